@@ -79,6 +79,8 @@ extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+void            lapictimer(int);
+void            lapicipi(int, int);
 void            microdelay(int);
 
 // log.c
@@ -123,7 +125,7 @@ void            __yield(void);
 // custom
 void            yield(void);
 void            demote(struct proc*);
-void            elapse(void);
+int             timeup(void);
 void            boost(void);
 void            schedulerLock(int);
 void            schedulerUnlock(int);
@@ -0,0 +1,17571 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 a0 10 00       	mov    $0x10a000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc f0 6d 11 80       	mov    $0x80116df0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 50 31 10 80       	mov    $0x80103150,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <binit>:
+  struct buf head;
+} bcache;
+
+void
+binit(void)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	53                   	push   %ebx
+
+//PAGEBREAK!
+  // Create linked list of buffers
+  bcache.head.prev = &bcache.head;
+  bcache.head.next = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100044:	bb 54 b5 10 80       	mov    $0x8010b554,%ebx
+{
+80100049:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010004c:	68 20 83 10 80       	push   $0x80108320
+80100051:	68 20 b5 10 80       	push   $0x8010b520
+80100056:	e8 95 52 00 00       	call   801052f0 <initlock>
+  bcache.head.next = &bcache.head;
+8010005b:	83 c4 10             	add    $0x10,%esp
+8010005e:	b8 1c fc 10 80       	mov    $0x8010fc1c,%eax
+  bcache.head.prev = &bcache.head;
+80100063:	c7 05 6c fc 10 80 1c 	movl   $0x8010fc1c,0x8010fc6c
+8010006a:	fc 10 80 
+  bcache.head.next = &bcache.head;
+8010006d:	c7 05 70 fc 10 80 1c 	movl   $0x8010fc1c,0x8010fc70
+80100074:	fc 10 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100077:	eb 09                	jmp    80100082 <binit+0x42>
+80100079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100080:	89 d3                	mov    %edx,%ebx
+    b->next = bcache.head.next;
+80100082:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+    initsleeplock(&b->lock, "buffer");
+80100085:	83 ec 08             	sub    $0x8,%esp
+80100088:	8d 43 0c             	lea    0xc(%ebx),%eax
+    b->prev = &bcache.head;
+8010008b:	c7 43 50 1c fc 10 80 	movl   $0x8010fc1c,0x50(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100092:	68 27 83 10 80       	push   $0x80108327
+80100097:	50                   	push   %eax
+80100098:	e8 23 51 00 00       	call   801051c0 <initsleeplock>
+    bcache.head.next->prev = b;
+8010009d:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000a2:	8d 93 5c 02 00 00    	lea    0x25c(%ebx),%edx
+801000a8:	83 c4 10             	add    $0x10,%esp
+    bcache.head.next->prev = b;
+801000ab:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+801000ae:	89 d8                	mov    %ebx,%eax
+801000b0:	89 1d 70 fc 10 80    	mov    %ebx,0x8010fc70
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000b6:	81 fb c0 f9 10 80    	cmp    $0x8010f9c0,%ebx
+801000bc:	75 c2                	jne    80100080 <binit+0x40>
+  }
+}
+801000be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801000c1:	c9                   	leave
+801000c2:	c3                   	ret
+801000c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801000d0 <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801000d0:	55                   	push   %ebp
+801000d1:	89 e5                	mov    %esp,%ebp
+801000d3:	57                   	push   %edi
+801000d4:	56                   	push   %esi
+801000d5:	53                   	push   %ebx
+801000d6:	83 ec 18             	sub    $0x18,%esp
+801000d9:	8b 75 08             	mov    0x8(%ebp),%esi
+801000dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&bcache.lock);
+801000df:	68 20 b5 10 80       	push   $0x8010b520
+801000e4:	e8 e7 53 00 00       	call   801054d0 <acquire>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+801000e9:	8b 1d 70 fc 10 80    	mov    0x8010fc70,%ebx
+801000ef:	83 c4 10             	add    $0x10,%esp
+801000f2:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+801000f8:	75 11                	jne    8010010b <bread+0x3b>
+801000fa:	eb 24                	jmp    80100120 <bread+0x50>
+801000fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100100:	8b 5b 54             	mov    0x54(%ebx),%ebx
+80100103:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+80100109:	74 15                	je     80100120 <bread+0x50>
+    if(b->dev == dev && b->blockno == blockno){
+8010010b:	3b 73 04             	cmp    0x4(%ebx),%esi
+8010010e:	75 f0                	jne    80100100 <bread+0x30>
+80100110:	3b 7b 08             	cmp    0x8(%ebx),%edi
+80100113:	75 eb                	jne    80100100 <bread+0x30>
+      b->refcnt++;
+80100115:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+80100119:	eb 3f                	jmp    8010015a <bread+0x8a>
+8010011b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010011f:	90                   	nop
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+80100120:	8b 1d 6c fc 10 80    	mov    0x8010fc6c,%ebx
+80100126:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+8010012c:	75 0d                	jne    8010013b <bread+0x6b>
+8010012e:	eb 6e                	jmp    8010019e <bread+0xce>
+80100130:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100133:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+80100139:	74 63                	je     8010019e <bread+0xce>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+8010013b:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010013e:	85 c0                	test   %eax,%eax
+80100140:	75 ee                	jne    80100130 <bread+0x60>
+80100142:	f6 03 04             	testb  $0x4,(%ebx)
+80100145:	75 e9                	jne    80100130 <bread+0x60>
+      b->dev = dev;
+80100147:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+8010014a:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+8010014d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+80100153:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+8010015a:	83 ec 0c             	sub    $0xc,%esp
+8010015d:	68 20 b5 10 80       	push   $0x8010b520
+80100162:	e8 09 53 00 00       	call   80105470 <release>
+      acquiresleep(&b->lock);
+80100167:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010016a:	89 04 24             	mov    %eax,(%esp)
+8010016d:	e8 8e 50 00 00       	call   80105200 <acquiresleep>
+      return b;
+80100172:	83 c4 10             	add    $0x10,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100175:	f6 03 02             	testb  $0x2,(%ebx)
+80100178:	74 0e                	je     80100188 <bread+0xb8>
+    iderw(b);
+  }
+  return b;
+}
+8010017a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010017d:	89 d8                	mov    %ebx,%eax
+8010017f:	5b                   	pop    %ebx
+80100180:	5e                   	pop    %esi
+80100181:	5f                   	pop    %edi
+80100182:	5d                   	pop    %ebp
+80100183:	c3                   	ret
+80100184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iderw(b);
+80100188:	83 ec 0c             	sub    $0xc,%esp
+8010018b:	53                   	push   %ebx
+8010018c:	e8 bf 21 00 00       	call   80102350 <iderw>
+80100191:	83 c4 10             	add    $0x10,%esp
+}
+80100194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100197:	89 d8                	mov    %ebx,%eax
+80100199:	5b                   	pop    %ebx
+8010019a:	5e                   	pop    %esi
+8010019b:	5f                   	pop    %edi
+8010019c:	5d                   	pop    %ebp
+8010019d:	c3                   	ret
+  panic("bget: no buffers");
+8010019e:	83 ec 0c             	sub    $0xc,%esp
+801001a1:	68 2e 83 10 80       	push   $0x8010832e
+801001a6:	e8 d5 01 00 00       	call   80100380 <panic>
+801001ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001af:	90                   	nop
+
+801001b0 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801001b0:	55                   	push   %ebp
+801001b1:	89 e5                	mov    %esp,%ebp
+801001b3:	53                   	push   %ebx
+801001b4:	83 ec 10             	sub    $0x10,%esp
+801001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001ba:	8d 43 0c             	lea    0xc(%ebx),%eax
+801001bd:	50                   	push   %eax
+801001be:	e8 dd 50 00 00       	call   801052a0 <holdingsleep>
+801001c3:	83 c4 10             	add    $0x10,%esp
+801001c6:	85 c0                	test   %eax,%eax
+801001c8:	74 0f                	je     801001d9 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801001ca:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+801001cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801001d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001d3:	c9                   	leave
+  iderw(b);
+801001d4:	e9 77 21 00 00       	jmp    80102350 <iderw>
+    panic("bwrite");
+801001d9:	83 ec 0c             	sub    $0xc,%esp
+801001dc:	68 3f 83 10 80       	push   $0x8010833f
+801001e1:	e8 9a 01 00 00       	call   80100380 <panic>
+801001e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801001f0 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+801001f0:	55                   	push   %ebp
+801001f1:	89 e5                	mov    %esp,%ebp
+801001f3:	56                   	push   %esi
+801001f4:	53                   	push   %ebx
+801001f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001f8:	8d 73 0c             	lea    0xc(%ebx),%esi
+801001fb:	83 ec 0c             	sub    $0xc,%esp
+801001fe:	56                   	push   %esi
+801001ff:	e8 9c 50 00 00       	call   801052a0 <holdingsleep>
+80100204:	83 c4 10             	add    $0x10,%esp
+80100207:	85 c0                	test   %eax,%eax
+80100209:	74 63                	je     8010026e <brelse+0x7e>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010020b:	83 ec 0c             	sub    $0xc,%esp
+8010020e:	56                   	push   %esi
+8010020f:	e8 4c 50 00 00       	call   80105260 <releasesleep>
+
+  acquire(&bcache.lock);
+80100214:	c7 04 24 20 b5 10 80 	movl   $0x8010b520,(%esp)
+8010021b:	e8 b0 52 00 00       	call   801054d0 <acquire>
+  b->refcnt--;
+80100220:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  if (b->refcnt == 0) {
+80100223:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100226:	83 e8 01             	sub    $0x1,%eax
+80100229:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+8010022c:	85 c0                	test   %eax,%eax
+8010022e:	75 2c                	jne    8010025c <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+80100230:	8b 53 54             	mov    0x54(%ebx),%edx
+80100233:	8b 43 50             	mov    0x50(%ebx),%eax
+80100236:	89 42 50             	mov    %eax,0x50(%edx)
+    b->prev->next = b->next;
+80100239:	8b 53 54             	mov    0x54(%ebx),%edx
+8010023c:	89 50 54             	mov    %edx,0x54(%eax)
+    b->next = bcache.head.next;
+8010023f:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+    b->prev = &bcache.head;
+80100244:	c7 43 50 1c fc 10 80 	movl   $0x8010fc1c,0x50(%ebx)
+    b->next = bcache.head.next;
+8010024b:	89 43 54             	mov    %eax,0x54(%ebx)
+    bcache.head.next->prev = b;
+8010024e:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+80100253:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100256:	89 1d 70 fc 10 80    	mov    %ebx,0x8010fc70
+  }
+  
+  release(&bcache.lock);
+8010025c:	c7 45 08 20 b5 10 80 	movl   $0x8010b520,0x8(%ebp)
+}
+80100263:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100266:	5b                   	pop    %ebx
+80100267:	5e                   	pop    %esi
+80100268:	5d                   	pop    %ebp
+  release(&bcache.lock);
+80100269:	e9 02 52 00 00       	jmp    80105470 <release>
+    panic("brelse");
+8010026e:	83 ec 0c             	sub    $0xc,%esp
+80100271:	68 46 83 10 80       	push   $0x80108346
+80100276:	e8 05 01 00 00       	call   80100380 <panic>
+8010027b:	66 90                	xchg   %ax,%ax
+8010027d:	66 90                	xchg   %ax,%ax
+8010027f:	90                   	nop
+
+80100280 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100280:	55                   	push   %ebp
+80100281:	89 e5                	mov    %esp,%ebp
+80100283:	57                   	push   %edi
+80100284:	56                   	push   %esi
+80100285:	53                   	push   %ebx
+80100286:	83 ec 18             	sub    $0x18,%esp
+80100289:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010028c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010028f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100292:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100294:	e8 17 16 00 00       	call   801018b0 <iunlock>
+  acquire(&cons.lock);
+80100299:	c7 04 24 20 ff 10 80 	movl   $0x8010ff20,(%esp)
+801002a0:	e8 2b 52 00 00       	call   801054d0 <acquire>
+  while(n > 0){
+801002a5:	83 c4 10             	add    $0x10,%esp
+801002a8:	85 db                	test   %ebx,%ebx
+801002aa:	0f 8e 94 00 00 00    	jle    80100344 <consoleread+0xc4>
+    while(input.r == input.w){
+801002b0:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+801002b5:	39 05 04 ff 10 80    	cmp    %eax,0x8010ff04
+801002bb:	74 25                	je     801002e2 <consoleread+0x62>
+801002bd:	eb 59                	jmp    80100318 <consoleread+0x98>
+801002bf:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801002c0:	83 ec 08             	sub    $0x8,%esp
+801002c3:	68 20 ff 10 80       	push   $0x8010ff20
+801002c8:	68 00 ff 10 80       	push   $0x8010ff00
+801002cd:	e8 5e 48 00 00       	call   80104b30 <sleep>
+    while(input.r == input.w){
+801002d2:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+801002d7:	83 c4 10             	add    $0x10,%esp
+801002da:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+801002e0:	75 36                	jne    80100318 <consoleread+0x98>
+      if(myproc()->killed){
+801002e2:	e8 99 3b 00 00       	call   80103e80 <myproc>
+801002e7:	8b 48 24             	mov    0x24(%eax),%ecx
+801002ea:	85 c9                	test   %ecx,%ecx
+801002ec:	74 d2                	je     801002c0 <consoleread+0x40>
+        release(&cons.lock);
+801002ee:	83 ec 0c             	sub    $0xc,%esp
+801002f1:	68 20 ff 10 80       	push   $0x8010ff20
+801002f6:	e8 75 51 00 00       	call   80105470 <release>
+        ilock(ip);
+801002fb:	5a                   	pop    %edx
+801002fc:	ff 75 08             	push   0x8(%ebp)
+801002ff:	e8 cc 14 00 00       	call   801017d0 <ilock>
+        return -1;
+80100304:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010030a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010030f:	5b                   	pop    %ebx
+80100310:	5e                   	pop    %esi
+80100311:	5f                   	pop    %edi
+80100312:	5d                   	pop    %ebp
+80100313:	c3                   	ret
+80100314:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100318:	8d 50 01             	lea    0x1(%eax),%edx
+8010031b:	89 15 00 ff 10 80    	mov    %edx,0x8010ff00
+80100321:	89 c2                	mov    %eax,%edx
+80100323:	83 e2 7f             	and    $0x7f,%edx
+80100326:	0f be 8a 80 fe 10 80 	movsbl -0x7fef0180(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010032d:	80 f9 04             	cmp    $0x4,%cl
+80100330:	74 37                	je     80100369 <consoleread+0xe9>
+    *dst++ = c;
+80100332:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100335:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100338:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010033b:	83 f9 0a             	cmp    $0xa,%ecx
+8010033e:	0f 85 64 ff ff ff    	jne    801002a8 <consoleread+0x28>
+  release(&cons.lock);
+80100344:	83 ec 0c             	sub    $0xc,%esp
+80100347:	68 20 ff 10 80       	push   $0x8010ff20
+8010034c:	e8 1f 51 00 00       	call   80105470 <release>
+  ilock(ip);
+80100351:	58                   	pop    %eax
+80100352:	ff 75 08             	push   0x8(%ebp)
+80100355:	e8 76 14 00 00       	call   801017d0 <ilock>
+  return target - n;
+8010035a:	89 f8                	mov    %edi,%eax
+8010035c:	83 c4 10             	add    $0x10,%esp
+}
+8010035f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100362:	29 d8                	sub    %ebx,%eax
+}
+80100364:	5b                   	pop    %ebx
+80100365:	5e                   	pop    %esi
+80100366:	5f                   	pop    %edi
+80100367:	5d                   	pop    %ebp
+80100368:	c3                   	ret
+      if(n < target){
+80100369:	39 fb                	cmp    %edi,%ebx
+8010036b:	73 d7                	jae    80100344 <consoleread+0xc4>
+        input.r--;
+8010036d:	a3 00 ff 10 80       	mov    %eax,0x8010ff00
+80100372:	eb d0                	jmp    80100344 <consoleread+0xc4>
+80100374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010037f:	90                   	nop
+
+80100380 <panic>:
+{
+80100380:	55                   	push   %ebp
+80100381:	89 e5                	mov    %esp,%ebp
+80100383:	56                   	push   %esi
+80100384:	53                   	push   %ebx
+80100385:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100388:	fa                   	cli
+  cons.locking = 0;
+80100389:	c7 05 54 ff 10 80 00 	movl   $0x0,0x8010ff54
+80100390:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100393:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100396:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100399:	e8 c2 25 00 00       	call   80102960 <lapicid>
+8010039e:	83 ec 08             	sub    $0x8,%esp
+801003a1:	50                   	push   %eax
+801003a2:	68 4d 83 10 80       	push   $0x8010834d
+801003a7:	e8 04 03 00 00       	call   801006b0 <cprintf>
+  cprintf(s);
+801003ac:	58                   	pop    %eax
+801003ad:	ff 75 08             	push   0x8(%ebp)
+801003b0:	e8 fb 02 00 00       	call   801006b0 <cprintf>
+  cprintf("\n");
+801003b5:	c7 04 24 61 8d 10 80 	movl   $0x80108d61,(%esp)
+801003bc:	e8 ef 02 00 00       	call   801006b0 <cprintf>
+  getcallerpcs(&s, pcs);
+801003c1:	8d 45 08             	lea    0x8(%ebp),%eax
+801003c4:	5a                   	pop    %edx
+801003c5:	59                   	pop    %ecx
+801003c6:	53                   	push   %ebx
+801003c7:	50                   	push   %eax
+801003c8:	e8 43 4f 00 00       	call   80105310 <getcallerpcs>
+  for(i=0; i<10; i++)
+801003cd:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801003d0:	83 ec 08             	sub    $0x8,%esp
+801003d3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801003d5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801003d8:	68 61 83 10 80       	push   $0x80108361
+801003dd:	e8 ce 02 00 00       	call   801006b0 <cprintf>
+  for(i=0; i<10; i++)
+801003e2:	83 c4 10             	add    $0x10,%esp
+801003e5:	39 f3                	cmp    %esi,%ebx
+801003e7:	75 e7                	jne    801003d0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801003e9:	c7 05 58 ff 10 80 01 	movl   $0x1,0x8010ff58
+801003f0:	00 00 00 
+  for(;;)
+801003f3:	eb fe                	jmp    801003f3 <panic+0x73>
+801003f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100400 <consputc.part.0>:
+consputc(int c)
+80100400:	55                   	push   %ebp
+80100401:	89 e5                	mov    %esp,%ebp
+80100403:	57                   	push   %edi
+80100404:	56                   	push   %esi
+80100405:	53                   	push   %ebx
+80100406:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100409:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010040e:	0f 84 cc 00 00 00    	je     801004e0 <consputc.part.0+0xe0>
+    uartputc(c);
+80100414:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100417:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010041c:	89 c3                	mov    %eax,%ebx
+8010041e:	50                   	push   %eax
+8010041f:	e8 ac 69 00 00       	call   80106dd0 <uartputc>
+80100424:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100429:	89 fa                	mov    %edi,%edx
+8010042b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010042c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100431:	89 f2                	mov    %esi,%edx
+80100433:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100434:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100437:	89 fa                	mov    %edi,%edx
+80100439:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010043e:	c1 e1 08             	shl    $0x8,%ecx
+80100441:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100442:	89 f2                	mov    %esi,%edx
+80100444:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100445:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100448:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010044b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010044d:	83 fb 0a             	cmp    $0xa,%ebx
+80100450:	75 76                	jne    801004c8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100452:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100457:	f7 e2                	mul    %edx
+80100459:	c1 ea 06             	shr    $0x6,%edx
+8010045c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010045f:	c1 e0 04             	shl    $0x4,%eax
+80100462:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100465:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010046b:	0f 8f 2f 01 00 00    	jg     801005a0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100471:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100477:	0f 8f c3 00 00 00    	jg     80100540 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010047d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010047f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100486:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100489:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010048c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100491:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100496:	89 da                	mov    %ebx,%edx
+80100498:	ee                   	out    %al,(%dx)
+80100499:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010049e:	89 f8                	mov    %edi,%eax
+801004a0:	89 ca                	mov    %ecx,%edx
+801004a2:	ee                   	out    %al,(%dx)
+801004a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801004a8:	89 da                	mov    %ebx,%edx
+801004aa:	ee                   	out    %al,(%dx)
+801004ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801004af:	89 ca                	mov    %ecx,%edx
+801004b1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801004b2:	b8 20 07 00 00       	mov    $0x720,%eax
+801004b7:	66 89 06             	mov    %ax,(%esi)
+}
+801004ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801004bd:	5b                   	pop    %ebx
+801004be:	5e                   	pop    %esi
+801004bf:	5f                   	pop    %edi
+801004c0:	5d                   	pop    %ebp
+801004c1:	c3                   	ret
+801004c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801004c8:	0f b6 db             	movzbl %bl,%ebx
+801004cb:	8d 70 01             	lea    0x1(%eax),%esi
+801004ce:	80 cf 07             	or     $0x7,%bh
+801004d1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801004d8:	80 
+801004d9:	eb 8a                	jmp    80100465 <consputc.part.0+0x65>
+801004db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801004df:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801004e0:	83 ec 0c             	sub    $0xc,%esp
+801004e3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801004e8:	6a 08                	push   $0x8
+801004ea:	e8 e1 68 00 00       	call   80106dd0 <uartputc>
+801004ef:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801004f6:	e8 d5 68 00 00       	call   80106dd0 <uartputc>
+801004fb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100502:	e8 c9 68 00 00       	call   80106dd0 <uartputc>
+80100507:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010050c:	89 f2                	mov    %esi,%edx
+8010050e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010050f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100514:	89 da                	mov    %ebx,%edx
+80100516:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100517:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010051a:	89 f2                	mov    %esi,%edx
+8010051c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100521:	c1 e1 08             	shl    $0x8,%ecx
+80100524:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100525:	89 da                	mov    %ebx,%edx
+80100527:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100528:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010052b:	83 c4 10             	add    $0x10,%esp
+8010052e:	09 ce                	or     %ecx,%esi
+80100530:	74 5e                	je     80100590 <consputc.part.0+0x190>
+80100532:	83 ee 01             	sub    $0x1,%esi
+80100535:	e9 2b ff ff ff       	jmp    80100465 <consputc.part.0+0x65>
+8010053a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100540:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100543:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100546:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+8010054d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100552:	68 60 0e 00 00       	push   $0xe60
+80100557:	68 a0 80 0b 80       	push   $0x800b80a0
+8010055c:	68 00 80 0b 80       	push   $0x800b8000
+80100561:	e8 da 50 00 00       	call   80105640 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100566:	b8 80 07 00 00       	mov    $0x780,%eax
+8010056b:	83 c4 0c             	add    $0xc,%esp
+8010056e:	29 d8                	sub    %ebx,%eax
+80100570:	01 c0                	add    %eax,%eax
+80100572:	50                   	push   %eax
+80100573:	6a 00                	push   $0x0
+80100575:	56                   	push   %esi
+80100576:	e8 35 50 00 00       	call   801055b0 <memset>
+  outb(CRTPORT+1, pos);
+8010057b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+8010057e:	83 c4 10             	add    $0x10,%esp
+80100581:	e9 06 ff ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+80100586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010058d:	8d 76 00             	lea    0x0(%esi),%esi
+80100590:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100594:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100599:	31 ff                	xor    %edi,%edi
+8010059b:	e9 ec fe ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+801005a0:	83 ec 0c             	sub    $0xc,%esp
+801005a3:	68 65 83 10 80       	push   $0x80108365
+801005a8:	e8 d3 fd ff ff       	call   80100380 <panic>
+801005ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801005b0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801005b0:	55                   	push   %ebp
+801005b1:	89 e5                	mov    %esp,%ebp
+801005b3:	57                   	push   %edi
+801005b4:	56                   	push   %esi
+801005b5:	53                   	push   %ebx
+801005b6:	83 ec 18             	sub    $0x18,%esp
+801005b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+801005bc:	ff 75 08             	push   0x8(%ebp)
+801005bf:	e8 ec 12 00 00       	call   801018b0 <iunlock>
+  acquire(&cons.lock);
+801005c4:	c7 04 24 20 ff 10 80 	movl   $0x8010ff20,(%esp)
+801005cb:	e8 00 4f 00 00       	call   801054d0 <acquire>
+  for(i = 0; i < n; i++)
+801005d0:	83 c4 10             	add    $0x10,%esp
+801005d3:	85 f6                	test   %esi,%esi
+801005d5:	7e 25                	jle    801005fc <consolewrite+0x4c>
+801005d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801005da:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+801005dd:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+    consputc(buf[i] & 0xff);
+801005e3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+801005e6:	85 d2                	test   %edx,%edx
+801005e8:	74 06                	je     801005f0 <consolewrite+0x40>
+  asm volatile("cli");
+801005ea:	fa                   	cli
+    for(;;)
+801005eb:	eb fe                	jmp    801005eb <consolewrite+0x3b>
+801005ed:	8d 76 00             	lea    0x0(%esi),%esi
+801005f0:	e8 0b fe ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; i < n; i++)
+801005f5:	83 c3 01             	add    $0x1,%ebx
+801005f8:	39 df                	cmp    %ebx,%edi
+801005fa:	75 e1                	jne    801005dd <consolewrite+0x2d>
+  release(&cons.lock);
+801005fc:	83 ec 0c             	sub    $0xc,%esp
+801005ff:	68 20 ff 10 80       	push   $0x8010ff20
+80100604:	e8 67 4e 00 00       	call   80105470 <release>
+  ilock(ip);
+80100609:	58                   	pop    %eax
+8010060a:	ff 75 08             	push   0x8(%ebp)
+8010060d:	e8 be 11 00 00       	call   801017d0 <ilock>
+
+  return n;
+}
+80100612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100615:	89 f0                	mov    %esi,%eax
+80100617:	5b                   	pop    %ebx
+80100618:	5e                   	pop    %esi
+80100619:	5f                   	pop    %edi
+8010061a:	5d                   	pop    %ebp
+8010061b:	c3                   	ret
+8010061c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100620 <printint>:
+{
+80100620:	55                   	push   %ebp
+80100621:	89 e5                	mov    %esp,%ebp
+80100623:	57                   	push   %edi
+80100624:	56                   	push   %esi
+80100625:	89 c6                	mov    %eax,%esi
+80100627:	53                   	push   %ebx
+80100628:	89 d3                	mov    %edx,%ebx
+8010062a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010062d:	85 c9                	test   %ecx,%ecx
+8010062f:	74 04                	je     80100635 <printint+0x15>
+80100631:	85 c0                	test   %eax,%eax
+80100633:	78 63                	js     80100698 <printint+0x78>
+    x = xx;
+80100635:	89 f1                	mov    %esi,%ecx
+80100637:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100639:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010063c:	31 f6                	xor    %esi,%esi
+8010063e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100640:	89 c8                	mov    %ecx,%eax
+80100642:	31 d2                	xor    %edx,%edx
+80100644:	89 f7                	mov    %esi,%edi
+80100646:	f7 f3                	div    %ebx
+80100648:	8d 76 01             	lea    0x1(%esi),%esi
+8010064b:	0f b6 92 90 83 10 80 	movzbl -0x7fef7c70(%edx),%edx
+80100652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100656:	89 ca                	mov    %ecx,%edx
+80100658:	89 c1                	mov    %eax,%ecx
+8010065a:	39 da                	cmp    %ebx,%edx
+8010065c:	73 e2                	jae    80100640 <printint+0x20>
+  if(sign)
+8010065e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100661:	85 c0                	test   %eax,%eax
+80100663:	74 07                	je     8010066c <printint+0x4c>
+    buf[i++] = '-';
+80100665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+8010066a:	89 f7                	mov    %esi,%edi
+8010066c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+8010066f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100671:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+    consputc(buf[i]);
+80100677:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+8010067a:	85 d2                	test   %edx,%edx
+8010067c:	74 0a                	je     80100688 <printint+0x68>
+8010067e:	fa                   	cli
+    for(;;)
+8010067f:	eb fe                	jmp    8010067f <printint+0x5f>
+80100681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100688:	e8 73 fd ff ff       	call   80100400 <consputc.part.0>
+  while(--i >= 0)
+8010068d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100690:	39 df                	cmp    %ebx,%edi
+80100692:	74 0c                	je     801006a0 <printint+0x80>
+80100694:	89 c7                	mov    %eax,%edi
+80100696:	eb d9                	jmp    80100671 <printint+0x51>
+80100698:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+8010069a:	89 f1                	mov    %esi,%ecx
+8010069c:	f7 d9                	neg    %ecx
+8010069e:	eb 99                	jmp    80100639 <printint+0x19>
+}
+801006a0:	83 c4 2c             	add    $0x2c,%esp
+801006a3:	5b                   	pop    %ebx
+801006a4:	5e                   	pop    %esi
+801006a5:	5f                   	pop    %edi
+801006a6:	5d                   	pop    %ebp
+801006a7:	c3                   	ret
+801006a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006af:	90                   	nop
+
+801006b0 <cprintf>:
+{
+801006b0:	55                   	push   %ebp
+801006b1:	89 e5                	mov    %esp,%ebp
+801006b3:	57                   	push   %edi
+801006b4:	56                   	push   %esi
+801006b5:	53                   	push   %ebx
+801006b6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+801006b9:	8b 3d 54 ff 10 80    	mov    0x8010ff54,%edi
+  if (fmt == 0)
+801006bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+801006c2:	85 ff                	test   %edi,%edi
+801006c4:	0f 85 36 01 00 00    	jne    80100800 <cprintf+0x150>
+  if (fmt == 0)
+801006ca:	85 f6                	test   %esi,%esi
+801006cc:	0f 84 e0 01 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006d2:	0f b6 06             	movzbl (%esi),%eax
+801006d5:	85 c0                	test   %eax,%eax
+801006d7:	74 6b                	je     80100744 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+801006d9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006dc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801006df:	31 db                	xor    %ebx,%ebx
+801006e1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+801006e3:	83 f8 25             	cmp    $0x25,%eax
+801006e6:	0f 85 dc 00 00 00    	jne    801007c8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+801006ec:	83 c3 01             	add    $0x1,%ebx
+801006ef:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+801006f3:	85 c9                	test   %ecx,%ecx
+801006f5:	74 42                	je     80100739 <cprintf+0x89>
+    switch(c){
+801006f7:	83 f9 70             	cmp    $0x70,%ecx
+801006fa:	0f 84 99 00 00 00    	je     80100799 <cprintf+0xe9>
+80100700:	7f 4e                	jg     80100750 <cprintf+0xa0>
+80100702:	83 f9 25             	cmp    $0x25,%ecx
+80100705:	0f 84 cd 00 00 00    	je     801007d8 <cprintf+0x128>
+8010070b:	83 f9 64             	cmp    $0x64,%ecx
+8010070e:	0f 85 24 01 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100714:	8d 47 04             	lea    0x4(%edi),%eax
+80100717:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010071c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100721:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100724:	8b 07                	mov    (%edi),%eax
+80100726:	e8 f5 fe ff ff       	call   80100620 <printint>
+8010072b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010072e:	83 c3 01             	add    $0x1,%ebx
+80100731:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100735:	85 c0                	test   %eax,%eax
+80100737:	75 aa                	jne    801006e3 <cprintf+0x33>
+80100739:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+8010073c:	85 ff                	test   %edi,%edi
+8010073e:	0f 85 df 00 00 00    	jne    80100823 <cprintf+0x173>
+}
+80100744:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100747:	5b                   	pop    %ebx
+80100748:	5e                   	pop    %esi
+80100749:	5f                   	pop    %edi
+8010074a:	5d                   	pop    %ebp
+8010074b:	c3                   	ret
+8010074c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100750:	83 f9 73             	cmp    $0x73,%ecx
+80100753:	75 3b                	jne    80100790 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100755:	8b 17                	mov    (%edi),%edx
+80100757:	8d 47 04             	lea    0x4(%edi),%eax
+8010075a:	85 d2                	test   %edx,%edx
+8010075c:	0f 85 0e 01 00 00    	jne    80100870 <cprintf+0x1c0>
+80100762:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100767:	bf 78 83 10 80       	mov    $0x80108378,%edi
+8010076c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010076f:	89 fb                	mov    %edi,%ebx
+80100771:	89 f7                	mov    %esi,%edi
+80100773:	89 c6                	mov    %eax,%esi
+80100775:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100778:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+8010077e:	85 d2                	test   %edx,%edx
+80100780:	0f 84 fe 00 00 00    	je     80100884 <cprintf+0x1d4>
+80100786:	fa                   	cli
+    for(;;)
+80100787:	eb fe                	jmp    80100787 <cprintf+0xd7>
+80100789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100790:	83 f9 78             	cmp    $0x78,%ecx
+80100793:	0f 85 9f 00 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100799:	8d 47 04             	lea    0x4(%edi),%eax
+8010079c:	31 c9                	xor    %ecx,%ecx
+8010079e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007a3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+801007a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801007a9:	8b 07                	mov    (%edi),%eax
+801007ab:	e8 70 fe ff ff       	call   80100620 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+801007b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b7:	85 c0                	test   %eax,%eax
+801007b9:	0f 85 24 ff ff ff    	jne    801006e3 <cprintf+0x33>
+801007bf:	e9 75 ff ff ff       	jmp    80100739 <cprintf+0x89>
+801007c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+801007c8:	8b 0d 58 ff 10 80    	mov    0x8010ff58,%ecx
+801007ce:	85 c9                	test   %ecx,%ecx
+801007d0:	74 15                	je     801007e7 <cprintf+0x137>
+801007d2:	fa                   	cli
+    for(;;)
+801007d3:	eb fe                	jmp    801007d3 <cprintf+0x123>
+801007d5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+801007d8:	8b 0d 58 ff 10 80    	mov    0x8010ff58,%ecx
+801007de:	85 c9                	test   %ecx,%ecx
+801007e0:	75 7e                	jne    80100860 <cprintf+0x1b0>
+801007e2:	b8 25 00 00 00       	mov    $0x25,%eax
+801007e7:	e8 14 fc ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007ec:	83 c3 01             	add    $0x1,%ebx
+801007ef:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+801007f3:	85 c0                	test   %eax,%eax
+801007f5:	0f 85 e8 fe ff ff    	jne    801006e3 <cprintf+0x33>
+801007fb:	e9 39 ff ff ff       	jmp    80100739 <cprintf+0x89>
+    acquire(&cons.lock);
+80100800:	83 ec 0c             	sub    $0xc,%esp
+80100803:	68 20 ff 10 80       	push   $0x8010ff20
+80100808:	e8 c3 4c 00 00       	call   801054d0 <acquire>
+  if (fmt == 0)
+8010080d:	83 c4 10             	add    $0x10,%esp
+80100810:	85 f6                	test   %esi,%esi
+80100812:	0f 84 9a 00 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100818:	0f b6 06             	movzbl (%esi),%eax
+8010081b:	85 c0                	test   %eax,%eax
+8010081d:	0f 85 b6 fe ff ff    	jne    801006d9 <cprintf+0x29>
+    release(&cons.lock);
+80100823:	83 ec 0c             	sub    $0xc,%esp
+80100826:	68 20 ff 10 80       	push   $0x8010ff20
+8010082b:	e8 40 4c 00 00       	call   80105470 <release>
+80100830:	83 c4 10             	add    $0x10,%esp
+80100833:	e9 0c ff ff ff       	jmp    80100744 <cprintf+0x94>
+  if(panicked){
+80100838:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+8010083e:	85 d2                	test   %edx,%edx
+80100840:	75 26                	jne    80100868 <cprintf+0x1b8>
+80100842:	b8 25 00 00 00       	mov    $0x25,%eax
+80100847:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010084a:	e8 b1 fb ff ff       	call   80100400 <consputc.part.0>
+8010084f:	a1 58 ff 10 80       	mov    0x8010ff58,%eax
+80100854:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100857:	85 c0                	test   %eax,%eax
+80100859:	74 4b                	je     801008a6 <cprintf+0x1f6>
+8010085b:	fa                   	cli
+    for(;;)
+8010085c:	eb fe                	jmp    8010085c <cprintf+0x1ac>
+8010085e:	66 90                	xchg   %ax,%ax
+80100860:	fa                   	cli
+80100861:	eb fe                	jmp    80100861 <cprintf+0x1b1>
+80100863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100867:	90                   	nop
+80100868:	fa                   	cli
+80100869:	eb fe                	jmp    80100869 <cprintf+0x1b9>
+8010086b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010086f:	90                   	nop
+      for(; *s; s++)
+80100870:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100873:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100875:	84 c9                	test   %cl,%cl
+80100877:	0f 85 ef fe ff ff    	jne    8010076c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+8010087d:	89 c7                	mov    %eax,%edi
+8010087f:	e9 aa fe ff ff       	jmp    8010072e <cprintf+0x7e>
+80100884:	e8 77 fb ff ff       	call   80100400 <consputc.part.0>
+      for(; *s; s++)
+80100889:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+8010088d:	83 c3 01             	add    $0x1,%ebx
+80100890:	84 c0                	test   %al,%al
+80100892:	0f 85 e0 fe ff ff    	jne    80100778 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100898:	89 f0                	mov    %esi,%eax
+8010089a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010089d:	89 fe                	mov    %edi,%esi
+8010089f:	89 c7                	mov    %eax,%edi
+801008a1:	e9 88 fe ff ff       	jmp    8010072e <cprintf+0x7e>
+801008a6:	89 c8                	mov    %ecx,%eax
+801008a8:	e8 53 fb ff ff       	call   80100400 <consputc.part.0>
+801008ad:	e9 7c fe ff ff       	jmp    8010072e <cprintf+0x7e>
+    panic("null fmt");
+801008b2:	83 ec 0c             	sub    $0xc,%esp
+801008b5:	68 7f 83 10 80       	push   $0x8010837f
+801008ba:	e8 c1 fa ff ff       	call   80100380 <panic>
+801008bf:	90                   	nop
+
+801008c0 <consoleintr>:
+{
+801008c0:	55                   	push   %ebp
+801008c1:	89 e5                	mov    %esp,%ebp
+801008c3:	57                   	push   %edi
+801008c4:	56                   	push   %esi
+  int c, doprocdump = 0;
+801008c5:	31 f6                	xor    %esi,%esi
+{
+801008c7:	53                   	push   %ebx
+801008c8:	83 ec 18             	sub    $0x18,%esp
+801008cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+801008ce:	68 20 ff 10 80       	push   $0x8010ff20
+801008d3:	e8 f8 4b 00 00       	call   801054d0 <acquire>
+  while((c = getc()) >= 0){
+801008d8:	83 c4 10             	add    $0x10,%esp
+801008db:	eb 1a                	jmp    801008f7 <consoleintr+0x37>
+801008dd:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+801008e0:	83 fb 08             	cmp    $0x8,%ebx
+801008e3:	0f 84 d7 00 00 00    	je     801009c0 <consoleintr+0x100>
+801008e9:	83 fb 10             	cmp    $0x10,%ebx
+801008ec:	0f 85 2d 01 00 00    	jne    80100a1f <consoleintr+0x15f>
+801008f2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+801008f7:	ff d7                	call   *%edi
+801008f9:	89 c3                	mov    %eax,%ebx
+801008fb:	85 c0                	test   %eax,%eax
+801008fd:	0f 88 e5 00 00 00    	js     801009e8 <consoleintr+0x128>
+    switch(c){
+80100903:	83 fb 15             	cmp    $0x15,%ebx
+80100906:	74 7a                	je     80100982 <consoleintr+0xc2>
+80100908:	7e d6                	jle    801008e0 <consoleintr+0x20>
+8010090a:	83 fb 7f             	cmp    $0x7f,%ebx
+8010090d:	0f 84 ad 00 00 00    	je     801009c0 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100913:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100918:	89 c2                	mov    %eax,%edx
+8010091a:	2b 15 00 ff 10 80    	sub    0x8010ff00,%edx
+80100920:	83 fa 7f             	cmp    $0x7f,%edx
+80100923:	77 d2                	ja     801008f7 <consoleintr+0x37>
+  if(panicked){
+80100925:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010092b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010092e:	83 e0 7f             	and    $0x7f,%eax
+80100931:	89 0d 08 ff 10 80    	mov    %ecx,0x8010ff08
+80100937:	88 98 80 fe 10 80    	mov    %bl,-0x7fef0180(%eax)
+  if(panicked){
+8010093d:	85 d2                	test   %edx,%edx
+8010093f:	0f 85 47 01 00 00    	jne    80100a8c <consoleintr+0x1cc>
+80100945:	89 d8                	mov    %ebx,%eax
+80100947:	e8 b4 fa ff ff       	call   80100400 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+8010094c:	83 fb 0a             	cmp    $0xa,%ebx
+8010094f:	0f 84 18 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+80100955:	83 fb 04             	cmp    $0x4,%ebx
+80100958:	0f 84 0f 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+8010095e:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+80100963:	83 e8 80             	sub    $0xffffff80,%eax
+80100966:	39 05 08 ff 10 80    	cmp    %eax,0x8010ff08
+8010096c:	75 89                	jne    801008f7 <consoleintr+0x37>
+8010096e:	e9 ff 00 00 00       	jmp    80100a72 <consoleintr+0x1b2>
+80100973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100977:	90                   	nop
+80100978:	b8 00 01 00 00       	mov    $0x100,%eax
+8010097d:	e8 7e fa ff ff       	call   80100400 <consputc.part.0>
+      while(input.e != input.w &&
+80100982:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100987:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+8010098d:	0f 84 64 ff ff ff    	je     801008f7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100993:	83 e8 01             	sub    $0x1,%eax
+80100996:	89 c2                	mov    %eax,%edx
+80100998:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010099b:	80 ba 80 fe 10 80 0a 	cmpb   $0xa,-0x7fef0180(%edx)
+801009a2:	0f 84 4f ff ff ff    	je     801008f7 <consoleintr+0x37>
+  if(panicked){
+801009a8:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.e--;
+801009ae:	a3 08 ff 10 80       	mov    %eax,0x8010ff08
+  if(panicked){
+801009b3:	85 d2                	test   %edx,%edx
+801009b5:	74 c1                	je     80100978 <consoleintr+0xb8>
+801009b7:	fa                   	cli
+    for(;;)
+801009b8:	eb fe                	jmp    801009b8 <consoleintr+0xf8>
+801009ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+801009c0:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+801009c5:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+801009cb:	0f 84 26 ff ff ff    	je     801008f7 <consoleintr+0x37>
+        input.e--;
+801009d1:	83 e8 01             	sub    $0x1,%eax
+801009d4:	a3 08 ff 10 80       	mov    %eax,0x8010ff08
+  if(panicked){
+801009d9:	a1 58 ff 10 80       	mov    0x8010ff58,%eax
+801009de:	85 c0                	test   %eax,%eax
+801009e0:	74 22                	je     80100a04 <consoleintr+0x144>
+801009e2:	fa                   	cli
+    for(;;)
+801009e3:	eb fe                	jmp    801009e3 <consoleintr+0x123>
+801009e5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+801009e8:	83 ec 0c             	sub    $0xc,%esp
+801009eb:	68 20 ff 10 80       	push   $0x8010ff20
+801009f0:	e8 7b 4a 00 00       	call   80105470 <release>
+  if(doprocdump) {
+801009f5:	83 c4 10             	add    $0x10,%esp
+801009f8:	85 f6                	test   %esi,%esi
+801009fa:	75 17                	jne    80100a13 <consoleintr+0x153>
+}
+801009fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009ff:	5b                   	pop    %ebx
+80100a00:	5e                   	pop    %esi
+80100a01:	5f                   	pop    %edi
+80100a02:	5d                   	pop    %ebp
+80100a03:	c3                   	ret
+80100a04:	b8 00 01 00 00       	mov    $0x100,%eax
+80100a09:	e8 f2 f9 ff ff       	call   80100400 <consputc.part.0>
+80100a0e:	e9 e4 fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a16:	5b                   	pop    %ebx
+80100a17:	5e                   	pop    %esi
+80100a18:	5f                   	pop    %edi
+80100a19:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+80100a1a:	e9 c1 42 00 00       	jmp    80104ce0 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100a1f:	85 db                	test   %ebx,%ebx
+80100a21:	0f 84 d0 fe ff ff    	je     801008f7 <consoleintr+0x37>
+80100a27:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100a2c:	89 c2                	mov    %eax,%edx
+80100a2e:	2b 15 00 ff 10 80    	sub    0x8010ff00,%edx
+80100a34:	83 fa 7f             	cmp    $0x7f,%edx
+80100a37:	0f 87 ba fe ff ff    	ja     801008f7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a3d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100a40:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a46:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100a49:	83 fb 0d             	cmp    $0xd,%ebx
+80100a4c:	0f 85 df fe ff ff    	jne    80100931 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a52:	89 0d 08 ff 10 80    	mov    %ecx,0x8010ff08
+80100a58:	c6 80 80 fe 10 80 0a 	movb   $0xa,-0x7fef0180(%eax)
+  if(panicked){
+80100a5f:	85 d2                	test   %edx,%edx
+80100a61:	75 29                	jne    80100a8c <consoleintr+0x1cc>
+80100a63:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100a68:	e8 93 f9 ff ff       	call   80100400 <consputc.part.0>
+          input.w = input.e;
+80100a6d:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+          wakeup(&input.r);
+80100a72:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100a75:	a3 04 ff 10 80       	mov    %eax,0x8010ff04
+          wakeup(&input.r);
+80100a7a:	68 00 ff 10 80       	push   $0x8010ff00
+80100a7f:	e8 7c 41 00 00       	call   80104c00 <wakeup>
+80100a84:	83 c4 10             	add    $0x10,%esp
+80100a87:	e9 6b fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a8c:	fa                   	cli
+    for(;;)
+80100a8d:	eb fe                	jmp    80100a8d <consoleintr+0x1cd>
+80100a8f:	90                   	nop
+
+80100a90 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100a90:	55                   	push   %ebp
+80100a91:	89 e5                	mov    %esp,%ebp
+80100a93:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100a96:	68 88 83 10 80       	push   $0x80108388
+80100a9b:	68 20 ff 10 80       	push   $0x8010ff20
+80100aa0:	e8 4b 48 00 00       	call   801052f0 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100aa5:	c7 05 0c 09 11 80 b0 	movl   $0x801005b0,0x8011090c
+80100aac:	05 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100aaf:	c7 05 08 09 11 80 80 	movl   $0x80100280,0x80110908
+80100ab6:	02 10 80 
+  cons.locking = 1;
+80100ab9:	c7 05 54 ff 10 80 01 	movl   $0x1,0x8010ff54
+80100ac0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100ac3:	58                   	pop    %eax
+80100ac4:	5a                   	pop    %edx
+80100ac5:	6a 00                	push   $0x0
+80100ac7:	6a 01                	push   $0x1
+80100ac9:	e8 12 1a 00 00       	call   801024e0 <ioapicenable>
+}
+80100ace:	83 c4 10             	add    $0x10,%esp
+80100ad1:	c9                   	leave
+80100ad2:	c3                   	ret
+80100ad3:	66 90                	xchg   %ax,%ax
+80100ad5:	66 90                	xchg   %ax,%ax
+80100ad7:	66 90                	xchg   %ax,%ax
+80100ad9:	66 90                	xchg   %ax,%ax
+80100adb:	66 90                	xchg   %ax,%ax
+80100add:	66 90                	xchg   %ax,%ax
+80100adf:	90                   	nop
+
+80100ae0 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100ae0:	55                   	push   %ebp
+80100ae1:	89 e5                	mov    %esp,%ebp
+80100ae3:	57                   	push   %edi
+80100ae4:	56                   	push   %esi
+80100ae5:	53                   	push   %ebx
+80100ae6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100aec:	e8 8f 33 00 00       	call   80103e80 <myproc>
+80100af1:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80100af7:	e8 64 23 00 00       	call   80102e60 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100afc:	83 ec 0c             	sub    $0xc,%esp
+80100aff:	ff 75 08             	push   0x8(%ebp)
+80100b02:	e8 f9 15 00 00       	call   80102100 <namei>
+80100b07:	83 c4 10             	add    $0x10,%esp
+80100b0a:	85 c0                	test   %eax,%eax
+80100b0c:	0f 84 30 03 00 00    	je     80100e42 <exec+0x362>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100b12:	83 ec 0c             	sub    $0xc,%esp
+80100b15:	89 c7                	mov    %eax,%edi
+80100b17:	50                   	push   %eax
+80100b18:	e8 b3 0c 00 00       	call   801017d0 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100b1d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100b23:	6a 34                	push   $0x34
+80100b25:	6a 00                	push   $0x0
+80100b27:	50                   	push   %eax
+80100b28:	57                   	push   %edi
+80100b29:	e8 b2 0f 00 00       	call   80101ae0 <readi>
+80100b2e:	83 c4 20             	add    $0x20,%esp
+80100b31:	83 f8 34             	cmp    $0x34,%eax
+80100b34:	0f 85 01 01 00 00    	jne    80100c3b <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100b3a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100b41:	45 4c 46 
+80100b44:	0f 85 f1 00 00 00    	jne    80100c3b <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100b4a:	e8 f1 73 00 00       	call   80107f40 <setupkvm>
+80100b4f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100b55:	85 c0                	test   %eax,%eax
+80100b57:	0f 84 de 00 00 00    	je     80100c3b <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b5d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100b64:	00 
+80100b65:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+80100b6b:	0f 84 a1 02 00 00    	je     80100e12 <exec+0x332>
+  sz = 0;
+80100b71:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100b78:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b7b:	31 db                	xor    %ebx,%ebx
+80100b7d:	e9 8c 00 00 00       	jmp    80100c0e <exec+0x12e>
+80100b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100b88:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100b8f:	75 6c                	jne    80100bfd <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100b91:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100b97:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100b9d:	0f 82 87 00 00 00    	jb     80100c2a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100ba3:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100ba9:	72 7f                	jb     80100c2a <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100bab:	83 ec 04             	sub    $0x4,%esp
+80100bae:	50                   	push   %eax
+80100baf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100bb5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bbb:	e8 b0 71 00 00       	call   80107d70 <allocuvm>
+80100bc0:	83 c4 10             	add    $0x10,%esp
+80100bc3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100bc9:	85 c0                	test   %eax,%eax
+80100bcb:	74 5d                	je     80100c2a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100bcd:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100bd3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100bd8:	75 50                	jne    80100c2a <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100bda:	83 ec 0c             	sub    $0xc,%esp
+80100bdd:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100be3:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100be9:	57                   	push   %edi
+80100bea:	50                   	push   %eax
+80100beb:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bf1:	e8 aa 70 00 00       	call   80107ca0 <loaduvm>
+80100bf6:	83 c4 20             	add    $0x20,%esp
+80100bf9:	85 c0                	test   %eax,%eax
+80100bfb:	78 2d                	js     80100c2a <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100bfd:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100c04:	83 c3 01             	add    $0x1,%ebx
+80100c07:	83 c6 20             	add    $0x20,%esi
+80100c0a:	39 d8                	cmp    %ebx,%eax
+80100c0c:	7e 52                	jle    80100c60 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100c0e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100c14:	6a 20                	push   $0x20
+80100c16:	56                   	push   %esi
+80100c17:	50                   	push   %eax
+80100c18:	57                   	push   %edi
+80100c19:	e8 c2 0e 00 00       	call   80101ae0 <readi>
+80100c1e:	83 c4 10             	add    $0x10,%esp
+80100c21:	83 f8 20             	cmp    $0x20,%eax
+80100c24:	0f 84 5e ff ff ff    	je     80100b88 <exec+0xa8>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100c2a:	83 ec 0c             	sub    $0xc,%esp
+80100c2d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100c33:	e8 88 72 00 00       	call   80107ec0 <freevm>
+  if(ip){
+80100c38:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100c3b:	83 ec 0c             	sub    $0xc,%esp
+80100c3e:	57                   	push   %edi
+80100c3f:	e8 1c 0e 00 00       	call   80101a60 <iunlockput>
+    end_op();
+80100c44:	e8 87 22 00 00       	call   80102ed0 <end_op>
+80100c49:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100c4c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80100c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c54:	5b                   	pop    %ebx
+80100c55:	5e                   	pop    %esi
+80100c56:	5f                   	pop    %edi
+80100c57:	5d                   	pop    %ebp
+80100c58:	c3                   	ret
+80100c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80100c60:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80100c66:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+80100c6c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100c72:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80100c78:	83 ec 0c             	sub    $0xc,%esp
+80100c7b:	57                   	push   %edi
+80100c7c:	e8 df 0d 00 00       	call   80101a60 <iunlockput>
+  end_op();
+80100c81:	e8 4a 22 00 00       	call   80102ed0 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100c86:	83 c4 0c             	add    $0xc,%esp
+80100c89:	53                   	push   %ebx
+80100c8a:	56                   	push   %esi
+80100c8b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100c91:	56                   	push   %esi
+80100c92:	e8 d9 70 00 00       	call   80107d70 <allocuvm>
+80100c97:	83 c4 10             	add    $0x10,%esp
+80100c9a:	89 c7                	mov    %eax,%edi
+80100c9c:	85 c0                	test   %eax,%eax
+80100c9e:	0f 84 86 00 00 00    	je     80100d2a <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100ca4:	83 ec 08             	sub    $0x8,%esp
+80100ca7:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+80100cad:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100caf:	50                   	push   %eax
+80100cb0:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80100cb1:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100cb3:	e8 28 73 00 00       	call   80107fe0 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100cb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100cbb:	83 c4 10             	add    $0x10,%esp
+80100cbe:	8b 10                	mov    (%eax),%edx
+80100cc0:	85 d2                	test   %edx,%edx
+80100cc2:	0f 84 56 01 00 00    	je     80100e1e <exec+0x33e>
+80100cc8:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+80100cce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100cd1:	eb 23                	jmp    80100cf6 <exec+0x216>
+80100cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100cd7:	90                   	nop
+80100cd8:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80100cdb:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80100ce2:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80100ce8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80100ceb:	85 d2                	test   %edx,%edx
+80100ced:	74 51                	je     80100d40 <exec+0x260>
+    if(argc >= MAXARG)
+80100cef:	83 f8 20             	cmp    $0x20,%eax
+80100cf2:	74 36                	je     80100d2a <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+80100cf4:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100cf6:	83 ec 0c             	sub    $0xc,%esp
+80100cf9:	52                   	push   %edx
+80100cfa:	e8 a1 4a 00 00       	call   801057a0 <strlen>
+80100cff:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d01:	58                   	pop    %eax
+80100d02:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d05:	83 eb 01             	sub    $0x1,%ebx
+80100d08:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d0b:	e8 90 4a 00 00       	call   801057a0 <strlen>
+80100d10:	83 c0 01             	add    $0x1,%eax
+80100d13:	50                   	push   %eax
+80100d14:	ff 34 b7             	push   (%edi,%esi,4)
+80100d17:	53                   	push   %ebx
+80100d18:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d1e:	e8 8d 74 00 00       	call   801081b0 <copyout>
+80100d23:	83 c4 20             	add    $0x20,%esp
+80100d26:	85 c0                	test   %eax,%eax
+80100d28:	79 ae                	jns    80100cd8 <exec+0x1f8>
+    freevm(pgdir);
+80100d2a:	83 ec 0c             	sub    $0xc,%esp
+80100d2d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d33:	e8 88 71 00 00       	call   80107ec0 <freevm>
+80100d38:	83 c4 10             	add    $0x10,%esp
+80100d3b:	e9 0c ff ff ff       	jmp    80100c4c <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d40:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80100d47:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80100d4d:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100d53:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80100d56:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80100d59:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80100d60:	00 00 00 00 
+  ustack[1] = argc;
+80100d64:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80100d6a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100d71:	ff ff ff 
+  ustack[1] = argc;
+80100d74:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d7a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80100d7c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d7e:	29 d0                	sub    %edx,%eax
+80100d80:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100d86:	56                   	push   %esi
+80100d87:	51                   	push   %ecx
+80100d88:	53                   	push   %ebx
+80100d89:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d8f:	e8 1c 74 00 00       	call   801081b0 <copyout>
+80100d94:	83 c4 10             	add    $0x10,%esp
+80100d97:	85 c0                	test   %eax,%eax
+80100d99:	78 8f                	js     80100d2a <exec+0x24a>
+  for(last=s=path; *s; s++)
+80100d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+80100d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+80100da1:	0f b6 00             	movzbl (%eax),%eax
+80100da4:	84 c0                	test   %al,%al
+80100da6:	74 17                	je     80100dbf <exec+0x2df>
+80100da8:	89 d1                	mov    %edx,%ecx
+80100daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+80100db0:	83 c1 01             	add    $0x1,%ecx
+80100db3:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80100db5:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80100db8:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+80100dbb:	84 c0                	test   %al,%al
+80100dbd:	75 f1                	jne    80100db0 <exec+0x2d0>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+80100dbf:	83 ec 04             	sub    $0x4,%esp
+80100dc2:	6a 10                	push   $0x10
+80100dc4:	52                   	push   %edx
+80100dc5:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+80100dcb:	8d 46 6c             	lea    0x6c(%esi),%eax
+80100dce:	50                   	push   %eax
+80100dcf:	e8 8c 49 00 00       	call   80105760 <safestrcpy>
+  curproc->pgdir = pgdir;
+80100dd4:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+80100dda:	89 f0                	mov    %esi,%eax
+80100ddc:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+80100ddf:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+80100de1:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+80100de4:	89 c1                	mov    %eax,%ecx
+80100de6:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80100dec:	8b 40 18             	mov    0x18(%eax),%eax
+80100def:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80100df2:	8b 41 18             	mov    0x18(%ecx),%eax
+80100df5:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+80100df8:	89 0c 24             	mov    %ecx,(%esp)
+80100dfb:	e8 10 6d 00 00       	call   80107b10 <switchuvm>
+  freevm(oldpgdir);
+80100e00:	89 34 24             	mov    %esi,(%esp)
+80100e03:	e8 b8 70 00 00       	call   80107ec0 <freevm>
+  return 0;
+80100e08:	83 c4 10             	add    $0x10,%esp
+80100e0b:	31 c0                	xor    %eax,%eax
+80100e0d:	e9 3f fe ff ff       	jmp    80100c51 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100e12:	bb 00 20 00 00       	mov    $0x2000,%ebx
+80100e17:	31 f6                	xor    %esi,%esi
+80100e19:	e9 5a fe ff ff       	jmp    80100c78 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+80100e1e:	be 10 00 00 00       	mov    $0x10,%esi
+80100e23:	ba 04 00 00 00       	mov    $0x4,%edx
+80100e28:	b8 03 00 00 00       	mov    $0x3,%eax
+80100e2d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100e34:	00 00 00 
+80100e37:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80100e3d:	e9 17 ff ff ff       	jmp    80100d59 <exec+0x279>
+    end_op();
+80100e42:	e8 89 20 00 00       	call   80102ed0 <end_op>
+    cprintf("exec: fail\n");
+80100e47:	83 ec 0c             	sub    $0xc,%esp
+80100e4a:	68 a1 83 10 80       	push   $0x801083a1
+80100e4f:	e8 5c f8 ff ff       	call   801006b0 <cprintf>
+    return -1;
+80100e54:	83 c4 10             	add    $0x10,%esp
+80100e57:	e9 f0 fd ff ff       	jmp    80100c4c <exec+0x16c>
+80100e5c:	66 90                	xchg   %ax,%ax
+80100e5e:	66 90                	xchg   %ax,%ax
+
+80100e60 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80100e60:	55                   	push   %ebp
+80100e61:	89 e5                	mov    %esp,%ebp
+80100e63:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100e66:	68 ad 83 10 80       	push   $0x801083ad
+80100e6b:	68 60 ff 10 80       	push   $0x8010ff60
+80100e70:	e8 7b 44 00 00       	call   801052f0 <initlock>
+}
+80100e75:	83 c4 10             	add    $0x10,%esp
+80100e78:	c9                   	leave
+80100e79:	c3                   	ret
+80100e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100e80 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80100e80:	55                   	push   %ebp
+80100e81:	89 e5                	mov    %esp,%ebp
+80100e83:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100e84:	bb 94 ff 10 80       	mov    $0x8010ff94,%ebx
+{
+80100e89:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+80100e8c:	68 60 ff 10 80       	push   $0x8010ff60
+80100e91:	e8 3a 46 00 00       	call   801054d0 <acquire>
+80100e96:	83 c4 10             	add    $0x10,%esp
+80100e99:	eb 10                	jmp    80100eab <filealloc+0x2b>
+80100e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100e9f:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100ea0:	83 c3 18             	add    $0x18,%ebx
+80100ea3:	81 fb f4 08 11 80    	cmp    $0x801108f4,%ebx
+80100ea9:	74 25                	je     80100ed0 <filealloc+0x50>
+    if(f->ref == 0){
+80100eab:	8b 43 04             	mov    0x4(%ebx),%eax
+80100eae:	85 c0                	test   %eax,%eax
+80100eb0:	75 ee                	jne    80100ea0 <filealloc+0x20>
+      f->ref = 1;
+      release(&ftable.lock);
+80100eb2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+80100eb5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+80100ebc:	68 60 ff 10 80       	push   $0x8010ff60
+80100ec1:	e8 aa 45 00 00       	call   80105470 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+80100ec6:	89 d8                	mov    %ebx,%eax
+      return f;
+80100ec8:	83 c4 10             	add    $0x10,%esp
+}
+80100ecb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100ece:	c9                   	leave
+80100ecf:	c3                   	ret
+  release(&ftable.lock);
+80100ed0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80100ed3:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+80100ed5:	68 60 ff 10 80       	push   $0x8010ff60
+80100eda:	e8 91 45 00 00       	call   80105470 <release>
+}
+80100edf:	89 d8                	mov    %ebx,%eax
+  return 0;
+80100ee1:	83 c4 10             	add    $0x10,%esp
+}
+80100ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100ee7:	c9                   	leave
+80100ee8:	c3                   	ret
+80100ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100ef0 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80100ef0:	55                   	push   %ebp
+80100ef1:	89 e5                	mov    %esp,%ebp
+80100ef3:	53                   	push   %ebx
+80100ef4:	83 ec 10             	sub    $0x10,%esp
+80100ef7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80100efa:	68 60 ff 10 80       	push   $0x8010ff60
+80100eff:	e8 cc 45 00 00       	call   801054d0 <acquire>
+  if(f->ref < 1)
+80100f04:	8b 43 04             	mov    0x4(%ebx),%eax
+80100f07:	83 c4 10             	add    $0x10,%esp
+80100f0a:	85 c0                	test   %eax,%eax
+80100f0c:	7e 1a                	jle    80100f28 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80100f0e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80100f11:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80100f14:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80100f17:	68 60 ff 10 80       	push   $0x8010ff60
+80100f1c:	e8 4f 45 00 00       	call   80105470 <release>
+  return f;
+}
+80100f21:	89 d8                	mov    %ebx,%eax
+80100f23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f26:	c9                   	leave
+80100f27:	c3                   	ret
+    panic("filedup");
+80100f28:	83 ec 0c             	sub    $0xc,%esp
+80100f2b:	68 b4 83 10 80       	push   $0x801083b4
+80100f30:	e8 4b f4 ff ff       	call   80100380 <panic>
+80100f35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100f40 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80100f40:	55                   	push   %ebp
+80100f41:	89 e5                	mov    %esp,%ebp
+80100f43:	57                   	push   %edi
+80100f44:	56                   	push   %esi
+80100f45:	53                   	push   %ebx
+80100f46:	83 ec 28             	sub    $0x28,%esp
+80100f49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80100f4c:	68 60 ff 10 80       	push   $0x8010ff60
+80100f51:	e8 7a 45 00 00       	call   801054d0 <acquire>
+  if(f->ref < 1)
+80100f56:	8b 53 04             	mov    0x4(%ebx),%edx
+80100f59:	83 c4 10             	add    $0x10,%esp
+80100f5c:	85 d2                	test   %edx,%edx
+80100f5e:	0f 8e a5 00 00 00    	jle    80101009 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80100f64:	83 ea 01             	sub    $0x1,%edx
+80100f67:	89 53 04             	mov    %edx,0x4(%ebx)
+80100f6a:	75 44                	jne    80100fb0 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+80100f6c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80100f70:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80100f73:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80100f75:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+80100f7b:	8b 73 0c             	mov    0xc(%ebx),%esi
+80100f7e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80100f81:	8b 43 10             	mov    0x10(%ebx),%eax
+80100f84:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80100f87:	68 60 ff 10 80       	push   $0x8010ff60
+80100f8c:	e8 df 44 00 00       	call   80105470 <release>
+
+  if(ff.type == FD_PIPE)
+80100f91:	83 c4 10             	add    $0x10,%esp
+80100f94:	83 ff 01             	cmp    $0x1,%edi
+80100f97:	74 57                	je     80100ff0 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80100f99:	83 ff 02             	cmp    $0x2,%edi
+80100f9c:	74 2a                	je     80100fc8 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+80100f9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fa1:	5b                   	pop    %ebx
+80100fa2:	5e                   	pop    %esi
+80100fa3:	5f                   	pop    %edi
+80100fa4:	5d                   	pop    %ebp
+80100fa5:	c3                   	ret
+80100fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100fad:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+80100fb0:	c7 45 08 60 ff 10 80 	movl   $0x8010ff60,0x8(%ebp)
+}
+80100fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fba:	5b                   	pop    %ebx
+80100fbb:	5e                   	pop    %esi
+80100fbc:	5f                   	pop    %edi
+80100fbd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+80100fbe:	e9 ad 44 00 00       	jmp    80105470 <release>
+80100fc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100fc7:	90                   	nop
+    begin_op();
+80100fc8:	e8 93 1e 00 00       	call   80102e60 <begin_op>
+    iput(ff.ip);
+80100fcd:	83 ec 0c             	sub    $0xc,%esp
+80100fd0:	ff 75 e0             	push   -0x20(%ebp)
+80100fd3:	e8 28 09 00 00       	call   80101900 <iput>
+    end_op();
+80100fd8:	83 c4 10             	add    $0x10,%esp
+}
+80100fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fde:	5b                   	pop    %ebx
+80100fdf:	5e                   	pop    %esi
+80100fe0:	5f                   	pop    %edi
+80100fe1:	5d                   	pop    %ebp
+    end_op();
+80100fe2:	e9 e9 1e 00 00       	jmp    80102ed0 <end_op>
+80100fe7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100fee:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80100ff0:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80100ff4:	83 ec 08             	sub    $0x8,%esp
+80100ff7:	53                   	push   %ebx
+80100ff8:	56                   	push   %esi
+80100ff9:	e8 22 26 00 00       	call   80103620 <pipeclose>
+80100ffe:	83 c4 10             	add    $0x10,%esp
+}
+80101001:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101004:	5b                   	pop    %ebx
+80101005:	5e                   	pop    %esi
+80101006:	5f                   	pop    %edi
+80101007:	5d                   	pop    %ebp
+80101008:	c3                   	ret
+    panic("fileclose");
+80101009:	83 ec 0c             	sub    $0xc,%esp
+8010100c:	68 bc 83 10 80       	push   $0x801083bc
+80101011:	e8 6a f3 ff ff       	call   80100380 <panic>
+80101016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010101d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101020 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101020:	55                   	push   %ebp
+80101021:	89 e5                	mov    %esp,%ebp
+80101023:	53                   	push   %ebx
+80101024:	83 ec 04             	sub    $0x4,%esp
+80101027:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010102a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010102d:	75 31                	jne    80101060 <filestat+0x40>
+    ilock(f->ip);
+8010102f:	83 ec 0c             	sub    $0xc,%esp
+80101032:	ff 73 10             	push   0x10(%ebx)
+80101035:	e8 96 07 00 00       	call   801017d0 <ilock>
+    stati(f->ip, st);
+8010103a:	58                   	pop    %eax
+8010103b:	5a                   	pop    %edx
+8010103c:	ff 75 0c             	push   0xc(%ebp)
+8010103f:	ff 73 10             	push   0x10(%ebx)
+80101042:	e8 69 0a 00 00       	call   80101ab0 <stati>
+    iunlock(f->ip);
+80101047:	59                   	pop    %ecx
+80101048:	ff 73 10             	push   0x10(%ebx)
+8010104b:	e8 60 08 00 00       	call   801018b0 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+80101050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101053:	83 c4 10             	add    $0x10,%esp
+80101056:	31 c0                	xor    %eax,%eax
+}
+80101058:	c9                   	leave
+80101059:	c3                   	ret
+8010105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101060:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101063:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101068:	c9                   	leave
+80101069:	c3                   	ret
+8010106a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101070 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101070:	55                   	push   %ebp
+80101071:	89 e5                	mov    %esp,%ebp
+80101073:	57                   	push   %edi
+80101074:	56                   	push   %esi
+80101075:	53                   	push   %ebx
+80101076:	83 ec 0c             	sub    $0xc,%esp
+80101079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010107c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010107f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int r;
+
+  if(f->readable == 0)
+80101082:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101086:	74 60                	je     801010e8 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+80101088:	8b 03                	mov    (%ebx),%eax
+8010108a:	83 f8 01             	cmp    $0x1,%eax
+8010108d:	74 41                	je     801010d0 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010108f:	83 f8 02             	cmp    $0x2,%eax
+80101092:	75 5b                	jne    801010ef <fileread+0x7f>
+    ilock(f->ip);
+80101094:	83 ec 0c             	sub    $0xc,%esp
+80101097:	ff 73 10             	push   0x10(%ebx)
+8010109a:	e8 31 07 00 00       	call   801017d0 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+8010109f:	57                   	push   %edi
+801010a0:	ff 73 14             	push   0x14(%ebx)
+801010a3:	56                   	push   %esi
+801010a4:	ff 73 10             	push   0x10(%ebx)
+801010a7:	e8 34 0a 00 00       	call   80101ae0 <readi>
+801010ac:	83 c4 20             	add    $0x20,%esp
+801010af:	89 c6                	mov    %eax,%esi
+801010b1:	85 c0                	test   %eax,%eax
+801010b3:	7e 03                	jle    801010b8 <fileread+0x48>
+      f->off += r;
+801010b5:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801010b8:	83 ec 0c             	sub    $0xc,%esp
+801010bb:	ff 73 10             	push   0x10(%ebx)
+801010be:	e8 ed 07 00 00       	call   801018b0 <iunlock>
+    return r;
+801010c3:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801010c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010c9:	89 f0                	mov    %esi,%eax
+801010cb:	5b                   	pop    %ebx
+801010cc:	5e                   	pop    %esi
+801010cd:	5f                   	pop    %edi
+801010ce:	5d                   	pop    %ebp
+801010cf:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+801010d0:	8b 43 0c             	mov    0xc(%ebx),%eax
+801010d3:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801010d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010d9:	5b                   	pop    %ebx
+801010da:	5e                   	pop    %esi
+801010db:	5f                   	pop    %edi
+801010dc:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+801010dd:	e9 fe 26 00 00       	jmp    801037e0 <piperead>
+801010e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801010e8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801010ed:	eb d7                	jmp    801010c6 <fileread+0x56>
+  panic("fileread");
+801010ef:	83 ec 0c             	sub    $0xc,%esp
+801010f2:	68 c6 83 10 80       	push   $0x801083c6
+801010f7:	e8 84 f2 ff ff       	call   80100380 <panic>
+801010fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101100 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101100:	55                   	push   %ebp
+80101101:	89 e5                	mov    %esp,%ebp
+80101103:	57                   	push   %edi
+80101104:	56                   	push   %esi
+80101105:	53                   	push   %ebx
+80101106:	83 ec 1c             	sub    $0x1c,%esp
+80101109:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010110c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010110f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101112:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+80101115:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+80101119:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+8010111c:	0f 84 bb 00 00 00    	je     801011dd <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+80101122:	8b 03                	mov    (%ebx),%eax
+80101124:	83 f8 01             	cmp    $0x1,%eax
+80101127:	0f 84 bf 00 00 00    	je     801011ec <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010112d:	83 f8 02             	cmp    $0x2,%eax
+80101130:	0f 85 c8 00 00 00    	jne    801011fe <filewrite+0xfe>
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+    while(i < n){
+80101136:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+80101139:	31 f6                	xor    %esi,%esi
+    while(i < n){
+8010113b:	85 c0                	test   %eax,%eax
+8010113d:	7f 30                	jg     8010116f <filewrite+0x6f>
+8010113f:	e9 94 00 00 00       	jmp    801011d8 <filewrite+0xd8>
+80101144:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+80101148:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+8010114b:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+8010114e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101151:	ff 73 10             	push   0x10(%ebx)
+80101154:	e8 57 07 00 00       	call   801018b0 <iunlock>
+      end_op();
+80101159:	e8 72 1d 00 00       	call   80102ed0 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+8010115e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101161:	83 c4 10             	add    $0x10,%esp
+80101164:	39 c7                	cmp    %eax,%edi
+80101166:	75 5c                	jne    801011c4 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+80101168:	01 fe                	add    %edi,%esi
+    while(i < n){
+8010116a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+8010116d:	7e 69                	jle    801011d8 <filewrite+0xd8>
+      int n1 = n - i;
+8010116f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101172:	b8 00 06 00 00       	mov    $0x600,%eax
+      int n1 = n - i;
+80101177:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101179:	39 c7                	cmp    %eax,%edi
+8010117b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+8010117e:	e8 dd 1c 00 00       	call   80102e60 <begin_op>
+      ilock(f->ip);
+80101183:	83 ec 0c             	sub    $0xc,%esp
+80101186:	ff 73 10             	push   0x10(%ebx)
+80101189:	e8 42 06 00 00       	call   801017d0 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+8010118e:	57                   	push   %edi
+8010118f:	ff 73 14             	push   0x14(%ebx)
+80101192:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101195:	01 f0                	add    %esi,%eax
+80101197:	50                   	push   %eax
+80101198:	ff 73 10             	push   0x10(%ebx)
+8010119b:	e8 40 0a 00 00       	call   80101be0 <writei>
+801011a0:	83 c4 20             	add    $0x20,%esp
+801011a3:	85 c0                	test   %eax,%eax
+801011a5:	7f a1                	jg     80101148 <filewrite+0x48>
+801011a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+801011aa:	83 ec 0c             	sub    $0xc,%esp
+801011ad:	ff 73 10             	push   0x10(%ebx)
+801011b0:	e8 fb 06 00 00       	call   801018b0 <iunlock>
+      end_op();
+801011b5:	e8 16 1d 00 00       	call   80102ed0 <end_op>
+      if(r < 0)
+801011ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801011bd:	83 c4 10             	add    $0x10,%esp
+801011c0:	85 c0                	test   %eax,%eax
+801011c2:	75 14                	jne    801011d8 <filewrite+0xd8>
+        panic("short filewrite");
+801011c4:	83 ec 0c             	sub    $0xc,%esp
+801011c7:	68 cf 83 10 80       	push   $0x801083cf
+801011cc:	e8 af f1 ff ff       	call   80100380 <panic>
+801011d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+801011d8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+801011db:	74 05                	je     801011e2 <filewrite+0xe2>
+    return -1;
+801011dd:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+801011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801011e5:	89 f0                	mov    %esi,%eax
+801011e7:	5b                   	pop    %ebx
+801011e8:	5e                   	pop    %esi
+801011e9:	5f                   	pop    %edi
+801011ea:	5d                   	pop    %ebp
+801011eb:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+801011ec:	8b 43 0c             	mov    0xc(%ebx),%eax
+801011ef:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801011f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801011f5:	5b                   	pop    %ebx
+801011f6:	5e                   	pop    %esi
+801011f7:	5f                   	pop    %edi
+801011f8:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+801011f9:	e9 c2 24 00 00       	jmp    801036c0 <pipewrite>
+  panic("filewrite");
+801011fe:	83 ec 0c             	sub    $0xc,%esp
+80101201:	68 d5 83 10 80       	push   $0x801083d5
+80101206:	e8 75 f1 ff ff       	call   80100380 <panic>
+8010120b:	66 90                	xchg   %ax,%ax
+8010120d:	66 90                	xchg   %ax,%ax
+8010120f:	90                   	nop
+
+80101210 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+80101210:	55                   	push   %ebp
+80101211:	89 e5                	mov    %esp,%ebp
+80101213:	57                   	push   %edi
+80101214:	56                   	push   %esi
+80101215:	53                   	push   %ebx
+80101216:	83 ec 1c             	sub    $0x1c,%esp
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+80101219:	8b 0d b4 25 11 80    	mov    0x801125b4,%ecx
+{
+8010121f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101222:	85 c9                	test   %ecx,%ecx
+80101224:	0f 84 8c 00 00 00    	je     801012b6 <balloc+0xa6>
+8010122a:	31 ff                	xor    %edi,%edi
+    bp = bread(dev, BBLOCK(b, sb));
+8010122c:	89 f8                	mov    %edi,%eax
+8010122e:	83 ec 08             	sub    $0x8,%esp
+80101231:	89 fe                	mov    %edi,%esi
+80101233:	c1 f8 0c             	sar    $0xc,%eax
+80101236:	03 05 cc 25 11 80    	add    0x801125cc,%eax
+8010123c:	50                   	push   %eax
+8010123d:	ff 75 dc             	push   -0x24(%ebp)
+80101240:	e8 8b ee ff ff       	call   801000d0 <bread>
+80101245:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80101248:	83 c4 10             	add    $0x10,%esp
+8010124b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+8010124e:	a1 b4 25 11 80       	mov    0x801125b4,%eax
+80101253:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101256:	31 c0                	xor    %eax,%eax
+80101258:	eb 32                	jmp    8010128c <balloc+0x7c>
+8010125a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      m = 1 << (bi % 8);
+80101260:	89 c1                	mov    %eax,%ecx
+80101262:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101267:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      m = 1 << (bi % 8);
+8010126a:	83 e1 07             	and    $0x7,%ecx
+8010126d:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+8010126f:	89 c1                	mov    %eax,%ecx
+80101271:	c1 f9 03             	sar    $0x3,%ecx
+80101274:	0f b6 7c 0f 5c       	movzbl 0x5c(%edi,%ecx,1),%edi
+80101279:	89 fa                	mov    %edi,%edx
+8010127b:	85 df                	test   %ebx,%edi
+8010127d:	74 49                	je     801012c8 <balloc+0xb8>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+8010127f:	83 c0 01             	add    $0x1,%eax
+80101282:	83 c6 01             	add    $0x1,%esi
+80101285:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010128a:	74 07                	je     80101293 <balloc+0x83>
+8010128c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010128f:	39 d6                	cmp    %edx,%esi
+80101291:	72 cd                	jb     80101260 <balloc+0x50>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+80101293:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80101296:	83 ec 0c             	sub    $0xc,%esp
+80101299:	ff 75 e4             	push   -0x1c(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+8010129c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    brelse(bp);
+801012a2:	e8 49 ef ff ff       	call   801001f0 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+801012a7:	83 c4 10             	add    $0x10,%esp
+801012aa:	3b 3d b4 25 11 80    	cmp    0x801125b4,%edi
+801012b0:	0f 82 76 ff ff ff    	jb     8010122c <balloc+0x1c>
+  }
+  panic("balloc: out of blocks");
+801012b6:	83 ec 0c             	sub    $0xc,%esp
+801012b9:	68 df 83 10 80       	push   $0x801083df
+801012be:	e8 bd f0 ff ff       	call   80100380 <panic>
+801012c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801012c7:	90                   	nop
+        bp->data[bi/8] |= m;  // Mark block in use.
+801012c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        log_write(bp);
+801012cb:	83 ec 0c             	sub    $0xc,%esp
+        bp->data[bi/8] |= m;  // Mark block in use.
+801012ce:	09 da                	or     %ebx,%edx
+801012d0:	88 54 0f 5c          	mov    %dl,0x5c(%edi,%ecx,1)
+        log_write(bp);
+801012d4:	57                   	push   %edi
+801012d5:	e8 66 1d 00 00       	call   80103040 <log_write>
+        brelse(bp);
+801012da:	89 3c 24             	mov    %edi,(%esp)
+801012dd:	e8 0e ef ff ff       	call   801001f0 <brelse>
+  bp = bread(dev, bno);
+801012e2:	58                   	pop    %eax
+801012e3:	5a                   	pop    %edx
+801012e4:	56                   	push   %esi
+801012e5:	ff 75 dc             	push   -0x24(%ebp)
+801012e8:	e8 e3 ed ff ff       	call   801000d0 <bread>
+  memset(bp->data, 0, BSIZE);
+801012ed:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, bno);
+801012f0:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+801012f2:	8d 40 5c             	lea    0x5c(%eax),%eax
+801012f5:	68 00 02 00 00       	push   $0x200
+801012fa:	6a 00                	push   $0x0
+801012fc:	50                   	push   %eax
+801012fd:	e8 ae 42 00 00       	call   801055b0 <memset>
+  log_write(bp);
+80101302:	89 1c 24             	mov    %ebx,(%esp)
+80101305:	e8 36 1d 00 00       	call   80103040 <log_write>
+  brelse(bp);
+8010130a:	89 1c 24             	mov    %ebx,(%esp)
+8010130d:	e8 de ee ff ff       	call   801001f0 <brelse>
+}
+80101312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101315:	89 f0                	mov    %esi,%eax
+80101317:	5b                   	pop    %ebx
+80101318:	5e                   	pop    %esi
+80101319:	5f                   	pop    %edi
+8010131a:	5d                   	pop    %ebp
+8010131b:	c3                   	ret
+8010131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101320 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+80101320:	55                   	push   %ebp
+80101321:	89 e5                	mov    %esp,%ebp
+80101323:	57                   	push   %edi
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+
+  // Is the inode already cached?
+  empty = 0;
+80101324:	31 ff                	xor    %edi,%edi
+{
+80101326:	56                   	push   %esi
+80101327:	89 c6                	mov    %eax,%esi
+80101329:	53                   	push   %ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010132a:	bb 94 09 11 80       	mov    $0x80110994,%ebx
+{
+8010132f:	83 ec 28             	sub    $0x28,%esp
+80101332:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+80101335:	68 60 09 11 80       	push   $0x80110960
+8010133a:	e8 91 41 00 00       	call   801054d0 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010133f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquire(&icache.lock);
+80101342:	83 c4 10             	add    $0x10,%esp
+80101345:	eb 1b                	jmp    80101362 <iget+0x42>
+80101347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010134e:	66 90                	xchg   %ax,%ax
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101350:	39 33                	cmp    %esi,(%ebx)
+80101352:	74 6c                	je     801013c0 <iget+0xa0>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101354:	81 c3 90 00 00 00    	add    $0x90,%ebx
+8010135a:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+80101360:	74 26                	je     80101388 <iget+0x68>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101362:	8b 43 08             	mov    0x8(%ebx),%eax
+80101365:	85 c0                	test   %eax,%eax
+80101367:	7f e7                	jg     80101350 <iget+0x30>
+      ip->ref++;
+      release(&icache.lock);
+      return ip;
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101369:	85 ff                	test   %edi,%edi
+8010136b:	75 e7                	jne    80101354 <iget+0x34>
+8010136d:	85 c0                	test   %eax,%eax
+8010136f:	75 76                	jne    801013e7 <iget+0xc7>
+80101371:	89 df                	mov    %ebx,%edi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101373:	81 c3 90 00 00 00    	add    $0x90,%ebx
+80101379:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+8010137f:	75 e1                	jne    80101362 <iget+0x42>
+80101381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      empty = ip;
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+80101388:	85 ff                	test   %edi,%edi
+8010138a:	74 79                	je     80101405 <iget+0xe5>
+  ip = empty;
+  ip->dev = dev;
+  ip->inum = inum;
+  ip->ref = 1;
+  ip->valid = 0;
+  release(&icache.lock);
+8010138c:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+8010138f:	89 37                	mov    %esi,(%edi)
+  ip->inum = inum;
+80101391:	89 57 04             	mov    %edx,0x4(%edi)
+  ip->ref = 1;
+80101394:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%edi)
+  ip->valid = 0;
+8010139b:	c7 47 4c 00 00 00 00 	movl   $0x0,0x4c(%edi)
+  release(&icache.lock);
+801013a2:	68 60 09 11 80       	push   $0x80110960
+801013a7:	e8 c4 40 00 00       	call   80105470 <release>
+
+  return ip;
+801013ac:	83 c4 10             	add    $0x10,%esp
+}
+801013af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801013b2:	89 f8                	mov    %edi,%eax
+801013b4:	5b                   	pop    %ebx
+801013b5:	5e                   	pop    %esi
+801013b6:	5f                   	pop    %edi
+801013b7:	5d                   	pop    %ebp
+801013b8:	c3                   	ret
+801013b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801013c0:	39 53 04             	cmp    %edx,0x4(%ebx)
+801013c3:	75 8f                	jne    80101354 <iget+0x34>
+      ip->ref++;
+801013c5:	83 c0 01             	add    $0x1,%eax
+      release(&icache.lock);
+801013c8:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+801013cb:	89 df                	mov    %ebx,%edi
+      ip->ref++;
+801013cd:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+801013d0:	68 60 09 11 80       	push   $0x80110960
+801013d5:	e8 96 40 00 00       	call   80105470 <release>
+      return ip;
+801013da:	83 c4 10             	add    $0x10,%esp
+}
+801013dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801013e0:	89 f8                	mov    %edi,%eax
+801013e2:	5b                   	pop    %ebx
+801013e3:	5e                   	pop    %esi
+801013e4:	5f                   	pop    %edi
+801013e5:	5d                   	pop    %ebp
+801013e6:	c3                   	ret
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801013e7:	81 c3 90 00 00 00    	add    $0x90,%ebx
+801013ed:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+801013f3:	74 10                	je     80101405 <iget+0xe5>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801013f5:	8b 43 08             	mov    0x8(%ebx),%eax
+801013f8:	85 c0                	test   %eax,%eax
+801013fa:	0f 8f 50 ff ff ff    	jg     80101350 <iget+0x30>
+80101400:	e9 68 ff ff ff       	jmp    8010136d <iget+0x4d>
+    panic("iget: no inodes");
+80101405:	83 ec 0c             	sub    $0xc,%esp
+80101408:	68 f5 83 10 80       	push   $0x801083f5
+8010140d:	e8 6e ef ff ff       	call   80100380 <panic>
+80101412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101420 <bfree>:
+{
+80101420:	55                   	push   %ebp
+80101421:	89 c1                	mov    %eax,%ecx
+  bp = bread(dev, BBLOCK(b, sb));
+80101423:	89 d0                	mov    %edx,%eax
+80101425:	c1 e8 0c             	shr    $0xc,%eax
+{
+80101428:	89 e5                	mov    %esp,%ebp
+8010142a:	56                   	push   %esi
+8010142b:	53                   	push   %ebx
+  bp = bread(dev, BBLOCK(b, sb));
+8010142c:	03 05 cc 25 11 80    	add    0x801125cc,%eax
+{
+80101432:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80101434:	83 ec 08             	sub    $0x8,%esp
+80101437:	50                   	push   %eax
+80101438:	51                   	push   %ecx
+80101439:	e8 92 ec ff ff       	call   801000d0 <bread>
+  m = 1 << (bi % 8);
+8010143e:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101440:	c1 fb 03             	sar    $0x3,%ebx
+80101443:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101446:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80101448:	83 e1 07             	and    $0x7,%ecx
+8010144b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101450:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+80101456:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101458:	0f b6 4c 1e 5c       	movzbl 0x5c(%esi,%ebx,1),%ecx
+8010145d:	85 c1                	test   %eax,%ecx
+8010145f:	74 23                	je     80101484 <bfree+0x64>
+  bp->data[bi/8] &= ~m;
+80101461:	f7 d0                	not    %eax
+  log_write(bp);
+80101463:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+80101466:	21 c8                	and    %ecx,%eax
+80101468:	88 44 1e 5c          	mov    %al,0x5c(%esi,%ebx,1)
+  log_write(bp);
+8010146c:	56                   	push   %esi
+8010146d:	e8 ce 1b 00 00       	call   80103040 <log_write>
+  brelse(bp);
+80101472:	89 34 24             	mov    %esi,(%esp)
+80101475:	e8 76 ed ff ff       	call   801001f0 <brelse>
+}
+8010147a:	83 c4 10             	add    $0x10,%esp
+8010147d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101480:	5b                   	pop    %ebx
+80101481:	5e                   	pop    %esi
+80101482:	5d                   	pop    %ebp
+80101483:	c3                   	ret
+    panic("freeing free block");
+80101484:	83 ec 0c             	sub    $0xc,%esp
+80101487:	68 05 84 10 80       	push   $0x80108405
+8010148c:	e8 ef ee ff ff       	call   80100380 <panic>
+80101491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010149f:	90                   	nop
+
+801014a0 <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+801014a0:	55                   	push   %ebp
+801014a1:	89 e5                	mov    %esp,%ebp
+801014a3:	57                   	push   %edi
+801014a4:	56                   	push   %esi
+801014a5:	89 c6                	mov    %eax,%esi
+801014a7:	53                   	push   %ebx
+801014a8:	83 ec 1c             	sub    $0x1c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+801014ab:	83 fa 0b             	cmp    $0xb,%edx
+801014ae:	0f 86 8c 00 00 00    	jbe    80101540 <bmap+0xa0>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+801014b4:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+  if(bn < NINDIRECT){
+801014b7:	83 fb 7f             	cmp    $0x7f,%ebx
+801014ba:	0f 87 a2 00 00 00    	ja     80101562 <bmap+0xc2>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+801014c0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+801014c6:	85 c0                	test   %eax,%eax
+801014c8:	74 5e                	je     80101528 <bmap+0x88>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+801014ca:	83 ec 08             	sub    $0x8,%esp
+801014cd:	50                   	push   %eax
+801014ce:	ff 36                	push   (%esi)
+801014d0:	e8 fb eb ff ff       	call   801000d0 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+801014d5:	83 c4 10             	add    $0x10,%esp
+801014d8:	8d 5c 98 5c          	lea    0x5c(%eax,%ebx,4),%ebx
+    bp = bread(ip->dev, addr);
+801014dc:	89 c2                	mov    %eax,%edx
+    if((addr = a[bn]) == 0){
+801014de:	8b 3b                	mov    (%ebx),%edi
+801014e0:	85 ff                	test   %edi,%edi
+801014e2:	74 1c                	je     80101500 <bmap+0x60>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+801014e4:	83 ec 0c             	sub    $0xc,%esp
+801014e7:	52                   	push   %edx
+801014e8:	e8 03 ed ff ff       	call   801001f0 <brelse>
+801014ed:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+801014f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014f3:	89 f8                	mov    %edi,%eax
+801014f5:	5b                   	pop    %ebx
+801014f6:	5e                   	pop    %esi
+801014f7:	5f                   	pop    %edi
+801014f8:	5d                   	pop    %ebp
+801014f9:	c3                   	ret
+801014fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101500:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      a[bn] = addr = balloc(ip->dev);
+80101503:	8b 06                	mov    (%esi),%eax
+80101505:	e8 06 fd ff ff       	call   80101210 <balloc>
+      log_write(bp);
+8010150a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010150d:	83 ec 0c             	sub    $0xc,%esp
+      a[bn] = addr = balloc(ip->dev);
+80101510:	89 03                	mov    %eax,(%ebx)
+80101512:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+80101514:	52                   	push   %edx
+80101515:	e8 26 1b 00 00       	call   80103040 <log_write>
+8010151a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010151d:	83 c4 10             	add    $0x10,%esp
+80101520:	eb c2                	jmp    801014e4 <bmap+0x44>
+80101522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101528:	8b 06                	mov    (%esi),%eax
+8010152a:	e8 e1 fc ff ff       	call   80101210 <balloc>
+8010152f:	89 86 8c 00 00 00    	mov    %eax,0x8c(%esi)
+80101535:	eb 93                	jmp    801014ca <bmap+0x2a>
+80101537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010153e:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101540:	8d 5a 14             	lea    0x14(%edx),%ebx
+80101543:	8b 7c 98 0c          	mov    0xc(%eax,%ebx,4),%edi
+80101547:	85 ff                	test   %edi,%edi
+80101549:	75 a5                	jne    801014f0 <bmap+0x50>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010154b:	8b 00                	mov    (%eax),%eax
+8010154d:	e8 be fc ff ff       	call   80101210 <balloc>
+80101552:	89 44 9e 0c          	mov    %eax,0xc(%esi,%ebx,4)
+80101556:	89 c7                	mov    %eax,%edi
+}
+80101558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010155b:	5b                   	pop    %ebx
+8010155c:	89 f8                	mov    %edi,%eax
+8010155e:	5e                   	pop    %esi
+8010155f:	5f                   	pop    %edi
+80101560:	5d                   	pop    %ebp
+80101561:	c3                   	ret
+  panic("bmap: out of range");
+80101562:	83 ec 0c             	sub    $0xc,%esp
+80101565:	68 18 84 10 80       	push   $0x80108418
+8010156a:	e8 11 ee ff ff       	call   80100380 <panic>
+8010156f:	90                   	nop
+
+80101570 <readsb>:
+{
+80101570:	55                   	push   %ebp
+80101571:	89 e5                	mov    %esp,%ebp
+80101573:	56                   	push   %esi
+80101574:	53                   	push   %ebx
+80101575:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80101578:	83 ec 08             	sub    $0x8,%esp
+8010157b:	6a 01                	push   $0x1
+8010157d:	ff 75 08             	push   0x8(%ebp)
+80101580:	e8 4b eb ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101585:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80101588:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010158a:	8d 40 5c             	lea    0x5c(%eax),%eax
+8010158d:	6a 1c                	push   $0x1c
+8010158f:	50                   	push   %eax
+80101590:	56                   	push   %esi
+80101591:	e8 aa 40 00 00       	call   80105640 <memmove>
+  brelse(bp);
+80101596:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101599:	83 c4 10             	add    $0x10,%esp
+}
+8010159c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010159f:	5b                   	pop    %ebx
+801015a0:	5e                   	pop    %esi
+801015a1:	5d                   	pop    %ebp
+  brelse(bp);
+801015a2:	e9 49 ec ff ff       	jmp    801001f0 <brelse>
+801015a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801015ae:	66 90                	xchg   %ax,%ax
+
+801015b0 <iinit>:
+{
+801015b0:	55                   	push   %ebp
+801015b1:	89 e5                	mov    %esp,%ebp
+801015b3:	53                   	push   %ebx
+801015b4:	bb a0 09 11 80       	mov    $0x801109a0,%ebx
+801015b9:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+801015bc:	68 2b 84 10 80       	push   $0x8010842b
+801015c1:	68 60 09 11 80       	push   $0x80110960
+801015c6:	e8 25 3d 00 00       	call   801052f0 <initlock>
+  for(i = 0; i < NINODE; i++) {
+801015cb:	83 c4 10             	add    $0x10,%esp
+801015ce:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+801015d0:	83 ec 08             	sub    $0x8,%esp
+801015d3:	68 32 84 10 80       	push   $0x80108432
+801015d8:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+801015d9:	81 c3 90 00 00 00    	add    $0x90,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+801015df:	e8 dc 3b 00 00       	call   801051c0 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+801015e4:	83 c4 10             	add    $0x10,%esp
+801015e7:	81 fb c0 25 11 80    	cmp    $0x801125c0,%ebx
+801015ed:	75 e1                	jne    801015d0 <iinit+0x20>
+  bp = bread(dev, 1);
+801015ef:	83 ec 08             	sub    $0x8,%esp
+801015f2:	6a 01                	push   $0x1
+801015f4:	ff 75 08             	push   0x8(%ebp)
+801015f7:	e8 d4 ea ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+801015fc:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+801015ff:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101601:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101604:	6a 1c                	push   $0x1c
+80101606:	50                   	push   %eax
+80101607:	68 b4 25 11 80       	push   $0x801125b4
+8010160c:	e8 2f 40 00 00       	call   80105640 <memmove>
+  brelse(bp);
+80101611:	89 1c 24             	mov    %ebx,(%esp)
+80101614:	e8 d7 eb ff ff       	call   801001f0 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101619:	ff 35 cc 25 11 80    	push   0x801125cc
+8010161f:	ff 35 c8 25 11 80    	push   0x801125c8
+80101625:	ff 35 c4 25 11 80    	push   0x801125c4
+8010162b:	ff 35 c0 25 11 80    	push   0x801125c0
+80101631:	ff 35 bc 25 11 80    	push   0x801125bc
+80101637:	ff 35 b8 25 11 80    	push   0x801125b8
+8010163d:	ff 35 b4 25 11 80    	push   0x801125b4
+80101643:	68 98 84 10 80       	push   $0x80108498
+80101648:	e8 63 f0 ff ff       	call   801006b0 <cprintf>
+}
+8010164d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101650:	83 c4 30             	add    $0x30,%esp
+80101653:	c9                   	leave
+80101654:	c3                   	ret
+80101655:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010165c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101660 <ialloc>:
+{
+80101660:	55                   	push   %ebp
+80101661:	89 e5                	mov    %esp,%ebp
+80101663:	57                   	push   %edi
+80101664:	56                   	push   %esi
+80101665:	53                   	push   %ebx
+80101666:	83 ec 1c             	sub    $0x1c,%esp
+80101669:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010166c:	83 3d bc 25 11 80 01 	cmpl   $0x1,0x801125bc
+{
+80101673:	8b 75 08             	mov    0x8(%ebp),%esi
+80101676:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101679:	0f 86 91 00 00 00    	jbe    80101710 <ialloc+0xb0>
+8010167f:	bf 01 00 00 00       	mov    $0x1,%edi
+80101684:	eb 21                	jmp    801016a7 <ialloc+0x47>
+80101686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010168d:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80101690:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101693:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80101696:	53                   	push   %ebx
+80101697:	e8 54 eb ff ff       	call   801001f0 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010169c:	83 c4 10             	add    $0x10,%esp
+8010169f:	3b 3d bc 25 11 80    	cmp    0x801125bc,%edi
+801016a5:	73 69                	jae    80101710 <ialloc+0xb0>
+    bp = bread(dev, IBLOCK(inum, sb));
+801016a7:	89 f8                	mov    %edi,%eax
+801016a9:	83 ec 08             	sub    $0x8,%esp
+801016ac:	c1 e8 03             	shr    $0x3,%eax
+801016af:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+801016b5:	50                   	push   %eax
+801016b6:	56                   	push   %esi
+801016b7:	e8 14 ea ff ff       	call   801000d0 <bread>
+    if(dip->type == 0){  // a free inode
+801016bc:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+801016bf:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+801016c1:	89 f8                	mov    %edi,%eax
+801016c3:	83 e0 07             	and    $0x7,%eax
+801016c6:	c1 e0 06             	shl    $0x6,%eax
+801016c9:	8d 4c 03 5c          	lea    0x5c(%ebx,%eax,1),%ecx
+    if(dip->type == 0){  // a free inode
+801016cd:	66 83 39 00          	cmpw   $0x0,(%ecx)
+801016d1:	75 bd                	jne    80101690 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+801016d3:	83 ec 04             	sub    $0x4,%esp
+801016d6:	6a 40                	push   $0x40
+801016d8:	6a 00                	push   $0x0
+801016da:	51                   	push   %ecx
+801016db:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801016de:	e8 cd 3e 00 00       	call   801055b0 <memset>
+      dip->type = type;
+801016e3:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+801016e7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801016ea:	66 89 01             	mov    %ax,(%ecx)
+      log_write(bp);   // mark it allocated on the disk
+801016ed:	89 1c 24             	mov    %ebx,(%esp)
+801016f0:	e8 4b 19 00 00       	call   80103040 <log_write>
+      brelse(bp);
+801016f5:	89 1c 24             	mov    %ebx,(%esp)
+801016f8:	e8 f3 ea ff ff       	call   801001f0 <brelse>
+      return iget(dev, inum);
+801016fd:	83 c4 10             	add    $0x10,%esp
+}
+80101700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80101703:	89 fa                	mov    %edi,%edx
+}
+80101705:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80101706:	89 f0                	mov    %esi,%eax
+}
+80101708:	5e                   	pop    %esi
+80101709:	5f                   	pop    %edi
+8010170a:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010170b:	e9 10 fc ff ff       	jmp    80101320 <iget>
+  panic("ialloc: no inodes");
+80101710:	83 ec 0c             	sub    $0xc,%esp
+80101713:	68 38 84 10 80       	push   $0x80108438
+80101718:	e8 63 ec ff ff       	call   80100380 <panic>
+8010171d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101720 <iupdate>:
+{
+80101720:	55                   	push   %ebp
+80101721:	89 e5                	mov    %esp,%ebp
+80101723:	56                   	push   %esi
+80101724:	53                   	push   %ebx
+80101725:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101728:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010172b:	83 c3 5c             	add    $0x5c,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010172e:	83 ec 08             	sub    $0x8,%esp
+80101731:	c1 e8 03             	shr    $0x3,%eax
+80101734:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+8010173a:	50                   	push   %eax
+8010173b:	ff 73 a4             	push   -0x5c(%ebx)
+8010173e:	e8 8d e9 ff ff       	call   801000d0 <bread>
+  dip->type = ip->type;
+80101743:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101747:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010174a:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010174c:	8b 43 a8             	mov    -0x58(%ebx),%eax
+8010174f:	83 e0 07             	and    $0x7,%eax
+80101752:	c1 e0 06             	shl    $0x6,%eax
+80101755:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80101759:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+8010175c:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101760:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+80101763:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+80101767:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+8010176b:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+8010176f:	0f b7 53 fa          	movzwl -0x6(%ebx),%edx
+80101773:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80101777:	8b 53 fc             	mov    -0x4(%ebx),%edx
+8010177a:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010177d:	6a 34                	push   $0x34
+8010177f:	53                   	push   %ebx
+80101780:	50                   	push   %eax
+80101781:	e8 ba 3e 00 00       	call   80105640 <memmove>
+  log_write(bp);
+80101786:	89 34 24             	mov    %esi,(%esp)
+80101789:	e8 b2 18 00 00       	call   80103040 <log_write>
+  brelse(bp);
+8010178e:	89 75 08             	mov    %esi,0x8(%ebp)
+80101791:	83 c4 10             	add    $0x10,%esp
+}
+80101794:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101797:	5b                   	pop    %ebx
+80101798:	5e                   	pop    %esi
+80101799:	5d                   	pop    %ebp
+  brelse(bp);
+8010179a:	e9 51 ea ff ff       	jmp    801001f0 <brelse>
+8010179f:	90                   	nop
+
+801017a0 <idup>:
+{
+801017a0:	55                   	push   %ebp
+801017a1:	89 e5                	mov    %esp,%ebp
+801017a3:	53                   	push   %ebx
+801017a4:	83 ec 10             	sub    $0x10,%esp
+801017a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+801017aa:	68 60 09 11 80       	push   $0x80110960
+801017af:	e8 1c 3d 00 00       	call   801054d0 <acquire>
+  ip->ref++;
+801017b4:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+801017b8:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+801017bf:	e8 ac 3c 00 00       	call   80105470 <release>
+}
+801017c4:	89 d8                	mov    %ebx,%eax
+801017c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801017c9:	c9                   	leave
+801017ca:	c3                   	ret
+801017cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801017cf:	90                   	nop
+
+801017d0 <ilock>:
+{
+801017d0:	55                   	push   %ebp
+801017d1:	89 e5                	mov    %esp,%ebp
+801017d3:	56                   	push   %esi
+801017d4:	53                   	push   %ebx
+801017d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+801017d8:	85 db                	test   %ebx,%ebx
+801017da:	0f 84 b7 00 00 00    	je     80101897 <ilock+0xc7>
+801017e0:	8b 53 08             	mov    0x8(%ebx),%edx
+801017e3:	85 d2                	test   %edx,%edx
+801017e5:	0f 8e ac 00 00 00    	jle    80101897 <ilock+0xc7>
+  acquiresleep(&ip->lock);
+801017eb:	83 ec 0c             	sub    $0xc,%esp
+801017ee:	8d 43 0c             	lea    0xc(%ebx),%eax
+801017f1:	50                   	push   %eax
+801017f2:	e8 09 3a 00 00       	call   80105200 <acquiresleep>
+  if(ip->valid == 0){
+801017f7:	8b 43 4c             	mov    0x4c(%ebx),%eax
+801017fa:	83 c4 10             	add    $0x10,%esp
+801017fd:	85 c0                	test   %eax,%eax
+801017ff:	74 0f                	je     80101810 <ilock+0x40>
+}
+80101801:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101804:	5b                   	pop    %ebx
+80101805:	5e                   	pop    %esi
+80101806:	5d                   	pop    %ebp
+80101807:	c3                   	ret
+80101808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010180f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101810:	8b 43 04             	mov    0x4(%ebx),%eax
+80101813:	83 ec 08             	sub    $0x8,%esp
+80101816:	c1 e8 03             	shr    $0x3,%eax
+80101819:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+8010181f:	50                   	push   %eax
+80101820:	ff 33                	push   (%ebx)
+80101822:	e8 a9 e8 ff ff       	call   801000d0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80101827:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010182a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010182c:	8b 43 04             	mov    0x4(%ebx),%eax
+8010182f:	83 e0 07             	and    $0x7,%eax
+80101832:	c1 e0 06             	shl    $0x6,%eax
+80101835:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    ip->type = dip->type;
+80101839:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+8010183c:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+8010183f:	66 89 53 50          	mov    %dx,0x50(%ebx)
+    ip->major = dip->major;
+80101843:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+80101847:	66 89 53 52          	mov    %dx,0x52(%ebx)
+    ip->minor = dip->minor;
+8010184b:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+8010184f:	66 89 53 54          	mov    %dx,0x54(%ebx)
+    ip->nlink = dip->nlink;
+80101853:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+80101857:	66 89 53 56          	mov    %dx,0x56(%ebx)
+    ip->size = dip->size;
+8010185b:	8b 50 fc             	mov    -0x4(%eax),%edx
+8010185e:	89 53 58             	mov    %edx,0x58(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80101861:	6a 34                	push   $0x34
+80101863:	50                   	push   %eax
+80101864:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80101867:	50                   	push   %eax
+80101868:	e8 d3 3d 00 00       	call   80105640 <memmove>
+    brelse(bp);
+8010186d:	89 34 24             	mov    %esi,(%esp)
+80101870:	e8 7b e9 ff ff       	call   801001f0 <brelse>
+    if(ip->type == 0)
+80101875:	83 c4 10             	add    $0x10,%esp
+80101878:	66 83 7b 50 00       	cmpw   $0x0,0x50(%ebx)
+    ip->valid = 1;
+8010187d:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+80101884:	0f 85 77 ff ff ff    	jne    80101801 <ilock+0x31>
+      panic("ilock: no type");
+8010188a:	83 ec 0c             	sub    $0xc,%esp
+8010188d:	68 50 84 10 80       	push   $0x80108450
+80101892:	e8 e9 ea ff ff       	call   80100380 <panic>
+    panic("ilock");
+80101897:	83 ec 0c             	sub    $0xc,%esp
+8010189a:	68 4a 84 10 80       	push   $0x8010844a
+8010189f:	e8 dc ea ff ff       	call   80100380 <panic>
+801018a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801018af:	90                   	nop
+
+801018b0 <iunlock>:
+{
+801018b0:	55                   	push   %ebp
+801018b1:	89 e5                	mov    %esp,%ebp
+801018b3:	56                   	push   %esi
+801018b4:	53                   	push   %ebx
+801018b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801018b8:	85 db                	test   %ebx,%ebx
+801018ba:	74 28                	je     801018e4 <iunlock+0x34>
+801018bc:	83 ec 0c             	sub    $0xc,%esp
+801018bf:	8d 73 0c             	lea    0xc(%ebx),%esi
+801018c2:	56                   	push   %esi
+801018c3:	e8 d8 39 00 00       	call   801052a0 <holdingsleep>
+801018c8:	83 c4 10             	add    $0x10,%esp
+801018cb:	85 c0                	test   %eax,%eax
+801018cd:	74 15                	je     801018e4 <iunlock+0x34>
+801018cf:	8b 43 08             	mov    0x8(%ebx),%eax
+801018d2:	85 c0                	test   %eax,%eax
+801018d4:	7e 0e                	jle    801018e4 <iunlock+0x34>
+  releasesleep(&ip->lock);
+801018d6:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+801018d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801018dc:	5b                   	pop    %ebx
+801018dd:	5e                   	pop    %esi
+801018de:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+801018df:	e9 7c 39 00 00       	jmp    80105260 <releasesleep>
+    panic("iunlock");
+801018e4:	83 ec 0c             	sub    $0xc,%esp
+801018e7:	68 5f 84 10 80       	push   $0x8010845f
+801018ec:	e8 8f ea ff ff       	call   80100380 <panic>
+801018f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ff:	90                   	nop
+
+80101900 <iput>:
+{
+80101900:	55                   	push   %ebp
+80101901:	89 e5                	mov    %esp,%ebp
+80101903:	57                   	push   %edi
+80101904:	56                   	push   %esi
+80101905:	53                   	push   %ebx
+80101906:	83 ec 28             	sub    $0x28,%esp
+80101909:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010190c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+8010190f:	57                   	push   %edi
+80101910:	e8 eb 38 00 00       	call   80105200 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80101915:	8b 53 4c             	mov    0x4c(%ebx),%edx
+80101918:	83 c4 10             	add    $0x10,%esp
+8010191b:	85 d2                	test   %edx,%edx
+8010191d:	74 07                	je     80101926 <iput+0x26>
+8010191f:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80101924:	74 32                	je     80101958 <iput+0x58>
+  releasesleep(&ip->lock);
+80101926:	83 ec 0c             	sub    $0xc,%esp
+80101929:	57                   	push   %edi
+8010192a:	e8 31 39 00 00       	call   80105260 <releasesleep>
+  acquire(&icache.lock);
+8010192f:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+80101936:	e8 95 3b 00 00       	call   801054d0 <acquire>
+  ip->ref--;
+8010193b:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+8010193f:	83 c4 10             	add    $0x10,%esp
+80101942:	c7 45 08 60 09 11 80 	movl   $0x80110960,0x8(%ebp)
+}
+80101949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010194c:	5b                   	pop    %ebx
+8010194d:	5e                   	pop    %esi
+8010194e:	5f                   	pop    %edi
+8010194f:	5d                   	pop    %ebp
+  release(&icache.lock);
+80101950:	e9 1b 3b 00 00       	jmp    80105470 <release>
+80101955:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&icache.lock);
+80101958:	83 ec 0c             	sub    $0xc,%esp
+8010195b:	68 60 09 11 80       	push   $0x80110960
+80101960:	e8 6b 3b 00 00       	call   801054d0 <acquire>
+    int r = ip->ref;
+80101965:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80101968:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+8010196f:	e8 fc 3a 00 00       	call   80105470 <release>
+    if(r == 1){
+80101974:	83 c4 10             	add    $0x10,%esp
+80101977:	83 fe 01             	cmp    $0x1,%esi
+8010197a:	75 aa                	jne    80101926 <iput+0x26>
+8010197c:	8d 8b 8c 00 00 00    	lea    0x8c(%ebx),%ecx
+80101982:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101985:	8d 73 5c             	lea    0x5c(%ebx),%esi
+80101988:	89 df                	mov    %ebx,%edi
+8010198a:	89 cb                	mov    %ecx,%ebx
+8010198c:	eb 09                	jmp    80101997 <iput+0x97>
+8010198e:	66 90                	xchg   %ax,%ax
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  for(i = 0; i < NDIRECT; i++){
+80101990:	83 c6 04             	add    $0x4,%esi
+80101993:	39 de                	cmp    %ebx,%esi
+80101995:	74 19                	je     801019b0 <iput+0xb0>
+    if(ip->addrs[i]){
+80101997:	8b 16                	mov    (%esi),%edx
+80101999:	85 d2                	test   %edx,%edx
+8010199b:	74 f3                	je     80101990 <iput+0x90>
+      bfree(ip->dev, ip->addrs[i]);
+8010199d:	8b 07                	mov    (%edi),%eax
+8010199f:	e8 7c fa ff ff       	call   80101420 <bfree>
+      ip->addrs[i] = 0;
+801019a4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+801019aa:	eb e4                	jmp    80101990 <iput+0x90>
+801019ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+801019b0:	89 fb                	mov    %edi,%ebx
+801019b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801019b5:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+801019bb:	85 c0                	test   %eax,%eax
+801019bd:	75 2d                	jne    801019ec <iput+0xec>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+  iupdate(ip);
+801019bf:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+801019c2:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  iupdate(ip);
+801019c9:	53                   	push   %ebx
+801019ca:	e8 51 fd ff ff       	call   80101720 <iupdate>
+      ip->type = 0;
+801019cf:	31 c0                	xor    %eax,%eax
+801019d1:	66 89 43 50          	mov    %ax,0x50(%ebx)
+      iupdate(ip);
+801019d5:	89 1c 24             	mov    %ebx,(%esp)
+801019d8:	e8 43 fd ff ff       	call   80101720 <iupdate>
+      ip->valid = 0;
+801019dd:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+801019e4:	83 c4 10             	add    $0x10,%esp
+801019e7:	e9 3a ff ff ff       	jmp    80101926 <iput+0x26>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+801019ec:	83 ec 08             	sub    $0x8,%esp
+801019ef:	50                   	push   %eax
+801019f0:	ff 33                	push   (%ebx)
+801019f2:	e8 d9 e6 ff ff       	call   801000d0 <bread>
+    for(j = 0; j < NINDIRECT; j++){
+801019f7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801019fa:	83 c4 10             	add    $0x10,%esp
+801019fd:	8d 88 5c 02 00 00    	lea    0x25c(%eax),%ecx
+80101a03:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101a06:	8d 70 5c             	lea    0x5c(%eax),%esi
+80101a09:	89 cf                	mov    %ecx,%edi
+80101a0b:	eb 0a                	jmp    80101a17 <iput+0x117>
+80101a0d:	8d 76 00             	lea    0x0(%esi),%esi
+80101a10:	83 c6 04             	add    $0x4,%esi
+80101a13:	39 fe                	cmp    %edi,%esi
+80101a15:	74 0f                	je     80101a26 <iput+0x126>
+      if(a[j])
+80101a17:	8b 16                	mov    (%esi),%edx
+80101a19:	85 d2                	test   %edx,%edx
+80101a1b:	74 f3                	je     80101a10 <iput+0x110>
+        bfree(ip->dev, a[j]);
+80101a1d:	8b 03                	mov    (%ebx),%eax
+80101a1f:	e8 fc f9 ff ff       	call   80101420 <bfree>
+80101a24:	eb ea                	jmp    80101a10 <iput+0x110>
+    brelse(bp);
+80101a26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101a29:	83 ec 0c             	sub    $0xc,%esp
+80101a2c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101a2f:	50                   	push   %eax
+80101a30:	e8 bb e7 ff ff       	call   801001f0 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80101a35:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80101a3b:	8b 03                	mov    (%ebx),%eax
+80101a3d:	e8 de f9 ff ff       	call   80101420 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80101a42:	83 c4 10             	add    $0x10,%esp
+80101a45:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80101a4c:	00 00 00 
+80101a4f:	e9 6b ff ff ff       	jmp    801019bf <iput+0xbf>
+80101a54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101a5f:	90                   	nop
+
+80101a60 <iunlockput>:
+{
+80101a60:	55                   	push   %ebp
+80101a61:	89 e5                	mov    %esp,%ebp
+80101a63:	56                   	push   %esi
+80101a64:	53                   	push   %ebx
+80101a65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101a68:	85 db                	test   %ebx,%ebx
+80101a6a:	74 34                	je     80101aa0 <iunlockput+0x40>
+80101a6c:	83 ec 0c             	sub    $0xc,%esp
+80101a6f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101a72:	56                   	push   %esi
+80101a73:	e8 28 38 00 00       	call   801052a0 <holdingsleep>
+80101a78:	83 c4 10             	add    $0x10,%esp
+80101a7b:	85 c0                	test   %eax,%eax
+80101a7d:	74 21                	je     80101aa0 <iunlockput+0x40>
+80101a7f:	8b 43 08             	mov    0x8(%ebx),%eax
+80101a82:	85 c0                	test   %eax,%eax
+80101a84:	7e 1a                	jle    80101aa0 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80101a86:	83 ec 0c             	sub    $0xc,%esp
+80101a89:	56                   	push   %esi
+80101a8a:	e8 d1 37 00 00       	call   80105260 <releasesleep>
+  iput(ip);
+80101a8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101a92:	83 c4 10             	add    $0x10,%esp
+}
+80101a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101a98:	5b                   	pop    %ebx
+80101a99:	5e                   	pop    %esi
+80101a9a:	5d                   	pop    %ebp
+  iput(ip);
+80101a9b:	e9 60 fe ff ff       	jmp    80101900 <iput>
+    panic("iunlock");
+80101aa0:	83 ec 0c             	sub    $0xc,%esp
+80101aa3:	68 5f 84 10 80       	push   $0x8010845f
+80101aa8:	e8 d3 e8 ff ff       	call   80100380 <panic>
+80101aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101ab0 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80101ab0:	55                   	push   %ebp
+80101ab1:	89 e5                	mov    %esp,%ebp
+80101ab3:	8b 55 08             	mov    0x8(%ebp),%edx
+80101ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80101ab9:	8b 0a                	mov    (%edx),%ecx
+80101abb:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80101abe:	8b 4a 04             	mov    0x4(%edx),%ecx
+80101ac1:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80101ac4:	0f b7 4a 50          	movzwl 0x50(%edx),%ecx
+80101ac8:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80101acb:	0f b7 4a 56          	movzwl 0x56(%edx),%ecx
+80101acf:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80101ad3:	8b 52 58             	mov    0x58(%edx),%edx
+80101ad6:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80101ad9:	5d                   	pop    %ebp
+80101ada:	c3                   	ret
+80101adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101adf:	90                   	nop
+
+80101ae0 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80101ae0:	55                   	push   %ebp
+80101ae1:	89 e5                	mov    %esp,%ebp
+80101ae3:	57                   	push   %edi
+80101ae4:	56                   	push   %esi
+80101ae5:	53                   	push   %ebx
+80101ae6:	83 ec 1c             	sub    $0x1c,%esp
+80101ae9:	8b 75 08             	mov    0x8(%ebp),%esi
+80101aec:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101aef:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101af2:	66 83 7e 50 03       	cmpw   $0x3,0x50(%esi)
+{
+80101af7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101afa:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80101afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80101b00:	0f 84 aa 00 00 00    	je     80101bb0 <readi+0xd0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101b06:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80101b09:	8b 56 58             	mov    0x58(%esi),%edx
+80101b0c:	39 fa                	cmp    %edi,%edx
+80101b0e:	0f 82 bd 00 00 00    	jb     80101bd1 <readi+0xf1>
+80101b14:	89 f9                	mov    %edi,%ecx
+80101b16:	31 db                	xor    %ebx,%ebx
+80101b18:	01 c1                	add    %eax,%ecx
+80101b1a:	0f 92 c3             	setb   %bl
+80101b1d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101b20:	0f 82 ab 00 00 00    	jb     80101bd1 <readi+0xf1>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+80101b26:	89 d3                	mov    %edx,%ebx
+80101b28:	29 fb                	sub    %edi,%ebx
+80101b2a:	39 ca                	cmp    %ecx,%edx
+80101b2c:	0f 42 c3             	cmovb  %ebx,%eax
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101b2f:	85 c0                	test   %eax,%eax
+80101b31:	74 73                	je     80101ba6 <readi+0xc6>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101b33:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80101b36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101b40:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80101b43:	89 fa                	mov    %edi,%edx
+80101b45:	c1 ea 09             	shr    $0x9,%edx
+80101b48:	89 d8                	mov    %ebx,%eax
+80101b4a:	e8 51 f9 ff ff       	call   801014a0 <bmap>
+80101b4f:	83 ec 08             	sub    $0x8,%esp
+80101b52:	50                   	push   %eax
+80101b53:	ff 33                	push   (%ebx)
+80101b55:	e8 76 e5 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101b5a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101b5d:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101b62:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101b64:	89 f8                	mov    %edi,%eax
+80101b66:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101b6b:	29 f3                	sub    %esi,%ebx
+80101b6d:	29 c1                	sub    %eax,%ecx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101b6f:	8d 44 02 5c          	lea    0x5c(%edx,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101b73:	39 d9                	cmp    %ebx,%ecx
+80101b75:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101b78:	83 c4 0c             	add    $0xc,%esp
+80101b7b:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101b7c:	01 de                	add    %ebx,%esi
+80101b7e:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+80101b80:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101b83:	50                   	push   %eax
+80101b84:	ff 75 e0             	push   -0x20(%ebp)
+80101b87:	e8 b4 3a 00 00       	call   80105640 <memmove>
+    brelse(bp);
+80101b8c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101b8f:	89 14 24             	mov    %edx,(%esp)
+80101b92:	e8 59 e6 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101b97:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80101b9a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101b9d:	83 c4 10             	add    $0x10,%esp
+80101ba0:	39 de                	cmp    %ebx,%esi
+80101ba2:	72 9c                	jb     80101b40 <readi+0x60>
+80101ba4:	89 d8                	mov    %ebx,%eax
+  }
+  return n;
+}
+80101ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ba9:	5b                   	pop    %ebx
+80101baa:	5e                   	pop    %esi
+80101bab:	5f                   	pop    %edi
+80101bac:	5d                   	pop    %ebp
+80101bad:	c3                   	ret
+80101bae:	66 90                	xchg   %ax,%ax
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80101bb0:	0f bf 56 52          	movswl 0x52(%esi),%edx
+80101bb4:	66 83 fa 09          	cmp    $0x9,%dx
+80101bb8:	77 17                	ja     80101bd1 <readi+0xf1>
+80101bba:	8b 14 d5 00 09 11 80 	mov    -0x7feef700(,%edx,8),%edx
+80101bc1:	85 d2                	test   %edx,%edx
+80101bc3:	74 0c                	je     80101bd1 <readi+0xf1>
+    return devsw[ip->major].read(ip, dst, n);
+80101bc5:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80101bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101bcb:	5b                   	pop    %ebx
+80101bcc:	5e                   	pop    %esi
+80101bcd:	5f                   	pop    %edi
+80101bce:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+80101bcf:	ff e2                	jmp    *%edx
+      return -1;
+80101bd1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101bd6:	eb ce                	jmp    80101ba6 <readi+0xc6>
+80101bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101bdf:	90                   	nop
+
+80101be0 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+80101be0:	55                   	push   %ebp
+80101be1:	89 e5                	mov    %esp,%ebp
+80101be3:	57                   	push   %edi
+80101be4:	56                   	push   %esi
+80101be5:	53                   	push   %ebx
+80101be6:	83 ec 1c             	sub    $0x1c,%esp
+80101be9:	8b 45 08             	mov    0x8(%ebp),%eax
+80101bec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80101bef:	8b 75 14             	mov    0x14(%ebp),%esi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101bf2:	66 83 78 50 03       	cmpw   $0x3,0x50(%eax)
+{
+80101bf7:	89 7d dc             	mov    %edi,-0x24(%ebp)
+80101bfa:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80101bfd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80101c00:	0f 84 ca 00 00 00    	je     80101cd0 <writei+0xf0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101c06:	39 78 58             	cmp    %edi,0x58(%eax)
+80101c09:	0f 82 fa 00 00 00    	jb     80101d09 <writei+0x129>
+80101c0f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101c12:	31 c9                	xor    %ecx,%ecx
+80101c14:	89 f2                	mov    %esi,%edx
+80101c16:	01 fa                	add    %edi,%edx
+80101c18:	0f 92 c1             	setb   %cl
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+80101c1b:	81 fa 00 18 01 00    	cmp    $0x11800,%edx
+80101c21:	0f 87 e2 00 00 00    	ja     80101d09 <writei+0x129>
+80101c27:	85 c9                	test   %ecx,%ecx
+80101c29:	0f 85 da 00 00 00    	jne    80101d09 <writei+0x129>
+    return -1;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101c2f:	85 f6                	test   %esi,%esi
+80101c31:	0f 84 86 00 00 00    	je     80101cbd <writei+0xdd>
+80101c37:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101c3e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80101c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101c48:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80101c4b:	89 fa                	mov    %edi,%edx
+80101c4d:	c1 ea 09             	shr    $0x9,%edx
+80101c50:	89 f0                	mov    %esi,%eax
+80101c52:	e8 49 f8 ff ff       	call   801014a0 <bmap>
+80101c57:	83 ec 08             	sub    $0x8,%esp
+80101c5a:	50                   	push   %eax
+80101c5b:	ff 36                	push   (%esi)
+80101c5d:	e8 6e e4 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101c62:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101c65:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101c68:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101c6d:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101c6f:	89 f8                	mov    %edi,%eax
+80101c71:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101c76:	29 d3                	sub    %edx,%ebx
+80101c78:	29 c1                	sub    %eax,%ecx
+    memmove(bp->data + off%BSIZE, src, m);
+80101c7a:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101c7e:	39 d9                	cmp    %ebx,%ecx
+80101c80:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80101c83:	83 c4 0c             	add    $0xc,%esp
+80101c86:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101c87:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+80101c89:	ff 75 dc             	push   -0x24(%ebp)
+80101c8c:	50                   	push   %eax
+80101c8d:	e8 ae 39 00 00       	call   80105640 <memmove>
+    log_write(bp);
+80101c92:	89 34 24             	mov    %esi,(%esp)
+80101c95:	e8 a6 13 00 00       	call   80103040 <log_write>
+    brelse(bp);
+80101c9a:	89 34 24             	mov    %esi,(%esp)
+80101c9d:	e8 4e e5 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101ca2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+80101ca5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101ca8:	83 c4 10             	add    $0x10,%esp
+80101cab:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80101cae:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101cb1:	39 d8                	cmp    %ebx,%eax
+80101cb3:	72 93                	jb     80101c48 <writei+0x68>
+  }
+
+  if(n > 0 && off > ip->size){
+80101cb5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101cb8:	39 78 58             	cmp    %edi,0x58(%eax)
+80101cbb:	72 3b                	jb     80101cf8 <writei+0x118>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+80101cbd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80101cc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101cc3:	5b                   	pop    %ebx
+80101cc4:	5e                   	pop    %esi
+80101cc5:	5f                   	pop    %edi
+80101cc6:	5d                   	pop    %ebp
+80101cc7:	c3                   	ret
+80101cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101ccf:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80101cd0:	0f bf 40 52          	movswl 0x52(%eax),%eax
+80101cd4:	66 83 f8 09          	cmp    $0x9,%ax
+80101cd8:	77 2f                	ja     80101d09 <writei+0x129>
+80101cda:	8b 04 c5 04 09 11 80 	mov    -0x7feef6fc(,%eax,8),%eax
+80101ce1:	85 c0                	test   %eax,%eax
+80101ce3:	74 24                	je     80101d09 <writei+0x129>
+    return devsw[ip->major].write(ip, src, n);
+80101ce5:	89 75 10             	mov    %esi,0x10(%ebp)
+}
+80101ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ceb:	5b                   	pop    %ebx
+80101cec:	5e                   	pop    %esi
+80101ced:	5f                   	pop    %edi
+80101cee:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80101cef:	ff e0                	jmp    *%eax
+80101cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80101cf8:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+80101cfb:	89 78 58             	mov    %edi,0x58(%eax)
+    iupdate(ip);
+80101cfe:	50                   	push   %eax
+80101cff:	e8 1c fa ff ff       	call   80101720 <iupdate>
+80101d04:	83 c4 10             	add    $0x10,%esp
+80101d07:	eb b4                	jmp    80101cbd <writei+0xdd>
+      return -1;
+80101d09:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101d0e:	eb b0                	jmp    80101cc0 <writei+0xe0>
+
+80101d10 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80101d10:	55                   	push   %ebp
+80101d11:	89 e5                	mov    %esp,%ebp
+80101d13:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80101d16:	6a 0e                	push   $0xe
+80101d18:	ff 75 0c             	push   0xc(%ebp)
+80101d1b:	ff 75 08             	push   0x8(%ebp)
+80101d1e:	e8 8d 39 00 00       	call   801056b0 <strncmp>
+}
+80101d23:	c9                   	leave
+80101d24:	c3                   	ret
+80101d25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101d30 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80101d30:	55                   	push   %ebp
+80101d31:	89 e5                	mov    %esp,%ebp
+80101d33:	57                   	push   %edi
+80101d34:	56                   	push   %esi
+80101d35:	53                   	push   %ebx
+80101d36:	83 ec 1c             	sub    $0x1c,%esp
+80101d39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+80101d3c:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80101d41:	0f 85 85 00 00 00    	jne    80101dcc <dirlookup+0x9c>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101d47:	8b 53 58             	mov    0x58(%ebx),%edx
+80101d4a:	31 ff                	xor    %edi,%edi
+80101d4c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80101d4f:	85 d2                	test   %edx,%edx
+80101d51:	74 3e                	je     80101d91 <dirlookup+0x61>
+80101d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101d57:	90                   	nop
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101d58:	6a 10                	push   $0x10
+80101d5a:	57                   	push   %edi
+80101d5b:	56                   	push   %esi
+80101d5c:	53                   	push   %ebx
+80101d5d:	e8 7e fd ff ff       	call   80101ae0 <readi>
+80101d62:	83 c4 10             	add    $0x10,%esp
+80101d65:	83 f8 10             	cmp    $0x10,%eax
+80101d68:	75 55                	jne    80101dbf <dirlookup+0x8f>
+      panic("dirlookup read");
+    if(de.inum == 0)
+80101d6a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80101d6f:	74 18                	je     80101d89 <dirlookup+0x59>
+  return strncmp(s, t, DIRSIZ);
+80101d71:	83 ec 04             	sub    $0x4,%esp
+80101d74:	8d 45 da             	lea    -0x26(%ebp),%eax
+80101d77:	6a 0e                	push   $0xe
+80101d79:	50                   	push   %eax
+80101d7a:	ff 75 0c             	push   0xc(%ebp)
+80101d7d:	e8 2e 39 00 00       	call   801056b0 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+80101d82:	83 c4 10             	add    $0x10,%esp
+80101d85:	85 c0                	test   %eax,%eax
+80101d87:	74 17                	je     80101da0 <dirlookup+0x70>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101d89:	83 c7 10             	add    $0x10,%edi
+80101d8c:	3b 7b 58             	cmp    0x58(%ebx),%edi
+80101d8f:	72 c7                	jb     80101d58 <dirlookup+0x28>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+80101d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80101d94:	31 c0                	xor    %eax,%eax
+}
+80101d96:	5b                   	pop    %ebx
+80101d97:	5e                   	pop    %esi
+80101d98:	5f                   	pop    %edi
+80101d99:	5d                   	pop    %ebp
+80101d9a:	c3                   	ret
+80101d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101d9f:	90                   	nop
+      if(poff)
+80101da0:	8b 45 10             	mov    0x10(%ebp),%eax
+80101da3:	85 c0                	test   %eax,%eax
+80101da5:	74 05                	je     80101dac <dirlookup+0x7c>
+        *poff = off;
+80101da7:	8b 45 10             	mov    0x10(%ebp),%eax
+80101daa:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+80101dac:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80101db0:	8b 03                	mov    (%ebx),%eax
+80101db2:	e8 69 f5 ff ff       	call   80101320 <iget>
+}
+80101db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101dba:	5b                   	pop    %ebx
+80101dbb:	5e                   	pop    %esi
+80101dbc:	5f                   	pop    %edi
+80101dbd:	5d                   	pop    %ebp
+80101dbe:	c3                   	ret
+      panic("dirlookup read");
+80101dbf:	83 ec 0c             	sub    $0xc,%esp
+80101dc2:	68 79 84 10 80       	push   $0x80108479
+80101dc7:	e8 b4 e5 ff ff       	call   80100380 <panic>
+    panic("dirlookup not DIR");
+80101dcc:	83 ec 0c             	sub    $0xc,%esp
+80101dcf:	68 67 84 10 80       	push   $0x80108467
+80101dd4:	e8 a7 e5 ff ff       	call   80100380 <panic>
+80101dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101de0 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80101de0:	55                   	push   %ebp
+80101de1:	89 e5                	mov    %esp,%ebp
+80101de3:	57                   	push   %edi
+80101de4:	56                   	push   %esi
+80101de5:	53                   	push   %ebx
+80101de6:	89 c3                	mov    %eax,%ebx
+80101de8:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80101deb:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+80101dee:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101df1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80101df4:	0f 84 64 01 00 00    	je     80101f5e <namex+0x17e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80101dfa:	e8 81 20 00 00       	call   80103e80 <myproc>
+  acquire(&icache.lock);
+80101dff:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80101e02:	8b 70 68             	mov    0x68(%eax),%esi
+  acquire(&icache.lock);
+80101e05:	68 60 09 11 80       	push   $0x80110960
+80101e0a:	e8 c1 36 00 00       	call   801054d0 <acquire>
+  ip->ref++;
+80101e0f:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80101e13:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+80101e1a:	e8 51 36 00 00       	call   80105470 <release>
+80101e1f:	83 c4 10             	add    $0x10,%esp
+80101e22:	eb 07                	jmp    80101e2b <namex+0x4b>
+80101e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80101e28:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101e2b:	0f b6 03             	movzbl (%ebx),%eax
+80101e2e:	3c 2f                	cmp    $0x2f,%al
+80101e30:	74 f6                	je     80101e28 <namex+0x48>
+  if(*path == 0)
+80101e32:	84 c0                	test   %al,%al
+80101e34:	0f 84 06 01 00 00    	je     80101f40 <namex+0x160>
+  while(*path != '/' && *path != 0)
+80101e3a:	0f b6 03             	movzbl (%ebx),%eax
+80101e3d:	84 c0                	test   %al,%al
+80101e3f:	0f 84 10 01 00 00    	je     80101f55 <namex+0x175>
+80101e45:	89 df                	mov    %ebx,%edi
+80101e47:	3c 2f                	cmp    $0x2f,%al
+80101e49:	0f 84 06 01 00 00    	je     80101f55 <namex+0x175>
+80101e4f:	90                   	nop
+80101e50:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80101e54:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80101e57:	3c 2f                	cmp    $0x2f,%al
+80101e59:	74 04                	je     80101e5f <namex+0x7f>
+80101e5b:	84 c0                	test   %al,%al
+80101e5d:	75 f1                	jne    80101e50 <namex+0x70>
+  len = path - s;
+80101e5f:	89 f8                	mov    %edi,%eax
+80101e61:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80101e63:	83 f8 0d             	cmp    $0xd,%eax
+80101e66:	0f 8e ac 00 00 00    	jle    80101f18 <namex+0x138>
+    memmove(name, s, DIRSIZ);
+80101e6c:	83 ec 04             	sub    $0x4,%esp
+80101e6f:	6a 0e                	push   $0xe
+80101e71:	53                   	push   %ebx
+    path++;
+80101e72:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+80101e74:	ff 75 e4             	push   -0x1c(%ebp)
+80101e77:	e8 c4 37 00 00       	call   80105640 <memmove>
+80101e7c:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80101e7f:	80 3f 2f             	cmpb   $0x2f,(%edi)
+80101e82:	75 0c                	jne    80101e90 <namex+0xb0>
+80101e84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80101e88:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101e8b:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101e8e:	74 f8                	je     80101e88 <namex+0xa8>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+80101e90:	83 ec 0c             	sub    $0xc,%esp
+80101e93:	56                   	push   %esi
+80101e94:	e8 37 f9 ff ff       	call   801017d0 <ilock>
+    if(ip->type != T_DIR){
+80101e99:	83 c4 10             	add    $0x10,%esp
+80101e9c:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80101ea1:	0f 85 cd 00 00 00    	jne    80101f74 <namex+0x194>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+80101ea7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101eaa:	85 c0                	test   %eax,%eax
+80101eac:	74 09                	je     80101eb7 <namex+0xd7>
+80101eae:	80 3b 00             	cmpb   $0x0,(%ebx)
+80101eb1:	0f 84 34 01 00 00    	je     80101feb <namex+0x20b>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101eb7:	83 ec 04             	sub    $0x4,%esp
+80101eba:	6a 00                	push   $0x0
+80101ebc:	ff 75 e4             	push   -0x1c(%ebp)
+80101ebf:	56                   	push   %esi
+80101ec0:	e8 6b fe ff ff       	call   80101d30 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101ec5:	8d 56 0c             	lea    0xc(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101ec8:	83 c4 10             	add    $0x10,%esp
+80101ecb:	89 c7                	mov    %eax,%edi
+80101ecd:	85 c0                	test   %eax,%eax
+80101ecf:	0f 84 e1 00 00 00    	je     80101fb6 <namex+0x1d6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101ed5:	83 ec 0c             	sub    $0xc,%esp
+80101ed8:	52                   	push   %edx
+80101ed9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101edc:	e8 bf 33 00 00       	call   801052a0 <holdingsleep>
+80101ee1:	83 c4 10             	add    $0x10,%esp
+80101ee4:	85 c0                	test   %eax,%eax
+80101ee6:	0f 84 3f 01 00 00    	je     8010202b <namex+0x24b>
+80101eec:	8b 56 08             	mov    0x8(%esi),%edx
+80101eef:	85 d2                	test   %edx,%edx
+80101ef1:	0f 8e 34 01 00 00    	jle    8010202b <namex+0x24b>
+  releasesleep(&ip->lock);
+80101ef7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101efa:	83 ec 0c             	sub    $0xc,%esp
+80101efd:	52                   	push   %edx
+80101efe:	e8 5d 33 00 00       	call   80105260 <releasesleep>
+  iput(ip);
+80101f03:	89 34 24             	mov    %esi,(%esp)
+80101f06:	89 fe                	mov    %edi,%esi
+80101f08:	e8 f3 f9 ff ff       	call   80101900 <iput>
+80101f0d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80101f10:	e9 16 ff ff ff       	jmp    80101e2b <namex+0x4b>
+80101f15:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80101f18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101f1b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+80101f1e:	83 ec 04             	sub    $0x4,%esp
+80101f21:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101f24:	50                   	push   %eax
+80101f25:	53                   	push   %ebx
+    name[len] = 0;
+80101f26:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80101f28:	ff 75 e4             	push   -0x1c(%ebp)
+80101f2b:	e8 10 37 00 00       	call   80105640 <memmove>
+    name[len] = 0;
+80101f30:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101f33:	83 c4 10             	add    $0x10,%esp
+80101f36:	c6 02 00             	movb   $0x0,(%edx)
+80101f39:	e9 41 ff ff ff       	jmp    80101e7f <namex+0x9f>
+80101f3e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80101f40:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101f43:	85 c0                	test   %eax,%eax
+80101f45:	0f 85 d0 00 00 00    	jne    8010201b <namex+0x23b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80101f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101f4e:	89 f0                	mov    %esi,%eax
+80101f50:	5b                   	pop    %ebx
+80101f51:	5e                   	pop    %esi
+80101f52:	5f                   	pop    %edi
+80101f53:	5d                   	pop    %ebp
+80101f54:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80101f55:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101f58:	89 df                	mov    %ebx,%edi
+80101f5a:	31 c0                	xor    %eax,%eax
+80101f5c:	eb c0                	jmp    80101f1e <namex+0x13e>
+    ip = iget(ROOTDEV, ROOTINO);
+80101f5e:	ba 01 00 00 00       	mov    $0x1,%edx
+80101f63:	b8 01 00 00 00       	mov    $0x1,%eax
+80101f68:	e8 b3 f3 ff ff       	call   80101320 <iget>
+80101f6d:	89 c6                	mov    %eax,%esi
+80101f6f:	e9 b7 fe ff ff       	jmp    80101e2b <namex+0x4b>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101f74:	83 ec 0c             	sub    $0xc,%esp
+80101f77:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80101f7a:	53                   	push   %ebx
+80101f7b:	e8 20 33 00 00       	call   801052a0 <holdingsleep>
+80101f80:	83 c4 10             	add    $0x10,%esp
+80101f83:	85 c0                	test   %eax,%eax
+80101f85:	0f 84 a0 00 00 00    	je     8010202b <namex+0x24b>
+80101f8b:	8b 46 08             	mov    0x8(%esi),%eax
+80101f8e:	85 c0                	test   %eax,%eax
+80101f90:	0f 8e 95 00 00 00    	jle    8010202b <namex+0x24b>
+  releasesleep(&ip->lock);
+80101f96:	83 ec 0c             	sub    $0xc,%esp
+80101f99:	53                   	push   %ebx
+80101f9a:	e8 c1 32 00 00       	call   80105260 <releasesleep>
+  iput(ip);
+80101f9f:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80101fa2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80101fa4:	e8 57 f9 ff ff       	call   80101900 <iput>
+      return 0;
+80101fa9:	83 c4 10             	add    $0x10,%esp
+}
+80101fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101faf:	89 f0                	mov    %esi,%eax
+80101fb1:	5b                   	pop    %ebx
+80101fb2:	5e                   	pop    %esi
+80101fb3:	5f                   	pop    %edi
+80101fb4:	5d                   	pop    %ebp
+80101fb5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101fb6:	83 ec 0c             	sub    $0xc,%esp
+80101fb9:	52                   	push   %edx
+80101fba:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80101fbd:	e8 de 32 00 00       	call   801052a0 <holdingsleep>
+80101fc2:	83 c4 10             	add    $0x10,%esp
+80101fc5:	85 c0                	test   %eax,%eax
+80101fc7:	74 62                	je     8010202b <namex+0x24b>
+80101fc9:	8b 4e 08             	mov    0x8(%esi),%ecx
+80101fcc:	85 c9                	test   %ecx,%ecx
+80101fce:	7e 5b                	jle    8010202b <namex+0x24b>
+  releasesleep(&ip->lock);
+80101fd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101fd3:	83 ec 0c             	sub    $0xc,%esp
+80101fd6:	52                   	push   %edx
+80101fd7:	e8 84 32 00 00       	call   80105260 <releasesleep>
+  iput(ip);
+80101fdc:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80101fdf:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80101fe1:	e8 1a f9 ff ff       	call   80101900 <iput>
+      return 0;
+80101fe6:	83 c4 10             	add    $0x10,%esp
+80101fe9:	eb c1                	jmp    80101fac <namex+0x1cc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101feb:	83 ec 0c             	sub    $0xc,%esp
+80101fee:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80101ff1:	53                   	push   %ebx
+80101ff2:	e8 a9 32 00 00       	call   801052a0 <holdingsleep>
+80101ff7:	83 c4 10             	add    $0x10,%esp
+80101ffa:	85 c0                	test   %eax,%eax
+80101ffc:	74 2d                	je     8010202b <namex+0x24b>
+80101ffe:	8b 7e 08             	mov    0x8(%esi),%edi
+80102001:	85 ff                	test   %edi,%edi
+80102003:	7e 26                	jle    8010202b <namex+0x24b>
+  releasesleep(&ip->lock);
+80102005:	83 ec 0c             	sub    $0xc,%esp
+80102008:	53                   	push   %ebx
+80102009:	e8 52 32 00 00       	call   80105260 <releasesleep>
+}
+8010200e:	83 c4 10             	add    $0x10,%esp
+}
+80102011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102014:	89 f0                	mov    %esi,%eax
+80102016:	5b                   	pop    %ebx
+80102017:	5e                   	pop    %esi
+80102018:	5f                   	pop    %edi
+80102019:	5d                   	pop    %ebp
+8010201a:	c3                   	ret
+    iput(ip);
+8010201b:	83 ec 0c             	sub    $0xc,%esp
+8010201e:	56                   	push   %esi
+      return 0;
+8010201f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80102021:	e8 da f8 ff ff       	call   80101900 <iput>
+    return 0;
+80102026:	83 c4 10             	add    $0x10,%esp
+80102029:	eb 81                	jmp    80101fac <namex+0x1cc>
+    panic("iunlock");
+8010202b:	83 ec 0c             	sub    $0xc,%esp
+8010202e:	68 5f 84 10 80       	push   $0x8010845f
+80102033:	e8 48 e3 ff ff       	call   80100380 <panic>
+80102038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010203f:	90                   	nop
+
+80102040 <dirlink>:
+{
+80102040:	55                   	push   %ebp
+80102041:	89 e5                	mov    %esp,%ebp
+80102043:	57                   	push   %edi
+80102044:	56                   	push   %esi
+80102045:	53                   	push   %ebx
+80102046:	83 ec 20             	sub    $0x20,%esp
+80102049:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+8010204c:	6a 00                	push   $0x0
+8010204e:	ff 75 0c             	push   0xc(%ebp)
+80102051:	53                   	push   %ebx
+80102052:	e8 d9 fc ff ff       	call   80101d30 <dirlookup>
+80102057:	83 c4 10             	add    $0x10,%esp
+8010205a:	85 c0                	test   %eax,%eax
+8010205c:	75 67                	jne    801020c5 <dirlink+0x85>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+8010205e:	8b 7b 58             	mov    0x58(%ebx),%edi
+80102061:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102064:	85 ff                	test   %edi,%edi
+80102066:	74 29                	je     80102091 <dirlink+0x51>
+80102068:	31 ff                	xor    %edi,%edi
+8010206a:	8d 75 d8             	lea    -0x28(%ebp),%esi
+8010206d:	eb 09                	jmp    80102078 <dirlink+0x38>
+8010206f:	90                   	nop
+80102070:	83 c7 10             	add    $0x10,%edi
+80102073:	3b 7b 58             	cmp    0x58(%ebx),%edi
+80102076:	73 19                	jae    80102091 <dirlink+0x51>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102078:	6a 10                	push   $0x10
+8010207a:	57                   	push   %edi
+8010207b:	56                   	push   %esi
+8010207c:	53                   	push   %ebx
+8010207d:	e8 5e fa ff ff       	call   80101ae0 <readi>
+80102082:	83 c4 10             	add    $0x10,%esp
+80102085:	83 f8 10             	cmp    $0x10,%eax
+80102088:	75 4e                	jne    801020d8 <dirlink+0x98>
+    if(de.inum == 0)
+8010208a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010208f:	75 df                	jne    80102070 <dirlink+0x30>
+  strncpy(de.name, name, DIRSIZ);
+80102091:	83 ec 04             	sub    $0x4,%esp
+80102094:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102097:	6a 0e                	push   $0xe
+80102099:	ff 75 0c             	push   0xc(%ebp)
+8010209c:	50                   	push   %eax
+8010209d:	e8 5e 36 00 00       	call   80105700 <strncpy>
+  de.inum = inum;
+801020a2:	8b 45 10             	mov    0x10(%ebp),%eax
+801020a5:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801020a9:	6a 10                	push   $0x10
+801020ab:	57                   	push   %edi
+801020ac:	56                   	push   %esi
+801020ad:	53                   	push   %ebx
+801020ae:	e8 2d fb ff ff       	call   80101be0 <writei>
+801020b3:	83 c4 20             	add    $0x20,%esp
+801020b6:	83 f8 10             	cmp    $0x10,%eax
+801020b9:	75 2a                	jne    801020e5 <dirlink+0xa5>
+  return 0;
+801020bb:	31 c0                	xor    %eax,%eax
+}
+801020bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801020c0:	5b                   	pop    %ebx
+801020c1:	5e                   	pop    %esi
+801020c2:	5f                   	pop    %edi
+801020c3:	5d                   	pop    %ebp
+801020c4:	c3                   	ret
+    iput(ip);
+801020c5:	83 ec 0c             	sub    $0xc,%esp
+801020c8:	50                   	push   %eax
+801020c9:	e8 32 f8 ff ff       	call   80101900 <iput>
+    return -1;
+801020ce:	83 c4 10             	add    $0x10,%esp
+801020d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801020d6:	eb e5                	jmp    801020bd <dirlink+0x7d>
+      panic("dirlink read");
+801020d8:	83 ec 0c             	sub    $0xc,%esp
+801020db:	68 88 84 10 80       	push   $0x80108488
+801020e0:	e8 9b e2 ff ff       	call   80100380 <panic>
+    panic("dirlink");
+801020e5:	83 ec 0c             	sub    $0xc,%esp
+801020e8:	68 b6 8a 10 80       	push   $0x80108ab6
+801020ed:	e8 8e e2 ff ff       	call   80100380 <panic>
+801020f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801020f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102100 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102100:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102101:	31 d2                	xor    %edx,%edx
+{
+80102103:	89 e5                	mov    %esp,%ebp
+80102105:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80102108:	8b 45 08             	mov    0x8(%ebp),%eax
+8010210b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010210e:	e8 cd fc ff ff       	call   80101de0 <namex>
+}
+80102113:	c9                   	leave
+80102114:	c3                   	ret
+80102115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010211c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102120 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80102120:	55                   	push   %ebp
+  return namex(path, 1, name);
+80102121:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80102126:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80102128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010212b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+8010212e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+8010212f:	e9 ac fc ff ff       	jmp    80101de0 <namex>
+80102134:	66 90                	xchg   %ax,%ax
+80102136:	66 90                	xchg   %ax,%ax
+80102138:	66 90                	xchg   %ax,%ax
+8010213a:	66 90                	xchg   %ax,%ax
+8010213c:	66 90                	xchg   %ax,%ax
+8010213e:	66 90                	xchg   %ax,%ax
+
+80102140 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80102140:	55                   	push   %ebp
+80102141:	89 e5                	mov    %esp,%ebp
+80102143:	57                   	push   %edi
+80102144:	56                   	push   %esi
+80102145:	53                   	push   %ebx
+80102146:	83 ec 0c             	sub    $0xc,%esp
+  if(b == 0)
+80102149:	85 c0                	test   %eax,%eax
+8010214b:	0f 84 b4 00 00 00    	je     80102205 <idestart+0xc5>
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80102151:	8b 70 08             	mov    0x8(%eax),%esi
+80102154:	89 c3                	mov    %eax,%ebx
+80102156:	81 fe e7 03 00 00    	cmp    $0x3e7,%esi
+8010215c:	0f 87 96 00 00 00    	ja     801021f8 <idestart+0xb8>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102162:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80102167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010216e:	66 90                	xchg   %ax,%ax
+80102170:	89 ca                	mov    %ecx,%edx
+80102172:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102173:	83 e0 c0             	and    $0xffffffc0,%eax
+80102176:	3c 40                	cmp    $0x40,%al
+80102178:	75 f6                	jne    80102170 <idestart+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010217a:	31 ff                	xor    %edi,%edi
+8010217c:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102181:	89 f8                	mov    %edi,%eax
+80102183:	ee                   	out    %al,(%dx)
+80102184:	b8 01 00 00 00       	mov    $0x1,%eax
+80102189:	ba f2 01 00 00       	mov    $0x1f2,%edx
+8010218e:	ee                   	out    %al,(%dx)
+8010218f:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102194:	89 f0                	mov    %esi,%eax
+80102196:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102197:	89 f0                	mov    %esi,%eax
+80102199:	ba f4 01 00 00       	mov    $0x1f4,%edx
+8010219e:	c1 f8 08             	sar    $0x8,%eax
+801021a1:	ee                   	out    %al,(%dx)
+801021a2:	ba f5 01 00 00       	mov    $0x1f5,%edx
+801021a7:	89 f8                	mov    %edi,%eax
+801021a9:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+801021aa:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+801021ae:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801021b3:	c1 e0 04             	shl    $0x4,%eax
+801021b6:	83 e0 10             	and    $0x10,%eax
+801021b9:	83 c8 e0             	or     $0xffffffe0,%eax
+801021bc:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+801021bd:	f6 03 04             	testb  $0x4,(%ebx)
+801021c0:	75 16                	jne    801021d8 <idestart+0x98>
+801021c2:	b8 20 00 00 00       	mov    $0x20,%eax
+801021c7:	89 ca                	mov    %ecx,%edx
+801021c9:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+801021ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801021cd:	5b                   	pop    %ebx
+801021ce:	5e                   	pop    %esi
+801021cf:	5f                   	pop    %edi
+801021d0:	5d                   	pop    %ebp
+801021d1:	c3                   	ret
+801021d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801021d8:	b8 30 00 00 00       	mov    $0x30,%eax
+801021dd:	89 ca                	mov    %ecx,%edx
+801021df:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+801021e0:	b9 80 00 00 00       	mov    $0x80,%ecx
+    outsl(0x1f0, b->data, BSIZE/4);
+801021e5:	8d 73 5c             	lea    0x5c(%ebx),%esi
+801021e8:	ba f0 01 00 00       	mov    $0x1f0,%edx
+801021ed:	fc                   	cld
+801021ee:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+801021f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801021f3:	5b                   	pop    %ebx
+801021f4:	5e                   	pop    %esi
+801021f5:	5f                   	pop    %edi
+801021f6:	5d                   	pop    %ebp
+801021f7:	c3                   	ret
+    panic("incorrect blockno");
+801021f8:	83 ec 0c             	sub    $0xc,%esp
+801021fb:	68 f4 84 10 80       	push   $0x801084f4
+80102200:	e8 7b e1 ff ff       	call   80100380 <panic>
+    panic("idestart");
+80102205:	83 ec 0c             	sub    $0xc,%esp
+80102208:	68 eb 84 10 80       	push   $0x801084eb
+8010220d:	e8 6e e1 ff ff       	call   80100380 <panic>
+80102212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102220 <ideinit>:
+{
+80102220:	55                   	push   %ebp
+80102221:	89 e5                	mov    %esp,%ebp
+80102223:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80102226:	68 06 85 10 80       	push   $0x80108506
+8010222b:	68 00 26 11 80       	push   $0x80112600
+80102230:	e8 bb 30 00 00       	call   801052f0 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102235:	58                   	pop    %eax
+80102236:	a1 84 27 11 80       	mov    0x80112784,%eax
+8010223b:	5a                   	pop    %edx
+8010223c:	83 e8 01             	sub    $0x1,%eax
+8010223f:	50                   	push   %eax
+80102240:	6a 0e                	push   $0xe
+80102242:	e8 99 02 00 00       	call   801024e0 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102247:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010224a:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+8010224f:	90                   	nop
+80102250:	89 ca                	mov    %ecx,%edx
+80102252:	ec                   	in     (%dx),%al
+80102253:	83 e0 c0             	and    $0xffffffc0,%eax
+80102256:	3c 40                	cmp    $0x40,%al
+80102258:	75 f6                	jne    80102250 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010225a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+8010225f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102264:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102265:	89 ca                	mov    %ecx,%edx
+80102267:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102268:	84 c0                	test   %al,%al
+8010226a:	75 1e                	jne    8010228a <ideinit+0x6a>
+8010226c:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80102271:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010227d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+80102280:	83 e9 01             	sub    $0x1,%ecx
+80102283:	74 0f                	je     80102294 <ideinit+0x74>
+80102285:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102286:	84 c0                	test   %al,%al
+80102288:	74 f6                	je     80102280 <ideinit+0x60>
+      havedisk1 = 1;
+8010228a:	c7 05 e0 25 11 80 01 	movl   $0x1,0x801125e0
+80102291:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102294:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102299:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010229e:	ee                   	out    %al,(%dx)
+}
+8010229f:	c9                   	leave
+801022a0:	c3                   	ret
+801022a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022af:	90                   	nop
+
+801022b0 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+801022b0:	55                   	push   %ebp
+801022b1:	89 e5                	mov    %esp,%ebp
+801022b3:	57                   	push   %edi
+801022b4:	56                   	push   %esi
+801022b5:	53                   	push   %ebx
+801022b6:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+801022b9:	68 00 26 11 80       	push   $0x80112600
+801022be:	e8 0d 32 00 00       	call   801054d0 <acquire>
+
+  if((b = idequeue) == 0){
+801022c3:	8b 1d e4 25 11 80    	mov    0x801125e4,%ebx
+801022c9:	83 c4 10             	add    $0x10,%esp
+801022cc:	85 db                	test   %ebx,%ebx
+801022ce:	74 63                	je     80102333 <ideintr+0x83>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+801022d0:	8b 43 58             	mov    0x58(%ebx),%eax
+801022d3:	a3 e4 25 11 80       	mov    %eax,0x801125e4
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+801022d8:	8b 33                	mov    (%ebx),%esi
+801022da:	f7 c6 04 00 00 00    	test   $0x4,%esi
+801022e0:	75 2f                	jne    80102311 <ideintr+0x61>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801022e2:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801022e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022ee:	66 90                	xchg   %ax,%ax
+801022f0:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801022f1:	89 c1                	mov    %eax,%ecx
+801022f3:	83 e1 c0             	and    $0xffffffc0,%ecx
+801022f6:	80 f9 40             	cmp    $0x40,%cl
+801022f9:	75 f5                	jne    801022f0 <ideintr+0x40>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+801022fb:	a8 21                	test   $0x21,%al
+801022fd:	75 12                	jne    80102311 <ideintr+0x61>
+    insl(0x1f0, b->data, BSIZE/4);
+801022ff:	8d 7b 5c             	lea    0x5c(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80102302:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102307:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010230c:	fc                   	cld
+8010230d:	f3 6d                	rep insl (%dx),%es:(%edi)
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+8010230f:	8b 33                	mov    (%ebx),%esi
+  b->flags &= ~B_DIRTY;
+80102311:	83 e6 fb             	and    $0xfffffffb,%esi
+  wakeup(b);
+80102314:	83 ec 0c             	sub    $0xc,%esp
+  b->flags &= ~B_DIRTY;
+80102317:	83 ce 02             	or     $0x2,%esi
+8010231a:	89 33                	mov    %esi,(%ebx)
+  wakeup(b);
+8010231c:	53                   	push   %ebx
+8010231d:	e8 de 28 00 00       	call   80104c00 <wakeup>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80102322:	a1 e4 25 11 80       	mov    0x801125e4,%eax
+80102327:	83 c4 10             	add    $0x10,%esp
+8010232a:	85 c0                	test   %eax,%eax
+8010232c:	74 05                	je     80102333 <ideintr+0x83>
+    idestart(idequeue);
+8010232e:	e8 0d fe ff ff       	call   80102140 <idestart>
+    release(&idelock);
+80102333:	83 ec 0c             	sub    $0xc,%esp
+80102336:	68 00 26 11 80       	push   $0x80112600
+8010233b:	e8 30 31 00 00       	call   80105470 <release>
+
+  release(&idelock);
+}
+80102340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102343:	5b                   	pop    %ebx
+80102344:	5e                   	pop    %esi
+80102345:	5f                   	pop    %edi
+80102346:	5d                   	pop    %ebp
+80102347:	c3                   	ret
+80102348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010234f:	90                   	nop
+
+80102350 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80102350:	55                   	push   %ebp
+80102351:	89 e5                	mov    %esp,%ebp
+80102353:	53                   	push   %ebx
+80102354:	83 ec 10             	sub    $0x10,%esp
+80102357:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+8010235a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010235d:	50                   	push   %eax
+8010235e:	e8 3d 2f 00 00       	call   801052a0 <holdingsleep>
+80102363:	83 c4 10             	add    $0x10,%esp
+80102366:	85 c0                	test   %eax,%eax
+80102368:	0f 84 c3 00 00 00    	je     80102431 <iderw+0xe1>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010236e:	8b 03                	mov    (%ebx),%eax
+80102370:	83 e0 06             	and    $0x6,%eax
+80102373:	83 f8 02             	cmp    $0x2,%eax
+80102376:	0f 84 a8 00 00 00    	je     80102424 <iderw+0xd4>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+8010237c:	8b 53 04             	mov    0x4(%ebx),%edx
+8010237f:	85 d2                	test   %edx,%edx
+80102381:	74 0d                	je     80102390 <iderw+0x40>
+80102383:	a1 e0 25 11 80       	mov    0x801125e0,%eax
+80102388:	85 c0                	test   %eax,%eax
+8010238a:	0f 84 87 00 00 00    	je     80102417 <iderw+0xc7>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80102390:	83 ec 0c             	sub    $0xc,%esp
+80102393:	68 00 26 11 80       	push   $0x80112600
+80102398:	e8 33 31 00 00       	call   801054d0 <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+8010239d:	a1 e4 25 11 80       	mov    0x801125e4,%eax
+  b->qnext = 0;
+801023a2:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801023a9:	83 c4 10             	add    $0x10,%esp
+801023ac:	85 c0                	test   %eax,%eax
+801023ae:	74 60                	je     80102410 <iderw+0xc0>
+801023b0:	89 c2                	mov    %eax,%edx
+801023b2:	8b 40 58             	mov    0x58(%eax),%eax
+801023b5:	85 c0                	test   %eax,%eax
+801023b7:	75 f7                	jne    801023b0 <iderw+0x60>
+801023b9:	83 c2 58             	add    $0x58,%edx
+    ;
+  *pp = b;
+801023bc:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+801023be:	39 1d e4 25 11 80    	cmp    %ebx,0x801125e4
+801023c4:	74 3a                	je     80102400 <iderw+0xb0>
+    idestart(b);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+801023c6:	8b 03                	mov    (%ebx),%eax
+801023c8:	83 e0 06             	and    $0x6,%eax
+801023cb:	83 f8 02             	cmp    $0x2,%eax
+801023ce:	74 1b                	je     801023eb <iderw+0x9b>
+    sleep(b, &idelock);
+801023d0:	83 ec 08             	sub    $0x8,%esp
+801023d3:	68 00 26 11 80       	push   $0x80112600
+801023d8:	53                   	push   %ebx
+801023d9:	e8 52 27 00 00       	call   80104b30 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+801023de:	8b 03                	mov    (%ebx),%eax
+801023e0:	83 c4 10             	add    $0x10,%esp
+801023e3:	83 e0 06             	and    $0x6,%eax
+801023e6:	83 f8 02             	cmp    $0x2,%eax
+801023e9:	75 e5                	jne    801023d0 <iderw+0x80>
+  }
+
+
+  release(&idelock);
+801023eb:	c7 45 08 00 26 11 80 	movl   $0x80112600,0x8(%ebp)
+}
+801023f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801023f5:	c9                   	leave
+  release(&idelock);
+801023f6:	e9 75 30 00 00       	jmp    80105470 <release>
+801023fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801023ff:	90                   	nop
+    idestart(b);
+80102400:	89 d8                	mov    %ebx,%eax
+80102402:	e8 39 fd ff ff       	call   80102140 <idestart>
+80102407:	eb bd                	jmp    801023c6 <iderw+0x76>
+80102409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102410:	ba e4 25 11 80       	mov    $0x801125e4,%edx
+80102415:	eb a5                	jmp    801023bc <iderw+0x6c>
+    panic("iderw: ide disk 1 not present");
+80102417:	83 ec 0c             	sub    $0xc,%esp
+8010241a:	68 35 85 10 80       	push   $0x80108535
+8010241f:	e8 5c df ff ff       	call   80100380 <panic>
+    panic("iderw: nothing to do");
+80102424:	83 ec 0c             	sub    $0xc,%esp
+80102427:	68 20 85 10 80       	push   $0x80108520
+8010242c:	e8 4f df ff ff       	call   80100380 <panic>
+    panic("iderw: buf not locked");
+80102431:	83 ec 0c             	sub    $0xc,%esp
+80102434:	68 0a 85 10 80       	push   $0x8010850a
+80102439:	e8 42 df ff ff       	call   80100380 <panic>
+8010243e:	66 90                	xchg   %ax,%ax
+
+80102440 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80102440:	55                   	push   %ebp
+80102441:	89 e5                	mov    %esp,%ebp
+80102443:	56                   	push   %esi
+80102444:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80102445:	c7 05 34 26 11 80 00 	movl   $0xfec00000,0x80112634
+8010244c:	00 c0 fe 
+  ioapic->reg = reg;
+8010244f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80102456:	00 00 00 
+  return ioapic->data;
+80102459:	8b 15 34 26 11 80    	mov    0x80112634,%edx
+8010245f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+80102462:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+80102468:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+8010246e:	0f b6 15 80 27 11 80 	movzbl 0x80112780,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80102475:	c1 ee 10             	shr    $0x10,%esi
+80102478:	89 f0                	mov    %esi,%eax
+8010247a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010247d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80102480:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80102483:	39 c2                	cmp    %eax,%edx
+80102485:	74 16                	je     8010249d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80102487:	83 ec 0c             	sub    $0xc,%esp
+8010248a:	68 54 85 10 80       	push   $0x80108554
+8010248f:	e8 1c e2 ff ff       	call   801006b0 <cprintf>
+  ioapic->reg = reg;
+80102494:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+8010249a:	83 c4 10             	add    $0x10,%esp
+{
+8010249d:	ba 10 00 00 00       	mov    $0x10,%edx
+801024a2:	31 c0                	xor    %eax,%eax
+801024a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+801024a8:	89 13                	mov    %edx,(%ebx)
+801024aa:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+801024ad:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+801024b3:	83 c0 01             	add    $0x1,%eax
+801024b6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+801024bc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+801024bf:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+801024c2:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+801024c5:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+801024c7:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+801024cd:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+801024d4:	39 c6                	cmp    %eax,%esi
+801024d6:	7d d0                	jge    801024a8 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+801024d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801024db:	5b                   	pop    %ebx
+801024dc:	5e                   	pop    %esi
+801024dd:	5d                   	pop    %ebp
+801024de:	c3                   	ret
+801024df:	90                   	nop
+
+801024e0 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+801024e0:	55                   	push   %ebp
+  ioapic->reg = reg;
+801024e1:	8b 0d 34 26 11 80    	mov    0x80112634,%ecx
+{
+801024e7:	89 e5                	mov    %esp,%ebp
+801024e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+801024ec:	8d 50 20             	lea    0x20(%eax),%edx
+801024ef:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+801024f3:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801024f5:	8b 0d 34 26 11 80    	mov    0x80112634,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801024fb:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+801024fe:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80102501:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80102504:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80102506:	a1 34 26 11 80       	mov    0x80112634,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010250b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010250e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102511:	5d                   	pop    %ebp
+80102512:	c3                   	ret
+80102513:	66 90                	xchg   %ax,%ax
+80102515:	66 90                	xchg   %ax,%ax
+80102517:	66 90                	xchg   %ax,%ax
+80102519:	66 90                	xchg   %ax,%ax
+8010251b:	66 90                	xchg   %ax,%ax
+8010251d:	66 90                	xchg   %ax,%ax
+8010251f:	90                   	nop
+
+80102520 <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+80102520:	55                   	push   %ebp
+80102521:	89 e5                	mov    %esp,%ebp
+80102523:	53                   	push   %ebx
+80102524:	83 ec 04             	sub    $0x4,%esp
+80102527:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+8010252a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80102530:	75 76                	jne    801025a8 <kfree+0x88>
+80102532:	81 fb f0 6d 11 80    	cmp    $0x80116df0,%ebx
+80102538:	72 6e                	jb     801025a8 <kfree+0x88>
+8010253a:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80102540:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80102545:	77 61                	ja     801025a8 <kfree+0x88>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+80102547:	83 ec 04             	sub    $0x4,%esp
+8010254a:	68 00 10 00 00       	push   $0x1000
+8010254f:	6a 01                	push   $0x1
+80102551:	53                   	push   %ebx
+80102552:	e8 59 30 00 00       	call   801055b0 <memset>
+
+  if(kmem.use_lock)
+80102557:	8b 15 74 26 11 80    	mov    0x80112674,%edx
+8010255d:	83 c4 10             	add    $0x10,%esp
+80102560:	85 d2                	test   %edx,%edx
+80102562:	75 1c                	jne    80102580 <kfree+0x60>
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.freelist;
+80102564:	a1 78 26 11 80       	mov    0x80112678,%eax
+80102569:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+  if(kmem.use_lock)
+8010256b:	a1 74 26 11 80       	mov    0x80112674,%eax
+  kmem.freelist = r;
+80102570:	89 1d 78 26 11 80    	mov    %ebx,0x80112678
+  if(kmem.use_lock)
+80102576:	85 c0                	test   %eax,%eax
+80102578:	75 1e                	jne    80102598 <kfree+0x78>
+    release(&kmem.lock);
+}
+8010257a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010257d:	c9                   	leave
+8010257e:	c3                   	ret
+8010257f:	90                   	nop
+    acquire(&kmem.lock);
+80102580:	83 ec 0c             	sub    $0xc,%esp
+80102583:	68 40 26 11 80       	push   $0x80112640
+80102588:	e8 43 2f 00 00       	call   801054d0 <acquire>
+8010258d:	83 c4 10             	add    $0x10,%esp
+80102590:	eb d2                	jmp    80102564 <kfree+0x44>
+80102592:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&kmem.lock);
+80102598:	c7 45 08 40 26 11 80 	movl   $0x80112640,0x8(%ebp)
+}
+8010259f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801025a2:	c9                   	leave
+    release(&kmem.lock);
+801025a3:	e9 c8 2e 00 00       	jmp    80105470 <release>
+    panic("kfree");
+801025a8:	83 ec 0c             	sub    $0xc,%esp
+801025ab:	68 86 85 10 80       	push   $0x80108586
+801025b0:	e8 cb dd ff ff       	call   80100380 <panic>
+801025b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801025c0 <freerange>:
+{
+801025c0:	55                   	push   %ebp
+801025c1:	89 e5                	mov    %esp,%ebp
+801025c3:	56                   	push   %esi
+801025c4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801025c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801025cb:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801025d1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801025d7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801025dd:	39 de                	cmp    %ebx,%esi
+801025df:	72 23                	jb     80102604 <freerange+0x44>
+801025e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+801025e8:	83 ec 0c             	sub    $0xc,%esp
+801025eb:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801025f1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801025f7:	50                   	push   %eax
+801025f8:	e8 23 ff ff ff       	call   80102520 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801025fd:	83 c4 10             	add    $0x10,%esp
+80102600:	39 de                	cmp    %ebx,%esi
+80102602:	73 e4                	jae    801025e8 <freerange+0x28>
+}
+80102604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102607:	5b                   	pop    %ebx
+80102608:	5e                   	pop    %esi
+80102609:	5d                   	pop    %ebp
+8010260a:	c3                   	ret
+8010260b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010260f:	90                   	nop
+
+80102610 <kinit2>:
+{
+80102610:	55                   	push   %ebp
+80102611:	89 e5                	mov    %esp,%ebp
+80102613:	56                   	push   %esi
+80102614:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80102615:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80102618:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010261b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102621:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102627:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010262d:	39 de                	cmp    %ebx,%esi
+8010262f:	72 23                	jb     80102654 <kinit2+0x44>
+80102631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80102638:	83 ec 0c             	sub    $0xc,%esp
+8010263b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102641:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80102647:	50                   	push   %eax
+80102648:	e8 d3 fe ff ff       	call   80102520 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+8010264d:	83 c4 10             	add    $0x10,%esp
+80102650:	39 de                	cmp    %ebx,%esi
+80102652:	73 e4                	jae    80102638 <kinit2+0x28>
+  kmem.use_lock = 1;
+80102654:	c7 05 74 26 11 80 01 	movl   $0x1,0x80112674
+8010265b:	00 00 00 
+}
+8010265e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102661:	5b                   	pop    %ebx
+80102662:	5e                   	pop    %esi
+80102663:	5d                   	pop    %ebp
+80102664:	c3                   	ret
+80102665:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010266c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102670 <kinit1>:
+{
+80102670:	55                   	push   %ebp
+80102671:	89 e5                	mov    %esp,%ebp
+80102673:	56                   	push   %esi
+80102674:	53                   	push   %ebx
+80102675:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80102678:	83 ec 08             	sub    $0x8,%esp
+8010267b:	68 8c 85 10 80       	push   $0x8010858c
+80102680:	68 40 26 11 80       	push   $0x80112640
+80102685:	e8 66 2c 00 00       	call   801052f0 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010268a:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+8010268d:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80102690:	c7 05 74 26 11 80 00 	movl   $0x0,0x80112674
+80102697:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+8010269a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801026a0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801026ac:	39 de                	cmp    %ebx,%esi
+801026ae:	72 1c                	jb     801026cc <kinit1+0x5c>
+    kfree(p);
+801026b0:	83 ec 0c             	sub    $0xc,%esp
+801026b3:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026b9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801026bf:	50                   	push   %eax
+801026c0:	e8 5b fe ff ff       	call   80102520 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026c5:	83 c4 10             	add    $0x10,%esp
+801026c8:	39 de                	cmp    %ebx,%esi
+801026ca:	73 e4                	jae    801026b0 <kinit1+0x40>
+}
+801026cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801026cf:	5b                   	pop    %ebx
+801026d0:	5e                   	pop    %esi
+801026d1:	5d                   	pop    %ebp
+801026d2:	c3                   	ret
+801026d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801026e0 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+801026e0:	55                   	push   %ebp
+801026e1:	89 e5                	mov    %esp,%ebp
+801026e3:	53                   	push   %ebx
+801026e4:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+
+  if(kmem.use_lock)
+801026e7:	a1 74 26 11 80       	mov    0x80112674,%eax
+801026ec:	85 c0                	test   %eax,%eax
+801026ee:	75 20                	jne    80102710 <kalloc+0x30>
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+801026f0:	8b 1d 78 26 11 80    	mov    0x80112678,%ebx
+  if(r)
+801026f6:	85 db                	test   %ebx,%ebx
+801026f8:	74 07                	je     80102701 <kalloc+0x21>
+    kmem.freelist = r->next;
+801026fa:	8b 03                	mov    (%ebx),%eax
+801026fc:	a3 78 26 11 80       	mov    %eax,0x80112678
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+80102701:	89 d8                	mov    %ebx,%eax
+80102703:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102706:	c9                   	leave
+80102707:	c3                   	ret
+80102708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010270f:	90                   	nop
+    acquire(&kmem.lock);
+80102710:	83 ec 0c             	sub    $0xc,%esp
+80102713:	68 40 26 11 80       	push   $0x80112640
+80102718:	e8 b3 2d 00 00       	call   801054d0 <acquire>
+  r = kmem.freelist;
+8010271d:	8b 1d 78 26 11 80    	mov    0x80112678,%ebx
+  if(kmem.use_lock)
+80102723:	a1 74 26 11 80       	mov    0x80112674,%eax
+  if(r)
+80102728:	83 c4 10             	add    $0x10,%esp
+8010272b:	85 db                	test   %ebx,%ebx
+8010272d:	74 08                	je     80102737 <kalloc+0x57>
+    kmem.freelist = r->next;
+8010272f:	8b 13                	mov    (%ebx),%edx
+80102731:	89 15 78 26 11 80    	mov    %edx,0x80112678
+  if(kmem.use_lock)
+80102737:	85 c0                	test   %eax,%eax
+80102739:	74 c6                	je     80102701 <kalloc+0x21>
+    release(&kmem.lock);
+8010273b:	83 ec 0c             	sub    $0xc,%esp
+8010273e:	68 40 26 11 80       	push   $0x80112640
+80102743:	e8 28 2d 00 00       	call   80105470 <release>
+}
+80102748:	89 d8                	mov    %ebx,%eax
+    release(&kmem.lock);
+8010274a:	83 c4 10             	add    $0x10,%esp
+}
+8010274d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102750:	c9                   	leave
+80102751:	c3                   	ret
+80102752:	66 90                	xchg   %ax,%ax
+80102754:	66 90                	xchg   %ax,%ax
+80102756:	66 90                	xchg   %ax,%ax
+80102758:	66 90                	xchg   %ax,%ax
+8010275a:	66 90                	xchg   %ax,%ax
+8010275c:	66 90                	xchg   %ax,%ax
+8010275e:	66 90                	xchg   %ax,%ax
+
+80102760 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102760:	ba 64 00 00 00       	mov    $0x64,%edx
+80102765:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80102766:	a8 01                	test   $0x1,%al
+80102768:	0f 84 c2 00 00 00    	je     80102830 <kbdgetc+0xd0>
+{
+8010276e:	55                   	push   %ebp
+8010276f:	ba 60 00 00 00       	mov    $0x60,%edx
+80102774:	89 e5                	mov    %esp,%ebp
+80102776:	53                   	push   %ebx
+80102777:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80102778:	8b 1d 7c 26 11 80    	mov    0x8011267c,%ebx
+  data = inb(KBDATAP);
+8010277e:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80102781:	3c e0                	cmp    $0xe0,%al
+80102783:	74 5b                	je     801027e0 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102785:	89 da                	mov    %ebx,%edx
+80102787:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+8010278a:	84 c0                	test   %al,%al
+8010278c:	78 6a                	js     801027f8 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+8010278e:	85 d2                	test   %edx,%edx
+80102790:	74 09                	je     8010279b <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80102792:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80102795:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80102798:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+8010279b:	0f b6 91 c0 86 10 80 	movzbl -0x7fef7940(%ecx),%edx
+  shift ^= togglecode[data];
+801027a2:	0f b6 81 c0 85 10 80 	movzbl -0x7fef7a40(%ecx),%eax
+  shift |= shiftcode[data];
+801027a9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+801027ab:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+801027ad:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+801027af:	89 15 7c 26 11 80    	mov    %edx,0x8011267c
+  c = charcode[shift & (CTL | SHIFT)][data];
+801027b5:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+801027b8:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+801027bb:	8b 04 85 a0 85 10 80 	mov    -0x7fef7a60(,%eax,4),%eax
+801027c2:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+801027c6:	74 0b                	je     801027d3 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+801027c8:	8d 50 9f             	lea    -0x61(%eax),%edx
+801027cb:	83 fa 19             	cmp    $0x19,%edx
+801027ce:	77 48                	ja     80102818 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+801027d0:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+801027d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801027d6:	c9                   	leave
+801027d7:	c3                   	ret
+801027d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801027df:	90                   	nop
+    shift |= E0ESC;
+801027e0:	89 d8                	mov    %ebx,%eax
+801027e2:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+801027e5:	a3 7c 26 11 80       	mov    %eax,0x8011267c
+    return 0;
+801027ea:	31 c0                	xor    %eax,%eax
+}
+801027ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801027ef:	c9                   	leave
+801027f0:	c3                   	ret
+801027f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+801027f8:	83 e0 7f             	and    $0x7f,%eax
+801027fb:	85 d2                	test   %edx,%edx
+801027fd:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80102800:	0f b6 81 c0 86 10 80 	movzbl -0x7fef7940(%ecx),%eax
+80102807:	83 c8 40             	or     $0x40,%eax
+8010280a:	0f b6 c0             	movzbl %al,%eax
+8010280d:	f7 d0                	not    %eax
+8010280f:	21 d8                	and    %ebx,%eax
+    return 0;
+80102811:	eb d2                	jmp    801027e5 <kbdgetc+0x85>
+80102813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102817:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80102818:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+8010281b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+8010281e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102821:	c9                   	leave
+      c += 'a' - 'A';
+80102822:	83 f9 1a             	cmp    $0x1a,%ecx
+80102825:	0f 42 c2             	cmovb  %edx,%eax
+}
+80102828:	c3                   	ret
+80102829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80102830:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80102835:	c3                   	ret
+80102836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010283d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102840 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80102840:	55                   	push   %ebp
+80102841:	89 e5                	mov    %esp,%ebp
+80102843:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80102846:	68 60 27 10 80       	push   $0x80102760
+8010284b:	e8 70 e0 ff ff       	call   801008c0 <consoleintr>
+}
+80102850:	83 c4 10             	add    $0x10,%esp
+80102853:	c9                   	leave
+80102854:	c3                   	ret
+80102855:	66 90                	xchg   %ax,%ax
+80102857:	66 90                	xchg   %ax,%ax
+80102859:	66 90                	xchg   %ax,%ax
+8010285b:	66 90                	xchg   %ax,%ax
+8010285d:	66 90                	xchg   %ax,%ax
+8010285f:	90                   	nop
+
+80102860 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80102860:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102865:	85 c0                	test   %eax,%eax
+80102867:	0f 84 cb 00 00 00    	je     80102938 <lapicinit+0xd8>
+  lapic[index] = value;
+8010286d:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80102874:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102877:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010287a:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80102881:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102884:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102887:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+8010288e:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102891:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102894:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+8010289b:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010289e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028a1:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+801028a8:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028ab:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028ae:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+801028b5:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028b8:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+801028bb:	8b 50 30             	mov    0x30(%eax),%edx
+801028be:	c1 ea 10             	shr    $0x10,%edx
+801028c1:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+801028c7:	75 77                	jne    80102940 <lapicinit+0xe0>
+  lapic[index] = value;
+801028c9:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+801028d0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028d3:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028d6:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+801028dd:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028e0:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028e3:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+801028ea:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028ed:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028f0:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+801028f7:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801028fa:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801028fd:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80102904:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102907:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010290a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80102911:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102914:	8b 50 20             	mov    0x20(%eax),%edx
+80102917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010291e:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80102920:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80102926:	80 e6 10             	and    $0x10,%dh
+80102929:	75 f5                	jne    80102920 <lapicinit+0xc0>
+  lapic[index] = value;
+8010292b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80102932:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102935:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80102938:	c3                   	ret
+80102939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80102940:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+80102947:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010294a:	8b 50 20             	mov    0x20(%eax),%edx
+}
+8010294d:	e9 77 ff ff ff       	jmp    801028c9 <lapicinit+0x69>
+80102952:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102960 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80102960:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102965:	85 c0                	test   %eax,%eax
+80102967:	74 07                	je     80102970 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80102969:	8b 40 20             	mov    0x20(%eax),%eax
+8010296c:	c1 e8 18             	shr    $0x18,%eax
+8010296f:	c3                   	ret
+    return 0;
+80102970:	31 c0                	xor    %eax,%eax
+}
+80102972:	c3                   	ret
+80102973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010297a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102980 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80102980:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102985:	85 c0                	test   %eax,%eax
+80102987:	74 0d                	je     80102996 <lapiceoi+0x16>
+  lapic[index] = value;
+80102989:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80102990:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102993:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80102996:	c3                   	ret
+80102997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010299e:	66 90                	xchg   %ax,%ax
+
+801029a0 <lapictimer>:
+// Switch this CPU's timer to one-shot and have it interrupt
+// once, after n ticks. n == 0 stops it.
+void
+lapictimer(int n)
+{
+  if(!lapic)
+801029a0:	a1 80 26 11 80       	mov    0x80112680,%eax
+801029a5:	85 c0                	test   %eax,%eax
+801029a7:	74 27                	je     801029d0 <lapictimer+0x30>
+{
+801029a9:	55                   	push   %ebp
+  lapic[index] = value;
+801029aa:	c7 80 20 03 00 00 20 	movl   $0x20,0x320(%eax)
+801029b1:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801029b4:	8b 50 20             	mov    0x20(%eax),%edx
+{
+801029b7:	89 e5                	mov    %esp,%ebp
+    return;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * TICKLEN);
+801029b9:	69 55 08 80 96 98 00 	imul   $0x989680,0x8(%ebp),%edx
+  lapic[index] = value;
+801029c0:	89 90 80 03 00 00    	mov    %edx,0x380(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801029c6:	8b 40 20             	mov    0x20(%eax),%eax
+}
+801029c9:	5d                   	pop    %ebp
+801029ca:	c3                   	ret
+801029cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801029cf:	90                   	nop
+801029d0:	c3                   	ret
+801029d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029df:	90                   	nop
+
+801029e0 <lapicipi>:
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+801029e0:	8b 15 80 26 11 80    	mov    0x80112680,%edx
+801029e6:	85 d2                	test   %edx,%edx
+801029e8:	74 36                	je     80102a20 <lapicipi+0x40>
+{
+801029ea:	55                   	push   %ebp
+801029eb:	89 e5                	mov    %esp,%ebp
+    return;
+  lapicw(ICRHI, apicid<<24);
+801029ed:	8b 45 08             	mov    0x8(%ebp),%eax
+801029f0:	c1 e0 18             	shl    $0x18,%eax
+  lapic[index] = value;
+801029f3:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+801029f9:	8b 42 20             	mov    0x20(%edx),%eax
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+801029fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801029ff:	80 cc 40             	or     $0x40,%ah
+  lapic[index] = value;
+80102a02:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80102a08:	8b 42 20             	mov    0x20(%edx),%eax
+80102a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102a0f:	90                   	nop
+  while(lapic[ICRLO] & DELIVS)
+80102a10:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80102a16:	f6 c4 10             	test   $0x10,%ah
+80102a19:	75 f5                	jne    80102a10 <lapicipi+0x30>
+    ;
+}
+80102a1b:	5d                   	pop    %ebp
+80102a1c:	c3                   	ret
+80102a1d:	8d 76 00             	lea    0x0(%esi),%esi
+80102a20:	c3                   	ret
+80102a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a2f:	90                   	nop
+
+80102a30 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80102a30:	c3                   	ret
+80102a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a3f:	90                   	nop
+
+80102a40 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80102a40:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102a41:	b8 0f 00 00 00       	mov    $0xf,%eax
+80102a46:	ba 70 00 00 00       	mov    $0x70,%edx
+80102a4b:	89 e5                	mov    %esp,%ebp
+80102a4d:	53                   	push   %ebx
+80102a4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102a51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102a54:	ee                   	out    %al,(%dx)
+80102a55:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102a5a:	ba 71 00 00 00       	mov    $0x71,%edx
+80102a5f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80102a60:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80102a62:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80102a65:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+80102a6b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102a6d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80102a70:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80102a72:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102a75:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80102a78:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+80102a7e:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102a83:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102a89:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102a8c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80102a93:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102a96:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102a99:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80102aa0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102aa3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102aa6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102aac:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102aaf:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ab5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102ab8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102abe:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102ac1:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ac7:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+80102aca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102acd:	c9                   	leave
+80102ace:	c3                   	ret
+80102acf:	90                   	nop
+
+80102ad0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80102ad0:	55                   	push   %ebp
+80102ad1:	b8 0b 00 00 00       	mov    $0xb,%eax
+80102ad6:	ba 70 00 00 00       	mov    $0x70,%edx
+80102adb:	89 e5                	mov    %esp,%ebp
+80102add:	57                   	push   %edi
+80102ade:	56                   	push   %esi
+80102adf:	53                   	push   %ebx
+80102ae0:	83 ec 4c             	sub    $0x4c,%esp
+80102ae3:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ae4:	ba 71 00 00 00       	mov    $0x71,%edx
+80102ae9:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80102aea:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102aed:	bf 70 00 00 00       	mov    $0x70,%edi
+80102af2:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80102af5:	8d 76 00             	lea    0x0(%esi),%esi
+80102af8:	31 c0                	xor    %eax,%eax
+80102afa:	89 fa                	mov    %edi,%edx
+80102afc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102afd:	b9 71 00 00 00       	mov    $0x71,%ecx
+80102b02:	89 ca                	mov    %ecx,%edx
+80102b04:	ec                   	in     (%dx),%al
+80102b05:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b08:	89 fa                	mov    %edi,%edx
+80102b0a:	b8 02 00 00 00       	mov    $0x2,%eax
+80102b0f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b10:	89 ca                	mov    %ecx,%edx
+80102b12:	ec                   	in     (%dx),%al
+80102b13:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b16:	89 fa                	mov    %edi,%edx
+80102b18:	b8 04 00 00 00       	mov    $0x4,%eax
+80102b1d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b1e:	89 ca                	mov    %ecx,%edx
+80102b20:	ec                   	in     (%dx),%al
+80102b21:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b24:	89 fa                	mov    %edi,%edx
+80102b26:	b8 07 00 00 00       	mov    $0x7,%eax
+80102b2b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b2c:	89 ca                	mov    %ecx,%edx
+80102b2e:	ec                   	in     (%dx),%al
+80102b2f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b32:	89 fa                	mov    %edi,%edx
+80102b34:	b8 08 00 00 00       	mov    $0x8,%eax
+80102b39:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b3a:	89 ca                	mov    %ecx,%edx
+80102b3c:	ec                   	in     (%dx),%al
+80102b3d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b3f:	89 fa                	mov    %edi,%edx
+80102b41:	b8 09 00 00 00       	mov    $0x9,%eax
+80102b46:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b47:	89 ca                	mov    %ecx,%edx
+80102b49:	ec                   	in     (%dx),%al
+80102b4a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b4d:	89 fa                	mov    %edi,%edx
+80102b4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102b54:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b55:	89 ca                	mov    %ecx,%edx
+80102b57:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80102b58:	84 c0                	test   %al,%al
+80102b5a:	78 9c                	js     80102af8 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+80102b5c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80102b60:	89 f2                	mov    %esi,%edx
+80102b62:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80102b65:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b68:	89 fa                	mov    %edi,%edx
+80102b6a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+80102b6d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80102b71:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80102b74:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80102b77:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+80102b7b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80102b7e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80102b82:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80102b85:	31 c0                	xor    %eax,%eax
+80102b87:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b88:	89 ca                	mov    %ecx,%edx
+80102b8a:	ec                   	in     (%dx),%al
+80102b8b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b8e:	89 fa                	mov    %edi,%edx
+80102b90:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80102b93:	b8 02 00 00 00       	mov    $0x2,%eax
+80102b98:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b99:	89 ca                	mov    %ecx,%edx
+80102b9b:	ec                   	in     (%dx),%al
+80102b9c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b9f:	89 fa                	mov    %edi,%edx
+80102ba1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80102ba4:	b8 04 00 00 00       	mov    $0x4,%eax
+80102ba9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102baa:	89 ca                	mov    %ecx,%edx
+80102bac:	ec                   	in     (%dx),%al
+80102bad:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bb0:	89 fa                	mov    %edi,%edx
+80102bb2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102bb5:	b8 07 00 00 00       	mov    $0x7,%eax
+80102bba:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bbb:	89 ca                	mov    %ecx,%edx
+80102bbd:	ec                   	in     (%dx),%al
+80102bbe:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bc1:	89 fa                	mov    %edi,%edx
+80102bc3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102bc6:	b8 08 00 00 00       	mov    $0x8,%eax
+80102bcb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bcc:	89 ca                	mov    %ecx,%edx
+80102bce:	ec                   	in     (%dx),%al
+80102bcf:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bd2:	89 fa                	mov    %edi,%edx
+80102bd4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102bd7:	b8 09 00 00 00       	mov    $0x9,%eax
+80102bdc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bdd:	89 ca                	mov    %ecx,%edx
+80102bdf:	ec                   	in     (%dx),%al
+80102be0:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80102be3:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80102be6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80102be9:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80102bec:	6a 18                	push   $0x18
+80102bee:	50                   	push   %eax
+80102bef:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80102bf2:	50                   	push   %eax
+80102bf3:	e8 f8 29 00 00       	call   801055f0 <memcmp>
+80102bf8:	83 c4 10             	add    $0x10,%esp
+80102bfb:	85 c0                	test   %eax,%eax
+80102bfd:	0f 85 f5 fe ff ff    	jne    80102af8 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80102c03:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80102c07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102c0a:	89 f0                	mov    %esi,%eax
+80102c0c:	84 c0                	test   %al,%al
+80102c0e:	75 78                	jne    80102c88 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80102c10:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102c13:	89 c2                	mov    %eax,%edx
+80102c15:	83 e0 0f             	and    $0xf,%eax
+80102c18:	c1 ea 04             	shr    $0x4,%edx
+80102c1b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c1e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c21:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80102c24:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102c27:	89 c2                	mov    %eax,%edx
+80102c29:	83 e0 0f             	and    $0xf,%eax
+80102c2c:	c1 ea 04             	shr    $0x4,%edx
+80102c2f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c32:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c35:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80102c38:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102c3b:	89 c2                	mov    %eax,%edx
+80102c3d:	83 e0 0f             	and    $0xf,%eax
+80102c40:	c1 ea 04             	shr    $0x4,%edx
+80102c43:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c46:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c49:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+80102c4c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80102c4f:	89 c2                	mov    %eax,%edx
+80102c51:	83 e0 0f             	and    $0xf,%eax
+80102c54:	c1 ea 04             	shr    $0x4,%edx
+80102c57:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c5a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c5d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80102c60:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80102c63:	89 c2                	mov    %eax,%edx
+80102c65:	83 e0 0f             	and    $0xf,%eax
+80102c68:	c1 ea 04             	shr    $0x4,%edx
+80102c6b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c6e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c71:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80102c74:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102c77:	89 c2                	mov    %eax,%edx
+80102c79:	83 e0 0f             	and    $0xf,%eax
+80102c7c:	c1 ea 04             	shr    $0x4,%edx
+80102c7f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c82:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c85:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80102c88:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102c8b:	89 03                	mov    %eax,(%ebx)
+80102c8d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102c90:	89 43 04             	mov    %eax,0x4(%ebx)
+80102c93:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102c96:	89 43 08             	mov    %eax,0x8(%ebx)
+80102c99:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80102c9c:	89 43 0c             	mov    %eax,0xc(%ebx)
+80102c9f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80102ca2:	89 43 10             	mov    %eax,0x10(%ebx)
+80102ca5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102ca8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+80102cab:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80102cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cb5:	5b                   	pop    %ebx
+80102cb6:	5e                   	pop    %esi
+80102cb7:	5f                   	pop    %edi
+80102cb8:	5d                   	pop    %ebp
+80102cb9:	c3                   	ret
+80102cba:	66 90                	xchg   %ax,%ax
+80102cbc:	66 90                	xchg   %ax,%ax
+80102cbe:	66 90                	xchg   %ax,%ax
+
+80102cc0 <install_trans>:
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102cc0:	8b 0d e8 26 11 80    	mov    0x801126e8,%ecx
+80102cc6:	85 c9                	test   %ecx,%ecx
+80102cc8:	0f 8e 8a 00 00 00    	jle    80102d58 <install_trans+0x98>
+{
+80102cce:	55                   	push   %ebp
+80102ccf:	89 e5                	mov    %esp,%ebp
+80102cd1:	57                   	push   %edi
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102cd2:	31 ff                	xor    %edi,%edi
+{
+80102cd4:	56                   	push   %esi
+80102cd5:	53                   	push   %ebx
+80102cd6:	83 ec 0c             	sub    $0xc,%esp
+80102cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80102ce0:	a1 d4 26 11 80       	mov    0x801126d4,%eax
+80102ce5:	83 ec 08             	sub    $0x8,%esp
+80102ce8:	01 f8                	add    %edi,%eax
+80102cea:	83 c0 01             	add    $0x1,%eax
+80102ced:	50                   	push   %eax
+80102cee:	ff 35 e4 26 11 80    	push   0x801126e4
+80102cf4:	e8 d7 d3 ff ff       	call   801000d0 <bread>
+80102cf9:	89 c6                	mov    %eax,%esi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102cfb:	58                   	pop    %eax
+80102cfc:	5a                   	pop    %edx
+80102cfd:	ff 34 bd ec 26 11 80 	push   -0x7feed914(,%edi,4)
+80102d04:	ff 35 e4 26 11 80    	push   0x801126e4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102d0a:	83 c7 01             	add    $0x1,%edi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102d0d:	e8 be d3 ff ff       	call   801000d0 <bread>
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102d12:	83 c4 0c             	add    $0xc,%esp
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102d15:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102d17:	8d 46 5c             	lea    0x5c(%esi),%eax
+80102d1a:	68 00 02 00 00       	push   $0x200
+80102d1f:	50                   	push   %eax
+80102d20:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80102d23:	50                   	push   %eax
+80102d24:	e8 17 29 00 00       	call   80105640 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80102d29:	89 1c 24             	mov    %ebx,(%esp)
+80102d2c:	e8 7f d4 ff ff       	call   801001b0 <bwrite>
+    brelse(lbuf);
+80102d31:	89 34 24             	mov    %esi,(%esp)
+80102d34:	e8 b7 d4 ff ff       	call   801001f0 <brelse>
+    brelse(dbuf);
+80102d39:	89 1c 24             	mov    %ebx,(%esp)
+80102d3c:	e8 af d4 ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102d41:	83 c4 10             	add    $0x10,%esp
+80102d44:	39 3d e8 26 11 80    	cmp    %edi,0x801126e8
+80102d4a:	7f 94                	jg     80102ce0 <install_trans+0x20>
+  }
+}
+80102d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d4f:	5b                   	pop    %ebx
+80102d50:	5e                   	pop    %esi
+80102d51:	5f                   	pop    %edi
+80102d52:	5d                   	pop    %ebp
+80102d53:	c3                   	ret
+80102d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d58:	c3                   	ret
+80102d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102d60 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80102d60:	55                   	push   %ebp
+80102d61:	89 e5                	mov    %esp,%ebp
+80102d63:	53                   	push   %ebx
+80102d64:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80102d67:	ff 35 d4 26 11 80    	push   0x801126d4
+80102d6d:	ff 35 e4 26 11 80    	push   0x801126e4
+80102d73:	e8 58 d3 ff ff       	call   801000d0 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+80102d78:	83 c4 10             	add    $0x10,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80102d7b:	89 c3                	mov    %eax,%ebx
+  hb->n = log.lh.n;
+80102d7d:	a1 e8 26 11 80       	mov    0x801126e8,%eax
+80102d82:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+80102d85:	85 c0                	test   %eax,%eax
+80102d87:	7e 19                	jle    80102da2 <write_head+0x42>
+80102d89:	31 d2                	xor    %edx,%edx
+80102d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d8f:	90                   	nop
+    hb->block[i] = log.lh.block[i];
+80102d90:	8b 0c 95 ec 26 11 80 	mov    -0x7feed914(,%edx,4),%ecx
+80102d97:	89 4c 93 60          	mov    %ecx,0x60(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102d9b:	83 c2 01             	add    $0x1,%edx
+80102d9e:	39 d0                	cmp    %edx,%eax
+80102da0:	75 ee                	jne    80102d90 <write_head+0x30>
+  }
+  bwrite(buf);
+80102da2:	83 ec 0c             	sub    $0xc,%esp
+80102da5:	53                   	push   %ebx
+80102da6:	e8 05 d4 ff ff       	call   801001b0 <bwrite>
+  brelse(buf);
+80102dab:	89 1c 24             	mov    %ebx,(%esp)
+80102dae:	e8 3d d4 ff ff       	call   801001f0 <brelse>
+}
+80102db3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102db6:	83 c4 10             	add    $0x10,%esp
+80102db9:	c9                   	leave
+80102dba:	c3                   	ret
+80102dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102dbf:	90                   	nop
+
+80102dc0 <initlog>:
+{
+80102dc0:	55                   	push   %ebp
+80102dc1:	89 e5                	mov    %esp,%ebp
+80102dc3:	53                   	push   %ebx
+80102dc4:	83 ec 2c             	sub    $0x2c,%esp
+80102dc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80102dca:	68 c0 87 10 80       	push   $0x801087c0
+80102dcf:	68 a0 26 11 80       	push   $0x801126a0
+80102dd4:	e8 17 25 00 00       	call   801052f0 <initlock>
+  readsb(dev, &sb);
+80102dd9:	58                   	pop    %eax
+80102dda:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80102ddd:	5a                   	pop    %edx
+80102dde:	50                   	push   %eax
+80102ddf:	53                   	push   %ebx
+80102de0:	e8 8b e7 ff ff       	call   80101570 <readsb>
+  log.size = sb.nlog;
+80102de5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80102de8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+80102deb:	89 1d e4 26 11 80    	mov    %ebx,0x801126e4
+  log.start = sb.logstart;
+80102df1:	a3 d4 26 11 80       	mov    %eax,0x801126d4
+  log.size = sb.nlog;
+80102df6:	89 15 d8 26 11 80    	mov    %edx,0x801126d8
+  struct buf *buf = bread(log.dev, log.start);
+80102dfc:	59                   	pop    %ecx
+80102dfd:	5a                   	pop    %edx
+80102dfe:	50                   	push   %eax
+80102dff:	53                   	push   %ebx
+80102e00:	e8 cb d2 ff ff       	call   801000d0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80102e05:	83 c4 10             	add    $0x10,%esp
+  log.lh.n = lh->n;
+80102e08:	8b 58 5c             	mov    0x5c(%eax),%ebx
+80102e0b:	89 1d e8 26 11 80    	mov    %ebx,0x801126e8
+  for (i = 0; i < log.lh.n; i++) {
+80102e11:	85 db                	test   %ebx,%ebx
+80102e13:	7e 1d                	jle    80102e32 <initlog+0x72>
+80102e15:	31 d2                	xor    %edx,%edx
+80102e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e1e:	66 90                	xchg   %ax,%ax
+    log.lh.block[i] = lh->block[i];
+80102e20:	8b 4c 90 60          	mov    0x60(%eax,%edx,4),%ecx
+80102e24:	89 0c 95 ec 26 11 80 	mov    %ecx,-0x7feed914(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102e2b:	83 c2 01             	add    $0x1,%edx
+80102e2e:	39 d3                	cmp    %edx,%ebx
+80102e30:	75 ee                	jne    80102e20 <initlog+0x60>
+  brelse(buf);
+80102e32:	83 ec 0c             	sub    $0xc,%esp
+80102e35:	50                   	push   %eax
+80102e36:	e8 b5 d3 ff ff       	call   801001f0 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+80102e3b:	e8 80 fe ff ff       	call   80102cc0 <install_trans>
+  log.lh.n = 0;
+80102e40:	c7 05 e8 26 11 80 00 	movl   $0x0,0x801126e8
+80102e47:	00 00 00 
+  write_head(); // clear the log
+80102e4a:	e8 11 ff ff ff       	call   80102d60 <write_head>
+}
+80102e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102e52:	83 c4 10             	add    $0x10,%esp
+80102e55:	c9                   	leave
+80102e56:	c3                   	ret
+80102e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e5e:	66 90                	xchg   %ax,%ax
+
+80102e60 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+80102e60:	55                   	push   %ebp
+80102e61:	89 e5                	mov    %esp,%ebp
+80102e63:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80102e66:	68 a0 26 11 80       	push   $0x801126a0
+80102e6b:	e8 60 26 00 00       	call   801054d0 <acquire>
+80102e70:	83 c4 10             	add    $0x10,%esp
+80102e73:	eb 18                	jmp    80102e8d <begin_op+0x2d>
+80102e75:	8d 76 00             	lea    0x0(%esi),%esi
+  while(1){
+    if(log.committing){
+      sleep(&log, &log.lock);
+80102e78:	83 ec 08             	sub    $0x8,%esp
+80102e7b:	68 a0 26 11 80       	push   $0x801126a0
+80102e80:	68 a0 26 11 80       	push   $0x801126a0
+80102e85:	e8 a6 1c 00 00       	call   80104b30 <sleep>
+80102e8a:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80102e8d:	a1 e0 26 11 80       	mov    0x801126e0,%eax
+80102e92:	85 c0                	test   %eax,%eax
+80102e94:	75 e2                	jne    80102e78 <begin_op+0x18>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80102e96:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+80102e9b:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+80102ea1:	83 c0 01             	add    $0x1,%eax
+80102ea4:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80102ea7:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80102eaa:	83 fa 1e             	cmp    $0x1e,%edx
+80102ead:	7f c9                	jg     80102e78 <begin_op+0x18>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+80102eaf:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80102eb2:	a3 dc 26 11 80       	mov    %eax,0x801126dc
+      release(&log.lock);
+80102eb7:	68 a0 26 11 80       	push   $0x801126a0
+80102ebc:	e8 af 25 00 00       	call   80105470 <release>
+      break;
+    }
+  }
+}
+80102ec1:	83 c4 10             	add    $0x10,%esp
+80102ec4:	c9                   	leave
+80102ec5:	c3                   	ret
+80102ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102ed0 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+80102ed0:	55                   	push   %ebp
+80102ed1:	89 e5                	mov    %esp,%ebp
+80102ed3:	57                   	push   %edi
+80102ed4:	56                   	push   %esi
+80102ed5:	53                   	push   %ebx
+80102ed6:	83 ec 18             	sub    $0x18,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+80102ed9:	68 a0 26 11 80       	push   $0x801126a0
+80102ede:	e8 ed 25 00 00       	call   801054d0 <acquire>
+  log.outstanding -= 1;
+80102ee3:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+  if(log.committing)
+80102ee8:	8b 35 e0 26 11 80    	mov    0x801126e0,%esi
+80102eee:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+80102ef1:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80102ef4:	89 1d dc 26 11 80    	mov    %ebx,0x801126dc
+  if(log.committing)
+80102efa:	85 f6                	test   %esi,%esi
+80102efc:	0f 85 22 01 00 00    	jne    80103024 <end_op+0x154>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80102f02:	85 db                	test   %ebx,%ebx
+80102f04:	0f 85 f6 00 00 00    	jne    80103000 <end_op+0x130>
+    do_commit = 1;
+    log.committing = 1;
+80102f0a:	c7 05 e0 26 11 80 01 	movl   $0x1,0x801126e0
+80102f11:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80102f14:	83 ec 0c             	sub    $0xc,%esp
+80102f17:	68 a0 26 11 80       	push   $0x801126a0
+80102f1c:	e8 4f 25 00 00       	call   80105470 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80102f21:	8b 0d e8 26 11 80    	mov    0x801126e8,%ecx
+80102f27:	83 c4 10             	add    $0x10,%esp
+80102f2a:	85 c9                	test   %ecx,%ecx
+80102f2c:	7f 42                	jg     80102f70 <end_op+0xa0>
+    acquire(&log.lock);
+80102f2e:	83 ec 0c             	sub    $0xc,%esp
+80102f31:	68 a0 26 11 80       	push   $0x801126a0
+80102f36:	e8 95 25 00 00       	call   801054d0 <acquire>
+    log.committing = 0;
+80102f3b:	c7 05 e0 26 11 80 00 	movl   $0x0,0x801126e0
+80102f42:	00 00 00 
+    wakeup(&log);
+80102f45:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80102f4c:	e8 af 1c 00 00       	call   80104c00 <wakeup>
+    release(&log.lock);
+80102f51:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80102f58:	e8 13 25 00 00       	call   80105470 <release>
+80102f5d:	83 c4 10             	add    $0x10,%esp
+}
+80102f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f63:	5b                   	pop    %ebx
+80102f64:	5e                   	pop    %esi
+80102f65:	5f                   	pop    %edi
+80102f66:	5d                   	pop    %ebp
+80102f67:	c3                   	ret
+80102f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f6f:	90                   	nop
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80102f70:	a1 d4 26 11 80       	mov    0x801126d4,%eax
+80102f75:	83 ec 08             	sub    $0x8,%esp
+80102f78:	01 d8                	add    %ebx,%eax
+80102f7a:	83 c0 01             	add    $0x1,%eax
+80102f7d:	50                   	push   %eax
+80102f7e:	ff 35 e4 26 11 80    	push   0x801126e4
+80102f84:	e8 47 d1 ff ff       	call   801000d0 <bread>
+80102f89:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102f8b:	58                   	pop    %eax
+80102f8c:	5a                   	pop    %edx
+80102f8d:	ff 34 9d ec 26 11 80 	push   -0x7feed914(,%ebx,4)
+80102f94:	ff 35 e4 26 11 80    	push   0x801126e4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102f9a:	83 c3 01             	add    $0x1,%ebx
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102f9d:	e8 2e d1 ff ff       	call   801000d0 <bread>
+    memmove(to->data, from->data, BSIZE);
+80102fa2:	83 c4 0c             	add    $0xc,%esp
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102fa5:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+80102fa7:	8d 40 5c             	lea    0x5c(%eax),%eax
+80102faa:	68 00 02 00 00       	push   $0x200
+80102faf:	50                   	push   %eax
+80102fb0:	8d 46 5c             	lea    0x5c(%esi),%eax
+80102fb3:	50                   	push   %eax
+80102fb4:	e8 87 26 00 00       	call   80105640 <memmove>
+    bwrite(to);  // write the log
+80102fb9:	89 34 24             	mov    %esi,(%esp)
+80102fbc:	e8 ef d1 ff ff       	call   801001b0 <bwrite>
+    brelse(from);
+80102fc1:	89 3c 24             	mov    %edi,(%esp)
+80102fc4:	e8 27 d2 ff ff       	call   801001f0 <brelse>
+    brelse(to);
+80102fc9:	89 34 24             	mov    %esi,(%esp)
+80102fcc:	e8 1f d2 ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102fd1:	83 c4 10             	add    $0x10,%esp
+80102fd4:	3b 1d e8 26 11 80    	cmp    0x801126e8,%ebx
+80102fda:	7c 94                	jl     80102f70 <end_op+0xa0>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+80102fdc:	e8 7f fd ff ff       	call   80102d60 <write_head>
+    install_trans(); // Now install writes to home locations
+80102fe1:	e8 da fc ff ff       	call   80102cc0 <install_trans>
+    log.lh.n = 0;
+80102fe6:	c7 05 e8 26 11 80 00 	movl   $0x0,0x801126e8
+80102fed:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80102ff0:	e8 6b fd ff ff       	call   80102d60 <write_head>
+80102ff5:	e9 34 ff ff ff       	jmp    80102f2e <end_op+0x5e>
+80102ffa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&log);
+80103000:	83 ec 0c             	sub    $0xc,%esp
+80103003:	68 a0 26 11 80       	push   $0x801126a0
+80103008:	e8 f3 1b 00 00       	call   80104c00 <wakeup>
+  release(&log.lock);
+8010300d:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80103014:	e8 57 24 00 00       	call   80105470 <release>
+80103019:	83 c4 10             	add    $0x10,%esp
+}
+8010301c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010301f:	5b                   	pop    %ebx
+80103020:	5e                   	pop    %esi
+80103021:	5f                   	pop    %edi
+80103022:	5d                   	pop    %ebp
+80103023:	c3                   	ret
+    panic("log.committing");
+80103024:	83 ec 0c             	sub    $0xc,%esp
+80103027:	68 c4 87 10 80       	push   $0x801087c4
+8010302c:	e8 4f d3 ff ff       	call   80100380 <panic>
+80103031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010303f:	90                   	nop
+
+80103040 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80103040:	55                   	push   %ebp
+80103041:	89 e5                	mov    %esp,%ebp
+80103043:	53                   	push   %ebx
+80103044:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103047:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+{
+8010304d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103050:	83 fa 1d             	cmp    $0x1d,%edx
+80103053:	7f 7d                	jg     801030d2 <log_write+0x92>
+80103055:	a1 d8 26 11 80       	mov    0x801126d8,%eax
+8010305a:	83 e8 01             	sub    $0x1,%eax
+8010305d:	39 c2                	cmp    %eax,%edx
+8010305f:	7d 71                	jge    801030d2 <log_write+0x92>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80103061:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+80103066:	85 c0                	test   %eax,%eax
+80103068:	7e 75                	jle    801030df <log_write+0x9f>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010306a:	83 ec 0c             	sub    $0xc,%esp
+8010306d:	68 a0 26 11 80       	push   $0x801126a0
+80103072:	e8 59 24 00 00       	call   801054d0 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103077:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+8010307a:	83 c4 10             	add    $0x10,%esp
+8010307d:	31 c0                	xor    %eax,%eax
+8010307f:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+80103085:	85 d2                	test   %edx,%edx
+80103087:	7f 0e                	jg     80103097 <log_write+0x57>
+80103089:	eb 15                	jmp    801030a0 <log_write+0x60>
+8010308b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010308f:	90                   	nop
+80103090:	83 c0 01             	add    $0x1,%eax
+80103093:	39 c2                	cmp    %eax,%edx
+80103095:	74 29                	je     801030c0 <log_write+0x80>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103097:	39 0c 85 ec 26 11 80 	cmp    %ecx,-0x7feed914(,%eax,4)
+8010309e:	75 f0                	jne    80103090 <log_write+0x50>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+801030a0:	89 0c 85 ec 26 11 80 	mov    %ecx,-0x7feed914(,%eax,4)
+  if (i == log.lh.n)
+801030a7:	39 c2                	cmp    %eax,%edx
+801030a9:	74 1c                	je     801030c7 <log_write+0x87>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801030ab:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+801030ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+801030b1:	c7 45 08 a0 26 11 80 	movl   $0x801126a0,0x8(%ebp)
+}
+801030b8:	c9                   	leave
+  release(&log.lock);
+801030b9:	e9 b2 23 00 00       	jmp    80105470 <release>
+801030be:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+801030c0:	89 0c 95 ec 26 11 80 	mov    %ecx,-0x7feed914(,%edx,4)
+    log.lh.n++;
+801030c7:	83 c2 01             	add    $0x1,%edx
+801030ca:	89 15 e8 26 11 80    	mov    %edx,0x801126e8
+801030d0:	eb d9                	jmp    801030ab <log_write+0x6b>
+    panic("too big a transaction");
+801030d2:	83 ec 0c             	sub    $0xc,%esp
+801030d5:	68 d3 87 10 80       	push   $0x801087d3
+801030da:	e8 a1 d2 ff ff       	call   80100380 <panic>
+    panic("log_write outside of trans");
+801030df:	83 ec 0c             	sub    $0xc,%esp
+801030e2:	68 e9 87 10 80       	push   $0x801087e9
+801030e7:	e8 94 d2 ff ff       	call   80100380 <panic>
+801030ec:	66 90                	xchg   %ax,%ax
+801030ee:	66 90                	xchg   %ax,%ax
+
+801030f0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801030f0:	55                   	push   %ebp
+801030f1:	89 e5                	mov    %esp,%ebp
+801030f3:	53                   	push   %ebx
+801030f4:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801030f7:	e8 24 0a 00 00       	call   80103b20 <cpuid>
+801030fc:	89 c3                	mov    %eax,%ebx
+801030fe:	e8 1d 0a 00 00       	call   80103b20 <cpuid>
+80103103:	83 ec 04             	sub    $0x4,%esp
+80103106:	53                   	push   %ebx
+80103107:	50                   	push   %eax
+80103108:	68 04 88 10 80       	push   $0x80108804
+8010310d:	e8 9e d5 ff ff       	call   801006b0 <cprintf>
+  idtinit();       // load idt register
+80103112:	e8 39 38 00 00       	call   80106950 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80103117:	e8 a4 09 00 00       	call   80103ac0 <mycpu>
+8010311c:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+8010311e:	b8 01 00 00 00       	mov    $0x1,%eax
+80103123:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+8010312a:	e8 71 12 00 00       	call   801043a0 <scheduler>
+8010312f:	90                   	nop
+
+80103130 <mpenter>:
+{
+80103130:	55                   	push   %ebp
+80103131:	89 e5                	mov    %esp,%ebp
+80103133:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80103136:	e8 c5 49 00 00       	call   80107b00 <switchkvm>
+  seginit();
+8010313b:	e8 30 49 00 00       	call   80107a70 <seginit>
+  lapicinit();
+80103140:	e8 1b f7 ff ff       	call   80102860 <lapicinit>
+  mpmain();
+80103145:	e8 a6 ff ff ff       	call   801030f0 <mpmain>
+8010314a:	66 90                	xchg   %ax,%ax
+8010314c:	66 90                	xchg   %ax,%ax
+8010314e:	66 90                	xchg   %ax,%ax
+
+80103150 <main>:
+{
+80103150:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80103154:	83 e4 f0             	and    $0xfffffff0,%esp
+80103157:	ff 71 fc             	push   -0x4(%ecx)
+8010315a:	55                   	push   %ebp
+8010315b:	89 e5                	mov    %esp,%ebp
+8010315d:	53                   	push   %ebx
+8010315e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+8010315f:	83 ec 08             	sub    $0x8,%esp
+80103162:	68 00 00 40 80       	push   $0x80400000
+80103167:	68 f0 6d 11 80       	push   $0x80116df0
+8010316c:	e8 ff f4 ff ff       	call   80102670 <kinit1>
+  kvmalloc();      // kernel page table
+80103171:	e8 4a 4e 00 00       	call   80107fc0 <kvmalloc>
+  mpinit();        // detect other processors
+80103176:	e8 85 01 00 00       	call   80103300 <mpinit>
+  lapicinit();     // interrupt controller
+8010317b:	e8 e0 f6 ff ff       	call   80102860 <lapicinit>
+  seginit();       // segment descriptors
+80103180:	e8 eb 48 00 00       	call   80107a70 <seginit>
+  picinit();       // disable pic
+80103185:	e8 86 03 00 00       	call   80103510 <picinit>
+  ioapicinit();    // another interrupt controller
+8010318a:	e8 b1 f2 ff ff       	call   80102440 <ioapicinit>
+  consoleinit();   // console hardware
+8010318f:	e8 fc d8 ff ff       	call   80100a90 <consoleinit>
+  uartinit();      // serial port
+80103194:	e8 47 3b 00 00       	call   80106ce0 <uartinit>
+  pinit();         // process table
+80103199:	e8 02 09 00 00       	call   80103aa0 <pinit>
+  tvinit();        // trap vectors
+8010319e:	e8 dd 36 00 00       	call   80106880 <tvinit>
+  binit();         // buffer cache
+801031a3:	e8 98 ce ff ff       	call   80100040 <binit>
+  fileinit();      // file table
+801031a8:	e8 b3 dc ff ff       	call   80100e60 <fileinit>
+  ideinit();       // disk 
+801031ad:	e8 6e f0 ff ff       	call   80102220 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801031b2:	83 c4 0c             	add    $0xc,%esp
+801031b5:	68 8a 00 00 00       	push   $0x8a
+801031ba:	68 8c b4 10 80       	push   $0x8010b48c
+801031bf:	68 00 70 00 80       	push   $0x80007000
+801031c4:	e8 77 24 00 00       	call   80105640 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801031c9:	83 c4 10             	add    $0x10,%esp
+801031cc:	69 05 84 27 11 80 f0 	imul   $0xf0,0x80112784,%eax
+801031d3:	00 00 00 
+801031d6:	05 a0 27 11 80       	add    $0x801127a0,%eax
+801031db:	3d a0 27 11 80       	cmp    $0x801127a0,%eax
+801031e0:	76 7e                	jbe    80103260 <main+0x110>
+801031e2:	bb a0 27 11 80       	mov    $0x801127a0,%ebx
+801031e7:	eb 20                	jmp    80103209 <main+0xb9>
+801031e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801031f0:	69 05 84 27 11 80 f0 	imul   $0xf0,0x80112784,%eax
+801031f7:	00 00 00 
+801031fa:	81 c3 f0 00 00 00    	add    $0xf0,%ebx
+80103200:	05 a0 27 11 80       	add    $0x801127a0,%eax
+80103205:	39 c3                	cmp    %eax,%ebx
+80103207:	73 57                	jae    80103260 <main+0x110>
+    if(c == mycpu())  // We've started already.
+80103209:	e8 b2 08 00 00       	call   80103ac0 <mycpu>
+8010320e:	39 c3                	cmp    %eax,%ebx
+80103210:	74 de                	je     801031f0 <main+0xa0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80103212:	e8 c9 f4 ff ff       	call   801026e0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80103217:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+8010321a:	c7 05 f8 6f 00 80 30 	movl   $0x80103130,0x80006ff8
+80103221:	31 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80103224:	c7 05 f4 6f 00 80 00 	movl   $0x10a000,0x80006ff4
+8010322b:	a0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+8010322e:	05 00 10 00 00       	add    $0x1000,%eax
+80103233:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80103238:	0f b6 03             	movzbl (%ebx),%eax
+8010323b:	68 00 70 00 00       	push   $0x7000
+80103240:	50                   	push   %eax
+80103241:	e8 fa f7 ff ff       	call   80102a40 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80103246:	83 c4 10             	add    $0x10,%esp
+80103249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103250:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80103256:	85 c0                	test   %eax,%eax
+80103258:	74 f6                	je     80103250 <main+0x100>
+8010325a:	eb 94                	jmp    801031f0 <main+0xa0>
+8010325c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80103260:	83 ec 08             	sub    $0x8,%esp
+80103263:	68 00 00 00 8e       	push   $0x8e000000
+80103268:	68 00 00 40 80       	push   $0x80400000
+8010326d:	e8 9e f3 ff ff       	call   80102610 <kinit2>
+  userinit();      // first user process
+80103272:	e8 39 0c 00 00       	call   80103eb0 <userinit>
+  mpmain();        // finish this processor's setup
+80103277:	e8 74 fe ff ff       	call   801030f0 <mpmain>
+8010327c:	66 90                	xchg   %ax,%ax
+8010327e:	66 90                	xchg   %ax,%ax
+
+80103280 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80103280:	55                   	push   %ebp
+80103281:	89 e5                	mov    %esp,%ebp
+80103283:	57                   	push   %edi
+80103284:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80103285:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+8010328b:	53                   	push   %ebx
+  e = addr+len;
+8010328c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+8010328f:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80103292:	39 de                	cmp    %ebx,%esi
+80103294:	72 10                	jb     801032a6 <mpsearch1+0x26>
+80103296:	eb 50                	jmp    801032e8 <mpsearch1+0x68>
+80103298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010329f:	90                   	nop
+801032a0:	89 fe                	mov    %edi,%esi
+801032a2:	39 df                	cmp    %ebx,%edi
+801032a4:	73 42                	jae    801032e8 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801032a6:	83 ec 04             	sub    $0x4,%esp
+801032a9:	8d 7e 10             	lea    0x10(%esi),%edi
+801032ac:	6a 04                	push   $0x4
+801032ae:	68 18 88 10 80       	push   $0x80108818
+801032b3:	56                   	push   %esi
+801032b4:	e8 37 23 00 00       	call   801055f0 <memcmp>
+801032b9:	83 c4 10             	add    $0x10,%esp
+801032bc:	85 c0                	test   %eax,%eax
+801032be:	75 e0                	jne    801032a0 <mpsearch1+0x20>
+801032c0:	89 f2                	mov    %esi,%edx
+801032c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+801032c8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801032cb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801032ce:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801032d0:	39 fa                	cmp    %edi,%edx
+801032d2:	75 f4                	jne    801032c8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801032d4:	84 c0                	test   %al,%al
+801032d6:	75 c8                	jne    801032a0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+801032d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801032db:	89 f0                	mov    %esi,%eax
+801032dd:	5b                   	pop    %ebx
+801032de:	5e                   	pop    %esi
+801032df:	5f                   	pop    %edi
+801032e0:	5d                   	pop    %ebp
+801032e1:	c3                   	ret
+801032e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801032e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801032eb:	31 f6                	xor    %esi,%esi
+}
+801032ed:	5b                   	pop    %ebx
+801032ee:	89 f0                	mov    %esi,%eax
+801032f0:	5e                   	pop    %esi
+801032f1:	5f                   	pop    %edi
+801032f2:	5d                   	pop    %ebp
+801032f3:	c3                   	ret
+801032f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801032fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801032ff:	90                   	nop
+
+80103300 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80103300:	55                   	push   %ebp
+80103301:	89 e5                	mov    %esp,%ebp
+80103303:	57                   	push   %edi
+80103304:	56                   	push   %esi
+80103305:	53                   	push   %ebx
+80103306:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80103309:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80103310:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80103317:	c1 e0 08             	shl    $0x8,%eax
+8010331a:	09 d0                	or     %edx,%eax
+8010331c:	c1 e0 04             	shl    $0x4,%eax
+8010331f:	75 1b                	jne    8010333c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80103321:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80103328:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010332f:	c1 e0 08             	shl    $0x8,%eax
+80103332:	09 d0                	or     %edx,%eax
+80103334:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80103337:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+8010333c:	ba 00 04 00 00       	mov    $0x400,%edx
+80103341:	e8 3a ff ff ff       	call   80103280 <mpsearch1>
+80103346:	89 c3                	mov    %eax,%ebx
+80103348:	85 c0                	test   %eax,%eax
+8010334a:	0f 84 50 01 00 00    	je     801034a0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80103350:	8b 73 04             	mov    0x4(%ebx),%esi
+80103353:	85 f6                	test   %esi,%esi
+80103355:	0f 84 35 01 00 00    	je     80103490 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010335b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+8010335e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103364:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80103367:	6a 04                	push   $0x4
+80103369:	68 1d 88 10 80       	push   $0x8010881d
+8010336e:	50                   	push   %eax
+8010336f:	e8 7c 22 00 00       	call   801055f0 <memcmp>
+80103374:	83 c4 10             	add    $0x10,%esp
+80103377:	85 c0                	test   %eax,%eax
+80103379:	0f 85 11 01 00 00    	jne    80103490 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+8010337f:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80103386:	3c 01                	cmp    $0x1,%al
+80103388:	74 08                	je     80103392 <mpinit+0x92>
+8010338a:	3c 04                	cmp    $0x4,%al
+8010338c:	0f 85 fe 00 00 00    	jne    80103490 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80103392:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80103399:	66 85 d2             	test   %dx,%dx
+8010339c:	74 22                	je     801033c0 <mpinit+0xc0>
+8010339e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+801033a1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+801033a3:	31 d2                	xor    %edx,%edx
+801033a5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801033a8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+801033af:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+801033b2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+801033b4:	39 c7                	cmp    %eax,%edi
+801033b6:	75 f0                	jne    801033a8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+801033b8:	84 d2                	test   %dl,%dl
+801033ba:	0f 85 d0 00 00 00    	jne    80103490 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+801033c0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801033c9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+801033cc:	a3 80 26 11 80       	mov    %eax,0x80112680
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033d1:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+801033d8:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+801033de:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033e3:	01 d7                	add    %edx,%edi
+801033e5:	89 fa                	mov    %edi,%edx
+801033e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801033ee:	66 90                	xchg   %ax,%ax
+801033f0:	39 d0                	cmp    %edx,%eax
+801033f2:	73 15                	jae    80103409 <mpinit+0x109>
+    switch(*p){
+801033f4:	0f b6 08             	movzbl (%eax),%ecx
+801033f7:	80 f9 02             	cmp    $0x2,%cl
+801033fa:	74 54                	je     80103450 <mpinit+0x150>
+801033fc:	77 42                	ja     80103440 <mpinit+0x140>
+801033fe:	84 c9                	test   %cl,%cl
+80103400:	74 5e                	je     80103460 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80103402:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103405:	39 d0                	cmp    %edx,%eax
+80103407:	72 eb                	jb     801033f4 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80103409:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010340c:	85 f6                	test   %esi,%esi
+8010340e:	0f 84 e1 00 00 00    	je     801034f5 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80103414:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80103418:	74 15                	je     8010342f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010341a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010341f:	ba 22 00 00 00       	mov    $0x22,%edx
+80103424:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103425:	ba 23 00 00 00       	mov    $0x23,%edx
+8010342a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010342b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010342e:	ee                   	out    %al,(%dx)
+  }
+}
+8010342f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103432:	5b                   	pop    %ebx
+80103433:	5e                   	pop    %esi
+80103434:	5f                   	pop    %edi
+80103435:	5d                   	pop    %ebp
+80103436:	c3                   	ret
+80103437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010343e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80103440:	83 e9 03             	sub    $0x3,%ecx
+80103443:	80 f9 01             	cmp    $0x1,%cl
+80103446:	76 ba                	jbe    80103402 <mpinit+0x102>
+80103448:	31 f6                	xor    %esi,%esi
+8010344a:	eb a4                	jmp    801033f0 <mpinit+0xf0>
+8010344c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80103450:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80103454:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80103457:	88 0d 80 27 11 80    	mov    %cl,0x80112780
+      continue;
+8010345d:	eb 91                	jmp    801033f0 <mpinit+0xf0>
+8010345f:	90                   	nop
+      if(ncpu < NCPU) {
+80103460:	8b 0d 84 27 11 80    	mov    0x80112784,%ecx
+80103466:	83 f9 07             	cmp    $0x7,%ecx
+80103469:	7f 19                	jg     80103484 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010346b:	69 f9 f0 00 00 00    	imul   $0xf0,%ecx,%edi
+80103471:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80103475:	83 c1 01             	add    $0x1,%ecx
+80103478:	89 0d 84 27 11 80    	mov    %ecx,0x80112784
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010347e:	88 9f a0 27 11 80    	mov    %bl,-0x7feed860(%edi)
+      p += sizeof(struct mpproc);
+80103484:	83 c0 14             	add    $0x14,%eax
+      continue;
+80103487:	e9 64 ff ff ff       	jmp    801033f0 <mpinit+0xf0>
+8010348c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80103490:	83 ec 0c             	sub    $0xc,%esp
+80103493:	68 22 88 10 80       	push   $0x80108822
+80103498:	e8 e3 ce ff ff       	call   80100380 <panic>
+8010349d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+801034a0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+801034a5:	eb 13                	jmp    801034ba <mpinit+0x1ba>
+801034a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034ae:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+801034b0:	89 f3                	mov    %esi,%ebx
+801034b2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+801034b8:	74 d6                	je     80103490 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801034ba:	83 ec 04             	sub    $0x4,%esp
+801034bd:	8d 73 10             	lea    0x10(%ebx),%esi
+801034c0:	6a 04                	push   $0x4
+801034c2:	68 18 88 10 80       	push   $0x80108818
+801034c7:	53                   	push   %ebx
+801034c8:	e8 23 21 00 00       	call   801055f0 <memcmp>
+801034cd:	83 c4 10             	add    $0x10,%esp
+801034d0:	85 c0                	test   %eax,%eax
+801034d2:	75 dc                	jne    801034b0 <mpinit+0x1b0>
+801034d4:	89 da                	mov    %ebx,%edx
+801034d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034dd:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801034e0:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801034e3:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801034e6:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801034e8:	39 f2                	cmp    %esi,%edx
+801034ea:	75 f4                	jne    801034e0 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801034ec:	84 c0                	test   %al,%al
+801034ee:	75 c0                	jne    801034b0 <mpinit+0x1b0>
+801034f0:	e9 5b fe ff ff       	jmp    80103350 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+801034f5:	83 ec 0c             	sub    $0xc,%esp
+801034f8:	68 3c 88 10 80       	push   $0x8010883c
+801034fd:	e8 7e ce ff ff       	call   80100380 <panic>
+80103502:	66 90                	xchg   %ax,%ax
+80103504:	66 90                	xchg   %ax,%ax
+80103506:	66 90                	xchg   %ax,%ax
+80103508:	66 90                	xchg   %ax,%ax
+8010350a:	66 90                	xchg   %ax,%ax
+8010350c:	66 90                	xchg   %ax,%ax
+8010350e:	66 90                	xchg   %ax,%ax
+
+80103510 <picinit>:
+80103510:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103515:	ba 21 00 00 00       	mov    $0x21,%edx
+8010351a:	ee                   	out    %al,(%dx)
+8010351b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80103520:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80103521:	c3                   	ret
+80103522:	66 90                	xchg   %ax,%ax
+80103524:	66 90                	xchg   %ax,%ax
+80103526:	66 90                	xchg   %ax,%ax
+80103528:	66 90                	xchg   %ax,%ax
+8010352a:	66 90                	xchg   %ax,%ax
+8010352c:	66 90                	xchg   %ax,%ax
+8010352e:	66 90                	xchg   %ax,%ax
+
+80103530 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80103530:	55                   	push   %ebp
+80103531:	89 e5                	mov    %esp,%ebp
+80103533:	57                   	push   %edi
+80103534:	56                   	push   %esi
+80103535:	53                   	push   %ebx
+80103536:	83 ec 0c             	sub    $0xc,%esp
+80103539:	8b 75 08             	mov    0x8(%ebp),%esi
+8010353c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010353f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80103545:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+8010354b:	e8 30 d9 ff ff       	call   80100e80 <filealloc>
+80103550:	89 06                	mov    %eax,(%esi)
+80103552:	85 c0                	test   %eax,%eax
+80103554:	0f 84 a5 00 00 00    	je     801035ff <pipealloc+0xcf>
+8010355a:	e8 21 d9 ff ff       	call   80100e80 <filealloc>
+8010355f:	89 07                	mov    %eax,(%edi)
+80103561:	85 c0                	test   %eax,%eax
+80103563:	0f 84 84 00 00 00    	je     801035ed <pipealloc+0xbd>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+80103569:	e8 72 f1 ff ff       	call   801026e0 <kalloc>
+8010356e:	89 c3                	mov    %eax,%ebx
+80103570:	85 c0                	test   %eax,%eax
+80103572:	0f 84 a0 00 00 00    	je     80103618 <pipealloc+0xe8>
+    goto bad;
+  p->readopen = 1;
+80103578:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+8010357f:	00 00 00 
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+80103582:	83 ec 08             	sub    $0x8,%esp
+  p->writeopen = 1;
+80103585:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+8010358c:	00 00 00 
+  p->nwrite = 0;
+8010358f:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+80103596:	00 00 00 
+  p->nread = 0;
+80103599:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+801035a0:	00 00 00 
+  initlock(&p->lock, "pipe");
+801035a3:	68 5b 88 10 80       	push   $0x8010885b
+801035a8:	50                   	push   %eax
+801035a9:	e8 42 1d 00 00       	call   801052f0 <initlock>
+  (*f0)->type = FD_PIPE;
+801035ae:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+801035b0:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+801035b3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+801035b9:	8b 06                	mov    (%esi),%eax
+801035bb:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801035bf:	8b 06                	mov    (%esi),%eax
+801035c1:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+801035c5:	8b 06                	mov    (%esi),%eax
+801035c7:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+801035ca:	8b 07                	mov    (%edi),%eax
+801035cc:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+801035d2:	8b 07                	mov    (%edi),%eax
+801035d4:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+801035d8:	8b 07                	mov    (%edi),%eax
+801035da:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+801035de:	8b 07                	mov    (%edi),%eax
+801035e0:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+801035e3:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+801035e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035e8:	5b                   	pop    %ebx
+801035e9:	5e                   	pop    %esi
+801035ea:	5f                   	pop    %edi
+801035eb:	5d                   	pop    %ebp
+801035ec:	c3                   	ret
+  if(*f0)
+801035ed:	8b 06                	mov    (%esi),%eax
+801035ef:	85 c0                	test   %eax,%eax
+801035f1:	74 1e                	je     80103611 <pipealloc+0xe1>
+    fileclose(*f0);
+801035f3:	83 ec 0c             	sub    $0xc,%esp
+801035f6:	50                   	push   %eax
+801035f7:	e8 44 d9 ff ff       	call   80100f40 <fileclose>
+801035fc:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+801035ff:	8b 07                	mov    (%edi),%eax
+80103601:	85 c0                	test   %eax,%eax
+80103603:	74 0c                	je     80103611 <pipealloc+0xe1>
+    fileclose(*f1);
+80103605:	83 ec 0c             	sub    $0xc,%esp
+80103608:	50                   	push   %eax
+80103609:	e8 32 d9 ff ff       	call   80100f40 <fileclose>
+8010360e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80103611:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103616:	eb cd                	jmp    801035e5 <pipealloc+0xb5>
+  if(*f0)
+80103618:	8b 06                	mov    (%esi),%eax
+8010361a:	85 c0                	test   %eax,%eax
+8010361c:	75 d5                	jne    801035f3 <pipealloc+0xc3>
+8010361e:	eb df                	jmp    801035ff <pipealloc+0xcf>
+
+80103620 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80103620:	55                   	push   %ebp
+80103621:	89 e5                	mov    %esp,%ebp
+80103623:	56                   	push   %esi
+80103624:	53                   	push   %ebx
+80103625:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103628:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+8010362b:	83 ec 0c             	sub    $0xc,%esp
+8010362e:	53                   	push   %ebx
+8010362f:	e8 9c 1e 00 00       	call   801054d0 <acquire>
+  if(writable){
+80103634:	83 c4 10             	add    $0x10,%esp
+80103637:	85 f6                	test   %esi,%esi
+80103639:	74 65                	je     801036a0 <pipeclose+0x80>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+8010363b:	83 ec 0c             	sub    $0xc,%esp
+8010363e:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+    p->writeopen = 0;
+80103644:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+8010364b:	00 00 00 
+    wakeup(&p->nread);
+8010364e:	50                   	push   %eax
+8010364f:	e8 ac 15 00 00       	call   80104c00 <wakeup>
+80103654:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80103657:	8b 93 3c 02 00 00    	mov    0x23c(%ebx),%edx
+8010365d:	85 d2                	test   %edx,%edx
+8010365f:	75 0a                	jne    8010366b <pipeclose+0x4b>
+80103661:	8b 83 40 02 00 00    	mov    0x240(%ebx),%eax
+80103667:	85 c0                	test   %eax,%eax
+80103669:	74 15                	je     80103680 <pipeclose+0x60>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+8010366b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010366e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103671:	5b                   	pop    %ebx
+80103672:	5e                   	pop    %esi
+80103673:	5d                   	pop    %ebp
+    release(&p->lock);
+80103674:	e9 f7 1d 00 00       	jmp    80105470 <release>
+80103679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80103680:	83 ec 0c             	sub    $0xc,%esp
+80103683:	53                   	push   %ebx
+80103684:	e8 e7 1d 00 00       	call   80105470 <release>
+    kfree((char*)p);
+80103689:	89 5d 08             	mov    %ebx,0x8(%ebp)
+8010368c:	83 c4 10             	add    $0x10,%esp
+}
+8010368f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103692:	5b                   	pop    %ebx
+80103693:	5e                   	pop    %esi
+80103694:	5d                   	pop    %ebp
+    kfree((char*)p);
+80103695:	e9 86 ee ff ff       	jmp    80102520 <kfree>
+8010369a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+801036a0:	83 ec 0c             	sub    $0xc,%esp
+801036a3:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+    p->readopen = 0;
+801036a9:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+801036b0:	00 00 00 
+    wakeup(&p->nwrite);
+801036b3:	50                   	push   %eax
+801036b4:	e8 47 15 00 00       	call   80104c00 <wakeup>
+801036b9:	83 c4 10             	add    $0x10,%esp
+801036bc:	eb 99                	jmp    80103657 <pipeclose+0x37>
+801036be:	66 90                	xchg   %ax,%ax
+
+801036c0 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801036c0:	55                   	push   %ebp
+801036c1:	89 e5                	mov    %esp,%ebp
+801036c3:	57                   	push   %edi
+801036c4:	56                   	push   %esi
+801036c5:	53                   	push   %ebx
+801036c6:	83 ec 28             	sub    $0x28,%esp
+801036c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801036cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801036cf:	53                   	push   %ebx
+801036d0:	e8 fb 1d 00 00       	call   801054d0 <acquire>
+  for(i = 0; i < n; i++){
+801036d5:	83 c4 10             	add    $0x10,%esp
+801036d8:	85 ff                	test   %edi,%edi
+801036da:	0f 8e ce 00 00 00    	jle    801037ae <pipewrite+0xee>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801036e0:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+801036e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801036e9:	89 7d 10             	mov    %edi,0x10(%ebp)
+801036ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801036ef:	8d 34 39             	lea    (%ecx,%edi,1),%esi
+801036f2:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+801036f5:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801036fb:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103701:	8d bb 38 02 00 00    	lea    0x238(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103707:	8d 90 00 02 00 00    	lea    0x200(%eax),%edx
+8010370d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+80103710:	0f 85 b6 00 00 00    	jne    801037cc <pipewrite+0x10c>
+80103716:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103719:	eb 3b                	jmp    80103756 <pipewrite+0x96>
+8010371b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010371f:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+80103720:	e8 5b 07 00 00       	call   80103e80 <myproc>
+80103725:	8b 48 24             	mov    0x24(%eax),%ecx
+80103728:	85 c9                	test   %ecx,%ecx
+8010372a:	75 34                	jne    80103760 <pipewrite+0xa0>
+      wakeup(&p->nread);
+8010372c:	83 ec 0c             	sub    $0xc,%esp
+8010372f:	56                   	push   %esi
+80103730:	e8 cb 14 00 00       	call   80104c00 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103735:	58                   	pop    %eax
+80103736:	5a                   	pop    %edx
+80103737:	53                   	push   %ebx
+80103738:	57                   	push   %edi
+80103739:	e8 f2 13 00 00       	call   80104b30 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010373e:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80103744:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+8010374a:	83 c4 10             	add    $0x10,%esp
+8010374d:	05 00 02 00 00       	add    $0x200,%eax
+80103752:	39 c2                	cmp    %eax,%edx
+80103754:	75 2a                	jne    80103780 <pipewrite+0xc0>
+      if(p->readopen == 0 || myproc()->killed){
+80103756:	8b 83 3c 02 00 00    	mov    0x23c(%ebx),%eax
+8010375c:	85 c0                	test   %eax,%eax
+8010375e:	75 c0                	jne    80103720 <pipewrite+0x60>
+        release(&p->lock);
+80103760:	83 ec 0c             	sub    $0xc,%esp
+80103763:	53                   	push   %ebx
+80103764:	e8 07 1d 00 00       	call   80105470 <release>
+        return -1;
+80103769:	83 c4 10             	add    $0x10,%esp
+8010376c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+80103771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103774:	5b                   	pop    %ebx
+80103775:	5e                   	pop    %esi
+80103776:	5f                   	pop    %edi
+80103777:	5d                   	pop    %ebp
+80103778:	c3                   	ret
+80103779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103780:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80103783:	8d 42 01             	lea    0x1(%edx),%eax
+80103786:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  for(i = 0; i < n; i++){
+8010378c:	83 c1 01             	add    $0x1,%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+8010378f:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80103795:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103798:	0f b6 41 ff          	movzbl -0x1(%ecx),%eax
+8010379c:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+801037a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801037a3:	39 c1                	cmp    %eax,%ecx
+801037a5:	0f 85 50 ff ff ff    	jne    801036fb <pipewrite+0x3b>
+801037ab:	8b 7d 10             	mov    0x10(%ebp),%edi
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801037ae:	83 ec 0c             	sub    $0xc,%esp
+801037b1:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+801037b7:	50                   	push   %eax
+801037b8:	e8 43 14 00 00       	call   80104c00 <wakeup>
+  release(&p->lock);
+801037bd:	89 1c 24             	mov    %ebx,(%esp)
+801037c0:	e8 ab 1c 00 00       	call   80105470 <release>
+  return n;
+801037c5:	83 c4 10             	add    $0x10,%esp
+801037c8:	89 f8                	mov    %edi,%eax
+801037ca:	eb a5                	jmp    80103771 <pipewrite+0xb1>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801037cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801037cf:	eb b2                	jmp    80103783 <pipewrite+0xc3>
+801037d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037df:	90                   	nop
+
+801037e0 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+801037e0:	55                   	push   %ebp
+801037e1:	89 e5                	mov    %esp,%ebp
+801037e3:	57                   	push   %edi
+801037e4:	56                   	push   %esi
+801037e5:	53                   	push   %ebx
+801037e6:	83 ec 18             	sub    $0x18,%esp
+801037e9:	8b 75 08             	mov    0x8(%ebp),%esi
+801037ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801037ef:	56                   	push   %esi
+801037f0:	8d 9e 34 02 00 00    	lea    0x234(%esi),%ebx
+801037f6:	e8 d5 1c 00 00       	call   801054d0 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801037fb:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103801:	83 c4 10             	add    $0x10,%esp
+80103804:	39 86 38 02 00 00    	cmp    %eax,0x238(%esi)
+8010380a:	74 2f                	je     8010383b <piperead+0x5b>
+8010380c:	eb 37                	jmp    80103845 <piperead+0x65>
+8010380e:	66 90                	xchg   %ax,%ax
+    if(myproc()->killed){
+80103810:	e8 6b 06 00 00       	call   80103e80 <myproc>
+80103815:	8b 48 24             	mov    0x24(%eax),%ecx
+80103818:	85 c9                	test   %ecx,%ecx
+8010381a:	0f 85 80 00 00 00    	jne    801038a0 <piperead+0xc0>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103820:	83 ec 08             	sub    $0x8,%esp
+80103823:	56                   	push   %esi
+80103824:	53                   	push   %ebx
+80103825:	e8 06 13 00 00       	call   80104b30 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010382a:	8b 86 38 02 00 00    	mov    0x238(%esi),%eax
+80103830:	83 c4 10             	add    $0x10,%esp
+80103833:	39 86 34 02 00 00    	cmp    %eax,0x234(%esi)
+80103839:	75 0a                	jne    80103845 <piperead+0x65>
+8010383b:	8b 86 40 02 00 00    	mov    0x240(%esi),%eax
+80103841:	85 c0                	test   %eax,%eax
+80103843:	75 cb                	jne    80103810 <piperead+0x30>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103845:	8b 55 10             	mov    0x10(%ebp),%edx
+80103848:	31 db                	xor    %ebx,%ebx
+8010384a:	85 d2                	test   %edx,%edx
+8010384c:	7f 20                	jg     8010386e <piperead+0x8e>
+8010384e:	eb 2c                	jmp    8010387c <piperead+0x9c>
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80103850:	8d 48 01             	lea    0x1(%eax),%ecx
+80103853:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103858:	89 8e 34 02 00 00    	mov    %ecx,0x234(%esi)
+8010385e:	0f b6 44 06 34       	movzbl 0x34(%esi,%eax,1),%eax
+80103863:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103866:	83 c3 01             	add    $0x1,%ebx
+80103869:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+8010386c:	74 0e                	je     8010387c <piperead+0x9c>
+    if(p->nread == p->nwrite)
+8010386e:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103874:	3b 86 38 02 00 00    	cmp    0x238(%esi),%eax
+8010387a:	75 d4                	jne    80103850 <piperead+0x70>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+8010387c:	83 ec 0c             	sub    $0xc,%esp
+8010387f:	8d 86 38 02 00 00    	lea    0x238(%esi),%eax
+80103885:	50                   	push   %eax
+80103886:	e8 75 13 00 00       	call   80104c00 <wakeup>
+  release(&p->lock);
+8010388b:	89 34 24             	mov    %esi,(%esp)
+8010388e:	e8 dd 1b 00 00       	call   80105470 <release>
+  return i;
+80103893:	83 c4 10             	add    $0x10,%esp
+}
+80103896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103899:	89 d8                	mov    %ebx,%eax
+8010389b:	5b                   	pop    %ebx
+8010389c:	5e                   	pop    %esi
+8010389d:	5f                   	pop    %edi
+8010389e:	5d                   	pop    %ebp
+8010389f:	c3                   	ret
+      release(&p->lock);
+801038a0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801038a3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&p->lock);
+801038a8:	56                   	push   %esi
+801038a9:	e8 c2 1b 00 00       	call   80105470 <release>
+      return -1;
+801038ae:	83 c4 10             	add    $0x10,%esp
+}
+801038b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801038b4:	89 d8                	mov    %ebx,%eax
+801038b6:	5b                   	pop    %ebx
+801038b7:	5e                   	pop    %esi
+801038b8:	5f                   	pop    %edi
+801038b9:	5d                   	pop    %ebp
+801038ba:	c3                   	ret
+801038bb:	66 90                	xchg   %ax,%ax
+801038bd:	66 90                	xchg   %ax,%ax
+801038bf:	90                   	nop
+
+801038c0 <allocproc>:
+// If found, change state to EMBRYO and initialize
+// state required to run in the kernel.
+// Otherwise return 0.
+static struct proc*
+allocproc(void)
+{
+801038c0:	55                   	push   %ebp
+801038c1:	89 e5                	mov    %esp,%ebp
+801038c3:	53                   	push   %ebx
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801038c4:	bb 54 2f 11 80       	mov    $0x80112f54,%ebx
+{
+801038c9:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+801038cc:	68 20 2f 11 80       	push   $0x80112f20
+801038d1:	e8 fa 1b 00 00       	call   801054d0 <acquire>
+801038d6:	83 c4 10             	add    $0x10,%esp
+801038d9:	eb 17                	jmp    801038f2 <allocproc+0x32>
+801038db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801038df:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801038e0:	81 c3 98 00 00 00    	add    $0x98,%ebx
+801038e6:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+801038ec:	0f 84 be 00 00 00    	je     801039b0 <allocproc+0xf0>
+    if(p->state == UNUSED)
+801038f2:	8b 43 0c             	mov    0xc(%ebx),%eax
+801038f5:	85 c0                	test   %eax,%eax
+801038f7:	75 e7                	jne    801038e0 <allocproc+0x20>
+  release(&ptable.lock);
+  return 0;
+
+found:
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+801038f9:	a1 04 b0 10 80       	mov    0x8010b004,%eax
+  p->state = EMBRYO;
+801038fe:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->pid = nextpid++;
+80103905:	8d 50 01             	lea    0x1(%eax),%edx
+80103908:	89 43 10             	mov    %eax,0x10(%ebx)
+  p->nboost = nboost;
+8010390b:	a1 54 55 11 80       	mov    0x80115554,%eax
+  p->pid = nextpid++;
+80103910:	89 15 04 b0 10 80    	mov    %edx,0x8010b004
+  p->nboost = nboost;
+80103916:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  if (p == headproc)
+8010391c:	39 1d 58 55 11 80    	cmp    %ebx,0x80115558
+80103922:	74 7c                	je     801039a0 <allocproc+0xe0>
+    headproc = 0;
+
+  release(&ptable.lock);
+80103924:	83 ec 0c             	sub    $0xc,%esp
+80103927:	68 20 2f 11 80       	push   $0x80112f20
+8010392c:	e8 3f 1b 00 00       	call   80105470 <release>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+80103931:	e8 aa ed ff ff       	call   801026e0 <kalloc>
+80103936:	83 c4 10             	add    $0x10,%esp
+80103939:	89 43 08             	mov    %eax,0x8(%ebx)
+8010393c:	85 c0                	test   %eax,%eax
+8010393e:	0f 84 85 00 00 00    	je     801039c9 <allocproc+0x109>
+    return 0;
+  }
+  sp = p->kstack + KSTACKSIZE;
+
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+80103944:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  sp -= 4;
+  *(uint*)sp = (uint)trapret;
+
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+8010394a:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+8010394d:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80103952:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80103955:	c7 40 14 67 68 10 80 	movl   $0x80106867,0x14(%eax)
+  p->context = (struct context*)sp;
+8010395c:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+8010395f:	6a 14                	push   $0x14
+80103961:	6a 00                	push   $0x0
+80103963:	50                   	push   %eax
+80103964:	e8 47 1c 00 00       	call   801055b0 <memset>
+  p->context->eip = (uint)forkret;
+80103969:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  // init process fields
+  p->localtime = 0;
+  p->priority = 3;
+  p->queue = L0;
+
+  return p;
+8010396c:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+8010396f:	c7 40 10 50 3a 10 80 	movl   $0x80103a50,0x10(%eax)
+}
+80103976:	89 d8                	mov    %ebx,%eax
+  p->localtime = 0;
+80103978:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+8010397f:	00 00 00 
+  p->priority = 3;
+80103982:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80103989:	00 00 00 
+  p->queue = L0;
+8010398c:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+}
+80103993:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103996:	c9                   	leave
+80103997:	c3                   	ret
+80103998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010399f:	90                   	nop
+    headproc = 0;
+801039a0:	c7 05 58 55 11 80 00 	movl   $0x0,0x80115558
+801039a7:	00 00 00 
+801039aa:	e9 75 ff ff ff       	jmp    80103924 <allocproc+0x64>
+801039af:	90                   	nop
+  release(&ptable.lock);
+801039b0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801039b3:	31 db                	xor    %ebx,%ebx
+  release(&ptable.lock);
+801039b5:	68 20 2f 11 80       	push   $0x80112f20
+801039ba:	e8 b1 1a 00 00       	call   80105470 <release>
+  return 0;
+801039bf:	83 c4 10             	add    $0x10,%esp
+}
+801039c2:	89 d8                	mov    %ebx,%eax
+801039c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801039c7:	c9                   	leave
+801039c8:	c3                   	ret
+    p->state = UNUSED;
+801039c9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return 0;
+801039d0:	31 db                	xor    %ebx,%ebx
+801039d2:	eb ee                	jmp    801039c2 <allocproc+0x102>
+801039d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801039db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801039df:	90                   	nop
+
+801039e0 <armtimer>:
+  if (c == &cpus[0])
+801039e0:	3d a0 27 11 80       	cmp    $0x801127a0,%eax
+801039e5:	74 59                	je     80103a40 <armtimer+0x60>
+{
+801039e7:	55                   	push   %ebp
+  n = BOOSTTICKS - ticks % BOOSTTICKS;
+801039e8:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+801039ed:	89 d1                	mov    %edx,%ecx
+{
+801039ef:	89 e5                	mov    %esp,%ebp
+801039f1:	53                   	push   %ebx
+801039f2:	83 ec 04             	sub    $0x4,%esp
+  n = BOOSTTICKS - ticks % BOOSTTICKS;
+801039f5:	8b 1d 80 55 11 80    	mov    0x80115580,%ebx
+801039fb:	f7 e3                	mul    %ebx
+801039fd:	c1 ea 05             	shr    $0x5,%edx
+80103a00:	6b d2 64             	imul   $0x64,%edx,%edx
+80103a03:	29 da                	sub    %ebx,%edx
+80103a05:	8d 42 64             	lea    0x64(%edx),%eax
+  if (p != specialproc && QUANTUM(p->queue) - (int)p->localtime < n)
+80103a08:	39 0d 5c 55 11 80    	cmp    %ecx,0x8011555c
+80103a0e:	74 1b                	je     80103a2b <armtimer+0x4b>
+80103a10:	8b 51 7c             	mov    0x7c(%ecx),%edx
+80103a13:	8d 54 12 04          	lea    0x4(%edx,%edx,1),%edx
+80103a17:	2b 91 84 00 00 00    	sub    0x84(%ecx),%edx
+80103a1d:	39 c2                	cmp    %eax,%edx
+80103a1f:	73 0a                	jae    80103a2b <armtimer+0x4b>
+    n = QUANTUM(p->queue) - p->localtime;
+80103a21:	85 d2                	test   %edx,%edx
+80103a23:	b8 01 00 00 00       	mov    $0x1,%eax
+80103a28:	0f 45 c2             	cmovne %edx,%eax
+  lapictimer(n);
+80103a2b:	83 ec 0c             	sub    $0xc,%esp
+80103a2e:	50                   	push   %eax
+80103a2f:	e8 6c ef ff ff       	call   801029a0 <lapictimer>
+}
+80103a34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lapictimer(n);
+80103a37:	83 c4 10             	add    $0x10,%esp
+}
+80103a3a:	c9                   	leave
+80103a3b:	c3                   	ret
+80103a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103a40:	c3                   	ret
+80103a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a4f:	90                   	nop
+
+80103a50 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+80103a50:	55                   	push   %ebp
+80103a51:	89 e5                	mov    %esp,%ebp
+80103a53:	83 ec 14             	sub    $0x14,%esp
+  static int first = 1;
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+80103a56:	68 20 2f 11 80       	push   $0x80112f20
+80103a5b:	e8 10 1a 00 00       	call   80105470 <release>
+
+  if (first) {
+80103a60:	a1 00 b0 10 80       	mov    0x8010b000,%eax
+80103a65:	83 c4 10             	add    $0x10,%esp
+80103a68:	85 c0                	test   %eax,%eax
+80103a6a:	75 04                	jne    80103a70 <forkret+0x20>
+    iinit(ROOTDEV);
+    initlog(ROOTDEV);
+  }
+
+  // Return to "caller", actually trapret (see allocproc).
+}
+80103a6c:	c9                   	leave
+80103a6d:	c3                   	ret
+80103a6e:	66 90                	xchg   %ax,%ax
+    first = 0;
+80103a70:	c7 05 00 b0 10 80 00 	movl   $0x0,0x8010b000
+80103a77:	00 00 00 
+    iinit(ROOTDEV);
+80103a7a:	83 ec 0c             	sub    $0xc,%esp
+80103a7d:	6a 01                	push   $0x1
+80103a7f:	e8 2c db ff ff       	call   801015b0 <iinit>
+    initlog(ROOTDEV);
+80103a84:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80103a8b:	e8 30 f3 ff ff       	call   80102dc0 <initlog>
+}
+80103a90:	83 c4 10             	add    $0x10,%esp
+80103a93:	c9                   	leave
+80103a94:	c3                   	ret
+80103a95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103aa0 <pinit>:
+{
+80103aa0:	55                   	push   %ebp
+80103aa1:	89 e5                	mov    %esp,%ebp
+80103aa3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+80103aa6:	68 60 88 10 80       	push   $0x80108860
+80103aab:	68 20 2f 11 80       	push   $0x80112f20
+80103ab0:	e8 3b 18 00 00       	call   801052f0 <initlock>
+}
+80103ab5:	83 c4 10             	add    $0x10,%esp
+80103ab8:	c9                   	leave
+80103ab9:	c3                   	ret
+80103aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103ac0 <mycpu>:
+{
+80103ac0:	55                   	push   %ebp
+80103ac1:	89 e5                	mov    %esp,%ebp
+80103ac3:	56                   	push   %esi
+80103ac4:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80103ac5:	9c                   	pushf
+80103ac6:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80103ac7:	f6 c4 02             	test   $0x2,%ah
+80103aca:	75 46                	jne    80103b12 <mycpu+0x52>
+  apicid = lapicid();
+80103acc:	e8 8f ee ff ff       	call   80102960 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80103ad1:	8b 35 84 27 11 80    	mov    0x80112784,%esi
+80103ad7:	85 f6                	test   %esi,%esi
+80103ad9:	7e 2a                	jle    80103b05 <mycpu+0x45>
+80103adb:	31 d2                	xor    %edx,%edx
+80103add:	eb 08                	jmp    80103ae7 <mycpu+0x27>
+80103adf:	90                   	nop
+80103ae0:	83 c2 01             	add    $0x1,%edx
+80103ae3:	39 f2                	cmp    %esi,%edx
+80103ae5:	74 1e                	je     80103b05 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80103ae7:	69 ca f0 00 00 00    	imul   $0xf0,%edx,%ecx
+80103aed:	0f b6 99 a0 27 11 80 	movzbl -0x7feed860(%ecx),%ebx
+80103af4:	39 c3                	cmp    %eax,%ebx
+80103af6:	75 e8                	jne    80103ae0 <mycpu+0x20>
+}
+80103af8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+80103afb:	8d 81 a0 27 11 80    	lea    -0x7feed860(%ecx),%eax
+}
+80103b01:	5b                   	pop    %ebx
+80103b02:	5e                   	pop    %esi
+80103b03:	5d                   	pop    %ebp
+80103b04:	c3                   	ret
+  panic("unknown apicid\n");
+80103b05:	83 ec 0c             	sub    $0xc,%esp
+80103b08:	68 67 88 10 80       	push   $0x80108867
+80103b0d:	e8 6e c8 ff ff       	call   80100380 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80103b12:	83 ec 0c             	sub    $0xc,%esp
+80103b15:	68 4c 89 10 80       	push   $0x8010894c
+80103b1a:	e8 61 c8 ff ff       	call   80100380 <panic>
+80103b1f:	90                   	nop
+
+80103b20 <cpuid>:
+cpuid() {
+80103b20:	55                   	push   %ebp
+80103b21:	89 e5                	mov    %esp,%ebp
+80103b23:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80103b26:	e8 95 ff ff ff       	call   80103ac0 <mycpu>
+}
+80103b2b:	c9                   	leave
+  return mycpu()-cpus;
+80103b2c:	2d a0 27 11 80       	sub    $0x801127a0,%eax
+80103b31:	c1 f8 04             	sar    $0x4,%eax
+80103b34:	69 c0 ef ee ee ee    	imul   $0xeeeeeeef,%eax,%eax
+}
+80103b3a:	c3                   	ret
+80103b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103b3f:	90                   	nop
+
+80103b40 <pickcpu>:
+{
+80103b40:	55                   	push   %ebp
+80103b41:	89 e5                	mov    %esp,%ebp
+80103b43:	57                   	push   %edi
+80103b44:	56                   	push   %esi
+80103b45:	53                   	push   %ebx
+80103b46:	83 ec 0c             	sub    $0xc,%esp
+  me = idlest = mycpu();
+80103b49:	e8 72 ff ff ff       	call   80103ac0 <mycpu>
+  for (c = cpus; c < cpus+ncpu; c++)
+80103b4e:	69 35 84 27 11 80 f0 	imul   $0xf0,0x80112784,%esi
+80103b55:	00 00 00 
+  me = idlest = mycpu();
+80103b58:	89 c7                	mov    %eax,%edi
+80103b5a:	89 c2                	mov    %eax,%edx
+  for (c = cpus; c < cpus+ncpu; c++)
+80103b5c:	81 c6 a0 27 11 80    	add    $0x801127a0,%esi
+80103b62:	81 fe a0 27 11 80    	cmp    $0x801127a0,%esi
+80103b68:	76 20                	jbe    80103b8a <pickcpu+0x4a>
+80103b6a:	b8 a0 27 11 80       	mov    $0x801127a0,%eax
+80103b6f:	90                   	nop
+    if (c->nrun < idlest->nrun)
+80103b70:	8b 88 e0 00 00 00    	mov    0xe0(%eax),%ecx
+80103b76:	8b 9a e0 00 00 00    	mov    0xe0(%edx),%ebx
+80103b7c:	39 cb                	cmp    %ecx,%ebx
+80103b7e:	0f 4f d0             	cmovg  %eax,%edx
+  for (c = cpus; c < cpus+ncpu; c++)
+80103b81:	05 f0 00 00 00       	add    $0xf0,%eax
+80103b86:	39 f0                	cmp    %esi,%eax
+80103b88:	72 e6                	jb     80103b70 <pickcpu+0x30>
+  if (idlest->nrun + 2 <= me->nrun)
+80103b8a:	8b 82 e0 00 00 00    	mov    0xe0(%edx),%eax
+80103b90:	8b 8f e0 00 00 00    	mov    0xe0(%edi),%ecx
+80103b96:	83 c0 01             	add    $0x1,%eax
+80103b99:	39 c8                	cmp    %ecx,%eax
+80103b9b:	0f 4d d7             	cmovge %edi,%edx
+}
+80103b9e:	83 c4 0c             	add    $0xc,%esp
+80103ba1:	5b                   	pop    %ebx
+80103ba2:	5e                   	pop    %esi
+80103ba3:	89 d0                	mov    %edx,%eax
+80103ba5:	5f                   	pop    %edi
+80103ba6:	5d                   	pop    %ebp
+80103ba7:	c3                   	ret
+80103ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103baf:	90                   	nop
+
+80103bb0 <kick>:
+{
+80103bb0:	55                   	push   %ebp
+80103bb1:	89 e5                	mov    %esp,%ebp
+80103bb3:	57                   	push   %edi
+80103bb4:	56                   	push   %esi
+80103bb5:	89 c6                	mov    %eax,%esi
+80103bb7:	53                   	push   %ebx
+80103bb8:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *v, *me = mycpu();
+80103bbb:	e8 00 ff ff ff       	call   80103ac0 <mycpu>
+  __sync_synchronize();
+80103bc0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  struct cpu *v, *me = mycpu();
+80103bc5:	89 c7                	mov    %eax,%edi
+  if (c && c != me && c->idle) {
+80103bc7:	85 f6                	test   %esi,%esi
+80103bc9:	74 0e                	je     80103bd9 <kick+0x29>
+80103bcb:	39 f0                	cmp    %esi,%eax
+80103bcd:	74 0a                	je     80103bd9 <kick+0x29>
+80103bcf:	8b 86 e4 00 00 00    	mov    0xe4(%esi),%eax
+80103bd5:	85 c0                	test   %eax,%eax
+80103bd7:	75 65                	jne    80103c3e <kick+0x8e>
+  for (v = cpus; v < cpus+ncpu; v++) {
+80103bd9:	8b 15 84 27 11 80    	mov    0x80112784,%edx
+80103bdf:	bb a0 27 11 80       	mov    $0x801127a0,%ebx
+80103be4:	69 c2 f0 00 00 00    	imul   $0xf0,%edx,%eax
+80103bea:	05 a0 27 11 80       	add    $0x801127a0,%eax
+80103bef:	39 d8                	cmp    %ebx,%eax
+80103bf1:	76 43                	jbe    80103c36 <kick+0x86>
+80103bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103bf7:	90                   	nop
+    if (v == me || !v->idle)
+80103bf8:	39 df                	cmp    %ebx,%edi
+80103bfa:	74 25                	je     80103c21 <kick+0x71>
+80103bfc:	8b 83 e4 00 00 00    	mov    0xe4(%ebx),%eax
+80103c02:	85 c0                	test   %eax,%eax
+80103c04:	74 1b                	je     80103c21 <kick+0x71>
+    lapicipi(v->apicid, T_IRQ0 + IRQ_WAKE);
+80103c06:	83 ec 08             	sub    $0x8,%esp
+80103c09:	6a 34                	push   $0x34
+80103c0b:	0f b6 03             	movzbl (%ebx),%eax
+80103c0e:	50                   	push   %eax
+80103c0f:	e8 cc ed ff ff       	call   801029e0 <lapicipi>
+    if (c)
+80103c14:	83 c4 10             	add    $0x10,%esp
+80103c17:	85 f6                	test   %esi,%esi
+80103c19:	75 1b                	jne    80103c36 <kick+0x86>
+80103c1b:	8b 15 84 27 11 80    	mov    0x80112784,%edx
+  for (v = cpus; v < cpus+ncpu; v++) {
+80103c21:	69 c2 f0 00 00 00    	imul   $0xf0,%edx,%eax
+80103c27:	81 c3 f0 00 00 00    	add    $0xf0,%ebx
+80103c2d:	05 a0 27 11 80       	add    $0x801127a0,%eax
+80103c32:	39 c3                	cmp    %eax,%ebx
+80103c34:	72 c2                	jb     80103bf8 <kick+0x48>
+}
+80103c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c39:	5b                   	pop    %ebx
+80103c3a:	5e                   	pop    %esi
+80103c3b:	5f                   	pop    %edi
+80103c3c:	5d                   	pop    %ebp
+80103c3d:	c3                   	ret
+    lapicipi(c->apicid, T_IRQ0 + IRQ_WAKE);
+80103c3e:	83 ec 08             	sub    $0x8,%esp
+80103c41:	6a 34                	push   $0x34
+80103c43:	0f b6 06             	movzbl (%esi),%eax
+80103c46:	50                   	push   %eax
+80103c47:	e8 94 ed ff ff       	call   801029e0 <lapicipi>
+    return;
+80103c4c:	83 c4 10             	add    $0x10,%esp
+}
+80103c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c52:	5b                   	pop    %ebx
+80103c53:	5e                   	pop    %esi
+80103c54:	5f                   	pop    %edi
+80103c55:	5d                   	pop    %ebp
+80103c56:	c3                   	ret
+80103c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c5e:	66 90                	xchg   %ax,%ax
+
+80103c60 <setrunnable>:
+{
+80103c60:	55                   	push   %ebp
+80103c61:	89 e5                	mov    %esp,%ebp
+80103c63:	53                   	push   %ebx
+80103c64:	83 ec 04             	sub    $0x4,%esp
+  p->state = RUNNABLE;
+80103c67:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  if (p == specialproc) {
+80103c6e:	39 05 5c 55 11 80    	cmp    %eax,0x8011555c
+80103c74:	0f 84 26 01 00 00    	je     80103da0 <setrunnable+0x140>
+80103c7a:	89 c3                	mov    %eax,%ebx
+  if (p->nboost == nboost)
+80103c7c:	a1 54 55 11 80       	mov    0x80115554,%eax
+80103c81:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80103c87:	74 21                	je     80103caa <setrunnable+0x4a>
+  p->nboost = nboost;
+80103c89:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->queue = L0;
+80103c8f:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->localtime = 0;
+80103c96:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80103c9d:	00 00 00 
+  p->priority = 3;
+80103ca0:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80103ca7:	00 00 00 
+  c = pickcpu();
+80103caa:	e8 91 fe ff ff       	call   80103b40 <pickcpu>
+  if (p == headproc) {
+80103caf:	39 1d 58 55 11 80    	cmp    %ebx,0x80115558
+80103cb5:	74 79                	je     80103d30 <setrunnable+0xd0>
+  if (p->queue != L2)
+80103cb7:	8b 53 7c             	mov    0x7c(%ebx),%edx
+80103cba:	83 fa 02             	cmp    $0x2,%edx
+80103cbd:	74 51                	je     80103d10 <setrunnable+0xb0>
+    p->qnext = 0;
+80103cbf:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80103cc6:	00 00 00 
+    p->qprev = q->back;
+80103cc9:	83 c2 16             	add    $0x16,%edx
+80103ccc:	8b 4c d0 04          	mov    0x4(%eax,%edx,8),%ecx
+80103cd0:	89 8b 8c 00 00 00    	mov    %ecx,0x8c(%ebx)
+    if (q->back)
+80103cd6:	85 c9                	test   %ecx,%ecx
+80103cd8:	0f 84 a2 00 00 00    	je     80103d80 <setrunnable+0x120>
+      q->back->qnext = p;
+80103cde:	89 99 88 00 00 00    	mov    %ebx,0x88(%ecx)
+    q->back = p;
+80103ce4:	89 5c d0 04          	mov    %ebx,0x4(%eax,%edx,8)
+  p->cpu = c;
+80103ce8:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+  c->nrun++;
+80103cee:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80103cf4:	83 c2 01             	add    $0x1,%edx
+80103cf7:	89 90 e0 00 00 00    	mov    %edx,0xe0(%eax)
+}
+80103cfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d00:	c9                   	leave
+  kick(c);
+80103d01:	e9 aa fe ff ff       	jmp    80103bb0 <kick>
+80103d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if (prio >= NPRIO)
+80103d10:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80103d16:	b9 03 00 00 00       	mov    $0x3,%ecx
+80103d1b:	39 ca                	cmp    %ecx,%edx
+80103d1d:	0f 4f d1             	cmovg  %ecx,%edx
+  return L2 + prio;
+80103d20:	31 c9                	xor    %ecx,%ecx
+80103d22:	85 d2                	test   %edx,%edx
+80103d24:	0f 48 d1             	cmovs  %ecx,%edx
+80103d27:	83 c2 02             	add    $0x2,%edx
+80103d2a:	eb 93                	jmp    80103cbf <setrunnable+0x5f>
+80103d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p->qprev = 0;
+80103d30:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80103d37:	00 00 00 
+    p->qnext = q->front;
+80103d3a:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+    headproc = 0;
+80103d40:	c7 05 58 55 11 80 00 	movl   $0x0,0x80115558
+80103d47:	00 00 00 
+    p->qnext = q->front;
+80103d4a:	89 93 88 00 00 00    	mov    %edx,0x88(%ebx)
+    if (q->front)
+80103d50:	85 d2                	test   %edx,%edx
+80103d52:	74 3c                	je     80103d90 <setrunnable+0x130>
+      q->front->qprev = p;
+80103d54:	89 9a 8c 00 00 00    	mov    %ebx,0x8c(%edx)
+    q->front = p;
+80103d5a:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+  p->cpu = c;
+80103d60:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+  c->nrun++;
+80103d66:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80103d6c:	83 c2 01             	add    $0x1,%edx
+80103d6f:	89 90 e0 00 00 00    	mov    %edx,0xe0(%eax)
+}
+80103d75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d78:	c9                   	leave
+  kick(c);
+80103d79:	e9 32 fe ff ff       	jmp    80103bb0 <kick>
+80103d7e:	66 90                	xchg   %ax,%ax
+      q->front = p;
+80103d80:	89 1c d0             	mov    %ebx,(%eax,%edx,8)
+80103d83:	e9 5c ff ff ff       	jmp    80103ce4 <setrunnable+0x84>
+80103d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d8f:	90                   	nop
+      q->back = p;
+80103d90:	89 98 b4 00 00 00    	mov    %ebx,0xb4(%eax)
+80103d96:	eb c2                	jmp    80103d5a <setrunnable+0xfa>
+80103d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d9f:	90                   	nop
+    kick(mycpu());
+80103da0:	e8 1b fd ff ff       	call   80103ac0 <mycpu>
+}
+80103da5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103da8:	c9                   	leave
+    kick(mycpu());
+80103da9:	e9 02 fe ff ff       	jmp    80103bb0 <kick>
+80103dae:	66 90                	xchg   %ax,%ax
+
+80103db0 <charge>:
+{
+80103db0:	55                   	push   %ebp
+80103db1:	89 e5                	mov    %esp,%ebp
+80103db3:	53                   	push   %ebx
+80103db4:	89 c3                	mov    %eax,%ebx
+80103db6:	83 ec 04             	sub    $0x4,%esp
+  struct cpu *c = mycpu();
+80103db9:	e8 02 fd ff ff       	call   80103ac0 <mycpu>
+  n = ticks - c->start;
+80103dbe:	8b 15 80 55 11 80    	mov    0x80115580,%edx
+80103dc4:	89 d1                	mov    %edx,%ecx
+80103dc6:	2b 88 e8 00 00 00    	sub    0xe8(%eax),%ecx
+  c->start = ticks;
+80103dcc:	89 90 e8 00 00 00    	mov    %edx,0xe8(%eax)
+  if (p == specialproc || n <= 0)
+80103dd2:	39 1d 5c 55 11 80    	cmp    %ebx,0x8011555c
+80103dd8:	74 39                	je     80103e13 <charge+0x63>
+80103dda:	85 c9                	test   %ecx,%ecx
+80103ddc:	7e 35                	jle    80103e13 <charge+0x63>
+  if (p->nboost == nboost)
+80103dde:	a1 54 55 11 80       	mov    0x80115554,%eax
+80103de3:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80103de9:	74 5d                	je     80103e48 <charge+0x98>
+  p->queue = L0;
+80103deb:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->priority = 3;
+80103df2:	ba 04 00 00 00       	mov    $0x4,%edx
+80103df7:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80103dfe:	00 00 00 
+  p->nboost = nboost;
+80103e01:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->priority = 3;
+80103e07:	31 c0                	xor    %eax,%eax
+  if (p->localtime < QUANTUM(p->queue))
+80103e09:	39 d1                	cmp    %edx,%ecx
+80103e0b:	73 13                	jae    80103e20 <charge+0x70>
+  p->localtime += n;
+80103e0d:	89 8b 84 00 00 00    	mov    %ecx,0x84(%ebx)
+    return 0;
+80103e13:	31 c0                	xor    %eax,%eax
+}
+80103e15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103e18:	c9                   	leave
+80103e19:	c3                   	ret
+80103e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  p->localtime = 0;
+80103e20:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80103e27:	00 00 00 
+  if (p->pid <= 2) return;
+80103e2a:	83 7b 10 02          	cmpl   $0x2,0x10(%ebx)
+80103e2e:	7e 0b                	jle    80103e3b <charge+0x8b>
+  if (p->queue == L2) {
+80103e30:	83 f8 02             	cmp    $0x2,%eax
+80103e33:	74 2b                	je     80103e60 <charge+0xb0>
+  p->queue++;
+80103e35:	83 c0 01             	add    $0x1,%eax
+80103e38:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  return 1;
+80103e3b:	b8 01 00 00 00       	mov    $0x1,%eax
+80103e40:	eb d3                	jmp    80103e15 <charge+0x65>
+80103e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if (p->localtime < QUANTUM(p->queue))
+80103e48:	8b 43 7c             	mov    0x7c(%ebx),%eax
+  p->localtime += n;
+80103e4b:	03 8b 84 00 00 00    	add    0x84(%ebx),%ecx
+  if (p->localtime < QUANTUM(p->queue))
+80103e51:	8d 54 00 04          	lea    0x4(%eax,%eax,1),%edx
+80103e55:	eb b2                	jmp    80103e09 <charge+0x59>
+80103e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e5e:	66 90                	xchg   %ax,%ax
+    p->priority--;
+80103e60:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80103e66:	ba 00 00 00 00       	mov    $0x0,%edx
+80103e6b:	83 e8 01             	sub    $0x1,%eax
+80103e6e:	0f 48 c2             	cmovs  %edx,%eax
+80103e71:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+80103e77:	eb c2                	jmp    80103e3b <charge+0x8b>
+80103e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103e80 <myproc>:
+{
+80103e80:	55                   	push   %ebp
+80103e81:	89 e5                	mov    %esp,%ebp
+80103e83:	53                   	push   %ebx
+80103e84:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80103e87:	e8 f4 14 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80103e8c:	e8 2f fc ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80103e91:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80103e97:	e8 34 15 00 00       	call   801053d0 <popcli>
+}
+80103e9c:	89 d8                	mov    %ebx,%eax
+80103e9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103ea1:	c9                   	leave
+80103ea2:	c3                   	ret
+80103ea3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103eb0 <userinit>:
+{
+80103eb0:	55                   	push   %ebp
+80103eb1:	89 e5                	mov    %esp,%ebp
+80103eb3:	53                   	push   %ebx
+80103eb4:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80103eb7:	e8 04 fa ff ff       	call   801038c0 <allocproc>
+80103ebc:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80103ebe:	a3 60 55 11 80       	mov    %eax,0x80115560
+  if((p->pgdir = setupkvm()) == 0)
+80103ec3:	e8 78 40 00 00       	call   80107f40 <setupkvm>
+80103ec8:	89 43 04             	mov    %eax,0x4(%ebx)
+80103ecb:	85 c0                	test   %eax,%eax
+80103ecd:	0f 84 bd 00 00 00    	je     80103f90 <userinit+0xe0>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80103ed3:	83 ec 04             	sub    $0x4,%esp
+80103ed6:	68 2c 00 00 00       	push   $0x2c
+80103edb:	68 60 b4 10 80       	push   $0x8010b460
+80103ee0:	50                   	push   %eax
+80103ee1:	e8 3a 3d 00 00       	call   80107c20 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80103ee6:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80103ee9:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80103eef:	6a 4c                	push   $0x4c
+80103ef1:	6a 00                	push   $0x0
+80103ef3:	ff 73 18             	push   0x18(%ebx)
+80103ef6:	e8 b5 16 00 00       	call   801055b0 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80103efb:	8b 43 18             	mov    0x18(%ebx),%eax
+80103efe:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80103f03:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80103f06:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80103f0b:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80103f0f:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f12:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80103f16:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f19:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80103f1d:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80103f21:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f24:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80103f28:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80103f2c:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f2f:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80103f36:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f39:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80103f40:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f43:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80103f4a:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80103f4d:	6a 10                	push   $0x10
+80103f4f:	68 90 88 10 80       	push   $0x80108890
+80103f54:	50                   	push   %eax
+80103f55:	e8 06 18 00 00       	call   80105760 <safestrcpy>
+  p->cwd = namei("/");
+80103f5a:	c7 04 24 99 88 10 80 	movl   $0x80108899,(%esp)
+80103f61:	e8 9a e1 ff ff       	call   80102100 <namei>
+80103f66:	89 43 68             	mov    %eax,0x68(%ebx)
+  acquire(&ptable.lock);
+80103f69:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+80103f70:	e8 5b 15 00 00       	call   801054d0 <acquire>
+  setrunnable(p);
+80103f75:	89 d8                	mov    %ebx,%eax
+80103f77:	e8 e4 fc ff ff       	call   80103c60 <setrunnable>
+  release(&ptable.lock);
+80103f7c:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+80103f83:	e8 e8 14 00 00       	call   80105470 <release>
+}
+80103f88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103f8b:	83 c4 10             	add    $0x10,%esp
+80103f8e:	c9                   	leave
+80103f8f:	c3                   	ret
+    panic("userinit: out of memory?");
+80103f90:	83 ec 0c             	sub    $0xc,%esp
+80103f93:	68 77 88 10 80       	push   $0x80108877
+80103f98:	e8 e3 c3 ff ff       	call   80100380 <panic>
+80103f9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103fa0 <growproc>:
+{
+80103fa0:	55                   	push   %ebp
+80103fa1:	89 e5                	mov    %esp,%ebp
+80103fa3:	56                   	push   %esi
+80103fa4:	53                   	push   %ebx
+80103fa5:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80103fa8:	e8 d3 13 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80103fad:	e8 0e fb ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80103fb2:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80103fb8:	e8 13 14 00 00       	call   801053d0 <popcli>
+  sz = curproc->sz;
+80103fbd:	8b 03                	mov    (%ebx),%eax
+  if(n > 0){
+80103fbf:	85 f6                	test   %esi,%esi
+80103fc1:	7f 1d                	jg     80103fe0 <growproc+0x40>
+  } else if(n < 0){
+80103fc3:	75 3b                	jne    80104000 <growproc+0x60>
+  switchuvm(curproc);
+80103fc5:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+80103fc8:	89 03                	mov    %eax,(%ebx)
+  switchuvm(curproc);
+80103fca:	53                   	push   %ebx
+80103fcb:	e8 40 3b 00 00       	call   80107b10 <switchuvm>
+  return 0;
+80103fd0:	83 c4 10             	add    $0x10,%esp
+80103fd3:	31 c0                	xor    %eax,%eax
+}
+80103fd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103fd8:	5b                   	pop    %ebx
+80103fd9:	5e                   	pop    %esi
+80103fda:	5d                   	pop    %ebp
+80103fdb:	c3                   	ret
+80103fdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80103fe0:	83 ec 04             	sub    $0x4,%esp
+80103fe3:	01 c6                	add    %eax,%esi
+80103fe5:	56                   	push   %esi
+80103fe6:	50                   	push   %eax
+80103fe7:	ff 73 04             	push   0x4(%ebx)
+80103fea:	e8 81 3d 00 00       	call   80107d70 <allocuvm>
+80103fef:	83 c4 10             	add    $0x10,%esp
+80103ff2:	85 c0                	test   %eax,%eax
+80103ff4:	75 cf                	jne    80103fc5 <growproc+0x25>
+      return -1;
+80103ff6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103ffb:	eb d8                	jmp    80103fd5 <growproc+0x35>
+80103ffd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80104000:	83 ec 04             	sub    $0x4,%esp
+80104003:	01 c6                	add    %eax,%esi
+80104005:	56                   	push   %esi
+80104006:	50                   	push   %eax
+80104007:	ff 73 04             	push   0x4(%ebx)
+8010400a:	e8 81 3e 00 00       	call   80107e90 <deallocuvm>
+8010400f:	83 c4 10             	add    $0x10,%esp
+80104012:	85 c0                	test   %eax,%eax
+80104014:	75 af                	jne    80103fc5 <growproc+0x25>
+80104016:	eb de                	jmp    80103ff6 <growproc+0x56>
+80104018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010401f:	90                   	nop
+
+80104020 <fork>:
+{
+80104020:	55                   	push   %ebp
+80104021:	89 e5                	mov    %esp,%ebp
+80104023:	57                   	push   %edi
+80104024:	56                   	push   %esi
+80104025:	53                   	push   %ebx
+80104026:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80104029:	e8 52 13 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+8010402e:	e8 8d fa ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104033:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104039:	e8 92 13 00 00       	call   801053d0 <popcli>
+  if((np = allocproc()) == 0){
+8010403e:	e8 7d f8 ff ff       	call   801038c0 <allocproc>
+80104043:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104046:	85 c0                	test   %eax,%eax
+80104048:	0f 84 d6 00 00 00    	je     80104124 <fork+0x104>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+8010404e:	83 ec 08             	sub    $0x8,%esp
+80104051:	ff 33                	push   (%ebx)
+80104053:	89 c7                	mov    %eax,%edi
+80104055:	ff 73 04             	push   0x4(%ebx)
+80104058:	e8 d3 3f 00 00       	call   80108030 <copyuvm>
+8010405d:	83 c4 10             	add    $0x10,%esp
+80104060:	89 47 04             	mov    %eax,0x4(%edi)
+80104063:	85 c0                	test   %eax,%eax
+80104065:	0f 84 9a 00 00 00    	je     80104105 <fork+0xe5>
+  np->sz = curproc->sz;
+8010406b:	8b 03                	mov    (%ebx),%eax
+8010406d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80104070:	89 01                	mov    %eax,(%ecx)
+  *np->tf = *curproc->tf;
+80104072:	8b 79 18             	mov    0x18(%ecx),%edi
+  np->parent = curproc;
+80104075:	89 c8                	mov    %ecx,%eax
+80104077:	89 59 14             	mov    %ebx,0x14(%ecx)
+  *np->tf = *curproc->tf;
+8010407a:	b9 13 00 00 00       	mov    $0x13,%ecx
+8010407f:	8b 73 18             	mov    0x18(%ebx),%esi
+80104082:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+80104084:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80104086:	8b 40 18             	mov    0x18(%eax),%eax
+80104089:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    if(curproc->ofile[i])
+80104090:	8b 44 b3 28          	mov    0x28(%ebx,%esi,4),%eax
+80104094:	85 c0                	test   %eax,%eax
+80104096:	74 13                	je     801040ab <fork+0x8b>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80104098:	83 ec 0c             	sub    $0xc,%esp
+8010409b:	50                   	push   %eax
+8010409c:	e8 4f ce ff ff       	call   80100ef0 <filedup>
+801040a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801040a4:	83 c4 10             	add    $0x10,%esp
+801040a7:	89 44 b2 28          	mov    %eax,0x28(%edx,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+801040ab:	83 c6 01             	add    $0x1,%esi
+801040ae:	83 fe 10             	cmp    $0x10,%esi
+801040b1:	75 dd                	jne    80104090 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+801040b3:	83 ec 0c             	sub    $0xc,%esp
+801040b6:	ff 73 68             	push   0x68(%ebx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801040b9:	83 c3 6c             	add    $0x6c,%ebx
+  np->cwd = idup(curproc->cwd);
+801040bc:	e8 df d6 ff ff       	call   801017a0 <idup>
+801040c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801040c4:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+801040c7:	89 47 68             	mov    %eax,0x68(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801040ca:	8d 47 6c             	lea    0x6c(%edi),%eax
+801040cd:	6a 10                	push   $0x10
+801040cf:	53                   	push   %ebx
+801040d0:	50                   	push   %eax
+801040d1:	e8 8a 16 00 00       	call   80105760 <safestrcpy>
+  pid = np->pid;
+801040d6:	8b 5f 10             	mov    0x10(%edi),%ebx
+  acquire(&ptable.lock);
+801040d9:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+801040e0:	e8 eb 13 00 00       	call   801054d0 <acquire>
+  setrunnable(np);
+801040e5:	89 f8                	mov    %edi,%eax
+801040e7:	e8 74 fb ff ff       	call   80103c60 <setrunnable>
+  release(&ptable.lock);
+801040ec:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+801040f3:	e8 78 13 00 00       	call   80105470 <release>
+  return pid;
+801040f8:	83 c4 10             	add    $0x10,%esp
+}
+801040fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801040fe:	89 d8                	mov    %ebx,%eax
+80104100:	5b                   	pop    %ebx
+80104101:	5e                   	pop    %esi
+80104102:	5f                   	pop    %edi
+80104103:	5d                   	pop    %ebp
+80104104:	c3                   	ret
+    kfree(np->kstack);
+80104105:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104108:	83 ec 0c             	sub    $0xc,%esp
+8010410b:	ff 77 08             	push   0x8(%edi)
+8010410e:	e8 0d e4 ff ff       	call   80102520 <kfree>
+    np->kstack = 0;
+80104113:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    return -1;
+8010411a:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+8010411d:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+    return -1;
+80104124:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80104129:	eb d0                	jmp    801040fb <fork+0xdb>
+8010412b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010412f:	90                   	nop
+
+80104130 <demote>:
+{
+80104130:	55                   	push   %ebp
+80104131:	89 e5                	mov    %esp,%ebp
+80104133:	8b 45 08             	mov    0x8(%ebp),%eax
+  p->localtime = 0;
+80104136:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%eax)
+8010413d:	00 00 00 
+  if (p->pid <= 2) return;
+80104140:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+80104144:	7e 0e                	jle    80104154 <demote+0x24>
+  if (p->queue == L2) {
+80104146:	8b 50 7c             	mov    0x7c(%eax),%edx
+80104149:	83 fa 02             	cmp    $0x2,%edx
+8010414c:	74 12                	je     80104160 <demote+0x30>
+  p->queue++;
+8010414e:	83 c2 01             	add    $0x1,%edx
+80104151:	89 50 7c             	mov    %edx,0x7c(%eax)
+}
+80104154:	5d                   	pop    %ebp
+80104155:	c3                   	ret
+80104156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010415d:	8d 76 00             	lea    0x0(%esi),%esi
+    p->priority--;
+80104160:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+80104166:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80104169:	31 c9                	xor    %ecx,%ecx
+8010416b:	85 d2                	test   %edx,%edx
+8010416d:	0f 48 d1             	cmovs  %ecx,%edx
+80104170:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+}
+80104176:	5d                   	pop    %ebp
+80104177:	c3                   	ret
+80104178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010417f:	90                   	nop
+
+80104180 <timeup>:
+{
+80104180:	55                   	push   %ebp
+80104181:	89 e5                	mov    %esp,%ebp
+80104183:	57                   	push   %edi
+80104184:	56                   	push   %esi
+80104185:	53                   	push   %ebx
+80104186:	83 ec 0c             	sub    $0xc,%esp
+  pushcli();
+80104189:	e8 f2 11 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+8010418e:	e8 2d f9 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104193:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80104199:	e8 32 12 00 00       	call   801053d0 <popcli>
+  struct cpu *c = mycpu();
+8010419e:	e8 1d f9 ff ff       	call   80103ac0 <mycpu>
+  if (!p)
+801041a3:	85 f6                	test   %esi,%esi
+801041a5:	0f 84 ad 00 00 00    	je     80104258 <timeup+0xd8>
+801041ab:	89 c7                	mov    %eax,%edi
+  if (c == &cpus[0] && !specialproc && c->nboost == nboost &&
+801041ad:	3d a0 27 11 80       	cmp    $0x801127a0,%eax
+801041b2:	74 64                	je     80104218 <timeup+0x98>
+  acquire(&ptable.lock);
+801041b4:	83 ec 0c             	sub    $0xc,%esp
+801041b7:	68 20 2f 11 80       	push   $0x80112f20
+801041bc:	e8 0f 13 00 00       	call   801054d0 <acquire>
+  yield = charge(p) || c->nboost != nboost ||
+801041c1:	89 f0                	mov    %esi,%eax
+801041c3:	e8 e8 fb ff ff       	call   80103db0 <charge>
+801041c8:	83 c4 10             	add    $0x10,%esp
+801041cb:	89 c3                	mov    %eax,%ebx
+801041cd:	85 c0                	test   %eax,%eax
+801041cf:	74 1f                	je     801041f0 <timeup+0x70>
+801041d1:	bb 01 00 00 00       	mov    $0x1,%ebx
+  release(&ptable.lock);
+801041d6:	83 ec 0c             	sub    $0xc,%esp
+801041d9:	68 20 2f 11 80       	push   $0x80112f20
+801041de:	e8 8d 12 00 00       	call   80105470 <release>
+  return yield;
+801041e3:	83 c4 10             	add    $0x10,%esp
+}
+801041e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801041e9:	89 d8                	mov    %ebx,%eax
+801041eb:	5b                   	pop    %ebx
+801041ec:	5e                   	pop    %esi
+801041ed:	5f                   	pop    %edi
+801041ee:	5d                   	pop    %ebp
+801041ef:	c3                   	ret
+  yield = charge(p) || c->nboost != nboost ||
+801041f0:	a1 54 55 11 80       	mov    0x80115554,%eax
+801041f5:	39 87 ec 00 00 00    	cmp    %eax,0xec(%edi)
+801041fb:	75 d4                	jne    801041d1 <timeup+0x51>
+          (specialproc && p != specialproc);
+801041fd:	a1 5c 55 11 80       	mov    0x8011555c,%eax
+80104202:	85 c0                	test   %eax,%eax
+80104204:	74 04                	je     8010420a <timeup+0x8a>
+80104206:	39 f0                	cmp    %esi,%eax
+80104208:	75 c7                	jne    801041d1 <timeup+0x51>
+    armtimer(c, p);
+8010420a:	89 f2                	mov    %esi,%edx
+8010420c:	89 f8                	mov    %edi,%eax
+8010420e:	e8 cd f7 ff ff       	call   801039e0 <armtimer>
+80104213:	eb c1                	jmp    801041d6 <timeup+0x56>
+80104215:	8d 76 00             	lea    0x0(%esi),%esi
+  if (c == &cpus[0] && !specialproc && c->nboost == nboost &&
+80104218:	a1 5c 55 11 80       	mov    0x8011555c,%eax
+8010421d:	85 c0                	test   %eax,%eax
+8010421f:	75 93                	jne    801041b4 <timeup+0x34>
+80104221:	a1 54 55 11 80       	mov    0x80115554,%eax
+80104226:	39 05 8c 28 11 80    	cmp    %eax,0x8011288c
+8010422c:	75 86                	jne    801041b4 <timeup+0x34>
+      p->localtime + (ticks - c->start) < QUANTUM(p->queue))
+8010422e:	8b 56 7c             	mov    0x7c(%esi),%edx
+80104231:	a1 80 55 11 80       	mov    0x80115580,%eax
+    return 0;
+80104236:	31 db                	xor    %ebx,%ebx
+      p->localtime + (ticks - c->start) < QUANTUM(p->queue))
+80104238:	2b 05 88 28 11 80    	sub    0x80112888,%eax
+8010423e:	03 86 84 00 00 00    	add    0x84(%esi),%eax
+80104244:	8d 54 12 04          	lea    0x4(%edx,%edx,1),%edx
+  if (c == &cpus[0] && !specialproc && c->nboost == nboost &&
+80104248:	39 d0                	cmp    %edx,%eax
+8010424a:	0f 83 64 ff ff ff    	jae    801041b4 <timeup+0x34>
+80104250:	eb 94                	jmp    801041e6 <timeup+0x66>
+80104252:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+}
+80104258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+8010425b:	31 db                	xor    %ebx,%ebx
+}
+8010425d:	89 d8                	mov    %ebx,%eax
+8010425f:	5b                   	pop    %ebx
+80104260:	5e                   	pop    %esi
+80104261:	5f                   	pop    %edi
+80104262:	5d                   	pop    %ebp
+80104263:	c3                   	ret
+80104264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010426b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010426f:	90                   	nop
+
+80104270 <boost>:
+{
+80104270:	55                   	push   %ebp
+80104271:	89 e5                	mov    %esp,%ebp
+80104273:	56                   	push   %esi
+80104274:	53                   	push   %ebx
+  acquire(&ptable.lock);
+80104275:	83 ec 0c             	sub    $0xc,%esp
+80104278:	68 20 2f 11 80       	push   $0x80112f20
+8010427d:	e8 4e 12 00 00       	call   801054d0 <acquire>
+  nboost++;
+80104282:	83 05 54 55 11 80 01 	addl   $0x1,0x80115554
+  for (c = cpus; c < cpus+ncpu; c++) {
+80104289:	83 c4 10             	add    $0x10,%esp
+8010428c:	69 35 84 27 11 80 f0 	imul   $0xf0,0x80112784,%esi
+80104293:	00 00 00 
+80104296:	81 c6 a0 27 11 80    	add    $0x801127a0,%esi
+8010429c:	81 fe a0 27 11 80    	cmp    $0x801127a0,%esi
+801042a2:	76 6c                	jbe    80104310 <boost+0xa0>
+801042a4:	ba 80 28 11 80       	mov    $0x80112880,%edx
+801042a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for (q = &c->queues[L1]; q < &c->queues[NQUEUE]; q++) {
+801042b0:	8d 42 d8             	lea    -0x28(%edx),%eax
+801042b3:	eb 2c                	jmp    801042e1 <boost+0x71>
+801042b5:	8d 76 00             	lea    0x0(%esi),%esi
+        l0->back->qnext = q->front;
+801042b8:	89 8b 88 00 00 00    	mov    %ecx,0x88(%ebx)
+        q->front->qprev = l0->back;
+801042be:	8b 5a d4             	mov    -0x2c(%edx),%ebx
+801042c1:	89 99 8c 00 00 00    	mov    %ebx,0x8c(%ecx)
+      l0->back = q->back;
+801042c7:	8b 48 04             	mov    0x4(%eax),%ecx
+801042ca:	89 4a d4             	mov    %ecx,-0x2c(%edx)
+      q->front = q->back = 0;
+801042cd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+801042d4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    for (q = &c->queues[L1]; q < &c->queues[NQUEUE]; q++) {
+801042da:	83 c0 08             	add    $0x8,%eax
+801042dd:	39 d0                	cmp    %edx,%eax
+801042df:	74 17                	je     801042f8 <boost+0x88>
+      if (!q->front)
+801042e1:	8b 08                	mov    (%eax),%ecx
+801042e3:	85 c9                	test   %ecx,%ecx
+801042e5:	74 f3                	je     801042da <boost+0x6a>
+      if (l0->back) {
+801042e7:	8b 5a d4             	mov    -0x2c(%edx),%ebx
+801042ea:	85 db                	test   %ebx,%ebx
+801042ec:	75 ca                	jne    801042b8 <boost+0x48>
+        l0->front = q->front;
+801042ee:	89 4a d0             	mov    %ecx,-0x30(%edx)
+801042f1:	eb d4                	jmp    801042c7 <boost+0x57>
+801042f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801042f7:	90                   	nop
+  for (c = cpus; c < cpus+ncpu; c++) {
+801042f8:	8d 82 f0 00 00 00    	lea    0xf0(%edx),%eax
+801042fe:	83 c2 10             	add    $0x10,%edx
+80104301:	39 f2                	cmp    %esi,%edx
+80104303:	73 0b                	jae    80104310 <boost+0xa0>
+80104305:	89 c2                	mov    %eax,%edx
+80104307:	eb a7                	jmp    801042b0 <boost+0x40>
+80104309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if ((p = specialproc) != 0) {
+80104310:	8b 1d 5c 55 11 80    	mov    0x8011555c,%ebx
+80104316:	85 db                	test   %ebx,%ebx
+80104318:	74 1d                	je     80104337 <boost+0xc7>
+    specialproc = 0;
+8010431a:	c7 05 5c 55 11 80 00 	movl   $0x0,0x8011555c
+80104321:	00 00 00 
+    if (p->state == RUNNABLE)
+80104324:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+80104328:	74 24                	je     8010434e <boost+0xde>
+      headproc = p;
+8010432a:	89 1d 58 55 11 80    	mov    %ebx,0x80115558
+    kick(0);
+80104330:	31 c0                	xor    %eax,%eax
+80104332:	e8 79 f8 ff ff       	call   80103bb0 <kick>
+  release(&ptable.lock);
+80104337:	83 ec 0c             	sub    $0xc,%esp
+8010433a:	68 20 2f 11 80       	push   $0x80112f20
+8010433f:	e8 2c 11 00 00       	call   80105470 <release>
+}
+80104344:	83 c4 10             	add    $0x10,%esp
+80104347:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010434a:	5b                   	pop    %ebx
+8010434b:	5e                   	pop    %esi
+8010434c:	5d                   	pop    %ebp
+8010434d:	c3                   	ret
+      enqueue(pickcpu(), L0, p, 1);
+8010434e:	e8 ed f7 ff ff       	call   80103b40 <pickcpu>
+    p->qprev = 0;
+80104353:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+8010435a:	00 00 00 
+    p->qnext = q->front;
+8010435d:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+80104363:	89 93 88 00 00 00    	mov    %edx,0x88(%ebx)
+    if (q->front)
+80104369:	85 d2                	test   %edx,%edx
+8010436b:	74 23                	je     80104390 <boost+0x120>
+      q->front->qprev = p;
+8010436d:	89 9a 8c 00 00 00    	mov    %ebx,0x8c(%edx)
+    q->front = p;
+80104373:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+  p->cpu = c;
+80104379:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+  c->nrun++;
+8010437f:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80104385:	83 c2 01             	add    $0x1,%edx
+80104388:	89 90 e0 00 00 00    	mov    %edx,0xe0(%eax)
+}
+8010438e:	eb a0                	jmp    80104330 <boost+0xc0>
+      q->back = p;
+80104390:	89 98 b4 00 00 00    	mov    %ebx,0xb4(%eax)
+80104396:	eb db                	jmp    80104373 <boost+0x103>
+80104398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010439f:	90                   	nop
+
+801043a0 <scheduler>:
+{
+801043a0:	55                   	push   %ebp
+801043a1:	89 e5                	mov    %esp,%ebp
+801043a3:	57                   	push   %edi
+801043a4:	56                   	push   %esi
+801043a5:	53                   	push   %ebx
+801043a6:	83 ec 1c             	sub    $0x1c,%esp
+  struct cpu *c = mycpu();
+801043a9:	e8 12 f7 ff ff       	call   80103ac0 <mycpu>
+  c->proc = 0;
+801043ae:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801043b5:	00 00 00 
+  struct cpu *c = mycpu();
+801043b8:	89 c3                	mov    %eax,%ebx
+  c->proc = 0;
+801043ba:	8d 80 b0 00 00 00    	lea    0xb0(%eax),%eax
+801043c0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801043c3:	8d 83 e0 00 00 00    	lea    0xe0(%ebx),%eax
+801043c9:	8d 73 04             	lea    0x4(%ebx),%esi
+801043cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801043cf:	90                   	nop
+  asm volatile("sti");
+801043d0:	fb                   	sti
+  __sync_synchronize();
+801043d1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if ((p = specialproc) != 0)
+801043d6:	a1 5c 55 11 80       	mov    0x8011555c,%eax
+801043db:	85 c0                	test   %eax,%eax
+801043dd:	74 51                	je     80104430 <scheduler+0x90>
+    if (!haswork()) {
+801043df:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+801043e3:	74 7e                	je     80104463 <scheduler+0xc3>
+  asm volatile("cli");
+801043e5:	fa                   	cli
+      c->idle = 1;
+801043e6:	c7 83 e4 00 00 00 01 	movl   $0x1,0xe4(%ebx)
+801043ed:	00 00 00 
+      if (c != &cpus[0])
+801043f0:	81 fb a0 27 11 80    	cmp    $0x801127a0,%ebx
+801043f6:	74 0d                	je     80104405 <scheduler+0x65>
+        lapictimer(0);
+801043f8:	83 ec 0c             	sub    $0xc,%esp
+801043fb:	6a 00                	push   $0x0
+801043fd:	e8 9e e5 ff ff       	call   801029a0 <lapictimer>
+80104402:	83 c4 10             	add    $0x10,%esp
+  __sync_synchronize();
+80104405:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if ((p = specialproc) != 0)
+8010440a:	a1 5c 55 11 80       	mov    0x8011555c,%eax
+8010440f:	85 c0                	test   %eax,%eax
+80104411:	0f 84 89 00 00 00    	je     801044a0 <scheduler+0x100>
+      if (!haswork())
+80104417:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010441b:	74 02                	je     8010441f <scheduler+0x7f>
+  asm volatile("sti; hlt");
+8010441d:	fb                   	sti
+8010441e:	f4                   	hlt
+      c->idle = 0;
+8010441f:	c7 83 e4 00 00 00 00 	movl   $0x0,0xe4(%ebx)
+80104426:	00 00 00 
+      continue;
+80104429:	eb a5                	jmp    801043d0 <scheduler+0x30>
+8010442b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010442f:	90                   	nop
+  for (c = cpus; c < cpus+ncpu; c++)
+80104430:	69 0d 84 27 11 80 f0 	imul   $0xf0,0x80112784,%ecx
+80104437:	00 00 00 
+8010443a:	b8 a0 27 11 80       	mov    $0x801127a0,%eax
+8010443f:	81 c1 a0 27 11 80    	add    $0x801127a0,%ecx
+80104445:	39 c1                	cmp    %eax,%ecx
+80104447:	77 10                	ja     80104459 <scheduler+0xb9>
+80104449:	eb 9a                	jmp    801043e5 <scheduler+0x45>
+8010444b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010444f:	90                   	nop
+80104450:	05 f0 00 00 00       	add    $0xf0,%eax
+80104455:	39 c8                	cmp    %ecx,%eax
+80104457:	73 8c                	jae    801043e5 <scheduler+0x45>
+    if (c->nrun > 0)
+80104459:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+8010445f:	85 d2                	test   %edx,%edx
+80104461:	7e ed                	jle    80104450 <scheduler+0xb0>
+    acquire(&ptable.lock);
+80104463:	83 ec 0c             	sub    $0xc,%esp
+80104466:	68 20 2f 11 80       	push   $0x80112f20
+8010446b:	e8 60 10 00 00       	call   801054d0 <acquire>
+    if (specialproc)
+80104470:	8b 3d 5c 55 11 80    	mov    0x8011555c,%edi
+80104476:	83 c4 10             	add    $0x10,%esp
+80104479:	85 ff                	test   %edi,%edi
+8010447b:	74 63                	je     801044e0 <scheduler+0x140>
+      p = specialproc->state == RUNNABLE ? specialproc : 0;
+8010447d:	83 7f 0c 03          	cmpl   $0x3,0xc(%edi)
+80104481:	0f 84 29 01 00 00    	je     801045b0 <scheduler+0x210>
+    release(&ptable.lock);
+80104487:	83 ec 0c             	sub    $0xc,%esp
+8010448a:	68 20 2f 11 80       	push   $0x80112f20
+8010448f:	e8 dc 0f 00 00       	call   80105470 <release>
+80104494:	83 c4 10             	add    $0x10,%esp
+80104497:	e9 34 ff ff ff       	jmp    801043d0 <scheduler+0x30>
+8010449c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for (c = cpus; c < cpus+ncpu; c++)
+801044a0:	69 0d 84 27 11 80 f0 	imul   $0xf0,0x80112784,%ecx
+801044a7:	00 00 00 
+801044aa:	b8 a0 27 11 80       	mov    $0x801127a0,%eax
+801044af:	81 c1 a0 27 11 80    	add    $0x801127a0,%ecx
+801044b5:	39 c1                	cmp    %eax,%ecx
+801044b7:	77 14                	ja     801044cd <scheduler+0x12d>
+801044b9:	e9 5f ff ff ff       	jmp    8010441d <scheduler+0x7d>
+801044be:	66 90                	xchg   %ax,%ax
+801044c0:	05 f0 00 00 00       	add    $0xf0,%eax
+801044c5:	39 c8                	cmp    %ecx,%eax
+801044c7:	0f 83 50 ff ff ff    	jae    8010441d <scheduler+0x7d>
+    if (c->nrun > 0)
+801044cd:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+801044d3:	85 d2                	test   %edx,%edx
+801044d5:	7e e9                	jle    801044c0 <scheduler+0x120>
+801044d7:	e9 43 ff ff ff       	jmp    8010441f <scheduler+0x7f>
+801044dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if (c->nrun > 0)
+801044e0:	8b 83 e0 00 00 00    	mov    0xe0(%ebx),%eax
+801044e6:	85 c0                	test   %eax,%eax
+801044e8:	0f 8f 47 01 00 00    	jg     80104635 <scheduler+0x295>
+  for (v = cpus; v < cpus+ncpu; v++)
+801044ee:	69 05 84 27 11 80 f0 	imul   $0xf0,0x80112784,%eax
+801044f5:	00 00 00 
+801044f8:	89 da                	mov    %ebx,%edx
+801044fa:	05 a0 27 11 80       	add    $0x801127a0,%eax
+801044ff:	89 c7                	mov    %eax,%edi
+80104501:	b8 a0 27 11 80       	mov    $0x801127a0,%eax
+80104506:	39 c7                	cmp    %eax,%edi
+80104508:	76 23                	jbe    8010452d <scheduler+0x18d>
+8010450a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010450d:	8d 76 00             	lea    0x0(%esi),%esi
+    if (v->nrun > busiest->nrun)
+80104510:	8b 88 e0 00 00 00    	mov    0xe0(%eax),%ecx
+80104516:	8b 9a e0 00 00 00    	mov    0xe0(%edx),%ebx
+8010451c:	39 cb                	cmp    %ecx,%ebx
+8010451e:	0f 4c d0             	cmovl  %eax,%edx
+  for (v = cpus; v < cpus+ncpu; v++)
+80104521:	05 f0 00 00 00       	add    $0xf0,%eax
+80104526:	39 f8                	cmp    %edi,%eax
+80104528:	72 e6                	jb     80104510 <scheduler+0x170>
+8010452a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  for (q = c->queues; q < &c->queues[NQUEUE]; q++) {
+8010452d:	8d 82 b0 00 00 00    	lea    0xb0(%edx),%eax
+80104533:	81 c2 e0 00 00 00    	add    $0xe0,%edx
+80104539:	eb 10                	jmp    8010454b <scheduler+0x1ab>
+8010453b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010453f:	90                   	nop
+80104540:	83 c0 08             	add    $0x8,%eax
+80104543:	39 c2                	cmp    %eax,%edx
+80104545:	0f 84 3c ff ff ff    	je     80104487 <scheduler+0xe7>
+    if ((p = q->front) != 0) {
+8010454b:	8b 38                	mov    (%eax),%edi
+8010454d:	85 ff                	test   %edi,%edi
+8010454f:	74 ef                	je     80104540 <scheduler+0x1a0>
+  if (p->qprev)
+80104551:	8b 97 8c 00 00 00    	mov    0x8c(%edi),%edx
+    p->qprev->qnext = p->qnext;
+80104557:	8b 8f 88 00 00 00    	mov    0x88(%edi),%ecx
+  if (p->qprev)
+8010455d:	85 d2                	test   %edx,%edx
+8010455f:	0f 84 25 01 00 00    	je     8010468a <scheduler+0x2ea>
+    p->qprev->qnext = p->qnext;
+80104565:	89 8a 88 00 00 00    	mov    %ecx,0x88(%edx)
+  if (p->qnext)
+8010456b:	8b 97 88 00 00 00    	mov    0x88(%edi),%edx
+    p->qnext->qprev = p->qprev;
+80104571:	8b 8f 8c 00 00 00    	mov    0x8c(%edi),%ecx
+  if (p->qnext)
+80104577:	85 d2                	test   %edx,%edx
+80104579:	0f 84 03 01 00 00    	je     80104682 <scheduler+0x2e2>
+    p->qnext->qprev = p->qprev;
+8010457f:	89 8a 8c 00 00 00    	mov    %ecx,0x8c(%edx)
+  p->qnext = p->qprev = 0;
+80104585:	c7 87 8c 00 00 00 00 	movl   $0x0,0x8c(%edi)
+8010458c:	00 00 00 
+  p->cpu->nrun--;
+8010458f:	8b 97 94 00 00 00    	mov    0x94(%edi),%edx
+  p->qnext = p->qprev = 0;
+80104595:	c7 87 88 00 00 00 00 	movl   $0x0,0x88(%edi)
+8010459c:	00 00 00 
+  p->cpu->nrun--;
+8010459f:	8b 82 e0 00 00 00    	mov    0xe0(%edx),%eax
+801045a5:	83 e8 01             	sub    $0x1,%eax
+801045a8:	89 82 e0 00 00 00    	mov    %eax,0xe0(%edx)
+    if (p) {
+801045ae:	66 90                	xchg   %ax,%ax
+      switchuvm(p);
+801045b0:	83 ec 0c             	sub    $0xc,%esp
+      c->proc = p;
+801045b3:	89 bb ac 00 00 00    	mov    %edi,0xac(%ebx)
+      switchuvm(p);
+801045b9:	57                   	push   %edi
+801045ba:	e8 51 35 00 00       	call   80107b10 <switchuvm>
+      p->state = RUNNING;
+801045bf:	c7 47 0c 04 00 00 00 	movl   $0x4,0xc(%edi)
+  if (p->nboost == nboost)
+801045c6:	a1 54 55 11 80       	mov    0x80115554,%eax
+801045cb:	83 c4 10             	add    $0x10,%esp
+801045ce:	39 87 90 00 00 00    	cmp    %eax,0x90(%edi)
+801045d4:	74 21                	je     801045f7 <scheduler+0x257>
+  p->nboost = nboost;
+801045d6:	89 87 90 00 00 00    	mov    %eax,0x90(%edi)
+  p->queue = L0;
+801045dc:	c7 47 7c 00 00 00 00 	movl   $0x0,0x7c(%edi)
+  p->localtime = 0;
+801045e3:	c7 87 84 00 00 00 00 	movl   $0x0,0x84(%edi)
+801045ea:	00 00 00 
+  p->priority = 3;
+801045ed:	c7 87 80 00 00 00 03 	movl   $0x3,0x80(%edi)
+801045f4:	00 00 00 
+      c->start = ticks;
+801045f7:	8b 15 80 55 11 80    	mov    0x80115580,%edx
+      c->nboost = nboost;
+801045fd:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+      armtimer(c, p);
+80104603:	89 d8                	mov    %ebx,%eax
+      c->start = ticks;
+80104605:	89 93 e8 00 00 00    	mov    %edx,0xe8(%ebx)
+      armtimer(c, p);
+8010460b:	89 fa                	mov    %edi,%edx
+8010460d:	e8 ce f3 ff ff       	call   801039e0 <armtimer>
+      swtch(&(c->scheduler), p->context);
+80104612:	83 ec 08             	sub    $0x8,%esp
+80104615:	ff 77 1c             	push   0x1c(%edi)
+80104618:	56                   	push   %esi
+80104619:	e8 9d 11 00 00       	call   801057bb <swtch>
+      switchkvm();
+8010461e:	e8 dd 34 00 00       	call   80107b00 <switchkvm>
+      c->proc = 0;
+80104623:	83 c4 10             	add    $0x10,%esp
+80104626:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+8010462d:	00 00 00 
+80104630:	e9 52 fe ff ff       	jmp    80104487 <scheduler+0xe7>
+  for (q = c->queues; q < &c->queues[NQUEUE]; q++) {
+80104635:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104638:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010463b:	eb 0e                	jmp    8010464b <scheduler+0x2ab>
+8010463d:	8d 76 00             	lea    0x0(%esi),%esi
+80104640:	83 c0 08             	add    $0x8,%eax
+80104643:	39 c2                	cmp    %eax,%edx
+80104645:	0f 84 3c fe ff ff    	je     80104487 <scheduler+0xe7>
+    if ((p = q->front) != 0) {
+8010464b:	8b 38                	mov    (%eax),%edi
+8010464d:	85 ff                	test   %edi,%edi
+8010464f:	74 ef                	je     80104640 <scheduler+0x2a0>
+  if (p->qprev)
+80104651:	8b 8f 8c 00 00 00    	mov    0x8c(%edi),%ecx
+    p->qprev->qnext = p->qnext;
+80104657:	8b 97 88 00 00 00    	mov    0x88(%edi),%edx
+  if (p->qprev)
+8010465d:	85 c9                	test   %ecx,%ecx
+8010465f:	74 30                	je     80104691 <scheduler+0x2f1>
+    p->qprev->qnext = p->qnext;
+80104661:	89 91 88 00 00 00    	mov    %edx,0x88(%ecx)
+  if (p->qnext)
+80104667:	8b 8f 88 00 00 00    	mov    0x88(%edi),%ecx
+    p->qnext->qprev = p->qprev;
+8010466d:	8b 97 8c 00 00 00    	mov    0x8c(%edi),%edx
+  if (p->qnext)
+80104673:	85 c9                	test   %ecx,%ecx
+80104675:	74 1e                	je     80104695 <scheduler+0x2f5>
+    p->qnext->qprev = p->qprev;
+80104677:	89 91 8c 00 00 00    	mov    %edx,0x8c(%ecx)
+8010467d:	e9 03 ff ff ff       	jmp    80104585 <scheduler+0x1e5>
+    q->back = p->qprev;
+80104682:	89 48 04             	mov    %ecx,0x4(%eax)
+80104685:	e9 fb fe ff ff       	jmp    80104585 <scheduler+0x1e5>
+    q->front = p->qnext;
+8010468a:	89 08                	mov    %ecx,(%eax)
+8010468c:	e9 da fe ff ff       	jmp    8010456b <scheduler+0x1cb>
+80104691:	89 10                	mov    %edx,(%eax)
+80104693:	eb d2                	jmp    80104667 <scheduler+0x2c7>
+    q->back = p->qprev;
+80104695:	89 50 04             	mov    %edx,0x4(%eax)
+  p->qnext = p->qprev = 0;
+80104698:	e9 e8 fe ff ff       	jmp    80104585 <scheduler+0x1e5>
+8010469d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801046a0 <sched>:
+{
+801046a0:	55                   	push   %ebp
+801046a1:	89 e5                	mov    %esp,%ebp
+801046a3:	56                   	push   %esi
+801046a4:	53                   	push   %ebx
+  pushcli();
+801046a5:	e8 d6 0c 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+801046aa:	e8 11 f4 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+801046af:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801046b5:	e8 16 0d 00 00       	call   801053d0 <popcli>
+  if(!holding(&ptable.lock))
+801046ba:	83 ec 0c             	sub    $0xc,%esp
+801046bd:	68 20 2f 11 80       	push   $0x80112f20
+801046c2:	e8 69 0d 00 00       	call   80105430 <holding>
+801046c7:	83 c4 10             	add    $0x10,%esp
+801046ca:	85 c0                	test   %eax,%eax
+801046cc:	74 4f                	je     8010471d <sched+0x7d>
+  if(mycpu()->ncli != 1)
+801046ce:	e8 ed f3 ff ff       	call   80103ac0 <mycpu>
+801046d3:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+801046da:	75 68                	jne    80104744 <sched+0xa4>
+  if(p->state == RUNNING)
+801046dc:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+801046e0:	74 55                	je     80104737 <sched+0x97>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801046e2:	9c                   	pushf
+801046e3:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801046e4:	f6 c4 02             	test   $0x2,%ah
+801046e7:	75 41                	jne    8010472a <sched+0x8a>
+  intena = mycpu()->intena;
+801046e9:	e8 d2 f3 ff ff       	call   80103ac0 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+801046ee:	83 c3 1c             	add    $0x1c,%ebx
+  intena = mycpu()->intena;
+801046f1:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+801046f7:	e8 c4 f3 ff ff       	call   80103ac0 <mycpu>
+801046fc:	83 ec 08             	sub    $0x8,%esp
+801046ff:	ff 70 04             	push   0x4(%eax)
+80104702:	53                   	push   %ebx
+80104703:	e8 b3 10 00 00       	call   801057bb <swtch>
+  mycpu()->intena = intena;
+80104708:	e8 b3 f3 ff ff       	call   80103ac0 <mycpu>
+}
+8010470d:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80104710:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80104716:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104719:	5b                   	pop    %ebx
+8010471a:	5e                   	pop    %esi
+8010471b:	5d                   	pop    %ebp
+8010471c:	c3                   	ret
+    panic("sched ptable.lock");
+8010471d:	83 ec 0c             	sub    $0xc,%esp
+80104720:	68 9b 88 10 80       	push   $0x8010889b
+80104725:	e8 56 bc ff ff       	call   80100380 <panic>
+    panic("sched interruptible");
+8010472a:	83 ec 0c             	sub    $0xc,%esp
+8010472d:	68 c7 88 10 80       	push   $0x801088c7
+80104732:	e8 49 bc ff ff       	call   80100380 <panic>
+    panic("sched running");
+80104737:	83 ec 0c             	sub    $0xc,%esp
+8010473a:	68 b9 88 10 80       	push   $0x801088b9
+8010473f:	e8 3c bc ff ff       	call   80100380 <panic>
+    panic("sched locks");
+80104744:	83 ec 0c             	sub    $0xc,%esp
+80104747:	68 ad 88 10 80       	push   $0x801088ad
+8010474c:	e8 2f bc ff ff       	call   80100380 <panic>
+80104751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010475f:	90                   	nop
+
+80104760 <exit>:
+{
+80104760:	55                   	push   %ebp
+80104761:	89 e5                	mov    %esp,%ebp
+80104763:	57                   	push   %edi
+80104764:	56                   	push   %esi
+80104765:	53                   	push   %ebx
+80104766:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80104769:	e8 12 f7 ff ff       	call   80103e80 <myproc>
+  if(curproc == initproc)
+8010476e:	39 05 60 55 11 80    	cmp    %eax,0x80115560
+80104774:	0f 84 27 01 00 00    	je     801048a1 <exit+0x141>
+8010477a:	89 c2                	mov    %eax,%edx
+8010477c:	8d 58 28             	lea    0x28(%eax),%ebx
+8010477f:	8d 70 68             	lea    0x68(%eax),%esi
+80104782:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+80104788:	8b 03                	mov    (%ebx),%eax
+8010478a:	85 c0                	test   %eax,%eax
+8010478c:	74 18                	je     801047a6 <exit+0x46>
+      fileclose(curproc->ofile[fd]);
+8010478e:	83 ec 0c             	sub    $0xc,%esp
+80104791:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80104794:	50                   	push   %eax
+80104795:	e8 a6 c7 ff ff       	call   80100f40 <fileclose>
+      curproc->ofile[fd] = 0;
+8010479a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+801047a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801047a3:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+801047a6:	83 c3 04             	add    $0x4,%ebx
+801047a9:	39 f3                	cmp    %esi,%ebx
+801047ab:	75 db                	jne    80104788 <exit+0x28>
+801047ad:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+static void
+wakeup1(void *chan)
+{
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+801047b0:	bb 54 2f 11 80       	mov    $0x80112f54,%ebx
+  begin_op();
+801047b5:	e8 a6 e6 ff ff       	call   80102e60 <begin_op>
+  iput(curproc->cwd);
+801047ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801047bd:	83 ec 0c             	sub    $0xc,%esp
+801047c0:	ff 72 68             	push   0x68(%edx)
+801047c3:	e8 38 d1 ff ff       	call   80101900 <iput>
+  end_op();
+801047c8:	e8 03 e7 ff ff       	call   80102ed0 <end_op>
+  curproc->cwd = 0;
+801047cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801047d0:	c7 42 68 00 00 00 00 	movl   $0x0,0x68(%edx)
+  acquire(&ptable.lock);
+801047d7:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+801047de:	e8 ed 0c 00 00       	call   801054d0 <acquire>
+  wakeup1(curproc->parent);
+801047e3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801047e6:	83 c4 10             	add    $0x10,%esp
+801047e9:	8b 72 14             	mov    0x14(%edx),%esi
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+801047ec:	eb 10                	jmp    801047fe <exit+0x9e>
+801047ee:	66 90                	xchg   %ax,%ax
+801047f0:	81 c3 98 00 00 00    	add    $0x98,%ebx
+801047f6:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+801047fc:	74 26                	je     80104824 <exit+0xc4>
+    if(p->state == SLEEPING && p->chan == chan) {
+801047fe:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80104802:	75 ec                	jne    801047f0 <exit+0x90>
+80104804:	3b 73 20             	cmp    0x20(%ebx),%esi
+80104807:	75 e7                	jne    801047f0 <exit+0x90>
+      setrunnable(p);
+80104809:	89 d8                	mov    %ebx,%eax
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+8010480b:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80104811:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      setrunnable(p);
+80104814:	e8 47 f4 ff ff       	call   80103c60 <setrunnable>
+80104819:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+8010481c:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+80104822:	75 da                	jne    801047fe <exit+0x9e>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104824:	be 54 2f 11 80       	mov    $0x80112f54,%esi
+80104829:	eb 13                	jmp    8010483e <exit+0xde>
+8010482b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010482f:	90                   	nop
+80104830:	81 c6 98 00 00 00    	add    $0x98,%esi
+80104836:	81 fe 54 55 11 80    	cmp    $0x80115554,%esi
+8010483c:	74 4a                	je     80104888 <exit+0x128>
+    if(p->parent == curproc){
+8010483e:	39 56 14             	cmp    %edx,0x14(%esi)
+80104841:	75 ed                	jne    80104830 <exit+0xd0>
+      p->parent = initproc;
+80104843:	8b 3d 60 55 11 80    	mov    0x80115560,%edi
+      if(p->state == ZOMBIE)
+80104849:	83 7e 0c 05          	cmpl   $0x5,0xc(%esi)
+      p->parent = initproc;
+8010484d:	89 7e 14             	mov    %edi,0x14(%esi)
+      if(p->state == ZOMBIE)
+80104850:	75 de                	jne    80104830 <exit+0xd0>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104852:	bb 54 2f 11 80       	mov    $0x80112f54,%ebx
+80104857:	eb 15                	jmp    8010486e <exit+0x10e>
+80104859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104860:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80104866:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+8010486c:	74 c2                	je     80104830 <exit+0xd0>
+    if(p->state == SLEEPING && p->chan == chan) {
+8010486e:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80104872:	75 ec                	jne    80104860 <exit+0x100>
+80104874:	3b 7b 20             	cmp    0x20(%ebx),%edi
+80104877:	75 e7                	jne    80104860 <exit+0x100>
+      setrunnable(p);
+80104879:	89 d8                	mov    %ebx,%eax
+8010487b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010487e:	e8 dd f3 ff ff       	call   80103c60 <setrunnable>
+80104883:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80104886:	eb d8                	jmp    80104860 <exit+0x100>
+  curproc->state = ZOMBIE;
+80104888:	c7 42 0c 05 00 00 00 	movl   $0x5,0xc(%edx)
+  sched();
+8010488f:	e8 0c fe ff ff       	call   801046a0 <sched>
+  panic("zombie exit");
+80104894:	83 ec 0c             	sub    $0xc,%esp
+80104897:	68 e8 88 10 80       	push   $0x801088e8
+8010489c:	e8 df ba ff ff       	call   80100380 <panic>
+    panic("init exiting");
+801048a1:	83 ec 0c             	sub    $0xc,%esp
+801048a4:	68 db 88 10 80       	push   $0x801088db
+801048a9:	e8 d2 ba ff ff       	call   80100380 <panic>
+801048ae:	66 90                	xchg   %ax,%ax
+
+801048b0 <wait>:
+{
+801048b0:	55                   	push   %ebp
+801048b1:	89 e5                	mov    %esp,%ebp
+801048b3:	56                   	push   %esi
+801048b4:	53                   	push   %ebx
+  pushcli();
+801048b5:	e8 c6 0a 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+801048ba:	e8 01 f2 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+801048bf:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+801048c5:	e8 06 0b 00 00       	call   801053d0 <popcli>
+  acquire(&ptable.lock);
+801048ca:	83 ec 0c             	sub    $0xc,%esp
+801048cd:	68 20 2f 11 80       	push   $0x80112f20
+801048d2:	e8 f9 0b 00 00       	call   801054d0 <acquire>
+801048d7:	83 c4 10             	add    $0x10,%esp
+    havekids = 0;
+801048da:	31 c0                	xor    %eax,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801048dc:	bb 54 2f 11 80       	mov    $0x80112f54,%ebx
+801048e1:	eb 13                	jmp    801048f6 <wait+0x46>
+801048e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801048e7:	90                   	nop
+801048e8:	81 c3 98 00 00 00    	add    $0x98,%ebx
+801048ee:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+801048f4:	74 1e                	je     80104914 <wait+0x64>
+      if(p->parent != curproc)
+801048f6:	39 73 14             	cmp    %esi,0x14(%ebx)
+801048f9:	75 ed                	jne    801048e8 <wait+0x38>
+      if(p->state == ZOMBIE){
+801048fb:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+801048ff:	74 6f                	je     80104970 <wait+0xc0>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104901:	81 c3 98 00 00 00    	add    $0x98,%ebx
+      havekids = 1;
+80104907:	b8 01 00 00 00       	mov    $0x1,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+8010490c:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+80104912:	75 e2                	jne    801048f6 <wait+0x46>
+    if(!havekids || curproc->killed){
+80104914:	85 c0                	test   %eax,%eax
+80104916:	0f 84 aa 00 00 00    	je     801049c6 <wait+0x116>
+8010491c:	8b 46 24             	mov    0x24(%esi),%eax
+8010491f:	85 c0                	test   %eax,%eax
+80104921:	0f 85 9f 00 00 00    	jne    801049c6 <wait+0x116>
+  pushcli();
+80104927:	e8 54 0a 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+8010492c:	e8 8f f1 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104931:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104937:	e8 94 0a 00 00       	call   801053d0 <popcli>
+  if(p == 0)
+8010493c:	85 db                	test   %ebx,%ebx
+8010493e:	0f 84 99 00 00 00    	je     801049dd <wait+0x12d>
+  charge(p);
+80104944:	89 d8                	mov    %ebx,%eax
+80104946:	e8 65 f4 ff ff       	call   80103db0 <charge>
+  p->chan = chan;
+8010494b:	89 73 20             	mov    %esi,0x20(%ebx)
+  p->state = SLEEPING;
+8010494e:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104955:	e8 46 fd ff ff       	call   801046a0 <sched>
+  p->chan = 0;
+8010495a:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+}
+80104961:	e9 74 ff ff ff       	jmp    801048da <wait+0x2a>
+80104966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010496d:	8d 76 00             	lea    0x0(%esi),%esi
+        kfree(p->kstack);
+80104970:	83 ec 0c             	sub    $0xc,%esp
+        pid = p->pid;
+80104973:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+80104976:	ff 73 08             	push   0x8(%ebx)
+80104979:	e8 a2 db ff ff       	call   80102520 <kfree>
+        p->kstack = 0;
+8010497e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        freevm(p->pgdir);
+80104985:	5a                   	pop    %edx
+80104986:	ff 73 04             	push   0x4(%ebx)
+80104989:	e8 32 35 00 00       	call   80107ec0 <freevm>
+        p->pid = 0;
+8010498e:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+        p->parent = 0;
+80104995:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+        p->name[0] = 0;
+8010499c:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+        p->killed = 0;
+801049a0:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+        p->state = UNUSED;
+801049a7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        release(&ptable.lock);
+801049ae:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+801049b5:	e8 b6 0a 00 00       	call   80105470 <release>
+        return pid;
+801049ba:	83 c4 10             	add    $0x10,%esp
+}
+801049bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801049c0:	89 f0                	mov    %esi,%eax
+801049c2:	5b                   	pop    %ebx
+801049c3:	5e                   	pop    %esi
+801049c4:	5d                   	pop    %ebp
+801049c5:	c3                   	ret
+      release(&ptable.lock);
+801049c6:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801049c9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+801049ce:	68 20 2f 11 80       	push   $0x80112f20
+801049d3:	e8 98 0a 00 00       	call   80105470 <release>
+      return -1;
+801049d8:	83 c4 10             	add    $0x10,%esp
+801049db:	eb e0                	jmp    801049bd <wait+0x10d>
+    panic("sleep");
+801049dd:	83 ec 0c             	sub    $0xc,%esp
+801049e0:	68 f4 88 10 80       	push   $0x801088f4
+801049e5:	e8 96 b9 ff ff       	call   80100380 <panic>
+801049ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801049f0 <__yield>:
+{
+801049f0:	55                   	push   %ebp
+801049f1:	89 e5                	mov    %esp,%ebp
+801049f3:	53                   	push   %ebx
+801049f4:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+801049f7:	68 20 2f 11 80       	push   $0x80112f20
+801049fc:	e8 cf 0a 00 00       	call   801054d0 <acquire>
+  pushcli();
+80104a01:	e8 7a 09 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104a06:	e8 b5 f0 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104a0b:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104a11:	e8 ba 09 00 00       	call   801053d0 <popcli>
+  charge(p);
+80104a16:	89 d8                	mov    %ebx,%eax
+80104a18:	e8 93 f3 ff ff       	call   80103db0 <charge>
+  setrunnable(p);
+80104a1d:	89 d8                	mov    %ebx,%eax
+80104a1f:	e8 3c f2 ff ff       	call   80103c60 <setrunnable>
+  sched();
+80104a24:	e8 77 fc ff ff       	call   801046a0 <sched>
+  release(&ptable.lock);
+80104a29:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+80104a30:	e8 3b 0a 00 00       	call   80105470 <release>
+}
+80104a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a38:	83 c4 10             	add    $0x10,%esp
+80104a3b:	c9                   	leave
+80104a3c:	c3                   	ret
+80104a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104a40 <yield>:
+{
+80104a40:	55                   	push   %ebp
+80104a41:	89 e5                	mov    %esp,%ebp
+80104a43:	53                   	push   %ebx
+80104a44:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+80104a47:	68 20 2f 11 80       	push   $0x80112f20
+80104a4c:	e8 7f 0a 00 00       	call   801054d0 <acquire>
+  pushcli();
+80104a51:	e8 2a 09 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104a56:	e8 65 f0 ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104a5b:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104a61:	e8 6a 09 00 00       	call   801053d0 <popcli>
+  charge(p);
+80104a66:	89 d8                	mov    %ebx,%eax
+80104a68:	e8 43 f3 ff ff       	call   80103db0 <charge>
+  if (p->nboost == nboost)
+80104a6d:	a1 54 55 11 80       	mov    0x80115554,%eax
+80104a72:	83 c4 10             	add    $0x10,%esp
+80104a75:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80104a7b:	74 43                	je     80104ac0 <yield+0x80>
+  p->nboost = nboost;
+80104a7d:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->queue = L0;
+80104a83:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->localtime = 0;
+80104a8a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104a91:	00 00 00 
+  p->priority = 3;
+80104a94:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80104a9b:	00 00 00 
+    setrunnable(p);
+80104a9e:	89 d8                	mov    %ebx,%eax
+80104aa0:	e8 bb f1 ff ff       	call   80103c60 <setrunnable>
+  sched();
+80104aa5:	e8 f6 fb ff ff       	call   801046a0 <sched>
+  release(&ptable.lock);
+80104aaa:	83 ec 0c             	sub    $0xc,%esp
+80104aad:	68 20 2f 11 80       	push   $0x80112f20
+80104ab2:	e8 b9 09 00 00       	call   80105470 <release>
+}
+80104ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104aba:	83 c4 10             	add    $0x10,%esp
+80104abd:	c9                   	leave
+80104abe:	c3                   	ret
+80104abf:	90                   	nop
+  if (p->queue == L2 && p != specialproc) {
+80104ac0:	83 7b 7c 02          	cmpl   $0x2,0x7c(%ebx)
+80104ac4:	75 d8                	jne    80104a9e <yield+0x5e>
+80104ac6:	39 1d 5c 55 11 80    	cmp    %ebx,0x8011555c
+80104acc:	74 d0                	je     80104a9e <yield+0x5e>
+    p->state = RUNNABLE;
+80104ace:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    enqueue(mycpu(), NQUEUE - 1, p, 0);
+80104ad5:	e8 e6 ef ff ff       	call   80103ac0 <mycpu>
+    p->qnext = 0;
+80104ada:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80104ae1:	00 00 00 
+    p->qprev = q->back;
+80104ae4:	8b 90 dc 00 00 00    	mov    0xdc(%eax),%edx
+80104aea:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+    if (q->back)
+80104af0:	85 d2                	test   %edx,%edx
+80104af2:	74 2c                	je     80104b20 <yield+0xe0>
+      q->back->qnext = p;
+80104af4:	89 9a 88 00 00 00    	mov    %ebx,0x88(%edx)
+    q->back = p;
+80104afa:	89 98 dc 00 00 00    	mov    %ebx,0xdc(%eax)
+  p->cpu = c;
+80104b00:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+  c->nrun++;
+80104b06:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80104b0c:	83 c2 01             	add    $0x1,%edx
+80104b0f:	89 90 e0 00 00 00    	mov    %edx,0xe0(%eax)
+}
+80104b15:	eb 8e                	jmp    80104aa5 <yield+0x65>
+80104b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b1e:	66 90                	xchg   %ax,%ax
+      q->front = p;
+80104b20:	89 98 d8 00 00 00    	mov    %ebx,0xd8(%eax)
+80104b26:	eb d2                	jmp    80104afa <yield+0xba>
+80104b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b2f:	90                   	nop
+
+80104b30 <sleep>:
+{
+80104b30:	55                   	push   %ebp
+80104b31:	89 e5                	mov    %esp,%ebp
+80104b33:	57                   	push   %edi
+80104b34:	56                   	push   %esi
+80104b35:	53                   	push   %ebx
+80104b36:	83 ec 0c             	sub    $0xc,%esp
+80104b39:	8b 7d 08             	mov    0x8(%ebp),%edi
+80104b3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pushcli();
+80104b3f:	e8 3c 08 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104b44:	e8 77 ef ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104b49:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104b4f:	e8 7c 08 00 00       	call   801053d0 <popcli>
+  if(p == 0)
+80104b54:	85 db                	test   %ebx,%ebx
+80104b56:	0f 84 96 00 00 00    	je     80104bf2 <sleep+0xc2>
+  if(lk == 0)
+80104b5c:	85 f6                	test   %esi,%esi
+80104b5e:	0f 84 81 00 00 00    	je     80104be5 <sleep+0xb5>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80104b64:	81 fe 20 2f 11 80    	cmp    $0x80112f20,%esi
+80104b6a:	74 54                	je     80104bc0 <sleep+0x90>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80104b6c:	83 ec 0c             	sub    $0xc,%esp
+80104b6f:	68 20 2f 11 80       	push   $0x80112f20
+80104b74:	e8 57 09 00 00       	call   801054d0 <acquire>
+    release(lk);
+80104b79:	89 34 24             	mov    %esi,(%esp)
+80104b7c:	e8 ef 08 00 00       	call   80105470 <release>
+  charge(p);
+80104b81:	89 d8                	mov    %ebx,%eax
+80104b83:	e8 28 f2 ff ff       	call   80103db0 <charge>
+  p->chan = chan;
+80104b88:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+80104b8b:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104b92:	e8 09 fb ff ff       	call   801046a0 <sched>
+  p->chan = 0;
+80104b97:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    release(&ptable.lock);
+80104b9e:	c7 04 24 20 2f 11 80 	movl   $0x80112f20,(%esp)
+80104ba5:	e8 c6 08 00 00       	call   80105470 <release>
+    acquire(lk);
+80104baa:	89 75 08             	mov    %esi,0x8(%ebp)
+80104bad:	83 c4 10             	add    $0x10,%esp
+}
+80104bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bb3:	5b                   	pop    %ebx
+80104bb4:	5e                   	pop    %esi
+80104bb5:	5f                   	pop    %edi
+80104bb6:	5d                   	pop    %ebp
+    acquire(lk);
+80104bb7:	e9 14 09 00 00       	jmp    801054d0 <acquire>
+80104bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  charge(p);
+80104bc0:	89 d8                	mov    %ebx,%eax
+80104bc2:	e8 e9 f1 ff ff       	call   80103db0 <charge>
+  p->chan = chan;
+80104bc7:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+80104bca:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104bd1:	e8 ca fa ff ff       	call   801046a0 <sched>
+  p->chan = 0;
+80104bd6:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+}
+80104bdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104be0:	5b                   	pop    %ebx
+80104be1:	5e                   	pop    %esi
+80104be2:	5f                   	pop    %edi
+80104be3:	5d                   	pop    %ebp
+80104be4:	c3                   	ret
+    panic("sleep without lk");
+80104be5:	83 ec 0c             	sub    $0xc,%esp
+80104be8:	68 fa 88 10 80       	push   $0x801088fa
+80104bed:	e8 8e b7 ff ff       	call   80100380 <panic>
+    panic("sleep");
+80104bf2:	83 ec 0c             	sub    $0xc,%esp
+80104bf5:	68 f4 88 10 80       	push   $0x801088f4
+80104bfa:	e8 81 b7 ff ff       	call   80100380 <panic>
+80104bff:	90                   	nop
+
+80104c00 <wakeup>:
+}
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+80104c00:	55                   	push   %ebp
+80104c01:	89 e5                	mov    %esp,%ebp
+80104c03:	56                   	push   %esi
+80104c04:	53                   	push   %ebx
+80104c05:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104c08:	bb 54 2f 11 80       	mov    $0x80112f54,%ebx
+  acquire(&ptable.lock);
+80104c0d:	83 ec 0c             	sub    $0xc,%esp
+80104c10:	68 20 2f 11 80       	push   $0x80112f20
+80104c15:	e8 b6 08 00 00       	call   801054d0 <acquire>
+80104c1a:	83 c4 10             	add    $0x10,%esp
+80104c1d:	eb 0f                	jmp    80104c2e <wakeup+0x2e>
+80104c1f:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104c20:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80104c26:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+80104c2c:	74 20                	je     80104c4e <wakeup+0x4e>
+    if(p->state == SLEEPING && p->chan == chan) {
+80104c2e:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80104c32:	75 ec                	jne    80104c20 <wakeup+0x20>
+80104c34:	3b 73 20             	cmp    0x20(%ebx),%esi
+80104c37:	75 e7                	jne    80104c20 <wakeup+0x20>
+      setrunnable(p);
+80104c39:	89 d8                	mov    %ebx,%eax
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104c3b:	81 c3 98 00 00 00    	add    $0x98,%ebx
+      setrunnable(p);
+80104c41:	e8 1a f0 ff ff       	call   80103c60 <setrunnable>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104c46:	81 fb 54 55 11 80    	cmp    $0x80115554,%ebx
+80104c4c:	75 e0                	jne    80104c2e <wakeup+0x2e>
+  wakeup1(chan);
+  release(&ptable.lock);
+80104c4e:	c7 45 08 20 2f 11 80 	movl   $0x80112f20,0x8(%ebp)
+}
+80104c55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104c58:	5b                   	pop    %ebx
+80104c59:	5e                   	pop    %esi
+80104c5a:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80104c5b:	e9 10 08 00 00       	jmp    80105470 <release>
+
+80104c60 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+80104c60:	55                   	push   %ebp
+80104c61:	89 e5                	mov    %esp,%ebp
+80104c63:	53                   	push   %ebx
+80104c64:	83 ec 10             	sub    $0x10,%esp
+80104c67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80104c6a:	68 20 2f 11 80       	push   $0x80112f20
+80104c6f:	e8 5c 08 00 00       	call   801054d0 <acquire>
+80104c74:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104c77:	b8 54 2f 11 80       	mov    $0x80112f54,%eax
+80104c7c:	eb 0e                	jmp    80104c8c <kill+0x2c>
+80104c7e:	66 90                	xchg   %ax,%ax
+80104c80:	05 98 00 00 00       	add    $0x98,%eax
+80104c85:	3d 54 55 11 80       	cmp    $0x80115554,%eax
+80104c8a:	74 2c                	je     80104cb8 <kill+0x58>
+    if(p->pid == pid){
+80104c8c:	39 58 10             	cmp    %ebx,0x10(%eax)
+80104c8f:	75 ef                	jne    80104c80 <kill+0x20>
+      p->killed = 1;
+      // Wake process from sleep if necessary.
+      if(p->state == SLEEPING) {
+80104c91:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+      p->killed = 1;
+80104c95:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+      if(p->state == SLEEPING) {
+80104c9c:	74 3a                	je     80104cd8 <kill+0x78>
+        setrunnable(p);
+      }
+      release(&ptable.lock);
+80104c9e:	83 ec 0c             	sub    $0xc,%esp
+80104ca1:	68 20 2f 11 80       	push   $0x80112f20
+80104ca6:	e8 c5 07 00 00       	call   80105470 <release>
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80104cab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+80104cae:	83 c4 10             	add    $0x10,%esp
+80104cb1:	31 c0                	xor    %eax,%eax
+}
+80104cb3:	c9                   	leave
+80104cb4:	c3                   	ret
+80104cb5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80104cb8:	83 ec 0c             	sub    $0xc,%esp
+80104cbb:	68 20 2f 11 80       	push   $0x80112f20
+80104cc0:	e8 ab 07 00 00       	call   80105470 <release>
+}
+80104cc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80104cc8:	83 c4 10             	add    $0x10,%esp
+80104ccb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104cd0:	c9                   	leave
+80104cd1:	c3                   	ret
+80104cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        setrunnable(p);
+80104cd8:	e8 83 ef ff ff       	call   80103c60 <setrunnable>
+80104cdd:	eb bf                	jmp    80104c9e <kill+0x3e>
+80104cdf:	90                   	nop
+
+80104ce0 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80104ce0:	55                   	push   %ebp
+80104ce1:	89 e5                	mov    %esp,%ebp
+80104ce3:	57                   	push   %edi
+80104ce4:	56                   	push   %esi
+80104ce5:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80104ce8:	53                   	push   %ebx
+80104ce9:	bb c0 2f 11 80       	mov    $0x80112fc0,%ebx
+80104cee:	83 ec 3c             	sub    $0x3c,%esp
+80104cf1:	eb 27                	jmp    80104d1a <procdump+0x3a>
+80104cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104cf7:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80104cf8:	83 ec 0c             	sub    $0xc,%esp
+80104cfb:	68 61 8d 10 80       	push   $0x80108d61
+80104d00:	e8 ab b9 ff ff       	call   801006b0 <cprintf>
+80104d05:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80104d08:	81 c3 98 00 00 00    	add    $0x98,%ebx
+80104d0e:	81 fb c0 55 11 80    	cmp    $0x801155c0,%ebx
+80104d14:	0f 84 7e 00 00 00    	je     80104d98 <procdump+0xb8>
+    if(p->state == UNUSED)
+80104d1a:	8b 43 a0             	mov    -0x60(%ebx),%eax
+80104d1d:	85 c0                	test   %eax,%eax
+80104d1f:	74 e7                	je     80104d08 <procdump+0x28>
+      state = "???";
+80104d21:	ba 0b 89 10 80       	mov    $0x8010890b,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80104d26:	83 f8 05             	cmp    $0x5,%eax
+80104d29:	77 11                	ja     80104d3c <procdump+0x5c>
+80104d2b:	8b 14 85 a4 89 10 80 	mov    -0x7fef765c(,%eax,4),%edx
+      state = "???";
+80104d32:	b8 0b 89 10 80       	mov    $0x8010890b,%eax
+80104d37:	85 d2                	test   %edx,%edx
+80104d39:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+80104d3c:	53                   	push   %ebx
+80104d3d:	52                   	push   %edx
+80104d3e:	ff 73 a4             	push   -0x5c(%ebx)
+80104d41:	68 0f 89 10 80       	push   $0x8010890f
+80104d46:	e8 65 b9 ff ff       	call   801006b0 <cprintf>
+    if(p->state == SLEEPING){
+80104d4b:	83 c4 10             	add    $0x10,%esp
+80104d4e:	83 7b a0 02          	cmpl   $0x2,-0x60(%ebx)
+80104d52:	75 a4                	jne    80104cf8 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80104d54:	83 ec 08             	sub    $0x8,%esp
+80104d57:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80104d5a:	8d 7d c0             	lea    -0x40(%ebp),%edi
+80104d5d:	50                   	push   %eax
+80104d5e:	8b 43 b0             	mov    -0x50(%ebx),%eax
+80104d61:	8b 40 0c             	mov    0xc(%eax),%eax
+80104d64:	83 c0 08             	add    $0x8,%eax
+80104d67:	50                   	push   %eax
+80104d68:	e8 a3 05 00 00       	call   80105310 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104d6d:	83 c4 10             	add    $0x10,%esp
+80104d70:	8b 17                	mov    (%edi),%edx
+80104d72:	85 d2                	test   %edx,%edx
+80104d74:	74 82                	je     80104cf8 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80104d76:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104d79:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+80104d7c:	52                   	push   %edx
+80104d7d:	68 61 83 10 80       	push   $0x80108361
+80104d82:	e8 29 b9 ff ff       	call   801006b0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104d87:	83 c4 10             	add    $0x10,%esp
+80104d8a:	39 f7                	cmp    %esi,%edi
+80104d8c:	75 e2                	jne    80104d70 <procdump+0x90>
+80104d8e:	e9 65 ff ff ff       	jmp    80104cf8 <procdump+0x18>
+80104d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104d97:	90                   	nop
+  }
+}
+80104d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d9b:	5b                   	pop    %ebx
+80104d9c:	5e                   	pop    %esi
+80104d9d:	5f                   	pop    %edi
+80104d9e:	5d                   	pop    %ebp
+80104d9f:	c3                   	ret
+
+80104da0 <schedulerLock>:
+
+// Lock the scheduler
+void 
+schedulerLock(int password)
+{
+80104da0:	55                   	push   %ebp
+80104da1:	89 e5                	mov    %esp,%ebp
+80104da3:	56                   	push   %esi
+80104da4:	53                   	push   %ebx
+80104da5:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80104da8:	e8 d3 05 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104dad:	e8 0e ed ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104db2:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104db8:	e8 13 06 00 00       	call   801053d0 <popcli>
+  struct proc *p = myproc();
+
+  acquire(&ptable.lock);
+80104dbd:	83 ec 0c             	sub    $0xc,%esp
+80104dc0:	68 20 2f 11 80       	push   $0x80112f20
+80104dc5:	e8 06 07 00 00       	call   801054d0 <acquire>
+
+  if (!p) {
+80104dca:	83 c4 10             	add    $0x10,%esp
+80104dcd:	85 db                	test   %ebx,%ebx
+80104dcf:	0f 84 92 00 00 00    	je     80104e67 <schedulerLock+0xc7>
+  if (p->nboost == nboost)
+80104dd5:	a1 54 55 11 80       	mov    0x80115554,%eax
+80104dda:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80104de0:	74 21                	je     80104e03 <schedulerLock+0x63>
+  p->nboost = nboost;
+80104de2:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->queue = L0;
+80104de8:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->localtime = 0;
+80104def:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104df6:	00 00 00 
+  p->priority = 3;
+80104df9:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80104e00:	00 00 00 
+    release(&ptable.lock);
+    return;
+  }
+  catchup(p);
+  if (password != 2021031685 || specialproc) {
+80104e03:	81 fe 05 7f 76 78    	cmp    $0x78767f05,%esi
+80104e09:	75 09                	jne    80104e14 <schedulerLock+0x74>
+80104e0b:	a1 5c 55 11 80       	mov    0x8011555c,%eax
+80104e10:	85 c0                	test   %eax,%eax
+80104e12:	74 3c                	je     80104e50 <schedulerLock+0xb0>
+    release(&ptable.lock);
+80104e14:	83 ec 0c             	sub    $0xc,%esp
+80104e17:	68 20 2f 11 80       	push   $0x80112f20
+80104e1c:	e8 4f 06 00 00       	call   80105470 <release>
+    cprintf("[killed] pid: %d, time quantum: %d, level: %d\n",
+80104e21:	ff 73 7c             	push   0x7c(%ebx)
+80104e24:	ff b3 84 00 00 00    	push   0x84(%ebx)
+80104e2a:	ff 73 10             	push   0x10(%ebx)
+80104e2d:	68 74 89 10 80       	push   $0x80108974
+80104e32:	e8 79 b8 ff ff       	call   801006b0 <cprintf>
+             p->pid, p->localtime, p->queue);
+    kill(p->pid);
+80104e37:	8b 43 10             	mov    0x10(%ebx),%eax
+80104e3a:	83 c4 20             	add    $0x20,%esp
+80104e3d:	89 45 08             	mov    %eax,0x8(%ebp)
+  ticks = 0;
+  p->queue = SPECIAL;
+  specialproc = p;
+
+  release(&ptable.lock);
+}
+80104e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104e43:	5b                   	pop    %ebx
+80104e44:	5e                   	pop    %esi
+80104e45:	5d                   	pop    %ebp
+    kill(p->pid);
+80104e46:	e9 15 fe ff ff       	jmp    80104c60 <kill>
+80104e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104e4f:	90                   	nop
+  ticks = 0;
+80104e50:	c7 05 80 55 11 80 00 	movl   $0x0,0x80115580
+80104e57:	00 00 00 
+  p->queue = SPECIAL;
+80104e5a:	c7 43 7c 03 00 00 00 	movl   $0x3,0x7c(%ebx)
+  specialproc = p;
+80104e61:	89 1d 5c 55 11 80    	mov    %ebx,0x8011555c
+  release(&ptable.lock);
+80104e67:	c7 45 08 20 2f 11 80 	movl   $0x80112f20,0x8(%ebp)
+}
+80104e6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104e71:	5b                   	pop    %ebx
+80104e72:	5e                   	pop    %esi
+80104e73:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80104e74:	e9 f7 05 00 00       	jmp    80105470 <release>
+80104e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104e80 <schedulerUnlock>:
+
+// Unlock the scheduler
+void
+schedulerUnlock(int password)
+{
+80104e80:	55                   	push   %ebp
+80104e81:	89 e5                	mov    %esp,%ebp
+80104e83:	56                   	push   %esi
+80104e84:	53                   	push   %ebx
+80104e85:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80104e88:	e8 f3 04 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104e8d:	e8 2e ec ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104e92:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104e98:	e8 33 05 00 00       	call   801053d0 <popcli>
+  struct proc *p = myproc();
+
+  acquire(&ptable.lock);
+80104e9d:	83 ec 0c             	sub    $0xc,%esp
+80104ea0:	68 20 2f 11 80       	push   $0x80112f20
+80104ea5:	e8 26 06 00 00       	call   801054d0 <acquire>
+  if (!p) {
+80104eaa:	83 c4 10             	add    $0x10,%esp
+80104ead:	85 db                	test   %ebx,%ebx
+80104eaf:	0f 84 ab 00 00 00    	je     80104f60 <schedulerUnlock+0xe0>
+  if (p->nboost == nboost)
+80104eb5:	a1 54 55 11 80       	mov    0x80115554,%eax
+80104eba:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80104ec0:	74 5e                	je     80104f20 <schedulerUnlock+0xa0>
+  p->nboost = nboost;
+80104ec2:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->queue = L0;
+80104ec8:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->localtime = 0;
+80104ecf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104ed6:	00 00 00 
+  p->priority = 3;
+80104ed9:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80104ee0:	00 00 00 
+    release(&ptable.lock);
+    return;
+  }
+  catchup(p);
+  if (password != 2021031685 || p->queue != SPECIAL) {
+    release(&ptable.lock);
+80104ee3:	83 ec 0c             	sub    $0xc,%esp
+80104ee6:	68 20 2f 11 80       	push   $0x80112f20
+80104eeb:	e8 80 05 00 00       	call   80105470 <release>
+    cprintf("[killed] pid: %d, time quantum: %d, level: %d\n",
+80104ef0:	ff 73 7c             	push   0x7c(%ebx)
+80104ef3:	ff b3 84 00 00 00    	push   0x84(%ebx)
+80104ef9:	ff 73 10             	push   0x10(%ebx)
+80104efc:	68 74 89 10 80       	push   $0x80108974
+80104f01:	e8 aa b7 ff ff       	call   801006b0 <cprintf>
+             p->pid, p->localtime, p->queue);
+
+    kill(p->pid);
+80104f06:	8b 43 10             	mov    0x10(%ebx),%eax
+80104f09:	83 c4 20             	add    $0x20,%esp
+80104f0c:	89 45 08             	mov    %eax,0x8(%ebp)
+  p->priority = 3;
+  headproc = p;
+  kick(0);
+
+  release(&ptable.lock);
+}
+80104f0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104f12:	5b                   	pop    %ebx
+80104f13:	5e                   	pop    %esi
+80104f14:	5d                   	pop    %ebp
+    kill(p->pid);
+80104f15:	e9 46 fd ff ff       	jmp    80104c60 <kill>
+80104f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if (password != 2021031685 || p->queue != SPECIAL) {
+80104f20:	81 fe 05 7f 76 78    	cmp    $0x78767f05,%esi
+80104f26:	75 bb                	jne    80104ee3 <schedulerUnlock+0x63>
+80104f28:	83 7b 7c 03          	cmpl   $0x3,0x7c(%ebx)
+80104f2c:	75 b5                	jne    80104ee3 <schedulerUnlock+0x63>
+  p->localtime = 0;
+80104f2e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104f35:	00 00 00 
+  kick(0);
+80104f38:	31 c0                	xor    %eax,%eax
+  p->queue = L0;
+80104f3a:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->priority = 3;
+80104f41:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80104f48:	00 00 00 
+  specialproc = 0;
+80104f4b:	c7 05 5c 55 11 80 00 	movl   $0x0,0x8011555c
+80104f52:	00 00 00 
+  headproc = p;
+80104f55:	89 1d 58 55 11 80    	mov    %ebx,0x80115558
+  kick(0);
+80104f5b:	e8 50 ec ff ff       	call   80103bb0 <kick>
+  release(&ptable.lock);
+80104f60:	c7 45 08 20 2f 11 80 	movl   $0x80112f20,0x8(%ebp)
+}
+80104f67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104f6a:	5b                   	pop    %ebx
+80104f6b:	5e                   	pop    %esi
+80104f6c:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80104f6d:	e9 fe 04 00 00       	jmp    80105470 <release>
+80104f72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104f80 <getLevel>:
+
+// Get level of current process
+int
+getLevel(void)
+{
+80104f80:	55                   	push   %ebp
+80104f81:	89 e5                	mov    %esp,%ebp
+80104f83:	53                   	push   %ebx
+80104f84:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80104f87:	e8 f4 03 00 00       	call   80105380 <pushcli>
+  c = mycpu();
+80104f8c:	e8 2f eb ff ff       	call   80103ac0 <mycpu>
+  p = c->proc;
+80104f91:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104f97:	e8 34 04 00 00       	call   801053d0 <popcli>
+  struct proc *p = myproc();
+  int level;
+
+  if (!p) return -1;
+80104f9c:	85 db                	test   %ebx,%ebx
+80104f9e:	74 65                	je     80105005 <getLevel+0x85>
+
+  acquire(&ptable.lock);
+80104fa0:	83 ec 0c             	sub    $0xc,%esp
+80104fa3:	68 20 2f 11 80       	push   $0x80112f20
+80104fa8:	e8 23 05 00 00       	call   801054d0 <acquire>
+  if (p->nboost == nboost)
+80104fad:	a1 54 55 11 80       	mov    0x80115554,%eax
+80104fb2:	83 c4 10             	add    $0x10,%esp
+80104fb5:	39 83 90 00 00 00    	cmp    %eax,0x90(%ebx)
+80104fbb:	74 43                	je     80105000 <getLevel+0x80>
+  p->nboost = nboost;
+80104fbd:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  p->queue = L0;
+80104fc3:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  p->localtime = 0;
+80104fca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80104fd1:	00 00 00 
+  p->priority = 3;
+80104fd4:	c7 83 80 00 00 00 03 	movl   $0x3,0x80(%ebx)
+80104fdb:	00 00 00 
+80104fde:	31 db                	xor    %ebx,%ebx
+  catchup(p);
+  level = p->queue;
+  release(&ptable.lock);
+80104fe0:	83 ec 0c             	sub    $0xc,%esp
+80104fe3:	68 20 2f 11 80       	push   $0x80112f20
+80104fe8:	e8 83 04 00 00       	call   80105470 <release>
+  return level;
+80104fed:	83 c4 10             	add    $0x10,%esp
+}
+80104ff0:	89 d8                	mov    %ebx,%eax
+80104ff2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ff5:	c9                   	leave
+80104ff6:	c3                   	ret
+80104ff7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104ffe:	66 90                	xchg   %ax,%ax
+  level = p->queue;
+80105000:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80105003:	eb db                	jmp    80104fe0 <getLevel+0x60>
+  if (!p) return -1;
+80105005:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010500a:	eb e4                	jmp    80104ff0 <getLevel+0x70>
+8010500c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105010 <setPriority>:
+
+// setPriority(int pid, int priority)
+// Set pid process's priority manually
+void
+setPriority(int pid, int priority)
+{
+80105010:	55                   	push   %ebp
+80105011:	89 e5                	mov    %esp,%ebp
+80105013:	56                   	push   %esi
+80105014:	53                   	push   %ebx
+80105015:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105018:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p;
+
+  acquire(&ptable.lock);
+8010501b:	83 ec 0c             	sub    $0xc,%esp
+8010501e:	68 20 2f 11 80       	push   $0x80112f20
+80105023:	e8 a8 04 00 00       	call   801054d0 <acquire>
+80105028:	83 c4 10             	add    $0x10,%esp
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+8010502b:	b8 54 2f 11 80       	mov    $0x80112f54,%eax
+80105030:	eb 12                	jmp    80105044 <setPriority+0x34>
+80105032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105038:	05 98 00 00 00       	add    $0x98,%eax
+8010503d:	3d 54 55 11 80       	cmp    $0x80115554,%eax
+80105042:	74 40                	je     80105084 <setPriority+0x74>
+    if (p->pid == pid) {
+80105044:	39 58 10             	cmp    %ebx,0x10(%eax)
+80105047:	75 ef                	jne    80105038 <setPriority+0x28>
+  if (p->nboost == nboost)
+80105049:	8b 15 54 55 11 80    	mov    0x80115554,%edx
+8010504f:	3b 90 90 00 00 00    	cmp    0x90(%eax),%edx
+80105055:	74 21                	je     80105078 <setPriority+0x68>
+  p->nboost = nboost;
+80105057:	89 90 90 00 00 00    	mov    %edx,0x90(%eax)
+  p->queue = L0;
+8010505d:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+  p->localtime = 0;
+80105064:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%eax)
+8010506b:	00 00 00 
+  p->priority = 3;
+8010506e:	c7 80 80 00 00 00 03 	movl   $0x3,0x80(%eax)
+80105075:	00 00 00 
+      catchup(p);
+      // move a queued L2 process to its new priority's queue
+      if (p->state == RUNNABLE && p != specialproc && p->queue == L2) {
+80105078:	83 78 0c 03          	cmpl   $0x3,0xc(%eax)
+8010507c:	74 22                	je     801050a0 <setPriority+0x90>
+        unqueue(findqueue(p), p);
+        p->priority = priority;
+        enqueue(p->cpu, qlevel(p), p, 0);
+      } else {
+        p->priority = priority;
+8010507e:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+      }
+      break;
+    }
+  }
+
+  release(&ptable.lock);
+80105084:	c7 45 08 20 2f 11 80 	movl   $0x80112f20,0x8(%ebp)
+8010508b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010508e:	5b                   	pop    %ebx
+8010508f:	5e                   	pop    %esi
+80105090:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80105091:	e9 da 03 00 00       	jmp    80105470 <release>
+80105096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010509d:	8d 76 00             	lea    0x0(%esi),%esi
+      if (p->state == RUNNABLE && p != specialproc && p->queue == L2) {
+801050a0:	39 05 5c 55 11 80    	cmp    %eax,0x8011555c
+801050a6:	74 d6                	je     8010507e <setPriority+0x6e>
+801050a8:	83 78 7c 02          	cmpl   $0x2,0x7c(%eax)
+801050ac:	75 d0                	jne    8010507e <setPriority+0x6e>
+801050ae:	89 c2                	mov    %eax,%edx
+  while (p->qprev)
+801050b0:	89 d1                	mov    %edx,%ecx
+801050b2:	8b 92 8c 00 00 00    	mov    0x8c(%edx),%edx
+801050b8:	85 d2                	test   %edx,%edx
+801050ba:	75 f4                	jne    801050b0 <setPriority+0xa0>
+  for (q = p->cpu->queues; q < &p->cpu->queues[NQUEUE]; q++)
+801050bc:	8b 99 94 00 00 00    	mov    0x94(%ecx),%ebx
+801050c2:	8d 93 b0 00 00 00    	lea    0xb0(%ebx),%edx
+801050c8:	81 c3 e0 00 00 00    	add    $0xe0,%ebx
+    if (q->front == p)
+801050ce:	3b 0a                	cmp    (%edx),%ecx
+801050d0:	74 14                	je     801050e6 <setPriority+0xd6>
+  for (q = p->cpu->queues; q < &p->cpu->queues[NQUEUE]; q++)
+801050d2:	83 c2 08             	add    $0x8,%edx
+801050d5:	39 d3                	cmp    %edx,%ebx
+801050d7:	75 f5                	jne    801050ce <setPriority+0xbe>
+  panic("findqueue");
+801050d9:	83 ec 0c             	sub    $0xc,%esp
+801050dc:	68 18 89 10 80       	push   $0x80108918
+801050e1:	e8 9a b2 ff ff       	call   80100380 <panic>
+  if (p->qprev)
+801050e6:	8b 98 8c 00 00 00    	mov    0x8c(%eax),%ebx
+    p->qprev->qnext = p->qnext;
+801050ec:	8b 88 88 00 00 00    	mov    0x88(%eax),%ecx
+  if (p->qprev)
+801050f2:	85 db                	test   %ebx,%ebx
+801050f4:	0f 84 b8 00 00 00    	je     801051b2 <setPriority+0x1a2>
+    p->qprev->qnext = p->qnext;
+801050fa:	89 8b 88 00 00 00    	mov    %ecx,0x88(%ebx)
+  if (p->qnext)
+80105100:	8b 98 88 00 00 00    	mov    0x88(%eax),%ebx
+    p->qnext->qprev = p->qprev;
+80105106:	8b 88 8c 00 00 00    	mov    0x8c(%eax),%ecx
+  if (p->qnext)
+8010510c:	85 db                	test   %ebx,%ebx
+8010510e:	0f 84 96 00 00 00    	je     801051aa <setPriority+0x19a>
+    p->qnext->qprev = p->qprev;
+80105114:	89 8b 8c 00 00 00    	mov    %ecx,0x8c(%ebx)
+  p->qnext = p->qprev = 0;
+8010511a:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+80105121:	00 00 00 
+  p->cpu->nrun--;
+80105124:	8b 88 94 00 00 00    	mov    0x94(%eax),%ecx
+  p->qnext = p->qprev = 0;
+8010512a:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+80105131:	00 00 00 
+  p->cpu->nrun--;
+80105134:	8b 91 e0 00 00 00    	mov    0xe0(%ecx),%edx
+8010513a:	83 ea 01             	sub    $0x1,%edx
+8010513d:	89 91 e0 00 00 00    	mov    %edx,0xe0(%ecx)
+  if (p->queue != L2)
+80105143:	8b 50 7c             	mov    0x7c(%eax),%edx
+        p->priority = priority;
+80105146:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+  if (p->queue != L2)
+8010514c:	83 fa 02             	cmp    $0x2,%edx
+8010514f:	75 14                	jne    80105165 <setPriority+0x155>
+  if (prio >= NPRIO)
+80105151:	ba 03 00 00 00       	mov    $0x3,%edx
+80105156:	39 d6                	cmp    %edx,%esi
+80105158:	0f 4e d6             	cmovle %esi,%edx
+  return L2 + prio;
+8010515b:	31 c9                	xor    %ecx,%ecx
+8010515d:	85 d2                	test   %edx,%edx
+8010515f:	0f 48 d1             	cmovs  %ecx,%edx
+80105162:	83 c2 02             	add    $0x2,%edx
+        enqueue(p->cpu, qlevel(p), p, 0);
+80105165:	8b 88 94 00 00 00    	mov    0x94(%eax),%ecx
+    p->qprev = q->back;
+8010516b:	83 c2 16             	add    $0x16,%edx
+    p->qnext = 0;
+8010516e:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+80105175:	00 00 00 
+    p->qprev = q->back;
+80105178:	8b 5c d1 04          	mov    0x4(%ecx,%edx,8),%ebx
+8010517c:	89 98 8c 00 00 00    	mov    %ebx,0x8c(%eax)
+    if (q->back)
+80105182:	85 db                	test   %ebx,%ebx
+80105184:	74 33                	je     801051b9 <setPriority+0x1a9>
+      q->back->qnext = p;
+80105186:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+    q->back = p;
+8010518c:	89 44 d1 04          	mov    %eax,0x4(%ecx,%edx,8)
+  p->cpu = c;
+80105190:	89 88 94 00 00 00    	mov    %ecx,0x94(%eax)
+  c->nrun++;
+80105196:	8b 81 e0 00 00 00    	mov    0xe0(%ecx),%eax
+8010519c:	83 c0 01             	add    $0x1,%eax
+8010519f:	89 81 e0 00 00 00    	mov    %eax,0xe0(%ecx)
+}
+801051a5:	e9 da fe ff ff       	jmp    80105084 <setPriority+0x74>
+    q->back = p->qprev;
+801051aa:	89 4a 04             	mov    %ecx,0x4(%edx)
+801051ad:	e9 68 ff ff ff       	jmp    8010511a <setPriority+0x10a>
+    q->front = p->qnext;
+801051b2:	89 0a                	mov    %ecx,(%edx)
+801051b4:	e9 47 ff ff ff       	jmp    80105100 <setPriority+0xf0>
+      q->front = p;
+801051b9:	89 04 d1             	mov    %eax,(%ecx,%edx,8)
+801051bc:	eb ce                	jmp    8010518c <setPriority+0x17c>
+801051be:	66 90                	xchg   %ax,%ax
+
+801051c0 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801051c0:	55                   	push   %ebp
+801051c1:	89 e5                	mov    %esp,%ebp
+801051c3:	53                   	push   %ebx
+801051c4:	83 ec 0c             	sub    $0xc,%esp
+801051c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801051ca:	68 bc 89 10 80       	push   $0x801089bc
+801051cf:	8d 43 04             	lea    0x4(%ebx),%eax
+801051d2:	50                   	push   %eax
+801051d3:	e8 18 01 00 00       	call   801052f0 <initlock>
+  lk->name = name;
+801051d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+801051db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+801051e1:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+801051e4:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+801051eb:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+801051ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801051f1:	c9                   	leave
+801051f2:	c3                   	ret
+801051f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801051fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105200 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80105200:	55                   	push   %ebp
+80105201:	89 e5                	mov    %esp,%ebp
+80105203:	56                   	push   %esi
+80105204:	53                   	push   %ebx
+80105205:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80105208:	8d 73 04             	lea    0x4(%ebx),%esi
+8010520b:	83 ec 0c             	sub    $0xc,%esp
+8010520e:	56                   	push   %esi
+8010520f:	e8 bc 02 00 00       	call   801054d0 <acquire>
+  while (lk->locked) {
+80105214:	8b 13                	mov    (%ebx),%edx
+80105216:	83 c4 10             	add    $0x10,%esp
+80105219:	85 d2                	test   %edx,%edx
+8010521b:	74 16                	je     80105233 <acquiresleep+0x33>
+8010521d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80105220:	83 ec 08             	sub    $0x8,%esp
+80105223:	56                   	push   %esi
+80105224:	53                   	push   %ebx
+80105225:	e8 06 f9 ff ff       	call   80104b30 <sleep>
+  while (lk->locked) {
+8010522a:	8b 03                	mov    (%ebx),%eax
+8010522c:	83 c4 10             	add    $0x10,%esp
+8010522f:	85 c0                	test   %eax,%eax
+80105231:	75 ed                	jne    80105220 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80105233:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80105239:	e8 42 ec ff ff       	call   80103e80 <myproc>
+8010523e:	8b 40 10             	mov    0x10(%eax),%eax
+80105241:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80105244:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80105247:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010524a:	5b                   	pop    %ebx
+8010524b:	5e                   	pop    %esi
+8010524c:	5d                   	pop    %ebp
+  release(&lk->lk);
+8010524d:	e9 1e 02 00 00       	jmp    80105470 <release>
+80105252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105260 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80105260:	55                   	push   %ebp
+80105261:	89 e5                	mov    %esp,%ebp
+80105263:	56                   	push   %esi
+80105264:	53                   	push   %ebx
+80105265:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80105268:	8d 73 04             	lea    0x4(%ebx),%esi
+8010526b:	83 ec 0c             	sub    $0xc,%esp
+8010526e:	56                   	push   %esi
+8010526f:	e8 5c 02 00 00       	call   801054d0 <acquire>
+  lk->locked = 0;
+80105274:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+8010527a:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80105281:	89 1c 24             	mov    %ebx,(%esp)
+80105284:	e8 77 f9 ff ff       	call   80104c00 <wakeup>
+  release(&lk->lk);
+80105289:	89 75 08             	mov    %esi,0x8(%ebp)
+8010528c:	83 c4 10             	add    $0x10,%esp
+}
+8010528f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105292:	5b                   	pop    %ebx
+80105293:	5e                   	pop    %esi
+80105294:	5d                   	pop    %ebp
+  release(&lk->lk);
+80105295:	e9 d6 01 00 00       	jmp    80105470 <release>
+8010529a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801052a0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+801052a0:	55                   	push   %ebp
+801052a1:	89 e5                	mov    %esp,%ebp
+801052a3:	57                   	push   %edi
+801052a4:	31 ff                	xor    %edi,%edi
+801052a6:	56                   	push   %esi
+801052a7:	53                   	push   %ebx
+801052a8:	83 ec 18             	sub    $0x18,%esp
+801052ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+801052ae:	8d 73 04             	lea    0x4(%ebx),%esi
+801052b1:	56                   	push   %esi
+801052b2:	e8 19 02 00 00       	call   801054d0 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+801052b7:	8b 03                	mov    (%ebx),%eax
+801052b9:	83 c4 10             	add    $0x10,%esp
+801052bc:	85 c0                	test   %eax,%eax
+801052be:	75 18                	jne    801052d8 <holdingsleep+0x38>
+  release(&lk->lk);
+801052c0:	83 ec 0c             	sub    $0xc,%esp
+801052c3:	56                   	push   %esi
+801052c4:	e8 a7 01 00 00       	call   80105470 <release>
+  return r;
+}
+801052c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801052cc:	89 f8                	mov    %edi,%eax
+801052ce:	5b                   	pop    %ebx
+801052cf:	5e                   	pop    %esi
+801052d0:	5f                   	pop    %edi
+801052d1:	5d                   	pop    %ebp
+801052d2:	c3                   	ret
+801052d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801052d7:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+801052d8:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+801052db:	e8 a0 eb ff ff       	call   80103e80 <myproc>
+801052e0:	39 58 10             	cmp    %ebx,0x10(%eax)
+801052e3:	0f 94 c0             	sete   %al
+801052e6:	0f b6 c0             	movzbl %al,%eax
+801052e9:	89 c7                	mov    %eax,%edi
+801052eb:	eb d3                	jmp    801052c0 <holdingsleep+0x20>
+801052ed:	66 90                	xchg   %ax,%ax
+801052ef:	90                   	nop
+
+801052f0 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+801052f0:	55                   	push   %ebp
+801052f1:	89 e5                	mov    %esp,%ebp
+801052f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+801052f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+801052f9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+801052ff:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80105302:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80105309:	5d                   	pop    %ebp
+8010530a:	c3                   	ret
+8010530b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010530f:	90                   	nop
+
+80105310 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80105310:	55                   	push   %ebp
+80105311:	89 e5                	mov    %esp,%ebp
+80105313:	53                   	push   %ebx
+80105314:	8b 45 08             	mov    0x8(%ebp),%eax
+80105317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+8010531a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010531d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80105322:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80105327:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010532c:	76 10                	jbe    8010533e <getcallerpcs+0x2e>
+8010532e:	eb 28                	jmp    80105358 <getcallerpcs+0x48>
+80105330:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80105336:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+8010533c:	77 1a                	ja     80105358 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+8010533e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80105341:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80105344:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80105347:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80105349:	83 f8 0a             	cmp    $0xa,%eax
+8010534c:	75 e2                	jne    80105330 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+8010534e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105351:	c9                   	leave
+80105352:	c3                   	ret
+80105353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105357:	90                   	nop
+80105358:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+8010535b:	8d 51 28             	lea    0x28(%ecx),%edx
+8010535e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80105360:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80105366:	83 c0 04             	add    $0x4,%eax
+80105369:	39 d0                	cmp    %edx,%eax
+8010536b:	75 f3                	jne    80105360 <getcallerpcs+0x50>
+}
+8010536d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105370:	c9                   	leave
+80105371:	c3                   	ret
+80105372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105380 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80105380:	55                   	push   %ebp
+80105381:	89 e5                	mov    %esp,%ebp
+80105383:	53                   	push   %ebx
+80105384:	83 ec 04             	sub    $0x4,%esp
+80105387:	9c                   	pushf
+80105388:	5b                   	pop    %ebx
+  asm volatile("cli");
+80105389:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+8010538a:	e8 31 e7 ff ff       	call   80103ac0 <mycpu>
+8010538f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80105395:	85 c0                	test   %eax,%eax
+80105397:	74 17                	je     801053b0 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80105399:	e8 22 e7 ff ff       	call   80103ac0 <mycpu>
+8010539e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+801053a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801053a8:	c9                   	leave
+801053a9:	c3                   	ret
+801053aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+801053b0:	e8 0b e7 ff ff       	call   80103ac0 <mycpu>
+801053b5:	81 e3 00 02 00 00    	and    $0x200,%ebx
+801053bb:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+801053c1:	eb d6                	jmp    80105399 <pushcli+0x19>
+801053c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801053ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801053d0 <popcli>:
+
+void
+popcli(void)
+{
+801053d0:	55                   	push   %ebp
+801053d1:	89 e5                	mov    %esp,%ebp
+801053d3:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801053d6:	9c                   	pushf
+801053d7:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801053d8:	f6 c4 02             	test   $0x2,%ah
+801053db:	75 35                	jne    80105412 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+801053dd:	e8 de e6 ff ff       	call   80103ac0 <mycpu>
+801053e2:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+801053e9:	78 34                	js     8010541f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+801053eb:	e8 d0 e6 ff ff       	call   80103ac0 <mycpu>
+801053f0:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+801053f6:	85 d2                	test   %edx,%edx
+801053f8:	74 06                	je     80105400 <popcli+0x30>
+    sti();
+}
+801053fa:	c9                   	leave
+801053fb:	c3                   	ret
+801053fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80105400:	e8 bb e6 ff ff       	call   80103ac0 <mycpu>
+80105405:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+8010540b:	85 c0                	test   %eax,%eax
+8010540d:	74 eb                	je     801053fa <popcli+0x2a>
+  asm volatile("sti");
+8010540f:	fb                   	sti
+}
+80105410:	c9                   	leave
+80105411:	c3                   	ret
+    panic("popcli - interruptible");
+80105412:	83 ec 0c             	sub    $0xc,%esp
+80105415:	68 c7 89 10 80       	push   $0x801089c7
+8010541a:	e8 61 af ff ff       	call   80100380 <panic>
+    panic("popcli");
+8010541f:	83 ec 0c             	sub    $0xc,%esp
+80105422:	68 de 89 10 80       	push   $0x801089de
+80105427:	e8 54 af ff ff       	call   80100380 <panic>
+8010542c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105430 <holding>:
+{
+80105430:	55                   	push   %ebp
+80105431:	89 e5                	mov    %esp,%ebp
+80105433:	56                   	push   %esi
+80105434:	53                   	push   %ebx
+80105435:	8b 75 08             	mov    0x8(%ebp),%esi
+80105438:	31 db                	xor    %ebx,%ebx
+  pushcli();
+8010543a:	e8 41 ff ff ff       	call   80105380 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+8010543f:	8b 06                	mov    (%esi),%eax
+80105441:	85 c0                	test   %eax,%eax
+80105443:	75 0b                	jne    80105450 <holding+0x20>
+  popcli();
+80105445:	e8 86 ff ff ff       	call   801053d0 <popcli>
+}
+8010544a:	89 d8                	mov    %ebx,%eax
+8010544c:	5b                   	pop    %ebx
+8010544d:	5e                   	pop    %esi
+8010544e:	5d                   	pop    %ebp
+8010544f:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80105450:	8b 5e 08             	mov    0x8(%esi),%ebx
+80105453:	e8 68 e6 ff ff       	call   80103ac0 <mycpu>
+80105458:	39 c3                	cmp    %eax,%ebx
+8010545a:	0f 94 c3             	sete   %bl
+  popcli();
+8010545d:	e8 6e ff ff ff       	call   801053d0 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80105462:	0f b6 db             	movzbl %bl,%ebx
+}
+80105465:	89 d8                	mov    %ebx,%eax
+80105467:	5b                   	pop    %ebx
+80105468:	5e                   	pop    %esi
+80105469:	5d                   	pop    %ebp
+8010546a:	c3                   	ret
+8010546b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010546f:	90                   	nop
+
+80105470 <release>:
+{
+80105470:	55                   	push   %ebp
+80105471:	89 e5                	mov    %esp,%ebp
+80105473:	56                   	push   %esi
+80105474:	53                   	push   %ebx
+80105475:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80105478:	e8 03 ff ff ff       	call   80105380 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+8010547d:	8b 03                	mov    (%ebx),%eax
+8010547f:	85 c0                	test   %eax,%eax
+80105481:	75 15                	jne    80105498 <release+0x28>
+  popcli();
+80105483:	e8 48 ff ff ff       	call   801053d0 <popcli>
+    panic("release");
+80105488:	83 ec 0c             	sub    $0xc,%esp
+8010548b:	68 e5 89 10 80       	push   $0x801089e5
+80105490:	e8 eb ae ff ff       	call   80100380 <panic>
+80105495:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80105498:	8b 73 08             	mov    0x8(%ebx),%esi
+8010549b:	e8 20 e6 ff ff       	call   80103ac0 <mycpu>
+801054a0:	39 c6                	cmp    %eax,%esi
+801054a2:	75 df                	jne    80105483 <release+0x13>
+  popcli();
+801054a4:	e8 27 ff ff ff       	call   801053d0 <popcli>
+  lk->pcs[0] = 0;
+801054a9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+801054b0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+801054b7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+801054bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+801054c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801054c5:	5b                   	pop    %ebx
+801054c6:	5e                   	pop    %esi
+801054c7:	5d                   	pop    %ebp
+  popcli();
+801054c8:	e9 03 ff ff ff       	jmp    801053d0 <popcli>
+801054cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801054d0 <acquire>:
+{
+801054d0:	55                   	push   %ebp
+801054d1:	89 e5                	mov    %esp,%ebp
+801054d3:	53                   	push   %ebx
+801054d4:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+801054d7:	e8 a4 fe ff ff       	call   80105380 <pushcli>
+  if(holding(lk))
+801054dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+801054df:	e8 9c fe ff ff       	call   80105380 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+801054e4:	8b 03                	mov    (%ebx),%eax
+801054e6:	85 c0                	test   %eax,%eax
+801054e8:	0f 85 9a 00 00 00    	jne    80105588 <acquire+0xb8>
+  popcli();
+801054ee:	e8 dd fe ff ff       	call   801053d0 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+801054f3:	b9 01 00 00 00       	mov    $0x1,%ecx
+801054f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801054ff:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80105500:	8b 55 08             	mov    0x8(%ebp),%edx
+80105503:	89 c8                	mov    %ecx,%eax
+80105505:	f0 87 02             	lock xchg %eax,(%edx)
+80105508:	85 c0                	test   %eax,%eax
+8010550a:	75 f4                	jne    80105500 <acquire+0x30>
+  __sync_synchronize();
+8010550c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80105511:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105514:	e8 a7 e5 ff ff       	call   80103ac0 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80105519:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+8010551c:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+8010551e:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80105521:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80105527:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+8010552c:	77 32                	ja     80105560 <acquire+0x90>
+  ebp = (uint*)v - 2;
+8010552e:	89 e8                	mov    %ebp,%eax
+80105530:	eb 14                	jmp    80105546 <acquire+0x76>
+80105532:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80105538:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+8010553e:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80105544:	77 1a                	ja     80105560 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+80105546:	8b 58 04             	mov    0x4(%eax),%ebx
+80105549:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+8010554d:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80105550:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80105552:	83 fa 0a             	cmp    $0xa,%edx
+80105555:	75 e1                	jne    80105538 <acquire+0x68>
+}
+80105557:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010555a:	c9                   	leave
+8010555b:	c3                   	ret
+8010555c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105560:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80105564:	8d 51 34             	lea    0x34(%ecx),%edx
+80105567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010556e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80105570:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80105576:	83 c0 04             	add    $0x4,%eax
+80105579:	39 c2                	cmp    %eax,%edx
+8010557b:	75 f3                	jne    80105570 <acquire+0xa0>
+}
+8010557d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105580:	c9                   	leave
+80105581:	c3                   	ret
+80105582:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80105588:	8b 5b 08             	mov    0x8(%ebx),%ebx
+8010558b:	e8 30 e5 ff ff       	call   80103ac0 <mycpu>
+80105590:	39 c3                	cmp    %eax,%ebx
+80105592:	0f 85 56 ff ff ff    	jne    801054ee <acquire+0x1e>
+  popcli();
+80105598:	e8 33 fe ff ff       	call   801053d0 <popcli>
+    panic("acquire");
+8010559d:	83 ec 0c             	sub    $0xc,%esp
+801055a0:	68 ed 89 10 80       	push   $0x801089ed
+801055a5:	e8 d6 ad ff ff       	call   80100380 <panic>
+801055aa:	66 90                	xchg   %ax,%ax
+801055ac:	66 90                	xchg   %ax,%ax
+801055ae:	66 90                	xchg   %ax,%ax
+
+801055b0 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+801055b0:	55                   	push   %ebp
+801055b1:	89 e5                	mov    %esp,%ebp
+801055b3:	57                   	push   %edi
+801055b4:	8b 55 08             	mov    0x8(%ebp),%edx
+801055b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+801055ba:	89 d0                	mov    %edx,%eax
+801055bc:	09 c8                	or     %ecx,%eax
+801055be:	a8 03                	test   $0x3,%al
+801055c0:	75 1e                	jne    801055e0 <memset+0x30>
+    c &= 0xFF;
+801055c2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+801055c6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+801055c9:	89 d7                	mov    %edx,%edi
+801055cb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+801055d1:	fc                   	cld
+801055d2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+801055d4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801055d7:	89 d0                	mov    %edx,%eax
+801055d9:	c9                   	leave
+801055da:	c3                   	ret
+801055db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801055df:	90                   	nop
+  asm volatile("cld; rep stosb" :
+801055e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801055e3:	89 d7                	mov    %edx,%edi
+801055e5:	fc                   	cld
+801055e6:	f3 aa                	rep stos %al,%es:(%edi)
+801055e8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801055eb:	89 d0                	mov    %edx,%eax
+801055ed:	c9                   	leave
+801055ee:	c3                   	ret
+801055ef:	90                   	nop
+
+801055f0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+801055f0:	55                   	push   %ebp
+801055f1:	89 e5                	mov    %esp,%ebp
+801055f3:	56                   	push   %esi
+801055f4:	53                   	push   %ebx
+801055f5:	8b 75 10             	mov    0x10(%ebp),%esi
+801055f8:	8b 55 08             	mov    0x8(%ebp),%edx
+801055fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801055fe:	85 f6                	test   %esi,%esi
+80105600:	74 2e                	je     80105630 <memcmp+0x40>
+80105602:	01 c6                	add    %eax,%esi
+80105604:	eb 14                	jmp    8010561a <memcmp+0x2a>
+80105606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010560d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80105610:	83 c0 01             	add    $0x1,%eax
+80105613:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80105616:	39 f0                	cmp    %esi,%eax
+80105618:	74 16                	je     80105630 <memcmp+0x40>
+    if(*s1 != *s2)
+8010561a:	0f b6 0a             	movzbl (%edx),%ecx
+8010561d:	0f b6 18             	movzbl (%eax),%ebx
+80105620:	38 d9                	cmp    %bl,%cl
+80105622:	74 ec                	je     80105610 <memcmp+0x20>
+      return *s1 - *s2;
+80105624:	0f b6 c1             	movzbl %cl,%eax
+80105627:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80105629:	5b                   	pop    %ebx
+8010562a:	5e                   	pop    %esi
+8010562b:	5d                   	pop    %ebp
+8010562c:	c3                   	ret
+8010562d:	8d 76 00             	lea    0x0(%esi),%esi
+80105630:	5b                   	pop    %ebx
+  return 0;
+80105631:	31 c0                	xor    %eax,%eax
+}
+80105633:	5e                   	pop    %esi
+80105634:	5d                   	pop    %ebp
+80105635:	c3                   	ret
+80105636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010563d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105640 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80105640:	55                   	push   %ebp
+80105641:	89 e5                	mov    %esp,%ebp
+80105643:	57                   	push   %edi
+80105644:	56                   	push   %esi
+80105645:	8b 55 08             	mov    0x8(%ebp),%edx
+80105648:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010564b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+8010564e:	39 d6                	cmp    %edx,%esi
+80105650:	73 26                	jae    80105678 <memmove+0x38>
+80105652:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80105655:	39 ca                	cmp    %ecx,%edx
+80105657:	73 1f                	jae    80105678 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80105659:	85 c0                	test   %eax,%eax
+8010565b:	74 0f                	je     8010566c <memmove+0x2c>
+8010565d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80105660:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80105664:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80105667:	83 e8 01             	sub    $0x1,%eax
+8010566a:	73 f4                	jae    80105660 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+8010566c:	5e                   	pop    %esi
+8010566d:	89 d0                	mov    %edx,%eax
+8010566f:	5f                   	pop    %edi
+80105670:	5d                   	pop    %ebp
+80105671:	c3                   	ret
+80105672:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80105678:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010567b:	89 d7                	mov    %edx,%edi
+8010567d:	85 c0                	test   %eax,%eax
+8010567f:	74 eb                	je     8010566c <memmove+0x2c>
+80105681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80105688:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80105689:	39 ce                	cmp    %ecx,%esi
+8010568b:	75 fb                	jne    80105688 <memmove+0x48>
+}
+8010568d:	5e                   	pop    %esi
+8010568e:	89 d0                	mov    %edx,%eax
+80105690:	5f                   	pop    %edi
+80105691:	5d                   	pop    %ebp
+80105692:	c3                   	ret
+80105693:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010569a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801056a0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+801056a0:	eb 9e                	jmp    80105640 <memmove>
+801056a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801056b0 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+801056b0:	55                   	push   %ebp
+801056b1:	89 e5                	mov    %esp,%ebp
+801056b3:	53                   	push   %ebx
+801056b4:	8b 55 10             	mov    0x10(%ebp),%edx
+801056b7:	8b 45 08             	mov    0x8(%ebp),%eax
+801056ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+801056bd:	85 d2                	test   %edx,%edx
+801056bf:	75 16                	jne    801056d7 <strncmp+0x27>
+801056c1:	eb 2d                	jmp    801056f0 <strncmp+0x40>
+801056c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801056c7:	90                   	nop
+801056c8:	3a 19                	cmp    (%ecx),%bl
+801056ca:	75 12                	jne    801056de <strncmp+0x2e>
+    n--, p++, q++;
+801056cc:	83 c0 01             	add    $0x1,%eax
+801056cf:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+801056d2:	83 ea 01             	sub    $0x1,%edx
+801056d5:	74 19                	je     801056f0 <strncmp+0x40>
+801056d7:	0f b6 18             	movzbl (%eax),%ebx
+801056da:	84 db                	test   %bl,%bl
+801056dc:	75 ea                	jne    801056c8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+801056de:	0f b6 00             	movzbl (%eax),%eax
+801056e1:	0f b6 11             	movzbl (%ecx),%edx
+}
+801056e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801056e7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+801056e8:	29 d0                	sub    %edx,%eax
+}
+801056ea:	c3                   	ret
+801056eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801056ef:	90                   	nop
+801056f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801056f3:	31 c0                	xor    %eax,%eax
+}
+801056f5:	c9                   	leave
+801056f6:	c3                   	ret
+801056f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056fe:	66 90                	xchg   %ax,%ax
+
+80105700 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80105700:	55                   	push   %ebp
+80105701:	89 e5                	mov    %esp,%ebp
+80105703:	57                   	push   %edi
+80105704:	56                   	push   %esi
+80105705:	53                   	push   %ebx
+80105706:	8b 75 08             	mov    0x8(%ebp),%esi
+80105709:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010570c:	89 f0                	mov    %esi,%eax
+8010570e:	eb 15                	jmp    80105725 <strncpy+0x25>
+80105710:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80105714:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80105717:	83 c0 01             	add    $0x1,%eax
+8010571a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+8010571e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80105721:	84 c9                	test   %cl,%cl
+80105723:	74 13                	je     80105738 <strncpy+0x38>
+80105725:	89 d3                	mov    %edx,%ebx
+80105727:	83 ea 01             	sub    $0x1,%edx
+8010572a:	85 db                	test   %ebx,%ebx
+8010572c:	7f e2                	jg     80105710 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+8010572e:	5b                   	pop    %ebx
+8010572f:	89 f0                	mov    %esi,%eax
+80105731:	5e                   	pop    %esi
+80105732:	5f                   	pop    %edi
+80105733:	5d                   	pop    %ebp
+80105734:	c3                   	ret
+80105735:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80105738:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010573b:	83 e9 01             	sub    $0x1,%ecx
+8010573e:	85 d2                	test   %edx,%edx
+80105740:	74 ec                	je     8010572e <strncpy+0x2e>
+80105742:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80105748:	83 c0 01             	add    $0x1,%eax
+8010574b:	89 ca                	mov    %ecx,%edx
+8010574d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80105751:	29 c2                	sub    %eax,%edx
+80105753:	85 d2                	test   %edx,%edx
+80105755:	7f f1                	jg     80105748 <strncpy+0x48>
+}
+80105757:	5b                   	pop    %ebx
+80105758:	89 f0                	mov    %esi,%eax
+8010575a:	5e                   	pop    %esi
+8010575b:	5f                   	pop    %edi
+8010575c:	5d                   	pop    %ebp
+8010575d:	c3                   	ret
+8010575e:	66 90                	xchg   %ax,%ax
+
+80105760 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80105760:	55                   	push   %ebp
+80105761:	89 e5                	mov    %esp,%ebp
+80105763:	56                   	push   %esi
+80105764:	53                   	push   %ebx
+80105765:	8b 55 10             	mov    0x10(%ebp),%edx
+80105768:	8b 75 08             	mov    0x8(%ebp),%esi
+8010576b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+8010576e:	85 d2                	test   %edx,%edx
+80105770:	7e 25                	jle    80105797 <safestrcpy+0x37>
+80105772:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80105776:	89 f2                	mov    %esi,%edx
+80105778:	eb 16                	jmp    80105790 <safestrcpy+0x30>
+8010577a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80105780:	0f b6 08             	movzbl (%eax),%ecx
+80105783:	83 c0 01             	add    $0x1,%eax
+80105786:	83 c2 01             	add    $0x1,%edx
+80105789:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010578c:	84 c9                	test   %cl,%cl
+8010578e:	74 04                	je     80105794 <safestrcpy+0x34>
+80105790:	39 d8                	cmp    %ebx,%eax
+80105792:	75 ec                	jne    80105780 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80105794:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80105797:	89 f0                	mov    %esi,%eax
+80105799:	5b                   	pop    %ebx
+8010579a:	5e                   	pop    %esi
+8010579b:	5d                   	pop    %ebp
+8010579c:	c3                   	ret
+8010579d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801057a0 <strlen>:
+
+int
+strlen(const char *s)
+{
+801057a0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+801057a1:	31 c0                	xor    %eax,%eax
+{
+801057a3:	89 e5                	mov    %esp,%ebp
+801057a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+801057a8:	80 3a 00             	cmpb   $0x0,(%edx)
+801057ab:	74 0c                	je     801057b9 <strlen+0x19>
+801057ad:	8d 76 00             	lea    0x0(%esi),%esi
+801057b0:	83 c0 01             	add    $0x1,%eax
+801057b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+801057b7:	75 f7                	jne    801057b0 <strlen+0x10>
+    ;
+  return n;
+}
+801057b9:	5d                   	pop    %ebp
+801057ba:	c3                   	ret
+
+801057bb <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+801057bb:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+801057bf:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+801057c3:	55                   	push   %ebp
+  pushl %ebx
+801057c4:	53                   	push   %ebx
+  pushl %esi
+801057c5:	56                   	push   %esi
+  pushl %edi
+801057c6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+801057c7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+801057c9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+801057cb:	5f                   	pop    %edi
+  popl %esi
+801057cc:	5e                   	pop    %esi
+  popl %ebx
+801057cd:	5b                   	pop    %ebx
+  popl %ebp
+801057ce:	5d                   	pop    %ebp
+  ret
+801057cf:	c3                   	ret
+
+801057d0 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+801057d0:	55                   	push   %ebp
+801057d1:	89 e5                	mov    %esp,%ebp
+801057d3:	53                   	push   %ebx
+801057d4:	83 ec 04             	sub    $0x4,%esp
+801057d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801057da:	e8 a1 e6 ff ff       	call   80103e80 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801057df:	8b 00                	mov    (%eax),%eax
+801057e1:	39 c3                	cmp    %eax,%ebx
+801057e3:	73 1b                	jae    80105800 <fetchint+0x30>
+801057e5:	8d 53 04             	lea    0x4(%ebx),%edx
+801057e8:	39 d0                	cmp    %edx,%eax
+801057ea:	72 14                	jb     80105800 <fetchint+0x30>
+    return -1;
+  *ip = *(int*)(addr);
+801057ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+801057ef:	8b 13                	mov    (%ebx),%edx
+801057f1:	89 10                	mov    %edx,(%eax)
+  return 0;
+801057f3:	31 c0                	xor    %eax,%eax
+}
+801057f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801057f8:	c9                   	leave
+801057f9:	c3                   	ret
+801057fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80105800:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105805:	eb ee                	jmp    801057f5 <fetchint+0x25>
+80105807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010580e:	66 90                	xchg   %ax,%ax
+
+80105810 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80105810:	55                   	push   %ebp
+80105811:	89 e5                	mov    %esp,%ebp
+80105813:	53                   	push   %ebx
+80105814:	83 ec 04             	sub    $0x4,%esp
+80105817:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010581a:	e8 61 e6 ff ff       	call   80103e80 <myproc>
+
+  if(addr >= curproc->sz)
+8010581f:	3b 18                	cmp    (%eax),%ebx
+80105821:	73 2d                	jae    80105850 <fetchstr+0x40>
+    return -1;
+  *pp = (char*)addr;
+80105823:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105826:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+80105828:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+8010582a:	39 d3                	cmp    %edx,%ebx
+8010582c:	73 22                	jae    80105850 <fetchstr+0x40>
+8010582e:	89 d8                	mov    %ebx,%eax
+80105830:	eb 0d                	jmp    8010583f <fetchstr+0x2f>
+80105832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105838:	83 c0 01             	add    $0x1,%eax
+8010583b:	39 d0                	cmp    %edx,%eax
+8010583d:	73 11                	jae    80105850 <fetchstr+0x40>
+    if(*s == 0)
+8010583f:	80 38 00             	cmpb   $0x0,(%eax)
+80105842:	75 f4                	jne    80105838 <fetchstr+0x28>
+      return s - *pp;
+80105844:	29 d8                	sub    %ebx,%eax
+  }
+  return -1;
+}
+80105846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105849:	c9                   	leave
+8010584a:	c3                   	ret
+8010584b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010584f:	90                   	nop
+80105850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80105853:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105858:	c9                   	leave
+80105859:	c3                   	ret
+8010585a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105860 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80105860:	55                   	push   %ebp
+80105861:	89 e5                	mov    %esp,%ebp
+80105863:	56                   	push   %esi
+80105864:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80105865:	e8 16 e6 ff ff       	call   80103e80 <myproc>
+8010586a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010586d:	8b 40 18             	mov    0x18(%eax),%eax
+80105870:	8b 40 44             	mov    0x44(%eax),%eax
+80105873:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80105876:	e8 05 e6 ff ff       	call   80103e80 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010587b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010587e:	8b 00                	mov    (%eax),%eax
+80105880:	39 c6                	cmp    %eax,%esi
+80105882:	73 1c                	jae    801058a0 <argint+0x40>
+80105884:	8d 53 08             	lea    0x8(%ebx),%edx
+80105887:	39 d0                	cmp    %edx,%eax
+80105889:	72 15                	jb     801058a0 <argint+0x40>
+  *ip = *(int*)(addr);
+8010588b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010588e:	8b 53 04             	mov    0x4(%ebx),%edx
+80105891:	89 10                	mov    %edx,(%eax)
+  return 0;
+80105893:	31 c0                	xor    %eax,%eax
+}
+80105895:	5b                   	pop    %ebx
+80105896:	5e                   	pop    %esi
+80105897:	5d                   	pop    %ebp
+80105898:	c3                   	ret
+80105899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+801058a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801058a5:	eb ee                	jmp    80105895 <argint+0x35>
+801058a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801058ae:	66 90                	xchg   %ax,%ax
+
+801058b0 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801058b0:	55                   	push   %ebp
+801058b1:	89 e5                	mov    %esp,%ebp
+801058b3:	57                   	push   %edi
+801058b4:	56                   	push   %esi
+801058b5:	53                   	push   %ebx
+801058b6:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  struct proc *curproc = myproc();
+801058b9:	e8 c2 e5 ff ff       	call   80103e80 <myproc>
+801058be:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801058c0:	e8 bb e5 ff ff       	call   80103e80 <myproc>
+801058c5:	8b 55 08             	mov    0x8(%ebp),%edx
+801058c8:	8b 40 18             	mov    0x18(%eax),%eax
+801058cb:	8b 40 44             	mov    0x44(%eax),%eax
+801058ce:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+801058d1:	e8 aa e5 ff ff       	call   80103e80 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801058d6:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801058d9:	8b 00                	mov    (%eax),%eax
+801058db:	39 c7                	cmp    %eax,%edi
+801058dd:	73 31                	jae    80105910 <argptr+0x60>
+801058df:	8d 4b 08             	lea    0x8(%ebx),%ecx
+801058e2:	39 c8                	cmp    %ecx,%eax
+801058e4:	72 2a                	jb     80105910 <argptr+0x60>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801058e6:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int*)(addr);
+801058e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801058ec:	85 d2                	test   %edx,%edx
+801058ee:	78 20                	js     80105910 <argptr+0x60>
+801058f0:	8b 16                	mov    (%esi),%edx
+801058f2:	39 d0                	cmp    %edx,%eax
+801058f4:	73 1a                	jae    80105910 <argptr+0x60>
+801058f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801058f9:	01 c3                	add    %eax,%ebx
+801058fb:	39 da                	cmp    %ebx,%edx
+801058fd:	72 11                	jb     80105910 <argptr+0x60>
+    return -1;
+  *pp = (char*)i;
+801058ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105902:	89 02                	mov    %eax,(%edx)
+  return 0;
+80105904:	31 c0                	xor    %eax,%eax
+}
+80105906:	83 c4 0c             	add    $0xc,%esp
+80105909:	5b                   	pop    %ebx
+8010590a:	5e                   	pop    %esi
+8010590b:	5f                   	pop    %edi
+8010590c:	5d                   	pop    %ebp
+8010590d:	c3                   	ret
+8010590e:	66 90                	xchg   %ax,%ax
+    return -1;
+80105910:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105915:	eb ef                	jmp    80105906 <argptr+0x56>
+80105917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010591e:	66 90                	xchg   %ax,%ax
+
+80105920 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80105920:	55                   	push   %ebp
+80105921:	89 e5                	mov    %esp,%ebp
+80105923:	56                   	push   %esi
+80105924:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80105925:	e8 56 e5 ff ff       	call   80103e80 <myproc>
+8010592a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010592d:	8b 40 18             	mov    0x18(%eax),%eax
+80105930:	8b 40 44             	mov    0x44(%eax),%eax
+80105933:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80105936:	e8 45 e5 ff ff       	call   80103e80 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010593b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010593e:	8b 00                	mov    (%eax),%eax
+80105940:	39 c6                	cmp    %eax,%esi
+80105942:	73 44                	jae    80105988 <argstr+0x68>
+80105944:	8d 53 08             	lea    0x8(%ebx),%edx
+80105947:	39 d0                	cmp    %edx,%eax
+80105949:	72 3d                	jb     80105988 <argstr+0x68>
+  *ip = *(int*)(addr);
+8010594b:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+8010594e:	e8 2d e5 ff ff       	call   80103e80 <myproc>
+  if(addr >= curproc->sz)
+80105953:	3b 18                	cmp    (%eax),%ebx
+80105955:	73 31                	jae    80105988 <argstr+0x68>
+  *pp = (char*)addr;
+80105957:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010595a:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+8010595c:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+8010595e:	39 d3                	cmp    %edx,%ebx
+80105960:	73 26                	jae    80105988 <argstr+0x68>
+80105962:	89 d8                	mov    %ebx,%eax
+80105964:	eb 11                	jmp    80105977 <argstr+0x57>
+80105966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010596d:	8d 76 00             	lea    0x0(%esi),%esi
+80105970:	83 c0 01             	add    $0x1,%eax
+80105973:	39 d0                	cmp    %edx,%eax
+80105975:	73 11                	jae    80105988 <argstr+0x68>
+    if(*s == 0)
+80105977:	80 38 00             	cmpb   $0x0,(%eax)
+8010597a:	75 f4                	jne    80105970 <argstr+0x50>
+      return s - *pp;
+8010597c:	29 d8                	sub    %ebx,%eax
+  int addr;
+  if(argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+}
+8010597e:	5b                   	pop    %ebx
+8010597f:	5e                   	pop    %esi
+80105980:	5d                   	pop    %ebp
+80105981:	c3                   	ret
+80105982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105988:	5b                   	pop    %ebx
+    return -1;
+80105989:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010598e:	5e                   	pop    %esi
+8010598f:	5d                   	pop    %ebp
+80105990:	c3                   	ret
+80105991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010599f:	90                   	nop
+
+801059a0 <syscall>:
+[SYS_yield]  sys_yield
+};
+
+void
+syscall(void)
+{
+801059a0:	55                   	push   %ebp
+801059a1:	89 e5                	mov    %esp,%ebp
+801059a3:	53                   	push   %ebx
+801059a4:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+801059a7:	e8 d4 e4 ff ff       	call   80103e80 <myproc>
+801059ac:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+801059ae:	8b 40 18             	mov    0x18(%eax),%eax
+801059b1:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801059b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+801059b7:	83 fa 1a             	cmp    $0x1a,%edx
+801059ba:	77 24                	ja     801059e0 <syscall+0x40>
+801059bc:	8b 14 85 20 8a 10 80 	mov    -0x7fef75e0(,%eax,4),%edx
+801059c3:	85 d2                	test   %edx,%edx
+801059c5:	74 19                	je     801059e0 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+801059c7:	ff d2                	call   *%edx
+801059c9:	89 c2                	mov    %eax,%edx
+801059cb:	8b 43 18             	mov    0x18(%ebx),%eax
+801059ce:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+801059d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801059d4:	c9                   	leave
+801059d5:	c3                   	ret
+801059d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059dd:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+801059e0:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+801059e1:	8d 43 6c             	lea    0x6c(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+801059e4:	50                   	push   %eax
+801059e5:	ff 73 10             	push   0x10(%ebx)
+801059e8:	68 f5 89 10 80       	push   $0x801089f5
+801059ed:	e8 be ac ff ff       	call   801006b0 <cprintf>
+    curproc->tf->eax = -1;
+801059f2:	8b 43 18             	mov    0x18(%ebx),%eax
+801059f5:	83 c4 10             	add    $0x10,%esp
+801059f8:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+801059ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105a02:	c9                   	leave
+80105a03:	c3                   	ret
+80105a04:	66 90                	xchg   %ax,%ax
+80105a06:	66 90                	xchg   %ax,%ax
+80105a08:	66 90                	xchg   %ax,%ax
+80105a0a:	66 90                	xchg   %ax,%ax
+80105a0c:	66 90                	xchg   %ax,%ax
+80105a0e:	66 90                	xchg   %ax,%ax
+
+80105a10 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80105a10:	55                   	push   %ebp
+80105a11:	89 e5                	mov    %esp,%ebp
+80105a13:	57                   	push   %edi
+80105a14:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80105a15:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+80105a18:	53                   	push   %ebx
+80105a19:	83 ec 34             	sub    $0x34,%esp
+80105a1c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80105a1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80105a22:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80105a25:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+80105a28:	57                   	push   %edi
+80105a29:	50                   	push   %eax
+80105a2a:	e8 f1 c6 ff ff       	call   80102120 <nameiparent>
+80105a2f:	83 c4 10             	add    $0x10,%esp
+80105a32:	85 c0                	test   %eax,%eax
+80105a34:	74 5e                	je     80105a94 <create+0x84>
+    return 0;
+  ilock(dp);
+80105a36:	83 ec 0c             	sub    $0xc,%esp
+80105a39:	89 c3                	mov    %eax,%ebx
+80105a3b:	50                   	push   %eax
+80105a3c:	e8 8f bd ff ff       	call   801017d0 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80105a41:	83 c4 0c             	add    $0xc,%esp
+80105a44:	6a 00                	push   $0x0
+80105a46:	57                   	push   %edi
+80105a47:	53                   	push   %ebx
+80105a48:	e8 e3 c2 ff ff       	call   80101d30 <dirlookup>
+80105a4d:	83 c4 10             	add    $0x10,%esp
+80105a50:	89 c6                	mov    %eax,%esi
+80105a52:	85 c0                	test   %eax,%eax
+80105a54:	74 4a                	je     80105aa0 <create+0x90>
+    iunlockput(dp);
+80105a56:	83 ec 0c             	sub    $0xc,%esp
+80105a59:	53                   	push   %ebx
+80105a5a:	e8 01 c0 ff ff       	call   80101a60 <iunlockput>
+    ilock(ip);
+80105a5f:	89 34 24             	mov    %esi,(%esp)
+80105a62:	e8 69 bd ff ff       	call   801017d0 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80105a67:	83 c4 10             	add    $0x10,%esp
+80105a6a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+80105a6f:	75 17                	jne    80105a88 <create+0x78>
+80105a71:	66 83 7e 50 02       	cmpw   $0x2,0x50(%esi)
+80105a76:	75 10                	jne    80105a88 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80105a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105a7b:	89 f0                	mov    %esi,%eax
+80105a7d:	5b                   	pop    %ebx
+80105a7e:	5e                   	pop    %esi
+80105a7f:	5f                   	pop    %edi
+80105a80:	5d                   	pop    %ebp
+80105a81:	c3                   	ret
+80105a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80105a88:	83 ec 0c             	sub    $0xc,%esp
+80105a8b:	56                   	push   %esi
+80105a8c:	e8 cf bf ff ff       	call   80101a60 <iunlockput>
+    return 0;
+80105a91:	83 c4 10             	add    $0x10,%esp
+}
+80105a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80105a97:	31 f6                	xor    %esi,%esi
+}
+80105a99:	5b                   	pop    %ebx
+80105a9a:	89 f0                	mov    %esi,%eax
+80105a9c:	5e                   	pop    %esi
+80105a9d:	5f                   	pop    %edi
+80105a9e:	5d                   	pop    %ebp
+80105a9f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80105aa0:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80105aa4:	83 ec 08             	sub    $0x8,%esp
+80105aa7:	50                   	push   %eax
+80105aa8:	ff 33                	push   (%ebx)
+80105aaa:	e8 b1 bb ff ff       	call   80101660 <ialloc>
+80105aaf:	83 c4 10             	add    $0x10,%esp
+80105ab2:	89 c6                	mov    %eax,%esi
+80105ab4:	85 c0                	test   %eax,%eax
+80105ab6:	0f 84 bc 00 00 00    	je     80105b78 <create+0x168>
+  ilock(ip);
+80105abc:	83 ec 0c             	sub    $0xc,%esp
+80105abf:	50                   	push   %eax
+80105ac0:	e8 0b bd ff ff       	call   801017d0 <ilock>
+  ip->major = major;
+80105ac5:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80105ac9:	66 89 46 52          	mov    %ax,0x52(%esi)
+  ip->minor = minor;
+80105acd:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80105ad1:	66 89 46 54          	mov    %ax,0x54(%esi)
+  ip->nlink = 1;
+80105ad5:	b8 01 00 00 00       	mov    $0x1,%eax
+80105ada:	66 89 46 56          	mov    %ax,0x56(%esi)
+  iupdate(ip);
+80105ade:	89 34 24             	mov    %esi,(%esp)
+80105ae1:	e8 3a bc ff ff       	call   80101720 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80105ae6:	83 c4 10             	add    $0x10,%esp
+80105ae9:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+80105aee:	74 30                	je     80105b20 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+80105af0:	83 ec 04             	sub    $0x4,%esp
+80105af3:	ff 76 04             	push   0x4(%esi)
+80105af6:	57                   	push   %edi
+80105af7:	53                   	push   %ebx
+80105af8:	e8 43 c5 ff ff       	call   80102040 <dirlink>
+80105afd:	83 c4 10             	add    $0x10,%esp
+80105b00:	85 c0                	test   %eax,%eax
+80105b02:	78 67                	js     80105b6b <create+0x15b>
+  iunlockput(dp);
+80105b04:	83 ec 0c             	sub    $0xc,%esp
+80105b07:	53                   	push   %ebx
+80105b08:	e8 53 bf ff ff       	call   80101a60 <iunlockput>
+  return ip;
+80105b0d:	83 c4 10             	add    $0x10,%esp
+}
+80105b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105b13:	89 f0                	mov    %esi,%eax
+80105b15:	5b                   	pop    %ebx
+80105b16:	5e                   	pop    %esi
+80105b17:	5f                   	pop    %edi
+80105b18:	5d                   	pop    %ebp
+80105b19:	c3                   	ret
+80105b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+80105b20:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80105b23:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+    iupdate(dp);
+80105b28:	53                   	push   %ebx
+80105b29:	e8 f2 bb ff ff       	call   80101720 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80105b2e:	83 c4 0c             	add    $0xc,%esp
+80105b31:	ff 76 04             	push   0x4(%esi)
+80105b34:	68 ac 8a 10 80       	push   $0x80108aac
+80105b39:	56                   	push   %esi
+80105b3a:	e8 01 c5 ff ff       	call   80102040 <dirlink>
+80105b3f:	83 c4 10             	add    $0x10,%esp
+80105b42:	85 c0                	test   %eax,%eax
+80105b44:	78 18                	js     80105b5e <create+0x14e>
+80105b46:	83 ec 04             	sub    $0x4,%esp
+80105b49:	ff 73 04             	push   0x4(%ebx)
+80105b4c:	68 ab 8a 10 80       	push   $0x80108aab
+80105b51:	56                   	push   %esi
+80105b52:	e8 e9 c4 ff ff       	call   80102040 <dirlink>
+80105b57:	83 c4 10             	add    $0x10,%esp
+80105b5a:	85 c0                	test   %eax,%eax
+80105b5c:	79 92                	jns    80105af0 <create+0xe0>
+      panic("create dots");
+80105b5e:	83 ec 0c             	sub    $0xc,%esp
+80105b61:	68 9f 8a 10 80       	push   $0x80108a9f
+80105b66:	e8 15 a8 ff ff       	call   80100380 <panic>
+    panic("create: dirlink");
+80105b6b:	83 ec 0c             	sub    $0xc,%esp
+80105b6e:	68 ae 8a 10 80       	push   $0x80108aae
+80105b73:	e8 08 a8 ff ff       	call   80100380 <panic>
+    panic("create: ialloc");
+80105b78:	83 ec 0c             	sub    $0xc,%esp
+80105b7b:	68 90 8a 10 80       	push   $0x80108a90
+80105b80:	e8 fb a7 ff ff       	call   80100380 <panic>
+80105b85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105b90 <sys_dup>:
+{
+80105b90:	55                   	push   %ebp
+80105b91:	89 e5                	mov    %esp,%ebp
+80105b93:	56                   	push   %esi
+80105b94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105b95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80105b98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80105b9b:	50                   	push   %eax
+80105b9c:	6a 00                	push   $0x0
+80105b9e:	e8 bd fc ff ff       	call   80105860 <argint>
+80105ba3:	83 c4 10             	add    $0x10,%esp
+80105ba6:	85 c0                	test   %eax,%eax
+80105ba8:	78 36                	js     80105be0 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105baa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105bae:	77 30                	ja     80105be0 <sys_dup+0x50>
+80105bb0:	e8 cb e2 ff ff       	call   80103e80 <myproc>
+80105bb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105bb8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80105bbc:	85 f6                	test   %esi,%esi
+80105bbe:	74 20                	je     80105be0 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+80105bc0:	e8 bb e2 ff ff       	call   80103e80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80105bc5:	31 db                	xor    %ebx,%ebx
+80105bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105bce:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+80105bd0:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+80105bd4:	85 d2                	test   %edx,%edx
+80105bd6:	74 18                	je     80105bf0 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+80105bd8:	83 c3 01             	add    $0x1,%ebx
+80105bdb:	83 fb 10             	cmp    $0x10,%ebx
+80105bde:	75 f0                	jne    80105bd0 <sys_dup+0x40>
+}
+80105be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80105be3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80105be8:	89 d8                	mov    %ebx,%eax
+80105bea:	5b                   	pop    %ebx
+80105beb:	5e                   	pop    %esi
+80105bec:	5d                   	pop    %ebp
+80105bed:	c3                   	ret
+80105bee:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80105bf0:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80105bf3:	89 74 98 28          	mov    %esi,0x28(%eax,%ebx,4)
+  filedup(f);
+80105bf7:	56                   	push   %esi
+80105bf8:	e8 f3 b2 ff ff       	call   80100ef0 <filedup>
+  return fd;
+80105bfd:	83 c4 10             	add    $0x10,%esp
+}
+80105c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105c03:	89 d8                	mov    %ebx,%eax
+80105c05:	5b                   	pop    %ebx
+80105c06:	5e                   	pop    %esi
+80105c07:	5d                   	pop    %ebp
+80105c08:	c3                   	ret
+80105c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105c10 <sys_read>:
+{
+80105c10:	55                   	push   %ebp
+80105c11:	89 e5                	mov    %esp,%ebp
+80105c13:	56                   	push   %esi
+80105c14:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105c15:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80105c18:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80105c1b:	53                   	push   %ebx
+80105c1c:	6a 00                	push   $0x0
+80105c1e:	e8 3d fc ff ff       	call   80105860 <argint>
+80105c23:	83 c4 10             	add    $0x10,%esp
+80105c26:	85 c0                	test   %eax,%eax
+80105c28:	78 5e                	js     80105c88 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105c2a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105c2e:	77 58                	ja     80105c88 <sys_read+0x78>
+80105c30:	e8 4b e2 ff ff       	call   80103e80 <myproc>
+80105c35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105c38:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80105c3c:	85 f6                	test   %esi,%esi
+80105c3e:	74 48                	je     80105c88 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80105c40:	83 ec 08             	sub    $0x8,%esp
+80105c43:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105c46:	50                   	push   %eax
+80105c47:	6a 02                	push   $0x2
+80105c49:	e8 12 fc ff ff       	call   80105860 <argint>
+80105c4e:	83 c4 10             	add    $0x10,%esp
+80105c51:	85 c0                	test   %eax,%eax
+80105c53:	78 33                	js     80105c88 <sys_read+0x78>
+80105c55:	83 ec 04             	sub    $0x4,%esp
+80105c58:	ff 75 f0             	push   -0x10(%ebp)
+80105c5b:	53                   	push   %ebx
+80105c5c:	6a 01                	push   $0x1
+80105c5e:	e8 4d fc ff ff       	call   801058b0 <argptr>
+80105c63:	83 c4 10             	add    $0x10,%esp
+80105c66:	85 c0                	test   %eax,%eax
+80105c68:	78 1e                	js     80105c88 <sys_read+0x78>
+  return fileread(f, p, n);
+80105c6a:	83 ec 04             	sub    $0x4,%esp
+80105c6d:	ff 75 f0             	push   -0x10(%ebp)
+80105c70:	ff 75 f4             	push   -0xc(%ebp)
+80105c73:	56                   	push   %esi
+80105c74:	e8 f7 b3 ff ff       	call   80101070 <fileread>
+80105c79:	83 c4 10             	add    $0x10,%esp
+}
+80105c7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105c7f:	5b                   	pop    %ebx
+80105c80:	5e                   	pop    %esi
+80105c81:	5d                   	pop    %ebp
+80105c82:	c3                   	ret
+80105c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105c87:	90                   	nop
+    return -1;
+80105c88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105c8d:	eb ed                	jmp    80105c7c <sys_read+0x6c>
+80105c8f:	90                   	nop
+
+80105c90 <sys_write>:
+{
+80105c90:	55                   	push   %ebp
+80105c91:	89 e5                	mov    %esp,%ebp
+80105c93:	56                   	push   %esi
+80105c94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105c95:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80105c98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80105c9b:	53                   	push   %ebx
+80105c9c:	6a 00                	push   $0x0
+80105c9e:	e8 bd fb ff ff       	call   80105860 <argint>
+80105ca3:	83 c4 10             	add    $0x10,%esp
+80105ca6:	85 c0                	test   %eax,%eax
+80105ca8:	78 5e                	js     80105d08 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105caa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105cae:	77 58                	ja     80105d08 <sys_write+0x78>
+80105cb0:	e8 cb e1 ff ff       	call   80103e80 <myproc>
+80105cb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105cb8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80105cbc:	85 f6                	test   %esi,%esi
+80105cbe:	74 48                	je     80105d08 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80105cc0:	83 ec 08             	sub    $0x8,%esp
+80105cc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105cc6:	50                   	push   %eax
+80105cc7:	6a 02                	push   $0x2
+80105cc9:	e8 92 fb ff ff       	call   80105860 <argint>
+80105cce:	83 c4 10             	add    $0x10,%esp
+80105cd1:	85 c0                	test   %eax,%eax
+80105cd3:	78 33                	js     80105d08 <sys_write+0x78>
+80105cd5:	83 ec 04             	sub    $0x4,%esp
+80105cd8:	ff 75 f0             	push   -0x10(%ebp)
+80105cdb:	53                   	push   %ebx
+80105cdc:	6a 01                	push   $0x1
+80105cde:	e8 cd fb ff ff       	call   801058b0 <argptr>
+80105ce3:	83 c4 10             	add    $0x10,%esp
+80105ce6:	85 c0                	test   %eax,%eax
+80105ce8:	78 1e                	js     80105d08 <sys_write+0x78>
+  return filewrite(f, p, n);
+80105cea:	83 ec 04             	sub    $0x4,%esp
+80105ced:	ff 75 f0             	push   -0x10(%ebp)
+80105cf0:	ff 75 f4             	push   -0xc(%ebp)
+80105cf3:	56                   	push   %esi
+80105cf4:	e8 07 b4 ff ff       	call   80101100 <filewrite>
+80105cf9:	83 c4 10             	add    $0x10,%esp
+}
+80105cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105cff:	5b                   	pop    %ebx
+80105d00:	5e                   	pop    %esi
+80105d01:	5d                   	pop    %ebp
+80105d02:	c3                   	ret
+80105d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105d07:	90                   	nop
+    return -1;
+80105d08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105d0d:	eb ed                	jmp    80105cfc <sys_write+0x6c>
+80105d0f:	90                   	nop
+
+80105d10 <sys_close>:
+{
+80105d10:	55                   	push   %ebp
+80105d11:	89 e5                	mov    %esp,%ebp
+80105d13:	56                   	push   %esi
+80105d14:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105d15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80105d18:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80105d1b:	50                   	push   %eax
+80105d1c:	6a 00                	push   $0x0
+80105d1e:	e8 3d fb ff ff       	call   80105860 <argint>
+80105d23:	83 c4 10             	add    $0x10,%esp
+80105d26:	85 c0                	test   %eax,%eax
+80105d28:	78 3e                	js     80105d68 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105d2a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105d2e:	77 38                	ja     80105d68 <sys_close+0x58>
+80105d30:	e8 4b e1 ff ff       	call   80103e80 <myproc>
+80105d35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105d38:	8d 5a 08             	lea    0x8(%edx),%ebx
+80105d3b:	8b 74 98 08          	mov    0x8(%eax,%ebx,4),%esi
+80105d3f:	85 f6                	test   %esi,%esi
+80105d41:	74 25                	je     80105d68 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80105d43:	e8 38 e1 ff ff       	call   80103e80 <myproc>
+  fileclose(f);
+80105d48:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+80105d4b:	c7 44 98 08 00 00 00 	movl   $0x0,0x8(%eax,%ebx,4)
+80105d52:	00 
+  fileclose(f);
+80105d53:	56                   	push   %esi
+80105d54:	e8 e7 b1 ff ff       	call   80100f40 <fileclose>
+  return 0;
+80105d59:	83 c4 10             	add    $0x10,%esp
+80105d5c:	31 c0                	xor    %eax,%eax
+}
+80105d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105d61:	5b                   	pop    %ebx
+80105d62:	5e                   	pop    %esi
+80105d63:	5d                   	pop    %ebp
+80105d64:	c3                   	ret
+80105d65:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80105d68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105d6d:	eb ef                	jmp    80105d5e <sys_close+0x4e>
+80105d6f:	90                   	nop
+
+80105d70 <sys_fstat>:
+{
+80105d70:	55                   	push   %ebp
+80105d71:	89 e5                	mov    %esp,%ebp
+80105d73:	56                   	push   %esi
+80105d74:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105d75:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80105d78:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80105d7b:	53                   	push   %ebx
+80105d7c:	6a 00                	push   $0x0
+80105d7e:	e8 dd fa ff ff       	call   80105860 <argint>
+80105d83:	83 c4 10             	add    $0x10,%esp
+80105d86:	85 c0                	test   %eax,%eax
+80105d88:	78 46                	js     80105dd0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80105d8a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80105d8e:	77 40                	ja     80105dd0 <sys_fstat+0x60>
+80105d90:	e8 eb e0 ff ff       	call   80103e80 <myproc>
+80105d95:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105d98:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80105d9c:	85 f6                	test   %esi,%esi
+80105d9e:	74 30                	je     80105dd0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80105da0:	83 ec 04             	sub    $0x4,%esp
+80105da3:	6a 14                	push   $0x14
+80105da5:	53                   	push   %ebx
+80105da6:	6a 01                	push   $0x1
+80105da8:	e8 03 fb ff ff       	call   801058b0 <argptr>
+80105dad:	83 c4 10             	add    $0x10,%esp
+80105db0:	85 c0                	test   %eax,%eax
+80105db2:	78 1c                	js     80105dd0 <sys_fstat+0x60>
+  return filestat(f, st);
+80105db4:	83 ec 08             	sub    $0x8,%esp
+80105db7:	ff 75 f4             	push   -0xc(%ebp)
+80105dba:	56                   	push   %esi
+80105dbb:	e8 60 b2 ff ff       	call   80101020 <filestat>
+80105dc0:	83 c4 10             	add    $0x10,%esp
+}
+80105dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105dc6:	5b                   	pop    %ebx
+80105dc7:	5e                   	pop    %esi
+80105dc8:	5d                   	pop    %ebp
+80105dc9:	c3                   	ret
+80105dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80105dd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105dd5:	eb ec                	jmp    80105dc3 <sys_fstat+0x53>
+80105dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dde:	66 90                	xchg   %ax,%ax
+
+80105de0 <sys_link>:
+{
+80105de0:	55                   	push   %ebp
+80105de1:	89 e5                	mov    %esp,%ebp
+80105de3:	57                   	push   %edi
+80105de4:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80105de5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80105de8:	53                   	push   %ebx
+80105de9:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80105dec:	50                   	push   %eax
+80105ded:	6a 00                	push   $0x0
+80105def:	e8 2c fb ff ff       	call   80105920 <argstr>
+80105df4:	83 c4 10             	add    $0x10,%esp
+80105df7:	85 c0                	test   %eax,%eax
+80105df9:	0f 88 fb 00 00 00    	js     80105efa <sys_link+0x11a>
+80105dff:	83 ec 08             	sub    $0x8,%esp
+80105e02:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80105e05:	50                   	push   %eax
+80105e06:	6a 01                	push   $0x1
+80105e08:	e8 13 fb ff ff       	call   80105920 <argstr>
+80105e0d:	83 c4 10             	add    $0x10,%esp
+80105e10:	85 c0                	test   %eax,%eax
+80105e12:	0f 88 e2 00 00 00    	js     80105efa <sys_link+0x11a>
+  begin_op();
+80105e18:	e8 43 d0 ff ff       	call   80102e60 <begin_op>
+  if((ip = namei(old)) == 0){
+80105e1d:	83 ec 0c             	sub    $0xc,%esp
+80105e20:	ff 75 d4             	push   -0x2c(%ebp)
+80105e23:	e8 d8 c2 ff ff       	call   80102100 <namei>
+80105e28:	83 c4 10             	add    $0x10,%esp
+80105e2b:	89 c3                	mov    %eax,%ebx
+80105e2d:	85 c0                	test   %eax,%eax
+80105e2f:	0f 84 df 00 00 00    	je     80105f14 <sys_link+0x134>
+  ilock(ip);
+80105e35:	83 ec 0c             	sub    $0xc,%esp
+80105e38:	50                   	push   %eax
+80105e39:	e8 92 b9 ff ff       	call   801017d0 <ilock>
+  if(ip->type == T_DIR){
+80105e3e:	83 c4 10             	add    $0x10,%esp
+80105e41:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105e46:	0f 84 b5 00 00 00    	je     80105f01 <sys_link+0x121>
+  iupdate(ip);
+80105e4c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+80105e4f:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80105e54:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80105e57:	53                   	push   %ebx
+80105e58:	e8 c3 b8 ff ff       	call   80101720 <iupdate>
+  iunlock(ip);
+80105e5d:	89 1c 24             	mov    %ebx,(%esp)
+80105e60:	e8 4b ba ff ff       	call   801018b0 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80105e65:	58                   	pop    %eax
+80105e66:	5a                   	pop    %edx
+80105e67:	57                   	push   %edi
+80105e68:	ff 75 d0             	push   -0x30(%ebp)
+80105e6b:	e8 b0 c2 ff ff       	call   80102120 <nameiparent>
+80105e70:	83 c4 10             	add    $0x10,%esp
+80105e73:	89 c6                	mov    %eax,%esi
+80105e75:	85 c0                	test   %eax,%eax
+80105e77:	74 5b                	je     80105ed4 <sys_link+0xf4>
+  ilock(dp);
+80105e79:	83 ec 0c             	sub    $0xc,%esp
+80105e7c:	50                   	push   %eax
+80105e7d:	e8 4e b9 ff ff       	call   801017d0 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80105e82:	8b 03                	mov    (%ebx),%eax
+80105e84:	83 c4 10             	add    $0x10,%esp
+80105e87:	39 06                	cmp    %eax,(%esi)
+80105e89:	75 3d                	jne    80105ec8 <sys_link+0xe8>
+80105e8b:	83 ec 04             	sub    $0x4,%esp
+80105e8e:	ff 73 04             	push   0x4(%ebx)
+80105e91:	57                   	push   %edi
+80105e92:	56                   	push   %esi
+80105e93:	e8 a8 c1 ff ff       	call   80102040 <dirlink>
+80105e98:	83 c4 10             	add    $0x10,%esp
+80105e9b:	85 c0                	test   %eax,%eax
+80105e9d:	78 29                	js     80105ec8 <sys_link+0xe8>
+  iunlockput(dp);
+80105e9f:	83 ec 0c             	sub    $0xc,%esp
+80105ea2:	56                   	push   %esi
+80105ea3:	e8 b8 bb ff ff       	call   80101a60 <iunlockput>
+  iput(ip);
+80105ea8:	89 1c 24             	mov    %ebx,(%esp)
+80105eab:	e8 50 ba ff ff       	call   80101900 <iput>
+  end_op();
+80105eb0:	e8 1b d0 ff ff       	call   80102ed0 <end_op>
+  return 0;
+80105eb5:	83 c4 10             	add    $0x10,%esp
+80105eb8:	31 c0                	xor    %eax,%eax
+}
+80105eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105ebd:	5b                   	pop    %ebx
+80105ebe:	5e                   	pop    %esi
+80105ebf:	5f                   	pop    %edi
+80105ec0:	5d                   	pop    %ebp
+80105ec1:	c3                   	ret
+80105ec2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80105ec8:	83 ec 0c             	sub    $0xc,%esp
+80105ecb:	56                   	push   %esi
+80105ecc:	e8 8f bb ff ff       	call   80101a60 <iunlockput>
+    goto bad;
+80105ed1:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80105ed4:	83 ec 0c             	sub    $0xc,%esp
+80105ed7:	53                   	push   %ebx
+80105ed8:	e8 f3 b8 ff ff       	call   801017d0 <ilock>
+  ip->nlink--;
+80105edd:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+80105ee2:	89 1c 24             	mov    %ebx,(%esp)
+80105ee5:	e8 36 b8 ff ff       	call   80101720 <iupdate>
+  iunlockput(ip);
+80105eea:	89 1c 24             	mov    %ebx,(%esp)
+80105eed:	e8 6e bb ff ff       	call   80101a60 <iunlockput>
+  end_op();
+80105ef2:	e8 d9 cf ff ff       	call   80102ed0 <end_op>
+  return -1;
+80105ef7:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80105efa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105eff:	eb b9                	jmp    80105eba <sys_link+0xda>
+    iunlockput(ip);
+80105f01:	83 ec 0c             	sub    $0xc,%esp
+80105f04:	53                   	push   %ebx
+80105f05:	e8 56 bb ff ff       	call   80101a60 <iunlockput>
+    end_op();
+80105f0a:	e8 c1 cf ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105f0f:	83 c4 10             	add    $0x10,%esp
+80105f12:	eb e6                	jmp    80105efa <sys_link+0x11a>
+    end_op();
+80105f14:	e8 b7 cf ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105f19:	eb df                	jmp    80105efa <sys_link+0x11a>
+80105f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105f1f:	90                   	nop
+
+80105f20 <sys_unlink>:
+{
+80105f20:	55                   	push   %ebp
+80105f21:	89 e5                	mov    %esp,%ebp
+80105f23:	57                   	push   %edi
+80105f24:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80105f25:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80105f28:	53                   	push   %ebx
+80105f29:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+80105f2c:	50                   	push   %eax
+80105f2d:	6a 00                	push   $0x0
+80105f2f:	e8 ec f9 ff ff       	call   80105920 <argstr>
+80105f34:	83 c4 10             	add    $0x10,%esp
+80105f37:	85 c0                	test   %eax,%eax
+80105f39:	0f 88 54 01 00 00    	js     80106093 <sys_unlink+0x173>
+  begin_op();
+80105f3f:	e8 1c cf ff ff       	call   80102e60 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80105f44:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80105f47:	83 ec 08             	sub    $0x8,%esp
+80105f4a:	53                   	push   %ebx
+80105f4b:	ff 75 c0             	push   -0x40(%ebp)
+80105f4e:	e8 cd c1 ff ff       	call   80102120 <nameiparent>
+80105f53:	83 c4 10             	add    $0x10,%esp
+80105f56:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80105f59:	85 c0                	test   %eax,%eax
+80105f5b:	0f 84 58 01 00 00    	je     801060b9 <sys_unlink+0x199>
+  ilock(dp);
+80105f61:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80105f64:	83 ec 0c             	sub    $0xc,%esp
+80105f67:	57                   	push   %edi
+80105f68:	e8 63 b8 ff ff       	call   801017d0 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80105f6d:	58                   	pop    %eax
+80105f6e:	5a                   	pop    %edx
+80105f6f:	68 ac 8a 10 80       	push   $0x80108aac
+80105f74:	53                   	push   %ebx
+80105f75:	e8 96 bd ff ff       	call   80101d10 <namecmp>
+80105f7a:	83 c4 10             	add    $0x10,%esp
+80105f7d:	85 c0                	test   %eax,%eax
+80105f7f:	0f 84 fb 00 00 00    	je     80106080 <sys_unlink+0x160>
+80105f85:	83 ec 08             	sub    $0x8,%esp
+80105f88:	68 ab 8a 10 80       	push   $0x80108aab
+80105f8d:	53                   	push   %ebx
+80105f8e:	e8 7d bd ff ff       	call   80101d10 <namecmp>
+80105f93:	83 c4 10             	add    $0x10,%esp
+80105f96:	85 c0                	test   %eax,%eax
+80105f98:	0f 84 e2 00 00 00    	je     80106080 <sys_unlink+0x160>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80105f9e:	83 ec 04             	sub    $0x4,%esp
+80105fa1:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80105fa4:	50                   	push   %eax
+80105fa5:	53                   	push   %ebx
+80105fa6:	57                   	push   %edi
+80105fa7:	e8 84 bd ff ff       	call   80101d30 <dirlookup>
+80105fac:	83 c4 10             	add    $0x10,%esp
+80105faf:	89 c3                	mov    %eax,%ebx
+80105fb1:	85 c0                	test   %eax,%eax
+80105fb3:	0f 84 c7 00 00 00    	je     80106080 <sys_unlink+0x160>
+  ilock(ip);
+80105fb9:	83 ec 0c             	sub    $0xc,%esp
+80105fbc:	50                   	push   %eax
+80105fbd:	e8 0e b8 ff ff       	call   801017d0 <ilock>
+  if(ip->nlink < 1)
+80105fc2:	83 c4 10             	add    $0x10,%esp
+80105fc5:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80105fca:	0f 8e 0a 01 00 00    	jle    801060da <sys_unlink+0x1ba>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80105fd0:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105fd5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80105fd8:	74 66                	je     80106040 <sys_unlink+0x120>
+  memset(&de, 0, sizeof(de));
+80105fda:	83 ec 04             	sub    $0x4,%esp
+80105fdd:	6a 10                	push   $0x10
+80105fdf:	6a 00                	push   $0x0
+80105fe1:	57                   	push   %edi
+80105fe2:	e8 c9 f5 ff ff       	call   801055b0 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80105fe7:	6a 10                	push   $0x10
+80105fe9:	ff 75 c4             	push   -0x3c(%ebp)
+80105fec:	57                   	push   %edi
+80105fed:	ff 75 b4             	push   -0x4c(%ebp)
+80105ff0:	e8 eb bb ff ff       	call   80101be0 <writei>
+80105ff5:	83 c4 20             	add    $0x20,%esp
+80105ff8:	83 f8 10             	cmp    $0x10,%eax
+80105ffb:	0f 85 cc 00 00 00    	jne    801060cd <sys_unlink+0x1ad>
+  if(ip->type == T_DIR){
+80106001:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80106006:	0f 84 94 00 00 00    	je     801060a0 <sys_unlink+0x180>
+  iunlockput(dp);
+8010600c:	83 ec 0c             	sub    $0xc,%esp
+8010600f:	ff 75 b4             	push   -0x4c(%ebp)
+80106012:	e8 49 ba ff ff       	call   80101a60 <iunlockput>
+  ip->nlink--;
+80106017:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+8010601c:	89 1c 24             	mov    %ebx,(%esp)
+8010601f:	e8 fc b6 ff ff       	call   80101720 <iupdate>
+  iunlockput(ip);
+80106024:	89 1c 24             	mov    %ebx,(%esp)
+80106027:	e8 34 ba ff ff       	call   80101a60 <iunlockput>
+  end_op();
+8010602c:	e8 9f ce ff ff       	call   80102ed0 <end_op>
+  return 0;
+80106031:	83 c4 10             	add    $0x10,%esp
+80106034:	31 c0                	xor    %eax,%eax
+}
+80106036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106039:	5b                   	pop    %ebx
+8010603a:	5e                   	pop    %esi
+8010603b:	5f                   	pop    %edi
+8010603c:	5d                   	pop    %ebp
+8010603d:	c3                   	ret
+8010603e:	66 90                	xchg   %ax,%ax
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80106040:	83 7b 58 20          	cmpl   $0x20,0x58(%ebx)
+80106044:	76 94                	jbe    80105fda <sys_unlink+0xba>
+80106046:	be 20 00 00 00       	mov    $0x20,%esi
+8010604b:	eb 0b                	jmp    80106058 <sys_unlink+0x138>
+8010604d:	8d 76 00             	lea    0x0(%esi),%esi
+80106050:	83 c6 10             	add    $0x10,%esi
+80106053:	3b 73 58             	cmp    0x58(%ebx),%esi
+80106056:	73 82                	jae    80105fda <sys_unlink+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80106058:	6a 10                	push   $0x10
+8010605a:	56                   	push   %esi
+8010605b:	57                   	push   %edi
+8010605c:	53                   	push   %ebx
+8010605d:	e8 7e ba ff ff       	call   80101ae0 <readi>
+80106062:	83 c4 10             	add    $0x10,%esp
+80106065:	83 f8 10             	cmp    $0x10,%eax
+80106068:	75 56                	jne    801060c0 <sys_unlink+0x1a0>
+    if(de.inum != 0)
+8010606a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010606f:	74 df                	je     80106050 <sys_unlink+0x130>
+    iunlockput(ip);
+80106071:	83 ec 0c             	sub    $0xc,%esp
+80106074:	53                   	push   %ebx
+80106075:	e8 e6 b9 ff ff       	call   80101a60 <iunlockput>
+    goto bad;
+8010607a:	83 c4 10             	add    $0x10,%esp
+8010607d:	8d 76 00             	lea    0x0(%esi),%esi
+  iunlockput(dp);
+80106080:	83 ec 0c             	sub    $0xc,%esp
+80106083:	ff 75 b4             	push   -0x4c(%ebp)
+80106086:	e8 d5 b9 ff ff       	call   80101a60 <iunlockput>
+  end_op();
+8010608b:	e8 40 ce ff ff       	call   80102ed0 <end_op>
+  return -1;
+80106090:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106093:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106098:	eb 9c                	jmp    80106036 <sys_unlink+0x116>
+8010609a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+801060a0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+801060a3:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+801060a6:	66 83 68 56 01       	subw   $0x1,0x56(%eax)
+    iupdate(dp);
+801060ab:	50                   	push   %eax
+801060ac:	e8 6f b6 ff ff       	call   80101720 <iupdate>
+801060b1:	83 c4 10             	add    $0x10,%esp
+801060b4:	e9 53 ff ff ff       	jmp    8010600c <sys_unlink+0xec>
+    end_op();
+801060b9:	e8 12 ce ff ff       	call   80102ed0 <end_op>
+    return -1;
+801060be:	eb d3                	jmp    80106093 <sys_unlink+0x173>
+      panic("isdirempty: readi");
+801060c0:	83 ec 0c             	sub    $0xc,%esp
+801060c3:	68 d0 8a 10 80       	push   $0x80108ad0
+801060c8:	e8 b3 a2 ff ff       	call   80100380 <panic>
+    panic("unlink: writei");
+801060cd:	83 ec 0c             	sub    $0xc,%esp
+801060d0:	68 e2 8a 10 80       	push   $0x80108ae2
+801060d5:	e8 a6 a2 ff ff       	call   80100380 <panic>
+    panic("unlink: nlink < 1");
+801060da:	83 ec 0c             	sub    $0xc,%esp
+801060dd:	68 be 8a 10 80       	push   $0x80108abe
+801060e2:	e8 99 a2 ff ff       	call   80100380 <panic>
+801060e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801060ee:	66 90                	xchg   %ax,%ax
+
+801060f0 <sys_open>:
+
+int
+sys_open(void)
+{
+801060f0:	55                   	push   %ebp
+801060f1:	89 e5                	mov    %esp,%ebp
+801060f3:	57                   	push   %edi
+801060f4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801060f5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+801060f8:	53                   	push   %ebx
+801060f9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801060fc:	50                   	push   %eax
+801060fd:	6a 00                	push   $0x0
+801060ff:	e8 1c f8 ff ff       	call   80105920 <argstr>
+80106104:	83 c4 10             	add    $0x10,%esp
+80106107:	85 c0                	test   %eax,%eax
+80106109:	0f 88 8e 00 00 00    	js     8010619d <sys_open+0xad>
+8010610f:	83 ec 08             	sub    $0x8,%esp
+80106112:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80106115:	50                   	push   %eax
+80106116:	6a 01                	push   $0x1
+80106118:	e8 43 f7 ff ff       	call   80105860 <argint>
+8010611d:	83 c4 10             	add    $0x10,%esp
+80106120:	85 c0                	test   %eax,%eax
+80106122:	78 79                	js     8010619d <sys_open+0xad>
+    return -1;
+
+  begin_op();
+80106124:	e8 37 cd ff ff       	call   80102e60 <begin_op>
+
+  if(omode & O_CREATE){
+80106129:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+8010612d:	75 79                	jne    801061a8 <sys_open+0xb8>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+8010612f:	83 ec 0c             	sub    $0xc,%esp
+80106132:	ff 75 e0             	push   -0x20(%ebp)
+80106135:	e8 c6 bf ff ff       	call   80102100 <namei>
+8010613a:	83 c4 10             	add    $0x10,%esp
+8010613d:	89 c6                	mov    %eax,%esi
+8010613f:	85 c0                	test   %eax,%eax
+80106141:	0f 84 7e 00 00 00    	je     801061c5 <sys_open+0xd5>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80106147:	83 ec 0c             	sub    $0xc,%esp
+8010614a:	50                   	push   %eax
+8010614b:	e8 80 b6 ff ff       	call   801017d0 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80106150:	83 c4 10             	add    $0x10,%esp
+80106153:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80106158:	0f 84 ba 00 00 00    	je     80106218 <sys_open+0x128>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+8010615e:	e8 1d ad ff ff       	call   80100e80 <filealloc>
+80106163:	89 c7                	mov    %eax,%edi
+80106165:	85 c0                	test   %eax,%eax
+80106167:	74 23                	je     8010618c <sys_open+0x9c>
+  struct proc *curproc = myproc();
+80106169:	e8 12 dd ff ff       	call   80103e80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010616e:	31 db                	xor    %ebx,%ebx
+    if(curproc->ofile[fd] == 0){
+80106170:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+80106174:	85 d2                	test   %edx,%edx
+80106176:	74 58                	je     801061d0 <sys_open+0xe0>
+  for(fd = 0; fd < NOFILE; fd++){
+80106178:	83 c3 01             	add    $0x1,%ebx
+8010617b:	83 fb 10             	cmp    $0x10,%ebx
+8010617e:	75 f0                	jne    80106170 <sys_open+0x80>
+    if(f)
+      fileclose(f);
+80106180:	83 ec 0c             	sub    $0xc,%esp
+80106183:	57                   	push   %edi
+80106184:	e8 b7 ad ff ff       	call   80100f40 <fileclose>
+80106189:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010618c:	83 ec 0c             	sub    $0xc,%esp
+8010618f:	56                   	push   %esi
+80106190:	e8 cb b8 ff ff       	call   80101a60 <iunlockput>
+    end_op();
+80106195:	e8 36 cd ff ff       	call   80102ed0 <end_op>
+    return -1;
+8010619a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010619d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801061a2:	eb 65                	jmp    80106209 <sys_open+0x119>
+801061a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+801061a8:	83 ec 0c             	sub    $0xc,%esp
+801061ab:	31 c9                	xor    %ecx,%ecx
+801061ad:	ba 02 00 00 00       	mov    $0x2,%edx
+801061b2:	6a 00                	push   $0x0
+801061b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801061b7:	e8 54 f8 ff ff       	call   80105a10 <create>
+    if(ip == 0){
+801061bc:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801061bf:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801061c1:	85 c0                	test   %eax,%eax
+801061c3:	75 99                	jne    8010615e <sys_open+0x6e>
+      end_op();
+801061c5:	e8 06 cd ff ff       	call   80102ed0 <end_op>
+      return -1;
+801061ca:	eb d1                	jmp    8010619d <sys_open+0xad>
+801061cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+801061d0:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801061d3:	89 7c 98 28          	mov    %edi,0x28(%eax,%ebx,4)
+  iunlock(ip);
+801061d7:	56                   	push   %esi
+801061d8:	e8 d3 b6 ff ff       	call   801018b0 <iunlock>
+  end_op();
+801061dd:	e8 ee cc ff ff       	call   80102ed0 <end_op>
+
+  f->type = FD_INODE;
+801061e2:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+801061e8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801061eb:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+801061ee:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+801061f1:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+801061f3:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+801061fa:	f7 d0                	not    %eax
+801061fc:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801061ff:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+80106202:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80106205:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+80106209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010620c:	89 d8                	mov    %ebx,%eax
+8010620e:	5b                   	pop    %ebx
+8010620f:	5e                   	pop    %esi
+80106210:	5f                   	pop    %edi
+80106211:	5d                   	pop    %ebp
+80106212:	c3                   	ret
+80106213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106217:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80106218:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010621b:	85 c9                	test   %ecx,%ecx
+8010621d:	0f 84 3b ff ff ff    	je     8010615e <sys_open+0x6e>
+80106223:	e9 64 ff ff ff       	jmp    8010618c <sys_open+0x9c>
+80106228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010622f:	90                   	nop
+
+80106230 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80106230:	55                   	push   %ebp
+80106231:	89 e5                	mov    %esp,%ebp
+80106233:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80106236:	e8 25 cc ff ff       	call   80102e60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010623b:	83 ec 08             	sub    $0x8,%esp
+8010623e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106241:	50                   	push   %eax
+80106242:	6a 00                	push   $0x0
+80106244:	e8 d7 f6 ff ff       	call   80105920 <argstr>
+80106249:	83 c4 10             	add    $0x10,%esp
+8010624c:	85 c0                	test   %eax,%eax
+8010624e:	78 30                	js     80106280 <sys_mkdir+0x50>
+80106250:	83 ec 0c             	sub    $0xc,%esp
+80106253:	31 c9                	xor    %ecx,%ecx
+80106255:	ba 01 00 00 00       	mov    $0x1,%edx
+8010625a:	6a 00                	push   $0x0
+8010625c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010625f:	e8 ac f7 ff ff       	call   80105a10 <create>
+80106264:	83 c4 10             	add    $0x10,%esp
+80106267:	85 c0                	test   %eax,%eax
+80106269:	74 15                	je     80106280 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010626b:	83 ec 0c             	sub    $0xc,%esp
+8010626e:	50                   	push   %eax
+8010626f:	e8 ec b7 ff ff       	call   80101a60 <iunlockput>
+  end_op();
+80106274:	e8 57 cc ff ff       	call   80102ed0 <end_op>
+  return 0;
+80106279:	83 c4 10             	add    $0x10,%esp
+8010627c:	31 c0                	xor    %eax,%eax
+}
+8010627e:	c9                   	leave
+8010627f:	c3                   	ret
+    end_op();
+80106280:	e8 4b cc ff ff       	call   80102ed0 <end_op>
+    return -1;
+80106285:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010628a:	c9                   	leave
+8010628b:	c3                   	ret
+8010628c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106290 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80106290:	55                   	push   %ebp
+80106291:	89 e5                	mov    %esp,%ebp
+80106293:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80106296:	e8 c5 cb ff ff       	call   80102e60 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010629b:	83 ec 08             	sub    $0x8,%esp
+8010629e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801062a1:	50                   	push   %eax
+801062a2:	6a 00                	push   $0x0
+801062a4:	e8 77 f6 ff ff       	call   80105920 <argstr>
+801062a9:	83 c4 10             	add    $0x10,%esp
+801062ac:	85 c0                	test   %eax,%eax
+801062ae:	78 60                	js     80106310 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+801062b0:	83 ec 08             	sub    $0x8,%esp
+801062b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801062b6:	50                   	push   %eax
+801062b7:	6a 01                	push   $0x1
+801062b9:	e8 a2 f5 ff ff       	call   80105860 <argint>
+  if((argstr(0, &path)) < 0 ||
+801062be:	83 c4 10             	add    $0x10,%esp
+801062c1:	85 c0                	test   %eax,%eax
+801062c3:	78 4b                	js     80106310 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+801062c5:	83 ec 08             	sub    $0x8,%esp
+801062c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801062cb:	50                   	push   %eax
+801062cc:	6a 02                	push   $0x2
+801062ce:	e8 8d f5 ff ff       	call   80105860 <argint>
+     argint(1, &major) < 0 ||
+801062d3:	83 c4 10             	add    $0x10,%esp
+801062d6:	85 c0                	test   %eax,%eax
+801062d8:	78 36                	js     80106310 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801062da:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+801062de:	83 ec 0c             	sub    $0xc,%esp
+801062e1:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801062e5:	ba 03 00 00 00       	mov    $0x3,%edx
+801062ea:	50                   	push   %eax
+801062eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801062ee:	e8 1d f7 ff ff       	call   80105a10 <create>
+     argint(2, &minor) < 0 ||
+801062f3:	83 c4 10             	add    $0x10,%esp
+801062f6:	85 c0                	test   %eax,%eax
+801062f8:	74 16                	je     80106310 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801062fa:	83 ec 0c             	sub    $0xc,%esp
+801062fd:	50                   	push   %eax
+801062fe:	e8 5d b7 ff ff       	call   80101a60 <iunlockput>
+  end_op();
+80106303:	e8 c8 cb ff ff       	call   80102ed0 <end_op>
+  return 0;
+80106308:	83 c4 10             	add    $0x10,%esp
+8010630b:	31 c0                	xor    %eax,%eax
+}
+8010630d:	c9                   	leave
+8010630e:	c3                   	ret
+8010630f:	90                   	nop
+    end_op();
+80106310:	e8 bb cb ff ff       	call   80102ed0 <end_op>
+    return -1;
+80106315:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010631a:	c9                   	leave
+8010631b:	c3                   	ret
+8010631c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106320 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80106320:	55                   	push   %ebp
+80106321:	89 e5                	mov    %esp,%ebp
+80106323:	56                   	push   %esi
+80106324:	53                   	push   %ebx
+80106325:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80106328:	e8 53 db ff ff       	call   80103e80 <myproc>
+8010632d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+8010632f:	e8 2c cb ff ff       	call   80102e60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80106334:	83 ec 08             	sub    $0x8,%esp
+80106337:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010633a:	50                   	push   %eax
+8010633b:	6a 00                	push   $0x0
+8010633d:	e8 de f5 ff ff       	call   80105920 <argstr>
+80106342:	83 c4 10             	add    $0x10,%esp
+80106345:	85 c0                	test   %eax,%eax
+80106347:	78 77                	js     801063c0 <sys_chdir+0xa0>
+80106349:	83 ec 0c             	sub    $0xc,%esp
+8010634c:	ff 75 f4             	push   -0xc(%ebp)
+8010634f:	e8 ac bd ff ff       	call   80102100 <namei>
+80106354:	83 c4 10             	add    $0x10,%esp
+80106357:	89 c3                	mov    %eax,%ebx
+80106359:	85 c0                	test   %eax,%eax
+8010635b:	74 63                	je     801063c0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+8010635d:	83 ec 0c             	sub    $0xc,%esp
+80106360:	50                   	push   %eax
+80106361:	e8 6a b4 ff ff       	call   801017d0 <ilock>
+  if(ip->type != T_DIR){
+80106366:	83 c4 10             	add    $0x10,%esp
+80106369:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+8010636e:	75 30                	jne    801063a0 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80106370:	83 ec 0c             	sub    $0xc,%esp
+80106373:	53                   	push   %ebx
+80106374:	e8 37 b5 ff ff       	call   801018b0 <iunlock>
+  iput(curproc->cwd);
+80106379:	58                   	pop    %eax
+8010637a:	ff 76 68             	push   0x68(%esi)
+8010637d:	e8 7e b5 ff ff       	call   80101900 <iput>
+  end_op();
+80106382:	e8 49 cb ff ff       	call   80102ed0 <end_op>
+  curproc->cwd = ip;
+80106387:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+8010638a:	83 c4 10             	add    $0x10,%esp
+8010638d:	31 c0                	xor    %eax,%eax
+}
+8010638f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106392:	5b                   	pop    %ebx
+80106393:	5e                   	pop    %esi
+80106394:	5d                   	pop    %ebp
+80106395:	c3                   	ret
+80106396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010639d:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+801063a0:	83 ec 0c             	sub    $0xc,%esp
+801063a3:	53                   	push   %ebx
+801063a4:	e8 b7 b6 ff ff       	call   80101a60 <iunlockput>
+    end_op();
+801063a9:	e8 22 cb ff ff       	call   80102ed0 <end_op>
+    return -1;
+801063ae:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801063b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801063b6:	eb d7                	jmp    8010638f <sys_chdir+0x6f>
+801063b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063bf:	90                   	nop
+    end_op();
+801063c0:	e8 0b cb ff ff       	call   80102ed0 <end_op>
+    return -1;
+801063c5:	eb ea                	jmp    801063b1 <sys_chdir+0x91>
+801063c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063ce:	66 90                	xchg   %ax,%ax
+
+801063d0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801063d0:	55                   	push   %ebp
+801063d1:	89 e5                	mov    %esp,%ebp
+801063d3:	57                   	push   %edi
+801063d4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801063d5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+801063db:	53                   	push   %ebx
+801063dc:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801063e2:	50                   	push   %eax
+801063e3:	6a 00                	push   $0x0
+801063e5:	e8 36 f5 ff ff       	call   80105920 <argstr>
+801063ea:	83 c4 10             	add    $0x10,%esp
+801063ed:	85 c0                	test   %eax,%eax
+801063ef:	0f 88 87 00 00 00    	js     8010647c <sys_exec+0xac>
+801063f5:	83 ec 08             	sub    $0x8,%esp
+801063f8:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+801063fe:	50                   	push   %eax
+801063ff:	6a 01                	push   $0x1
+80106401:	e8 5a f4 ff ff       	call   80105860 <argint>
+80106406:	83 c4 10             	add    $0x10,%esp
+80106409:	85 c0                	test   %eax,%eax
+8010640b:	78 6f                	js     8010647c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+8010640d:	83 ec 04             	sub    $0x4,%esp
+80106410:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80106416:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80106418:	68 80 00 00 00       	push   $0x80
+8010641d:	6a 00                	push   $0x0
+8010641f:	56                   	push   %esi
+80106420:	e8 8b f1 ff ff       	call   801055b0 <memset>
+80106425:	83 c4 10             	add    $0x10,%esp
+80106428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010642f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80106430:	83 ec 08             	sub    $0x8,%esp
+80106433:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80106439:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80106440:	50                   	push   %eax
+80106441:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80106447:	01 f8                	add    %edi,%eax
+80106449:	50                   	push   %eax
+8010644a:	e8 81 f3 ff ff       	call   801057d0 <fetchint>
+8010644f:	83 c4 10             	add    $0x10,%esp
+80106452:	85 c0                	test   %eax,%eax
+80106454:	78 26                	js     8010647c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80106456:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010645c:	85 c0                	test   %eax,%eax
+8010645e:	74 30                	je     80106490 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80106460:	83 ec 08             	sub    $0x8,%esp
+80106463:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80106466:	52                   	push   %edx
+80106467:	50                   	push   %eax
+80106468:	e8 a3 f3 ff ff       	call   80105810 <fetchstr>
+8010646d:	83 c4 10             	add    $0x10,%esp
+80106470:	85 c0                	test   %eax,%eax
+80106472:	78 08                	js     8010647c <sys_exec+0xac>
+  for(i=0;; i++){
+80106474:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80106477:	83 fb 20             	cmp    $0x20,%ebx
+8010647a:	75 b4                	jne    80106430 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+8010647c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010647f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106484:	5b                   	pop    %ebx
+80106485:	5e                   	pop    %esi
+80106486:	5f                   	pop    %edi
+80106487:	5d                   	pop    %ebp
+80106488:	c3                   	ret
+80106489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80106490:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80106497:	00 00 00 00 
+  return exec(path, argv);
+8010649b:	83 ec 08             	sub    $0x8,%esp
+8010649e:	56                   	push   %esi
+8010649f:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+801064a5:	e8 36 a6 ff ff       	call   80100ae0 <exec>
+801064aa:	83 c4 10             	add    $0x10,%esp
+}
+801064ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801064b0:	5b                   	pop    %ebx
+801064b1:	5e                   	pop    %esi
+801064b2:	5f                   	pop    %edi
+801064b3:	5d                   	pop    %ebp
+801064b4:	c3                   	ret
+801064b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801064bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801064c0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801064c0:	55                   	push   %ebp
+801064c1:	89 e5                	mov    %esp,%ebp
+801064c3:	57                   	push   %edi
+801064c4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801064c5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801064c8:	53                   	push   %ebx
+801064c9:	83 ec 20             	sub    $0x20,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801064cc:	6a 08                	push   $0x8
+801064ce:	50                   	push   %eax
+801064cf:	6a 00                	push   $0x0
+801064d1:	e8 da f3 ff ff       	call   801058b0 <argptr>
+801064d6:	83 c4 10             	add    $0x10,%esp
+801064d9:	85 c0                	test   %eax,%eax
+801064db:	0f 88 8b 00 00 00    	js     8010656c <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+801064e1:	83 ec 08             	sub    $0x8,%esp
+801064e4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801064e7:	50                   	push   %eax
+801064e8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801064eb:	50                   	push   %eax
+801064ec:	e8 3f d0 ff ff       	call   80103530 <pipealloc>
+801064f1:	83 c4 10             	add    $0x10,%esp
+801064f4:	85 c0                	test   %eax,%eax
+801064f6:	78 74                	js     8010656c <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801064f8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+801064fb:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+801064fd:	e8 7e d9 ff ff       	call   80103e80 <myproc>
+    if(curproc->ofile[fd] == 0){
+80106502:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+80106506:	85 f6                	test   %esi,%esi
+80106508:	74 16                	je     80106520 <sys_pipe+0x60>
+8010650a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80106510:	83 c3 01             	add    $0x1,%ebx
+80106513:	83 fb 10             	cmp    $0x10,%ebx
+80106516:	74 3d                	je     80106555 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80106518:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+8010651c:	85 f6                	test   %esi,%esi
+8010651e:	75 f0                	jne    80106510 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80106520:	8d 73 08             	lea    0x8(%ebx),%esi
+80106523:	89 7c b0 08          	mov    %edi,0x8(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80106527:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+8010652a:	e8 51 d9 ff ff       	call   80103e80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010652f:	31 d2                	xor    %edx,%edx
+80106531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80106538:	8b 4c 90 28          	mov    0x28(%eax,%edx,4),%ecx
+8010653c:	85 c9                	test   %ecx,%ecx
+8010653e:	74 38                	je     80106578 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80106540:	83 c2 01             	add    $0x1,%edx
+80106543:	83 fa 10             	cmp    $0x10,%edx
+80106546:	75 f0                	jne    80106538 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80106548:	e8 33 d9 ff ff       	call   80103e80 <myproc>
+8010654d:	c7 44 b0 08 00 00 00 	movl   $0x0,0x8(%eax,%esi,4)
+80106554:	00 
+    fileclose(rf);
+80106555:	83 ec 0c             	sub    $0xc,%esp
+80106558:	ff 75 e0             	push   -0x20(%ebp)
+8010655b:	e8 e0 a9 ff ff       	call   80100f40 <fileclose>
+    fileclose(wf);
+80106560:	58                   	pop    %eax
+80106561:	ff 75 e4             	push   -0x1c(%ebp)
+80106564:	e8 d7 a9 ff ff       	call   80100f40 <fileclose>
+    return -1;
+80106569:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010656c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106571:	eb 16                	jmp    80106589 <sys_pipe+0xc9>
+80106573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106577:	90                   	nop
+      curproc->ofile[fd] = f;
+80106578:	89 7c 90 28          	mov    %edi,0x28(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+8010657c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010657f:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+80106581:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80106584:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+80106587:	31 c0                	xor    %eax,%eax
+}
+80106589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010658c:	5b                   	pop    %ebx
+8010658d:	5e                   	pop    %esi
+8010658e:	5f                   	pop    %edi
+8010658f:	5d                   	pop    %ebp
+80106590:	c3                   	ret
+80106591:	66 90                	xchg   %ax,%ax
+80106593:	66 90                	xchg   %ax,%ax
+80106595:	66 90                	xchg   %ax,%ax
+80106597:	66 90                	xchg   %ax,%ax
+80106599:	66 90                	xchg   %ax,%ax
+8010659b:	66 90                	xchg   %ax,%ax
+8010659d:	66 90                	xchg   %ax,%ax
+8010659f:	90                   	nop
+
+801065a0 <sys_fork>:
+#include "proc.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+801065a0:	e9 7b da ff ff       	jmp    80104020 <fork>
+801065a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801065b0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+801065b0:	55                   	push   %ebp
+801065b1:	89 e5                	mov    %esp,%ebp
+801065b3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+801065b6:	e8 a5 e1 ff ff       	call   80104760 <exit>
+  return 0;  // not reached
+}
+801065bb:	31 c0                	xor    %eax,%eax
+801065bd:	c9                   	leave
+801065be:	c3                   	ret
+801065bf:	90                   	nop
+
+801065c0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+801065c0:	e9 eb e2 ff ff       	jmp    801048b0 <wait>
+801065c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801065d0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+801065d0:	55                   	push   %ebp
+801065d1:	89 e5                	mov    %esp,%ebp
+801065d3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+801065d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801065d9:	50                   	push   %eax
+801065da:	6a 00                	push   $0x0
+801065dc:	e8 7f f2 ff ff       	call   80105860 <argint>
+801065e1:	83 c4 10             	add    $0x10,%esp
+801065e4:	85 c0                	test   %eax,%eax
+801065e6:	78 18                	js     80106600 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+801065e8:	83 ec 0c             	sub    $0xc,%esp
+801065eb:	ff 75 f4             	push   -0xc(%ebp)
+801065ee:	e8 6d e6 ff ff       	call   80104c60 <kill>
+801065f3:	83 c4 10             	add    $0x10,%esp
+}
+801065f6:	c9                   	leave
+801065f7:	c3                   	ret
+801065f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065ff:	90                   	nop
+80106600:	c9                   	leave
+    return -1;
+80106601:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106606:	c3                   	ret
+80106607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010660e:	66 90                	xchg   %ax,%ax
+
+80106610 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80106610:	55                   	push   %ebp
+80106611:	89 e5                	mov    %esp,%ebp
+80106613:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80106616:	e8 65 d8 ff ff       	call   80103e80 <myproc>
+8010661b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010661e:	c9                   	leave
+8010661f:	c3                   	ret
+
+80106620 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80106620:	55                   	push   %ebp
+80106621:	89 e5                	mov    %esp,%ebp
+80106623:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80106624:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80106627:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010662a:	50                   	push   %eax
+8010662b:	6a 00                	push   $0x0
+8010662d:	e8 2e f2 ff ff       	call   80105860 <argint>
+80106632:	83 c4 10             	add    $0x10,%esp
+80106635:	85 c0                	test   %eax,%eax
+80106637:	78 27                	js     80106660 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80106639:	e8 42 d8 ff ff       	call   80103e80 <myproc>
+  if(growproc(n) < 0)
+8010663e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80106641:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80106643:	ff 75 f4             	push   -0xc(%ebp)
+80106646:	e8 55 d9 ff ff       	call   80103fa0 <growproc>
+8010664b:	83 c4 10             	add    $0x10,%esp
+8010664e:	85 c0                	test   %eax,%eax
+80106650:	78 0e                	js     80106660 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80106652:	89 d8                	mov    %ebx,%eax
+80106654:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106657:	c9                   	leave
+80106658:	c3                   	ret
+80106659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80106660:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106665:	eb eb                	jmp    80106652 <sys_sbrk+0x32>
+80106667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010666e:	66 90                	xchg   %ax,%ax
+
+80106670 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80106670:	55                   	push   %ebp
+80106671:	89 e5                	mov    %esp,%ebp
+80106673:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80106674:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80106677:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010667a:	50                   	push   %eax
+8010667b:	6a 00                	push   $0x0
+8010667d:	e8 de f1 ff ff       	call   80105860 <argint>
+80106682:	83 c4 10             	add    $0x10,%esp
+80106685:	85 c0                	test   %eax,%eax
+80106687:	78 64                	js     801066ed <sys_sleep+0x7d>
+    return -1;
+  acquire(&tickslock);
+80106689:	83 ec 0c             	sub    $0xc,%esp
+8010668c:	68 a0 55 11 80       	push   $0x801155a0
+80106691:	e8 3a ee ff ff       	call   801054d0 <acquire>
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+80106696:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  ticks0 = ticks;
+80106699:	8b 1d 80 55 11 80    	mov    0x80115580,%ebx
+  while(ticks - ticks0 < n){
+8010669f:	83 c4 10             	add    $0x10,%esp
+801066a2:	85 d2                	test   %edx,%edx
+801066a4:	75 2b                	jne    801066d1 <sys_sleep+0x61>
+801066a6:	eb 58                	jmp    80106700 <sys_sleep+0x90>
+801066a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066af:	90                   	nop
+    if(myproc()->killed){
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+801066b0:	83 ec 08             	sub    $0x8,%esp
+801066b3:	68 a0 55 11 80       	push   $0x801155a0
+801066b8:	68 80 55 11 80       	push   $0x80115580
+801066bd:	e8 6e e4 ff ff       	call   80104b30 <sleep>
+  while(ticks - ticks0 < n){
+801066c2:	a1 80 55 11 80       	mov    0x80115580,%eax
+801066c7:	83 c4 10             	add    $0x10,%esp
+801066ca:	29 d8                	sub    %ebx,%eax
+801066cc:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+801066cf:	73 2f                	jae    80106700 <sys_sleep+0x90>
+    if(myproc()->killed){
+801066d1:	e8 aa d7 ff ff       	call   80103e80 <myproc>
+801066d6:	8b 40 24             	mov    0x24(%eax),%eax
+801066d9:	85 c0                	test   %eax,%eax
+801066db:	74 d3                	je     801066b0 <sys_sleep+0x40>
+      release(&tickslock);
+801066dd:	83 ec 0c             	sub    $0xc,%esp
+801066e0:	68 a0 55 11 80       	push   $0x801155a0
+801066e5:	e8 86 ed ff ff       	call   80105470 <release>
+      return -1;
+801066ea:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&tickslock);
+  return 0;
+}
+801066ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+801066f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801066f5:	c9                   	leave
+801066f6:	c3                   	ret
+801066f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066fe:	66 90                	xchg   %ax,%ax
+  release(&tickslock);
+80106700:	83 ec 0c             	sub    $0xc,%esp
+80106703:	68 a0 55 11 80       	push   $0x801155a0
+80106708:	e8 63 ed ff ff       	call   80105470 <release>
+}
+8010670d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80106710:	83 c4 10             	add    $0x10,%esp
+80106713:	31 c0                	xor    %eax,%eax
+}
+80106715:	c9                   	leave
+80106716:	c3                   	ret
+80106717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010671e:	66 90                	xchg   %ax,%ax
+
+80106720 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80106720:	55                   	push   %ebp
+80106721:	89 e5                	mov    %esp,%ebp
+80106723:	53                   	push   %ebx
+80106724:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80106727:	68 a0 55 11 80       	push   $0x801155a0
+8010672c:	e8 9f ed ff ff       	call   801054d0 <acquire>
+  xticks = ticks;
+80106731:	8b 1d 80 55 11 80    	mov    0x80115580,%ebx
+  release(&tickslock);
+80106737:	c7 04 24 a0 55 11 80 	movl   $0x801155a0,(%esp)
+8010673e:	e8 2d ed ff ff       	call   80105470 <release>
+  return xticks;
+}
+80106743:	89 d8                	mov    %ebx,%eax
+80106745:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106748:	c9                   	leave
+80106749:	c3                   	ret
+8010674a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106750 <sys_schedulerLock>:
+
+int
+sys_schedulerLock(void)
+{
+80106750:	55                   	push   %ebp
+80106751:	89 e5                	mov    %esp,%ebp
+80106753:	83 ec 20             	sub    $0x20,%esp
+  int password;
+  
+  if (argint(0, &password) < 0)
+80106756:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106759:	50                   	push   %eax
+8010675a:	6a 00                	push   $0x0
+8010675c:	e8 ff f0 ff ff       	call   80105860 <argint>
+80106761:	83 c4 10             	add    $0x10,%esp
+80106764:	85 c0                	test   %eax,%eax
+80106766:	78 18                	js     80106780 <sys_schedulerLock+0x30>
+    return -1;
+  
+  schedulerLock(password);
+80106768:	83 ec 0c             	sub    $0xc,%esp
+8010676b:	ff 75 f4             	push   -0xc(%ebp)
+8010676e:	e8 2d e6 ff ff       	call   80104da0 <schedulerLock>
+
+  return 0;
+80106773:	83 c4 10             	add    $0x10,%esp
+80106776:	31 c0                	xor    %eax,%eax
+}
+80106778:	c9                   	leave
+80106779:	c3                   	ret
+8010677a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106780:	c9                   	leave
+    return -1;
+80106781:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106786:	c3                   	ret
+80106787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010678e:	66 90                	xchg   %ax,%ax
+
+80106790 <sys_schedulerUnlock>:
+
+int
+sys_schedulerUnlock(void)
+{
+80106790:	55                   	push   %ebp
+80106791:	89 e5                	mov    %esp,%ebp
+80106793:	83 ec 20             	sub    $0x20,%esp
+  int password;
+  
+  if (argint(0, &password) < 0)
+80106796:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106799:	50                   	push   %eax
+8010679a:	6a 00                	push   $0x0
+8010679c:	e8 bf f0 ff ff       	call   80105860 <argint>
+801067a1:	83 c4 10             	add    $0x10,%esp
+801067a4:	85 c0                	test   %eax,%eax
+801067a6:	78 18                	js     801067c0 <sys_schedulerUnlock+0x30>
+    return -1;
+  
+  schedulerUnlock(password);
+801067a8:	83 ec 0c             	sub    $0xc,%esp
+801067ab:	ff 75 f4             	push   -0xc(%ebp)
+801067ae:	e8 cd e6 ff ff       	call   80104e80 <schedulerUnlock>
+
+  return 0;
+801067b3:	83 c4 10             	add    $0x10,%esp
+801067b6:	31 c0                	xor    %eax,%eax
+}
+801067b8:	c9                   	leave
+801067b9:	c3                   	ret
+801067ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801067c0:	c9                   	leave
+    return -1;
+801067c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801067c6:	c3                   	ret
+801067c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067ce:	66 90                	xchg   %ax,%ax
+
+801067d0 <sys_getLevel>:
+
+int
+sys_getLevel(void)
+{
+  return getLevel();
+801067d0:	e9 ab e7 ff ff       	jmp    80104f80 <getLevel>
+801067d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801067e0 <sys_setPriority>:
+}
+
+int
+sys_setPriority(void)
+{
+801067e0:	55                   	push   %ebp
+801067e1:	89 e5                	mov    %esp,%ebp
+801067e3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  int priority;
+
+  if (argint(0, &pid) < 0)
+801067e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801067e9:	50                   	push   %eax
+801067ea:	6a 00                	push   $0x0
+801067ec:	e8 6f f0 ff ff       	call   80105860 <argint>
+801067f1:	83 c4 10             	add    $0x10,%esp
+801067f4:	85 c0                	test   %eax,%eax
+801067f6:	78 38                	js     80106830 <sys_setPriority+0x50>
+    return -1;
+  
+  if (argint(1, &priority) < 0)
+801067f8:	83 ec 08             	sub    $0x8,%esp
+801067fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801067fe:	50                   	push   %eax
+801067ff:	6a 01                	push   $0x1
+80106801:	e8 5a f0 ff ff       	call   80105860 <argint>
+80106806:	83 c4 10             	add    $0x10,%esp
+80106809:	85 c0                	test   %eax,%eax
+8010680b:	78 23                	js     80106830 <sys_setPriority+0x50>
+    return -1;
+
+  if (priority < 0 || priority > 3) 
+8010680d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80106810:	83 f8 03             	cmp    $0x3,%eax
+80106813:	77 1b                	ja     80106830 <sys_setPriority+0x50>
+    return -1;
+
+  setPriority(pid, priority);
+80106815:	83 ec 08             	sub    $0x8,%esp
+80106818:	50                   	push   %eax
+80106819:	ff 75 f0             	push   -0x10(%ebp)
+8010681c:	e8 ef e7 ff ff       	call   80105010 <setPriority>
+
+  return 0;
+80106821:	83 c4 10             	add    $0x10,%esp
+80106824:	31 c0                	xor    %eax,%eax
+}
+80106826:	c9                   	leave
+80106827:	c3                   	ret
+80106828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010682f:	90                   	nop
+80106830:	c9                   	leave
+    return -1;
+80106831:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106836:	c3                   	ret
+80106837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010683e:	66 90                	xchg   %ax,%ax
+
+80106840 <sys_yield>:
+
+int
+sys_yield(void)
+{
+80106840:	55                   	push   %ebp
+80106841:	89 e5                	mov    %esp,%ebp
+80106843:	83 ec 08             	sub    $0x8,%esp
+  yield();
+80106846:	e8 f5 e1 ff ff       	call   80104a40 <yield>
+
+  return 0;
+8010684b:	31 c0                	xor    %eax,%eax
+8010684d:	c9                   	leave
+8010684e:	c3                   	ret
+
+8010684f <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+8010684f:	1e                   	push   %ds
+  pushl %es
+80106850:	06                   	push   %es
+  pushl %fs
+80106851:	0f a0                	push   %fs
+  pushl %gs
+80106853:	0f a8                	push   %gs
+  pushal
+80106855:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80106856:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+8010685a:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+8010685c:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+8010685e:	54                   	push   %esp
+  call trap
+8010685f:	e8 1c 01 00 00       	call   80106980 <trap>
+  addl $4, %esp
+80106864:	83 c4 04             	add    $0x4,%esp
+
+80106867 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80106867:	61                   	popa
+  popl %gs
+80106868:	0f a9                	pop    %gs
+  popl %fs
+8010686a:	0f a1                	pop    %fs
+  popl %es
+8010686c:	07                   	pop    %es
+  popl %ds
+8010686d:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+8010686e:	83 c4 08             	add    $0x8,%esp
+  iret
+80106871:	cf                   	iret
+80106872:	66 90                	xchg   %ax,%ax
+80106874:	66 90                	xchg   %ax,%ax
+80106876:	66 90                	xchg   %ax,%ax
+80106878:	66 90                	xchg   %ax,%ax
+8010687a:	66 90                	xchg   %ax,%ax
+8010687c:	66 90                	xchg   %ax,%ax
+8010687e:	66 90                	xchg   %ax,%ax
+
+80106880 <tvinit>:
+uint ticks;
+
+
+void
+tvinit(void)
+{
+80106880:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80106881:	31 c0                	xor    %eax,%eax
+{
+80106883:	89 e5                	mov    %esp,%ebp
+80106885:	83 ec 08             	sub    $0x8,%esp
+80106888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010688f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80106890:	8b 14 85 08 b0 10 80 	mov    -0x7fef4ff8(,%eax,4),%edx
+80106897:	c7 04 c5 e2 55 11 80 	movl   $0x8e000008,-0x7feeaa1e(,%eax,8)
+8010689e:	08 00 00 8e 
+801068a2:	66 89 14 c5 e0 55 11 	mov    %dx,-0x7feeaa20(,%eax,8)
+801068a9:	80 
+801068aa:	c1 ea 10             	shr    $0x10,%edx
+801068ad:	66 89 14 c5 e6 55 11 	mov    %dx,-0x7feeaa1a(,%eax,8)
+801068b4:	80 
+  for(i = 0; i < 256; i++)
+801068b5:	83 c0 01             	add    $0x1,%eax
+801068b8:	3d 00 01 00 00       	cmp    $0x100,%eax
+801068bd:	75 d1                	jne    80106890 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801068bf:	a1 08 b1 10 80       	mov    0x8010b108,%eax
+
+  // set interrupt 129, 130 user-executable
+  SETGATE(idt[129], 1, SEG_KCODE<<3, vectors[129], DPL_USER);
+  SETGATE(idt[130], 1, SEG_KCODE<<3, vectors[130], DPL_USER);
+
+  initlock(&tickslock, "time");
+801068c4:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801068c7:	c7 05 e2 57 11 80 08 	movl   $0xef000008,0x801157e2
+801068ce:	00 00 ef 
+  SETGATE(idt[128], 0, SEG_KCODE<<3, vectors[128], DPL_USER); 
+801068d1:	c7 05 e2 59 11 80 08 	movl   $0xee000008,0x801159e2
+801068d8:	00 00 ee 
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801068db:	66 a3 e0 57 11 80    	mov    %ax,0x801157e0
+801068e1:	c1 e8 10             	shr    $0x10,%eax
+801068e4:	66 a3 e6 57 11 80    	mov    %ax,0x801157e6
+  SETGATE(idt[128], 0, SEG_KCODE<<3, vectors[128], DPL_USER); 
+801068ea:	a1 08 b2 10 80       	mov    0x8010b208,%eax
+  SETGATE(idt[129], 1, SEG_KCODE<<3, vectors[129], DPL_USER);
+801068ef:	c7 05 ea 59 11 80 08 	movl   $0xef000008,0x801159ea
+801068f6:	00 00 ef 
+  SETGATE(idt[128], 0, SEG_KCODE<<3, vectors[128], DPL_USER); 
+801068f9:	66 a3 e0 59 11 80    	mov    %ax,0x801159e0
+801068ff:	c1 e8 10             	shr    $0x10,%eax
+80106902:	66 a3 e6 59 11 80    	mov    %ax,0x801159e6
+  SETGATE(idt[129], 1, SEG_KCODE<<3, vectors[129], DPL_USER);
+80106908:	a1 0c b2 10 80       	mov    0x8010b20c,%eax
+  SETGATE(idt[130], 1, SEG_KCODE<<3, vectors[130], DPL_USER);
+8010690d:	c7 05 f2 59 11 80 08 	movl   $0xef000008,0x801159f2
+80106914:	00 00 ef 
+  SETGATE(idt[129], 1, SEG_KCODE<<3, vectors[129], DPL_USER);
+80106917:	66 a3 e8 59 11 80    	mov    %ax,0x801159e8
+8010691d:	c1 e8 10             	shr    $0x10,%eax
+80106920:	66 a3 ee 59 11 80    	mov    %ax,0x801159ee
+  SETGATE(idt[130], 1, SEG_KCODE<<3, vectors[130], DPL_USER);
+80106926:	a1 10 b2 10 80       	mov    0x8010b210,%eax
+8010692b:	66 a3 f0 59 11 80    	mov    %ax,0x801159f0
+80106931:	c1 e8 10             	shr    $0x10,%eax
+80106934:	66 a3 f6 59 11 80    	mov    %ax,0x801159f6
+  initlock(&tickslock, "time");
+8010693a:	68 f1 8a 10 80       	push   $0x80108af1
+8010693f:	68 a0 55 11 80       	push   $0x801155a0
+80106944:	e8 a7 e9 ff ff       	call   801052f0 <initlock>
+}
+80106949:	83 c4 10             	add    $0x10,%esp
+8010694c:	c9                   	leave
+8010694d:	c3                   	ret
+8010694e:	66 90                	xchg   %ax,%ax
+
+80106950 <idtinit>:
+
+void
+idtinit(void)
+{
+80106950:	55                   	push   %ebp
+  pd[0] = size-1;
+80106951:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80106956:	89 e5                	mov    %esp,%ebp
+80106958:	83 ec 10             	sub    $0x10,%esp
+8010695b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010695f:	b8 e0 55 11 80       	mov    $0x801155e0,%eax
+80106964:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80106968:	c1 e8 10             	shr    $0x10,%eax
+8010696b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010696f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80106972:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80106975:	c9                   	leave
+80106976:	c3                   	ret
+80106977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010697e:	66 90                	xchg   %ax,%ax
+
+80106980 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80106980:	55                   	push   %ebp
+80106981:	89 e5                	mov    %esp,%ebp
+80106983:	57                   	push   %edi
+80106984:	56                   	push   %esi
+80106985:	53                   	push   %ebx
+80106986:	83 ec 1c             	sub    $0x1c,%esp
+80106989:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+8010698c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010698f:	83 f8 40             	cmp    $0x40,%eax
+80106992:	0f 84 d8 01 00 00    	je     80106b70 <trap+0x1f0>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80106998:	83 f8 3f             	cmp    $0x3f,%eax
+8010699b:	0f 87 9f 00 00 00    	ja     80106a40 <trap+0xc0>
+801069a1:	83 f8 1f             	cmp    $0x1f,%eax
+801069a4:	0f 86 f6 00 00 00    	jbe    80106aa0 <trap+0x120>
+801069aa:	83 e8 20             	sub    $0x20,%eax
+801069ad:	83 f8 1f             	cmp    $0x1f,%eax
+801069b0:	0f 87 ea 00 00 00    	ja     80106aa0 <trap+0x120>
+801069b6:	ff 24 85 98 8b 10 80 	jmp    *-0x7fef7468(,%eax,4)
+801069bd:	8d 76 00             	lea    0x0(%esi),%esi
+  case T_IRQ0 + IRQ_WAKE:
+    // Nothing to do: the CPU just had to leave hlt.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+801069c0:	e8 eb b8 ff ff       	call   801022b0 <ideintr>
+    lapiceoi();
+801069c5:	e8 b6 bf ff ff       	call   80102980 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801069ca:	e8 b1 d4 ff ff       	call   80103e80 <myproc>
+801069cf:	85 c0                	test   %eax,%eax
+801069d1:	74 1d                	je     801069f0 <trap+0x70>
+801069d3:	e8 a8 d4 ff ff       	call   80103e80 <myproc>
+801069d8:	8b 50 24             	mov    0x24(%eax),%edx
+801069db:	85 d2                	test   %edx,%edx
+801069dd:	74 11                	je     801069f0 <trap+0x70>
+801069df:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801069e3:	83 e0 03             	and    $0x3,%eax
+801069e6:	66 83 f8 03          	cmp    $0x3,%ax
+801069ea:	0f 84 60 02 00 00    	je     80106c50 <trap+0x2d0>
+    exit();
+
+  // Force process to give up CPU on clock tick, if its quantum
+  // is used up or it was boosted.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+801069f0:	e8 8b d4 ff ff       	call   80103e80 <myproc>
+801069f5:	85 c0                	test   %eax,%eax
+801069f7:	74 0f                	je     80106a08 <trap+0x88>
+801069f9:	e8 82 d4 ff ff       	call   80103e80 <myproc>
+801069fe:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80106a02:	0f 84 10 01 00 00    	je     80106b18 <trap+0x198>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeup()) {
+    __yield();
+  }
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80106a08:	e8 73 d4 ff ff       	call   80103e80 <myproc>
+80106a0d:	85 c0                	test   %eax,%eax
+80106a0f:	74 1d                	je     80106a2e <trap+0xae>
+80106a11:	e8 6a d4 ff ff       	call   80103e80 <myproc>
+80106a16:	8b 40 24             	mov    0x24(%eax),%eax
+80106a19:	85 c0                	test   %eax,%eax
+80106a1b:	74 11                	je     80106a2e <trap+0xae>
+80106a1d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80106a21:	83 e0 03             	and    $0x3,%eax
+80106a24:	66 83 f8 03          	cmp    $0x3,%ax
+80106a28:	0f 84 6f 01 00 00    	je     80106b9d <trap+0x21d>
+    exit();
+}
+80106a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a31:	5b                   	pop    %ebx
+80106a32:	5e                   	pop    %esi
+80106a33:	5f                   	pop    %edi
+80106a34:	5d                   	pop    %ebp
+80106a35:	c3                   	ret
+80106a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a3d:	8d 76 00             	lea    0x0(%esi),%esi
+  switch(tf->trapno){
+80106a40:	3d 81 00 00 00       	cmp    $0x81,%eax
+80106a45:	0f 84 e5 01 00 00    	je     80106c30 <trap+0x2b0>
+80106a4b:	3d 82 00 00 00       	cmp    $0x82,%eax
+80106a50:	75 1e                	jne    80106a70 <trap+0xf0>
+    myproc()->tf = tf;
+80106a52:	e8 29 d4 ff ff       	call   80103e80 <myproc>
+    schedulerUnlock(2021031685);
+80106a57:	83 ec 0c             	sub    $0xc,%esp
+    myproc()->tf = tf;
+80106a5a:	89 58 18             	mov    %ebx,0x18(%eax)
+    schedulerUnlock(2021031685);
+80106a5d:	68 05 7f 76 78       	push   $0x78767f05
+80106a62:	e8 19 e4 ff ff       	call   80104e80 <schedulerUnlock>
+    break;
+80106a67:	83 c4 10             	add    $0x10,%esp
+80106a6a:	e9 5b ff ff ff       	jmp    801069ca <trap+0x4a>
+80106a6f:	90                   	nop
+  switch(tf->trapno){
+80106a70:	3d 80 00 00 00       	cmp    $0x80,%eax
+80106a75:	75 29                	jne    80106aa0 <trap+0x120>
+    if (myproc()->killed)
+80106a77:	e8 04 d4 ff ff       	call   80103e80 <myproc>
+80106a7c:	8b 48 24             	mov    0x24(%eax),%ecx
+80106a7f:	85 c9                	test   %ecx,%ecx
+80106a81:	0f 85 d9 01 00 00    	jne    80106c60 <trap+0x2e0>
+    myproc()->tf = tf;
+80106a87:	e8 f4 d3 ff ff       	call   80103e80 <myproc>
+80106a8c:	89 58 18             	mov    %ebx,0x18(%eax)
+    mycall();
+80106a8f:	e8 5c 18 00 00       	call   801082f0 <mycall>
+    exit();
+80106a94:	e8 c7 dc ff ff       	call   80104760 <exit>
+    break;
+80106a99:	e9 2c ff ff ff       	jmp    801069ca <trap+0x4a>
+80106a9e:	66 90                	xchg   %ax,%ax
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80106aa0:	e8 db d3 ff ff       	call   80103e80 <myproc>
+80106aa5:	85 c0                	test   %eax,%eax
+80106aa7:	0f 84 d7 01 00 00    	je     80106c84 <trap+0x304>
+80106aad:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80106ab1:	0f 84 cd 01 00 00    	je     80106c84 <trap+0x304>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80106ab7:	0f 20 d1             	mov    %cr2,%ecx
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106aba:	8b 53 38             	mov    0x38(%ebx),%edx
+80106abd:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80106ac0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80106ac3:	e8 58 d0 ff ff       	call   80103b20 <cpuid>
+80106ac8:	8b 73 30             	mov    0x30(%ebx),%esi
+80106acb:	89 c7                	mov    %eax,%edi
+80106acd:	8b 43 34             	mov    0x34(%ebx),%eax
+80106ad0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80106ad3:	e8 a8 d3 ff ff       	call   80103e80 <myproc>
+80106ad8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106adb:	e8 a0 d3 ff ff       	call   80103e80 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106ae0:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80106ae3:	51                   	push   %ecx
+80106ae4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80106ae7:	52                   	push   %edx
+80106ae8:	57                   	push   %edi
+80106ae9:	ff 75 e4             	push   -0x1c(%ebp)
+80106aec:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80106aed:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80106af0:	83 c6 6c             	add    $0x6c,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106af3:	56                   	push   %esi
+80106af4:	ff 70 10             	push   0x10(%eax)
+80106af7:	68 54 8b 10 80       	push   $0x80108b54
+80106afc:	e8 af 9b ff ff       	call   801006b0 <cprintf>
+    myproc()->killed = 1;
+80106b01:	83 c4 20             	add    $0x20,%esp
+80106b04:	e8 77 d3 ff ff       	call   80103e80 <myproc>
+80106b09:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+80106b10:	e9 b5 fe ff ff       	jmp    801069ca <trap+0x4a>
+80106b15:	8d 76 00             	lea    0x0(%esi),%esi
+  if(myproc() && myproc()->state == RUNNING &&
+80106b18:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80106b1c:	0f 85 e6 fe ff ff    	jne    80106a08 <trap+0x88>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeup()) {
+80106b22:	e8 59 d6 ff ff       	call   80104180 <timeup>
+80106b27:	85 c0                	test   %eax,%eax
+80106b29:	0f 84 d9 fe ff ff    	je     80106a08 <trap+0x88>
+    __yield();
+80106b2f:	e8 bc de ff ff       	call   801049f0 <__yield>
+80106b34:	e9 cf fe ff ff       	jmp    80106a08 <trap+0x88>
+80106b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80106b40:	8b 7b 38             	mov    0x38(%ebx),%edi
+80106b43:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+80106b47:	e8 d4 cf ff ff       	call   80103b20 <cpuid>
+80106b4c:	57                   	push   %edi
+80106b4d:	56                   	push   %esi
+80106b4e:	50                   	push   %eax
+80106b4f:	68 fc 8a 10 80       	push   $0x80108afc
+80106b54:	e8 57 9b ff ff       	call   801006b0 <cprintf>
+    lapiceoi();
+80106b59:	e8 22 be ff ff       	call   80102980 <lapiceoi>
+    break;
+80106b5e:	83 c4 10             	add    $0x10,%esp
+80106b61:	e9 64 fe ff ff       	jmp    801069ca <trap+0x4a>
+80106b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc()->killed)
+80106b70:	e8 0b d3 ff ff       	call   80103e80 <myproc>
+80106b75:	8b 70 24             	mov    0x24(%eax),%esi
+80106b78:	85 f6                	test   %esi,%esi
+80106b7a:	0f 85 f0 00 00 00    	jne    80106c70 <trap+0x2f0>
+    myproc()->tf = tf;
+80106b80:	e8 fb d2 ff ff       	call   80103e80 <myproc>
+80106b85:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+80106b88:	e8 13 ee ff ff       	call   801059a0 <syscall>
+    if(myproc()->killed)
+80106b8d:	e8 ee d2 ff ff       	call   80103e80 <myproc>
+80106b92:	8b 58 24             	mov    0x24(%eax),%ebx
+80106b95:	85 db                	test   %ebx,%ebx
+80106b97:	0f 84 91 fe ff ff    	je     80106a2e <trap+0xae>
+}
+80106b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106ba0:	5b                   	pop    %ebx
+80106ba1:	5e                   	pop    %esi
+80106ba2:	5f                   	pop    %edi
+80106ba3:	5d                   	pop    %ebp
+      exit();
+80106ba4:	e9 b7 db ff ff       	jmp    80104760 <exit>
+80106ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    uartintr();
+80106bb0:	e8 7b 02 00 00       	call   80106e30 <uartintr>
+    lapiceoi();
+80106bb5:	e8 c6 bd ff ff       	call   80102980 <lapiceoi>
+    break;
+80106bba:	e9 0b fe ff ff       	jmp    801069ca <trap+0x4a>
+80106bbf:	90                   	nop
+    if(cpuid() == 0){
+80106bc0:	e8 5b cf ff ff       	call   80103b20 <cpuid>
+80106bc5:	85 c0                	test   %eax,%eax
+80106bc7:	0f 85 f8 fd ff ff    	jne    801069c5 <trap+0x45>
+      acquire(&tickslock);
+80106bcd:	83 ec 0c             	sub    $0xc,%esp
+80106bd0:	68 a0 55 11 80       	push   $0x801155a0
+80106bd5:	e8 f6 e8 ff ff       	call   801054d0 <acquire>
+      ticks++;
+80106bda:	a1 80 55 11 80       	mov    0x80115580,%eax
+80106bdf:	83 c4 10             	add    $0x10,%esp
+80106be2:	83 c0 01             	add    $0x1,%eax
+80106be5:	a3 80 55 11 80       	mov    %eax,0x80115580
+80106bea:	69 c0 29 5c 8f c2    	imul   $0xc28f5c29,%eax,%eax
+80106bf0:	c1 c8 02             	ror    $0x2,%eax
+      if ((ticks % BOOSTTICKS) == 0)
+80106bf3:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+80106bf8:	0f 86 7c 00 00 00    	jbe    80106c7a <trap+0x2fa>
+      wakeup(&ticks);
+80106bfe:	83 ec 0c             	sub    $0xc,%esp
+80106c01:	68 80 55 11 80       	push   $0x80115580
+80106c06:	e8 f5 df ff ff       	call   80104c00 <wakeup>
+      release(&tickslock);
+80106c0b:	c7 04 24 a0 55 11 80 	movl   $0x801155a0,(%esp)
+80106c12:	e8 59 e8 ff ff       	call   80105470 <release>
+80106c17:	83 c4 10             	add    $0x10,%esp
+    lapiceoi();
+80106c1a:	e9 a6 fd ff ff       	jmp    801069c5 <trap+0x45>
+80106c1f:	90                   	nop
+    kbdintr();
+80106c20:	e8 1b bc ff ff       	call   80102840 <kbdintr>
+    lapiceoi();
+80106c25:	e8 56 bd ff ff       	call   80102980 <lapiceoi>
+    break;
+80106c2a:	e9 9b fd ff ff       	jmp    801069ca <trap+0x4a>
+80106c2f:	90                   	nop
+    myproc()->tf = tf;
+80106c30:	e8 4b d2 ff ff       	call   80103e80 <myproc>
+    schedulerLock(2021031685);
+80106c35:	83 ec 0c             	sub    $0xc,%esp
+    myproc()->tf = tf;
+80106c38:	89 58 18             	mov    %ebx,0x18(%eax)
+    schedulerLock(2021031685);
+80106c3b:	68 05 7f 76 78       	push   $0x78767f05
+80106c40:	e8 5b e1 ff ff       	call   80104da0 <schedulerLock>
+    break;
+80106c45:	83 c4 10             	add    $0x10,%esp
+80106c48:	e9 7d fd ff ff       	jmp    801069ca <trap+0x4a>
+80106c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+80106c50:	e8 0b db ff ff       	call   80104760 <exit>
+80106c55:	e9 96 fd ff ff       	jmp    801069f0 <trap+0x70>
+80106c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80106c60:	e8 fb da ff ff       	call   80104760 <exit>
+80106c65:	e9 1d fe ff ff       	jmp    80106a87 <trap+0x107>
+80106c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80106c70:	e8 eb da ff ff       	call   80104760 <exit>
+80106c75:	e9 06 ff ff ff       	jmp    80106b80 <trap+0x200>
+        boost();
+80106c7a:	e8 f1 d5 ff ff       	call   80104270 <boost>
+80106c7f:	e9 7a ff ff ff       	jmp    80106bfe <trap+0x27e>
+80106c84:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80106c87:	8b 73 38             	mov    0x38(%ebx),%esi
+80106c8a:	e8 91 ce ff ff       	call   80103b20 <cpuid>
+80106c8f:	83 ec 0c             	sub    $0xc,%esp
+80106c92:	57                   	push   %edi
+80106c93:	56                   	push   %esi
+80106c94:	50                   	push   %eax
+80106c95:	ff 73 30             	push   0x30(%ebx)
+80106c98:	68 20 8b 10 80       	push   $0x80108b20
+80106c9d:	e8 0e 9a ff ff       	call   801006b0 <cprintf>
+      panic("trap");
+80106ca2:	83 c4 14             	add    $0x14,%esp
+80106ca5:	68 f6 8a 10 80       	push   $0x80108af6
+80106caa:	e8 d1 96 ff ff       	call   80100380 <panic>
+80106caf:	90                   	nop
+
+80106cb0 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80106cb0:	a1 e0 5d 11 80       	mov    0x80115de0,%eax
+80106cb5:	85 c0                	test   %eax,%eax
+80106cb7:	74 17                	je     80106cd0 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106cb9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106cbe:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80106cbf:	a8 01                	test   $0x1,%al
+80106cc1:	74 0d                	je     80106cd0 <uartgetc+0x20>
+80106cc3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106cc8:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80106cc9:	0f b6 c0             	movzbl %al,%eax
+80106ccc:	c3                   	ret
+80106ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80106cd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106cd5:	c3                   	ret
+80106cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106ce0 <uartinit>:
+{
+80106ce0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106ce1:	31 c9                	xor    %ecx,%ecx
+80106ce3:	89 c8                	mov    %ecx,%eax
+80106ce5:	89 e5                	mov    %esp,%ebp
+80106ce7:	57                   	push   %edi
+80106ce8:	bf fa 03 00 00       	mov    $0x3fa,%edi
+80106ced:	56                   	push   %esi
+80106cee:	89 fa                	mov    %edi,%edx
+80106cf0:	53                   	push   %ebx
+80106cf1:	83 ec 1c             	sub    $0x1c,%esp
+80106cf4:	ee                   	out    %al,(%dx)
+80106cf5:	be fb 03 00 00       	mov    $0x3fb,%esi
+80106cfa:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80106cff:	89 f2                	mov    %esi,%edx
+80106d01:	ee                   	out    %al,(%dx)
+80106d02:	b8 0c 00 00 00       	mov    $0xc,%eax
+80106d07:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106d0c:	ee                   	out    %al,(%dx)
+80106d0d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80106d12:	89 c8                	mov    %ecx,%eax
+80106d14:	89 da                	mov    %ebx,%edx
+80106d16:	ee                   	out    %al,(%dx)
+80106d17:	b8 03 00 00 00       	mov    $0x3,%eax
+80106d1c:	89 f2                	mov    %esi,%edx
+80106d1e:	ee                   	out    %al,(%dx)
+80106d1f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80106d24:	89 c8                	mov    %ecx,%eax
+80106d26:	ee                   	out    %al,(%dx)
+80106d27:	b8 01 00 00 00       	mov    $0x1,%eax
+80106d2c:	89 da                	mov    %ebx,%edx
+80106d2e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106d2f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106d34:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80106d35:	3c ff                	cmp    $0xff,%al
+80106d37:	0f 84 7c 00 00 00    	je     80106db9 <uartinit+0xd9>
+  uart = 1;
+80106d3d:	c7 05 e0 5d 11 80 01 	movl   $0x1,0x80115de0
+80106d44:	00 00 00 
+80106d47:	89 fa                	mov    %edi,%edx
+80106d49:	ec                   	in     (%dx),%al
+80106d4a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106d4f:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80106d50:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80106d53:	bf 18 8c 10 80       	mov    $0x80108c18,%edi
+80106d58:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+80106d5d:	6a 00                	push   $0x0
+80106d5f:	6a 04                	push   $0x4
+80106d61:	e8 7a b7 ff ff       	call   801024e0 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80106d66:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80106d6a:	83 c4 10             	add    $0x10,%esp
+80106d6d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80106d70:	a1 e0 5d 11 80       	mov    0x80115de0,%eax
+80106d75:	85 c0                	test   %eax,%eax
+80106d77:	74 32                	je     80106dab <uartinit+0xcb>
+80106d79:	89 f2                	mov    %esi,%edx
+80106d7b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106d7c:	a8 20                	test   $0x20,%al
+80106d7e:	75 21                	jne    80106da1 <uartinit+0xc1>
+80106d80:	bb 80 00 00 00       	mov    $0x80,%ebx
+80106d85:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80106d88:	83 ec 0c             	sub    $0xc,%esp
+80106d8b:	6a 0a                	push   $0xa
+80106d8d:	e8 9e bc ff ff       	call   80102a30 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106d92:	83 c4 10             	add    $0x10,%esp
+80106d95:	83 eb 01             	sub    $0x1,%ebx
+80106d98:	74 07                	je     80106da1 <uartinit+0xc1>
+80106d9a:	89 f2                	mov    %esi,%edx
+80106d9c:	ec                   	in     (%dx),%al
+80106d9d:	a8 20                	test   $0x20,%al
+80106d9f:	74 e7                	je     80106d88 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106da1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106da6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80106daa:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80106dab:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80106daf:	83 c7 01             	add    $0x1,%edi
+80106db2:	88 45 e7             	mov    %al,-0x19(%ebp)
+80106db5:	84 c0                	test   %al,%al
+80106db7:	75 b7                	jne    80106d70 <uartinit+0x90>
+}
+80106db9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106dbc:	5b                   	pop    %ebx
+80106dbd:	5e                   	pop    %esi
+80106dbe:	5f                   	pop    %edi
+80106dbf:	5d                   	pop    %ebp
+80106dc0:	c3                   	ret
+80106dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dcf:	90                   	nop
+
+80106dd0 <uartputc>:
+  if(!uart)
+80106dd0:	a1 e0 5d 11 80       	mov    0x80115de0,%eax
+80106dd5:	85 c0                	test   %eax,%eax
+80106dd7:	74 4f                	je     80106e28 <uartputc+0x58>
+{
+80106dd9:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106dda:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106ddf:	89 e5                	mov    %esp,%ebp
+80106de1:	56                   	push   %esi
+80106de2:	53                   	push   %ebx
+80106de3:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106de4:	a8 20                	test   $0x20,%al
+80106de6:	75 29                	jne    80106e11 <uartputc+0x41>
+80106de8:	bb 80 00 00 00       	mov    $0x80,%ebx
+80106ded:	be fd 03 00 00       	mov    $0x3fd,%esi
+80106df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80106df8:	83 ec 0c             	sub    $0xc,%esp
+80106dfb:	6a 0a                	push   $0xa
+80106dfd:	e8 2e bc ff ff       	call   80102a30 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106e02:	83 c4 10             	add    $0x10,%esp
+80106e05:	83 eb 01             	sub    $0x1,%ebx
+80106e08:	74 07                	je     80106e11 <uartputc+0x41>
+80106e0a:	89 f2                	mov    %esi,%edx
+80106e0c:	ec                   	in     (%dx),%al
+80106e0d:	a8 20                	test   $0x20,%al
+80106e0f:	74 e7                	je     80106df8 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106e11:	8b 45 08             	mov    0x8(%ebp),%eax
+80106e14:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106e19:	ee                   	out    %al,(%dx)
+}
+80106e1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106e1d:	5b                   	pop    %ebx
+80106e1e:	5e                   	pop    %esi
+80106e1f:	5d                   	pop    %ebp
+80106e20:	c3                   	ret
+80106e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e28:	c3                   	ret
+80106e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106e30 <uartintr>:
+
+void
+uartintr(void)
+{
+80106e30:	55                   	push   %ebp
+80106e31:	89 e5                	mov    %esp,%ebp
+80106e33:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80106e36:	68 b0 6c 10 80       	push   $0x80106cb0
+80106e3b:	e8 80 9a ff ff       	call   801008c0 <consoleintr>
+}
+80106e40:	83 c4 10             	add    $0x10,%esp
+80106e43:	c9                   	leave
+80106e44:	c3                   	ret
+
+80106e45 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80106e45:	6a 00                	push   $0x0
+  pushl $0
+80106e47:	6a 00                	push   $0x0
+  jmp alltraps
+80106e49:	e9 01 fa ff ff       	jmp    8010684f <alltraps>
+
+80106e4e <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80106e4e:	6a 00                	push   $0x0
+  pushl $1
+80106e50:	6a 01                	push   $0x1
+  jmp alltraps
+80106e52:	e9 f8 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e57 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80106e57:	6a 00                	push   $0x0
+  pushl $2
+80106e59:	6a 02                	push   $0x2
+  jmp alltraps
+80106e5b:	e9 ef f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e60 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80106e60:	6a 00                	push   $0x0
+  pushl $3
+80106e62:	6a 03                	push   $0x3
+  jmp alltraps
+80106e64:	e9 e6 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e69 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80106e69:	6a 00                	push   $0x0
+  pushl $4
+80106e6b:	6a 04                	push   $0x4
+  jmp alltraps
+80106e6d:	e9 dd f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e72 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80106e72:	6a 00                	push   $0x0
+  pushl $5
+80106e74:	6a 05                	push   $0x5
+  jmp alltraps
+80106e76:	e9 d4 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e7b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80106e7b:	6a 00                	push   $0x0
+  pushl $6
+80106e7d:	6a 06                	push   $0x6
+  jmp alltraps
+80106e7f:	e9 cb f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e84 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80106e84:	6a 00                	push   $0x0
+  pushl $7
+80106e86:	6a 07                	push   $0x7
+  jmp alltraps
+80106e88:	e9 c2 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e8d <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80106e8d:	6a 08                	push   $0x8
+  jmp alltraps
+80106e8f:	e9 bb f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e94 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80106e94:	6a 00                	push   $0x0
+  pushl $9
+80106e96:	6a 09                	push   $0x9
+  jmp alltraps
+80106e98:	e9 b2 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106e9d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80106e9d:	6a 0a                	push   $0xa
+  jmp alltraps
+80106e9f:	e9 ab f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ea4 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80106ea4:	6a 0b                	push   $0xb
+  jmp alltraps
+80106ea6:	e9 a4 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106eab <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80106eab:	6a 0c                	push   $0xc
+  jmp alltraps
+80106ead:	e9 9d f9 ff ff       	jmp    8010684f <alltraps>
+
+80106eb2 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80106eb2:	6a 0d                	push   $0xd
+  jmp alltraps
+80106eb4:	e9 96 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106eb9 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80106eb9:	6a 0e                	push   $0xe
+  jmp alltraps
+80106ebb:	e9 8f f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ec0 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80106ec0:	6a 00                	push   $0x0
+  pushl $15
+80106ec2:	6a 0f                	push   $0xf
+  jmp alltraps
+80106ec4:	e9 86 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ec9 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80106ec9:	6a 00                	push   $0x0
+  pushl $16
+80106ecb:	6a 10                	push   $0x10
+  jmp alltraps
+80106ecd:	e9 7d f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ed2 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80106ed2:	6a 11                	push   $0x11
+  jmp alltraps
+80106ed4:	e9 76 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ed9 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80106ed9:	6a 00                	push   $0x0
+  pushl $18
+80106edb:	6a 12                	push   $0x12
+  jmp alltraps
+80106edd:	e9 6d f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ee2 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80106ee2:	6a 00                	push   $0x0
+  pushl $19
+80106ee4:	6a 13                	push   $0x13
+  jmp alltraps
+80106ee6:	e9 64 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106eeb <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80106eeb:	6a 00                	push   $0x0
+  pushl $20
+80106eed:	6a 14                	push   $0x14
+  jmp alltraps
+80106eef:	e9 5b f9 ff ff       	jmp    8010684f <alltraps>
+
+80106ef4 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80106ef4:	6a 00                	push   $0x0
+  pushl $21
+80106ef6:	6a 15                	push   $0x15
+  jmp alltraps
+80106ef8:	e9 52 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106efd <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80106efd:	6a 00                	push   $0x0
+  pushl $22
+80106eff:	6a 16                	push   $0x16
+  jmp alltraps
+80106f01:	e9 49 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f06 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80106f06:	6a 00                	push   $0x0
+  pushl $23
+80106f08:	6a 17                	push   $0x17
+  jmp alltraps
+80106f0a:	e9 40 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f0f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80106f0f:	6a 00                	push   $0x0
+  pushl $24
+80106f11:	6a 18                	push   $0x18
+  jmp alltraps
+80106f13:	e9 37 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f18 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80106f18:	6a 00                	push   $0x0
+  pushl $25
+80106f1a:	6a 19                	push   $0x19
+  jmp alltraps
+80106f1c:	e9 2e f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f21 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80106f21:	6a 00                	push   $0x0
+  pushl $26
+80106f23:	6a 1a                	push   $0x1a
+  jmp alltraps
+80106f25:	e9 25 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f2a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80106f2a:	6a 00                	push   $0x0
+  pushl $27
+80106f2c:	6a 1b                	push   $0x1b
+  jmp alltraps
+80106f2e:	e9 1c f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f33 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80106f33:	6a 00                	push   $0x0
+  pushl $28
+80106f35:	6a 1c                	push   $0x1c
+  jmp alltraps
+80106f37:	e9 13 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f3c <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80106f3c:	6a 00                	push   $0x0
+  pushl $29
+80106f3e:	6a 1d                	push   $0x1d
+  jmp alltraps
+80106f40:	e9 0a f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f45 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80106f45:	6a 00                	push   $0x0
+  pushl $30
+80106f47:	6a 1e                	push   $0x1e
+  jmp alltraps
+80106f49:	e9 01 f9 ff ff       	jmp    8010684f <alltraps>
+
+80106f4e <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80106f4e:	6a 00                	push   $0x0
+  pushl $31
+80106f50:	6a 1f                	push   $0x1f
+  jmp alltraps
+80106f52:	e9 f8 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f57 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80106f57:	6a 00                	push   $0x0
+  pushl $32
+80106f59:	6a 20                	push   $0x20
+  jmp alltraps
+80106f5b:	e9 ef f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f60 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80106f60:	6a 00                	push   $0x0
+  pushl $33
+80106f62:	6a 21                	push   $0x21
+  jmp alltraps
+80106f64:	e9 e6 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f69 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80106f69:	6a 00                	push   $0x0
+  pushl $34
+80106f6b:	6a 22                	push   $0x22
+  jmp alltraps
+80106f6d:	e9 dd f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f72 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80106f72:	6a 00                	push   $0x0
+  pushl $35
+80106f74:	6a 23                	push   $0x23
+  jmp alltraps
+80106f76:	e9 d4 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f7b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80106f7b:	6a 00                	push   $0x0
+  pushl $36
+80106f7d:	6a 24                	push   $0x24
+  jmp alltraps
+80106f7f:	e9 cb f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f84 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80106f84:	6a 00                	push   $0x0
+  pushl $37
+80106f86:	6a 25                	push   $0x25
+  jmp alltraps
+80106f88:	e9 c2 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f8d <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80106f8d:	6a 00                	push   $0x0
+  pushl $38
+80106f8f:	6a 26                	push   $0x26
+  jmp alltraps
+80106f91:	e9 b9 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f96 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80106f96:	6a 00                	push   $0x0
+  pushl $39
+80106f98:	6a 27                	push   $0x27
+  jmp alltraps
+80106f9a:	e9 b0 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106f9f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80106f9f:	6a 00                	push   $0x0
+  pushl $40
+80106fa1:	6a 28                	push   $0x28
+  jmp alltraps
+80106fa3:	e9 a7 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fa8 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80106fa8:	6a 00                	push   $0x0
+  pushl $41
+80106faa:	6a 29                	push   $0x29
+  jmp alltraps
+80106fac:	e9 9e f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fb1 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80106fb1:	6a 00                	push   $0x0
+  pushl $42
+80106fb3:	6a 2a                	push   $0x2a
+  jmp alltraps
+80106fb5:	e9 95 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fba <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80106fba:	6a 00                	push   $0x0
+  pushl $43
+80106fbc:	6a 2b                	push   $0x2b
+  jmp alltraps
+80106fbe:	e9 8c f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fc3 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80106fc3:	6a 00                	push   $0x0
+  pushl $44
+80106fc5:	6a 2c                	push   $0x2c
+  jmp alltraps
+80106fc7:	e9 83 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fcc <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80106fcc:	6a 00                	push   $0x0
+  pushl $45
+80106fce:	6a 2d                	push   $0x2d
+  jmp alltraps
+80106fd0:	e9 7a f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fd5 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80106fd5:	6a 00                	push   $0x0
+  pushl $46
+80106fd7:	6a 2e                	push   $0x2e
+  jmp alltraps
+80106fd9:	e9 71 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fde <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80106fde:	6a 00                	push   $0x0
+  pushl $47
+80106fe0:	6a 2f                	push   $0x2f
+  jmp alltraps
+80106fe2:	e9 68 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106fe7 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80106fe7:	6a 00                	push   $0x0
+  pushl $48
+80106fe9:	6a 30                	push   $0x30
+  jmp alltraps
+80106feb:	e9 5f f8 ff ff       	jmp    8010684f <alltraps>
+
+80106ff0 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80106ff0:	6a 00                	push   $0x0
+  pushl $49
+80106ff2:	6a 31                	push   $0x31
+  jmp alltraps
+80106ff4:	e9 56 f8 ff ff       	jmp    8010684f <alltraps>
+
+80106ff9 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80106ff9:	6a 00                	push   $0x0
+  pushl $50
+80106ffb:	6a 32                	push   $0x32
+  jmp alltraps
+80106ffd:	e9 4d f8 ff ff       	jmp    8010684f <alltraps>
+
+80107002 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80107002:	6a 00                	push   $0x0
+  pushl $51
+80107004:	6a 33                	push   $0x33
+  jmp alltraps
+80107006:	e9 44 f8 ff ff       	jmp    8010684f <alltraps>
+
+8010700b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010700b:	6a 00                	push   $0x0
+  pushl $52
+8010700d:	6a 34                	push   $0x34
+  jmp alltraps
+8010700f:	e9 3b f8 ff ff       	jmp    8010684f <alltraps>
+
+80107014 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80107014:	6a 00                	push   $0x0
+  pushl $53
+80107016:	6a 35                	push   $0x35
+  jmp alltraps
+80107018:	e9 32 f8 ff ff       	jmp    8010684f <alltraps>
+
+8010701d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010701d:	6a 00                	push   $0x0
+  pushl $54
+8010701f:	6a 36                	push   $0x36
+  jmp alltraps
+80107021:	e9 29 f8 ff ff       	jmp    8010684f <alltraps>
+
+80107026 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80107026:	6a 00                	push   $0x0
+  pushl $55
+80107028:	6a 37                	push   $0x37
+  jmp alltraps
+8010702a:	e9 20 f8 ff ff       	jmp    8010684f <alltraps>
+
+8010702f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010702f:	6a 00                	push   $0x0
+  pushl $56
+80107031:	6a 38                	push   $0x38
+  jmp alltraps
+80107033:	e9 17 f8 ff ff       	jmp    8010684f <alltraps>
+
+80107038 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80107038:	6a 00                	push   $0x0
+  pushl $57
+8010703a:	6a 39                	push   $0x39
+  jmp alltraps
+8010703c:	e9 0e f8 ff ff       	jmp    8010684f <alltraps>
+
+80107041 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80107041:	6a 00                	push   $0x0
+  pushl $58
+80107043:	6a 3a                	push   $0x3a
+  jmp alltraps
+80107045:	e9 05 f8 ff ff       	jmp    8010684f <alltraps>
+
+8010704a <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010704a:	6a 00                	push   $0x0
+  pushl $59
+8010704c:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010704e:	e9 fc f7 ff ff       	jmp    8010684f <alltraps>
+
+80107053 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80107053:	6a 00                	push   $0x0
+  pushl $60
+80107055:	6a 3c                	push   $0x3c
+  jmp alltraps
+80107057:	e9 f3 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010705c <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010705c:	6a 00                	push   $0x0
+  pushl $61
+8010705e:	6a 3d                	push   $0x3d
+  jmp alltraps
+80107060:	e9 ea f7 ff ff       	jmp    8010684f <alltraps>
+
+80107065 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80107065:	6a 00                	push   $0x0
+  pushl $62
+80107067:	6a 3e                	push   $0x3e
+  jmp alltraps
+80107069:	e9 e1 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010706e <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010706e:	6a 00                	push   $0x0
+  pushl $63
+80107070:	6a 3f                	push   $0x3f
+  jmp alltraps
+80107072:	e9 d8 f7 ff ff       	jmp    8010684f <alltraps>
+
+80107077 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80107077:	6a 00                	push   $0x0
+  pushl $64
+80107079:	6a 40                	push   $0x40
+  jmp alltraps
+8010707b:	e9 cf f7 ff ff       	jmp    8010684f <alltraps>
+
+80107080 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80107080:	6a 00                	push   $0x0
+  pushl $65
+80107082:	6a 41                	push   $0x41
+  jmp alltraps
+80107084:	e9 c6 f7 ff ff       	jmp    8010684f <alltraps>
+
+80107089 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80107089:	6a 00                	push   $0x0
+  pushl $66
+8010708b:	6a 42                	push   $0x42
+  jmp alltraps
+8010708d:	e9 bd f7 ff ff       	jmp    8010684f <alltraps>
+
+80107092 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80107092:	6a 00                	push   $0x0
+  pushl $67
+80107094:	6a 43                	push   $0x43
+  jmp alltraps
+80107096:	e9 b4 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010709b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010709b:	6a 00                	push   $0x0
+  pushl $68
+8010709d:	6a 44                	push   $0x44
+  jmp alltraps
+8010709f:	e9 ab f7 ff ff       	jmp    8010684f <alltraps>
+
+801070a4 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+801070a4:	6a 00                	push   $0x0
+  pushl $69
+801070a6:	6a 45                	push   $0x45
+  jmp alltraps
+801070a8:	e9 a2 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070ad <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+801070ad:	6a 00                	push   $0x0
+  pushl $70
+801070af:	6a 46                	push   $0x46
+  jmp alltraps
+801070b1:	e9 99 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070b6 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+801070b6:	6a 00                	push   $0x0
+  pushl $71
+801070b8:	6a 47                	push   $0x47
+  jmp alltraps
+801070ba:	e9 90 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070bf <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+801070bf:	6a 00                	push   $0x0
+  pushl $72
+801070c1:	6a 48                	push   $0x48
+  jmp alltraps
+801070c3:	e9 87 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070c8 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+801070c8:	6a 00                	push   $0x0
+  pushl $73
+801070ca:	6a 49                	push   $0x49
+  jmp alltraps
+801070cc:	e9 7e f7 ff ff       	jmp    8010684f <alltraps>
+
+801070d1 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+801070d1:	6a 00                	push   $0x0
+  pushl $74
+801070d3:	6a 4a                	push   $0x4a
+  jmp alltraps
+801070d5:	e9 75 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070da <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+801070da:	6a 00                	push   $0x0
+  pushl $75
+801070dc:	6a 4b                	push   $0x4b
+  jmp alltraps
+801070de:	e9 6c f7 ff ff       	jmp    8010684f <alltraps>
+
+801070e3 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+801070e3:	6a 00                	push   $0x0
+  pushl $76
+801070e5:	6a 4c                	push   $0x4c
+  jmp alltraps
+801070e7:	e9 63 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070ec <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+801070ec:	6a 00                	push   $0x0
+  pushl $77
+801070ee:	6a 4d                	push   $0x4d
+  jmp alltraps
+801070f0:	e9 5a f7 ff ff       	jmp    8010684f <alltraps>
+
+801070f5 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+801070f5:	6a 00                	push   $0x0
+  pushl $78
+801070f7:	6a 4e                	push   $0x4e
+  jmp alltraps
+801070f9:	e9 51 f7 ff ff       	jmp    8010684f <alltraps>
+
+801070fe <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+801070fe:	6a 00                	push   $0x0
+  pushl $79
+80107100:	6a 4f                	push   $0x4f
+  jmp alltraps
+80107102:	e9 48 f7 ff ff       	jmp    8010684f <alltraps>
+
+80107107 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80107107:	6a 00                	push   $0x0
+  pushl $80
+80107109:	6a 50                	push   $0x50
+  jmp alltraps
+8010710b:	e9 3f f7 ff ff       	jmp    8010684f <alltraps>
+
+80107110 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80107110:	6a 00                	push   $0x0
+  pushl $81
+80107112:	6a 51                	push   $0x51
+  jmp alltraps
+80107114:	e9 36 f7 ff ff       	jmp    8010684f <alltraps>
+
+80107119 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80107119:	6a 00                	push   $0x0
+  pushl $82
+8010711b:	6a 52                	push   $0x52
+  jmp alltraps
+8010711d:	e9 2d f7 ff ff       	jmp    8010684f <alltraps>
+
+80107122 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80107122:	6a 00                	push   $0x0
+  pushl $83
+80107124:	6a 53                	push   $0x53
+  jmp alltraps
+80107126:	e9 24 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010712b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010712b:	6a 00                	push   $0x0
+  pushl $84
+8010712d:	6a 54                	push   $0x54
+  jmp alltraps
+8010712f:	e9 1b f7 ff ff       	jmp    8010684f <alltraps>
+
+80107134 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80107134:	6a 00                	push   $0x0
+  pushl $85
+80107136:	6a 55                	push   $0x55
+  jmp alltraps
+80107138:	e9 12 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010713d <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010713d:	6a 00                	push   $0x0
+  pushl $86
+8010713f:	6a 56                	push   $0x56
+  jmp alltraps
+80107141:	e9 09 f7 ff ff       	jmp    8010684f <alltraps>
+
+80107146 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80107146:	6a 00                	push   $0x0
+  pushl $87
+80107148:	6a 57                	push   $0x57
+  jmp alltraps
+8010714a:	e9 00 f7 ff ff       	jmp    8010684f <alltraps>
+
+8010714f <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010714f:	6a 00                	push   $0x0
+  pushl $88
+80107151:	6a 58                	push   $0x58
+  jmp alltraps
+80107153:	e9 f7 f6 ff ff       	jmp    8010684f <alltraps>
+
+80107158 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80107158:	6a 00                	push   $0x0
+  pushl $89
+8010715a:	6a 59                	push   $0x59
+  jmp alltraps
+8010715c:	e9 ee f6 ff ff       	jmp    8010684f <alltraps>
+
+80107161 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80107161:	6a 00                	push   $0x0
+  pushl $90
+80107163:	6a 5a                	push   $0x5a
+  jmp alltraps
+80107165:	e9 e5 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010716a <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010716a:	6a 00                	push   $0x0
+  pushl $91
+8010716c:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010716e:	e9 dc f6 ff ff       	jmp    8010684f <alltraps>
+
+80107173 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80107173:	6a 00                	push   $0x0
+  pushl $92
+80107175:	6a 5c                	push   $0x5c
+  jmp alltraps
+80107177:	e9 d3 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010717c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010717c:	6a 00                	push   $0x0
+  pushl $93
+8010717e:	6a 5d                	push   $0x5d
+  jmp alltraps
+80107180:	e9 ca f6 ff ff       	jmp    8010684f <alltraps>
+
+80107185 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80107185:	6a 00                	push   $0x0
+  pushl $94
+80107187:	6a 5e                	push   $0x5e
+  jmp alltraps
+80107189:	e9 c1 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010718e <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010718e:	6a 00                	push   $0x0
+  pushl $95
+80107190:	6a 5f                	push   $0x5f
+  jmp alltraps
+80107192:	e9 b8 f6 ff ff       	jmp    8010684f <alltraps>
+
+80107197 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80107197:	6a 00                	push   $0x0
+  pushl $96
+80107199:	6a 60                	push   $0x60
+  jmp alltraps
+8010719b:	e9 af f6 ff ff       	jmp    8010684f <alltraps>
+
+801071a0 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+801071a0:	6a 00                	push   $0x0
+  pushl $97
+801071a2:	6a 61                	push   $0x61
+  jmp alltraps
+801071a4:	e9 a6 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071a9 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+801071a9:	6a 00                	push   $0x0
+  pushl $98
+801071ab:	6a 62                	push   $0x62
+  jmp alltraps
+801071ad:	e9 9d f6 ff ff       	jmp    8010684f <alltraps>
+
+801071b2 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+801071b2:	6a 00                	push   $0x0
+  pushl $99
+801071b4:	6a 63                	push   $0x63
+  jmp alltraps
+801071b6:	e9 94 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071bb <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+801071bb:	6a 00                	push   $0x0
+  pushl $100
+801071bd:	6a 64                	push   $0x64
+  jmp alltraps
+801071bf:	e9 8b f6 ff ff       	jmp    8010684f <alltraps>
+
+801071c4 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+801071c4:	6a 00                	push   $0x0
+  pushl $101
+801071c6:	6a 65                	push   $0x65
+  jmp alltraps
+801071c8:	e9 82 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071cd <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+801071cd:	6a 00                	push   $0x0
+  pushl $102
+801071cf:	6a 66                	push   $0x66
+  jmp alltraps
+801071d1:	e9 79 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071d6 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+801071d6:	6a 00                	push   $0x0
+  pushl $103
+801071d8:	6a 67                	push   $0x67
+  jmp alltraps
+801071da:	e9 70 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071df <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+801071df:	6a 00                	push   $0x0
+  pushl $104
+801071e1:	6a 68                	push   $0x68
+  jmp alltraps
+801071e3:	e9 67 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071e8 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+801071e8:	6a 00                	push   $0x0
+  pushl $105
+801071ea:	6a 69                	push   $0x69
+  jmp alltraps
+801071ec:	e9 5e f6 ff ff       	jmp    8010684f <alltraps>
+
+801071f1 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+801071f1:	6a 00                	push   $0x0
+  pushl $106
+801071f3:	6a 6a                	push   $0x6a
+  jmp alltraps
+801071f5:	e9 55 f6 ff ff       	jmp    8010684f <alltraps>
+
+801071fa <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+801071fa:	6a 00                	push   $0x0
+  pushl $107
+801071fc:	6a 6b                	push   $0x6b
+  jmp alltraps
+801071fe:	e9 4c f6 ff ff       	jmp    8010684f <alltraps>
+
+80107203 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80107203:	6a 00                	push   $0x0
+  pushl $108
+80107205:	6a 6c                	push   $0x6c
+  jmp alltraps
+80107207:	e9 43 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010720c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010720c:	6a 00                	push   $0x0
+  pushl $109
+8010720e:	6a 6d                	push   $0x6d
+  jmp alltraps
+80107210:	e9 3a f6 ff ff       	jmp    8010684f <alltraps>
+
+80107215 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80107215:	6a 00                	push   $0x0
+  pushl $110
+80107217:	6a 6e                	push   $0x6e
+  jmp alltraps
+80107219:	e9 31 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010721e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010721e:	6a 00                	push   $0x0
+  pushl $111
+80107220:	6a 6f                	push   $0x6f
+  jmp alltraps
+80107222:	e9 28 f6 ff ff       	jmp    8010684f <alltraps>
+
+80107227 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80107227:	6a 00                	push   $0x0
+  pushl $112
+80107229:	6a 70                	push   $0x70
+  jmp alltraps
+8010722b:	e9 1f f6 ff ff       	jmp    8010684f <alltraps>
+
+80107230 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+80107230:	6a 00                	push   $0x0
+  pushl $113
+80107232:	6a 71                	push   $0x71
+  jmp alltraps
+80107234:	e9 16 f6 ff ff       	jmp    8010684f <alltraps>
+
+80107239 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+80107239:	6a 00                	push   $0x0
+  pushl $114
+8010723b:	6a 72                	push   $0x72
+  jmp alltraps
+8010723d:	e9 0d f6 ff ff       	jmp    8010684f <alltraps>
+
+80107242 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+80107242:	6a 00                	push   $0x0
+  pushl $115
+80107244:	6a 73                	push   $0x73
+  jmp alltraps
+80107246:	e9 04 f6 ff ff       	jmp    8010684f <alltraps>
+
+8010724b <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010724b:	6a 00                	push   $0x0
+  pushl $116
+8010724d:	6a 74                	push   $0x74
+  jmp alltraps
+8010724f:	e9 fb f5 ff ff       	jmp    8010684f <alltraps>
+
+80107254 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80107254:	6a 00                	push   $0x0
+  pushl $117
+80107256:	6a 75                	push   $0x75
+  jmp alltraps
+80107258:	e9 f2 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010725d <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010725d:	6a 00                	push   $0x0
+  pushl $118
+8010725f:	6a 76                	push   $0x76
+  jmp alltraps
+80107261:	e9 e9 f5 ff ff       	jmp    8010684f <alltraps>
+
+80107266 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80107266:	6a 00                	push   $0x0
+  pushl $119
+80107268:	6a 77                	push   $0x77
+  jmp alltraps
+8010726a:	e9 e0 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010726f <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010726f:	6a 00                	push   $0x0
+  pushl $120
+80107271:	6a 78                	push   $0x78
+  jmp alltraps
+80107273:	e9 d7 f5 ff ff       	jmp    8010684f <alltraps>
+
+80107278 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80107278:	6a 00                	push   $0x0
+  pushl $121
+8010727a:	6a 79                	push   $0x79
+  jmp alltraps
+8010727c:	e9 ce f5 ff ff       	jmp    8010684f <alltraps>
+
+80107281 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80107281:	6a 00                	push   $0x0
+  pushl $122
+80107283:	6a 7a                	push   $0x7a
+  jmp alltraps
+80107285:	e9 c5 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010728a <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010728a:	6a 00                	push   $0x0
+  pushl $123
+8010728c:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010728e:	e9 bc f5 ff ff       	jmp    8010684f <alltraps>
+
+80107293 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80107293:	6a 00                	push   $0x0
+  pushl $124
+80107295:	6a 7c                	push   $0x7c
+  jmp alltraps
+80107297:	e9 b3 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010729c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010729c:	6a 00                	push   $0x0
+  pushl $125
+8010729e:	6a 7d                	push   $0x7d
+  jmp alltraps
+801072a0:	e9 aa f5 ff ff       	jmp    8010684f <alltraps>
+
+801072a5 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+801072a5:	6a 00                	push   $0x0
+  pushl $126
+801072a7:	6a 7e                	push   $0x7e
+  jmp alltraps
+801072a9:	e9 a1 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072ae <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+801072ae:	6a 00                	push   $0x0
+  pushl $127
+801072b0:	6a 7f                	push   $0x7f
+  jmp alltraps
+801072b2:	e9 98 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072b7 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+801072b7:	6a 00                	push   $0x0
+  pushl $128
+801072b9:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+801072be:	e9 8c f5 ff ff       	jmp    8010684f <alltraps>
+
+801072c3 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+801072c3:	6a 00                	push   $0x0
+  pushl $129
+801072c5:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+801072ca:	e9 80 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072cf <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+801072cf:	6a 00                	push   $0x0
+  pushl $130
+801072d1:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+801072d6:	e9 74 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072db <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+801072db:	6a 00                	push   $0x0
+  pushl $131
+801072dd:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+801072e2:	e9 68 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072e7 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+801072e7:	6a 00                	push   $0x0
+  pushl $132
+801072e9:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+801072ee:	e9 5c f5 ff ff       	jmp    8010684f <alltraps>
+
+801072f3 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+801072f3:	6a 00                	push   $0x0
+  pushl $133
+801072f5:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+801072fa:	e9 50 f5 ff ff       	jmp    8010684f <alltraps>
+
+801072ff <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+801072ff:	6a 00                	push   $0x0
+  pushl $134
+80107301:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80107306:	e9 44 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010730b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010730b:	6a 00                	push   $0x0
+  pushl $135
+8010730d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80107312:	e9 38 f5 ff ff       	jmp    8010684f <alltraps>
+
+80107317 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80107317:	6a 00                	push   $0x0
+  pushl $136
+80107319:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010731e:	e9 2c f5 ff ff       	jmp    8010684f <alltraps>
+
+80107323 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80107323:	6a 00                	push   $0x0
+  pushl $137
+80107325:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010732a:	e9 20 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010732f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010732f:	6a 00                	push   $0x0
+  pushl $138
+80107331:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80107336:	e9 14 f5 ff ff       	jmp    8010684f <alltraps>
+
+8010733b <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010733b:	6a 00                	push   $0x0
+  pushl $139
+8010733d:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80107342:	e9 08 f5 ff ff       	jmp    8010684f <alltraps>
+
+80107347 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80107347:	6a 00                	push   $0x0
+  pushl $140
+80107349:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010734e:	e9 fc f4 ff ff       	jmp    8010684f <alltraps>
+
+80107353 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80107353:	6a 00                	push   $0x0
+  pushl $141
+80107355:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010735a:	e9 f0 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010735f <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010735f:	6a 00                	push   $0x0
+  pushl $142
+80107361:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80107366:	e9 e4 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010736b <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010736b:	6a 00                	push   $0x0
+  pushl $143
+8010736d:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80107372:	e9 d8 f4 ff ff       	jmp    8010684f <alltraps>
+
+80107377 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80107377:	6a 00                	push   $0x0
+  pushl $144
+80107379:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010737e:	e9 cc f4 ff ff       	jmp    8010684f <alltraps>
+
+80107383 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80107383:	6a 00                	push   $0x0
+  pushl $145
+80107385:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010738a:	e9 c0 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010738f <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010738f:	6a 00                	push   $0x0
+  pushl $146
+80107391:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80107396:	e9 b4 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010739b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010739b:	6a 00                	push   $0x0
+  pushl $147
+8010739d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+801073a2:	e9 a8 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073a7 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+801073a7:	6a 00                	push   $0x0
+  pushl $148
+801073a9:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+801073ae:	e9 9c f4 ff ff       	jmp    8010684f <alltraps>
+
+801073b3 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+801073b3:	6a 00                	push   $0x0
+  pushl $149
+801073b5:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+801073ba:	e9 90 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073bf <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+801073bf:	6a 00                	push   $0x0
+  pushl $150
+801073c1:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+801073c6:	e9 84 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073cb <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+801073cb:	6a 00                	push   $0x0
+  pushl $151
+801073cd:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+801073d2:	e9 78 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073d7 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+801073d7:	6a 00                	push   $0x0
+  pushl $152
+801073d9:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+801073de:	e9 6c f4 ff ff       	jmp    8010684f <alltraps>
+
+801073e3 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+801073e3:	6a 00                	push   $0x0
+  pushl $153
+801073e5:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+801073ea:	e9 60 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073ef <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+801073ef:	6a 00                	push   $0x0
+  pushl $154
+801073f1:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+801073f6:	e9 54 f4 ff ff       	jmp    8010684f <alltraps>
+
+801073fb <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+801073fb:	6a 00                	push   $0x0
+  pushl $155
+801073fd:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80107402:	e9 48 f4 ff ff       	jmp    8010684f <alltraps>
+
+80107407 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80107407:	6a 00                	push   $0x0
+  pushl $156
+80107409:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010740e:	e9 3c f4 ff ff       	jmp    8010684f <alltraps>
+
+80107413 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80107413:	6a 00                	push   $0x0
+  pushl $157
+80107415:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010741a:	e9 30 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010741f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010741f:	6a 00                	push   $0x0
+  pushl $158
+80107421:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80107426:	e9 24 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010742b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010742b:	6a 00                	push   $0x0
+  pushl $159
+8010742d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80107432:	e9 18 f4 ff ff       	jmp    8010684f <alltraps>
+
+80107437 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80107437:	6a 00                	push   $0x0
+  pushl $160
+80107439:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010743e:	e9 0c f4 ff ff       	jmp    8010684f <alltraps>
+
+80107443 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80107443:	6a 00                	push   $0x0
+  pushl $161
+80107445:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010744a:	e9 00 f4 ff ff       	jmp    8010684f <alltraps>
+
+8010744f <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010744f:	6a 00                	push   $0x0
+  pushl $162
+80107451:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80107456:	e9 f4 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010745b <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010745b:	6a 00                	push   $0x0
+  pushl $163
+8010745d:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80107462:	e9 e8 f3 ff ff       	jmp    8010684f <alltraps>
+
+80107467 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80107467:	6a 00                	push   $0x0
+  pushl $164
+80107469:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010746e:	e9 dc f3 ff ff       	jmp    8010684f <alltraps>
+
+80107473 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80107473:	6a 00                	push   $0x0
+  pushl $165
+80107475:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010747a:	e9 d0 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010747f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010747f:	6a 00                	push   $0x0
+  pushl $166
+80107481:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80107486:	e9 c4 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010748b <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010748b:	6a 00                	push   $0x0
+  pushl $167
+8010748d:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80107492:	e9 b8 f3 ff ff       	jmp    8010684f <alltraps>
+
+80107497 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80107497:	6a 00                	push   $0x0
+  pushl $168
+80107499:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010749e:	e9 ac f3 ff ff       	jmp    8010684f <alltraps>
+
+801074a3 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+801074a3:	6a 00                	push   $0x0
+  pushl $169
+801074a5:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+801074aa:	e9 a0 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074af <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+801074af:	6a 00                	push   $0x0
+  pushl $170
+801074b1:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+801074b6:	e9 94 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074bb <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+801074bb:	6a 00                	push   $0x0
+  pushl $171
+801074bd:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+801074c2:	e9 88 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074c7 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+801074c7:	6a 00                	push   $0x0
+  pushl $172
+801074c9:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+801074ce:	e9 7c f3 ff ff       	jmp    8010684f <alltraps>
+
+801074d3 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+801074d3:	6a 00                	push   $0x0
+  pushl $173
+801074d5:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+801074da:	e9 70 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074df <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+801074df:	6a 00                	push   $0x0
+  pushl $174
+801074e1:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+801074e6:	e9 64 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074eb <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+801074eb:	6a 00                	push   $0x0
+  pushl $175
+801074ed:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+801074f2:	e9 58 f3 ff ff       	jmp    8010684f <alltraps>
+
+801074f7 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+801074f7:	6a 00                	push   $0x0
+  pushl $176
+801074f9:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+801074fe:	e9 4c f3 ff ff       	jmp    8010684f <alltraps>
+
+80107503 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80107503:	6a 00                	push   $0x0
+  pushl $177
+80107505:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010750a:	e9 40 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010750f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010750f:	6a 00                	push   $0x0
+  pushl $178
+80107511:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80107516:	e9 34 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010751b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010751b:	6a 00                	push   $0x0
+  pushl $179
+8010751d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80107522:	e9 28 f3 ff ff       	jmp    8010684f <alltraps>
+
+80107527 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80107527:	6a 00                	push   $0x0
+  pushl $180
+80107529:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010752e:	e9 1c f3 ff ff       	jmp    8010684f <alltraps>
+
+80107533 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80107533:	6a 00                	push   $0x0
+  pushl $181
+80107535:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010753a:	e9 10 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010753f <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010753f:	6a 00                	push   $0x0
+  pushl $182
+80107541:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80107546:	e9 04 f3 ff ff       	jmp    8010684f <alltraps>
+
+8010754b <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010754b:	6a 00                	push   $0x0
+  pushl $183
+8010754d:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80107552:	e9 f8 f2 ff ff       	jmp    8010684f <alltraps>
+
+80107557 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80107557:	6a 00                	push   $0x0
+  pushl $184
+80107559:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010755e:	e9 ec f2 ff ff       	jmp    8010684f <alltraps>
+
+80107563 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80107563:	6a 00                	push   $0x0
+  pushl $185
+80107565:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010756a:	e9 e0 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010756f <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010756f:	6a 00                	push   $0x0
+  pushl $186
+80107571:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80107576:	e9 d4 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010757b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010757b:	6a 00                	push   $0x0
+  pushl $187
+8010757d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80107582:	e9 c8 f2 ff ff       	jmp    8010684f <alltraps>
+
+80107587 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80107587:	6a 00                	push   $0x0
+  pushl $188
+80107589:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010758e:	e9 bc f2 ff ff       	jmp    8010684f <alltraps>
+
+80107593 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80107593:	6a 00                	push   $0x0
+  pushl $189
+80107595:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010759a:	e9 b0 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010759f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010759f:	6a 00                	push   $0x0
+  pushl $190
+801075a1:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+801075a6:	e9 a4 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075ab <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+801075ab:	6a 00                	push   $0x0
+  pushl $191
+801075ad:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+801075b2:	e9 98 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075b7 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+801075b7:	6a 00                	push   $0x0
+  pushl $192
+801075b9:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+801075be:	e9 8c f2 ff ff       	jmp    8010684f <alltraps>
+
+801075c3 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+801075c3:	6a 00                	push   $0x0
+  pushl $193
+801075c5:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+801075ca:	e9 80 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075cf <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+801075cf:	6a 00                	push   $0x0
+  pushl $194
+801075d1:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+801075d6:	e9 74 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075db <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+801075db:	6a 00                	push   $0x0
+  pushl $195
+801075dd:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+801075e2:	e9 68 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075e7 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+801075e7:	6a 00                	push   $0x0
+  pushl $196
+801075e9:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+801075ee:	e9 5c f2 ff ff       	jmp    8010684f <alltraps>
+
+801075f3 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+801075f3:	6a 00                	push   $0x0
+  pushl $197
+801075f5:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+801075fa:	e9 50 f2 ff ff       	jmp    8010684f <alltraps>
+
+801075ff <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+801075ff:	6a 00                	push   $0x0
+  pushl $198
+80107601:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80107606:	e9 44 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010760b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010760b:	6a 00                	push   $0x0
+  pushl $199
+8010760d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80107612:	e9 38 f2 ff ff       	jmp    8010684f <alltraps>
+
+80107617 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80107617:	6a 00                	push   $0x0
+  pushl $200
+80107619:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010761e:	e9 2c f2 ff ff       	jmp    8010684f <alltraps>
+
+80107623 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80107623:	6a 00                	push   $0x0
+  pushl $201
+80107625:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010762a:	e9 20 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010762f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010762f:	6a 00                	push   $0x0
+  pushl $202
+80107631:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80107636:	e9 14 f2 ff ff       	jmp    8010684f <alltraps>
+
+8010763b <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010763b:	6a 00                	push   $0x0
+  pushl $203
+8010763d:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80107642:	e9 08 f2 ff ff       	jmp    8010684f <alltraps>
+
+80107647 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80107647:	6a 00                	push   $0x0
+  pushl $204
+80107649:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010764e:	e9 fc f1 ff ff       	jmp    8010684f <alltraps>
+
+80107653 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80107653:	6a 00                	push   $0x0
+  pushl $205
+80107655:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010765a:	e9 f0 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010765f <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010765f:	6a 00                	push   $0x0
+  pushl $206
+80107661:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80107666:	e9 e4 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010766b <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010766b:	6a 00                	push   $0x0
+  pushl $207
+8010766d:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80107672:	e9 d8 f1 ff ff       	jmp    8010684f <alltraps>
+
+80107677 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80107677:	6a 00                	push   $0x0
+  pushl $208
+80107679:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010767e:	e9 cc f1 ff ff       	jmp    8010684f <alltraps>
+
+80107683 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80107683:	6a 00                	push   $0x0
+  pushl $209
+80107685:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010768a:	e9 c0 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010768f <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010768f:	6a 00                	push   $0x0
+  pushl $210
+80107691:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80107696:	e9 b4 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010769b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010769b:	6a 00                	push   $0x0
+  pushl $211
+8010769d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+801076a2:	e9 a8 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076a7 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+801076a7:	6a 00                	push   $0x0
+  pushl $212
+801076a9:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+801076ae:	e9 9c f1 ff ff       	jmp    8010684f <alltraps>
+
+801076b3 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+801076b3:	6a 00                	push   $0x0
+  pushl $213
+801076b5:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+801076ba:	e9 90 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076bf <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+801076bf:	6a 00                	push   $0x0
+  pushl $214
+801076c1:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+801076c6:	e9 84 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076cb <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+801076cb:	6a 00                	push   $0x0
+  pushl $215
+801076cd:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+801076d2:	e9 78 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076d7 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+801076d7:	6a 00                	push   $0x0
+  pushl $216
+801076d9:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+801076de:	e9 6c f1 ff ff       	jmp    8010684f <alltraps>
+
+801076e3 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+801076e3:	6a 00                	push   $0x0
+  pushl $217
+801076e5:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+801076ea:	e9 60 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076ef <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+801076ef:	6a 00                	push   $0x0
+  pushl $218
+801076f1:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+801076f6:	e9 54 f1 ff ff       	jmp    8010684f <alltraps>
+
+801076fb <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+801076fb:	6a 00                	push   $0x0
+  pushl $219
+801076fd:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80107702:	e9 48 f1 ff ff       	jmp    8010684f <alltraps>
+
+80107707 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80107707:	6a 00                	push   $0x0
+  pushl $220
+80107709:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010770e:	e9 3c f1 ff ff       	jmp    8010684f <alltraps>
+
+80107713 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80107713:	6a 00                	push   $0x0
+  pushl $221
+80107715:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010771a:	e9 30 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010771f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010771f:	6a 00                	push   $0x0
+  pushl $222
+80107721:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80107726:	e9 24 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010772b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010772b:	6a 00                	push   $0x0
+  pushl $223
+8010772d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80107732:	e9 18 f1 ff ff       	jmp    8010684f <alltraps>
+
+80107737 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80107737:	6a 00                	push   $0x0
+  pushl $224
+80107739:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010773e:	e9 0c f1 ff ff       	jmp    8010684f <alltraps>
+
+80107743 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80107743:	6a 00                	push   $0x0
+  pushl $225
+80107745:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010774a:	e9 00 f1 ff ff       	jmp    8010684f <alltraps>
+
+8010774f <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010774f:	6a 00                	push   $0x0
+  pushl $226
+80107751:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80107756:	e9 f4 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010775b <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010775b:	6a 00                	push   $0x0
+  pushl $227
+8010775d:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80107762:	e9 e8 f0 ff ff       	jmp    8010684f <alltraps>
+
+80107767 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80107767:	6a 00                	push   $0x0
+  pushl $228
+80107769:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010776e:	e9 dc f0 ff ff       	jmp    8010684f <alltraps>
+
+80107773 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80107773:	6a 00                	push   $0x0
+  pushl $229
+80107775:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010777a:	e9 d0 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010777f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010777f:	6a 00                	push   $0x0
+  pushl $230
+80107781:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80107786:	e9 c4 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010778b <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010778b:	6a 00                	push   $0x0
+  pushl $231
+8010778d:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80107792:	e9 b8 f0 ff ff       	jmp    8010684f <alltraps>
+
+80107797 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80107797:	6a 00                	push   $0x0
+  pushl $232
+80107799:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010779e:	e9 ac f0 ff ff       	jmp    8010684f <alltraps>
+
+801077a3 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+801077a3:	6a 00                	push   $0x0
+  pushl $233
+801077a5:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+801077aa:	e9 a0 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077af <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+801077af:	6a 00                	push   $0x0
+  pushl $234
+801077b1:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+801077b6:	e9 94 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077bb <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+801077bb:	6a 00                	push   $0x0
+  pushl $235
+801077bd:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+801077c2:	e9 88 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077c7 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+801077c7:	6a 00                	push   $0x0
+  pushl $236
+801077c9:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+801077ce:	e9 7c f0 ff ff       	jmp    8010684f <alltraps>
+
+801077d3 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+801077d3:	6a 00                	push   $0x0
+  pushl $237
+801077d5:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+801077da:	e9 70 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077df <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+801077df:	6a 00                	push   $0x0
+  pushl $238
+801077e1:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+801077e6:	e9 64 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077eb <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+801077eb:	6a 00                	push   $0x0
+  pushl $239
+801077ed:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+801077f2:	e9 58 f0 ff ff       	jmp    8010684f <alltraps>
+
+801077f7 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+801077f7:	6a 00                	push   $0x0
+  pushl $240
+801077f9:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+801077fe:	e9 4c f0 ff ff       	jmp    8010684f <alltraps>
+
+80107803 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80107803:	6a 00                	push   $0x0
+  pushl $241
+80107805:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010780a:	e9 40 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010780f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010780f:	6a 00                	push   $0x0
+  pushl $242
+80107811:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80107816:	e9 34 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010781b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010781b:	6a 00                	push   $0x0
+  pushl $243
+8010781d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80107822:	e9 28 f0 ff ff       	jmp    8010684f <alltraps>
+
+80107827 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80107827:	6a 00                	push   $0x0
+  pushl $244
+80107829:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010782e:	e9 1c f0 ff ff       	jmp    8010684f <alltraps>
+
+80107833 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80107833:	6a 00                	push   $0x0
+  pushl $245
+80107835:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010783a:	e9 10 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010783f <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010783f:	6a 00                	push   $0x0
+  pushl $246
+80107841:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80107846:	e9 04 f0 ff ff       	jmp    8010684f <alltraps>
+
+8010784b <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010784b:	6a 00                	push   $0x0
+  pushl $247
+8010784d:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80107852:	e9 f8 ef ff ff       	jmp    8010684f <alltraps>
+
+80107857 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80107857:	6a 00                	push   $0x0
+  pushl $248
+80107859:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010785e:	e9 ec ef ff ff       	jmp    8010684f <alltraps>
+
+80107863 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80107863:	6a 00                	push   $0x0
+  pushl $249
+80107865:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010786a:	e9 e0 ef ff ff       	jmp    8010684f <alltraps>
+
+8010786f <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010786f:	6a 00                	push   $0x0
+  pushl $250
+80107871:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80107876:	e9 d4 ef ff ff       	jmp    8010684f <alltraps>
+
+8010787b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010787b:	6a 00                	push   $0x0
+  pushl $251
+8010787d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80107882:	e9 c8 ef ff ff       	jmp    8010684f <alltraps>
+
+80107887 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80107887:	6a 00                	push   $0x0
+  pushl $252
+80107889:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010788e:	e9 bc ef ff ff       	jmp    8010684f <alltraps>
+
+80107893 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80107893:	6a 00                	push   $0x0
+  pushl $253
+80107895:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010789a:	e9 b0 ef ff ff       	jmp    8010684f <alltraps>
+
+8010789f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010789f:	6a 00                	push   $0x0
+  pushl $254
+801078a1:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+801078a6:	e9 a4 ef ff ff       	jmp    8010684f <alltraps>
+
+801078ab <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+801078ab:	6a 00                	push   $0x0
+  pushl $255
+801078ad:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+801078b2:	e9 98 ef ff ff       	jmp    8010684f <alltraps>
+801078b7:	66 90                	xchg   %ax,%ax
+801078b9:	66 90                	xchg   %ax,%ax
+801078bb:	66 90                	xchg   %ax,%ax
+801078bd:	66 90                	xchg   %ax,%ax
+801078bf:	90                   	nop
+
+801078c0 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+801078c0:	55                   	push   %ebp
+801078c1:	89 e5                	mov    %esp,%ebp
+801078c3:	57                   	push   %edi
+801078c4:	56                   	push   %esi
+801078c5:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+801078c6:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+801078cc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+801078d2:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+801078d5:	39 d3                	cmp    %edx,%ebx
+801078d7:	73 56                	jae    8010792f <deallocuvm.part.0+0x6f>
+801078d9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801078dc:	89 c6                	mov    %eax,%esi
+801078de:	89 d7                	mov    %edx,%edi
+801078e0:	eb 12                	jmp    801078f4 <deallocuvm.part.0+0x34>
+801078e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+801078e8:	83 c2 01             	add    $0x1,%edx
+801078eb:	89 d3                	mov    %edx,%ebx
+801078ed:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+801078f0:	39 fb                	cmp    %edi,%ebx
+801078f2:	73 38                	jae    8010792c <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+801078f4:	89 da                	mov    %ebx,%edx
+801078f6:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+801078f9:	8b 04 96             	mov    (%esi,%edx,4),%eax
+801078fc:	a8 01                	test   $0x1,%al
+801078fe:	74 e8                	je     801078e8 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+80107900:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107902:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80107907:	c1 e9 0a             	shr    $0xa,%ecx
+8010790a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+80107910:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+80107917:	85 c0                	test   %eax,%eax
+80107919:	74 cd                	je     801078e8 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010791b:	8b 10                	mov    (%eax),%edx
+8010791d:	f6 c2 01             	test   $0x1,%dl
+80107920:	75 1e                	jne    80107940 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+80107922:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80107928:	39 fb                	cmp    %edi,%ebx
+8010792a:	72 c8                	jb     801078f4 <deallocuvm.part.0+0x34>
+8010792c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010792f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107932:	89 c8                	mov    %ecx,%eax
+80107934:	5b                   	pop    %ebx
+80107935:	5e                   	pop    %esi
+80107936:	5f                   	pop    %edi
+80107937:	5d                   	pop    %ebp
+80107938:	c3                   	ret
+80107939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+80107940:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+80107946:	74 26                	je     8010796e <deallocuvm.part.0+0xae>
+      kfree(v);
+80107948:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010794b:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+80107951:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+80107954:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010795a:	52                   	push   %edx
+8010795b:	e8 c0 ab ff ff       	call   80102520 <kfree>
+      *pte = 0;
+80107960:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+80107963:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+80107966:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010796c:	eb 82                	jmp    801078f0 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010796e:	83 ec 0c             	sub    $0xc,%esp
+80107971:	68 86 85 10 80       	push   $0x80108586
+80107976:	e8 05 8a ff ff       	call   80100380 <panic>
+8010797b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010797f:	90                   	nop
+
+80107980 <mappages>:
+{
+80107980:	55                   	push   %ebp
+80107981:	89 e5                	mov    %esp,%ebp
+80107983:	57                   	push   %edi
+80107984:	56                   	push   %esi
+80107985:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+80107986:	89 d3                	mov    %edx,%ebx
+80107988:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010798e:	83 ec 1c             	sub    $0x1c,%esp
+80107991:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+80107994:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+80107998:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010799d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801079a0:	8b 45 08             	mov    0x8(%ebp),%eax
+801079a3:	29 d8                	sub    %ebx,%eax
+801079a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801079a8:	eb 3f                	jmp    801079e9 <mappages+0x69>
+801079aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+801079b0:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+801079b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+801079b7:	c1 ea 0a             	shr    $0xa,%edx
+801079ba:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+801079c0:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+801079c7:	85 c0                	test   %eax,%eax
+801079c9:	74 75                	je     80107a40 <mappages+0xc0>
+    if(*pte & PTE_P)
+801079cb:	f6 00 01             	testb  $0x1,(%eax)
+801079ce:	0f 85 86 00 00 00    	jne    80107a5a <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+801079d4:	0b 75 0c             	or     0xc(%ebp),%esi
+801079d7:	83 ce 01             	or     $0x1,%esi
+801079da:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+801079dc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801079df:	39 c3                	cmp    %eax,%ebx
+801079e1:	74 6d                	je     80107a50 <mappages+0xd0>
+    a += PGSIZE;
+801079e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+801079e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+801079ec:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801079ef:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+801079f2:	89 d8                	mov    %ebx,%eax
+801079f4:	c1 e8 16             	shr    $0x16,%eax
+801079f7:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+801079fa:	8b 07                	mov    (%edi),%eax
+801079fc:	a8 01                	test   $0x1,%al
+801079fe:	75 b0                	jne    801079b0 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+80107a00:	e8 db ac ff ff       	call   801026e0 <kalloc>
+80107a05:	85 c0                	test   %eax,%eax
+80107a07:	74 37                	je     80107a40 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+80107a09:	83 ec 04             	sub    $0x4,%esp
+80107a0c:	68 00 10 00 00       	push   $0x1000
+80107a11:	6a 00                	push   $0x0
+80107a13:	50                   	push   %eax
+80107a14:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80107a17:	e8 94 db ff ff       	call   801055b0 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80107a1c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+80107a1f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80107a22:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+80107a28:	83 c8 07             	or     $0x7,%eax
+80107a2b:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+80107a2d:	89 d8                	mov    %ebx,%eax
+80107a2f:	c1 e8 0a             	shr    $0xa,%eax
+80107a32:	25 fc 0f 00 00       	and    $0xffc,%eax
+80107a37:	01 d0                	add    %edx,%eax
+80107a39:	eb 90                	jmp    801079cb <mappages+0x4b>
+80107a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107a3f:	90                   	nop
+}
+80107a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+80107a43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107a48:	5b                   	pop    %ebx
+80107a49:	5e                   	pop    %esi
+80107a4a:	5f                   	pop    %edi
+80107a4b:	5d                   	pop    %ebp
+80107a4c:	c3                   	ret
+80107a4d:	8d 76 00             	lea    0x0(%esi),%esi
+80107a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80107a53:	31 c0                	xor    %eax,%eax
+}
+80107a55:	5b                   	pop    %ebx
+80107a56:	5e                   	pop    %esi
+80107a57:	5f                   	pop    %edi
+80107a58:	5d                   	pop    %ebp
+80107a59:	c3                   	ret
+      panic("remap");
+80107a5a:	83 ec 0c             	sub    $0xc,%esp
+80107a5d:	68 20 8c 10 80       	push   $0x80108c20
+80107a62:	e8 19 89 ff ff       	call   80100380 <panic>
+80107a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a6e:	66 90                	xchg   %ax,%ax
+
+80107a70 <seginit>:
+{
+80107a70:	55                   	push   %ebp
+80107a71:	89 e5                	mov    %esp,%ebp
+80107a73:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+80107a76:	e8 a5 c0 ff ff       	call   80103b20 <cpuid>
+  pd[0] = size-1;
+80107a7b:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80107a80:	69 c0 f0 00 00 00    	imul   $0xf0,%eax,%eax
+80107a86:	c7 80 18 28 11 80 ff 	movl   $0xffff,-0x7feed7e8(%eax)
+80107a8d:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80107a90:	c7 80 20 28 11 80 ff 	movl   $0xffff,-0x7feed7e0(%eax)
+80107a97:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80107a9a:	c7 80 28 28 11 80 ff 	movl   $0xffff,-0x7feed7d8(%eax)
+80107aa1:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80107aa4:	c7 80 30 28 11 80 ff 	movl   $0xffff,-0x7feed7d0(%eax)
+80107aab:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80107aae:	c7 80 1c 28 11 80 00 	movl   $0xcf9a00,-0x7feed7e4(%eax)
+80107ab5:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80107ab8:	c7 80 24 28 11 80 00 	movl   $0xcf9200,-0x7feed7dc(%eax)
+80107abf:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80107ac2:	c7 80 2c 28 11 80 00 	movl   $0xcffa00,-0x7feed7d4(%eax)
+80107ac9:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80107acc:	c7 80 34 28 11 80 00 	movl   $0xcff200,-0x7feed7cc(%eax)
+80107ad3:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+80107ad6:	05 10 28 11 80       	add    $0x80112810,%eax
+80107adb:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+80107adf:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+80107ae3:	c1 e8 10             	shr    $0x10,%eax
+80107ae6:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+80107aea:	8d 45 f2             	lea    -0xe(%ebp),%eax
+80107aed:	0f 01 10             	lgdtl  (%eax)
+}
+80107af0:	c9                   	leave
+80107af1:	c3                   	ret
+80107af2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107b00 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80107b00:	a1 e4 5d 11 80       	mov    0x80115de4,%eax
+80107b05:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80107b0a:	0f 22 d8             	mov    %eax,%cr3
+}
+80107b0d:	c3                   	ret
+80107b0e:	66 90                	xchg   %ax,%ax
+
+80107b10 <switchuvm>:
+{
+80107b10:	55                   	push   %ebp
+80107b11:	89 e5                	mov    %esp,%ebp
+80107b13:	57                   	push   %edi
+80107b14:	56                   	push   %esi
+80107b15:	53                   	push   %ebx
+80107b16:	83 ec 1c             	sub    $0x1c,%esp
+80107b19:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+80107b1c:	85 f6                	test   %esi,%esi
+80107b1e:	0f 84 cb 00 00 00    	je     80107bef <switchuvm+0xdf>
+  if(p->kstack == 0)
+80107b24:	8b 46 08             	mov    0x8(%esi),%eax
+80107b27:	85 c0                	test   %eax,%eax
+80107b29:	0f 84 da 00 00 00    	je     80107c09 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+80107b2f:	8b 46 04             	mov    0x4(%esi),%eax
+80107b32:	85 c0                	test   %eax,%eax
+80107b34:	0f 84 c2 00 00 00    	je     80107bfc <switchuvm+0xec>
+  pushcli();
+80107b3a:	e8 41 d8 ff ff       	call   80105380 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+80107b3f:	e8 7c bf ff ff       	call   80103ac0 <mycpu>
+80107b44:	89 c3                	mov    %eax,%ebx
+80107b46:	e8 75 bf ff ff       	call   80103ac0 <mycpu>
+80107b4b:	89 c7                	mov    %eax,%edi
+80107b4d:	e8 6e bf ff ff       	call   80103ac0 <mycpu>
+80107b52:	83 c7 08             	add    $0x8,%edi
+80107b55:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107b58:	e8 63 bf ff ff       	call   80103ac0 <mycpu>
+80107b5d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80107b60:	ba 67 00 00 00       	mov    $0x67,%edx
+80107b65:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+80107b6c:	83 c0 08             	add    $0x8,%eax
+80107b6f:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+80107b76:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+80107b7b:	83 c1 08             	add    $0x8,%ecx
+80107b7e:	c1 e8 18             	shr    $0x18,%eax
+80107b81:	c1 e9 10             	shr    $0x10,%ecx
+80107b84:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+80107b8a:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+80107b90:	b9 99 40 00 00       	mov    $0x4099,%ecx
+80107b95:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+80107b9c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+80107ba1:	e8 1a bf ff ff       	call   80103ac0 <mycpu>
+80107ba6:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+80107bad:	e8 0e bf ff ff       	call   80103ac0 <mycpu>
+80107bb2:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+80107bb6:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107bb9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80107bbf:	e8 fc be ff ff       	call   80103ac0 <mycpu>
+80107bc4:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+80107bc7:	e8 f4 be ff ff       	call   80103ac0 <mycpu>
+80107bcc:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+80107bd0:	b8 28 00 00 00       	mov    $0x28,%eax
+80107bd5:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+80107bd8:	8b 46 04             	mov    0x4(%esi),%eax
+80107bdb:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80107be0:	0f 22 d8             	mov    %eax,%cr3
+}
+80107be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107be6:	5b                   	pop    %ebx
+80107be7:	5e                   	pop    %esi
+80107be8:	5f                   	pop    %edi
+80107be9:	5d                   	pop    %ebp
+  popcli();
+80107bea:	e9 e1 d7 ff ff       	jmp    801053d0 <popcli>
+    panic("switchuvm: no process");
+80107bef:	83 ec 0c             	sub    $0xc,%esp
+80107bf2:	68 26 8c 10 80       	push   $0x80108c26
+80107bf7:	e8 84 87 ff ff       	call   80100380 <panic>
+    panic("switchuvm: no pgdir");
+80107bfc:	83 ec 0c             	sub    $0xc,%esp
+80107bff:	68 51 8c 10 80       	push   $0x80108c51
+80107c04:	e8 77 87 ff ff       	call   80100380 <panic>
+    panic("switchuvm: no kstack");
+80107c09:	83 ec 0c             	sub    $0xc,%esp
+80107c0c:	68 3c 8c 10 80       	push   $0x80108c3c
+80107c11:	e8 6a 87 ff ff       	call   80100380 <panic>
+80107c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107c20 <inituvm>:
+{
+80107c20:	55                   	push   %ebp
+80107c21:	89 e5                	mov    %esp,%ebp
+80107c23:	57                   	push   %edi
+80107c24:	56                   	push   %esi
+80107c25:	53                   	push   %ebx
+80107c26:	83 ec 1c             	sub    $0x1c,%esp
+80107c29:	8b 45 08             	mov    0x8(%ebp),%eax
+80107c2c:	8b 75 10             	mov    0x10(%ebp),%esi
+80107c2f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107c32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+80107c35:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+80107c3b:	77 49                	ja     80107c86 <inituvm+0x66>
+  mem = kalloc();
+80107c3d:	e8 9e aa ff ff       	call   801026e0 <kalloc>
+  memset(mem, 0, PGSIZE);
+80107c42:	83 ec 04             	sub    $0x4,%esp
+80107c45:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+80107c4a:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+80107c4c:	6a 00                	push   $0x0
+80107c4e:	50                   	push   %eax
+80107c4f:	e8 5c d9 ff ff       	call   801055b0 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+80107c54:	58                   	pop    %eax
+80107c55:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80107c5b:	5a                   	pop    %edx
+80107c5c:	6a 06                	push   $0x6
+80107c5e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80107c63:	31 d2                	xor    %edx,%edx
+80107c65:	50                   	push   %eax
+80107c66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107c69:	e8 12 fd ff ff       	call   80107980 <mappages>
+  memmove(mem, init, sz);
+80107c6e:	89 75 10             	mov    %esi,0x10(%ebp)
+80107c71:	83 c4 10             	add    $0x10,%esp
+80107c74:	89 7d 0c             	mov    %edi,0xc(%ebp)
+80107c77:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80107c7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107c7d:	5b                   	pop    %ebx
+80107c7e:	5e                   	pop    %esi
+80107c7f:	5f                   	pop    %edi
+80107c80:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+80107c81:	e9 ba d9 ff ff       	jmp    80105640 <memmove>
+    panic("inituvm: more than a page");
+80107c86:	83 ec 0c             	sub    $0xc,%esp
+80107c89:	68 65 8c 10 80       	push   $0x80108c65
+80107c8e:	e8 ed 86 ff ff       	call   80100380 <panic>
+80107c93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107ca0 <loaduvm>:
+{
+80107ca0:	55                   	push   %ebp
+80107ca1:	89 e5                	mov    %esp,%ebp
+80107ca3:	57                   	push   %edi
+80107ca4:	56                   	push   %esi
+80107ca5:	53                   	push   %ebx
+80107ca6:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+80107ca9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+80107cac:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+80107caf:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+80107cb5:	0f 85 a2 00 00 00    	jne    80107d5d <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+80107cbb:	85 ff                	test   %edi,%edi
+80107cbd:	74 7d                	je     80107d3c <loaduvm+0x9c>
+80107cbf:	90                   	nop
+  pde = &pgdir[PDX(va)];
+80107cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80107cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+80107cc6:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+80107cc8:	89 c1                	mov    %eax,%ecx
+80107cca:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+80107ccd:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+80107cd0:	f6 c1 01             	test   $0x1,%cl
+80107cd3:	75 13                	jne    80107ce8 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+80107cd5:	83 ec 0c             	sub    $0xc,%esp
+80107cd8:	68 7f 8c 10 80       	push   $0x80108c7f
+80107cdd:	e8 9e 86 ff ff       	call   80100380 <panic>
+80107ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+80107ce8:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107ceb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+80107cf1:	25 fc 0f 00 00       	and    $0xffc,%eax
+80107cf6:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+80107cfd:	85 c9                	test   %ecx,%ecx
+80107cff:	74 d4                	je     80107cd5 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+80107d01:	89 fb                	mov    %edi,%ebx
+80107d03:	b8 00 10 00 00       	mov    $0x1000,%eax
+80107d08:	29 f3                	sub    %esi,%ebx
+80107d0a:	39 c3                	cmp    %eax,%ebx
+80107d0c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+80107d0f:	53                   	push   %ebx
+80107d10:	8b 45 14             	mov    0x14(%ebp),%eax
+80107d13:	01 f0                	add    %esi,%eax
+80107d15:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+80107d16:	8b 01                	mov    (%ecx),%eax
+80107d18:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+80107d1d:	05 00 00 00 80       	add    $0x80000000,%eax
+80107d22:	50                   	push   %eax
+80107d23:	ff 75 10             	push   0x10(%ebp)
+80107d26:	e8 b5 9d ff ff       	call   80101ae0 <readi>
+80107d2b:	83 c4 10             	add    $0x10,%esp
+80107d2e:	39 d8                	cmp    %ebx,%eax
+80107d30:	75 1e                	jne    80107d50 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+80107d32:	81 c6 00 10 00 00    	add    $0x1000,%esi
+80107d38:	39 fe                	cmp    %edi,%esi
+80107d3a:	72 84                	jb     80107cc0 <loaduvm+0x20>
+}
+80107d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80107d3f:	31 c0                	xor    %eax,%eax
+}
+80107d41:	5b                   	pop    %ebx
+80107d42:	5e                   	pop    %esi
+80107d43:	5f                   	pop    %edi
+80107d44:	5d                   	pop    %ebp
+80107d45:	c3                   	ret
+80107d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d4d:	8d 76 00             	lea    0x0(%esi),%esi
+80107d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+80107d53:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107d58:	5b                   	pop    %ebx
+80107d59:	5e                   	pop    %esi
+80107d5a:	5f                   	pop    %edi
+80107d5b:	5d                   	pop    %ebp
+80107d5c:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+80107d5d:	83 ec 0c             	sub    $0xc,%esp
+80107d60:	68 20 8d 10 80       	push   $0x80108d20
+80107d65:	e8 16 86 ff ff       	call   80100380 <panic>
+80107d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107d70 <allocuvm>:
+{
+80107d70:	55                   	push   %ebp
+80107d71:	89 e5                	mov    %esp,%ebp
+80107d73:	57                   	push   %edi
+80107d74:	56                   	push   %esi
+80107d75:	53                   	push   %ebx
+80107d76:	83 ec 1c             	sub    $0x1c,%esp
+80107d79:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+80107d7c:	85 f6                	test   %esi,%esi
+80107d7e:	0f 88 98 00 00 00    	js     80107e1c <allocuvm+0xac>
+80107d84:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+80107d86:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107d89:	0f 82 a1 00 00 00    	jb     80107e30 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+80107d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107d92:	05 ff 0f 00 00       	add    $0xfff,%eax
+80107d97:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80107d9c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+80107d9e:	39 f0                	cmp    %esi,%eax
+80107da0:	0f 83 8d 00 00 00    	jae    80107e33 <allocuvm+0xc3>
+80107da6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80107da9:	eb 44                	jmp    80107def <allocuvm+0x7f>
+80107dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107daf:	90                   	nop
+    memset(mem, 0, PGSIZE);
+80107db0:	83 ec 04             	sub    $0x4,%esp
+80107db3:	68 00 10 00 00       	push   $0x1000
+80107db8:	6a 00                	push   $0x0
+80107dba:	50                   	push   %eax
+80107dbb:	e8 f0 d7 ff ff       	call   801055b0 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+80107dc0:	58                   	pop    %eax
+80107dc1:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80107dc7:	5a                   	pop    %edx
+80107dc8:	6a 06                	push   $0x6
+80107dca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80107dcf:	89 fa                	mov    %edi,%edx
+80107dd1:	50                   	push   %eax
+80107dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+80107dd5:	e8 a6 fb ff ff       	call   80107980 <mappages>
+80107dda:	83 c4 10             	add    $0x10,%esp
+80107ddd:	85 c0                	test   %eax,%eax
+80107ddf:	78 5f                	js     80107e40 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+80107de1:	81 c7 00 10 00 00    	add    $0x1000,%edi
+80107de7:	39 f7                	cmp    %esi,%edi
+80107de9:	0f 83 89 00 00 00    	jae    80107e78 <allocuvm+0x108>
+    mem = kalloc();
+80107def:	e8 ec a8 ff ff       	call   801026e0 <kalloc>
+80107df4:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+80107df6:	85 c0                	test   %eax,%eax
+80107df8:	75 b6                	jne    80107db0 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+80107dfa:	83 ec 0c             	sub    $0xc,%esp
+80107dfd:	68 9d 8c 10 80       	push   $0x80108c9d
+80107e02:	e8 a9 88 ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+80107e07:	83 c4 10             	add    $0x10,%esp
+80107e0a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107e0d:	74 0d                	je     80107e1c <allocuvm+0xac>
+80107e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107e12:	8b 45 08             	mov    0x8(%ebp),%eax
+80107e15:	89 f2                	mov    %esi,%edx
+80107e17:	e8 a4 fa ff ff       	call   801078c0 <deallocuvm.part.0>
+    return 0;
+80107e1c:	31 d2                	xor    %edx,%edx
+}
+80107e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e21:	89 d0                	mov    %edx,%eax
+80107e23:	5b                   	pop    %ebx
+80107e24:	5e                   	pop    %esi
+80107e25:	5f                   	pop    %edi
+80107e26:	5d                   	pop    %ebp
+80107e27:	c3                   	ret
+80107e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107e2f:	90                   	nop
+    return oldsz;
+80107e30:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80107e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e36:	89 d0                	mov    %edx,%eax
+80107e38:	5b                   	pop    %ebx
+80107e39:	5e                   	pop    %esi
+80107e3a:	5f                   	pop    %edi
+80107e3b:	5d                   	pop    %ebp
+80107e3c:	c3                   	ret
+80107e3d:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+80107e40:	83 ec 0c             	sub    $0xc,%esp
+80107e43:	68 b5 8c 10 80       	push   $0x80108cb5
+80107e48:	e8 63 88 ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+80107e4d:	83 c4 10             	add    $0x10,%esp
+80107e50:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107e53:	74 0d                	je     80107e62 <allocuvm+0xf2>
+80107e55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107e58:	8b 45 08             	mov    0x8(%ebp),%eax
+80107e5b:	89 f2                	mov    %esi,%edx
+80107e5d:	e8 5e fa ff ff       	call   801078c0 <deallocuvm.part.0>
+      kfree(mem);
+80107e62:	83 ec 0c             	sub    $0xc,%esp
+80107e65:	53                   	push   %ebx
+80107e66:	e8 b5 a6 ff ff       	call   80102520 <kfree>
+      return 0;
+80107e6b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80107e6e:	31 d2                	xor    %edx,%edx
+80107e70:	eb ac                	jmp    80107e1e <allocuvm+0xae>
+80107e72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107e78:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+80107e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e7e:	5b                   	pop    %ebx
+80107e7f:	5e                   	pop    %esi
+80107e80:	89 d0                	mov    %edx,%eax
+80107e82:	5f                   	pop    %edi
+80107e83:	5d                   	pop    %ebp
+80107e84:	c3                   	ret
+80107e85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107e90 <deallocuvm>:
+{
+80107e90:	55                   	push   %ebp
+80107e91:	89 e5                	mov    %esp,%ebp
+80107e93:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107e96:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+80107e9c:	39 d1                	cmp    %edx,%ecx
+80107e9e:	73 10                	jae    80107eb0 <deallocuvm+0x20>
+}
+80107ea0:	5d                   	pop    %ebp
+80107ea1:	e9 1a fa ff ff       	jmp    801078c0 <deallocuvm.part.0>
+80107ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ead:	8d 76 00             	lea    0x0(%esi),%esi
+80107eb0:	89 d0                	mov    %edx,%eax
+80107eb2:	5d                   	pop    %ebp
+80107eb3:	c3                   	ret
+80107eb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ebf:	90                   	nop
+
+80107ec0 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+80107ec0:	55                   	push   %ebp
+80107ec1:	89 e5                	mov    %esp,%ebp
+80107ec3:	57                   	push   %edi
+80107ec4:	56                   	push   %esi
+80107ec5:	53                   	push   %ebx
+80107ec6:	83 ec 0c             	sub    $0xc,%esp
+80107ec9:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+80107ecc:	85 f6                	test   %esi,%esi
+80107ece:	74 59                	je     80107f29 <freevm+0x69>
+  if(newsz >= oldsz)
+80107ed0:	31 c9                	xor    %ecx,%ecx
+80107ed2:	ba 00 00 00 80       	mov    $0x80000000,%edx
+80107ed7:	89 f0                	mov    %esi,%eax
+80107ed9:	89 f3                	mov    %esi,%ebx
+80107edb:	e8 e0 f9 ff ff       	call   801078c0 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+80107ee0:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+80107ee6:	eb 0f                	jmp    80107ef7 <freevm+0x37>
+80107ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eef:	90                   	nop
+80107ef0:	83 c3 04             	add    $0x4,%ebx
+80107ef3:	39 fb                	cmp    %edi,%ebx
+80107ef5:	74 23                	je     80107f1a <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+80107ef7:	8b 03                	mov    (%ebx),%eax
+80107ef9:	a8 01                	test   $0x1,%al
+80107efb:	74 f3                	je     80107ef0 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+80107efd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+80107f02:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+80107f05:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+80107f08:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+80107f0d:	50                   	push   %eax
+80107f0e:	e8 0d a6 ff ff       	call   80102520 <kfree>
+80107f13:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+80107f16:	39 fb                	cmp    %edi,%ebx
+80107f18:	75 dd                	jne    80107ef7 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+80107f1a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107f20:	5b                   	pop    %ebx
+80107f21:	5e                   	pop    %esi
+80107f22:	5f                   	pop    %edi
+80107f23:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+80107f24:	e9 f7 a5 ff ff       	jmp    80102520 <kfree>
+    panic("freevm: no pgdir");
+80107f29:	83 ec 0c             	sub    $0xc,%esp
+80107f2c:	68 d1 8c 10 80       	push   $0x80108cd1
+80107f31:	e8 4a 84 ff ff       	call   80100380 <panic>
+80107f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107f40 <setupkvm>:
+{
+80107f40:	55                   	push   %ebp
+80107f41:	89 e5                	mov    %esp,%ebp
+80107f43:	56                   	push   %esi
+80107f44:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+80107f45:	e8 96 a7 ff ff       	call   801026e0 <kalloc>
+80107f4a:	85 c0                	test   %eax,%eax
+80107f4c:	74 5e                	je     80107fac <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+80107f4e:	83 ec 04             	sub    $0x4,%esp
+80107f51:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80107f53:	bb 20 b4 10 80       	mov    $0x8010b420,%ebx
+  memset(pgdir, 0, PGSIZE);
+80107f58:	68 00 10 00 00       	push   $0x1000
+80107f5d:	6a 00                	push   $0x0
+80107f5f:	50                   	push   %eax
+80107f60:	e8 4b d6 ff ff       	call   801055b0 <memset>
+80107f65:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+80107f68:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+80107f6b:	83 ec 08             	sub    $0x8,%esp
+80107f6e:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80107f71:	8b 13                	mov    (%ebx),%edx
+80107f73:	ff 73 0c             	push   0xc(%ebx)
+80107f76:	50                   	push   %eax
+80107f77:	29 c1                	sub    %eax,%ecx
+80107f79:	89 f0                	mov    %esi,%eax
+80107f7b:	e8 00 fa ff ff       	call   80107980 <mappages>
+80107f80:	83 c4 10             	add    $0x10,%esp
+80107f83:	85 c0                	test   %eax,%eax
+80107f85:	78 19                	js     80107fa0 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80107f87:	83 c3 10             	add    $0x10,%ebx
+80107f8a:	81 fb 60 b4 10 80    	cmp    $0x8010b460,%ebx
+80107f90:	75 d6                	jne    80107f68 <setupkvm+0x28>
+}
+80107f92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107f95:	89 f0                	mov    %esi,%eax
+80107f97:	5b                   	pop    %ebx
+80107f98:	5e                   	pop    %esi
+80107f99:	5d                   	pop    %ebp
+80107f9a:	c3                   	ret
+80107f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107f9f:	90                   	nop
+      freevm(pgdir);
+80107fa0:	83 ec 0c             	sub    $0xc,%esp
+80107fa3:	56                   	push   %esi
+80107fa4:	e8 17 ff ff ff       	call   80107ec0 <freevm>
+      return 0;
+80107fa9:	83 c4 10             	add    $0x10,%esp
+}
+80107fac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+80107faf:	31 f6                	xor    %esi,%esi
+}
+80107fb1:	89 f0                	mov    %esi,%eax
+80107fb3:	5b                   	pop    %ebx
+80107fb4:	5e                   	pop    %esi
+80107fb5:	5d                   	pop    %ebp
+80107fb6:	c3                   	ret
+80107fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107fbe:	66 90                	xchg   %ax,%ax
+
+80107fc0 <kvmalloc>:
+{
+80107fc0:	55                   	push   %ebp
+80107fc1:	89 e5                	mov    %esp,%ebp
+80107fc3:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+80107fc6:	e8 75 ff ff ff       	call   80107f40 <setupkvm>
+80107fcb:	a3 e4 5d 11 80       	mov    %eax,0x80115de4
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80107fd0:	05 00 00 00 80       	add    $0x80000000,%eax
+80107fd5:	0f 22 d8             	mov    %eax,%cr3
+}
+80107fd8:	c9                   	leave
+80107fd9:	c3                   	ret
+80107fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107fe0 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+80107fe0:	55                   	push   %ebp
+80107fe1:	89 e5                	mov    %esp,%ebp
+80107fe3:	83 ec 08             	sub    $0x8,%esp
+80107fe6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80107fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+80107fec:	89 c1                	mov    %eax,%ecx
+80107fee:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+80107ff1:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+80107ff4:	f6 c2 01             	test   $0x1,%dl
+80107ff7:	75 17                	jne    80108010 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+80107ff9:	83 ec 0c             	sub    $0xc,%esp
+80107ffc:	68 e2 8c 10 80       	push   $0x80108ce2
+80108001:	e8 7a 83 ff ff       	call   80100380 <panic>
+80108006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010800d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+80108010:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108013:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+80108019:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010801e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+80108025:	85 c0                	test   %eax,%eax
+80108027:	74 d0                	je     80107ff9 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+80108029:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010802c:	c9                   	leave
+8010802d:	c3                   	ret
+8010802e:	66 90                	xchg   %ax,%ax
+
+80108030 <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+80108030:	55                   	push   %ebp
+80108031:	89 e5                	mov    %esp,%ebp
+80108033:	57                   	push   %edi
+80108034:	56                   	push   %esi
+80108035:	53                   	push   %ebx
+80108036:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+80108039:	e8 02 ff ff ff       	call   80107f40 <setupkvm>
+8010803e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80108041:	85 c0                	test   %eax,%eax
+80108043:	0f 84 e9 00 00 00    	je     80108132 <copyuvm+0x102>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+80108049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010804c:	85 c9                	test   %ecx,%ecx
+8010804e:	0f 84 b2 00 00 00    	je     80108106 <copyuvm+0xd6>
+80108054:	31 f6                	xor    %esi,%esi
+80108056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010805d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*pde & PTE_P){
+80108060:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+80108063:	89 f0                	mov    %esi,%eax
+80108065:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+80108068:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010806b:	a8 01                	test   $0x1,%al
+8010806d:	75 11                	jne    80108080 <copyuvm+0x50>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+8010806f:	83 ec 0c             	sub    $0xc,%esp
+80108072:	68 ec 8c 10 80       	push   $0x80108cec
+80108077:	e8 04 83 ff ff       	call   80100380 <panic>
+8010807c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+80108080:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108082:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80108087:	c1 ea 0a             	shr    $0xa,%edx
+8010808a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+80108090:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+80108097:	85 c0                	test   %eax,%eax
+80108099:	74 d4                	je     8010806f <copyuvm+0x3f>
+    if(!(*pte & PTE_P))
+8010809b:	8b 00                	mov    (%eax),%eax
+8010809d:	a8 01                	test   $0x1,%al
+8010809f:	0f 84 9f 00 00 00    	je     80108144 <copyuvm+0x114>
+      panic("copyuvm: page not present");
+    pa = PTE_ADDR(*pte);
+801080a5:	89 c7                	mov    %eax,%edi
+    flags = PTE_FLAGS(*pte);
+801080a7:	25 ff 0f 00 00       	and    $0xfff,%eax
+801080ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pa = PTE_ADDR(*pte);
+801080af:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+    if((mem = kalloc()) == 0)
+801080b5:	e8 26 a6 ff ff       	call   801026e0 <kalloc>
+801080ba:	89 c3                	mov    %eax,%ebx
+801080bc:	85 c0                	test   %eax,%eax
+801080be:	74 64                	je     80108124 <copyuvm+0xf4>
+      goto bad;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+801080c0:	83 ec 04             	sub    $0x4,%esp
+801080c3:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+801080c9:	68 00 10 00 00       	push   $0x1000
+801080ce:	57                   	push   %edi
+801080cf:	50                   	push   %eax
+801080d0:	e8 6b d5 ff ff       	call   80105640 <memmove>
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+801080d5:	58                   	pop    %eax
+801080d6:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801080dc:	5a                   	pop    %edx
+801080dd:	ff 75 e4             	push   -0x1c(%ebp)
+801080e0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801080e5:	89 f2                	mov    %esi,%edx
+801080e7:	50                   	push   %eax
+801080e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801080eb:	e8 90 f8 ff ff       	call   80107980 <mappages>
+801080f0:	83 c4 10             	add    $0x10,%esp
+801080f3:	85 c0                	test   %eax,%eax
+801080f5:	78 21                	js     80108118 <copyuvm+0xe8>
+  for(i = 0; i < sz; i += PGSIZE){
+801080f7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+801080fd:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80108100:	0f 82 5a ff ff ff    	jb     80108060 <copyuvm+0x30>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+80108106:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010810c:	5b                   	pop    %ebx
+8010810d:	5e                   	pop    %esi
+8010810e:	5f                   	pop    %edi
+8010810f:	5d                   	pop    %ebp
+80108110:	c3                   	ret
+80108111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      kfree(mem);
+80108118:	83 ec 0c             	sub    $0xc,%esp
+8010811b:	53                   	push   %ebx
+8010811c:	e8 ff a3 ff ff       	call   80102520 <kfree>
+      goto bad;
+80108121:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+80108124:	83 ec 0c             	sub    $0xc,%esp
+80108127:	ff 75 e0             	push   -0x20(%ebp)
+8010812a:	e8 91 fd ff ff       	call   80107ec0 <freevm>
+  return 0;
+8010812f:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80108132:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+80108139:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010813c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010813f:	5b                   	pop    %ebx
+80108140:	5e                   	pop    %esi
+80108141:	5f                   	pop    %edi
+80108142:	5d                   	pop    %ebp
+80108143:	c3                   	ret
+      panic("copyuvm: page not present");
+80108144:	83 ec 0c             	sub    $0xc,%esp
+80108147:	68 06 8d 10 80       	push   $0x80108d06
+8010814c:	e8 2f 82 ff ff       	call   80100380 <panic>
+80108151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010815f:	90                   	nop
+
+80108160 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+80108160:	55                   	push   %ebp
+80108161:	89 e5                	mov    %esp,%ebp
+80108163:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80108166:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+80108169:	89 c1                	mov    %eax,%ecx
+8010816b:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010816e:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+80108171:	f6 c2 01             	test   $0x1,%dl
+80108174:	0f 84 00 01 00 00    	je     8010827a <uva2ka.cold>
+  return &pgtab[PTX(va)];
+8010817a:	c1 e8 0c             	shr    $0xc,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010817d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if((*pte & PTE_P) == 0)
+    return 0;
+  if((*pte & PTE_U) == 0)
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+80108183:	5d                   	pop    %ebp
+  return &pgtab[PTX(va)];
+80108184:	25 ff 03 00 00       	and    $0x3ff,%eax
+  if((*pte & PTE_P) == 0)
+80108189:	8b 84 82 00 00 00 80 	mov    -0x80000000(%edx,%eax,4),%eax
+  if((*pte & PTE_U) == 0)
+80108190:	89 c2                	mov    %eax,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+80108192:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+80108197:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010819a:	05 00 00 00 80       	add    $0x80000000,%eax
+8010819f:	83 fa 05             	cmp    $0x5,%edx
+801081a2:	ba 00 00 00 00       	mov    $0x0,%edx
+801081a7:	0f 45 c2             	cmovne %edx,%eax
+}
+801081aa:	c3                   	ret
+801081ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801081af:	90                   	nop
+
+801081b0 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+801081b0:	55                   	push   %ebp
+801081b1:	89 e5                	mov    %esp,%ebp
+801081b3:	57                   	push   %edi
+801081b4:	56                   	push   %esi
+801081b5:	53                   	push   %ebx
+801081b6:	83 ec 0c             	sub    $0xc,%esp
+801081b9:	8b 75 14             	mov    0x14(%ebp),%esi
+801081bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801081bf:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+801081c2:	85 f6                	test   %esi,%esi
+801081c4:	75 51                	jne    80108217 <copyout+0x67>
+801081c6:	e9 a5 00 00 00       	jmp    80108270 <copyout+0xc0>
+801081cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801081cf:	90                   	nop
+  return (char*)P2V(PTE_ADDR(*pte));
+801081d0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+801081d6:	8d 8b 00 00 00 80    	lea    -0x80000000(%ebx),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+801081dc:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+801081e2:	74 75                	je     80108259 <copyout+0xa9>
+      return -1;
+    n = PGSIZE - (va - va0);
+801081e4:	89 fb                	mov    %edi,%ebx
+801081e6:	29 c3                	sub    %eax,%ebx
+801081e8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801081ee:	39 f3                	cmp    %esi,%ebx
+801081f0:	0f 47 de             	cmova  %esi,%ebx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+801081f3:	29 f8                	sub    %edi,%eax
+801081f5:	83 ec 04             	sub    $0x4,%esp
+801081f8:	01 c1                	add    %eax,%ecx
+801081fa:	53                   	push   %ebx
+801081fb:	52                   	push   %edx
+801081fc:	89 55 10             	mov    %edx,0x10(%ebp)
+801081ff:	51                   	push   %ecx
+80108200:	e8 3b d4 ff ff       	call   80105640 <memmove>
+    len -= n;
+    buf += n;
+80108205:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+80108208:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+8010820e:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+80108211:	01 da                	add    %ebx,%edx
+  while(len > 0){
+80108213:	29 de                	sub    %ebx,%esi
+80108215:	74 59                	je     80108270 <copyout+0xc0>
+  if(*pde & PTE_P){
+80108217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+8010821a:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010821c:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+8010821e:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+80108221:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+80108227:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010822a:	f6 c1 01             	test   $0x1,%cl
+8010822d:	0f 84 4e 00 00 00    	je     80108281 <copyout.cold>
+  return &pgtab[PTX(va)];
+80108233:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108235:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010823b:	c1 eb 0c             	shr    $0xc,%ebx
+8010823e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  if((*pte & PTE_P) == 0)
+80108244:	8b 9c 99 00 00 00 80 	mov    -0x80000000(%ecx,%ebx,4),%ebx
+  if((*pte & PTE_U) == 0)
+8010824b:	89 d9                	mov    %ebx,%ecx
+8010824d:	83 e1 05             	and    $0x5,%ecx
+80108250:	83 f9 05             	cmp    $0x5,%ecx
+80108253:	0f 84 77 ff ff ff    	je     801081d0 <copyout+0x20>
+  }
+  return 0;
+}
+80108259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010825c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108261:	5b                   	pop    %ebx
+80108262:	5e                   	pop    %esi
+80108263:	5f                   	pop    %edi
+80108264:	5d                   	pop    %ebp
+80108265:	c3                   	ret
+80108266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010826d:	8d 76 00             	lea    0x0(%esi),%esi
+80108270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80108273:	31 c0                	xor    %eax,%eax
+}
+80108275:	5b                   	pop    %ebx
+80108276:	5e                   	pop    %esi
+80108277:	5f                   	pop    %edi
+80108278:	5d                   	pop    %ebp
+80108279:	c3                   	ret
+
+8010827a <uva2ka.cold>:
+  if((*pte & PTE_P) == 0)
+8010827a:	a1 00 00 00 00       	mov    0x0,%eax
+8010827f:	0f 0b                	ud2
+
+80108281 <copyout.cold>:
+80108281:	a1 00 00 00 00       	mov    0x0,%eax
+80108286:	0f 0b                	ud2
+80108288:	66 90                	xchg   %ax,%ax
+8010828a:	66 90                	xchg   %ax,%ax
+8010828c:	66 90                	xchg   %ax,%ax
+8010828e:	66 90                	xchg   %ax,%ax
+
+80108290 <myfunction>:
+#include "types.h"
+#include "defs.h"
+
+int myfunction(char* str) {
+80108290:	55                   	push   %ebp
+80108291:	89 e5                	mov    %esp,%ebp
+80108293:	83 ec 10             	sub    $0x10,%esp
+  cprintf("%s\n", str);
+80108296:	ff 75 08             	push   0x8(%ebp)
+80108299:	68 43 8d 10 80       	push   $0x80108d43
+8010829e:	e8 0d 84 ff ff       	call   801006b0 <cprintf>
+  return 0xABCDABCD;
+}
+801082a3:	b8 cd ab cd ab       	mov    $0xabcdabcd,%eax
+801082a8:	c9                   	leave
+801082a9:	c3                   	ret
+801082aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801082b0 <sys_myfunction>:
+
+int sys_myfunction(void) {
+801082b0:	55                   	push   %ebp
+801082b1:	89 e5                	mov    %esp,%ebp
+801082b3:	83 ec 20             	sub    $0x20,%esp
+  char* str;
+
+  if (argstr(0, &str) < 0) return -1;
+801082b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801082b9:	50                   	push   %eax
+801082ba:	6a 00                	push   $0x0
+801082bc:	e8 5f d6 ff ff       	call   80105920 <argstr>
+801082c1:	83 c4 10             	add    $0x10,%esp
+801082c4:	89 c2                	mov    %eax,%edx
+801082c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801082cb:	85 d2                	test   %edx,%edx
+801082cd:	78 18                	js     801082e7 <sys_myfunction+0x37>
+  cprintf("%s\n", str);
+801082cf:	83 ec 08             	sub    $0x8,%esp
+801082d2:	ff 75 f4             	push   -0xc(%ebp)
+801082d5:	68 43 8d 10 80       	push   $0x80108d43
+801082da:	e8 d1 83 ff ff       	call   801006b0 <cprintf>
+  return myfunction(str);
+801082df:	83 c4 10             	add    $0x10,%esp
+801082e2:	b8 cd ab cd ab       	mov    $0xabcdabcd,%eax
+801082e7:	c9                   	leave
+801082e8:	c3                   	ret
+801082e9:	66 90                	xchg   %ax,%ax
+801082eb:	66 90                	xchg   %ax,%ax
+801082ed:	66 90                	xchg   %ax,%ax
+801082ef:	90                   	nop
+
+801082f0 <mycall>:
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+
+void mycall(void) {
+801082f0:	55                   	push   %ebp
+801082f1:	89 e5                	mov    %esp,%ebp
+801082f3:	83 ec 14             	sub    $0x14,%esp
+  cprintf("user interrupt 128 called!\n");
+801082f6:	68 47 8d 10 80       	push   $0x80108d47
+801082fb:	e8 b0 83 ff ff       	call   801006b0 <cprintf>
+80108300:	83 c4 10             	add    $0x10,%esp
+80108303:	c9                   	leave
+80108304:	c3                   	ret
@@ -0,0 +1,1518 @@
+
+_mlfq_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    exit();
+  while (wait() != -1);
+}
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 2c             	sub    $0x2c,%esp
+  int i, pid;
+  int count[MAX_LEVEL] = {0};
+  13:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  1a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  21:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  28:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  2f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+//  int child;
+
+  parent = getpid();
+  36:	e8 d8 05 00 00       	call   613 <getpid>
+
+  printf(1, "MLFQ test start\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 38 0a 00 00       	push   $0xa38
+  43:	6a 01                	push   $0x1
+  parent = getpid();
+  45:	a3 a8 0e 00 00       	mov    %eax,0xea8
+  printf(1, "MLFQ test start\n");
+  4a:	e8 c1 06 00 00       	call   710 <printf>
+
+  printf(1, "[Test 1] default\n");
+  4f:	58                   	pop    %eax
+  50:	5a                   	pop    %edx
+  51:	68 49 0a 00 00       	push   $0xa49
+  56:	6a 01                	push   $0x1
+  58:	e8 b3 06 00 00       	call   710 <printf>
+  pid = fork_children();
+  5d:	e8 ce 01 00 00       	call   230 <fork_children>
+
+  if (pid != parent)
+  62:	83 c4 10             	add    $0x10,%esp
+  65:	39 05 a8 0e 00 00    	cmp    %eax,0xea8
+  6b:	74 6d                	je     da <main+0xda>
+  6d:	89 c6                	mov    %eax,%esi
+  6f:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+  74:	eb 14                	jmp    8a <main+0x8a>
+  76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+      if (x < 0 || x > 4)
+      {
+        printf(1, "Wrong level: %d\n", x);
+        exit();
+      }
+      count[x]++;
+  80:	83 44 85 d4 01       	addl   $0x1,-0x2c(%ebp,%eax,4)
+    for (i = 0; i < NUM_LOOP; i++)
+  85:	83 eb 01             	sub    $0x1,%ebx
+  88:	74 1f                	je     a9 <main+0xa9>
+      int x = getLevel();
+  8a:	e8 bc 05 00 00       	call   64b <getLevel>
+      if (x < 0 || x > 4)
+  8f:	83 f8 04             	cmp    $0x4,%eax
+  92:	76 ec                	jbe    80 <main+0x80>
+    {
+      // int x = 1;
+      int x = getLevel();
+      if (x < 0 || x > 4)
+      {
+        printf(1, "Wrong level: %d\n", x);
+  94:	83 ec 04             	sub    $0x4,%esp
+  97:	50                   	push   %eax
+  98:	68 5b 0a 00 00       	push   $0xa5b
+  9d:	6a 01                	push   $0x1
+  9f:	e8 6c 06 00 00       	call   710 <printf>
+        exit();
+  a4:	e8 ea 04 00 00       	call   593 <exit>
+    printf(1, "Process %d\n", pid);
+  a9:	50                   	push   %eax
+    for (i = 0; i < MAX_LEVEL; i++) 
+  aa:	31 db                	xor    %ebx,%ebx
+    printf(1, "Process %d\n", pid);
+  ac:	56                   	push   %esi
+  ad:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+  b0:	68 6c 0a 00 00       	push   $0xa6c
+  b5:	6a 01                	push   $0x1
+  b7:	e8 54 06 00 00       	call   710 <printf>
+  bc:	83 c4 10             	add    $0x10,%esp
+      printf(1, "L%d: %d\n", i, count[i]);
+  bf:	ff 34 9e             	push   (%esi,%ebx,4)
+  c2:	53                   	push   %ebx
+    for (i = 0; i < MAX_LEVEL; i++) 
+  c3:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "L%d: %d\n", i, count[i]);
+  c6:	68 78 0a 00 00       	push   $0xa78
+  cb:	6a 01                	push   $0x1
+  cd:	e8 3e 06 00 00       	call   710 <printf>
+    for (i = 0; i < MAX_LEVEL; i++) 
+  d2:	83 c4 10             	add    $0x10,%esp
+  d5:	83 fb 05             	cmp    $0x5,%ebx
+  d8:	75 e5                	jne    bf <main+0xbf>
+  exit_children();
+  da:	e8 41 02 00 00       	call   320 <exit_children>
+  printf(1, "[Test 1] finished\n");
+  df:	53                   	push   %ebx
+  e0:	53                   	push   %ebx
+  e1:	68 81 0a 00 00       	push   $0xa81
+  e6:	6a 01                	push   $0x1
+  e8:	e8 23 06 00 00       	call   710 <printf>
+  printf(1, "[Test 2] setPriority\n");
+  ed:	5e                   	pop    %esi
+  ee:	58                   	pop    %eax
+  ef:	68 94 0a 00 00       	push   $0xa94
+  f4:	6a 01                	push   $0x1
+  f6:	e8 15 06 00 00       	call   710 <printf>
+  pid = fork_children2();
+  fb:	e8 70 01 00 00       	call   270 <fork_children2>
+  if (pid != parent)
+ 100:	83 c4 10             	add    $0x10,%esp
+  pid = fork_children2();
+ 103:	89 c6                	mov    %eax,%esi
+  if (pid != parent)
+ 105:	39 05 a8 0e 00 00    	cmp    %eax,0xea8
+ 10b:	74 55                	je     162 <main+0x162>
+ 10d:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+ 112:	eb 0e                	jmp    122 <main+0x122>
+ 114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      count[x]++;
+ 118:	83 44 85 d4 01       	addl   $0x1,-0x2c(%ebp,%eax,4)
+    for (i = 0; i < NUM_LOOP; i++)
+ 11d:	83 eb 01             	sub    $0x1,%ebx
+ 120:	74 0f                	je     131 <main+0x131>
+      int x = getLevel();
+ 122:	e8 24 05 00 00       	call   64b <getLevel>
+      if (x < 0 || x > 4)
+ 127:	83 f8 04             	cmp    $0x4,%eax
+ 12a:	76 ec                	jbe    118 <main+0x118>
+ 12c:	e9 63 ff ff ff       	jmp    94 <main+0x94>
+    printf(1, "Process %d\n", pid);
+ 131:	51                   	push   %ecx
+    for (i = 0; i < MAX_LEVEL; i++)
+ 132:	31 db                	xor    %ebx,%ebx
+    printf(1, "Process %d\n", pid);
+ 134:	56                   	push   %esi
+ 135:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+ 138:	68 6c 0a 00 00       	push   $0xa6c
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 cc 05 00 00       	call   710 <printf>
+ 144:	83 c4 10             	add    $0x10,%esp
+      printf(1, "L%d: %d\n", i, count[i]);
+ 147:	ff 34 9e             	push   (%esi,%ebx,4)
+ 14a:	53                   	push   %ebx
+    for (i = 0; i < MAX_LEVEL; i++)
+ 14b:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "L%d: %d\n", i, count[i]);
+ 14e:	68 78 0a 00 00       	push   $0xa78
+ 153:	6a 01                	push   $0x1
+ 155:	e8 b6 05 00 00       	call   710 <printf>
+    for (i = 0; i < MAX_LEVEL; i++)
+ 15a:	83 c4 10             	add    $0x10,%esp
+ 15d:	83 fb 05             	cmp    $0x5,%ebx
+ 160:	75 e5                	jne    147 <main+0x147>
+  exit_children();
+ 162:	e8 b9 01 00 00       	call   320 <exit_children>
+  printf(1, "[Test 2] finished\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 aa 0a 00 00       	push   $0xaaa
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 9b 05 00 00       	call   710 <printf>
+    printf(1, "[Test 3] maxlevel\n");
+ 175:	58                   	pop    %eax
+ 176:	5a                   	pop    %edx
+ 177:	68 bd 0a 00 00       	push   $0xabd
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 8d 05 00 00       	call   710 <printf>
+  pid = fork_children3();
+ 183:	e8 48 01 00 00       	call   2d0 <fork_children3>
+  if (pid != parent)
+ 188:	83 c4 10             	add    $0x10,%esp
+  pid = fork_children3();
+ 18b:	89 c6                	mov    %eax,%esi
+  if (pid != parent)
+ 18d:	39 05 a8 0e 00 00    	cmp    %eax,0xea8
+ 193:	74 6b                	je     200 <main+0x200>
+ 195:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+ 19a:	eb 0e                	jmp    1aa <main+0x1aa>
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      }
+      count[x]++;
+ 1a0:	83 44 85 d4 01       	addl   $0x1,-0x2c(%ebp,%eax,4)
+    for (i = 0; i < NUM_LOOP; i++)
+ 1a5:	83 eb 01             	sub    $0x1,%ebx
+ 1a8:	74 0f                	je     1b9 <main+0x1b9>
+      int x = getLevel();
+ 1aa:	e8 9c 04 00 00       	call   64b <getLevel>
+      if (x < 0 || x > 4)
+ 1af:	83 f8 04             	cmp    $0x4,%eax
+ 1b2:	76 ec                	jbe    1a0 <main+0x1a0>
+ 1b4:	e9 db fe ff ff       	jmp    94 <main+0x94>
+    }
+    printf(1, "Process %d\n", pid);
+ 1b9:	50                   	push   %eax
+    for (i = 0; i < MAX_LEVEL; i++)
+ 1ba:	31 db                	xor    %ebx,%ebx
+    printf(1, "Process %d\n", pid);
+ 1bc:	56                   	push   %esi
+ 1bd:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+ 1c0:	68 6c 0a 00 00       	push   $0xa6c
+ 1c5:	6a 01                	push   $0x1
+ 1c7:	e8 44 05 00 00       	call   710 <printf>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+      printf(1, "L%d: %d\n", i, count[i]);
+ 1cf:	ff 34 9e             	push   (%esi,%ebx,4)
+ 1d2:	53                   	push   %ebx
+    for (i = 0; i < MAX_LEVEL; i++)
+ 1d3:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "L%d: %d\n", i, count[i]);
+ 1d6:	68 78 0a 00 00       	push   $0xa78
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 2e 05 00 00       	call   710 <printf>
+    for (i = 0; i < MAX_LEVEL; i++)
+ 1e2:	83 c4 10             	add    $0x10,%esp
+ 1e5:	83 fb 05             	cmp    $0x5,%ebx
+ 1e8:	75 e5                	jne    1cf <main+0x1cf>
+
+    printf(1, "maxlevel: %d\n", max_level);
+ 1ea:	53                   	push   %ebx
+ 1eb:	ff 35 a4 0e 00 00    	push   0xea4
+ 1f1:	68 d0 0a 00 00       	push   $0xad0
+ 1f6:	6a 01                	push   $0x1
+ 1f8:	e8 13 05 00 00       	call   710 <printf>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+  }
+  exit_children();
+ 200:	e8 1b 01 00 00       	call   320 <exit_children>
+  printf(1, "[Test 3] finished\n");
+ 205:	50                   	push   %eax
+ 206:	50                   	push   %eax
+ 207:	68 de 0a 00 00       	push   $0xade
+ 20c:	6a 01                	push   $0x1
+ 20e:	e8 fd 04 00 00       	call   710 <printf>
+  printf(1, "done\n");
+ 213:	5a                   	pop    %edx
+ 214:	59                   	pop    %ecx
+ 215:	68 f1 0a 00 00       	push   $0xaf1
+ 21a:	6a 01                	push   $0x1
+ 21c:	e8 ef 04 00 00       	call   710 <printf>
+  exit();
+ 221:	e8 6d 03 00 00       	call   593 <exit>
+ 226:	66 90                	xchg   %ax,%ax
+ 228:	66 90                	xchg   %ax,%ax
+ 22a:	66 90                	xchg   %ax,%ax
+ 22c:	66 90                	xchg   %ax,%ax
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <fork_children>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	bb 04 00 00 00       	mov    $0x4,%ebx
+ 239:	83 ec 04             	sub    $0x4,%esp
+    if ((p = fork()) == 0)
+ 23c:	e8 4a 03 00 00       	call   58b <fork>
+ 241:	85 c0                	test   %eax,%eax
+ 243:	74 13                	je     258 <fork_children+0x28>
+  for (i = 0; i < NUM_THREAD; i++)
+ 245:	83 eb 01             	sub    $0x1,%ebx
+ 248:	75 f2                	jne    23c <fork_children+0xc>
+}
+ 24a:	a1 a8 0e 00 00       	mov    0xea8,%eax
+ 24f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 252:	c9                   	leave
+ 253:	c3                   	ret
+ 254:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(10);
+ 258:	83 ec 0c             	sub    $0xc,%esp
+ 25b:	6a 0a                	push   $0xa
+ 25d:	e8 c1 03 00 00       	call   623 <sleep>
+}
+ 262:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return getpid();
+ 265:	83 c4 10             	add    $0x10,%esp
+}
+ 268:	c9                   	leave
+      return getpid();
+ 269:	e9 a5 03 00 00       	jmp    613 <getpid>
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <fork_children2>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	53                   	push   %ebx
+  for (i = 0; i < NUM_THREAD; i++)
+ 274:	31 db                	xor    %ebx,%ebx
+{
+ 276:	83 ec 04             	sub    $0x4,%esp
+    if ((p = fork()) == 0)
+ 279:	e8 0d 03 00 00       	call   58b <fork>
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	74 26                	je     2a8 <fork_children2+0x38>
+      setPriority(p, i);
+ 282:	83 ec 08             	sub    $0x8,%esp
+ 285:	53                   	push   %ebx
+  for (i = 0; i < NUM_THREAD; i++)
+ 286:	83 c3 01             	add    $0x1,%ebx
+      setPriority(p, i);
+ 289:	50                   	push   %eax
+ 28a:	e8 c4 03 00 00       	call   653 <setPriority>
+  for (i = 0; i < NUM_THREAD; i++)
+ 28f:	83 c4 10             	add    $0x10,%esp
+ 292:	83 fb 04             	cmp    $0x4,%ebx
+ 295:	75 e2                	jne    279 <fork_children2+0x9>
+}
+ 297:	a1 a8 0e 00 00       	mov    0xea8,%eax
+ 29c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29f:	c9                   	leave
+ 2a0:	c3                   	ret
+ 2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      sleep(300);
+ 2a8:	83 ec 0c             	sub    $0xc,%esp
+ 2ab:	68 2c 01 00 00       	push   $0x12c
+ 2b0:	e8 6e 03 00 00       	call   623 <sleep>
+}
+ 2b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return getpid();
+ 2b8:	83 c4 10             	add    $0x10,%esp
+}
+ 2bb:	c9                   	leave
+      return getpid();
+ 2bc:	e9 52 03 00 00       	jmp    613 <getpid>
+ 2c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <fork_children3>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	53                   	push   %ebx
+  for (i = 0; i < NUM_THREAD; i++)
+ 2d4:	31 db                	xor    %ebx,%ebx
+{
+ 2d6:	83 ec 04             	sub    $0x4,%esp
+    if ((p = fork()) == 0)
+ 2d9:	e8 ad 02 00 00       	call   58b <fork>
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	74 16                	je     2f8 <fork_children3+0x28>
+  for (i = 0; i < NUM_THREAD; i++)
+ 2e2:	83 c3 01             	add    $0x1,%ebx
+ 2e5:	83 fb 04             	cmp    $0x4,%ebx
+ 2e8:	75 ef                	jne    2d9 <fork_children3+0x9>
+}
+ 2ea:	a1 a8 0e 00 00       	mov    0xea8,%eax
+ 2ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f2:	c9                   	leave
+ 2f3:	c3                   	ret
+ 2f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(10);
+ 2f8:	83 ec 0c             	sub    $0xc,%esp
+ 2fb:	6a 0a                	push   $0xa
+ 2fd:	e8 21 03 00 00       	call   623 <sleep>
+      max_level = i;
+ 302:	89 1d a4 0e 00 00    	mov    %ebx,0xea4
+      return getpid();
+ 308:	83 c4 10             	add    $0x10,%esp
+}
+ 30b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30e:	c9                   	leave
+      return getpid();
+ 30f:	e9 ff 02 00 00       	jmp    613 <getpid>
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <exit_children>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 08             	sub    $0x8,%esp
+  if (getpid() != parent)
+ 326:	e8 e8 02 00 00       	call   613 <getpid>
+ 32b:	3b 05 a8 0e 00 00    	cmp    0xea8,%eax
+ 331:	75 11                	jne    344 <exit_children+0x24>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+  while (wait() != -1);
+ 338:	e8 5e 02 00 00       	call   59b <wait>
+ 33d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 340:	75 f6                	jne    338 <exit_children+0x18>
+}
+ 342:	c9                   	leave
+ 343:	c3                   	ret
+    exit();
+ 344:	e8 4a 02 00 00       	call   593 <exit>
+ 349:	66 90                	xchg   %ax,%ax
+ 34b:	66 90                	xchg   %ax,%ax
+ 34d:	66 90                	xchg   %ax,%ax
+ 34f:	90                   	nop
+
+00000350 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 350:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 351:	31 c0                	xor    %eax,%eax
+{
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	53                   	push   %ebx
+ 356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 360:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 364:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 367:	83 c0 01             	add    $0x1,%eax
+ 36a:	84 d2                	test   %dl,%dl
+ 36c:	75 f2                	jne    360 <strcpy+0x10>
+    ;
+  return os;
+}
+ 36e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 371:	89 c8                	mov    %ecx,%eax
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 38a:	0f b6 02             	movzbl (%edx),%eax
+ 38d:	84 c0                	test   %al,%al
+ 38f:	75 17                	jne    3a8 <strcmp+0x28>
+ 391:	eb 3a                	jmp    3cd <strcmp+0x4d>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 39c:	83 c2 01             	add    $0x1,%edx
+ 39f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3a2:	84 c0                	test   %al,%al
+ 3a4:	74 1a                	je     3c0 <strcmp+0x40>
+    p++, q++;
+ 3a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3ab:	38 c3                	cmp    %al,%bl
+ 3ad:	74 e9                	je     398 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3af:	29 d8                	sub    %ebx,%eax
+}
+ 3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3c4:	31 c0                	xor    %eax,%eax
+ 3c6:	29 d8                	sub    %ebx,%eax
+}
+ 3c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3d0:	31 c0                	xor    %eax,%eax
+ 3d2:	eb db                	jmp    3af <strcmp+0x2f>
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3e9:	74 15                	je     400 <strlen+0x20>
+ 3eb:	31 c0                	xor    %eax,%eax
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3f7:	89 c1                	mov    %eax,%ecx
+ 3f9:	75 f5                	jne    3f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3fb:	89 c8                	mov    %ecx,%eax
+ 3fd:	5d                   	pop    %ebp
+ 3fe:	c3                   	ret
+ 3ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 400:	31 c9                	xor    %ecx,%ecx
+}
+ 402:	5d                   	pop    %ebp
+ 403:	89 c8                	mov    %ecx,%eax
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 417:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41d:	89 d7                	mov    %edx,%edi
+ 41f:	fc                   	cld
+ 420:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 422:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 425:	89 d0                	mov    %edx,%eax
+ 427:	c9                   	leave
+ 428:	c3                   	ret
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 43a:	0f b6 10             	movzbl (%eax),%edx
+ 43d:	84 d2                	test   %dl,%dl
+ 43f:	75 12                	jne    453 <strchr+0x23>
+ 441:	eb 1d                	jmp    460 <strchr+0x30>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 44c:	83 c0 01             	add    $0x1,%eax
+ 44f:	84 d2                	test   %dl,%dl
+ 451:	74 0d                	je     460 <strchr+0x30>
+    if(*s == c)
+ 453:	38 d1                	cmp    %dl,%cl
+ 455:	75 f1                	jne    448 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 457:	5d                   	pop    %ebp
+ 458:	c3                   	ret
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 460:	31 c0                	xor    %eax,%eax
+}
+ 462:	5d                   	pop    %ebp
+ 463:	c3                   	ret
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 475:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 478:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 479:	31 db                	xor    %ebx,%ebx
+{
+ 47b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 47e:	eb 27                	jmp    4a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 01                	push   $0x1
+ 485:	56                   	push   %esi
+ 486:	6a 00                	push   $0x0
+ 488:	e8 1e 01 00 00       	call   5ab <read>
+    if(cc < 1)
+ 48d:	83 c4 10             	add    $0x10,%esp
+ 490:	85 c0                	test   %eax,%eax
+ 492:	7e 1d                	jle    4b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 494:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 49f:	3c 0a                	cmp    $0xa,%al
+ 4a1:	74 10                	je     4b3 <gets+0x43>
+ 4a3:	3c 0d                	cmp    $0xd,%al
+ 4a5:	74 0c                	je     4b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4a7:	89 df                	mov    %ebx,%edi
+ 4a9:	83 c3 01             	add    $0x1,%ebx
+ 4ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4af:	7c cf                	jl     480 <gets+0x10>
+ 4b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bd:	5b                   	pop    %ebx
+ 4be:	5e                   	pop    %esi
+ 4bf:	5f                   	pop    %edi
+ 4c0:	5d                   	pop    %ebp
+ 4c1:	c3                   	ret
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d5:	83 ec 08             	sub    $0x8,%esp
+ 4d8:	6a 00                	push   $0x0
+ 4da:	ff 75 08             	push   0x8(%ebp)
+ 4dd:	e8 f1 00 00 00       	call   5d3 <open>
+  if(fd < 0)
+ 4e2:	83 c4 10             	add    $0x10,%esp
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	78 27                	js     510 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	ff 75 0c             	push   0xc(%ebp)
+ 4ef:	89 c3                	mov    %eax,%ebx
+ 4f1:	50                   	push   %eax
+ 4f2:	e8 f4 00 00 00       	call   5eb <fstat>
+  close(fd);
+ 4f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4fc:	e8 ba 00 00 00       	call   5bb <close>
+  return r;
+ 501:	83 c4 10             	add    $0x10,%esp
+}
+ 504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 507:	89 f0                	mov    %esi,%eax
+ 509:	5b                   	pop    %ebx
+ 50a:	5e                   	pop    %esi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 515:	eb ed                	jmp    504 <stat+0x34>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 527:	0f be 02             	movsbl (%edx),%eax
+ 52a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 52d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 535:	77 1e                	ja     555 <atoi+0x35>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 540:	83 c2 01             	add    $0x1,%edx
+ 543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 54a:	0f be 02             	movsbl (%edx),%eax
+ 54d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 550:	80 fb 09             	cmp    $0x9,%bl
+ 553:	76 eb                	jbe    540 <atoi+0x20>
+  return n;
+}
+ 555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 558:	89 c8                	mov    %ecx,%eax
+ 55a:	c9                   	leave
+ 55b:	c3                   	ret
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	8b 45 10             	mov    0x10(%ebp),%eax
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 56e:	85 c0                	test   %eax,%eax
+ 570:	7e 13                	jle    585 <memmove+0x25>
+ 572:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 580:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 581:	39 f8                	cmp    %edi,%eax
+ 583:	75 fb                	jne    580 <memmove+0x20>
+  return vdst;
+}
+ 585:	5e                   	pop    %esi
+ 586:	89 d0                	mov    %edx,%eax
+ 588:	5f                   	pop    %edi
+ 589:	5d                   	pop    %ebp
+ 58a:	c3                   	ret
+
+0000058b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 58b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <exit>:
+SYSCALL(exit)
+ 593:	b8 02 00 00 00       	mov    $0x2,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <wait>:
+SYSCALL(wait)
+ 59b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <pipe>:
+SYSCALL(pipe)
+ 5a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <read>:
+SYSCALL(read)
+ 5ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <write>:
+SYSCALL(write)
+ 5b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <close>:
+SYSCALL(close)
+ 5bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <kill>:
+SYSCALL(kill)
+ 5c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <exec>:
+SYSCALL(exec)
+ 5cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <open>:
+SYSCALL(open)
+ 5d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mknod>:
+SYSCALL(mknod)
+ 5db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <unlink>:
+SYSCALL(unlink)
+ 5e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <fstat>:
+SYSCALL(fstat)
+ 5eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <link>:
+SYSCALL(link)
+ 5f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mkdir>:
+SYSCALL(mkdir)
+ 5fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <chdir>:
+SYSCALL(chdir)
+ 603:	b8 09 00 00 00       	mov    $0x9,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <dup>:
+SYSCALL(dup)
+ 60b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getpid>:
+SYSCALL(getpid)
+ 613:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <sbrk>:
+SYSCALL(sbrk)
+ 61b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <sleep>:
+SYSCALL(sleep)
+ 623:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <uptime>:
+SYSCALL(uptime)
+ 62b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <myfunction>:
+SYSCALL(myfunction)
+ 633:	b8 16 00 00 00       	mov    $0x16,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <schedulerLock>:
+SYSCALL(schedulerLock)
+ 63b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <schedulerUnlock>:
+SYSCALL(schedulerUnlock)
+ 643:	b8 18 00 00 00       	mov    $0x18,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <getLevel>:
+SYSCALL(getLevel)
+ 64b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <setPriority>:
+SYSCALL(setPriority)
+ 653:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <yield>:
+ 65b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+ 663:	66 90                	xchg   %ax,%ax
+ 665:	66 90                	xchg   %ax,%ax
+ 667:	66 90                	xchg   %ax,%ax
+ 669:	66 90                	xchg   %ax,%ax
+ 66b:	66 90                	xchg   %ax,%ax
+ 66d:	66 90                	xchg   %ax,%ax
+ 66f:	90                   	nop
+
+00000670 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 678:	89 d1                	mov    %edx,%ecx
+{
+ 67a:	83 ec 3c             	sub    $0x3c,%esp
+ 67d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 680:	85 d2                	test   %edx,%edx
+ 682:	0f 89 80 00 00 00    	jns    708 <printint+0x98>
+ 688:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 68c:	74 7a                	je     708 <printint+0x98>
+    x = -xx;
+ 68e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 690:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 695:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 698:	31 f6                	xor    %esi,%esi
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	31 d2                	xor    %edx,%edx
+ 6a4:	89 f7                	mov    %esi,%edi
+ 6a6:	f7 f3                	div    %ebx
+ 6a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6ab:	0f b6 92 58 0b 00 00 	movzbl 0xb58(%edx),%edx
+ 6b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6b6:	89 ca                	mov    %ecx,%edx
+ 6b8:	89 c1                	mov    %eax,%ecx
+ 6ba:	39 da                	cmp    %ebx,%edx
+ 6bc:	73 e2                	jae    6a0 <printint+0x30>
+  if(neg)
+ 6be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	74 07                	je     6cc <printint+0x5c>
+    buf[i++] = '-';
+ 6c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ca:	89 f7                	mov    %esi,%edi
+ 6cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6d2:	01 df                	add    %ebx,%edi
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6e4:	6a 01                	push   $0x1
+ 6e6:	50                   	push   %eax
+ 6e7:	56                   	push   %esi
+ 6e8:	e8 c6 fe ff ff       	call   5b3 <write>
+  while(--i >= 0)
+ 6ed:	89 f8                	mov    %edi,%eax
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	83 ef 01             	sub    $0x1,%edi
+ 6f5:	39 d8                	cmp    %ebx,%eax
+ 6f7:	75 df                	jne    6d8 <printint+0x68>
+}
+ 6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fc:	5b                   	pop    %ebx
+ 6fd:	5e                   	pop    %esi
+ 6fe:	5f                   	pop    %edi
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 708:	31 c0                	xor    %eax,%eax
+ 70a:	eb 89                	jmp    695 <printint+0x25>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 719:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 71c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 71f:	0f b6 1e             	movzbl (%esi),%ebx
+ 722:	83 c6 01             	add    $0x1,%esi
+ 725:	84 db                	test   %bl,%bl
+ 727:	74 67                	je     790 <printf+0x80>
+ 729:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 72c:	31 d2                	xor    %edx,%edx
+ 72e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 731:	eb 34                	jmp    767 <printf+0x57>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 740:	83 f8 25             	cmp    $0x25,%eax
+ 743:	74 18                	je     75d <printf+0x4d>
+  write(fd, &c, 1);
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 74b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74e:	6a 01                	push   $0x1
+ 750:	50                   	push   %eax
+ 751:	57                   	push   %edi
+ 752:	e8 5c fe ff ff       	call   5b3 <write>
+ 757:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 75a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 75d:	0f b6 1e             	movzbl (%esi),%ebx
+ 760:	83 c6 01             	add    $0x1,%esi
+ 763:	84 db                	test   %bl,%bl
+ 765:	74 29                	je     790 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 767:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 76a:	85 d2                	test   %edx,%edx
+ 76c:	74 ca                	je     738 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 76e:	83 fa 25             	cmp    $0x25,%edx
+ 771:	75 ea                	jne    75d <printf+0x4d>
+      if(c == 'd'){
+ 773:	83 f8 25             	cmp    $0x25,%eax
+ 776:	0f 84 24 01 00 00    	je     8a0 <printf+0x190>
+ 77c:	83 e8 63             	sub    $0x63,%eax
+ 77f:	83 f8 15             	cmp    $0x15,%eax
+ 782:	77 1c                	ja     7a0 <printf+0x90>
+ 784:	ff 24 85 00 0b 00 00 	jmp    *0xb00(,%eax,4)
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	52                   	push   %edx
+ 7ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7b0:	57                   	push   %edi
+ 7b1:	e8 fd fd ff ff       	call   5b3 <write>
+ 7b6:	83 c4 0c             	add    $0xc,%esp
+ 7b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7bc:	6a 01                	push   $0x1
+ 7be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7c1:	52                   	push   %edx
+ 7c2:	57                   	push   %edi
+ 7c3:	e8 eb fd ff ff       	call   5b3 <write>
+        putc(fd, c);
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cb:	31 d2                	xor    %edx,%edx
+ 7cd:	eb 8e                	jmp    75d <printf+0x4d>
+ 7cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 00                	push   $0x0
+ 7df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7e4:	e8 87 fe ff ff       	call   670 <printint>
+        ap++;
+ 7e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 67 ff ff ff       	jmp    75d <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 800:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 803:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 80b:	85 db                	test   %ebx,%ebx
+ 80d:	0f 84 9d 00 00 00    	je     8b0 <printf+0x1a0>
+        while(*s != 0){
+ 813:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 816:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 818:	84 c0                	test   %al,%al
+ 81a:	0f 84 3d ff ff ff    	je     75d <printf+0x4d>
+ 820:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 823:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 826:	89 de                	mov    %ebx,%esi
+ 828:	89 d3                	mov    %edx,%ebx
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 836:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	53                   	push   %ebx
+ 83c:	57                   	push   %edi
+ 83d:	e8 71 fd ff ff       	call   5b3 <write>
+        while(*s != 0){
+ 842:	0f b6 06             	movzbl (%esi),%eax
+ 845:	83 c4 10             	add    $0x10,%esp
+ 848:	84 c0                	test   %al,%al
+ 84a:	75 e4                	jne    830 <printf+0x120>
+      state = 0;
+ 84c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 07 ff ff ff       	jmp    75d <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 01                	push   $0x1
+ 86f:	e9 6b ff ff ff       	jmp    7df <printf+0xcf>
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 878:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 881:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 883:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 886:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	52                   	push   %edx
+ 88c:	57                   	push   %edi
+ 88d:	e8 21 fd ff ff       	call   5b3 <write>
+        ap++;
+ 892:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 895:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 898:	31 d2                	xor    %edx,%edx
+ 89a:	e9 be fe ff ff       	jmp    75d <printf+0x4d>
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	e9 11 ff ff ff       	jmp    7c1 <printf+0xb1>
+ 8b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8b5:	bb f7 0a 00 00       	mov    $0xaf7,%ebx
+ 8ba:	e9 61 ff ff ff       	jmp    820 <printf+0x110>
+ 8bf:	90                   	nop
+
+000008c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	a1 ac 0e 00 00       	mov    0xeac,%eax
+{
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	57                   	push   %edi
+ 8c9:	56                   	push   %esi
+ 8ca:	53                   	push   %ebx
+ 8cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8dc:	39 ca                	cmp    %ecx,%edx
+ 8de:	73 30                	jae    910 <free+0x50>
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 04                	jb     8e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e4:	39 c2                	cmp    %eax,%edx
+ 8e6:	72 f0                	jb     8d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ee:	39 f8                	cmp    %edi,%eax
+ 8f0:	74 2e                	je     920 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8fb:	39 f1                	cmp    %esi,%ecx
+ 8fd:	74 38                	je     937 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 901:	5b                   	pop    %ebx
+  freep = p;
+ 902:	89 15 ac 0e 00 00    	mov    %edx,0xeac
+}
+ 908:	5e                   	pop    %esi
+ 909:	5f                   	pop    %edi
+ 90a:	5d                   	pop    %ebp
+ 90b:	c3                   	ret
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 d0                	jb     8e4 <free+0x24>
+ 914:	eb c2                	jmp    8d8 <free+0x18>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 920:	03 70 04             	add    0x4(%eax),%esi
+ 923:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 926:	8b 02                	mov    (%edx),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 92d:	8b 42 04             	mov    0x4(%edx),%eax
+ 930:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 933:	39 f1                	cmp    %esi,%ecx
+ 935:	75 c8                	jne    8ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 937:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 93a:	89 15 ac 0e 00 00    	mov    %edx,0xeac
+    p->s.size += bp->s.size;
+ 940:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 943:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 946:	89 0a                	mov    %ecx,(%edx)
+}
+ 948:	5b                   	pop    %ebx
+ 949:	5e                   	pop    %esi
+ 94a:	5f                   	pop    %edi
+ 94b:	5d                   	pop    %ebp
+ 94c:	c3                   	ret
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 959:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 95c:	8b 15 ac 0e 00 00    	mov    0xeac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 962:	8d 78 07             	lea    0x7(%eax),%edi
+ 965:	c1 ef 03             	shr    $0x3,%edi
+ 968:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 96b:	85 d2                	test   %edx,%edx
+ 96d:	0f 84 8d 00 00 00    	je     a00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 973:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 975:	8b 48 04             	mov    0x4(%eax),%ecx
+ 978:	39 f9                	cmp    %edi,%ecx
+ 97a:	73 64                	jae    9e0 <malloc+0x90>
+  if(nu < 4096)
+ 97c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 981:	39 df                	cmp    %ebx,%edi
+ 983:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 986:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 98d:	eb 0a                	jmp    999 <malloc+0x49>
+ 98f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 992:	8b 48 04             	mov    0x4(%eax),%ecx
+ 995:	39 f9                	cmp    %edi,%ecx
+ 997:	73 47                	jae    9e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 999:	89 c2                	mov    %eax,%edx
+ 99b:	39 05 ac 0e 00 00    	cmp    %eax,0xeac
+ 9a1:	75 ed                	jne    990 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	56                   	push   %esi
+ 9a7:	e8 6f fc ff ff       	call   61b <sbrk>
+  if(p == (char*)-1)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+ 9af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9b2:	74 1c                	je     9d0 <malloc+0x80>
+  hp->s.size = nu;
+ 9b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9b7:	83 ec 0c             	sub    $0xc,%esp
+ 9ba:	83 c0 08             	add    $0x8,%eax
+ 9bd:	50                   	push   %eax
+ 9be:	e8 fd fe ff ff       	call   8c0 <free>
+  return freep;
+ 9c3:	8b 15 ac 0e 00 00    	mov    0xeac,%edx
+      if((p = morecore(nunits)) == 0)
+ 9c9:	83 c4 10             	add    $0x10,%esp
+ 9cc:	85 d2                	test   %edx,%edx
+ 9ce:	75 c0                	jne    990 <malloc+0x40>
+        return 0;
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9d3:	31 c0                	xor    %eax,%eax
+}
+ 9d5:	5b                   	pop    %ebx
+ 9d6:	5e                   	pop    %esi
+ 9d7:	5f                   	pop    %edi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9e0:	39 cf                	cmp    %ecx,%edi
+ 9e2:	74 4c                	je     a30 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9e4:	29 f9                	sub    %edi,%ecx
+ 9e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ef:	89 15 ac 0e 00 00    	mov    %edx,0xeac
+}
+ 9f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9f8:	83 c0 08             	add    $0x8,%eax
+}
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5f                   	pop    %edi
+ 9fe:	5d                   	pop    %ebp
+ 9ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a00:	c7 05 ac 0e 00 00 b0 	movl   $0xeb0,0xeac
+ a07:	0e 00 00 
+    base.s.size = 0;
+ a0a:	b8 b0 0e 00 00       	mov    $0xeb0,%eax
+    base.s.ptr = freep = prevp = &base;
+ a0f:	c7 05 b0 0e 00 00 b0 	movl   $0xeb0,0xeb0
+ a16:	0e 00 00 
+    base.s.size = 0;
+ a19:	c7 05 b4 0e 00 00 00 	movl   $0x0,0xeb4
+ a20:	00 00 00 
+    if(p->s.size >= nunits){
+ a23:	e9 54 ff ff ff       	jmp    97c <malloc+0x2c>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 08                	mov    (%eax),%ecx
+ a32:	89 0a                	mov    %ecx,(%edx)
+ a34:	eb b9                	jmp    9ef <malloc+0x9f>
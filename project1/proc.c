@@ -6,10 +6,9 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
 
 #define QUANTUM(X) (2*(X) + 4)
-#define QNEXT(start, p) ((start) + (((uint)((p) - (start)) + 1) % NPROC))
-#define QPREV(start, p) ((start) + (((uint)((p) - (start)) - 1) % NPROC))
 
 
 struct {
@@ -25,64 +24,270 @@ extern void trapret(void);
 
 static void wakeup1(void *chan);
 
-// Defining queues
-struct queue queues[] = {
-  [L0] = {ptable.proc, ptable.proc},
-  [L1] = {ptable.proc, ptable.proc},
-  [L2] = {ptable.proc, ptable.proc},
-};
+// Each CPU keeps its own run queues of RUNNABLE processes
+// (struct cpu's queues[]), linked through qnext/qprev. They are
+// still protected by ptable.lock, which sleep/wakeup and the
+// swtch protocol depend on, so every enqueue, dequeue, steal and
+// dispatch still serializes on that one lock; only an idle CPU
+// avoids it, by not taking it until some CPU has queued work
+// (see haswork()). Per-CPU queues spread the work, not the
+// locking: giving each CPU its own queue lock would only pay off
+// once dispatch stops holding ptable.lock across swtch, which
+// needs per-process locks for sleep/wakeup first. The running
+// process and specialproc are on no queue.
 
 static struct proc *specialproc;
 
+// Put at the front of L0 when it next becomes runnable.
+static struct proc *headproc;
+
+// Number of boost() calls so far.
+static uint nboost;
+
 /* ---Queue functions definition start--- */
 
-// Check whether queue is empty
-int 
-isempty_queue(enum qpriority level) 
+// Queue (index into cpu->queues) that p is scheduled from
+static int
+qlevel(struct proc *p)
 {
-  return (queues[level].front == queues[level].back);
+  int prio;
+
+  if (p->queue != L2)
+    return p->queue;
+
+  prio = p->priority;
+  if (prio < 0)
+    prio = 0;
+  if (prio >= NPRIO)
+    prio = NPRIO - 1;
+  return L2 + prio;
 }
 
-// Get first element of queue (L0, L1, L2)
-struct proc*
-firstproc(enum qpriority level) 
+// Queue that p is on, found by walking to its front
+static struct queue*
+findqueue(struct proc *p)
+{
+  struct queue *q;
+
+  while (p->qprev)
+    p = p->qprev;
+  for (q = p->cpu->queues; q < &p->cpu->queues[NQUEUE]; q++)
+    if (q->front == p)
+      return q;
+  panic("findqueue");
+}
+
+// Add p to the front or back of queue level of CPU c
+static void
+enqueue(struct cpu *c, int level, struct proc *p, int front)
+{
+  struct queue *q = &c->queues[level];
+
+  if (front) {
+    p->qprev = 0;
+    p->qnext = q->front;
+    if (q->front)
+      q->front->qprev = p;
+    else
+      q->back = p;
+    q->front = p;
+  } else {
+    p->qnext = 0;
+    p->qprev = q->back;
+    if (q->back)
+      q->back->qnext = p;
+    else
+      q->front = p;
+    q->back = p;
+  }
+  p->cpu = c;
+  c->nrun++;
+}
+
+// Remove p from q, one of p->cpu's queues
+static void
+unqueue(struct queue *q, struct proc *p)
+{
+  if (p->qprev)
+    p->qprev->qnext = p->qnext;
+  else
+    q->front = p->qnext;
+  if (p->qnext)
+    p->qnext->qprev = p->qprev;
+  else
+    q->back = p->qprev;
+  p->qnext = p->qprev = 0;
+  p->cpu->nrun--;
+}
+
+// Take the first process of c's highest non-empty queue
+static struct proc*
+dequeue1(struct cpu *c)
 {
+  struct queue *q;
   struct proc *p;
 
-  for (p = queues[level].front; p != queues[level].back; p = QNEXT(ptable.proc, p)) {
-    if (p->state == RUNNABLE && p->queue == level)
-      goto found;
+  for (q = c->queues; q < &c->queues[NQUEUE]; q++) {
+    if ((p = q->front) != 0) {
+      unqueue(q, p);
+      return p;
+    }
   }
+  return 0;
+}
 
-  // if nothing found -> find one more time
-  p = queues[level].back;
-  do {
-    if (p->state == RUNNABLE && p->queue == level)
-      goto found;
-    
-    p = QNEXT(ptable.proc, p);
-  } while (p != queues[level].back);
+// Next process for c to run: its own, or else one stolen
+// from the CPU with the most queued processes.
+static struct proc*
+dequeue(struct cpu *c)
+{
+  struct cpu *v, *busiest;
 
-found:
-  queues[level].front = p;
-  return p;
+  if (c->nrun > 0)
+    return dequeue1(c);
+
+  busiest = c;
+  for (v = cpus; v < cpus+ncpu; v++)
+    if (v->nrun > busiest->nrun)
+      busiest = v;
+  return dequeue1(busiest);
 }
 
-// Set back of queue with level appropriately.
-// Back of queue can vary by (circular) order of front, back and p.
-// case 1) front, p, back => no need for updating back
-// case 2) front, back, p => update back to QNEXT(ptable.proc, p)
-void
-setback(enum qpriority level, const struct proc* p) 
+// Whether there might be something to run. Called without
+// ptable.lock; scheduler() checks again with it held.
+static int
+haswork(void)
 {
-  struct proc *nextp = QNEXT(ptable.proc, p);
+  struct proc *p;
+  struct cpu *c;
 
-  // case 2
-  if ((queues[level].front - nextp) *
-      (nextp - queues[level].back) *
-      (queues[level].back - queues[level].front) <= 0) {
-        queues[level].back = nextp;
-      }
+  __sync_synchronize();
+  if ((p = specialproc) != 0)
+    return p->state == RUNNABLE;
+  for (c = cpus; c < cpus+ncpu; c++)
+    if (c->nrun > 0)
+      return 1;
+  return 0;
+}
+
+// CPU to queue a process that becomes runnable: the one making
+// it runnable, unless another has two fewer queued processes.
+static struct cpu*
+pickcpu(void)
+{
+  struct cpu *c, *me, *idlest;
+
+  me = idlest = mycpu();
+  for (c = cpus; c < cpus+ncpu; c++)
+    if (c->nrun < idlest->nrun)
+      idlest = c;
+  if (idlest->nrun + 2 <= me->nrun)
+    return idlest;
+  return me;
+}
+
+// Apply the boosts p has missed. boost() only moves the queues,
+// so each process resets its own fields the next time they are
+// used. Must be called before reading or setting them.
+static void
+catchup(struct proc *p)
+{
+  if (p->nboost == nboost)
+    return;
+
+  p->nboost = nboost;
+  p->queue = L0;
+  p->localtime = 0;
+  p->priority = 3;
+}
+
+// Wake a halted CPU to run, or steal, work just queued on c.
+// If c is 0, wake all of them.
+static void
+kick(struct cpu *c)
+{
+  struct cpu *v, *me = mycpu();
+
+  // Pairs with the barrier in haswork(): either we see the
+  // CPU idle, or it sees the work before halting.
+  __sync_synchronize();
+  if (c && c != me && c->idle) {
+    lapicipi(c->apicid, T_IRQ0 + IRQ_WAKE);
+    return;
+  }
+  for (v = cpus; v < cpus+ncpu; v++) {
+    if (v == me || !v->idle)
+      continue;
+    lapicipi(v->apicid, T_IRQ0 + IRQ_WAKE);
+    if (c)
+      return;
+  }
+}
+
+// Make p RUNNABLE and put it on a queue
+static void
+setrunnable(struct proc *p)
+{
+  struct cpu *c;
+
+  p->state = RUNNABLE;
+
+  // scheduler() runs specialproc without queueing it
+  if (p == specialproc) {
+    kick(mycpu());
+    return;
+  }
+
+  catchup(p);
+  c = pickcpu();
+  if (p == headproc) {
+    headproc = 0;
+    enqueue(c, L0, p, 1);
+  } else {
+    enqueue(c, qlevel(p), p, 0);
+  }
+  kick(c);
+}
+
+// Charge p for the ticks it ran since the last charge and
+// demote it if its quantum is used up. Returns whether it was.
+static int
+charge(struct proc *p)
+{
+  struct cpu *c = mycpu();
+  int n;
+
+  // schedulerLock() resets ticks, so n can come out negative.
+  n = ticks - c->start;
+  c->start = ticks;
+  if (p == specialproc || n <= 0)
+    return 0;
+
+  catchup(p);
+  p->localtime += n;
+  if (p->localtime < QUANTUM(p->queue))
+    return 0;
+  demote(p);
+  return 1;
+}
+
+// Program c's one-shot timer for p's quantum expiry or the
+// next boost, whichever is first. CPU 0 keeps its periodic
+// tick, since it maintains ticks and calls boost().
+static void
+armtimer(struct cpu *c, struct proc *p)
+{
+  int n;
+
+  if (c == &cpus[0])
+    return;
+
+  n = BOOSTTICKS - ticks % BOOSTTICKS;
+  if (p != specialproc && QUANTUM(p->queue) - (int)p->localtime < n)
+    n = QUANTUM(p->queue) - p->localtime;
+  if (n < 1)
+    n = 1;
+  lapictimer(n);
 }
 
 /* ---Queue functions definition end--- */
@@ -145,14 +350,10 @@ allocproc(void)
   char *sp;
 
   acquire(&ptable.lock);
-  p = queues[L0].back;
 
-  do {
-    if (p->state == UNUSED)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == UNUSED)
       goto found;
-    
-    p = QNEXT(ptable.proc, p);
-  } while (p != queues[L0].back);
 
   release(&ptable.lock);
   return 0;
@@ -160,6 +361,9 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->nboost = nboost;
+  if (p == headproc)
+    headproc = 0;
 
   release(&ptable.lock);
 
@@ -225,15 +429,7 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
-
-  // set the very first process to front
-  if (isempty_queue(L0)) {
-    queues[L0].front = p;
-  }
-  // set back of L0 appropriately
-  setback(L0, p);
-  // queues[L0].back = QNEXT(ptable.proc, p);
+  setrunnable(p);
 
   release(&ptable.lock);
 }
@@ -299,14 +495,7 @@ fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
-
-  // set the very first process to front
-  if (isempty_queue(L0)) {
-    queues[L0].front = np;
-  }
-  // set back appropriately
-  setback(np->queue, np);
+  setrunnable(np);
 
   release(&ptable.lock);
 
@@ -404,7 +593,8 @@ wait(void)
   }
 }
 
-// Demote process to higher-level queue
+// Demote process to higher-level queue.
+// p is running, so it joins the new queue when it yields.
 void
 demote(struct proc *p) 
 {
@@ -425,56 +615,76 @@ demote(struct proc *p)
 
   // p->queue will be either L1 or L2
   p->queue++;
-
-  // if queue is empty, need to set front as p
-  if (isempty_queue(p->queue))
-    queues[p->queue].front = p;
-
-  setback(p->queue, p);
-  // queues[p->queue].back = QNEXT(ptable.proc, p);
 }
 
-// Elapse localtime at timer interrupt.
-void
-elapse(void) 
+// Called at a timer interrupt, or at the IPI schedulerLock()
+// sends other CPUs. Charges the current process
+// and returns whether it should yield: its quantum is used up,
+// it was boosted, or the scheduler was locked by another one.
+// Otherwise re-arms the timer.
+int
+timeup(void)
 {
-  acquire(&ptable.lock);
-
-
   struct proc *p = myproc();
+  struct cpu *c = mycpu();
+  int yield;
 
-  if (!p) {
-    release(&ptable.lock);
-    return;
-  } 
-
-  p->localtime++;
+  if (!p)
+    return 0;
 
-  if (p->localtime >= QUANTUM(p->queue))
-    demote(p);
+  // Most ticks on CPU 0 change nothing; skip ptable.lock.
+  // (Other CPUs only get an interrupt when a deadline is due.)
+  if (c == &cpus[0] && !specialproc && c->nboost == nboost &&
+      p->localtime + (ticks - c->start) < QUANTUM(p->queue))
+    return 0;
 
+  acquire(&ptable.lock);
+  yield = charge(p) || c->nboost != nboost ||
+          (specialproc && p != specialproc);
+  if (!yield)
+    armtimer(c, p);
   release(&ptable.lock);
+
+  return yield;
 }
 
 // Boost foreach 100 ticks.
+// Moves every CPU's queues onto its L0; the processes' own
+// fields are reset lazily by catchup().
 void
 boost(void) 
 {
+  struct cpu *c;
+  struct queue *q, *l0;
   struct proc *p;
 
   acquire(&ptable.lock);
-  specialproc = 0;
+  nboost++;
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    // set specialproc to front of L0 queue
-    if (p->queue == SPECIAL) {
-      queues[L0].front = p;
-      setback(L0, p);
+  for (c = cpus; c < cpus+ncpu; c++) {
+    l0 = &c->queues[L0];
+    for (q = &c->queues[L1]; q < &c->queues[NQUEUE]; q++) {
+      if (!q->front)
+        continue;
+      if (l0->back) {
+        l0->back->qnext = q->front;
+        q->front->qprev = l0->back;
+      } else {
+        l0->front = q->front;
+      }
+      l0->back = q->back;
+      q->front = q->back = 0;
     }
+  }
 
-    p->queue = L0;
-    p->localtime = 0;
-    p->priority = 3;
+  // set specialproc to front of L0 queue
+  if ((p = specialproc) != 0) {
+    specialproc = 0;
+    if (p->state == RUNNABLE)
+      enqueue(pickcpu(), L0, p, 1);
+    else
+      headproc = p;
+    kick(0);
   }
 
   release(&ptable.lock);
@@ -492,7 +702,6 @@ void
 scheduler(void)
 {
   struct proc *p;
-  struct proc *fcfsp;
   struct cpu *c = mycpu();
   c->proc = 0;
   
@@ -500,60 +709,36 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    acquire(&ptable.lock);
-
-    if (!specialproc) goto L0sched;
-SPECIALsched:
-
-    while (specialproc && specialproc->state == RUNNABLE) {
-      c->proc = specialproc;
-      switchuvm(specialproc);
-      specialproc->state = RUNNING;
-
-      swtch(&(c->scheduler), specialproc->context);
-      switchkvm();
-
-      c->proc = 0;
+    if (!haswork()) {
+      // Nothing to run: stop the timer and halt until an
+      // interrupt, or an IPI from kick().
+      cli();
+      c->idle = 1;
+      if (c != &cpus[0])
+        lapictimer(0);
+      if (!haswork())
+        stihlt();
+      c->idle = 0;
+      continue;
     }
 
-    if (specialproc) goto schedend;
-
-L0sched:
-    // find and set first process. then, schedule as RR.
-    p = firstproc(L0);
-    for (p = queues[L0].front; p != queues[L0].back; p = QNEXT(ptable.proc, p)) {
-      if(p->state != RUNNABLE || p->queue != L0)
-        continue;
+    acquire(&ptable.lock);
 
-      if (specialproc) goto SPECIALsched;
+    // Only specialproc runs while the scheduler is locked.
+    if (specialproc)
+      p = specialproc->state == RUNNABLE ? specialproc : 0;
+    else
+      p = dequeue(c);
 
+    if (p) {
       c->proc = p;
       switchuvm(p);
       p->state = RUNNING;
 
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      c->proc = 0;
-    }
-
-    if (!isempty_queue(L0)) goto L0sched;
-
-L1sched:
-    p = firstproc(L1);
-
-    for (p = queues[L1].front; p != queues[L1].back; p = QNEXT(ptable.proc, p)) {
-      if (p->state != RUNNABLE || p->queue != L1)
-        continue;
-      
-      if (specialproc) goto SPECIALsched;
-
-      // L0 process came while scheduling L1 queue
-      if (!isempty_queue(L0)) goto L0sched;
-
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
+      catchup(p);
+      c->start = ticks;
+      c->nboost = nboost;
+      armtimer(c, p);
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
@@ -561,40 +746,6 @@ L1sched:
       c->proc = 0;
     }
 
-
-    if (!isempty_queue(L1)) goto L1sched;
-
-// L2sched:
-    fcfsp = p = firstproc(L2);
-
-    if (isempty_queue(L2)) {
-      goto schedend;
-    }
-
-    // find L2 process w/ the lowest priority
-    for (p = queues[L2].front; p != queues[L2].back; p = QNEXT(ptable.proc, p)) {
-      if (p->state != RUNNABLE || p->queue != L2) continue;
-
-      if (specialproc) goto SPECIALsched;
-      if (!isempty_queue(L0)) goto L0sched;
-      if (!isempty_queue(L1)) goto L1sched;
-
-      if (fcfsp->priority > p->priority) {
-        fcfsp = p;
-      }
-    }
-
-    // do context switching
-    c->proc = fcfsp;
-    switchuvm(fcfsp);
-    fcfsp->state = RUNNING;
-
-    swtch(&(c->scheduler), fcfsp->context);
-    switchkvm();
-
-    c->proc = 0;
-
-schedend:
     release(&ptable.lock);
   }
 }
@@ -633,7 +784,8 @@ __yield(void)
   acquire(&ptable.lock);  //DOC: yieldlock
 
   p = myproc();
-  p->state = RUNNABLE;
+  charge(p);
+  setrunnable(p);
   sched();
   release(&ptable.lock);
 }
@@ -646,19 +798,16 @@ yield(void)
   acquire(&ptable.lock);  //DOC: yieldlock
 
   p = myproc();
-  p->state = RUNNABLE;
-
-  // specially yield for L2 scheduler
-  if (p->queue == L2) {
-    // find next arbitrary runnable L2 process (ignore priority)
-    // and set front with it.
-    for (struct proc *temp = QNEXT(ptable.proc, queues[L0].front); 
-         temp != queues[L0].back;
-         temp = QNEXT(ptable.proc, temp)) {
-          if (temp->state == RUNNABLE && temp->queue == L2) {
-            queues[L2].front = temp;
-          }
-         }
+  charge(p);
+  catchup(p);
+
+  // specially yield for L2 scheduler: go behind every other
+  // runnable L2 process (ignore priority) for this round.
+  if (p->queue == L2 && p != specialproc) {
+    p->state = RUNNABLE;
+    enqueue(mycpu(), NQUEUE - 1, p, 0);
+  } else {
+    setrunnable(p);
   }
   sched();
   release(&ptable.lock);
@@ -709,6 +858,7 @@ sleep(void *chan, struct spinlock *lk)
     release(lk);
   }
   // Go to sleep.
+  charge(p);
   p->chan = chan;
   p->state = SLEEPING;
 
@@ -734,8 +884,7 @@ wakeup1(void *chan)
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
     if(p->state == SLEEPING && p->chan == chan) {
-      p->state = RUNNABLE;
-
+      setrunnable(p);
     }
   }
 }
@@ -763,7 +912,7 @@ kill(int pid)
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING) {
-        p->state = RUNNABLE;
+        setrunnable(p);
       }
       release(&ptable.lock);
       return 0;
@@ -815,6 +964,7 @@ void
 schedulerLock(int password)
 {
   struct proc *p = myproc();
+  struct cpu *c;
 
   acquire(&ptable.lock);
 
@@ -822,6 +972,7 @@ schedulerLock(int password)
     release(&ptable.lock);
     return;
   }
+  catchup(p);
   if (password != 2021031685 || specialproc) {
     release(&ptable.lock);
     cprintf("[killed] pid: %d, time quantum: %d, level: %d\n",
@@ -830,11 +981,17 @@ schedulerLock(int password)
     return;
   }
 
+  // p is running; scheduler() picks it up when it yields.
   ticks = 0;
   p->queue = SPECIAL;
-  p->state = RUNNABLE;
   specialproc = p;
 
+  // Other CPUs only take a timer interrupt at their next
+  // deadline; make the ones running a process yield now.
+  for (c = cpus; c < cpus+ncpu; c++)
+    if (c != mycpu() && c->proc)
+      lapicipi(c->apicid, T_IRQ0 + IRQ_WAKE);
+
   release(&ptable.lock);
 }
 
@@ -849,6 +1006,7 @@ schedulerUnlock(int password)
     release(&ptable.lock);
     return;
   }
+  catchup(p);
   if (password != 2021031685 || p->queue != SPECIAL) {
     release(&ptable.lock);
     cprintf("[killed] pid: %d, time quantum: %d, level: %d\n",
@@ -863,9 +1021,8 @@ schedulerUnlock(int password)
   p->localtime = 0;
   p->queue = L0;
   p->priority = 3;
-  queues[L0].front = p;
-
-  setback(L0, p);
+  headproc = p;
+  kick(0);
 
   release(&ptable.lock);
 }
@@ -875,8 +1032,15 @@ int
 getLevel(void)
 {
   struct proc *p = myproc();
+  int level;
+
   if (!p) return -1;
-  return p->queue;
+
+  acquire(&ptable.lock);
+  catchup(p);
+  level = p->queue;
+  release(&ptable.lock);
+  return level;
 }
 
 
@@ -890,7 +1054,15 @@ setPriority(int pid, int priority)
   acquire(&ptable.lock);
   for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
     if (p->pid == pid) {
-      p->priority = priority;
+      catchup(p);
+      // move a queued L2 process to its new priority's queue
+      if (p->state == RUNNABLE && p != specialproc && p->queue == L2) {
+        unqueue(findqueue(p), p);
+        p->priority = priority;
+        enqueue(p->cpu, qlevel(p), p, 0);
+      } else {
+        p->priority = priority;
+      }
       break;
     }
   }
@@ -1,3 +1,14 @@
+enum qpriority { L0, L1, L2, SPECIAL };
+
+#define QNUM 3
+#define NPRIO 4                // L2 priorities with a queue of their own
+#define NQUEUE (L2 + NPRIO)    // L0, L1, then L2 by priority
+
+struct queue {
+  struct proc *front;          // Front of queue
+  struct proc *back;           // Back of queue
+};
+
 // Per-CPU state
 struct cpu {
   uchar apicid;                // Local APIC ID
@@ -8,6 +19,11 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct queue queues[NQUEUE]; // RUNNABLE processes queued on this cpu
+  volatile int nrun;           // Number of processes in queues
+  volatile int idle;           // Halted in scheduler()
+  uint start;                  // ticks when proc was last charged
+  uint nboost;                 // Number of boosts when proc was dispatched
 };
 
 extern struct cpu cpus[NCPU];
@@ -33,8 +49,6 @@ struct context {
 };
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
-enum qpriority { L0, L1, L2, SPECIAL };
-
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -53,13 +67,10 @@ struct proc {
   enum qpriority queue;        // Queue priority
   int priority;                // Priority in L2 queue
   uint localtime;              // Elapsed time of process
-};
-
-#define QNUM 3
-
-struct queue {
-  struct proc *front;          // Front of queue
-  struct proc *back;           // Back of queue
+  struct proc *qnext;          // Next process in run queue
+  struct proc *qprev;          // Previous process in run queue
+  uint nboost;                 // Number of boosts applied to queue fields
+  struct cpu *cpu;             // CPU whose queues p is on
 };
 
 // Process memory is laid out contiguously, low addresses first:
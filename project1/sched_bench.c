@@ -0,0 +1,57 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NUM_YIELD 20000
+#define NUM_THREAD 4
+
+int idle[] = {0, 16, 48};
+int idlepid[64];
+
+// Time NUM_THREAD processes yielding to each other while n
+// other processes sleep. Scheduling cost should not grow with n.
+void bench(int n)
+{
+  int i, j, pid, start;
+
+  for (i = 0; i < n; i++)
+  {
+    if ((pid = fork()) == 0)
+    {
+      for (;;)
+        sleep(1000);
+    }
+    idlepid[i] = pid;
+  }
+
+  start = uptime();
+  for (i = 0; i < NUM_THREAD; i++)
+  {
+    if (fork() == 0)
+    {
+      for (j = 0; j < NUM_YIELD; j++)
+        yield();
+      exit();
+    }
+  }
+  for (i = 0; i < NUM_THREAD; i++)
+    wait();
+  printf(1, "%d idle: %d yields in %d ticks\n",
+         n, NUM_THREAD * NUM_YIELD, uptime() - start);
+
+  for (i = 0; i < n; i++)
+    kill(idlepid[i]);
+  for (i = 0; i < n; i++)
+    wait();
+}
+
+int main(int argc, char *argv[])
+{
+  int i;
+
+  printf(1, "scheduler benchmark start\n");
+  for (i = 0; i < sizeof(idle) / sizeof(idle[0]); i++)
+    bench(idle[i]);
+  printf(1, "done\n");
+  exit();
+}
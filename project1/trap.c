@@ -76,9 +76,7 @@ trap(struct trapframe *tf)
       acquire(&tickslock);
       ticks++;
 
-      elapse();
-
-      if ((ticks % 100) == 0)
+      if ((ticks % BOOSTTICKS) == 0)
         boost();
       
       wakeup(&ticks);
@@ -86,6 +84,10 @@ trap(struct trapframe *tf)
     }
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_WAKE:
+    // Leave hlt, or yield to specialproc (see below).
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -130,10 +132,12 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, if its quantum
+  // is used up or it was boosted, or on schedulerLock()'s IPI.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER) {
+     (tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_WAKE) &&
+     timeup()) {
     __yield();
   }
 
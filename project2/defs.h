@@ -125,6 +125,9 @@ void            wakeup(void*);
 void            yield(void);
 int             setmemorylimit(int, int);
 int             listproc(void);
+void            setparent(struct proc*, struct proc*);
+void            setpid(struct proc*, int);
+void            reparent(struct proc*);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -0,0 +1,17229 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 a0 10 00       	mov    $0x10a000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc f0 91 11 80       	mov    $0x801191f0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 50 31 10 80       	mov    $0x80103150,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <binit>:
+  struct buf head;
+} bcache;
+
+void
+binit(void)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	53                   	push   %ebx
+
+//PAGEBREAK!
+  // Create linked list of buffers
+  bcache.head.prev = &bcache.head;
+  bcache.head.next = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100044:	bb 54 b5 10 80       	mov    $0x8010b554,%ebx
+{
+80100049:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010004c:	68 20 7f 10 80       	push   $0x80107f20
+80100051:	68 20 b5 10 80       	push   $0x8010b520
+80100056:	e8 a5 49 00 00       	call   80104a00 <initlock>
+  bcache.head.next = &bcache.head;
+8010005b:	83 c4 10             	add    $0x10,%esp
+8010005e:	b8 1c fc 10 80       	mov    $0x8010fc1c,%eax
+  bcache.head.prev = &bcache.head;
+80100063:	c7 05 6c fc 10 80 1c 	movl   $0x8010fc1c,0x8010fc6c
+8010006a:	fc 10 80 
+  bcache.head.next = &bcache.head;
+8010006d:	c7 05 70 fc 10 80 1c 	movl   $0x8010fc1c,0x8010fc70
+80100074:	fc 10 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100077:	eb 09                	jmp    80100082 <binit+0x42>
+80100079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100080:	89 d3                	mov    %edx,%ebx
+    b->next = bcache.head.next;
+80100082:	89 43 54             	mov    %eax,0x54(%ebx)
+    b->prev = &bcache.head;
+    initsleeplock(&b->lock, "buffer");
+80100085:	83 ec 08             	sub    $0x8,%esp
+80100088:	8d 43 0c             	lea    0xc(%ebx),%eax
+    b->prev = &bcache.head;
+8010008b:	c7 43 50 1c fc 10 80 	movl   $0x8010fc1c,0x50(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100092:	68 27 7f 10 80       	push   $0x80107f27
+80100097:	50                   	push   %eax
+80100098:	e8 33 48 00 00       	call   801048d0 <initsleeplock>
+    bcache.head.next->prev = b;
+8010009d:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000a2:	8d 93 5c 02 00 00    	lea    0x25c(%ebx),%edx
+801000a8:	83 c4 10             	add    $0x10,%esp
+    bcache.head.next->prev = b;
+801000ab:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+801000ae:	89 d8                	mov    %ebx,%eax
+801000b0:	89 1d 70 fc 10 80    	mov    %ebx,0x8010fc70
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801000b6:	81 fb c0 f9 10 80    	cmp    $0x8010f9c0,%ebx
+801000bc:	75 c2                	jne    80100080 <binit+0x40>
+  }
+}
+801000be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801000c1:	c9                   	leave
+801000c2:	c3                   	ret
+801000c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801000d0 <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801000d0:	55                   	push   %ebp
+801000d1:	89 e5                	mov    %esp,%ebp
+801000d3:	57                   	push   %edi
+801000d4:	56                   	push   %esi
+801000d5:	53                   	push   %ebx
+801000d6:	83 ec 18             	sub    $0x18,%esp
+801000d9:	8b 75 08             	mov    0x8(%ebp),%esi
+801000dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&bcache.lock);
+801000df:	68 20 b5 10 80       	push   $0x8010b520
+801000e4:	e8 f7 4a 00 00       	call   80104be0 <acquire>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+801000e9:	8b 1d 70 fc 10 80    	mov    0x8010fc70,%ebx
+801000ef:	83 c4 10             	add    $0x10,%esp
+801000f2:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+801000f8:	75 11                	jne    8010010b <bread+0x3b>
+801000fa:	eb 24                	jmp    80100120 <bread+0x50>
+801000fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100100:	8b 5b 54             	mov    0x54(%ebx),%ebx
+80100103:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+80100109:	74 15                	je     80100120 <bread+0x50>
+    if(b->dev == dev && b->blockno == blockno){
+8010010b:	3b 73 04             	cmp    0x4(%ebx),%esi
+8010010e:	75 f0                	jne    80100100 <bread+0x30>
+80100110:	3b 7b 08             	cmp    0x8(%ebx),%edi
+80100113:	75 eb                	jne    80100100 <bread+0x30>
+      b->refcnt++;
+80100115:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+80100119:	eb 3f                	jmp    8010015a <bread+0x8a>
+8010011b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010011f:	90                   	nop
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+80100120:	8b 1d 6c fc 10 80    	mov    0x8010fc6c,%ebx
+80100126:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+8010012c:	75 0d                	jne    8010013b <bread+0x6b>
+8010012e:	eb 6e                	jmp    8010019e <bread+0xce>
+80100130:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100133:	81 fb 1c fc 10 80    	cmp    $0x8010fc1c,%ebx
+80100139:	74 63                	je     8010019e <bread+0xce>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+8010013b:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010013e:	85 c0                	test   %eax,%eax
+80100140:	75 ee                	jne    80100130 <bread+0x60>
+80100142:	f6 03 04             	testb  $0x4,(%ebx)
+80100145:	75 e9                	jne    80100130 <bread+0x60>
+      b->dev = dev;
+80100147:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+8010014a:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+8010014d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+80100153:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+      release(&bcache.lock);
+8010015a:	83 ec 0c             	sub    $0xc,%esp
+8010015d:	68 20 b5 10 80       	push   $0x8010b520
+80100162:	e8 19 4a 00 00       	call   80104b80 <release>
+      acquiresleep(&b->lock);
+80100167:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010016a:	89 04 24             	mov    %eax,(%esp)
+8010016d:	e8 9e 47 00 00       	call   80104910 <acquiresleep>
+      return b;
+80100172:	83 c4 10             	add    $0x10,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100175:	f6 03 02             	testb  $0x2,(%ebx)
+80100178:	74 0e                	je     80100188 <bread+0xb8>
+    iderw(b);
+  }
+  return b;
+}
+8010017a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010017d:	89 d8                	mov    %ebx,%eax
+8010017f:	5b                   	pop    %ebx
+80100180:	5e                   	pop    %esi
+80100181:	5f                   	pop    %edi
+80100182:	5d                   	pop    %ebp
+80100183:	c3                   	ret
+80100184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iderw(b);
+80100188:	83 ec 0c             	sub    $0xc,%esp
+8010018b:	53                   	push   %ebx
+8010018c:	e8 4f 22 00 00       	call   801023e0 <iderw>
+80100191:	83 c4 10             	add    $0x10,%esp
+}
+80100194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100197:	89 d8                	mov    %ebx,%eax
+80100199:	5b                   	pop    %ebx
+8010019a:	5e                   	pop    %esi
+8010019b:	5f                   	pop    %edi
+8010019c:	5d                   	pop    %ebp
+8010019d:	c3                   	ret
+  panic("bget: no buffers");
+8010019e:	83 ec 0c             	sub    $0xc,%esp
+801001a1:	68 2e 7f 10 80       	push   $0x80107f2e
+801001a6:	e8 d5 01 00 00       	call   80100380 <panic>
+801001ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001af:	90                   	nop
+
+801001b0 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801001b0:	55                   	push   %ebp
+801001b1:	89 e5                	mov    %esp,%ebp
+801001b3:	53                   	push   %ebx
+801001b4:	83 ec 10             	sub    $0x10,%esp
+801001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001ba:	8d 43 0c             	lea    0xc(%ebx),%eax
+801001bd:	50                   	push   %eax
+801001be:	e8 ed 47 00 00       	call   801049b0 <holdingsleep>
+801001c3:	83 c4 10             	add    $0x10,%esp
+801001c6:	85 c0                	test   %eax,%eax
+801001c8:	74 0f                	je     801001d9 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801001ca:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+801001cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801001d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801001d3:	c9                   	leave
+  iderw(b);
+801001d4:	e9 07 22 00 00       	jmp    801023e0 <iderw>
+    panic("bwrite");
+801001d9:	83 ec 0c             	sub    $0xc,%esp
+801001dc:	68 3f 7f 10 80       	push   $0x80107f3f
+801001e1:	e8 9a 01 00 00       	call   80100380 <panic>
+801001e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801001f0 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+801001f0:	55                   	push   %ebp
+801001f1:	89 e5                	mov    %esp,%ebp
+801001f3:	56                   	push   %esi
+801001f4:	53                   	push   %ebx
+801001f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801001f8:	8d 73 0c             	lea    0xc(%ebx),%esi
+801001fb:	83 ec 0c             	sub    $0xc,%esp
+801001fe:	56                   	push   %esi
+801001ff:	e8 ac 47 00 00       	call   801049b0 <holdingsleep>
+80100204:	83 c4 10             	add    $0x10,%esp
+80100207:	85 c0                	test   %eax,%eax
+80100209:	74 63                	je     8010026e <brelse+0x7e>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010020b:	83 ec 0c             	sub    $0xc,%esp
+8010020e:	56                   	push   %esi
+8010020f:	e8 5c 47 00 00       	call   80104970 <releasesleep>
+
+  acquire(&bcache.lock);
+80100214:	c7 04 24 20 b5 10 80 	movl   $0x8010b520,(%esp)
+8010021b:	e8 c0 49 00 00       	call   80104be0 <acquire>
+  b->refcnt--;
+80100220:	8b 43 4c             	mov    0x4c(%ebx),%eax
+  if (b->refcnt == 0) {
+80100223:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100226:	83 e8 01             	sub    $0x1,%eax
+80100229:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0) {
+8010022c:	85 c0                	test   %eax,%eax
+8010022e:	75 2c                	jne    8010025c <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+80100230:	8b 53 54             	mov    0x54(%ebx),%edx
+80100233:	8b 43 50             	mov    0x50(%ebx),%eax
+80100236:	89 42 50             	mov    %eax,0x50(%edx)
+    b->prev->next = b->next;
+80100239:	8b 53 54             	mov    0x54(%ebx),%edx
+8010023c:	89 50 54             	mov    %edx,0x54(%eax)
+    b->next = bcache.head.next;
+8010023f:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+    b->prev = &bcache.head;
+80100244:	c7 43 50 1c fc 10 80 	movl   $0x8010fc1c,0x50(%ebx)
+    b->next = bcache.head.next;
+8010024b:	89 43 54             	mov    %eax,0x54(%ebx)
+    bcache.head.next->prev = b;
+8010024e:	a1 70 fc 10 80       	mov    0x8010fc70,%eax
+80100253:	89 58 50             	mov    %ebx,0x50(%eax)
+    bcache.head.next = b;
+80100256:	89 1d 70 fc 10 80    	mov    %ebx,0x8010fc70
+  }
+  
+  release(&bcache.lock);
+8010025c:	c7 45 08 20 b5 10 80 	movl   $0x8010b520,0x8(%ebp)
+}
+80100263:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100266:	5b                   	pop    %ebx
+80100267:	5e                   	pop    %esi
+80100268:	5d                   	pop    %ebp
+  release(&bcache.lock);
+80100269:	e9 12 49 00 00       	jmp    80104b80 <release>
+    panic("brelse");
+8010026e:	83 ec 0c             	sub    $0xc,%esp
+80100271:	68 46 7f 10 80       	push   $0x80107f46
+80100276:	e8 05 01 00 00       	call   80100380 <panic>
+8010027b:	66 90                	xchg   %ax,%ax
+8010027d:	66 90                	xchg   %ax,%ax
+8010027f:	90                   	nop
+
+80100280 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100280:	55                   	push   %ebp
+80100281:	89 e5                	mov    %esp,%ebp
+80100283:	57                   	push   %edi
+80100284:	56                   	push   %esi
+80100285:	53                   	push   %ebx
+80100286:	83 ec 18             	sub    $0x18,%esp
+80100289:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010028c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010028f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100292:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100294:	e8 a7 16 00 00       	call   80101940 <iunlock>
+  acquire(&cons.lock);
+80100299:	c7 04 24 20 ff 10 80 	movl   $0x8010ff20,(%esp)
+801002a0:	e8 3b 49 00 00       	call   80104be0 <acquire>
+  while(n > 0){
+801002a5:	83 c4 10             	add    $0x10,%esp
+801002a8:	85 db                	test   %ebx,%ebx
+801002aa:	0f 8e 94 00 00 00    	jle    80100344 <consoleread+0xc4>
+    while(input.r == input.w){
+801002b0:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+801002b5:	39 05 04 ff 10 80    	cmp    %eax,0x8010ff04
+801002bb:	74 25                	je     801002e2 <consoleread+0x62>
+801002bd:	eb 59                	jmp    80100318 <consoleread+0x98>
+801002bf:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801002c0:	83 ec 08             	sub    $0x8,%esp
+801002c3:	68 20 ff 10 80       	push   $0x8010ff20
+801002c8:	68 00 ff 10 80       	push   $0x8010ff00
+801002cd:	e8 1e 41 00 00       	call   801043f0 <sleep>
+    while(input.r == input.w){
+801002d2:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+801002d7:	83 c4 10             	add    $0x10,%esp
+801002da:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+801002e0:	75 36                	jne    80100318 <consoleread+0x98>
+      if(myproc()->killed){
+801002e2:	e8 c9 36 00 00       	call   801039b0 <myproc>
+801002e7:	8b 48 24             	mov    0x24(%eax),%ecx
+801002ea:	85 c9                	test   %ecx,%ecx
+801002ec:	74 d2                	je     801002c0 <consoleread+0x40>
+        release(&cons.lock);
+801002ee:	83 ec 0c             	sub    $0xc,%esp
+801002f1:	68 20 ff 10 80       	push   $0x8010ff20
+801002f6:	e8 85 48 00 00       	call   80104b80 <release>
+        ilock(ip);
+801002fb:	5a                   	pop    %edx
+801002fc:	ff 75 08             	push   0x8(%ebp)
+801002ff:	e8 5c 15 00 00       	call   80101860 <ilock>
+        return -1;
+80100304:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010030a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010030f:	5b                   	pop    %ebx
+80100310:	5e                   	pop    %esi
+80100311:	5f                   	pop    %edi
+80100312:	5d                   	pop    %ebp
+80100313:	c3                   	ret
+80100314:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100318:	8d 50 01             	lea    0x1(%eax),%edx
+8010031b:	89 15 00 ff 10 80    	mov    %edx,0x8010ff00
+80100321:	89 c2                	mov    %eax,%edx
+80100323:	83 e2 7f             	and    $0x7f,%edx
+80100326:	0f be 8a 80 fe 10 80 	movsbl -0x7fef0180(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010032d:	80 f9 04             	cmp    $0x4,%cl
+80100330:	74 37                	je     80100369 <consoleread+0xe9>
+    *dst++ = c;
+80100332:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100335:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100338:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010033b:	83 f9 0a             	cmp    $0xa,%ecx
+8010033e:	0f 85 64 ff ff ff    	jne    801002a8 <consoleread+0x28>
+  release(&cons.lock);
+80100344:	83 ec 0c             	sub    $0xc,%esp
+80100347:	68 20 ff 10 80       	push   $0x8010ff20
+8010034c:	e8 2f 48 00 00       	call   80104b80 <release>
+  ilock(ip);
+80100351:	58                   	pop    %eax
+80100352:	ff 75 08             	push   0x8(%ebp)
+80100355:	e8 06 15 00 00       	call   80101860 <ilock>
+  return target - n;
+8010035a:	89 f8                	mov    %edi,%eax
+8010035c:	83 c4 10             	add    $0x10,%esp
+}
+8010035f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100362:	29 d8                	sub    %ebx,%eax
+}
+80100364:	5b                   	pop    %ebx
+80100365:	5e                   	pop    %esi
+80100366:	5f                   	pop    %edi
+80100367:	5d                   	pop    %ebp
+80100368:	c3                   	ret
+      if(n < target){
+80100369:	39 fb                	cmp    %edi,%ebx
+8010036b:	73 d7                	jae    80100344 <consoleread+0xc4>
+        input.r--;
+8010036d:	a3 00 ff 10 80       	mov    %eax,0x8010ff00
+80100372:	eb d0                	jmp    80100344 <consoleread+0xc4>
+80100374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010037f:	90                   	nop
+
+80100380 <panic>:
+{
+80100380:	55                   	push   %ebp
+80100381:	89 e5                	mov    %esp,%ebp
+80100383:	56                   	push   %esi
+80100384:	53                   	push   %ebx
+80100385:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100388:	fa                   	cli
+  cons.locking = 0;
+80100389:	c7 05 54 ff 10 80 00 	movl   $0x0,0x8010ff54
+80100390:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100393:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100396:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100399:	e8 52 26 00 00       	call   801029f0 <lapicid>
+8010039e:	83 ec 08             	sub    $0x8,%esp
+801003a1:	50                   	push   %eax
+801003a2:	68 4d 7f 10 80       	push   $0x80107f4d
+801003a7:	e8 04 03 00 00       	call   801006b0 <cprintf>
+  cprintf(s);
+801003ac:	58                   	pop    %eax
+801003ad:	ff 75 08             	push   0x8(%ebp)
+801003b0:	e8 fb 02 00 00       	call   801006b0 <cprintf>
+  cprintf("\n");
+801003b5:	c7 04 24 4f 89 10 80 	movl   $0x8010894f,(%esp)
+801003bc:	e8 ef 02 00 00       	call   801006b0 <cprintf>
+  getcallerpcs(&s, pcs);
+801003c1:	8d 45 08             	lea    0x8(%ebp),%eax
+801003c4:	5a                   	pop    %edx
+801003c5:	59                   	pop    %ecx
+801003c6:	53                   	push   %ebx
+801003c7:	50                   	push   %eax
+801003c8:	e8 53 46 00 00       	call   80104a20 <getcallerpcs>
+  for(i=0; i<10; i++)
+801003cd:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801003d0:	83 ec 08             	sub    $0x8,%esp
+801003d3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801003d5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801003d8:	68 61 7f 10 80       	push   $0x80107f61
+801003dd:	e8 ce 02 00 00       	call   801006b0 <cprintf>
+  for(i=0; i<10; i++)
+801003e2:	83 c4 10             	add    $0x10,%esp
+801003e5:	39 f3                	cmp    %esi,%ebx
+801003e7:	75 e7                	jne    801003d0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801003e9:	c7 05 58 ff 10 80 01 	movl   $0x1,0x8010ff58
+801003f0:	00 00 00 
+  for(;;)
+801003f3:	eb fe                	jmp    801003f3 <panic+0x73>
+801003f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100400 <consputc.part.0>:
+consputc(int c)
+80100400:	55                   	push   %ebp
+80100401:	89 e5                	mov    %esp,%ebp
+80100403:	57                   	push   %edi
+80100404:	56                   	push   %esi
+80100405:	53                   	push   %ebx
+80100406:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100409:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010040e:	0f 84 cc 00 00 00    	je     801004e0 <consputc.part.0+0xe0>
+    uartputc(c);
+80100414:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100417:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010041c:	89 c3                	mov    %eax,%ebx
+8010041e:	50                   	push   %eax
+8010041f:	e8 2c 66 00 00       	call   80106a50 <uartputc>
+80100424:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100429:	89 fa                	mov    %edi,%edx
+8010042b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010042c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100431:	89 f2                	mov    %esi,%edx
+80100433:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100434:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100437:	89 fa                	mov    %edi,%edx
+80100439:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010043e:	c1 e1 08             	shl    $0x8,%ecx
+80100441:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100442:	89 f2                	mov    %esi,%edx
+80100444:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100445:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100448:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010044b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010044d:	83 fb 0a             	cmp    $0xa,%ebx
+80100450:	75 76                	jne    801004c8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100452:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100457:	f7 e2                	mul    %edx
+80100459:	c1 ea 06             	shr    $0x6,%edx
+8010045c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010045f:	c1 e0 04             	shl    $0x4,%eax
+80100462:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100465:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010046b:	0f 8f 2f 01 00 00    	jg     801005a0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100471:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100477:	0f 8f c3 00 00 00    	jg     80100540 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010047d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010047f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100486:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100489:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010048c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100491:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100496:	89 da                	mov    %ebx,%edx
+80100498:	ee                   	out    %al,(%dx)
+80100499:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010049e:	89 f8                	mov    %edi,%eax
+801004a0:	89 ca                	mov    %ecx,%edx
+801004a2:	ee                   	out    %al,(%dx)
+801004a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801004a8:	89 da                	mov    %ebx,%edx
+801004aa:	ee                   	out    %al,(%dx)
+801004ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801004af:	89 ca                	mov    %ecx,%edx
+801004b1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801004b2:	b8 20 07 00 00       	mov    $0x720,%eax
+801004b7:	66 89 06             	mov    %ax,(%esi)
+}
+801004ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801004bd:	5b                   	pop    %ebx
+801004be:	5e                   	pop    %esi
+801004bf:	5f                   	pop    %edi
+801004c0:	5d                   	pop    %ebp
+801004c1:	c3                   	ret
+801004c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801004c8:	0f b6 db             	movzbl %bl,%ebx
+801004cb:	8d 70 01             	lea    0x1(%eax),%esi
+801004ce:	80 cf 07             	or     $0x7,%bh
+801004d1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801004d8:	80 
+801004d9:	eb 8a                	jmp    80100465 <consputc.part.0+0x65>
+801004db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801004df:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801004e0:	83 ec 0c             	sub    $0xc,%esp
+801004e3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801004e8:	6a 08                	push   $0x8
+801004ea:	e8 61 65 00 00       	call   80106a50 <uartputc>
+801004ef:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801004f6:	e8 55 65 00 00       	call   80106a50 <uartputc>
+801004fb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100502:	e8 49 65 00 00       	call   80106a50 <uartputc>
+80100507:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010050c:	89 f2                	mov    %esi,%edx
+8010050e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010050f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100514:	89 da                	mov    %ebx,%edx
+80100516:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100517:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010051a:	89 f2                	mov    %esi,%edx
+8010051c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100521:	c1 e1 08             	shl    $0x8,%ecx
+80100524:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100525:	89 da                	mov    %ebx,%edx
+80100527:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100528:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010052b:	83 c4 10             	add    $0x10,%esp
+8010052e:	09 ce                	or     %ecx,%esi
+80100530:	74 5e                	je     80100590 <consputc.part.0+0x190>
+80100532:	83 ee 01             	sub    $0x1,%esi
+80100535:	e9 2b ff ff ff       	jmp    80100465 <consputc.part.0+0x65>
+8010053a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100540:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100543:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100546:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+8010054d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100552:	68 60 0e 00 00       	push   $0xe60
+80100557:	68 a0 80 0b 80       	push   $0x800b80a0
+8010055c:	68 00 80 0b 80       	push   $0x800b8000
+80100561:	e8 ea 47 00 00       	call   80104d50 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100566:	b8 80 07 00 00       	mov    $0x780,%eax
+8010056b:	83 c4 0c             	add    $0xc,%esp
+8010056e:	29 d8                	sub    %ebx,%eax
+80100570:	01 c0                	add    %eax,%eax
+80100572:	50                   	push   %eax
+80100573:	6a 00                	push   $0x0
+80100575:	56                   	push   %esi
+80100576:	e8 45 47 00 00       	call   80104cc0 <memset>
+  outb(CRTPORT+1, pos);
+8010057b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+8010057e:	83 c4 10             	add    $0x10,%esp
+80100581:	e9 06 ff ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+80100586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010058d:	8d 76 00             	lea    0x0(%esi),%esi
+80100590:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100594:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100599:	31 ff                	xor    %edi,%edi
+8010059b:	e9 ec fe ff ff       	jmp    8010048c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+801005a0:	83 ec 0c             	sub    $0xc,%esp
+801005a3:	68 65 7f 10 80       	push   $0x80107f65
+801005a8:	e8 d3 fd ff ff       	call   80100380 <panic>
+801005ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801005b0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801005b0:	55                   	push   %ebp
+801005b1:	89 e5                	mov    %esp,%ebp
+801005b3:	57                   	push   %edi
+801005b4:	56                   	push   %esi
+801005b5:	53                   	push   %ebx
+801005b6:	83 ec 18             	sub    $0x18,%esp
+801005b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+801005bc:	ff 75 08             	push   0x8(%ebp)
+801005bf:	e8 7c 13 00 00       	call   80101940 <iunlock>
+  acquire(&cons.lock);
+801005c4:	c7 04 24 20 ff 10 80 	movl   $0x8010ff20,(%esp)
+801005cb:	e8 10 46 00 00       	call   80104be0 <acquire>
+  for(i = 0; i < n; i++)
+801005d0:	83 c4 10             	add    $0x10,%esp
+801005d3:	85 f6                	test   %esi,%esi
+801005d5:	7e 25                	jle    801005fc <consolewrite+0x4c>
+801005d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801005da:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+801005dd:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+    consputc(buf[i] & 0xff);
+801005e3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+801005e6:	85 d2                	test   %edx,%edx
+801005e8:	74 06                	je     801005f0 <consolewrite+0x40>
+  asm volatile("cli");
+801005ea:	fa                   	cli
+    for(;;)
+801005eb:	eb fe                	jmp    801005eb <consolewrite+0x3b>
+801005ed:	8d 76 00             	lea    0x0(%esi),%esi
+801005f0:	e8 0b fe ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; i < n; i++)
+801005f5:	83 c3 01             	add    $0x1,%ebx
+801005f8:	39 df                	cmp    %ebx,%edi
+801005fa:	75 e1                	jne    801005dd <consolewrite+0x2d>
+  release(&cons.lock);
+801005fc:	83 ec 0c             	sub    $0xc,%esp
+801005ff:	68 20 ff 10 80       	push   $0x8010ff20
+80100604:	e8 77 45 00 00       	call   80104b80 <release>
+  ilock(ip);
+80100609:	58                   	pop    %eax
+8010060a:	ff 75 08             	push   0x8(%ebp)
+8010060d:	e8 4e 12 00 00       	call   80101860 <ilock>
+
+  return n;
+}
+80100612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100615:	89 f0                	mov    %esi,%eax
+80100617:	5b                   	pop    %ebx
+80100618:	5e                   	pop    %esi
+80100619:	5f                   	pop    %edi
+8010061a:	5d                   	pop    %ebp
+8010061b:	c3                   	ret
+8010061c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100620 <printint>:
+{
+80100620:	55                   	push   %ebp
+80100621:	89 e5                	mov    %esp,%ebp
+80100623:	57                   	push   %edi
+80100624:	56                   	push   %esi
+80100625:	89 c6                	mov    %eax,%esi
+80100627:	53                   	push   %ebx
+80100628:	89 d3                	mov    %edx,%ebx
+8010062a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010062d:	85 c9                	test   %ecx,%ecx
+8010062f:	74 04                	je     80100635 <printint+0x15>
+80100631:	85 c0                	test   %eax,%eax
+80100633:	78 63                	js     80100698 <printint+0x78>
+    x = xx;
+80100635:	89 f1                	mov    %esi,%ecx
+80100637:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100639:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010063c:	31 f6                	xor    %esi,%esi
+8010063e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100640:	89 c8                	mov    %ecx,%eax
+80100642:	31 d2                	xor    %edx,%edx
+80100644:	89 f7                	mov    %esi,%edi
+80100646:	f7 f3                	div    %ebx
+80100648:	8d 76 01             	lea    0x1(%esi),%esi
+8010064b:	0f b6 92 90 7f 10 80 	movzbl -0x7fef8070(%edx),%edx
+80100652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100656:	89 ca                	mov    %ecx,%edx
+80100658:	89 c1                	mov    %eax,%ecx
+8010065a:	39 da                	cmp    %ebx,%edx
+8010065c:	73 e2                	jae    80100640 <printint+0x20>
+  if(sign)
+8010065e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100661:	85 c0                	test   %eax,%eax
+80100663:	74 07                	je     8010066c <printint+0x4c>
+    buf[i++] = '-';
+80100665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+8010066a:	89 f7                	mov    %esi,%edi
+8010066c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+8010066f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100671:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+    consputc(buf[i]);
+80100677:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+8010067a:	85 d2                	test   %edx,%edx
+8010067c:	74 0a                	je     80100688 <printint+0x68>
+8010067e:	fa                   	cli
+    for(;;)
+8010067f:	eb fe                	jmp    8010067f <printint+0x5f>
+80100681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100688:	e8 73 fd ff ff       	call   80100400 <consputc.part.0>
+  while(--i >= 0)
+8010068d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100690:	39 df                	cmp    %ebx,%edi
+80100692:	74 0c                	je     801006a0 <printint+0x80>
+80100694:	89 c7                	mov    %eax,%edi
+80100696:	eb d9                	jmp    80100671 <printint+0x51>
+80100698:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+8010069a:	89 f1                	mov    %esi,%ecx
+8010069c:	f7 d9                	neg    %ecx
+8010069e:	eb 99                	jmp    80100639 <printint+0x19>
+}
+801006a0:	83 c4 2c             	add    $0x2c,%esp
+801006a3:	5b                   	pop    %ebx
+801006a4:	5e                   	pop    %esi
+801006a5:	5f                   	pop    %edi
+801006a6:	5d                   	pop    %ebp
+801006a7:	c3                   	ret
+801006a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006af:	90                   	nop
+
+801006b0 <cprintf>:
+{
+801006b0:	55                   	push   %ebp
+801006b1:	89 e5                	mov    %esp,%ebp
+801006b3:	57                   	push   %edi
+801006b4:	56                   	push   %esi
+801006b5:	53                   	push   %ebx
+801006b6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+801006b9:	8b 3d 54 ff 10 80    	mov    0x8010ff54,%edi
+  if (fmt == 0)
+801006bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+801006c2:	85 ff                	test   %edi,%edi
+801006c4:	0f 85 36 01 00 00    	jne    80100800 <cprintf+0x150>
+  if (fmt == 0)
+801006ca:	85 f6                	test   %esi,%esi
+801006cc:	0f 84 e0 01 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006d2:	0f b6 06             	movzbl (%esi),%eax
+801006d5:	85 c0                	test   %eax,%eax
+801006d7:	74 6b                	je     80100744 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+801006d9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801006dc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801006df:	31 db                	xor    %ebx,%ebx
+801006e1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+801006e3:	83 f8 25             	cmp    $0x25,%eax
+801006e6:	0f 85 dc 00 00 00    	jne    801007c8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+801006ec:	83 c3 01             	add    $0x1,%ebx
+801006ef:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+801006f3:	85 c9                	test   %ecx,%ecx
+801006f5:	74 42                	je     80100739 <cprintf+0x89>
+    switch(c){
+801006f7:	83 f9 70             	cmp    $0x70,%ecx
+801006fa:	0f 84 99 00 00 00    	je     80100799 <cprintf+0xe9>
+80100700:	7f 4e                	jg     80100750 <cprintf+0xa0>
+80100702:	83 f9 25             	cmp    $0x25,%ecx
+80100705:	0f 84 cd 00 00 00    	je     801007d8 <cprintf+0x128>
+8010070b:	83 f9 64             	cmp    $0x64,%ecx
+8010070e:	0f 85 24 01 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100714:	8d 47 04             	lea    0x4(%edi),%eax
+80100717:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010071c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100721:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100724:	8b 07                	mov    (%edi),%eax
+80100726:	e8 f5 fe ff ff       	call   80100620 <printint>
+8010072b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010072e:	83 c3 01             	add    $0x1,%ebx
+80100731:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100735:	85 c0                	test   %eax,%eax
+80100737:	75 aa                	jne    801006e3 <cprintf+0x33>
+80100739:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+8010073c:	85 ff                	test   %edi,%edi
+8010073e:	0f 85 df 00 00 00    	jne    80100823 <cprintf+0x173>
+}
+80100744:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100747:	5b                   	pop    %ebx
+80100748:	5e                   	pop    %esi
+80100749:	5f                   	pop    %edi
+8010074a:	5d                   	pop    %ebp
+8010074b:	c3                   	ret
+8010074c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100750:	83 f9 73             	cmp    $0x73,%ecx
+80100753:	75 3b                	jne    80100790 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100755:	8b 17                	mov    (%edi),%edx
+80100757:	8d 47 04             	lea    0x4(%edi),%eax
+8010075a:	85 d2                	test   %edx,%edx
+8010075c:	0f 85 0e 01 00 00    	jne    80100870 <cprintf+0x1c0>
+80100762:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100767:	bf 78 7f 10 80       	mov    $0x80107f78,%edi
+8010076c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010076f:	89 fb                	mov    %edi,%ebx
+80100771:	89 f7                	mov    %esi,%edi
+80100773:	89 c6                	mov    %eax,%esi
+80100775:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100778:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+8010077e:	85 d2                	test   %edx,%edx
+80100780:	0f 84 fe 00 00 00    	je     80100884 <cprintf+0x1d4>
+80100786:	fa                   	cli
+    for(;;)
+80100787:	eb fe                	jmp    80100787 <cprintf+0xd7>
+80100789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100790:	83 f9 78             	cmp    $0x78,%ecx
+80100793:	0f 85 9f 00 00 00    	jne    80100838 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100799:	8d 47 04             	lea    0x4(%edi),%eax
+8010079c:	31 c9                	xor    %ecx,%ecx
+8010079e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007a3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+801007a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801007a9:	8b 07                	mov    (%edi),%eax
+801007ab:	e8 70 fe ff ff       	call   80100620 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+801007b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007b7:	85 c0                	test   %eax,%eax
+801007b9:	0f 85 24 ff ff ff    	jne    801006e3 <cprintf+0x33>
+801007bf:	e9 75 ff ff ff       	jmp    80100739 <cprintf+0x89>
+801007c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+801007c8:	8b 0d 58 ff 10 80    	mov    0x8010ff58,%ecx
+801007ce:	85 c9                	test   %ecx,%ecx
+801007d0:	74 15                	je     801007e7 <cprintf+0x137>
+801007d2:	fa                   	cli
+    for(;;)
+801007d3:	eb fe                	jmp    801007d3 <cprintf+0x123>
+801007d5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+801007d8:	8b 0d 58 ff 10 80    	mov    0x8010ff58,%ecx
+801007de:	85 c9                	test   %ecx,%ecx
+801007e0:	75 7e                	jne    80100860 <cprintf+0x1b0>
+801007e2:	b8 25 00 00 00       	mov    $0x25,%eax
+801007e7:	e8 14 fc ff ff       	call   80100400 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801007ec:	83 c3 01             	add    $0x1,%ebx
+801007ef:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+801007f3:	85 c0                	test   %eax,%eax
+801007f5:	0f 85 e8 fe ff ff    	jne    801006e3 <cprintf+0x33>
+801007fb:	e9 39 ff ff ff       	jmp    80100739 <cprintf+0x89>
+    acquire(&cons.lock);
+80100800:	83 ec 0c             	sub    $0xc,%esp
+80100803:	68 20 ff 10 80       	push   $0x8010ff20
+80100808:	e8 d3 43 00 00       	call   80104be0 <acquire>
+  if (fmt == 0)
+8010080d:	83 c4 10             	add    $0x10,%esp
+80100810:	85 f6                	test   %esi,%esi
+80100812:	0f 84 9a 00 00 00    	je     801008b2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100818:	0f b6 06             	movzbl (%esi),%eax
+8010081b:	85 c0                	test   %eax,%eax
+8010081d:	0f 85 b6 fe ff ff    	jne    801006d9 <cprintf+0x29>
+    release(&cons.lock);
+80100823:	83 ec 0c             	sub    $0xc,%esp
+80100826:	68 20 ff 10 80       	push   $0x8010ff20
+8010082b:	e8 50 43 00 00       	call   80104b80 <release>
+80100830:	83 c4 10             	add    $0x10,%esp
+80100833:	e9 0c ff ff ff       	jmp    80100744 <cprintf+0x94>
+  if(panicked){
+80100838:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+8010083e:	85 d2                	test   %edx,%edx
+80100840:	75 26                	jne    80100868 <cprintf+0x1b8>
+80100842:	b8 25 00 00 00       	mov    $0x25,%eax
+80100847:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010084a:	e8 b1 fb ff ff       	call   80100400 <consputc.part.0>
+8010084f:	a1 58 ff 10 80       	mov    0x8010ff58,%eax
+80100854:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100857:	85 c0                	test   %eax,%eax
+80100859:	74 4b                	je     801008a6 <cprintf+0x1f6>
+8010085b:	fa                   	cli
+    for(;;)
+8010085c:	eb fe                	jmp    8010085c <cprintf+0x1ac>
+8010085e:	66 90                	xchg   %ax,%ax
+80100860:	fa                   	cli
+80100861:	eb fe                	jmp    80100861 <cprintf+0x1b1>
+80100863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100867:	90                   	nop
+80100868:	fa                   	cli
+80100869:	eb fe                	jmp    80100869 <cprintf+0x1b9>
+8010086b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010086f:	90                   	nop
+      for(; *s; s++)
+80100870:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100873:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100875:	84 c9                	test   %cl,%cl
+80100877:	0f 85 ef fe ff ff    	jne    8010076c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+8010087d:	89 c7                	mov    %eax,%edi
+8010087f:	e9 aa fe ff ff       	jmp    8010072e <cprintf+0x7e>
+80100884:	e8 77 fb ff ff       	call   80100400 <consputc.part.0>
+      for(; *s; s++)
+80100889:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+8010088d:	83 c3 01             	add    $0x1,%ebx
+80100890:	84 c0                	test   %al,%al
+80100892:	0f 85 e0 fe ff ff    	jne    80100778 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100898:	89 f0                	mov    %esi,%eax
+8010089a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010089d:	89 fe                	mov    %edi,%esi
+8010089f:	89 c7                	mov    %eax,%edi
+801008a1:	e9 88 fe ff ff       	jmp    8010072e <cprintf+0x7e>
+801008a6:	89 c8                	mov    %ecx,%eax
+801008a8:	e8 53 fb ff ff       	call   80100400 <consputc.part.0>
+801008ad:	e9 7c fe ff ff       	jmp    8010072e <cprintf+0x7e>
+    panic("null fmt");
+801008b2:	83 ec 0c             	sub    $0xc,%esp
+801008b5:	68 7f 7f 10 80       	push   $0x80107f7f
+801008ba:	e8 c1 fa ff ff       	call   80100380 <panic>
+801008bf:	90                   	nop
+
+801008c0 <consoleintr>:
+{
+801008c0:	55                   	push   %ebp
+801008c1:	89 e5                	mov    %esp,%ebp
+801008c3:	57                   	push   %edi
+801008c4:	56                   	push   %esi
+  int c, doprocdump = 0;
+801008c5:	31 f6                	xor    %esi,%esi
+{
+801008c7:	53                   	push   %ebx
+801008c8:	83 ec 18             	sub    $0x18,%esp
+801008cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+801008ce:	68 20 ff 10 80       	push   $0x8010ff20
+801008d3:	e8 08 43 00 00       	call   80104be0 <acquire>
+  while((c = getc()) >= 0){
+801008d8:	83 c4 10             	add    $0x10,%esp
+801008db:	eb 1a                	jmp    801008f7 <consoleintr+0x37>
+801008dd:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+801008e0:	83 fb 08             	cmp    $0x8,%ebx
+801008e3:	0f 84 d7 00 00 00    	je     801009c0 <consoleintr+0x100>
+801008e9:	83 fb 10             	cmp    $0x10,%ebx
+801008ec:	0f 85 2d 01 00 00    	jne    80100a1f <consoleintr+0x15f>
+801008f2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+801008f7:	ff d7                	call   *%edi
+801008f9:	89 c3                	mov    %eax,%ebx
+801008fb:	85 c0                	test   %eax,%eax
+801008fd:	0f 88 e5 00 00 00    	js     801009e8 <consoleintr+0x128>
+    switch(c){
+80100903:	83 fb 15             	cmp    $0x15,%ebx
+80100906:	74 7a                	je     80100982 <consoleintr+0xc2>
+80100908:	7e d6                	jle    801008e0 <consoleintr+0x20>
+8010090a:	83 fb 7f             	cmp    $0x7f,%ebx
+8010090d:	0f 84 ad 00 00 00    	je     801009c0 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100913:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100918:	89 c2                	mov    %eax,%edx
+8010091a:	2b 15 00 ff 10 80    	sub    0x8010ff00,%edx
+80100920:	83 fa 7f             	cmp    $0x7f,%edx
+80100923:	77 d2                	ja     801008f7 <consoleintr+0x37>
+  if(panicked){
+80100925:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010092b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010092e:	83 e0 7f             	and    $0x7f,%eax
+80100931:	89 0d 08 ff 10 80    	mov    %ecx,0x8010ff08
+80100937:	88 98 80 fe 10 80    	mov    %bl,-0x7fef0180(%eax)
+  if(panicked){
+8010093d:	85 d2                	test   %edx,%edx
+8010093f:	0f 85 47 01 00 00    	jne    80100a8c <consoleintr+0x1cc>
+80100945:	89 d8                	mov    %ebx,%eax
+80100947:	e8 b4 fa ff ff       	call   80100400 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+8010094c:	83 fb 0a             	cmp    $0xa,%ebx
+8010094f:	0f 84 18 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+80100955:	83 fb 04             	cmp    $0x4,%ebx
+80100958:	0f 84 0f 01 00 00    	je     80100a6d <consoleintr+0x1ad>
+8010095e:	a1 00 ff 10 80       	mov    0x8010ff00,%eax
+80100963:	83 e8 80             	sub    $0xffffff80,%eax
+80100966:	39 05 08 ff 10 80    	cmp    %eax,0x8010ff08
+8010096c:	75 89                	jne    801008f7 <consoleintr+0x37>
+8010096e:	e9 ff 00 00 00       	jmp    80100a72 <consoleintr+0x1b2>
+80100973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100977:	90                   	nop
+80100978:	b8 00 01 00 00       	mov    $0x100,%eax
+8010097d:	e8 7e fa ff ff       	call   80100400 <consputc.part.0>
+      while(input.e != input.w &&
+80100982:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100987:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+8010098d:	0f 84 64 ff ff ff    	je     801008f7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100993:	83 e8 01             	sub    $0x1,%eax
+80100996:	89 c2                	mov    %eax,%edx
+80100998:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010099b:	80 ba 80 fe 10 80 0a 	cmpb   $0xa,-0x7fef0180(%edx)
+801009a2:	0f 84 4f ff ff ff    	je     801008f7 <consoleintr+0x37>
+  if(panicked){
+801009a8:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.e--;
+801009ae:	a3 08 ff 10 80       	mov    %eax,0x8010ff08
+  if(panicked){
+801009b3:	85 d2                	test   %edx,%edx
+801009b5:	74 c1                	je     80100978 <consoleintr+0xb8>
+801009b7:	fa                   	cli
+    for(;;)
+801009b8:	eb fe                	jmp    801009b8 <consoleintr+0xf8>
+801009ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+801009c0:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+801009c5:	3b 05 04 ff 10 80    	cmp    0x8010ff04,%eax
+801009cb:	0f 84 26 ff ff ff    	je     801008f7 <consoleintr+0x37>
+        input.e--;
+801009d1:	83 e8 01             	sub    $0x1,%eax
+801009d4:	a3 08 ff 10 80       	mov    %eax,0x8010ff08
+  if(panicked){
+801009d9:	a1 58 ff 10 80       	mov    0x8010ff58,%eax
+801009de:	85 c0                	test   %eax,%eax
+801009e0:	74 22                	je     80100a04 <consoleintr+0x144>
+801009e2:	fa                   	cli
+    for(;;)
+801009e3:	eb fe                	jmp    801009e3 <consoleintr+0x123>
+801009e5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+801009e8:	83 ec 0c             	sub    $0xc,%esp
+801009eb:	68 20 ff 10 80       	push   $0x8010ff20
+801009f0:	e8 8b 41 00 00       	call   80104b80 <release>
+  if(doprocdump) {
+801009f5:	83 c4 10             	add    $0x10,%esp
+801009f8:	85 f6                	test   %esi,%esi
+801009fa:	75 17                	jne    80100a13 <consoleintr+0x153>
+}
+801009fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009ff:	5b                   	pop    %ebx
+80100a00:	5e                   	pop    %esi
+80100a01:	5f                   	pop    %edi
+80100a02:	5d                   	pop    %ebp
+80100a03:	c3                   	ret
+80100a04:	b8 00 01 00 00       	mov    $0x100,%eax
+80100a09:	e8 f2 f9 ff ff       	call   80100400 <consputc.part.0>
+80100a0e:	e9 e4 fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a16:	5b                   	pop    %ebx
+80100a17:	5e                   	pop    %esi
+80100a18:	5f                   	pop    %edi
+80100a19:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+80100a1a:	e9 91 3c 00 00       	jmp    801046b0 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100a1f:	85 db                	test   %ebx,%ebx
+80100a21:	0f 84 d0 fe ff ff    	je     801008f7 <consoleintr+0x37>
+80100a27:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+80100a2c:	89 c2                	mov    %eax,%edx
+80100a2e:	2b 15 00 ff 10 80    	sub    0x8010ff00,%edx
+80100a34:	83 fa 7f             	cmp    $0x7f,%edx
+80100a37:	0f 87 ba fe ff ff    	ja     801008f7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a3d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100a40:	8b 15 58 ff 10 80    	mov    0x8010ff58,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a46:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100a49:	83 fb 0d             	cmp    $0xd,%ebx
+80100a4c:	0f 85 df fe ff ff    	jne    80100931 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a52:	89 0d 08 ff 10 80    	mov    %ecx,0x8010ff08
+80100a58:	c6 80 80 fe 10 80 0a 	movb   $0xa,-0x7fef0180(%eax)
+  if(panicked){
+80100a5f:	85 d2                	test   %edx,%edx
+80100a61:	75 29                	jne    80100a8c <consoleintr+0x1cc>
+80100a63:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100a68:	e8 93 f9 ff ff       	call   80100400 <consputc.part.0>
+          input.w = input.e;
+80100a6d:	a1 08 ff 10 80       	mov    0x8010ff08,%eax
+          wakeup(&input.r);
+80100a72:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100a75:	a3 04 ff 10 80       	mov    %eax,0x8010ff04
+          wakeup(&input.r);
+80100a7a:	68 00 ff 10 80       	push   $0x8010ff00
+80100a7f:	e8 1c 3b 00 00       	call   801045a0 <wakeup>
+80100a84:	83 c4 10             	add    $0x10,%esp
+80100a87:	e9 6b fe ff ff       	jmp    801008f7 <consoleintr+0x37>
+80100a8c:	fa                   	cli
+    for(;;)
+80100a8d:	eb fe                	jmp    80100a8d <consoleintr+0x1cd>
+80100a8f:	90                   	nop
+
+80100a90 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100a90:	55                   	push   %ebp
+80100a91:	89 e5                	mov    %esp,%ebp
+80100a93:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100a96:	68 88 7f 10 80       	push   $0x80107f88
+80100a9b:	68 20 ff 10 80       	push   $0x8010ff20
+80100aa0:	e8 5b 3f 00 00       	call   80104a00 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100aa5:	c7 05 0c 09 11 80 b0 	movl   $0x801005b0,0x8011090c
+80100aac:	05 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100aaf:	c7 05 08 09 11 80 80 	movl   $0x80100280,0x80110908
+80100ab6:	02 10 80 
+  cons.locking = 1;
+80100ab9:	c7 05 54 ff 10 80 01 	movl   $0x1,0x8010ff54
+80100ac0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100ac3:	58                   	pop    %eax
+80100ac4:	5a                   	pop    %edx
+80100ac5:	6a 00                	push   $0x0
+80100ac7:	6a 01                	push   $0x1
+80100ac9:	e8 a2 1a 00 00       	call   80102570 <ioapicenable>
+}
+80100ace:	83 c4 10             	add    $0x10,%esp
+80100ad1:	c9                   	leave
+80100ad2:	c3                   	ret
+80100ad3:	66 90                	xchg   %ax,%ax
+80100ad5:	66 90                	xchg   %ax,%ax
+80100ad7:	66 90                	xchg   %ax,%ax
+80100ad9:	66 90                	xchg   %ax,%ax
+80100adb:	66 90                	xchg   %ax,%ax
+80100add:	66 90                	xchg   %ax,%ax
+80100adf:	90                   	nop
+
+80100ae0 <exec2>:
+  return exec2(path, argv, 1);
+}
+
+int
+exec2(char *path, char **argv, int stacksize)
+{
+80100ae0:	55                   	push   %ebp
+80100ae1:	89 e5                	mov    %esp,%ebp
+80100ae3:	57                   	push   %edi
+80100ae4:	56                   	push   %esi
+80100ae5:	53                   	push   %ebx
+80100ae6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100aec:	e8 bf 2e 00 00       	call   801039b0 <myproc>
+
+  // Cleanup sibling & mother thread
+  clean_thread(curproc);
+80100af1:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80100af4:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+  clean_thread(curproc);
+80100afa:	50                   	push   %eax
+80100afb:	e8 d0 59 00 00       	call   801064d0 <clean_thread>
+
+  begin_op();
+80100b00:	e8 5b 23 00 00       	call   80102e60 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100b05:	59                   	pop    %ecx
+80100b06:	ff 75 08             	push   0x8(%ebp)
+80100b09:	e8 82 16 00 00       	call   80102190 <namei>
+80100b0e:	83 c4 10             	add    $0x10,%esp
+80100b11:	85 c0                	test   %eax,%eax
+80100b13:	0f 84 9a 03 00 00    	je     80100eb3 <exec2+0x3d3>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100b19:	83 ec 0c             	sub    $0xc,%esp
+80100b1c:	89 c7                	mov    %eax,%edi
+80100b1e:	50                   	push   %eax
+80100b1f:	e8 3c 0d 00 00       	call   80101860 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100b24:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100b2a:	6a 34                	push   $0x34
+80100b2c:	6a 00                	push   $0x0
+80100b2e:	50                   	push   %eax
+80100b2f:	57                   	push   %edi
+80100b30:	e8 3b 10 00 00       	call   80101b70 <readi>
+80100b35:	83 c4 20             	add    $0x20,%esp
+80100b38:	83 f8 34             	cmp    $0x34,%eax
+80100b3b:	0f 85 02 01 00 00    	jne    80100c43 <exec2+0x163>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100b41:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100b48:	45 4c 46 
+80100b4b:	0f 85 f2 00 00 00    	jne    80100c43 <exec2+0x163>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100b51:	e8 6a 70 00 00       	call   80107bc0 <setupkvm>
+80100b56:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100b5c:	85 c0                	test   %eax,%eax
+80100b5e:	0f 84 df 00 00 00    	je     80100c43 <exec2+0x163>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b64:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100b6b:	00 
+80100b6c:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+  sz = 0;
+80100b72:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100b79:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100b7c:	0f 84 e6 00 00 00    	je     80100c68 <exec2+0x188>
+80100b82:	31 db                	xor    %ebx,%ebx
+80100b84:	e9 8d 00 00 00       	jmp    80100c16 <exec2+0x136>
+80100b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100b90:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100b97:	75 6c                	jne    80100c05 <exec2+0x125>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100b99:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100b9f:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100ba5:	0f 82 87 00 00 00    	jb     80100c32 <exec2+0x152>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100bab:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100bb1:	72 7f                	jb     80100c32 <exec2+0x152>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100bb3:	83 ec 04             	sub    $0x4,%esp
+80100bb6:	50                   	push   %eax
+80100bb7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100bbd:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bc3:	e8 28 6e 00 00       	call   801079f0 <allocuvm>
+80100bc8:	83 c4 10             	add    $0x10,%esp
+80100bcb:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100bd1:	85 c0                	test   %eax,%eax
+80100bd3:	74 5d                	je     80100c32 <exec2+0x152>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100bd5:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100bdb:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100be0:	75 50                	jne    80100c32 <exec2+0x152>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100be2:	83 ec 0c             	sub    $0xc,%esp
+80100be5:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100beb:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100bf1:	57                   	push   %edi
+80100bf2:	50                   	push   %eax
+80100bf3:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100bf9:	e8 22 6d 00 00       	call   80107920 <loaduvm>
+80100bfe:	83 c4 20             	add    $0x20,%esp
+80100c01:	85 c0                	test   %eax,%eax
+80100c03:	78 2d                	js     80100c32 <exec2+0x152>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100c05:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100c0c:	83 c3 01             	add    $0x1,%ebx
+80100c0f:	83 c6 20             	add    $0x20,%esi
+80100c12:	39 d8                	cmp    %ebx,%eax
+80100c14:	7e 52                	jle    80100c68 <exec2+0x188>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100c16:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100c1c:	6a 20                	push   $0x20
+80100c1e:	56                   	push   %esi
+80100c1f:	50                   	push   %eax
+80100c20:	57                   	push   %edi
+80100c21:	e8 4a 0f 00 00       	call   80101b70 <readi>
+80100c26:	83 c4 10             	add    $0x10,%esp
+80100c29:	83 f8 20             	cmp    $0x20,%eax
+80100c2c:	0f 84 5e ff ff ff    	je     80100b90 <exec2+0xb0>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100c32:	83 ec 0c             	sub    $0xc,%esp
+80100c35:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100c3b:	e8 00 6f 00 00       	call   80107b40 <freevm>
+  if(ip){
+80100c40:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100c43:	83 ec 0c             	sub    $0xc,%esp
+80100c46:	57                   	push   %edi
+80100c47:	e8 a4 0e 00 00       	call   80101af0 <iunlockput>
+    end_op();
+80100c4c:	e8 7f 22 00 00       	call   80102ed0 <end_op>
+80100c51:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100c54:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80100c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c5c:	5b                   	pop    %ebx
+80100c5d:	5e                   	pop    %esi
+80100c5e:	5f                   	pop    %edi
+80100c5f:	5d                   	pop    %ebp
+80100c60:	c3                   	ret
+80100c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  iunlockput(ip);
+80100c68:	83 ec 0c             	sub    $0xc,%esp
+80100c6b:	57                   	push   %edi
+80100c6c:	e8 7f 0e 00 00       	call   80101af0 <iunlockput>
+  end_op();
+80100c71:	e8 5a 22 00 00       	call   80102ed0 <end_op>
+  if (stacksize < 1 || stacksize > 100) 
+80100c76:	8b 45 10             	mov    0x10(%ebp),%eax
+80100c79:	83 c4 10             	add    $0x10,%esp
+80100c7c:	83 e8 01             	sub    $0x1,%eax
+80100c7f:	83 f8 63             	cmp    $0x63,%eax
+80100c82:	0f 87 da 00 00 00    	ja     80100d62 <exec2+0x282>
+  if (curproc->limit && sz + NEWSIZEINBYTES(stacksize) > curproc->limit) {
+80100c88:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+80100c8e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80100c91:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80100c97:	8d 59 01             	lea    0x1(%ecx),%ebx
+80100c9a:	c1 e3 0c             	shl    $0xc,%ebx
+80100c9d:	85 c0                	test   %eax,%eax
+80100c9f:	74 11                	je     80100cb2 <exec2+0x1d2>
+80100ca1:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+80100ca7:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+80100caa:	39 d0                	cmp    %edx,%eax
+80100cac:	0f 82 e0 01 00 00    	jb     80100e92 <exec2+0x3b2>
+  sz = PGROUNDUP(sz);
+80100cb2:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+  if((sz = allocuvm(pgdir, sz, sz + NEWSIZEINBYTES(stacksize))) == 0)
+80100cb8:	83 ec 04             	sub    $0x4,%esp
+  sz = PGROUNDUP(sz);
+80100cbb:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+80100cc1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + NEWSIZEINBYTES(stacksize))) == 0)
+80100cc7:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+80100cca:	50                   	push   %eax
+80100ccb:	56                   	push   %esi
+80100ccc:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100cd2:	56                   	push   %esi
+80100cd3:	e8 18 6d 00 00       	call   801079f0 <allocuvm>
+80100cd8:	83 c4 10             	add    $0x10,%esp
+80100cdb:	89 c7                	mov    %eax,%edi
+80100cdd:	85 c0                	test   %eax,%eax
+80100cdf:	0f 84 7d 00 00 00    	je     80100d62 <exec2+0x282>
+  clearpteu(pgdir, (char*)(sz - NEWSIZEINBYTES(stacksize)));
+80100ce5:	83 ec 08             	sub    $0x8,%esp
+80100ce8:	29 d8                	sub    %ebx,%eax
+  for(argc = 0; argv[argc]; argc++) {
+80100cea:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - NEWSIZEINBYTES(stacksize)));
+80100cec:	50                   	push   %eax
+80100ced:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80100cee:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - NEWSIZEINBYTES(stacksize)));
+80100cf0:	e8 6b 6f 00 00       	call   80107c60 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100cf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100cf8:	83 c4 10             	add    $0x10,%esp
+80100cfb:	8b 10                	mov    (%eax),%edx
+80100cfd:	85 d2                	test   %edx,%edx
+80100cff:	0f 84 69 01 00 00    	je     80100e6e <exec2+0x38e>
+80100d05:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+80100d0b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100d0e:	eb 1e                	jmp    80100d2e <exec2+0x24e>
+80100d10:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80100d13:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80100d1a:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80100d20:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80100d23:	85 d2                	test   %edx,%edx
+80100d25:	74 51                	je     80100d78 <exec2+0x298>
+    if(argc >= MAXARG)
+80100d27:	83 f8 20             	cmp    $0x20,%eax
+80100d2a:	74 36                	je     80100d62 <exec2+0x282>
+  for(argc = 0; argv[argc]; argc++) {
+80100d2c:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d2e:	83 ec 0c             	sub    $0xc,%esp
+80100d31:	52                   	push   %edx
+80100d32:	e8 79 41 00 00       	call   80104eb0 <strlen>
+80100d37:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d39:	58                   	pop    %eax
+80100d3a:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d3d:	83 eb 01             	sub    $0x1,%ebx
+80100d40:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d43:	e8 68 41 00 00       	call   80104eb0 <strlen>
+80100d48:	83 c0 01             	add    $0x1,%eax
+80100d4b:	50                   	push   %eax
+80100d4c:	ff 34 b7             	push   (%edi,%esi,4)
+80100d4f:	53                   	push   %ebx
+80100d50:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d56:	e8 d5 70 00 00       	call   80107e30 <copyout>
+80100d5b:	83 c4 20             	add    $0x20,%esp
+80100d5e:	85 c0                	test   %eax,%eax
+80100d60:	79 ae                	jns    80100d10 <exec2+0x230>
+    freevm(pgdir);
+80100d62:	83 ec 0c             	sub    $0xc,%esp
+80100d65:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d6b:	e8 d0 6d 00 00       	call   80107b40 <freevm>
+80100d70:	83 c4 10             	add    $0x10,%esp
+80100d73:	e9 dc fe ff ff       	jmp    80100c54 <exec2+0x174>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100d78:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80100d7f:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80100d85:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100d8b:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80100d8e:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80100d91:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80100d98:	00 00 00 00 
+  ustack[1] = argc;
+80100d9c:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80100da2:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100da9:	ff ff ff 
+  ustack[1] = argc;
+80100dac:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100db2:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80100db4:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100db6:	29 d0                	sub    %edx,%eax
+80100db8:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100dbe:	56                   	push   %esi
+80100dbf:	51                   	push   %ecx
+80100dc0:	53                   	push   %ebx
+80100dc1:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100dc7:	e8 64 70 00 00       	call   80107e30 <copyout>
+80100dcc:	83 c4 10             	add    $0x10,%esp
+80100dcf:	85 c0                	test   %eax,%eax
+80100dd1:	78 8f                	js     80100d62 <exec2+0x282>
+  for(last=s=path; *s; s++)
+80100dd3:	8b 45 08             	mov    0x8(%ebp),%eax
+80100dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+80100dd9:	0f b6 00             	movzbl (%eax),%eax
+80100ddc:	84 c0                	test   %al,%al
+80100dde:	74 17                	je     80100df7 <exec2+0x317>
+80100de0:	89 d1                	mov    %edx,%ecx
+80100de2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+80100de8:	83 c1 01             	add    $0x1,%ecx
+80100deb:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80100ded:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80100df0:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+80100df3:	84 c0                	test   %al,%al
+80100df5:	75 f1                	jne    80100de8 <exec2+0x308>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+80100df7:	83 ec 04             	sub    $0x4,%esp
+80100dfa:	6a 10                	push   $0x10
+80100dfc:	52                   	push   %edx
+80100dfd:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+80100e03:	8d 46 6c             	lea    0x6c(%esi),%eax
+80100e06:	50                   	push   %eax
+80100e07:	e8 64 40 00 00       	call   80104e70 <safestrcpy>
+  curproc->pgdir = pgdir;
+80100e0c:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+80100e12:	89 f0                	mov    %esi,%eax
+80100e14:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+80100e17:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+80100e19:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+80100e1c:	89 c1                	mov    %eax,%ecx
+80100e1e:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+80100e24:	8b 40 18             	mov    0x18(%eax),%eax
+80100e27:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80100e2a:	8b 41 18             	mov    0x18(%ecx),%eax
+80100e2d:	89 58 44             	mov    %ebx,0x44(%eax)
+  curproc->stackpage = stacksize;
+80100e30:	8b 45 10             	mov    0x10(%ebp),%eax
+  curproc->isthread = 0;
+80100e33:	c7 81 88 00 00 00 00 	movl   $0x0,0x88(%ecx)
+80100e3a:	00 00 00 
+  curproc->stackpage = stacksize;
+80100e3d:	89 41 7c             	mov    %eax,0x7c(%ecx)
+  curproc->mother = 0;
+80100e40:	c7 81 94 00 00 00 00 	movl   $0x0,0x94(%ecx)
+80100e47:	00 00 00 
+  curproc->tid = 0;
+80100e4a:	c7 81 8c 00 00 00 00 	movl   $0x0,0x8c(%ecx)
+80100e51:	00 00 00 
+  switchuvm(curproc);
+80100e54:	89 0c 24             	mov    %ecx,(%esp)
+80100e57:	e8 34 69 00 00       	call   80107790 <switchuvm>
+  freevm(oldpgdir);
+80100e5c:	89 34 24             	mov    %esi,(%esp)
+80100e5f:	e8 dc 6c 00 00       	call   80107b40 <freevm>
+  return 0;
+80100e64:	83 c4 10             	add    $0x10,%esp
+80100e67:	31 c0                	xor    %eax,%eax
+80100e69:	e9 eb fd ff ff       	jmp    80100c59 <exec2+0x179>
+  for(argc = 0; argv[argc]; argc++) {
+80100e6e:	be 10 00 00 00       	mov    $0x10,%esi
+80100e73:	ba 04 00 00 00       	mov    $0x4,%edx
+80100e78:	b8 03 00 00 00       	mov    $0x3,%eax
+80100e7d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100e84:	00 00 00 
+80100e87:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80100e8d:	e9 ff fe ff ff       	jmp    80100d91 <exec2+0x2b1>
+    cprintf("exec error: memory limit exceeded!\n");
+80100e92:	83 ec 0c             	sub    $0xc,%esp
+80100e95:	68 b0 7f 10 80       	push   $0x80107fb0
+80100e9a:	e8 11 f8 ff ff       	call   801006b0 <cprintf>
+    freevm(pgdir);
+80100e9f:	5a                   	pop    %edx
+80100ea0:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100ea6:	e8 95 6c 00 00       	call   80107b40 <freevm>
+80100eab:	83 c4 10             	add    $0x10,%esp
+80100eae:	e9 a1 fd ff ff       	jmp    80100c54 <exec2+0x174>
+    end_op();
+80100eb3:	e8 18 20 00 00       	call   80102ed0 <end_op>
+    cprintf("exec: fail\n");
+80100eb8:	83 ec 0c             	sub    $0xc,%esp
+80100ebb:	68 a1 7f 10 80       	push   $0x80107fa1
+80100ec0:	e8 eb f7 ff ff       	call   801006b0 <cprintf>
+    return -1;
+80100ec5:	83 c4 10             	add    $0x10,%esp
+80100ec8:	e9 87 fd ff ff       	jmp    80100c54 <exec2+0x174>
+80100ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100ed0 <exec>:
+{
+80100ed0:	55                   	push   %ebp
+80100ed1:	89 e5                	mov    %esp,%ebp
+80100ed3:	83 ec 0c             	sub    $0xc,%esp
+  return exec2(path, argv, 1);
+80100ed6:	6a 01                	push   $0x1
+80100ed8:	ff 75 0c             	push   0xc(%ebp)
+80100edb:	ff 75 08             	push   0x8(%ebp)
+80100ede:	e8 fd fb ff ff       	call   80100ae0 <exec2>
+}
+80100ee3:	c9                   	leave
+80100ee4:	c3                   	ret
+80100ee5:	66 90                	xchg   %ax,%ax
+80100ee7:	66 90                	xchg   %ax,%ax
+80100ee9:	66 90                	xchg   %ax,%ax
+80100eeb:	66 90                	xchg   %ax,%ax
+80100eed:	66 90                	xchg   %ax,%ax
+80100eef:	90                   	nop
+
+80100ef0 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80100ef0:	55                   	push   %ebp
+80100ef1:	89 e5                	mov    %esp,%ebp
+80100ef3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100ef6:	68 d4 7f 10 80       	push   $0x80107fd4
+80100efb:	68 60 ff 10 80       	push   $0x8010ff60
+80100f00:	e8 fb 3a 00 00       	call   80104a00 <initlock>
+}
+80100f05:	83 c4 10             	add    $0x10,%esp
+80100f08:	c9                   	leave
+80100f09:	c3                   	ret
+80100f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100f10 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80100f10:	55                   	push   %ebp
+80100f11:	89 e5                	mov    %esp,%ebp
+80100f13:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100f14:	bb 94 ff 10 80       	mov    $0x8010ff94,%ebx
+{
+80100f19:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+80100f1c:	68 60 ff 10 80       	push   $0x8010ff60
+80100f21:	e8 ba 3c 00 00       	call   80104be0 <acquire>
+80100f26:	83 c4 10             	add    $0x10,%esp
+80100f29:	eb 10                	jmp    80100f3b <filealloc+0x2b>
+80100f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100f2f:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100f30:	83 c3 18             	add    $0x18,%ebx
+80100f33:	81 fb f4 08 11 80    	cmp    $0x801108f4,%ebx
+80100f39:	74 25                	je     80100f60 <filealloc+0x50>
+    if(f->ref == 0){
+80100f3b:	8b 43 04             	mov    0x4(%ebx),%eax
+80100f3e:	85 c0                	test   %eax,%eax
+80100f40:	75 ee                	jne    80100f30 <filealloc+0x20>
+      f->ref = 1;
+      release(&ftable.lock);
+80100f42:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+80100f45:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+80100f4c:	68 60 ff 10 80       	push   $0x8010ff60
+80100f51:	e8 2a 3c 00 00       	call   80104b80 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+80100f56:	89 d8                	mov    %ebx,%eax
+      return f;
+80100f58:	83 c4 10             	add    $0x10,%esp
+}
+80100f5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f5e:	c9                   	leave
+80100f5f:	c3                   	ret
+  release(&ftable.lock);
+80100f60:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80100f63:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+80100f65:	68 60 ff 10 80       	push   $0x8010ff60
+80100f6a:	e8 11 3c 00 00       	call   80104b80 <release>
+}
+80100f6f:	89 d8                	mov    %ebx,%eax
+  return 0;
+80100f71:	83 c4 10             	add    $0x10,%esp
+}
+80100f74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100f77:	c9                   	leave
+80100f78:	c3                   	ret
+80100f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100f80 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80100f80:	55                   	push   %ebp
+80100f81:	89 e5                	mov    %esp,%ebp
+80100f83:	53                   	push   %ebx
+80100f84:	83 ec 10             	sub    $0x10,%esp
+80100f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+80100f8a:	68 60 ff 10 80       	push   $0x8010ff60
+80100f8f:	e8 4c 3c 00 00       	call   80104be0 <acquire>
+  if(f->ref < 1)
+80100f94:	8b 43 04             	mov    0x4(%ebx),%eax
+80100f97:	83 c4 10             	add    $0x10,%esp
+80100f9a:	85 c0                	test   %eax,%eax
+80100f9c:	7e 1a                	jle    80100fb8 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+80100f9e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80100fa1:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80100fa4:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80100fa7:	68 60 ff 10 80       	push   $0x8010ff60
+80100fac:	e8 cf 3b 00 00       	call   80104b80 <release>
+  return f;
+}
+80100fb1:	89 d8                	mov    %ebx,%eax
+80100fb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100fb6:	c9                   	leave
+80100fb7:	c3                   	ret
+    panic("filedup");
+80100fb8:	83 ec 0c             	sub    $0xc,%esp
+80100fbb:	68 db 7f 10 80       	push   $0x80107fdb
+80100fc0:	e8 bb f3 ff ff       	call   80100380 <panic>
+80100fc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100fd0 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80100fd0:	55                   	push   %ebp
+80100fd1:	89 e5                	mov    %esp,%ebp
+80100fd3:	57                   	push   %edi
+80100fd4:	56                   	push   %esi
+80100fd5:	53                   	push   %ebx
+80100fd6:	83 ec 28             	sub    $0x28,%esp
+80100fd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+80100fdc:	68 60 ff 10 80       	push   $0x8010ff60
+80100fe1:	e8 fa 3b 00 00       	call   80104be0 <acquire>
+  if(f->ref < 1)
+80100fe6:	8b 53 04             	mov    0x4(%ebx),%edx
+80100fe9:	83 c4 10             	add    $0x10,%esp
+80100fec:	85 d2                	test   %edx,%edx
+80100fee:	0f 8e a5 00 00 00    	jle    80101099 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80100ff4:	83 ea 01             	sub    $0x1,%edx
+80100ff7:	89 53 04             	mov    %edx,0x4(%ebx)
+80100ffa:	75 44                	jne    80101040 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+80100ffc:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80101000:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101003:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101005:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010100b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010100e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80101011:	8b 43 10             	mov    0x10(%ebx),%eax
+80101014:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80101017:	68 60 ff 10 80       	push   $0x8010ff60
+8010101c:	e8 5f 3b 00 00       	call   80104b80 <release>
+
+  if(ff.type == FD_PIPE)
+80101021:	83 c4 10             	add    $0x10,%esp
+80101024:	83 ff 01             	cmp    $0x1,%edi
+80101027:	74 57                	je     80101080 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80101029:	83 ff 02             	cmp    $0x2,%edi
+8010102c:	74 2a                	je     80101058 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+8010102e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101031:	5b                   	pop    %ebx
+80101032:	5e                   	pop    %esi
+80101033:	5f                   	pop    %edi
+80101034:	5d                   	pop    %ebp
+80101035:	c3                   	ret
+80101036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010103d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+80101040:	c7 45 08 60 ff 10 80 	movl   $0x8010ff60,0x8(%ebp)
+}
+80101047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010104a:	5b                   	pop    %ebx
+8010104b:	5e                   	pop    %esi
+8010104c:	5f                   	pop    %edi
+8010104d:	5d                   	pop    %ebp
+    release(&ftable.lock);
+8010104e:	e9 2d 3b 00 00       	jmp    80104b80 <release>
+80101053:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101057:	90                   	nop
+    begin_op();
+80101058:	e8 03 1e 00 00       	call   80102e60 <begin_op>
+    iput(ff.ip);
+8010105d:	83 ec 0c             	sub    $0xc,%esp
+80101060:	ff 75 e0             	push   -0x20(%ebp)
+80101063:	e8 28 09 00 00       	call   80101990 <iput>
+    end_op();
+80101068:	83 c4 10             	add    $0x10,%esp
+}
+8010106b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010106e:	5b                   	pop    %ebx
+8010106f:	5e                   	pop    %esi
+80101070:	5f                   	pop    %edi
+80101071:	5d                   	pop    %ebp
+    end_op();
+80101072:	e9 59 1e 00 00       	jmp    80102ed0 <end_op>
+80101077:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010107e:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101080:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101084:	83 ec 08             	sub    $0x8,%esp
+80101087:	53                   	push   %ebx
+80101088:	56                   	push   %esi
+80101089:	e8 92 25 00 00       	call   80103620 <pipeclose>
+8010108e:	83 c4 10             	add    $0x10,%esp
+}
+80101091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101094:	5b                   	pop    %ebx
+80101095:	5e                   	pop    %esi
+80101096:	5f                   	pop    %edi
+80101097:	5d                   	pop    %ebp
+80101098:	c3                   	ret
+    panic("fileclose");
+80101099:	83 ec 0c             	sub    $0xc,%esp
+8010109c:	68 e3 7f 10 80       	push   $0x80107fe3
+801010a1:	e8 da f2 ff ff       	call   80100380 <panic>
+801010a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801010ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801010b0 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+801010b0:	55                   	push   %ebp
+801010b1:	89 e5                	mov    %esp,%ebp
+801010b3:	53                   	push   %ebx
+801010b4:	83 ec 04             	sub    $0x4,%esp
+801010b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+801010ba:	83 3b 02             	cmpl   $0x2,(%ebx)
+801010bd:	75 31                	jne    801010f0 <filestat+0x40>
+    ilock(f->ip);
+801010bf:	83 ec 0c             	sub    $0xc,%esp
+801010c2:	ff 73 10             	push   0x10(%ebx)
+801010c5:	e8 96 07 00 00       	call   80101860 <ilock>
+    stati(f->ip, st);
+801010ca:	58                   	pop    %eax
+801010cb:	5a                   	pop    %edx
+801010cc:	ff 75 0c             	push   0xc(%ebp)
+801010cf:	ff 73 10             	push   0x10(%ebx)
+801010d2:	e8 69 0a 00 00       	call   80101b40 <stati>
+    iunlock(f->ip);
+801010d7:	59                   	pop    %ecx
+801010d8:	ff 73 10             	push   0x10(%ebx)
+801010db:	e8 60 08 00 00       	call   80101940 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+801010e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801010e3:	83 c4 10             	add    $0x10,%esp
+801010e6:	31 c0                	xor    %eax,%eax
+}
+801010e8:	c9                   	leave
+801010e9:	c3                   	ret
+801010ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801010f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+801010f3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801010f8:	c9                   	leave
+801010f9:	c3                   	ret
+801010fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101100 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101100:	55                   	push   %ebp
+80101101:	89 e5                	mov    %esp,%ebp
+80101103:	57                   	push   %edi
+80101104:	56                   	push   %esi
+80101105:	53                   	push   %ebx
+80101106:	83 ec 0c             	sub    $0xc,%esp
+80101109:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010110c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010110f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int r;
+
+  if(f->readable == 0)
+80101112:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101116:	74 60                	je     80101178 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+80101118:	8b 03                	mov    (%ebx),%eax
+8010111a:	83 f8 01             	cmp    $0x1,%eax
+8010111d:	74 41                	je     80101160 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010111f:	83 f8 02             	cmp    $0x2,%eax
+80101122:	75 5b                	jne    8010117f <fileread+0x7f>
+    ilock(f->ip);
+80101124:	83 ec 0c             	sub    $0xc,%esp
+80101127:	ff 73 10             	push   0x10(%ebx)
+8010112a:	e8 31 07 00 00       	call   80101860 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+8010112f:	57                   	push   %edi
+80101130:	ff 73 14             	push   0x14(%ebx)
+80101133:	56                   	push   %esi
+80101134:	ff 73 10             	push   0x10(%ebx)
+80101137:	e8 34 0a 00 00       	call   80101b70 <readi>
+8010113c:	83 c4 20             	add    $0x20,%esp
+8010113f:	89 c6                	mov    %eax,%esi
+80101141:	85 c0                	test   %eax,%eax
+80101143:	7e 03                	jle    80101148 <fileread+0x48>
+      f->off += r;
+80101145:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+80101148:	83 ec 0c             	sub    $0xc,%esp
+8010114b:	ff 73 10             	push   0x10(%ebx)
+8010114e:	e8 ed 07 00 00       	call   80101940 <iunlock>
+    return r;
+80101153:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80101156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101159:	89 f0                	mov    %esi,%eax
+8010115b:	5b                   	pop    %ebx
+8010115c:	5e                   	pop    %esi
+8010115d:	5f                   	pop    %edi
+8010115e:	5d                   	pop    %ebp
+8010115f:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80101160:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101163:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101169:	5b                   	pop    %ebx
+8010116a:	5e                   	pop    %esi
+8010116b:	5f                   	pop    %edi
+8010116c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010116d:	e9 6e 26 00 00       	jmp    801037e0 <piperead>
+80101172:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80101178:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010117d:	eb d7                	jmp    80101156 <fileread+0x56>
+  panic("fileread");
+8010117f:	83 ec 0c             	sub    $0xc,%esp
+80101182:	68 ed 7f 10 80       	push   $0x80107fed
+80101187:	e8 f4 f1 ff ff       	call   80100380 <panic>
+8010118c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101190 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101190:	55                   	push   %ebp
+80101191:	89 e5                	mov    %esp,%ebp
+80101193:	57                   	push   %edi
+80101194:	56                   	push   %esi
+80101195:	53                   	push   %ebx
+80101196:	83 ec 1c             	sub    $0x1c,%esp
+80101199:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010119c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010119f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801011a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+801011a5:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+801011a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+801011ac:	0f 84 bb 00 00 00    	je     8010126d <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+801011b2:	8b 03                	mov    (%ebx),%eax
+801011b4:	83 f8 01             	cmp    $0x1,%eax
+801011b7:	0f 84 bf 00 00 00    	je     8010127c <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801011bd:	83 f8 02             	cmp    $0x2,%eax
+801011c0:	0f 85 c8 00 00 00    	jne    8010128e <filewrite+0xfe>
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+    while(i < n){
+801011c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+801011c9:	31 f6                	xor    %esi,%esi
+    while(i < n){
+801011cb:	85 c0                	test   %eax,%eax
+801011cd:	7f 30                	jg     801011ff <filewrite+0x6f>
+801011cf:	e9 94 00 00 00       	jmp    80101268 <filewrite+0xd8>
+801011d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+801011d8:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+801011db:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+801011de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+801011e1:	ff 73 10             	push   0x10(%ebx)
+801011e4:	e8 57 07 00 00       	call   80101940 <iunlock>
+      end_op();
+801011e9:	e8 e2 1c 00 00       	call   80102ed0 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+801011ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801011f1:	83 c4 10             	add    $0x10,%esp
+801011f4:	39 c7                	cmp    %eax,%edi
+801011f6:	75 5c                	jne    80101254 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+801011f8:	01 fe                	add    %edi,%esi
+    while(i < n){
+801011fa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+801011fd:	7e 69                	jle    80101268 <filewrite+0xd8>
+      int n1 = n - i;
+801011ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101202:	b8 00 06 00 00       	mov    $0x600,%eax
+      int n1 = n - i;
+80101207:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101209:	39 c7                	cmp    %eax,%edi
+8010120b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+8010120e:	e8 4d 1c 00 00       	call   80102e60 <begin_op>
+      ilock(f->ip);
+80101213:	83 ec 0c             	sub    $0xc,%esp
+80101216:	ff 73 10             	push   0x10(%ebx)
+80101219:	e8 42 06 00 00       	call   80101860 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+8010121e:	57                   	push   %edi
+8010121f:	ff 73 14             	push   0x14(%ebx)
+80101222:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101225:	01 f0                	add    %esi,%eax
+80101227:	50                   	push   %eax
+80101228:	ff 73 10             	push   0x10(%ebx)
+8010122b:	e8 40 0a 00 00       	call   80101c70 <writei>
+80101230:	83 c4 20             	add    $0x20,%esp
+80101233:	85 c0                	test   %eax,%eax
+80101235:	7f a1                	jg     801011d8 <filewrite+0x48>
+80101237:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+8010123a:	83 ec 0c             	sub    $0xc,%esp
+8010123d:	ff 73 10             	push   0x10(%ebx)
+80101240:	e8 fb 06 00 00       	call   80101940 <iunlock>
+      end_op();
+80101245:	e8 86 1c 00 00       	call   80102ed0 <end_op>
+      if(r < 0)
+8010124a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010124d:	83 c4 10             	add    $0x10,%esp
+80101250:	85 c0                	test   %eax,%eax
+80101252:	75 14                	jne    80101268 <filewrite+0xd8>
+        panic("short filewrite");
+80101254:	83 ec 0c             	sub    $0xc,%esp
+80101257:	68 f6 7f 10 80       	push   $0x80107ff6
+8010125c:	e8 1f f1 ff ff       	call   80100380 <panic>
+80101261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+80101268:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+8010126b:	74 05                	je     80101272 <filewrite+0xe2>
+    return -1;
+8010126d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+80101272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101275:	89 f0                	mov    %esi,%eax
+80101277:	5b                   	pop    %ebx
+80101278:	5e                   	pop    %esi
+80101279:	5f                   	pop    %edi
+8010127a:	5d                   	pop    %ebp
+8010127b:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+8010127c:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010127f:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101285:	5b                   	pop    %ebx
+80101286:	5e                   	pop    %esi
+80101287:	5f                   	pop    %edi
+80101288:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+80101289:	e9 32 24 00 00       	jmp    801036c0 <pipewrite>
+  panic("filewrite");
+8010128e:	83 ec 0c             	sub    $0xc,%esp
+80101291:	68 fc 7f 10 80       	push   $0x80107ffc
+80101296:	e8 e5 f0 ff ff       	call   80100380 <panic>
+8010129b:	66 90                	xchg   %ax,%ax
+8010129d:	66 90                	xchg   %ax,%ax
+8010129f:	90                   	nop
+
+801012a0 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+801012a0:	55                   	push   %ebp
+801012a1:	89 e5                	mov    %esp,%ebp
+801012a3:	57                   	push   %edi
+801012a4:	56                   	push   %esi
+801012a5:	53                   	push   %ebx
+801012a6:	83 ec 1c             	sub    $0x1c,%esp
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+801012a9:	8b 0d b4 25 11 80    	mov    0x801125b4,%ecx
+{
+801012af:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+801012b2:	85 c9                	test   %ecx,%ecx
+801012b4:	0f 84 8c 00 00 00    	je     80101346 <balloc+0xa6>
+801012ba:	31 ff                	xor    %edi,%edi
+    bp = bread(dev, BBLOCK(b, sb));
+801012bc:	89 f8                	mov    %edi,%eax
+801012be:	83 ec 08             	sub    $0x8,%esp
+801012c1:	89 fe                	mov    %edi,%esi
+801012c3:	c1 f8 0c             	sar    $0xc,%eax
+801012c6:	03 05 cc 25 11 80    	add    0x801125cc,%eax
+801012cc:	50                   	push   %eax
+801012cd:	ff 75 dc             	push   -0x24(%ebp)
+801012d0:	e8 fb ed ff ff       	call   801000d0 <bread>
+801012d5:	89 7d d8             	mov    %edi,-0x28(%ebp)
+801012d8:	83 c4 10             	add    $0x10,%esp
+801012db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+801012de:	a1 b4 25 11 80       	mov    0x801125b4,%eax
+801012e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801012e6:	31 c0                	xor    %eax,%eax
+801012e8:	eb 32                	jmp    8010131c <balloc+0x7c>
+801012ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      m = 1 << (bi % 8);
+801012f0:	89 c1                	mov    %eax,%ecx
+801012f2:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801012f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      m = 1 << (bi % 8);
+801012fa:	83 e1 07             	and    $0x7,%ecx
+801012fd:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+801012ff:	89 c1                	mov    %eax,%ecx
+80101301:	c1 f9 03             	sar    $0x3,%ecx
+80101304:	0f b6 7c 0f 5c       	movzbl 0x5c(%edi,%ecx,1),%edi
+80101309:	89 fa                	mov    %edi,%edx
+8010130b:	85 df                	test   %ebx,%edi
+8010130d:	74 49                	je     80101358 <balloc+0xb8>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+8010130f:	83 c0 01             	add    $0x1,%eax
+80101312:	83 c6 01             	add    $0x1,%esi
+80101315:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010131a:	74 07                	je     80101323 <balloc+0x83>
+8010131c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010131f:	39 d6                	cmp    %edx,%esi
+80101321:	72 cd                	jb     801012f0 <balloc+0x50>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+80101323:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80101326:	83 ec 0c             	sub    $0xc,%esp
+80101329:	ff 75 e4             	push   -0x1c(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+8010132c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    brelse(bp);
+80101332:	e8 b9 ee ff ff       	call   801001f0 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80101337:	83 c4 10             	add    $0x10,%esp
+8010133a:	3b 3d b4 25 11 80    	cmp    0x801125b4,%edi
+80101340:	0f 82 76 ff ff ff    	jb     801012bc <balloc+0x1c>
+  }
+  panic("balloc: out of blocks");
+80101346:	83 ec 0c             	sub    $0xc,%esp
+80101349:	68 06 80 10 80       	push   $0x80108006
+8010134e:	e8 2d f0 ff ff       	call   80100380 <panic>
+80101353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101357:	90                   	nop
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101358:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        log_write(bp);
+8010135b:	83 ec 0c             	sub    $0xc,%esp
+        bp->data[bi/8] |= m;  // Mark block in use.
+8010135e:	09 da                	or     %ebx,%edx
+80101360:	88 54 0f 5c          	mov    %dl,0x5c(%edi,%ecx,1)
+        log_write(bp);
+80101364:	57                   	push   %edi
+80101365:	e8 d6 1c 00 00       	call   80103040 <log_write>
+        brelse(bp);
+8010136a:	89 3c 24             	mov    %edi,(%esp)
+8010136d:	e8 7e ee ff ff       	call   801001f0 <brelse>
+  bp = bread(dev, bno);
+80101372:	58                   	pop    %eax
+80101373:	5a                   	pop    %edx
+80101374:	56                   	push   %esi
+80101375:	ff 75 dc             	push   -0x24(%ebp)
+80101378:	e8 53 ed ff ff       	call   801000d0 <bread>
+  memset(bp->data, 0, BSIZE);
+8010137d:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, bno);
+80101380:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80101382:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101385:	68 00 02 00 00       	push   $0x200
+8010138a:	6a 00                	push   $0x0
+8010138c:	50                   	push   %eax
+8010138d:	e8 2e 39 00 00       	call   80104cc0 <memset>
+  log_write(bp);
+80101392:	89 1c 24             	mov    %ebx,(%esp)
+80101395:	e8 a6 1c 00 00       	call   80103040 <log_write>
+  brelse(bp);
+8010139a:	89 1c 24             	mov    %ebx,(%esp)
+8010139d:	e8 4e ee ff ff       	call   801001f0 <brelse>
+}
+801013a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801013a5:	89 f0                	mov    %esi,%eax
+801013a7:	5b                   	pop    %ebx
+801013a8:	5e                   	pop    %esi
+801013a9:	5f                   	pop    %edi
+801013aa:	5d                   	pop    %ebp
+801013ab:	c3                   	ret
+801013ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801013b0 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+801013b0:	55                   	push   %ebp
+801013b1:	89 e5                	mov    %esp,%ebp
+801013b3:	57                   	push   %edi
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+
+  // Is the inode already cached?
+  empty = 0;
+801013b4:	31 ff                	xor    %edi,%edi
+{
+801013b6:	56                   	push   %esi
+801013b7:	89 c6                	mov    %eax,%esi
+801013b9:	53                   	push   %ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801013ba:	bb 94 09 11 80       	mov    $0x80110994,%ebx
+{
+801013bf:	83 ec 28             	sub    $0x28,%esp
+801013c2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+801013c5:	68 60 09 11 80       	push   $0x80110960
+801013ca:	e8 11 38 00 00       	call   80104be0 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801013cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquire(&icache.lock);
+801013d2:	83 c4 10             	add    $0x10,%esp
+801013d5:	eb 1b                	jmp    801013f2 <iget+0x42>
+801013d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801013de:	66 90                	xchg   %ax,%ax
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801013e0:	39 33                	cmp    %esi,(%ebx)
+801013e2:	74 6c                	je     80101450 <iget+0xa0>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801013e4:	81 c3 90 00 00 00    	add    $0x90,%ebx
+801013ea:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+801013f0:	74 26                	je     80101418 <iget+0x68>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801013f2:	8b 43 08             	mov    0x8(%ebx),%eax
+801013f5:	85 c0                	test   %eax,%eax
+801013f7:	7f e7                	jg     801013e0 <iget+0x30>
+      ip->ref++;
+      release(&icache.lock);
+      return ip;
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+801013f9:	85 ff                	test   %edi,%edi
+801013fb:	75 e7                	jne    801013e4 <iget+0x34>
+801013fd:	85 c0                	test   %eax,%eax
+801013ff:	75 76                	jne    80101477 <iget+0xc7>
+80101401:	89 df                	mov    %ebx,%edi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101403:	81 c3 90 00 00 00    	add    $0x90,%ebx
+80101409:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+8010140f:	75 e1                	jne    801013f2 <iget+0x42>
+80101411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      empty = ip;
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+80101418:	85 ff                	test   %edi,%edi
+8010141a:	74 79                	je     80101495 <iget+0xe5>
+  ip = empty;
+  ip->dev = dev;
+  ip->inum = inum;
+  ip->ref = 1;
+  ip->valid = 0;
+  release(&icache.lock);
+8010141c:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+8010141f:	89 37                	mov    %esi,(%edi)
+  ip->inum = inum;
+80101421:	89 57 04             	mov    %edx,0x4(%edi)
+  ip->ref = 1;
+80101424:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%edi)
+  ip->valid = 0;
+8010142b:	c7 47 4c 00 00 00 00 	movl   $0x0,0x4c(%edi)
+  release(&icache.lock);
+80101432:	68 60 09 11 80       	push   $0x80110960
+80101437:	e8 44 37 00 00       	call   80104b80 <release>
+
+  return ip;
+8010143c:	83 c4 10             	add    $0x10,%esp
+}
+8010143f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101442:	89 f8                	mov    %edi,%eax
+80101444:	5b                   	pop    %ebx
+80101445:	5e                   	pop    %esi
+80101446:	5f                   	pop    %edi
+80101447:	5d                   	pop    %ebp
+80101448:	c3                   	ret
+80101449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101450:	39 53 04             	cmp    %edx,0x4(%ebx)
+80101453:	75 8f                	jne    801013e4 <iget+0x34>
+      ip->ref++;
+80101455:	83 c0 01             	add    $0x1,%eax
+      release(&icache.lock);
+80101458:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+8010145b:	89 df                	mov    %ebx,%edi
+      ip->ref++;
+8010145d:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101460:	68 60 09 11 80       	push   $0x80110960
+80101465:	e8 16 37 00 00       	call   80104b80 <release>
+      return ip;
+8010146a:	83 c4 10             	add    $0x10,%esp
+}
+8010146d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101470:	89 f8                	mov    %edi,%eax
+80101472:	5b                   	pop    %ebx
+80101473:	5e                   	pop    %esi
+80101474:	5f                   	pop    %edi
+80101475:	5d                   	pop    %ebp
+80101476:	c3                   	ret
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101477:	81 c3 90 00 00 00    	add    $0x90,%ebx
+8010147d:	81 fb b4 25 11 80    	cmp    $0x801125b4,%ebx
+80101483:	74 10                	je     80101495 <iget+0xe5>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101485:	8b 43 08             	mov    0x8(%ebx),%eax
+80101488:	85 c0                	test   %eax,%eax
+8010148a:	0f 8f 50 ff ff ff    	jg     801013e0 <iget+0x30>
+80101490:	e9 68 ff ff ff       	jmp    801013fd <iget+0x4d>
+    panic("iget: no inodes");
+80101495:	83 ec 0c             	sub    $0xc,%esp
+80101498:	68 1c 80 10 80       	push   $0x8010801c
+8010149d:	e8 de ee ff ff       	call   80100380 <panic>
+801014a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801014b0 <bfree>:
+{
+801014b0:	55                   	push   %ebp
+801014b1:	89 c1                	mov    %eax,%ecx
+  bp = bread(dev, BBLOCK(b, sb));
+801014b3:	89 d0                	mov    %edx,%eax
+801014b5:	c1 e8 0c             	shr    $0xc,%eax
+{
+801014b8:	89 e5                	mov    %esp,%ebp
+801014ba:	56                   	push   %esi
+801014bb:	53                   	push   %ebx
+  bp = bread(dev, BBLOCK(b, sb));
+801014bc:	03 05 cc 25 11 80    	add    0x801125cc,%eax
+{
+801014c2:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+801014c4:	83 ec 08             	sub    $0x8,%esp
+801014c7:	50                   	push   %eax
+801014c8:	51                   	push   %ecx
+801014c9:	e8 02 ec ff ff       	call   801000d0 <bread>
+  m = 1 << (bi % 8);
+801014ce:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+801014d0:	c1 fb 03             	sar    $0x3,%ebx
+801014d3:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+801014d6:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+801014d8:	83 e1 07             	and    $0x7,%ecx
+801014db:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+801014e0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+801014e6:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+801014e8:	0f b6 4c 1e 5c       	movzbl 0x5c(%esi,%ebx,1),%ecx
+801014ed:	85 c1                	test   %eax,%ecx
+801014ef:	74 23                	je     80101514 <bfree+0x64>
+  bp->data[bi/8] &= ~m;
+801014f1:	f7 d0                	not    %eax
+  log_write(bp);
+801014f3:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+801014f6:	21 c8                	and    %ecx,%eax
+801014f8:	88 44 1e 5c          	mov    %al,0x5c(%esi,%ebx,1)
+  log_write(bp);
+801014fc:	56                   	push   %esi
+801014fd:	e8 3e 1b 00 00       	call   80103040 <log_write>
+  brelse(bp);
+80101502:	89 34 24             	mov    %esi,(%esp)
+80101505:	e8 e6 ec ff ff       	call   801001f0 <brelse>
+}
+8010150a:	83 c4 10             	add    $0x10,%esp
+8010150d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101510:	5b                   	pop    %ebx
+80101511:	5e                   	pop    %esi
+80101512:	5d                   	pop    %ebp
+80101513:	c3                   	ret
+    panic("freeing free block");
+80101514:	83 ec 0c             	sub    $0xc,%esp
+80101517:	68 2c 80 10 80       	push   $0x8010802c
+8010151c:	e8 5f ee ff ff       	call   80100380 <panic>
+80101521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010152f:	90                   	nop
+
+80101530 <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+80101530:	55                   	push   %ebp
+80101531:	89 e5                	mov    %esp,%ebp
+80101533:	57                   	push   %edi
+80101534:	56                   	push   %esi
+80101535:	89 c6                	mov    %eax,%esi
+80101537:	53                   	push   %ebx
+80101538:	83 ec 1c             	sub    $0x1c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+8010153b:	83 fa 0b             	cmp    $0xb,%edx
+8010153e:	0f 86 8c 00 00 00    	jbe    801015d0 <bmap+0xa0>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+80101544:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+  if(bn < NINDIRECT){
+80101547:	83 fb 7f             	cmp    $0x7f,%ebx
+8010154a:	0f 87 a2 00 00 00    	ja     801015f2 <bmap+0xc2>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101550:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80101556:	85 c0                	test   %eax,%eax
+80101558:	74 5e                	je     801015b8 <bmap+0x88>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+8010155a:	83 ec 08             	sub    $0x8,%esp
+8010155d:	50                   	push   %eax
+8010155e:	ff 36                	push   (%esi)
+80101560:	e8 6b eb ff ff       	call   801000d0 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+80101565:	83 c4 10             	add    $0x10,%esp
+80101568:	8d 5c 98 5c          	lea    0x5c(%eax,%ebx,4),%ebx
+    bp = bread(ip->dev, addr);
+8010156c:	89 c2                	mov    %eax,%edx
+    if((addr = a[bn]) == 0){
+8010156e:	8b 3b                	mov    (%ebx),%edi
+80101570:	85 ff                	test   %edi,%edi
+80101572:	74 1c                	je     80101590 <bmap+0x60>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+80101574:	83 ec 0c             	sub    $0xc,%esp
+80101577:	52                   	push   %edx
+80101578:	e8 73 ec ff ff       	call   801001f0 <brelse>
+8010157d:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+80101580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101583:	89 f8                	mov    %edi,%eax
+80101585:	5b                   	pop    %ebx
+80101586:	5e                   	pop    %esi
+80101587:	5f                   	pop    %edi
+80101588:	5d                   	pop    %ebp
+80101589:	c3                   	ret
+8010158a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101590:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      a[bn] = addr = balloc(ip->dev);
+80101593:	8b 06                	mov    (%esi),%eax
+80101595:	e8 06 fd ff ff       	call   801012a0 <balloc>
+      log_write(bp);
+8010159a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010159d:	83 ec 0c             	sub    $0xc,%esp
+      a[bn] = addr = balloc(ip->dev);
+801015a0:	89 03                	mov    %eax,(%ebx)
+801015a2:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+801015a4:	52                   	push   %edx
+801015a5:	e8 96 1a 00 00       	call   80103040 <log_write>
+801015aa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801015ad:	83 c4 10             	add    $0x10,%esp
+801015b0:	eb c2                	jmp    80101574 <bmap+0x44>
+801015b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+801015b8:	8b 06                	mov    (%esi),%eax
+801015ba:	e8 e1 fc ff ff       	call   801012a0 <balloc>
+801015bf:	89 86 8c 00 00 00    	mov    %eax,0x8c(%esi)
+801015c5:	eb 93                	jmp    8010155a <bmap+0x2a>
+801015c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801015ce:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+801015d0:	8d 5a 14             	lea    0x14(%edx),%ebx
+801015d3:	8b 7c 98 0c          	mov    0xc(%eax,%ebx,4),%edi
+801015d7:	85 ff                	test   %edi,%edi
+801015d9:	75 a5                	jne    80101580 <bmap+0x50>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+801015db:	8b 00                	mov    (%eax),%eax
+801015dd:	e8 be fc ff ff       	call   801012a0 <balloc>
+801015e2:	89 44 9e 0c          	mov    %eax,0xc(%esi,%ebx,4)
+801015e6:	89 c7                	mov    %eax,%edi
+}
+801015e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015eb:	5b                   	pop    %ebx
+801015ec:	89 f8                	mov    %edi,%eax
+801015ee:	5e                   	pop    %esi
+801015ef:	5f                   	pop    %edi
+801015f0:	5d                   	pop    %ebp
+801015f1:	c3                   	ret
+  panic("bmap: out of range");
+801015f2:	83 ec 0c             	sub    $0xc,%esp
+801015f5:	68 3f 80 10 80       	push   $0x8010803f
+801015fa:	e8 81 ed ff ff       	call   80100380 <panic>
+801015ff:	90                   	nop
+
+80101600 <readsb>:
+{
+80101600:	55                   	push   %ebp
+80101601:	89 e5                	mov    %esp,%ebp
+80101603:	56                   	push   %esi
+80101604:	53                   	push   %ebx
+80101605:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80101608:	83 ec 08             	sub    $0x8,%esp
+8010160b:	6a 01                	push   $0x1
+8010160d:	ff 75 08             	push   0x8(%ebp)
+80101610:	e8 bb ea ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101615:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80101618:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010161a:	8d 40 5c             	lea    0x5c(%eax),%eax
+8010161d:	6a 1c                	push   $0x1c
+8010161f:	50                   	push   %eax
+80101620:	56                   	push   %esi
+80101621:	e8 2a 37 00 00       	call   80104d50 <memmove>
+  brelse(bp);
+80101626:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101629:	83 c4 10             	add    $0x10,%esp
+}
+8010162c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010162f:	5b                   	pop    %ebx
+80101630:	5e                   	pop    %esi
+80101631:	5d                   	pop    %ebp
+  brelse(bp);
+80101632:	e9 b9 eb ff ff       	jmp    801001f0 <brelse>
+80101637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010163e:	66 90                	xchg   %ax,%ax
+
+80101640 <iinit>:
+{
+80101640:	55                   	push   %ebp
+80101641:	89 e5                	mov    %esp,%ebp
+80101643:	53                   	push   %ebx
+80101644:	bb a0 09 11 80       	mov    $0x801109a0,%ebx
+80101649:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+8010164c:	68 52 80 10 80       	push   $0x80108052
+80101651:	68 60 09 11 80       	push   $0x80110960
+80101656:	e8 a5 33 00 00       	call   80104a00 <initlock>
+  for(i = 0; i < NINODE; i++) {
+8010165b:	83 c4 10             	add    $0x10,%esp
+8010165e:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101660:	83 ec 08             	sub    $0x8,%esp
+80101663:	68 59 80 10 80       	push   $0x80108059
+80101668:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+80101669:	81 c3 90 00 00 00    	add    $0x90,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+8010166f:	e8 5c 32 00 00       	call   801048d0 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+80101674:	83 c4 10             	add    $0x10,%esp
+80101677:	81 fb c0 25 11 80    	cmp    $0x801125c0,%ebx
+8010167d:	75 e1                	jne    80101660 <iinit+0x20>
+  bp = bread(dev, 1);
+8010167f:	83 ec 08             	sub    $0x8,%esp
+80101682:	6a 01                	push   $0x1
+80101684:	ff 75 08             	push   0x8(%ebp)
+80101687:	e8 44 ea ff ff       	call   801000d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+8010168c:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+8010168f:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101691:	8d 40 5c             	lea    0x5c(%eax),%eax
+80101694:	6a 1c                	push   $0x1c
+80101696:	50                   	push   %eax
+80101697:	68 b4 25 11 80       	push   $0x801125b4
+8010169c:	e8 af 36 00 00       	call   80104d50 <memmove>
+  brelse(bp);
+801016a1:	89 1c 24             	mov    %ebx,(%esp)
+801016a4:	e8 47 eb ff ff       	call   801001f0 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+801016a9:	ff 35 cc 25 11 80    	push   0x801125cc
+801016af:	ff 35 c8 25 11 80    	push   0x801125c8
+801016b5:	ff 35 c4 25 11 80    	push   0x801125c4
+801016bb:	ff 35 c0 25 11 80    	push   0x801125c0
+801016c1:	ff 35 bc 25 11 80    	push   0x801125bc
+801016c7:	ff 35 b8 25 11 80    	push   0x801125b8
+801016cd:	ff 35 b4 25 11 80    	push   0x801125b4
+801016d3:	68 bc 80 10 80       	push   $0x801080bc
+801016d8:	e8 d3 ef ff ff       	call   801006b0 <cprintf>
+}
+801016dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801016e0:	83 c4 30             	add    $0x30,%esp
+801016e3:	c9                   	leave
+801016e4:	c3                   	ret
+801016e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801016ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801016f0 <ialloc>:
+{
+801016f0:	55                   	push   %ebp
+801016f1:	89 e5                	mov    %esp,%ebp
+801016f3:	57                   	push   %edi
+801016f4:	56                   	push   %esi
+801016f5:	53                   	push   %ebx
+801016f6:	83 ec 1c             	sub    $0x1c,%esp
+801016f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+801016fc:	83 3d bc 25 11 80 01 	cmpl   $0x1,0x801125bc
+{
+80101703:	8b 75 08             	mov    0x8(%ebp),%esi
+80101706:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101709:	0f 86 91 00 00 00    	jbe    801017a0 <ialloc+0xb0>
+8010170f:	bf 01 00 00 00       	mov    $0x1,%edi
+80101714:	eb 21                	jmp    80101737 <ialloc+0x47>
+80101716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010171d:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80101720:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101723:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80101726:	53                   	push   %ebx
+80101727:	e8 c4 ea ff ff       	call   801001f0 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010172c:	83 c4 10             	add    $0x10,%esp
+8010172f:	3b 3d bc 25 11 80    	cmp    0x801125bc,%edi
+80101735:	73 69                	jae    801017a0 <ialloc+0xb0>
+    bp = bread(dev, IBLOCK(inum, sb));
+80101737:	89 f8                	mov    %edi,%eax
+80101739:	83 ec 08             	sub    $0x8,%esp
+8010173c:	c1 e8 03             	shr    $0x3,%eax
+8010173f:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+80101745:	50                   	push   %eax
+80101746:	56                   	push   %esi
+80101747:	e8 84 e9 ff ff       	call   801000d0 <bread>
+    if(dip->type == 0){  // a free inode
+8010174c:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+8010174f:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101751:	89 f8                	mov    %edi,%eax
+80101753:	83 e0 07             	and    $0x7,%eax
+80101756:	c1 e0 06             	shl    $0x6,%eax
+80101759:	8d 4c 03 5c          	lea    0x5c(%ebx,%eax,1),%ecx
+    if(dip->type == 0){  // a free inode
+8010175d:	66 83 39 00          	cmpw   $0x0,(%ecx)
+80101761:	75 bd                	jne    80101720 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+80101763:	83 ec 04             	sub    $0x4,%esp
+80101766:	6a 40                	push   $0x40
+80101768:	6a 00                	push   $0x0
+8010176a:	51                   	push   %ecx
+8010176b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010176e:	e8 4d 35 00 00       	call   80104cc0 <memset>
+      dip->type = type;
+80101773:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80101777:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010177a:	66 89 01             	mov    %ax,(%ecx)
+      log_write(bp);   // mark it allocated on the disk
+8010177d:	89 1c 24             	mov    %ebx,(%esp)
+80101780:	e8 bb 18 00 00       	call   80103040 <log_write>
+      brelse(bp);
+80101785:	89 1c 24             	mov    %ebx,(%esp)
+80101788:	e8 63 ea ff ff       	call   801001f0 <brelse>
+      return iget(dev, inum);
+8010178d:	83 c4 10             	add    $0x10,%esp
+}
+80101790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80101793:	89 fa                	mov    %edi,%edx
+}
+80101795:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80101796:	89 f0                	mov    %esi,%eax
+}
+80101798:	5e                   	pop    %esi
+80101799:	5f                   	pop    %edi
+8010179a:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010179b:	e9 10 fc ff ff       	jmp    801013b0 <iget>
+  panic("ialloc: no inodes");
+801017a0:	83 ec 0c             	sub    $0xc,%esp
+801017a3:	68 5f 80 10 80       	push   $0x8010805f
+801017a8:	e8 d3 eb ff ff       	call   80100380 <panic>
+801017ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801017b0 <iupdate>:
+{
+801017b0:	55                   	push   %ebp
+801017b1:	89 e5                	mov    %esp,%ebp
+801017b3:	56                   	push   %esi
+801017b4:	53                   	push   %ebx
+801017b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801017b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801017bb:	83 c3 5c             	add    $0x5c,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801017be:	83 ec 08             	sub    $0x8,%esp
+801017c1:	c1 e8 03             	shr    $0x3,%eax
+801017c4:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+801017ca:	50                   	push   %eax
+801017cb:	ff 73 a4             	push   -0x5c(%ebx)
+801017ce:	e8 fd e8 ff ff       	call   801000d0 <bread>
+  dip->type = ip->type;
+801017d3:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801017d7:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801017da:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+801017dc:	8b 43 a8             	mov    -0x58(%ebx),%eax
+801017df:	83 e0 07             	and    $0x7,%eax
+801017e2:	c1 e0 06             	shl    $0x6,%eax
+801017e5:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+  dip->type = ip->type;
+801017e9:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+801017ec:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801017f0:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+801017f3:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+801017f7:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+801017fb:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+801017ff:	0f b7 53 fa          	movzwl -0x6(%ebx),%edx
+80101803:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80101807:	8b 53 fc             	mov    -0x4(%ebx),%edx
+8010180a:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010180d:	6a 34                	push   $0x34
+8010180f:	53                   	push   %ebx
+80101810:	50                   	push   %eax
+80101811:	e8 3a 35 00 00       	call   80104d50 <memmove>
+  log_write(bp);
+80101816:	89 34 24             	mov    %esi,(%esp)
+80101819:	e8 22 18 00 00       	call   80103040 <log_write>
+  brelse(bp);
+8010181e:	89 75 08             	mov    %esi,0x8(%ebp)
+80101821:	83 c4 10             	add    $0x10,%esp
+}
+80101824:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101827:	5b                   	pop    %ebx
+80101828:	5e                   	pop    %esi
+80101829:	5d                   	pop    %ebp
+  brelse(bp);
+8010182a:	e9 c1 e9 ff ff       	jmp    801001f0 <brelse>
+8010182f:	90                   	nop
+
+80101830 <idup>:
+{
+80101830:	55                   	push   %ebp
+80101831:	89 e5                	mov    %esp,%ebp
+80101833:	53                   	push   %ebx
+80101834:	83 ec 10             	sub    $0x10,%esp
+80101837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010183a:	68 60 09 11 80       	push   $0x80110960
+8010183f:	e8 9c 33 00 00       	call   80104be0 <acquire>
+  ip->ref++;
+80101844:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80101848:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+8010184f:	e8 2c 33 00 00       	call   80104b80 <release>
+}
+80101854:	89 d8                	mov    %ebx,%eax
+80101856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101859:	c9                   	leave
+8010185a:	c3                   	ret
+8010185b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010185f:	90                   	nop
+
+80101860 <ilock>:
+{
+80101860:	55                   	push   %ebp
+80101861:	89 e5                	mov    %esp,%ebp
+80101863:	56                   	push   %esi
+80101864:	53                   	push   %ebx
+80101865:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80101868:	85 db                	test   %ebx,%ebx
+8010186a:	0f 84 b7 00 00 00    	je     80101927 <ilock+0xc7>
+80101870:	8b 53 08             	mov    0x8(%ebx),%edx
+80101873:	85 d2                	test   %edx,%edx
+80101875:	0f 8e ac 00 00 00    	jle    80101927 <ilock+0xc7>
+  acquiresleep(&ip->lock);
+8010187b:	83 ec 0c             	sub    $0xc,%esp
+8010187e:	8d 43 0c             	lea    0xc(%ebx),%eax
+80101881:	50                   	push   %eax
+80101882:	e8 89 30 00 00       	call   80104910 <acquiresleep>
+  if(ip->valid == 0){
+80101887:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010188a:	83 c4 10             	add    $0x10,%esp
+8010188d:	85 c0                	test   %eax,%eax
+8010188f:	74 0f                	je     801018a0 <ilock+0x40>
+}
+80101891:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101894:	5b                   	pop    %ebx
+80101895:	5e                   	pop    %esi
+80101896:	5d                   	pop    %ebp
+80101897:	c3                   	ret
+80101898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010189f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801018a0:	8b 43 04             	mov    0x4(%ebx),%eax
+801018a3:	83 ec 08             	sub    $0x8,%esp
+801018a6:	c1 e8 03             	shr    $0x3,%eax
+801018a9:	03 05 c8 25 11 80    	add    0x801125c8,%eax
+801018af:	50                   	push   %eax
+801018b0:	ff 33                	push   (%ebx)
+801018b2:	e8 19 e8 ff ff       	call   801000d0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801018b7:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801018ba:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801018bc:	8b 43 04             	mov    0x4(%ebx),%eax
+801018bf:	83 e0 07             	and    $0x7,%eax
+801018c2:	c1 e0 06             	shl    $0x6,%eax
+801018c5:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    ip->type = dip->type;
+801018c9:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801018cc:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+801018cf:	66 89 53 50          	mov    %dx,0x50(%ebx)
+    ip->major = dip->major;
+801018d3:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+801018d7:	66 89 53 52          	mov    %dx,0x52(%ebx)
+    ip->minor = dip->minor;
+801018db:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+801018df:	66 89 53 54          	mov    %dx,0x54(%ebx)
+    ip->nlink = dip->nlink;
+801018e3:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+801018e7:	66 89 53 56          	mov    %dx,0x56(%ebx)
+    ip->size = dip->size;
+801018eb:	8b 50 fc             	mov    -0x4(%eax),%edx
+801018ee:	89 53 58             	mov    %edx,0x58(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801018f1:	6a 34                	push   $0x34
+801018f3:	50                   	push   %eax
+801018f4:	8d 43 5c             	lea    0x5c(%ebx),%eax
+801018f7:	50                   	push   %eax
+801018f8:	e8 53 34 00 00       	call   80104d50 <memmove>
+    brelse(bp);
+801018fd:	89 34 24             	mov    %esi,(%esp)
+80101900:	e8 eb e8 ff ff       	call   801001f0 <brelse>
+    if(ip->type == 0)
+80101905:	83 c4 10             	add    $0x10,%esp
+80101908:	66 83 7b 50 00       	cmpw   $0x0,0x50(%ebx)
+    ip->valid = 1;
+8010190d:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+80101914:	0f 85 77 ff ff ff    	jne    80101891 <ilock+0x31>
+      panic("ilock: no type");
+8010191a:	83 ec 0c             	sub    $0xc,%esp
+8010191d:	68 77 80 10 80       	push   $0x80108077
+80101922:	e8 59 ea ff ff       	call   80100380 <panic>
+    panic("ilock");
+80101927:	83 ec 0c             	sub    $0xc,%esp
+8010192a:	68 71 80 10 80       	push   $0x80108071
+8010192f:	e8 4c ea ff ff       	call   80100380 <panic>
+80101934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010193b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010193f:	90                   	nop
+
+80101940 <iunlock>:
+{
+80101940:	55                   	push   %ebp
+80101941:	89 e5                	mov    %esp,%ebp
+80101943:	56                   	push   %esi
+80101944:	53                   	push   %ebx
+80101945:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101948:	85 db                	test   %ebx,%ebx
+8010194a:	74 28                	je     80101974 <iunlock+0x34>
+8010194c:	83 ec 0c             	sub    $0xc,%esp
+8010194f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101952:	56                   	push   %esi
+80101953:	e8 58 30 00 00       	call   801049b0 <holdingsleep>
+80101958:	83 c4 10             	add    $0x10,%esp
+8010195b:	85 c0                	test   %eax,%eax
+8010195d:	74 15                	je     80101974 <iunlock+0x34>
+8010195f:	8b 43 08             	mov    0x8(%ebx),%eax
+80101962:	85 c0                	test   %eax,%eax
+80101964:	7e 0e                	jle    80101974 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80101966:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80101969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010196c:	5b                   	pop    %ebx
+8010196d:	5e                   	pop    %esi
+8010196e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+8010196f:	e9 fc 2f 00 00       	jmp    80104970 <releasesleep>
+    panic("iunlock");
+80101974:	83 ec 0c             	sub    $0xc,%esp
+80101977:	68 86 80 10 80       	push   $0x80108086
+8010197c:	e8 ff e9 ff ff       	call   80100380 <panic>
+80101981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010198f:	90                   	nop
+
+80101990 <iput>:
+{
+80101990:	55                   	push   %ebp
+80101991:	89 e5                	mov    %esp,%ebp
+80101993:	57                   	push   %edi
+80101994:	56                   	push   %esi
+80101995:	53                   	push   %ebx
+80101996:	83 ec 28             	sub    $0x28,%esp
+80101999:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010199c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+8010199f:	57                   	push   %edi
+801019a0:	e8 6b 2f 00 00       	call   80104910 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+801019a5:	8b 53 4c             	mov    0x4c(%ebx),%edx
+801019a8:	83 c4 10             	add    $0x10,%esp
+801019ab:	85 d2                	test   %edx,%edx
+801019ad:	74 07                	je     801019b6 <iput+0x26>
+801019af:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+801019b4:	74 32                	je     801019e8 <iput+0x58>
+  releasesleep(&ip->lock);
+801019b6:	83 ec 0c             	sub    $0xc,%esp
+801019b9:	57                   	push   %edi
+801019ba:	e8 b1 2f 00 00       	call   80104970 <releasesleep>
+  acquire(&icache.lock);
+801019bf:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+801019c6:	e8 15 32 00 00       	call   80104be0 <acquire>
+  ip->ref--;
+801019cb:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+801019cf:	83 c4 10             	add    $0x10,%esp
+801019d2:	c7 45 08 60 09 11 80 	movl   $0x80110960,0x8(%ebp)
+}
+801019d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019dc:	5b                   	pop    %ebx
+801019dd:	5e                   	pop    %esi
+801019de:	5f                   	pop    %edi
+801019df:	5d                   	pop    %ebp
+  release(&icache.lock);
+801019e0:	e9 9b 31 00 00       	jmp    80104b80 <release>
+801019e5:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&icache.lock);
+801019e8:	83 ec 0c             	sub    $0xc,%esp
+801019eb:	68 60 09 11 80       	push   $0x80110960
+801019f0:	e8 eb 31 00 00       	call   80104be0 <acquire>
+    int r = ip->ref;
+801019f5:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+801019f8:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+801019ff:	e8 7c 31 00 00       	call   80104b80 <release>
+    if(r == 1){
+80101a04:	83 c4 10             	add    $0x10,%esp
+80101a07:	83 fe 01             	cmp    $0x1,%esi
+80101a0a:	75 aa                	jne    801019b6 <iput+0x26>
+80101a0c:	8d 8b 8c 00 00 00    	lea    0x8c(%ebx),%ecx
+80101a12:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101a15:	8d 73 5c             	lea    0x5c(%ebx),%esi
+80101a18:	89 df                	mov    %ebx,%edi
+80101a1a:	89 cb                	mov    %ecx,%ebx
+80101a1c:	eb 09                	jmp    80101a27 <iput+0x97>
+80101a1e:	66 90                	xchg   %ax,%ax
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  for(i = 0; i < NDIRECT; i++){
+80101a20:	83 c6 04             	add    $0x4,%esi
+80101a23:	39 de                	cmp    %ebx,%esi
+80101a25:	74 19                	je     80101a40 <iput+0xb0>
+    if(ip->addrs[i]){
+80101a27:	8b 16                	mov    (%esi),%edx
+80101a29:	85 d2                	test   %edx,%edx
+80101a2b:	74 f3                	je     80101a20 <iput+0x90>
+      bfree(ip->dev, ip->addrs[i]);
+80101a2d:	8b 07                	mov    (%edi),%eax
+80101a2f:	e8 7c fa ff ff       	call   801014b0 <bfree>
+      ip->addrs[i] = 0;
+80101a34:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80101a3a:	eb e4                	jmp    80101a20 <iput+0x90>
+80101a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+80101a40:	89 fb                	mov    %edi,%ebx
+80101a42:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101a45:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80101a4b:	85 c0                	test   %eax,%eax
+80101a4d:	75 2d                	jne    80101a7c <iput+0xec>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+  iupdate(ip);
+80101a4f:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80101a52:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  iupdate(ip);
+80101a59:	53                   	push   %ebx
+80101a5a:	e8 51 fd ff ff       	call   801017b0 <iupdate>
+      ip->type = 0;
+80101a5f:	31 c0                	xor    %eax,%eax
+80101a61:	66 89 43 50          	mov    %ax,0x50(%ebx)
+      iupdate(ip);
+80101a65:	89 1c 24             	mov    %ebx,(%esp)
+80101a68:	e8 43 fd ff ff       	call   801017b0 <iupdate>
+      ip->valid = 0;
+80101a6d:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+80101a74:	83 c4 10             	add    $0x10,%esp
+80101a77:	e9 3a ff ff ff       	jmp    801019b6 <iput+0x26>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80101a7c:	83 ec 08             	sub    $0x8,%esp
+80101a7f:	50                   	push   %eax
+80101a80:	ff 33                	push   (%ebx)
+80101a82:	e8 49 e6 ff ff       	call   801000d0 <bread>
+    for(j = 0; j < NINDIRECT; j++){
+80101a87:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101a8a:	83 c4 10             	add    $0x10,%esp
+80101a8d:	8d 88 5c 02 00 00    	lea    0x25c(%eax),%ecx
+80101a93:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101a96:	8d 70 5c             	lea    0x5c(%eax),%esi
+80101a99:	89 cf                	mov    %ecx,%edi
+80101a9b:	eb 0a                	jmp    80101aa7 <iput+0x117>
+80101a9d:	8d 76 00             	lea    0x0(%esi),%esi
+80101aa0:	83 c6 04             	add    $0x4,%esi
+80101aa3:	39 fe                	cmp    %edi,%esi
+80101aa5:	74 0f                	je     80101ab6 <iput+0x126>
+      if(a[j])
+80101aa7:	8b 16                	mov    (%esi),%edx
+80101aa9:	85 d2                	test   %edx,%edx
+80101aab:	74 f3                	je     80101aa0 <iput+0x110>
+        bfree(ip->dev, a[j]);
+80101aad:	8b 03                	mov    (%ebx),%eax
+80101aaf:	e8 fc f9 ff ff       	call   801014b0 <bfree>
+80101ab4:	eb ea                	jmp    80101aa0 <iput+0x110>
+    brelse(bp);
+80101ab6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101ab9:	83 ec 0c             	sub    $0xc,%esp
+80101abc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101abf:	50                   	push   %eax
+80101ac0:	e8 2b e7 ff ff       	call   801001f0 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80101ac5:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80101acb:	8b 03                	mov    (%ebx),%eax
+80101acd:	e8 de f9 ff ff       	call   801014b0 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80101ad2:	83 c4 10             	add    $0x10,%esp
+80101ad5:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80101adc:	00 00 00 
+80101adf:	e9 6b ff ff ff       	jmp    80101a4f <iput+0xbf>
+80101ae4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101aef:	90                   	nop
+
+80101af0 <iunlockput>:
+{
+80101af0:	55                   	push   %ebp
+80101af1:	89 e5                	mov    %esp,%ebp
+80101af3:	56                   	push   %esi
+80101af4:	53                   	push   %ebx
+80101af5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101af8:	85 db                	test   %ebx,%ebx
+80101afa:	74 34                	je     80101b30 <iunlockput+0x40>
+80101afc:	83 ec 0c             	sub    $0xc,%esp
+80101aff:	8d 73 0c             	lea    0xc(%ebx),%esi
+80101b02:	56                   	push   %esi
+80101b03:	e8 a8 2e 00 00       	call   801049b0 <holdingsleep>
+80101b08:	83 c4 10             	add    $0x10,%esp
+80101b0b:	85 c0                	test   %eax,%eax
+80101b0d:	74 21                	je     80101b30 <iunlockput+0x40>
+80101b0f:	8b 43 08             	mov    0x8(%ebx),%eax
+80101b12:	85 c0                	test   %eax,%eax
+80101b14:	7e 1a                	jle    80101b30 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80101b16:	83 ec 0c             	sub    $0xc,%esp
+80101b19:	56                   	push   %esi
+80101b1a:	e8 51 2e 00 00       	call   80104970 <releasesleep>
+  iput(ip);
+80101b1f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101b22:	83 c4 10             	add    $0x10,%esp
+}
+80101b25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101b28:	5b                   	pop    %ebx
+80101b29:	5e                   	pop    %esi
+80101b2a:	5d                   	pop    %ebp
+  iput(ip);
+80101b2b:	e9 60 fe ff ff       	jmp    80101990 <iput>
+    panic("iunlock");
+80101b30:	83 ec 0c             	sub    $0xc,%esp
+80101b33:	68 86 80 10 80       	push   $0x80108086
+80101b38:	e8 43 e8 ff ff       	call   80100380 <panic>
+80101b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101b40 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80101b40:	55                   	push   %ebp
+80101b41:	89 e5                	mov    %esp,%ebp
+80101b43:	8b 55 08             	mov    0x8(%ebp),%edx
+80101b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80101b49:	8b 0a                	mov    (%edx),%ecx
+80101b4b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80101b4e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80101b51:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80101b54:	0f b7 4a 50          	movzwl 0x50(%edx),%ecx
+80101b58:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80101b5b:	0f b7 4a 56          	movzwl 0x56(%edx),%ecx
+80101b5f:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80101b63:	8b 52 58             	mov    0x58(%edx),%edx
+80101b66:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80101b69:	5d                   	pop    %ebp
+80101b6a:	c3                   	ret
+80101b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101b6f:	90                   	nop
+
+80101b70 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80101b70:	55                   	push   %ebp
+80101b71:	89 e5                	mov    %esp,%ebp
+80101b73:	57                   	push   %edi
+80101b74:	56                   	push   %esi
+80101b75:	53                   	push   %ebx
+80101b76:	83 ec 1c             	sub    $0x1c,%esp
+80101b79:	8b 75 08             	mov    0x8(%ebp),%esi
+80101b7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101b7f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101b82:	66 83 7e 50 03       	cmpw   $0x3,0x50(%esi)
+{
+80101b87:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101b8a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80101b8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80101b90:	0f 84 aa 00 00 00    	je     80101c40 <readi+0xd0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101b96:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80101b99:	8b 56 58             	mov    0x58(%esi),%edx
+80101b9c:	39 fa                	cmp    %edi,%edx
+80101b9e:	0f 82 bd 00 00 00    	jb     80101c61 <readi+0xf1>
+80101ba4:	89 f9                	mov    %edi,%ecx
+80101ba6:	31 db                	xor    %ebx,%ebx
+80101ba8:	01 c1                	add    %eax,%ecx
+80101baa:	0f 92 c3             	setb   %bl
+80101bad:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101bb0:	0f 82 ab 00 00 00    	jb     80101c61 <readi+0xf1>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+80101bb6:	89 d3                	mov    %edx,%ebx
+80101bb8:	29 fb                	sub    %edi,%ebx
+80101bba:	39 ca                	cmp    %ecx,%edx
+80101bbc:	0f 42 c3             	cmovb  %ebx,%eax
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101bbf:	85 c0                	test   %eax,%eax
+80101bc1:	74 73                	je     80101c36 <readi+0xc6>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101bc3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80101bc6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101bd0:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80101bd3:	89 fa                	mov    %edi,%edx
+80101bd5:	c1 ea 09             	shr    $0x9,%edx
+80101bd8:	89 d8                	mov    %ebx,%eax
+80101bda:	e8 51 f9 ff ff       	call   80101530 <bmap>
+80101bdf:	83 ec 08             	sub    $0x8,%esp
+80101be2:	50                   	push   %eax
+80101be3:	ff 33                	push   (%ebx)
+80101be5:	e8 e6 e4 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101bea:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101bed:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101bf2:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101bf4:	89 f8                	mov    %edi,%eax
+80101bf6:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101bfb:	29 f3                	sub    %esi,%ebx
+80101bfd:	29 c1                	sub    %eax,%ecx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101bff:	8d 44 02 5c          	lea    0x5c(%edx,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101c03:	39 d9                	cmp    %ebx,%ecx
+80101c05:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80101c08:	83 c4 0c             	add    $0xc,%esp
+80101c0b:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101c0c:	01 de                	add    %ebx,%esi
+80101c0e:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+80101c10:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101c13:	50                   	push   %eax
+80101c14:	ff 75 e0             	push   -0x20(%ebp)
+80101c17:	e8 34 31 00 00       	call   80104d50 <memmove>
+    brelse(bp);
+80101c1c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101c1f:	89 14 24             	mov    %edx,(%esp)
+80101c22:	e8 c9 e5 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80101c27:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80101c2a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101c2d:	83 c4 10             	add    $0x10,%esp
+80101c30:	39 de                	cmp    %ebx,%esi
+80101c32:	72 9c                	jb     80101bd0 <readi+0x60>
+80101c34:	89 d8                	mov    %ebx,%eax
+  }
+  return n;
+}
+80101c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c39:	5b                   	pop    %ebx
+80101c3a:	5e                   	pop    %esi
+80101c3b:	5f                   	pop    %edi
+80101c3c:	5d                   	pop    %ebp
+80101c3d:	c3                   	ret
+80101c3e:	66 90                	xchg   %ax,%ax
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80101c40:	0f bf 56 52          	movswl 0x52(%esi),%edx
+80101c44:	66 83 fa 09          	cmp    $0x9,%dx
+80101c48:	77 17                	ja     80101c61 <readi+0xf1>
+80101c4a:	8b 14 d5 00 09 11 80 	mov    -0x7feef700(,%edx,8),%edx
+80101c51:	85 d2                	test   %edx,%edx
+80101c53:	74 0c                	je     80101c61 <readi+0xf1>
+    return devsw[ip->major].read(ip, dst, n);
+80101c55:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80101c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c5b:	5b                   	pop    %ebx
+80101c5c:	5e                   	pop    %esi
+80101c5d:	5f                   	pop    %edi
+80101c5e:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+80101c5f:	ff e2                	jmp    *%edx
+      return -1;
+80101c61:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101c66:	eb ce                	jmp    80101c36 <readi+0xc6>
+80101c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c6f:	90                   	nop
+
+80101c70 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+80101c70:	55                   	push   %ebp
+80101c71:	89 e5                	mov    %esp,%ebp
+80101c73:	57                   	push   %edi
+80101c74:	56                   	push   %esi
+80101c75:	53                   	push   %ebx
+80101c76:	83 ec 1c             	sub    $0x1c,%esp
+80101c79:	8b 45 08             	mov    0x8(%ebp),%eax
+80101c7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80101c7f:	8b 75 14             	mov    0x14(%ebp),%esi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80101c82:	66 83 78 50 03       	cmpw   $0x3,0x50(%eax)
+{
+80101c87:	89 7d dc             	mov    %edi,-0x24(%ebp)
+80101c8a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80101c8d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80101c90:	0f 84 ca 00 00 00    	je     80101d60 <writei+0xf0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80101c96:	39 78 58             	cmp    %edi,0x58(%eax)
+80101c99:	0f 82 fa 00 00 00    	jb     80101d99 <writei+0x129>
+80101c9f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101ca2:	31 c9                	xor    %ecx,%ecx
+80101ca4:	89 f2                	mov    %esi,%edx
+80101ca6:	01 fa                	add    %edi,%edx
+80101ca8:	0f 92 c1             	setb   %cl
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+80101cab:	81 fa 00 18 01 00    	cmp    $0x11800,%edx
+80101cb1:	0f 87 e2 00 00 00    	ja     80101d99 <writei+0x129>
+80101cb7:	85 c9                	test   %ecx,%ecx
+80101cb9:	0f 85 da 00 00 00    	jne    80101d99 <writei+0x129>
+    return -1;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101cbf:	85 f6                	test   %esi,%esi
+80101cc1:	0f 84 86 00 00 00    	je     80101d4d <writei+0xdd>
+80101cc7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101cce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80101cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101cd8:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80101cdb:	89 fa                	mov    %edi,%edx
+80101cdd:	c1 ea 09             	shr    $0x9,%edx
+80101ce0:	89 f0                	mov    %esi,%eax
+80101ce2:	e8 49 f8 ff ff       	call   80101530 <bmap>
+80101ce7:	83 ec 08             	sub    $0x8,%esp
+80101cea:	50                   	push   %eax
+80101ceb:	ff 36                	push   (%esi)
+80101ced:	e8 de e3 ff ff       	call   801000d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101cf2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101cf5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101cf8:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80101cfd:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101cff:	89 f8                	mov    %edi,%eax
+80101d01:	25 ff 01 00 00       	and    $0x1ff,%eax
+80101d06:	29 d3                	sub    %edx,%ebx
+80101d08:	29 c1                	sub    %eax,%ecx
+    memmove(bp->data + off%BSIZE, src, m);
+80101d0a:	8d 44 06 5c          	lea    0x5c(%esi,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80101d0e:	39 d9                	cmp    %ebx,%ecx
+80101d10:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80101d13:	83 c4 0c             	add    $0xc,%esp
+80101d16:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101d17:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+80101d19:	ff 75 dc             	push   -0x24(%ebp)
+80101d1c:	50                   	push   %eax
+80101d1d:	e8 2e 30 00 00       	call   80104d50 <memmove>
+    log_write(bp);
+80101d22:	89 34 24             	mov    %esi,(%esp)
+80101d25:	e8 16 13 00 00       	call   80103040 <log_write>
+    brelse(bp);
+80101d2a:	89 34 24             	mov    %esi,(%esp)
+80101d2d:	e8 be e4 ff ff       	call   801001f0 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80101d32:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+80101d35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101d38:	83 c4 10             	add    $0x10,%esp
+80101d3b:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80101d3e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101d41:	39 d8                	cmp    %ebx,%eax
+80101d43:	72 93                	jb     80101cd8 <writei+0x68>
+  }
+
+  if(n > 0 && off > ip->size){
+80101d45:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101d48:	39 78 58             	cmp    %edi,0x58(%eax)
+80101d4b:	72 3b                	jb     80101d88 <writei+0x118>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+80101d4d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80101d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d53:	5b                   	pop    %ebx
+80101d54:	5e                   	pop    %esi
+80101d55:	5f                   	pop    %edi
+80101d56:	5d                   	pop    %ebp
+80101d57:	c3                   	ret
+80101d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d5f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80101d60:	0f bf 40 52          	movswl 0x52(%eax),%eax
+80101d64:	66 83 f8 09          	cmp    $0x9,%ax
+80101d68:	77 2f                	ja     80101d99 <writei+0x129>
+80101d6a:	8b 04 c5 04 09 11 80 	mov    -0x7feef6fc(,%eax,8),%eax
+80101d71:	85 c0                	test   %eax,%eax
+80101d73:	74 24                	je     80101d99 <writei+0x129>
+    return devsw[ip->major].write(ip, src, n);
+80101d75:	89 75 10             	mov    %esi,0x10(%ebp)
+}
+80101d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d7b:	5b                   	pop    %ebx
+80101d7c:	5e                   	pop    %esi
+80101d7d:	5f                   	pop    %edi
+80101d7e:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80101d7f:	ff e0                	jmp    *%eax
+80101d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80101d88:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+80101d8b:	89 78 58             	mov    %edi,0x58(%eax)
+    iupdate(ip);
+80101d8e:	50                   	push   %eax
+80101d8f:	e8 1c fa ff ff       	call   801017b0 <iupdate>
+80101d94:	83 c4 10             	add    $0x10,%esp
+80101d97:	eb b4                	jmp    80101d4d <writei+0xdd>
+      return -1;
+80101d99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101d9e:	eb b0                	jmp    80101d50 <writei+0xe0>
+
+80101da0 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80101da0:	55                   	push   %ebp
+80101da1:	89 e5                	mov    %esp,%ebp
+80101da3:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80101da6:	6a 0e                	push   $0xe
+80101da8:	ff 75 0c             	push   0xc(%ebp)
+80101dab:	ff 75 08             	push   0x8(%ebp)
+80101dae:	e8 0d 30 00 00       	call   80104dc0 <strncmp>
+}
+80101db3:	c9                   	leave
+80101db4:	c3                   	ret
+80101db5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101dc0 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80101dc0:	55                   	push   %ebp
+80101dc1:	89 e5                	mov    %esp,%ebp
+80101dc3:	57                   	push   %edi
+80101dc4:	56                   	push   %esi
+80101dc5:	53                   	push   %ebx
+80101dc6:	83 ec 1c             	sub    $0x1c,%esp
+80101dc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+80101dcc:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80101dd1:	0f 85 85 00 00 00    	jne    80101e5c <dirlookup+0x9c>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101dd7:	8b 53 58             	mov    0x58(%ebx),%edx
+80101dda:	31 ff                	xor    %edi,%edi
+80101ddc:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80101ddf:	85 d2                	test   %edx,%edx
+80101de1:	74 3e                	je     80101e21 <dirlookup+0x61>
+80101de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101de7:	90                   	nop
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80101de8:	6a 10                	push   $0x10
+80101dea:	57                   	push   %edi
+80101deb:	56                   	push   %esi
+80101dec:	53                   	push   %ebx
+80101ded:	e8 7e fd ff ff       	call   80101b70 <readi>
+80101df2:	83 c4 10             	add    $0x10,%esp
+80101df5:	83 f8 10             	cmp    $0x10,%eax
+80101df8:	75 55                	jne    80101e4f <dirlookup+0x8f>
+      panic("dirlookup read");
+    if(de.inum == 0)
+80101dfa:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80101dff:	74 18                	je     80101e19 <dirlookup+0x59>
+  return strncmp(s, t, DIRSIZ);
+80101e01:	83 ec 04             	sub    $0x4,%esp
+80101e04:	8d 45 da             	lea    -0x26(%ebp),%eax
+80101e07:	6a 0e                	push   $0xe
+80101e09:	50                   	push   %eax
+80101e0a:	ff 75 0c             	push   0xc(%ebp)
+80101e0d:	e8 ae 2f 00 00       	call   80104dc0 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+80101e12:	83 c4 10             	add    $0x10,%esp
+80101e15:	85 c0                	test   %eax,%eax
+80101e17:	74 17                	je     80101e30 <dirlookup+0x70>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80101e19:	83 c7 10             	add    $0x10,%edi
+80101e1c:	3b 7b 58             	cmp    0x58(%ebx),%edi
+80101e1f:	72 c7                	jb     80101de8 <dirlookup+0x28>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+80101e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80101e24:	31 c0                	xor    %eax,%eax
+}
+80101e26:	5b                   	pop    %ebx
+80101e27:	5e                   	pop    %esi
+80101e28:	5f                   	pop    %edi
+80101e29:	5d                   	pop    %ebp
+80101e2a:	c3                   	ret
+80101e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101e2f:	90                   	nop
+      if(poff)
+80101e30:	8b 45 10             	mov    0x10(%ebp),%eax
+80101e33:	85 c0                	test   %eax,%eax
+80101e35:	74 05                	je     80101e3c <dirlookup+0x7c>
+        *poff = off;
+80101e37:	8b 45 10             	mov    0x10(%ebp),%eax
+80101e3a:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+80101e3c:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80101e40:	8b 03                	mov    (%ebx),%eax
+80101e42:	e8 69 f5 ff ff       	call   801013b0 <iget>
+}
+80101e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101e4a:	5b                   	pop    %ebx
+80101e4b:	5e                   	pop    %esi
+80101e4c:	5f                   	pop    %edi
+80101e4d:	5d                   	pop    %ebp
+80101e4e:	c3                   	ret
+      panic("dirlookup read");
+80101e4f:	83 ec 0c             	sub    $0xc,%esp
+80101e52:	68 a0 80 10 80       	push   $0x801080a0
+80101e57:	e8 24 e5 ff ff       	call   80100380 <panic>
+    panic("dirlookup not DIR");
+80101e5c:	83 ec 0c             	sub    $0xc,%esp
+80101e5f:	68 8e 80 10 80       	push   $0x8010808e
+80101e64:	e8 17 e5 ff ff       	call   80100380 <panic>
+80101e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101e70 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80101e70:	55                   	push   %ebp
+80101e71:	89 e5                	mov    %esp,%ebp
+80101e73:	57                   	push   %edi
+80101e74:	56                   	push   %esi
+80101e75:	53                   	push   %ebx
+80101e76:	89 c3                	mov    %eax,%ebx
+80101e78:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80101e7b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+80101e7e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80101e81:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80101e84:	0f 84 64 01 00 00    	je     80101fee <namex+0x17e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80101e8a:	e8 21 1b 00 00       	call   801039b0 <myproc>
+  acquire(&icache.lock);
+80101e8f:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80101e92:	8b 70 68             	mov    0x68(%eax),%esi
+  acquire(&icache.lock);
+80101e95:	68 60 09 11 80       	push   $0x80110960
+80101e9a:	e8 41 2d 00 00       	call   80104be0 <acquire>
+  ip->ref++;
+80101e9f:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80101ea3:	c7 04 24 60 09 11 80 	movl   $0x80110960,(%esp)
+80101eaa:	e8 d1 2c 00 00       	call   80104b80 <release>
+80101eaf:	83 c4 10             	add    $0x10,%esp
+80101eb2:	eb 07                	jmp    80101ebb <namex+0x4b>
+80101eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80101eb8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101ebb:	0f b6 03             	movzbl (%ebx),%eax
+80101ebe:	3c 2f                	cmp    $0x2f,%al
+80101ec0:	74 f6                	je     80101eb8 <namex+0x48>
+  if(*path == 0)
+80101ec2:	84 c0                	test   %al,%al
+80101ec4:	0f 84 06 01 00 00    	je     80101fd0 <namex+0x160>
+  while(*path != '/' && *path != 0)
+80101eca:	0f b6 03             	movzbl (%ebx),%eax
+80101ecd:	84 c0                	test   %al,%al
+80101ecf:	0f 84 10 01 00 00    	je     80101fe5 <namex+0x175>
+80101ed5:	89 df                	mov    %ebx,%edi
+80101ed7:	3c 2f                	cmp    $0x2f,%al
+80101ed9:	0f 84 06 01 00 00    	je     80101fe5 <namex+0x175>
+80101edf:	90                   	nop
+80101ee0:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80101ee4:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80101ee7:	3c 2f                	cmp    $0x2f,%al
+80101ee9:	74 04                	je     80101eef <namex+0x7f>
+80101eeb:	84 c0                	test   %al,%al
+80101eed:	75 f1                	jne    80101ee0 <namex+0x70>
+  len = path - s;
+80101eef:	89 f8                	mov    %edi,%eax
+80101ef1:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80101ef3:	83 f8 0d             	cmp    $0xd,%eax
+80101ef6:	0f 8e ac 00 00 00    	jle    80101fa8 <namex+0x138>
+    memmove(name, s, DIRSIZ);
+80101efc:	83 ec 04             	sub    $0x4,%esp
+80101eff:	6a 0e                	push   $0xe
+80101f01:	53                   	push   %ebx
+    path++;
+80101f02:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+80101f04:	ff 75 e4             	push   -0x1c(%ebp)
+80101f07:	e8 44 2e 00 00       	call   80104d50 <memmove>
+80101f0c:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80101f0f:	80 3f 2f             	cmpb   $0x2f,(%edi)
+80101f12:	75 0c                	jne    80101f20 <namex+0xb0>
+80101f14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80101f18:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101f1b:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101f1e:	74 f8                	je     80101f18 <namex+0xa8>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+80101f20:	83 ec 0c             	sub    $0xc,%esp
+80101f23:	56                   	push   %esi
+80101f24:	e8 37 f9 ff ff       	call   80101860 <ilock>
+    if(ip->type != T_DIR){
+80101f29:	83 c4 10             	add    $0x10,%esp
+80101f2c:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80101f31:	0f 85 cd 00 00 00    	jne    80102004 <namex+0x194>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+80101f37:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101f3a:	85 c0                	test   %eax,%eax
+80101f3c:	74 09                	je     80101f47 <namex+0xd7>
+80101f3e:	80 3b 00             	cmpb   $0x0,(%ebx)
+80101f41:	0f 84 34 01 00 00    	je     8010207b <namex+0x20b>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101f47:	83 ec 04             	sub    $0x4,%esp
+80101f4a:	6a 00                	push   $0x0
+80101f4c:	ff 75 e4             	push   -0x1c(%ebp)
+80101f4f:	56                   	push   %esi
+80101f50:	e8 6b fe ff ff       	call   80101dc0 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101f55:	8d 56 0c             	lea    0xc(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80101f58:	83 c4 10             	add    $0x10,%esp
+80101f5b:	89 c7                	mov    %eax,%edi
+80101f5d:	85 c0                	test   %eax,%eax
+80101f5f:	0f 84 e1 00 00 00    	je     80102046 <namex+0x1d6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80101f65:	83 ec 0c             	sub    $0xc,%esp
+80101f68:	52                   	push   %edx
+80101f69:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101f6c:	e8 3f 2a 00 00       	call   801049b0 <holdingsleep>
+80101f71:	83 c4 10             	add    $0x10,%esp
+80101f74:	85 c0                	test   %eax,%eax
+80101f76:	0f 84 3f 01 00 00    	je     801020bb <namex+0x24b>
+80101f7c:	8b 56 08             	mov    0x8(%esi),%edx
+80101f7f:	85 d2                	test   %edx,%edx
+80101f81:	0f 8e 34 01 00 00    	jle    801020bb <namex+0x24b>
+  releasesleep(&ip->lock);
+80101f87:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101f8a:	83 ec 0c             	sub    $0xc,%esp
+80101f8d:	52                   	push   %edx
+80101f8e:	e8 dd 29 00 00       	call   80104970 <releasesleep>
+  iput(ip);
+80101f93:	89 34 24             	mov    %esi,(%esp)
+80101f96:	89 fe                	mov    %edi,%esi
+80101f98:	e8 f3 f9 ff ff       	call   80101990 <iput>
+80101f9d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80101fa0:	e9 16 ff ff ff       	jmp    80101ebb <namex+0x4b>
+80101fa5:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80101fa8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101fab:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+80101fae:	83 ec 04             	sub    $0x4,%esp
+80101fb1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101fb4:	50                   	push   %eax
+80101fb5:	53                   	push   %ebx
+    name[len] = 0;
+80101fb6:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80101fb8:	ff 75 e4             	push   -0x1c(%ebp)
+80101fbb:	e8 90 2d 00 00       	call   80104d50 <memmove>
+    name[len] = 0;
+80101fc0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101fc3:	83 c4 10             	add    $0x10,%esp
+80101fc6:	c6 02 00             	movb   $0x0,(%edx)
+80101fc9:	e9 41 ff ff ff       	jmp    80101f0f <namex+0x9f>
+80101fce:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80101fd0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101fd3:	85 c0                	test   %eax,%eax
+80101fd5:	0f 85 d0 00 00 00    	jne    801020ab <namex+0x23b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80101fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101fde:	89 f0                	mov    %esi,%eax
+80101fe0:	5b                   	pop    %ebx
+80101fe1:	5e                   	pop    %esi
+80101fe2:	5f                   	pop    %edi
+80101fe3:	5d                   	pop    %ebp
+80101fe4:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80101fe5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101fe8:	89 df                	mov    %ebx,%edi
+80101fea:	31 c0                	xor    %eax,%eax
+80101fec:	eb c0                	jmp    80101fae <namex+0x13e>
+    ip = iget(ROOTDEV, ROOTINO);
+80101fee:	ba 01 00 00 00       	mov    $0x1,%edx
+80101ff3:	b8 01 00 00 00       	mov    $0x1,%eax
+80101ff8:	e8 b3 f3 ff ff       	call   801013b0 <iget>
+80101ffd:	89 c6                	mov    %eax,%esi
+80101fff:	e9 b7 fe ff ff       	jmp    80101ebb <namex+0x4b>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102004:	83 ec 0c             	sub    $0xc,%esp
+80102007:	8d 5e 0c             	lea    0xc(%esi),%ebx
+8010200a:	53                   	push   %ebx
+8010200b:	e8 a0 29 00 00       	call   801049b0 <holdingsleep>
+80102010:	83 c4 10             	add    $0x10,%esp
+80102013:	85 c0                	test   %eax,%eax
+80102015:	0f 84 a0 00 00 00    	je     801020bb <namex+0x24b>
+8010201b:	8b 46 08             	mov    0x8(%esi),%eax
+8010201e:	85 c0                	test   %eax,%eax
+80102020:	0f 8e 95 00 00 00    	jle    801020bb <namex+0x24b>
+  releasesleep(&ip->lock);
+80102026:	83 ec 0c             	sub    $0xc,%esp
+80102029:	53                   	push   %ebx
+8010202a:	e8 41 29 00 00       	call   80104970 <releasesleep>
+  iput(ip);
+8010202f:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80102032:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102034:	e8 57 f9 ff ff       	call   80101990 <iput>
+      return 0;
+80102039:	83 c4 10             	add    $0x10,%esp
+}
+8010203c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010203f:	89 f0                	mov    %esi,%eax
+80102041:	5b                   	pop    %ebx
+80102042:	5e                   	pop    %esi
+80102043:	5f                   	pop    %edi
+80102044:	5d                   	pop    %ebp
+80102045:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102046:	83 ec 0c             	sub    $0xc,%esp
+80102049:	52                   	push   %edx
+8010204a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010204d:	e8 5e 29 00 00       	call   801049b0 <holdingsleep>
+80102052:	83 c4 10             	add    $0x10,%esp
+80102055:	85 c0                	test   %eax,%eax
+80102057:	74 62                	je     801020bb <namex+0x24b>
+80102059:	8b 4e 08             	mov    0x8(%esi),%ecx
+8010205c:	85 c9                	test   %ecx,%ecx
+8010205e:	7e 5b                	jle    801020bb <namex+0x24b>
+  releasesleep(&ip->lock);
+80102060:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102063:	83 ec 0c             	sub    $0xc,%esp
+80102066:	52                   	push   %edx
+80102067:	e8 04 29 00 00       	call   80104970 <releasesleep>
+  iput(ip);
+8010206c:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+8010206f:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102071:	e8 1a f9 ff ff       	call   80101990 <iput>
+      return 0;
+80102076:	83 c4 10             	add    $0x10,%esp
+80102079:	eb c1                	jmp    8010203c <namex+0x1cc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+8010207b:	83 ec 0c             	sub    $0xc,%esp
+8010207e:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102081:	53                   	push   %ebx
+80102082:	e8 29 29 00 00       	call   801049b0 <holdingsleep>
+80102087:	83 c4 10             	add    $0x10,%esp
+8010208a:	85 c0                	test   %eax,%eax
+8010208c:	74 2d                	je     801020bb <namex+0x24b>
+8010208e:	8b 7e 08             	mov    0x8(%esi),%edi
+80102091:	85 ff                	test   %edi,%edi
+80102093:	7e 26                	jle    801020bb <namex+0x24b>
+  releasesleep(&ip->lock);
+80102095:	83 ec 0c             	sub    $0xc,%esp
+80102098:	53                   	push   %ebx
+80102099:	e8 d2 28 00 00       	call   80104970 <releasesleep>
+}
+8010209e:	83 c4 10             	add    $0x10,%esp
+}
+801020a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801020a4:	89 f0                	mov    %esi,%eax
+801020a6:	5b                   	pop    %ebx
+801020a7:	5e                   	pop    %esi
+801020a8:	5f                   	pop    %edi
+801020a9:	5d                   	pop    %ebp
+801020aa:	c3                   	ret
+    iput(ip);
+801020ab:	83 ec 0c             	sub    $0xc,%esp
+801020ae:	56                   	push   %esi
+      return 0;
+801020af:	31 f6                	xor    %esi,%esi
+    iput(ip);
+801020b1:	e8 da f8 ff ff       	call   80101990 <iput>
+    return 0;
+801020b6:	83 c4 10             	add    $0x10,%esp
+801020b9:	eb 81                	jmp    8010203c <namex+0x1cc>
+    panic("iunlock");
+801020bb:	83 ec 0c             	sub    $0xc,%esp
+801020be:	68 86 80 10 80       	push   $0x80108086
+801020c3:	e8 b8 e2 ff ff       	call   80100380 <panic>
+801020c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801020cf:	90                   	nop
+
+801020d0 <dirlink>:
+{
+801020d0:	55                   	push   %ebp
+801020d1:	89 e5                	mov    %esp,%ebp
+801020d3:	57                   	push   %edi
+801020d4:	56                   	push   %esi
+801020d5:	53                   	push   %ebx
+801020d6:	83 ec 20             	sub    $0x20,%esp
+801020d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801020dc:	6a 00                	push   $0x0
+801020de:	ff 75 0c             	push   0xc(%ebp)
+801020e1:	53                   	push   %ebx
+801020e2:	e8 d9 fc ff ff       	call   80101dc0 <dirlookup>
+801020e7:	83 c4 10             	add    $0x10,%esp
+801020ea:	85 c0                	test   %eax,%eax
+801020ec:	75 67                	jne    80102155 <dirlink+0x85>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801020ee:	8b 7b 58             	mov    0x58(%ebx),%edi
+801020f1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801020f4:	85 ff                	test   %edi,%edi
+801020f6:	74 29                	je     80102121 <dirlink+0x51>
+801020f8:	31 ff                	xor    %edi,%edi
+801020fa:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801020fd:	eb 09                	jmp    80102108 <dirlink+0x38>
+801020ff:	90                   	nop
+80102100:	83 c7 10             	add    $0x10,%edi
+80102103:	3b 7b 58             	cmp    0x58(%ebx),%edi
+80102106:	73 19                	jae    80102121 <dirlink+0x51>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102108:	6a 10                	push   $0x10
+8010210a:	57                   	push   %edi
+8010210b:	56                   	push   %esi
+8010210c:	53                   	push   %ebx
+8010210d:	e8 5e fa ff ff       	call   80101b70 <readi>
+80102112:	83 c4 10             	add    $0x10,%esp
+80102115:	83 f8 10             	cmp    $0x10,%eax
+80102118:	75 4e                	jne    80102168 <dirlink+0x98>
+    if(de.inum == 0)
+8010211a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010211f:	75 df                	jne    80102100 <dirlink+0x30>
+  strncpy(de.name, name, DIRSIZ);
+80102121:	83 ec 04             	sub    $0x4,%esp
+80102124:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102127:	6a 0e                	push   $0xe
+80102129:	ff 75 0c             	push   0xc(%ebp)
+8010212c:	50                   	push   %eax
+8010212d:	e8 de 2c 00 00       	call   80104e10 <strncpy>
+  de.inum = inum;
+80102132:	8b 45 10             	mov    0x10(%ebp),%eax
+80102135:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102139:	6a 10                	push   $0x10
+8010213b:	57                   	push   %edi
+8010213c:	56                   	push   %esi
+8010213d:	53                   	push   %ebx
+8010213e:	e8 2d fb ff ff       	call   80101c70 <writei>
+80102143:	83 c4 20             	add    $0x20,%esp
+80102146:	83 f8 10             	cmp    $0x10,%eax
+80102149:	75 2a                	jne    80102175 <dirlink+0xa5>
+  return 0;
+8010214b:	31 c0                	xor    %eax,%eax
+}
+8010214d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102150:	5b                   	pop    %ebx
+80102151:	5e                   	pop    %esi
+80102152:	5f                   	pop    %edi
+80102153:	5d                   	pop    %ebp
+80102154:	c3                   	ret
+    iput(ip);
+80102155:	83 ec 0c             	sub    $0xc,%esp
+80102158:	50                   	push   %eax
+80102159:	e8 32 f8 ff ff       	call   80101990 <iput>
+    return -1;
+8010215e:	83 c4 10             	add    $0x10,%esp
+80102161:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102166:	eb e5                	jmp    8010214d <dirlink+0x7d>
+      panic("dirlink read");
+80102168:	83 ec 0c             	sub    $0xc,%esp
+8010216b:	68 af 80 10 80       	push   $0x801080af
+80102170:	e8 0b e2 ff ff       	call   80100380 <panic>
+    panic("dirlink");
+80102175:	83 ec 0c             	sub    $0xc,%esp
+80102178:	68 f6 86 10 80       	push   $0x801086f6
+8010217d:	e8 fe e1 ff ff       	call   80100380 <panic>
+80102182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102190 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102190:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102191:	31 d2                	xor    %edx,%edx
+{
+80102193:	89 e5                	mov    %esp,%ebp
+80102195:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80102198:	8b 45 08             	mov    0x8(%ebp),%eax
+8010219b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010219e:	e8 cd fc ff ff       	call   80101e70 <namex>
+}
+801021a3:	c9                   	leave
+801021a4:	c3                   	ret
+801021a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801021b0 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+801021b0:	55                   	push   %ebp
+  return namex(path, 1, name);
+801021b1:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+801021b6:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+801021b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801021bb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+801021be:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+801021bf:	e9 ac fc ff ff       	jmp    80101e70 <namex>
+801021c4:	66 90                	xchg   %ax,%ax
+801021c6:	66 90                	xchg   %ax,%ax
+801021c8:	66 90                	xchg   %ax,%ax
+801021ca:	66 90                	xchg   %ax,%ax
+801021cc:	66 90                	xchg   %ax,%ax
+801021ce:	66 90                	xchg   %ax,%ax
+
+801021d0 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+801021d0:	55                   	push   %ebp
+801021d1:	89 e5                	mov    %esp,%ebp
+801021d3:	57                   	push   %edi
+801021d4:	56                   	push   %esi
+801021d5:	53                   	push   %ebx
+801021d6:	83 ec 0c             	sub    $0xc,%esp
+  if(b == 0)
+801021d9:	85 c0                	test   %eax,%eax
+801021db:	0f 84 b4 00 00 00    	je     80102295 <idestart+0xc5>
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+801021e1:	8b 70 08             	mov    0x8(%eax),%esi
+801021e4:	89 c3                	mov    %eax,%ebx
+801021e6:	81 fe e7 03 00 00    	cmp    $0x3e7,%esi
+801021ec:	0f 87 96 00 00 00    	ja     80102288 <idestart+0xb8>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801021f2:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801021f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021fe:	66 90                	xchg   %ax,%ax
+80102200:	89 ca                	mov    %ecx,%edx
+80102202:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102203:	83 e0 c0             	and    $0xffffffc0,%eax
+80102206:	3c 40                	cmp    $0x40,%al
+80102208:	75 f6                	jne    80102200 <idestart+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010220a:	31 ff                	xor    %edi,%edi
+8010220c:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102211:	89 f8                	mov    %edi,%eax
+80102213:	ee                   	out    %al,(%dx)
+80102214:	b8 01 00 00 00       	mov    $0x1,%eax
+80102219:	ba f2 01 00 00       	mov    $0x1f2,%edx
+8010221e:	ee                   	out    %al,(%dx)
+8010221f:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102224:	89 f0                	mov    %esi,%eax
+80102226:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102227:	89 f0                	mov    %esi,%eax
+80102229:	ba f4 01 00 00       	mov    $0x1f4,%edx
+8010222e:	c1 f8 08             	sar    $0x8,%eax
+80102231:	ee                   	out    %al,(%dx)
+80102232:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102237:	89 f8                	mov    %edi,%eax
+80102239:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+8010223a:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+8010223e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102243:	c1 e0 04             	shl    $0x4,%eax
+80102246:	83 e0 10             	and    $0x10,%eax
+80102249:	83 c8 e0             	or     $0xffffffe0,%eax
+8010224c:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+8010224d:	f6 03 04             	testb  $0x4,(%ebx)
+80102250:	75 16                	jne    80102268 <idestart+0x98>
+80102252:	b8 20 00 00 00       	mov    $0x20,%eax
+80102257:	89 ca                	mov    %ecx,%edx
+80102259:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+8010225a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010225d:	5b                   	pop    %ebx
+8010225e:	5e                   	pop    %esi
+8010225f:	5f                   	pop    %edi
+80102260:	5d                   	pop    %ebp
+80102261:	c3                   	ret
+80102262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102268:	b8 30 00 00 00       	mov    $0x30,%eax
+8010226d:	89 ca                	mov    %ecx,%edx
+8010226f:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+80102270:	b9 80 00 00 00       	mov    $0x80,%ecx
+    outsl(0x1f0, b->data, BSIZE/4);
+80102275:	8d 73 5c             	lea    0x5c(%ebx),%esi
+80102278:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010227d:	fc                   	cld
+8010227e:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80102280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102283:	5b                   	pop    %ebx
+80102284:	5e                   	pop    %esi
+80102285:	5f                   	pop    %edi
+80102286:	5d                   	pop    %ebp
+80102287:	c3                   	ret
+    panic("incorrect blockno");
+80102288:	83 ec 0c             	sub    $0xc,%esp
+8010228b:	68 18 81 10 80       	push   $0x80108118
+80102290:	e8 eb e0 ff ff       	call   80100380 <panic>
+    panic("idestart");
+80102295:	83 ec 0c             	sub    $0xc,%esp
+80102298:	68 0f 81 10 80       	push   $0x8010810f
+8010229d:	e8 de e0 ff ff       	call   80100380 <panic>
+801022a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801022b0 <ideinit>:
+{
+801022b0:	55                   	push   %ebp
+801022b1:	89 e5                	mov    %esp,%ebp
+801022b3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+801022b6:	68 2a 81 10 80       	push   $0x8010812a
+801022bb:	68 00 26 11 80       	push   $0x80112600
+801022c0:	e8 3b 27 00 00       	call   80104a00 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+801022c5:	58                   	pop    %eax
+801022c6:	a1 84 27 11 80       	mov    0x80112784,%eax
+801022cb:	5a                   	pop    %edx
+801022cc:	83 e8 01             	sub    $0x1,%eax
+801022cf:	50                   	push   %eax
+801022d0:	6a 0e                	push   $0xe
+801022d2:	e8 99 02 00 00       	call   80102570 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801022d7:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801022da:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801022df:	90                   	nop
+801022e0:	89 ca                	mov    %ecx,%edx
+801022e2:	ec                   	in     (%dx),%al
+801022e3:	83 e0 c0             	and    $0xffffffc0,%eax
+801022e6:	3c 40                	cmp    $0x40,%al
+801022e8:	75 f6                	jne    801022e0 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801022ea:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801022ef:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801022f4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801022f5:	89 ca                	mov    %ecx,%edx
+801022f7:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801022f8:	84 c0                	test   %al,%al
+801022fa:	75 1e                	jne    8010231a <ideinit+0x6a>
+801022fc:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80102301:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010230d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+80102310:	83 e9 01             	sub    $0x1,%ecx
+80102313:	74 0f                	je     80102324 <ideinit+0x74>
+80102315:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102316:	84 c0                	test   %al,%al
+80102318:	74 f6                	je     80102310 <ideinit+0x60>
+      havedisk1 = 1;
+8010231a:	c7 05 e0 25 11 80 01 	movl   $0x1,0x801125e0
+80102321:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102324:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102329:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010232e:	ee                   	out    %al,(%dx)
+}
+8010232f:	c9                   	leave
+80102330:	c3                   	ret
+80102331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010233f:	90                   	nop
+
+80102340 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80102340:	55                   	push   %ebp
+80102341:	89 e5                	mov    %esp,%ebp
+80102343:	57                   	push   %edi
+80102344:	56                   	push   %esi
+80102345:	53                   	push   %ebx
+80102346:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+80102349:	68 00 26 11 80       	push   $0x80112600
+8010234e:	e8 8d 28 00 00       	call   80104be0 <acquire>
+
+  if((b = idequeue) == 0){
+80102353:	8b 1d e4 25 11 80    	mov    0x801125e4,%ebx
+80102359:	83 c4 10             	add    $0x10,%esp
+8010235c:	85 db                	test   %ebx,%ebx
+8010235e:	74 63                	je     801023c3 <ideintr+0x83>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+80102360:	8b 43 58             	mov    0x58(%ebx),%eax
+80102363:	a3 e4 25 11 80       	mov    %eax,0x801125e4
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80102368:	8b 33                	mov    (%ebx),%esi
+8010236a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+80102370:	75 2f                	jne    801023a1 <ideintr+0x61>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102372:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010237e:	66 90                	xchg   %ax,%ax
+80102380:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102381:	89 c1                	mov    %eax,%ecx
+80102383:	83 e1 c0             	and    $0xffffffc0,%ecx
+80102386:	80 f9 40             	cmp    $0x40,%cl
+80102389:	75 f5                	jne    80102380 <ideintr+0x40>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+8010238b:	a8 21                	test   $0x21,%al
+8010238d:	75 12                	jne    801023a1 <ideintr+0x61>
+    insl(0x1f0, b->data, BSIZE/4);
+8010238f:	8d 7b 5c             	lea    0x5c(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80102392:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102397:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010239c:	fc                   	cld
+8010239d:	f3 6d                	rep insl (%dx),%es:(%edi)
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+8010239f:	8b 33                	mov    (%ebx),%esi
+  b->flags &= ~B_DIRTY;
+801023a1:	83 e6 fb             	and    $0xfffffffb,%esi
+  wakeup(b);
+801023a4:	83 ec 0c             	sub    $0xc,%esp
+  b->flags &= ~B_DIRTY;
+801023a7:	83 ce 02             	or     $0x2,%esi
+801023aa:	89 33                	mov    %esi,(%ebx)
+  wakeup(b);
+801023ac:	53                   	push   %ebx
+801023ad:	e8 ee 21 00 00       	call   801045a0 <wakeup>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+801023b2:	a1 e4 25 11 80       	mov    0x801125e4,%eax
+801023b7:	83 c4 10             	add    $0x10,%esp
+801023ba:	85 c0                	test   %eax,%eax
+801023bc:	74 05                	je     801023c3 <ideintr+0x83>
+    idestart(idequeue);
+801023be:	e8 0d fe ff ff       	call   801021d0 <idestart>
+    release(&idelock);
+801023c3:	83 ec 0c             	sub    $0xc,%esp
+801023c6:	68 00 26 11 80       	push   $0x80112600
+801023cb:	e8 b0 27 00 00       	call   80104b80 <release>
+
+  release(&idelock);
+}
+801023d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801023d3:	5b                   	pop    %ebx
+801023d4:	5e                   	pop    %esi
+801023d5:	5f                   	pop    %edi
+801023d6:	5d                   	pop    %ebp
+801023d7:	c3                   	ret
+801023d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801023df:	90                   	nop
+
+801023e0 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+801023e0:	55                   	push   %ebp
+801023e1:	89 e5                	mov    %esp,%ebp
+801023e3:	53                   	push   %ebx
+801023e4:	83 ec 10             	sub    $0x10,%esp
+801023e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+801023ea:	8d 43 0c             	lea    0xc(%ebx),%eax
+801023ed:	50                   	push   %eax
+801023ee:	e8 bd 25 00 00       	call   801049b0 <holdingsleep>
+801023f3:	83 c4 10             	add    $0x10,%esp
+801023f6:	85 c0                	test   %eax,%eax
+801023f8:	0f 84 c3 00 00 00    	je     801024c1 <iderw+0xe1>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+801023fe:	8b 03                	mov    (%ebx),%eax
+80102400:	83 e0 06             	and    $0x6,%eax
+80102403:	83 f8 02             	cmp    $0x2,%eax
+80102406:	0f 84 a8 00 00 00    	je     801024b4 <iderw+0xd4>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+8010240c:	8b 53 04             	mov    0x4(%ebx),%edx
+8010240f:	85 d2                	test   %edx,%edx
+80102411:	74 0d                	je     80102420 <iderw+0x40>
+80102413:	a1 e0 25 11 80       	mov    0x801125e0,%eax
+80102418:	85 c0                	test   %eax,%eax
+8010241a:	0f 84 87 00 00 00    	je     801024a7 <iderw+0xc7>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80102420:	83 ec 0c             	sub    $0xc,%esp
+80102423:	68 00 26 11 80       	push   $0x80112600
+80102428:	e8 b3 27 00 00       	call   80104be0 <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+8010242d:	a1 e4 25 11 80       	mov    0x801125e4,%eax
+  b->qnext = 0;
+80102432:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102439:	83 c4 10             	add    $0x10,%esp
+8010243c:	85 c0                	test   %eax,%eax
+8010243e:	74 60                	je     801024a0 <iderw+0xc0>
+80102440:	89 c2                	mov    %eax,%edx
+80102442:	8b 40 58             	mov    0x58(%eax),%eax
+80102445:	85 c0                	test   %eax,%eax
+80102447:	75 f7                	jne    80102440 <iderw+0x60>
+80102449:	83 c2 58             	add    $0x58,%edx
+    ;
+  *pp = b;
+8010244c:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+8010244e:	39 1d e4 25 11 80    	cmp    %ebx,0x801125e4
+80102454:	74 3a                	je     80102490 <iderw+0xb0>
+    idestart(b);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80102456:	8b 03                	mov    (%ebx),%eax
+80102458:	83 e0 06             	and    $0x6,%eax
+8010245b:	83 f8 02             	cmp    $0x2,%eax
+8010245e:	74 1b                	je     8010247b <iderw+0x9b>
+    sleep(b, &idelock);
+80102460:	83 ec 08             	sub    $0x8,%esp
+80102463:	68 00 26 11 80       	push   $0x80112600
+80102468:	53                   	push   %ebx
+80102469:	e8 82 1f 00 00       	call   801043f0 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+8010246e:	8b 03                	mov    (%ebx),%eax
+80102470:	83 c4 10             	add    $0x10,%esp
+80102473:	83 e0 06             	and    $0x6,%eax
+80102476:	83 f8 02             	cmp    $0x2,%eax
+80102479:	75 e5                	jne    80102460 <iderw+0x80>
+  }
+
+
+  release(&idelock);
+8010247b:	c7 45 08 00 26 11 80 	movl   $0x80112600,0x8(%ebp)
+}
+80102482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102485:	c9                   	leave
+  release(&idelock);
+80102486:	e9 f5 26 00 00       	jmp    80104b80 <release>
+8010248b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010248f:	90                   	nop
+    idestart(b);
+80102490:	89 d8                	mov    %ebx,%eax
+80102492:	e8 39 fd ff ff       	call   801021d0 <idestart>
+80102497:	eb bd                	jmp    80102456 <iderw+0x76>
+80102499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801024a0:	ba e4 25 11 80       	mov    $0x801125e4,%edx
+801024a5:	eb a5                	jmp    8010244c <iderw+0x6c>
+    panic("iderw: ide disk 1 not present");
+801024a7:	83 ec 0c             	sub    $0xc,%esp
+801024aa:	68 59 81 10 80       	push   $0x80108159
+801024af:	e8 cc de ff ff       	call   80100380 <panic>
+    panic("iderw: nothing to do");
+801024b4:	83 ec 0c             	sub    $0xc,%esp
+801024b7:	68 44 81 10 80       	push   $0x80108144
+801024bc:	e8 bf de ff ff       	call   80100380 <panic>
+    panic("iderw: buf not locked");
+801024c1:	83 ec 0c             	sub    $0xc,%esp
+801024c4:	68 2e 81 10 80       	push   $0x8010812e
+801024c9:	e8 b2 de ff ff       	call   80100380 <panic>
+801024ce:	66 90                	xchg   %ax,%ax
+
+801024d0 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+801024d0:	55                   	push   %ebp
+801024d1:	89 e5                	mov    %esp,%ebp
+801024d3:	56                   	push   %esi
+801024d4:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801024d5:	c7 05 34 26 11 80 00 	movl   $0xfec00000,0x80112634
+801024dc:	00 c0 fe 
+  ioapic->reg = reg;
+801024df:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+801024e6:	00 00 00 
+  return ioapic->data;
+801024e9:	8b 15 34 26 11 80    	mov    0x80112634,%edx
+801024ef:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+801024f2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+801024f8:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+801024fe:	0f b6 15 80 27 11 80 	movzbl 0x80112780,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80102505:	c1 ee 10             	shr    $0x10,%esi
+80102508:	89 f0                	mov    %esi,%eax
+8010250a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010250d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80102510:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80102513:	39 c2                	cmp    %eax,%edx
+80102515:	74 16                	je     8010252d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80102517:	83 ec 0c             	sub    $0xc,%esp
+8010251a:	68 78 81 10 80       	push   $0x80108178
+8010251f:	e8 8c e1 ff ff       	call   801006b0 <cprintf>
+  ioapic->reg = reg;
+80102524:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+8010252a:	83 c4 10             	add    $0x10,%esp
+{
+8010252d:	ba 10 00 00 00       	mov    $0x10,%edx
+80102532:	31 c0                	xor    %eax,%eax
+80102534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+80102538:	89 13                	mov    %edx,(%ebx)
+8010253a:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+8010253d:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+80102543:	83 c0 01             	add    $0x1,%eax
+80102546:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+8010254c:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+8010254f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80102552:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80102555:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80102557:	8b 1d 34 26 11 80    	mov    0x80112634,%ebx
+8010255d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+80102564:	39 c6                	cmp    %eax,%esi
+80102566:	7d d0                	jge    80102538 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80102568:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010256b:	5b                   	pop    %ebx
+8010256c:	5e                   	pop    %esi
+8010256d:	5d                   	pop    %ebp
+8010256e:	c3                   	ret
+8010256f:	90                   	nop
+
+80102570 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80102570:	55                   	push   %ebp
+  ioapic->reg = reg;
+80102571:	8b 0d 34 26 11 80    	mov    0x80112634,%ecx
+{
+80102577:	89 e5                	mov    %esp,%ebp
+80102579:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010257c:	8d 50 20             	lea    0x20(%eax),%edx
+8010257f:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80102583:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80102585:	8b 0d 34 26 11 80    	mov    0x80112634,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010258b:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+8010258e:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80102591:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80102594:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80102596:	a1 34 26 11 80       	mov    0x80112634,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010259b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010259e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801025a1:	5d                   	pop    %ebp
+801025a2:	c3                   	ret
+801025a3:	66 90                	xchg   %ax,%ax
+801025a5:	66 90                	xchg   %ax,%ax
+801025a7:	66 90                	xchg   %ax,%ax
+801025a9:	66 90                	xchg   %ax,%ax
+801025ab:	66 90                	xchg   %ax,%ax
+801025ad:	66 90                	xchg   %ax,%ax
+801025af:	90                   	nop
+
+801025b0 <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+801025b0:	55                   	push   %ebp
+801025b1:	89 e5                	mov    %esp,%ebp
+801025b3:	53                   	push   %ebx
+801025b4:	83 ec 04             	sub    $0x4,%esp
+801025b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801025ba:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801025c0:	75 76                	jne    80102638 <kfree+0x88>
+801025c2:	81 fb f0 91 11 80    	cmp    $0x801191f0,%ebx
+801025c8:	72 6e                	jb     80102638 <kfree+0x88>
+801025ca:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801025d0:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801025d5:	77 61                	ja     80102638 <kfree+0x88>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+801025d7:	83 ec 04             	sub    $0x4,%esp
+801025da:	68 00 10 00 00       	push   $0x1000
+801025df:	6a 01                	push   $0x1
+801025e1:	53                   	push   %ebx
+801025e2:	e8 d9 26 00 00       	call   80104cc0 <memset>
+
+  if(kmem.use_lock)
+801025e7:	8b 15 74 26 11 80    	mov    0x80112674,%edx
+801025ed:	83 c4 10             	add    $0x10,%esp
+801025f0:	85 d2                	test   %edx,%edx
+801025f2:	75 1c                	jne    80102610 <kfree+0x60>
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.freelist;
+801025f4:	a1 78 26 11 80       	mov    0x80112678,%eax
+801025f9:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+  if(kmem.use_lock)
+801025fb:	a1 74 26 11 80       	mov    0x80112674,%eax
+  kmem.freelist = r;
+80102600:	89 1d 78 26 11 80    	mov    %ebx,0x80112678
+  if(kmem.use_lock)
+80102606:	85 c0                	test   %eax,%eax
+80102608:	75 1e                	jne    80102628 <kfree+0x78>
+    release(&kmem.lock);
+}
+8010260a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010260d:	c9                   	leave
+8010260e:	c3                   	ret
+8010260f:	90                   	nop
+    acquire(&kmem.lock);
+80102610:	83 ec 0c             	sub    $0xc,%esp
+80102613:	68 40 26 11 80       	push   $0x80112640
+80102618:	e8 c3 25 00 00       	call   80104be0 <acquire>
+8010261d:	83 c4 10             	add    $0x10,%esp
+80102620:	eb d2                	jmp    801025f4 <kfree+0x44>
+80102622:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&kmem.lock);
+80102628:	c7 45 08 40 26 11 80 	movl   $0x80112640,0x8(%ebp)
+}
+8010262f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102632:	c9                   	leave
+    release(&kmem.lock);
+80102633:	e9 48 25 00 00       	jmp    80104b80 <release>
+    panic("kfree");
+80102638:	83 ec 0c             	sub    $0xc,%esp
+8010263b:	68 aa 81 10 80       	push   $0x801081aa
+80102640:	e8 3b dd ff ff       	call   80100380 <panic>
+80102645:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010264c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102650 <freerange>:
+{
+80102650:	55                   	push   %ebp
+80102651:	89 e5                	mov    %esp,%ebp
+80102653:	56                   	push   %esi
+80102654:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80102655:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80102658:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010265b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102661:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102667:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010266d:	39 de                	cmp    %ebx,%esi
+8010266f:	72 23                	jb     80102694 <freerange+0x44>
+80102671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80102678:	83 ec 0c             	sub    $0xc,%esp
+8010267b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102681:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80102687:	50                   	push   %eax
+80102688:	e8 23 ff ff ff       	call   801025b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+8010268d:	83 c4 10             	add    $0x10,%esp
+80102690:	39 de                	cmp    %ebx,%esi
+80102692:	73 e4                	jae    80102678 <freerange+0x28>
+}
+80102694:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102697:	5b                   	pop    %ebx
+80102698:	5e                   	pop    %esi
+80102699:	5d                   	pop    %ebp
+8010269a:	c3                   	ret
+8010269b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010269f:	90                   	nop
+
+801026a0 <kinit2>:
+{
+801026a0:	55                   	push   %ebp
+801026a1:	89 e5                	mov    %esp,%ebp
+801026a3:	56                   	push   %esi
+801026a4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801026a5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801026a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801026ab:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801026b1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026b7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801026bd:	39 de                	cmp    %ebx,%esi
+801026bf:	72 23                	jb     801026e4 <kinit2+0x44>
+801026c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+801026c8:	83 ec 0c             	sub    $0xc,%esp
+801026cb:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026d1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801026d7:	50                   	push   %eax
+801026d8:	e8 d3 fe ff ff       	call   801025b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801026dd:	83 c4 10             	add    $0x10,%esp
+801026e0:	39 de                	cmp    %ebx,%esi
+801026e2:	73 e4                	jae    801026c8 <kinit2+0x28>
+  kmem.use_lock = 1;
+801026e4:	c7 05 74 26 11 80 01 	movl   $0x1,0x80112674
+801026eb:	00 00 00 
+}
+801026ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801026f1:	5b                   	pop    %ebx
+801026f2:	5e                   	pop    %esi
+801026f3:	5d                   	pop    %ebp
+801026f4:	c3                   	ret
+801026f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102700 <kinit1>:
+{
+80102700:	55                   	push   %ebp
+80102701:	89 e5                	mov    %esp,%ebp
+80102703:	56                   	push   %esi
+80102704:	53                   	push   %ebx
+80102705:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80102708:	83 ec 08             	sub    $0x8,%esp
+8010270b:	68 b0 81 10 80       	push   $0x801081b0
+80102710:	68 40 26 11 80       	push   $0x80112640
+80102715:	e8 e6 22 00 00       	call   80104a00 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010271a:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+8010271d:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80102720:	c7 05 74 26 11 80 00 	movl   $0x0,0x80112674
+80102727:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+8010272a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80102730:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102736:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010273c:	39 de                	cmp    %ebx,%esi
+8010273e:	72 1c                	jb     8010275c <kinit1+0x5c>
+    kfree(p);
+80102740:	83 ec 0c             	sub    $0xc,%esp
+80102743:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102749:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+8010274f:	50                   	push   %eax
+80102750:	e8 5b fe ff ff       	call   801025b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80102755:	83 c4 10             	add    $0x10,%esp
+80102758:	39 de                	cmp    %ebx,%esi
+8010275a:	73 e4                	jae    80102740 <kinit1+0x40>
+}
+8010275c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010275f:	5b                   	pop    %ebx
+80102760:	5e                   	pop    %esi
+80102761:	5d                   	pop    %ebp
+80102762:	c3                   	ret
+80102763:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010276a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102770 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80102770:	55                   	push   %ebp
+80102771:	89 e5                	mov    %esp,%ebp
+80102773:	53                   	push   %ebx
+80102774:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+
+  if(kmem.use_lock)
+80102777:	a1 74 26 11 80       	mov    0x80112674,%eax
+8010277c:	85 c0                	test   %eax,%eax
+8010277e:	75 20                	jne    801027a0 <kalloc+0x30>
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+80102780:	8b 1d 78 26 11 80    	mov    0x80112678,%ebx
+  if(r)
+80102786:	85 db                	test   %ebx,%ebx
+80102788:	74 07                	je     80102791 <kalloc+0x21>
+    kmem.freelist = r->next;
+8010278a:	8b 03                	mov    (%ebx),%eax
+8010278c:	a3 78 26 11 80       	mov    %eax,0x80112678
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+80102791:	89 d8                	mov    %ebx,%eax
+80102793:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102796:	c9                   	leave
+80102797:	c3                   	ret
+80102798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010279f:	90                   	nop
+    acquire(&kmem.lock);
+801027a0:	83 ec 0c             	sub    $0xc,%esp
+801027a3:	68 40 26 11 80       	push   $0x80112640
+801027a8:	e8 33 24 00 00       	call   80104be0 <acquire>
+  r = kmem.freelist;
+801027ad:	8b 1d 78 26 11 80    	mov    0x80112678,%ebx
+  if(kmem.use_lock)
+801027b3:	a1 74 26 11 80       	mov    0x80112674,%eax
+  if(r)
+801027b8:	83 c4 10             	add    $0x10,%esp
+801027bb:	85 db                	test   %ebx,%ebx
+801027bd:	74 08                	je     801027c7 <kalloc+0x57>
+    kmem.freelist = r->next;
+801027bf:	8b 13                	mov    (%ebx),%edx
+801027c1:	89 15 78 26 11 80    	mov    %edx,0x80112678
+  if(kmem.use_lock)
+801027c7:	85 c0                	test   %eax,%eax
+801027c9:	74 c6                	je     80102791 <kalloc+0x21>
+    release(&kmem.lock);
+801027cb:	83 ec 0c             	sub    $0xc,%esp
+801027ce:	68 40 26 11 80       	push   $0x80112640
+801027d3:	e8 a8 23 00 00       	call   80104b80 <release>
+}
+801027d8:	89 d8                	mov    %ebx,%eax
+    release(&kmem.lock);
+801027da:	83 c4 10             	add    $0x10,%esp
+}
+801027dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801027e0:	c9                   	leave
+801027e1:	c3                   	ret
+801027e2:	66 90                	xchg   %ax,%ax
+801027e4:	66 90                	xchg   %ax,%ax
+801027e6:	66 90                	xchg   %ax,%ax
+801027e8:	66 90                	xchg   %ax,%ax
+801027ea:	66 90                	xchg   %ax,%ax
+801027ec:	66 90                	xchg   %ax,%ax
+801027ee:	66 90                	xchg   %ax,%ax
+
+801027f0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801027f0:	ba 64 00 00 00       	mov    $0x64,%edx
+801027f5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+801027f6:	a8 01                	test   $0x1,%al
+801027f8:	0f 84 c2 00 00 00    	je     801028c0 <kbdgetc+0xd0>
+{
+801027fe:	55                   	push   %ebp
+801027ff:	ba 60 00 00 00       	mov    $0x60,%edx
+80102804:	89 e5                	mov    %esp,%ebp
+80102806:	53                   	push   %ebx
+80102807:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80102808:	8b 1d 7c 26 11 80    	mov    0x8011267c,%ebx
+  data = inb(KBDATAP);
+8010280e:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80102811:	3c e0                	cmp    $0xe0,%al
+80102813:	74 5b                	je     80102870 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102815:	89 da                	mov    %ebx,%edx
+80102817:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+8010281a:	84 c0                	test   %al,%al
+8010281c:	78 6a                	js     80102888 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+8010281e:	85 d2                	test   %edx,%edx
+80102820:	74 09                	je     8010282b <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80102822:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80102825:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80102828:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+8010282b:	0f b6 91 e0 82 10 80 	movzbl -0x7fef7d20(%ecx),%edx
+  shift ^= togglecode[data];
+80102832:	0f b6 81 e0 81 10 80 	movzbl -0x7fef7e20(%ecx),%eax
+  shift |= shiftcode[data];
+80102839:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+8010283b:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010283d:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+8010283f:	89 15 7c 26 11 80    	mov    %edx,0x8011267c
+  c = charcode[shift & (CTL | SHIFT)][data];
+80102845:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80102848:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010284b:	8b 04 85 c0 81 10 80 	mov    -0x7fef7e40(,%eax,4),%eax
+80102852:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80102856:	74 0b                	je     80102863 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80102858:	8d 50 9f             	lea    -0x61(%eax),%edx
+8010285b:	83 fa 19             	cmp    $0x19,%edx
+8010285e:	77 48                	ja     801028a8 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80102860:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80102863:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102866:	c9                   	leave
+80102867:	c3                   	ret
+80102868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010286f:	90                   	nop
+    shift |= E0ESC;
+80102870:	89 d8                	mov    %ebx,%eax
+80102872:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80102875:	a3 7c 26 11 80       	mov    %eax,0x8011267c
+    return 0;
+8010287a:	31 c0                	xor    %eax,%eax
+}
+8010287c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010287f:	c9                   	leave
+80102880:	c3                   	ret
+80102881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80102888:	83 e0 7f             	and    $0x7f,%eax
+8010288b:	85 d2                	test   %edx,%edx
+8010288d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80102890:	0f b6 81 e0 82 10 80 	movzbl -0x7fef7d20(%ecx),%eax
+80102897:	83 c8 40             	or     $0x40,%eax
+8010289a:	0f b6 c0             	movzbl %al,%eax
+8010289d:	f7 d0                	not    %eax
+8010289f:	21 d8                	and    %ebx,%eax
+    return 0;
+801028a1:	eb d2                	jmp    80102875 <kbdgetc+0x85>
+801028a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801028a7:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+801028a8:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+801028ab:	8d 50 20             	lea    0x20(%eax),%edx
+}
+801028ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801028b1:	c9                   	leave
+      c += 'a' - 'A';
+801028b2:	83 f9 1a             	cmp    $0x1a,%ecx
+801028b5:	0f 42 c2             	cmovb  %edx,%eax
+}
+801028b8:	c3                   	ret
+801028b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+801028c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801028c5:	c3                   	ret
+801028c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801028cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801028d0 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801028d0:	55                   	push   %ebp
+801028d1:	89 e5                	mov    %esp,%ebp
+801028d3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+801028d6:	68 f0 27 10 80       	push   $0x801027f0
+801028db:	e8 e0 df ff ff       	call   801008c0 <consoleintr>
+}
+801028e0:	83 c4 10             	add    $0x10,%esp
+801028e3:	c9                   	leave
+801028e4:	c3                   	ret
+801028e5:	66 90                	xchg   %ax,%ax
+801028e7:	66 90                	xchg   %ax,%ax
+801028e9:	66 90                	xchg   %ax,%ax
+801028eb:	66 90                	xchg   %ax,%ax
+801028ed:	66 90                	xchg   %ax,%ax
+801028ef:	90                   	nop
+
+801028f0 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+801028f0:	a1 80 26 11 80       	mov    0x80112680,%eax
+801028f5:	85 c0                	test   %eax,%eax
+801028f7:	0f 84 cb 00 00 00    	je     801029c8 <lapicinit+0xd8>
+  lapic[index] = value;
+801028fd:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80102904:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102907:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010290a:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80102911:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102914:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102917:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+8010291e:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102921:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102924:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+8010292b:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010292e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102931:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80102938:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010293b:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010293e:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80102945:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102948:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+8010294b:	8b 50 30             	mov    0x30(%eax),%edx
+8010294e:	c1 ea 10             	shr    $0x10,%edx
+80102951:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80102957:	75 77                	jne    801029d0 <lapicinit+0xe0>
+  lapic[index] = value;
+80102959:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80102960:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102963:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102966:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010296d:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102970:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102973:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010297a:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010297d:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102980:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80102987:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010298a:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010298d:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80102994:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102997:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010299a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+801029a1:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+801029a4:	8b 50 20             	mov    0x20(%eax),%edx
+801029a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029ae:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+801029b0:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+801029b6:	80 e6 10             	and    $0x10,%dh
+801029b9:	75 f5                	jne    801029b0 <lapicinit+0xc0>
+  lapic[index] = value;
+801029bb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+801029c2:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801029c5:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+801029c8:	c3                   	ret
+801029c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+801029d0:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+801029d7:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+801029da:	8b 50 20             	mov    0x20(%eax),%edx
+}
+801029dd:	e9 77 ff ff ff       	jmp    80102959 <lapicinit+0x69>
+801029e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801029f0 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+801029f0:	a1 80 26 11 80       	mov    0x80112680,%eax
+801029f5:	85 c0                	test   %eax,%eax
+801029f7:	74 07                	je     80102a00 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+801029f9:	8b 40 20             	mov    0x20(%eax),%eax
+801029fc:	c1 e8 18             	shr    $0x18,%eax
+801029ff:	c3                   	ret
+    return 0;
+80102a00:	31 c0                	xor    %eax,%eax
+}
+80102a02:	c3                   	ret
+80102a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102a10 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80102a10:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102a15:	85 c0                	test   %eax,%eax
+80102a17:	74 0d                	je     80102a26 <lapiceoi+0x16>
+  lapic[index] = value;
+80102a19:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80102a20:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102a23:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80102a26:	c3                   	ret
+80102a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a2e:	66 90                	xchg   %ax,%ax
+
+80102a30 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80102a30:	c3                   	ret
+80102a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a3f:	90                   	nop
+
+80102a40 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80102a40:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102a41:	b8 0f 00 00 00       	mov    $0xf,%eax
+80102a46:	ba 70 00 00 00       	mov    $0x70,%edx
+80102a4b:	89 e5                	mov    %esp,%ebp
+80102a4d:	53                   	push   %ebx
+80102a4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102a51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102a54:	ee                   	out    %al,(%dx)
+80102a55:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102a5a:	ba 71 00 00 00       	mov    $0x71,%edx
+80102a5f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80102a60:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80102a62:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80102a65:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+80102a6b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102a6d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80102a70:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80102a72:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80102a75:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80102a78:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+80102a7e:	a1 80 26 11 80       	mov    0x80112680,%eax
+80102a83:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102a89:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102a8c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80102a93:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102a96:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102a99:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80102aa0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80102aa3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102aa6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102aac:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102aaf:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ab5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80102ab8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102abe:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80102ac1:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80102ac7:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+80102aca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102acd:	c9                   	leave
+80102ace:	c3                   	ret
+80102acf:	90                   	nop
+
+80102ad0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80102ad0:	55                   	push   %ebp
+80102ad1:	b8 0b 00 00 00       	mov    $0xb,%eax
+80102ad6:	ba 70 00 00 00       	mov    $0x70,%edx
+80102adb:	89 e5                	mov    %esp,%ebp
+80102add:	57                   	push   %edi
+80102ade:	56                   	push   %esi
+80102adf:	53                   	push   %ebx
+80102ae0:	83 ec 4c             	sub    $0x4c,%esp
+80102ae3:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ae4:	ba 71 00 00 00       	mov    $0x71,%edx
+80102ae9:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80102aea:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102aed:	bf 70 00 00 00       	mov    $0x70,%edi
+80102af2:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80102af5:	8d 76 00             	lea    0x0(%esi),%esi
+80102af8:	31 c0                	xor    %eax,%eax
+80102afa:	89 fa                	mov    %edi,%edx
+80102afc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102afd:	b9 71 00 00 00       	mov    $0x71,%ecx
+80102b02:	89 ca                	mov    %ecx,%edx
+80102b04:	ec                   	in     (%dx),%al
+80102b05:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b08:	89 fa                	mov    %edi,%edx
+80102b0a:	b8 02 00 00 00       	mov    $0x2,%eax
+80102b0f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b10:	89 ca                	mov    %ecx,%edx
+80102b12:	ec                   	in     (%dx),%al
+80102b13:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b16:	89 fa                	mov    %edi,%edx
+80102b18:	b8 04 00 00 00       	mov    $0x4,%eax
+80102b1d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b1e:	89 ca                	mov    %ecx,%edx
+80102b20:	ec                   	in     (%dx),%al
+80102b21:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b24:	89 fa                	mov    %edi,%edx
+80102b26:	b8 07 00 00 00       	mov    $0x7,%eax
+80102b2b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b2c:	89 ca                	mov    %ecx,%edx
+80102b2e:	ec                   	in     (%dx),%al
+80102b2f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b32:	89 fa                	mov    %edi,%edx
+80102b34:	b8 08 00 00 00       	mov    $0x8,%eax
+80102b39:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b3a:	89 ca                	mov    %ecx,%edx
+80102b3c:	ec                   	in     (%dx),%al
+80102b3d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b3f:	89 fa                	mov    %edi,%edx
+80102b41:	b8 09 00 00 00       	mov    $0x9,%eax
+80102b46:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b47:	89 ca                	mov    %ecx,%edx
+80102b49:	ec                   	in     (%dx),%al
+80102b4a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b4d:	89 fa                	mov    %edi,%edx
+80102b4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80102b54:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b55:	89 ca                	mov    %ecx,%edx
+80102b57:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80102b58:	84 c0                	test   %al,%al
+80102b5a:	78 9c                	js     80102af8 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+80102b5c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80102b60:	89 f2                	mov    %esi,%edx
+80102b62:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80102b65:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b68:	89 fa                	mov    %edi,%edx
+80102b6a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+80102b6d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80102b71:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80102b74:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80102b77:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+80102b7b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80102b7e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80102b82:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80102b85:	31 c0                	xor    %eax,%eax
+80102b87:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b88:	89 ca                	mov    %ecx,%edx
+80102b8a:	ec                   	in     (%dx),%al
+80102b8b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b8e:	89 fa                	mov    %edi,%edx
+80102b90:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80102b93:	b8 02 00 00 00       	mov    $0x2,%eax
+80102b98:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b99:	89 ca                	mov    %ecx,%edx
+80102b9b:	ec                   	in     (%dx),%al
+80102b9c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b9f:	89 fa                	mov    %edi,%edx
+80102ba1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80102ba4:	b8 04 00 00 00       	mov    $0x4,%eax
+80102ba9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102baa:	89 ca                	mov    %ecx,%edx
+80102bac:	ec                   	in     (%dx),%al
+80102bad:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bb0:	89 fa                	mov    %edi,%edx
+80102bb2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102bb5:	b8 07 00 00 00       	mov    $0x7,%eax
+80102bba:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bbb:	89 ca                	mov    %ecx,%edx
+80102bbd:	ec                   	in     (%dx),%al
+80102bbe:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bc1:	89 fa                	mov    %edi,%edx
+80102bc3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102bc6:	b8 08 00 00 00       	mov    $0x8,%eax
+80102bcb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bcc:	89 ca                	mov    %ecx,%edx
+80102bce:	ec                   	in     (%dx),%al
+80102bcf:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bd2:	89 fa                	mov    %edi,%edx
+80102bd4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102bd7:	b8 09 00 00 00       	mov    $0x9,%eax
+80102bdc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bdd:	89 ca                	mov    %ecx,%edx
+80102bdf:	ec                   	in     (%dx),%al
+80102be0:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80102be3:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80102be6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80102be9:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80102bec:	6a 18                	push   $0x18
+80102bee:	50                   	push   %eax
+80102bef:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80102bf2:	50                   	push   %eax
+80102bf3:	e8 08 21 00 00       	call   80104d00 <memcmp>
+80102bf8:	83 c4 10             	add    $0x10,%esp
+80102bfb:	85 c0                	test   %eax,%eax
+80102bfd:	0f 85 f5 fe ff ff    	jne    80102af8 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80102c03:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80102c07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102c0a:	89 f0                	mov    %esi,%eax
+80102c0c:	84 c0                	test   %al,%al
+80102c0e:	75 78                	jne    80102c88 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80102c10:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102c13:	89 c2                	mov    %eax,%edx
+80102c15:	83 e0 0f             	and    $0xf,%eax
+80102c18:	c1 ea 04             	shr    $0x4,%edx
+80102c1b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c1e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c21:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80102c24:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102c27:	89 c2                	mov    %eax,%edx
+80102c29:	83 e0 0f             	and    $0xf,%eax
+80102c2c:	c1 ea 04             	shr    $0x4,%edx
+80102c2f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c32:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c35:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80102c38:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102c3b:	89 c2                	mov    %eax,%edx
+80102c3d:	83 e0 0f             	and    $0xf,%eax
+80102c40:	c1 ea 04             	shr    $0x4,%edx
+80102c43:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c46:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c49:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+80102c4c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80102c4f:	89 c2                	mov    %eax,%edx
+80102c51:	83 e0 0f             	and    $0xf,%eax
+80102c54:	c1 ea 04             	shr    $0x4,%edx
+80102c57:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c5a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c5d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80102c60:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80102c63:	89 c2                	mov    %eax,%edx
+80102c65:	83 e0 0f             	and    $0xf,%eax
+80102c68:	c1 ea 04             	shr    $0x4,%edx
+80102c6b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c6e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c71:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80102c74:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102c77:	89 c2                	mov    %eax,%edx
+80102c79:	83 e0 0f             	and    $0xf,%eax
+80102c7c:	c1 ea 04             	shr    $0x4,%edx
+80102c7f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80102c82:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80102c85:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80102c88:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102c8b:	89 03                	mov    %eax,(%ebx)
+80102c8d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102c90:	89 43 04             	mov    %eax,0x4(%ebx)
+80102c93:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102c96:	89 43 08             	mov    %eax,0x8(%ebx)
+80102c99:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80102c9c:	89 43 0c             	mov    %eax,0xc(%ebx)
+80102c9f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80102ca2:	89 43 10             	mov    %eax,0x10(%ebx)
+80102ca5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102ca8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+80102cab:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80102cb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cb5:	5b                   	pop    %ebx
+80102cb6:	5e                   	pop    %esi
+80102cb7:	5f                   	pop    %edi
+80102cb8:	5d                   	pop    %ebp
+80102cb9:	c3                   	ret
+80102cba:	66 90                	xchg   %ax,%ax
+80102cbc:	66 90                	xchg   %ax,%ax
+80102cbe:	66 90                	xchg   %ax,%ax
+
+80102cc0 <install_trans>:
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102cc0:	8b 0d e8 26 11 80    	mov    0x801126e8,%ecx
+80102cc6:	85 c9                	test   %ecx,%ecx
+80102cc8:	0f 8e 8a 00 00 00    	jle    80102d58 <install_trans+0x98>
+{
+80102cce:	55                   	push   %ebp
+80102ccf:	89 e5                	mov    %esp,%ebp
+80102cd1:	57                   	push   %edi
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102cd2:	31 ff                	xor    %edi,%edi
+{
+80102cd4:	56                   	push   %esi
+80102cd5:	53                   	push   %ebx
+80102cd6:	83 ec 0c             	sub    $0xc,%esp
+80102cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80102ce0:	a1 d4 26 11 80       	mov    0x801126d4,%eax
+80102ce5:	83 ec 08             	sub    $0x8,%esp
+80102ce8:	01 f8                	add    %edi,%eax
+80102cea:	83 c0 01             	add    $0x1,%eax
+80102ced:	50                   	push   %eax
+80102cee:	ff 35 e4 26 11 80    	push   0x801126e4
+80102cf4:	e8 d7 d3 ff ff       	call   801000d0 <bread>
+80102cf9:	89 c6                	mov    %eax,%esi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102cfb:	58                   	pop    %eax
+80102cfc:	5a                   	pop    %edx
+80102cfd:	ff 34 bd ec 26 11 80 	push   -0x7feed914(,%edi,4)
+80102d04:	ff 35 e4 26 11 80    	push   0x801126e4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102d0a:	83 c7 01             	add    $0x1,%edi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102d0d:	e8 be d3 ff ff       	call   801000d0 <bread>
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102d12:	83 c4 0c             	add    $0xc,%esp
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80102d15:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80102d17:	8d 46 5c             	lea    0x5c(%esi),%eax
+80102d1a:	68 00 02 00 00       	push   $0x200
+80102d1f:	50                   	push   %eax
+80102d20:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80102d23:	50                   	push   %eax
+80102d24:	e8 27 20 00 00       	call   80104d50 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80102d29:	89 1c 24             	mov    %ebx,(%esp)
+80102d2c:	e8 7f d4 ff ff       	call   801001b0 <bwrite>
+    brelse(lbuf);
+80102d31:	89 34 24             	mov    %esi,(%esp)
+80102d34:	e8 b7 d4 ff ff       	call   801001f0 <brelse>
+    brelse(dbuf);
+80102d39:	89 1c 24             	mov    %ebx,(%esp)
+80102d3c:	e8 af d4 ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102d41:	83 c4 10             	add    $0x10,%esp
+80102d44:	39 3d e8 26 11 80    	cmp    %edi,0x801126e8
+80102d4a:	7f 94                	jg     80102ce0 <install_trans+0x20>
+  }
+}
+80102d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d4f:	5b                   	pop    %ebx
+80102d50:	5e                   	pop    %esi
+80102d51:	5f                   	pop    %edi
+80102d52:	5d                   	pop    %ebp
+80102d53:	c3                   	ret
+80102d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d58:	c3                   	ret
+80102d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102d60 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80102d60:	55                   	push   %ebp
+80102d61:	89 e5                	mov    %esp,%ebp
+80102d63:	53                   	push   %ebx
+80102d64:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80102d67:	ff 35 d4 26 11 80    	push   0x801126d4
+80102d6d:	ff 35 e4 26 11 80    	push   0x801126e4
+80102d73:	e8 58 d3 ff ff       	call   801000d0 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+80102d78:	83 c4 10             	add    $0x10,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80102d7b:	89 c3                	mov    %eax,%ebx
+  hb->n = log.lh.n;
+80102d7d:	a1 e8 26 11 80       	mov    0x801126e8,%eax
+80102d82:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+80102d85:	85 c0                	test   %eax,%eax
+80102d87:	7e 19                	jle    80102da2 <write_head+0x42>
+80102d89:	31 d2                	xor    %edx,%edx
+80102d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d8f:	90                   	nop
+    hb->block[i] = log.lh.block[i];
+80102d90:	8b 0c 95 ec 26 11 80 	mov    -0x7feed914(,%edx,4),%ecx
+80102d97:	89 4c 93 60          	mov    %ecx,0x60(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102d9b:	83 c2 01             	add    $0x1,%edx
+80102d9e:	39 d0                	cmp    %edx,%eax
+80102da0:	75 ee                	jne    80102d90 <write_head+0x30>
+  }
+  bwrite(buf);
+80102da2:	83 ec 0c             	sub    $0xc,%esp
+80102da5:	53                   	push   %ebx
+80102da6:	e8 05 d4 ff ff       	call   801001b0 <bwrite>
+  brelse(buf);
+80102dab:	89 1c 24             	mov    %ebx,(%esp)
+80102dae:	e8 3d d4 ff ff       	call   801001f0 <brelse>
+}
+80102db3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102db6:	83 c4 10             	add    $0x10,%esp
+80102db9:	c9                   	leave
+80102dba:	c3                   	ret
+80102dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102dbf:	90                   	nop
+
+80102dc0 <initlog>:
+{
+80102dc0:	55                   	push   %ebp
+80102dc1:	89 e5                	mov    %esp,%ebp
+80102dc3:	53                   	push   %ebx
+80102dc4:	83 ec 2c             	sub    $0x2c,%esp
+80102dc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80102dca:	68 e0 83 10 80       	push   $0x801083e0
+80102dcf:	68 a0 26 11 80       	push   $0x801126a0
+80102dd4:	e8 27 1c 00 00       	call   80104a00 <initlock>
+  readsb(dev, &sb);
+80102dd9:	58                   	pop    %eax
+80102dda:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80102ddd:	5a                   	pop    %edx
+80102dde:	50                   	push   %eax
+80102ddf:	53                   	push   %ebx
+80102de0:	e8 1b e8 ff ff       	call   80101600 <readsb>
+  log.size = sb.nlog;
+80102de5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80102de8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+80102deb:	89 1d e4 26 11 80    	mov    %ebx,0x801126e4
+  log.start = sb.logstart;
+80102df1:	a3 d4 26 11 80       	mov    %eax,0x801126d4
+  log.size = sb.nlog;
+80102df6:	89 15 d8 26 11 80    	mov    %edx,0x801126d8
+  struct buf *buf = bread(log.dev, log.start);
+80102dfc:	59                   	pop    %ecx
+80102dfd:	5a                   	pop    %edx
+80102dfe:	50                   	push   %eax
+80102dff:	53                   	push   %ebx
+80102e00:	e8 cb d2 ff ff       	call   801000d0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80102e05:	83 c4 10             	add    $0x10,%esp
+  log.lh.n = lh->n;
+80102e08:	8b 58 5c             	mov    0x5c(%eax),%ebx
+80102e0b:	89 1d e8 26 11 80    	mov    %ebx,0x801126e8
+  for (i = 0; i < log.lh.n; i++) {
+80102e11:	85 db                	test   %ebx,%ebx
+80102e13:	7e 1d                	jle    80102e32 <initlog+0x72>
+80102e15:	31 d2                	xor    %edx,%edx
+80102e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e1e:	66 90                	xchg   %ax,%ax
+    log.lh.block[i] = lh->block[i];
+80102e20:	8b 4c 90 60          	mov    0x60(%eax,%edx,4),%ecx
+80102e24:	89 0c 95 ec 26 11 80 	mov    %ecx,-0x7feed914(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80102e2b:	83 c2 01             	add    $0x1,%edx
+80102e2e:	39 d3                	cmp    %edx,%ebx
+80102e30:	75 ee                	jne    80102e20 <initlog+0x60>
+  brelse(buf);
+80102e32:	83 ec 0c             	sub    $0xc,%esp
+80102e35:	50                   	push   %eax
+80102e36:	e8 b5 d3 ff ff       	call   801001f0 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+80102e3b:	e8 80 fe ff ff       	call   80102cc0 <install_trans>
+  log.lh.n = 0;
+80102e40:	c7 05 e8 26 11 80 00 	movl   $0x0,0x801126e8
+80102e47:	00 00 00 
+  write_head(); // clear the log
+80102e4a:	e8 11 ff ff ff       	call   80102d60 <write_head>
+}
+80102e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102e52:	83 c4 10             	add    $0x10,%esp
+80102e55:	c9                   	leave
+80102e56:	c3                   	ret
+80102e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e5e:	66 90                	xchg   %ax,%ax
+
+80102e60 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+80102e60:	55                   	push   %ebp
+80102e61:	89 e5                	mov    %esp,%ebp
+80102e63:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80102e66:	68 a0 26 11 80       	push   $0x801126a0
+80102e6b:	e8 70 1d 00 00       	call   80104be0 <acquire>
+80102e70:	83 c4 10             	add    $0x10,%esp
+80102e73:	eb 18                	jmp    80102e8d <begin_op+0x2d>
+80102e75:	8d 76 00             	lea    0x0(%esi),%esi
+  while(1){
+    if(log.committing){
+      sleep(&log, &log.lock);
+80102e78:	83 ec 08             	sub    $0x8,%esp
+80102e7b:	68 a0 26 11 80       	push   $0x801126a0
+80102e80:	68 a0 26 11 80       	push   $0x801126a0
+80102e85:	e8 66 15 00 00       	call   801043f0 <sleep>
+80102e8a:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80102e8d:	a1 e0 26 11 80       	mov    0x801126e0,%eax
+80102e92:	85 c0                	test   %eax,%eax
+80102e94:	75 e2                	jne    80102e78 <begin_op+0x18>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80102e96:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+80102e9b:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+80102ea1:	83 c0 01             	add    $0x1,%eax
+80102ea4:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80102ea7:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80102eaa:	83 fa 1e             	cmp    $0x1e,%edx
+80102ead:	7f c9                	jg     80102e78 <begin_op+0x18>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+80102eaf:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80102eb2:	a3 dc 26 11 80       	mov    %eax,0x801126dc
+      release(&log.lock);
+80102eb7:	68 a0 26 11 80       	push   $0x801126a0
+80102ebc:	e8 bf 1c 00 00       	call   80104b80 <release>
+      break;
+    }
+  }
+}
+80102ec1:	83 c4 10             	add    $0x10,%esp
+80102ec4:	c9                   	leave
+80102ec5:	c3                   	ret
+80102ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102ed0 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+80102ed0:	55                   	push   %ebp
+80102ed1:	89 e5                	mov    %esp,%ebp
+80102ed3:	57                   	push   %edi
+80102ed4:	56                   	push   %esi
+80102ed5:	53                   	push   %ebx
+80102ed6:	83 ec 18             	sub    $0x18,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+80102ed9:	68 a0 26 11 80       	push   $0x801126a0
+80102ede:	e8 fd 1c 00 00       	call   80104be0 <acquire>
+  log.outstanding -= 1;
+80102ee3:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+  if(log.committing)
+80102ee8:	8b 35 e0 26 11 80    	mov    0x801126e0,%esi
+80102eee:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+80102ef1:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80102ef4:	89 1d dc 26 11 80    	mov    %ebx,0x801126dc
+  if(log.committing)
+80102efa:	85 f6                	test   %esi,%esi
+80102efc:	0f 85 22 01 00 00    	jne    80103024 <end_op+0x154>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80102f02:	85 db                	test   %ebx,%ebx
+80102f04:	0f 85 f6 00 00 00    	jne    80103000 <end_op+0x130>
+    do_commit = 1;
+    log.committing = 1;
+80102f0a:	c7 05 e0 26 11 80 01 	movl   $0x1,0x801126e0
+80102f11:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80102f14:	83 ec 0c             	sub    $0xc,%esp
+80102f17:	68 a0 26 11 80       	push   $0x801126a0
+80102f1c:	e8 5f 1c 00 00       	call   80104b80 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80102f21:	8b 0d e8 26 11 80    	mov    0x801126e8,%ecx
+80102f27:	83 c4 10             	add    $0x10,%esp
+80102f2a:	85 c9                	test   %ecx,%ecx
+80102f2c:	7f 42                	jg     80102f70 <end_op+0xa0>
+    acquire(&log.lock);
+80102f2e:	83 ec 0c             	sub    $0xc,%esp
+80102f31:	68 a0 26 11 80       	push   $0x801126a0
+80102f36:	e8 a5 1c 00 00       	call   80104be0 <acquire>
+    log.committing = 0;
+80102f3b:	c7 05 e0 26 11 80 00 	movl   $0x0,0x801126e0
+80102f42:	00 00 00 
+    wakeup(&log);
+80102f45:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80102f4c:	e8 4f 16 00 00       	call   801045a0 <wakeup>
+    release(&log.lock);
+80102f51:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80102f58:	e8 23 1c 00 00       	call   80104b80 <release>
+80102f5d:	83 c4 10             	add    $0x10,%esp
+}
+80102f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f63:	5b                   	pop    %ebx
+80102f64:	5e                   	pop    %esi
+80102f65:	5f                   	pop    %edi
+80102f66:	5d                   	pop    %ebp
+80102f67:	c3                   	ret
+80102f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f6f:	90                   	nop
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80102f70:	a1 d4 26 11 80       	mov    0x801126d4,%eax
+80102f75:	83 ec 08             	sub    $0x8,%esp
+80102f78:	01 d8                	add    %ebx,%eax
+80102f7a:	83 c0 01             	add    $0x1,%eax
+80102f7d:	50                   	push   %eax
+80102f7e:	ff 35 e4 26 11 80    	push   0x801126e4
+80102f84:	e8 47 d1 ff ff       	call   801000d0 <bread>
+80102f89:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102f8b:	58                   	pop    %eax
+80102f8c:	5a                   	pop    %edx
+80102f8d:	ff 34 9d ec 26 11 80 	push   -0x7feed914(,%ebx,4)
+80102f94:	ff 35 e4 26 11 80    	push   0x801126e4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102f9a:	83 c3 01             	add    $0x1,%ebx
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102f9d:	e8 2e d1 ff ff       	call   801000d0 <bread>
+    memmove(to->data, from->data, BSIZE);
+80102fa2:	83 c4 0c             	add    $0xc,%esp
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80102fa5:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+80102fa7:	8d 40 5c             	lea    0x5c(%eax),%eax
+80102faa:	68 00 02 00 00       	push   $0x200
+80102faf:	50                   	push   %eax
+80102fb0:	8d 46 5c             	lea    0x5c(%esi),%eax
+80102fb3:	50                   	push   %eax
+80102fb4:	e8 97 1d 00 00       	call   80104d50 <memmove>
+    bwrite(to);  // write the log
+80102fb9:	89 34 24             	mov    %esi,(%esp)
+80102fbc:	e8 ef d1 ff ff       	call   801001b0 <bwrite>
+    brelse(from);
+80102fc1:	89 3c 24             	mov    %edi,(%esp)
+80102fc4:	e8 27 d2 ff ff       	call   801001f0 <brelse>
+    brelse(to);
+80102fc9:	89 34 24             	mov    %esi,(%esp)
+80102fcc:	e8 1f d2 ff ff       	call   801001f0 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80102fd1:	83 c4 10             	add    $0x10,%esp
+80102fd4:	3b 1d e8 26 11 80    	cmp    0x801126e8,%ebx
+80102fda:	7c 94                	jl     80102f70 <end_op+0xa0>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+80102fdc:	e8 7f fd ff ff       	call   80102d60 <write_head>
+    install_trans(); // Now install writes to home locations
+80102fe1:	e8 da fc ff ff       	call   80102cc0 <install_trans>
+    log.lh.n = 0;
+80102fe6:	c7 05 e8 26 11 80 00 	movl   $0x0,0x801126e8
+80102fed:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80102ff0:	e8 6b fd ff ff       	call   80102d60 <write_head>
+80102ff5:	e9 34 ff ff ff       	jmp    80102f2e <end_op+0x5e>
+80102ffa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&log);
+80103000:	83 ec 0c             	sub    $0xc,%esp
+80103003:	68 a0 26 11 80       	push   $0x801126a0
+80103008:	e8 93 15 00 00       	call   801045a0 <wakeup>
+  release(&log.lock);
+8010300d:	c7 04 24 a0 26 11 80 	movl   $0x801126a0,(%esp)
+80103014:	e8 67 1b 00 00       	call   80104b80 <release>
+80103019:	83 c4 10             	add    $0x10,%esp
+}
+8010301c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010301f:	5b                   	pop    %ebx
+80103020:	5e                   	pop    %esi
+80103021:	5f                   	pop    %edi
+80103022:	5d                   	pop    %ebp
+80103023:	c3                   	ret
+    panic("log.committing");
+80103024:	83 ec 0c             	sub    $0xc,%esp
+80103027:	68 e4 83 10 80       	push   $0x801083e4
+8010302c:	e8 4f d3 ff ff       	call   80100380 <panic>
+80103031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010303f:	90                   	nop
+
+80103040 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80103040:	55                   	push   %ebp
+80103041:	89 e5                	mov    %esp,%ebp
+80103043:	53                   	push   %ebx
+80103044:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103047:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+{
+8010304d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103050:	83 fa 1d             	cmp    $0x1d,%edx
+80103053:	7f 7d                	jg     801030d2 <log_write+0x92>
+80103055:	a1 d8 26 11 80       	mov    0x801126d8,%eax
+8010305a:	83 e8 01             	sub    $0x1,%eax
+8010305d:	39 c2                	cmp    %eax,%edx
+8010305f:	7d 71                	jge    801030d2 <log_write+0x92>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80103061:	a1 dc 26 11 80       	mov    0x801126dc,%eax
+80103066:	85 c0                	test   %eax,%eax
+80103068:	7e 75                	jle    801030df <log_write+0x9f>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010306a:	83 ec 0c             	sub    $0xc,%esp
+8010306d:	68 a0 26 11 80       	push   $0x801126a0
+80103072:	e8 69 1b 00 00       	call   80104be0 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103077:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+8010307a:	83 c4 10             	add    $0x10,%esp
+8010307d:	31 c0                	xor    %eax,%eax
+8010307f:	8b 15 e8 26 11 80    	mov    0x801126e8,%edx
+80103085:	85 d2                	test   %edx,%edx
+80103087:	7f 0e                	jg     80103097 <log_write+0x57>
+80103089:	eb 15                	jmp    801030a0 <log_write+0x60>
+8010308b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010308f:	90                   	nop
+80103090:	83 c0 01             	add    $0x1,%eax
+80103093:	39 c2                	cmp    %eax,%edx
+80103095:	74 29                	je     801030c0 <log_write+0x80>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103097:	39 0c 85 ec 26 11 80 	cmp    %ecx,-0x7feed914(,%eax,4)
+8010309e:	75 f0                	jne    80103090 <log_write+0x50>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+801030a0:	89 0c 85 ec 26 11 80 	mov    %ecx,-0x7feed914(,%eax,4)
+  if (i == log.lh.n)
+801030a7:	39 c2                	cmp    %eax,%edx
+801030a9:	74 1c                	je     801030c7 <log_write+0x87>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801030ab:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+801030ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+801030b1:	c7 45 08 a0 26 11 80 	movl   $0x801126a0,0x8(%ebp)
+}
+801030b8:	c9                   	leave
+  release(&log.lock);
+801030b9:	e9 c2 1a 00 00       	jmp    80104b80 <release>
+801030be:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+801030c0:	89 0c 95 ec 26 11 80 	mov    %ecx,-0x7feed914(,%edx,4)
+    log.lh.n++;
+801030c7:	83 c2 01             	add    $0x1,%edx
+801030ca:	89 15 e8 26 11 80    	mov    %edx,0x801126e8
+801030d0:	eb d9                	jmp    801030ab <log_write+0x6b>
+    panic("too big a transaction");
+801030d2:	83 ec 0c             	sub    $0xc,%esp
+801030d5:	68 f3 83 10 80       	push   $0x801083f3
+801030da:	e8 a1 d2 ff ff       	call   80100380 <panic>
+    panic("log_write outside of trans");
+801030df:	83 ec 0c             	sub    $0xc,%esp
+801030e2:	68 09 84 10 80       	push   $0x80108409
+801030e7:	e8 94 d2 ff ff       	call   80100380 <panic>
+801030ec:	66 90                	xchg   %ax,%ax
+801030ee:	66 90                	xchg   %ax,%ax
+
+801030f0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801030f0:	55                   	push   %ebp
+801030f1:	89 e5                	mov    %esp,%ebp
+801030f3:	53                   	push   %ebx
+801030f4:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801030f7:	e8 94 08 00 00       	call   80103990 <cpuid>
+801030fc:	89 c3                	mov    %eax,%ebx
+801030fe:	e8 8d 08 00 00       	call   80103990 <cpuid>
+80103103:	83 ec 04             	sub    $0x4,%esp
+80103106:	53                   	push   %ebx
+80103107:	50                   	push   %eax
+80103108:	68 24 84 10 80       	push   $0x80108424
+8010310d:	e8 9e d5 ff ff       	call   801006b0 <cprintf>
+  idtinit();       // load idt register
+80103112:	e8 29 35 00 00       	call   80106640 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80103117:	e8 14 08 00 00       	call   80103930 <mycpu>
+8010311c:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+8010311e:	b8 01 00 00 00       	mov    $0x1,%eax
+80103123:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+8010312a:	e8 51 0f 00 00       	call   80104080 <scheduler>
+8010312f:	90                   	nop
+
+80103130 <mpenter>:
+{
+80103130:	55                   	push   %ebp
+80103131:	89 e5                	mov    %esp,%ebp
+80103133:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80103136:	e8 45 46 00 00       	call   80107780 <switchkvm>
+  seginit();
+8010313b:	e8 b0 45 00 00       	call   801076f0 <seginit>
+  lapicinit();
+80103140:	e8 ab f7 ff ff       	call   801028f0 <lapicinit>
+  mpmain();
+80103145:	e8 a6 ff ff ff       	call   801030f0 <mpmain>
+8010314a:	66 90                	xchg   %ax,%ax
+8010314c:	66 90                	xchg   %ax,%ax
+8010314e:	66 90                	xchg   %ax,%ax
+
+80103150 <main>:
+{
+80103150:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80103154:	83 e4 f0             	and    $0xfffffff0,%esp
+80103157:	ff 71 fc             	push   -0x4(%ecx)
+8010315a:	55                   	push   %ebp
+8010315b:	89 e5                	mov    %esp,%ebp
+8010315d:	53                   	push   %ebx
+8010315e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+8010315f:	83 ec 08             	sub    $0x8,%esp
+80103162:	68 00 00 40 80       	push   $0x80400000
+80103167:	68 f0 91 11 80       	push   $0x801191f0
+8010316c:	e8 8f f5 ff ff       	call   80102700 <kinit1>
+  kvmalloc();      // kernel page table
+80103171:	e8 ca 4a 00 00       	call   80107c40 <kvmalloc>
+  mpinit();        // detect other processors
+80103176:	e8 85 01 00 00       	call   80103300 <mpinit>
+  lapicinit();     // interrupt controller
+8010317b:	e8 70 f7 ff ff       	call   801028f0 <lapicinit>
+  seginit();       // segment descriptors
+80103180:	e8 6b 45 00 00       	call   801076f0 <seginit>
+  picinit();       // disable pic
+80103185:	e8 86 03 00 00       	call   80103510 <picinit>
+  ioapicinit();    // another interrupt controller
+8010318a:	e8 41 f3 ff ff       	call   801024d0 <ioapicinit>
+  consoleinit();   // console hardware
+8010318f:	e8 fc d8 ff ff       	call   80100a90 <consoleinit>
+  uartinit();      // serial port
+80103194:	e8 c7 37 00 00       	call   80106960 <uartinit>
+  pinit();         // process table
+80103199:	e8 72 07 00 00       	call   80103910 <pinit>
+  tvinit();        // trap vectors
+8010319e:	e8 1d 34 00 00       	call   801065c0 <tvinit>
+  binit();         // buffer cache
+801031a3:	e8 98 ce ff ff       	call   80100040 <binit>
+  fileinit();      // file table
+801031a8:	e8 43 dd ff ff       	call   80100ef0 <fileinit>
+  ideinit();       // disk 
+801031ad:	e8 fe f0 ff ff       	call   801022b0 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801031b2:	83 c4 0c             	add    $0xc,%esp
+801031b5:	68 8a 00 00 00       	push   $0x8a
+801031ba:	68 8c b4 10 80       	push   $0x8010b48c
+801031bf:	68 00 70 00 80       	push   $0x80007000
+801031c4:	e8 87 1b 00 00       	call   80104d50 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801031c9:	83 c4 10             	add    $0x10,%esp
+801031cc:	69 05 84 27 11 80 b0 	imul   $0xb0,0x80112784,%eax
+801031d3:	00 00 00 
+801031d6:	05 a0 27 11 80       	add    $0x801127a0,%eax
+801031db:	3d a0 27 11 80       	cmp    $0x801127a0,%eax
+801031e0:	76 7e                	jbe    80103260 <main+0x110>
+801031e2:	bb a0 27 11 80       	mov    $0x801127a0,%ebx
+801031e7:	eb 20                	jmp    80103209 <main+0xb9>
+801031e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801031f0:	69 05 84 27 11 80 b0 	imul   $0xb0,0x80112784,%eax
+801031f7:	00 00 00 
+801031fa:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+80103200:	05 a0 27 11 80       	add    $0x801127a0,%eax
+80103205:	39 c3                	cmp    %eax,%ebx
+80103207:	73 57                	jae    80103260 <main+0x110>
+    if(c == mycpu())  // We've started already.
+80103209:	e8 22 07 00 00       	call   80103930 <mycpu>
+8010320e:	39 c3                	cmp    %eax,%ebx
+80103210:	74 de                	je     801031f0 <main+0xa0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80103212:	e8 59 f5 ff ff       	call   80102770 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80103217:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+8010321a:	c7 05 f8 6f 00 80 30 	movl   $0x80103130,0x80006ff8
+80103221:	31 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80103224:	c7 05 f4 6f 00 80 00 	movl   $0x10a000,0x80006ff4
+8010322b:	a0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+8010322e:	05 00 10 00 00       	add    $0x1000,%eax
+80103233:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80103238:	0f b6 03             	movzbl (%ebx),%eax
+8010323b:	68 00 70 00 00       	push   $0x7000
+80103240:	50                   	push   %eax
+80103241:	e8 fa f7 ff ff       	call   80102a40 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80103246:	83 c4 10             	add    $0x10,%esp
+80103249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103250:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80103256:	85 c0                	test   %eax,%eax
+80103258:	74 f6                	je     80103250 <main+0x100>
+8010325a:	eb 94                	jmp    801031f0 <main+0xa0>
+8010325c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80103260:	83 ec 08             	sub    $0x8,%esp
+80103263:	68 00 00 00 8e       	push   $0x8e000000
+80103268:	68 00 00 40 80       	push   $0x80400000
+8010326d:	e8 2e f4 ff ff       	call   801026a0 <kinit2>
+  userinit();      // first user process
+80103272:	e8 89 0a 00 00       	call   80103d00 <userinit>
+  mpmain();        // finish this processor's setup
+80103277:	e8 74 fe ff ff       	call   801030f0 <mpmain>
+8010327c:	66 90                	xchg   %ax,%ax
+8010327e:	66 90                	xchg   %ax,%ax
+
+80103280 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80103280:	55                   	push   %ebp
+80103281:	89 e5                	mov    %esp,%ebp
+80103283:	57                   	push   %edi
+80103284:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80103285:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+8010328b:	53                   	push   %ebx
+  e = addr+len;
+8010328c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+8010328f:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80103292:	39 de                	cmp    %ebx,%esi
+80103294:	72 10                	jb     801032a6 <mpsearch1+0x26>
+80103296:	eb 50                	jmp    801032e8 <mpsearch1+0x68>
+80103298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010329f:	90                   	nop
+801032a0:	89 fe                	mov    %edi,%esi
+801032a2:	39 df                	cmp    %ebx,%edi
+801032a4:	73 42                	jae    801032e8 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801032a6:	83 ec 04             	sub    $0x4,%esp
+801032a9:	8d 7e 10             	lea    0x10(%esi),%edi
+801032ac:	6a 04                	push   $0x4
+801032ae:	68 38 84 10 80       	push   $0x80108438
+801032b3:	56                   	push   %esi
+801032b4:	e8 47 1a 00 00       	call   80104d00 <memcmp>
+801032b9:	83 c4 10             	add    $0x10,%esp
+801032bc:	85 c0                	test   %eax,%eax
+801032be:	75 e0                	jne    801032a0 <mpsearch1+0x20>
+801032c0:	89 f2                	mov    %esi,%edx
+801032c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+801032c8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801032cb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801032ce:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801032d0:	39 fa                	cmp    %edi,%edx
+801032d2:	75 f4                	jne    801032c8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801032d4:	84 c0                	test   %al,%al
+801032d6:	75 c8                	jne    801032a0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+801032d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801032db:	89 f0                	mov    %esi,%eax
+801032dd:	5b                   	pop    %ebx
+801032de:	5e                   	pop    %esi
+801032df:	5f                   	pop    %edi
+801032e0:	5d                   	pop    %ebp
+801032e1:	c3                   	ret
+801032e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801032e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801032eb:	31 f6                	xor    %esi,%esi
+}
+801032ed:	5b                   	pop    %ebx
+801032ee:	89 f0                	mov    %esi,%eax
+801032f0:	5e                   	pop    %esi
+801032f1:	5f                   	pop    %edi
+801032f2:	5d                   	pop    %ebp
+801032f3:	c3                   	ret
+801032f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801032fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801032ff:	90                   	nop
+
+80103300 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80103300:	55                   	push   %ebp
+80103301:	89 e5                	mov    %esp,%ebp
+80103303:	57                   	push   %edi
+80103304:	56                   	push   %esi
+80103305:	53                   	push   %ebx
+80103306:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80103309:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80103310:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80103317:	c1 e0 08             	shl    $0x8,%eax
+8010331a:	09 d0                	or     %edx,%eax
+8010331c:	c1 e0 04             	shl    $0x4,%eax
+8010331f:	75 1b                	jne    8010333c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80103321:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80103328:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010332f:	c1 e0 08             	shl    $0x8,%eax
+80103332:	09 d0                	or     %edx,%eax
+80103334:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80103337:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+8010333c:	ba 00 04 00 00       	mov    $0x400,%edx
+80103341:	e8 3a ff ff ff       	call   80103280 <mpsearch1>
+80103346:	89 c3                	mov    %eax,%ebx
+80103348:	85 c0                	test   %eax,%eax
+8010334a:	0f 84 50 01 00 00    	je     801034a0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80103350:	8b 73 04             	mov    0x4(%ebx),%esi
+80103353:	85 f6                	test   %esi,%esi
+80103355:	0f 84 35 01 00 00    	je     80103490 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010335b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+8010335e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103364:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80103367:	6a 04                	push   $0x4
+80103369:	68 3d 84 10 80       	push   $0x8010843d
+8010336e:	50                   	push   %eax
+8010336f:	e8 8c 19 00 00       	call   80104d00 <memcmp>
+80103374:	83 c4 10             	add    $0x10,%esp
+80103377:	85 c0                	test   %eax,%eax
+80103379:	0f 85 11 01 00 00    	jne    80103490 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+8010337f:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80103386:	3c 01                	cmp    $0x1,%al
+80103388:	74 08                	je     80103392 <mpinit+0x92>
+8010338a:	3c 04                	cmp    $0x4,%al
+8010338c:	0f 85 fe 00 00 00    	jne    80103490 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80103392:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80103399:	66 85 d2             	test   %dx,%dx
+8010339c:	74 22                	je     801033c0 <mpinit+0xc0>
+8010339e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+801033a1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+801033a3:	31 d2                	xor    %edx,%edx
+801033a5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801033a8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+801033af:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+801033b2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+801033b4:	39 c7                	cmp    %eax,%edi
+801033b6:	75 f0                	jne    801033a8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+801033b8:	84 d2                	test   %dl,%dl
+801033ba:	0f 85 d0 00 00 00    	jne    80103490 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+801033c0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801033c9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+801033cc:	a3 80 26 11 80       	mov    %eax,0x80112680
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033d1:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+801033d8:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+801033de:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801033e3:	01 d7                	add    %edx,%edi
+801033e5:	89 fa                	mov    %edi,%edx
+801033e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801033ee:	66 90                	xchg   %ax,%ax
+801033f0:	39 d0                	cmp    %edx,%eax
+801033f2:	73 15                	jae    80103409 <mpinit+0x109>
+    switch(*p){
+801033f4:	0f b6 08             	movzbl (%eax),%ecx
+801033f7:	80 f9 02             	cmp    $0x2,%cl
+801033fa:	74 54                	je     80103450 <mpinit+0x150>
+801033fc:	77 42                	ja     80103440 <mpinit+0x140>
+801033fe:	84 c9                	test   %cl,%cl
+80103400:	74 5e                	je     80103460 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80103402:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80103405:	39 d0                	cmp    %edx,%eax
+80103407:	72 eb                	jb     801033f4 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80103409:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010340c:	85 f6                	test   %esi,%esi
+8010340e:	0f 84 e1 00 00 00    	je     801034f5 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80103414:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80103418:	74 15                	je     8010342f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010341a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010341f:	ba 22 00 00 00       	mov    $0x22,%edx
+80103424:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103425:	ba 23 00 00 00       	mov    $0x23,%edx
+8010342a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010342b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010342e:	ee                   	out    %al,(%dx)
+  }
+}
+8010342f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103432:	5b                   	pop    %ebx
+80103433:	5e                   	pop    %esi
+80103434:	5f                   	pop    %edi
+80103435:	5d                   	pop    %ebp
+80103436:	c3                   	ret
+80103437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010343e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80103440:	83 e9 03             	sub    $0x3,%ecx
+80103443:	80 f9 01             	cmp    $0x1,%cl
+80103446:	76 ba                	jbe    80103402 <mpinit+0x102>
+80103448:	31 f6                	xor    %esi,%esi
+8010344a:	eb a4                	jmp    801033f0 <mpinit+0xf0>
+8010344c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80103450:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80103454:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80103457:	88 0d 80 27 11 80    	mov    %cl,0x80112780
+      continue;
+8010345d:	eb 91                	jmp    801033f0 <mpinit+0xf0>
+8010345f:	90                   	nop
+      if(ncpu < NCPU) {
+80103460:	8b 0d 84 27 11 80    	mov    0x80112784,%ecx
+80103466:	83 f9 07             	cmp    $0x7,%ecx
+80103469:	7f 19                	jg     80103484 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010346b:	69 f9 b0 00 00 00    	imul   $0xb0,%ecx,%edi
+80103471:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80103475:	83 c1 01             	add    $0x1,%ecx
+80103478:	89 0d 84 27 11 80    	mov    %ecx,0x80112784
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010347e:	88 9f a0 27 11 80    	mov    %bl,-0x7feed860(%edi)
+      p += sizeof(struct mpproc);
+80103484:	83 c0 14             	add    $0x14,%eax
+      continue;
+80103487:	e9 64 ff ff ff       	jmp    801033f0 <mpinit+0xf0>
+8010348c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80103490:	83 ec 0c             	sub    $0xc,%esp
+80103493:	68 42 84 10 80       	push   $0x80108442
+80103498:	e8 e3 ce ff ff       	call   80100380 <panic>
+8010349d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+801034a0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+801034a5:	eb 13                	jmp    801034ba <mpinit+0x1ba>
+801034a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034ae:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+801034b0:	89 f3                	mov    %esi,%ebx
+801034b2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+801034b8:	74 d6                	je     80103490 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801034ba:	83 ec 04             	sub    $0x4,%esp
+801034bd:	8d 73 10             	lea    0x10(%ebx),%esi
+801034c0:	6a 04                	push   $0x4
+801034c2:	68 38 84 10 80       	push   $0x80108438
+801034c7:	53                   	push   %ebx
+801034c8:	e8 33 18 00 00       	call   80104d00 <memcmp>
+801034cd:	83 c4 10             	add    $0x10,%esp
+801034d0:	85 c0                	test   %eax,%eax
+801034d2:	75 dc                	jne    801034b0 <mpinit+0x1b0>
+801034d4:	89 da                	mov    %ebx,%edx
+801034d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034dd:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801034e0:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801034e3:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801034e6:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801034e8:	39 f2                	cmp    %esi,%edx
+801034ea:	75 f4                	jne    801034e0 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801034ec:	84 c0                	test   %al,%al
+801034ee:	75 c0                	jne    801034b0 <mpinit+0x1b0>
+801034f0:	e9 5b fe ff ff       	jmp    80103350 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+801034f5:	83 ec 0c             	sub    $0xc,%esp
+801034f8:	68 5c 84 10 80       	push   $0x8010845c
+801034fd:	e8 7e ce ff ff       	call   80100380 <panic>
+80103502:	66 90                	xchg   %ax,%ax
+80103504:	66 90                	xchg   %ax,%ax
+80103506:	66 90                	xchg   %ax,%ax
+80103508:	66 90                	xchg   %ax,%ax
+8010350a:	66 90                	xchg   %ax,%ax
+8010350c:	66 90                	xchg   %ax,%ax
+8010350e:	66 90                	xchg   %ax,%ax
+
+80103510 <picinit>:
+80103510:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103515:	ba 21 00 00 00       	mov    $0x21,%edx
+8010351a:	ee                   	out    %al,(%dx)
+8010351b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80103520:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80103521:	c3                   	ret
+80103522:	66 90                	xchg   %ax,%ax
+80103524:	66 90                	xchg   %ax,%ax
+80103526:	66 90                	xchg   %ax,%ax
+80103528:	66 90                	xchg   %ax,%ax
+8010352a:	66 90                	xchg   %ax,%ax
+8010352c:	66 90                	xchg   %ax,%ax
+8010352e:	66 90                	xchg   %ax,%ax
+
+80103530 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80103530:	55                   	push   %ebp
+80103531:	89 e5                	mov    %esp,%ebp
+80103533:	57                   	push   %edi
+80103534:	56                   	push   %esi
+80103535:	53                   	push   %ebx
+80103536:	83 ec 0c             	sub    $0xc,%esp
+80103539:	8b 75 08             	mov    0x8(%ebp),%esi
+8010353c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010353f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80103545:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+8010354b:	e8 c0 d9 ff ff       	call   80100f10 <filealloc>
+80103550:	89 06                	mov    %eax,(%esi)
+80103552:	85 c0                	test   %eax,%eax
+80103554:	0f 84 a5 00 00 00    	je     801035ff <pipealloc+0xcf>
+8010355a:	e8 b1 d9 ff ff       	call   80100f10 <filealloc>
+8010355f:	89 07                	mov    %eax,(%edi)
+80103561:	85 c0                	test   %eax,%eax
+80103563:	0f 84 84 00 00 00    	je     801035ed <pipealloc+0xbd>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+80103569:	e8 02 f2 ff ff       	call   80102770 <kalloc>
+8010356e:	89 c3                	mov    %eax,%ebx
+80103570:	85 c0                	test   %eax,%eax
+80103572:	0f 84 a0 00 00 00    	je     80103618 <pipealloc+0xe8>
+    goto bad;
+  p->readopen = 1;
+80103578:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+8010357f:	00 00 00 
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+80103582:	83 ec 08             	sub    $0x8,%esp
+  p->writeopen = 1;
+80103585:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+8010358c:	00 00 00 
+  p->nwrite = 0;
+8010358f:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+80103596:	00 00 00 
+  p->nread = 0;
+80103599:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+801035a0:	00 00 00 
+  initlock(&p->lock, "pipe");
+801035a3:	68 7b 84 10 80       	push   $0x8010847b
+801035a8:	50                   	push   %eax
+801035a9:	e8 52 14 00 00       	call   80104a00 <initlock>
+  (*f0)->type = FD_PIPE;
+801035ae:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+801035b0:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+801035b3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+801035b9:	8b 06                	mov    (%esi),%eax
+801035bb:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801035bf:	8b 06                	mov    (%esi),%eax
+801035c1:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+801035c5:	8b 06                	mov    (%esi),%eax
+801035c7:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+801035ca:	8b 07                	mov    (%edi),%eax
+801035cc:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+801035d2:	8b 07                	mov    (%edi),%eax
+801035d4:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+801035d8:	8b 07                	mov    (%edi),%eax
+801035da:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+801035de:	8b 07                	mov    (%edi),%eax
+801035e0:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+801035e3:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+801035e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035e8:	5b                   	pop    %ebx
+801035e9:	5e                   	pop    %esi
+801035ea:	5f                   	pop    %edi
+801035eb:	5d                   	pop    %ebp
+801035ec:	c3                   	ret
+  if(*f0)
+801035ed:	8b 06                	mov    (%esi),%eax
+801035ef:	85 c0                	test   %eax,%eax
+801035f1:	74 1e                	je     80103611 <pipealloc+0xe1>
+    fileclose(*f0);
+801035f3:	83 ec 0c             	sub    $0xc,%esp
+801035f6:	50                   	push   %eax
+801035f7:	e8 d4 d9 ff ff       	call   80100fd0 <fileclose>
+801035fc:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+801035ff:	8b 07                	mov    (%edi),%eax
+80103601:	85 c0                	test   %eax,%eax
+80103603:	74 0c                	je     80103611 <pipealloc+0xe1>
+    fileclose(*f1);
+80103605:	83 ec 0c             	sub    $0xc,%esp
+80103608:	50                   	push   %eax
+80103609:	e8 c2 d9 ff ff       	call   80100fd0 <fileclose>
+8010360e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80103611:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103616:	eb cd                	jmp    801035e5 <pipealloc+0xb5>
+  if(*f0)
+80103618:	8b 06                	mov    (%esi),%eax
+8010361a:	85 c0                	test   %eax,%eax
+8010361c:	75 d5                	jne    801035f3 <pipealloc+0xc3>
+8010361e:	eb df                	jmp    801035ff <pipealloc+0xcf>
+
+80103620 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80103620:	55                   	push   %ebp
+80103621:	89 e5                	mov    %esp,%ebp
+80103623:	56                   	push   %esi
+80103624:	53                   	push   %ebx
+80103625:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103628:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+8010362b:	83 ec 0c             	sub    $0xc,%esp
+8010362e:	53                   	push   %ebx
+8010362f:	e8 ac 15 00 00       	call   80104be0 <acquire>
+  if(writable){
+80103634:	83 c4 10             	add    $0x10,%esp
+80103637:	85 f6                	test   %esi,%esi
+80103639:	74 65                	je     801036a0 <pipeclose+0x80>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+8010363b:	83 ec 0c             	sub    $0xc,%esp
+8010363e:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+    p->writeopen = 0;
+80103644:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+8010364b:	00 00 00 
+    wakeup(&p->nread);
+8010364e:	50                   	push   %eax
+8010364f:	e8 4c 0f 00 00       	call   801045a0 <wakeup>
+80103654:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80103657:	8b 93 3c 02 00 00    	mov    0x23c(%ebx),%edx
+8010365d:	85 d2                	test   %edx,%edx
+8010365f:	75 0a                	jne    8010366b <pipeclose+0x4b>
+80103661:	8b 83 40 02 00 00    	mov    0x240(%ebx),%eax
+80103667:	85 c0                	test   %eax,%eax
+80103669:	74 15                	je     80103680 <pipeclose+0x60>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+8010366b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010366e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103671:	5b                   	pop    %ebx
+80103672:	5e                   	pop    %esi
+80103673:	5d                   	pop    %ebp
+    release(&p->lock);
+80103674:	e9 07 15 00 00       	jmp    80104b80 <release>
+80103679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80103680:	83 ec 0c             	sub    $0xc,%esp
+80103683:	53                   	push   %ebx
+80103684:	e8 f7 14 00 00       	call   80104b80 <release>
+    kfree((char*)p);
+80103689:	89 5d 08             	mov    %ebx,0x8(%ebp)
+8010368c:	83 c4 10             	add    $0x10,%esp
+}
+8010368f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103692:	5b                   	pop    %ebx
+80103693:	5e                   	pop    %esi
+80103694:	5d                   	pop    %ebp
+    kfree((char*)p);
+80103695:	e9 16 ef ff ff       	jmp    801025b0 <kfree>
+8010369a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+801036a0:	83 ec 0c             	sub    $0xc,%esp
+801036a3:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+    p->readopen = 0;
+801036a9:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+801036b0:	00 00 00 
+    wakeup(&p->nwrite);
+801036b3:	50                   	push   %eax
+801036b4:	e8 e7 0e 00 00       	call   801045a0 <wakeup>
+801036b9:	83 c4 10             	add    $0x10,%esp
+801036bc:	eb 99                	jmp    80103657 <pipeclose+0x37>
+801036be:	66 90                	xchg   %ax,%ax
+
+801036c0 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801036c0:	55                   	push   %ebp
+801036c1:	89 e5                	mov    %esp,%ebp
+801036c3:	57                   	push   %edi
+801036c4:	56                   	push   %esi
+801036c5:	53                   	push   %ebx
+801036c6:	83 ec 28             	sub    $0x28,%esp
+801036c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801036cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801036cf:	53                   	push   %ebx
+801036d0:	e8 0b 15 00 00       	call   80104be0 <acquire>
+  for(i = 0; i < n; i++){
+801036d5:	83 c4 10             	add    $0x10,%esp
+801036d8:	85 ff                	test   %edi,%edi
+801036da:	0f 8e ce 00 00 00    	jle    801037ae <pipewrite+0xee>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801036e0:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+801036e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801036e9:	89 7d 10             	mov    %edi,0x10(%ebp)
+801036ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801036ef:	8d 34 39             	lea    (%ecx,%edi,1),%esi
+801036f2:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+801036f5:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801036fb:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103701:	8d bb 38 02 00 00    	lea    0x238(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80103707:	8d 90 00 02 00 00    	lea    0x200(%eax),%edx
+8010370d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+80103710:	0f 85 b6 00 00 00    	jne    801037cc <pipewrite+0x10c>
+80103716:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80103719:	eb 3b                	jmp    80103756 <pipewrite+0x96>
+8010371b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010371f:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+80103720:	e8 8b 02 00 00       	call   801039b0 <myproc>
+80103725:	8b 48 24             	mov    0x24(%eax),%ecx
+80103728:	85 c9                	test   %ecx,%ecx
+8010372a:	75 34                	jne    80103760 <pipewrite+0xa0>
+      wakeup(&p->nread);
+8010372c:	83 ec 0c             	sub    $0xc,%esp
+8010372f:	56                   	push   %esi
+80103730:	e8 6b 0e 00 00       	call   801045a0 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80103735:	58                   	pop    %eax
+80103736:	5a                   	pop    %edx
+80103737:	53                   	push   %ebx
+80103738:	57                   	push   %edi
+80103739:	e8 b2 0c 00 00       	call   801043f0 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010373e:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80103744:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+8010374a:	83 c4 10             	add    $0x10,%esp
+8010374d:	05 00 02 00 00       	add    $0x200,%eax
+80103752:	39 c2                	cmp    %eax,%edx
+80103754:	75 2a                	jne    80103780 <pipewrite+0xc0>
+      if(p->readopen == 0 || myproc()->killed){
+80103756:	8b 83 3c 02 00 00    	mov    0x23c(%ebx),%eax
+8010375c:	85 c0                	test   %eax,%eax
+8010375e:	75 c0                	jne    80103720 <pipewrite+0x60>
+        release(&p->lock);
+80103760:	83 ec 0c             	sub    $0xc,%esp
+80103763:	53                   	push   %ebx
+80103764:	e8 17 14 00 00       	call   80104b80 <release>
+        return -1;
+80103769:	83 c4 10             	add    $0x10,%esp
+8010376c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+80103771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103774:	5b                   	pop    %ebx
+80103775:	5e                   	pop    %esi
+80103776:	5f                   	pop    %edi
+80103777:	5d                   	pop    %ebp
+80103778:	c3                   	ret
+80103779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103780:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+80103783:	8d 42 01             	lea    0x1(%edx),%eax
+80103786:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  for(i = 0; i < n; i++){
+8010378c:	83 c1 01             	add    $0x1,%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+8010378f:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80103795:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103798:	0f b6 41 ff          	movzbl -0x1(%ecx),%eax
+8010379c:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+801037a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801037a3:	39 c1                	cmp    %eax,%ecx
+801037a5:	0f 85 50 ff ff ff    	jne    801036fb <pipewrite+0x3b>
+801037ab:	8b 7d 10             	mov    0x10(%ebp),%edi
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801037ae:	83 ec 0c             	sub    $0xc,%esp
+801037b1:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+801037b7:	50                   	push   %eax
+801037b8:	e8 e3 0d 00 00       	call   801045a0 <wakeup>
+  release(&p->lock);
+801037bd:	89 1c 24             	mov    %ebx,(%esp)
+801037c0:	e8 bb 13 00 00       	call   80104b80 <release>
+  return n;
+801037c5:	83 c4 10             	add    $0x10,%esp
+801037c8:	89 f8                	mov    %edi,%eax
+801037ca:	eb a5                	jmp    80103771 <pipewrite+0xb1>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801037cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801037cf:	eb b2                	jmp    80103783 <pipewrite+0xc3>
+801037d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037df:	90                   	nop
+
+801037e0 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+801037e0:	55                   	push   %ebp
+801037e1:	89 e5                	mov    %esp,%ebp
+801037e3:	57                   	push   %edi
+801037e4:	56                   	push   %esi
+801037e5:	53                   	push   %ebx
+801037e6:	83 ec 18             	sub    $0x18,%esp
+801037e9:	8b 75 08             	mov    0x8(%ebp),%esi
+801037ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801037ef:	56                   	push   %esi
+801037f0:	8d 9e 34 02 00 00    	lea    0x234(%esi),%ebx
+801037f6:	e8 e5 13 00 00       	call   80104be0 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801037fb:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103801:	83 c4 10             	add    $0x10,%esp
+80103804:	39 86 38 02 00 00    	cmp    %eax,0x238(%esi)
+8010380a:	74 2f                	je     8010383b <piperead+0x5b>
+8010380c:	eb 37                	jmp    80103845 <piperead+0x65>
+8010380e:	66 90                	xchg   %ax,%ax
+    if(myproc()->killed){
+80103810:	e8 9b 01 00 00       	call   801039b0 <myproc>
+80103815:	8b 48 24             	mov    0x24(%eax),%ecx
+80103818:	85 c9                	test   %ecx,%ecx
+8010381a:	0f 85 80 00 00 00    	jne    801038a0 <piperead+0xc0>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80103820:	83 ec 08             	sub    $0x8,%esp
+80103823:	56                   	push   %esi
+80103824:	53                   	push   %ebx
+80103825:	e8 c6 0b 00 00       	call   801043f0 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010382a:	8b 86 38 02 00 00    	mov    0x238(%esi),%eax
+80103830:	83 c4 10             	add    $0x10,%esp
+80103833:	39 86 34 02 00 00    	cmp    %eax,0x234(%esi)
+80103839:	75 0a                	jne    80103845 <piperead+0x65>
+8010383b:	8b 86 40 02 00 00    	mov    0x240(%esi),%eax
+80103841:	85 c0                	test   %eax,%eax
+80103843:	75 cb                	jne    80103810 <piperead+0x30>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103845:	8b 55 10             	mov    0x10(%ebp),%edx
+80103848:	31 db                	xor    %ebx,%ebx
+8010384a:	85 d2                	test   %edx,%edx
+8010384c:	7f 20                	jg     8010386e <piperead+0x8e>
+8010384e:	eb 2c                	jmp    8010387c <piperead+0x9c>
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80103850:	8d 48 01             	lea    0x1(%eax),%ecx
+80103853:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103858:	89 8e 34 02 00 00    	mov    %ecx,0x234(%esi)
+8010385e:	0f b6 44 06 34       	movzbl 0x34(%esi,%eax,1),%eax
+80103863:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80103866:	83 c3 01             	add    $0x1,%ebx
+80103869:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+8010386c:	74 0e                	je     8010387c <piperead+0x9c>
+    if(p->nread == p->nwrite)
+8010386e:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80103874:	3b 86 38 02 00 00    	cmp    0x238(%esi),%eax
+8010387a:	75 d4                	jne    80103850 <piperead+0x70>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+8010387c:	83 ec 0c             	sub    $0xc,%esp
+8010387f:	8d 86 38 02 00 00    	lea    0x238(%esi),%eax
+80103885:	50                   	push   %eax
+80103886:	e8 15 0d 00 00       	call   801045a0 <wakeup>
+  release(&p->lock);
+8010388b:	89 34 24             	mov    %esi,(%esp)
+8010388e:	e8 ed 12 00 00       	call   80104b80 <release>
+  return i;
+80103893:	83 c4 10             	add    $0x10,%esp
+}
+80103896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103899:	89 d8                	mov    %ebx,%eax
+8010389b:	5b                   	pop    %ebx
+8010389c:	5e                   	pop    %esi
+8010389d:	5f                   	pop    %edi
+8010389e:	5d                   	pop    %ebp
+8010389f:	c3                   	ret
+      release(&p->lock);
+801038a0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801038a3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&p->lock);
+801038a8:	56                   	push   %esi
+801038a9:	e8 d2 12 00 00       	call   80104b80 <release>
+      return -1;
+801038ae:	83 c4 10             	add    $0x10,%esp
+}
+801038b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801038b4:	89 d8                	mov    %ebx,%eax
+801038b6:	5b                   	pop    %ebx
+801038b7:	5e                   	pop    %esi
+801038b8:	5f                   	pop    %edi
+801038b9:	5d                   	pop    %ebp
+801038ba:	c3                   	ret
+801038bb:	66 90                	xchg   %ax,%ax
+801038bd:	66 90                	xchg   %ax,%ax
+801038bf:	90                   	nop
+
+801038c0 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+801038c0:	55                   	push   %ebp
+801038c1:	89 e5                	mov    %esp,%ebp
+801038c3:	83 ec 14             	sub    $0x14,%esp
+  static int first = 1;
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+801038c6:	68 40 2d 11 80       	push   $0x80112d40
+801038cb:	e8 b0 12 00 00       	call   80104b80 <release>
+
+  if (first) {
+801038d0:	a1 00 b0 10 80       	mov    0x8010b000,%eax
+801038d5:	83 c4 10             	add    $0x10,%esp
+801038d8:	85 c0                	test   %eax,%eax
+801038da:	75 04                	jne    801038e0 <forkret+0x20>
+    iinit(ROOTDEV);
+    initlog(ROOTDEV);
+  }
+
+  // Return to "caller", actually trapret (see allocproc).
+}
+801038dc:	c9                   	leave
+801038dd:	c3                   	ret
+801038de:	66 90                	xchg   %ax,%ax
+    first = 0;
+801038e0:	c7 05 00 b0 10 80 00 	movl   $0x0,0x8010b000
+801038e7:	00 00 00 
+    iinit(ROOTDEV);
+801038ea:	83 ec 0c             	sub    $0xc,%esp
+801038ed:	6a 01                	push   $0x1
+801038ef:	e8 4c dd ff ff       	call   80101640 <iinit>
+    initlog(ROOTDEV);
+801038f4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801038fb:	e8 c0 f4 ff ff       	call   80102dc0 <initlog>
+}
+80103900:	83 c4 10             	add    $0x10,%esp
+80103903:	c9                   	leave
+80103904:	c3                   	ret
+80103905:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010390c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103910 <pinit>:
+{
+80103910:	55                   	push   %ebp
+80103911:	89 e5                	mov    %esp,%ebp
+80103913:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+80103916:	68 80 84 10 80       	push   $0x80108480
+8010391b:	68 40 2d 11 80       	push   $0x80112d40
+80103920:	e8 db 10 00 00       	call   80104a00 <initlock>
+}
+80103925:	83 c4 10             	add    $0x10,%esp
+80103928:	c9                   	leave
+80103929:	c3                   	ret
+8010392a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103930 <mycpu>:
+{
+80103930:	55                   	push   %ebp
+80103931:	89 e5                	mov    %esp,%ebp
+80103933:	56                   	push   %esi
+80103934:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80103935:	9c                   	pushf
+80103936:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80103937:	f6 c4 02             	test   $0x2,%ah
+8010393a:	75 46                	jne    80103982 <mycpu+0x52>
+  apicid = lapicid();
+8010393c:	e8 af f0 ff ff       	call   801029f0 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80103941:	8b 35 84 27 11 80    	mov    0x80112784,%esi
+80103947:	85 f6                	test   %esi,%esi
+80103949:	7e 2a                	jle    80103975 <mycpu+0x45>
+8010394b:	31 d2                	xor    %edx,%edx
+8010394d:	eb 08                	jmp    80103957 <mycpu+0x27>
+8010394f:	90                   	nop
+80103950:	83 c2 01             	add    $0x1,%edx
+80103953:	39 f2                	cmp    %esi,%edx
+80103955:	74 1e                	je     80103975 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80103957:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+8010395d:	0f b6 99 a0 27 11 80 	movzbl -0x7feed860(%ecx),%ebx
+80103964:	39 c3                	cmp    %eax,%ebx
+80103966:	75 e8                	jne    80103950 <mycpu+0x20>
+}
+80103968:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+8010396b:	8d 81 a0 27 11 80    	lea    -0x7feed860(%ecx),%eax
+}
+80103971:	5b                   	pop    %ebx
+80103972:	5e                   	pop    %esi
+80103973:	5d                   	pop    %ebp
+80103974:	c3                   	ret
+  panic("unknown apicid\n");
+80103975:	83 ec 0c             	sub    $0xc,%esp
+80103978:	68 87 84 10 80       	push   $0x80108487
+8010397d:	e8 fe c9 ff ff       	call   80100380 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80103982:	83 ec 0c             	sub    $0xc,%esp
+80103985:	68 78 85 10 80       	push   $0x80108578
+8010398a:	e8 f1 c9 ff ff       	call   80100380 <panic>
+8010398f:	90                   	nop
+
+80103990 <cpuid>:
+cpuid() {
+80103990:	55                   	push   %ebp
+80103991:	89 e5                	mov    %esp,%ebp
+80103993:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80103996:	e8 95 ff ff ff       	call   80103930 <mycpu>
+}
+8010399b:	c9                   	leave
+  return mycpu()-cpus;
+8010399c:	2d a0 27 11 80       	sub    $0x801127a0,%eax
+801039a1:	c1 f8 04             	sar    $0x4,%eax
+801039a4:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+801039aa:	c3                   	ret
+801039ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801039af:	90                   	nop
+
+801039b0 <myproc>:
+myproc(void) {
+801039b0:	55                   	push   %ebp
+801039b1:	89 e5                	mov    %esp,%ebp
+801039b3:	53                   	push   %ebx
+801039b4:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+801039b7:	e8 d4 10 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+801039bc:	e8 6f ff ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+801039c1:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801039c7:	e8 14 11 00 00       	call   80104ae0 <popcli>
+}
+801039cc:	89 d8                	mov    %ebx,%eax
+801039ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801039d1:	c9                   	leave
+801039d2:	c3                   	ret
+801039d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801039da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801039e0 <setparent>:
+{
+801039e0:	55                   	push   %ebp
+801039e1:	89 e5                	mov    %esp,%ebp
+801039e3:	53                   	push   %ebx
+801039e4:	8b 45 08             	mov    0x8(%ebp),%eax
+801039e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(p->parent){
+801039ea:	8b 48 14             	mov    0x14(%eax),%ecx
+801039ed:	85 c9                	test   %ecx,%ecx
+801039ef:	74 1e                	je     80103a0f <setparent+0x2f>
+    if((*p->psibling = p->sibling) != 0)
+801039f1:	8b 88 20 01 00 00    	mov    0x120(%eax),%ecx
+801039f7:	8b 98 24 01 00 00    	mov    0x124(%eax),%ebx
+801039fd:	89 0b                	mov    %ecx,(%ebx)
+801039ff:	85 c9                	test   %ecx,%ecx
+80103a01:	74 0c                	je     80103a0f <setparent+0x2f>
+      p->sibling->psibling = p->psibling;
+80103a03:	8b 98 24 01 00 00    	mov    0x124(%eax),%ebx
+80103a09:	89 99 24 01 00 00    	mov    %ebx,0x124(%ecx)
+  p->parent = parent;
+80103a0f:	89 50 14             	mov    %edx,0x14(%eax)
+  if(parent){
+80103a12:	85 d2                	test   %edx,%edx
+80103a14:	74 2e                	je     80103a44 <setparent+0x64>
+    if((p->sibling = parent->children) != 0)
+80103a16:	8b 8a 1c 01 00 00    	mov    0x11c(%edx),%ecx
+80103a1c:	89 88 20 01 00 00    	mov    %ecx,0x120(%eax)
+80103a22:	85 c9                	test   %ecx,%ecx
+80103a24:	74 0c                	je     80103a32 <setparent+0x52>
+      p->sibling->psibling = &p->sibling;
+80103a26:	8d 98 20 01 00 00    	lea    0x120(%eax),%ebx
+80103a2c:	89 99 24 01 00 00    	mov    %ebx,0x124(%ecx)
+    parent->children = p;
+80103a32:	89 82 1c 01 00 00    	mov    %eax,0x11c(%edx)
+    p->psibling = &parent->children;
+80103a38:	81 c2 1c 01 00 00    	add    $0x11c,%edx
+80103a3e:	89 90 24 01 00 00    	mov    %edx,0x124(%eax)
+}
+80103a44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103a47:	c9                   	leave
+80103a48:	c3                   	ret
+80103a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103a50 <reparent>:
+{
+80103a50:	55                   	push   %ebp
+80103a51:	89 e5                	mov    %esp,%ebp
+80103a53:	56                   	push   %esi
+80103a54:	53                   	push   %ebx
+80103a55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while((c = p->children) != 0){
+80103a58:	eb 6c                	jmp    80103ac6 <reparent+0x76>
+80103a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(p->parent){
+80103a60:	8b 48 14             	mov    0x14(%eax),%ecx
+    setparent(c, initproc);
+80103a63:	8b 15 20 2d 11 80    	mov    0x80112d20,%edx
+  if(p->parent){
+80103a69:	85 c9                	test   %ecx,%ecx
+80103a6b:	74 1e                	je     80103a8b <reparent+0x3b>
+    if((*p->psibling = p->sibling) != 0)
+80103a6d:	8b 88 20 01 00 00    	mov    0x120(%eax),%ecx
+80103a73:	8b b0 24 01 00 00    	mov    0x124(%eax),%esi
+80103a79:	89 0e                	mov    %ecx,(%esi)
+80103a7b:	85 c9                	test   %ecx,%ecx
+80103a7d:	74 0c                	je     80103a8b <reparent+0x3b>
+      p->sibling->psibling = p->psibling;
+80103a7f:	8b b0 24 01 00 00    	mov    0x124(%eax),%esi
+80103a85:	89 b1 24 01 00 00    	mov    %esi,0x124(%ecx)
+  p->parent = parent;
+80103a8b:	89 50 14             	mov    %edx,0x14(%eax)
+  if(parent){
+80103a8e:	85 d2                	test   %edx,%edx
+80103a90:	74 2e                	je     80103ac0 <reparent+0x70>
+    if((p->sibling = parent->children) != 0)
+80103a92:	8b 8a 1c 01 00 00    	mov    0x11c(%edx),%ecx
+80103a98:	89 88 20 01 00 00    	mov    %ecx,0x120(%eax)
+80103a9e:	85 c9                	test   %ecx,%ecx
+80103aa0:	74 0c                	je     80103aae <reparent+0x5e>
+      p->sibling->psibling = &p->sibling;
+80103aa2:	8d b0 20 01 00 00    	lea    0x120(%eax),%esi
+80103aa8:	89 b1 24 01 00 00    	mov    %esi,0x124(%ecx)
+    parent->children = p;
+80103aae:	89 82 1c 01 00 00    	mov    %eax,0x11c(%edx)
+    p->psibling = &parent->children;
+80103ab4:	81 c2 1c 01 00 00    	add    $0x11c,%edx
+80103aba:	89 90 24 01 00 00    	mov    %edx,0x124(%eax)
+    if(c->state == ZOMBIE)
+80103ac0:	83 78 0c 05          	cmpl   $0x5,0xc(%eax)
+80103ac4:	74 12                	je     80103ad8 <reparent+0x88>
+  while((c = p->children) != 0){
+80103ac6:	8b 83 1c 01 00 00    	mov    0x11c(%ebx),%eax
+80103acc:	85 c0                	test   %eax,%eax
+80103ace:	75 90                	jne    80103a60 <reparent+0x10>
+}
+80103ad0:	5b                   	pop    %ebx
+80103ad1:	5e                   	pop    %esi
+80103ad2:	5d                   	pop    %ebp
+80103ad3:	c3                   	ret
+80103ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      wakeup1(initproc);
+80103ad8:	8b 15 20 2d 11 80    	mov    0x80112d20,%edx
+void
+wakeup1(void *chan)
+{
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80103ade:	b8 74 2d 11 80       	mov    $0x80112d74,%eax
+80103ae3:	eb 0f                	jmp    80103af4 <reparent+0xa4>
+80103ae5:	8d 76 00             	lea    0x0(%esi),%esi
+80103ae8:	05 2c 01 00 00       	add    $0x12c,%eax
+80103aed:	3d 74 78 11 80       	cmp    $0x80117874,%eax
+80103af2:	74 d2                	je     80103ac6 <reparent+0x76>
+    if(p->state == SLEEPING && p->chan == chan)
+80103af4:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80103af8:	75 ee                	jne    80103ae8 <reparent+0x98>
+80103afa:	3b 50 20             	cmp    0x20(%eax),%edx
+80103afd:	75 e9                	jne    80103ae8 <reparent+0x98>
+      p->state = RUNNABLE;
+80103aff:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+80103b06:	eb e0                	jmp    80103ae8 <reparent+0x98>
+80103b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b0f:	90                   	nop
+
+80103b10 <setpid>:
+{
+80103b10:	55                   	push   %ebp
+80103b11:	89 e5                	mov    %esp,%ebp
+80103b13:	56                   	push   %esi
+80103b14:	53                   	push   %ebx
+80103b15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80103b18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(p->pid){
+80103b1b:	8b 71 10             	mov    0x10(%ecx),%esi
+80103b1e:	85 f6                	test   %esi,%esi
+80103b20:	74 3e                	je     80103b60 <setpid+0x50>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80103b22:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80103b27:	f7 ee                	imul   %esi
+80103b29:	89 f0                	mov    %esi,%eax
+80103b2b:	c1 f8 1f             	sar    $0x1f,%eax
+80103b2e:	c1 fa 04             	sar    $0x4,%edx
+80103b31:	29 c2                	sub    %eax,%edx
+80103b33:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80103b36:	29 c6                	sub    %eax,%esi
+80103b38:	8b 04 b5 74 78 11 80 	mov    -0x7fee878c(,%esi,4),%eax
+80103b3f:	85 c0                	test   %eax,%eax
+80103b41:	74 1d                	je     80103b60 <setpid+0x50>
+      if(*pp == p){
+80103b43:	39 c8                	cmp    %ecx,%eax
+80103b45:	75 0d                	jne    80103b54 <setpid+0x44>
+80103b47:	eb 67                	jmp    80103bb0 <setpid+0xa0>
+80103b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b50:	39 c1                	cmp    %eax,%ecx
+80103b52:	74 4c                	je     80103ba0 <setpid+0x90>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80103b54:	89 c2                	mov    %eax,%edx
+80103b56:	8b 80 28 01 00 00    	mov    0x128(%eax),%eax
+80103b5c:	85 c0                	test   %eax,%eax
+80103b5e:	75 f0                	jne    80103b50 <setpid+0x40>
+  p->pid = pid;
+80103b60:	89 59 10             	mov    %ebx,0x10(%ecx)
+  if(pid){
+80103b63:	85 db                	test   %ebx,%ebx
+80103b65:	74 32                	je     80103b99 <setpid+0x89>
+    p->pidnext = ptable.pidhash[pid % NPIDHASH];
+80103b67:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80103b6c:	f7 eb                	imul   %ebx
+80103b6e:	89 d8                	mov    %ebx,%eax
+80103b70:	c1 f8 1f             	sar    $0x1f,%eax
+80103b73:	c1 fa 04             	sar    $0x4,%edx
+80103b76:	29 c2                	sub    %eax,%edx
+80103b78:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80103b7b:	29 c3                	sub    %eax,%ebx
+80103b7d:	89 da                	mov    %ebx,%edx
+80103b7f:	81 c2 cc 12 00 00    	add    $0x12cc,%edx
+80103b85:	8b 04 95 44 2d 11 80 	mov    -0x7feed2bc(,%edx,4),%eax
+80103b8c:	89 81 28 01 00 00    	mov    %eax,0x128(%ecx)
+    ptable.pidhash[pid % NPIDHASH] = p;
+80103b92:	89 0c 95 44 2d 11 80 	mov    %ecx,-0x7feed2bc(,%edx,4)
+}
+80103b99:	5b                   	pop    %ebx
+80103b9a:	5e                   	pop    %esi
+80103b9b:	5d                   	pop    %ebp
+80103b9c:	c3                   	ret
+80103b9d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80103ba0:	81 c2 28 01 00 00    	add    $0x128,%edx
+        *pp = p->pidnext;
+80103ba6:	8b 81 28 01 00 00    	mov    0x128(%ecx),%eax
+80103bac:	89 02                	mov    %eax,(%edx)
+        break;
+80103bae:	eb b0                	jmp    80103b60 <setpid+0x50>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80103bb0:	8d 14 b5 74 78 11 80 	lea    -0x7fee878c(,%esi,4),%edx
+80103bb7:	eb ed                	jmp    80103ba6 <setpid+0x96>
+80103bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103bc0 <allocproc>:
+{
+80103bc0:	55                   	push   %ebp
+80103bc1:	89 e5                	mov    %esp,%ebp
+80103bc3:	53                   	push   %ebx
+80103bc4:	83 ec 10             	sub    $0x10,%esp
+  if (holding(&ptable.lock))
+80103bc7:	68 40 2d 11 80       	push   $0x80112d40
+80103bcc:	e8 6f 0f 00 00       	call   80104b40 <holding>
+80103bd1:	83 c4 10             	add    $0x10,%esp
+80103bd4:	85 c0                	test   %eax,%eax
+80103bd6:	0f 85 e4 00 00 00    	jne    80103cc0 <allocproc+0x100>
+  acquire(&ptable.lock);
+80103bdc:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80103bdf:	bb 74 2d 11 80       	mov    $0x80112d74,%ebx
+  acquire(&ptable.lock);
+80103be4:	68 40 2d 11 80       	push   $0x80112d40
+80103be9:	e8 f2 0f 00 00       	call   80104be0 <acquire>
+80103bee:	83 c4 10             	add    $0x10,%esp
+80103bf1:	eb 17                	jmp    80103c0a <allocproc+0x4a>
+80103bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103bf7:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80103bf8:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+80103bfe:	81 fb 74 78 11 80    	cmp    $0x80117874,%ebx
+80103c04:	0f 84 ce 00 00 00    	je     80103cd8 <allocproc+0x118>
+    if(p->state == UNUSED)
+80103c0a:	8b 43 0c             	mov    0xc(%ebx),%eax
+80103c0d:	85 c0                	test   %eax,%eax
+80103c0f:	75 e7                	jne    80103bf8 <allocproc+0x38>
+  setpid(p, nextpid++);
+80103c11:	a1 04 b0 10 80       	mov    0x8010b004,%eax
+80103c16:	83 ec 08             	sub    $0x8,%esp
+  p->state = EMBRYO;
+80103c19:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  setpid(p, nextpid++);
+80103c20:	8d 50 01             	lea    0x1(%eax),%edx
+80103c23:	89 15 04 b0 10 80    	mov    %edx,0x8010b004
+80103c29:	50                   	push   %eax
+80103c2a:	53                   	push   %ebx
+80103c2b:	e8 e0 fe ff ff       	call   80103b10 <setpid>
+  p->mother = p;
+80103c30:	89 9b 94 00 00 00    	mov    %ebx,0x94(%ebx)
+  p->limit = 0;
+80103c36:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80103c3d:	00 00 00 
+  p->thread_num = 0;
+80103c40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80103c47:	00 00 00 
+  p->isthread = 0;
+80103c4a:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80103c51:	00 00 00 
+  p->tid = 0;
+80103c54:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80103c5b:	00 00 00 
+  p->nexttid = 0;
+80103c5e:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80103c65:	00 00 00 
+  release(&ptable.lock);
+80103c68:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80103c6f:	e8 0c 0f 00 00       	call   80104b80 <release>
+  if((p->kstack = kalloc()) == 0){
+80103c74:	e8 f7 ea ff ff       	call   80102770 <kalloc>
+80103c79:	83 c4 10             	add    $0x10,%esp
+80103c7c:	89 43 08             	mov    %eax,0x8(%ebx)
+80103c7f:	85 c0                	test   %eax,%eax
+80103c81:	74 6e                	je     80103cf1 <allocproc+0x131>
+  sp -= sizeof *p->tf;
+80103c83:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  memset(p->context, 0, sizeof *p->context);
+80103c89:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80103c8c:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80103c91:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80103c94:	c7 40 14 b2 65 10 80 	movl   $0x801065b2,0x14(%eax)
+  p->context = (struct context*)sp;
+80103c9b:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80103c9e:	6a 14                	push   $0x14
+80103ca0:	6a 00                	push   $0x0
+80103ca2:	50                   	push   %eax
+80103ca3:	e8 18 10 00 00       	call   80104cc0 <memset>
+  p->context->eip = (uint)forkret;
+80103ca8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  return p;
+80103cab:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+80103cae:	c7 40 10 c0 38 10 80 	movl   $0x801038c0,0x10(%eax)
+}
+80103cb5:	89 d8                	mov    %ebx,%eax
+80103cb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103cba:	c9                   	leave
+80103cbb:	c3                   	ret
+80103cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    release(&ptable.lock);
+80103cc0:	83 ec 0c             	sub    $0xc,%esp
+80103cc3:	68 40 2d 11 80       	push   $0x80112d40
+80103cc8:	e8 b3 0e 00 00       	call   80104b80 <release>
+80103ccd:	83 c4 10             	add    $0x10,%esp
+80103cd0:	e9 07 ff ff ff       	jmp    80103bdc <allocproc+0x1c>
+80103cd5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80103cd8:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80103cdb:	31 db                	xor    %ebx,%ebx
+  release(&ptable.lock);
+80103cdd:	68 40 2d 11 80       	push   $0x80112d40
+80103ce2:	e8 99 0e 00 00       	call   80104b80 <release>
+  return 0;
+80103ce7:	83 c4 10             	add    $0x10,%esp
+}
+80103cea:	89 d8                	mov    %ebx,%eax
+80103cec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103cef:	c9                   	leave
+80103cf0:	c3                   	ret
+    p->state = UNUSED;
+80103cf1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return 0;
+80103cf8:	31 db                	xor    %ebx,%ebx
+80103cfa:	eb ee                	jmp    80103cea <allocproc+0x12a>
+80103cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103d00 <userinit>:
+{
+80103d00:	55                   	push   %ebp
+80103d01:	89 e5                	mov    %esp,%ebp
+80103d03:	53                   	push   %ebx
+80103d04:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80103d07:	e8 b4 fe ff ff       	call   80103bc0 <allocproc>
+80103d0c:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80103d0e:	a3 20 2d 11 80       	mov    %eax,0x80112d20
+  if((p->pgdir = setupkvm()) == 0)
+80103d13:	e8 a8 3e 00 00       	call   80107bc0 <setupkvm>
+80103d18:	89 43 04             	mov    %eax,0x4(%ebx)
+80103d1b:	85 c0                	test   %eax,%eax
+80103d1d:	0f 84 bd 00 00 00    	je     80103de0 <userinit+0xe0>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80103d23:	83 ec 04             	sub    $0x4,%esp
+80103d26:	68 2c 00 00 00       	push   $0x2c
+80103d2b:	68 60 b4 10 80       	push   $0x8010b460
+80103d30:	50                   	push   %eax
+80103d31:	e8 6a 3b 00 00       	call   801078a0 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80103d36:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80103d39:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80103d3f:	6a 4c                	push   $0x4c
+80103d41:	6a 00                	push   $0x0
+80103d43:	ff 73 18             	push   0x18(%ebx)
+80103d46:	e8 75 0f 00 00       	call   80104cc0 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80103d4b:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d4e:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80103d53:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80103d56:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80103d5b:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80103d5f:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d62:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80103d66:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d69:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80103d6d:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80103d71:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d74:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80103d78:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80103d7c:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d7f:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80103d86:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d89:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80103d90:	8b 43 18             	mov    0x18(%ebx),%eax
+80103d93:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80103d9a:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80103d9d:	6a 10                	push   $0x10
+80103d9f:	68 b0 84 10 80       	push   $0x801084b0
+80103da4:	50                   	push   %eax
+80103da5:	e8 c6 10 00 00       	call   80104e70 <safestrcpy>
+  p->cwd = namei("/");
+80103daa:	c7 04 24 b9 84 10 80 	movl   $0x801084b9,(%esp)
+80103db1:	e8 da e3 ff ff       	call   80102190 <namei>
+80103db6:	89 43 68             	mov    %eax,0x68(%ebx)
+  acquire(&ptable.lock);
+80103db9:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80103dc0:	e8 1b 0e 00 00       	call   80104be0 <acquire>
+  p->state = RUNNABLE;
+80103dc5:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  release(&ptable.lock);
+80103dcc:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80103dd3:	e8 a8 0d 00 00       	call   80104b80 <release>
+}
+80103dd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103ddb:	83 c4 10             	add    $0x10,%esp
+80103dde:	c9                   	leave
+80103ddf:	c3                   	ret
+    panic("userinit: out of memory?");
+80103de0:	83 ec 0c             	sub    $0xc,%esp
+80103de3:	68 97 84 10 80       	push   $0x80108497
+80103de8:	e8 93 c5 ff ff       	call   80100380 <panic>
+80103ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103df0 <growproc>:
+{
+80103df0:	55                   	push   %ebp
+80103df1:	89 e5                	mov    %esp,%ebp
+80103df3:	57                   	push   %edi
+80103df4:	56                   	push   %esi
+80103df5:	53                   	push   %ebx
+80103df6:	83 ec 0c             	sub    $0xc,%esp
+80103df9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80103dfc:	e8 8f 0c 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+80103e01:	e8 2a fb ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+80103e06:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80103e0c:	e8 cf 0c 00 00       	call   80104ae0 <popcli>
+  acquire(&ptable.lock);
+80103e11:	83 ec 0c             	sub    $0xc,%esp
+80103e14:	68 40 2d 11 80       	push   $0x80112d40
+80103e19:	e8 c2 0d 00 00       	call   80104be0 <acquire>
+  sz = curproc->sz;
+80103e1e:	8b 3e                	mov    (%esi),%edi
+  if(n > 0){
+80103e20:	83 c4 10             	add    $0x10,%esp
+80103e23:	85 db                	test   %ebx,%ebx
+80103e25:	0f 8e a5 00 00 00    	jle    80103ed0 <growproc+0xe0>
+    if (curproc->limit && sz + n > curproc->limit) {
+80103e2b:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+80103e31:	01 fb                	add    %edi,%ebx
+80103e33:	85 c0                	test   %eax,%eax
+80103e35:	74 08                	je     80103e3f <growproc+0x4f>
+80103e37:	39 d8                	cmp    %ebx,%eax
+80103e39:	0f 82 b1 00 00 00    	jb     80103ef0 <growproc+0x100>
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80103e3f:	83 ec 04             	sub    $0x4,%esp
+80103e42:	53                   	push   %ebx
+80103e43:	57                   	push   %edi
+80103e44:	ff 76 04             	push   0x4(%esi)
+80103e47:	e8 a4 3b 00 00       	call   801079f0 <allocuvm>
+80103e4c:	83 c4 10             	add    $0x10,%esp
+80103e4f:	89 c7                	mov    %eax,%edi
+80103e51:	85 c0                	test   %eax,%eax
+80103e53:	0f 84 a7 00 00 00    	je     80103f00 <growproc+0x110>
+  mother = (curproc->isthread) ? curproc->mother : curproc;
+80103e59:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+80103e5f:	89 f3                	mov    %esi,%ebx
+80103e61:	85 c0                	test   %eax,%eax
+80103e63:	75 5b                	jne    80103ec0 <growproc+0xd0>
+  mother->sz = sz;
+80103e65:	89 3b                	mov    %edi,(%ebx)
+  tnum = mother->thread_num;
+80103e67:	8b 8b 84 00 00 00    	mov    0x84(%ebx),%ecx
+  for (int i = 0; i < NTHREAD; i++) {
+80103e6d:	31 c0                	xor    %eax,%eax
+80103e6f:	eb 1f                	jmp    80103e90 <growproc+0xa0>
+80103e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (mother->threads[i]) {
+80103e78:	8b 94 83 98 00 00 00 	mov    0x98(%ebx,%eax,4),%edx
+80103e7f:	85 d2                	test   %edx,%edx
+80103e81:	74 05                	je     80103e88 <growproc+0x98>
+      mother->threads[i]->sz = sz;
+80103e83:	89 3a                	mov    %edi,(%edx)
+      tnum--;
+80103e85:	83 e9 01             	sub    $0x1,%ecx
+  for (int i = 0; i < NTHREAD; i++) {
+80103e88:	83 c0 01             	add    $0x1,%eax
+    if (tnum == 0) break;
+80103e8b:	83 f8 20             	cmp    $0x20,%eax
+80103e8e:	74 04                	je     80103e94 <growproc+0xa4>
+80103e90:	85 c9                	test   %ecx,%ecx
+80103e92:	75 e4                	jne    80103e78 <growproc+0x88>
+  release(&ptable.lock);
+80103e94:	83 ec 0c             	sub    $0xc,%esp
+80103e97:	68 40 2d 11 80       	push   $0x80112d40
+80103e9c:	e8 df 0c 00 00       	call   80104b80 <release>
+  switchuvm(curproc);
+80103ea1:	89 34 24             	mov    %esi,(%esp)
+80103ea4:	e8 e7 38 00 00       	call   80107790 <switchuvm>
+  return 0;
+80103ea9:	83 c4 10             	add    $0x10,%esp
+80103eac:	31 c0                	xor    %eax,%eax
+}
+80103eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103eb1:	5b                   	pop    %ebx
+80103eb2:	5e                   	pop    %esi
+80103eb3:	5f                   	pop    %edi
+80103eb4:	5d                   	pop    %ebp
+80103eb5:	c3                   	ret
+80103eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ebd:	8d 76 00             	lea    0x0(%esi),%esi
+  mother = (curproc->isthread) ? curproc->mother : curproc;
+80103ec0:	8b 9e 94 00 00 00    	mov    0x94(%esi),%ebx
+80103ec6:	eb 9d                	jmp    80103e65 <growproc+0x75>
+80103ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ecf:	90                   	nop
+  } else if(n < 0){
+80103ed0:	74 87                	je     80103e59 <growproc+0x69>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80103ed2:	83 ec 04             	sub    $0x4,%esp
+80103ed5:	01 fb                	add    %edi,%ebx
+80103ed7:	53                   	push   %ebx
+80103ed8:	57                   	push   %edi
+80103ed9:	ff 76 04             	push   0x4(%esi)
+80103edc:	e8 2f 3c 00 00       	call   80107b10 <deallocuvm>
+80103ee1:	83 c4 10             	add    $0x10,%esp
+80103ee4:	89 c7                	mov    %eax,%edi
+80103ee6:	85 c0                	test   %eax,%eax
+80103ee8:	0f 85 6b ff ff ff    	jne    80103e59 <growproc+0x69>
+80103eee:	eb 10                	jmp    80103f00 <growproc+0x110>
+      cprintf("sbrk error: memory limit exceeded!\n");
+80103ef0:	83 ec 0c             	sub    $0xc,%esp
+80103ef3:	68 a0 85 10 80       	push   $0x801085a0
+80103ef8:	e8 b3 c7 ff ff       	call   801006b0 <cprintf>
+      return -1;
+80103efd:	83 c4 10             	add    $0x10,%esp
+80103f00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103f05:	eb a7                	jmp    80103eae <growproc+0xbe>
+80103f07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f0e:	66 90                	xchg   %ax,%ax
+
+80103f10 <fork>:
+{
+80103f10:	55                   	push   %ebp
+80103f11:	89 e5                	mov    %esp,%ebp
+80103f13:	57                   	push   %edi
+80103f14:	56                   	push   %esi
+80103f15:	53                   	push   %ebx
+80103f16:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80103f19:	e8 72 0b 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+80103f1e:	e8 0d fa ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+80103f23:	8b 90 ac 00 00 00    	mov    0xac(%eax),%edx
+80103f29:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  popcli();
+80103f2c:	e8 af 0b 00 00       	call   80104ae0 <popcli>
+  if((np = allocproc()) == 0){
+80103f31:	e8 8a fc ff ff       	call   80103bc0 <allocproc>
+80103f36:	85 c0                	test   %eax,%eax
+80103f38:	0f 84 36 01 00 00    	je     80104074 <fork+0x164>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80103f3e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103f41:	83 ec 08             	sub    $0x8,%esp
+80103f44:	89 c3                	mov    %eax,%ebx
+80103f46:	ff 32                	push   (%edx)
+80103f48:	ff 72 04             	push   0x4(%edx)
+80103f4b:	e8 60 3d 00 00       	call   80107cb0 <copyuvm>
+80103f50:	83 c4 10             	add    $0x10,%esp
+80103f53:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103f56:	85 c0                	test   %eax,%eax
+80103f58:	89 43 04             	mov    %eax,0x4(%ebx)
+80103f5b:	0f 84 f7 00 00 00    	je     80104058 <fork+0x148>
+  np->sz = curproc->sz;
+80103f61:	8b 02                	mov    (%edx),%eax
+  *np->tf = *curproc->tf;
+80103f63:	8b 7b 18             	mov    0x18(%ebx),%edi
+80103f66:	b9 13 00 00 00       	mov    $0x13,%ecx
+  np->sz = curproc->sz;
+80103f6b:	89 03                	mov    %eax,(%ebx)
+  *np->tf = *curproc->tf;
+80103f6d:	8b 72 18             	mov    0x18(%edx),%esi
+80103f70:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+80103f72:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80103f74:	8b 43 18             	mov    0x18(%ebx),%eax
+80103f77:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+80103f7e:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[i])
+80103f80:	8b 44 b2 28          	mov    0x28(%edx,%esi,4),%eax
+80103f84:	85 c0                	test   %eax,%eax
+80103f86:	74 16                	je     80103f9e <fork+0x8e>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80103f88:	83 ec 0c             	sub    $0xc,%esp
+80103f8b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80103f8e:	50                   	push   %eax
+80103f8f:	e8 ec cf ff ff       	call   80100f80 <filedup>
+80103f94:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103f97:	83 c4 10             	add    $0x10,%esp
+80103f9a:	89 44 b3 28          	mov    %eax,0x28(%ebx,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+80103f9e:	83 c6 01             	add    $0x1,%esi
+80103fa1:	83 fe 10             	cmp    $0x10,%esi
+80103fa4:	75 da                	jne    80103f80 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+80103fa6:	83 ec 0c             	sub    $0xc,%esp
+80103fa9:	ff 72 68             	push   0x68(%edx)
+80103fac:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80103faf:	e8 7c d8 ff ff       	call   80101830 <idup>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80103fb4:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+80103fb7:	89 43 68             	mov    %eax,0x68(%ebx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80103fba:	6a 10                	push   $0x10
+80103fbc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103fbf:	8d 42 6c             	lea    0x6c(%edx),%eax
+80103fc2:	50                   	push   %eax
+80103fc3:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80103fc6:	50                   	push   %eax
+80103fc7:	e8 a4 0e 00 00       	call   80104e70 <safestrcpy>
+  pid = np->pid;
+80103fcc:	8b 73 10             	mov    0x10(%ebx),%esi
+  acquire(&ptable.lock);
+80103fcf:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80103fd6:	e8 05 0c 00 00       	call   80104be0 <acquire>
+  if(p->parent){
+80103fdb:	8b 43 14             	mov    0x14(%ebx),%eax
+80103fde:	83 c4 10             	add    $0x10,%esp
+80103fe1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103fe4:	85 c0                	test   %eax,%eax
+80103fe6:	74 1e                	je     80104006 <fork+0xf6>
+    if((*p->psibling = p->sibling) != 0)
+80103fe8:	8b 8b 24 01 00 00    	mov    0x124(%ebx),%ecx
+80103fee:	8b 83 20 01 00 00    	mov    0x120(%ebx),%eax
+80103ff4:	89 01                	mov    %eax,(%ecx)
+80103ff6:	85 c0                	test   %eax,%eax
+80103ff8:	74 0c                	je     80104006 <fork+0xf6>
+      p->sibling->psibling = p->psibling;
+80103ffa:	8b 8b 24 01 00 00    	mov    0x124(%ebx),%ecx
+80104000:	89 88 24 01 00 00    	mov    %ecx,0x124(%eax)
+  p->parent = parent;
+80104006:	89 53 14             	mov    %edx,0x14(%ebx)
+    if((p->sibling = parent->children) != 0)
+80104009:	8b 82 1c 01 00 00    	mov    0x11c(%edx),%eax
+8010400f:	89 83 20 01 00 00    	mov    %eax,0x120(%ebx)
+80104015:	85 c0                	test   %eax,%eax
+80104017:	74 0c                	je     80104025 <fork+0x115>
+      p->sibling->psibling = &p->sibling;
+80104019:	8d 8b 20 01 00 00    	lea    0x120(%ebx),%ecx
+8010401f:	89 88 24 01 00 00    	mov    %ecx,0x124(%eax)
+    parent->children = p;
+80104025:	89 9a 1c 01 00 00    	mov    %ebx,0x11c(%edx)
+  release(&ptable.lock);
+8010402b:	83 ec 0c             	sub    $0xc,%esp
+    p->psibling = &parent->children;
+8010402e:	81 c2 1c 01 00 00    	add    $0x11c,%edx
+80104034:	89 93 24 01 00 00    	mov    %edx,0x124(%ebx)
+  np->state = RUNNABLE;
+8010403a:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  release(&ptable.lock);
+80104041:	68 40 2d 11 80       	push   $0x80112d40
+80104046:	e8 35 0b 00 00       	call   80104b80 <release>
+  return pid;
+8010404b:	83 c4 10             	add    $0x10,%esp
+}
+8010404e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104051:	89 f0                	mov    %esi,%eax
+80104053:	5b                   	pop    %ebx
+80104054:	5e                   	pop    %esi
+80104055:	5f                   	pop    %edi
+80104056:	5d                   	pop    %ebp
+80104057:	c3                   	ret
+    kfree(np->kstack);
+80104058:	83 ec 0c             	sub    $0xc,%esp
+8010405b:	ff 73 08             	push   0x8(%ebx)
+8010405e:	e8 4d e5 ff ff       	call   801025b0 <kfree>
+    np->kstack = 0;
+80104063:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    return -1;
+8010406a:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+8010406d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return -1;
+80104074:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80104079:	eb d3                	jmp    8010404e <fork+0x13e>
+8010407b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010407f:	90                   	nop
+
+80104080 <scheduler>:
+{
+80104080:	55                   	push   %ebp
+80104081:	89 e5                	mov    %esp,%ebp
+80104083:	57                   	push   %edi
+80104084:	56                   	push   %esi
+80104085:	53                   	push   %ebx
+80104086:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c = mycpu();
+80104089:	e8 a2 f8 ff ff       	call   80103930 <mycpu>
+  c->proc = 0;
+8010408e:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80104095:	00 00 00 
+  struct cpu *c = mycpu();
+80104098:	89 c6                	mov    %eax,%esi
+  c->proc = 0;
+8010409a:	8d 78 04             	lea    0x4(%eax),%edi
+8010409d:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("sti");
+801040a0:	fb                   	sti
+    acquire(&ptable.lock);
+801040a1:	83 ec 0c             	sub    $0xc,%esp
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){      
+801040a4:	bb 74 2d 11 80       	mov    $0x80112d74,%ebx
+    acquire(&ptable.lock);
+801040a9:	68 40 2d 11 80       	push   $0x80112d40
+801040ae:	e8 2d 0b 00 00       	call   80104be0 <acquire>
+801040b3:	83 c4 10             	add    $0x10,%esp
+801040b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801040bd:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->state != RUNNABLE)
+801040c0:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+801040c4:	75 33                	jne    801040f9 <scheduler+0x79>
+      switchuvm(p);
+801040c6:	83 ec 0c             	sub    $0xc,%esp
+      c->proc = p;
+801040c9:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+      switchuvm(p);
+801040cf:	53                   	push   %ebx
+801040d0:	e8 bb 36 00 00       	call   80107790 <switchuvm>
+      swtch(&(c->scheduler), p->context);
+801040d5:	58                   	pop    %eax
+801040d6:	5a                   	pop    %edx
+801040d7:	ff 73 1c             	push   0x1c(%ebx)
+801040da:	57                   	push   %edi
+      p->state = RUNNING;
+801040db:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+      swtch(&(c->scheduler), p->context);
+801040e2:	e8 e4 0d 00 00       	call   80104ecb <swtch>
+      switchkvm();
+801040e7:	e8 94 36 00 00       	call   80107780 <switchkvm>
+      c->proc = 0;
+801040ec:	83 c4 10             	add    $0x10,%esp
+801040ef:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+801040f6:	00 00 00 
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){      
+801040f9:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+801040ff:	81 fb 74 78 11 80    	cmp    $0x80117874,%ebx
+80104105:	75 b9                	jne    801040c0 <scheduler+0x40>
+    release(&ptable.lock);
+80104107:	83 ec 0c             	sub    $0xc,%esp
+8010410a:	68 40 2d 11 80       	push   $0x80112d40
+8010410f:	e8 6c 0a 00 00       	call   80104b80 <release>
+    sti();
+80104114:	83 c4 10             	add    $0x10,%esp
+80104117:	eb 87                	jmp    801040a0 <scheduler+0x20>
+80104119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104120 <sched>:
+{
+80104120:	55                   	push   %ebp
+80104121:	89 e5                	mov    %esp,%ebp
+80104123:	56                   	push   %esi
+80104124:	53                   	push   %ebx
+  pushcli();
+80104125:	e8 66 09 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+8010412a:	e8 01 f8 ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+8010412f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80104135:	e8 a6 09 00 00       	call   80104ae0 <popcli>
+  if(!holding(&ptable.lock))
+8010413a:	83 ec 0c             	sub    $0xc,%esp
+8010413d:	68 40 2d 11 80       	push   $0x80112d40
+80104142:	e8 f9 09 00 00       	call   80104b40 <holding>
+80104147:	83 c4 10             	add    $0x10,%esp
+8010414a:	85 c0                	test   %eax,%eax
+8010414c:	74 4f                	je     8010419d <sched+0x7d>
+  if(mycpu()->ncli != 1)
+8010414e:	e8 dd f7 ff ff       	call   80103930 <mycpu>
+80104153:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+8010415a:	75 68                	jne    801041c4 <sched+0xa4>
+  if(p->state == RUNNING)
+8010415c:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80104160:	74 55                	je     801041b7 <sched+0x97>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80104162:	9c                   	pushf
+80104163:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80104164:	f6 c4 02             	test   $0x2,%ah
+80104167:	75 41                	jne    801041aa <sched+0x8a>
+  intena = mycpu()->intena;
+80104169:	e8 c2 f7 ff ff       	call   80103930 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+8010416e:	83 c3 1c             	add    $0x1c,%ebx
+  intena = mycpu()->intena;
+80104171:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80104177:	e8 b4 f7 ff ff       	call   80103930 <mycpu>
+8010417c:	83 ec 08             	sub    $0x8,%esp
+8010417f:	ff 70 04             	push   0x4(%eax)
+80104182:	53                   	push   %ebx
+80104183:	e8 43 0d 00 00       	call   80104ecb <swtch>
+  mycpu()->intena = intena;
+80104188:	e8 a3 f7 ff ff       	call   80103930 <mycpu>
+}
+8010418d:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80104190:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80104196:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104199:	5b                   	pop    %ebx
+8010419a:	5e                   	pop    %esi
+8010419b:	5d                   	pop    %ebp
+8010419c:	c3                   	ret
+    panic("sched ptable.lock");
+8010419d:	83 ec 0c             	sub    $0xc,%esp
+801041a0:	68 bb 84 10 80       	push   $0x801084bb
+801041a5:	e8 d6 c1 ff ff       	call   80100380 <panic>
+    panic("sched interruptible");
+801041aa:	83 ec 0c             	sub    $0xc,%esp
+801041ad:	68 e7 84 10 80       	push   $0x801084e7
+801041b2:	e8 c9 c1 ff ff       	call   80100380 <panic>
+    panic("sched running");
+801041b7:	83 ec 0c             	sub    $0xc,%esp
+801041ba:	68 d9 84 10 80       	push   $0x801084d9
+801041bf:	e8 bc c1 ff ff       	call   80100380 <panic>
+    panic("sched locks");
+801041c4:	83 ec 0c             	sub    $0xc,%esp
+801041c7:	68 cd 84 10 80       	push   $0x801084cd
+801041cc:	e8 af c1 ff ff       	call   80100380 <panic>
+801041d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041df:	90                   	nop
+
+801041e0 <wait>:
+{
+801041e0:	55                   	push   %ebp
+801041e1:	89 e5                	mov    %esp,%ebp
+801041e3:	56                   	push   %esi
+801041e4:	53                   	push   %ebx
+  pushcli();
+801041e5:	e8 a6 08 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+801041ea:	e8 41 f7 ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+801041ef:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+801041f5:	e8 e6 08 00 00       	call   80104ae0 <popcli>
+  acquire(&ptable.lock);
+801041fa:	83 ec 0c             	sub    $0xc,%esp
+801041fd:	68 40 2d 11 80       	push   $0x80112d40
+80104202:	e8 d9 09 00 00       	call   80104be0 <acquire>
+    for(p = curproc->children; p; p = p->sibling){
+80104207:	8b 9e 1c 01 00 00    	mov    0x11c(%esi),%ebx
+  acquire(&ptable.lock);
+8010420d:	83 c4 10             	add    $0x10,%esp
+    for(p = curproc->children; p; p = p->sibling){
+80104210:	85 db                	test   %ebx,%ebx
+80104212:	75 1a                	jne    8010422e <wait+0x4e>
+80104214:	e9 33 01 00 00       	jmp    8010434c <wait+0x16c>
+80104219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104220:	8b 9b 20 01 00 00    	mov    0x120(%ebx),%ebx
+80104226:	85 db                	test   %ebx,%ebx
+80104228:	0f 84 da 00 00 00    	je     80104308 <wait+0x128>
+      if(p->state == ZOMBIE){
+8010422e:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+80104232:	75 ec                	jne    80104220 <wait+0x40>
+        kfree(p->kstack);
+80104234:	83 ec 0c             	sub    $0xc,%esp
+        pid = p->pid;
+80104237:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+8010423a:	ff 73 08             	push   0x8(%ebx)
+8010423d:	e8 6e e3 ff ff       	call   801025b0 <kfree>
+        p->kstack = 0;
+80104242:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        freevm(p->pgdir);
+80104249:	59                   	pop    %ecx
+8010424a:	ff 73 04             	push   0x4(%ebx)
+8010424d:	e8 ee 38 00 00       	call   80107b40 <freevm>
+  if(p->pid){
+80104252:	8b 4b 10             	mov    0x10(%ebx),%ecx
+80104255:	83 c4 10             	add    $0x10,%esp
+80104258:	85 c9                	test   %ecx,%ecx
+8010425a:	74 48                	je     801042a4 <wait+0xc4>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+8010425c:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80104261:	f7 e9                	imul   %ecx
+80104263:	89 c8                	mov    %ecx,%eax
+80104265:	c1 f8 1f             	sar    $0x1f,%eax
+80104268:	c1 fa 04             	sar    $0x4,%edx
+8010426b:	29 c2                	sub    %eax,%edx
+8010426d:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80104270:	29 c1                	sub    %eax,%ecx
+80104272:	8b 04 8d 74 78 11 80 	mov    -0x7fee878c(,%ecx,4),%eax
+80104279:	85 c0                	test   %eax,%eax
+8010427b:	74 27                	je     801042a4 <wait+0xc4>
+      if(*pp == p){
+8010427d:	39 c3                	cmp    %eax,%ebx
+8010427f:	75 17                	jne    80104298 <wait+0xb8>
+80104281:	e9 f5 00 00 00       	jmp    8010437b <wait+0x19b>
+80104286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010428d:	8d 76 00             	lea    0x0(%esi),%esi
+80104290:	39 d8                	cmp    %ebx,%eax
+80104292:	0f 84 d0 00 00 00    	je     80104368 <wait+0x188>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80104298:	89 c2                	mov    %eax,%edx
+8010429a:	8b 80 28 01 00 00    	mov    0x128(%eax),%eax
+801042a0:	85 c0                	test   %eax,%eax
+801042a2:	75 ec                	jne    80104290 <wait+0xb0>
+  if(p->parent){
+801042a4:	8b 53 14             	mov    0x14(%ebx),%edx
+  p->pid = pid;
+801042a7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  if(p->parent){
+801042ae:	85 d2                	test   %edx,%edx
+801042b0:	74 1e                	je     801042d0 <wait+0xf0>
+    if((*p->psibling = p->sibling) != 0)
+801042b2:	8b 93 24 01 00 00    	mov    0x124(%ebx),%edx
+801042b8:	8b 83 20 01 00 00    	mov    0x120(%ebx),%eax
+801042be:	89 02                	mov    %eax,(%edx)
+801042c0:	85 c0                	test   %eax,%eax
+801042c2:	74 0c                	je     801042d0 <wait+0xf0>
+      p->sibling->psibling = p->psibling;
+801042c4:	8b 93 24 01 00 00    	mov    0x124(%ebx),%edx
+801042ca:	89 90 24 01 00 00    	mov    %edx,0x124(%eax)
+        release(&ptable.lock);
+801042d0:	83 ec 0c             	sub    $0xc,%esp
+  p->parent = parent;
+801042d3:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+        p->name[0] = 0;
+801042da:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+        p->killed = 0;
+801042de:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+        p->state = UNUSED;
+801042e5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        release(&ptable.lock);
+801042ec:	68 40 2d 11 80       	push   $0x80112d40
+801042f1:	e8 8a 08 00 00       	call   80104b80 <release>
+        return pid;
+801042f6:	83 c4 10             	add    $0x10,%esp
+}
+801042f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801042fc:	89 f0                	mov    %esi,%eax
+801042fe:	5b                   	pop    %ebx
+801042ff:	5e                   	pop    %esi
+80104300:	5d                   	pop    %ebp
+80104301:	c3                   	ret
+80104302:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(!havekids || curproc->killed){
+80104308:	8b 46 24             	mov    0x24(%esi),%eax
+8010430b:	85 c0                	test   %eax,%eax
+8010430d:	75 3d                	jne    8010434c <wait+0x16c>
+  pushcli();
+8010430f:	e8 7c 07 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+80104314:	e8 17 f6 ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+80104319:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010431f:	e8 bc 07 00 00       	call   80104ae0 <popcli>
+  if(p == 0)
+80104324:	85 db                	test   %ebx,%ebx
+80104326:	74 5c                	je     80104384 <wait+0x1a4>
+  p->chan = chan;
+80104328:	89 73 20             	mov    %esi,0x20(%ebx)
+  p->state = SLEEPING;
+8010432b:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104332:	e8 e9 fd ff ff       	call   80104120 <sched>
+  p->chan = 0;
+80104337:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    for(p = curproc->children; p; p = p->sibling){
+8010433e:	8b 9e 1c 01 00 00    	mov    0x11c(%esi),%ebx
+80104344:	85 db                	test   %ebx,%ebx
+80104346:	0f 85 e2 fe ff ff    	jne    8010422e <wait+0x4e>
+      release(&ptable.lock);
+8010434c:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+8010434f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+80104354:	68 40 2d 11 80       	push   $0x80112d40
+80104359:	e8 22 08 00 00       	call   80104b80 <release>
+      return -1;
+8010435e:	83 c4 10             	add    $0x10,%esp
+80104361:	eb 96                	jmp    801042f9 <wait+0x119>
+80104363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104367:	90                   	nop
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+80104368:	81 c2 28 01 00 00    	add    $0x128,%edx
+        *pp = p->pidnext;
+8010436e:	8b 83 28 01 00 00    	mov    0x128(%ebx),%eax
+80104374:	89 02                	mov    %eax,(%edx)
+        break;
+80104376:	e9 29 ff ff ff       	jmp    801042a4 <wait+0xc4>
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+8010437b:	8d 14 8d 74 78 11 80 	lea    -0x7fee878c(,%ecx,4),%edx
+80104382:	eb ea                	jmp    8010436e <wait+0x18e>
+    panic("sleep");
+80104384:	83 ec 0c             	sub    $0xc,%esp
+80104387:	68 fb 84 10 80       	push   $0x801084fb
+8010438c:	e8 ef bf ff ff       	call   80100380 <panic>
+80104391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010439f:	90                   	nop
+
+801043a0 <yield>:
+{
+801043a0:	55                   	push   %ebp
+801043a1:	89 e5                	mov    %esp,%ebp
+801043a3:	53                   	push   %ebx
+801043a4:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+801043a7:	68 40 2d 11 80       	push   $0x80112d40
+801043ac:	e8 2f 08 00 00       	call   80104be0 <acquire>
+  pushcli();
+801043b1:	e8 da 06 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+801043b6:	e8 75 f5 ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+801043bb:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801043c1:	e8 1a 07 00 00       	call   80104ae0 <popcli>
+  myproc()->state = RUNNABLE;
+801043c6:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  sched();
+801043cd:	e8 4e fd ff ff       	call   80104120 <sched>
+  release(&ptable.lock);
+801043d2:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+801043d9:	e8 a2 07 00 00       	call   80104b80 <release>
+}
+801043de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801043e1:	83 c4 10             	add    $0x10,%esp
+801043e4:	c9                   	leave
+801043e5:	c3                   	ret
+801043e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801043ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801043f0 <sleep>:
+{
+801043f0:	55                   	push   %ebp
+801043f1:	89 e5                	mov    %esp,%ebp
+801043f3:	57                   	push   %edi
+801043f4:	56                   	push   %esi
+801043f5:	53                   	push   %ebx
+801043f6:	83 ec 0c             	sub    $0xc,%esp
+801043f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+801043fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pushcli();
+801043ff:	e8 8c 06 00 00       	call   80104a90 <pushcli>
+  c = mycpu();
+80104404:	e8 27 f5 ff ff       	call   80103930 <mycpu>
+  p = c->proc;
+80104409:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010440f:	e8 cc 06 00 00       	call   80104ae0 <popcli>
+  if(p == 0)
+80104414:	85 db                	test   %ebx,%ebx
+80104416:	0f 84 87 00 00 00    	je     801044a3 <sleep+0xb3>
+  if(lk == 0)
+8010441c:	85 f6                	test   %esi,%esi
+8010441e:	74 76                	je     80104496 <sleep+0xa6>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80104420:	81 fe 40 2d 11 80    	cmp    $0x80112d40,%esi
+80104426:	74 50                	je     80104478 <sleep+0x88>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80104428:	83 ec 0c             	sub    $0xc,%esp
+8010442b:	68 40 2d 11 80       	push   $0x80112d40
+80104430:	e8 ab 07 00 00       	call   80104be0 <acquire>
+    release(lk);
+80104435:	89 34 24             	mov    %esi,(%esp)
+80104438:	e8 43 07 00 00       	call   80104b80 <release>
+  p->chan = chan;
+8010443d:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+80104440:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104447:	e8 d4 fc ff ff       	call   80104120 <sched>
+  p->chan = 0;
+8010444c:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    release(&ptable.lock);
+80104453:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+8010445a:	e8 21 07 00 00       	call   80104b80 <release>
+    acquire(lk);
+8010445f:	89 75 08             	mov    %esi,0x8(%ebp)
+80104462:	83 c4 10             	add    $0x10,%esp
+}
+80104465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104468:	5b                   	pop    %ebx
+80104469:	5e                   	pop    %esi
+8010446a:	5f                   	pop    %edi
+8010446b:	5d                   	pop    %ebp
+    acquire(lk);
+8010446c:	e9 6f 07 00 00       	jmp    80104be0 <acquire>
+80104471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  p->chan = chan;
+80104478:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+8010447b:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80104482:	e8 99 fc ff ff       	call   80104120 <sched>
+  p->chan = 0;
+80104487:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+}
+8010448e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104491:	5b                   	pop    %ebx
+80104492:	5e                   	pop    %esi
+80104493:	5f                   	pop    %edi
+80104494:	5d                   	pop    %ebp
+80104495:	c3                   	ret
+    panic("sleep without lk");
+80104496:	83 ec 0c             	sub    $0xc,%esp
+80104499:	68 01 85 10 80       	push   $0x80108501
+8010449e:	e8 dd be ff ff       	call   80100380 <panic>
+    panic("sleep");
+801044a3:	83 ec 0c             	sub    $0xc,%esp
+801044a6:	68 fb 84 10 80       	push   $0x801084fb
+801044ab:	e8 d0 be ff ff       	call   80100380 <panic>
+
+801044b0 <wakeup1>:
+{
+801044b0:	55                   	push   %ebp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801044b1:	b8 74 2d 11 80       	mov    $0x80112d74,%eax
+{
+801044b6:	89 e5                	mov    %esp,%ebp
+801044b8:	8b 55 08             	mov    0x8(%ebp),%edx
+801044bb:	eb 0f                	jmp    801044cc <wakeup1+0x1c>
+801044bd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801044c0:	05 2c 01 00 00       	add    $0x12c,%eax
+801044c5:	3d 74 78 11 80       	cmp    $0x80117874,%eax
+801044ca:	74 1e                	je     801044ea <wakeup1+0x3a>
+    if(p->state == SLEEPING && p->chan == chan)
+801044cc:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+801044d0:	75 ee                	jne    801044c0 <wakeup1+0x10>
+801044d2:	39 50 20             	cmp    %edx,0x20(%eax)
+801044d5:	75 e9                	jne    801044c0 <wakeup1+0x10>
+      p->state = RUNNABLE;
+801044d7:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801044de:	05 2c 01 00 00       	add    $0x12c,%eax
+801044e3:	3d 74 78 11 80       	cmp    $0x80117874,%eax
+801044e8:	75 e2                	jne    801044cc <wakeup1+0x1c>
+}
+801044ea:	5d                   	pop    %ebp
+801044eb:	c3                   	ret
+801044ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801044f0 <exit>:
+{
+801044f0:	55                   	push   %ebp
+801044f1:	89 e5                	mov    %esp,%ebp
+801044f3:	57                   	push   %edi
+801044f4:	56                   	push   %esi
+801044f5:	53                   	push   %ebx
+801044f6:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+801044f9:	e8 b2 f4 ff ff       	call   801039b0 <myproc>
+  if(curproc == initproc)
+801044fe:	39 05 20 2d 11 80    	cmp    %eax,0x80112d20
+80104504:	0f 84 85 00 00 00    	je     8010458f <exit+0x9f>
+8010450a:	89 c6                	mov    %eax,%esi
+8010450c:	8d 58 28             	lea    0x28(%eax),%ebx
+8010450f:	8d 78 68             	lea    0x68(%eax),%edi
+80104512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+80104518:	8b 03                	mov    (%ebx),%eax
+8010451a:	85 c0                	test   %eax,%eax
+8010451c:	74 12                	je     80104530 <exit+0x40>
+      fileclose(curproc->ofile[fd]);
+8010451e:	83 ec 0c             	sub    $0xc,%esp
+80104521:	50                   	push   %eax
+80104522:	e8 a9 ca ff ff       	call   80100fd0 <fileclose>
+      curproc->ofile[fd] = 0;
+80104527:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+8010452d:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80104530:	83 c3 04             	add    $0x4,%ebx
+80104533:	39 fb                	cmp    %edi,%ebx
+80104535:	75 e1                	jne    80104518 <exit+0x28>
+  clean_thread(curproc);
+80104537:	83 ec 0c             	sub    $0xc,%esp
+8010453a:	56                   	push   %esi
+8010453b:	e8 90 1f 00 00       	call   801064d0 <clean_thread>
+  begin_op();
+80104540:	e8 1b e9 ff ff       	call   80102e60 <begin_op>
+  iput(curproc->cwd);
+80104545:	58                   	pop    %eax
+80104546:	ff 76 68             	push   0x68(%esi)
+80104549:	e8 42 d4 ff ff       	call   80101990 <iput>
+  end_op();
+8010454e:	e8 7d e9 ff ff       	call   80102ed0 <end_op>
+  curproc->cwd = 0;
+80104553:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+  acquire(&ptable.lock);
+8010455a:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80104561:	e8 7a 06 00 00       	call   80104be0 <acquire>
+  wakeup1(curproc->parent);
+80104566:	5a                   	pop    %edx
+80104567:	ff 76 14             	push   0x14(%esi)
+8010456a:	e8 41 ff ff ff       	call   801044b0 <wakeup1>
+  reparent(curproc);
+8010456f:	89 34 24             	mov    %esi,(%esp)
+80104572:	e8 d9 f4 ff ff       	call   80103a50 <reparent>
+  curproc->state = ZOMBIE;
+80104577:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  sched();
+8010457e:	e8 9d fb ff ff       	call   80104120 <sched>
+  panic("zombie exit");
+80104583:	c7 04 24 1f 85 10 80 	movl   $0x8010851f,(%esp)
+8010458a:	e8 f1 bd ff ff       	call   80100380 <panic>
+    panic("init exiting");
+8010458f:	83 ec 0c             	sub    $0xc,%esp
+80104592:	68 12 85 10 80       	push   $0x80108512
+80104597:	e8 e4 bd ff ff       	call   80100380 <panic>
+8010459c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801045a0 <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+801045a0:	55                   	push   %ebp
+801045a1:	89 e5                	mov    %esp,%ebp
+801045a3:	53                   	push   %ebx
+801045a4:	83 ec 10             	sub    $0x10,%esp
+801045a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+801045aa:	68 40 2d 11 80       	push   $0x80112d40
+801045af:	e8 2c 06 00 00       	call   80104be0 <acquire>
+801045b4:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801045b7:	b8 74 2d 11 80       	mov    $0x80112d74,%eax
+801045bc:	eb 0e                	jmp    801045cc <wakeup+0x2c>
+801045be:	66 90                	xchg   %ax,%ax
+801045c0:	05 2c 01 00 00       	add    $0x12c,%eax
+801045c5:	3d 74 78 11 80       	cmp    $0x80117874,%eax
+801045ca:	74 1e                	je     801045ea <wakeup+0x4a>
+    if(p->state == SLEEPING && p->chan == chan)
+801045cc:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+801045d0:	75 ee                	jne    801045c0 <wakeup+0x20>
+801045d2:	3b 58 20             	cmp    0x20(%eax),%ebx
+801045d5:	75 e9                	jne    801045c0 <wakeup+0x20>
+      p->state = RUNNABLE;
+801045d7:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+801045de:	05 2c 01 00 00       	add    $0x12c,%eax
+801045e3:	3d 74 78 11 80       	cmp    $0x80117874,%eax
+801045e8:	75 e2                	jne    801045cc <wakeup+0x2c>
+  wakeup1(chan);
+  release(&ptable.lock);
+801045ea:	c7 45 08 40 2d 11 80 	movl   $0x80112d40,0x8(%ebp)
+}
+801045f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801045f4:	c9                   	leave
+  release(&ptable.lock);
+801045f5:	e9 86 05 00 00       	jmp    80104b80 <release>
+801045fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104600 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+80104600:	55                   	push   %ebp
+80104601:	89 e5                	mov    %esp,%ebp
+80104603:	53                   	push   %ebx
+80104604:	83 ec 10             	sub    $0x10,%esp
+80104607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+8010460a:	68 40 2d 11 80       	push   $0x80112d40
+8010460f:	e8 cc 05 00 00       	call   80104be0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->pidnext){
+80104614:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80104619:	83 c4 10             	add    $0x10,%esp
+8010461c:	f7 eb                	imul   %ebx
+8010461e:	89 d8                	mov    %ebx,%eax
+80104620:	c1 f8 1f             	sar    $0x1f,%eax
+80104623:	c1 fa 04             	sar    $0x4,%edx
+80104626:	29 c2                	sub    %eax,%edx
+80104628:	89 d8                	mov    %ebx,%eax
+8010462a:	6b d2 3d             	imul   $0x3d,%edx,%edx
+8010462d:	29 d0                	sub    %edx,%eax
+8010462f:	8b 04 85 74 78 11 80 	mov    -0x7fee878c(,%eax,4),%eax
+80104636:	85 c0                	test   %eax,%eax
+80104638:	74 5a                	je     80104694 <kill+0x94>
+  lwp = 0;
+8010463a:	31 d2                	xor    %edx,%edx
+8010463c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p->pid != pid)
+80104640:	3b 58 10             	cmp    0x10(%eax),%ebx
+80104643:	75 0f                	jne    80104654 <kill+0x54>
+    if(!p->isthread)
+80104645:	8b 88 88 00 00 00    	mov    0x88(%eax),%ecx
+8010464b:	85 c9                	test   %ecx,%ecx
+8010464d:	74 41                	je     80104690 <kill+0x90>
+    if(!lwp)
+8010464f:	85 d2                	test   %edx,%edx
+80104651:	0f 44 d0             	cmove  %eax,%edx
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->pidnext){
+80104654:	8b 80 28 01 00 00    	mov    0x128(%eax),%eax
+8010465a:	85 c0                	test   %eax,%eax
+8010465c:	75 e2                	jne    80104640 <kill+0x40>
+  if((p = findproc(pid)) != 0){
+8010465e:	85 d2                	test   %edx,%edx
+80104660:	74 32                	je     80104694 <kill+0x94>
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+80104662:	83 7a 0c 02          	cmpl   $0x2,0xc(%edx)
+    p->killed = 1;
+80104666:	c7 42 24 01 00 00 00 	movl   $0x1,0x24(%edx)
+    if(p->state == SLEEPING)
+8010466d:	75 07                	jne    80104676 <kill+0x76>
+      p->state = RUNNABLE;
+8010466f:	c7 42 0c 03 00 00 00 	movl   $0x3,0xc(%edx)
+    release(&ptable.lock);
+80104676:	83 ec 0c             	sub    $0xc,%esp
+80104679:	68 40 2d 11 80       	push   $0x80112d40
+8010467e:	e8 fd 04 00 00       	call   80104b80 <release>
+    return 0;
+80104683:	83 c4 10             	add    $0x10,%esp
+80104686:	31 c0                	xor    %eax,%eax
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80104688:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010468b:	c9                   	leave
+8010468c:	c3                   	ret
+8010468d:	8d 76 00             	lea    0x0(%esi),%esi
+80104690:	89 c2                	mov    %eax,%edx
+80104692:	eb ce                	jmp    80104662 <kill+0x62>
+  release(&ptable.lock);
+80104694:	83 ec 0c             	sub    $0xc,%esp
+80104697:	68 40 2d 11 80       	push   $0x80112d40
+8010469c:	e8 df 04 00 00       	call   80104b80 <release>
+  return -1;
+801046a1:	83 c4 10             	add    $0x10,%esp
+801046a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801046a9:	eb dd                	jmp    80104688 <kill+0x88>
+801046ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801046af:	90                   	nop
+
+801046b0 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+801046b0:	55                   	push   %ebp
+801046b1:	89 e5                	mov    %esp,%ebp
+801046b3:	57                   	push   %edi
+801046b4:	56                   	push   %esi
+801046b5:	8d 75 e8             	lea    -0x18(%ebp),%esi
+801046b8:	53                   	push   %ebx
+801046b9:	bb e0 2d 11 80       	mov    $0x80112de0,%ebx
+801046be:	83 ec 3c             	sub    $0x3c,%esp
+801046c1:	eb 27                	jmp    801046ea <procdump+0x3a>
+801046c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801046c7:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+801046c8:	83 ec 0c             	sub    $0xc,%esp
+801046cb:	68 4f 89 10 80       	push   $0x8010894f
+801046d0:	e8 db bf ff ff       	call   801006b0 <cprintf>
+801046d5:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801046d8:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+801046de:	81 fb e0 78 11 80    	cmp    $0x801178e0,%ebx
+801046e4:	0f 84 7e 00 00 00    	je     80104768 <procdump+0xb8>
+    if(p->state == UNUSED)
+801046ea:	8b 43 a0             	mov    -0x60(%ebx),%eax
+801046ed:	85 c0                	test   %eax,%eax
+801046ef:	74 e7                	je     801046d8 <procdump+0x28>
+      state = "???";
+801046f1:	ba 2b 85 10 80       	mov    $0x8010852b,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801046f6:	83 f8 05             	cmp    $0x5,%eax
+801046f9:	77 11                	ja     8010470c <procdump+0x5c>
+801046fb:	8b 14 85 e8 85 10 80 	mov    -0x7fef7a18(,%eax,4),%edx
+      state = "???";
+80104702:	b8 2b 85 10 80       	mov    $0x8010852b,%eax
+80104707:	85 d2                	test   %edx,%edx
+80104709:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+8010470c:	53                   	push   %ebx
+8010470d:	52                   	push   %edx
+8010470e:	ff 73 a4             	push   -0x5c(%ebx)
+80104711:	68 2f 85 10 80       	push   $0x8010852f
+80104716:	e8 95 bf ff ff       	call   801006b0 <cprintf>
+    if(p->state == SLEEPING){
+8010471b:	83 c4 10             	add    $0x10,%esp
+8010471e:	83 7b a0 02          	cmpl   $0x2,-0x60(%ebx)
+80104722:	75 a4                	jne    801046c8 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80104724:	83 ec 08             	sub    $0x8,%esp
+80104727:	8d 45 c0             	lea    -0x40(%ebp),%eax
+8010472a:	8d 7d c0             	lea    -0x40(%ebp),%edi
+8010472d:	50                   	push   %eax
+8010472e:	8b 43 b0             	mov    -0x50(%ebx),%eax
+80104731:	8b 40 0c             	mov    0xc(%eax),%eax
+80104734:	83 c0 08             	add    $0x8,%eax
+80104737:	50                   	push   %eax
+80104738:	e8 e3 02 00 00       	call   80104a20 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010473d:	83 c4 10             	add    $0x10,%esp
+80104740:	8b 17                	mov    (%edi),%edx
+80104742:	85 d2                	test   %edx,%edx
+80104744:	74 82                	je     801046c8 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80104746:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104749:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+8010474c:	52                   	push   %edx
+8010474d:	68 61 7f 10 80       	push   $0x80107f61
+80104752:	e8 59 bf ff ff       	call   801006b0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80104757:	83 c4 10             	add    $0x10,%esp
+8010475a:	39 f7                	cmp    %esi,%edi
+8010475c:	75 e2                	jne    80104740 <procdump+0x90>
+8010475e:	e9 65 ff ff ff       	jmp    801046c8 <procdump+0x18>
+80104763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104767:	90                   	nop
+  }
+}
+80104768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010476b:	5b                   	pop    %ebx
+8010476c:	5e                   	pop    %esi
+8010476d:	5f                   	pop    %edi
+8010476e:	5d                   	pop    %ebp
+8010476f:	c3                   	ret
+
+80104770 <setmemorylimit>:
+
+// Set memory limit (bytes)
+int 
+setmemorylimit(int pid, int limit) 
+{
+80104770:	55                   	push   %ebp
+80104771:	89 e5                	mov    %esp,%ebp
+80104773:	57                   	push   %edi
+80104774:	56                   	push   %esi
+80104775:	53                   	push   %ebx
+80104776:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *p;
+
+  if (limit < 0)
+80104779:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+8010477c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (limit < 0)
+8010477f:	85 d2                	test   %edx,%edx
+80104781:	0f 88 ad 00 00 00    	js     80104834 <setmemorylimit+0xc4>
+    return -1;
+
+  acquire(&ptable.lock);
+80104787:	83 ec 0c             	sub    $0xc,%esp
+8010478a:	68 40 2d 11 80       	push   $0x80112d40
+8010478f:	e8 4c 04 00 00       	call   80104be0 <acquire>
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->pidnext){
+80104794:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80104799:	83 c4 10             	add    $0x10,%esp
+8010479c:	f7 ef                	imul   %edi
+8010479e:	89 f8                	mov    %edi,%eax
+801047a0:	c1 f8 1f             	sar    $0x1f,%eax
+801047a3:	c1 fa 04             	sar    $0x4,%edx
+801047a6:	29 c2                	sub    %eax,%edx
+801047a8:	89 f8                	mov    %edi,%eax
+801047aa:	6b d2 3d             	imul   $0x3d,%edx,%edx
+801047ad:	29 d0                	sub    %edx,%eax
+801047af:	8b 1c 85 74 78 11 80 	mov    -0x7fee878c(,%eax,4),%ebx
+801047b6:	85 db                	test   %ebx,%ebx
+801047b8:	74 6a                	je     80104824 <setmemorylimit+0xb4>
+  lwp = 0;
+801047ba:	31 f6                	xor    %esi,%esi
+801047bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p->pid != pid)
+801047c0:	3b 7b 10             	cmp    0x10(%ebx),%edi
+801047c3:	75 0f                	jne    801047d4 <setmemorylimit+0x64>
+    if(!p->isthread)
+801047c5:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+801047cb:	85 c0                	test   %eax,%eax
+801047cd:	74 41                	je     80104810 <setmemorylimit+0xa0>
+    if(!lwp)
+801047cf:	85 f6                	test   %esi,%esi
+801047d1:	0f 44 f3             	cmove  %ebx,%esi
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->pidnext){
+801047d4:	8b 9b 28 01 00 00    	mov    0x128(%ebx),%ebx
+801047da:	85 db                	test   %ebx,%ebx
+801047dc:	75 e2                	jne    801047c0 <setmemorylimit+0x50>
+  p = findproc(pid);
+  release(&ptable.lock);
+801047de:	83 ec 0c             	sub    $0xc,%esp
+801047e1:	68 40 2d 11 80       	push   $0x80112d40
+801047e6:	e8 95 03 00 00       	call   80104b80 <release>
+
+  if (!p)
+801047eb:	83 c4 10             	add    $0x10,%esp
+801047ee:	85 f6                	test   %esi,%esi
+801047f0:	74 42                	je     80104834 <setmemorylimit+0xc4>
+    return -1;
+
+  if (p->sz > limit) 
+801047f2:	8b 06                	mov    (%esi),%eax
+801047f4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+801047f7:	72 3b                	jb     80104834 <setmemorylimit+0xc4>
+    return -1;
+
+  p->limit = limit;
+801047f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801047fc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+
+  return 0;
+80104802:	31 c0                	xor    %eax,%eax
+}
+80104804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104807:	5b                   	pop    %ebx
+80104808:	5e                   	pop    %esi
+80104809:	5f                   	pop    %edi
+8010480a:	5d                   	pop    %ebp
+8010480b:	c3                   	ret
+8010480c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  release(&ptable.lock);
+80104810:	83 ec 0c             	sub    $0xc,%esp
+80104813:	89 de                	mov    %ebx,%esi
+80104815:	68 40 2d 11 80       	push   $0x80112d40
+8010481a:	e8 61 03 00 00       	call   80104b80 <release>
+8010481f:	83 c4 10             	add    $0x10,%esp
+80104822:	eb ce                	jmp    801047f2 <setmemorylimit+0x82>
+80104824:	83 ec 0c             	sub    $0xc,%esp
+80104827:	68 40 2d 11 80       	push   $0x80112d40
+8010482c:	e8 4f 03 00 00       	call   80104b80 <release>
+80104831:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80104834:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104839:	eb c9                	jmp    80104804 <setmemorylimit+0x94>
+8010483b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010483f:	90                   	nop
+
+80104840 <listproc>:
+
+int
+listproc(void) 
+{
+80104840:	55                   	push   %ebp
+80104841:	89 e5                	mov    %esp,%ebp
+80104843:	53                   	push   %ebx
+80104844:	bb e0 2d 11 80       	mov    $0x80112de0,%ebx
+80104849:	83 ec 10             	sub    $0x10,%esp
+  struct proc *p;
+
+  cprintf("proc \tpid \tstack \tmemory \tmemlimit\n");
+8010484c:	68 c4 85 10 80       	push   $0x801085c4
+80104851:	e8 5a be ff ff       	call   801006b0 <cprintf>
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104856:	83 c4 10             	add    $0x10,%esp
+80104859:	eb 13                	jmp    8010486e <listproc+0x2e>
+8010485b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010485f:	90                   	nop
+80104860:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+80104866:	81 fb e0 78 11 80    	cmp    $0x801178e0,%ebx
+8010486c:	74 42                	je     801048b0 <listproc+0x70>
+    if (p->isthread || p->stackpage == 0) continue;
+8010486e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80104871:	85 c0                	test   %eax,%eax
+80104873:	75 eb                	jne    80104860 <listproc+0x20>
+80104875:	8b 53 10             	mov    0x10(%ebx),%edx
+80104878:	85 d2                	test   %edx,%edx
+8010487a:	74 e4                	je     80104860 <listproc+0x20>
+
+    if (p->state == RUNNING || p->state == RUNNABLE || p->state == SLEEPING) {
+8010487c:	8b 43 a0             	mov    -0x60(%ebx),%eax
+8010487f:	83 e8 02             	sub    $0x2,%eax
+80104882:	83 f8 02             	cmp    $0x2,%eax
+80104885:	77 d9                	ja     80104860 <listproc+0x20>
+      cprintf("%s \t%d \t%d \t%d \t%d\n", p->name, p->pid, p->stackpage, p->sz, p->limit);
+80104887:	83 ec 08             	sub    $0x8,%esp
+8010488a:	ff 73 14             	push   0x14(%ebx)
+8010488d:	ff 73 94             	push   -0x6c(%ebx)
+80104890:	52                   	push   %edx
+80104891:	ff 73 a4             	push   -0x5c(%ebx)
+80104894:	53                   	push   %ebx
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104895:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+      cprintf("%s \t%d \t%d \t%d \t%d\n", p->name, p->pid, p->stackpage, p->sz, p->limit);
+8010489b:	68 38 85 10 80       	push   $0x80108538
+801048a0:	e8 0b be ff ff       	call   801006b0 <cprintf>
+801048a5:	83 c4 20             	add    $0x20,%esp
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+801048a8:	81 fb e0 78 11 80    	cmp    $0x801178e0,%ebx
+801048ae:	75 be                	jne    8010486e <listproc+0x2e>
+    }
+  }
+  cprintf("\n");
+801048b0:	83 ec 0c             	sub    $0xc,%esp
+801048b3:	68 4f 89 10 80       	push   $0x8010894f
+801048b8:	e8 f3 bd ff ff       	call   801006b0 <cprintf>
+
+  return 0;
+}
+801048bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801048c0:	31 c0                	xor    %eax,%eax
+801048c2:	c9                   	leave
+801048c3:	c3                   	ret
+801048c4:	66 90                	xchg   %ax,%ax
+801048c6:	66 90                	xchg   %ax,%ax
+801048c8:	66 90                	xchg   %ax,%ax
+801048ca:	66 90                	xchg   %ax,%ax
+801048cc:	66 90                	xchg   %ax,%ax
+801048ce:	66 90                	xchg   %ax,%ax
+
+801048d0 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801048d0:	55                   	push   %ebp
+801048d1:	89 e5                	mov    %esp,%ebp
+801048d3:	53                   	push   %ebx
+801048d4:	83 ec 0c             	sub    $0xc,%esp
+801048d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801048da:	68 00 86 10 80       	push   $0x80108600
+801048df:	8d 43 04             	lea    0x4(%ebx),%eax
+801048e2:	50                   	push   %eax
+801048e3:	e8 18 01 00 00       	call   80104a00 <initlock>
+  lk->name = name;
+801048e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+801048eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+801048f1:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+801048f4:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+801048fb:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+801048fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104901:	c9                   	leave
+80104902:	c3                   	ret
+80104903:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010490a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104910 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80104910:	55                   	push   %ebp
+80104911:	89 e5                	mov    %esp,%ebp
+80104913:	56                   	push   %esi
+80104914:	53                   	push   %ebx
+80104915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80104918:	8d 73 04             	lea    0x4(%ebx),%esi
+8010491b:	83 ec 0c             	sub    $0xc,%esp
+8010491e:	56                   	push   %esi
+8010491f:	e8 bc 02 00 00       	call   80104be0 <acquire>
+  while (lk->locked) {
+80104924:	8b 13                	mov    (%ebx),%edx
+80104926:	83 c4 10             	add    $0x10,%esp
+80104929:	85 d2                	test   %edx,%edx
+8010492b:	74 16                	je     80104943 <acquiresleep+0x33>
+8010492d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80104930:	83 ec 08             	sub    $0x8,%esp
+80104933:	56                   	push   %esi
+80104934:	53                   	push   %ebx
+80104935:	e8 b6 fa ff ff       	call   801043f0 <sleep>
+  while (lk->locked) {
+8010493a:	8b 03                	mov    (%ebx),%eax
+8010493c:	83 c4 10             	add    $0x10,%esp
+8010493f:	85 c0                	test   %eax,%eax
+80104941:	75 ed                	jne    80104930 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80104943:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80104949:	e8 62 f0 ff ff       	call   801039b0 <myproc>
+8010494e:	8b 40 10             	mov    0x10(%eax),%eax
+80104951:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80104954:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80104957:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010495a:	5b                   	pop    %ebx
+8010495b:	5e                   	pop    %esi
+8010495c:	5d                   	pop    %ebp
+  release(&lk->lk);
+8010495d:	e9 1e 02 00 00       	jmp    80104b80 <release>
+80104962:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104970 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80104970:	55                   	push   %ebp
+80104971:	89 e5                	mov    %esp,%ebp
+80104973:	56                   	push   %esi
+80104974:	53                   	push   %ebx
+80104975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80104978:	8d 73 04             	lea    0x4(%ebx),%esi
+8010497b:	83 ec 0c             	sub    $0xc,%esp
+8010497e:	56                   	push   %esi
+8010497f:	e8 5c 02 00 00       	call   80104be0 <acquire>
+  lk->locked = 0;
+80104984:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+8010498a:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80104991:	89 1c 24             	mov    %ebx,(%esp)
+80104994:	e8 07 fc ff ff       	call   801045a0 <wakeup>
+  release(&lk->lk);
+80104999:	89 75 08             	mov    %esi,0x8(%ebp)
+8010499c:	83 c4 10             	add    $0x10,%esp
+}
+8010499f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801049a2:	5b                   	pop    %ebx
+801049a3:	5e                   	pop    %esi
+801049a4:	5d                   	pop    %ebp
+  release(&lk->lk);
+801049a5:	e9 d6 01 00 00       	jmp    80104b80 <release>
+801049aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801049b0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+801049b0:	55                   	push   %ebp
+801049b1:	89 e5                	mov    %esp,%ebp
+801049b3:	57                   	push   %edi
+801049b4:	31 ff                	xor    %edi,%edi
+801049b6:	56                   	push   %esi
+801049b7:	53                   	push   %ebx
+801049b8:	83 ec 18             	sub    $0x18,%esp
+801049bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+801049be:	8d 73 04             	lea    0x4(%ebx),%esi
+801049c1:	56                   	push   %esi
+801049c2:	e8 19 02 00 00       	call   80104be0 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+801049c7:	8b 03                	mov    (%ebx),%eax
+801049c9:	83 c4 10             	add    $0x10,%esp
+801049cc:	85 c0                	test   %eax,%eax
+801049ce:	75 18                	jne    801049e8 <holdingsleep+0x38>
+  release(&lk->lk);
+801049d0:	83 ec 0c             	sub    $0xc,%esp
+801049d3:	56                   	push   %esi
+801049d4:	e8 a7 01 00 00       	call   80104b80 <release>
+  return r;
+}
+801049d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801049dc:	89 f8                	mov    %edi,%eax
+801049de:	5b                   	pop    %ebx
+801049df:	5e                   	pop    %esi
+801049e0:	5f                   	pop    %edi
+801049e1:	5d                   	pop    %ebp
+801049e2:	c3                   	ret
+801049e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801049e7:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+801049e8:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+801049eb:	e8 c0 ef ff ff       	call   801039b0 <myproc>
+801049f0:	39 58 10             	cmp    %ebx,0x10(%eax)
+801049f3:	0f 94 c0             	sete   %al
+801049f6:	0f b6 c0             	movzbl %al,%eax
+801049f9:	89 c7                	mov    %eax,%edi
+801049fb:	eb d3                	jmp    801049d0 <holdingsleep+0x20>
+801049fd:	66 90                	xchg   %ax,%ax
+801049ff:	90                   	nop
+
+80104a00 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80104a00:	55                   	push   %ebp
+80104a01:	89 e5                	mov    %esp,%ebp
+80104a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80104a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80104a09:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+80104a0f:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80104a12:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80104a19:	5d                   	pop    %ebp
+80104a1a:	c3                   	ret
+80104a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104a1f:	90                   	nop
+
+80104a20 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80104a20:	55                   	push   %ebp
+80104a21:	89 e5                	mov    %esp,%ebp
+80104a23:	53                   	push   %ebx
+80104a24:	8b 45 08             	mov    0x8(%ebp),%eax
+80104a27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80104a2a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80104a2d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80104a32:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80104a37:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80104a3c:	76 10                	jbe    80104a4e <getcallerpcs+0x2e>
+80104a3e:	eb 28                	jmp    80104a68 <getcallerpcs+0x48>
+80104a40:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80104a46:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80104a4c:	77 1a                	ja     80104a68 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80104a4e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80104a51:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80104a54:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80104a57:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80104a59:	83 f8 0a             	cmp    $0xa,%eax
+80104a5c:	75 e2                	jne    80104a40 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80104a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a61:	c9                   	leave
+80104a62:	c3                   	ret
+80104a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104a67:	90                   	nop
+80104a68:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80104a6b:	8d 51 28             	lea    0x28(%ecx),%edx
+80104a6e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80104a70:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80104a76:	83 c0 04             	add    $0x4,%eax
+80104a79:	39 d0                	cmp    %edx,%eax
+80104a7b:	75 f3                	jne    80104a70 <getcallerpcs+0x50>
+}
+80104a7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a80:	c9                   	leave
+80104a81:	c3                   	ret
+80104a82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104a90 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80104a90:	55                   	push   %ebp
+80104a91:	89 e5                	mov    %esp,%ebp
+80104a93:	53                   	push   %ebx
+80104a94:	83 ec 04             	sub    $0x4,%esp
+80104a97:	9c                   	pushf
+80104a98:	5b                   	pop    %ebx
+  asm volatile("cli");
+80104a99:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80104a9a:	e8 91 ee ff ff       	call   80103930 <mycpu>
+80104a9f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80104aa5:	85 c0                	test   %eax,%eax
+80104aa7:	74 17                	je     80104ac0 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80104aa9:	e8 82 ee ff ff       	call   80103930 <mycpu>
+80104aae:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80104ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ab8:	c9                   	leave
+80104ab9:	c3                   	ret
+80104aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80104ac0:	e8 6b ee ff ff       	call   80103930 <mycpu>
+80104ac5:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80104acb:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80104ad1:	eb d6                	jmp    80104aa9 <pushcli+0x19>
+80104ad3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104ae0 <popcli>:
+
+void
+popcli(void)
+{
+80104ae0:	55                   	push   %ebp
+80104ae1:	89 e5                	mov    %esp,%ebp
+80104ae3:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80104ae6:	9c                   	pushf
+80104ae7:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80104ae8:	f6 c4 02             	test   $0x2,%ah
+80104aeb:	75 35                	jne    80104b22 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80104aed:	e8 3e ee ff ff       	call   80103930 <mycpu>
+80104af2:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80104af9:	78 34                	js     80104b2f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80104afb:	e8 30 ee ff ff       	call   80103930 <mycpu>
+80104b00:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80104b06:	85 d2                	test   %edx,%edx
+80104b08:	74 06                	je     80104b10 <popcli+0x30>
+    sti();
+}
+80104b0a:	c9                   	leave
+80104b0b:	c3                   	ret
+80104b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80104b10:	e8 1b ee ff ff       	call   80103930 <mycpu>
+80104b15:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+80104b1b:	85 c0                	test   %eax,%eax
+80104b1d:	74 eb                	je     80104b0a <popcli+0x2a>
+  asm volatile("sti");
+80104b1f:	fb                   	sti
+}
+80104b20:	c9                   	leave
+80104b21:	c3                   	ret
+    panic("popcli - interruptible");
+80104b22:	83 ec 0c             	sub    $0xc,%esp
+80104b25:	68 0b 86 10 80       	push   $0x8010860b
+80104b2a:	e8 51 b8 ff ff       	call   80100380 <panic>
+    panic("popcli");
+80104b2f:	83 ec 0c             	sub    $0xc,%esp
+80104b32:	68 22 86 10 80       	push   $0x80108622
+80104b37:	e8 44 b8 ff ff       	call   80100380 <panic>
+80104b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104b40 <holding>:
+{
+80104b40:	55                   	push   %ebp
+80104b41:	89 e5                	mov    %esp,%ebp
+80104b43:	56                   	push   %esi
+80104b44:	53                   	push   %ebx
+80104b45:	8b 75 08             	mov    0x8(%ebp),%esi
+80104b48:	31 db                	xor    %ebx,%ebx
+  pushcli();
+80104b4a:	e8 41 ff ff ff       	call   80104a90 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80104b4f:	8b 06                	mov    (%esi),%eax
+80104b51:	85 c0                	test   %eax,%eax
+80104b53:	75 0b                	jne    80104b60 <holding+0x20>
+  popcli();
+80104b55:	e8 86 ff ff ff       	call   80104ae0 <popcli>
+}
+80104b5a:	89 d8                	mov    %ebx,%eax
+80104b5c:	5b                   	pop    %ebx
+80104b5d:	5e                   	pop    %esi
+80104b5e:	5d                   	pop    %ebp
+80104b5f:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80104b60:	8b 5e 08             	mov    0x8(%esi),%ebx
+80104b63:	e8 c8 ed ff ff       	call   80103930 <mycpu>
+80104b68:	39 c3                	cmp    %eax,%ebx
+80104b6a:	0f 94 c3             	sete   %bl
+  popcli();
+80104b6d:	e8 6e ff ff ff       	call   80104ae0 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80104b72:	0f b6 db             	movzbl %bl,%ebx
+}
+80104b75:	89 d8                	mov    %ebx,%eax
+80104b77:	5b                   	pop    %ebx
+80104b78:	5e                   	pop    %esi
+80104b79:	5d                   	pop    %ebp
+80104b7a:	c3                   	ret
+80104b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104b7f:	90                   	nop
+
+80104b80 <release>:
+{
+80104b80:	55                   	push   %ebp
+80104b81:	89 e5                	mov    %esp,%ebp
+80104b83:	56                   	push   %esi
+80104b84:	53                   	push   %ebx
+80104b85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80104b88:	e8 03 ff ff ff       	call   80104a90 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80104b8d:	8b 03                	mov    (%ebx),%eax
+80104b8f:	85 c0                	test   %eax,%eax
+80104b91:	75 15                	jne    80104ba8 <release+0x28>
+  popcli();
+80104b93:	e8 48 ff ff ff       	call   80104ae0 <popcli>
+    panic("release");
+80104b98:	83 ec 0c             	sub    $0xc,%esp
+80104b9b:	68 29 86 10 80       	push   $0x80108629
+80104ba0:	e8 db b7 ff ff       	call   80100380 <panic>
+80104ba5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80104ba8:	8b 73 08             	mov    0x8(%ebx),%esi
+80104bab:	e8 80 ed ff ff       	call   80103930 <mycpu>
+80104bb0:	39 c6                	cmp    %eax,%esi
+80104bb2:	75 df                	jne    80104b93 <release+0x13>
+  popcli();
+80104bb4:	e8 27 ff ff ff       	call   80104ae0 <popcli>
+  lk->pcs[0] = 0;
+80104bb9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80104bc0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80104bc7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80104bcc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80104bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104bd5:	5b                   	pop    %ebx
+80104bd6:	5e                   	pop    %esi
+80104bd7:	5d                   	pop    %ebp
+  popcli();
+80104bd8:	e9 03 ff ff ff       	jmp    80104ae0 <popcli>
+80104bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104be0 <acquire>:
+{
+80104be0:	55                   	push   %ebp
+80104be1:	89 e5                	mov    %esp,%ebp
+80104be3:	53                   	push   %ebx
+80104be4:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80104be7:	e8 a4 fe ff ff       	call   80104a90 <pushcli>
+  if(holding(lk))
+80104bec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80104bef:	e8 9c fe ff ff       	call   80104a90 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80104bf4:	8b 03                	mov    (%ebx),%eax
+80104bf6:	85 c0                	test   %eax,%eax
+80104bf8:	0f 85 9a 00 00 00    	jne    80104c98 <acquire+0xb8>
+  popcli();
+80104bfe:	e8 dd fe ff ff       	call   80104ae0 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+80104c03:	b9 01 00 00 00       	mov    $0x1,%ecx
+80104c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c0f:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80104c10:	8b 55 08             	mov    0x8(%ebp),%edx
+80104c13:	89 c8                	mov    %ecx,%eax
+80104c15:	f0 87 02             	lock xchg %eax,(%edx)
+80104c18:	85 c0                	test   %eax,%eax
+80104c1a:	75 f4                	jne    80104c10 <acquire+0x30>
+  __sync_synchronize();
+80104c1c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80104c21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104c24:	e8 07 ed ff ff       	call   80103930 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80104c29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+80104c2c:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+80104c2e:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80104c31:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80104c37:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80104c3c:	77 32                	ja     80104c70 <acquire+0x90>
+  ebp = (uint*)v - 2;
+80104c3e:	89 e8                	mov    %ebp,%eax
+80104c40:	eb 14                	jmp    80104c56 <acquire+0x76>
+80104c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80104c48:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+80104c4e:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80104c54:	77 1a                	ja     80104c70 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+80104c56:	8b 58 04             	mov    0x4(%eax),%ebx
+80104c59:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80104c5d:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80104c60:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80104c62:	83 fa 0a             	cmp    $0xa,%edx
+80104c65:	75 e1                	jne    80104c48 <acquire+0x68>
+}
+80104c67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104c6a:	c9                   	leave
+80104c6b:	c3                   	ret
+80104c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104c70:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80104c74:	8d 51 34             	lea    0x34(%ecx),%edx
+80104c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c7e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80104c80:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80104c86:	83 c0 04             	add    $0x4,%eax
+80104c89:	39 c2                	cmp    %eax,%edx
+80104c8b:	75 f3                	jne    80104c80 <acquire+0xa0>
+}
+80104c8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104c90:	c9                   	leave
+80104c91:	c3                   	ret
+80104c92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80104c98:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80104c9b:	e8 90 ec ff ff       	call   80103930 <mycpu>
+80104ca0:	39 c3                	cmp    %eax,%ebx
+80104ca2:	0f 85 56 ff ff ff    	jne    80104bfe <acquire+0x1e>
+  popcli();
+80104ca8:	e8 33 fe ff ff       	call   80104ae0 <popcli>
+    panic("acquire");
+80104cad:	83 ec 0c             	sub    $0xc,%esp
+80104cb0:	68 31 86 10 80       	push   $0x80108631
+80104cb5:	e8 c6 b6 ff ff       	call   80100380 <panic>
+80104cba:	66 90                	xchg   %ax,%ax
+80104cbc:	66 90                	xchg   %ax,%ax
+80104cbe:	66 90                	xchg   %ax,%ax
+
+80104cc0 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80104cc0:	55                   	push   %ebp
+80104cc1:	89 e5                	mov    %esp,%ebp
+80104cc3:	57                   	push   %edi
+80104cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+80104cc7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80104cca:	89 d0                	mov    %edx,%eax
+80104ccc:	09 c8                	or     %ecx,%eax
+80104cce:	a8 03                	test   $0x3,%al
+80104cd0:	75 1e                	jne    80104cf0 <memset+0x30>
+    c &= 0xFF;
+80104cd2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80104cd6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80104cd9:	89 d7                	mov    %edx,%edi
+80104cdb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80104ce1:	fc                   	cld
+80104ce2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80104ce4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80104ce7:	89 d0                	mov    %edx,%eax
+80104ce9:	c9                   	leave
+80104cea:	c3                   	ret
+80104ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104cef:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80104cf0:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104cf3:	89 d7                	mov    %edx,%edi
+80104cf5:	fc                   	cld
+80104cf6:	f3 aa                	rep stos %al,%es:(%edi)
+80104cf8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80104cfb:	89 d0                	mov    %edx,%eax
+80104cfd:	c9                   	leave
+80104cfe:	c3                   	ret
+80104cff:	90                   	nop
+
+80104d00 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80104d00:	55                   	push   %ebp
+80104d01:	89 e5                	mov    %esp,%ebp
+80104d03:	56                   	push   %esi
+80104d04:	53                   	push   %ebx
+80104d05:	8b 75 10             	mov    0x10(%ebp),%esi
+80104d08:	8b 55 08             	mov    0x8(%ebp),%edx
+80104d0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80104d0e:	85 f6                	test   %esi,%esi
+80104d10:	74 2e                	je     80104d40 <memcmp+0x40>
+80104d12:	01 c6                	add    %eax,%esi
+80104d14:	eb 14                	jmp    80104d2a <memcmp+0x2a>
+80104d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80104d20:	83 c0 01             	add    $0x1,%eax
+80104d23:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80104d26:	39 f0                	cmp    %esi,%eax
+80104d28:	74 16                	je     80104d40 <memcmp+0x40>
+    if(*s1 != *s2)
+80104d2a:	0f b6 0a             	movzbl (%edx),%ecx
+80104d2d:	0f b6 18             	movzbl (%eax),%ebx
+80104d30:	38 d9                	cmp    %bl,%cl
+80104d32:	74 ec                	je     80104d20 <memcmp+0x20>
+      return *s1 - *s2;
+80104d34:	0f b6 c1             	movzbl %cl,%eax
+80104d37:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80104d39:	5b                   	pop    %ebx
+80104d3a:	5e                   	pop    %esi
+80104d3b:	5d                   	pop    %ebp
+80104d3c:	c3                   	ret
+80104d3d:	8d 76 00             	lea    0x0(%esi),%esi
+80104d40:	5b                   	pop    %ebx
+  return 0;
+80104d41:	31 c0                	xor    %eax,%eax
+}
+80104d43:	5e                   	pop    %esi
+80104d44:	5d                   	pop    %ebp
+80104d45:	c3                   	ret
+80104d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104d50 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80104d50:	55                   	push   %ebp
+80104d51:	89 e5                	mov    %esp,%ebp
+80104d53:	57                   	push   %edi
+80104d54:	56                   	push   %esi
+80104d55:	8b 55 08             	mov    0x8(%ebp),%edx
+80104d58:	8b 75 0c             	mov    0xc(%ebp),%esi
+80104d5b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80104d5e:	39 d6                	cmp    %edx,%esi
+80104d60:	73 26                	jae    80104d88 <memmove+0x38>
+80104d62:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80104d65:	39 ca                	cmp    %ecx,%edx
+80104d67:	73 1f                	jae    80104d88 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80104d69:	85 c0                	test   %eax,%eax
+80104d6b:	74 0f                	je     80104d7c <memmove+0x2c>
+80104d6d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80104d70:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80104d74:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80104d77:	83 e8 01             	sub    $0x1,%eax
+80104d7a:	73 f4                	jae    80104d70 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+80104d7c:	5e                   	pop    %esi
+80104d7d:	89 d0                	mov    %edx,%eax
+80104d7f:	5f                   	pop    %edi
+80104d80:	5d                   	pop    %ebp
+80104d81:	c3                   	ret
+80104d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80104d88:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80104d8b:	89 d7                	mov    %edx,%edi
+80104d8d:	85 c0                	test   %eax,%eax
+80104d8f:	74 eb                	je     80104d7c <memmove+0x2c>
+80104d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80104d98:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80104d99:	39 ce                	cmp    %ecx,%esi
+80104d9b:	75 fb                	jne    80104d98 <memmove+0x48>
+}
+80104d9d:	5e                   	pop    %esi
+80104d9e:	89 d0                	mov    %edx,%eax
+80104da0:	5f                   	pop    %edi
+80104da1:	5d                   	pop    %ebp
+80104da2:	c3                   	ret
+80104da3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104db0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80104db0:	eb 9e                	jmp    80104d50 <memmove>
+80104db2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104dc0 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80104dc0:	55                   	push   %ebp
+80104dc1:	89 e5                	mov    %esp,%ebp
+80104dc3:	53                   	push   %ebx
+80104dc4:	8b 55 10             	mov    0x10(%ebp),%edx
+80104dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+80104dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+80104dcd:	85 d2                	test   %edx,%edx
+80104dcf:	75 16                	jne    80104de7 <strncmp+0x27>
+80104dd1:	eb 2d                	jmp    80104e00 <strncmp+0x40>
+80104dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104dd7:	90                   	nop
+80104dd8:	3a 19                	cmp    (%ecx),%bl
+80104dda:	75 12                	jne    80104dee <strncmp+0x2e>
+    n--, p++, q++;
+80104ddc:	83 c0 01             	add    $0x1,%eax
+80104ddf:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80104de2:	83 ea 01             	sub    $0x1,%edx
+80104de5:	74 19                	je     80104e00 <strncmp+0x40>
+80104de7:	0f b6 18             	movzbl (%eax),%ebx
+80104dea:	84 db                	test   %bl,%bl
+80104dec:	75 ea                	jne    80104dd8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80104dee:	0f b6 00             	movzbl (%eax),%eax
+80104df1:	0f b6 11             	movzbl (%ecx),%edx
+}
+80104df4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104df7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+80104df8:	29 d0                	sub    %edx,%eax
+}
+80104dfa:	c3                   	ret
+80104dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104dff:	90                   	nop
+80104e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80104e03:	31 c0                	xor    %eax,%eax
+}
+80104e05:	c9                   	leave
+80104e06:	c3                   	ret
+80104e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e0e:	66 90                	xchg   %ax,%ax
+
+80104e10 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80104e10:	55                   	push   %ebp
+80104e11:	89 e5                	mov    %esp,%ebp
+80104e13:	57                   	push   %edi
+80104e14:	56                   	push   %esi
+80104e15:	53                   	push   %ebx
+80104e16:	8b 75 08             	mov    0x8(%ebp),%esi
+80104e19:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80104e1c:	89 f0                	mov    %esi,%eax
+80104e1e:	eb 15                	jmp    80104e35 <strncpy+0x25>
+80104e20:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80104e24:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80104e27:	83 c0 01             	add    $0x1,%eax
+80104e2a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+80104e2e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80104e31:	84 c9                	test   %cl,%cl
+80104e33:	74 13                	je     80104e48 <strncpy+0x38>
+80104e35:	89 d3                	mov    %edx,%ebx
+80104e37:	83 ea 01             	sub    $0x1,%edx
+80104e3a:	85 db                	test   %ebx,%ebx
+80104e3c:	7f e2                	jg     80104e20 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+80104e3e:	5b                   	pop    %ebx
+80104e3f:	89 f0                	mov    %esi,%eax
+80104e41:	5e                   	pop    %esi
+80104e42:	5f                   	pop    %edi
+80104e43:	5d                   	pop    %ebp
+80104e44:	c3                   	ret
+80104e45:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80104e48:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80104e4b:	83 e9 01             	sub    $0x1,%ecx
+80104e4e:	85 d2                	test   %edx,%edx
+80104e50:	74 ec                	je     80104e3e <strncpy+0x2e>
+80104e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80104e58:	83 c0 01             	add    $0x1,%eax
+80104e5b:	89 ca                	mov    %ecx,%edx
+80104e5d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80104e61:	29 c2                	sub    %eax,%edx
+80104e63:	85 d2                	test   %edx,%edx
+80104e65:	7f f1                	jg     80104e58 <strncpy+0x48>
+}
+80104e67:	5b                   	pop    %ebx
+80104e68:	89 f0                	mov    %esi,%eax
+80104e6a:	5e                   	pop    %esi
+80104e6b:	5f                   	pop    %edi
+80104e6c:	5d                   	pop    %ebp
+80104e6d:	c3                   	ret
+80104e6e:	66 90                	xchg   %ax,%ax
+
+80104e70 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80104e70:	55                   	push   %ebp
+80104e71:	89 e5                	mov    %esp,%ebp
+80104e73:	56                   	push   %esi
+80104e74:	53                   	push   %ebx
+80104e75:	8b 55 10             	mov    0x10(%ebp),%edx
+80104e78:	8b 75 08             	mov    0x8(%ebp),%esi
+80104e7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80104e7e:	85 d2                	test   %edx,%edx
+80104e80:	7e 25                	jle    80104ea7 <safestrcpy+0x37>
+80104e82:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80104e86:	89 f2                	mov    %esi,%edx
+80104e88:	eb 16                	jmp    80104ea0 <safestrcpy+0x30>
+80104e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80104e90:	0f b6 08             	movzbl (%eax),%ecx
+80104e93:	83 c0 01             	add    $0x1,%eax
+80104e96:	83 c2 01             	add    $0x1,%edx
+80104e99:	88 4a ff             	mov    %cl,-0x1(%edx)
+80104e9c:	84 c9                	test   %cl,%cl
+80104e9e:	74 04                	je     80104ea4 <safestrcpy+0x34>
+80104ea0:	39 d8                	cmp    %ebx,%eax
+80104ea2:	75 ec                	jne    80104e90 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80104ea4:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80104ea7:	89 f0                	mov    %esi,%eax
+80104ea9:	5b                   	pop    %ebx
+80104eaa:	5e                   	pop    %esi
+80104eab:	5d                   	pop    %ebp
+80104eac:	c3                   	ret
+80104ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104eb0 <strlen>:
+
+int
+strlen(const char *s)
+{
+80104eb0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80104eb1:	31 c0                	xor    %eax,%eax
+{
+80104eb3:	89 e5                	mov    %esp,%ebp
+80104eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80104eb8:	80 3a 00             	cmpb   $0x0,(%edx)
+80104ebb:	74 0c                	je     80104ec9 <strlen+0x19>
+80104ebd:	8d 76 00             	lea    0x0(%esi),%esi
+80104ec0:	83 c0 01             	add    $0x1,%eax
+80104ec3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80104ec7:	75 f7                	jne    80104ec0 <strlen+0x10>
+    ;
+  return n;
+}
+80104ec9:	5d                   	pop    %ebp
+80104eca:	c3                   	ret
+
+80104ecb <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80104ecb:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80104ecf:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80104ed3:	55                   	push   %ebp
+  pushl %ebx
+80104ed4:	53                   	push   %ebx
+  pushl %esi
+80104ed5:	56                   	push   %esi
+  pushl %edi
+80104ed6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80104ed7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80104ed9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80104edb:	5f                   	pop    %edi
+  popl %esi
+80104edc:	5e                   	pop    %esi
+  popl %ebx
+80104edd:	5b                   	pop    %ebx
+  popl %ebp
+80104ede:	5d                   	pop    %ebp
+  ret
+80104edf:	c3                   	ret
+
+80104ee0 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80104ee0:	55                   	push   %ebp
+80104ee1:	89 e5                	mov    %esp,%ebp
+80104ee3:	53                   	push   %ebx
+80104ee4:	83 ec 04             	sub    $0x4,%esp
+80104ee7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80104eea:	e8 c1 ea ff ff       	call   801039b0 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80104eef:	8b 00                	mov    (%eax),%eax
+80104ef1:	39 c3                	cmp    %eax,%ebx
+80104ef3:	73 1b                	jae    80104f10 <fetchint+0x30>
+80104ef5:	8d 53 04             	lea    0x4(%ebx),%edx
+80104ef8:	39 d0                	cmp    %edx,%eax
+80104efa:	72 14                	jb     80104f10 <fetchint+0x30>
+    return -1;
+  *ip = *(int*)(addr);
+80104efc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104eff:	8b 13                	mov    (%ebx),%edx
+80104f01:	89 10                	mov    %edx,(%eax)
+  return 0;
+80104f03:	31 c0                	xor    %eax,%eax
+}
+80104f05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104f08:	c9                   	leave
+80104f09:	c3                   	ret
+80104f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80104f10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f15:	eb ee                	jmp    80104f05 <fetchint+0x25>
+80104f17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f1e:	66 90                	xchg   %ax,%ax
+
+80104f20 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80104f20:	55                   	push   %ebp
+80104f21:	89 e5                	mov    %esp,%ebp
+80104f23:	53                   	push   %ebx
+80104f24:	83 ec 04             	sub    $0x4,%esp
+80104f27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+80104f2a:	e8 81 ea ff ff       	call   801039b0 <myproc>
+
+  if(addr >= curproc->sz)
+80104f2f:	3b 18                	cmp    (%eax),%ebx
+80104f31:	73 2d                	jae    80104f60 <fetchstr+0x40>
+    return -1;
+  *pp = (char*)addr;
+80104f33:	8b 55 0c             	mov    0xc(%ebp),%edx
+80104f36:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+80104f38:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+80104f3a:	39 d3                	cmp    %edx,%ebx
+80104f3c:	73 22                	jae    80104f60 <fetchstr+0x40>
+80104f3e:	89 d8                	mov    %ebx,%eax
+80104f40:	eb 0d                	jmp    80104f4f <fetchstr+0x2f>
+80104f42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104f48:	83 c0 01             	add    $0x1,%eax
+80104f4b:	39 d0                	cmp    %edx,%eax
+80104f4d:	73 11                	jae    80104f60 <fetchstr+0x40>
+    if(*s == 0)
+80104f4f:	80 38 00             	cmpb   $0x0,(%eax)
+80104f52:	75 f4                	jne    80104f48 <fetchstr+0x28>
+      return s - *pp;
+80104f54:	29 d8                	sub    %ebx,%eax
+  }
+  return -1;
+}
+80104f56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104f59:	c9                   	leave
+80104f5a:	c3                   	ret
+80104f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104f5f:	90                   	nop
+80104f60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80104f63:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104f68:	c9                   	leave
+80104f69:	c3                   	ret
+80104f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104f70 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80104f70:	55                   	push   %ebp
+80104f71:	89 e5                	mov    %esp,%ebp
+80104f73:	56                   	push   %esi
+80104f74:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80104f75:	e8 36 ea ff ff       	call   801039b0 <myproc>
+80104f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+80104f7d:	8b 40 18             	mov    0x18(%eax),%eax
+80104f80:	8b 40 44             	mov    0x44(%eax),%eax
+80104f83:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80104f86:	e8 25 ea ff ff       	call   801039b0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80104f8b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80104f8e:	8b 00                	mov    (%eax),%eax
+80104f90:	39 c6                	cmp    %eax,%esi
+80104f92:	73 1c                	jae    80104fb0 <argint+0x40>
+80104f94:	8d 53 08             	lea    0x8(%ebx),%edx
+80104f97:	39 d0                	cmp    %edx,%eax
+80104f99:	72 15                	jb     80104fb0 <argint+0x40>
+  *ip = *(int*)(addr);
+80104f9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104f9e:	8b 53 04             	mov    0x4(%ebx),%edx
+80104fa1:	89 10                	mov    %edx,(%eax)
+  return 0;
+80104fa3:	31 c0                	xor    %eax,%eax
+}
+80104fa5:	5b                   	pop    %ebx
+80104fa6:	5e                   	pop    %esi
+80104fa7:	5d                   	pop    %ebp
+80104fa8:	c3                   	ret
+80104fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80104fb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80104fb5:	eb ee                	jmp    80104fa5 <argint+0x35>
+80104fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fbe:	66 90                	xchg   %ax,%ax
+
+80104fc0 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80104fc0:	55                   	push   %ebp
+80104fc1:	89 e5                	mov    %esp,%ebp
+80104fc3:	57                   	push   %edi
+80104fc4:	56                   	push   %esi
+80104fc5:	53                   	push   %ebx
+80104fc6:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  struct proc *curproc = myproc();
+80104fc9:	e8 e2 e9 ff ff       	call   801039b0 <myproc>
+80104fce:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80104fd0:	e8 db e9 ff ff       	call   801039b0 <myproc>
+80104fd5:	8b 55 08             	mov    0x8(%ebp),%edx
+80104fd8:	8b 40 18             	mov    0x18(%eax),%eax
+80104fdb:	8b 40 44             	mov    0x44(%eax),%eax
+80104fde:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80104fe1:	e8 ca e9 ff ff       	call   801039b0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80104fe6:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80104fe9:	8b 00                	mov    (%eax),%eax
+80104feb:	39 c7                	cmp    %eax,%edi
+80104fed:	73 31                	jae    80105020 <argptr+0x60>
+80104fef:	8d 4b 08             	lea    0x8(%ebx),%ecx
+80104ff2:	39 c8                	cmp    %ecx,%eax
+80104ff4:	72 2a                	jb     80105020 <argptr+0x60>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80104ff6:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int*)(addr);
+80104ff9:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80104ffc:	85 d2                	test   %edx,%edx
+80104ffe:	78 20                	js     80105020 <argptr+0x60>
+80105000:	8b 16                	mov    (%esi),%edx
+80105002:	39 d0                	cmp    %edx,%eax
+80105004:	73 1a                	jae    80105020 <argptr+0x60>
+80105006:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80105009:	01 c3                	add    %eax,%ebx
+8010500b:	39 da                	cmp    %ebx,%edx
+8010500d:	72 11                	jb     80105020 <argptr+0x60>
+    return -1;
+  *pp = (char*)i;
+8010500f:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105012:	89 02                	mov    %eax,(%edx)
+  return 0;
+80105014:	31 c0                	xor    %eax,%eax
+}
+80105016:	83 c4 0c             	add    $0xc,%esp
+80105019:	5b                   	pop    %ebx
+8010501a:	5e                   	pop    %esi
+8010501b:	5f                   	pop    %edi
+8010501c:	5d                   	pop    %ebp
+8010501d:	c3                   	ret
+8010501e:	66 90                	xchg   %ax,%ax
+    return -1;
+80105020:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105025:	eb ef                	jmp    80105016 <argptr+0x56>
+80105027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010502e:	66 90                	xchg   %ax,%ax
+
+80105030 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80105030:	55                   	push   %ebp
+80105031:	89 e5                	mov    %esp,%ebp
+80105033:	56                   	push   %esi
+80105034:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80105035:	e8 76 e9 ff ff       	call   801039b0 <myproc>
+8010503a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010503d:	8b 40 18             	mov    0x18(%eax),%eax
+80105040:	8b 40 44             	mov    0x44(%eax),%eax
+80105043:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80105046:	e8 65 e9 ff ff       	call   801039b0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010504b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010504e:	8b 00                	mov    (%eax),%eax
+80105050:	39 c6                	cmp    %eax,%esi
+80105052:	73 44                	jae    80105098 <argstr+0x68>
+80105054:	8d 53 08             	lea    0x8(%ebx),%edx
+80105057:	39 d0                	cmp    %edx,%eax
+80105059:	72 3d                	jb     80105098 <argstr+0x68>
+  *ip = *(int*)(addr);
+8010505b:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+8010505e:	e8 4d e9 ff ff       	call   801039b0 <myproc>
+  if(addr >= curproc->sz)
+80105063:	3b 18                	cmp    (%eax),%ebx
+80105065:	73 31                	jae    80105098 <argstr+0x68>
+  *pp = (char*)addr;
+80105067:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010506a:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+8010506c:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+8010506e:	39 d3                	cmp    %edx,%ebx
+80105070:	73 26                	jae    80105098 <argstr+0x68>
+80105072:	89 d8                	mov    %ebx,%eax
+80105074:	eb 11                	jmp    80105087 <argstr+0x57>
+80105076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010507d:	8d 76 00             	lea    0x0(%esi),%esi
+80105080:	83 c0 01             	add    $0x1,%eax
+80105083:	39 d0                	cmp    %edx,%eax
+80105085:	73 11                	jae    80105098 <argstr+0x68>
+    if(*s == 0)
+80105087:	80 38 00             	cmpb   $0x0,(%eax)
+8010508a:	75 f4                	jne    80105080 <argstr+0x50>
+      return s - *pp;
+8010508c:	29 d8                	sub    %ebx,%eax
+  int addr;
+  if(argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+}
+8010508e:	5b                   	pop    %ebx
+8010508f:	5e                   	pop    %esi
+80105090:	5d                   	pop    %ebp
+80105091:	c3                   	ret
+80105092:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105098:	5b                   	pop    %ebx
+    return -1;
+80105099:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010509e:	5e                   	pop    %esi
+8010509f:	5d                   	pop    %ebp
+801050a0:	c3                   	ret
+801050a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050af:	90                   	nop
+
+801050b0 <syscall>:
+[SYS_thread_exit]   sys_thread_exit,
+};
+
+void
+syscall(void)
+{
+801050b0:	55                   	push   %ebp
+801050b1:	89 e5                	mov    %esp,%ebp
+801050b3:	53                   	push   %ebx
+801050b4:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+801050b7:	e8 f4 e8 ff ff       	call   801039b0 <myproc>
+801050bc:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+801050be:	8b 40 18             	mov    0x18(%eax),%eax
+801050c1:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801050c4:	8d 50 ff             	lea    -0x1(%eax),%edx
+801050c7:	83 fa 1a             	cmp    $0x1a,%edx
+801050ca:	77 24                	ja     801050f0 <syscall+0x40>
+801050cc:	8b 14 85 60 86 10 80 	mov    -0x7fef79a0(,%eax,4),%edx
+801050d3:	85 d2                	test   %edx,%edx
+801050d5:	74 19                	je     801050f0 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+801050d7:	ff d2                	call   *%edx
+801050d9:	89 c2                	mov    %eax,%edx
+801050db:	8b 43 18             	mov    0x18(%ebx),%eax
+801050de:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+801050e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801050e4:	c9                   	leave
+801050e5:	c3                   	ret
+801050e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050ed:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+801050f0:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+801050f1:	8d 43 6c             	lea    0x6c(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+801050f4:	50                   	push   %eax
+801050f5:	ff 73 10             	push   0x10(%ebx)
+801050f8:	68 39 86 10 80       	push   $0x80108639
+801050fd:	e8 ae b5 ff ff       	call   801006b0 <cprintf>
+    curproc->tf->eax = -1;
+80105102:	8b 43 18             	mov    0x18(%ebx),%eax
+80105105:	83 c4 10             	add    $0x10,%esp
+80105108:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+8010510f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105112:	c9                   	leave
+80105113:	c3                   	ret
+80105114:	66 90                	xchg   %ax,%ax
+80105116:	66 90                	xchg   %ax,%ax
+80105118:	66 90                	xchg   %ax,%ax
+8010511a:	66 90                	xchg   %ax,%ax
+8010511c:	66 90                	xchg   %ax,%ax
+8010511e:	66 90                	xchg   %ax,%ax
+
+80105120 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80105120:	55                   	push   %ebp
+80105121:	89 e5                	mov    %esp,%ebp
+80105123:	57                   	push   %edi
+80105124:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80105125:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+80105128:	53                   	push   %ebx
+80105129:	83 ec 34             	sub    $0x34,%esp
+8010512c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+8010512f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80105132:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80105135:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+80105138:	57                   	push   %edi
+80105139:	50                   	push   %eax
+8010513a:	e8 71 d0 ff ff       	call   801021b0 <nameiparent>
+8010513f:	83 c4 10             	add    $0x10,%esp
+80105142:	85 c0                	test   %eax,%eax
+80105144:	74 5e                	je     801051a4 <create+0x84>
+    return 0;
+  ilock(dp);
+80105146:	83 ec 0c             	sub    $0xc,%esp
+80105149:	89 c3                	mov    %eax,%ebx
+8010514b:	50                   	push   %eax
+8010514c:	e8 0f c7 ff ff       	call   80101860 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80105151:	83 c4 0c             	add    $0xc,%esp
+80105154:	6a 00                	push   $0x0
+80105156:	57                   	push   %edi
+80105157:	53                   	push   %ebx
+80105158:	e8 63 cc ff ff       	call   80101dc0 <dirlookup>
+8010515d:	83 c4 10             	add    $0x10,%esp
+80105160:	89 c6                	mov    %eax,%esi
+80105162:	85 c0                	test   %eax,%eax
+80105164:	74 4a                	je     801051b0 <create+0x90>
+    iunlockput(dp);
+80105166:	83 ec 0c             	sub    $0xc,%esp
+80105169:	53                   	push   %ebx
+8010516a:	e8 81 c9 ff ff       	call   80101af0 <iunlockput>
+    ilock(ip);
+8010516f:	89 34 24             	mov    %esi,(%esp)
+80105172:	e8 e9 c6 ff ff       	call   80101860 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80105177:	83 c4 10             	add    $0x10,%esp
+8010517a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+8010517f:	75 17                	jne    80105198 <create+0x78>
+80105181:	66 83 7e 50 02       	cmpw   $0x2,0x50(%esi)
+80105186:	75 10                	jne    80105198 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80105188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010518b:	89 f0                	mov    %esi,%eax
+8010518d:	5b                   	pop    %ebx
+8010518e:	5e                   	pop    %esi
+8010518f:	5f                   	pop    %edi
+80105190:	5d                   	pop    %ebp
+80105191:	c3                   	ret
+80105192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80105198:	83 ec 0c             	sub    $0xc,%esp
+8010519b:	56                   	push   %esi
+8010519c:	e8 4f c9 ff ff       	call   80101af0 <iunlockput>
+    return 0;
+801051a1:	83 c4 10             	add    $0x10,%esp
+}
+801051a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+801051a7:	31 f6                	xor    %esi,%esi
+}
+801051a9:	5b                   	pop    %ebx
+801051aa:	89 f0                	mov    %esi,%eax
+801051ac:	5e                   	pop    %esi
+801051ad:	5f                   	pop    %edi
+801051ae:	5d                   	pop    %ebp
+801051af:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+801051b0:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+801051b4:	83 ec 08             	sub    $0x8,%esp
+801051b7:	50                   	push   %eax
+801051b8:	ff 33                	push   (%ebx)
+801051ba:	e8 31 c5 ff ff       	call   801016f0 <ialloc>
+801051bf:	83 c4 10             	add    $0x10,%esp
+801051c2:	89 c6                	mov    %eax,%esi
+801051c4:	85 c0                	test   %eax,%eax
+801051c6:	0f 84 bc 00 00 00    	je     80105288 <create+0x168>
+  ilock(ip);
+801051cc:	83 ec 0c             	sub    $0xc,%esp
+801051cf:	50                   	push   %eax
+801051d0:	e8 8b c6 ff ff       	call   80101860 <ilock>
+  ip->major = major;
+801051d5:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+801051d9:	66 89 46 52          	mov    %ax,0x52(%esi)
+  ip->minor = minor;
+801051dd:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+801051e1:	66 89 46 54          	mov    %ax,0x54(%esi)
+  ip->nlink = 1;
+801051e5:	b8 01 00 00 00       	mov    $0x1,%eax
+801051ea:	66 89 46 56          	mov    %ax,0x56(%esi)
+  iupdate(ip);
+801051ee:	89 34 24             	mov    %esi,(%esp)
+801051f1:	e8 ba c5 ff ff       	call   801017b0 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+801051f6:	83 c4 10             	add    $0x10,%esp
+801051f9:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+801051fe:	74 30                	je     80105230 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+80105200:	83 ec 04             	sub    $0x4,%esp
+80105203:	ff 76 04             	push   0x4(%esi)
+80105206:	57                   	push   %edi
+80105207:	53                   	push   %ebx
+80105208:	e8 c3 ce ff ff       	call   801020d0 <dirlink>
+8010520d:	83 c4 10             	add    $0x10,%esp
+80105210:	85 c0                	test   %eax,%eax
+80105212:	78 67                	js     8010527b <create+0x15b>
+  iunlockput(dp);
+80105214:	83 ec 0c             	sub    $0xc,%esp
+80105217:	53                   	push   %ebx
+80105218:	e8 d3 c8 ff ff       	call   80101af0 <iunlockput>
+  return ip;
+8010521d:	83 c4 10             	add    $0x10,%esp
+}
+80105220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105223:	89 f0                	mov    %esi,%eax
+80105225:	5b                   	pop    %ebx
+80105226:	5e                   	pop    %esi
+80105227:	5f                   	pop    %edi
+80105228:	5d                   	pop    %ebp
+80105229:	c3                   	ret
+8010522a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+80105230:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80105233:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+    iupdate(dp);
+80105238:	53                   	push   %ebx
+80105239:	e8 72 c5 ff ff       	call   801017b0 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+8010523e:	83 c4 0c             	add    $0xc,%esp
+80105241:	ff 76 04             	push   0x4(%esi)
+80105244:	68 ec 86 10 80       	push   $0x801086ec
+80105249:	56                   	push   %esi
+8010524a:	e8 81 ce ff ff       	call   801020d0 <dirlink>
+8010524f:	83 c4 10             	add    $0x10,%esp
+80105252:	85 c0                	test   %eax,%eax
+80105254:	78 18                	js     8010526e <create+0x14e>
+80105256:	83 ec 04             	sub    $0x4,%esp
+80105259:	ff 73 04             	push   0x4(%ebx)
+8010525c:	68 eb 86 10 80       	push   $0x801086eb
+80105261:	56                   	push   %esi
+80105262:	e8 69 ce ff ff       	call   801020d0 <dirlink>
+80105267:	83 c4 10             	add    $0x10,%esp
+8010526a:	85 c0                	test   %eax,%eax
+8010526c:	79 92                	jns    80105200 <create+0xe0>
+      panic("create dots");
+8010526e:	83 ec 0c             	sub    $0xc,%esp
+80105271:	68 df 86 10 80       	push   $0x801086df
+80105276:	e8 05 b1 ff ff       	call   80100380 <panic>
+    panic("create: dirlink");
+8010527b:	83 ec 0c             	sub    $0xc,%esp
+8010527e:	68 ee 86 10 80       	push   $0x801086ee
+80105283:	e8 f8 b0 ff ff       	call   80100380 <panic>
+    panic("create: ialloc");
+80105288:	83 ec 0c             	sub    $0xc,%esp
+8010528b:	68 d0 86 10 80       	push   $0x801086d0
+80105290:	e8 eb b0 ff ff       	call   80100380 <panic>
+80105295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010529c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801052a0 <sys_dup>:
+{
+801052a0:	55                   	push   %ebp
+801052a1:	89 e5                	mov    %esp,%ebp
+801052a3:	56                   	push   %esi
+801052a4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801052a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801052a8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801052ab:	50                   	push   %eax
+801052ac:	6a 00                	push   $0x0
+801052ae:	e8 bd fc ff ff       	call   80104f70 <argint>
+801052b3:	83 c4 10             	add    $0x10,%esp
+801052b6:	85 c0                	test   %eax,%eax
+801052b8:	78 36                	js     801052f0 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801052ba:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801052be:	77 30                	ja     801052f0 <sys_dup+0x50>
+801052c0:	e8 eb e6 ff ff       	call   801039b0 <myproc>
+801052c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801052c8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+801052cc:	85 f6                	test   %esi,%esi
+801052ce:	74 20                	je     801052f0 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+801052d0:	e8 db e6 ff ff       	call   801039b0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+801052d5:	31 db                	xor    %ebx,%ebx
+801052d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801052de:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+801052e0:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+801052e4:	85 d2                	test   %edx,%edx
+801052e6:	74 18                	je     80105300 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+801052e8:	83 c3 01             	add    $0x1,%ebx
+801052eb:	83 fb 10             	cmp    $0x10,%ebx
+801052ee:	75 f0                	jne    801052e0 <sys_dup+0x40>
+}
+801052f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+801052f3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801052f8:	89 d8                	mov    %ebx,%eax
+801052fa:	5b                   	pop    %ebx
+801052fb:	5e                   	pop    %esi
+801052fc:	5d                   	pop    %ebp
+801052fd:	c3                   	ret
+801052fe:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80105300:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80105303:	89 74 98 28          	mov    %esi,0x28(%eax,%ebx,4)
+  filedup(f);
+80105307:	56                   	push   %esi
+80105308:	e8 73 bc ff ff       	call   80100f80 <filedup>
+  return fd;
+8010530d:	83 c4 10             	add    $0x10,%esp
+}
+80105310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105313:	89 d8                	mov    %ebx,%eax
+80105315:	5b                   	pop    %ebx
+80105316:	5e                   	pop    %esi
+80105317:	5d                   	pop    %ebp
+80105318:	c3                   	ret
+80105319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105320 <sys_read>:
+{
+80105320:	55                   	push   %ebp
+80105321:	89 e5                	mov    %esp,%ebp
+80105323:	56                   	push   %esi
+80105324:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105325:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80105328:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010532b:	53                   	push   %ebx
+8010532c:	6a 00                	push   $0x0
+8010532e:	e8 3d fc ff ff       	call   80104f70 <argint>
+80105333:	83 c4 10             	add    $0x10,%esp
+80105336:	85 c0                	test   %eax,%eax
+80105338:	78 5e                	js     80105398 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010533a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010533e:	77 58                	ja     80105398 <sys_read+0x78>
+80105340:	e8 6b e6 ff ff       	call   801039b0 <myproc>
+80105345:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105348:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+8010534c:	85 f6                	test   %esi,%esi
+8010534e:	74 48                	je     80105398 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80105350:	83 ec 08             	sub    $0x8,%esp
+80105353:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105356:	50                   	push   %eax
+80105357:	6a 02                	push   $0x2
+80105359:	e8 12 fc ff ff       	call   80104f70 <argint>
+8010535e:	83 c4 10             	add    $0x10,%esp
+80105361:	85 c0                	test   %eax,%eax
+80105363:	78 33                	js     80105398 <sys_read+0x78>
+80105365:	83 ec 04             	sub    $0x4,%esp
+80105368:	ff 75 f0             	push   -0x10(%ebp)
+8010536b:	53                   	push   %ebx
+8010536c:	6a 01                	push   $0x1
+8010536e:	e8 4d fc ff ff       	call   80104fc0 <argptr>
+80105373:	83 c4 10             	add    $0x10,%esp
+80105376:	85 c0                	test   %eax,%eax
+80105378:	78 1e                	js     80105398 <sys_read+0x78>
+  return fileread(f, p, n);
+8010537a:	83 ec 04             	sub    $0x4,%esp
+8010537d:	ff 75 f0             	push   -0x10(%ebp)
+80105380:	ff 75 f4             	push   -0xc(%ebp)
+80105383:	56                   	push   %esi
+80105384:	e8 77 bd ff ff       	call   80101100 <fileread>
+80105389:	83 c4 10             	add    $0x10,%esp
+}
+8010538c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010538f:	5b                   	pop    %ebx
+80105390:	5e                   	pop    %esi
+80105391:	5d                   	pop    %ebp
+80105392:	c3                   	ret
+80105393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105397:	90                   	nop
+    return -1;
+80105398:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010539d:	eb ed                	jmp    8010538c <sys_read+0x6c>
+8010539f:	90                   	nop
+
+801053a0 <sys_write>:
+{
+801053a0:	55                   	push   %ebp
+801053a1:	89 e5                	mov    %esp,%ebp
+801053a3:	56                   	push   %esi
+801053a4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801053a5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+801053a8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801053ab:	53                   	push   %ebx
+801053ac:	6a 00                	push   $0x0
+801053ae:	e8 bd fb ff ff       	call   80104f70 <argint>
+801053b3:	83 c4 10             	add    $0x10,%esp
+801053b6:	85 c0                	test   %eax,%eax
+801053b8:	78 5e                	js     80105418 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801053ba:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801053be:	77 58                	ja     80105418 <sys_write+0x78>
+801053c0:	e8 eb e5 ff ff       	call   801039b0 <myproc>
+801053c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801053c8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+801053cc:	85 f6                	test   %esi,%esi
+801053ce:	74 48                	je     80105418 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+801053d0:	83 ec 08             	sub    $0x8,%esp
+801053d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801053d6:	50                   	push   %eax
+801053d7:	6a 02                	push   $0x2
+801053d9:	e8 92 fb ff ff       	call   80104f70 <argint>
+801053de:	83 c4 10             	add    $0x10,%esp
+801053e1:	85 c0                	test   %eax,%eax
+801053e3:	78 33                	js     80105418 <sys_write+0x78>
+801053e5:	83 ec 04             	sub    $0x4,%esp
+801053e8:	ff 75 f0             	push   -0x10(%ebp)
+801053eb:	53                   	push   %ebx
+801053ec:	6a 01                	push   $0x1
+801053ee:	e8 cd fb ff ff       	call   80104fc0 <argptr>
+801053f3:	83 c4 10             	add    $0x10,%esp
+801053f6:	85 c0                	test   %eax,%eax
+801053f8:	78 1e                	js     80105418 <sys_write+0x78>
+  return filewrite(f, p, n);
+801053fa:	83 ec 04             	sub    $0x4,%esp
+801053fd:	ff 75 f0             	push   -0x10(%ebp)
+80105400:	ff 75 f4             	push   -0xc(%ebp)
+80105403:	56                   	push   %esi
+80105404:	e8 87 bd ff ff       	call   80101190 <filewrite>
+80105409:	83 c4 10             	add    $0x10,%esp
+}
+8010540c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010540f:	5b                   	pop    %ebx
+80105410:	5e                   	pop    %esi
+80105411:	5d                   	pop    %ebp
+80105412:	c3                   	ret
+80105413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105417:	90                   	nop
+    return -1;
+80105418:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010541d:	eb ed                	jmp    8010540c <sys_write+0x6c>
+8010541f:	90                   	nop
+
+80105420 <sys_close>:
+{
+80105420:	55                   	push   %ebp
+80105421:	89 e5                	mov    %esp,%ebp
+80105423:	56                   	push   %esi
+80105424:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105425:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80105428:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010542b:	50                   	push   %eax
+8010542c:	6a 00                	push   $0x0
+8010542e:	e8 3d fb ff ff       	call   80104f70 <argint>
+80105433:	83 c4 10             	add    $0x10,%esp
+80105436:	85 c0                	test   %eax,%eax
+80105438:	78 3e                	js     80105478 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010543a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010543e:	77 38                	ja     80105478 <sys_close+0x58>
+80105440:	e8 6b e5 ff ff       	call   801039b0 <myproc>
+80105445:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80105448:	8d 5a 08             	lea    0x8(%edx),%ebx
+8010544b:	8b 74 98 08          	mov    0x8(%eax,%ebx,4),%esi
+8010544f:	85 f6                	test   %esi,%esi
+80105451:	74 25                	je     80105478 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80105453:	e8 58 e5 ff ff       	call   801039b0 <myproc>
+  fileclose(f);
+80105458:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+8010545b:	c7 44 98 08 00 00 00 	movl   $0x0,0x8(%eax,%ebx,4)
+80105462:	00 
+  fileclose(f);
+80105463:	56                   	push   %esi
+80105464:	e8 67 bb ff ff       	call   80100fd0 <fileclose>
+  return 0;
+80105469:	83 c4 10             	add    $0x10,%esp
+8010546c:	31 c0                	xor    %eax,%eax
+}
+8010546e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105471:	5b                   	pop    %ebx
+80105472:	5e                   	pop    %esi
+80105473:	5d                   	pop    %ebp
+80105474:	c3                   	ret
+80105475:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80105478:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010547d:	eb ef                	jmp    8010546e <sys_close+0x4e>
+8010547f:	90                   	nop
+
+80105480 <sys_fstat>:
+{
+80105480:	55                   	push   %ebp
+80105481:	89 e5                	mov    %esp,%ebp
+80105483:	56                   	push   %esi
+80105484:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80105485:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80105488:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010548b:	53                   	push   %ebx
+8010548c:	6a 00                	push   $0x0
+8010548e:	e8 dd fa ff ff       	call   80104f70 <argint>
+80105493:	83 c4 10             	add    $0x10,%esp
+80105496:	85 c0                	test   %eax,%eax
+80105498:	78 46                	js     801054e0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010549a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010549e:	77 40                	ja     801054e0 <sys_fstat+0x60>
+801054a0:	e8 0b e5 ff ff       	call   801039b0 <myproc>
+801054a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801054a8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+801054ac:	85 f6                	test   %esi,%esi
+801054ae:	74 30                	je     801054e0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+801054b0:	83 ec 04             	sub    $0x4,%esp
+801054b3:	6a 14                	push   $0x14
+801054b5:	53                   	push   %ebx
+801054b6:	6a 01                	push   $0x1
+801054b8:	e8 03 fb ff ff       	call   80104fc0 <argptr>
+801054bd:	83 c4 10             	add    $0x10,%esp
+801054c0:	85 c0                	test   %eax,%eax
+801054c2:	78 1c                	js     801054e0 <sys_fstat+0x60>
+  return filestat(f, st);
+801054c4:	83 ec 08             	sub    $0x8,%esp
+801054c7:	ff 75 f4             	push   -0xc(%ebp)
+801054ca:	56                   	push   %esi
+801054cb:	e8 e0 bb ff ff       	call   801010b0 <filestat>
+801054d0:	83 c4 10             	add    $0x10,%esp
+}
+801054d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801054d6:	5b                   	pop    %ebx
+801054d7:	5e                   	pop    %esi
+801054d8:	5d                   	pop    %ebp
+801054d9:	c3                   	ret
+801054da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801054e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801054e5:	eb ec                	jmp    801054d3 <sys_fstat+0x53>
+801054e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801054ee:	66 90                	xchg   %ax,%ax
+
+801054f0 <sys_link>:
+{
+801054f0:	55                   	push   %ebp
+801054f1:	89 e5                	mov    %esp,%ebp
+801054f3:	57                   	push   %edi
+801054f4:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801054f5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+801054f8:	53                   	push   %ebx
+801054f9:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801054fc:	50                   	push   %eax
+801054fd:	6a 00                	push   $0x0
+801054ff:	e8 2c fb ff ff       	call   80105030 <argstr>
+80105504:	83 c4 10             	add    $0x10,%esp
+80105507:	85 c0                	test   %eax,%eax
+80105509:	0f 88 fb 00 00 00    	js     8010560a <sys_link+0x11a>
+8010550f:	83 ec 08             	sub    $0x8,%esp
+80105512:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80105515:	50                   	push   %eax
+80105516:	6a 01                	push   $0x1
+80105518:	e8 13 fb ff ff       	call   80105030 <argstr>
+8010551d:	83 c4 10             	add    $0x10,%esp
+80105520:	85 c0                	test   %eax,%eax
+80105522:	0f 88 e2 00 00 00    	js     8010560a <sys_link+0x11a>
+  begin_op();
+80105528:	e8 33 d9 ff ff       	call   80102e60 <begin_op>
+  if((ip = namei(old)) == 0){
+8010552d:	83 ec 0c             	sub    $0xc,%esp
+80105530:	ff 75 d4             	push   -0x2c(%ebp)
+80105533:	e8 58 cc ff ff       	call   80102190 <namei>
+80105538:	83 c4 10             	add    $0x10,%esp
+8010553b:	89 c3                	mov    %eax,%ebx
+8010553d:	85 c0                	test   %eax,%eax
+8010553f:	0f 84 df 00 00 00    	je     80105624 <sys_link+0x134>
+  ilock(ip);
+80105545:	83 ec 0c             	sub    $0xc,%esp
+80105548:	50                   	push   %eax
+80105549:	e8 12 c3 ff ff       	call   80101860 <ilock>
+  if(ip->type == T_DIR){
+8010554e:	83 c4 10             	add    $0x10,%esp
+80105551:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105556:	0f 84 b5 00 00 00    	je     80105611 <sys_link+0x121>
+  iupdate(ip);
+8010555c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+8010555f:	66 83 43 56 01       	addw   $0x1,0x56(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80105564:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80105567:	53                   	push   %ebx
+80105568:	e8 43 c2 ff ff       	call   801017b0 <iupdate>
+  iunlock(ip);
+8010556d:	89 1c 24             	mov    %ebx,(%esp)
+80105570:	e8 cb c3 ff ff       	call   80101940 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80105575:	58                   	pop    %eax
+80105576:	5a                   	pop    %edx
+80105577:	57                   	push   %edi
+80105578:	ff 75 d0             	push   -0x30(%ebp)
+8010557b:	e8 30 cc ff ff       	call   801021b0 <nameiparent>
+80105580:	83 c4 10             	add    $0x10,%esp
+80105583:	89 c6                	mov    %eax,%esi
+80105585:	85 c0                	test   %eax,%eax
+80105587:	74 5b                	je     801055e4 <sys_link+0xf4>
+  ilock(dp);
+80105589:	83 ec 0c             	sub    $0xc,%esp
+8010558c:	50                   	push   %eax
+8010558d:	e8 ce c2 ff ff       	call   80101860 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80105592:	8b 03                	mov    (%ebx),%eax
+80105594:	83 c4 10             	add    $0x10,%esp
+80105597:	39 06                	cmp    %eax,(%esi)
+80105599:	75 3d                	jne    801055d8 <sys_link+0xe8>
+8010559b:	83 ec 04             	sub    $0x4,%esp
+8010559e:	ff 73 04             	push   0x4(%ebx)
+801055a1:	57                   	push   %edi
+801055a2:	56                   	push   %esi
+801055a3:	e8 28 cb ff ff       	call   801020d0 <dirlink>
+801055a8:	83 c4 10             	add    $0x10,%esp
+801055ab:	85 c0                	test   %eax,%eax
+801055ad:	78 29                	js     801055d8 <sys_link+0xe8>
+  iunlockput(dp);
+801055af:	83 ec 0c             	sub    $0xc,%esp
+801055b2:	56                   	push   %esi
+801055b3:	e8 38 c5 ff ff       	call   80101af0 <iunlockput>
+  iput(ip);
+801055b8:	89 1c 24             	mov    %ebx,(%esp)
+801055bb:	e8 d0 c3 ff ff       	call   80101990 <iput>
+  end_op();
+801055c0:	e8 0b d9 ff ff       	call   80102ed0 <end_op>
+  return 0;
+801055c5:	83 c4 10             	add    $0x10,%esp
+801055c8:	31 c0                	xor    %eax,%eax
+}
+801055ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055cd:	5b                   	pop    %ebx
+801055ce:	5e                   	pop    %esi
+801055cf:	5f                   	pop    %edi
+801055d0:	5d                   	pop    %ebp
+801055d1:	c3                   	ret
+801055d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+801055d8:	83 ec 0c             	sub    $0xc,%esp
+801055db:	56                   	push   %esi
+801055dc:	e8 0f c5 ff ff       	call   80101af0 <iunlockput>
+    goto bad;
+801055e1:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+801055e4:	83 ec 0c             	sub    $0xc,%esp
+801055e7:	53                   	push   %ebx
+801055e8:	e8 73 c2 ff ff       	call   80101860 <ilock>
+  ip->nlink--;
+801055ed:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+801055f2:	89 1c 24             	mov    %ebx,(%esp)
+801055f5:	e8 b6 c1 ff ff       	call   801017b0 <iupdate>
+  iunlockput(ip);
+801055fa:	89 1c 24             	mov    %ebx,(%esp)
+801055fd:	e8 ee c4 ff ff       	call   80101af0 <iunlockput>
+  end_op();
+80105602:	e8 c9 d8 ff ff       	call   80102ed0 <end_op>
+  return -1;
+80105607:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010560a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010560f:	eb b9                	jmp    801055ca <sys_link+0xda>
+    iunlockput(ip);
+80105611:	83 ec 0c             	sub    $0xc,%esp
+80105614:	53                   	push   %ebx
+80105615:	e8 d6 c4 ff ff       	call   80101af0 <iunlockput>
+    end_op();
+8010561a:	e8 b1 d8 ff ff       	call   80102ed0 <end_op>
+    return -1;
+8010561f:	83 c4 10             	add    $0x10,%esp
+80105622:	eb e6                	jmp    8010560a <sys_link+0x11a>
+    end_op();
+80105624:	e8 a7 d8 ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105629:	eb df                	jmp    8010560a <sys_link+0x11a>
+8010562b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010562f:	90                   	nop
+
+80105630 <sys_unlink>:
+{
+80105630:	55                   	push   %ebp
+80105631:	89 e5                	mov    %esp,%ebp
+80105633:	57                   	push   %edi
+80105634:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80105635:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80105638:	53                   	push   %ebx
+80105639:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+8010563c:	50                   	push   %eax
+8010563d:	6a 00                	push   $0x0
+8010563f:	e8 ec f9 ff ff       	call   80105030 <argstr>
+80105644:	83 c4 10             	add    $0x10,%esp
+80105647:	85 c0                	test   %eax,%eax
+80105649:	0f 88 54 01 00 00    	js     801057a3 <sys_unlink+0x173>
+  begin_op();
+8010564f:	e8 0c d8 ff ff       	call   80102e60 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80105654:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80105657:	83 ec 08             	sub    $0x8,%esp
+8010565a:	53                   	push   %ebx
+8010565b:	ff 75 c0             	push   -0x40(%ebp)
+8010565e:	e8 4d cb ff ff       	call   801021b0 <nameiparent>
+80105663:	83 c4 10             	add    $0x10,%esp
+80105666:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80105669:	85 c0                	test   %eax,%eax
+8010566b:	0f 84 58 01 00 00    	je     801057c9 <sys_unlink+0x199>
+  ilock(dp);
+80105671:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80105674:	83 ec 0c             	sub    $0xc,%esp
+80105677:	57                   	push   %edi
+80105678:	e8 e3 c1 ff ff       	call   80101860 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+8010567d:	58                   	pop    %eax
+8010567e:	5a                   	pop    %edx
+8010567f:	68 ec 86 10 80       	push   $0x801086ec
+80105684:	53                   	push   %ebx
+80105685:	e8 16 c7 ff ff       	call   80101da0 <namecmp>
+8010568a:	83 c4 10             	add    $0x10,%esp
+8010568d:	85 c0                	test   %eax,%eax
+8010568f:	0f 84 fb 00 00 00    	je     80105790 <sys_unlink+0x160>
+80105695:	83 ec 08             	sub    $0x8,%esp
+80105698:	68 eb 86 10 80       	push   $0x801086eb
+8010569d:	53                   	push   %ebx
+8010569e:	e8 fd c6 ff ff       	call   80101da0 <namecmp>
+801056a3:	83 c4 10             	add    $0x10,%esp
+801056a6:	85 c0                	test   %eax,%eax
+801056a8:	0f 84 e2 00 00 00    	je     80105790 <sys_unlink+0x160>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801056ae:	83 ec 04             	sub    $0x4,%esp
+801056b1:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+801056b4:	50                   	push   %eax
+801056b5:	53                   	push   %ebx
+801056b6:	57                   	push   %edi
+801056b7:	e8 04 c7 ff ff       	call   80101dc0 <dirlookup>
+801056bc:	83 c4 10             	add    $0x10,%esp
+801056bf:	89 c3                	mov    %eax,%ebx
+801056c1:	85 c0                	test   %eax,%eax
+801056c3:	0f 84 c7 00 00 00    	je     80105790 <sys_unlink+0x160>
+  ilock(ip);
+801056c9:	83 ec 0c             	sub    $0xc,%esp
+801056cc:	50                   	push   %eax
+801056cd:	e8 8e c1 ff ff       	call   80101860 <ilock>
+  if(ip->nlink < 1)
+801056d2:	83 c4 10             	add    $0x10,%esp
+801056d5:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+801056da:	0f 8e 0a 01 00 00    	jle    801057ea <sys_unlink+0x1ba>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801056e0:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+801056e5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801056e8:	74 66                	je     80105750 <sys_unlink+0x120>
+  memset(&de, 0, sizeof(de));
+801056ea:	83 ec 04             	sub    $0x4,%esp
+801056ed:	6a 10                	push   $0x10
+801056ef:	6a 00                	push   $0x0
+801056f1:	57                   	push   %edi
+801056f2:	e8 c9 f5 ff ff       	call   80104cc0 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801056f7:	6a 10                	push   $0x10
+801056f9:	ff 75 c4             	push   -0x3c(%ebp)
+801056fc:	57                   	push   %edi
+801056fd:	ff 75 b4             	push   -0x4c(%ebp)
+80105700:	e8 6b c5 ff ff       	call   80101c70 <writei>
+80105705:	83 c4 20             	add    $0x20,%esp
+80105708:	83 f8 10             	cmp    $0x10,%eax
+8010570b:	0f 85 cc 00 00 00    	jne    801057dd <sys_unlink+0x1ad>
+  if(ip->type == T_DIR){
+80105711:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105716:	0f 84 94 00 00 00    	je     801057b0 <sys_unlink+0x180>
+  iunlockput(dp);
+8010571c:	83 ec 0c             	sub    $0xc,%esp
+8010571f:	ff 75 b4             	push   -0x4c(%ebp)
+80105722:	e8 c9 c3 ff ff       	call   80101af0 <iunlockput>
+  ip->nlink--;
+80105727:	66 83 6b 56 01       	subw   $0x1,0x56(%ebx)
+  iupdate(ip);
+8010572c:	89 1c 24             	mov    %ebx,(%esp)
+8010572f:	e8 7c c0 ff ff       	call   801017b0 <iupdate>
+  iunlockput(ip);
+80105734:	89 1c 24             	mov    %ebx,(%esp)
+80105737:	e8 b4 c3 ff ff       	call   80101af0 <iunlockput>
+  end_op();
+8010573c:	e8 8f d7 ff ff       	call   80102ed0 <end_op>
+  return 0;
+80105741:	83 c4 10             	add    $0x10,%esp
+80105744:	31 c0                	xor    %eax,%eax
+}
+80105746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105749:	5b                   	pop    %ebx
+8010574a:	5e                   	pop    %esi
+8010574b:	5f                   	pop    %edi
+8010574c:	5d                   	pop    %ebp
+8010574d:	c3                   	ret
+8010574e:	66 90                	xchg   %ax,%ax
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80105750:	83 7b 58 20          	cmpl   $0x20,0x58(%ebx)
+80105754:	76 94                	jbe    801056ea <sys_unlink+0xba>
+80105756:	be 20 00 00 00       	mov    $0x20,%esi
+8010575b:	eb 0b                	jmp    80105768 <sys_unlink+0x138>
+8010575d:	8d 76 00             	lea    0x0(%esi),%esi
+80105760:	83 c6 10             	add    $0x10,%esi
+80105763:	3b 73 58             	cmp    0x58(%ebx),%esi
+80105766:	73 82                	jae    801056ea <sys_unlink+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80105768:	6a 10                	push   $0x10
+8010576a:	56                   	push   %esi
+8010576b:	57                   	push   %edi
+8010576c:	53                   	push   %ebx
+8010576d:	e8 fe c3 ff ff       	call   80101b70 <readi>
+80105772:	83 c4 10             	add    $0x10,%esp
+80105775:	83 f8 10             	cmp    $0x10,%eax
+80105778:	75 56                	jne    801057d0 <sys_unlink+0x1a0>
+    if(de.inum != 0)
+8010577a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010577f:	74 df                	je     80105760 <sys_unlink+0x130>
+    iunlockput(ip);
+80105781:	83 ec 0c             	sub    $0xc,%esp
+80105784:	53                   	push   %ebx
+80105785:	e8 66 c3 ff ff       	call   80101af0 <iunlockput>
+    goto bad;
+8010578a:	83 c4 10             	add    $0x10,%esp
+8010578d:	8d 76 00             	lea    0x0(%esi),%esi
+  iunlockput(dp);
+80105790:	83 ec 0c             	sub    $0xc,%esp
+80105793:	ff 75 b4             	push   -0x4c(%ebp)
+80105796:	e8 55 c3 ff ff       	call   80101af0 <iunlockput>
+  end_op();
+8010579b:	e8 30 d7 ff ff       	call   80102ed0 <end_op>
+  return -1;
+801057a0:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801057a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801057a8:	eb 9c                	jmp    80105746 <sys_unlink+0x116>
+801057aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+801057b0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+801057b3:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+801057b6:	66 83 68 56 01       	subw   $0x1,0x56(%eax)
+    iupdate(dp);
+801057bb:	50                   	push   %eax
+801057bc:	e8 ef bf ff ff       	call   801017b0 <iupdate>
+801057c1:	83 c4 10             	add    $0x10,%esp
+801057c4:	e9 53 ff ff ff       	jmp    8010571c <sys_unlink+0xec>
+    end_op();
+801057c9:	e8 02 d7 ff ff       	call   80102ed0 <end_op>
+    return -1;
+801057ce:	eb d3                	jmp    801057a3 <sys_unlink+0x173>
+      panic("isdirempty: readi");
+801057d0:	83 ec 0c             	sub    $0xc,%esp
+801057d3:	68 10 87 10 80       	push   $0x80108710
+801057d8:	e8 a3 ab ff ff       	call   80100380 <panic>
+    panic("unlink: writei");
+801057dd:	83 ec 0c             	sub    $0xc,%esp
+801057e0:	68 22 87 10 80       	push   $0x80108722
+801057e5:	e8 96 ab ff ff       	call   80100380 <panic>
+    panic("unlink: nlink < 1");
+801057ea:	83 ec 0c             	sub    $0xc,%esp
+801057ed:	68 fe 86 10 80       	push   $0x801086fe
+801057f2:	e8 89 ab ff ff       	call   80100380 <panic>
+801057f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801057fe:	66 90                	xchg   %ax,%ax
+
+80105800 <sys_open>:
+
+int
+sys_open(void)
+{
+80105800:	55                   	push   %ebp
+80105801:	89 e5                	mov    %esp,%ebp
+80105803:	57                   	push   %edi
+80105804:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80105805:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+80105808:	53                   	push   %ebx
+80105809:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010580c:	50                   	push   %eax
+8010580d:	6a 00                	push   $0x0
+8010580f:	e8 1c f8 ff ff       	call   80105030 <argstr>
+80105814:	83 c4 10             	add    $0x10,%esp
+80105817:	85 c0                	test   %eax,%eax
+80105819:	0f 88 8e 00 00 00    	js     801058ad <sys_open+0xad>
+8010581f:	83 ec 08             	sub    $0x8,%esp
+80105822:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80105825:	50                   	push   %eax
+80105826:	6a 01                	push   $0x1
+80105828:	e8 43 f7 ff ff       	call   80104f70 <argint>
+8010582d:	83 c4 10             	add    $0x10,%esp
+80105830:	85 c0                	test   %eax,%eax
+80105832:	78 79                	js     801058ad <sys_open+0xad>
+    return -1;
+
+  begin_op();
+80105834:	e8 27 d6 ff ff       	call   80102e60 <begin_op>
+
+  if(omode & O_CREATE){
+80105839:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+8010583d:	75 79                	jne    801058b8 <sys_open+0xb8>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+8010583f:	83 ec 0c             	sub    $0xc,%esp
+80105842:	ff 75 e0             	push   -0x20(%ebp)
+80105845:	e8 46 c9 ff ff       	call   80102190 <namei>
+8010584a:	83 c4 10             	add    $0x10,%esp
+8010584d:	89 c6                	mov    %eax,%esi
+8010584f:	85 c0                	test   %eax,%eax
+80105851:	0f 84 7e 00 00 00    	je     801058d5 <sys_open+0xd5>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80105857:	83 ec 0c             	sub    $0xc,%esp
+8010585a:	50                   	push   %eax
+8010585b:	e8 00 c0 ff ff       	call   80101860 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80105860:	83 c4 10             	add    $0x10,%esp
+80105863:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+80105868:	0f 84 ba 00 00 00    	je     80105928 <sys_open+0x128>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+8010586e:	e8 9d b6 ff ff       	call   80100f10 <filealloc>
+80105873:	89 c7                	mov    %eax,%edi
+80105875:	85 c0                	test   %eax,%eax
+80105877:	74 23                	je     8010589c <sys_open+0x9c>
+  struct proc *curproc = myproc();
+80105879:	e8 32 e1 ff ff       	call   801039b0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010587e:	31 db                	xor    %ebx,%ebx
+    if(curproc->ofile[fd] == 0){
+80105880:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+80105884:	85 d2                	test   %edx,%edx
+80105886:	74 58                	je     801058e0 <sys_open+0xe0>
+  for(fd = 0; fd < NOFILE; fd++){
+80105888:	83 c3 01             	add    $0x1,%ebx
+8010588b:	83 fb 10             	cmp    $0x10,%ebx
+8010588e:	75 f0                	jne    80105880 <sys_open+0x80>
+    if(f)
+      fileclose(f);
+80105890:	83 ec 0c             	sub    $0xc,%esp
+80105893:	57                   	push   %edi
+80105894:	e8 37 b7 ff ff       	call   80100fd0 <fileclose>
+80105899:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010589c:	83 ec 0c             	sub    $0xc,%esp
+8010589f:	56                   	push   %esi
+801058a0:	e8 4b c2 ff ff       	call   80101af0 <iunlockput>
+    end_op();
+801058a5:	e8 26 d6 ff ff       	call   80102ed0 <end_op>
+    return -1;
+801058aa:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801058ad:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801058b2:	eb 65                	jmp    80105919 <sys_open+0x119>
+801058b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+801058b8:	83 ec 0c             	sub    $0xc,%esp
+801058bb:	31 c9                	xor    %ecx,%ecx
+801058bd:	ba 02 00 00 00       	mov    $0x2,%edx
+801058c2:	6a 00                	push   $0x0
+801058c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801058c7:	e8 54 f8 ff ff       	call   80105120 <create>
+    if(ip == 0){
+801058cc:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801058cf:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801058d1:	85 c0                	test   %eax,%eax
+801058d3:	75 99                	jne    8010586e <sys_open+0x6e>
+      end_op();
+801058d5:	e8 f6 d5 ff ff       	call   80102ed0 <end_op>
+      return -1;
+801058da:	eb d1                	jmp    801058ad <sys_open+0xad>
+801058dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+801058e0:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801058e3:	89 7c 98 28          	mov    %edi,0x28(%eax,%ebx,4)
+  iunlock(ip);
+801058e7:	56                   	push   %esi
+801058e8:	e8 53 c0 ff ff       	call   80101940 <iunlock>
+  end_op();
+801058ed:	e8 de d5 ff ff       	call   80102ed0 <end_op>
+
+  f->type = FD_INODE;
+801058f2:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+801058f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801058fb:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+801058fe:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+80105901:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+80105903:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+8010590a:	f7 d0                	not    %eax
+8010590c:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010590f:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+80105912:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80105915:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+80105919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010591c:	89 d8                	mov    %ebx,%eax
+8010591e:	5b                   	pop    %ebx
+8010591f:	5e                   	pop    %esi
+80105920:	5f                   	pop    %edi
+80105921:	5d                   	pop    %ebp
+80105922:	c3                   	ret
+80105923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105927:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80105928:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010592b:	85 c9                	test   %ecx,%ecx
+8010592d:	0f 84 3b ff ff ff    	je     8010586e <sys_open+0x6e>
+80105933:	e9 64 ff ff ff       	jmp    8010589c <sys_open+0x9c>
+80105938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010593f:	90                   	nop
+
+80105940 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80105940:	55                   	push   %ebp
+80105941:	89 e5                	mov    %esp,%ebp
+80105943:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80105946:	e8 15 d5 ff ff       	call   80102e60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010594b:	83 ec 08             	sub    $0x8,%esp
+8010594e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105951:	50                   	push   %eax
+80105952:	6a 00                	push   $0x0
+80105954:	e8 d7 f6 ff ff       	call   80105030 <argstr>
+80105959:	83 c4 10             	add    $0x10,%esp
+8010595c:	85 c0                	test   %eax,%eax
+8010595e:	78 30                	js     80105990 <sys_mkdir+0x50>
+80105960:	83 ec 0c             	sub    $0xc,%esp
+80105963:	31 c9                	xor    %ecx,%ecx
+80105965:	ba 01 00 00 00       	mov    $0x1,%edx
+8010596a:	6a 00                	push   $0x0
+8010596c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010596f:	e8 ac f7 ff ff       	call   80105120 <create>
+80105974:	83 c4 10             	add    $0x10,%esp
+80105977:	85 c0                	test   %eax,%eax
+80105979:	74 15                	je     80105990 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010597b:	83 ec 0c             	sub    $0xc,%esp
+8010597e:	50                   	push   %eax
+8010597f:	e8 6c c1 ff ff       	call   80101af0 <iunlockput>
+  end_op();
+80105984:	e8 47 d5 ff ff       	call   80102ed0 <end_op>
+  return 0;
+80105989:	83 c4 10             	add    $0x10,%esp
+8010598c:	31 c0                	xor    %eax,%eax
+}
+8010598e:	c9                   	leave
+8010598f:	c3                   	ret
+    end_op();
+80105990:	e8 3b d5 ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105995:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010599a:	c9                   	leave
+8010599b:	c3                   	ret
+8010599c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801059a0 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+801059a0:	55                   	push   %ebp
+801059a1:	89 e5                	mov    %esp,%ebp
+801059a3:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+801059a6:	e8 b5 d4 ff ff       	call   80102e60 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801059ab:	83 ec 08             	sub    $0x8,%esp
+801059ae:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801059b1:	50                   	push   %eax
+801059b2:	6a 00                	push   $0x0
+801059b4:	e8 77 f6 ff ff       	call   80105030 <argstr>
+801059b9:	83 c4 10             	add    $0x10,%esp
+801059bc:	85 c0                	test   %eax,%eax
+801059be:	78 60                	js     80105a20 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+801059c0:	83 ec 08             	sub    $0x8,%esp
+801059c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801059c6:	50                   	push   %eax
+801059c7:	6a 01                	push   $0x1
+801059c9:	e8 a2 f5 ff ff       	call   80104f70 <argint>
+  if((argstr(0, &path)) < 0 ||
+801059ce:	83 c4 10             	add    $0x10,%esp
+801059d1:	85 c0                	test   %eax,%eax
+801059d3:	78 4b                	js     80105a20 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+801059d5:	83 ec 08             	sub    $0x8,%esp
+801059d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801059db:	50                   	push   %eax
+801059dc:	6a 02                	push   $0x2
+801059de:	e8 8d f5 ff ff       	call   80104f70 <argint>
+     argint(1, &major) < 0 ||
+801059e3:	83 c4 10             	add    $0x10,%esp
+801059e6:	85 c0                	test   %eax,%eax
+801059e8:	78 36                	js     80105a20 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801059ea:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+801059ee:	83 ec 0c             	sub    $0xc,%esp
+801059f1:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801059f5:	ba 03 00 00 00       	mov    $0x3,%edx
+801059fa:	50                   	push   %eax
+801059fb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801059fe:	e8 1d f7 ff ff       	call   80105120 <create>
+     argint(2, &minor) < 0 ||
+80105a03:	83 c4 10             	add    $0x10,%esp
+80105a06:	85 c0                	test   %eax,%eax
+80105a08:	74 16                	je     80105a20 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80105a0a:	83 ec 0c             	sub    $0xc,%esp
+80105a0d:	50                   	push   %eax
+80105a0e:	e8 dd c0 ff ff       	call   80101af0 <iunlockput>
+  end_op();
+80105a13:	e8 b8 d4 ff ff       	call   80102ed0 <end_op>
+  return 0;
+80105a18:	83 c4 10             	add    $0x10,%esp
+80105a1b:	31 c0                	xor    %eax,%eax
+}
+80105a1d:	c9                   	leave
+80105a1e:	c3                   	ret
+80105a1f:	90                   	nop
+    end_op();
+80105a20:	e8 ab d4 ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105a25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105a2a:	c9                   	leave
+80105a2b:	c3                   	ret
+80105a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105a30 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80105a30:	55                   	push   %ebp
+80105a31:	89 e5                	mov    %esp,%ebp
+80105a33:	56                   	push   %esi
+80105a34:	53                   	push   %ebx
+80105a35:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80105a38:	e8 73 df ff ff       	call   801039b0 <myproc>
+80105a3d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+80105a3f:	e8 1c d4 ff ff       	call   80102e60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80105a44:	83 ec 08             	sub    $0x8,%esp
+80105a47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105a4a:	50                   	push   %eax
+80105a4b:	6a 00                	push   $0x0
+80105a4d:	e8 de f5 ff ff       	call   80105030 <argstr>
+80105a52:	83 c4 10             	add    $0x10,%esp
+80105a55:	85 c0                	test   %eax,%eax
+80105a57:	78 77                	js     80105ad0 <sys_chdir+0xa0>
+80105a59:	83 ec 0c             	sub    $0xc,%esp
+80105a5c:	ff 75 f4             	push   -0xc(%ebp)
+80105a5f:	e8 2c c7 ff ff       	call   80102190 <namei>
+80105a64:	83 c4 10             	add    $0x10,%esp
+80105a67:	89 c3                	mov    %eax,%ebx
+80105a69:	85 c0                	test   %eax,%eax
+80105a6b:	74 63                	je     80105ad0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80105a6d:	83 ec 0c             	sub    $0xc,%esp
+80105a70:	50                   	push   %eax
+80105a71:	e8 ea bd ff ff       	call   80101860 <ilock>
+  if(ip->type != T_DIR){
+80105a76:	83 c4 10             	add    $0x10,%esp
+80105a79:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80105a7e:	75 30                	jne    80105ab0 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80105a80:	83 ec 0c             	sub    $0xc,%esp
+80105a83:	53                   	push   %ebx
+80105a84:	e8 b7 be ff ff       	call   80101940 <iunlock>
+  iput(curproc->cwd);
+80105a89:	58                   	pop    %eax
+80105a8a:	ff 76 68             	push   0x68(%esi)
+80105a8d:	e8 fe be ff ff       	call   80101990 <iput>
+  end_op();
+80105a92:	e8 39 d4 ff ff       	call   80102ed0 <end_op>
+  curproc->cwd = ip;
+80105a97:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+80105a9a:	83 c4 10             	add    $0x10,%esp
+80105a9d:	31 c0                	xor    %eax,%eax
+}
+80105a9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105aa2:	5b                   	pop    %ebx
+80105aa3:	5e                   	pop    %esi
+80105aa4:	5d                   	pop    %ebp
+80105aa5:	c3                   	ret
+80105aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105aad:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80105ab0:	83 ec 0c             	sub    $0xc,%esp
+80105ab3:	53                   	push   %ebx
+80105ab4:	e8 37 c0 ff ff       	call   80101af0 <iunlockput>
+    end_op();
+80105ab9:	e8 12 d4 ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105abe:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80105ac1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105ac6:	eb d7                	jmp    80105a9f <sys_chdir+0x6f>
+80105ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105acf:	90                   	nop
+    end_op();
+80105ad0:	e8 fb d3 ff ff       	call   80102ed0 <end_op>
+    return -1;
+80105ad5:	eb ea                	jmp    80105ac1 <sys_chdir+0x91>
+80105ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ade:	66 90                	xchg   %ax,%ax
+
+80105ae0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80105ae0:	55                   	push   %ebp
+80105ae1:	89 e5                	mov    %esp,%ebp
+80105ae3:	57                   	push   %edi
+80105ae4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80105ae5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+80105aeb:	53                   	push   %ebx
+80105aec:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80105af2:	50                   	push   %eax
+80105af3:	6a 00                	push   $0x0
+80105af5:	e8 36 f5 ff ff       	call   80105030 <argstr>
+80105afa:	83 c4 10             	add    $0x10,%esp
+80105afd:	85 c0                	test   %eax,%eax
+80105aff:	0f 88 87 00 00 00    	js     80105b8c <sys_exec+0xac>
+80105b05:	83 ec 08             	sub    $0x8,%esp
+80105b08:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+80105b0e:	50                   	push   %eax
+80105b0f:	6a 01                	push   $0x1
+80105b11:	e8 5a f4 ff ff       	call   80104f70 <argint>
+80105b16:	83 c4 10             	add    $0x10,%esp
+80105b19:	85 c0                	test   %eax,%eax
+80105b1b:	78 6f                	js     80105b8c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80105b1d:	83 ec 04             	sub    $0x4,%esp
+80105b20:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80105b26:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80105b28:	68 80 00 00 00       	push   $0x80
+80105b2d:	6a 00                	push   $0x0
+80105b2f:	56                   	push   %esi
+80105b30:	e8 8b f1 ff ff       	call   80104cc0 <memset>
+80105b35:	83 c4 10             	add    $0x10,%esp
+80105b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b3f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80105b40:	83 ec 08             	sub    $0x8,%esp
+80105b43:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80105b49:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80105b50:	50                   	push   %eax
+80105b51:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80105b57:	01 f8                	add    %edi,%eax
+80105b59:	50                   	push   %eax
+80105b5a:	e8 81 f3 ff ff       	call   80104ee0 <fetchint>
+80105b5f:	83 c4 10             	add    $0x10,%esp
+80105b62:	85 c0                	test   %eax,%eax
+80105b64:	78 26                	js     80105b8c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80105b66:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+80105b6c:	85 c0                	test   %eax,%eax
+80105b6e:	74 30                	je     80105ba0 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80105b70:	83 ec 08             	sub    $0x8,%esp
+80105b73:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80105b76:	52                   	push   %edx
+80105b77:	50                   	push   %eax
+80105b78:	e8 a3 f3 ff ff       	call   80104f20 <fetchstr>
+80105b7d:	83 c4 10             	add    $0x10,%esp
+80105b80:	85 c0                	test   %eax,%eax
+80105b82:	78 08                	js     80105b8c <sys_exec+0xac>
+  for(i=0;; i++){
+80105b84:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80105b87:	83 fb 20             	cmp    $0x20,%ebx
+80105b8a:	75 b4                	jne    80105b40 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+80105b8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80105b8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105b94:	5b                   	pop    %ebx
+80105b95:	5e                   	pop    %esi
+80105b96:	5f                   	pop    %edi
+80105b97:	5d                   	pop    %ebp
+80105b98:	c3                   	ret
+80105b99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80105ba0:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80105ba7:	00 00 00 00 
+  return exec(path, argv);
+80105bab:	83 ec 08             	sub    $0x8,%esp
+80105bae:	56                   	push   %esi
+80105baf:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80105bb5:	e8 16 b3 ff ff       	call   80100ed0 <exec>
+80105bba:	83 c4 10             	add    $0x10,%esp
+}
+80105bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105bc0:	5b                   	pop    %ebx
+80105bc1:	5e                   	pop    %esi
+80105bc2:	5f                   	pop    %edi
+80105bc3:	5d                   	pop    %ebp
+80105bc4:	c3                   	ret
+80105bc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105bd0 <sys_exec2>:
+
+int
+sys_exec2(void)
+{
+80105bd0:	55                   	push   %ebp
+80105bd1:	89 e5                	mov    %esp,%ebp
+80105bd3:	57                   	push   %edi
+80105bd4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  int stacksize;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || 
+80105bd5:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+{
+80105bdb:	53                   	push   %ebx
+80105bdc:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || 
+80105be2:	50                   	push   %eax
+80105be3:	6a 00                	push   $0x0
+80105be5:	e8 46 f4 ff ff       	call   80105030 <argstr>
+80105bea:	83 c4 10             	add    $0x10,%esp
+80105bed:	85 c0                	test   %eax,%eax
+80105bef:	0f 88 97 00 00 00    	js     80105c8c <sys_exec2+0xbc>
+     argint(1, (int*)&uargv) < 0 || 
+80105bf5:	83 ec 08             	sub    $0x8,%esp
+80105bf8:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+80105bfe:	50                   	push   %eax
+80105bff:	6a 01                	push   $0x1
+80105c01:	e8 6a f3 ff ff       	call   80104f70 <argint>
+  if(argstr(0, &path) < 0 || 
+80105c06:	83 c4 10             	add    $0x10,%esp
+80105c09:	85 c0                	test   %eax,%eax
+80105c0b:	78 7f                	js     80105c8c <sys_exec2+0xbc>
+     argint(2, &stacksize) < 0){
+80105c0d:	83 ec 08             	sub    $0x8,%esp
+80105c10:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+80105c16:	50                   	push   %eax
+80105c17:	6a 02                	push   $0x2
+80105c19:	e8 52 f3 ff ff       	call   80104f70 <argint>
+     argint(1, (int*)&uargv) < 0 || 
+80105c1e:	83 c4 10             	add    $0x10,%esp
+80105c21:	85 c0                	test   %eax,%eax
+80105c23:	78 67                	js     80105c8c <sys_exec2+0xbc>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80105c25:	83 ec 04             	sub    $0x4,%esp
+80105c28:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80105c2e:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80105c30:	68 80 00 00 00       	push   $0x80
+80105c35:	6a 00                	push   $0x0
+80105c37:	56                   	push   %esi
+80105c38:	e8 83 f0 ff ff       	call   80104cc0 <memset>
+80105c3d:	83 c4 10             	add    $0x10,%esp
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80105c40:	83 ec 08             	sub    $0x8,%esp
+80105c43:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80105c49:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80105c50:	50                   	push   %eax
+80105c51:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80105c57:	01 f8                	add    %edi,%eax
+80105c59:	50                   	push   %eax
+80105c5a:	e8 81 f2 ff ff       	call   80104ee0 <fetchint>
+80105c5f:	83 c4 10             	add    $0x10,%esp
+80105c62:	85 c0                	test   %eax,%eax
+80105c64:	78 26                	js     80105c8c <sys_exec2+0xbc>
+      return -1;
+    if(uarg == 0){
+80105c66:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+80105c6c:	85 c0                	test   %eax,%eax
+80105c6e:	74 30                	je     80105ca0 <sys_exec2+0xd0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80105c70:	83 ec 08             	sub    $0x8,%esp
+80105c73:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80105c76:	52                   	push   %edx
+80105c77:	50                   	push   %eax
+80105c78:	e8 a3 f2 ff ff       	call   80104f20 <fetchstr>
+80105c7d:	83 c4 10             	add    $0x10,%esp
+80105c80:	85 c0                	test   %eax,%eax
+80105c82:	78 08                	js     80105c8c <sys_exec2+0xbc>
+  for(i=0;; i++){
+80105c84:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80105c87:	83 fb 20             	cmp    $0x20,%ebx
+80105c8a:	75 b4                	jne    80105c40 <sys_exec2+0x70>
+      return -1;
+  }
+  return exec2(path, argv, stacksize);
+}
+80105c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80105c8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105c94:	5b                   	pop    %ebx
+80105c95:	5e                   	pop    %esi
+80105c96:	5f                   	pop    %edi
+80105c97:	5d                   	pop    %ebp
+80105c98:	c3                   	ret
+80105c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80105ca0:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80105ca7:	00 00 00 00 
+  return exec2(path, argv, stacksize);
+80105cab:	83 ec 04             	sub    $0x4,%esp
+80105cae:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80105cb4:	56                   	push   %esi
+80105cb5:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+80105cbb:	e8 20 ae ff ff       	call   80100ae0 <exec2>
+80105cc0:	83 c4 10             	add    $0x10,%esp
+}
+80105cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cc6:	5b                   	pop    %ebx
+80105cc7:	5e                   	pop    %esi
+80105cc8:	5f                   	pop    %edi
+80105cc9:	5d                   	pop    %ebp
+80105cca:	c3                   	ret
+80105ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105ccf:	90                   	nop
+
+80105cd0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80105cd0:	55                   	push   %ebp
+80105cd1:	89 e5                	mov    %esp,%ebp
+80105cd3:	57                   	push   %edi
+80105cd4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80105cd5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+80105cd8:	53                   	push   %ebx
+80105cd9:	83 ec 20             	sub    $0x20,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80105cdc:	6a 08                	push   $0x8
+80105cde:	50                   	push   %eax
+80105cdf:	6a 00                	push   $0x0
+80105ce1:	e8 da f2 ff ff       	call   80104fc0 <argptr>
+80105ce6:	83 c4 10             	add    $0x10,%esp
+80105ce9:	85 c0                	test   %eax,%eax
+80105ceb:	0f 88 8b 00 00 00    	js     80105d7c <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80105cf1:	83 ec 08             	sub    $0x8,%esp
+80105cf4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80105cf7:	50                   	push   %eax
+80105cf8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80105cfb:	50                   	push   %eax
+80105cfc:	e8 2f d8 ff ff       	call   80103530 <pipealloc>
+80105d01:	83 c4 10             	add    $0x10,%esp
+80105d04:	85 c0                	test   %eax,%eax
+80105d06:	78 74                	js     80105d7c <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80105d08:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+80105d0b:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+80105d0d:	e8 9e dc ff ff       	call   801039b0 <myproc>
+    if(curproc->ofile[fd] == 0){
+80105d12:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+80105d16:	85 f6                	test   %esi,%esi
+80105d18:	74 16                	je     80105d30 <sys_pipe+0x60>
+80105d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80105d20:	83 c3 01             	add    $0x1,%ebx
+80105d23:	83 fb 10             	cmp    $0x10,%ebx
+80105d26:	74 3d                	je     80105d65 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80105d28:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+80105d2c:	85 f6                	test   %esi,%esi
+80105d2e:	75 f0                	jne    80105d20 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80105d30:	8d 73 08             	lea    0x8(%ebx),%esi
+80105d33:	89 7c b0 08          	mov    %edi,0x8(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80105d37:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+80105d3a:	e8 71 dc ff ff       	call   801039b0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80105d3f:	31 d2                	xor    %edx,%edx
+80105d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80105d48:	8b 4c 90 28          	mov    0x28(%eax,%edx,4),%ecx
+80105d4c:	85 c9                	test   %ecx,%ecx
+80105d4e:	74 38                	je     80105d88 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80105d50:	83 c2 01             	add    $0x1,%edx
+80105d53:	83 fa 10             	cmp    $0x10,%edx
+80105d56:	75 f0                	jne    80105d48 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80105d58:	e8 53 dc ff ff       	call   801039b0 <myproc>
+80105d5d:	c7 44 b0 08 00 00 00 	movl   $0x0,0x8(%eax,%esi,4)
+80105d64:	00 
+    fileclose(rf);
+80105d65:	83 ec 0c             	sub    $0xc,%esp
+80105d68:	ff 75 e0             	push   -0x20(%ebp)
+80105d6b:	e8 60 b2 ff ff       	call   80100fd0 <fileclose>
+    fileclose(wf);
+80105d70:	58                   	pop    %eax
+80105d71:	ff 75 e4             	push   -0x1c(%ebp)
+80105d74:	e8 57 b2 ff ff       	call   80100fd0 <fileclose>
+    return -1;
+80105d79:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80105d7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105d81:	eb 16                	jmp    80105d99 <sys_pipe+0xc9>
+80105d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105d87:	90                   	nop
+      curproc->ofile[fd] = f;
+80105d88:	89 7c 90 28          	mov    %edi,0x28(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+80105d8c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80105d8f:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+80105d91:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80105d94:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+80105d97:	31 c0                	xor    %eax,%eax
+}
+80105d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105d9c:	5b                   	pop    %ebx
+80105d9d:	5e                   	pop    %esi
+80105d9e:	5f                   	pop    %edi
+80105d9f:	5d                   	pop    %ebp
+80105da0:	c3                   	ret
+80105da1:	66 90                	xchg   %ax,%ax
+80105da3:	66 90                	xchg   %ax,%ax
+80105da5:	66 90                	xchg   %ax,%ax
+80105da7:	66 90                	xchg   %ax,%ax
+80105da9:	66 90                	xchg   %ax,%ax
+80105dab:	66 90                	xchg   %ax,%ax
+80105dad:	66 90                	xchg   %ax,%ax
+80105daf:	90                   	nop
+
+80105db0 <sys_fork>:
+#include "proc.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+80105db0:	e9 5b e1 ff ff       	jmp    80103f10 <fork>
+80105db5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105dc0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80105dc0:	55                   	push   %ebp
+80105dc1:	89 e5                	mov    %esp,%ebp
+80105dc3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80105dc6:	e8 25 e7 ff ff       	call   801044f0 <exit>
+  return 0;  // not reached
+}
+80105dcb:	31 c0                	xor    %eax,%eax
+80105dcd:	c9                   	leave
+80105dce:	c3                   	ret
+80105dcf:	90                   	nop
+
+80105dd0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80105dd0:	e9 0b e4 ff ff       	jmp    801041e0 <wait>
+80105dd5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105de0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80105de0:	55                   	push   %ebp
+80105de1:	89 e5                	mov    %esp,%ebp
+80105de3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80105de6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105de9:	50                   	push   %eax
+80105dea:	6a 00                	push   $0x0
+80105dec:	e8 7f f1 ff ff       	call   80104f70 <argint>
+80105df1:	83 c4 10             	add    $0x10,%esp
+80105df4:	85 c0                	test   %eax,%eax
+80105df6:	78 18                	js     80105e10 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80105df8:	83 ec 0c             	sub    $0xc,%esp
+80105dfb:	ff 75 f4             	push   -0xc(%ebp)
+80105dfe:	e8 fd e7 ff ff       	call   80104600 <kill>
+80105e03:	83 c4 10             	add    $0x10,%esp
+}
+80105e06:	c9                   	leave
+80105e07:	c3                   	ret
+80105e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e0f:	90                   	nop
+80105e10:	c9                   	leave
+    return -1;
+80105e11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105e16:	c3                   	ret
+80105e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e1e:	66 90                	xchg   %ax,%ax
+
+80105e20 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80105e20:	55                   	push   %ebp
+80105e21:	89 e5                	mov    %esp,%ebp
+80105e23:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80105e26:	e8 85 db ff ff       	call   801039b0 <myproc>
+80105e2b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80105e2e:	c9                   	leave
+80105e2f:	c3                   	ret
+
+80105e30 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80105e30:	55                   	push   %ebp
+80105e31:	89 e5                	mov    %esp,%ebp
+80105e33:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80105e34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80105e37:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80105e3a:	50                   	push   %eax
+80105e3b:	6a 00                	push   $0x0
+80105e3d:	e8 2e f1 ff ff       	call   80104f70 <argint>
+80105e42:	83 c4 10             	add    $0x10,%esp
+80105e45:	85 c0                	test   %eax,%eax
+80105e47:	78 27                	js     80105e70 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80105e49:	e8 62 db ff ff       	call   801039b0 <myproc>
+  if(growproc(n) < 0)
+80105e4e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80105e51:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80105e53:	ff 75 f4             	push   -0xc(%ebp)
+80105e56:	e8 95 df ff ff       	call   80103df0 <growproc>
+80105e5b:	83 c4 10             	add    $0x10,%esp
+80105e5e:	85 c0                	test   %eax,%eax
+80105e60:	78 0e                	js     80105e70 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80105e62:	89 d8                	mov    %ebx,%eax
+80105e64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105e67:	c9                   	leave
+80105e68:	c3                   	ret
+80105e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80105e70:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80105e75:	eb eb                	jmp    80105e62 <sys_sbrk+0x32>
+80105e77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e7e:	66 90                	xchg   %ax,%ax
+
+80105e80 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80105e80:	55                   	push   %ebp
+80105e81:	89 e5                	mov    %esp,%ebp
+80105e83:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80105e84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80105e87:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80105e8a:	50                   	push   %eax
+80105e8b:	6a 00                	push   $0x0
+80105e8d:	e8 de f0 ff ff       	call   80104f70 <argint>
+80105e92:	83 c4 10             	add    $0x10,%esp
+80105e95:	85 c0                	test   %eax,%eax
+80105e97:	78 64                	js     80105efd <sys_sleep+0x7d>
+    return -1;
+  acquire(&tickslock);
+80105e99:	83 ec 0c             	sub    $0xc,%esp
+80105e9c:	68 a0 79 11 80       	push   $0x801179a0
+80105ea1:	e8 3a ed ff ff       	call   80104be0 <acquire>
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+80105ea6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  ticks0 = ticks;
+80105ea9:	8b 1d 80 79 11 80    	mov    0x80117980,%ebx
+  while(ticks - ticks0 < n){
+80105eaf:	83 c4 10             	add    $0x10,%esp
+80105eb2:	85 d2                	test   %edx,%edx
+80105eb4:	75 2b                	jne    80105ee1 <sys_sleep+0x61>
+80105eb6:	eb 58                	jmp    80105f10 <sys_sleep+0x90>
+80105eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ebf:	90                   	nop
+    if(myproc()->killed){
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80105ec0:	83 ec 08             	sub    $0x8,%esp
+80105ec3:	68 a0 79 11 80       	push   $0x801179a0
+80105ec8:	68 80 79 11 80       	push   $0x80117980
+80105ecd:	e8 1e e5 ff ff       	call   801043f0 <sleep>
+  while(ticks - ticks0 < n){
+80105ed2:	a1 80 79 11 80       	mov    0x80117980,%eax
+80105ed7:	83 c4 10             	add    $0x10,%esp
+80105eda:	29 d8                	sub    %ebx,%eax
+80105edc:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80105edf:	73 2f                	jae    80105f10 <sys_sleep+0x90>
+    if(myproc()->killed){
+80105ee1:	e8 ca da ff ff       	call   801039b0 <myproc>
+80105ee6:	8b 40 24             	mov    0x24(%eax),%eax
+80105ee9:	85 c0                	test   %eax,%eax
+80105eeb:	74 d3                	je     80105ec0 <sys_sleep+0x40>
+      release(&tickslock);
+80105eed:	83 ec 0c             	sub    $0xc,%esp
+80105ef0:	68 a0 79 11 80       	push   $0x801179a0
+80105ef5:	e8 86 ec ff ff       	call   80104b80 <release>
+      return -1;
+80105efa:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&tickslock);
+  return 0;
+}
+80105efd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80105f00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105f05:	c9                   	leave
+80105f06:	c3                   	ret
+80105f07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105f0e:	66 90                	xchg   %ax,%ax
+  release(&tickslock);
+80105f10:	83 ec 0c             	sub    $0xc,%esp
+80105f13:	68 a0 79 11 80       	push   $0x801179a0
+80105f18:	e8 63 ec ff ff       	call   80104b80 <release>
+}
+80105f1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80105f20:	83 c4 10             	add    $0x10,%esp
+80105f23:	31 c0                	xor    %eax,%eax
+}
+80105f25:	c9                   	leave
+80105f26:	c3                   	ret
+80105f27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105f2e:	66 90                	xchg   %ax,%ax
+
+80105f30 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80105f30:	55                   	push   %ebp
+80105f31:	89 e5                	mov    %esp,%ebp
+80105f33:	53                   	push   %ebx
+80105f34:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80105f37:	68 a0 79 11 80       	push   $0x801179a0
+80105f3c:	e8 9f ec ff ff       	call   80104be0 <acquire>
+  xticks = ticks;
+80105f41:	8b 1d 80 79 11 80    	mov    0x80117980,%ebx
+  release(&tickslock);
+80105f47:	c7 04 24 a0 79 11 80 	movl   $0x801179a0,(%esp)
+80105f4e:	e8 2d ec ff ff       	call   80104b80 <release>
+  return xticks;
+}
+80105f53:	89 d8                	mov    %ebx,%eax
+80105f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105f58:	c9                   	leave
+80105f59:	c3                   	ret
+80105f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105f60 <sys_setmemorylimit>:
+
+int
+sys_setmemorylimit(void)
+{
+80105f60:	55                   	push   %ebp
+80105f61:	89 e5                	mov    %esp,%ebp
+80105f63:	83 ec 20             	sub    $0x20,%esp
+  int pid, limit;
+
+  if (argint(0, &pid) < 0 || argint(1, &limit) < 0)
+80105f66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105f69:	50                   	push   %eax
+80105f6a:	6a 00                	push   $0x0
+80105f6c:	e8 ff ef ff ff       	call   80104f70 <argint>
+80105f71:	83 c4 10             	add    $0x10,%esp
+80105f74:	85 c0                	test   %eax,%eax
+80105f76:	78 28                	js     80105fa0 <sys_setmemorylimit+0x40>
+80105f78:	83 ec 08             	sub    $0x8,%esp
+80105f7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105f7e:	50                   	push   %eax
+80105f7f:	6a 01                	push   $0x1
+80105f81:	e8 ea ef ff ff       	call   80104f70 <argint>
+80105f86:	83 c4 10             	add    $0x10,%esp
+80105f89:	85 c0                	test   %eax,%eax
+80105f8b:	78 13                	js     80105fa0 <sys_setmemorylimit+0x40>
+    return -1;
+
+  return setmemorylimit(pid, limit);
+80105f8d:	83 ec 08             	sub    $0x8,%esp
+80105f90:	ff 75 f4             	push   -0xc(%ebp)
+80105f93:	ff 75 f0             	push   -0x10(%ebp)
+80105f96:	e8 d5 e7 ff ff       	call   80104770 <setmemorylimit>
+80105f9b:	83 c4 10             	add    $0x10,%esp
+}
+80105f9e:	c9                   	leave
+80105f9f:	c3                   	ret
+80105fa0:	c9                   	leave
+    return -1;
+80105fa1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105fa6:	c3                   	ret
+80105fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105fae:	66 90                	xchg   %ax,%ax
+
+80105fb0 <sys_listproc>:
+
+int
+sys_listproc(void)
+{
+  return listproc();
+80105fb0:	e9 8b e8 ff ff       	jmp    80104840 <listproc>
+80105fb5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105fc0 <sys_thread_create>:
+}
+
+int
+sys_thread_create(void)
+{
+80105fc0:	55                   	push   %ebp
+80105fc1:	89 e5                	mov    %esp,%ebp
+80105fc3:	83 ec 1c             	sub    $0x1c,%esp
+  thread_t *thread;
+  void *(*start_routine)(void*);
+  void *arg;
+
+  argptr(0, (char**)&thread, sizeof(thread));
+80105fc6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80105fc9:	6a 04                	push   $0x4
+80105fcb:	50                   	push   %eax
+80105fcc:	6a 00                	push   $0x0
+80105fce:	e8 ed ef ff ff       	call   80104fc0 <argptr>
+  argptr(1, (char**)&start_routine, sizeof(start_routine));
+80105fd3:	83 c4 0c             	add    $0xc,%esp
+80105fd6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80105fd9:	6a 04                	push   $0x4
+80105fdb:	50                   	push   %eax
+80105fdc:	6a 01                	push   $0x1
+80105fde:	e8 dd ef ff ff       	call   80104fc0 <argptr>
+  argptr(2, (char**)&arg, sizeof(arg));
+80105fe3:	83 c4 0c             	add    $0xc,%esp
+80105fe6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80105fe9:	6a 04                	push   $0x4
+80105feb:	50                   	push   %eax
+80105fec:	6a 02                	push   $0x2
+80105fee:	e8 cd ef ff ff       	call   80104fc0 <argptr>
+
+  return thread_create(thread, start_routine, arg);
+80105ff3:	83 c4 0c             	add    $0xc,%esp
+80105ff6:	ff 75 f4             	push   -0xc(%ebp)
+80105ff9:	ff 75 f0             	push   -0x10(%ebp)
+80105ffc:	ff 75 ec             	push   -0x14(%ebp)
+80105fff:	e8 5c 00 00 00       	call   80106060 <thread_create>
+}
+80106004:	c9                   	leave
+80106005:	c3                   	ret
+80106006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010600d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106010 <sys_thread_join>:
+
+int
+sys_thread_join(void)
+{
+80106010:	55                   	push   %ebp
+80106011:	89 e5                	mov    %esp,%ebp
+80106013:	83 ec 20             	sub    $0x20,%esp
+  int thread;
+  void **retval;
+
+  argint(0, &thread);
+80106016:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80106019:	50                   	push   %eax
+8010601a:	6a 00                	push   $0x0
+8010601c:	e8 4f ef ff ff       	call   80104f70 <argint>
+  argptr(1, (char**)&retval, sizeof(retval));
+80106021:	83 c4 0c             	add    $0xc,%esp
+80106024:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106027:	6a 04                	push   $0x4
+80106029:	50                   	push   %eax
+8010602a:	6a 01                	push   $0x1
+8010602c:	e8 8f ef ff ff       	call   80104fc0 <argptr>
+
+  return thread_join((thread_t)thread, retval);
+80106031:	58                   	pop    %eax
+80106032:	5a                   	pop    %edx
+80106033:	ff 75 f4             	push   -0xc(%ebp)
+80106036:	ff 75 f0             	push   -0x10(%ebp)
+80106039:	e8 e2 03 00 00       	call   80106420 <thread_join>
+}
+8010603e:	c9                   	leave
+8010603f:	c3                   	ret
+
+80106040 <sys_thread_exit>:
+int
+sys_thread_exit(void)
+{
+80106040:	55                   	push   %ebp
+80106041:	89 e5                	mov    %esp,%ebp
+80106043:	83 ec 1c             	sub    $0x1c,%esp
+  void *retval;
+
+  argptr(0, (char**)&retval, sizeof(retval));
+80106046:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80106049:	6a 04                	push   $0x4
+8010604b:	50                   	push   %eax
+8010604c:	6a 00                	push   $0x0
+8010604e:	e8 6d ef ff ff       	call   80104fc0 <argptr>
+  thread_exit(retval);
+80106053:	58                   	pop    %eax
+80106054:	ff 75 f4             	push   -0xc(%ebp)
+80106057:	e8 84 02 00 00       	call   801062e0 <thread_exit>
+  return 0;
+8010605c:	31 c0                	xor    %eax,%eax
+8010605e:	c9                   	leave
+8010605f:	c3                   	ret
+
+80106060 <thread_create>:
+
+// Creates and update thread to tid(thread's id) having start_routine with arg.
+// Returns 0 for success, -1 for failure.
+int
+thread_create(thread_t *thread, void *(*start_routine)(void *), void *arg)
+{
+80106060:	55                   	push   %ebp
+80106061:	89 e5                	mov    %esp,%ebp
+80106063:	57                   	push   %edi
+80106064:	56                   	push   %esi
+80106065:	53                   	push   %ebx
+80106066:	83 ec 2c             	sub    $0x2c,%esp
+  struct proc* lwp;                     // current(will be created) thread
+  struct proc* mother = myproc();       // process that called thread_create
+80106069:	e8 42 d9 ff ff       	call   801039b0 <myproc>
+8010606e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+  // Allocate lwp and initiailize it
+  if ((lwp = allocproc()) == 0) {
+80106071:	e8 4a db ff ff       	call   80103bc0 <allocproc>
+80106076:	85 c0                	test   %eax,%eax
+80106078:	0f 84 53 02 00 00    	je     801062d1 <thread_create+0x271>
+  }
+  lwp->stackpage = 1;
+  lwp->isthread = 1;
+
+  // Share the same address space and parent process as the mother process
+  lwp->pgdir = mother->pgdir;
+8010607e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  lwp->stackpage = 1;
+80106081:	c7 40 7c 01 00 00 00 	movl   $0x1,0x7c(%eax)
+80106088:	89 c3                	mov    %eax,%ebx
+  lwp->mother = mother;
+  lwp->limit = mother->limit;
+  acquire(&ptable.lock);
+8010608a:	83 ec 0c             	sub    $0xc,%esp
+  lwp->isthread = 1;
+8010608d:	c7 80 88 00 00 00 01 	movl   $0x1,0x88(%eax)
+80106094:	00 00 00 
+  lwp->pgdir = mother->pgdir;
+80106097:	8b 42 04             	mov    0x4(%edx),%eax
+  lwp->mother = mother;
+8010609a:	89 93 94 00 00 00    	mov    %edx,0x94(%ebx)
+  lwp->pgdir = mother->pgdir;
+801060a0:	89 43 04             	mov    %eax,0x4(%ebx)
+  lwp->limit = mother->limit;
+801060a3:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+801060a9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  acquire(&ptable.lock);
+801060af:	68 40 2d 11 80       	push   $0x80112d40
+801060b4:	e8 27 eb ff ff       	call   80104be0 <acquire>
+  setparent(lwp, mother->parent);
+801060b9:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801060bc:	5f                   	pop    %edi
+801060bd:	58                   	pop    %eax
+801060be:	ff 72 14             	push   0x14(%edx)
+801060c1:	53                   	push   %ebx
+801060c2:	e8 19 d9 ff ff       	call   801039e0 <setparent>
+  setpid(lwp, mother->pid);
+801060c7:	58                   	pop    %eax
+801060c8:	5a                   	pop    %edx
+801060c9:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801060cc:	ff 72 10             	push   0x10(%edx)
+801060cf:	53                   	push   %ebx
+801060d0:	e8 3b da ff ff       	call   80103b10 <setpid>
+  release(&ptable.lock);
+801060d5:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+801060dc:	e8 9f ea ff ff       	call   80104b80 <release>
+
+  // Check if new size exceed memory limit
+  if (mother->limit && mother->sz + 2*PGSIZE > mother->limit) {
+801060e1:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801060e4:	83 c4 10             	add    $0x10,%esp
+801060e7:	8b 02                	mov    (%edx),%eax
+801060e9:	8b b2 80 00 00 00    	mov    0x80(%edx),%esi
+801060ef:	8d 88 00 20 00 00    	lea    0x2000(%eax),%ecx
+801060f5:	85 f6                	test   %esi,%esi
+801060f7:	74 08                	je     80106101 <thread_create+0xa1>
+801060f9:	39 ce                	cmp    %ecx,%esi
+801060fb:	0f 82 78 01 00 00    	jb     80106279 <thread_create+0x219>
+    cprintf("thread create error: memory limit exceeded!\n");
+    goto bad;
+  }
+
+  // Allocate pages for lwp and update its mother's size as well
+  if ((lwp->sz = mother->sz = allocuvm(lwp->pgdir, mother->sz, mother->sz + 2*PGSIZE)) == 0) {
+80106101:	83 ec 04             	sub    $0x4,%esp
+80106104:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80106107:	51                   	push   %ecx
+80106108:	50                   	push   %eax
+80106109:	ff 73 04             	push   0x4(%ebx)
+8010610c:	e8 df 18 00 00       	call   801079f0 <allocuvm>
+80106111:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80106114:	83 c4 10             	add    $0x10,%esp
+80106117:	89 02                	mov    %eax,(%edx)
+80106119:	89 55 d0             	mov    %edx,-0x30(%ebp)
+8010611c:	89 03                	mov    %eax,(%ebx)
+8010611e:	85 c0                	test   %eax,%eax
+80106120:	0f 84 63 01 00 00    	je     80106289 <thread_create+0x229>
+    goto bad;
+  }
+
+  // Build stack guard
+  clearpteu(lwp->pgdir, (char*)(lwp->sz - 2*PGSIZE));
+80106126:	83 ec 08             	sub    $0x8,%esp
+80106129:	2d 00 20 00 00       	sub    $0x2000,%eax
+8010612e:	50                   	push   %eax
+8010612f:	ff 73 04             	push   0x4(%ebx)
+80106132:	e8 29 1b 00 00       	call   80107c60 <clearpteu>
+
+  // Set up the LWP's stack
+  uint sp = lwp->sz;
+80106137:	8b 03                	mov    (%ebx),%eax
+  uint ustack[2];
+  ustack[1] = (uint)arg;
+80106139:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ustack[0] = 0xffffffff; // Placeholder for the return address
+8010613c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+
+  sp -= 2*sizeof(uint);
+80106143:	83 e8 08             	sub    $0x8,%eax
+  ustack[1] = (uint)arg;
+80106146:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  sp -= 2*sizeof(uint);
+80106149:	89 c7                	mov    %eax,%edi
+
+  // Allocate and copy the user stack
+  if (copyout(lwp->pgdir, sp, ustack, 2*sizeof(uint)) < 0) {
+8010614b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010614e:	6a 08                	push   $0x8
+80106150:	50                   	push   %eax
+80106151:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+80106154:	57                   	push   %edi
+80106155:	ff 73 04             	push   0x4(%ebx)
+80106158:	e8 d3 1c 00 00       	call   80107e30 <copyout>
+8010615d:	83 c4 20             	add    $0x20,%esp
+80106160:	85 c0                	test   %eax,%eax
+80106162:	0f 88 21 01 00 00    	js     80106289 <thread_create+0x229>
+    goto bad;
+  }
+
+  // Initialize the thread's trapframe
+  *lwp->tf = *mother->tf;
+80106168:	8b 55 d0             	mov    -0x30(%ebp),%edx
+8010616b:	8b 7b 18             	mov    0x18(%ebx),%edi
+8010616e:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106173:	8b 72 18             	mov    0x18(%edx),%esi
+80106176:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  lwp->tf->esp = sp;
+80106178:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  lwp->tf->eip = (uint)start_routine;
+8010617b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  lwp->tf->eax = 0;
+
+  // Copy file descriptor from mother
+  for(int i=0;i<NOFILE;i++)
+8010617e:	31 f6                	xor    %esi,%esi
+  lwp->tf->esp = sp;
+80106180:	8b 43 18             	mov    0x18(%ebx),%eax
+80106183:	89 78 44             	mov    %edi,0x44(%eax)
+  lwp->tf->eip = (uint)start_routine;
+80106186:	8b 43 18             	mov    0x18(%ebx),%eax
+  for(int i=0;i<NOFILE;i++)
+80106189:	89 d7                	mov    %edx,%edi
+  lwp->tf->eip = (uint)start_routine;
+8010618b:	89 48 38             	mov    %ecx,0x38(%eax)
+  lwp->tf->eax = 0;
+8010618e:	8b 43 18             	mov    0x18(%ebx),%eax
+80106191:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(int i=0;i<NOFILE;i++)
+80106198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010619f:	90                   	nop
+    if(mother->ofile[i])
+801061a0:	8b 44 b7 28          	mov    0x28(%edi,%esi,4),%eax
+801061a4:	85 c0                	test   %eax,%eax
+801061a6:	74 10                	je     801061b8 <thread_create+0x158>
+      lwp->ofile[i]=filedup(mother->ofile[i]);
+801061a8:	83 ec 0c             	sub    $0xc,%esp
+801061ab:	50                   	push   %eax
+801061ac:	e8 cf ad ff ff       	call   80100f80 <filedup>
+801061b1:	83 c4 10             	add    $0x10,%esp
+801061b4:	89 44 b3 28          	mov    %eax,0x28(%ebx,%esi,4)
+  for(int i=0;i<NOFILE;i++)
+801061b8:	83 c6 01             	add    $0x1,%esi
+801061bb:	83 fe 10             	cmp    $0x10,%esi
+801061be:	75 e0                	jne    801061a0 <thread_create+0x140>
+  lwp->cwd=idup(mother->cwd);
+801061c0:	83 ec 0c             	sub    $0xc,%esp
+801061c3:	ff 77 68             	push   0x68(%edi)
+801061c6:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+801061c9:	e8 62 b6 ff ff       	call   80101830 <idup>
+
+  // Copy name of mother process to thread
+  safestrcpy(lwp->name,mother->name,sizeof(mother->name));
+801061ce:	83 c4 0c             	add    $0xc,%esp
+  lwp->cwd=idup(mother->cwd);
+801061d1:	89 43 68             	mov    %eax,0x68(%ebx)
+  safestrcpy(lwp->name,mother->name,sizeof(mother->name));
+801061d4:	6a 10                	push   $0x10
+801061d6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801061d9:	8d 42 6c             	lea    0x6c(%edx),%eax
+801061dc:	50                   	push   %eax
+801061dd:	8d 43 6c             	lea    0x6c(%ebx),%eax
+801061e0:	50                   	push   %eax
+801061e1:	e8 8a ec ff ff       	call   80104e70 <safestrcpy>
+
+  // Set the thread ID
+  *thread = lwp->tid = (mother->nexttid++) % NPROC;
+801061e6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801061e9:	83 c4 10             	add    $0x10,%esp
+801061ec:	8b 82 90 00 00 00    	mov    0x90(%edx),%eax
+801061f2:	8d 48 01             	lea    0x1(%eax),%ecx
+801061f5:	83 e0 3f             	and    $0x3f,%eax
+801061f8:	89 8a 90 00 00 00    	mov    %ecx,0x90(%edx)
+801061fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80106201:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+80106207:	89 01                	mov    %eax,(%ecx)
+  mother->thread_num++;
+80106209:	83 82 84 00 00 00 01 	addl   $0x1,0x84(%edx)
+
+  // Add the LWP to the mother's thread array
+  mother->threads[lwp->tid] = lwp;
+80106210:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80106216:	89 9c 82 98 00 00 00 	mov    %ebx,0x98(%edx,%eax,4)
+
+  // Set sibling thread's size equal as current thread(lwp)
+  for (int i = 0; i < NTHREAD; i++) {
+8010621d:	8d 82 98 00 00 00    	lea    0x98(%edx),%eax
+80106223:	81 c2 18 01 00 00    	add    $0x118,%edx
+80106229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (mother->threads[i]) {
+80106230:	8b 08                	mov    (%eax),%ecx
+80106232:	85 c9                	test   %ecx,%ecx
+80106234:	74 04                	je     8010623a <thread_create+0x1da>
+      mother->threads[i]->sz = lwp->sz;
+80106236:	8b 33                	mov    (%ebx),%esi
+80106238:	89 31                	mov    %esi,(%ecx)
+  for (int i = 0; i < NTHREAD; i++) {
+8010623a:	83 c0 04             	add    $0x4,%eax
+8010623d:	39 d0                	cmp    %edx,%eax
+8010623f:	75 ef                	jne    80106230 <thread_create+0x1d0>
+    }
+  }
+
+  // Mark the LWP as runnable
+  acquire(&ptable.lock);
+80106241:	83 ec 0c             	sub    $0xc,%esp
+80106244:	68 40 2d 11 80       	push   $0x80112d40
+80106249:	e8 92 e9 ff ff       	call   80104be0 <acquire>
+  lcr3(V2P(lwp->pgdir));  // switch to process's address space
+8010624e:	8b 43 04             	mov    0x4(%ebx),%eax
+80106251:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80106256:	0f 22 d8             	mov    %eax,%cr3
+  lwp->state = RUNNABLE;
+80106259:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  release(&ptable.lock);
+80106260:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80106267:	e8 14 e9 ff ff       	call   80104b80 <release>
+
+  return 0; // Thread creation successful
+8010626c:	83 c4 10             	add    $0x10,%esp
+8010626f:	31 c0                	xor    %eax,%eax
+  setpid(lwp, 0);
+  setparent(lwp, 0);
+  lwp->state = UNUSED;
+  release(&ptable.lock);
+  return -1;
+}
+80106271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106274:	5b                   	pop    %ebx
+80106275:	5e                   	pop    %esi
+80106276:	5f                   	pop    %edi
+80106277:	5d                   	pop    %ebp
+80106278:	c3                   	ret
+    cprintf("thread create error: memory limit exceeded!\n");
+80106279:	83 ec 0c             	sub    $0xc,%esp
+8010627c:	68 34 87 10 80       	push   $0x80108734
+80106281:	e8 2a a4 ff ff       	call   801006b0 <cprintf>
+    goto bad;
+80106286:	83 c4 10             	add    $0x10,%esp
+  kfree(lwp->kstack);
+80106289:	83 ec 0c             	sub    $0xc,%esp
+8010628c:	ff 73 08             	push   0x8(%ebx)
+8010628f:	e8 1c c3 ff ff       	call   801025b0 <kfree>
+  lwp->kstack = 0;
+80106294:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  acquire(&ptable.lock);
+8010629b:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+801062a2:	e8 39 e9 ff ff       	call   80104be0 <acquire>
+  setpid(lwp, 0);
+801062a7:	58                   	pop    %eax
+801062a8:	5a                   	pop    %edx
+801062a9:	6a 00                	push   $0x0
+801062ab:	53                   	push   %ebx
+801062ac:	e8 5f d8 ff ff       	call   80103b10 <setpid>
+  setparent(lwp, 0);
+801062b1:	59                   	pop    %ecx
+801062b2:	5e                   	pop    %esi
+801062b3:	6a 00                	push   $0x0
+801062b5:	53                   	push   %ebx
+801062b6:	e8 25 d7 ff ff       	call   801039e0 <setparent>
+  lwp->state = UNUSED;
+801062bb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  release(&ptable.lock);
+801062c2:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+801062c9:	e8 b2 e8 ff ff       	call   80104b80 <release>
+  return -1;
+801062ce:	83 c4 10             	add    $0x10,%esp
+    return -1; // Failed to allocate a new LWP
+801062d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801062d6:	eb 99                	jmp    80106271 <thread_create+0x211>
+801062d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801062df:	90                   	nop
+
+801062e0 <thread_exit>:
+}
+
+
+// Exit thread and set return value of thread to retval.
+// Never returns.
+void thread_exit(void* retval) {
+801062e0:	55                   	push   %ebp
+801062e1:	89 e5                	mov    %esp,%ebp
+801062e3:	57                   	push   %edi
+801062e4:	56                   	push   %esi
+801062e5:	53                   	push   %ebx
+801062e6:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc* lwp = myproc();
+801062e9:	e8 c2 d6 ff ff       	call   801039b0 <myproc>
+801062ee:	89 c6                	mov    %eax,%esi
+  struct proc* mother = lwp->mother;
+801062f0:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+801062f6:	8d 7e 28             	lea    0x28(%esi),%edi
+801062f9:	8d 5e 68             	lea    0x68(%esi),%ebx
+801062fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd;
+
+  // Close all open files.
+  for(fd = 0; fd < NOFILE; fd++){
+801062ff:	90                   	nop
+    if(lwp->ofile[fd]){
+80106300:	8b 17                	mov    (%edi),%edx
+80106302:	85 d2                	test   %edx,%edx
+80106304:	74 12                	je     80106318 <thread_exit+0x38>
+      fileclose(lwp->ofile[fd]);
+80106306:	83 ec 0c             	sub    $0xc,%esp
+80106309:	52                   	push   %edx
+8010630a:	e8 c1 ac ff ff       	call   80100fd0 <fileclose>
+      lwp->ofile[fd] = 0;
+8010630f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80106315:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80106318:	83 c7 04             	add    $0x4,%edi
+8010631b:	39 df                	cmp    %ebx,%edi
+8010631d:	75 e1                	jne    80106300 <thread_exit+0x20>
+    }
+  }
+
+  // Release lwp's working directory
+  begin_op();
+8010631f:	e8 3c cb ff ff       	call   80102e60 <begin_op>
+  iput(lwp->cwd);
+80106324:	83 ec 0c             	sub    $0xc,%esp
+80106327:	ff 76 68             	push   0x68(%esi)
+8010632a:	e8 61 b6 ff ff       	call   80101990 <iput>
+  end_op();
+8010632f:	e8 9c cb ff ff       	call   80102ed0 <end_op>
+  lwp->cwd = 0;
+80106334:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+
+  acquire(&ptable.lock);
+8010633b:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+80106342:	e8 99 e8 ff ff       	call   80104be0 <acquire>
+
+  lwp->retval = retval;         // Set the return value in the current lwp
+80106347:	8b 45 08             	mov    0x8(%ebp),%eax
+8010634a:	89 86 18 01 00 00    	mov    %eax,0x118(%esi)
+  lwp->mother->thread_num--;    // Decrease number of thread of mother proc
+80106350:	8b 86 94 00 00 00    	mov    0x94(%esi),%eax
+80106356:	83 a8 84 00 00 00 01 	subl   $0x1,0x84(%eax)
+
+  // Wake up the mother proc waiting in thread_join
+  wakeup1(mother);
+8010635d:	58                   	pop    %eax
+8010635e:	ff 75 e4             	push   -0x1c(%ebp)
+80106361:	e8 4a e1 ff ff       	call   801044b0 <wakeup1>
+
+  // Adopt abandoned processes
+  reparent(lwp);
+80106366:	89 34 24             	mov    %esi,(%esp)
+80106369:	e8 e2 d6 ff ff       	call   80103a50 <reparent>
+
+  lwp->state = ZOMBIE;
+8010636e:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+
+  // Keep holding ptable.lock before jumping into the scheduler
+  // Jump into the scheduler, never to return
+  sched();
+80106375:	e8 a6 dd ff ff       	call   80104120 <sched>
+  panic("zombie exit");
+8010637a:	c7 04 24 1f 85 10 80 	movl   $0x8010851f,(%esp)
+80106381:	e8 fa 9f ff ff       	call   80100380 <panic>
+80106386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010638d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106390 <_cleanup>:
+
+// Cleanup function for internal use. 
+// Only works when victim != myproc()
+void
+_cleanup(struct proc *victim)
+{
+80106390:	55                   	push   %ebp
+80106391:	89 e5                	mov    %esp,%ebp
+80106393:	53                   	push   %ebx
+80106394:	83 ec 04             	sub    $0x4,%esp
+80106397:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!victim) return;
+8010639a:	85 db                	test   %ebx,%ebx
+8010639c:	74 6f                	je     8010640d <_cleanup+0x7d>
+
+  if (victim->kstack)
+8010639e:	8b 43 08             	mov    0x8(%ebx),%eax
+801063a1:	85 c0                	test   %eax,%eax
+801063a3:	74 0c                	je     801063b1 <_cleanup+0x21>
+    kfree(victim->kstack);
+801063a5:	83 ec 0c             	sub    $0xc,%esp
+801063a8:	50                   	push   %eax
+801063a9:	e8 02 c2 ff ff       	call   801025b0 <kfree>
+801063ae:	83 c4 10             	add    $0x10,%esp
+  victim->kstack = 0;
+  setpid(victim, 0);
+801063b1:	83 ec 08             	sub    $0x8,%esp
+  victim->kstack = 0;
+801063b4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  setpid(victim, 0);
+801063bb:	6a 00                	push   $0x0
+801063bd:	53                   	push   %ebx
+801063be:	e8 4d d7 ff ff       	call   80103b10 <setpid>
+  setparent(victim, 0);
+801063c3:	58                   	pop    %eax
+801063c4:	5a                   	pop    %edx
+801063c5:	6a 00                	push   $0x0
+801063c7:	53                   	push   %ebx
+801063c8:	e8 13 d6 ff ff       	call   801039e0 <setparent>
+  victim->mother = 0;
+  victim->isthread = 0;
+  victim->tid = 0;
+  victim->name[0] = 0;
+801063cd:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+  victim->killed = 0;
+  victim->tf = 0;
+  victim->sz = 0;
+  victim->state = UNUSED;
+801063d1:	83 c4 10             	add    $0x10,%esp
+  victim->mother = 0;
+801063d4:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+801063db:	00 00 00 
+  victim->isthread = 0;
+801063de:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+801063e5:	00 00 00 
+  victim->tid = 0;
+801063e8:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+801063ef:	00 00 00 
+  victim->killed = 0;
+801063f2:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+  victim->tf = 0;
+801063f9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  victim->sz = 0;
+80106400:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  victim->state = UNUSED;
+80106406:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+8010640d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106410:	c9                   	leave
+80106411:	c3                   	ret
+80106412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106420 <thread_join>:
+{
+80106420:	55                   	push   %ebp
+80106421:	89 e5                	mov    %esp,%ebp
+80106423:	56                   	push   %esi
+80106424:	53                   	push   %ebx
+80106425:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc* curproc = myproc();
+80106428:	e8 83 d5 ff ff       	call   801039b0 <myproc>
+  acquire(&ptable.lock);
+8010642d:	83 ec 0c             	sub    $0xc,%esp
+80106430:	68 40 2d 11 80       	push   $0x80112d40
+  struct proc* curproc = myproc();
+80106435:	89 c6                	mov    %eax,%esi
+  acquire(&ptable.lock);
+80106437:	e8 a4 e7 ff ff       	call   80104be0 <acquire>
+  if (thread >= NTHREAD || curproc->threads[thread] == 0) {
+8010643c:	83 c4 10             	add    $0x10,%esp
+8010643f:	83 fb 1f             	cmp    $0x1f,%ebx
+80106442:	77 6e                	ja     801064b2 <thread_join+0x92>
+80106444:	8b 9c 9e 98 00 00 00 	mov    0x98(%esi,%ebx,4),%ebx
+8010644b:	85 db                	test   %ebx,%ebx
+8010644d:	75 1a                	jne    80106469 <thread_join+0x49>
+8010644f:	eb 61                	jmp    801064b2 <thread_join+0x92>
+80106451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(curproc, &ptable.lock);
+80106458:	83 ec 08             	sub    $0x8,%esp
+8010645b:	68 40 2d 11 80       	push   $0x80112d40
+80106460:	56                   	push   %esi
+80106461:	e8 8a df ff ff       	call   801043f0 <sleep>
+  while (lwp->state != ZOMBIE) {
+80106466:	83 c4 10             	add    $0x10,%esp
+80106469:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+8010646d:	75 e9                	jne    80106458 <thread_join+0x38>
+  *retval = lwp->retval;
+8010646f:	8b 93 18 01 00 00    	mov    0x118(%ebx),%edx
+80106475:	8b 45 0c             	mov    0xc(%ebp),%eax
+  _cleanup(lwp);
+80106478:	83 ec 0c             	sub    $0xc,%esp
+  *retval = lwp->retval;
+8010647b:	89 10                	mov    %edx,(%eax)
+  lwp->mother->threads[lwp->tid] = 0;
+8010647d:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80106483:	8b 93 8c 00 00 00    	mov    0x8c(%ebx),%edx
+80106489:	c7 84 90 98 00 00 00 	movl   $0x0,0x98(%eax,%edx,4)
+80106490:	00 00 00 00 
+  _cleanup(lwp);
+80106494:	53                   	push   %ebx
+80106495:	e8 f6 fe ff ff       	call   80106390 <_cleanup>
+  release(&ptable.lock);
+8010649a:	c7 04 24 40 2d 11 80 	movl   $0x80112d40,(%esp)
+801064a1:	e8 da e6 ff ff       	call   80104b80 <release>
+  return 0; // Thread join successful
+801064a6:	83 c4 10             	add    $0x10,%esp
+801064a9:	31 c0                	xor    %eax,%eax
+}
+801064ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801064ae:	5b                   	pop    %ebx
+801064af:	5e                   	pop    %esi
+801064b0:	5d                   	pop    %ebp
+801064b1:	c3                   	ret
+    release(&ptable.lock);
+801064b2:	83 ec 0c             	sub    $0xc,%esp
+801064b5:	68 40 2d 11 80       	push   $0x80112d40
+801064ba:	e8 c1 e6 ff ff       	call   80104b80 <release>
+    return -1; // Invalid thread ID or thread does not exist
+801064bf:	83 c4 10             	add    $0x10,%esp
+801064c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801064c7:	eb e2                	jmp    801064ab <thread_join+0x8b>
+801064c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801064d0 <clean_thread>:
+
+// Clean all sibling thread except self. 
+// If there's mother thread, cleanup as well.
+int
+clean_thread(struct proc* curproc)
+{
+801064d0:	55                   	push   %ebp
+801064d1:	89 e5                	mov    %esp,%ebp
+801064d3:	57                   	push   %edi
+801064d4:	56                   	push   %esi
+801064d5:	53                   	push   %ebx
+801064d6:	83 ec 18             	sub    $0x18,%esp
+  acquire(&ptable.lock);
+801064d9:	68 40 2d 11 80       	push   $0x80112d40
+801064de:	e8 fd e6 ff ff       	call   80104be0 <acquire>
+  struct proc *mother;
+  struct proc *sibling;
+
+  mother = (curproc->isthread) ? curproc->mother : curproc;
+801064e3:	8b 75 08             	mov    0x8(%ebp),%esi
+801064e6:	83 c4 10             	add    $0x10,%esp
+801064e9:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+801064ef:	85 c0                	test   %eax,%eax
+801064f1:	74 06                	je     801064f9 <clean_thread+0x29>
+801064f3:	8b b6 94 00 00 00    	mov    0x94(%esi),%esi
+
+  // Cleanup siblings
+  for (int i = 0; i < NTHREAD; i++) {
+801064f9:	8d 9e 98 00 00 00    	lea    0x98(%esi),%ebx
+801064ff:	8d be 18 01 00 00    	lea    0x118(%esi),%edi
+80106505:	eb 29                	jmp    80106530 <clean_thread+0x60>
+80106507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010650e:	66 90                	xchg   %ax,%ax
+      mother->thread_num--;    // Decrese threadnum even for current thread
+      continue;
+    }
+
+    // found scapegoat sibling
+    _cleanup(sibling);
+80106510:	83 ec 0c             	sub    $0xc,%esp
+80106513:	50                   	push   %eax
+80106514:	e8 77 fe ff ff       	call   80106390 <_cleanup>
+    mother->threads[i] = 0;
+80106519:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    mother->thread_num--;
+8010651f:	83 c4 10             	add    $0x10,%esp
+80106522:	83 ae 84 00 00 00 01 	subl   $0x1,0x84(%esi)
+  for (int i = 0; i < NTHREAD; i++) {
+80106529:	83 c3 04             	add    $0x4,%ebx
+8010652c:	39 fb                	cmp    %edi,%ebx
+8010652e:	74 28                	je     80106558 <clean_thread+0x88>
+    if (mother->thread_num == 0)
+80106530:	8b 8e 84 00 00 00    	mov    0x84(%esi),%ecx
+    sibling = mother->threads[i];
+80106536:	8b 03                	mov    (%ebx),%eax
+    if (mother->thread_num == 0)
+80106538:	85 c9                	test   %ecx,%ecx
+8010653a:	74 1c                	je     80106558 <clean_thread+0x88>
+    if (!sibling) 
+8010653c:	85 c0                	test   %eax,%eax
+8010653e:	74 e9                	je     80106529 <clean_thread+0x59>
+    if (sibling == curproc) {
+80106540:	39 45 08             	cmp    %eax,0x8(%ebp)
+80106543:	75 cb                	jne    80106510 <clean_thread+0x40>
+      mother->thread_num--;    // Decrese threadnum even for current thread
+80106545:	83 e9 01             	sub    $0x1,%ecx
+  for (int i = 0; i < NTHREAD; i++) {
+80106548:	83 c3 04             	add    $0x4,%ebx
+      mother->thread_num--;    // Decrese threadnum even for current thread
+8010654b:	89 8e 84 00 00 00    	mov    %ecx,0x84(%esi)
+  for (int i = 0; i < NTHREAD; i++) {
+80106551:	39 fb                	cmp    %edi,%ebx
+80106553:	75 db                	jne    80106530 <clean_thread+0x60>
+80106555:	8d 76 00             	lea    0x0(%esi),%esi
+  }
+
+  // If current process is not mother process, then cleanup mother as well
+  if (curproc != mother) {
+80106558:	3b 75 08             	cmp    0x8(%ebp),%esi
+8010655b:	74 26                	je     80106583 <clean_thread+0xb3>
+    setparent(curproc, mother->parent);
+8010655d:	83 ec 08             	sub    $0x8,%esp
+80106560:	ff 76 14             	push   0x14(%esi)
+80106563:	ff 75 08             	push   0x8(%ebp)
+80106566:	e8 75 d4 ff ff       	call   801039e0 <setparent>
+    curproc->mother = 0;
+8010656b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010656e:	c7 80 94 00 00 00 00 	movl   $0x0,0x94(%eax)
+80106575:	00 00 00 
+    _cleanup(mother);
+80106578:	89 34 24             	mov    %esi,(%esp)
+8010657b:	e8 10 fe ff ff       	call   80106390 <_cleanup>
+80106580:	83 c4 10             	add    $0x10,%esp
+  }
+
+  release(&ptable.lock);
+80106583:	83 ec 0c             	sub    $0xc,%esp
+80106586:	68 40 2d 11 80       	push   $0x80112d40
+8010658b:	e8 f0 e5 ff ff       	call   80104b80 <release>
+  return 0;
+80106590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106593:	31 c0                	xor    %eax,%eax
+80106595:	5b                   	pop    %ebx
+80106596:	5e                   	pop    %esi
+80106597:	5f                   	pop    %edi
+80106598:	5d                   	pop    %ebp
+80106599:	c3                   	ret
+
+8010659a <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+8010659a:	1e                   	push   %ds
+  pushl %es
+8010659b:	06                   	push   %es
+  pushl %fs
+8010659c:	0f a0                	push   %fs
+  pushl %gs
+8010659e:	0f a8                	push   %gs
+  pushal
+801065a0:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+801065a1:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801065a5:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+801065a7:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+801065a9:	54                   	push   %esp
+  call trap
+801065aa:	e8 c1 00 00 00       	call   80106670 <trap>
+  addl $4, %esp
+801065af:	83 c4 04             	add    $0x4,%esp
+
+801065b2 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+801065b2:	61                   	popa
+  popl %gs
+801065b3:	0f a9                	pop    %gs
+  popl %fs
+801065b5:	0f a1                	pop    %fs
+  popl %es
+801065b7:	07                   	pop    %es
+  popl %ds
+801065b8:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801065b9:	83 c4 08             	add    $0x8,%esp
+  iret
+801065bc:	cf                   	iret
+801065bd:	66 90                	xchg   %ax,%ax
+801065bf:	90                   	nop
+
+801065c0 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+801065c0:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+801065c1:	31 c0                	xor    %eax,%eax
+{
+801065c3:	89 e5                	mov    %esp,%ebp
+801065c5:	83 ec 08             	sub    $0x8,%esp
+801065c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065cf:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+801065d0:	8b 14 85 08 b0 10 80 	mov    -0x7fef4ff8(,%eax,4),%edx
+801065d7:	c7 04 c5 e2 79 11 80 	movl   $0x8e000008,-0x7fee861e(,%eax,8)
+801065de:	08 00 00 8e 
+801065e2:	66 89 14 c5 e0 79 11 	mov    %dx,-0x7fee8620(,%eax,8)
+801065e9:	80 
+801065ea:	c1 ea 10             	shr    $0x10,%edx
+801065ed:	66 89 14 c5 e6 79 11 	mov    %dx,-0x7fee861a(,%eax,8)
+801065f4:	80 
+  for(i = 0; i < 256; i++)
+801065f5:	83 c0 01             	add    $0x1,%eax
+801065f8:	3d 00 01 00 00       	cmp    $0x100,%eax
+801065fd:	75 d1                	jne    801065d0 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801065ff:	a1 08 b1 10 80       	mov    0x8010b108,%eax
+
+  initlock(&tickslock, "time");
+80106604:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80106607:	c7 05 e2 7b 11 80 08 	movl   $0xef000008,0x80117be2
+8010660e:	00 00 ef 
+80106611:	66 a3 e0 7b 11 80    	mov    %ax,0x80117be0
+80106617:	c1 e8 10             	shr    $0x10,%eax
+8010661a:	66 a3 e6 7b 11 80    	mov    %ax,0x80117be6
+  initlock(&tickslock, "time");
+80106620:	68 61 87 10 80       	push   $0x80108761
+80106625:	68 a0 79 11 80       	push   $0x801179a0
+8010662a:	e8 d1 e3 ff ff       	call   80104a00 <initlock>
+}
+8010662f:	83 c4 10             	add    $0x10,%esp
+80106632:	c9                   	leave
+80106633:	c3                   	ret
+80106634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010663b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010663f:	90                   	nop
+
+80106640 <idtinit>:
+
+void
+idtinit(void)
+{
+80106640:	55                   	push   %ebp
+  pd[0] = size-1;
+80106641:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80106646:	89 e5                	mov    %esp,%ebp
+80106648:	83 ec 10             	sub    $0x10,%esp
+8010664b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010664f:	b8 e0 79 11 80       	mov    $0x801179e0,%eax
+80106654:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80106658:	c1 e8 10             	shr    $0x10,%eax
+8010665b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010665f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80106662:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80106665:	c9                   	leave
+80106666:	c3                   	ret
+80106667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010666e:	66 90                	xchg   %ax,%ax
+
+80106670 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80106670:	55                   	push   %ebp
+80106671:	89 e5                	mov    %esp,%ebp
+80106673:	57                   	push   %edi
+80106674:	56                   	push   %esi
+80106675:	53                   	push   %ebx
+80106676:	83 ec 1c             	sub    $0x1c,%esp
+80106679:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+8010667c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010667f:	83 f8 40             	cmp    $0x40,%eax
+80106682:	0f 84 78 01 00 00    	je     80106800 <trap+0x190>
+    return;
+  }
+
+
+
+  switch(tf->trapno){
+80106688:	83 e8 20             	sub    $0x20,%eax
+8010668b:	83 f8 1f             	cmp    $0x1f,%eax
+8010668e:	0f 87 8c 00 00 00    	ja     80106720 <trap+0xb0>
+80106694:	ff 24 85 18 88 10 80 	jmp    *-0x7fef77e8(,%eax,4)
+8010669b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010669f:	90                   	nop
+      release(&tickslock);
+    }
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+801066a0:	e8 9b bc ff ff       	call   80102340 <ideintr>
+    lapiceoi();
+801066a5:	e8 66 c3 ff ff       	call   80102a10 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801066aa:	e8 01 d3 ff ff       	call   801039b0 <myproc>
+801066af:	85 c0                	test   %eax,%eax
+801066b1:	74 1d                	je     801066d0 <trap+0x60>
+801066b3:	e8 f8 d2 ff ff       	call   801039b0 <myproc>
+801066b8:	8b 50 24             	mov    0x24(%eax),%edx
+801066bb:	85 d2                	test   %edx,%edx
+801066bd:	74 11                	je     801066d0 <trap+0x60>
+801066bf:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801066c3:	83 e0 03             	and    $0x3,%eax
+801066c6:	66 83 f8 03          	cmp    $0x3,%ax
+801066ca:	0f 84 f8 01 00 00    	je     801068c8 <trap+0x258>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+801066d0:	e8 db d2 ff ff       	call   801039b0 <myproc>
+801066d5:	85 c0                	test   %eax,%eax
+801066d7:	74 0f                	je     801066e8 <trap+0x78>
+801066d9:	e8 d2 d2 ff ff       	call   801039b0 <myproc>
+801066de:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+801066e2:	0f 84 c8 00 00 00    	je     801067b0 <trap+0x140>
+     tf->trapno == T_IRQ0+IRQ_TIMER)
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801066e8:	e8 c3 d2 ff ff       	call   801039b0 <myproc>
+801066ed:	85 c0                	test   %eax,%eax
+801066ef:	74 1d                	je     8010670e <trap+0x9e>
+801066f1:	e8 ba d2 ff ff       	call   801039b0 <myproc>
+801066f6:	8b 40 24             	mov    0x24(%eax),%eax
+801066f9:	85 c0                	test   %eax,%eax
+801066fb:	74 11                	je     8010670e <trap+0x9e>
+801066fd:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80106701:	83 e0 03             	and    $0x3,%eax
+80106704:	66 83 f8 03          	cmp    $0x3,%ax
+80106708:	0f 84 1f 01 00 00    	je     8010682d <trap+0x1bd>
+    exit();
+}
+8010670e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106711:	5b                   	pop    %ebx
+80106712:	5e                   	pop    %esi
+80106713:	5f                   	pop    %edi
+80106714:	5d                   	pop    %ebp
+80106715:	c3                   	ret
+80106716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010671d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80106720:	e8 8b d2 ff ff       	call   801039b0 <myproc>
+80106725:	8b 7b 38             	mov    0x38(%ebx),%edi
+80106728:	85 c0                	test   %eax,%eax
+8010672a:	0f 84 d0 01 00 00    	je     80106900 <trap+0x290>
+80106730:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80106734:	0f 84 c6 01 00 00    	je     80106900 <trap+0x290>
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+8010673a:	0f 20 d1             	mov    %cr2,%ecx
+8010673d:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106740:	e8 4b d2 ff ff       	call   80103990 <cpuid>
+80106745:	8b 73 30             	mov    0x30(%ebx),%esi
+80106748:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010674b:	8b 43 34             	mov    0x34(%ebx),%eax
+8010674e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80106751:	e8 5a d2 ff ff       	call   801039b0 <myproc>
+80106756:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106759:	e8 52 d2 ff ff       	call   801039b0 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010675e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80106761:	51                   	push   %ecx
+80106762:	57                   	push   %edi
+80106763:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80106766:	52                   	push   %edx
+80106767:	ff 75 e4             	push   -0x1c(%ebp)
+8010676a:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+8010676b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010676e:	83 c6 6c             	add    $0x6c,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80106771:	56                   	push   %esi
+80106772:	ff 70 10             	push   0x10(%eax)
+80106775:	68 d4 87 10 80       	push   $0x801087d4
+8010677a:	e8 31 9f ff ff       	call   801006b0 <cprintf>
+    if(tf->trapno == 14) {
+8010677f:	83 c4 20             	add    $0x20,%esp
+80106782:	83 7b 30 0e          	cmpl   $0xe,0x30(%ebx)
+80106786:	0f 84 5c 01 00 00    	je     801068e8 <trap+0x278>
+    myproc()->killed = 1;
+8010678c:	e8 1f d2 ff ff       	call   801039b0 <myproc>
+80106791:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80106798:	e8 13 d2 ff ff       	call   801039b0 <myproc>
+8010679d:	85 c0                	test   %eax,%eax
+8010679f:	0f 85 0e ff ff ff    	jne    801066b3 <trap+0x43>
+801067a5:	e9 26 ff ff ff       	jmp    801066d0 <trap+0x60>
+801067aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(myproc() && myproc()->state == RUNNING &&
+801067b0:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+801067b4:	0f 85 2e ff ff ff    	jne    801066e8 <trap+0x78>
+    yield();
+801067ba:	e8 e1 db ff ff       	call   801043a0 <yield>
+801067bf:	e9 24 ff ff ff       	jmp    801066e8 <trap+0x78>
+801067c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801067c8:	8b 7b 38             	mov    0x38(%ebx),%edi
+801067cb:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+801067cf:	e8 bc d1 ff ff       	call   80103990 <cpuid>
+801067d4:	57                   	push   %edi
+801067d5:	56                   	push   %esi
+801067d6:	50                   	push   %eax
+801067d7:	68 7c 87 10 80       	push   $0x8010877c
+801067dc:	e8 cf 9e ff ff       	call   801006b0 <cprintf>
+    lapiceoi();
+801067e1:	e8 2a c2 ff ff       	call   80102a10 <lapiceoi>
+    break;
+801067e6:	83 c4 10             	add    $0x10,%esp
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801067e9:	e8 c2 d1 ff ff       	call   801039b0 <myproc>
+801067ee:	85 c0                	test   %eax,%eax
+801067f0:	0f 85 bd fe ff ff    	jne    801066b3 <trap+0x43>
+801067f6:	e9 d5 fe ff ff       	jmp    801066d0 <trap+0x60>
+801067fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801067ff:	90                   	nop
+    if(myproc()->killed)
+80106800:	e8 ab d1 ff ff       	call   801039b0 <myproc>
+80106805:	8b 70 24             	mov    0x24(%eax),%esi
+80106808:	85 f6                	test   %esi,%esi
+8010680a:	0f 85 c8 00 00 00    	jne    801068d8 <trap+0x268>
+    myproc()->tf = tf;
+80106810:	e8 9b d1 ff ff       	call   801039b0 <myproc>
+80106815:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+80106818:	e8 93 e8 ff ff       	call   801050b0 <syscall>
+    if(myproc()->killed)
+8010681d:	e8 8e d1 ff ff       	call   801039b0 <myproc>
+80106822:	8b 48 24             	mov    0x24(%eax),%ecx
+80106825:	85 c9                	test   %ecx,%ecx
+80106827:	0f 84 e1 fe ff ff    	je     8010670e <trap+0x9e>
+}
+8010682d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106830:	5b                   	pop    %ebx
+80106831:	5e                   	pop    %esi
+80106832:	5f                   	pop    %edi
+80106833:	5d                   	pop    %ebp
+      exit();
+80106834:	e9 b7 dc ff ff       	jmp    801044f0 <exit>
+80106839:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    uartintr();
+80106840:	e8 6b 02 00 00       	call   80106ab0 <uartintr>
+    lapiceoi();
+80106845:	e8 c6 c1 ff ff       	call   80102a10 <lapiceoi>
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010684a:	e8 61 d1 ff ff       	call   801039b0 <myproc>
+8010684f:	85 c0                	test   %eax,%eax
+80106851:	0f 85 5c fe ff ff    	jne    801066b3 <trap+0x43>
+80106857:	e9 74 fe ff ff       	jmp    801066d0 <trap+0x60>
+8010685c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kbdintr();
+80106860:	e8 6b c0 ff ff       	call   801028d0 <kbdintr>
+    lapiceoi();
+80106865:	e8 a6 c1 ff ff       	call   80102a10 <lapiceoi>
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010686a:	e8 41 d1 ff ff       	call   801039b0 <myproc>
+8010686f:	85 c0                	test   %eax,%eax
+80106871:	0f 85 3c fe ff ff    	jne    801066b3 <trap+0x43>
+80106877:	e9 54 fe ff ff       	jmp    801066d0 <trap+0x60>
+8010687c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(cpuid() == 0){
+80106880:	e8 0b d1 ff ff       	call   80103990 <cpuid>
+80106885:	85 c0                	test   %eax,%eax
+80106887:	0f 85 18 fe ff ff    	jne    801066a5 <trap+0x35>
+      acquire(&tickslock);
+8010688d:	83 ec 0c             	sub    $0xc,%esp
+80106890:	68 a0 79 11 80       	push   $0x801179a0
+80106895:	e8 46 e3 ff ff       	call   80104be0 <acquire>
+      ticks++;
+8010689a:	83 05 80 79 11 80 01 	addl   $0x1,0x80117980
+      wakeup(&ticks);
+801068a1:	c7 04 24 80 79 11 80 	movl   $0x80117980,(%esp)
+801068a8:	e8 f3 dc ff ff       	call   801045a0 <wakeup>
+      release(&tickslock);
+801068ad:	c7 04 24 a0 79 11 80 	movl   $0x801179a0,(%esp)
+801068b4:	e8 c7 e2 ff ff       	call   80104b80 <release>
+801068b9:	83 c4 10             	add    $0x10,%esp
+    lapiceoi();
+801068bc:	e9 e4 fd ff ff       	jmp    801066a5 <trap+0x35>
+801068c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    exit();
+801068c8:	e8 23 dc ff ff       	call   801044f0 <exit>
+801068cd:	e9 fe fd ff ff       	jmp    801066d0 <trap+0x60>
+801068d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+801068d8:	e8 13 dc ff ff       	call   801044f0 <exit>
+801068dd:	e9 2e ff ff ff       	jmp    80106810 <trap+0x1a0>
+801068e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      cprintf("eip(uint): %d\n", tf->eip);
+801068e8:	83 ec 08             	sub    $0x8,%esp
+801068eb:	ff 73 38             	push   0x38(%ebx)
+801068ee:	68 6b 87 10 80       	push   $0x8010876b
+801068f3:	e8 b8 9d ff ff       	call   801006b0 <cprintf>
+801068f8:	83 c4 10             	add    $0x10,%esp
+801068fb:	e9 8c fe ff ff       	jmp    8010678c <trap+0x11c>
+80106900:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80106903:	e8 88 d0 ff ff       	call   80103990 <cpuid>
+80106908:	83 ec 0c             	sub    $0xc,%esp
+8010690b:	56                   	push   %esi
+8010690c:	57                   	push   %edi
+8010690d:	50                   	push   %eax
+8010690e:	ff 73 30             	push   0x30(%ebx)
+80106911:	68 a0 87 10 80       	push   $0x801087a0
+80106916:	e8 95 9d ff ff       	call   801006b0 <cprintf>
+      panic("trap");
+8010691b:	83 c4 14             	add    $0x14,%esp
+8010691e:	68 66 87 10 80       	push   $0x80108766
+80106923:	e8 58 9a ff ff       	call   80100380 <panic>
+80106928:	66 90                	xchg   %ax,%ax
+8010692a:	66 90                	xchg   %ax,%ax
+8010692c:	66 90                	xchg   %ax,%ax
+8010692e:	66 90                	xchg   %ax,%ax
+
+80106930 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80106930:	a1 e0 81 11 80       	mov    0x801181e0,%eax
+80106935:	85 c0                	test   %eax,%eax
+80106937:	74 17                	je     80106950 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106939:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010693e:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+8010693f:	a8 01                	test   $0x1,%al
+80106941:	74 0d                	je     80106950 <uartgetc+0x20>
+80106943:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106948:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80106949:	0f b6 c0             	movzbl %al,%eax
+8010694c:	c3                   	ret
+8010694d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80106950:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106955:	c3                   	ret
+80106956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010695d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106960 <uartinit>:
+{
+80106960:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106961:	31 c9                	xor    %ecx,%ecx
+80106963:	89 c8                	mov    %ecx,%eax
+80106965:	89 e5                	mov    %esp,%ebp
+80106967:	57                   	push   %edi
+80106968:	bf fa 03 00 00       	mov    $0x3fa,%edi
+8010696d:	56                   	push   %esi
+8010696e:	89 fa                	mov    %edi,%edx
+80106970:	53                   	push   %ebx
+80106971:	83 ec 1c             	sub    $0x1c,%esp
+80106974:	ee                   	out    %al,(%dx)
+80106975:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010697a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010697f:	89 f2                	mov    %esi,%edx
+80106981:	ee                   	out    %al,(%dx)
+80106982:	b8 0c 00 00 00       	mov    $0xc,%eax
+80106987:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010698c:	ee                   	out    %al,(%dx)
+8010698d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80106992:	89 c8                	mov    %ecx,%eax
+80106994:	89 da                	mov    %ebx,%edx
+80106996:	ee                   	out    %al,(%dx)
+80106997:	b8 03 00 00 00       	mov    $0x3,%eax
+8010699c:	89 f2                	mov    %esi,%edx
+8010699e:	ee                   	out    %al,(%dx)
+8010699f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+801069a4:	89 c8                	mov    %ecx,%eax
+801069a6:	ee                   	out    %al,(%dx)
+801069a7:	b8 01 00 00 00       	mov    $0x1,%eax
+801069ac:	89 da                	mov    %ebx,%edx
+801069ae:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801069af:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801069b4:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+801069b5:	3c ff                	cmp    $0xff,%al
+801069b7:	0f 84 7c 00 00 00    	je     80106a39 <uartinit+0xd9>
+  uart = 1;
+801069bd:	c7 05 e0 81 11 80 01 	movl   $0x1,0x801181e0
+801069c4:	00 00 00 
+801069c7:	89 fa                	mov    %edi,%edx
+801069c9:	ec                   	in     (%dx),%al
+801069ca:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801069cf:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+801069d0:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+801069d3:	bf 98 88 10 80       	mov    $0x80108898,%edi
+801069d8:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+801069dd:	6a 00                	push   $0x0
+801069df:	6a 04                	push   $0x4
+801069e1:	e8 8a bb ff ff       	call   80102570 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+801069e6:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+801069ea:	83 c4 10             	add    $0x10,%esp
+801069ed:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+801069f0:	a1 e0 81 11 80       	mov    0x801181e0,%eax
+801069f5:	85 c0                	test   %eax,%eax
+801069f7:	74 32                	je     80106a2b <uartinit+0xcb>
+801069f9:	89 f2                	mov    %esi,%edx
+801069fb:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801069fc:	a8 20                	test   $0x20,%al
+801069fe:	75 21                	jne    80106a21 <uartinit+0xc1>
+80106a00:	bb 80 00 00 00       	mov    $0x80,%ebx
+80106a05:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80106a08:	83 ec 0c             	sub    $0xc,%esp
+80106a0b:	6a 0a                	push   $0xa
+80106a0d:	e8 1e c0 ff ff       	call   80102a30 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106a12:	83 c4 10             	add    $0x10,%esp
+80106a15:	83 eb 01             	sub    $0x1,%ebx
+80106a18:	74 07                	je     80106a21 <uartinit+0xc1>
+80106a1a:	89 f2                	mov    %esi,%edx
+80106a1c:	ec                   	in     (%dx),%al
+80106a1d:	a8 20                	test   $0x20,%al
+80106a1f:	74 e7                	je     80106a08 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106a21:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106a26:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80106a2a:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80106a2b:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80106a2f:	83 c7 01             	add    $0x1,%edi
+80106a32:	88 45 e7             	mov    %al,-0x19(%ebp)
+80106a35:	84 c0                	test   %al,%al
+80106a37:	75 b7                	jne    801069f0 <uartinit+0x90>
+}
+80106a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a3c:	5b                   	pop    %ebx
+80106a3d:	5e                   	pop    %esi
+80106a3e:	5f                   	pop    %edi
+80106a3f:	5d                   	pop    %ebp
+80106a40:	c3                   	ret
+80106a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a4f:	90                   	nop
+
+80106a50 <uartputc>:
+  if(!uart)
+80106a50:	a1 e0 81 11 80       	mov    0x801181e0,%eax
+80106a55:	85 c0                	test   %eax,%eax
+80106a57:	74 4f                	je     80106aa8 <uartputc+0x58>
+{
+80106a59:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106a5a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80106a5f:	89 e5                	mov    %esp,%ebp
+80106a61:	56                   	push   %esi
+80106a62:	53                   	push   %ebx
+80106a63:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106a64:	a8 20                	test   $0x20,%al
+80106a66:	75 29                	jne    80106a91 <uartputc+0x41>
+80106a68:	bb 80 00 00 00       	mov    $0x80,%ebx
+80106a6d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80106a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80106a78:	83 ec 0c             	sub    $0xc,%esp
+80106a7b:	6a 0a                	push   $0xa
+80106a7d:	e8 ae bf ff ff       	call   80102a30 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80106a82:	83 c4 10             	add    $0x10,%esp
+80106a85:	83 eb 01             	sub    $0x1,%ebx
+80106a88:	74 07                	je     80106a91 <uartputc+0x41>
+80106a8a:	89 f2                	mov    %esi,%edx
+80106a8c:	ec                   	in     (%dx),%al
+80106a8d:	a8 20                	test   $0x20,%al
+80106a8f:	74 e7                	je     80106a78 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80106a91:	8b 45 08             	mov    0x8(%ebp),%eax
+80106a94:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80106a99:	ee                   	out    %al,(%dx)
+}
+80106a9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106a9d:	5b                   	pop    %ebx
+80106a9e:	5e                   	pop    %esi
+80106a9f:	5d                   	pop    %ebp
+80106aa0:	c3                   	ret
+80106aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106aa8:	c3                   	ret
+80106aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106ab0 <uartintr>:
+
+void
+uartintr(void)
+{
+80106ab0:	55                   	push   %ebp
+80106ab1:	89 e5                	mov    %esp,%ebp
+80106ab3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80106ab6:	68 30 69 10 80       	push   $0x80106930
+80106abb:	e8 00 9e ff ff       	call   801008c0 <consoleintr>
+}
+80106ac0:	83 c4 10             	add    $0x10,%esp
+80106ac3:	c9                   	leave
+80106ac4:	c3                   	ret
+
+80106ac5 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80106ac5:	6a 00                	push   $0x0
+  pushl $0
+80106ac7:	6a 00                	push   $0x0
+  jmp alltraps
+80106ac9:	e9 cc fa ff ff       	jmp    8010659a <alltraps>
+
+80106ace <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80106ace:	6a 00                	push   $0x0
+  pushl $1
+80106ad0:	6a 01                	push   $0x1
+  jmp alltraps
+80106ad2:	e9 c3 fa ff ff       	jmp    8010659a <alltraps>
+
+80106ad7 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80106ad7:	6a 00                	push   $0x0
+  pushl $2
+80106ad9:	6a 02                	push   $0x2
+  jmp alltraps
+80106adb:	e9 ba fa ff ff       	jmp    8010659a <alltraps>
+
+80106ae0 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80106ae0:	6a 00                	push   $0x0
+  pushl $3
+80106ae2:	6a 03                	push   $0x3
+  jmp alltraps
+80106ae4:	e9 b1 fa ff ff       	jmp    8010659a <alltraps>
+
+80106ae9 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80106ae9:	6a 00                	push   $0x0
+  pushl $4
+80106aeb:	6a 04                	push   $0x4
+  jmp alltraps
+80106aed:	e9 a8 fa ff ff       	jmp    8010659a <alltraps>
+
+80106af2 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80106af2:	6a 00                	push   $0x0
+  pushl $5
+80106af4:	6a 05                	push   $0x5
+  jmp alltraps
+80106af6:	e9 9f fa ff ff       	jmp    8010659a <alltraps>
+
+80106afb <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80106afb:	6a 00                	push   $0x0
+  pushl $6
+80106afd:	6a 06                	push   $0x6
+  jmp alltraps
+80106aff:	e9 96 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b04 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80106b04:	6a 00                	push   $0x0
+  pushl $7
+80106b06:	6a 07                	push   $0x7
+  jmp alltraps
+80106b08:	e9 8d fa ff ff       	jmp    8010659a <alltraps>
+
+80106b0d <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80106b0d:	6a 08                	push   $0x8
+  jmp alltraps
+80106b0f:	e9 86 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b14 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80106b14:	6a 00                	push   $0x0
+  pushl $9
+80106b16:	6a 09                	push   $0x9
+  jmp alltraps
+80106b18:	e9 7d fa ff ff       	jmp    8010659a <alltraps>
+
+80106b1d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80106b1d:	6a 0a                	push   $0xa
+  jmp alltraps
+80106b1f:	e9 76 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b24 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80106b24:	6a 0b                	push   $0xb
+  jmp alltraps
+80106b26:	e9 6f fa ff ff       	jmp    8010659a <alltraps>
+
+80106b2b <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80106b2b:	6a 0c                	push   $0xc
+  jmp alltraps
+80106b2d:	e9 68 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b32 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80106b32:	6a 0d                	push   $0xd
+  jmp alltraps
+80106b34:	e9 61 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b39 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80106b39:	6a 0e                	push   $0xe
+  jmp alltraps
+80106b3b:	e9 5a fa ff ff       	jmp    8010659a <alltraps>
+
+80106b40 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80106b40:	6a 00                	push   $0x0
+  pushl $15
+80106b42:	6a 0f                	push   $0xf
+  jmp alltraps
+80106b44:	e9 51 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b49 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80106b49:	6a 00                	push   $0x0
+  pushl $16
+80106b4b:	6a 10                	push   $0x10
+  jmp alltraps
+80106b4d:	e9 48 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b52 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80106b52:	6a 11                	push   $0x11
+  jmp alltraps
+80106b54:	e9 41 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b59 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80106b59:	6a 00                	push   $0x0
+  pushl $18
+80106b5b:	6a 12                	push   $0x12
+  jmp alltraps
+80106b5d:	e9 38 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b62 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80106b62:	6a 00                	push   $0x0
+  pushl $19
+80106b64:	6a 13                	push   $0x13
+  jmp alltraps
+80106b66:	e9 2f fa ff ff       	jmp    8010659a <alltraps>
+
+80106b6b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80106b6b:	6a 00                	push   $0x0
+  pushl $20
+80106b6d:	6a 14                	push   $0x14
+  jmp alltraps
+80106b6f:	e9 26 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b74 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80106b74:	6a 00                	push   $0x0
+  pushl $21
+80106b76:	6a 15                	push   $0x15
+  jmp alltraps
+80106b78:	e9 1d fa ff ff       	jmp    8010659a <alltraps>
+
+80106b7d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80106b7d:	6a 00                	push   $0x0
+  pushl $22
+80106b7f:	6a 16                	push   $0x16
+  jmp alltraps
+80106b81:	e9 14 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b86 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80106b86:	6a 00                	push   $0x0
+  pushl $23
+80106b88:	6a 17                	push   $0x17
+  jmp alltraps
+80106b8a:	e9 0b fa ff ff       	jmp    8010659a <alltraps>
+
+80106b8f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80106b8f:	6a 00                	push   $0x0
+  pushl $24
+80106b91:	6a 18                	push   $0x18
+  jmp alltraps
+80106b93:	e9 02 fa ff ff       	jmp    8010659a <alltraps>
+
+80106b98 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80106b98:	6a 00                	push   $0x0
+  pushl $25
+80106b9a:	6a 19                	push   $0x19
+  jmp alltraps
+80106b9c:	e9 f9 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106ba1 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80106ba1:	6a 00                	push   $0x0
+  pushl $26
+80106ba3:	6a 1a                	push   $0x1a
+  jmp alltraps
+80106ba5:	e9 f0 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106baa <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80106baa:	6a 00                	push   $0x0
+  pushl $27
+80106bac:	6a 1b                	push   $0x1b
+  jmp alltraps
+80106bae:	e9 e7 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bb3 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80106bb3:	6a 00                	push   $0x0
+  pushl $28
+80106bb5:	6a 1c                	push   $0x1c
+  jmp alltraps
+80106bb7:	e9 de f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bbc <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80106bbc:	6a 00                	push   $0x0
+  pushl $29
+80106bbe:	6a 1d                	push   $0x1d
+  jmp alltraps
+80106bc0:	e9 d5 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bc5 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80106bc5:	6a 00                	push   $0x0
+  pushl $30
+80106bc7:	6a 1e                	push   $0x1e
+  jmp alltraps
+80106bc9:	e9 cc f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bce <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80106bce:	6a 00                	push   $0x0
+  pushl $31
+80106bd0:	6a 1f                	push   $0x1f
+  jmp alltraps
+80106bd2:	e9 c3 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bd7 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80106bd7:	6a 00                	push   $0x0
+  pushl $32
+80106bd9:	6a 20                	push   $0x20
+  jmp alltraps
+80106bdb:	e9 ba f9 ff ff       	jmp    8010659a <alltraps>
+
+80106be0 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80106be0:	6a 00                	push   $0x0
+  pushl $33
+80106be2:	6a 21                	push   $0x21
+  jmp alltraps
+80106be4:	e9 b1 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106be9 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80106be9:	6a 00                	push   $0x0
+  pushl $34
+80106beb:	6a 22                	push   $0x22
+  jmp alltraps
+80106bed:	e9 a8 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bf2 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80106bf2:	6a 00                	push   $0x0
+  pushl $35
+80106bf4:	6a 23                	push   $0x23
+  jmp alltraps
+80106bf6:	e9 9f f9 ff ff       	jmp    8010659a <alltraps>
+
+80106bfb <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80106bfb:	6a 00                	push   $0x0
+  pushl $36
+80106bfd:	6a 24                	push   $0x24
+  jmp alltraps
+80106bff:	e9 96 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c04 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80106c04:	6a 00                	push   $0x0
+  pushl $37
+80106c06:	6a 25                	push   $0x25
+  jmp alltraps
+80106c08:	e9 8d f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c0d <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80106c0d:	6a 00                	push   $0x0
+  pushl $38
+80106c0f:	6a 26                	push   $0x26
+  jmp alltraps
+80106c11:	e9 84 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c16 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80106c16:	6a 00                	push   $0x0
+  pushl $39
+80106c18:	6a 27                	push   $0x27
+  jmp alltraps
+80106c1a:	e9 7b f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c1f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80106c1f:	6a 00                	push   $0x0
+  pushl $40
+80106c21:	6a 28                	push   $0x28
+  jmp alltraps
+80106c23:	e9 72 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c28 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80106c28:	6a 00                	push   $0x0
+  pushl $41
+80106c2a:	6a 29                	push   $0x29
+  jmp alltraps
+80106c2c:	e9 69 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c31 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80106c31:	6a 00                	push   $0x0
+  pushl $42
+80106c33:	6a 2a                	push   $0x2a
+  jmp alltraps
+80106c35:	e9 60 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c3a <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80106c3a:	6a 00                	push   $0x0
+  pushl $43
+80106c3c:	6a 2b                	push   $0x2b
+  jmp alltraps
+80106c3e:	e9 57 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c43 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80106c43:	6a 00                	push   $0x0
+  pushl $44
+80106c45:	6a 2c                	push   $0x2c
+  jmp alltraps
+80106c47:	e9 4e f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c4c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80106c4c:	6a 00                	push   $0x0
+  pushl $45
+80106c4e:	6a 2d                	push   $0x2d
+  jmp alltraps
+80106c50:	e9 45 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c55 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80106c55:	6a 00                	push   $0x0
+  pushl $46
+80106c57:	6a 2e                	push   $0x2e
+  jmp alltraps
+80106c59:	e9 3c f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c5e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80106c5e:	6a 00                	push   $0x0
+  pushl $47
+80106c60:	6a 2f                	push   $0x2f
+  jmp alltraps
+80106c62:	e9 33 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c67 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80106c67:	6a 00                	push   $0x0
+  pushl $48
+80106c69:	6a 30                	push   $0x30
+  jmp alltraps
+80106c6b:	e9 2a f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c70 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80106c70:	6a 00                	push   $0x0
+  pushl $49
+80106c72:	6a 31                	push   $0x31
+  jmp alltraps
+80106c74:	e9 21 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c79 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80106c79:	6a 00                	push   $0x0
+  pushl $50
+80106c7b:	6a 32                	push   $0x32
+  jmp alltraps
+80106c7d:	e9 18 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c82 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80106c82:	6a 00                	push   $0x0
+  pushl $51
+80106c84:	6a 33                	push   $0x33
+  jmp alltraps
+80106c86:	e9 0f f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c8b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+80106c8b:	6a 00                	push   $0x0
+  pushl $52
+80106c8d:	6a 34                	push   $0x34
+  jmp alltraps
+80106c8f:	e9 06 f9 ff ff       	jmp    8010659a <alltraps>
+
+80106c94 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80106c94:	6a 00                	push   $0x0
+  pushl $53
+80106c96:	6a 35                	push   $0x35
+  jmp alltraps
+80106c98:	e9 fd f8 ff ff       	jmp    8010659a <alltraps>
+
+80106c9d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+80106c9d:	6a 00                	push   $0x0
+  pushl $54
+80106c9f:	6a 36                	push   $0x36
+  jmp alltraps
+80106ca1:	e9 f4 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106ca6 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80106ca6:	6a 00                	push   $0x0
+  pushl $55
+80106ca8:	6a 37                	push   $0x37
+  jmp alltraps
+80106caa:	e9 eb f8 ff ff       	jmp    8010659a <alltraps>
+
+80106caf <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80106caf:	6a 00                	push   $0x0
+  pushl $56
+80106cb1:	6a 38                	push   $0x38
+  jmp alltraps
+80106cb3:	e9 e2 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cb8 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80106cb8:	6a 00                	push   $0x0
+  pushl $57
+80106cba:	6a 39                	push   $0x39
+  jmp alltraps
+80106cbc:	e9 d9 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cc1 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80106cc1:	6a 00                	push   $0x0
+  pushl $58
+80106cc3:	6a 3a                	push   $0x3a
+  jmp alltraps
+80106cc5:	e9 d0 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cca <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80106cca:	6a 00                	push   $0x0
+  pushl $59
+80106ccc:	6a 3b                	push   $0x3b
+  jmp alltraps
+80106cce:	e9 c7 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cd3 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80106cd3:	6a 00                	push   $0x0
+  pushl $60
+80106cd5:	6a 3c                	push   $0x3c
+  jmp alltraps
+80106cd7:	e9 be f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cdc <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80106cdc:	6a 00                	push   $0x0
+  pushl $61
+80106cde:	6a 3d                	push   $0x3d
+  jmp alltraps
+80106ce0:	e9 b5 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106ce5 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80106ce5:	6a 00                	push   $0x0
+  pushl $62
+80106ce7:	6a 3e                	push   $0x3e
+  jmp alltraps
+80106ce9:	e9 ac f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cee <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80106cee:	6a 00                	push   $0x0
+  pushl $63
+80106cf0:	6a 3f                	push   $0x3f
+  jmp alltraps
+80106cf2:	e9 a3 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106cf7 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80106cf7:	6a 00                	push   $0x0
+  pushl $64
+80106cf9:	6a 40                	push   $0x40
+  jmp alltraps
+80106cfb:	e9 9a f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d00 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80106d00:	6a 00                	push   $0x0
+  pushl $65
+80106d02:	6a 41                	push   $0x41
+  jmp alltraps
+80106d04:	e9 91 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d09 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80106d09:	6a 00                	push   $0x0
+  pushl $66
+80106d0b:	6a 42                	push   $0x42
+  jmp alltraps
+80106d0d:	e9 88 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d12 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80106d12:	6a 00                	push   $0x0
+  pushl $67
+80106d14:	6a 43                	push   $0x43
+  jmp alltraps
+80106d16:	e9 7f f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d1b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80106d1b:	6a 00                	push   $0x0
+  pushl $68
+80106d1d:	6a 44                	push   $0x44
+  jmp alltraps
+80106d1f:	e9 76 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d24 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80106d24:	6a 00                	push   $0x0
+  pushl $69
+80106d26:	6a 45                	push   $0x45
+  jmp alltraps
+80106d28:	e9 6d f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d2d <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80106d2d:	6a 00                	push   $0x0
+  pushl $70
+80106d2f:	6a 46                	push   $0x46
+  jmp alltraps
+80106d31:	e9 64 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d36 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80106d36:	6a 00                	push   $0x0
+  pushl $71
+80106d38:	6a 47                	push   $0x47
+  jmp alltraps
+80106d3a:	e9 5b f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d3f <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80106d3f:	6a 00                	push   $0x0
+  pushl $72
+80106d41:	6a 48                	push   $0x48
+  jmp alltraps
+80106d43:	e9 52 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d48 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80106d48:	6a 00                	push   $0x0
+  pushl $73
+80106d4a:	6a 49                	push   $0x49
+  jmp alltraps
+80106d4c:	e9 49 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d51 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80106d51:	6a 00                	push   $0x0
+  pushl $74
+80106d53:	6a 4a                	push   $0x4a
+  jmp alltraps
+80106d55:	e9 40 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d5a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80106d5a:	6a 00                	push   $0x0
+  pushl $75
+80106d5c:	6a 4b                	push   $0x4b
+  jmp alltraps
+80106d5e:	e9 37 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d63 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80106d63:	6a 00                	push   $0x0
+  pushl $76
+80106d65:	6a 4c                	push   $0x4c
+  jmp alltraps
+80106d67:	e9 2e f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d6c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80106d6c:	6a 00                	push   $0x0
+  pushl $77
+80106d6e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80106d70:	e9 25 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d75 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80106d75:	6a 00                	push   $0x0
+  pushl $78
+80106d77:	6a 4e                	push   $0x4e
+  jmp alltraps
+80106d79:	e9 1c f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d7e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80106d7e:	6a 00                	push   $0x0
+  pushl $79
+80106d80:	6a 4f                	push   $0x4f
+  jmp alltraps
+80106d82:	e9 13 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d87 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80106d87:	6a 00                	push   $0x0
+  pushl $80
+80106d89:	6a 50                	push   $0x50
+  jmp alltraps
+80106d8b:	e9 0a f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d90 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80106d90:	6a 00                	push   $0x0
+  pushl $81
+80106d92:	6a 51                	push   $0x51
+  jmp alltraps
+80106d94:	e9 01 f8 ff ff       	jmp    8010659a <alltraps>
+
+80106d99 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80106d99:	6a 00                	push   $0x0
+  pushl $82
+80106d9b:	6a 52                	push   $0x52
+  jmp alltraps
+80106d9d:	e9 f8 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106da2 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80106da2:	6a 00                	push   $0x0
+  pushl $83
+80106da4:	6a 53                	push   $0x53
+  jmp alltraps
+80106da6:	e9 ef f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dab <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+80106dab:	6a 00                	push   $0x0
+  pushl $84
+80106dad:	6a 54                	push   $0x54
+  jmp alltraps
+80106daf:	e9 e6 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106db4 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80106db4:	6a 00                	push   $0x0
+  pushl $85
+80106db6:	6a 55                	push   $0x55
+  jmp alltraps
+80106db8:	e9 dd f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dbd <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+80106dbd:	6a 00                	push   $0x0
+  pushl $86
+80106dbf:	6a 56                	push   $0x56
+  jmp alltraps
+80106dc1:	e9 d4 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dc6 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80106dc6:	6a 00                	push   $0x0
+  pushl $87
+80106dc8:	6a 57                	push   $0x57
+  jmp alltraps
+80106dca:	e9 cb f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dcf <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+80106dcf:	6a 00                	push   $0x0
+  pushl $88
+80106dd1:	6a 58                	push   $0x58
+  jmp alltraps
+80106dd3:	e9 c2 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dd8 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80106dd8:	6a 00                	push   $0x0
+  pushl $89
+80106dda:	6a 59                	push   $0x59
+  jmp alltraps
+80106ddc:	e9 b9 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106de1 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80106de1:	6a 00                	push   $0x0
+  pushl $90
+80106de3:	6a 5a                	push   $0x5a
+  jmp alltraps
+80106de5:	e9 b0 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dea <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80106dea:	6a 00                	push   $0x0
+  pushl $91
+80106dec:	6a 5b                	push   $0x5b
+  jmp alltraps
+80106dee:	e9 a7 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106df3 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80106df3:	6a 00                	push   $0x0
+  pushl $92
+80106df5:	6a 5c                	push   $0x5c
+  jmp alltraps
+80106df7:	e9 9e f7 ff ff       	jmp    8010659a <alltraps>
+
+80106dfc <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80106dfc:	6a 00                	push   $0x0
+  pushl $93
+80106dfe:	6a 5d                	push   $0x5d
+  jmp alltraps
+80106e00:	e9 95 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e05 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80106e05:	6a 00                	push   $0x0
+  pushl $94
+80106e07:	6a 5e                	push   $0x5e
+  jmp alltraps
+80106e09:	e9 8c f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e0e <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80106e0e:	6a 00                	push   $0x0
+  pushl $95
+80106e10:	6a 5f                	push   $0x5f
+  jmp alltraps
+80106e12:	e9 83 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e17 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80106e17:	6a 00                	push   $0x0
+  pushl $96
+80106e19:	6a 60                	push   $0x60
+  jmp alltraps
+80106e1b:	e9 7a f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e20 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80106e20:	6a 00                	push   $0x0
+  pushl $97
+80106e22:	6a 61                	push   $0x61
+  jmp alltraps
+80106e24:	e9 71 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e29 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80106e29:	6a 00                	push   $0x0
+  pushl $98
+80106e2b:	6a 62                	push   $0x62
+  jmp alltraps
+80106e2d:	e9 68 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e32 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80106e32:	6a 00                	push   $0x0
+  pushl $99
+80106e34:	6a 63                	push   $0x63
+  jmp alltraps
+80106e36:	e9 5f f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e3b <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80106e3b:	6a 00                	push   $0x0
+  pushl $100
+80106e3d:	6a 64                	push   $0x64
+  jmp alltraps
+80106e3f:	e9 56 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e44 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80106e44:	6a 00                	push   $0x0
+  pushl $101
+80106e46:	6a 65                	push   $0x65
+  jmp alltraps
+80106e48:	e9 4d f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e4d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+80106e4d:	6a 00                	push   $0x0
+  pushl $102
+80106e4f:	6a 66                	push   $0x66
+  jmp alltraps
+80106e51:	e9 44 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e56 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80106e56:	6a 00                	push   $0x0
+  pushl $103
+80106e58:	6a 67                	push   $0x67
+  jmp alltraps
+80106e5a:	e9 3b f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e5f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+80106e5f:	6a 00                	push   $0x0
+  pushl $104
+80106e61:	6a 68                	push   $0x68
+  jmp alltraps
+80106e63:	e9 32 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e68 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80106e68:	6a 00                	push   $0x0
+  pushl $105
+80106e6a:	6a 69                	push   $0x69
+  jmp alltraps
+80106e6c:	e9 29 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e71 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80106e71:	6a 00                	push   $0x0
+  pushl $106
+80106e73:	6a 6a                	push   $0x6a
+  jmp alltraps
+80106e75:	e9 20 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e7a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+80106e7a:	6a 00                	push   $0x0
+  pushl $107
+80106e7c:	6a 6b                	push   $0x6b
+  jmp alltraps
+80106e7e:	e9 17 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e83 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80106e83:	6a 00                	push   $0x0
+  pushl $108
+80106e85:	6a 6c                	push   $0x6c
+  jmp alltraps
+80106e87:	e9 0e f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e8c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+80106e8c:	6a 00                	push   $0x0
+  pushl $109
+80106e8e:	6a 6d                	push   $0x6d
+  jmp alltraps
+80106e90:	e9 05 f7 ff ff       	jmp    8010659a <alltraps>
+
+80106e95 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80106e95:	6a 00                	push   $0x0
+  pushl $110
+80106e97:	6a 6e                	push   $0x6e
+  jmp alltraps
+80106e99:	e9 fc f6 ff ff       	jmp    8010659a <alltraps>
+
+80106e9e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+80106e9e:	6a 00                	push   $0x0
+  pushl $111
+80106ea0:	6a 6f                	push   $0x6f
+  jmp alltraps
+80106ea2:	e9 f3 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ea7 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80106ea7:	6a 00                	push   $0x0
+  pushl $112
+80106ea9:	6a 70                	push   $0x70
+  jmp alltraps
+80106eab:	e9 ea f6 ff ff       	jmp    8010659a <alltraps>
+
+80106eb0 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+80106eb0:	6a 00                	push   $0x0
+  pushl $113
+80106eb2:	6a 71                	push   $0x71
+  jmp alltraps
+80106eb4:	e9 e1 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106eb9 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+80106eb9:	6a 00                	push   $0x0
+  pushl $114
+80106ebb:	6a 72                	push   $0x72
+  jmp alltraps
+80106ebd:	e9 d8 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ec2 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+80106ec2:	6a 00                	push   $0x0
+  pushl $115
+80106ec4:	6a 73                	push   $0x73
+  jmp alltraps
+80106ec6:	e9 cf f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ecb <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+80106ecb:	6a 00                	push   $0x0
+  pushl $116
+80106ecd:	6a 74                	push   $0x74
+  jmp alltraps
+80106ecf:	e9 c6 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ed4 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80106ed4:	6a 00                	push   $0x0
+  pushl $117
+80106ed6:	6a 75                	push   $0x75
+  jmp alltraps
+80106ed8:	e9 bd f6 ff ff       	jmp    8010659a <alltraps>
+
+80106edd <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+80106edd:	6a 00                	push   $0x0
+  pushl $118
+80106edf:	6a 76                	push   $0x76
+  jmp alltraps
+80106ee1:	e9 b4 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ee6 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80106ee6:	6a 00                	push   $0x0
+  pushl $119
+80106ee8:	6a 77                	push   $0x77
+  jmp alltraps
+80106eea:	e9 ab f6 ff ff       	jmp    8010659a <alltraps>
+
+80106eef <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+80106eef:	6a 00                	push   $0x0
+  pushl $120
+80106ef1:	6a 78                	push   $0x78
+  jmp alltraps
+80106ef3:	e9 a2 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106ef8 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80106ef8:	6a 00                	push   $0x0
+  pushl $121
+80106efa:	6a 79                	push   $0x79
+  jmp alltraps
+80106efc:	e9 99 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f01 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80106f01:	6a 00                	push   $0x0
+  pushl $122
+80106f03:	6a 7a                	push   $0x7a
+  jmp alltraps
+80106f05:	e9 90 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f0a <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80106f0a:	6a 00                	push   $0x0
+  pushl $123
+80106f0c:	6a 7b                	push   $0x7b
+  jmp alltraps
+80106f0e:	e9 87 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f13 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80106f13:	6a 00                	push   $0x0
+  pushl $124
+80106f15:	6a 7c                	push   $0x7c
+  jmp alltraps
+80106f17:	e9 7e f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f1c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80106f1c:	6a 00                	push   $0x0
+  pushl $125
+80106f1e:	6a 7d                	push   $0x7d
+  jmp alltraps
+80106f20:	e9 75 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f25 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80106f25:	6a 00                	push   $0x0
+  pushl $126
+80106f27:	6a 7e                	push   $0x7e
+  jmp alltraps
+80106f29:	e9 6c f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f2e <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80106f2e:	6a 00                	push   $0x0
+  pushl $127
+80106f30:	6a 7f                	push   $0x7f
+  jmp alltraps
+80106f32:	e9 63 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f37 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80106f37:	6a 00                	push   $0x0
+  pushl $128
+80106f39:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80106f3e:	e9 57 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f43 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80106f43:	6a 00                	push   $0x0
+  pushl $129
+80106f45:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80106f4a:	e9 4b f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f4f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80106f4f:	6a 00                	push   $0x0
+  pushl $130
+80106f51:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80106f56:	e9 3f f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f5b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80106f5b:	6a 00                	push   $0x0
+  pushl $131
+80106f5d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80106f62:	e9 33 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f67 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80106f67:	6a 00                	push   $0x0
+  pushl $132
+80106f69:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80106f6e:	e9 27 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f73 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80106f73:	6a 00                	push   $0x0
+  pushl $133
+80106f75:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+80106f7a:	e9 1b f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f7f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80106f7f:	6a 00                	push   $0x0
+  pushl $134
+80106f81:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80106f86:	e9 0f f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f8b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+80106f8b:	6a 00                	push   $0x0
+  pushl $135
+80106f8d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80106f92:	e9 03 f6 ff ff       	jmp    8010659a <alltraps>
+
+80106f97 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80106f97:	6a 00                	push   $0x0
+  pushl $136
+80106f99:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+80106f9e:	e9 f7 f5 ff ff       	jmp    8010659a <alltraps>
+
+80106fa3 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80106fa3:	6a 00                	push   $0x0
+  pushl $137
+80106fa5:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+80106faa:	e9 eb f5 ff ff       	jmp    8010659a <alltraps>
+
+80106faf <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80106faf:	6a 00                	push   $0x0
+  pushl $138
+80106fb1:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80106fb6:	e9 df f5 ff ff       	jmp    8010659a <alltraps>
+
+80106fbb <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80106fbb:	6a 00                	push   $0x0
+  pushl $139
+80106fbd:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80106fc2:	e9 d3 f5 ff ff       	jmp    8010659a <alltraps>
+
+80106fc7 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80106fc7:	6a 00                	push   $0x0
+  pushl $140
+80106fc9:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+80106fce:	e9 c7 f5 ff ff       	jmp    8010659a <alltraps>
+
+80106fd3 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80106fd3:	6a 00                	push   $0x0
+  pushl $141
+80106fd5:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80106fda:	e9 bb f5 ff ff       	jmp    8010659a <alltraps>
+
+80106fdf <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80106fdf:	6a 00                	push   $0x0
+  pushl $142
+80106fe1:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80106fe6:	e9 af f5 ff ff       	jmp    8010659a <alltraps>
+
+80106feb <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80106feb:	6a 00                	push   $0x0
+  pushl $143
+80106fed:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80106ff2:	e9 a3 f5 ff ff       	jmp    8010659a <alltraps>
+
+80106ff7 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80106ff7:	6a 00                	push   $0x0
+  pushl $144
+80106ff9:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80106ffe:	e9 97 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107003 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80107003:	6a 00                	push   $0x0
+  pushl $145
+80107005:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010700a:	e9 8b f5 ff ff       	jmp    8010659a <alltraps>
+
+8010700f <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010700f:	6a 00                	push   $0x0
+  pushl $146
+80107011:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80107016:	e9 7f f5 ff ff       	jmp    8010659a <alltraps>
+
+8010701b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010701b:	6a 00                	push   $0x0
+  pushl $147
+8010701d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80107022:	e9 73 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107027 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80107027:	6a 00                	push   $0x0
+  pushl $148
+80107029:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010702e:	e9 67 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107033 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80107033:	6a 00                	push   $0x0
+  pushl $149
+80107035:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010703a:	e9 5b f5 ff ff       	jmp    8010659a <alltraps>
+
+8010703f <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010703f:	6a 00                	push   $0x0
+  pushl $150
+80107041:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80107046:	e9 4f f5 ff ff       	jmp    8010659a <alltraps>
+
+8010704b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010704b:	6a 00                	push   $0x0
+  pushl $151
+8010704d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80107052:	e9 43 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107057 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80107057:	6a 00                	push   $0x0
+  pushl $152
+80107059:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010705e:	e9 37 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107063 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80107063:	6a 00                	push   $0x0
+  pushl $153
+80107065:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010706a:	e9 2b f5 ff ff       	jmp    8010659a <alltraps>
+
+8010706f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010706f:	6a 00                	push   $0x0
+  pushl $154
+80107071:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80107076:	e9 1f f5 ff ff       	jmp    8010659a <alltraps>
+
+8010707b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010707b:	6a 00                	push   $0x0
+  pushl $155
+8010707d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80107082:	e9 13 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107087 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80107087:	6a 00                	push   $0x0
+  pushl $156
+80107089:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010708e:	e9 07 f5 ff ff       	jmp    8010659a <alltraps>
+
+80107093 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80107093:	6a 00                	push   $0x0
+  pushl $157
+80107095:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010709a:	e9 fb f4 ff ff       	jmp    8010659a <alltraps>
+
+8010709f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010709f:	6a 00                	push   $0x0
+  pushl $158
+801070a1:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+801070a6:	e9 ef f4 ff ff       	jmp    8010659a <alltraps>
+
+801070ab <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+801070ab:	6a 00                	push   $0x0
+  pushl $159
+801070ad:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+801070b2:	e9 e3 f4 ff ff       	jmp    8010659a <alltraps>
+
+801070b7 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+801070b7:	6a 00                	push   $0x0
+  pushl $160
+801070b9:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+801070be:	e9 d7 f4 ff ff       	jmp    8010659a <alltraps>
+
+801070c3 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+801070c3:	6a 00                	push   $0x0
+  pushl $161
+801070c5:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+801070ca:	e9 cb f4 ff ff       	jmp    8010659a <alltraps>
+
+801070cf <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+801070cf:	6a 00                	push   $0x0
+  pushl $162
+801070d1:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+801070d6:	e9 bf f4 ff ff       	jmp    8010659a <alltraps>
+
+801070db <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+801070db:	6a 00                	push   $0x0
+  pushl $163
+801070dd:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+801070e2:	e9 b3 f4 ff ff       	jmp    8010659a <alltraps>
+
+801070e7 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+801070e7:	6a 00                	push   $0x0
+  pushl $164
+801070e9:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+801070ee:	e9 a7 f4 ff ff       	jmp    8010659a <alltraps>
+
+801070f3 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+801070f3:	6a 00                	push   $0x0
+  pushl $165
+801070f5:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+801070fa:	e9 9b f4 ff ff       	jmp    8010659a <alltraps>
+
+801070ff <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+801070ff:	6a 00                	push   $0x0
+  pushl $166
+80107101:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80107106:	e9 8f f4 ff ff       	jmp    8010659a <alltraps>
+
+8010710b <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010710b:	6a 00                	push   $0x0
+  pushl $167
+8010710d:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80107112:	e9 83 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107117 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80107117:	6a 00                	push   $0x0
+  pushl $168
+80107119:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010711e:	e9 77 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107123 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80107123:	6a 00                	push   $0x0
+  pushl $169
+80107125:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010712a:	e9 6b f4 ff ff       	jmp    8010659a <alltraps>
+
+8010712f <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010712f:	6a 00                	push   $0x0
+  pushl $170
+80107131:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80107136:	e9 5f f4 ff ff       	jmp    8010659a <alltraps>
+
+8010713b <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010713b:	6a 00                	push   $0x0
+  pushl $171
+8010713d:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80107142:	e9 53 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107147 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80107147:	6a 00                	push   $0x0
+  pushl $172
+80107149:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010714e:	e9 47 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107153 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80107153:	6a 00                	push   $0x0
+  pushl $173
+80107155:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010715a:	e9 3b f4 ff ff       	jmp    8010659a <alltraps>
+
+8010715f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010715f:	6a 00                	push   $0x0
+  pushl $174
+80107161:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80107166:	e9 2f f4 ff ff       	jmp    8010659a <alltraps>
+
+8010716b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010716b:	6a 00                	push   $0x0
+  pushl $175
+8010716d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80107172:	e9 23 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107177 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80107177:	6a 00                	push   $0x0
+  pushl $176
+80107179:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010717e:	e9 17 f4 ff ff       	jmp    8010659a <alltraps>
+
+80107183 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80107183:	6a 00                	push   $0x0
+  pushl $177
+80107185:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010718a:	e9 0b f4 ff ff       	jmp    8010659a <alltraps>
+
+8010718f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010718f:	6a 00                	push   $0x0
+  pushl $178
+80107191:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80107196:	e9 ff f3 ff ff       	jmp    8010659a <alltraps>
+
+8010719b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010719b:	6a 00                	push   $0x0
+  pushl $179
+8010719d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+801071a2:	e9 f3 f3 ff ff       	jmp    8010659a <alltraps>
+
+801071a7 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+801071a7:	6a 00                	push   $0x0
+  pushl $180
+801071a9:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+801071ae:	e9 e7 f3 ff ff       	jmp    8010659a <alltraps>
+
+801071b3 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+801071b3:	6a 00                	push   $0x0
+  pushl $181
+801071b5:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+801071ba:	e9 db f3 ff ff       	jmp    8010659a <alltraps>
+
+801071bf <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+801071bf:	6a 00                	push   $0x0
+  pushl $182
+801071c1:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+801071c6:	e9 cf f3 ff ff       	jmp    8010659a <alltraps>
+
+801071cb <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+801071cb:	6a 00                	push   $0x0
+  pushl $183
+801071cd:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+801071d2:	e9 c3 f3 ff ff       	jmp    8010659a <alltraps>
+
+801071d7 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+801071d7:	6a 00                	push   $0x0
+  pushl $184
+801071d9:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+801071de:	e9 b7 f3 ff ff       	jmp    8010659a <alltraps>
+
+801071e3 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+801071e3:	6a 00                	push   $0x0
+  pushl $185
+801071e5:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+801071ea:	e9 ab f3 ff ff       	jmp    8010659a <alltraps>
+
+801071ef <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+801071ef:	6a 00                	push   $0x0
+  pushl $186
+801071f1:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+801071f6:	e9 9f f3 ff ff       	jmp    8010659a <alltraps>
+
+801071fb <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+801071fb:	6a 00                	push   $0x0
+  pushl $187
+801071fd:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80107202:	e9 93 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107207 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80107207:	6a 00                	push   $0x0
+  pushl $188
+80107209:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010720e:	e9 87 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107213 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80107213:	6a 00                	push   $0x0
+  pushl $189
+80107215:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010721a:	e9 7b f3 ff ff       	jmp    8010659a <alltraps>
+
+8010721f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010721f:	6a 00                	push   $0x0
+  pushl $190
+80107221:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80107226:	e9 6f f3 ff ff       	jmp    8010659a <alltraps>
+
+8010722b <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010722b:	6a 00                	push   $0x0
+  pushl $191
+8010722d:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80107232:	e9 63 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107237 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80107237:	6a 00                	push   $0x0
+  pushl $192
+80107239:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010723e:	e9 57 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107243 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80107243:	6a 00                	push   $0x0
+  pushl $193
+80107245:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010724a:	e9 4b f3 ff ff       	jmp    8010659a <alltraps>
+
+8010724f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010724f:	6a 00                	push   $0x0
+  pushl $194
+80107251:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80107256:	e9 3f f3 ff ff       	jmp    8010659a <alltraps>
+
+8010725b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010725b:	6a 00                	push   $0x0
+  pushl $195
+8010725d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+80107262:	e9 33 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107267 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80107267:	6a 00                	push   $0x0
+  pushl $196
+80107269:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010726e:	e9 27 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107273 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80107273:	6a 00                	push   $0x0
+  pushl $197
+80107275:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010727a:	e9 1b f3 ff ff       	jmp    8010659a <alltraps>
+
+8010727f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010727f:	6a 00                	push   $0x0
+  pushl $198
+80107281:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80107286:	e9 0f f3 ff ff       	jmp    8010659a <alltraps>
+
+8010728b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010728b:	6a 00                	push   $0x0
+  pushl $199
+8010728d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80107292:	e9 03 f3 ff ff       	jmp    8010659a <alltraps>
+
+80107297 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80107297:	6a 00                	push   $0x0
+  pushl $200
+80107299:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010729e:	e9 f7 f2 ff ff       	jmp    8010659a <alltraps>
+
+801072a3 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+801072a3:	6a 00                	push   $0x0
+  pushl $201
+801072a5:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+801072aa:	e9 eb f2 ff ff       	jmp    8010659a <alltraps>
+
+801072af <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+801072af:	6a 00                	push   $0x0
+  pushl $202
+801072b1:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+801072b6:	e9 df f2 ff ff       	jmp    8010659a <alltraps>
+
+801072bb <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+801072bb:	6a 00                	push   $0x0
+  pushl $203
+801072bd:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+801072c2:	e9 d3 f2 ff ff       	jmp    8010659a <alltraps>
+
+801072c7 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+801072c7:	6a 00                	push   $0x0
+  pushl $204
+801072c9:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+801072ce:	e9 c7 f2 ff ff       	jmp    8010659a <alltraps>
+
+801072d3 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+801072d3:	6a 00                	push   $0x0
+  pushl $205
+801072d5:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+801072da:	e9 bb f2 ff ff       	jmp    8010659a <alltraps>
+
+801072df <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+801072df:	6a 00                	push   $0x0
+  pushl $206
+801072e1:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+801072e6:	e9 af f2 ff ff       	jmp    8010659a <alltraps>
+
+801072eb <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+801072eb:	6a 00                	push   $0x0
+  pushl $207
+801072ed:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+801072f2:	e9 a3 f2 ff ff       	jmp    8010659a <alltraps>
+
+801072f7 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+801072f7:	6a 00                	push   $0x0
+  pushl $208
+801072f9:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+801072fe:	e9 97 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107303 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80107303:	6a 00                	push   $0x0
+  pushl $209
+80107305:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010730a:	e9 8b f2 ff ff       	jmp    8010659a <alltraps>
+
+8010730f <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010730f:	6a 00                	push   $0x0
+  pushl $210
+80107311:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80107316:	e9 7f f2 ff ff       	jmp    8010659a <alltraps>
+
+8010731b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010731b:	6a 00                	push   $0x0
+  pushl $211
+8010731d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80107322:	e9 73 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107327 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80107327:	6a 00                	push   $0x0
+  pushl $212
+80107329:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010732e:	e9 67 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107333 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80107333:	6a 00                	push   $0x0
+  pushl $213
+80107335:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010733a:	e9 5b f2 ff ff       	jmp    8010659a <alltraps>
+
+8010733f <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010733f:	6a 00                	push   $0x0
+  pushl $214
+80107341:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80107346:	e9 4f f2 ff ff       	jmp    8010659a <alltraps>
+
+8010734b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010734b:	6a 00                	push   $0x0
+  pushl $215
+8010734d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80107352:	e9 43 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107357 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80107357:	6a 00                	push   $0x0
+  pushl $216
+80107359:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010735e:	e9 37 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107363 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80107363:	6a 00                	push   $0x0
+  pushl $217
+80107365:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010736a:	e9 2b f2 ff ff       	jmp    8010659a <alltraps>
+
+8010736f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010736f:	6a 00                	push   $0x0
+  pushl $218
+80107371:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80107376:	e9 1f f2 ff ff       	jmp    8010659a <alltraps>
+
+8010737b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010737b:	6a 00                	push   $0x0
+  pushl $219
+8010737d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80107382:	e9 13 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107387 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80107387:	6a 00                	push   $0x0
+  pushl $220
+80107389:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010738e:	e9 07 f2 ff ff       	jmp    8010659a <alltraps>
+
+80107393 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80107393:	6a 00                	push   $0x0
+  pushl $221
+80107395:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010739a:	e9 fb f1 ff ff       	jmp    8010659a <alltraps>
+
+8010739f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010739f:	6a 00                	push   $0x0
+  pushl $222
+801073a1:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+801073a6:	e9 ef f1 ff ff       	jmp    8010659a <alltraps>
+
+801073ab <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+801073ab:	6a 00                	push   $0x0
+  pushl $223
+801073ad:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+801073b2:	e9 e3 f1 ff ff       	jmp    8010659a <alltraps>
+
+801073b7 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+801073b7:	6a 00                	push   $0x0
+  pushl $224
+801073b9:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+801073be:	e9 d7 f1 ff ff       	jmp    8010659a <alltraps>
+
+801073c3 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+801073c3:	6a 00                	push   $0x0
+  pushl $225
+801073c5:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+801073ca:	e9 cb f1 ff ff       	jmp    8010659a <alltraps>
+
+801073cf <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+801073cf:	6a 00                	push   $0x0
+  pushl $226
+801073d1:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+801073d6:	e9 bf f1 ff ff       	jmp    8010659a <alltraps>
+
+801073db <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+801073db:	6a 00                	push   $0x0
+  pushl $227
+801073dd:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+801073e2:	e9 b3 f1 ff ff       	jmp    8010659a <alltraps>
+
+801073e7 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+801073e7:	6a 00                	push   $0x0
+  pushl $228
+801073e9:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+801073ee:	e9 a7 f1 ff ff       	jmp    8010659a <alltraps>
+
+801073f3 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+801073f3:	6a 00                	push   $0x0
+  pushl $229
+801073f5:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+801073fa:	e9 9b f1 ff ff       	jmp    8010659a <alltraps>
+
+801073ff <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+801073ff:	6a 00                	push   $0x0
+  pushl $230
+80107401:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80107406:	e9 8f f1 ff ff       	jmp    8010659a <alltraps>
+
+8010740b <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010740b:	6a 00                	push   $0x0
+  pushl $231
+8010740d:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80107412:	e9 83 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107417 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80107417:	6a 00                	push   $0x0
+  pushl $232
+80107419:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010741e:	e9 77 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107423 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80107423:	6a 00                	push   $0x0
+  pushl $233
+80107425:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010742a:	e9 6b f1 ff ff       	jmp    8010659a <alltraps>
+
+8010742f <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010742f:	6a 00                	push   $0x0
+  pushl $234
+80107431:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80107436:	e9 5f f1 ff ff       	jmp    8010659a <alltraps>
+
+8010743b <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010743b:	6a 00                	push   $0x0
+  pushl $235
+8010743d:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80107442:	e9 53 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107447 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80107447:	6a 00                	push   $0x0
+  pushl $236
+80107449:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010744e:	e9 47 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107453 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80107453:	6a 00                	push   $0x0
+  pushl $237
+80107455:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010745a:	e9 3b f1 ff ff       	jmp    8010659a <alltraps>
+
+8010745f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010745f:	6a 00                	push   $0x0
+  pushl $238
+80107461:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80107466:	e9 2f f1 ff ff       	jmp    8010659a <alltraps>
+
+8010746b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010746b:	6a 00                	push   $0x0
+  pushl $239
+8010746d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80107472:	e9 23 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107477 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80107477:	6a 00                	push   $0x0
+  pushl $240
+80107479:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010747e:	e9 17 f1 ff ff       	jmp    8010659a <alltraps>
+
+80107483 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80107483:	6a 00                	push   $0x0
+  pushl $241
+80107485:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010748a:	e9 0b f1 ff ff       	jmp    8010659a <alltraps>
+
+8010748f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010748f:	6a 00                	push   $0x0
+  pushl $242
+80107491:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80107496:	e9 ff f0 ff ff       	jmp    8010659a <alltraps>
+
+8010749b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010749b:	6a 00                	push   $0x0
+  pushl $243
+8010749d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+801074a2:	e9 f3 f0 ff ff       	jmp    8010659a <alltraps>
+
+801074a7 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+801074a7:	6a 00                	push   $0x0
+  pushl $244
+801074a9:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+801074ae:	e9 e7 f0 ff ff       	jmp    8010659a <alltraps>
+
+801074b3 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+801074b3:	6a 00                	push   $0x0
+  pushl $245
+801074b5:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+801074ba:	e9 db f0 ff ff       	jmp    8010659a <alltraps>
+
+801074bf <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+801074bf:	6a 00                	push   $0x0
+  pushl $246
+801074c1:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+801074c6:	e9 cf f0 ff ff       	jmp    8010659a <alltraps>
+
+801074cb <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+801074cb:	6a 00                	push   $0x0
+  pushl $247
+801074cd:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+801074d2:	e9 c3 f0 ff ff       	jmp    8010659a <alltraps>
+
+801074d7 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+801074d7:	6a 00                	push   $0x0
+  pushl $248
+801074d9:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+801074de:	e9 b7 f0 ff ff       	jmp    8010659a <alltraps>
+
+801074e3 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+801074e3:	6a 00                	push   $0x0
+  pushl $249
+801074e5:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+801074ea:	e9 ab f0 ff ff       	jmp    8010659a <alltraps>
+
+801074ef <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+801074ef:	6a 00                	push   $0x0
+  pushl $250
+801074f1:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+801074f6:	e9 9f f0 ff ff       	jmp    8010659a <alltraps>
+
+801074fb <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+801074fb:	6a 00                	push   $0x0
+  pushl $251
+801074fd:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80107502:	e9 93 f0 ff ff       	jmp    8010659a <alltraps>
+
+80107507 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80107507:	6a 00                	push   $0x0
+  pushl $252
+80107509:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010750e:	e9 87 f0 ff ff       	jmp    8010659a <alltraps>
+
+80107513 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80107513:	6a 00                	push   $0x0
+  pushl $253
+80107515:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010751a:	e9 7b f0 ff ff       	jmp    8010659a <alltraps>
+
+8010751f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010751f:	6a 00                	push   $0x0
+  pushl $254
+80107521:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80107526:	e9 6f f0 ff ff       	jmp    8010659a <alltraps>
+
+8010752b <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010752b:	6a 00                	push   $0x0
+  pushl $255
+8010752d:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80107532:	e9 63 f0 ff ff       	jmp    8010659a <alltraps>
+80107537:	66 90                	xchg   %ax,%ax
+80107539:	66 90                	xchg   %ax,%ax
+8010753b:	66 90                	xchg   %ax,%ax
+8010753d:	66 90                	xchg   %ax,%ax
+8010753f:	90                   	nop
+
+80107540 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80107540:	55                   	push   %ebp
+80107541:	89 e5                	mov    %esp,%ebp
+80107543:	57                   	push   %edi
+80107544:	56                   	push   %esi
+80107545:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+80107546:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010754c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80107552:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+80107555:	39 d3                	cmp    %edx,%ebx
+80107557:	73 56                	jae    801075af <deallocuvm.part.0+0x6f>
+80107559:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010755c:	89 c6                	mov    %eax,%esi
+8010755e:	89 d7                	mov    %edx,%edi
+80107560:	eb 12                	jmp    80107574 <deallocuvm.part.0+0x34>
+80107562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+80107568:	83 c2 01             	add    $0x1,%edx
+8010756b:	89 d3                	mov    %edx,%ebx
+8010756d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+80107570:	39 fb                	cmp    %edi,%ebx
+80107572:	73 38                	jae    801075ac <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+80107574:	89 da                	mov    %ebx,%edx
+80107576:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+80107579:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010757c:	a8 01                	test   $0x1,%al
+8010757e:	74 e8                	je     80107568 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+80107580:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107582:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80107587:	c1 e9 0a             	shr    $0xa,%ecx
+8010758a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+80107590:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+80107597:	85 c0                	test   %eax,%eax
+80107599:	74 cd                	je     80107568 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010759b:	8b 10                	mov    (%eax),%edx
+8010759d:	f6 c2 01             	test   $0x1,%dl
+801075a0:	75 1e                	jne    801075c0 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+801075a2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801075a8:	39 fb                	cmp    %edi,%ebx
+801075aa:	72 c8                	jb     80107574 <deallocuvm.part.0+0x34>
+801075ac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+801075af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801075b2:	89 c8                	mov    %ecx,%eax
+801075b4:	5b                   	pop    %ebx
+801075b5:	5e                   	pop    %esi
+801075b6:	5f                   	pop    %edi
+801075b7:	5d                   	pop    %ebp
+801075b8:	c3                   	ret
+801075b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+801075c0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+801075c6:	74 26                	je     801075ee <deallocuvm.part.0+0xae>
+      kfree(v);
+801075c8:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+801075cb:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+801075d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+801075d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+801075da:	52                   	push   %edx
+801075db:	e8 d0 af ff ff       	call   801025b0 <kfree>
+      *pte = 0;
+801075e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+801075e3:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+801075e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+801075ec:	eb 82                	jmp    80107570 <deallocuvm.part.0+0x30>
+        panic("kfree");
+801075ee:	83 ec 0c             	sub    $0xc,%esp
+801075f1:	68 aa 81 10 80       	push   $0x801081aa
+801075f6:	e8 85 8d ff ff       	call   80100380 <panic>
+801075fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801075ff:	90                   	nop
+
+80107600 <mappages>:
+{
+80107600:	55                   	push   %ebp
+80107601:	89 e5                	mov    %esp,%ebp
+80107603:	57                   	push   %edi
+80107604:	56                   	push   %esi
+80107605:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+80107606:	89 d3                	mov    %edx,%ebx
+80107608:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010760e:	83 ec 1c             	sub    $0x1c,%esp
+80107611:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+80107614:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+80107618:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010761d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80107620:	8b 45 08             	mov    0x8(%ebp),%eax
+80107623:	29 d8                	sub    %ebx,%eax
+80107625:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107628:	eb 3f                	jmp    80107669 <mappages+0x69>
+8010762a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+80107630:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107632:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80107637:	c1 ea 0a             	shr    $0xa,%edx
+8010763a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+80107640:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+80107647:	85 c0                	test   %eax,%eax
+80107649:	74 75                	je     801076c0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010764b:	f6 00 01             	testb  $0x1,(%eax)
+8010764e:	0f 85 86 00 00 00    	jne    801076da <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+80107654:	0b 75 0c             	or     0xc(%ebp),%esi
+80107657:	83 ce 01             	or     $0x1,%esi
+8010765a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010765c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010765f:	39 c3                	cmp    %eax,%ebx
+80107661:	74 6d                	je     801076d0 <mappages+0xd0>
+    a += PGSIZE;
+80107663:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+80107669:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010766c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010766f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+80107672:	89 d8                	mov    %ebx,%eax
+80107674:	c1 e8 16             	shr    $0x16,%eax
+80107677:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010767a:	8b 07                	mov    (%edi),%eax
+8010767c:	a8 01                	test   $0x1,%al
+8010767e:	75 b0                	jne    80107630 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+80107680:	e8 eb b0 ff ff       	call   80102770 <kalloc>
+80107685:	85 c0                	test   %eax,%eax
+80107687:	74 37                	je     801076c0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+80107689:	83 ec 04             	sub    $0x4,%esp
+8010768c:	68 00 10 00 00       	push   $0x1000
+80107691:	6a 00                	push   $0x0
+80107693:	50                   	push   %eax
+80107694:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80107697:	e8 24 d6 ff ff       	call   80104cc0 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010769c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010769f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+801076a2:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+801076a8:	83 c8 07             	or     $0x7,%eax
+801076ab:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+801076ad:	89 d8                	mov    %ebx,%eax
+801076af:	c1 e8 0a             	shr    $0xa,%eax
+801076b2:	25 fc 0f 00 00       	and    $0xffc,%eax
+801076b7:	01 d0                	add    %edx,%eax
+801076b9:	eb 90                	jmp    8010764b <mappages+0x4b>
+801076bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801076bf:	90                   	nop
+}
+801076c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+801076c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801076c8:	5b                   	pop    %ebx
+801076c9:	5e                   	pop    %esi
+801076ca:	5f                   	pop    %edi
+801076cb:	5d                   	pop    %ebp
+801076cc:	c3                   	ret
+801076cd:	8d 76 00             	lea    0x0(%esi),%esi
+801076d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801076d3:	31 c0                	xor    %eax,%eax
+}
+801076d5:	5b                   	pop    %ebx
+801076d6:	5e                   	pop    %esi
+801076d7:	5f                   	pop    %edi
+801076d8:	5d                   	pop    %ebp
+801076d9:	c3                   	ret
+      panic("remap");
+801076da:	83 ec 0c             	sub    $0xc,%esp
+801076dd:	68 a0 88 10 80       	push   $0x801088a0
+801076e2:	e8 99 8c ff ff       	call   80100380 <panic>
+801076e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801076ee:	66 90                	xchg   %ax,%ax
+
+801076f0 <seginit>:
+{
+801076f0:	55                   	push   %ebp
+801076f1:	89 e5                	mov    %esp,%ebp
+801076f3:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+801076f6:	e8 95 c2 ff ff       	call   80103990 <cpuid>
+  pd[0] = size-1;
+801076fb:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+80107700:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+80107706:	c7 80 18 28 11 80 ff 	movl   $0xffff,-0x7feed7e8(%eax)
+8010770d:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80107710:	c7 80 20 28 11 80 ff 	movl   $0xffff,-0x7feed7e0(%eax)
+80107717:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010771a:	c7 80 28 28 11 80 ff 	movl   $0xffff,-0x7feed7d8(%eax)
+80107721:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80107724:	c7 80 30 28 11 80 ff 	movl   $0xffff,-0x7feed7d0(%eax)
+8010772b:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010772e:	c7 80 1c 28 11 80 00 	movl   $0xcf9a00,-0x7feed7e4(%eax)
+80107735:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+80107738:	c7 80 24 28 11 80 00 	movl   $0xcf9200,-0x7feed7dc(%eax)
+8010773f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80107742:	c7 80 2c 28 11 80 00 	movl   $0xcffa00,-0x7feed7d4(%eax)
+80107749:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010774c:	c7 80 34 28 11 80 00 	movl   $0xcff200,-0x7feed7cc(%eax)
+80107753:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+80107756:	05 10 28 11 80       	add    $0x80112810,%eax
+8010775b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010775f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+80107763:	c1 e8 10             	shr    $0x10,%eax
+80107766:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010776a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010776d:	0f 01 10             	lgdtl  (%eax)
+}
+80107770:	c9                   	leave
+80107771:	c3                   	ret
+80107772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107780 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80107780:	a1 e4 81 11 80       	mov    0x801181e4,%eax
+80107785:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010778a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010778d:	c3                   	ret
+8010778e:	66 90                	xchg   %ax,%ax
+
+80107790 <switchuvm>:
+{
+80107790:	55                   	push   %ebp
+80107791:	89 e5                	mov    %esp,%ebp
+80107793:	57                   	push   %edi
+80107794:	56                   	push   %esi
+80107795:	53                   	push   %ebx
+80107796:	83 ec 1c             	sub    $0x1c,%esp
+80107799:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010779c:	85 f6                	test   %esi,%esi
+8010779e:	0f 84 cb 00 00 00    	je     8010786f <switchuvm+0xdf>
+  if(p->kstack == 0)
+801077a4:	8b 46 08             	mov    0x8(%esi),%eax
+801077a7:	85 c0                	test   %eax,%eax
+801077a9:	0f 84 da 00 00 00    	je     80107889 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+801077af:	8b 46 04             	mov    0x4(%esi),%eax
+801077b2:	85 c0                	test   %eax,%eax
+801077b4:	0f 84 c2 00 00 00    	je     8010787c <switchuvm+0xec>
+  pushcli();
+801077ba:	e8 d1 d2 ff ff       	call   80104a90 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+801077bf:	e8 6c c1 ff ff       	call   80103930 <mycpu>
+801077c4:	89 c3                	mov    %eax,%ebx
+801077c6:	e8 65 c1 ff ff       	call   80103930 <mycpu>
+801077cb:	89 c7                	mov    %eax,%edi
+801077cd:	e8 5e c1 ff ff       	call   80103930 <mycpu>
+801077d2:	83 c7 08             	add    $0x8,%edi
+801077d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801077d8:	e8 53 c1 ff ff       	call   80103930 <mycpu>
+801077dd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801077e0:	ba 67 00 00 00       	mov    $0x67,%edx
+801077e5:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+801077ec:	83 c0 08             	add    $0x8,%eax
+801077ef:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+801077f6:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+801077fb:	83 c1 08             	add    $0x8,%ecx
+801077fe:	c1 e8 18             	shr    $0x18,%eax
+80107801:	c1 e9 10             	shr    $0x10,%ecx
+80107804:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010780a:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+80107810:	b9 99 40 00 00       	mov    $0x4099,%ecx
+80107815:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010781c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+80107821:	e8 0a c1 ff ff       	call   80103930 <mycpu>
+80107826:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010782d:	e8 fe c0 ff ff       	call   80103930 <mycpu>
+80107832:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+80107836:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107839:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010783f:	e8 ec c0 ff ff       	call   80103930 <mycpu>
+80107844:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+80107847:	e8 e4 c0 ff ff       	call   80103930 <mycpu>
+8010784c:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+80107850:	b8 28 00 00 00       	mov    $0x28,%eax
+80107855:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+80107858:	8b 46 04             	mov    0x4(%esi),%eax
+8010785b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+80107860:	0f 22 d8             	mov    %eax,%cr3
+}
+80107863:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107866:	5b                   	pop    %ebx
+80107867:	5e                   	pop    %esi
+80107868:	5f                   	pop    %edi
+80107869:	5d                   	pop    %ebp
+  popcli();
+8010786a:	e9 71 d2 ff ff       	jmp    80104ae0 <popcli>
+    panic("switchuvm: no process");
+8010786f:	83 ec 0c             	sub    $0xc,%esp
+80107872:	68 a6 88 10 80       	push   $0x801088a6
+80107877:	e8 04 8b ff ff       	call   80100380 <panic>
+    panic("switchuvm: no pgdir");
+8010787c:	83 ec 0c             	sub    $0xc,%esp
+8010787f:	68 d1 88 10 80       	push   $0x801088d1
+80107884:	e8 f7 8a ff ff       	call   80100380 <panic>
+    panic("switchuvm: no kstack");
+80107889:	83 ec 0c             	sub    $0xc,%esp
+8010788c:	68 bc 88 10 80       	push   $0x801088bc
+80107891:	e8 ea 8a ff ff       	call   80100380 <panic>
+80107896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010789d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801078a0 <inituvm>:
+{
+801078a0:	55                   	push   %ebp
+801078a1:	89 e5                	mov    %esp,%ebp
+801078a3:	57                   	push   %edi
+801078a4:	56                   	push   %esi
+801078a5:	53                   	push   %ebx
+801078a6:	83 ec 1c             	sub    $0x1c,%esp
+801078a9:	8b 45 08             	mov    0x8(%ebp),%eax
+801078ac:	8b 75 10             	mov    0x10(%ebp),%esi
+801078af:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801078b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+801078b5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+801078bb:	77 49                	ja     80107906 <inituvm+0x66>
+  mem = kalloc();
+801078bd:	e8 ae ae ff ff       	call   80102770 <kalloc>
+  memset(mem, 0, PGSIZE);
+801078c2:	83 ec 04             	sub    $0x4,%esp
+801078c5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+801078ca:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+801078cc:	6a 00                	push   $0x0
+801078ce:	50                   	push   %eax
+801078cf:	e8 ec d3 ff ff       	call   80104cc0 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+801078d4:	58                   	pop    %eax
+801078d5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801078db:	5a                   	pop    %edx
+801078dc:	6a 06                	push   $0x6
+801078de:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801078e3:	31 d2                	xor    %edx,%edx
+801078e5:	50                   	push   %eax
+801078e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801078e9:	e8 12 fd ff ff       	call   80107600 <mappages>
+  memmove(mem, init, sz);
+801078ee:	89 75 10             	mov    %esi,0x10(%ebp)
+801078f1:	83 c4 10             	add    $0x10,%esp
+801078f4:	89 7d 0c             	mov    %edi,0xc(%ebp)
+801078f7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801078fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801078fd:	5b                   	pop    %ebx
+801078fe:	5e                   	pop    %esi
+801078ff:	5f                   	pop    %edi
+80107900:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+80107901:	e9 4a d4 ff ff       	jmp    80104d50 <memmove>
+    panic("inituvm: more than a page");
+80107906:	83 ec 0c             	sub    $0xc,%esp
+80107909:	68 e5 88 10 80       	push   $0x801088e5
+8010790e:	e8 6d 8a ff ff       	call   80100380 <panic>
+80107913:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010791a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107920 <loaduvm>:
+{
+80107920:	55                   	push   %ebp
+80107921:	89 e5                	mov    %esp,%ebp
+80107923:	57                   	push   %edi
+80107924:	56                   	push   %esi
+80107925:	53                   	push   %ebx
+80107926:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+80107929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010792c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010792f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+80107935:	0f 85 a2 00 00 00    	jne    801079dd <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010793b:	85 ff                	test   %edi,%edi
+8010793d:	74 7d                	je     801079bc <loaduvm+0x9c>
+8010793f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+80107940:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80107943:	8b 55 08             	mov    0x8(%ebp),%edx
+80107946:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+80107948:	89 c1                	mov    %eax,%ecx
+8010794a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010794d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+80107950:	f6 c1 01             	test   $0x1,%cl
+80107953:	75 13                	jne    80107968 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+80107955:	83 ec 0c             	sub    $0xc,%esp
+80107958:	68 ff 88 10 80       	push   $0x801088ff
+8010795d:	e8 1e 8a ff ff       	call   80100380 <panic>
+80107962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+80107968:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010796b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+80107971:	25 fc 0f 00 00       	and    $0xffc,%eax
+80107976:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010797d:	85 c9                	test   %ecx,%ecx
+8010797f:	74 d4                	je     80107955 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+80107981:	89 fb                	mov    %edi,%ebx
+80107983:	b8 00 10 00 00       	mov    $0x1000,%eax
+80107988:	29 f3                	sub    %esi,%ebx
+8010798a:	39 c3                	cmp    %eax,%ebx
+8010798c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010798f:	53                   	push   %ebx
+80107990:	8b 45 14             	mov    0x14(%ebp),%eax
+80107993:	01 f0                	add    %esi,%eax
+80107995:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+80107996:	8b 01                	mov    (%ecx),%eax
+80107998:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010799d:	05 00 00 00 80       	add    $0x80000000,%eax
+801079a2:	50                   	push   %eax
+801079a3:	ff 75 10             	push   0x10(%ebp)
+801079a6:	e8 c5 a1 ff ff       	call   80101b70 <readi>
+801079ab:	83 c4 10             	add    $0x10,%esp
+801079ae:	39 d8                	cmp    %ebx,%eax
+801079b0:	75 1e                	jne    801079d0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+801079b2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+801079b8:	39 fe                	cmp    %edi,%esi
+801079ba:	72 84                	jb     80107940 <loaduvm+0x20>
+}
+801079bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801079bf:	31 c0                	xor    %eax,%eax
+}
+801079c1:	5b                   	pop    %ebx
+801079c2:	5e                   	pop    %esi
+801079c3:	5f                   	pop    %edi
+801079c4:	5d                   	pop    %ebp
+801079c5:	c3                   	ret
+801079c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801079cd:	8d 76 00             	lea    0x0(%esi),%esi
+801079d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+801079d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801079d8:	5b                   	pop    %ebx
+801079d9:	5e                   	pop    %esi
+801079da:	5f                   	pop    %edi
+801079db:	5d                   	pop    %ebp
+801079dc:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+801079dd:	83 ec 0c             	sub    $0xc,%esp
+801079e0:	68 a0 89 10 80       	push   $0x801089a0
+801079e5:	e8 96 89 ff ff       	call   80100380 <panic>
+801079ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801079f0 <allocuvm>:
+{
+801079f0:	55                   	push   %ebp
+801079f1:	89 e5                	mov    %esp,%ebp
+801079f3:	57                   	push   %edi
+801079f4:	56                   	push   %esi
+801079f5:	53                   	push   %ebx
+801079f6:	83 ec 1c             	sub    $0x1c,%esp
+801079f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+801079fc:	85 f6                	test   %esi,%esi
+801079fe:	0f 88 98 00 00 00    	js     80107a9c <allocuvm+0xac>
+80107a04:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+80107a06:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107a09:	0f 82 a1 00 00 00    	jb     80107ab0 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+80107a0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107a12:	05 ff 0f 00 00       	add    $0xfff,%eax
+80107a17:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80107a1c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+80107a1e:	39 f0                	cmp    %esi,%eax
+80107a20:	0f 83 8d 00 00 00    	jae    80107ab3 <allocuvm+0xc3>
+80107a26:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80107a29:	eb 44                	jmp    80107a6f <allocuvm+0x7f>
+80107a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107a2f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+80107a30:	83 ec 04             	sub    $0x4,%esp
+80107a33:	68 00 10 00 00       	push   $0x1000
+80107a38:	6a 00                	push   $0x0
+80107a3a:	50                   	push   %eax
+80107a3b:	e8 80 d2 ff ff       	call   80104cc0 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+80107a40:	58                   	pop    %eax
+80107a41:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80107a47:	5a                   	pop    %edx
+80107a48:	6a 06                	push   $0x6
+80107a4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80107a4f:	89 fa                	mov    %edi,%edx
+80107a51:	50                   	push   %eax
+80107a52:	8b 45 08             	mov    0x8(%ebp),%eax
+80107a55:	e8 a6 fb ff ff       	call   80107600 <mappages>
+80107a5a:	83 c4 10             	add    $0x10,%esp
+80107a5d:	85 c0                	test   %eax,%eax
+80107a5f:	78 5f                	js     80107ac0 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+80107a61:	81 c7 00 10 00 00    	add    $0x1000,%edi
+80107a67:	39 f7                	cmp    %esi,%edi
+80107a69:	0f 83 89 00 00 00    	jae    80107af8 <allocuvm+0x108>
+    mem = kalloc();
+80107a6f:	e8 fc ac ff ff       	call   80102770 <kalloc>
+80107a74:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+80107a76:	85 c0                	test   %eax,%eax
+80107a78:	75 b6                	jne    80107a30 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+80107a7a:	83 ec 0c             	sub    $0xc,%esp
+80107a7d:	68 1d 89 10 80       	push   $0x8010891d
+80107a82:	e8 29 8c ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+80107a87:	83 c4 10             	add    $0x10,%esp
+80107a8a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107a8d:	74 0d                	je     80107a9c <allocuvm+0xac>
+80107a8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107a92:	8b 45 08             	mov    0x8(%ebp),%eax
+80107a95:	89 f2                	mov    %esi,%edx
+80107a97:	e8 a4 fa ff ff       	call   80107540 <deallocuvm.part.0>
+    return 0;
+80107a9c:	31 d2                	xor    %edx,%edx
+}
+80107a9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107aa1:	89 d0                	mov    %edx,%eax
+80107aa3:	5b                   	pop    %ebx
+80107aa4:	5e                   	pop    %esi
+80107aa5:	5f                   	pop    %edi
+80107aa6:	5d                   	pop    %ebp
+80107aa7:	c3                   	ret
+80107aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107aaf:	90                   	nop
+    return oldsz;
+80107ab0:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80107ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ab6:	89 d0                	mov    %edx,%eax
+80107ab8:	5b                   	pop    %ebx
+80107ab9:	5e                   	pop    %esi
+80107aba:	5f                   	pop    %edi
+80107abb:	5d                   	pop    %ebp
+80107abc:	c3                   	ret
+80107abd:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+80107ac0:	83 ec 0c             	sub    $0xc,%esp
+80107ac3:	68 35 89 10 80       	push   $0x80108935
+80107ac8:	e8 e3 8b ff ff       	call   801006b0 <cprintf>
+  if(newsz >= oldsz)
+80107acd:	83 c4 10             	add    $0x10,%esp
+80107ad0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107ad3:	74 0d                	je     80107ae2 <allocuvm+0xf2>
+80107ad5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+80107adb:	89 f2                	mov    %esi,%edx
+80107add:	e8 5e fa ff ff       	call   80107540 <deallocuvm.part.0>
+      kfree(mem);
+80107ae2:	83 ec 0c             	sub    $0xc,%esp
+80107ae5:	53                   	push   %ebx
+80107ae6:	e8 c5 aa ff ff       	call   801025b0 <kfree>
+      return 0;
+80107aeb:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80107aee:	31 d2                	xor    %edx,%edx
+80107af0:	eb ac                	jmp    80107a9e <allocuvm+0xae>
+80107af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107af8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+80107afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107afe:	5b                   	pop    %ebx
+80107aff:	5e                   	pop    %esi
+80107b00:	89 d0                	mov    %edx,%eax
+80107b02:	5f                   	pop    %edi
+80107b03:	5d                   	pop    %ebp
+80107b04:	c3                   	ret
+80107b05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107b10 <deallocuvm>:
+{
+80107b10:	55                   	push   %ebp
+80107b11:	89 e5                	mov    %esp,%ebp
+80107b13:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107b16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+80107b1c:	39 d1                	cmp    %edx,%ecx
+80107b1e:	73 10                	jae    80107b30 <deallocuvm+0x20>
+}
+80107b20:	5d                   	pop    %ebp
+80107b21:	e9 1a fa ff ff       	jmp    80107540 <deallocuvm.part.0>
+80107b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b2d:	8d 76 00             	lea    0x0(%esi),%esi
+80107b30:	89 d0                	mov    %edx,%eax
+80107b32:	5d                   	pop    %ebp
+80107b33:	c3                   	ret
+80107b34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b3f:	90                   	nop
+
+80107b40 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+80107b40:	55                   	push   %ebp
+80107b41:	89 e5                	mov    %esp,%ebp
+80107b43:	57                   	push   %edi
+80107b44:	56                   	push   %esi
+80107b45:	53                   	push   %ebx
+80107b46:	83 ec 0c             	sub    $0xc,%esp
+80107b49:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+80107b4c:	85 f6                	test   %esi,%esi
+80107b4e:	74 59                	je     80107ba9 <freevm+0x69>
+  if(newsz >= oldsz)
+80107b50:	31 c9                	xor    %ecx,%ecx
+80107b52:	ba 00 00 00 80       	mov    $0x80000000,%edx
+80107b57:	89 f0                	mov    %esi,%eax
+80107b59:	89 f3                	mov    %esi,%ebx
+80107b5b:	e8 e0 f9 ff ff       	call   80107540 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+80107b60:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+80107b66:	eb 0f                	jmp    80107b77 <freevm+0x37>
+80107b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b6f:	90                   	nop
+80107b70:	83 c3 04             	add    $0x4,%ebx
+80107b73:	39 fb                	cmp    %edi,%ebx
+80107b75:	74 23                	je     80107b9a <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+80107b77:	8b 03                	mov    (%ebx),%eax
+80107b79:	a8 01                	test   $0x1,%al
+80107b7b:	74 f3                	je     80107b70 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+80107b7d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+80107b82:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+80107b85:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+80107b88:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+80107b8d:	50                   	push   %eax
+80107b8e:	e8 1d aa ff ff       	call   801025b0 <kfree>
+80107b93:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+80107b96:	39 fb                	cmp    %edi,%ebx
+80107b98:	75 dd                	jne    80107b77 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+80107b9a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ba0:	5b                   	pop    %ebx
+80107ba1:	5e                   	pop    %esi
+80107ba2:	5f                   	pop    %edi
+80107ba3:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+80107ba4:	e9 07 aa ff ff       	jmp    801025b0 <kfree>
+    panic("freevm: no pgdir");
+80107ba9:	83 ec 0c             	sub    $0xc,%esp
+80107bac:	68 51 89 10 80       	push   $0x80108951
+80107bb1:	e8 ca 87 ff ff       	call   80100380 <panic>
+80107bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107bc0 <setupkvm>:
+{
+80107bc0:	55                   	push   %ebp
+80107bc1:	89 e5                	mov    %esp,%ebp
+80107bc3:	56                   	push   %esi
+80107bc4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+80107bc5:	e8 a6 ab ff ff       	call   80102770 <kalloc>
+80107bca:	85 c0                	test   %eax,%eax
+80107bcc:	74 5e                	je     80107c2c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+80107bce:	83 ec 04             	sub    $0x4,%esp
+80107bd1:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80107bd3:	bb 20 b4 10 80       	mov    $0x8010b420,%ebx
+  memset(pgdir, 0, PGSIZE);
+80107bd8:	68 00 10 00 00       	push   $0x1000
+80107bdd:	6a 00                	push   $0x0
+80107bdf:	50                   	push   %eax
+80107be0:	e8 db d0 ff ff       	call   80104cc0 <memset>
+80107be5:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+80107be8:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+80107beb:	83 ec 08             	sub    $0x8,%esp
+80107bee:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80107bf1:	8b 13                	mov    (%ebx),%edx
+80107bf3:	ff 73 0c             	push   0xc(%ebx)
+80107bf6:	50                   	push   %eax
+80107bf7:	29 c1                	sub    %eax,%ecx
+80107bf9:	89 f0                	mov    %esi,%eax
+80107bfb:	e8 00 fa ff ff       	call   80107600 <mappages>
+80107c00:	83 c4 10             	add    $0x10,%esp
+80107c03:	85 c0                	test   %eax,%eax
+80107c05:	78 19                	js     80107c20 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+80107c07:	83 c3 10             	add    $0x10,%ebx
+80107c0a:	81 fb 60 b4 10 80    	cmp    $0x8010b460,%ebx
+80107c10:	75 d6                	jne    80107be8 <setupkvm+0x28>
+}
+80107c12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c15:	89 f0                	mov    %esi,%eax
+80107c17:	5b                   	pop    %ebx
+80107c18:	5e                   	pop    %esi
+80107c19:	5d                   	pop    %ebp
+80107c1a:	c3                   	ret
+80107c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c1f:	90                   	nop
+      freevm(pgdir);
+80107c20:	83 ec 0c             	sub    $0xc,%esp
+80107c23:	56                   	push   %esi
+80107c24:	e8 17 ff ff ff       	call   80107b40 <freevm>
+      return 0;
+80107c29:	83 c4 10             	add    $0x10,%esp
+}
+80107c2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+80107c2f:	31 f6                	xor    %esi,%esi
+}
+80107c31:	89 f0                	mov    %esi,%eax
+80107c33:	5b                   	pop    %ebx
+80107c34:	5e                   	pop    %esi
+80107c35:	5d                   	pop    %ebp
+80107c36:	c3                   	ret
+80107c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c3e:	66 90                	xchg   %ax,%ax
+
+80107c40 <kvmalloc>:
+{
+80107c40:	55                   	push   %ebp
+80107c41:	89 e5                	mov    %esp,%ebp
+80107c43:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+80107c46:	e8 75 ff ff ff       	call   80107bc0 <setupkvm>
+80107c4b:	a3 e4 81 11 80       	mov    %eax,0x801181e4
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+80107c50:	05 00 00 00 80       	add    $0x80000000,%eax
+80107c55:	0f 22 d8             	mov    %eax,%cr3
+}
+80107c58:	c9                   	leave
+80107c59:	c3                   	ret
+80107c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107c60 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+80107c60:	55                   	push   %ebp
+80107c61:	89 e5                	mov    %esp,%ebp
+80107c63:	83 ec 08             	sub    $0x8,%esp
+80107c66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80107c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+80107c6c:	89 c1                	mov    %eax,%ecx
+80107c6e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+80107c71:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+80107c74:	f6 c2 01             	test   $0x1,%dl
+80107c77:	75 17                	jne    80107c90 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+80107c79:	83 ec 0c             	sub    $0xc,%esp
+80107c7c:	68 62 89 10 80       	push   $0x80108962
+80107c81:	e8 fa 86 ff ff       	call   80100380 <panic>
+80107c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c8d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+80107c90:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107c93:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+80107c99:	25 fc 0f 00 00       	and    $0xffc,%eax
+80107c9e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+80107ca5:	85 c0                	test   %eax,%eax
+80107ca7:	74 d0                	je     80107c79 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+80107ca9:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+80107cac:	c9                   	leave
+80107cad:	c3                   	ret
+80107cae:	66 90                	xchg   %ax,%ax
+
+80107cb0 <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+80107cb0:	55                   	push   %ebp
+80107cb1:	89 e5                	mov    %esp,%ebp
+80107cb3:	57                   	push   %edi
+80107cb4:	56                   	push   %esi
+80107cb5:	53                   	push   %ebx
+80107cb6:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+80107cb9:	e8 02 ff ff ff       	call   80107bc0 <setupkvm>
+80107cbe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107cc1:	85 c0                	test   %eax,%eax
+80107cc3:	0f 84 e9 00 00 00    	je     80107db2 <copyuvm+0x102>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+80107cc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107ccc:	85 c9                	test   %ecx,%ecx
+80107cce:	0f 84 b2 00 00 00    	je     80107d86 <copyuvm+0xd6>
+80107cd4:	31 f6                	xor    %esi,%esi
+80107cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cdd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*pde & PTE_P){
+80107ce0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+80107ce3:	89 f0                	mov    %esi,%eax
+80107ce5:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+80107ce8:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+80107ceb:	a8 01                	test   $0x1,%al
+80107ced:	75 11                	jne    80107d00 <copyuvm+0x50>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+80107cef:	83 ec 0c             	sub    $0xc,%esp
+80107cf2:	68 6c 89 10 80       	push   $0x8010896c
+80107cf7:	e8 84 86 ff ff       	call   80100380 <panic>
+80107cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+80107d00:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107d02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80107d07:	c1 ea 0a             	shr    $0xa,%edx
+80107d0a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+80107d10:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+80107d17:	85 c0                	test   %eax,%eax
+80107d19:	74 d4                	je     80107cef <copyuvm+0x3f>
+    if(!(*pte & PTE_P))
+80107d1b:	8b 00                	mov    (%eax),%eax
+80107d1d:	a8 01                	test   $0x1,%al
+80107d1f:	0f 84 9f 00 00 00    	je     80107dc4 <copyuvm+0x114>
+      panic("copyuvm: page not present");
+    pa = PTE_ADDR(*pte);
+80107d25:	89 c7                	mov    %eax,%edi
+    flags = PTE_FLAGS(*pte);
+80107d27:	25 ff 0f 00 00       	and    $0xfff,%eax
+80107d2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pa = PTE_ADDR(*pte);
+80107d2f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+    if((mem = kalloc()) == 0)
+80107d35:	e8 36 aa ff ff       	call   80102770 <kalloc>
+80107d3a:	89 c3                	mov    %eax,%ebx
+80107d3c:	85 c0                	test   %eax,%eax
+80107d3e:	74 64                	je     80107da4 <copyuvm+0xf4>
+      goto bad;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+80107d40:	83 ec 04             	sub    $0x4,%esp
+80107d43:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+80107d49:	68 00 10 00 00       	push   $0x1000
+80107d4e:	57                   	push   %edi
+80107d4f:	50                   	push   %eax
+80107d50:	e8 fb cf ff ff       	call   80104d50 <memmove>
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+80107d55:	58                   	pop    %eax
+80107d56:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80107d5c:	5a                   	pop    %edx
+80107d5d:	ff 75 e4             	push   -0x1c(%ebp)
+80107d60:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80107d65:	89 f2                	mov    %esi,%edx
+80107d67:	50                   	push   %eax
+80107d68:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107d6b:	e8 90 f8 ff ff       	call   80107600 <mappages>
+80107d70:	83 c4 10             	add    $0x10,%esp
+80107d73:	85 c0                	test   %eax,%eax
+80107d75:	78 21                	js     80107d98 <copyuvm+0xe8>
+  for(i = 0; i < sz; i += PGSIZE){
+80107d77:	81 c6 00 10 00 00    	add    $0x1000,%esi
+80107d7d:	3b 75 0c             	cmp    0xc(%ebp),%esi
+80107d80:	0f 82 5a ff ff ff    	jb     80107ce0 <copyuvm+0x30>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+80107d86:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107d89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107d8c:	5b                   	pop    %ebx
+80107d8d:	5e                   	pop    %esi
+80107d8e:	5f                   	pop    %edi
+80107d8f:	5d                   	pop    %ebp
+80107d90:	c3                   	ret
+80107d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      kfree(mem);
+80107d98:	83 ec 0c             	sub    $0xc,%esp
+80107d9b:	53                   	push   %ebx
+80107d9c:	e8 0f a8 ff ff       	call   801025b0 <kfree>
+      goto bad;
+80107da1:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+80107da4:	83 ec 0c             	sub    $0xc,%esp
+80107da7:	ff 75 e0             	push   -0x20(%ebp)
+80107daa:	e8 91 fd ff ff       	call   80107b40 <freevm>
+  return 0;
+80107daf:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80107db2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+80107db9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107dbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107dbf:	5b                   	pop    %ebx
+80107dc0:	5e                   	pop    %esi
+80107dc1:	5f                   	pop    %edi
+80107dc2:	5d                   	pop    %ebp
+80107dc3:	c3                   	ret
+      panic("copyuvm: page not present");
+80107dc4:	83 ec 0c             	sub    $0xc,%esp
+80107dc7:	68 86 89 10 80       	push   $0x80108986
+80107dcc:	e8 af 85 ff ff       	call   80100380 <panic>
+80107dd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ddf:	90                   	nop
+
+80107de0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+80107de0:	55                   	push   %ebp
+80107de1:	89 e5                	mov    %esp,%ebp
+80107de3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+80107de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+80107de9:	89 c1                	mov    %eax,%ecx
+80107deb:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+80107dee:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+80107df1:	f6 c2 01             	test   $0x1,%dl
+80107df4:	0f 84 00 01 00 00    	je     80107efa <uva2ka.cold>
+  return &pgtab[PTX(va)];
+80107dfa:	c1 e8 0c             	shr    $0xc,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107dfd:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if((*pte & PTE_P) == 0)
+    return 0;
+  if((*pte & PTE_U) == 0)
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+80107e03:	5d                   	pop    %ebp
+  return &pgtab[PTX(va)];
+80107e04:	25 ff 03 00 00       	and    $0x3ff,%eax
+  if((*pte & PTE_P) == 0)
+80107e09:	8b 84 82 00 00 00 80 	mov    -0x80000000(%edx,%eax,4),%eax
+  if((*pte & PTE_U) == 0)
+80107e10:	89 c2                	mov    %eax,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+80107e12:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+80107e17:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+80107e1a:	05 00 00 00 80       	add    $0x80000000,%eax
+80107e1f:	83 fa 05             	cmp    $0x5,%edx
+80107e22:	ba 00 00 00 00       	mov    $0x0,%edx
+80107e27:	0f 45 c2             	cmovne %edx,%eax
+}
+80107e2a:	c3                   	ret
+80107e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107e2f:	90                   	nop
+
+80107e30 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+80107e30:	55                   	push   %ebp
+80107e31:	89 e5                	mov    %esp,%ebp
+80107e33:	57                   	push   %edi
+80107e34:	56                   	push   %esi
+80107e35:	53                   	push   %ebx
+80107e36:	83 ec 0c             	sub    $0xc,%esp
+80107e39:	8b 75 14             	mov    0x14(%ebp),%esi
+80107e3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107e3f:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+80107e42:	85 f6                	test   %esi,%esi
+80107e44:	75 51                	jne    80107e97 <copyout+0x67>
+80107e46:	e9 a5 00 00 00       	jmp    80107ef0 <copyout+0xc0>
+80107e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107e4f:	90                   	nop
+  return (char*)P2V(PTE_ADDR(*pte));
+80107e50:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+80107e56:	8d 8b 00 00 00 80    	lea    -0x80000000(%ebx),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+80107e5c:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+80107e62:	74 75                	je     80107ed9 <copyout+0xa9>
+      return -1;
+    n = PGSIZE - (va - va0);
+80107e64:	89 fb                	mov    %edi,%ebx
+80107e66:	29 c3                	sub    %eax,%ebx
+80107e68:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80107e6e:	39 f3                	cmp    %esi,%ebx
+80107e70:	0f 47 de             	cmova  %esi,%ebx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+80107e73:	29 f8                	sub    %edi,%eax
+80107e75:	83 ec 04             	sub    $0x4,%esp
+80107e78:	01 c1                	add    %eax,%ecx
+80107e7a:	53                   	push   %ebx
+80107e7b:	52                   	push   %edx
+80107e7c:	89 55 10             	mov    %edx,0x10(%ebp)
+80107e7f:	51                   	push   %ecx
+80107e80:	e8 cb ce ff ff       	call   80104d50 <memmove>
+    len -= n;
+    buf += n;
+80107e85:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+80107e88:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+80107e8e:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+80107e91:	01 da                	add    %ebx,%edx
+  while(len > 0){
+80107e93:	29 de                	sub    %ebx,%esi
+80107e95:	74 59                	je     80107ef0 <copyout+0xc0>
+  if(*pde & PTE_P){
+80107e97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+80107e9a:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+80107e9c:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+80107e9e:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+80107ea1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+80107ea7:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+80107eaa:	f6 c1 01             	test   $0x1,%cl
+80107ead:	0f 84 4e 00 00 00    	je     80107f01 <copyout.cold>
+  return &pgtab[PTX(va)];
+80107eb3:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80107eb5:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+80107ebb:	c1 eb 0c             	shr    $0xc,%ebx
+80107ebe:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  if((*pte & PTE_P) == 0)
+80107ec4:	8b 9c 99 00 00 00 80 	mov    -0x80000000(%ecx,%ebx,4),%ebx
+  if((*pte & PTE_U) == 0)
+80107ecb:	89 d9                	mov    %ebx,%ecx
+80107ecd:	83 e1 05             	and    $0x5,%ecx
+80107ed0:	83 f9 05             	cmp    $0x5,%ecx
+80107ed3:	0f 84 77 ff ff ff    	je     80107e50 <copyout+0x20>
+  }
+  return 0;
+}
+80107ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+80107edc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107ee1:	5b                   	pop    %ebx
+80107ee2:	5e                   	pop    %esi
+80107ee3:	5f                   	pop    %edi
+80107ee4:	5d                   	pop    %ebp
+80107ee5:	c3                   	ret
+80107ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eed:	8d 76 00             	lea    0x0(%esi),%esi
+80107ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80107ef3:	31 c0                	xor    %eax,%eax
+}
+80107ef5:	5b                   	pop    %ebx
+80107ef6:	5e                   	pop    %esi
+80107ef7:	5f                   	pop    %edi
+80107ef8:	5d                   	pop    %ebp
+80107ef9:	c3                   	ret
+
+80107efa <uva2ka.cold>:
+  if((*pte & PTE_P) == 0)
+80107efa:	a1 00 00 00 00       	mov    0x0,%eax
+80107eff:	0f 0b                	ud2
+
+80107f01 <copyout.cold>:
+80107f01:	a1 00 00 00 00       	mov    0x0,%eax
+80107f06:	0f 0b                	ud2
@@ -0,0 +1,1569 @@
+
+_pmanager:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+int checkspace(char*);
+char* getop(char*, char*);
+
+int
+main(void) 
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+  printf(2, "[pmanager]: ");
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	68 d8 0a 00 00       	push   $0xad8
+  19:	6a 02                	push   $0x2
+  1b:	e8 90 07 00 00       	call   7b0 <printf>
+  memset(buf, 0, nbuf);
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	6a 64                	push   $0x64
+  25:	6a 00                	push   $0x0
+  27:	68 80 0f 00 00       	push   $0xf80
+  2c:	e8 7f 04 00 00       	call   4b0 <memset>
+  gets(buf, nbuf);
+  31:	58                   	pop    %eax
+  32:	5a                   	pop    %edx
+  33:	6a 64                	push   $0x64
+  35:	68 80 0f 00 00       	push   $0xf80
+  3a:	e8 d1 04 00 00       	call   510 <gets>
+  if(buf[0] == 0) // EOF
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	80 3d 80 0f 00 00 00 	cmpb   $0x0,0xf80
+  49:	74 1a                	je     65 <main+0x65>
+    status = parserun(buf);
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	68 80 0f 00 00       	push   $0xf80
+  53:	e8 e8 00 00 00       	call   140 <parserun>
+    switch (status) {
+  58:	83 c4 10             	add    $0x10,%esp
+  5b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  5e:	74 10                	je     70 <main+0x70>
+  60:	83 f8 01             	cmp    $0x1,%eax
+  63:	75 ac                	jne    11 <main+0x11>
+  exit();
+  65:	e8 c9 05 00 00       	call   633 <exit>
+  6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printf(1, "bad command for pmanager!\n");
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	68 a1 0b 00 00       	push   $0xba1
+  78:	6a 01                	push   $0x1
+  7a:	e8 31 07 00 00       	call   7b0 <printf>
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	eb 8d                	jmp    11 <main+0x11>
+  84:	66 90                	xchg   %ax,%ax
+  86:	66 90                	xchg   %ax,%ax
+  88:	66 90                	xchg   %ax,%ax
+  8a:	66 90                	xchg   %ax,%ax
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <getcmd>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "[pmanager]: ");
+  9b:	83 ec 08             	sub    $0x8,%esp
+  9e:	68 d8 0a 00 00       	push   $0xad8
+  a3:	6a 02                	push   $0x2
+  a5:	e8 06 07 00 00       	call   7b0 <printf>
+  memset(buf, 0, nbuf);
+  aa:	83 c4 0c             	add    $0xc,%esp
+  ad:	56                   	push   %esi
+  ae:	6a 00                	push   $0x0
+  b0:	53                   	push   %ebx
+  b1:	e8 fa 03 00 00       	call   4b0 <memset>
+  gets(buf, nbuf);
+  b6:	58                   	pop    %eax
+  b7:	5a                   	pop    %edx
+  b8:	56                   	push   %esi
+  b9:	53                   	push   %ebx
+  ba:	e8 51 04 00 00       	call   510 <gets>
+  if(buf[0] == 0) // EOF
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	80 3b 01             	cmpb   $0x1,(%ebx)
+  c5:	19 c0                	sbb    %eax,%eax
+    return -1;
+  return 0;
+}
+  c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ca:	5b                   	pop    %ebx
+  cb:	5e                   	pop    %esi
+  cc:	5d                   	pop    %ebp
+  cd:	c3                   	ret
+  ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <getop>:
+}
+
+// Parse op and return string after current op.
+char *
+getop(char *src, char *dst) 
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	53                   	push   %ebx
+  d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+
+// -1 for null, 0 for spaces, 1 for others
+int
+checkspace(char *str)
+{
+  if (*str == 0) 
+  da:	0f b6 10             	movzbl (%eax),%edx
+  dd:	84 d2                	test   %dl,%dl
+  df:	74 23                	je     104 <getop+0x34>
+  e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+
+  if (*str == ' ' || *str == '\n' || *str == '\t')
+  e8:	8d 5a f7             	lea    -0x9(%edx),%ebx
+  eb:	80 fb 01             	cmp    $0x1,%bl
+  ee:	76 14                	jbe    104 <getop+0x34>
+  f0:	80 fa 20             	cmp    $0x20,%dl
+  f3:	74 0f                	je     104 <getop+0x34>
+    src++;
+  f5:	83 c0 01             	add    $0x1,%eax
+    *dst = *src;
+  f8:	88 11                	mov    %dl,(%ecx)
+    dst++;
+  fa:	83 c1 01             	add    $0x1,%ecx
+  if (*str == 0) 
+  fd:	0f b6 10             	movzbl (%eax),%edx
+ 100:	84 d2                	test   %dl,%dl
+ 102:	75 e4                	jne    e8 <getop+0x18>
+  *dst = 0;
+ 104:	c6 01 00             	movb   $0x0,(%ecx)
+  if (*str == 0) 
+ 107:	0f b6 10             	movzbl (%eax),%edx
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	74 0f                	je     11d <getop+0x4d>
+ 10e:	66 90                	xchg   %ax,%ax
+  if (*str == ' ' || *str == '\n' || *str == '\t')
+ 110:	8d 4a f7             	lea    -0x9(%edx),%ecx
+ 113:	80 f9 01             	cmp    $0x1,%cl
+ 116:	76 10                	jbe    128 <getop+0x58>
+ 118:	80 fa 20             	cmp    $0x20,%dl
+ 11b:	74 0b                	je     128 <getop+0x58>
+}
+ 11d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 120:	c9                   	leave
+ 121:	c3                   	ret
+ 122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if (*str == 0) 
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    src++;
+ 12c:	83 c0 01             	add    $0x1,%eax
+  if (*str == 0) 
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	75 dd                	jne    110 <getop+0x40>
+}
+ 133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 136:	c9                   	leave
+ 137:	c3                   	ret
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <parserun>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	56                   	push   %esi
+  char *next = getop(buf, op);
+ 145:	8d b5 20 ff ff ff    	lea    -0xe0(%ebp),%esi
+{
+ 14b:	53                   	push   %ebx
+ 14c:	81 ec 24 01 00 00    	sub    $0x124,%esp
+  char *next = getop(buf, op);
+ 152:	56                   	push   %esi
+ 153:	ff 75 08             	push   0x8(%ebp)
+ 156:	e8 75 ff ff ff       	call   d0 <getop>
+  if (!strcmp(op, "exit")) {
+ 15b:	59                   	pop    %ecx
+ 15c:	5b                   	pop    %ebx
+ 15d:	68 e5 0a 00 00       	push   $0xae5
+ 162:	56                   	push   %esi
+  char *next = getop(buf, op);
+ 163:	89 c7                	mov    %eax,%edi
+    return 1;
+ 165:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if (!strcmp(op, "exit")) {
+ 16a:	e8 b1 02 00 00       	call   420 <strcmp>
+ 16f:	83 c4 10             	add    $0x10,%esp
+ 172:	85 c0                	test   %eax,%eax
+ 174:	75 0a                	jne    180 <parserun+0x40>
+}
+ 176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 179:	89 d8                	mov    %ebx,%eax
+ 17b:	5b                   	pop    %ebx
+ 17c:	5e                   	pop    %esi
+ 17d:	5f                   	pop    %edi
+ 17e:	5d                   	pop    %ebp
+ 17f:	c3                   	ret
+  if (!strcmp(op, "list")) {
+ 180:	83 ec 08             	sub    $0x8,%esp
+ 183:	68 ea 0a 00 00       	push   $0xaea
+ 188:	56                   	push   %esi
+ 189:	e8 92 02 00 00       	call   420 <strcmp>
+ 18e:	83 c4 10             	add    $0x10,%esp
+ 191:	89 c3                	mov    %eax,%ebx
+ 193:	85 c0                	test   %eax,%eax
+ 195:	0f 84 05 01 00 00    	je     2a0 <parserun+0x160>
+  if (!strcmp(op, "kill")) {
+ 19b:	83 ec 08             	sub    $0x8,%esp
+ 19e:	68 ef 0a 00 00       	push   $0xaef
+ 1a3:	56                   	push   %esi
+ 1a4:	e8 77 02 00 00       	call   420 <strcmp>
+ 1a9:	83 c4 10             	add    $0x10,%esp
+ 1ac:	85 c0                	test   %eax,%eax
+ 1ae:	0f 84 94 00 00 00    	je     248 <parserun+0x108>
+  if (!strcmp(op, "execute")) {
+ 1b4:	83 ec 08             	sub    $0x8,%esp
+ 1b7:	68 20 0b 00 00       	push   $0xb20
+ 1bc:	56                   	push   %esi
+ 1bd:	e8 5e 02 00 00       	call   420 <strcmp>
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	89 c3                	mov    %eax,%ebx
+ 1c7:	85 c0                	test   %eax,%eax
+ 1c9:	0f 85 e1 00 00 00    	jne    2b0 <parserun+0x170>
+    getop(getop(next, path), stacksizestr);
+ 1cf:	83 ec 08             	sub    $0x8,%esp
+ 1d2:	8d 75 84             	lea    -0x7c(%ebp),%esi
+ 1d5:	56                   	push   %esi
+ 1d6:	57                   	push   %edi
+ 1d7:	e8 f4 fe ff ff       	call   d0 <getop>
+ 1dc:	5f                   	pop    %edi
+ 1dd:	8d bd e4 fe ff ff    	lea    -0x11c(%ebp),%edi
+ 1e3:	5a                   	pop    %edx
+ 1e4:	57                   	push   %edi
+ 1e5:	50                   	push   %eax
+ 1e6:	e8 e5 fe ff ff       	call   d0 <getop>
+    if ((stacksize = atoi(stacksizestr)) <= 0) {
+ 1eb:	89 3c 24             	mov    %edi,(%esp)
+ 1ee:	e8 cd 03 00 00       	call   5c0 <atoi>
+ 1f3:	83 c4 10             	add    $0x10,%esp
+ 1f6:	89 c7                	mov    %eax,%edi
+ 1f8:	85 c0                	test   %eax,%eax
+ 1fa:	0f 8e 70 01 00 00    	jle    370 <parserun+0x230>
+    argv[0] = path;
+ 200:	89 b5 f8 fe ff ff    	mov    %esi,-0x108(%ebp)
+    if ((pid = fork()) != 0) {
+ 206:	e8 20 04 00 00       	call   62b <fork>
+ 20b:	85 c0                	test   %eax,%eax
+ 20d:	0f 85 63 ff ff ff    	jne    176 <parserun+0x36>
+    int status = exec2(path, argv, stacksize);
+ 213:	83 ec 04             	sub    $0x4,%esp
+ 216:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+ 21c:	57                   	push   %edi
+ 21d:	50                   	push   %eax
+ 21e:	56                   	push   %esi
+ 21f:	e8 4f 04 00 00       	call   673 <exec2>
+    if (status) {
+ 224:	83 c4 10             	add    $0x10,%esp
+ 227:	85 c0                	test   %eax,%eax
+ 229:	0f 84 47 ff ff ff    	je     176 <parserun+0x36>
+      printf(1, "exec failed\n");
+ 22f:	53                   	push   %ebx
+ 230:	53                   	push   %ebx
+ 231:	68 3f 0b 00 00       	push   $0xb3f
+ 236:	6a 01                	push   $0x1
+ 238:	e8 73 05 00 00       	call   7b0 <printf>
+      exit();
+ 23d:	e8 f1 03 00 00       	call   633 <exit>
+ 242:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    getop(next, pidstr);
+ 248:	83 ec 08             	sub    $0x8,%esp
+ 24b:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+ 24e:	53                   	push   %ebx
+ 24f:	57                   	push   %edi
+ 250:	e8 7b fe ff ff       	call   d0 <getop>
+    if ((pid = atoi(pidstr)) <= 0) {
+ 255:	89 1c 24             	mov    %ebx,(%esp)
+      return -1;
+ 258:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    if ((pid = atoi(pidstr)) <= 0) {
+ 25d:	e8 5e 03 00 00       	call   5c0 <atoi>
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	89 c6                	mov    %eax,%esi
+ 267:	85 c0                	test   %eax,%eax
+ 269:	0f 8e 07 ff ff ff    	jle    176 <parserun+0x36>
+    int status = kill(pid);
+ 26f:	83 ec 0c             	sub    $0xc,%esp
+ 272:	50                   	push   %eax
+ 273:	e8 eb 03 00 00       	call   663 <kill>
+    if (!status) printf(1, "successfully killed pid: %d\n", pid);
+ 278:	83 c4 10             	add    $0x10,%esp
+    int status = kill(pid);
+ 27b:	89 c3                	mov    %eax,%ebx
+    if (!status) printf(1, "successfully killed pid: %d\n", pid);
+ 27d:	85 c0                	test   %eax,%eax
+ 27f:	0f 85 a3 00 00 00    	jne    328 <parserun+0x1e8>
+ 285:	83 ec 04             	sub    $0x4,%esp
+ 288:	56                   	push   %esi
+ 289:	68 f4 0a 00 00       	push   $0xaf4
+ 28e:	6a 01                	push   $0x1
+ 290:	e8 1b 05 00 00       	call   7b0 <printf>
+ 295:	83 c4 10             	add    $0x10,%esp
+ 298:	e9 d9 fe ff ff       	jmp    176 <parserun+0x36>
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    listproc();
+ 2a0:	e8 3e 04 00 00       	call   6e3 <listproc>
+}
+ 2a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2a8:	89 d8                	mov    %ebx,%eax
+ 2aa:	5b                   	pop    %ebx
+ 2ab:	5e                   	pop    %esi
+ 2ac:	5f                   	pop    %edi
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+  if (!strcmp(op, "memlimit")) {
+ 2b0:	83 ec 08             	sub    $0x8,%esp
+ 2b3:	68 4c 0b 00 00       	push   $0xb4c
+ 2b8:	56                   	push   %esi
+ 2b9:	e8 62 01 00 00       	call   420 <strcmp>
+ 2be:	83 c4 10             	add    $0x10,%esp
+ 2c1:	85 c0                	test   %eax,%eax
+ 2c3:	0f 85 de 00 00 00    	jne    3a7 <parserun+0x267>
+    getop(getop(next, pidstr), limstr);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+ 2d2:	8d 75 84             	lea    -0x7c(%ebp),%esi
+ 2d5:	53                   	push   %ebx
+ 2d6:	57                   	push   %edi
+ 2d7:	e8 f4 fd ff ff       	call   d0 <getop>
+ 2dc:	5a                   	pop    %edx
+ 2dd:	59                   	pop    %ecx
+ 2de:	56                   	push   %esi
+ 2df:	50                   	push   %eax
+ 2e0:	e8 eb fd ff ff       	call   d0 <getop>
+    if ((pid = atoi(pidstr)) <= 0 || (limit = atoi(limstr)) < 0) {
+ 2e5:	89 1c 24             	mov    %ebx,(%esp)
+ 2e8:	e8 d3 02 00 00       	call   5c0 <atoi>
+ 2ed:	83 c4 10             	add    $0x10,%esp
+ 2f0:	89 c3                	mov    %eax,%ebx
+ 2f2:	85 c0                	test   %eax,%eax
+ 2f4:	7e 10                	jle    306 <parserun+0x1c6>
+ 2f6:	83 ec 0c             	sub    $0xc,%esp
+ 2f9:	56                   	push   %esi
+ 2fa:	e8 c1 02 00 00       	call   5c0 <atoi>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+ 302:	85 c0                	test   %eax,%eax
+ 304:	79 3a                	jns    340 <parserun+0x200>
+      printf(1, "pid and limit must be int\n");
+ 306:	83 ec 08             	sub    $0x8,%esp
+      return -1;
+ 309:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      printf(1, "pid and limit must be int\n");
+ 30e:	68 55 0b 00 00       	push   $0xb55
+ 313:	6a 01                	push   $0x1
+ 315:	e8 96 04 00 00       	call   7b0 <printf>
+      return -1;
+ 31a:	83 c4 10             	add    $0x10,%esp
+ 31d:	e9 54 fe ff ff       	jmp    176 <parserun+0x36>
+ 322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    else printf(1, "killed failed\n");
+ 328:	83 ec 08             	sub    $0x8,%esp
+ 32b:	68 11 0b 00 00       	push   $0xb11
+ 330:	6a 01                	push   $0x1
+ 332:	e8 79 04 00 00       	call   7b0 <printf>
+ 337:	83 c4 10             	add    $0x10,%esp
+ 33a:	e9 37 fe ff ff       	jmp    176 <parserun+0x36>
+ 33f:	90                   	nop
+    int status = setmemorylimit(pid, limit);
+ 340:	83 ec 08             	sub    $0x8,%esp
+ 343:	50                   	push   %eax
+ 344:	53                   	push   %ebx
+ 345:	e8 91 03 00 00       	call   6db <setmemorylimit>
+    if (status) printf(1, "setmemorylimit failed\n");
+ 34a:	83 c4 10             	add    $0x10,%esp
+    int status = setmemorylimit(pid, limit);
+ 34d:	89 c3                	mov    %eax,%ebx
+    if (status) printf(1, "setmemorylimit failed\n");
+ 34f:	85 c0                	test   %eax,%eax
+ 351:	74 3d                	je     390 <parserun+0x250>
+ 353:	83 ec 08             	sub    $0x8,%esp
+ 356:	68 70 0b 00 00       	push   $0xb70
+ 35b:	6a 01                	push   $0x1
+ 35d:	e8 4e 04 00 00       	call   7b0 <printf>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	e9 0c fe ff ff       	jmp    176 <parserun+0x36>
+ 36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(1, "stacksize must be int\n");
+ 370:	83 ec 08             	sub    $0x8,%esp
+      return -1;
+ 373:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      printf(1, "stacksize must be int\n");
+ 378:	68 28 0b 00 00       	push   $0xb28
+ 37d:	6a 01                	push   $0x1
+ 37f:	e8 2c 04 00 00       	call   7b0 <printf>
+      return -1;
+ 384:	83 c4 10             	add    $0x10,%esp
+ 387:	e9 ea fd ff ff       	jmp    176 <parserun+0x36>
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    else printf(1, "setmemorylimit succeeded\n");
+ 390:	83 ec 08             	sub    $0x8,%esp
+ 393:	68 87 0b 00 00       	push   $0xb87
+ 398:	6a 01                	push   $0x1
+ 39a:	e8 11 04 00 00       	call   7b0 <printf>
+ 39f:	83 c4 10             	add    $0x10,%esp
+ 3a2:	e9 cf fd ff ff       	jmp    176 <parserun+0x36>
+  return -1;
+ 3a7:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ 3ac:	e9 c5 fd ff ff       	jmp    176 <parserun+0x36>
+ 3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <checkspace>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  if (*str == 0) 
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 10             	movzbl (%eax),%edx
+ 3c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3ce:	84 d2                	test   %dl,%dl
+ 3d0:	74 16                	je     3e8 <checkspace+0x28>
+  if (*str == ' ' || *str == '\n' || *str == '\t')
+ 3d2:	8d 42 f7             	lea    -0x9(%edx),%eax
+ 3d5:	3c 01                	cmp    $0x1,%al
+ 3d7:	0f 96 c0             	setbe  %al
+ 3da:	80 fa 20             	cmp    $0x20,%dl
+ 3dd:	0f 94 c2             	sete   %dl
+ 3e0:	09 d0                	or     %edx,%eax
+ 3e2:	83 f0 01             	xor    $0x1,%eax
+ 3e5:	0f b6 c0             	movzbl %al,%eax
+    return 0;
+
+  return 1;
+ 3e8:	5d                   	pop    %ebp
+ 3e9:	c3                   	ret
+ 3ea:	66 90                	xchg   %ax,%ax
+ 3ec:	66 90                	xchg   %ax,%ax
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 400:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 404:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 407:	83 c0 01             	add    $0x1,%eax
+ 40a:	84 d2                	test   %dl,%dl
+ 40c:	75 f2                	jne    400 <strcpy+0x10>
+    ;
+  return os;
+}
+ 40e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+ 427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 42a:	0f b6 02             	movzbl (%edx),%eax
+ 42d:	84 c0                	test   %al,%al
+ 42f:	75 17                	jne    448 <strcmp+0x28>
+ 431:	eb 3a                	jmp    46d <strcmp+0x4d>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 43c:	83 c2 01             	add    $0x1,%edx
+ 43f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 442:	84 c0                	test   %al,%al
+ 444:	74 1a                	je     460 <strcmp+0x40>
+    p++, q++;
+ 446:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 448:	0f b6 19             	movzbl (%ecx),%ebx
+ 44b:	38 c3                	cmp    %al,%bl
+ 44d:	74 e9                	je     438 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 44f:	29 d8                	sub    %ebx,%eax
+}
+ 451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 454:	c9                   	leave
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 460:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 464:	31 c0                	xor    %eax,%eax
+ 466:	29 d8                	sub    %ebx,%eax
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+ 46c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 46d:	0f b6 19             	movzbl (%ecx),%ebx
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	eb db                	jmp    44f <strcmp+0x2f>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 486:	80 3a 00             	cmpb   $0x0,(%edx)
+ 489:	74 15                	je     4a0 <strlen+0x20>
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+ 490:	83 c0 01             	add    $0x1,%eax
+ 493:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 497:	89 c1                	mov    %eax,%ecx
+ 499:	75 f5                	jne    490 <strlen+0x10>
+    ;
+  return n;
+}
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	5d                   	pop    %ebp
+ 49e:	c3                   	ret
+ 49f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4a0:	31 c9                	xor    %ecx,%ecx
+}
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	89 c8                	mov    %ecx,%eax
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 d7                	mov    %edx,%edi
+ 4bf:	fc                   	cld
+ 4c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	c9                   	leave
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4da:	0f b6 10             	movzbl (%eax),%edx
+ 4dd:	84 d2                	test   %dl,%dl
+ 4df:	75 12                	jne    4f3 <strchr+0x23>
+ 4e1:	eb 1d                	jmp    500 <strchr+0x30>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	84 d2                	test   %dl,%dl
+ 4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+ 4f3:	38 d1                	cmp    %dl,%cl
+ 4f5:	75 f1                	jne    4e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 500:	31 c0                	xor    %eax,%eax
+}
+ 502:	5d                   	pop    %ebp
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 515:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 518:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 519:	31 db                	xor    %ebx,%ebx
+{
+ 51b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 51e:	eb 27                	jmp    547 <gets+0x37>
+    cc = read(0, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	6a 01                	push   $0x1
+ 525:	56                   	push   %esi
+ 526:	6a 00                	push   $0x0
+ 528:	e8 1e 01 00 00       	call   64b <read>
+    if(cc < 1)
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	85 c0                	test   %eax,%eax
+ 532:	7e 1d                	jle    551 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 534:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 53f:	3c 0a                	cmp    $0xa,%al
+ 541:	74 10                	je     553 <gets+0x43>
+ 543:	3c 0d                	cmp    $0xd,%al
+ 545:	74 0c                	je     553 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 547:	89 df                	mov    %ebx,%edi
+ 549:	83 c3 01             	add    $0x1,%ebx
+ 54c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 54f:	7c cf                	jl     520 <gets+0x10>
+ 551:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 55a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55d:	5b                   	pop    %ebx
+ 55e:	5e                   	pop    %esi
+ 55f:	5f                   	pop    %edi
+ 560:	5d                   	pop    %ebp
+ 561:	c3                   	ret
+ 562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	56                   	push   %esi
+ 574:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	6a 00                	push   $0x0
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 f9 00 00 00       	call   67b <open>
+  if(fd < 0)
+ 582:	83 c4 10             	add    $0x10,%esp
+ 585:	85 c0                	test   %eax,%eax
+ 587:	78 27                	js     5b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 589:	83 ec 08             	sub    $0x8,%esp
+ 58c:	ff 75 0c             	push   0xc(%ebp)
+ 58f:	89 c3                	mov    %eax,%ebx
+ 591:	50                   	push   %eax
+ 592:	e8 fc 00 00 00       	call   693 <fstat>
+  close(fd);
+ 597:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 59a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 59c:	e8 ba 00 00 00       	call   65b <close>
+  return r;
+ 5a1:	83 c4 10             	add    $0x10,%esp
+}
+ 5a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5a7:	89 f0                	mov    %esi,%eax
+ 5a9:	5b                   	pop    %ebx
+ 5aa:	5e                   	pop    %esi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5b5:	eb ed                	jmp    5a4 <stat+0x34>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5c7:	0f be 02             	movsbl (%edx),%eax
+ 5ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5d5:	77 1e                	ja     5f5 <atoi+0x35>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ea:	0f be 02             	movsbl (%edx),%eax
+ 5ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5f0:	80 fb 09             	cmp    $0x9,%bl
+ 5f3:	76 eb                	jbe    5e0 <atoi+0x20>
+  return n;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5f8:	89 c8                	mov    %ecx,%eax
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	8b 45 10             	mov    0x10(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 60e:	85 c0                	test   %eax,%eax
+ 610:	7e 13                	jle    625 <memmove+0x25>
+ 612:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 614:	89 d7                	mov    %edx,%edi
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 620:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 621:	39 f8                	cmp    %edi,%eax
+ 623:	75 fb                	jne    620 <memmove+0x20>
+  return vdst;
+}
+ 625:	5e                   	pop    %esi
+ 626:	89 d0                	mov    %edx,%eax
+ 628:	5f                   	pop    %edi
+ 629:	5d                   	pop    %ebp
+ 62a:	c3                   	ret
+
+0000062b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 62b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <exit>:
+SYSCALL(exit)
+ 633:	b8 02 00 00 00       	mov    $0x2,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <wait>:
+SYSCALL(wait)
+ 63b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <pipe>:
+SYSCALL(pipe)
+ 643:	b8 04 00 00 00       	mov    $0x4,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <read>:
+SYSCALL(read)
+ 64b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <write>:
+SYSCALL(write)
+ 653:	b8 10 00 00 00       	mov    $0x10,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <close>:
+SYSCALL(close)
+ 65b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <kill>:
+SYSCALL(kill)
+ 663:	b8 06 00 00 00       	mov    $0x6,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <exec>:
+SYSCALL(exec)
+ 66b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <exec2>:
+SYSCALL(exec2)
+ 673:	b8 16 00 00 00       	mov    $0x16,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <open>:
+SYSCALL(open)
+ 67b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <mknod>:
+SYSCALL(mknod)
+ 683:	b8 11 00 00 00       	mov    $0x11,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <unlink>:
+SYSCALL(unlink)
+ 68b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <fstat>:
+SYSCALL(fstat)
+ 693:	b8 08 00 00 00       	mov    $0x8,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <link>:
+SYSCALL(link)
+ 69b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <mkdir>:
+SYSCALL(mkdir)
+ 6a3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <chdir>:
+SYSCALL(chdir)
+ 6ab:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <dup>:
+SYSCALL(dup)
+ 6b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <getpid>:
+SYSCALL(getpid)
+ 6bb:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <sbrk>:
+SYSCALL(sbrk)
+ 6c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <sleep>:
+SYSCALL(sleep)
+ 6cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <uptime>:
+SYSCALL(uptime)
+ 6d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <setmemorylimit>:
+SYSCALL(setmemorylimit)
+ 6db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <listproc>:
+SYSCALL(listproc)
+ 6e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <thread_create>:
+SYSCALL(thread_create)
+ 6eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <thread_join>:
+SYSCALL(thread_join)
+ 6f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <thread_exit>:
+SYSCALL(thread_exit)
+ 6fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+ 703:	66 90                	xchg   %ax,%ax
+ 705:	66 90                	xchg   %ax,%ax
+ 707:	66 90                	xchg   %ax,%ax
+ 709:	66 90                	xchg   %ax,%ax
+ 70b:	66 90                	xchg   %ax,%ax
+ 70d:	66 90                	xchg   %ax,%ax
+ 70f:	90                   	nop
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 1c 0c 00 00 	movzbl 0xc1c(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 c6 fe ff ff       	call   653 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 5c fe ff ff       	call   653 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 c4 0b 00 00 	jmp    *0xbc4(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 fd fd ff ff       	call   653 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 eb fd ff ff       	call   653 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 71 fd ff ff       	call   653 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 21 fd ff ff       	call   653 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb bc 0b 00 00       	mov    $0xbbc,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+{
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	57                   	push   %edi
+ 969:	56                   	push   %esi
+ 96a:	53                   	push   %ebx
+ 96b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 96e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	39 ca                	cmp    %ecx,%edx
+ 97e:	73 30                	jae    9b0 <free+0x50>
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 04                	jb     988 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	39 c2                	cmp    %eax,%edx
+ 986:	72 f0                	jb     978 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 988:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 98b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 98e:	39 f8                	cmp    %edi,%eax
+ 990:	74 2e                	je     9c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 992:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 995:	8b 42 04             	mov    0x4(%edx),%eax
+ 998:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 99b:	39 f1                	cmp    %esi,%ecx
+ 99d:	74 38                	je     9d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 99f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a1:	5b                   	pop    %ebx
+  freep = p;
+ 9a2:	89 15 e4 0f 00 00    	mov    %edx,0xfe4
+}
+ 9a8:	5e                   	pop    %esi
+ 9a9:	5f                   	pop    %edi
+ 9aa:	5d                   	pop    %ebp
+ 9ab:	c3                   	ret
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 d0                	jb     984 <free+0x24>
+ 9b4:	eb c2                	jmp    978 <free+0x18>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 70 04             	add    0x4(%eax),%esi
+ 9c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	75 c8                	jne    99f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9da:	89 15 e4 0f 00 00    	mov    %edx,0xfe4
+    p->s.size += bp->s.size;
+ 9e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9fc:	8b 15 e4 0f 00 00    	mov    0xfe4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a02:	8d 78 07             	lea    0x7(%eax),%edi
+ a05:	c1 ef 03             	shr    $0x3,%edi
+ a08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a0b:	85 d2                	test   %edx,%edx
+ a0d:	0f 84 8d 00 00 00    	je     aa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a15:	8b 48 04             	mov    0x4(%eax),%ecx
+ a18:	39 f9                	cmp    %edi,%ecx
+ a1a:	73 64                	jae    a80 <malloc+0x90>
+  if(nu < 4096)
+ a1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a21:	39 df                	cmp    %ebx,%edi
+ a23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2d:	eb 0a                	jmp    a39 <malloc+0x49>
+ a2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a32:	8b 48 04             	mov    0x4(%eax),%ecx
+ a35:	39 f9                	cmp    %edi,%ecx
+ a37:	73 47                	jae    a80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a39:	89 c2                	mov    %eax,%edx
+ a3b:	39 05 e4 0f 00 00    	cmp    %eax,0xfe4
+ a41:	75 ed                	jne    a30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	56                   	push   %esi
+ a47:	e8 77 fc ff ff       	call   6c3 <sbrk>
+  if(p == (char*)-1)
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a52:	74 1c                	je     a70 <malloc+0x80>
+  hp->s.size = nu;
+ a54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	83 c0 08             	add    $0x8,%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 fd fe ff ff       	call   960 <free>
+  return freep;
+ a63:	8b 15 e4 0f 00 00    	mov    0xfe4,%edx
+      if((p = morecore(nunits)) == 0)
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 d2                	test   %edx,%edx
+ a6e:	75 c0                	jne    a30 <malloc+0x40>
+        return 0;
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a73:	31 c0                	xor    %eax,%eax
+}
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5f                   	pop    %edi
+ a78:	5d                   	pop    %ebp
+ a79:	c3                   	ret
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a80:	39 cf                	cmp    %ecx,%edi
+ a82:	74 4c                	je     ad0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a84:	29 f9                	sub    %edi,%ecx
+ a86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a8f:	89 15 e4 0f 00 00    	mov    %edx,0xfe4
+}
+ a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a98:	83 c0 08             	add    $0x8,%eax
+}
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ aa0:	c7 05 e4 0f 00 00 e8 	movl   $0xfe8,0xfe4
+ aa7:	0f 00 00 
+    base.s.size = 0;
+ aaa:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    base.s.ptr = freep = prevp = &base;
+ aaf:	c7 05 e8 0f 00 00 e8 	movl   $0xfe8,0xfe8
+ ab6:	0f 00 00 
+    base.s.size = 0;
+ ab9:	c7 05 ec 0f 00 00 00 	movl   $0x0,0xfec
+ ac0:	00 00 00 
+    if(p->s.size >= nunits){
+ ac3:	e9 54 ff ff ff       	jmp    a1c <malloc+0x2c>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ad0:	8b 08                	mov    (%eax),%ecx
+ ad2:	89 0a                	mov    %ecx,(%edx)
+ ad4:	eb b9                	jmp    a8f <malloc+0x9f>
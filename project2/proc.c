@@ -63,6 +63,81 @@ myproc(void) {
   return p;
 }
 
+// Make parent the parent of p, moving p from its old
+// parent's child list to the new one's.
+// Caller must hold ptable.lock.
+void
+setparent(struct proc *p, struct proc *parent)
+{
+  if(p->parent){
+    if((*p->psibling = p->sibling) != 0)
+      p->sibling->psibling = p->psibling;
+  }
+  p->parent = parent;
+  if(parent){
+    if((p->sibling = parent->children) != 0)
+      p->sibling->psibling = &p->sibling;
+    parent->children = p;
+    p->psibling = &parent->children;
+  }
+}
+
+// Pass p's children to init.
+// Caller must hold ptable.lock.
+void
+reparent(struct proc *p)
+{
+  struct proc *c;
+
+  while((c = p->children) != 0){
+    setparent(c, initproc);
+    if(c->state == ZOMBIE)
+      wakeup1(initproc);
+  }
+}
+
+// Set p's pid, moving it between pid hash chains.
+// Caller must hold ptable.lock.
+void
+setpid(struct proc *p, int pid)
+{
+  struct proc **pp;
+
+  if(p->pid){
+    for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp; pp = &(*pp)->pidnext){
+      if(*pp == p){
+        *pp = p->pidnext;
+        break;
+      }
+    }
+  }
+  p->pid = pid;
+  if(pid){
+    p->pidnext = ptable.pidhash[pid % NPIDHASH];
+    ptable.pidhash[pid % NPIDHASH] = p;
+  }
+}
+
+// Find the process with the given pid. LWPs share their
+// mother's pid, so prefer the one that is not a thread.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p, *lwp;
+
+  lwp = 0;
+  for(p = ptable.pidhash[pid % NPIDHASH]; p; p = p->pidnext){
+    if(p->pid != pid)
+      continue;
+    if(!p->isthread)
+      return p;
+    if(!lwp)
+      lwp = p;
+  }
+  return lwp;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -87,11 +162,13 @@ allocproc(void)
 
 found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
+  setpid(p, nextpid++);
   
   // set default limit to 0
   p->limit = 0;
 
+  p->children = 0;
+
   // initialize thread-related fields
   p->mother = p;
   p->thread_num = 0;
@@ -235,7 +312,6 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -252,6 +328,7 @@ fork(void)
 
   acquire(&ptable.lock);
 
+  setparent(np, curproc);
   np->state = RUNNABLE;
 
   release(&ptable.lock);
@@ -266,7 +343,6 @@ void
 exit(void)
 {
   struct proc *curproc = myproc();
-  struct proc *p;
   int fd;
 
   if(curproc == initproc)
@@ -293,13 +369,7 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
-  }
+  reparent(curproc);
 
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
@@ -318,11 +388,9 @@ wait(void)
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
+    for(p = curproc->children; p; p = p->sibling){
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
@@ -330,8 +398,8 @@ wait(void)
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
+        setpid(p, 0);
+        setparent(p, 0);
         p->name[0] = 0;
         p->killed = 0;
         p->state = UNUSED;
@@ -522,15 +590,13 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      p->state = RUNNABLE;
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
   return -1;
@@ -582,13 +648,13 @@ setmemorylimit(int pid, int limit)
   if (limit < 0)
     return -1;
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (pid == p->pid) goto found;
-  }
+  acquire(&ptable.lock);
+  p = findproc(pid);
+  release(&ptable.lock);
 
-  return -1;
+  if (!p)
+    return -1;
 
-found:
   if (p->sz > limit) 
     return -1;
 
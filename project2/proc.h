@@ -64,11 +64,18 @@ struct proc {
   struct proc* mother;         // Creator of thread
   struct proc* threads[NTHREAD]; // Child threads
   void *retval;                // Return value of thread
+  struct proc *children;       // First process whose parent is this
+  struct proc *sibling;        // Next child of parent
+  struct proc **psibling;      // Pointer to this in parent's child list
+  struct proc *pidnext;        // Next proc in pid hash chain
 };
 
+#define NPIDHASH 61
+
 struct ptable_t {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *pidhash[NPIDHASH]; // Procs by pid, LWPs included
 };
 
 // Process memory is laid out contiguously, low addresses first:
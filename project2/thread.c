@@ -34,9 +34,11 @@ thread_create(thread_t *thread, void *(*start_routine)(void *), void *arg)
   // Share the same address space and parent process as the mother process
   lwp->pgdir = mother->pgdir;
   lwp->mother = mother;
-  lwp->parent = mother->parent;
   lwp->limit = mother->limit;
-  lwp->pid = mother->pid;
+  acquire(&ptable.lock);
+  setparent(lwp, mother->parent);
+  setpid(lwp, mother->pid);
+  release(&ptable.lock);
 
   // Check if new size exceed memory limit
   if (mother->limit && mother->sz + 2*PGSIZE > mother->limit) {
@@ -105,7 +107,11 @@ thread_create(thread_t *thread, void *(*start_routine)(void *), void *arg)
 bad:
   kfree(lwp->kstack);
   lwp->kstack = 0;
+  acquire(&ptable.lock);
+  setpid(lwp, 0);
+  setparent(lwp, 0);
   lwp->state = UNUSED;
+  release(&ptable.lock);
   return -1;
 }
 
@@ -172,13 +178,7 @@ void thread_exit(void* retval) {
   wakeup1(mother);
 
   // Adopt abandoned processes
-  for(struct proc *p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == lwp){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
-  }
+  reparent(lwp);
 
   lwp->state = ZOMBIE;
 
@@ -190,6 +190,7 @@ void thread_exit(void* retval) {
 
 // Cleanup function for internal use. 
 // Only works when victim != myproc()
+// Caller must hold ptable.lock.
 void
 _cleanup(struct proc *victim)
 {
@@ -198,8 +199,9 @@ _cleanup(struct proc *victim)
   if (victim->kstack)
     kfree(victim->kstack);
   victim->kstack = 0;
-  victim->pid = 0;
-  victim->parent = 0;
+  setpid(victim, 0);
+  reparent(victim);
+  setparent(victim, 0);
   victim->mother = 0;
   victim->isthread = 0;
   victim->tid = 0;
@@ -244,7 +246,7 @@ clean_thread(struct proc* curproc)
 
   // If current process is not mother process, then cleanup mother as well
   if (curproc != mother) {
-    curproc->parent = mother->parent;
+    setparent(curproc, mother->parent);
     curproc->mother = 0;
     _cleanup(mother);
   }
@@ -0,0 +1,1645 @@
+
+_thread_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  for (i = 0; i < NUM_THREAD; i++)
+    expected[i] = i;
+  11:	c7 05 f0 11 00 00 00 	movl   $0x0,0x11f0
+  18:	00 00 00 
+
+  printf(1, "Test 1: Basic test\n");
+  1b:	68 94 0c 00 00       	push   $0xc94
+  20:	6a 01                	push   $0x1
+    expected[i] = i;
+  22:	c7 05 f4 11 00 00 01 	movl   $0x1,0x11f4
+  29:	00 00 00 
+  2c:	c7 05 f8 11 00 00 02 	movl   $0x2,0x11f8
+  33:	00 00 00 
+  36:	c7 05 fc 11 00 00 03 	movl   $0x3,0x11fc
+  3d:	00 00 00 
+  40:	c7 05 00 12 00 00 04 	movl   $0x4,0x1200
+  47:	00 00 00 
+  printf(1, "Test 1: Basic test\n");
+  4a:	e8 41 08 00 00       	call   890 <printf>
+  create_all(2, thread_basic);
+  4f:	58                   	pop    %eax
+  50:	5a                   	pop    %edx
+  51:	68 70 01 00 00       	push   $0x170
+  56:	6a 02                	push   $0x2
+  58:	e8 93 03 00 00       	call   3f0 <create_all>
+  sleep(100);
+  5d:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+  64:	e8 42 07 00 00       	call   7ab <sleep>
+  printf(1, "Parent waiting for children...\n");
+  69:	59                   	pop    %ecx
+  6a:	58                   	pop    %eax
+  6b:	68 58 0d 00 00       	push   $0xd58
+  70:	6a 01                	push   $0x1
+  72:	e8 19 08 00 00       	call   890 <printf>
+  join_all(2);
+  77:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  7e:	e8 cd 03 00 00       	call   450 <join_all>
+  if (status != 1) {
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	83 3d 18 12 00 00 01 	cmpl   $0x1,0x1218
+  8d:	74 13                	je     a2 <main+0xa2>
+    printf(1, "Join returned before thread exit, or the address space is not properly shared\n");
+  8f:	50                   	push   %eax
+  90:	50                   	push   %eax
+  91:	68 78 0d 00 00       	push   $0xd78
+  96:	6a 01                	push   $0x1
+  98:	e8 f3 07 00 00       	call   890 <printf>
+    failed();
+  9d:	e8 2e 01 00 00       	call   1d0 <failed>
+  }
+  printf(1, "Test 1 passed\n\n");
+  a2:	50                   	push   %eax
+  a3:	50                   	push   %eax
+  a4:	68 a8 0c 00 00       	push   $0xca8
+  a9:	6a 01                	push   $0x1
+  ab:	e8 e0 07 00 00       	call   890 <printf>
+
+  printf(1, "Test 2: Fork test\n");
+  b0:	58                   	pop    %eax
+  b1:	5a                   	pop    %edx
+  b2:	68 b8 0c 00 00       	push   $0xcb8
+  b7:	6a 01                	push   $0x1
+  b9:	e8 d2 07 00 00       	call   890 <printf>
+  create_all(NUM_THREAD, thread_fork);
+  be:	59                   	pop    %ecx
+  bf:	58                   	pop    %eax
+  c0:	68 f0 01 00 00       	push   $0x1f0
+  c5:	6a 05                	push   $0x5
+  c7:	e8 24 03 00 00       	call   3f0 <create_all>
+  join_all(NUM_THREAD);
+  cc:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+  d3:	e8 78 03 00 00       	call   450 <join_all>
+  if (status != 2) {
+  d8:	a1 18 12 00 00       	mov    0x1218,%eax
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	83 f8 02             	cmp    $0x2,%eax
+  e3:	74 2e                	je     113 <main+0x113>
+    if (status == 3) {
+  e5:	83 f8 03             	cmp    $0x3,%eax
+  e8:	74 16                	je     100 <main+0x100>
+      printf(1, "Child process referenced parent's memory\n");
+    }
+    else {
+      printf(1, "Status expected 2, found %d\n", status);
+  ea:	51                   	push   %ecx
+  eb:	50                   	push   %eax
+  ec:	68 cb 0c 00 00       	push   $0xccb
+  f1:	6a 01                	push   $0x1
+  f3:	e8 98 07 00 00       	call   890 <printf>
+  f8:	83 c4 10             	add    $0x10,%esp
+    }
+    failed();
+  fb:	e8 d0 00 00 00       	call   1d0 <failed>
+      printf(1, "Child process referenced parent's memory\n");
+ 100:	50                   	push   %eax
+ 101:	50                   	push   %eax
+ 102:	68 c8 0d 00 00       	push   $0xdc8
+ 107:	6a 01                	push   $0x1
+ 109:	e8 82 07 00 00       	call   890 <printf>
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	eb e8                	jmp    fb <main+0xfb>
+  }
+  printf(1, "Test 2 passed\n\n");
+ 113:	50                   	push   %eax
+ 114:	50                   	push   %eax
+ 115:	68 e8 0c 00 00       	push   $0xce8
+ 11a:	6a 01                	push   $0x1
+ 11c:	e8 6f 07 00 00       	call   890 <printf>
+
+  printf(1, "Test 3: Sbrk test\n");
+ 121:	5a                   	pop    %edx
+ 122:	59                   	pop    %ecx
+ 123:	68 f8 0c 00 00       	push   $0xcf8
+ 128:	6a 01                	push   $0x1
+ 12a:	e8 61 07 00 00       	call   890 <printf>
+  create_all(NUM_THREAD, thread_sbrk);
+ 12f:	58                   	pop    %eax
+ 130:	5a                   	pop    %edx
+ 131:	68 b0 02 00 00       	push   $0x2b0
+ 136:	6a 05                	push   $0x5
+ 138:	e8 b3 02 00 00       	call   3f0 <create_all>
+  join_all(NUM_THREAD);
+ 13d:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+ 144:	e8 07 03 00 00       	call   450 <join_all>
+  printf(1, "Test 3 passed\n\n");
+ 149:	59                   	pop    %ecx
+ 14a:	58                   	pop    %eax
+ 14b:	68 0b 0d 00 00       	push   $0xd0b
+ 150:	6a 01                	push   $0x1
+ 152:	e8 39 07 00 00       	call   890 <printf>
+
+  printf(1, "All tests passed!\n");
+ 157:	58                   	pop    %eax
+ 158:	5a                   	pop    %edx
+ 159:	68 1b 0d 00 00       	push   $0xd1b
+ 15e:	6a 01                	push   $0x1
+ 160:	e8 2b 07 00 00       	call   890 <printf>
+  exit();
+ 165:	e8 a9 05 00 00       	call   713 <exit>
+ 16a:	66 90                	xchg   %ax,%ax
+ 16c:	66 90                	xchg   %ax,%ax
+ 16e:	66 90                	xchg   %ax,%ax
+
+00000170 <thread_basic>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	83 ec 08             	sub    $0x8,%esp
+ 177:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf(1, "Thread %d start\n", val);
+ 17a:	53                   	push   %ebx
+ 17b:	68 b8 0b 00 00       	push   $0xbb8
+ 180:	6a 01                	push   $0x1
+ 182:	e8 09 07 00 00       	call   890 <printf>
+  if (val == 1) {
+ 187:	83 c4 10             	add    $0x10,%esp
+ 18a:	83 fb 01             	cmp    $0x1,%ebx
+ 18d:	74 21                	je     1b0 <thread_basic+0x40>
+  printf(1, "Thread %d end\n", val);
+ 18f:	83 ec 04             	sub    $0x4,%esp
+ 192:	53                   	push   %ebx
+ 193:	68 c9 0b 00 00       	push   $0xbc9
+ 198:	6a 01                	push   $0x1
+ 19a:	e8 f1 06 00 00       	call   890 <printf>
+  thread_exit(arg);
+ 19f:	89 1c 24             	mov    %ebx,(%esp)
+ 1a2:	e8 34 06 00 00       	call   7db <thread_exit>
+}
+ 1a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1aa:	31 c0                	xor    %eax,%eax
+ 1ac:	c9                   	leave
+ 1ad:	c3                   	ret
+ 1ae:	66 90                	xchg   %ax,%ax
+    sleep(200);
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	68 c8 00 00 00       	push   $0xc8
+ 1b8:	e8 ee 05 00 00       	call   7ab <sleep>
+    status = 1;
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	c7 05 18 12 00 00 01 	movl   $0x1,0x1218
+ 1c7:	00 00 00 
+ 1ca:	eb c3                	jmp    18f <thread_basic+0x1f>
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <failed>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "Test failed!\n");
+ 1d6:	68 d8 0b 00 00       	push   $0xbd8
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 ae 06 00 00       	call   890 <printf>
+  exit();
+ 1e2:	e8 2c 05 00 00       	call   713 <exit>
+ 1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <thread_fork>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	83 ec 08             	sub    $0x8,%esp
+ 1f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf(1, "Thread %d start\n", val);
+ 1fa:	53                   	push   %ebx
+ 1fb:	68 b8 0b 00 00       	push   $0xbb8
+ 200:	6a 01                	push   $0x1
+ 202:	e8 89 06 00 00       	call   890 <printf>
+  pid = fork();
+ 207:	e8 ff 04 00 00       	call   70b <fork>
+  if (pid < 0) {
+ 20c:	83 c4 10             	add    $0x10,%esp
+ 20f:	85 c0                	test   %eax,%eax
+ 211:	78 35                	js     248 <thread_fork+0x58>
+  if (pid == 0) {
+ 213:	74 59                	je     26e <thread_fork+0x7e>
+    status = 2;
+ 215:	c7 05 18 12 00 00 02 	movl   $0x2,0x1218
+ 21c:	00 00 00 
+    if (wait() == -1) {
+ 21f:	e8 f7 04 00 00       	call   71b <wait>
+ 224:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 227:	74 32                	je     25b <thread_fork+0x6b>
+  printf(1, "Thread %d end\n", val);
+ 229:	83 ec 04             	sub    $0x4,%esp
+ 22c:	53                   	push   %ebx
+ 22d:	68 c9 0b 00 00       	push   $0xbc9
+ 232:	6a 01                	push   $0x1
+ 234:	e8 57 06 00 00       	call   890 <printf>
+  thread_exit(arg);
+ 239:	89 1c 24             	mov    %ebx,(%esp)
+ 23c:	e8 9a 05 00 00       	call   7db <thread_exit>
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	c9                   	leave
+ 247:	c3                   	ret
+    printf(1, "Fork error on thread %d\n", val);
+ 248:	51                   	push   %ecx
+ 249:	53                   	push   %ebx
+ 24a:	68 e6 0b 00 00       	push   $0xbe6
+ 24f:	6a 01                	push   $0x1
+ 251:	e8 3a 06 00 00       	call   890 <printf>
+    failed();
+ 256:	e8 75 ff ff ff       	call   1d0 <failed>
+      printf(1, "Thread %d lost their child\n", val);
+ 25b:	50                   	push   %eax
+ 25c:	53                   	push   %ebx
+ 25d:	68 31 0c 00 00       	push   $0xc31
+ 262:	6a 01                	push   $0x1
+ 264:	e8 27 06 00 00       	call   890 <printf>
+      failed();
+ 269:	e8 62 ff ff ff       	call   1d0 <failed>
+    printf(1, "Child of thread %d start\n", val);
+ 26e:	52                   	push   %edx
+ 26f:	53                   	push   %ebx
+ 270:	68 ff 0b 00 00       	push   $0xbff
+ 275:	6a 01                	push   $0x1
+ 277:	e8 14 06 00 00       	call   890 <printf>
+    sleep(100);
+ 27c:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+ 283:	e8 23 05 00 00       	call   7ab <sleep>
+    printf(1, "Child of thread %d end\n", val);
+ 288:	83 c4 0c             	add    $0xc,%esp
+    status = 3;
+ 28b:	c7 05 18 12 00 00 03 	movl   $0x3,0x1218
+ 292:	00 00 00 
+    printf(1, "Child of thread %d end\n", val);
+ 295:	53                   	push   %ebx
+ 296:	68 19 0c 00 00       	push   $0xc19
+ 29b:	6a 01                	push   $0x1
+ 29d:	e8 ee 05 00 00       	call   890 <printf>
+    exit();
+ 2a2:	e8 6c 04 00 00       	call   713 <exit>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <thread_sbrk>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	53                   	push   %ebx
+ 2b6:	83 ec 10             	sub    $0x10,%esp
+ 2b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  printf(1, "Thread %d start\n", val);
+ 2bc:	56                   	push   %esi
+ 2bd:	68 b8 0b 00 00       	push   $0xbb8
+ 2c2:	6a 01                	push   $0x1
+ 2c4:	e8 c7 05 00 00       	call   890 <printf>
+  if (val == 0) {
+ 2c9:	83 c4 10             	add    $0x10,%esp
+ 2cc:	85 f6                	test   %esi,%esi
+ 2ce:	0f 84 e0 00 00 00    	je     3b4 <thread_sbrk+0x104>
+    while (ptr == 0)
+ 2d4:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 2d9:	85 c0                	test   %eax,%eax
+ 2db:	75 16                	jne    2f3 <thread_sbrk+0x43>
+      sleep(1);
+ 2dd:	83 ec 0c             	sub    $0xc,%esp
+ 2e0:	6a 01                	push   $0x1
+ 2e2:	e8 c4 04 00 00       	call   7ab <sleep>
+    while (ptr == 0)
+ 2e7:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 2ec:	83 c4 10             	add    $0x10,%esp
+ 2ef:	85 c0                	test   %eax,%eax
+ 2f1:	74 ea                	je     2dd <thread_sbrk+0x2d>
+      ptr[i] = val;
+ 2f3:	89 30                	mov    %esi,(%eax)
+ 2f5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 300:	8b 15 ec 11 00 00    	mov    0x11ec,%edx
+ 306:	89 34 02             	mov    %esi,(%edx,%eax,1)
+    for (i = 0; i < 16384; i++)
+ 309:	83 c0 04             	add    $0x4,%eax
+ 30c:	3d 00 00 01 00       	cmp    $0x10000,%eax
+ 311:	75 ed                	jne    300 <thread_sbrk+0x50>
+  while (ptr != 0)
+ 313:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 318:	85 c0                	test   %eax,%eax
+ 31a:	74 16                	je     332 <thread_sbrk+0x82>
+    sleep(1);
+ 31c:	83 ec 0c             	sub    $0xc,%esp
+ 31f:	6a 01                	push   $0x1
+ 321:	e8 85 04 00 00       	call   7ab <sleep>
+  while (ptr != 0)
+ 326:	a1 ec 11 00 00       	mov    0x11ec,%eax
+ 32b:	83 c4 10             	add    $0x10,%esp
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	75 ea                	jne    31c <thread_sbrk+0x6c>
+      ptr[i] = val;
+ 332:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    int *p = (int *)malloc(65536);
+ 340:	83 ec 0c             	sub    $0xc,%esp
+ 343:	68 00 00 01 00       	push   $0x10000
+ 348:	e8 83 07 00 00       	call   ad0 <malloc>
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < 16384; j++)
+ 352:	89 c2                	mov    %eax,%edx
+ 354:	8d 88 00 00 01 00    	lea    0x10000(%eax),%ecx
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      p[j] = val;
+ 360:	89 30                	mov    %esi,(%eax)
+    for (j = 0; j < 16384; j++)
+ 362:	83 c0 04             	add    $0x4,%eax
+ 365:	39 c1                	cmp    %eax,%ecx
+ 367:	75 f7                	jne    360 <thread_sbrk+0xb0>
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if (p[j] != val) {
+ 370:	8b 02                	mov    (%edx),%eax
+ 372:	39 f0                	cmp    %esi,%eax
+ 374:	75 2b                	jne    3a1 <thread_sbrk+0xf1>
+    for (j = 0; j < 16384; j++) {
+ 376:	83 c2 04             	add    $0x4,%edx
+ 379:	39 ca                	cmp    %ecx,%edx
+ 37b:	75 f3                	jne    370 <thread_sbrk+0xc0>
+    free(p);
+ 37d:	83 ec 0c             	sub    $0xc,%esp
+ 380:	57                   	push   %edi
+ 381:	e8 ba 06 00 00       	call   a40 <free>
+  for (i = 0; i < 2000; i++) {
+ 386:	83 c4 10             	add    $0x10,%esp
+ 389:	83 eb 01             	sub    $0x1,%ebx
+ 38c:	75 b2                	jne    340 <thread_sbrk+0x90>
+  thread_exit(arg);
+ 38e:	83 ec 0c             	sub    $0xc,%esp
+ 391:	56                   	push   %esi
+ 392:	e8 44 04 00 00       	call   7db <thread_exit>
+}
+ 397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39a:	31 c0                	xor    %eax,%eax
+ 39c:	5b                   	pop    %ebx
+ 39d:	5e                   	pop    %esi
+ 39e:	5f                   	pop    %edi
+ 39f:	5d                   	pop    %ebp
+ 3a0:	c3                   	ret
+        printf(1, "Thread %d found %d\n", val, p[j]);
+ 3a1:	50                   	push   %eax
+ 3a2:	56                   	push   %esi
+ 3a3:	68 4d 0c 00 00       	push   $0xc4d
+ 3a8:	6a 01                	push   $0x1
+ 3aa:	e8 e1 04 00 00       	call   890 <printf>
+        failed();
+ 3af:	e8 1c fe ff ff       	call   1d0 <failed>
+    ptr = (int *)malloc(65536);
+ 3b4:	83 ec 0c             	sub    $0xc,%esp
+ 3b7:	68 00 00 01 00       	push   $0x10000
+ 3bc:	e8 0f 07 00 00       	call   ad0 <malloc>
+ 3c1:	a3 ec 11 00 00       	mov    %eax,0x11ec
+    sleep(100);
+ 3c6:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+ 3cd:	e8 d9 03 00 00       	call   7ab <sleep>
+    free(ptr);
+ 3d2:	5a                   	pop    %edx
+ 3d3:	ff 35 ec 11 00 00    	push   0x11ec
+ 3d9:	e8 62 06 00 00       	call   a40 <free>
+    ptr = 0;
+ 3de:	83 c4 10             	add    $0x10,%esp
+ 3e1:	c7 05 ec 11 00 00 00 	movl   $0x0,0x11ec
+ 3e8:	00 00 00 
+  while (ptr != 0)
+ 3eb:	e9 42 ff ff ff       	jmp    332 <thread_sbrk+0x82>
+
+000003f0 <create_all>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	83 ec 0c             	sub    $0xc,%esp
+ 3f9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (i = 0; i < n; i++) {
+ 3ff:	85 f6                	test   %esi,%esi
+ 401:	7e 25                	jle    428 <create_all+0x38>
+ 403:	31 db                	xor    %ebx,%ebx
+ 405:	8d 76 00             	lea    0x0(%esi),%esi
+    if (thread_create(&thread[i], entry, (void *)i) != 0) {
+ 408:	83 ec 04             	sub    $0x4,%esp
+ 40b:	8d 04 9d 04 12 00 00 	lea    0x1204(,%ebx,4),%eax
+ 412:	53                   	push   %ebx
+ 413:	57                   	push   %edi
+ 414:	50                   	push   %eax
+ 415:	e8 b1 03 00 00       	call   7cb <thread_create>
+ 41a:	83 c4 10             	add    $0x10,%esp
+ 41d:	85 c0                	test   %eax,%eax
+ 41f:	75 0f                	jne    430 <create_all+0x40>
+  for (i = 0; i < n; i++) {
+ 421:	83 c3 01             	add    $0x1,%ebx
+ 424:	39 de                	cmp    %ebx,%esi
+ 426:	75 e0                	jne    408 <create_all+0x18>
+}
+ 428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42b:	5b                   	pop    %ebx
+ 42c:	5e                   	pop    %esi
+ 42d:	5f                   	pop    %edi
+ 42e:	5d                   	pop    %ebp
+ 42f:	c3                   	ret
+      printf(1, "Error creating thread %d\n", i);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	53                   	push   %ebx
+ 434:	68 61 0c 00 00       	push   $0xc61
+ 439:	6a 01                	push   $0x1
+ 43b:	e8 50 04 00 00       	call   890 <printf>
+      failed();
+ 440:	e8 8b fd ff ff       	call   1d0 <failed>
+ 445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <join_all>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 1c             	sub    $0x1c,%esp
+ 459:	8b 75 08             	mov    0x8(%ebp),%esi
+  for (i = 0; i < n; i++) {
+ 45c:	85 f6                	test   %esi,%esi
+ 45e:	7e 34                	jle    494 <join_all+0x44>
+ 460:	31 db                	xor    %ebx,%ebx
+ 462:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+ 465:	8d 76 00             	lea    0x0(%esi),%esi
+    if (thread_join(thread[i], (void **)&retval) != 0) {
+ 468:	83 ec 08             	sub    $0x8,%esp
+ 46b:	57                   	push   %edi
+ 46c:	ff 34 9d 04 12 00 00 	push   0x1204(,%ebx,4)
+ 473:	e8 5b 03 00 00       	call   7d3 <thread_join>
+ 478:	83 c4 10             	add    $0x10,%esp
+ 47b:	85 c0                	test   %eax,%eax
+ 47d:	75 1d                	jne    49c <join_all+0x4c>
+    if (retval != expected[i]) {
+ 47f:	8b 14 9d f0 11 00 00 	mov    0x11f0(,%ebx,4),%edx
+ 486:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 489:	39 c2                	cmp    %eax,%edx
+ 48b:	75 24                	jne    4b1 <join_all+0x61>
+  for (i = 0; i < n; i++) {
+ 48d:	83 c3 01             	add    $0x1,%ebx
+ 490:	39 de                	cmp    %ebx,%esi
+ 492:	75 d4                	jne    468 <join_all+0x18>
+}
+ 494:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 497:	5b                   	pop    %ebx
+ 498:	5e                   	pop    %esi
+ 499:	5f                   	pop    %edi
+ 49a:	5d                   	pop    %ebp
+ 49b:	c3                   	ret
+      printf(1, "Error joining thread %d\n", i);
+ 49c:	83 ec 04             	sub    $0x4,%esp
+ 49f:	53                   	push   %ebx
+ 4a0:	68 7b 0c 00 00       	push   $0xc7b
+ 4a5:	6a 01                	push   $0x1
+ 4a7:	e8 e4 03 00 00       	call   890 <printf>
+      failed();
+ 4ac:	e8 1f fd ff ff       	call   1d0 <failed>
+      printf(1, "Thread %d returned %d, but expected %d\n", i, retval, expected[i]);
+ 4b1:	83 ec 0c             	sub    $0xc,%esp
+ 4b4:	52                   	push   %edx
+ 4b5:	50                   	push   %eax
+ 4b6:	53                   	push   %ebx
+ 4b7:	68 30 0d 00 00       	push   $0xd30
+ 4bc:	6a 01                	push   $0x1
+ 4be:	e8 cd 03 00 00       	call   890 <printf>
+      failed();
+ 4c3:	83 c4 20             	add    $0x20,%esp
+ 4c6:	e8 05 fd ff ff       	call   1d0 <failed>
+ 4cb:	66 90                	xchg   %ax,%ax
+ 4cd:	66 90                	xchg   %ax,%ax
+ 4cf:	90                   	nop
+
+000004d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 4d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 4d1:	31 c0                	xor    %eax,%eax
+{
+ 4d3:	89 e5                	mov    %esp,%ebp
+ 4d5:	53                   	push   %ebx
+ 4d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4e7:	83 c0 01             	add    $0x1,%eax
+ 4ea:	84 d2                	test   %dl,%dl
+ 4ec:	75 f2                	jne    4e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f1:	89 c8                	mov    %ecx,%eax
+ 4f3:	c9                   	leave
+ 4f4:	c3                   	ret
+ 4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+ 507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 50a:	0f b6 02             	movzbl (%edx),%eax
+ 50d:	84 c0                	test   %al,%al
+ 50f:	75 17                	jne    528 <strcmp+0x28>
+ 511:	eb 3a                	jmp    54d <strcmp+0x4d>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 51c:	83 c2 01             	add    $0x1,%edx
+ 51f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 522:	84 c0                	test   %al,%al
+ 524:	74 1a                	je     540 <strcmp+0x40>
+    p++, q++;
+ 526:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 528:	0f b6 19             	movzbl (%ecx),%ebx
+ 52b:	38 c3                	cmp    %al,%bl
+ 52d:	74 e9                	je     518 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 52f:	29 d8                	sub    %ebx,%eax
+}
+ 531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 534:	c9                   	leave
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 540:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 544:	31 c0                	xor    %eax,%eax
+ 546:	29 d8                	sub    %ebx,%eax
+}
+ 548:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 54b:	c9                   	leave
+ 54c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 54d:	0f b6 19             	movzbl (%ecx),%ebx
+ 550:	31 c0                	xor    %eax,%eax
+ 552:	eb db                	jmp    52f <strcmp+0x2f>
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 566:	80 3a 00             	cmpb   $0x0,(%edx)
+ 569:	74 15                	je     580 <strlen+0x20>
+ 56b:	31 c0                	xor    %eax,%eax
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+ 570:	83 c0 01             	add    $0x1,%eax
+ 573:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 577:	89 c1                	mov    %eax,%ecx
+ 579:	75 f5                	jne    570 <strlen+0x10>
+    ;
+  return n;
+}
+ 57b:	89 c8                	mov    %ecx,%eax
+ 57d:	5d                   	pop    %ebp
+ 57e:	c3                   	ret
+ 57f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 580:	31 c9                	xor    %ecx,%ecx
+}
+ 582:	5d                   	pop    %ebp
+ 583:	89 c8                	mov    %ecx,%eax
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 597:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	89 d7                	mov    %edx,%edi
+ 59f:	fc                   	cld
+ 5a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5a5:	89 d0                	mov    %edx,%eax
+ 5a7:	c9                   	leave
+ 5a8:	c3                   	ret
+ 5a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ba:	0f b6 10             	movzbl (%eax),%edx
+ 5bd:	84 d2                	test   %dl,%dl
+ 5bf:	75 12                	jne    5d3 <strchr+0x23>
+ 5c1:	eb 1d                	jmp    5e0 <strchr+0x30>
+ 5c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5c7:	90                   	nop
+ 5c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5cc:	83 c0 01             	add    $0x1,%eax
+ 5cf:	84 d2                	test   %dl,%dl
+ 5d1:	74 0d                	je     5e0 <strchr+0x30>
+    if(*s == c)
+ 5d3:	38 d1                	cmp    %dl,%cl
+ 5d5:	75 f1                	jne    5c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 5d7:	5d                   	pop    %ebp
+ 5d8:	c3                   	ret
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5e0:	31 c0                	xor    %eax,%eax
+}
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	c3                   	ret
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5f9:	31 db                	xor    %ebx,%ebx
+{
+ 5fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5fe:	eb 27                	jmp    627 <gets+0x37>
+    cc = read(0, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	6a 01                	push   $0x1
+ 605:	56                   	push   %esi
+ 606:	6a 00                	push   $0x0
+ 608:	e8 1e 01 00 00       	call   72b <read>
+    if(cc < 1)
+ 60d:	83 c4 10             	add    $0x10,%esp
+ 610:	85 c0                	test   %eax,%eax
+ 612:	7e 1d                	jle    631 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 614:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 618:	8b 55 08             	mov    0x8(%ebp),%edx
+ 61b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 61f:	3c 0a                	cmp    $0xa,%al
+ 621:	74 10                	je     633 <gets+0x43>
+ 623:	3c 0d                	cmp    $0xd,%al
+ 625:	74 0c                	je     633 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 627:	89 df                	mov    %ebx,%edi
+ 629:	83 c3 01             	add    $0x1,%ebx
+ 62c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 62f:	7c cf                	jl     600 <gets+0x10>
+ 631:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 63a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63d:	5b                   	pop    %ebx
+ 63e:	5e                   	pop    %esi
+ 63f:	5f                   	pop    %edi
+ 640:	5d                   	pop    %ebp
+ 641:	c3                   	ret
+ 642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	56                   	push   %esi
+ 654:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 655:	83 ec 08             	sub    $0x8,%esp
+ 658:	6a 00                	push   $0x0
+ 65a:	ff 75 08             	push   0x8(%ebp)
+ 65d:	e8 f9 00 00 00       	call   75b <open>
+  if(fd < 0)
+ 662:	83 c4 10             	add    $0x10,%esp
+ 665:	85 c0                	test   %eax,%eax
+ 667:	78 27                	js     690 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 669:	83 ec 08             	sub    $0x8,%esp
+ 66c:	ff 75 0c             	push   0xc(%ebp)
+ 66f:	89 c3                	mov    %eax,%ebx
+ 671:	50                   	push   %eax
+ 672:	e8 fc 00 00 00       	call   773 <fstat>
+  close(fd);
+ 677:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 67a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 67c:	e8 ba 00 00 00       	call   73b <close>
+  return r;
+ 681:	83 c4 10             	add    $0x10,%esp
+}
+ 684:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 687:	89 f0                	mov    %esi,%eax
+ 689:	5b                   	pop    %ebx
+ 68a:	5e                   	pop    %esi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 690:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 695:	eb ed                	jmp    684 <stat+0x34>
+ 697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	53                   	push   %ebx
+ 6a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6a7:	0f be 02             	movsbl (%edx),%eax
+ 6aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6b5:	77 1e                	ja     6d5 <atoi+0x35>
+ 6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6c0:	83 c2 01             	add    $0x1,%edx
+ 6c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6ca:	0f be 02             	movsbl (%edx),%eax
+ 6cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6d0:	80 fb 09             	cmp    $0x9,%bl
+ 6d3:	76 eb                	jbe    6c0 <atoi+0x20>
+  return n;
+}
+ 6d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6d8:	89 c8                	mov    %ecx,%eax
+ 6da:	c9                   	leave
+ 6db:	c3                   	ret
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6ee:	85 c0                	test   %eax,%eax
+ 6f0:	7e 13                	jle    705 <memmove+0x25>
+ 6f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6f4:	89 d7                	mov    %edx,%edi
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 700:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 701:	39 f8                	cmp    %edi,%eax
+ 703:	75 fb                	jne    700 <memmove+0x20>
+  return vdst;
+}
+ 705:	5e                   	pop    %esi
+ 706:	89 d0                	mov    %edx,%eax
+ 708:	5f                   	pop    %edi
+ 709:	5d                   	pop    %ebp
+ 70a:	c3                   	ret
+
+0000070b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 70b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <exit>:
+SYSCALL(exit)
+ 713:	b8 02 00 00 00       	mov    $0x2,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <wait>:
+SYSCALL(wait)
+ 71b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <pipe>:
+SYSCALL(pipe)
+ 723:	b8 04 00 00 00       	mov    $0x4,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <read>:
+SYSCALL(read)
+ 72b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <write>:
+SYSCALL(write)
+ 733:	b8 10 00 00 00       	mov    $0x10,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <close>:
+SYSCALL(close)
+ 73b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <kill>:
+SYSCALL(kill)
+ 743:	b8 06 00 00 00       	mov    $0x6,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <exec>:
+SYSCALL(exec)
+ 74b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <exec2>:
+SYSCALL(exec2)
+ 753:	b8 16 00 00 00       	mov    $0x16,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <open>:
+SYSCALL(open)
+ 75b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <mknod>:
+SYSCALL(mknod)
+ 763:	b8 11 00 00 00       	mov    $0x11,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <unlink>:
+SYSCALL(unlink)
+ 76b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <fstat>:
+SYSCALL(fstat)
+ 773:	b8 08 00 00 00       	mov    $0x8,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <link>:
+SYSCALL(link)
+ 77b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <mkdir>:
+SYSCALL(mkdir)
+ 783:	b8 14 00 00 00       	mov    $0x14,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <chdir>:
+SYSCALL(chdir)
+ 78b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <dup>:
+SYSCALL(dup)
+ 793:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <getpid>:
+SYSCALL(getpid)
+ 79b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <sbrk>:
+SYSCALL(sbrk)
+ 7a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <sleep>:
+SYSCALL(sleep)
+ 7ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <uptime>:
+SYSCALL(uptime)
+ 7b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <setmemorylimit>:
+SYSCALL(setmemorylimit)
+ 7bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <listproc>:
+SYSCALL(listproc)
+ 7c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <thread_create>:
+SYSCALL(thread_create)
+ 7cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <thread_join>:
+SYSCALL(thread_join)
+ 7d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <thread_exit>:
+SYSCALL(thread_exit)
+ 7db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+ 7e3:	66 90                	xchg   %ax,%ax
+ 7e5:	66 90                	xchg   %ax,%ax
+ 7e7:	66 90                	xchg   %ax,%ax
+ 7e9:	66 90                	xchg   %ax,%ax
+ 7eb:	66 90                	xchg   %ax,%ax
+ 7ed:	66 90                	xchg   %ax,%ax
+ 7ef:	90                   	nop
+
+000007f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7f8:	89 d1                	mov    %edx,%ecx
+{
+ 7fa:	83 ec 3c             	sub    $0x3c,%esp
+ 7fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 800:	85 d2                	test   %edx,%edx
+ 802:	0f 89 80 00 00 00    	jns    888 <printint+0x98>
+ 808:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 80c:	74 7a                	je     888 <printint+0x98>
+    x = -xx;
+ 80e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 810:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 815:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 818:	31 f6                	xor    %esi,%esi
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 820:	89 c8                	mov    %ecx,%eax
+ 822:	31 d2                	xor    %edx,%edx
+ 824:	89 f7                	mov    %esi,%edi
+ 826:	f7 f3                	div    %ebx
+ 828:	8d 76 01             	lea    0x1(%esi),%esi
+ 82b:	0f b6 92 54 0e 00 00 	movzbl 0xe54(%edx),%edx
+ 832:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 836:	89 ca                	mov    %ecx,%edx
+ 838:	89 c1                	mov    %eax,%ecx
+ 83a:	39 da                	cmp    %ebx,%edx
+ 83c:	73 e2                	jae    820 <printint+0x30>
+  if(neg)
+ 83e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 841:	85 c0                	test   %eax,%eax
+ 843:	74 07                	je     84c <printint+0x5c>
+    buf[i++] = '-';
+ 845:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 84a:	89 f7                	mov    %esi,%edi
+ 84c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 84f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 852:	01 df                	add    %ebx,%edi
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 858:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 85b:	83 ec 04             	sub    $0x4,%esp
+ 85e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 861:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 864:	6a 01                	push   $0x1
+ 866:	50                   	push   %eax
+ 867:	56                   	push   %esi
+ 868:	e8 c6 fe ff ff       	call   733 <write>
+  while(--i >= 0)
+ 86d:	89 f8                	mov    %edi,%eax
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	83 ef 01             	sub    $0x1,%edi
+ 875:	39 d8                	cmp    %ebx,%eax
+ 877:	75 df                	jne    858 <printint+0x68>
+}
+ 879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87c:	5b                   	pop    %ebx
+ 87d:	5e                   	pop    %esi
+ 87e:	5f                   	pop    %edi
+ 87f:	5d                   	pop    %ebp
+ 880:	c3                   	ret
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 888:	31 c0                	xor    %eax,%eax
+ 88a:	eb 89                	jmp    815 <printint+0x25>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000890 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 899:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 89c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 89f:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a2:	83 c6 01             	add    $0x1,%esi
+ 8a5:	84 db                	test   %bl,%bl
+ 8a7:	74 67                	je     910 <printf+0x80>
+ 8a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8ac:	31 d2                	xor    %edx,%edx
+ 8ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8b1:	eb 34                	jmp    8e7 <printf+0x57>
+ 8b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8b7:	90                   	nop
+ 8b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8c0:	83 f8 25             	cmp    $0x25,%eax
+ 8c3:	74 18                	je     8dd <printf+0x4d>
+  write(fd, &c, 1);
+ 8c5:	83 ec 04             	sub    $0x4,%esp
+ 8c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ce:	6a 01                	push   $0x1
+ 8d0:	50                   	push   %eax
+ 8d1:	57                   	push   %edi
+ 8d2:	e8 5c fe ff ff       	call   733 <write>
+ 8d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8e0:	83 c6 01             	add    $0x1,%esi
+ 8e3:	84 db                	test   %bl,%bl
+ 8e5:	74 29                	je     910 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8ea:	85 d2                	test   %edx,%edx
+ 8ec:	74 ca                	je     8b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ee:	83 fa 25             	cmp    $0x25,%edx
+ 8f1:	75 ea                	jne    8dd <printf+0x4d>
+      if(c == 'd'){
+ 8f3:	83 f8 25             	cmp    $0x25,%eax
+ 8f6:	0f 84 24 01 00 00    	je     a20 <printf+0x190>
+ 8fc:	83 e8 63             	sub    $0x63,%eax
+ 8ff:	83 f8 15             	cmp    $0x15,%eax
+ 902:	77 1c                	ja     920 <printf+0x90>
+ 904:	ff 24 85 fc 0d 00 00 	jmp    *0xdfc(,%eax,4)
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 913:	5b                   	pop    %ebx
+ 914:	5e                   	pop    %esi
+ 915:	5f                   	pop    %edi
+ 916:	5d                   	pop    %ebp
+ 917:	c3                   	ret
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 926:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 92a:	6a 01                	push   $0x1
+ 92c:	52                   	push   %edx
+ 92d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 930:	57                   	push   %edi
+ 931:	e8 fd fd ff ff       	call   733 <write>
+ 936:	83 c4 0c             	add    $0xc,%esp
+ 939:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 93c:	6a 01                	push   $0x1
+ 93e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 941:	52                   	push   %edx
+ 942:	57                   	push   %edi
+ 943:	e8 eb fd ff ff       	call   733 <write>
+        putc(fd, c);
+ 948:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94b:	31 d2                	xor    %edx,%edx
+ 94d:	eb 8e                	jmp    8dd <printf+0x4d>
+ 94f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 950:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 95b:	8b 13                	mov    (%ebx),%edx
+ 95d:	6a 00                	push   $0x0
+ 95f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 961:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 964:	e8 87 fe ff ff       	call   7f0 <printint>
+        ap++;
+ 969:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 96c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 67 ff ff ff       	jmp    8dd <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 980:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 983:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 985:	83 c0 04             	add    $0x4,%eax
+ 988:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 98b:	85 db                	test   %ebx,%ebx
+ 98d:	0f 84 9d 00 00 00    	je     a30 <printf+0x1a0>
+        while(*s != 0){
+ 993:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 996:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 998:	84 c0                	test   %al,%al
+ 99a:	0f 84 3d ff ff ff    	je     8dd <printf+0x4d>
+ 9a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9a6:	89 de                	mov    %ebx,%esi
+ 9a8:	89 d3                	mov    %edx,%ebx
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	53                   	push   %ebx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 71 fd ff ff       	call   733 <write>
+        while(*s != 0){
+ 9c2:	0f b6 06             	movzbl (%esi),%eax
+ 9c5:	83 c4 10             	add    $0x10,%esp
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	75 e4                	jne    9b0 <printf+0x120>
+      state = 0;
+ 9cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9cf:	31 d2                	xor    %edx,%edx
+ 9d1:	e9 07 ff ff ff       	jmp    8dd <printf+0x4d>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 01                	push   $0x1
+ 9ef:	e9 6b ff ff ff       	jmp    95f <printf+0xcf>
+ 9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9fb:	83 ec 04             	sub    $0x4,%esp
+ 9fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a09:	6a 01                	push   $0x1
+ a0b:	52                   	push   %edx
+ a0c:	57                   	push   %edi
+ a0d:	e8 21 fd ff ff       	call   733 <write>
+        ap++;
+ a12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a18:	31 d2                	xor    %edx,%edx
+ a1a:	e9 be fe ff ff       	jmp    8dd <printf+0x4d>
+ a1f:	90                   	nop
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a29:	6a 01                	push   $0x1
+ a2b:	e9 11 ff ff ff       	jmp    941 <printf+0xb1>
+ a30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a35:	bb f2 0d 00 00       	mov    $0xdf2,%ebx
+ a3a:	e9 61 ff ff ff       	jmp    9a0 <printf+0x110>
+ a3f:	90                   	nop
+
+00000a40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a41:	a1 1c 12 00 00       	mov    0x121c,%eax
+{
+ a46:	89 e5                	mov    %esp,%ebp
+ a48:	57                   	push   %edi
+ a49:	56                   	push   %esi
+ a4a:	53                   	push   %ebx
+ a4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a5c:	39 ca                	cmp    %ecx,%edx
+ a5e:	73 30                	jae    a90 <free+0x50>
+ a60:	39 c1                	cmp    %eax,%ecx
+ a62:	72 04                	jb     a68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a64:	39 c2                	cmp    %eax,%edx
+ a66:	72 f0                	jb     a58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a6e:	39 f8                	cmp    %edi,%eax
+ a70:	74 2e                	je     aa0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a75:	8b 42 04             	mov    0x4(%edx),%eax
+ a78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a7b:	39 f1                	cmp    %esi,%ecx
+ a7d:	74 38                	je     ab7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a81:	5b                   	pop    %ebx
+  freep = p;
+ a82:	89 15 1c 12 00 00    	mov    %edx,0x121c
+}
+ a88:	5e                   	pop    %esi
+ a89:	5f                   	pop    %edi
+ a8a:	5d                   	pop    %ebp
+ a8b:	c3                   	ret
+ a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a90:	39 c1                	cmp    %eax,%ecx
+ a92:	72 d0                	jb     a64 <free+0x24>
+ a94:	eb c2                	jmp    a58 <free+0x18>
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ aa0:	03 70 04             	add    0x4(%eax),%esi
+ aa3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aa6:	8b 02                	mov    (%edx),%eax
+ aa8:	8b 00                	mov    (%eax),%eax
+ aaa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ aad:	8b 42 04             	mov    0x4(%edx),%eax
+ ab0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ab3:	39 f1                	cmp    %esi,%ecx
+ ab5:	75 c8                	jne    a7f <free+0x3f>
+    p->s.size += bp->s.size;
+ ab7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aba:	89 15 1c 12 00 00    	mov    %edx,0x121c
+    p->s.size += bp->s.size;
+ ac0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ac3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ac6:	89 0a                	mov    %ecx,(%edx)
+}
+ ac8:	5b                   	pop    %ebx
+ ac9:	5e                   	pop    %esi
+ aca:	5f                   	pop    %edi
+ acb:	5d                   	pop    %ebp
+ acc:	c3                   	ret
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ad9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ adc:	8b 15 1c 12 00 00    	mov    0x121c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ae2:	8d 78 07             	lea    0x7(%eax),%edi
+ ae5:	c1 ef 03             	shr    $0x3,%edi
+ ae8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ aeb:	85 d2                	test   %edx,%edx
+ aed:	0f 84 8d 00 00 00    	je     b80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ af5:	8b 48 04             	mov    0x4(%eax),%ecx
+ af8:	39 f9                	cmp    %edi,%ecx
+ afa:	73 64                	jae    b60 <malloc+0x90>
+  if(nu < 4096)
+ afc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b01:	39 df                	cmp    %ebx,%edi
+ b03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b0d:	eb 0a                	jmp    b19 <malloc+0x49>
+ b0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b12:	8b 48 04             	mov    0x4(%eax),%ecx
+ b15:	39 f9                	cmp    %edi,%ecx
+ b17:	73 47                	jae    b60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b19:	89 c2                	mov    %eax,%edx
+ b1b:	39 05 1c 12 00 00    	cmp    %eax,0x121c
+ b21:	75 ed                	jne    b10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b23:	83 ec 0c             	sub    $0xc,%esp
+ b26:	56                   	push   %esi
+ b27:	e8 77 fc ff ff       	call   7a3 <sbrk>
+  if(p == (char*)-1)
+ b2c:	83 c4 10             	add    $0x10,%esp
+ b2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b32:	74 1c                	je     b50 <malloc+0x80>
+  hp->s.size = nu;
+ b34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b37:	83 ec 0c             	sub    $0xc,%esp
+ b3a:	83 c0 08             	add    $0x8,%eax
+ b3d:	50                   	push   %eax
+ b3e:	e8 fd fe ff ff       	call   a40 <free>
+  return freep;
+ b43:	8b 15 1c 12 00 00    	mov    0x121c,%edx
+      if((p = morecore(nunits)) == 0)
+ b49:	83 c4 10             	add    $0x10,%esp
+ b4c:	85 d2                	test   %edx,%edx
+ b4e:	75 c0                	jne    b10 <malloc+0x40>
+        return 0;
+  }
+}
+ b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b53:	31 c0                	xor    %eax,%eax
+}
+ b55:	5b                   	pop    %ebx
+ b56:	5e                   	pop    %esi
+ b57:	5f                   	pop    %edi
+ b58:	5d                   	pop    %ebp
+ b59:	c3                   	ret
+ b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b60:	39 cf                	cmp    %ecx,%edi
+ b62:	74 4c                	je     bb0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b64:	29 f9                	sub    %edi,%ecx
+ b66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b6f:	89 15 1c 12 00 00    	mov    %edx,0x121c
+}
+ b75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b78:	83 c0 08             	add    $0x8,%eax
+}
+ b7b:	5b                   	pop    %ebx
+ b7c:	5e                   	pop    %esi
+ b7d:	5f                   	pop    %edi
+ b7e:	5d                   	pop    %ebp
+ b7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b80:	c7 05 1c 12 00 00 20 	movl   $0x1220,0x121c
+ b87:	12 00 00 
+    base.s.size = 0;
+ b8a:	b8 20 12 00 00       	mov    $0x1220,%eax
+    base.s.ptr = freep = prevp = &base;
+ b8f:	c7 05 20 12 00 00 20 	movl   $0x1220,0x1220
+ b96:	12 00 00 
+    base.s.size = 0;
+ b99:	c7 05 24 12 00 00 00 	movl   $0x0,0x1224
+ ba0:	00 00 00 
+    if(p->s.size >= nunits){
+ ba3:	e9 54 ff ff ff       	jmp    afc <malloc+0x2c>
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bb0:	8b 08                	mov    (%eax),%ecx
+ bb2:	89 0a                	mov    %ecx,(%edx)
+ bb4:	eb b9                	jmp    b6f <malloc+0x9f>
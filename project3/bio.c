@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -21,75 +21,208 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "slab.h"
 
-struct {
-  struct spinlock lock;
-  struct buf buf[NBUF];
+#define NBUCKET 13
+#define BHASH(dev, blockno) ((((dev) << 27) | (blockno)) % NBUCKET)
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
+struct bucket {
+  struct spinlock lock;
+  // Circular list of buffers hashed to this bucket, through prev/next.
   struct buf head;
+};
+
+struct {
+  // Serializes buffer recycling, so that at most one CPU at a time
+  // moves buffers between buckets.
+  struct spinlock lock;
+  struct slabcache cache;
+  uint nbuf;
+  // Buffers are never freed, so their data blocks are carved
+  // from whole pages, PGSIZE/BSIZE at a time.
+  uchar *data;
+  uint ndata;
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+// Unlink b from its bucket.  Caller must hold the bucket lock.
+static void
+bunlink(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
+// Link b at the front of bucket bk.  Caller must hold bk->lock.
+static void
+blink(struct bucket *bk, struct buf *b)
+{
+  b->next = bk->head.next;
+  b->prev = &bk->head;
+  bk->head.next->prev = b;
+  bk->head.next = b;
+}
+
+static void
+bufctor(void *v)
+{
+  initsleeplock(&((struct buf*)v)->lock, "buffer");
+}
+
+// Allocate a new buffer, not yet in any bucket.
+// Returns 0 if there is no memory left.
+static struct buf*
+bnew(void)
+{
+  struct buf *b;
+
+  if(bcache.ndata == 0){
+    if((bcache.data = (uchar*)kalloc()) == 0)
+      return 0;
+    bcache.ndata = PGSIZE/BSIZE;
+  }
+  if((b = slaballoc(&bcache.cache)) == 0)
+    return 0;
+  // The constructor leaves everything but the lock as it was.
+  b->flags = 0;
+  b->dev = b->blockno = ~0;
+  b->refcnt = 0;
+  b->lastuse = 0;
+  b->qnext = 0;
+  b->data = bcache.data;
+  bcache.data += BSIZE;
+  bcache.ndata--;
+  bcache.nbuf++;
+  return b;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  slabinit(&bcache.cache, "buf", sizeof(struct buf), bufctor);
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    initlock(&bk->lock, "bcache.bucket");
+    bk->head.prev = &bk->head;
+    bk->head.next = &bk->head;
+  }
+
+  // Start with NBUF buffers spread over the buckets; bget()
+  // moves them to the right bucket when they are first used,
+  // and adds more if they are ever all in use.
+  for(i = 0; i < NBUF; i++){
+    if((b = bnew()) == 0)
+      panic("binit");
+    blink(&bcache.bucket[i % NBUCKET], b);
   }
 }
 
+// Look for block on device dev in bucket bk.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head.next; b != &bk->head; b = b->next){
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  }
+  return 0;
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
 static struct buf*
 bget(uint dev, uint blockno)
 {
-  struct buf *b;
+  struct buf *b, *c, *victim;
+  struct bucket *bk, *vbk, *cur;
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BHASH(dev, blockno)];
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
+  // Not cached; recycle the least recently used unused buffer.
+  // Only one CPU at a time may recycle, so check again in case
+  // another one cached the block while we did not hold bk->lock.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    release(&bcache.lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+  release(&bk->lock);
+
+  // Scan every bucket, keeping only the lock of the bucket that
+  // holds the best victim so far.  Other CPUs never hold one bucket
+  // lock while waiting for another, so this cannot deadlock.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  victim = 0;
+  vbk = 0;
+  for(cur = bcache.bucket; cur < bcache.bucket+NBUCKET; cur++){
+    acquire(&cur->lock);
+    b = 0;
+    for(c = cur->head.next; c != &cur->head; c = c->next){
+      if(c->refcnt == 0 && (c->flags & B_DIRTY) == 0 &&
+         (b == 0 || c->lastuse < b->lastuse))
+        b = c;
+    }
+    if(b && (victim == 0 || b->lastuse < victim->lastuse)){
+      if(vbk)
+        release(&vbk->lock);
+      victim = b;
+      vbk = cur;
+    } else {
+      release(&cur->lock);
+    }
+  }
+  if(victim == 0){
+    // Every buffer is busy; grow the cache.
+    if((b = bnew()) == 0)
+      panic("bget: no buffers");
+  } else
+    b = victim;
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  if(vbk != bk){
+    if(vbk){
+      bunlink(b);
+      release(&vbk->lock);
     }
+    acquire(&bk->lock);
+    blink(bk, b);
   }
-  panic("bget: no buffers");
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -115,8 +248,52 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Drop a reference to b.
+// Stamp it with the current tick so bget() recycles
+// the least recently used buffer first.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    b->lastuse = ticks;
+  }
+  release(&bk->lock);
+}
+
+// Start reading a block into the cache without waiting for it,
+// unless it is cached already.  The disk interrupt releases the
+// buffer through bdone() once the data is in.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
+// Release a buffer whose read-ahead has finished.
+// Called from the disk interrupt, which does not own b->lock
+// in the sense holdingsleep() checks.
+void
+bdone(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bput(b);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
@@ -124,21 +301,8 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
-
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+  bput(b);
 }
+
 //PAGEBREAK!
 // Blank page.
-
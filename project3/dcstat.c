@@ -0,0 +1,18 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "dcstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct dcstat st;
+
+  if(dcstat(&st) < 0){
+    printf(2, "dcstat: failed\n");
+    exit();
+  }
+  printf(1, "hits %d negative hits %d misses %d\n",
+         st.nhit, st.nneg, st.nmiss);
+  exit();
+}
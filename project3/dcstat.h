@@ -0,0 +1,6 @@
+// Name cache counters, returned by the dcstat system call.
+struct dcstat {
+  uint nhit;   // lookups answered with an inode
+  uint nneg;   // lookups answered with "no such name"
+  uint nmiss;  // lookups that had to read the directory
+};
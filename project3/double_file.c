@@ -2,9 +2,8 @@
 #include "stat.h"
 #include "user.h"
 #include "fcntl.h"
+#include "fs.h"
 
-#define BSIZE 512
-#define NINDIRECT (BSIZE / sizeof(uint))
 #define NDBLINDIRECT ((NINDIRECT) * (NINDIRECT))
 #define NUM_BYTES (8 * 1024 * 1024)
 
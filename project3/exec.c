@@ -33,19 +33,6 @@ exec(char *path, char **argv)
   }
   ilock(ip);
 
-  // for symbolic link
-  if (ip->type == T_SYMLINK) {
-    path = ip->repath;
-
-    iunlockput(ip);
-    if ((ip = namei(path)) == 0) {
-      end_op();
-      cprintf("exec: fail\n");
-      return -1;
-    }
-    ilock(ip);
-  }
-
   pgdir = 0;
 
   // Check ELF header
@@ -3,3 +3,4 @@
 #define O_RDWR    0x002
 #define O_CREATE  0x200
 #define O_LOOKUP  0x004
+#define O_EXTENT  0x400  // with O_CREATE: map new file by extents
@@ -13,7 +13,7 @@ struct file {
 
 
 // #include "sleeplock.h"
-#define MAXPATH 50
+#define MAXPATH 128
 
 // in-memory copy of an inode
 struct inode {
@@ -22,15 +22,19 @@ struct inode {
   int ref;            // Reference count
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
-  int isSymlink;      // is this symbolic link?
-  char repath[MAXPATH];       // redirection path for symlink
+  uint lastblock;     // last block allocated, balloc() hint
+  uint ranext;        // offset where the last readi() ended
+  uint rahead;        // first block not yet read ahead
 
   short type;         // copy of disk inode
+  short flags;
   short major;
   short minor;
   short nlink;
   uint size;
   uint addrs[NDIRECT+1+1+1];
+  struct inode *next;  // icache bucket chain, most recently used
+  struct inode *prev;  // first; protected by the bucket's lock
 };
 
 // table mapping major device number to
@@ -20,8 +20,11 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "slab.h"
+#include "dcstat.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
 static void itrunc(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
@@ -51,30 +54,142 @@ bzero(int dev, int bno)
 }
 
 // Blocks.
+//
+// bsum summarizes the free bitmap so that balloc() does not
+// have to read full bitmap blocks.  nfree[i] is the number of
+// free blocks described by bitmap block i, or -1 until that
+// block has first been read.  It changes only while the
+// bitmap block's buffer is locked, so it is exact for whoever
+// holds that lock and a hint for everybody else.
+
+#define NBMAP (FSSIZE/BPB + 1)  // most bitmap blocks of a file system
+
+struct {
+  struct spinlock lock;
+  int nfree[NBMAP];
+  uint cursor;  // bitmap block where the last search succeeded
+} bsum;
+
+// Count the free blocks among the first n bits of bitmap words w.
+static int
+bcount(uint *w, uint n)
+{
+  uint i, x;
+  int free;
+
+  free = 0;
+  for(i = 0; i < n; i += 32){
+    x = ~w[i/32];
+    if(n - i < 32)
+      x &= (1U << (n - i)) - 1;
+    for(; x; x &= x - 1)
+      free++;
+  }
+  return free;
+}
 
-// Allocate a zeroed disk block.
+// Find the first clear bit at or after from and before n
+// in bitmap words w, checking 32 bits at a time.
+// Returns -1 if there is none.
+static int
+bscan(uint *w, uint from, uint n)
+{
+  uint i, x;
+  int bi;
+
+  for(i = from/32; i*32 < n; i++){
+    x = ~w[i];
+    if(i == from/32)
+      x &= ~((1U << (from % 32)) - 1);
+    if(x == 0)
+      continue;
+    for(bi = 0; (x & (1U << bi)) == 0; bi++)
+      ;
+    if(i*32 + bi >= n)
+      return -1;
+    return i*32 + bi;
+  }
+  return -1;
+}
+
+// Try to allocate a block described by bitmap block bb,
+// at bit from or later.  Returns the block number, or 0.
 static uint
-balloc(uint dev)
+ballocin(uint dev, uint bb, uint from)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint base, n;
+  int bi;
+
+  base = bb * BPB;
+  n = sb.size - base < BPB ? sb.size - base : BPB;
+  bp = bread(dev, sb.bmapstart + bb);
+  acquire(&bsum.lock);
+  if(bsum.nfree[bb] < 0)
+    bsum.nfree[bb] = bcount((uint*)bp->data, n);
+  release(&bsum.lock);
+
+  if((bi = bscan((uint*)bp->data, from, n)) < 0){
+    brelse(bp);
+    return 0;
+  }
+  bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+  log_write(bp);
+  acquire(&bsum.lock);
+  bsum.nfree[bb]--;
+  bsum.cursor = bb;
+  release(&bsum.lock);
+  brelse(bp);
+  bzero(dev, base + bi);
+  return base + bi;
+}
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+// Allocate a zeroed disk block, preferably the one after near
+// so that files get contiguous runs of blocks.  near may be 0.
+static uint
+balloc(uint dev, uint near)
+{
+  uint b, bb, nbmap, start;
+
+  nbmap = (sb.size + BPB - 1) / BPB;
+  if(near != 0 && near + 1 < sb.size){
+    if((b = ballocin(dev, BBLOCK(near + 1, sb) - sb.bmapstart,
+                     (near + 1) % BPB)) != 0)
+      return b;
+  }
+
+  start = bsum.cursor;
+  for(bb = 0; bb < nbmap; bb++){
+    if(bsum.nfree[(start + bb) % nbmap] == 0)
+      continue;
+    if((b = ballocin(dev, (start + bb) % nbmap, 0)) != 0)
+      return b;
+  }
+  panic("balloc: out of blocks");
+}
+
+// Free the n disk blocks starting at b,
+// updating each bitmap block once.
+static void
+bfreerange(int dev, uint b, uint n)
+{
+  struct buf *bp;
+  uint bi, end;
+
+  for(end = b + n; b < end; ){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        panic("freeing free block");
+      bp->data[bi/8] &= ~(1 << (bi % 8));
+      acquire(&bsum.lock);
+      if(bsum.nfree[b / BPB] >= 0)
+        bsum.nfree[b / BPB]++;
+      release(&bsum.lock);
     }
+    log_write(bp);
     brelse(bp);
   }
-  panic("balloc: out of blocks");
 }
 
 // Free a disk block.
@@ -91,9 +206,22 @@ bfree(int dev, uint b)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
+  acquire(&bsum.lock);
+  if(bsum.nfree[b / BPB] >= 0)
+    bsum.nfree[b / BPB]++;
+  release(&bsum.lock);
   brelse(bp);
 }
 
+// Allocate a block for ip, right after the last one
+// allocated to it if possible.
+static uint
+bnext(struct inode *ip)
+{
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+  return ip->lastblock;
+}
+
 // Inodes.
 //
 // An inode describes a single unnamed file.
@@ -119,12 +247,13 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to the entry (open files and current
+//   directories). iget() finds or creates a cache entry and
+//   increments its ref; iput() decrements ref.  An entry
+//   whose ref is zero stays cached, with its contents, until
+//   it is the least recently used unreferenced entry of its
+//   hash bucket and the bucket has too many of them.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -154,31 +283,96 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The icache is a hash table on (dev, inum).  Each bucket's
+// spin-lock protects its chain of entries, kept in most recently
+// used order, and their ip->ref, ip->dev and ip->inum; one must
+// hold the bucket lock while using any of those fields.  Entries
+// come from a slab cache.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
-struct {
+// The name cache, further down with the directory code.
+static void dcacheinit(void);
+static void dcachepurge(uint, uint);
+
+#define NIBUCKET 127
+#define IHASH(dev, inum) ((((dev) << 27) | (inum)) % NIBUCKET)
+#define IBUCKETIDLE 8  // most unreferenced inodes a bucket keeps
+
+struct ibucket {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *inode;  // Chain through next/prev, most recent first
+  int nidle;            // Entries in the chain with ref 0
+};
+
+struct {
+  struct slabcache cache;
+  struct ibucket bucket[NIBUCKET];
 } icache;
 
+static struct ibucket*
+ibucket(struct inode *ip)
+{
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+}
+
+// Unlink ip from its bucket's chain.  Caller must hold bk->lock.
+static void
+iunlink(struct ibucket *bk, struct inode *ip)
+{
+  if(ip->prev)
+    ip->prev->next = ip->next;
+  else
+    bk->inode = ip->next;
+  if(ip->next)
+    ip->next->prev = ip->prev;
+}
+
+// Put ip at the front of bk's chain.  Caller must hold bk->lock.
+static void
+ilink(struct ibucket *bk, struct inode *ip)
+{
+  ip->prev = 0;
+  ip->next = bk->inode;
+  if(bk->inode)
+    bk->inode->prev = ip;
+  bk->inode = ip;
+}
+
+static void
+inodector(void *v)
+{
+  initsleeplock(&((struct inode*)v)->lock, "inode");
+}
+
+// Runs from main(), before userinit() looks up "/";
+// the rest of iinit() has to wait for a process context.
+void
+icacheinit(void)
+{
+  int i;
+
+  for(i = 0; i < NIBUCKET; i++)
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+  dcacheinit();
+  slabinit(&icache.cache, "inode", sizeof(struct inode), inodector);
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
-  initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  int i;
 
   readsb(dev, &sb);
+  if(sb.bsize != BSIZE)
+    panic("iinit: wrong block size");
+  if(sb.size > FSSIZE)
+    panic("iinit: file system too big");
+  initlock(&bsum.lock, "bsum");
+  for(i = 0; i < NBMAP; i++)
+    bsum.nfree[i] = -1;
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
@@ -226,6 +420,7 @@ iupdate(struct inode *ip)
   bp = bread(ip->dev, IBLOCK(ip->inum, sb));
   dip = (struct dinode*)bp->data + ip->inum%IPB;
   dip->type = ip->type;
+  dip->flags = ip->flags;
   dip->major = ip->major;
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
@@ -241,32 +436,33 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
+  struct ibucket *bk;
 
-  acquire(&icache.lock);
+  bk = &icache.bucket[IHASH(dev, inum)];
+  acquire(&bk->lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
+  for(ip = bk->inode; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        bk->nidle--;
+      iunlink(bk, ip);
+      ilink(bk, ip);
+      release(&bk->lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Allocate a new inode cache entry.
+  if((ip = slaballoc(&icache.cache)) == 0)
     panic("iget: no inodes");
-
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  ilink(bk, ip);
+  release(&bk->lock);
 
   return ip;
 }
@@ -276,9 +472,12 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *bk;
+
+  bk = ibucket(ip);
+  acquire(&bk->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&bk->lock);
   return ip;
 }
 
@@ -299,12 +498,16 @@ ilock(struct inode *ip)
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     ip->type = dip->type;
+    ip->flags = dip->flags;
     ip->major = dip->major;
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->lastblock = 0;
+    ip->ranext = 0;
+    ip->rahead = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -322,8 +525,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry
+// stays cached unless its bucket has enough idle entries.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -331,13 +534,19 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *bk;
+  struct inode *victim;
+
+  bk = ibucket(ip);
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&bk->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&bk->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcachepurge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -346,9 +555,27 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  acquire(&bk->lock);
+  if(--ip->ref == 0){
+    // A freed inode is not worth keeping.
+    victim = ip;
+    if(ip->valid){
+      // Else give up the least recently used idle one.
+      victim = 0;
+      if(++bk->nidle > IBUCKETIDLE){
+        for(victim = ip; victim->next; victim = victim->next)
+          ;
+        while(victim->ref > 0)
+          victim = victim->prev;
+        bk->nidle--;
+      }
+    }
+    if(victim){
+      iunlink(bk, victim);
+      slabfree(&icache.cache, victim);
+    }
+  }
+  release(&bk->lock);
 }
 
 // Common idiom: unlock, then put.
@@ -367,18 +594,124 @@ iunlockput(struct inode *ip)
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
 // listed in block ip->addrs[NDIRECT].
 
+// Return the index of the first of extents e[0..n) that ends
+// after logical block bn or is unused, or n if there is none.
+static int
+efind(struct extent *e, int n, uint bn)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n;
+  while(lo < hi){
+    mid = (lo + hi) / 2;
+    if(e[mid].end == 0 || e[mid].end > bn)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+// bmap() for an extent-mapped inode: a binary search of the
+// inode's extents, and of the extent blocks, one after another,
+// only for files with more than NIEXTENT extents.  Files have no
+// holes, so a block that is not mapped yet is the one after the
+// end of the file; it extends the last extent if the disk block
+// after it was free, and otherwise starts a new extent, chaining
+// on another extent block when the last one is full.
+static uint
+emap(struct inode *ip, uint bn, int alloc)
+{
+  struct extent *e, *last;
+  struct buf *bp;
+  uint addr, prev, next, xb;
+  int i, n;
+
+  bp = 0;
+  e = (struct extent*)ip->addrs;
+  n = NIEXTENT;
+  i = efind(e, n, bn);
+  for(next = ip->addrs[EXTBLOCK]; i == n && next != 0; ){
+    if(bp)
+      brelse(bp);
+    bp = bread(ip->dev, next);
+    e = (struct extent*)bp->data;
+    n = NBEXTENT;
+    i = efind(e, n, bn);
+    next = EXTNEXT(bp->data);
+  }
+  last = 0;
+  prev = 0;
+  if(i > 0 && e[i-1].end != 0){
+    last = &e[i-1];
+    prev = last->end;
+  }
+
+  if(i < n && e[i].end != 0){
+    addr = e[i].pend - (e[i].end - bn);
+    goto out;
+  }
+
+  if(!alloc){
+    addr = 0;
+    goto out;
+  }
+  if(bn != prev)
+    panic("emap: hole");
+  addr = balloc(ip->dev, last ? last->pend - 1 : ip->lastblock);
+  ip->lastblock = addr;
+  if(last && last->pend == addr){
+    last->end++;
+    last->pend++;
+  } else {
+    if(i == n){
+      // The extents so far are full; start an extent block.
+      // Put it in front of the new run rather than in its way.
+      xb = balloc(ip->dev, addr);
+      if(xb == addr + 1){
+        xb = addr++;
+        ip->lastblock = addr;
+      }
+      if(bp){
+        EXTNEXT(bp->data) = xb;
+        log_write(bp);
+        brelse(bp);
+      } else
+        ip->addrs[EXTBLOCK] = xb;
+      bp = bread(ip->dev, xb);
+      e = (struct extent*)bp->data;
+      n = NBEXTENT;
+      i = 0;
+    }
+    e[i].end = bn + 1;
+    e[i].pend = addr + 1;
+  }
+  if(bp)
+    log_write(bp);
+
+out:
+  if(bp)
+    brelse(bp);
+  return addr;
+}
+
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one if alloc is
+// set and returns 0 otherwise.
 static uint
-bmap(struct inode *ip, uint bn)
+bmap(struct inode *ip, uint bn, int alloc)
 {
 
   uint addr, *a;
   struct buf *bp;
 
+  if(ip->flags & I_EXTENT)
+    return emap(ip, bn, alloc);
+
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+      ip->addrs[bn] = addr = bnext(ip);
     return addr;
   }
   bn -= NDIRECT;
@@ -386,12 +719,14 @@ bmap(struct inode *ip, uint bn)
   // Single indirect blocks
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[NDIRECT]) == 0 && alloc)
+      ip->addrs[NDIRECT] = addr = bnext(ip);
+    if(addr == 0)
+      return 0;
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[bn]) == 0 && alloc){
+      a[bn] = addr = bnext(ip);
       log_write(bp);
     }
     brelse(bp);
@@ -402,8 +737,10 @@ bmap(struct inode *ip, uint bn)
   // Double indirect blocks
   if(bn < DINDIRECT){
     // Load double indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT+1]) == 0)
-      ip->addrs[NDIRECT+1] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[NDIRECT+1]) == 0 && alloc)
+      ip->addrs[NDIRECT+1] = addr = bnext(ip);
+    if(addr == 0)
+      return 0;
 
     uint indirect_blockidx = bn / NINDIRECT;
     uint inside_blockidx = bn % NINDIRECT;
@@ -412,18 +749,20 @@ bmap(struct inode *ip, uint bn)
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
 
-    if ((addr = a[indirect_blockidx]) == 0) {
-      a[indirect_blockidx] = addr = balloc(ip->dev);
+    if ((addr = a[indirect_blockidx]) == 0 && alloc) {
+      a[indirect_blockidx] = addr = bnext(ip);
       log_write(bp);
     }
     brelse(bp);
+    if(addr == 0)
+      return 0;
 
     // for inside blocks
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
 
-    if ((addr = a[inside_blockidx]) == 0) {
-      a[inside_blockidx] = addr = balloc(ip->dev);
+    if ((addr = a[inside_blockidx]) == 0 && alloc) {
+      a[inside_blockidx] = addr = bnext(ip);
       log_write(bp);
     }
 
@@ -435,8 +774,10 @@ bmap(struct inode *ip, uint bn)
   // Triple indirect block
   if(bn < TINDIRECT){
     // Load double indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT+2]) == 0)
-      ip->addrs[NDIRECT+2] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[NDIRECT+2]) == 0 && alloc)
+      ip->addrs[NDIRECT+2] = addr = bnext(ip);
+    if(addr == 0)
+      return 0;
 
     // for 1st layer blocks
     bp = bread(ip->dev, addr);
@@ -445,11 +786,13 @@ bmap(struct inode *ip, uint bn)
     uint outer_index = bn / DINDIRECT;
     uint outer_offset = bn % DINDIRECT;
 
-    if ((addr = a[outer_index]) == 0) {
-      a[outer_index] = addr = balloc(ip->dev);
+    if ((addr = a[outer_index]) == 0 && alloc) {
+      a[outer_index] = addr = bnext(ip);
       log_write(bp);
     }
     brelse(bp);
+    if(addr == 0)
+      return 0;
 
     // for 2nd layer blocks
     bp = bread(ip->dev, addr);
@@ -458,18 +801,20 @@ bmap(struct inode *ip, uint bn)
     uint inner_index = outer_offset / NINDIRECT;
     uint inner_offset = outer_offset % NINDIRECT;
 
-    if ((addr = a[inner_index]) == 0) {
-      a[inner_index] = addr = balloc(ip->dev);
+    if ((addr = a[inner_index]) == 0 && alloc) {
+      a[inner_index] = addr = bnext(ip);
       log_write(bp);
     }
     brelse(bp);
+    if(addr == 0)
+      return 0;
 
     // for 3rd layer blocks
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
 
-    if ((addr = a[inner_offset]) == 0) {
-      a[inner_offset] = addr = balloc(ip->dev);
+    if ((addr = a[inner_offset]) == 0 && alloc) {
+      a[inner_offset] = addr = bnext(ip);
       log_write(bp);
     }
     brelse(bp);
@@ -478,6 +823,39 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
+// Free the extents in e[0..n), given the logical block
+// before the first one.  Returns the end of the last extent.
+static uint
+efree(uint dev, struct extent *e, int n, uint prev)
+{
+  int i;
+
+  for(i = 0; i < n && e[i].end != 0; i++){
+    bfreerange(dev, e[i].pend - (e[i].end - prev), e[i].end - prev);
+    prev = e[i].end;
+  }
+  return prev;
+}
+
+// itrunc() for an extent-mapped inode: one bfreerange()
+// per extent instead of one bfree() per block.
+static void
+etrunc(struct inode *ip)
+{
+  struct buf *bp;
+  uint prev, xb, next;
+
+  prev = efree(ip->dev, (struct extent*)ip->addrs, NIEXTENT, 0);
+  for(xb = ip->addrs[EXTBLOCK]; xb != 0; xb = next){
+    bp = bread(ip->dev, xb);
+    prev = efree(ip->dev, (struct extent*)bp->data, NBEXTENT, prev);
+    next = EXTNEXT(bp->data);
+    brelse(bp);
+    bfree(ip->dev, xb);
+  }
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -490,6 +868,21 @@ itrunc(struct inode *ip)
   struct buf *bp, *bp2, *bp3;
   uint *a, *b, *c;
 
+  if(ip->flags & I_INLINE){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->flags &= ~I_INLINE;
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
+  if(ip->flags & I_EXTENT){
+    etrunc(ip);
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
   for (i = 0; i < NDIRECT; i++) {
     if (ip->addrs[i]) {
       bfree(ip->dev, ip->addrs[i]);
@@ -592,13 +985,31 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Blocks readi() reads ahead of a sequential reader.
+static int readahead = 8;
+
+// Set the read-ahead window to n blocks, if n is not negative.
+// Returns the previous window, or -1 if n is too big.
+int
+setreadahead(int n)
+{
+  int old;
+
+  if(n > MAXREADAHEAD)
+    return -1;
+  old = readahead;
+  if(n >= 0)
+    readahead = n;
+  return old;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr, bn, end;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -612,22 +1023,69 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  if(ip->flags & I_INLINE){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
+
+  // A read that starts where the last one ended is sequential.
+  // Queue its blocks and the next readahead ones without waiting,
+  // so that the disk merges them and the blocks are cached by
+  // the time they are asked for.
+  if(off != ip->ranext)
+    ip->rahead = 0;
+  else if(readahead > 0){
+    end = (off + n + BSIZE - 1)/BSIZE + readahead;
+    if(end > (ip->size + BSIZE - 1)/BSIZE)
+      end = (ip->size + BSIZE - 1)/BSIZE;
+    for(bn = max(off/BSIZE, ip->rahead); bn < end; bn++)
+      if((addr = bmap(ip, bn, 0)) != 0)
+        breadahead(ip->dev, addr);
+    ip->rahead = max(end, ip->rahead);
+  }
+  ip->ranext = off + n;
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+      // A hole, e.g. in a hashed directory's table.
+      memset(dst, 0, m);
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
   return n;
 }
 
+// Move the inline data of ip out to a data block, so that
+// it can grow past NINLINE bytes.  Caller must hold ip->lock.
+static void
+iexpand(struct inode *ip)
+{
+  char data[NINLINE];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, ip->size);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  ip->flags &= ~I_INLINE;
+  if(ip->size > 0){
+    bp = bread(ip->dev, bmap(ip, 0, 1));
+    memmove(bp->data, data, ip->size);
+    log_write(bp);
+    brelse(bp);
+  }
+  iupdate(ip);
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -641,13 +1099,31 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  // An empty file that stays tiny keeps its data in the inode.
+  if(ip->type == T_FILE && ip->size == 0 && n > 0 && off + n <= NINLINE &&
+     (ip->flags & (I_EXTENT|I_INLINE)) == 0)
+    ip->flags |= I_INLINE;
+  if(ip->flags & I_INLINE){
+    if(off + n <= NINLINE){
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      return n;
+    }
+    iexpand(ip);
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if((addr = bmap(ip, off/BSIZE, 1)) == 0)
+      break;
+    bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
     brelse(bp);
   }
+  n = tot;
 
   if(n > 0 && off > ip->size){
     ip->size = off;
@@ -656,6 +1132,38 @@ writei(struct inode *ip, char *src, uint off, uint n)
   return n;
 }
 
+// Make target, n bytes long, the contents of the new symlink ip.
+// Caller must hold ip->lock.
+void
+writelink(struct inode *ip, char *target, uint n)
+{
+  if(ip->type != T_SYMLINK || ip->size != 0)
+    panic("writelink");
+
+  if(n <= NINLINE){
+    memmove(ip->addrs, target, n);
+    ip->flags |= I_INLINE;
+    ip->size = n;
+    iupdate(ip);
+    return;
+  }
+  if(writei(ip, target, 0, n) != n)
+    panic("writelink: writei");
+}
+
+// Copy the target of symlink ip into buf, which holds n bytes,
+// and null-terminate it.  Caller must hold ip->lock.
+int
+readlink(struct inode *ip, char *buf, uint n)
+{
+  if(ip->type != T_SYMLINK || ip->size >= n)
+    return -1;
+  if(readi(ip, buf, 0, ip->size) != ip->size)
+    return -1;
+  buf[ip->size] = 0;
+  return ip->size;
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -665,31 +1173,273 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
-// Look for a directory entry in a directory.
-// If found, set *poff to byte offset of entry.
-struct inode*
-dirlookup(struct inode *dp, char *name, uint *poff)
+// Hash a name for the table of an I_DIRHASH directory (FNV-1a).
+static uint
+dirhash(char *name)
 {
-  uint off, inum;
-  struct dirent de;
+  uint h;
+  int i;
 
-  if(dp->type != T_DIR)
-    panic("dirlookup not DIR");
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+// The name cache remembers what dirlookup() found for a name in
+// a directory, including that it was not there, so that resolving
+// a hot path reads no directory blocks.  Each set holds NDCWAY
+// entries and replaces them round robin.  dirlink() and unlink
+// update the entries they affect, and freeing a directory purges
+// its entries before its inode number can be reused.  All updates
+// for a directory happen with it locked, like lookups.
+#define NDCSET 128
+#define NDCWAY 4
+
+struct dentry {
+  uint dev;
+  uint dinum;         // Directory the name is in
+  uint inum;          // Inode the name maps to, 0 if none
+  char name[DIRSIZ];
+  char used;
+};
+
+struct dcset {
+  struct spinlock lock;
+  struct dentry e[NDCWAY];
+  int next;           // Entry to replace next
+  struct dcstat st;
+};
+
+static struct dcset dcache[NDCSET];
+
+static void
+dcacheinit(void)
+{
+  int i;
+
+  for(i = 0; i < NDCSET; i++)
+    initlock(&dcache[i].lock, "dcache");
+}
+
+static struct dcset*
+dcset(struct inode *dp, char *name)
+{
+  return &dcache[(dirhash(name) ^ dp->inum*2654435761U ^ dp->dev) % NDCSET];
+}
+
+// Look up name in directory dp in the name cache.
+// If it is there, set *pinum and return 1.
+static int
+dcacheget(struct inode *dp, char *name, uint *pinum)
+{
+  struct dcset *s;
+  struct dentry *e;
+
+  s = dcset(dp, name);
+  acquire(&s->lock);
+  for(e = s->e; e < s->e+NDCWAY; e++){
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+       namecmp(e->name, name) == 0){
+      *pinum = e->inum;
+      if(e->inum)
+        s->st.nhit++;
+      else
+        s->st.nneg++;
+      release(&s->lock);
+      return 1;
+    }
+  }
+  s->st.nmiss++;
+  release(&s->lock);
+  return 0;
+}
+
+// Record that name in directory dp maps to inum, or to
+// nothing if inum is 0.  Caller must hold dp->lock.
+void
+dcacheput(struct inode *dp, char *name, uint inum)
+{
+  struct dcset *s;
+  struct dentry *e;
+
+  s = dcset(dp, name);
+  acquire(&s->lock);
+  for(e = s->e; e < s->e+NDCWAY; e++)
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+       namecmp(e->name, name) == 0)
+      break;
+  if(e == s->e+NDCWAY){
+    e = &s->e[s->next];
+    s->next = (s->next + 1) % NDCWAY;
+  }
+  e->dev = dp->dev;
+  e->dinum = dp->inum;
+  e->inum = inum;
+  strncpy(e->name, name, DIRSIZ);
+  e->used = 1;
+  release(&s->lock);
+}
+
+// Forget every name in directory inum, which is being freed.
+static void
+dcachepurge(uint dev, uint inum)
+{
+  struct dcset *s;
+  struct dentry *e;
+
+  for(s = dcache; s < dcache+NDCSET; s++){
+    acquire(&s->lock);
+    for(e = s->e; e < s->e+NDCWAY; e++)
+      if(e->used && e->dinum == inum && e->dev == dev)
+        e->used = 0;
+    release(&s->lock);
+  }
+}
+
+// Copy the name cache counters into st.
+void
+dcachestat(struct dcstat *st)
+{
+  struct dcset *s;
+
+  memset(st, 0, sizeof(*st));
+  for(s = dcache; s < dcache+NDCSET; s++){
+    acquire(&s->lock);
+    st->nhit += s->st.nhit;
+    st->nneg += s->st.nneg;
+    st->nmiss += s->st.nmiss;
+    release(&s->lock);
+  }
+}
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
+// Return the buffer holding the dirent at off in dp, or 0 if its
+// block is a hole, which reads as never-used dirents.  The walks
+// below look at dirents in the buffer cache rather than copying a
+// block onto the kernel stack, which a large BSIZE would overflow.
+static struct buf*
+dirblock(struct inode *dp, uint off)
+{
+  uint addr;
+
+  if((addr = bmap(dp, off/BSIZE, 0)) == 0)
+    return 0;
+  return bread(dp->dev, addr);
+}
+
+// Scan the dirents in [off, end) for name, a block at a time.
+// Returns the inum and sets *poff if found.  If pfree is set,
+// *pfree is the first free dirent, or end if there is none.
+static uint
+dirscan(struct inode *dp, char *name, uint off, uint end,
+        uint *poff, uint *pfree)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint i, n, inum;
+
+  if(pfree)
+    *pfree = end;
+  for(; off < end; off += n){
+    n = min(end - off, BSIZE - off%BSIZE);
+    if((bp = dirblock(dp, off)) == 0){
+      if(pfree && *pfree == end)
+        *pfree = off;
+      continue;
+    }
+    de = (struct dirent*)(bp->data + off%BSIZE);
+    for(i = 0; i < n/sizeof(*de); i++){
+      if(de[i].inum == 0){
+        if(pfree && *pfree == end)
+          *pfree = off + i*sizeof(*de);
+        continue;
+      }
+      if(namecmp(name, de[i].name) == 0){
+        if(poff)
+          *poff = off + i*sizeof(*de);
+        inum = de[i].inum;
+        brelse(bp);
+        return inum;
+      }
+    }
+    brelse(bp);
+  }
+  return 0;
+}
+
+// Probe the hash table of an I_DIRHASH directory for name.
+// Returns the inum and sets *poff if found.  Otherwise sets
+// *pfree to the first free slot in the probe window (0 if none)
+// and returns 0 if the search reached a never-used slot, so the
+// name cannot have overflowed past the table, or -1 if not.
+static int
+dirprobe(struct inode *dp, char *name, uint *poff, uint *pfree)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint s, off, bn;
+  int i, r;
+
+  *pfree = 0;
+  bp = 0;
+  bn = 0;
+  r = -1;
+  s = dirhash(name) % DIRHASH_NSLOT;
+  for(i = 0; i < DPB; i++, s = (s + 1) % DIRHASH_NSLOT){
+    off = DIRHASH_START*BSIZE + s*sizeof(*de);
+    if(i == 0 || off/BSIZE != bn){
+      if(bp)
+        brelse(bp);
+      bn = off/BSIZE;
+      bp = dirblock(dp, off);
+    }
+    de = bp ? (struct dirent*)bp->data + s%DPB : 0;
+    if(de == 0 || de->inum == 0){
+      if(*pfree == 0)
+        *pfree = off;
+      if(de == 0 || de->name[0] == 0){
+        r = 0;
+        break;
+      }
       continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
+    }
+    if(namecmp(name, de->name) == 0){
       if(poff)
         *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+      r = de->inum;
+      break;
     }
   }
+  if(bp)
+    brelse(bp);
+  return r;
+}
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+  uint free, inum;
+  int r;
 
+  if(dp->type != T_DIR)
+    panic("dirlookup not DIR");
+
+  // The name cache does not know offsets.
+  if(poff == 0 && dcacheget(dp, name, &inum))
+    return inum ? iget(dp->dev, inum) : 0;
+
+  if((dp->flags & I_DIRHASH) == 0)
+    inum = dirscan(dp, name, 0, dp->size, poff, 0);
+  else if((r = dirprobe(dp, name, poff, &free)) > 0)
+    inum = r;
+  else if((inum = dirscan(dp, name, 0, DIRHASH_START*BSIZE, poff, 0)) == 0 &&
+          r < 0)
+    inum = dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, poff, 0);
+  dcacheput(dp, name, inum);
+  if(inum)
+    return iget(dp->dev, inum);
   return 0;
 }
 
@@ -697,7 +1447,7 @@ dirlookup(struct inode *dp, char *name, uint *poff)
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  uint off;
   struct dirent de;
   struct inode *ip;
 
@@ -707,18 +1457,27 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  if((dp->flags & I_DIRHASH) == 0){
+    // Look for an empty dirent.
+    dirscan(dp, name, 0, dp->size, 0, &off);
+    if(off == DIRHASH_START*BSIZE && dp->size == off){
+      // Full: switch to the hash table.
+      dp->flags |= I_DIRHASH;
+      dp->size = DIRHASH_END*BSIZE;
+      iupdate(dp);
+    }
+  }
+  if(dp->flags & I_DIRHASH){
+    dirprobe(dp, name, 0, &off);
+    if(off == 0)
+      dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, 0, &off);
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcacheput(dp, name, inum);
 
   return 0;
 }
@@ -763,20 +1522,53 @@ skipelem(char *path, char *name)
   return path;
 }
 
+// Replace the path element just looked up in ip with the target
+// of symlink lp, leaving the rest of the path after it, and return
+// the new path, kept in buf.  An absolute target moves *ipp to the
+// root; a relative one carries on from the directory holding the
+// link.  Caller must hold lp->lock.
+static char*
+followlink(struct inode **ipp, struct inode *lp, char *path, char *buf)
+{
+  char target[MAXPATH];
+  int n, r;
+
+  if((n = readlink(lp, target, sizeof(target))) < 0)
+    return 0;
+  r = strlen(path);
+  if(n + 1 + r >= MAXPATH)
+    return 0;
+  memmove(buf + n + 1, path, r + 1);
+  memmove(buf, target, n);
+  buf[n] = '/';
+  if(target[0] == '/'){
+    iput(*ipp);
+    *ipp = iget(ROOTDEV, ROOTINO);
+  }
+  return buf;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
+// Symlinks are followed, at most MAXSYMLINKS of them, except as the
+// final element when follow is 0.  Each hop reuses the name cache
+// and reads an inline target from the cached inode, so going through
+// the same link again reads no blocks.
 // Must be called inside a transaction since it calls iput().
 static struct inode*
-namex(char *path, int nameiparent, char *name)
+namex(char *path, int nameiparent, int follow, char *name)
 {
   struct inode *ip, *next;
+  char buf[MAXPATH];
+  int hops;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
     ip = idup(myproc()->cwd);
 
+  hops = 0;
   while((path = skipelem(path, name)) != 0){
     ilock(ip);
     if(ip->type != T_DIR){
@@ -792,7 +1584,20 @@ namex(char *path, int nameiparent, char *name)
       iunlockput(ip);
       return 0;
     }
-    iunlockput(ip);
+    iunlock(ip);
+    ilock(next);
+    if(next->type == T_SYMLINK && (*path != '\0' || follow)){
+      if(++hops > MAXSYMLINKS ||
+         (path = followlink(&ip, next, path, buf)) == 0){
+        iunlockput(next);
+        iput(ip);
+        return 0;
+      }
+      iunlockput(next);
+      continue;
+    }
+    iunlock(next);
+    iput(ip);
     ip = next;
   }
   if(nameiparent){
@@ -806,11 +1611,19 @@ struct inode*
 namei(char *path)
 {
   char name[DIRSIZ];
-  return namex(path, 0, name);
+  return namex(path, 0, 1, name);
+}
+
+// Like namei, but return a final symlink itself.
+struct inode*
+nameilink(char *path)
+{
+  char name[DIRSIZ];
+  return namex(path, 0, 0, name);
 }
 
 struct inode*
 nameiparent(char *path, char *name)
 {
-  return namex(path, 1, name);
+  return namex(path, 1, 0, name);
 }
@@ -3,7 +3,16 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+
+// Block size, chosen at build time (make BSIZE=1024).
+// mkfs records it in the super block and iinit() checks it.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
+#if BSIZE % 512 != 0 || BSIZE > 4096
+#error "BSIZE must be a multiple of 512 and at most 4096"
+#endif
+#define MAXREADAHEAD 64  // most blocks readi() may read ahead
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -19,6 +28,7 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint bsize;        // Block size (bytes)
 };
 
 #define NDIRECT 10
@@ -29,9 +39,39 @@ struct superblock {
 #define MAXFILE \
   (NDIRECT + NINDIRECT + DINDIRECT + TINDIRECT)
 
+// Extent-mapped inodes (I_EXTENT) use addrs[] as an array of
+// extents, each a run of logical blocks stored in consecutive
+// disk blocks.  Extent i covers the logical blocks from the end
+// of extent i-1 (or 0) up to end, and ends at disk block pend.
+// Unused extents have end 0.  The first NIEXTENT extents are in
+// the inode, the rest in a chain of extent blocks starting at
+// addrs[EXTBLOCK], each holding NBEXTENT extents and, in its last
+// word, the number of the next extent block (0 if none).
+struct extent {
+  uint end;   // logical block after the extent
+  uint pend;  // disk block after the extent
+};
+
+#define NIEXTENT ((NDIRECT+2) / 2)
+#define EXTBLOCK (NDIRECT+2)
+#define NBEXTENT ((BSIZE - sizeof(uint)) / sizeof(struct extent))
+#define EXTNEXT(data) (((uint*)(data))[BSIZE/sizeof(uint) - 1])
+
+// Inode flags
+#define I_EXTENT 0x1  // addrs[] holds extents
+#define I_DIRHASH 0x2 // directory has a hash table
+#define I_INLINE 0x4  // addrs[] holds the data itself
+
+// Files of at most NINLINE bytes and symlink targets short enough
+// keep their data in addrs[] itself (I_INLINE), so reading them
+// reads no data block.  A file that grows past NINLINE moves its
+// data out to a block; longer targets are written to blocks.
+#define NINLINE ((NDIRECT+3) * sizeof(uint))
+
 // On-disk inode structure
 struct dinode {
-  short type;           // File type
+  uchar type;           // File type
+  uchar flags;          // I_EXTENT, I_DIRHASH, I_INLINE
   short major;          // Major device number (T_DEV only)
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
@@ -59,3 +99,17 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Dirents per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// A directory that fills DIRHASH_START blocks is marked
+// I_DIRHASH and its size jumps to DIRHASH_END blocks.  Later
+// entries go in the hash table in between, at the first free
+// slot within DPB slots of the name's hash; the table's blocks
+// are allocated on first use.  Entries that find no slot are
+// appended after the table.  Unlinked entries keep their name,
+// so a lookup can stop at a never-used slot.
+#define DIRHASH_START  4
+#define DIRHASH_NBLOCK 128
+#define DIRHASH_END    (DIRHASH_START + DIRHASH_NBLOCK)
+#define DIRHASH_NSLOT  (DIRHASH_NBLOCK * DPB)
@@ -12,6 +12,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -24,12 +25,21 @@
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// Most sectors moved by one multi-sector command; the drive's
+// default READ/WRITE MULTIPLE block size is larger than this.
+#define IDE_MAXSECT   16
+
+// idequeue points to the first of the idebusy bufs now being
+// read/written to the disk by one command.  The rest of the
+// queue is kept in C-SCAN order: ascending block numbers from
+// the active request, wrapping around to the lowest ones, so
+// that idestart() can merge runs of adjacent blocks.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idebusy;
+static struct iostat idestat;
 
 static int havedisk1;
 static void idestart(struct buf*);
@@ -69,10 +79,15 @@ ideinit(void)
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, merging the queued requests after it
+// that continue it on disk into the same command.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *n;
+  int i;
+
   if(b == 0)
     panic("idestart");
   if(b->blockno >= FSSIZE) {
@@ -81,21 +96,34 @@ idestart(struct buf *b)
   }
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  idebusy = 1;
+  for(n = b; n->qnext != 0; n = n->qnext){
+    if((idebusy+1) * sector_per_block > IDE_MAXSECT ||
+       n->qnext->dev != b->dev ||
+       n->qnext->blockno != n->blockno + 1 ||
+       (n->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    idebusy++;
+  }
+  idestat.ncmd++;
+  idestat.nmerged += idebusy - 1;
+
+  int nsector = idebusy * sector_per_block;
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(i = 0, n = b; i < idebusy; i++, n = n->qnext)
+      outsl(0x1f0, n->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -106,24 +134,34 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int ok;
 
-  // First queued buffer is the active request.
+  // First idebusy queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
-
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Read data if needed; the sectors arrive in queue order.
+  ok = (b->flags & B_DIRTY) || idewait(1) >= 0;
+  for(; idebusy > 0; idebusy--){
+    b = idequeue;
+    idequeue = b->qnext;
+    if(!(b->flags & B_DIRTY) && ok)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf, or hand
+    // a read-ahead buffer back to the cache.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      bdone(b);
+    } else
+      wakeup(b);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -136,10 +174,12 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr() releases b.
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
+  struct buf **pp, *last;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -150,16 +190,34 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
+  // Insert b in C-SCAN order after the active request:
+  // block numbers are compared by their distance past the
+  // last active block, wrapping around.
   b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
+  pp = &idequeue;
+  if(idequeue != 0){
+    last = idequeue;
+    for(i = 0; i < idebusy; i++){
+      last = *pp;
+      pp = &(*pp)->qnext;
+    }
+    for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+      if(b->blockno - last->blockno < (*pp)->blockno - last->blockno)
+        break;
+    b->qnext = *pp;
+  }
   *pp = b;
+  idestat.nreq++;
 
   // Start disk if necessary.
   if(idequeue == b)
     idestart(b);
 
+  if(b->flags & B_ASYNC){
+    release(&idelock);
+    return;
+  }
+
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
@@ -168,3 +226,12 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Copy the disk request counters into st.
+void
+ideiostat(struct iostat *st)
+{
+  acquire(&idelock);
+  *st = idestat;
+  release(&idelock);
+}
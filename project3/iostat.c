@@ -0,0 +1,18 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "iostat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat st;
+
+  if(iostat(&st) < 0){
+    printf(2, "iostat: failed\n");
+    exit();
+  }
+  printf(1, "requests %d commands %d merged %d\n",
+         st.nreq, st.ncmd, st.nmerged);
+  exit();
+}
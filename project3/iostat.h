@@ -0,0 +1,6 @@
+// Disk request counters, returned by the iostat system call.
+struct iostat {
+  uint nreq;     // requests queued by iderw()
+  uint ncmd;     // commands issued to the disk
+  uint nmerged;  // requests served by another request's command
+};
@@ -7,12 +7,20 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
+// Pages move between a CPU's cache and the global pool
+// KBATCH at a time; a cache holding more than KHIGH pages
+// drains a batch back to the pool.
+#define KBATCH 32
+#define KHIGH  (2*KBATCH)
+
 struct run {
   struct run *next;
 };
@@ -23,15 +31,37 @@ struct {
   struct run *freelist;
 } kmem;
 
+// Per-CPU cache of free pages.  Only its own CPU pushes and pops,
+// with interrupts off; the lock is there for neighbours stealing
+// pages when they run dry, so it is almost never contended.
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+};
+
+static struct kcache kcache[NCPU];
+
+// Number of page tables mapping each physical page, so that
+// copy-on-write pages are only freed by their last user.
+// Updated with xadd() rather than under a lock.
+static int kref[PHYSTOP/PGSIZE];
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Until kinit2() finishes, every page goes through kmem.freelist,
+// since mycpu() does not work before mpinit().
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kcache[i].lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,32 +78,122 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kref[V2P(p)/PGSIZE] = 1;
     kfree(p);
+  }
+}
+
+// Detach up to n pages from the front of *list.
+// Returns the detached chain and stores its length in *got.
+static struct run*
+takepages(struct run **list, int n, int *got)
+{
+  struct run *head, *r;
+  int i;
+
+  head = *list;
+  if(head == 0){
+    *got = 0;
+    return 0;
+  }
+  for(i = 1, r = head; i < n && r->next; i++)
+    r = r->next;
+  *list = r->next;
+  r->next = 0;
+  *got = i;
+  return head;
+}
+
+// Refill c, which must be empty, from the global pool or,
+// failing that, by stealing half of a neighbour's cache.
+// Caller must have interrupts off and must not hold c->lock,
+// so that no CPU ever holds two cache locks at once.
+static void
+refill(struct kcache *c)
+{
+  struct kcache *o;
+  struct run *chain, *r;
+  int got;
+
+  acquire(&kmem.lock);
+  chain = takepages(&kmem.freelist, KBATCH, &got);
+  release(&kmem.lock);
+
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+    if(o == c)
+      continue;
+    acquire(&o->lock);
+    chain = takepages(&o->freelist, (o->nfree+1)/2, &got);
+    o->nfree -= got;
+    release(&o->lock);
+  }
+  if(chain == 0)
+    return;
+
+  for(r = chain; r->next; r = r->next)
+    ;
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = chain;
+  c->nfree += got;
+  release(&c->lock);
 }
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
+// Drop a reference to the page of physical memory pointed at by v,
+// and free it if that was the last one.  v normally should have
+// been returned by a call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
 void
 kfree(char *v)
 {
-  struct run *r;
+  struct run *r, *chain;
+  struct kcache *c;
+  int got;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(xadd(&kref[V2P(v)/PGSIZE], -1) != 1){
+    if(kref[V2P(v)/PGSIZE] < 0)
+      panic("kfree: ref");
+    return;
+  }
+
+#ifdef KALLOC_DEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    return;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  chain = 0;
+  if(++c->nfree > KHIGH){
+    chain = takepages(&c->freelist, KBATCH, &got);
+    c->nfree -= got;
+  }
+  release(&c->lock);
+
+  // Give a batch back to the pool so other CPUs can use it.
+  if(chain){
+    for(r = chain; r->next; r = r->next)
+      ;
+    acquire(&kmem.lock);
+    r->next = kmem.freelist;
+    kmem.freelist = chain;
     release(&kmem.lock);
+  }
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +203,44 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcache *c;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r)
+      kmem.freelist = r->next;
+  } else {
+    pushcli();
+    c = &kcache[cpuid()];
+    if(c->freelist == 0)
+      refill(c);
+    acquire(&c->lock);
+    r = c->freelist;
+    if(r){
+      c->freelist = r->next;
+      c->nfree--;
+    }
+    release(&c->lock);
+    popcli();
+  }
   if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+    kref[V2P(r)/PGSIZE] = 1;
   return (char*)r;
 }
 
+// Add a reference to the page pointed at by v,
+// which another page table is about to share.
+void
+kincref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+  xadd(&kref[V2P(v)/PGSIZE], 1);
+}
+
+// Return the number of references to the page pointed at by v.
+int
+krefcnt(char *v)
+{
+  return kref[V2P(v)/PGSIZE];
+}
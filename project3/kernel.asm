@@ -0,0 +1,22230 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 10 9d 15 80       	mov    $0x80159d10,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 70 5a 10 80       	mov    $0x80105a70,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bufctor>:
+  bk->head.next = b;
+}
+
+static void
+bufctor(void *v)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	83 ec 10             	sub    $0x10,%esp
+  initsleeplock(&((struct buf*)v)->lock, "buffer");
+80100046:	68 60 ad 10 80       	push   $0x8010ad60
+8010004b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010004e:	83 c0 0c             	add    $0xc,%eax
+80100051:	50                   	push   %eax
+80100052:	e8 09 78 00 00       	call   80107860 <initsleeplock>
+}
+80100057:	83 c4 10             	add    $0x10,%esp
+8010005a:	c9                   	leave
+8010005b:	c3                   	ret
+8010005c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100060 <bnew>:
+
+// Allocate a new buffer, not yet in any bucket.
+// Returns 0 if there is no memory left.
+static struct buf*
+bnew(void)
+{
+80100060:	55                   	push   %ebp
+80100061:	89 e5                	mov    %esp,%ebp
+80100063:	83 ec 08             	sub    $0x8,%esp
+  struct buf *b;
+
+  if(bcache.ndata == 0){
+80100066:	a1 cc e7 10 80       	mov    0x8010e7cc,%eax
+8010006b:	85 c0                	test   %eax,%eax
+8010006d:	75 18                	jne    80100087 <bnew+0x27>
+    if((bcache.data = (uchar*)kalloc()) == 0)
+8010006f:	e8 4c 4a 00 00       	call   80104ac0 <kalloc>
+80100074:	a3 c8 e7 10 80       	mov    %eax,0x8010e7c8
+80100079:	85 c0                	test   %eax,%eax
+8010007b:	74 43                	je     801000c0 <bnew+0x60>
+      return 0;
+    bcache.ndata = PGSIZE/BSIZE;
+8010007d:	c7 05 cc e7 10 80 08 	movl   $0x8,0x8010e7cc
+80100084:	00 00 00 
+  }
+  if((b = slaballoc(&bcache.cache)) == 0)
+80100087:	83 ec 0c             	sub    $0xc,%esp
+8010008a:	68 54 e5 10 80       	push   $0x8010e554
+8010008f:	e8 6c 74 00 00       	call   80107500 <slaballoc>
+80100094:	83 c4 10             	add    $0x10,%esp
+80100097:	85 c0                	test   %eax,%eax
+80100099:	74 25                	je     801000c0 <bnew+0x60>
+    return 0;
+  b->data = bcache.data;
+8010009b:	8b 15 c8 e7 10 80    	mov    0x8010e7c8,%edx
+801000a1:	89 50 60             	mov    %edx,0x60(%eax)
+  bcache.data += BSIZE;
+801000a4:	81 c2 00 02 00 00    	add    $0x200,%edx
+  bcache.ndata--;
+801000aa:	83 2d cc e7 10 80 01 	subl   $0x1,0x8010e7cc
+  bcache.nbuf++;
+801000b1:	83 05 c4 e7 10 80 01 	addl   $0x1,0x8010e7c4
+  bcache.data += BSIZE;
+801000b8:	89 15 c8 e7 10 80    	mov    %edx,0x8010e7c8
+  return b;
+}
+801000be:	c9                   	leave
+801000bf:	c3                   	ret
+801000c0:	c9                   	leave
+      return 0;
+801000c1:	31 c0                	xor    %eax,%eax
+}
+801000c3:	c3                   	ret
+801000c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801000cf:	90                   	nop
+
+801000d0 <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+801000d0:	55                   	push   %ebp
+  struct buf *b, *c, *victim;
+  struct bucket *bk, *vbk, *cur;
+
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+801000d1:	89 c1                	mov    %eax,%ecx
+801000d3:	c1 e1 1b             	shl    $0x1b,%ecx
+801000d6:	09 d1                	or     %edx,%ecx
+{
+801000d8:	89 e5                	mov    %esp,%ebp
+801000da:	57                   	push   %edi
+801000db:	89 c7                	mov    %eax,%edi
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+801000dd:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+{
+801000e2:	56                   	push   %esi
+801000e3:	53                   	push   %ebx
+801000e4:	83 ec 38             	sub    $0x38,%esp
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+801000e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801000ea:	f7 e1                	mul    %ecx
+801000ec:	c1 ea 02             	shr    $0x2,%edx
+801000ef:	8d 04 52             	lea    (%edx,%edx,2),%eax
+801000f2:	8d 04 82             	lea    (%edx,%eax,4),%eax
+801000f5:	29 c1                	sub    %eax,%ecx
+801000f7:	69 f1 98 00 00 00    	imul   $0x98,%ecx,%esi
+801000fd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80100100:	8d 8e d0 e7 10 80    	lea    -0x7fef1830(%esi),%ecx
+80100106:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+
+  // Is the block already cached?
+  acquire(&bk->lock);
+80100109:	51                   	push   %ecx
+8010010a:	e8 61 7a 00 00       	call   80107b70 <acquire>
+  for(b = bk->head.next; b != &bk->head; b = b->next){
+8010010f:	8b 9e 5c e8 10 80    	mov    -0x7fef17a4(%esi),%ebx
+80100115:	83 c4 10             	add    $0x10,%esp
+80100118:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010011b:	8d 8e 04 e8 10 80    	lea    -0x7fef17fc(%esi),%ecx
+80100121:	39 cb                	cmp    %ecx,%ebx
+80100123:	74 4b                	je     80100170 <bget+0xa0>
+80100125:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100128:	eb 0d                	jmp    80100137 <bget+0x67>
+8010012a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80100130:	8b 5b 58             	mov    0x58(%ebx),%ebx
+80100133:	39 cb                	cmp    %ecx,%ebx
+80100135:	74 39                	je     80100170 <bget+0xa0>
+    if(b->dev == dev && b->blockno == blockno)
+80100137:	3b 7b 04             	cmp    0x4(%ebx),%edi
+8010013a:	75 f4                	jne    80100130 <bget+0x60>
+8010013c:	3b 43 08             	cmp    0x8(%ebx),%eax
+8010013f:	75 ef                	jne    80100130 <bget+0x60>
+  if((b = bfind(bk, dev, blockno)) != 0){
+    b->refcnt++;
+80100141:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+    release(&bk->lock);
+80100145:	83 ec 0c             	sub    $0xc,%esp
+80100148:	ff 75 e0             	push   -0x20(%ebp)
+8010014b:	e8 c0 79 00 00       	call   80107b10 <release>
+    acquiresleep(&b->lock);
+80100150:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100153:	89 04 24             	mov    %eax,(%esp)
+80100156:	e8 45 77 00 00       	call   801078a0 <acquiresleep>
+    return b;
+8010015b:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+8010015e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100161:	89 d8                	mov    %ebx,%eax
+80100163:	5b                   	pop    %ebx
+80100164:	5e                   	pop    %esi
+80100165:	5f                   	pop    %edi
+80100166:	5d                   	pop    %ebp
+80100167:	c3                   	ret
+80100168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010016f:	90                   	nop
+  release(&bk->lock);
+80100170:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80100173:	83 ec 0c             	sub    $0xc,%esp
+80100176:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80100179:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010017c:	56                   	push   %esi
+8010017d:	e8 8e 79 00 00       	call   80107b10 <release>
+  acquire(&bcache.lock);
+80100182:	c7 04 24 20 e5 10 80 	movl   $0x8010e520,(%esp)
+80100189:	e8 e2 79 00 00       	call   80107b70 <acquire>
+  acquire(&bk->lock);
+8010018e:	89 34 24             	mov    %esi,(%esp)
+80100191:	e8 da 79 00 00       	call   80107b70 <acquire>
+  for(b = bk->head.next; b != &bk->head; b = b->next){
+80100196:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80100199:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+8010019c:	83 c4 10             	add    $0x10,%esp
+8010019f:	69 c2 98 00 00 00    	imul   $0x98,%edx,%eax
+801001a5:	8b 98 5c e8 10 80    	mov    -0x7fef17a4(%eax),%ebx
+801001ab:	39 cb                	cmp    %ecx,%ebx
+801001ad:	74 39                	je     801001e8 <bget+0x118>
+801001af:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801001b2:	eb 0b                	jmp    801001bf <bget+0xef>
+801001b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001b8:	8b 5b 58             	mov    0x58(%ebx),%ebx
+801001bb:	39 cb                	cmp    %ecx,%ebx
+801001bd:	74 29                	je     801001e8 <bget+0x118>
+    if(b->dev == dev && b->blockno == blockno)
+801001bf:	3b 7b 04             	cmp    0x4(%ebx),%edi
+801001c2:	75 f4                	jne    801001b8 <bget+0xe8>
+801001c4:	3b 43 08             	cmp    0x8(%ebx),%eax
+801001c7:	75 ef                	jne    801001b8 <bget+0xe8>
+    b->refcnt++;
+801001c9:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+    release(&bk->lock);
+801001cd:	83 ec 0c             	sub    $0xc,%esp
+801001d0:	ff 75 e0             	push   -0x20(%ebp)
+801001d3:	e8 38 79 00 00       	call   80107b10 <release>
+    release(&bcache.lock);
+801001d8:	c7 04 24 20 e5 10 80 	movl   $0x8010e520,(%esp)
+801001df:	e9 67 ff ff ff       	jmp    8010014b <bget+0x7b>
+801001e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001e8:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  release(&bk->lock);
+801001eb:	83 ec 0c             	sub    $0xc,%esp
+801001ee:	be 04 e8 10 80       	mov    $0x8010e804,%esi
+  victim = 0;
+801001f3:	31 db                	xor    %ebx,%ebx
+801001f5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  release(&bk->lock);
+801001f8:	ff 75 e0             	push   -0x20(%ebp)
+801001fb:	e8 10 79 00 00       	call   80107b10 <release>
+  victim = 0;
+80100200:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80100203:	89 7d cc             	mov    %edi,-0x34(%ebp)
+80100206:	83 c4 10             	add    $0x10,%esp
+  vbk = 0;
+80100209:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  victim = 0;
+80100210:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80100213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100217:	90                   	nop
+    acquire(&cur->lock);
+80100218:	83 ec 0c             	sub    $0xc,%esp
+8010021b:	8d 7e cc             	lea    -0x34(%esi),%edi
+8010021e:	57                   	push   %edi
+8010021f:	e8 4c 79 00 00       	call   80107b70 <acquire>
+    for(c = cur->head.next; c != &cur->head; c = c->next){
+80100224:	8b 46 58             	mov    0x58(%esi),%eax
+80100227:	83 c4 10             	add    $0x10,%esp
+8010022a:	39 f0                	cmp    %esi,%eax
+8010022c:	74 41                	je     8010026f <bget+0x19f>
+    b = 0;
+8010022e:	31 d2                	xor    %edx,%edx
+      if(c->refcnt == 0 && (c->flags & B_DIRTY) == 0 &&
+80100230:	8b 48 4c             	mov    0x4c(%eax),%ecx
+80100233:	85 c9                	test   %ecx,%ecx
+80100235:	75 19                	jne    80100250 <bget+0x180>
+80100237:	f6 00 04             	testb  $0x4,(%eax)
+8010023a:	75 14                	jne    80100250 <bget+0x180>
+8010023c:	85 d2                	test   %edx,%edx
+8010023e:	0f 84 ec 00 00 00    	je     80100330 <bget+0x260>
+         (b == 0 || c->lastuse < b->lastuse))
+80100244:	8b 4a 50             	mov    0x50(%edx),%ecx
+80100247:	39 48 50             	cmp    %ecx,0x50(%eax)
+8010024a:	0f 42 d0             	cmovb  %eax,%edx
+8010024d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(c = cur->head.next; c != &cur->head; c = c->next){
+80100250:	8b 40 58             	mov    0x58(%eax),%eax
+80100253:	39 f0                	cmp    %esi,%eax
+80100255:	75 d9                	jne    80100230 <bget+0x160>
+    if(b && (victim == 0 || b->lastuse < victim->lastuse)){
+80100257:	85 d2                	test   %edx,%edx
+80100259:	74 14                	je     8010026f <bget+0x19f>
+8010025b:	85 db                	test   %ebx,%ebx
+8010025d:	0f 84 dd 00 00 00    	je     80100340 <bget+0x270>
+80100263:	8b 43 50             	mov    0x50(%ebx),%eax
+80100266:	39 42 50             	cmp    %eax,0x50(%edx)
+80100269:	0f 82 d1 00 00 00    	jb     80100340 <bget+0x270>
+      release(&cur->lock);
+8010026f:	83 ec 0c             	sub    $0xc,%esp
+80100272:	57                   	push   %edi
+80100273:	e8 98 78 00 00       	call   80107b10 <release>
+80100278:	83 c4 10             	add    $0x10,%esp
+  for(cur = bcache.bucket; cur < bcache.bucket+NBUCKET; cur++){
+8010027b:	81 c6 98 00 00 00    	add    $0x98,%esi
+80100281:	b8 bc ef 10 80       	mov    $0x8010efbc,%eax
+80100286:	39 f0                	cmp    %esi,%eax
+80100288:	75 8e                	jne    80100218 <bget+0x148>
+  if(victim == 0){
+8010028a:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010028d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80100290:	8b 7d cc             	mov    -0x34(%ebp),%edi
+80100293:	85 db                	test   %ebx,%ebx
+80100295:	0f 84 ca 00 00 00    	je     80100365 <bget+0x295>
+  b->blockno = blockno;
+8010029b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  b->dev = dev;
+8010029e:	89 7b 04             	mov    %edi,0x4(%ebx)
+  if(vbk != bk){
+801002a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  b->flags = 0;
+801002a4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  b->blockno = blockno;
+801002aa:	89 43 08             	mov    %eax,0x8(%ebx)
+  if(vbk != bk){
+801002ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  b->refcnt = 1;
+801002b0:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+  if(vbk != bk){
+801002b7:	39 c7                	cmp    %eax,%edi
+801002b9:	0f 84 0e ff ff ff    	je     801001cd <bget+0xfd>
+    if(vbk){
+801002bf:	85 ff                	test   %edi,%edi
+801002c1:	74 27                	je     801002ea <bget+0x21a>
+  b->next->prev = b->prev;
+801002c3:	8b 73 58             	mov    0x58(%ebx),%esi
+801002c6:	8b 43 54             	mov    0x54(%ebx),%eax
+      release(&vbk->lock);
+801002c9:	83 ec 0c             	sub    $0xc,%esp
+801002cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801002cf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  b->next->prev = b->prev;
+801002d2:	89 46 54             	mov    %eax,0x54(%esi)
+  b->prev->next = b->next;
+801002d5:	8b 73 58             	mov    0x58(%ebx),%esi
+801002d8:	89 70 58             	mov    %esi,0x58(%eax)
+      release(&vbk->lock);
+801002db:	57                   	push   %edi
+801002dc:	e8 2f 78 00 00       	call   80107b10 <release>
+801002e1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801002e4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801002e7:	83 c4 10             	add    $0x10,%esp
+801002ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+    acquire(&bk->lock);
+801002ed:	83 ec 0c             	sub    $0xc,%esp
+801002f0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801002f3:	ff 75 e0             	push   -0x20(%ebp)
+801002f6:	e8 75 78 00 00       	call   80107b70 <acquire>
+  b->next = bk->head.next;
+801002fb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  b->prev = &bk->head;
+801002fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+}
+80100301:	83 c4 10             	add    $0x10,%esp
+  b->next = bk->head.next;
+80100304:	69 c2 98 00 00 00    	imul   $0x98,%edx,%eax
+8010030a:	8b 90 5c e8 10 80    	mov    -0x7fef17a4(%eax),%edx
+  b->prev = &bk->head;
+80100310:	89 4b 54             	mov    %ecx,0x54(%ebx)
+  b->next = bk->head.next;
+80100313:	89 53 58             	mov    %edx,0x58(%ebx)
+  bk->head.next->prev = b;
+80100316:	8b 90 5c e8 10 80    	mov    -0x7fef17a4(%eax),%edx
+8010031c:	89 5a 54             	mov    %ebx,0x54(%edx)
+  bk->head.next = b;
+8010031f:	89 98 5c e8 10 80    	mov    %ebx,-0x7fef17a4(%eax)
+}
+80100325:	e9 a3 fe ff ff       	jmp    801001cd <bget+0xfd>
+8010032a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80100330:	89 c2                	mov    %eax,%edx
+80100332:	e9 19 ff ff ff       	jmp    80100250 <bget+0x180>
+80100337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010033e:	66 90                	xchg   %ax,%ax
+      if(vbk)
+80100340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100343:	85 c0                	test   %eax,%eax
+80100345:	74 14                	je     8010035b <bget+0x28b>
+80100347:	89 55 d8             	mov    %edx,-0x28(%ebp)
+        release(&vbk->lock);
+8010034a:	83 ec 0c             	sub    $0xc,%esp
+8010034d:	ff 75 e4             	push   -0x1c(%ebp)
+80100350:	e8 bb 77 00 00       	call   80107b10 <release>
+80100355:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80100358:	83 c4 10             	add    $0x10,%esp
+8010035b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010035e:	89 d3                	mov    %edx,%ebx
+80100360:	e9 16 ff ff ff       	jmp    8010027b <bget+0x1ab>
+80100365:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80100368:	89 55 d8             	mov    %edx,-0x28(%ebp)
+    if((b = bnew()) == 0)
+8010036b:	e8 f0 fc ff ff       	call   80100060 <bnew>
+80100370:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80100373:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80100376:	85 c0                	test   %eax,%eax
+80100378:	89 c3                	mov    %eax,%ebx
+8010037a:	0f 85 1b ff ff ff    	jne    8010029b <bget+0x1cb>
+      panic("bget: no buffers");
+80100380:	83 ec 0c             	sub    $0xc,%esp
+80100383:	68 67 ad 10 80       	push   $0x8010ad67
+80100388:	e8 a3 03 00 00       	call   80100730 <panic>
+8010038d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100390 <binit>:
+{
+80100390:	55                   	push   %ebp
+80100391:	89 e5                	mov    %esp,%ebp
+80100393:	57                   	push   %edi
+80100394:	56                   	push   %esi
+80100395:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+80100396:	bb d0 e7 10 80       	mov    $0x8010e7d0,%ebx
+{
+8010039b:	83 ec 14             	sub    $0x14,%esp
+  initlock(&bcache.lock, "bcache");
+8010039e:	68 78 ad 10 80       	push   $0x8010ad78
+801003a3:	68 20 e5 10 80       	push   $0x8010e520
+801003a8:	e8 e3 75 00 00       	call   80107990 <initlock>
+  slabinit(&bcache.cache, "buf", sizeof(struct buf), bufctor);
+801003ad:	68 40 00 10 80       	push   $0x80100040
+801003b2:	6a 64                	push   $0x64
+801003b4:	68 7f ad 10 80       	push   $0x8010ad7f
+801003b9:	68 54 e5 10 80       	push   $0x8010e554
+801003be:	e8 cd 70 00 00       	call   80107490 <slabinit>
+801003c3:	83 c4 20             	add    $0x20,%esp
+801003c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003cd:	8d 76 00             	lea    0x0(%esi),%esi
+    initlock(&bk->lock, "bcache.bucket");
+801003d0:	83 ec 08             	sub    $0x8,%esp
+801003d3:	68 83 ad 10 80       	push   $0x8010ad83
+801003d8:	53                   	push   %ebx
+801003d9:	e8 b2 75 00 00       	call   80107990 <initlock>
+    bk->head.prev = &bk->head;
+801003de:	8d 43 34             	lea    0x34(%ebx),%eax
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+801003e1:	81 c3 98 00 00 00    	add    $0x98,%ebx
+801003e7:	83 c4 10             	add    $0x10,%esp
+    bk->head.prev = &bk->head;
+801003ea:	89 43 f0             	mov    %eax,-0x10(%ebx)
+    bk->head.next = &bk->head;
+801003ed:	89 43 f4             	mov    %eax,-0xc(%ebx)
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+801003f0:	81 fb 88 ef 10 80    	cmp    $0x8010ef88,%ebx
+801003f6:	75 d8                	jne    801003d0 <binit+0x40>
+  for(i = 0; i < NBUF; i++){
+801003f8:	31 f6                	xor    %esi,%esi
+    blink(&bcache.bucket[i % NBUCKET], b);
+801003fa:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+801003ff:	90                   	nop
+    if((b = bnew()) == 0)
+80100400:	e8 5b fc ff ff       	call   80100060 <bnew>
+80100405:	89 c1                	mov    %eax,%ecx
+80100407:	85 c0                	test   %eax,%eax
+80100409:	74 51                	je     8010045c <binit+0xcc>
+    blink(&bcache.bucket[i % NBUCKET], b);
+8010040b:	89 f0                	mov    %esi,%eax
+8010040d:	f7 e3                	mul    %ebx
+8010040f:	c1 ea 02             	shr    $0x2,%edx
+80100412:	8d 04 52             	lea    (%edx,%edx,2),%eax
+80100415:	8d 04 82             	lea    (%edx,%eax,4),%eax
+80100418:	89 f2                	mov    %esi,%edx
+  for(i = 0; i < NBUF; i++){
+8010041a:	83 c6 01             	add    $0x1,%esi
+    blink(&bcache.bucket[i % NBUCKET], b);
+8010041d:	29 c2                	sub    %eax,%edx
+  b->next = bk->head.next;
+8010041f:	69 d2 98 00 00 00    	imul   $0x98,%edx,%edx
+80100425:	8b ba 5c e8 10 80    	mov    -0x7fef17a4(%edx),%edi
+8010042b:	8d 82 20 e5 10 80    	lea    -0x7fef1ae0(%edx),%eax
+  b->prev = &bk->head;
+80100431:	81 c2 04 e8 10 80    	add    $0x8010e804,%edx
+80100437:	89 51 54             	mov    %edx,0x54(%ecx)
+  b->next = bk->head.next;
+8010043a:	89 79 58             	mov    %edi,0x58(%ecx)
+  bk->head.next->prev = b;
+8010043d:	8b 90 3c 03 00 00    	mov    0x33c(%eax),%edx
+80100443:	89 4a 54             	mov    %ecx,0x54(%edx)
+  bk->head.next = b;
+80100446:	89 88 3c 03 00 00    	mov    %ecx,0x33c(%eax)
+  for(i = 0; i < NBUF; i++){
+8010044c:	81 fe 96 00 00 00    	cmp    $0x96,%esi
+80100452:	75 ac                	jne    80100400 <binit+0x70>
+}
+80100454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100457:	5b                   	pop    %ebx
+80100458:	5e                   	pop    %esi
+80100459:	5f                   	pop    %edi
+8010045a:	5d                   	pop    %ebp
+8010045b:	c3                   	ret
+      panic("binit");
+8010045c:	83 ec 0c             	sub    $0xc,%esp
+8010045f:	68 91 ad 10 80       	push   $0x8010ad91
+80100464:	e8 c7 02 00 00       	call   80100730 <panic>
+80100469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100470 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+80100470:	55                   	push   %ebp
+80100471:	89 e5                	mov    %esp,%ebp
+80100473:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100476:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100479:	8b 45 08             	mov    0x8(%ebp),%eax
+8010047c:	e8 4f fc ff ff       	call   801000d0 <bget>
+  if((b->flags & B_VALID) == 0) {
+80100481:	f6 00 02             	testb  $0x2,(%eax)
+80100484:	74 0a                	je     80100490 <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+80100486:	c9                   	leave
+80100487:	c3                   	ret
+80100488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010048f:	90                   	nop
+    iderw(b);
+80100490:	83 ec 0c             	sub    $0xc,%esp
+80100493:	50                   	push   %eax
+80100494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+80100497:	e8 a4 40 00 00       	call   80104540 <iderw>
+8010049c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010049f:	83 c4 10             	add    $0x10,%esp
+}
+801004a2:	c9                   	leave
+801004a3:	c3                   	ret
+801004a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801004af:	90                   	nop
+
+801004b0 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+801004b0:	55                   	push   %ebp
+801004b1:	89 e5                	mov    %esp,%ebp
+801004b3:	53                   	push   %ebx
+801004b4:	83 ec 10             	sub    $0x10,%esp
+801004b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801004ba:	8d 43 0c             	lea    0xc(%ebx),%eax
+801004bd:	50                   	push   %eax
+801004be:	e8 7d 74 00 00       	call   80107940 <holdingsleep>
+801004c3:	83 c4 10             	add    $0x10,%esp
+801004c6:	85 c0                	test   %eax,%eax
+801004c8:	74 0f                	je     801004d9 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+801004ca:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+801004cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801004d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801004d3:	c9                   	leave
+  iderw(b);
+801004d4:	e9 67 40 00 00       	jmp    80104540 <iderw>
+    panic("bwrite");
+801004d9:	83 ec 0c             	sub    $0xc,%esp
+801004dc:	68 97 ad 10 80       	push   $0x8010ad97
+801004e1:	e8 4a 02 00 00       	call   80100730 <panic>
+801004e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801004f0 <bdone>:
+// Release a buffer whose read-ahead has finished.
+// Called from the disk interrupt, which does not own b->lock
+// in the sense holdingsleep() checks.
+void
+bdone(struct buf *b)
+{
+801004f0:	55                   	push   %ebp
+801004f1:	89 e5                	mov    %esp,%ebp
+801004f3:	56                   	push   %esi
+801004f4:	53                   	push   %ebx
+801004f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  releasesleep(&b->lock);
+801004f8:	8d 46 0c             	lea    0xc(%esi),%eax
+801004fb:	83 ec 0c             	sub    $0xc,%esp
+801004fe:	50                   	push   %eax
+801004ff:	e8 fc 73 00 00       	call   80107900 <releasesleep>
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+80100504:	8b 4e 04             	mov    0x4(%esi),%ecx
+80100507:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+8010050c:	c1 e1 1b             	shl    $0x1b,%ecx
+8010050f:	0b 4e 08             	or     0x8(%esi),%ecx
+80100512:	f7 e1                	mul    %ecx
+80100514:	c1 ea 02             	shr    $0x2,%edx
+80100517:	8d 04 52             	lea    (%edx,%edx,2),%eax
+8010051a:	8d 04 82             	lea    (%edx,%eax,4),%eax
+8010051d:	29 c1                	sub    %eax,%ecx
+  acquire(&bk->lock);
+8010051f:	69 d9 98 00 00 00    	imul   $0x98,%ecx,%ebx
+80100525:	81 c3 d0 e7 10 80    	add    $0x8010e7d0,%ebx
+8010052b:	89 1c 24             	mov    %ebx,(%esp)
+8010052e:	e8 3d 76 00 00       	call   80107b70 <acquire>
+  b->refcnt--;
+80100533:	8b 46 4c             	mov    0x4c(%esi),%eax
+  if (b->refcnt == 0) {
+80100536:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100539:	83 e8 01             	sub    $0x1,%eax
+8010053c:	89 46 4c             	mov    %eax,0x4c(%esi)
+  if (b->refcnt == 0) {
+8010053f:	85 c0                	test   %eax,%eax
+80100541:	75 08                	jne    8010054b <bdone+0x5b>
+    b->lastuse = ticks;
+80100543:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+80100548:	89 46 50             	mov    %eax,0x50(%esi)
+  release(&bk->lock);
+8010054b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  bput(b);
+}
+8010054e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100551:	5b                   	pop    %ebx
+80100552:	5e                   	pop    %esi
+80100553:	5d                   	pop    %ebp
+  release(&bk->lock);
+80100554:	e9 b7 75 00 00       	jmp    80107b10 <release>
+80100559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100560 <brelse>:
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+80100560:	55                   	push   %ebp
+80100561:	89 e5                	mov    %esp,%ebp
+80100563:	56                   	push   %esi
+80100564:	53                   	push   %ebx
+80100565:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!holdingsleep(&b->lock))
+80100568:	8d 5e 0c             	lea    0xc(%esi),%ebx
+8010056b:	83 ec 0c             	sub    $0xc,%esp
+8010056e:	53                   	push   %ebx
+8010056f:	e8 cc 73 00 00       	call   80107940 <holdingsleep>
+80100574:	83 c4 10             	add    $0x10,%esp
+80100577:	85 c0                	test   %eax,%eax
+80100579:	74 5e                	je     801005d9 <brelse+0x79>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010057b:	83 ec 0c             	sub    $0xc,%esp
+8010057e:	53                   	push   %ebx
+8010057f:	e8 7c 73 00 00       	call   80107900 <releasesleep>
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+80100584:	8b 4e 04             	mov    0x4(%esi),%ecx
+80100587:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+8010058c:	c1 e1 1b             	shl    $0x1b,%ecx
+8010058f:	0b 4e 08             	or     0x8(%esi),%ecx
+80100592:	f7 e1                	mul    %ecx
+80100594:	c1 ea 02             	shr    $0x2,%edx
+80100597:	8d 04 52             	lea    (%edx,%edx,2),%eax
+8010059a:	8d 04 82             	lea    (%edx,%eax,4),%eax
+8010059d:	29 c1                	sub    %eax,%ecx
+  acquire(&bk->lock);
+8010059f:	69 d9 98 00 00 00    	imul   $0x98,%ecx,%ebx
+801005a5:	81 c3 d0 e7 10 80    	add    $0x8010e7d0,%ebx
+801005ab:	89 1c 24             	mov    %ebx,(%esp)
+801005ae:	e8 bd 75 00 00       	call   80107b70 <acquire>
+  b->refcnt--;
+801005b3:	8b 46 4c             	mov    0x4c(%esi),%eax
+  if (b->refcnt == 0) {
+801005b6:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+801005b9:	83 e8 01             	sub    $0x1,%eax
+801005bc:	89 46 4c             	mov    %eax,0x4c(%esi)
+  if (b->refcnt == 0) {
+801005bf:	85 c0                	test   %eax,%eax
+801005c1:	75 08                	jne    801005cb <brelse+0x6b>
+    b->lastuse = ticks;
+801005c3:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+801005c8:	89 46 50             	mov    %eax,0x50(%esi)
+  release(&bk->lock);
+801005cb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  bput(b);
+}
+801005ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801005d1:	5b                   	pop    %ebx
+801005d2:	5e                   	pop    %esi
+801005d3:	5d                   	pop    %ebp
+  release(&bk->lock);
+801005d4:	e9 37 75 00 00       	jmp    80107b10 <release>
+    panic("brelse");
+801005d9:	83 ec 0c             	sub    $0xc,%esp
+801005dc:	68 9e ad 10 80       	push   $0x8010ad9e
+801005e1:	e8 4a 01 00 00       	call   80100730 <panic>
+801005e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801005ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801005f0 <breadahead>:
+{
+801005f0:	55                   	push   %ebp
+801005f1:	89 e5                	mov    %esp,%ebp
+801005f3:	83 ec 08             	sub    $0x8,%esp
+  b = bget(dev, blockno);
+801005f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+801005f9:	8b 45 08             	mov    0x8(%ebp),%eax
+801005fc:	e8 cf fa ff ff       	call   801000d0 <bget>
+  if(b->flags & B_VALID){
+80100601:	8b 10                	mov    (%eax),%edx
+80100603:	f6 c2 02             	test   $0x2,%dl
+80100606:	75 18                	jne    80100620 <breadahead+0x30>
+  b->flags |= B_ASYNC;
+80100608:	83 ca 08             	or     $0x8,%edx
+8010060b:	89 10                	mov    %edx,(%eax)
+  iderw(b);
+8010060d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80100610:	c9                   	leave
+  iderw(b);
+80100611:	e9 2a 3f 00 00       	jmp    80104540 <iderw>
+80100616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010061d:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(b);
+80100620:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80100623:	c9                   	leave
+    brelse(b);
+80100624:	e9 37 ff ff ff       	jmp    80100560 <brelse>
+80100629:	66 90                	xchg   %ax,%ax
+8010062b:	66 90                	xchg   %ax,%ax
+8010062d:	66 90                	xchg   %ax,%ax
+8010062f:	90                   	nop
+
+80100630 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100630:	55                   	push   %ebp
+80100631:	89 e5                	mov    %esp,%ebp
+80100633:	57                   	push   %edi
+80100634:	56                   	push   %esi
+80100635:	53                   	push   %ebx
+80100636:	83 ec 18             	sub    $0x18,%esp
+80100639:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010063c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010063f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100642:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100644:	e8 17 23 00 00       	call   80102960 <iunlock>
+  acquire(&cons.lock);
+80100649:	c7 04 24 40 f0 10 80 	movl   $0x8010f040,(%esp)
+80100650:	e8 1b 75 00 00       	call   80107b70 <acquire>
+  while(n > 0){
+80100655:	83 c4 10             	add    $0x10,%esp
+80100658:	85 db                	test   %ebx,%ebx
+8010065a:	0f 8e 94 00 00 00    	jle    801006f4 <consoleread+0xc4>
+    while(input.r == input.w){
+80100660:	a1 20 f0 10 80       	mov    0x8010f020,%eax
+80100665:	39 05 24 f0 10 80    	cmp    %eax,0x8010f024
+8010066b:	74 25                	je     80100692 <consoleread+0x62>
+8010066d:	eb 59                	jmp    801006c8 <consoleread+0x98>
+8010066f:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100670:	83 ec 08             	sub    $0x8,%esp
+80100673:	68 40 f0 10 80       	push   $0x8010f040
+80100678:	68 20 f0 10 80       	push   $0x8010f020
+8010067d:	e8 fe 6a 00 00       	call   80107180 <sleep>
+    while(input.r == input.w){
+80100682:	a1 20 f0 10 80       	mov    0x8010f020,%eax
+80100687:	83 c4 10             	add    $0x10,%esp
+8010068a:	3b 05 24 f0 10 80    	cmp    0x8010f024,%eax
+80100690:	75 36                	jne    801006c8 <consoleread+0x98>
+      if(myproc()->killed){
+80100692:	e8 89 62 00 00       	call   80106920 <myproc>
+80100697:	8b 48 28             	mov    0x28(%eax),%ecx
+8010069a:	85 c9                	test   %ecx,%ecx
+8010069c:	74 d2                	je     80100670 <consoleread+0x40>
+        release(&cons.lock);
+8010069e:	83 ec 0c             	sub    $0xc,%esp
+801006a1:	68 40 f0 10 80       	push   $0x8010f040
+801006a6:	e8 65 74 00 00       	call   80107b10 <release>
+        ilock(ip);
+801006ab:	5a                   	pop    %edx
+801006ac:	ff 75 08             	push   0x8(%ebp)
+801006af:	e8 bc 21 00 00       	call   80102870 <ilock>
+        return -1;
+801006b4:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+801006b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+801006ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801006bf:	5b                   	pop    %ebx
+801006c0:	5e                   	pop    %esi
+801006c1:	5f                   	pop    %edi
+801006c2:	5d                   	pop    %ebp
+801006c3:	c3                   	ret
+801006c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+801006c8:	8d 50 01             	lea    0x1(%eax),%edx
+801006cb:	89 15 20 f0 10 80    	mov    %edx,0x8010f020
+801006d1:	89 c2                	mov    %eax,%edx
+801006d3:	83 e2 7f             	and    $0x7f,%edx
+801006d6:	0f be 8a a0 ef 10 80 	movsbl -0x7fef1060(%edx),%ecx
+    if(c == C('D')){  // EOF
+801006dd:	80 f9 04             	cmp    $0x4,%cl
+801006e0:	74 37                	je     80100719 <consoleread+0xe9>
+    *dst++ = c;
+801006e2:	83 c6 01             	add    $0x1,%esi
+    --n;
+801006e5:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+801006e8:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+801006eb:	83 f9 0a             	cmp    $0xa,%ecx
+801006ee:	0f 85 64 ff ff ff    	jne    80100658 <consoleread+0x28>
+  release(&cons.lock);
+801006f4:	83 ec 0c             	sub    $0xc,%esp
+801006f7:	68 40 f0 10 80       	push   $0x8010f040
+801006fc:	e8 0f 74 00 00       	call   80107b10 <release>
+  ilock(ip);
+80100701:	58                   	pop    %eax
+80100702:	ff 75 08             	push   0x8(%ebp)
+80100705:	e8 66 21 00 00       	call   80102870 <ilock>
+  return target - n;
+8010070a:	89 f8                	mov    %edi,%eax
+8010070c:	83 c4 10             	add    $0x10,%esp
+}
+8010070f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100712:	29 d8                	sub    %ebx,%eax
+}
+80100714:	5b                   	pop    %ebx
+80100715:	5e                   	pop    %esi
+80100716:	5f                   	pop    %edi
+80100717:	5d                   	pop    %ebp
+80100718:	c3                   	ret
+      if(n < target){
+80100719:	39 fb                	cmp    %edi,%ebx
+8010071b:	73 d7                	jae    801006f4 <consoleread+0xc4>
+        input.r--;
+8010071d:	a3 20 f0 10 80       	mov    %eax,0x8010f020
+80100722:	eb d0                	jmp    801006f4 <consoleread+0xc4>
+80100724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010072b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010072f:	90                   	nop
+
+80100730 <panic>:
+{
+80100730:	55                   	push   %ebp
+80100731:	89 e5                	mov    %esp,%ebp
+80100733:	56                   	push   %esi
+80100734:	53                   	push   %ebx
+80100735:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100738:	fa                   	cli
+  cons.locking = 0;
+80100739:	c7 05 74 f0 10 80 00 	movl   $0x0,0x8010f074
+80100740:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100743:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100746:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100749:	e8 42 48 00 00       	call   80104f90 <lapicid>
+8010074e:	83 ec 08             	sub    $0x8,%esp
+80100751:	50                   	push   %eax
+80100752:	68 a5 ad 10 80       	push   $0x8010ada5
+80100757:	e8 04 03 00 00       	call   80100a60 <cprintf>
+  cprintf(s);
+8010075c:	58                   	pop    %eax
+8010075d:	ff 75 08             	push   0x8(%ebp)
+80100760:	e8 fb 02 00 00       	call   80100a60 <cprintf>
+  cprintf("\n");
+80100765:	c7 04 24 57 b8 10 80 	movl   $0x8010b857,(%esp)
+8010076c:	e8 ef 02 00 00       	call   80100a60 <cprintf>
+  getcallerpcs(&s, pcs);
+80100771:	8d 45 08             	lea    0x8(%ebp),%eax
+80100774:	5a                   	pop    %edx
+80100775:	59                   	pop    %ecx
+80100776:	53                   	push   %ebx
+80100777:	50                   	push   %eax
+80100778:	e8 33 72 00 00       	call   801079b0 <getcallerpcs>
+  for(i=0; i<10; i++)
+8010077d:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+80100780:	83 ec 08             	sub    $0x8,%esp
+80100783:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+80100785:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+80100788:	68 b9 ad 10 80       	push   $0x8010adb9
+8010078d:	e8 ce 02 00 00       	call   80100a60 <cprintf>
+  for(i=0; i<10; i++)
+80100792:	83 c4 10             	add    $0x10,%esp
+80100795:	39 f3                	cmp    %esi,%ebx
+80100797:	75 e7                	jne    80100780 <panic+0x50>
+  panicked = 1; // freeze other CPU
+80100799:	c7 05 78 f0 10 80 01 	movl   $0x1,0x8010f078
+801007a0:	00 00 00 
+  for(;;)
+801007a3:	eb fe                	jmp    801007a3 <panic+0x73>
+801007a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801007ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801007b0 <consputc.part.0>:
+consputc(int c)
+801007b0:	55                   	push   %ebp
+801007b1:	89 e5                	mov    %esp,%ebp
+801007b3:	57                   	push   %edi
+801007b4:	56                   	push   %esi
+801007b5:	53                   	push   %ebx
+801007b6:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+801007b9:	3d 00 01 00 00       	cmp    $0x100,%eax
+801007be:	0f 84 cc 00 00 00    	je     80100890 <consputc.part.0+0xe0>
+    uartputc(c);
+801007c4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801007c7:	bf d4 03 00 00       	mov    $0x3d4,%edi
+801007cc:	89 c3                	mov    %eax,%ebx
+801007ce:	50                   	push   %eax
+801007cf:	e8 8c 8d 00 00       	call   80109560 <uartputc>
+801007d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+801007d9:	89 fa                	mov    %edi,%edx
+801007db:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801007dc:	be d5 03 00 00       	mov    $0x3d5,%esi
+801007e1:	89 f2                	mov    %esi,%edx
+801007e3:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+801007e4:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801007e7:	89 fa                	mov    %edi,%edx
+801007e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+801007ee:	c1 e1 08             	shl    $0x8,%ecx
+801007f1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801007f2:	89 f2                	mov    %esi,%edx
+801007f4:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+801007f5:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+801007f8:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+801007fb:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+801007fd:	83 fb 0a             	cmp    $0xa,%ebx
+80100800:	75 76                	jne    80100878 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100802:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100807:	f7 e2                	mul    %edx
+80100809:	c1 ea 06             	shr    $0x6,%edx
+8010080c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010080f:	c1 e0 04             	shl    $0x4,%eax
+80100812:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100815:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010081b:	0f 8f 2f 01 00 00    	jg     80100950 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100821:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100827:	0f 8f c3 00 00 00    	jg     801008f0 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010082d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010082f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100839:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010083c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100841:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100846:	89 da                	mov    %ebx,%edx
+80100848:	ee                   	out    %al,(%dx)
+80100849:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010084e:	89 f8                	mov    %edi,%eax
+80100850:	89 ca                	mov    %ecx,%edx
+80100852:	ee                   	out    %al,(%dx)
+80100853:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100858:	89 da                	mov    %ebx,%edx
+8010085a:	ee                   	out    %al,(%dx)
+8010085b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+8010085f:	89 ca                	mov    %ecx,%edx
+80100861:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100862:	b8 20 07 00 00       	mov    $0x720,%eax
+80100867:	66 89 06             	mov    %ax,(%esi)
+}
+8010086a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010086d:	5b                   	pop    %ebx
+8010086e:	5e                   	pop    %esi
+8010086f:	5f                   	pop    %edi
+80100870:	5d                   	pop    %ebp
+80100871:	c3                   	ret
+80100872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100878:	0f b6 db             	movzbl %bl,%ebx
+8010087b:	8d 70 01             	lea    0x1(%eax),%esi
+8010087e:	80 cf 07             	or     $0x7,%bh
+80100881:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+80100888:	80 
+80100889:	eb 8a                	jmp    80100815 <consputc.part.0+0x65>
+8010088b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010088f:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100890:	83 ec 0c             	sub    $0xc,%esp
+80100893:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100898:	6a 08                	push   $0x8
+8010089a:	e8 c1 8c 00 00       	call   80109560 <uartputc>
+8010089f:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801008a6:	e8 b5 8c 00 00       	call   80109560 <uartputc>
+801008ab:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+801008b2:	e8 a9 8c 00 00       	call   80109560 <uartputc>
+801008b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+801008bc:	89 f2                	mov    %esi,%edx
+801008be:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801008bf:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+801008c4:	89 da                	mov    %ebx,%edx
+801008c6:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+801008c7:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801008ca:	89 f2                	mov    %esi,%edx
+801008cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+801008d1:	c1 e1 08             	shl    $0x8,%ecx
+801008d4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801008d5:	89 da                	mov    %ebx,%edx
+801008d7:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+801008d8:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+801008db:	83 c4 10             	add    $0x10,%esp
+801008de:	09 ce                	or     %ecx,%esi
+801008e0:	74 5e                	je     80100940 <consputc.part.0+0x190>
+801008e2:	83 ee 01             	sub    $0x1,%esi
+801008e5:	e9 2b ff ff ff       	jmp    80100815 <consputc.part.0+0x65>
+801008ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+801008f0:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+801008f3:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+801008f6:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+801008fd:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100902:	68 60 0e 00 00       	push   $0xe60
+80100907:	68 a0 80 0b 80       	push   $0x800b80a0
+8010090c:	68 00 80 0b 80       	push   $0x800b8000
+80100911:	e8 ca 73 00 00       	call   80107ce0 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100916:	b8 80 07 00 00       	mov    $0x780,%eax
+8010091b:	83 c4 0c             	add    $0xc,%esp
+8010091e:	29 d8                	sub    %ebx,%eax
+80100920:	01 c0                	add    %eax,%eax
+80100922:	50                   	push   %eax
+80100923:	6a 00                	push   $0x0
+80100925:	56                   	push   %esi
+80100926:	e8 25 73 00 00       	call   80107c50 <memset>
+  outb(CRTPORT+1, pos);
+8010092b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+8010092e:	83 c4 10             	add    $0x10,%esp
+80100931:	e9 06 ff ff ff       	jmp    8010083c <consputc.part.0+0x8c>
+80100936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010093d:	8d 76 00             	lea    0x0(%esi),%esi
+80100940:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100944:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100949:	31 ff                	xor    %edi,%edi
+8010094b:	e9 ec fe ff ff       	jmp    8010083c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100950:	83 ec 0c             	sub    $0xc,%esp
+80100953:	68 bd ad 10 80       	push   $0x8010adbd
+80100958:	e8 d3 fd ff ff       	call   80100730 <panic>
+8010095d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100960 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100960:	55                   	push   %ebp
+80100961:	89 e5                	mov    %esp,%ebp
+80100963:	57                   	push   %edi
+80100964:	56                   	push   %esi
+80100965:	53                   	push   %ebx
+80100966:	83 ec 18             	sub    $0x18,%esp
+80100969:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+8010096c:	ff 75 08             	push   0x8(%ebp)
+8010096f:	e8 ec 1f 00 00       	call   80102960 <iunlock>
+  acquire(&cons.lock);
+80100974:	c7 04 24 40 f0 10 80 	movl   $0x8010f040,(%esp)
+8010097b:	e8 f0 71 00 00       	call   80107b70 <acquire>
+  for(i = 0; i < n; i++)
+80100980:	83 c4 10             	add    $0x10,%esp
+80100983:	85 f6                	test   %esi,%esi
+80100985:	7e 25                	jle    801009ac <consolewrite+0x4c>
+80100987:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010098a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+8010098d:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+    consputc(buf[i] & 0xff);
+80100993:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80100996:	85 d2                	test   %edx,%edx
+80100998:	74 06                	je     801009a0 <consolewrite+0x40>
+  asm volatile("cli");
+8010099a:	fa                   	cli
+    for(;;)
+8010099b:	eb fe                	jmp    8010099b <consolewrite+0x3b>
+8010099d:	8d 76 00             	lea    0x0(%esi),%esi
+801009a0:	e8 0b fe ff ff       	call   801007b0 <consputc.part.0>
+  for(i = 0; i < n; i++)
+801009a5:	83 c3 01             	add    $0x1,%ebx
+801009a8:	39 df                	cmp    %ebx,%edi
+801009aa:	75 e1                	jne    8010098d <consolewrite+0x2d>
+  release(&cons.lock);
+801009ac:	83 ec 0c             	sub    $0xc,%esp
+801009af:	68 40 f0 10 80       	push   $0x8010f040
+801009b4:	e8 57 71 00 00       	call   80107b10 <release>
+  ilock(ip);
+801009b9:	58                   	pop    %eax
+801009ba:	ff 75 08             	push   0x8(%ebp)
+801009bd:	e8 ae 1e 00 00       	call   80102870 <ilock>
+
+  return n;
+}
+801009c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009c5:	89 f0                	mov    %esi,%eax
+801009c7:	5b                   	pop    %ebx
+801009c8:	5e                   	pop    %esi
+801009c9:	5f                   	pop    %edi
+801009ca:	5d                   	pop    %ebp
+801009cb:	c3                   	ret
+801009cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801009d0 <printint>:
+{
+801009d0:	55                   	push   %ebp
+801009d1:	89 e5                	mov    %esp,%ebp
+801009d3:	57                   	push   %edi
+801009d4:	56                   	push   %esi
+801009d5:	89 c6                	mov    %eax,%esi
+801009d7:	53                   	push   %ebx
+801009d8:	89 d3                	mov    %edx,%ebx
+801009da:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+801009dd:	85 c9                	test   %ecx,%ecx
+801009df:	74 04                	je     801009e5 <printint+0x15>
+801009e1:	85 c0                	test   %eax,%eax
+801009e3:	78 63                	js     80100a48 <printint+0x78>
+    x = xx;
+801009e5:	89 f1                	mov    %esi,%ecx
+801009e7:	31 c0                	xor    %eax,%eax
+  i = 0;
+801009e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801009ec:	31 f6                	xor    %esi,%esi
+801009ee:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+801009f0:	89 c8                	mov    %ecx,%eax
+801009f2:	31 d2                	xor    %edx,%edx
+801009f4:	89 f7                	mov    %esi,%edi
+801009f6:	f7 f3                	div    %ebx
+801009f8:	8d 76 01             	lea    0x1(%esi),%esi
+801009fb:	0f b6 92 e8 ad 10 80 	movzbl -0x7fef5218(%edx),%edx
+80100a02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100a06:	89 ca                	mov    %ecx,%edx
+80100a08:	89 c1                	mov    %eax,%ecx
+80100a0a:	39 da                	cmp    %ebx,%edx
+80100a0c:	73 e2                	jae    801009f0 <printint+0x20>
+  if(sign)
+80100a0e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100a11:	85 c0                	test   %eax,%eax
+80100a13:	74 07                	je     80100a1c <printint+0x4c>
+    buf[i++] = '-';
+80100a15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+80100a1a:	89 f7                	mov    %esi,%edi
+80100a1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80100a1f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100a21:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+    consputc(buf[i]);
+80100a27:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+80100a2a:	85 d2                	test   %edx,%edx
+80100a2c:	74 0a                	je     80100a38 <printint+0x68>
+80100a2e:	fa                   	cli
+    for(;;)
+80100a2f:	eb fe                	jmp    80100a2f <printint+0x5f>
+80100a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a38:	e8 73 fd ff ff       	call   801007b0 <consputc.part.0>
+  while(--i >= 0)
+80100a3d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100a40:	39 df                	cmp    %ebx,%edi
+80100a42:	74 0c                	je     80100a50 <printint+0x80>
+80100a44:	89 c7                	mov    %eax,%edi
+80100a46:	eb d9                	jmp    80100a21 <printint+0x51>
+80100a48:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+80100a4a:	89 f1                	mov    %esi,%ecx
+80100a4c:	f7 d9                	neg    %ecx
+80100a4e:	eb 99                	jmp    801009e9 <printint+0x19>
+}
+80100a50:	83 c4 2c             	add    $0x2c,%esp
+80100a53:	5b                   	pop    %ebx
+80100a54:	5e                   	pop    %esi
+80100a55:	5f                   	pop    %edi
+80100a56:	5d                   	pop    %ebp
+80100a57:	c3                   	ret
+80100a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a5f:	90                   	nop
+
+80100a60 <cprintf>:
+{
+80100a60:	55                   	push   %ebp
+80100a61:	89 e5                	mov    %esp,%ebp
+80100a63:	57                   	push   %edi
+80100a64:	56                   	push   %esi
+80100a65:	53                   	push   %ebx
+80100a66:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100a69:	8b 3d 74 f0 10 80    	mov    0x8010f074,%edi
+  if (fmt == 0)
+80100a6f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80100a72:	85 ff                	test   %edi,%edi
+80100a74:	0f 85 36 01 00 00    	jne    80100bb0 <cprintf+0x150>
+  if (fmt == 0)
+80100a7a:	85 f6                	test   %esi,%esi
+80100a7c:	0f 84 e0 01 00 00    	je     80100c62 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a82:	0f b6 06             	movzbl (%esi),%eax
+80100a85:	85 c0                	test   %eax,%eax
+80100a87:	74 6b                	je     80100af4 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80100a89:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a8c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80100a8f:	31 db                	xor    %ebx,%ebx
+80100a91:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80100a93:	83 f8 25             	cmp    $0x25,%eax
+80100a96:	0f 85 dc 00 00 00    	jne    80100b78 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+80100a9c:	83 c3 01             	add    $0x1,%ebx
+80100a9f:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80100aa3:	85 c9                	test   %ecx,%ecx
+80100aa5:	74 42                	je     80100ae9 <cprintf+0x89>
+    switch(c){
+80100aa7:	83 f9 70             	cmp    $0x70,%ecx
+80100aaa:	0f 84 99 00 00 00    	je     80100b49 <cprintf+0xe9>
+80100ab0:	7f 4e                	jg     80100b00 <cprintf+0xa0>
+80100ab2:	83 f9 25             	cmp    $0x25,%ecx
+80100ab5:	0f 84 cd 00 00 00    	je     80100b88 <cprintf+0x128>
+80100abb:	83 f9 64             	cmp    $0x64,%ecx
+80100abe:	0f 85 24 01 00 00    	jne    80100be8 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100ac4:	8d 47 04             	lea    0x4(%edi),%eax
+80100ac7:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100acc:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100ad1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100ad4:	8b 07                	mov    (%edi),%eax
+80100ad6:	e8 f5 fe ff ff       	call   801009d0 <printint>
+80100adb:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ade:	83 c3 01             	add    $0x1,%ebx
+80100ae1:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100ae5:	85 c0                	test   %eax,%eax
+80100ae7:	75 aa                	jne    80100a93 <cprintf+0x33>
+80100ae9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+80100aec:	85 ff                	test   %edi,%edi
+80100aee:	0f 85 df 00 00 00    	jne    80100bd3 <cprintf+0x173>
+}
+80100af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100af7:	5b                   	pop    %ebx
+80100af8:	5e                   	pop    %esi
+80100af9:	5f                   	pop    %edi
+80100afa:	5d                   	pop    %ebp
+80100afb:	c3                   	ret
+80100afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100b00:	83 f9 73             	cmp    $0x73,%ecx
+80100b03:	75 3b                	jne    80100b40 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100b05:	8b 17                	mov    (%edi),%edx
+80100b07:	8d 47 04             	lea    0x4(%edi),%eax
+80100b0a:	85 d2                	test   %edx,%edx
+80100b0c:	0f 85 0e 01 00 00    	jne    80100c20 <cprintf+0x1c0>
+80100b12:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100b17:	bf d0 ad 10 80       	mov    $0x8010add0,%edi
+80100b1c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100b1f:	89 fb                	mov    %edi,%ebx
+80100b21:	89 f7                	mov    %esi,%edi
+80100b23:	89 c6                	mov    %eax,%esi
+80100b25:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100b28:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+80100b2e:	85 d2                	test   %edx,%edx
+80100b30:	0f 84 fe 00 00 00    	je     80100c34 <cprintf+0x1d4>
+80100b36:	fa                   	cli
+    for(;;)
+80100b37:	eb fe                	jmp    80100b37 <cprintf+0xd7>
+80100b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100b40:	83 f9 78             	cmp    $0x78,%ecx
+80100b43:	0f 85 9f 00 00 00    	jne    80100be8 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100b49:	8d 47 04             	lea    0x4(%edi),%eax
+80100b4c:	31 c9                	xor    %ecx,%ecx
+80100b4e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100b53:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100b56:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100b59:	8b 07                	mov    (%edi),%eax
+80100b5b:	e8 70 fe ff ff       	call   801009d0 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100b60:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100b64:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100b67:	85 c0                	test   %eax,%eax
+80100b69:	0f 85 24 ff ff ff    	jne    80100a93 <cprintf+0x33>
+80100b6f:	e9 75 ff ff ff       	jmp    80100ae9 <cprintf+0x89>
+80100b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80100b78:	8b 0d 78 f0 10 80    	mov    0x8010f078,%ecx
+80100b7e:	85 c9                	test   %ecx,%ecx
+80100b80:	74 15                	je     80100b97 <cprintf+0x137>
+80100b82:	fa                   	cli
+    for(;;)
+80100b83:	eb fe                	jmp    80100b83 <cprintf+0x123>
+80100b85:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80100b88:	8b 0d 78 f0 10 80    	mov    0x8010f078,%ecx
+80100b8e:	85 c9                	test   %ecx,%ecx
+80100b90:	75 7e                	jne    80100c10 <cprintf+0x1b0>
+80100b92:	b8 25 00 00 00       	mov    $0x25,%eax
+80100b97:	e8 14 fc ff ff       	call   801007b0 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100b9c:	83 c3 01             	add    $0x1,%ebx
+80100b9f:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100ba3:	85 c0                	test   %eax,%eax
+80100ba5:	0f 85 e8 fe ff ff    	jne    80100a93 <cprintf+0x33>
+80100bab:	e9 39 ff ff ff       	jmp    80100ae9 <cprintf+0x89>
+    acquire(&cons.lock);
+80100bb0:	83 ec 0c             	sub    $0xc,%esp
+80100bb3:	68 40 f0 10 80       	push   $0x8010f040
+80100bb8:	e8 b3 6f 00 00       	call   80107b70 <acquire>
+  if (fmt == 0)
+80100bbd:	83 c4 10             	add    $0x10,%esp
+80100bc0:	85 f6                	test   %esi,%esi
+80100bc2:	0f 84 9a 00 00 00    	je     80100c62 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100bc8:	0f b6 06             	movzbl (%esi),%eax
+80100bcb:	85 c0                	test   %eax,%eax
+80100bcd:	0f 85 b6 fe ff ff    	jne    80100a89 <cprintf+0x29>
+    release(&cons.lock);
+80100bd3:	83 ec 0c             	sub    $0xc,%esp
+80100bd6:	68 40 f0 10 80       	push   $0x8010f040
+80100bdb:	e8 30 6f 00 00       	call   80107b10 <release>
+80100be0:	83 c4 10             	add    $0x10,%esp
+80100be3:	e9 0c ff ff ff       	jmp    80100af4 <cprintf+0x94>
+  if(panicked){
+80100be8:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+80100bee:	85 d2                	test   %edx,%edx
+80100bf0:	75 26                	jne    80100c18 <cprintf+0x1b8>
+80100bf2:	b8 25 00 00 00       	mov    $0x25,%eax
+80100bf7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80100bfa:	e8 b1 fb ff ff       	call   801007b0 <consputc.part.0>
+80100bff:	a1 78 f0 10 80       	mov    0x8010f078,%eax
+80100c04:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100c07:	85 c0                	test   %eax,%eax
+80100c09:	74 4b                	je     80100c56 <cprintf+0x1f6>
+80100c0b:	fa                   	cli
+    for(;;)
+80100c0c:	eb fe                	jmp    80100c0c <cprintf+0x1ac>
+80100c0e:	66 90                	xchg   %ax,%ax
+80100c10:	fa                   	cli
+80100c11:	eb fe                	jmp    80100c11 <cprintf+0x1b1>
+80100c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100c17:	90                   	nop
+80100c18:	fa                   	cli
+80100c19:	eb fe                	jmp    80100c19 <cprintf+0x1b9>
+80100c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100c1f:	90                   	nop
+      for(; *s; s++)
+80100c20:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100c23:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100c25:	84 c9                	test   %cl,%cl
+80100c27:	0f 85 ef fe ff ff    	jne    80100b1c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+80100c2d:	89 c7                	mov    %eax,%edi
+80100c2f:	e9 aa fe ff ff       	jmp    80100ade <cprintf+0x7e>
+80100c34:	e8 77 fb ff ff       	call   801007b0 <consputc.part.0>
+      for(; *s; s++)
+80100c39:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+80100c3d:	83 c3 01             	add    $0x1,%ebx
+80100c40:	84 c0                	test   %al,%al
+80100c42:	0f 85 e0 fe ff ff    	jne    80100b28 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100c48:	89 f0                	mov    %esi,%eax
+80100c4a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80100c4d:	89 fe                	mov    %edi,%esi
+80100c4f:	89 c7                	mov    %eax,%edi
+80100c51:	e9 88 fe ff ff       	jmp    80100ade <cprintf+0x7e>
+80100c56:	89 c8                	mov    %ecx,%eax
+80100c58:	e8 53 fb ff ff       	call   801007b0 <consputc.part.0>
+80100c5d:	e9 7c fe ff ff       	jmp    80100ade <cprintf+0x7e>
+    panic("null fmt");
+80100c62:	83 ec 0c             	sub    $0xc,%esp
+80100c65:	68 d7 ad 10 80       	push   $0x8010add7
+80100c6a:	e8 c1 fa ff ff       	call   80100730 <panic>
+80100c6f:	90                   	nop
+
+80100c70 <consoleintr>:
+{
+80100c70:	55                   	push   %ebp
+80100c71:	89 e5                	mov    %esp,%ebp
+80100c73:	57                   	push   %edi
+80100c74:	56                   	push   %esi
+  int c, doprocdump = 0;
+80100c75:	31 f6                	xor    %esi,%esi
+{
+80100c77:	53                   	push   %ebx
+80100c78:	83 ec 18             	sub    $0x18,%esp
+80100c7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+80100c7e:	68 40 f0 10 80       	push   $0x8010f040
+80100c83:	e8 e8 6e 00 00       	call   80107b70 <acquire>
+  while((c = getc()) >= 0){
+80100c88:	83 c4 10             	add    $0x10,%esp
+80100c8b:	eb 1a                	jmp    80100ca7 <consoleintr+0x37>
+80100c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+80100c90:	83 fb 08             	cmp    $0x8,%ebx
+80100c93:	0f 84 d7 00 00 00    	je     80100d70 <consoleintr+0x100>
+80100c99:	83 fb 10             	cmp    $0x10,%ebx
+80100c9c:	0f 85 2d 01 00 00    	jne    80100dcf <consoleintr+0x15f>
+80100ca2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100ca7:	ff d7                	call   *%edi
+80100ca9:	89 c3                	mov    %eax,%ebx
+80100cab:	85 c0                	test   %eax,%eax
+80100cad:	0f 88 e5 00 00 00    	js     80100d98 <consoleintr+0x128>
+    switch(c){
+80100cb3:	83 fb 15             	cmp    $0x15,%ebx
+80100cb6:	74 7a                	je     80100d32 <consoleintr+0xc2>
+80100cb8:	7e d6                	jle    80100c90 <consoleintr+0x20>
+80100cba:	83 fb 7f             	cmp    $0x7f,%ebx
+80100cbd:	0f 84 ad 00 00 00    	je     80100d70 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100cc3:	a1 28 f0 10 80       	mov    0x8010f028,%eax
+80100cc8:	89 c2                	mov    %eax,%edx
+80100cca:	2b 15 20 f0 10 80    	sub    0x8010f020,%edx
+80100cd0:	83 fa 7f             	cmp    $0x7f,%edx
+80100cd3:	77 d2                	ja     80100ca7 <consoleintr+0x37>
+  if(panicked){
+80100cd5:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100cdb:	8d 48 01             	lea    0x1(%eax),%ecx
+80100cde:	83 e0 7f             	and    $0x7f,%eax
+80100ce1:	89 0d 28 f0 10 80    	mov    %ecx,0x8010f028
+80100ce7:	88 98 a0 ef 10 80    	mov    %bl,-0x7fef1060(%eax)
+  if(panicked){
+80100ced:	85 d2                	test   %edx,%edx
+80100cef:	0f 85 47 01 00 00    	jne    80100e3c <consoleintr+0x1cc>
+80100cf5:	89 d8                	mov    %ebx,%eax
+80100cf7:	e8 b4 fa ff ff       	call   801007b0 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100cfc:	83 fb 0a             	cmp    $0xa,%ebx
+80100cff:	0f 84 18 01 00 00    	je     80100e1d <consoleintr+0x1ad>
+80100d05:	83 fb 04             	cmp    $0x4,%ebx
+80100d08:	0f 84 0f 01 00 00    	je     80100e1d <consoleintr+0x1ad>
+80100d0e:	a1 20 f0 10 80       	mov    0x8010f020,%eax
+80100d13:	83 e8 80             	sub    $0xffffff80,%eax
+80100d16:	39 05 28 f0 10 80    	cmp    %eax,0x8010f028
+80100d1c:	75 89                	jne    80100ca7 <consoleintr+0x37>
+80100d1e:	e9 ff 00 00 00       	jmp    80100e22 <consoleintr+0x1b2>
+80100d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d27:	90                   	nop
+80100d28:	b8 00 01 00 00       	mov    $0x100,%eax
+80100d2d:	e8 7e fa ff ff       	call   801007b0 <consputc.part.0>
+      while(input.e != input.w &&
+80100d32:	a1 28 f0 10 80       	mov    0x8010f028,%eax
+80100d37:	3b 05 24 f0 10 80    	cmp    0x8010f024,%eax
+80100d3d:	0f 84 64 ff ff ff    	je     80100ca7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100d43:	83 e8 01             	sub    $0x1,%eax
+80100d46:	89 c2                	mov    %eax,%edx
+80100d48:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100d4b:	80 ba a0 ef 10 80 0a 	cmpb   $0xa,-0x7fef1060(%edx)
+80100d52:	0f 84 4f ff ff ff    	je     80100ca7 <consoleintr+0x37>
+  if(panicked){
+80100d58:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+        input.e--;
+80100d5e:	a3 28 f0 10 80       	mov    %eax,0x8010f028
+  if(panicked){
+80100d63:	85 d2                	test   %edx,%edx
+80100d65:	74 c1                	je     80100d28 <consoleintr+0xb8>
+80100d67:	fa                   	cli
+    for(;;)
+80100d68:	eb fe                	jmp    80100d68 <consoleintr+0xf8>
+80100d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+80100d70:	a1 28 f0 10 80       	mov    0x8010f028,%eax
+80100d75:	3b 05 24 f0 10 80    	cmp    0x8010f024,%eax
+80100d7b:	0f 84 26 ff ff ff    	je     80100ca7 <consoleintr+0x37>
+        input.e--;
+80100d81:	83 e8 01             	sub    $0x1,%eax
+80100d84:	a3 28 f0 10 80       	mov    %eax,0x8010f028
+  if(panicked){
+80100d89:	a1 78 f0 10 80       	mov    0x8010f078,%eax
+80100d8e:	85 c0                	test   %eax,%eax
+80100d90:	74 22                	je     80100db4 <consoleintr+0x144>
+80100d92:	fa                   	cli
+    for(;;)
+80100d93:	eb fe                	jmp    80100d93 <consoleintr+0x123>
+80100d95:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+80100d98:	83 ec 0c             	sub    $0xc,%esp
+80100d9b:	68 40 f0 10 80       	push   $0x8010f040
+80100da0:	e8 6b 6d 00 00       	call   80107b10 <release>
+  if(doprocdump) {
+80100da5:	83 c4 10             	add    $0x10,%esp
+80100da8:	85 f6                	test   %esi,%esi
+80100daa:	75 17                	jne    80100dc3 <consoleintr+0x153>
+}
+80100dac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100daf:	5b                   	pop    %ebx
+80100db0:	5e                   	pop    %esi
+80100db1:	5f                   	pop    %edi
+80100db2:	5d                   	pop    %ebp
+80100db3:	c3                   	ret
+80100db4:	b8 00 01 00 00       	mov    $0x100,%eax
+80100db9:	e8 f2 f9 ff ff       	call   801007b0 <consputc.part.0>
+80100dbe:	e9 e4 fe ff ff       	jmp    80100ca7 <consoleintr+0x37>
+80100dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100dc6:	5b                   	pop    %ebx
+80100dc7:	5e                   	pop    %esi
+80100dc8:	5f                   	pop    %edi
+80100dc9:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+80100dca:	e9 e1 65 00 00       	jmp    801073b0 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100dcf:	85 db                	test   %ebx,%ebx
+80100dd1:	0f 84 d0 fe ff ff    	je     80100ca7 <consoleintr+0x37>
+80100dd7:	a1 28 f0 10 80       	mov    0x8010f028,%eax
+80100ddc:	89 c2                	mov    %eax,%edx
+80100dde:	2b 15 20 f0 10 80    	sub    0x8010f020,%edx
+80100de4:	83 fa 7f             	cmp    $0x7f,%edx
+80100de7:	0f 87 ba fe ff ff    	ja     80100ca7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100ded:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100df0:	8b 15 78 f0 10 80    	mov    0x8010f078,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100df6:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100df9:	83 fb 0d             	cmp    $0xd,%ebx
+80100dfc:	0f 85 df fe ff ff    	jne    80100ce1 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100e02:	89 0d 28 f0 10 80    	mov    %ecx,0x8010f028
+80100e08:	c6 80 a0 ef 10 80 0a 	movb   $0xa,-0x7fef1060(%eax)
+  if(panicked){
+80100e0f:	85 d2                	test   %edx,%edx
+80100e11:	75 29                	jne    80100e3c <consoleintr+0x1cc>
+80100e13:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100e18:	e8 93 f9 ff ff       	call   801007b0 <consputc.part.0>
+          input.w = input.e;
+80100e1d:	a1 28 f0 10 80       	mov    0x8010f028,%eax
+          wakeup(&input.r);
+80100e22:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100e25:	a3 24 f0 10 80       	mov    %eax,0x8010f024
+          wakeup(&input.r);
+80100e2a:	68 20 f0 10 80       	push   $0x8010f020
+80100e2f:	e8 5c 64 00 00       	call   80107290 <wakeup>
+80100e34:	83 c4 10             	add    $0x10,%esp
+80100e37:	e9 6b fe ff ff       	jmp    80100ca7 <consoleintr+0x37>
+80100e3c:	fa                   	cli
+    for(;;)
+80100e3d:	eb fe                	jmp    80100e3d <consoleintr+0x1cd>
+80100e3f:	90                   	nop
+
+80100e40 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100e40:	55                   	push   %ebp
+80100e41:	89 e5                	mov    %esp,%ebp
+80100e43:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100e46:	68 e0 ad 10 80       	push   $0x8010ade0
+80100e4b:	68 40 f0 10 80       	push   $0x8010f040
+80100e50:	e8 3b 6b 00 00       	call   80107990 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100e55:	c7 05 4c f3 10 80 60 	movl   $0x80100960,0x8010f34c
+80100e5c:	09 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100e5f:	c7 05 48 f3 10 80 30 	movl   $0x80100630,0x8010f348
+80100e66:	06 10 80 
+  cons.locking = 1;
+80100e69:	c7 05 74 f0 10 80 01 	movl   $0x1,0x8010f074
+80100e70:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100e73:	58                   	pop    %eax
+80100e74:	5a                   	pop    %edx
+80100e75:	6a 00                	push   $0x0
+80100e77:	6a 01                	push   $0x1
+80100e79:	e8 f2 38 00 00       	call   80104770 <ioapicenable>
+}
+80100e7e:	83 c4 10             	add    $0x10,%esp
+80100e81:	c9                   	leave
+80100e82:	c3                   	ret
+80100e83:	66 90                	xchg   %ax,%ax
+80100e85:	66 90                	xchg   %ax,%ax
+80100e87:	66 90                	xchg   %ax,%ax
+80100e89:	66 90                	xchg   %ax,%ax
+80100e8b:	66 90                	xchg   %ax,%ax
+80100e8d:	66 90                	xchg   %ax,%ax
+80100e8f:	90                   	nop
+
+80100e90 <exec>:
+#include "fs.h"
+#include "file.h"
+
+int
+exec(char *path, char **argv)
+{
+80100e90:	55                   	push   %ebp
+80100e91:	89 e5                	mov    %esp,%ebp
+80100e93:	57                   	push   %edi
+80100e94:	56                   	push   %esi
+80100e95:	53                   	push   %ebx
+80100e96:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100e9c:	e8 7f 5a 00 00       	call   80106920 <myproc>
+80100ea1:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80100ea7:	e8 54 48 00 00       	call   80105700 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100eac:	83 ec 0c             	sub    $0xc,%esp
+80100eaf:	ff 75 08             	push   0x8(%ebp)
+80100eb2:	e8 49 32 00 00       	call   80104100 <namei>
+80100eb7:	83 c4 10             	add    $0x10,%esp
+80100eba:	85 c0                	test   %eax,%eax
+80100ebc:	0f 84 30 03 00 00    	je     801011f2 <exec+0x362>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100ec2:	83 ec 0c             	sub    $0xc,%esp
+80100ec5:	89 c7                	mov    %eax,%edi
+80100ec7:	50                   	push   %eax
+80100ec8:	e8 a3 19 00 00       	call   80102870 <ilock>
+
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100ecd:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100ed3:	6a 34                	push   $0x34
+80100ed5:	6a 00                	push   $0x0
+80100ed7:	50                   	push   %eax
+80100ed8:	57                   	push   %edi
+80100ed9:	e8 52 21 00 00       	call   80103030 <readi>
+80100ede:	83 c4 20             	add    $0x20,%esp
+80100ee1:	83 f8 34             	cmp    $0x34,%eax
+80100ee4:	0f 85 01 01 00 00    	jne    80100feb <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100eea:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100ef1:	45 4c 46 
+80100ef4:	0f 85 f1 00 00 00    	jne    80100feb <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100efa:	e8 d1 97 00 00       	call   8010a6d0 <setupkvm>
+80100eff:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100f05:	85 c0                	test   %eax,%eax
+80100f07:	0f 84 de 00 00 00    	je     80100feb <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100f0d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100f14:	00 
+80100f15:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+80100f1b:	0f 84 a1 02 00 00    	je     801011c2 <exec+0x332>
+  sz = 0;
+80100f21:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100f28:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100f2b:	31 db                	xor    %ebx,%ebx
+80100f2d:	e9 8c 00 00 00       	jmp    80100fbe <exec+0x12e>
+80100f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100f38:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100f3f:	75 6c                	jne    80100fad <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100f41:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100f47:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100f4d:	0f 82 87 00 00 00    	jb     80100fda <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100f53:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100f59:	72 7f                	jb     80100fda <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100f5b:	83 ec 04             	sub    $0x4,%esp
+80100f5e:	50                   	push   %eax
+80100f5f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100f65:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100f6b:	e8 90 95 00 00       	call   8010a500 <allocuvm>
+80100f70:	83 c4 10             	add    $0x10,%esp
+80100f73:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100f79:	85 c0                	test   %eax,%eax
+80100f7b:	74 5d                	je     80100fda <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100f7d:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100f83:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100f88:	75 50                	jne    80100fda <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100f8a:	83 ec 0c             	sub    $0xc,%esp
+80100f8d:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100f93:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100f99:	57                   	push   %edi
+80100f9a:	50                   	push   %eax
+80100f9b:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100fa1:	e8 8a 94 00 00       	call   8010a430 <loaduvm>
+80100fa6:	83 c4 20             	add    $0x20,%esp
+80100fa9:	85 c0                	test   %eax,%eax
+80100fab:	78 2d                	js     80100fda <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100fad:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100fb4:	83 c3 01             	add    $0x1,%ebx
+80100fb7:	83 c6 20             	add    $0x20,%esi
+80100fba:	39 d8                	cmp    %ebx,%eax
+80100fbc:	7e 52                	jle    80101010 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100fbe:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100fc4:	6a 20                	push   $0x20
+80100fc6:	56                   	push   %esi
+80100fc7:	50                   	push   %eax
+80100fc8:	57                   	push   %edi
+80100fc9:	e8 62 20 00 00       	call   80103030 <readi>
+80100fce:	83 c4 10             	add    $0x10,%esp
+80100fd1:	83 f8 20             	cmp    $0x20,%eax
+80100fd4:	0f 84 5e ff ff ff    	je     80100f38 <exec+0xa8>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100fda:	83 ec 0c             	sub    $0xc,%esp
+80100fdd:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100fe3:	e8 68 96 00 00       	call   8010a650 <freevm>
+  if(ip){
+80100fe8:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100feb:	83 ec 0c             	sub    $0xc,%esp
+80100fee:	57                   	push   %edi
+80100fef:	e8 8c 1f 00 00       	call   80102f80 <iunlockput>
+    end_op();
+80100ff4:	e8 87 47 00 00       	call   80105780 <end_op>
+80100ff9:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100ffc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80101001:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101004:	5b                   	pop    %ebx
+80101005:	5e                   	pop    %esi
+80101006:	5f                   	pop    %edi
+80101007:	5d                   	pop    %ebp
+80101008:	c3                   	ret
+80101009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80101010:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80101016:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+8010101c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101022:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80101028:	83 ec 0c             	sub    $0xc,%esp
+8010102b:	57                   	push   %edi
+8010102c:	e8 4f 1f 00 00       	call   80102f80 <iunlockput>
+  end_op();
+80101031:	e8 4a 47 00 00       	call   80105780 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101036:	83 c4 0c             	add    $0xc,%esp
+80101039:	53                   	push   %ebx
+8010103a:	56                   	push   %esi
+8010103b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80101041:	56                   	push   %esi
+80101042:	e8 b9 94 00 00       	call   8010a500 <allocuvm>
+80101047:	83 c4 10             	add    $0x10,%esp
+8010104a:	89 c7                	mov    %eax,%edi
+8010104c:	85 c0                	test   %eax,%eax
+8010104e:	0f 84 86 00 00 00    	je     801010da <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101054:	83 ec 08             	sub    $0x8,%esp
+80101057:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+8010105d:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+8010105f:	50                   	push   %eax
+80101060:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80101061:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101063:	e8 08 97 00 00       	call   8010a770 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80101068:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010106b:	83 c4 10             	add    $0x10,%esp
+8010106e:	8b 10                	mov    (%eax),%edx
+80101070:	85 d2                	test   %edx,%edx
+80101072:	0f 84 56 01 00 00    	je     801011ce <exec+0x33e>
+80101078:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+8010107e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80101081:	eb 23                	jmp    801010a6 <exec+0x216>
+80101083:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101087:	90                   	nop
+80101088:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+8010108b:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80101092:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80101098:	8b 14 87             	mov    (%edi,%eax,4),%edx
+8010109b:	85 d2                	test   %edx,%edx
+8010109d:	74 51                	je     801010f0 <exec+0x260>
+    if(argc >= MAXARG)
+8010109f:	83 f8 20             	cmp    $0x20,%eax
+801010a2:	74 36                	je     801010da <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+801010a4:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+801010a6:	83 ec 0c             	sub    $0xc,%esp
+801010a9:	52                   	push   %edx
+801010aa:	e8 91 6d 00 00       	call   80107e40 <strlen>
+801010af:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+801010b1:	58                   	pop    %eax
+801010b2:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+801010b5:	83 eb 01             	sub    $0x1,%ebx
+801010b8:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+801010bb:	e8 80 6d 00 00       	call   80107e40 <strlen>
+801010c0:	83 c0 01             	add    $0x1,%eax
+801010c3:	50                   	push   %eax
+801010c4:	ff 34 b7             	push   (%edi,%esi,4)
+801010c7:	53                   	push   %ebx
+801010c8:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+801010ce:	e8 6d 9b 00 00       	call   8010ac40 <copyout>
+801010d3:	83 c4 20             	add    $0x20,%esp
+801010d6:	85 c0                	test   %eax,%eax
+801010d8:	79 ae                	jns    80101088 <exec+0x1f8>
+    freevm(pgdir);
+801010da:	83 ec 0c             	sub    $0xc,%esp
+801010dd:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+801010e3:	e8 68 95 00 00       	call   8010a650 <freevm>
+801010e8:	83 c4 10             	add    $0x10,%esp
+801010eb:	e9 0c ff ff ff       	jmp    80100ffc <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+801010f0:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+801010f7:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+801010fd:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101103:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80101106:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80101109:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80101110:	00 00 00 00 
+  ustack[1] = argc;
+80101114:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+8010111a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101121:	ff ff ff 
+  ustack[1] = argc;
+80101124:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010112a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+8010112c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010112e:	29 d0                	sub    %edx,%eax
+80101130:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101136:	56                   	push   %esi
+80101137:	51                   	push   %ecx
+80101138:	53                   	push   %ebx
+80101139:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010113f:	e8 fc 9a 00 00       	call   8010ac40 <copyout>
+80101144:	83 c4 10             	add    $0x10,%esp
+80101147:	85 c0                	test   %eax,%eax
+80101149:	78 8f                	js     801010da <exec+0x24a>
+  for(last=s=path; *s; s++)
+8010114b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010114e:	8b 55 08             	mov    0x8(%ebp),%edx
+80101151:	0f b6 00             	movzbl (%eax),%eax
+80101154:	84 c0                	test   %al,%al
+80101156:	74 17                	je     8010116f <exec+0x2df>
+80101158:	89 d1                	mov    %edx,%ecx
+8010115a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+80101160:	83 c1 01             	add    $0x1,%ecx
+80101163:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80101165:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80101168:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+8010116b:	84 c0                	test   %al,%al
+8010116d:	75 f1                	jne    80101160 <exec+0x2d0>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+8010116f:	83 ec 04             	sub    $0x4,%esp
+80101172:	6a 10                	push   $0x10
+80101174:	52                   	push   %edx
+80101175:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+8010117b:	8d 46 70             	lea    0x70(%esi),%eax
+8010117e:	50                   	push   %eax
+8010117f:	e8 7c 6c 00 00       	call   80107e00 <safestrcpy>
+  curproc->pgdir = pgdir;
+80101184:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+8010118a:	89 f0                	mov    %esi,%eax
+8010118c:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+8010118f:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+80101191:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+80101194:	89 c1                	mov    %eax,%ecx
+80101196:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+8010119c:	8b 40 18             	mov    0x18(%eax),%eax
+8010119f:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+801011a2:	8b 41 18             	mov    0x18(%ecx),%eax
+801011a5:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+801011a8:	89 0c 24             	mov    %ecx,(%esp)
+801011ab:	e8 f0 90 00 00       	call   8010a2a0 <switchuvm>
+  freevm(oldpgdir);
+801011b0:	89 34 24             	mov    %esi,(%esp)
+801011b3:	e8 98 94 00 00       	call   8010a650 <freevm>
+  return 0;
+801011b8:	83 c4 10             	add    $0x10,%esp
+801011bb:	31 c0                	xor    %eax,%eax
+801011bd:	e9 3f fe ff ff       	jmp    80101001 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+801011c2:	bb 00 20 00 00       	mov    $0x2000,%ebx
+801011c7:	31 f6                	xor    %esi,%esi
+801011c9:	e9 5a fe ff ff       	jmp    80101028 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+801011ce:	be 10 00 00 00       	mov    $0x10,%esi
+801011d3:	ba 04 00 00 00       	mov    $0x4,%edx
+801011d8:	b8 03 00 00 00       	mov    $0x3,%eax
+801011dd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+801011e4:	00 00 00 
+801011e7:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+801011ed:	e9 17 ff ff ff       	jmp    80101109 <exec+0x279>
+    end_op();
+801011f2:	e8 89 45 00 00       	call   80105780 <end_op>
+    cprintf("exec: fail\n");
+801011f7:	83 ec 0c             	sub    $0xc,%esp
+801011fa:	68 f9 ad 10 80       	push   $0x8010adf9
+801011ff:	e8 5c f8 ff ff       	call   80100a60 <cprintf>
+    return -1;
+80101204:	83 c4 10             	add    $0x10,%esp
+80101207:	e9 f0 fd ff ff       	jmp    80100ffc <exec+0x16c>
+8010120c:	66 90                	xchg   %ax,%ax
+8010120e:	66 90                	xchg   %ax,%ax
+
+80101210 <fileinit>:
+  struct slabcache cache;
+} ftable;
+
+void
+fileinit(void)
+{
+80101210:	55                   	push   %ebp
+80101211:	89 e5                	mov    %esp,%ebp
+80101213:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101216:	68 05 ae 10 80       	push   $0x8010ae05
+8010121b:	68 80 f0 10 80       	push   $0x8010f080
+80101220:	e8 6b 67 00 00       	call   80107990 <initlock>
+  slabinit(&ftable.cache, "file", sizeof(struct file), 0);
+80101225:	6a 00                	push   $0x0
+80101227:	6a 18                	push   $0x18
+80101229:	68 0c ae 10 80       	push   $0x8010ae0c
+8010122e:	68 b4 f0 10 80       	push   $0x8010f0b4
+80101233:	e8 58 62 00 00       	call   80107490 <slabinit>
+}
+80101238:	83 c4 20             	add    $0x20,%esp
+8010123b:	c9                   	leave
+8010123c:	c3                   	ret
+8010123d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101240 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80101240:	55                   	push   %ebp
+80101241:	89 e5                	mov    %esp,%ebp
+80101243:	83 ec 14             	sub    $0x14,%esp
+  struct file *f;
+
+  if((f = slaballoc(&ftable.cache)) == 0)
+80101246:	68 b4 f0 10 80       	push   $0x8010f0b4
+8010124b:	e8 b0 62 00 00       	call   80107500 <slaballoc>
+80101250:	83 c4 10             	add    $0x10,%esp
+80101253:	85 c0                	test   %eax,%eax
+80101255:	74 07                	je     8010125e <filealloc+0x1e>
+    return 0;
+  f->ref = 1;
+80101257:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+  return f;
+}
+8010125e:	c9                   	leave
+8010125f:	c3                   	ret
+
+80101260 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101260:	55                   	push   %ebp
+80101261:	89 e5                	mov    %esp,%ebp
+80101263:	53                   	push   %ebx
+80101264:	83 ec 10             	sub    $0x10,%esp
+80101267:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010126a:	68 80 f0 10 80       	push   $0x8010f080
+8010126f:	e8 fc 68 00 00       	call   80107b70 <acquire>
+  if(f->ref < 1)
+80101274:	8b 43 04             	mov    0x4(%ebx),%eax
+80101277:	83 c4 10             	add    $0x10,%esp
+8010127a:	85 c0                	test   %eax,%eax
+8010127c:	7e 1a                	jle    80101298 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010127e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80101281:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80101284:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101287:	68 80 f0 10 80       	push   $0x8010f080
+8010128c:	e8 7f 68 00 00       	call   80107b10 <release>
+  return f;
+}
+80101291:	89 d8                	mov    %ebx,%eax
+80101293:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101296:	c9                   	leave
+80101297:	c3                   	ret
+    panic("filedup");
+80101298:	83 ec 0c             	sub    $0xc,%esp
+8010129b:	68 11 ae 10 80       	push   $0x8010ae11
+801012a0:	e8 8b f4 ff ff       	call   80100730 <panic>
+801012a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801012b0 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+801012b0:	55                   	push   %ebp
+801012b1:	89 e5                	mov    %esp,%ebp
+801012b3:	57                   	push   %edi
+801012b4:	56                   	push   %esi
+801012b5:	53                   	push   %ebx
+801012b6:	83 ec 28             	sub    $0x28,%esp
+801012b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+801012bc:	68 80 f0 10 80       	push   $0x8010f080
+801012c1:	e8 aa 68 00 00       	call   80107b70 <acquire>
+  if(f->ref < 1)
+801012c6:	8b 53 04             	mov    0x4(%ebx),%edx
+801012c9:	83 c4 10             	add    $0x10,%esp
+801012cc:	85 d2                	test   %edx,%edx
+801012ce:	0f 8e a5 00 00 00    	jle    80101379 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+801012d4:	83 ea 01             	sub    $0x1,%edx
+801012d7:	89 53 04             	mov    %edx,0x4(%ebx)
+801012da:	75 44                	jne    80101320 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+801012dc:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  release(&ftable.lock);
+801012e0:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+801012e3:	8b 3b                	mov    (%ebx),%edi
+801012e5:	8b 73 0c             	mov    0xc(%ebx),%esi
+801012e8:	88 45 e7             	mov    %al,-0x19(%ebp)
+801012eb:	8b 43 10             	mov    0x10(%ebx),%eax
+801012ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+801012f1:	68 80 f0 10 80       	push   $0x8010f080
+801012f6:	e8 15 68 00 00       	call   80107b10 <release>
+  slabfree(&ftable.cache, f);
+801012fb:	58                   	pop    %eax
+801012fc:	5a                   	pop    %edx
+801012fd:	53                   	push   %ebx
+801012fe:	68 b4 f0 10 80       	push   $0x8010f0b4
+80101303:	e8 f8 63 00 00       	call   80107700 <slabfree>
+
+  if(ff.type == FD_PIPE)
+80101308:	83 c4 10             	add    $0x10,%esp
+8010130b:	83 ff 01             	cmp    $0x1,%edi
+8010130e:	74 50                	je     80101360 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+80101310:	83 ff 02             	cmp    $0x2,%edi
+80101313:	74 23                	je     80101338 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+80101315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101318:	5b                   	pop    %ebx
+80101319:	5e                   	pop    %esi
+8010131a:	5f                   	pop    %edi
+8010131b:	5d                   	pop    %ebp
+8010131c:	c3                   	ret
+8010131d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+80101320:	c7 45 08 80 f0 10 80 	movl   $0x8010f080,0x8(%ebp)
+}
+80101327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010132a:	5b                   	pop    %ebx
+8010132b:	5e                   	pop    %esi
+8010132c:	5f                   	pop    %edi
+8010132d:	5d                   	pop    %ebp
+    release(&ftable.lock);
+8010132e:	e9 dd 67 00 00       	jmp    80107b10 <release>
+80101333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101337:	90                   	nop
+    begin_op();
+80101338:	e8 c3 43 00 00       	call   80105700 <begin_op>
+    iput(ff.ip);
+8010133d:	83 ec 0c             	sub    $0xc,%esp
+80101340:	ff 75 e0             	push   -0x20(%ebp)
+80101343:	e8 68 16 00 00       	call   801029b0 <iput>
+    end_op();
+80101348:	83 c4 10             	add    $0x10,%esp
+}
+8010134b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010134e:	5b                   	pop    %ebx
+8010134f:	5e                   	pop    %esi
+80101350:	5f                   	pop    %edi
+80101351:	5d                   	pop    %ebp
+    end_op();
+80101352:	e9 29 44 00 00       	jmp    80105780 <end_op>
+80101357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010135e:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101360:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101364:	83 ec 08             	sub    $0x8,%esp
+80101367:	53                   	push   %ebx
+80101368:	56                   	push   %esi
+80101369:	e8 22 4d 00 00       	call   80106090 <pipeclose>
+8010136e:	83 c4 10             	add    $0x10,%esp
+}
+80101371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101374:	5b                   	pop    %ebx
+80101375:	5e                   	pop    %esi
+80101376:	5f                   	pop    %edi
+80101377:	5d                   	pop    %ebp
+80101378:	c3                   	ret
+    panic("fileclose");
+80101379:	83 ec 0c             	sub    $0xc,%esp
+8010137c:	68 19 ae 10 80       	push   $0x8010ae19
+80101381:	e8 aa f3 ff ff       	call   80100730 <panic>
+80101386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010138d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101390 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101390:	55                   	push   %ebp
+80101391:	89 e5                	mov    %esp,%ebp
+80101393:	53                   	push   %ebx
+80101394:	83 ec 04             	sub    $0x4,%esp
+80101397:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010139a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010139d:	75 31                	jne    801013d0 <filestat+0x40>
+    ilock(f->ip);
+8010139f:	83 ec 0c             	sub    $0xc,%esp
+801013a2:	ff 73 10             	push   0x10(%ebx)
+801013a5:	e8 c6 14 00 00       	call   80102870 <ilock>
+    stati(f->ip, st);
+801013aa:	58                   	pop    %eax
+801013ab:	5a                   	pop    %edx
+801013ac:	ff 75 0c             	push   0xc(%ebp)
+801013af:	ff 73 10             	push   0x10(%ebx)
+801013b2:	e8 19 1c 00 00       	call   80102fd0 <stati>
+    iunlock(f->ip);
+801013b7:	59                   	pop    %ecx
+801013b8:	ff 73 10             	push   0x10(%ebx)
+801013bb:	e8 a0 15 00 00       	call   80102960 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+801013c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801013c3:	83 c4 10             	add    $0x10,%esp
+801013c6:	31 c0                	xor    %eax,%eax
+}
+801013c8:	c9                   	leave
+801013c9:	c3                   	ret
+801013ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801013d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+801013d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801013d8:	c9                   	leave
+801013d9:	c3                   	ret
+801013da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801013e0 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+801013e0:	55                   	push   %ebp
+801013e1:	89 e5                	mov    %esp,%ebp
+801013e3:	57                   	push   %edi
+801013e4:	56                   	push   %esi
+801013e5:	53                   	push   %ebx
+801013e6:	83 ec 0c             	sub    $0xc,%esp
+801013e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801013ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+801013ef:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int r;
+
+  if(f->readable == 0)
+801013f2:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801013f6:	74 60                	je     80101458 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+801013f8:	8b 03                	mov    (%ebx),%eax
+801013fa:	83 f8 01             	cmp    $0x1,%eax
+801013fd:	74 41                	je     80101440 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801013ff:	83 f8 02             	cmp    $0x2,%eax
+80101402:	75 5b                	jne    8010145f <fileread+0x7f>
+    ilock(f->ip);
+80101404:	83 ec 0c             	sub    $0xc,%esp
+80101407:	ff 73 10             	push   0x10(%ebx)
+8010140a:	e8 61 14 00 00       	call   80102870 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+8010140f:	57                   	push   %edi
+80101410:	ff 73 14             	push   0x14(%ebx)
+80101413:	56                   	push   %esi
+80101414:	ff 73 10             	push   0x10(%ebx)
+80101417:	e8 14 1c 00 00       	call   80103030 <readi>
+8010141c:	83 c4 20             	add    $0x20,%esp
+8010141f:	89 c6                	mov    %eax,%esi
+80101421:	85 c0                	test   %eax,%eax
+80101423:	7e 03                	jle    80101428 <fileread+0x48>
+      f->off += r;
+80101425:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+80101428:	83 ec 0c             	sub    $0xc,%esp
+8010142b:	ff 73 10             	push   0x10(%ebx)
+8010142e:	e8 2d 15 00 00       	call   80102960 <iunlock>
+    return r;
+80101433:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+80101436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101439:	89 f0                	mov    %esi,%eax
+8010143b:	5b                   	pop    %ebx
+8010143c:	5e                   	pop    %esi
+8010143d:	5f                   	pop    %edi
+8010143e:	5d                   	pop    %ebp
+8010143f:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80101440:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101443:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101449:	5b                   	pop    %ebx
+8010144a:	5e                   	pop    %esi
+8010144b:	5f                   	pop    %edi
+8010144c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010144d:	e9 5e 4f 00 00       	jmp    801063b0 <piperead>
+80101452:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80101458:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010145d:	eb d7                	jmp    80101436 <fileread+0x56>
+  panic("fileread");
+8010145f:	83 ec 0c             	sub    $0xc,%esp
+80101462:	68 23 ae 10 80       	push   $0x8010ae23
+80101467:	e8 c4 f2 ff ff       	call   80100730 <panic>
+8010146c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101470 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101470:	55                   	push   %ebp
+80101471:	89 e5                	mov    %esp,%ebp
+80101473:	57                   	push   %edi
+80101474:	56                   	push   %esi
+80101475:	53                   	push   %ebx
+80101476:	83 ec 1c             	sub    $0x1c,%esp
+80101479:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010147c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010147f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101482:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+80101485:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+80101489:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+8010148c:	0f 84 b1 00 00 00    	je     80101543 <filewrite+0xd3>
+    return -1;
+  if(f->type == FD_PIPE)
+80101492:	8b 03                	mov    (%ebx),%eax
+80101494:	83 f8 01             	cmp    $0x1,%eax
+80101497:	0f 84 b3 00 00 00    	je     80101550 <filewrite+0xe0>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010149d:	83 f8 02             	cmp    $0x2,%eax
+801014a0:	0f 85 bc 00 00 00    	jne    80101562 <filewrite+0xf2>
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+801014a6:	31 ff                	xor    %edi,%edi
+801014a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014af:	90                   	nop
+    while(i < n){
+801014b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801014b3:	39 c7                	cmp    %eax,%edi
+801014b5:	7d 61                	jge    80101518 <filewrite+0xa8>
+      int n1 = n - i;
+801014b7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+      if(n1 > max)
+801014ba:	b8 00 06 00 00       	mov    $0x600,%eax
+      int n1 = n - i;
+801014bf:	29 fe                	sub    %edi,%esi
+      if(n1 > max)
+801014c1:	39 c6                	cmp    %eax,%esi
+801014c3:	0f 4f f0             	cmovg  %eax,%esi
+        n1 = max;
+
+      begin_op();
+801014c6:	e8 35 42 00 00       	call   80105700 <begin_op>
+      ilock(f->ip);
+801014cb:	83 ec 0c             	sub    $0xc,%esp
+801014ce:	ff 73 10             	push   0x10(%ebx)
+801014d1:	e8 9a 13 00 00       	call   80102870 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+801014d6:	56                   	push   %esi
+801014d7:	ff 73 14             	push   0x14(%ebx)
+801014da:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801014dd:	01 f8                	add    %edi,%eax
+801014df:	50                   	push   %eax
+801014e0:	ff 73 10             	push   0x10(%ebx)
+801014e3:	e8 68 1e 00 00       	call   80103350 <writei>
+801014e8:	83 c4 20             	add    $0x20,%esp
+801014eb:	85 c0                	test   %eax,%eax
+801014ed:	7e 41                	jle    80101530 <filewrite+0xc0>
+        f->off += r;
+801014ef:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+801014f2:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+801014f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+801014f8:	ff 73 10             	push   0x10(%ebx)
+801014fb:	e8 60 14 00 00       	call   80102960 <iunlock>
+      end_op();
+80101500:	e8 7b 42 00 00       	call   80105780 <end_op>
+
+      if(r < 0)
+        break;
+      i += r;
+80101505:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      if(r != n1)
+80101508:	83 c4 10             	add    $0x10,%esp
+      i += r;
+8010150b:	01 c7                	add    %eax,%edi
+      if(r != n1)
+8010150d:	39 c6                	cmp    %eax,%esi
+8010150f:	74 9f                	je     801014b0 <filewrite+0x40>
+80101511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        break;  // file cannot grow any further
+    }
+    return i == n ? n : -1;
+80101518:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010151b:	39 c7                	cmp    %eax,%edi
+8010151d:	75 24                	jne    80101543 <filewrite+0xd3>
+8010151f:	89 f8                	mov    %edi,%eax
+  }
+  panic("filewrite");
+}
+80101521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101524:	5b                   	pop    %ebx
+80101525:	5e                   	pop    %esi
+80101526:	5f                   	pop    %edi
+80101527:	5d                   	pop    %ebp
+80101528:	c3                   	ret
+80101529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      iunlock(f->ip);
+80101530:	83 ec 0c             	sub    $0xc,%esp
+80101533:	ff 73 10             	push   0x10(%ebx)
+80101536:	e8 25 14 00 00       	call   80102960 <iunlock>
+      end_op();
+8010153b:	e8 40 42 00 00       	call   80105780 <end_op>
+80101540:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80101543:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101548:	eb d7                	jmp    80101521 <filewrite+0xb1>
+8010154a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return pipewrite(f->pipe, addr, n);
+80101550:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101553:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101559:	5b                   	pop    %ebx
+8010155a:	5e                   	pop    %esi
+8010155b:	5f                   	pop    %edi
+8010155c:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+8010155d:	e9 0e 4c 00 00       	jmp    80106170 <pipewrite>
+  panic("filewrite");
+80101562:	83 ec 0c             	sub    $0xc,%esp
+80101565:	68 2c ae 10 80       	push   $0x8010ae2c
+8010156a:	e8 c1 f1 ff ff       	call   80100730 <panic>
+8010156f:	90                   	nop
+
+80101570 <inodector>:
+  bk->inode = ip;
+}
+
+static void
+inodector(void *v)
+{
+80101570:	55                   	push   %ebp
+80101571:	89 e5                	mov    %esp,%ebp
+80101573:	83 ec 10             	sub    $0x10,%esp
+  initsleeplock(&((struct inode*)v)->lock, "inode");
+80101576:	68 36 ae 10 80       	push   $0x8010ae36
+8010157b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010157e:	83 c0 0c             	add    $0xc,%eax
+80101581:	50                   	push   %eax
+80101582:	e8 d9 62 00 00       	call   80107860 <initsleeplock>
+}
+80101587:	83 c4 10             	add    $0x10,%esp
+8010158a:	c9                   	leave
+8010158b:	c3                   	ret
+8010158c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101590 <efree>:
+
+// Free the extents in e[0..n), given the logical block
+// before the first one.  Returns the end of the last extent.
+static uint
+efree(uint dev, struct extent *e, int n, uint prev)
+{
+80101590:	55                   	push   %ebp
+80101591:	89 e5                	mov    %esp,%ebp
+80101593:	57                   	push   %edi
+80101594:	56                   	push   %esi
+80101595:	8d 34 ca             	lea    (%edx,%ecx,8),%esi
+80101598:	53                   	push   %ebx
+80101599:	89 d3                	mov    %edx,%ebx
+8010159b:	83 ec 2c             	sub    $0x2c,%esp
+8010159e:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+801015a1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801015a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  int i;
+
+  for(i = 0; i < n && e[i].end != 0; i++){
+801015a7:	8b 13                	mov    (%ebx),%edx
+801015a9:	85 d2                	test   %edx,%edx
+801015ab:	0f 84 47 01 00 00    	je     801016f8 <efree+0x168>
+    bfreerange(dev, e[i].pend - (e[i].end - prev), e[i].end - prev);
+801015b1:	8b 7b 04             	mov    0x4(%ebx),%edi
+801015b4:	8d 34 07             	lea    (%edi,%eax,1),%esi
+801015b7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801015ba:	29 d6                	sub    %edx,%esi
+  for(end = b + n; b < end; ){
+801015bc:	39 fe                	cmp    %edi,%esi
+801015be:	0f 83 49 01 00 00    	jae    8010170d <efree+0x17d>
+801015c4:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+801015c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801015ce:	66 90                	xchg   %ax,%ax
+    bp = bread(dev, BBLOCK(b, sb));
+801015d0:	89 f0                	mov    %esi,%eax
+801015d2:	83 ec 08             	sub    $0x8,%esp
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+801015d5:	89 f3                	mov    %esi,%ebx
+    bp = bread(dev, BBLOCK(b, sb));
+801015d7:	c1 e8 0c             	shr    $0xc,%eax
+801015da:	03 05 b8 1f 11 80    	add    0x80111fb8,%eax
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+801015e0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+    bp = bread(dev, BBLOCK(b, sb));
+801015e6:	50                   	push   %eax
+801015e7:	ff 75 dc             	push   -0x24(%ebp)
+801015ea:	e8 81 ee ff ff       	call   80100470 <bread>
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+801015ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801015f2:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, BBLOCK(b, sb));
+801015f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+801015f8:	39 fe                	cmp    %edi,%esi
+801015fa:	0f 83 d0 00 00 00    	jae    801016d0 <efree+0x140>
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+80101600:	89 da                	mov    %ebx,%edx
+80101602:	89 f1                	mov    %esi,%ecx
+80101604:	c1 ea 03             	shr    $0x3,%edx
+80101607:	03 50 60             	add    0x60(%eax),%edx
+8010160a:	83 e1 07             	and    $0x7,%ecx
+8010160d:	0f b6 3a             	movzbl (%edx),%edi
+80101610:	0f a3 cf             	bt     %ecx,%edi
+80101613:	89 f8                	mov    %edi,%eax
+80101615:	72 2e                	jb     80101645 <efree+0xb5>
+80101617:	e9 e4 00 00 00       	jmp    80101700 <efree+0x170>
+8010161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+80101620:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101623:	39 c6                	cmp    %eax,%esi
+80101625:	73 78                	jae    8010169f <efree+0x10f>
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+80101627:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010162a:	89 da                	mov    %ebx,%edx
+8010162c:	89 d9                	mov    %ebx,%ecx
+8010162e:	c1 ea 03             	shr    $0x3,%edx
+80101631:	83 e1 07             	and    $0x7,%ecx
+80101634:	03 50 60             	add    0x60(%eax),%edx
+80101637:	0f b6 3a             	movzbl (%edx),%edi
+8010163a:	0f a3 cf             	bt     %ecx,%edi
+8010163d:	89 f8                	mov    %edi,%eax
+8010163f:	0f 83 bb 00 00 00    	jae    80101700 <efree+0x170>
+      bp->data[bi/8] &= ~(1 << (bi % 8));
+80101645:	bf 01 00 00 00       	mov    $0x1,%edi
+      acquire(&bsum.lock);
+8010164a:	83 ec 0c             	sub    $0xc,%esp
+      bp->data[bi/8] &= ~(1 << (bi % 8));
+8010164d:	d3 e7                	shl    %cl,%edi
+8010164f:	89 f9                	mov    %edi,%ecx
+80101651:	f7 d1                	not    %ecx
+80101653:	21 c8                	and    %ecx,%eax
+80101655:	88 02                	mov    %al,(%edx)
+      acquire(&bsum.lock);
+80101657:	68 e0 13 11 80       	push   $0x801113e0
+8010165c:	e8 0f 65 00 00       	call   80107b70 <acquire>
+      if(bsum.nfree[b / BPB] >= 0)
+80101661:	89 f0                	mov    %esi,%eax
+80101663:	83 c4 10             	add    $0x10,%esp
+80101666:	c1 e8 0c             	shr    $0xc,%eax
+80101669:	83 c0 0c             	add    $0xc,%eax
+8010166c:	8b 14 85 e4 13 11 80 	mov    -0x7feeec1c(,%eax,4),%edx
+80101673:	85 d2                	test   %edx,%edx
+80101675:	78 0a                	js     80101681 <efree+0xf1>
+        bsum.nfree[b / BPB]++;
+80101677:	83 c2 01             	add    $0x1,%edx
+8010167a:	89 14 85 e4 13 11 80 	mov    %edx,-0x7feeec1c(,%eax,4)
+      release(&bsum.lock);
+80101681:	83 ec 0c             	sub    $0xc,%esp
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+80101684:	83 c3 01             	add    $0x1,%ebx
+80101687:	83 c6 01             	add    $0x1,%esi
+      release(&bsum.lock);
+8010168a:	68 e0 13 11 80       	push   $0x801113e0
+8010168f:	e8 7c 64 00 00       	call   80107b10 <release>
+    for(bi = b % BPB; bi < BPB && b < end; bi++, b++){
+80101694:	83 c4 10             	add    $0x10,%esp
+80101697:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+8010169d:	76 81                	jbe    80101620 <efree+0x90>
+    log_write(bp);
+8010169f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801016a2:	83 ec 0c             	sub    $0xc,%esp
+801016a5:	53                   	push   %ebx
+801016a6:	e8 85 42 00 00       	call   80105930 <log_write>
+    brelse(bp);
+801016ab:	89 1c 24             	mov    %ebx,(%esp)
+801016ae:	e8 ad ee ff ff       	call   80100560 <brelse>
+  for(end = b + n; b < end; ){
+801016b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801016b6:	83 c4 10             	add    $0x10,%esp
+801016b9:	39 c6                	cmp    %eax,%esi
+801016bb:	0f 82 0f ff ff ff    	jb     801015d0 <efree+0x40>
+    prev = e[i].end;
+801016c1:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+801016c4:	8b 03                	mov    (%ebx),%eax
+801016c6:	eb 24                	jmp    801016ec <efree+0x15c>
+801016c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801016cf:	90                   	nop
+    log_write(bp);
+801016d0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801016d3:	83 ec 0c             	sub    $0xc,%esp
+801016d6:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+801016d9:	56                   	push   %esi
+801016da:	e8 51 42 00 00       	call   80105930 <log_write>
+    brelse(bp);
+801016df:	89 34 24             	mov    %esi,(%esp)
+801016e2:	e8 79 ee ff ff       	call   80100560 <brelse>
+    prev = e[i].end;
+801016e7:	8b 03                	mov    (%ebx),%eax
+801016e9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n && e[i].end != 0; i++){
+801016ec:	83 c3 08             	add    $0x8,%ebx
+801016ef:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+801016f2:	0f 85 af fe ff ff    	jne    801015a7 <efree+0x17>
+  }
+  return prev;
+}
+801016f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801016fb:	5b                   	pop    %ebx
+801016fc:	5e                   	pop    %esi
+801016fd:	5f                   	pop    %edi
+801016fe:	5d                   	pop    %ebp
+801016ff:	c3                   	ret
+        panic("freeing free block");
+80101700:	83 ec 0c             	sub    $0xc,%esp
+80101703:	68 3c ae 10 80       	push   $0x8010ae3c
+80101708:	e8 23 f0 ff ff       	call   80100730 <panic>
+  for(end = b + n; b < end; ){
+8010170d:	89 d0                	mov    %edx,%eax
+8010170f:	eb db                	jmp    801016ec <efree+0x15c>
+80101711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010171f:	90                   	nop
+
+80101720 <bfree>:
+{
+80101720:	55                   	push   %ebp
+80101721:	89 e5                	mov    %esp,%ebp
+80101723:	57                   	push   %edi
+80101724:	56                   	push   %esi
+  bp = bread(dev, BBLOCK(b, sb));
+80101725:	89 d6                	mov    %edx,%esi
+{
+80101727:	53                   	push   %ebx
+80101728:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+8010172a:	c1 ee 0c             	shr    $0xc,%esi
+{
+8010172d:	83 ec 14             	sub    $0x14,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101730:	8b 15 b8 1f 11 80    	mov    0x80111fb8,%edx
+80101736:	01 f2                	add    %esi,%edx
+80101738:	52                   	push   %edx
+80101739:	50                   	push   %eax
+8010173a:	e8 31 ed ff ff       	call   80100470 <bread>
+  m = 1 << (bi % 8);
+8010173f:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101741:	c1 fb 03             	sar    $0x3,%ebx
+80101744:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101747:	89 c7                	mov    %eax,%edi
+  m = 1 << (bi % 8);
+80101749:	83 e1 07             	and    $0x7,%ecx
+8010174c:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101751:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+80101757:	03 5f 60             	add    0x60(%edi),%ebx
+  m = 1 << (bi % 8);
+8010175a:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+8010175c:	0f b6 0b             	movzbl (%ebx),%ecx
+8010175f:	85 c1                	test   %eax,%ecx
+80101761:	74 56                	je     801017b9 <bfree+0x99>
+  bp->data[bi/8] &= ~m;
+80101763:	f7 d0                	not    %eax
+  log_write(bp);
+80101765:	83 ec 0c             	sub    $0xc,%esp
+  if(bsum.nfree[b / BPB] >= 0)
+80101768:	83 c6 0c             	add    $0xc,%esi
+  bp->data[bi/8] &= ~m;
+8010176b:	21 c8                	and    %ecx,%eax
+8010176d:	88 03                	mov    %al,(%ebx)
+  log_write(bp);
+8010176f:	57                   	push   %edi
+80101770:	e8 bb 41 00 00       	call   80105930 <log_write>
+  acquire(&bsum.lock);
+80101775:	c7 04 24 e0 13 11 80 	movl   $0x801113e0,(%esp)
+8010177c:	e8 ef 63 00 00       	call   80107b70 <acquire>
+  if(bsum.nfree[b / BPB] >= 0)
+80101781:	8b 04 b5 e4 13 11 80 	mov    -0x7feeec1c(,%esi,4),%eax
+80101788:	83 c4 10             	add    $0x10,%esp
+8010178b:	85 c0                	test   %eax,%eax
+8010178d:	78 0a                	js     80101799 <bfree+0x79>
+    bsum.nfree[b / BPB]++;
+8010178f:	83 c0 01             	add    $0x1,%eax
+80101792:	89 04 b5 e4 13 11 80 	mov    %eax,-0x7feeec1c(,%esi,4)
+  release(&bsum.lock);
+80101799:	83 ec 0c             	sub    $0xc,%esp
+8010179c:	68 e0 13 11 80       	push   $0x801113e0
+801017a1:	e8 6a 63 00 00       	call   80107b10 <release>
+  brelse(bp);
+801017a6:	89 3c 24             	mov    %edi,(%esp)
+801017a9:	e8 b2 ed ff ff       	call   80100560 <brelse>
+}
+801017ae:	83 c4 10             	add    $0x10,%esp
+801017b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801017b4:	5b                   	pop    %ebx
+801017b5:	5e                   	pop    %esi
+801017b6:	5f                   	pop    %edi
+801017b7:	5d                   	pop    %ebp
+801017b8:	c3                   	ret
+    panic("freeing free block");
+801017b9:	83 ec 0c             	sub    $0xc,%esp
+801017bc:	68 3c ae 10 80       	push   $0x8010ae3c
+801017c1:	e8 6a ef ff ff       	call   80100730 <panic>
+801017c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801017cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801017d0 <ballocin>:
+{
+801017d0:	55                   	push   %ebp
+801017d1:	89 e5                	mov    %esp,%ebp
+801017d3:	57                   	push   %edi
+  base = bb * BPB;
+801017d4:	89 d7                	mov    %edx,%edi
+{
+801017d6:	56                   	push   %esi
+  base = bb * BPB;
+801017d7:	c1 e7 0c             	shl    $0xc,%edi
+{
+801017da:	89 d6                	mov    %edx,%esi
+801017dc:	53                   	push   %ebx
+801017dd:	83 ec 34             	sub    $0x34,%esp
+  n = sb.size - base < BPB ? sb.size - base : BPB;
+801017e0:	8b 1d a0 1f 11 80    	mov    0x80111fa0,%ebx
+{
+801017e6:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  base = bb * BPB;
+801017e9:	89 fa                	mov    %edi,%edx
+801017eb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  n = sb.size - base < BPB ? sb.size - base : BPB;
+801017ee:	89 df                	mov    %ebx,%edi
+{
+801017f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  n = sb.size - base < BPB ? sb.size - base : BPB;
+801017f3:	b8 00 10 00 00       	mov    $0x1000,%eax
+801017f8:	29 d7                	sub    %edx,%edi
+{
+801017fa:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  n = sb.size - base < BPB ? sb.size - base : BPB;
+801017fd:	39 c7                	cmp    %eax,%edi
+801017ff:	0f 47 f8             	cmova  %eax,%edi
+  bp = bread(dev, sb.bmapstart + bb);
+80101802:	a1 b8 1f 11 80       	mov    0x80111fb8,%eax
+80101807:	01 f0                	add    %esi,%eax
+80101809:	50                   	push   %eax
+8010180a:	ff 75 dc             	push   -0x24(%ebp)
+8010180d:	e8 5e ec ff ff       	call   80100470 <bread>
+80101812:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  acquire(&bsum.lock);
+80101815:	c7 04 24 e0 13 11 80 	movl   $0x801113e0,(%esp)
+8010181c:	e8 4f 63 00 00       	call   80107b70 <acquire>
+  if(bsum.nfree[bb] < 0)
+80101821:	8b 0c b5 14 14 11 80 	mov    -0x7feeebec(,%esi,4),%ecx
+80101828:	8d 46 0c             	lea    0xc(%esi),%eax
+8010182b:	83 c4 10             	add    $0x10,%esp
+8010182e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80101831:	85 c9                	test   %ecx,%ecx
+80101833:	0f 88 47 01 00 00    	js     80101980 <ballocin+0x1b0>
+  release(&bsum.lock);
+80101839:	83 ec 0c             	sub    $0xc,%esp
+8010183c:	68 e0 13 11 80       	push   $0x801113e0
+80101841:	e8 ca 62 00 00       	call   80107b10 <release>
+  if((bi = bscan((uint*)bp->data, from, n)) < 0){
+80101846:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  for(i = from/32; i*32 < n; i++){
+80101849:	83 c4 10             	add    $0x10,%esp
+  if((bi = bscan((uint*)bp->data, from, n)) < 0){
+8010184c:	8b 70 60             	mov    0x60(%eax),%esi
+  for(i = from/32; i*32 < n; i++){
+8010184f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101852:	89 c1                	mov    %eax,%ecx
+80101854:	83 e0 e0             	and    $0xffffffe0,%eax
+80101857:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010185a:	c1 e9 05             	shr    $0x5,%ecx
+8010185d:	39 f8                	cmp    %edi,%eax
+8010185f:	0f 83 ff 00 00 00    	jae    80101964 <ballocin+0x194>
+80101865:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80101868:	89 ca                	mov    %ecx,%edx
+    x = ~w[i];
+8010186a:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010186d:	f7 d0                	not    %eax
+    if(i == from/32)
+8010186f:	39 55 d4             	cmp    %edx,-0x2c(%ebp)
+80101872:	75 0f                	jne    80101883 <ballocin+0xb3>
+      x &= ~((1U << (from % 32)) - 1);
+80101874:	0f b6 4d d8          	movzbl -0x28(%ebp),%ecx
+80101878:	bb 01 00 00 00       	mov    $0x1,%ebx
+8010187d:	d3 e3                	shl    %cl,%ebx
+8010187f:	f7 db                	neg    %ebx
+80101881:	21 d8                	and    %ebx,%eax
+    if(x == 0)
+80101883:	85 c0                	test   %eax,%eax
+80101885:	0f 84 c5 00 00 00    	je     80101950 <ballocin+0x180>
+    for(bi = 0; (x & (1U << bi)) == 0; bi++)
+8010188b:	31 c9                	xor    %ecx,%ecx
+8010188d:	ba 01 00 00 00       	mov    $0x1,%edx
+80101892:	a8 01                	test   $0x1,%al
+80101894:	75 18                	jne    801018ae <ballocin+0xde>
+80101896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010189d:	8d 76 00             	lea    0x0(%esi),%esi
+801018a0:	83 c1 01             	add    $0x1,%ecx
+801018a3:	89 d3                	mov    %edx,%ebx
+801018a5:	d3 e3                	shl    %cl,%ebx
+801018a7:	85 c3                	test   %eax,%ebx
+801018a9:	74 f5                	je     801018a0 <ballocin+0xd0>
+    if(i*32 + bi >= n)
+801018ab:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+801018ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801018b1:	39 f8                	cmp    %edi,%eax
+801018b3:	0f 83 ab 00 00 00    	jae    80101964 <ballocin+0x194>
+  bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+801018b9:	89 c2                	mov    %eax,%edx
+801018bb:	89 c1                	mov    %eax,%ecx
+801018bd:	89 c7                	mov    %eax,%edi
+801018bf:	b8 01 00 00 00       	mov    $0x1,%eax
+801018c4:	83 e1 07             	and    $0x7,%ecx
+801018c7:	c1 fa 03             	sar    $0x3,%edx
+  log_write(bp);
+801018ca:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+801018cd:	d3 e0                	shl    %cl,%eax
+801018cf:	08 04 16             	or     %al,(%esi,%edx,1)
+  log_write(bp);
+801018d2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801018d5:	56                   	push   %esi
+801018d6:	e8 55 40 00 00       	call   80105930 <log_write>
+  acquire(&bsum.lock);
+801018db:	c7 04 24 e0 13 11 80 	movl   $0x801113e0,(%esp)
+801018e2:	e8 89 62 00 00       	call   80107b70 <acquire>
+  bsum.nfree[bb]--;
+801018e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801018ea:	83 2c 85 e4 13 11 80 	subl   $0x1,-0x7feeec1c(,%eax,4)
+801018f1:	01 
+  bsum.cursor = bb;
+801018f2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801018f5:	a3 88 1f 11 80       	mov    %eax,0x80111f88
+  release(&bsum.lock);
+801018fa:	c7 04 24 e0 13 11 80 	movl   $0x801113e0,(%esp)
+80101901:	e8 0a 62 00 00       	call   80107b10 <release>
+  brelse(bp);
+80101906:	89 34 24             	mov    %esi,(%esp)
+80101909:	e8 52 ec ff ff       	call   80100560 <brelse>
+  bzero(dev, base + bi);
+8010190e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  bp = bread(dev, bno);
+80101911:	58                   	pop    %eax
+80101912:	5a                   	pop    %edx
+  bzero(dev, base + bi);
+80101913:	01 fb                	add    %edi,%ebx
+  bp = bread(dev, bno);
+80101915:	53                   	push   %ebx
+80101916:	ff 75 dc             	push   -0x24(%ebp)
+80101919:	e8 52 eb ff ff       	call   80100470 <bread>
+  memset(bp->data, 0, BSIZE);
+8010191e:	83 c4 0c             	add    $0xc,%esp
+80101921:	68 00 02 00 00       	push   $0x200
+  bp = bread(dev, bno);
+80101926:	89 c6                	mov    %eax,%esi
+  memset(bp->data, 0, BSIZE);
+80101928:	6a 00                	push   $0x0
+8010192a:	ff 70 60             	push   0x60(%eax)
+8010192d:	e8 1e 63 00 00       	call   80107c50 <memset>
+  log_write(bp);
+80101932:	89 34 24             	mov    %esi,(%esp)
+80101935:	e8 f6 3f 00 00       	call   80105930 <log_write>
+  brelse(bp);
+8010193a:	89 34 24             	mov    %esi,(%esp)
+8010193d:	e8 1e ec ff ff       	call   80100560 <brelse>
+}
+80101942:	83 c4 10             	add    $0x10,%esp
+}
+80101945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101948:	89 d8                	mov    %ebx,%eax
+8010194a:	5b                   	pop    %ebx
+8010194b:	5e                   	pop    %esi
+8010194c:	5f                   	pop    %edi
+8010194d:	5d                   	pop    %ebp
+8010194e:	c3                   	ret
+8010194f:	90                   	nop
+  for(i = from/32; i*32 < n; i++){
+80101950:	83 c2 01             	add    $0x1,%edx
+80101953:	83 45 e4 20          	addl   $0x20,-0x1c(%ebp)
+80101957:	89 d0                	mov    %edx,%eax
+80101959:	c1 e0 05             	shl    $0x5,%eax
+8010195c:	39 f8                	cmp    %edi,%eax
+8010195e:	0f 82 06 ff ff ff    	jb     8010186a <ballocin+0x9a>
+    brelse(bp);
+80101964:	83 ec 0c             	sub    $0xc,%esp
+80101967:	ff 75 e0             	push   -0x20(%ebp)
+    return 0;
+8010196a:	31 db                	xor    %ebx,%ebx
+    brelse(bp);
+8010196c:	e8 ef eb ff ff       	call   80100560 <brelse>
+    return 0;
+80101971:	83 c4 10             	add    $0x10,%esp
+}
+80101974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101977:	89 d8                	mov    %ebx,%eax
+80101979:	5b                   	pop    %ebx
+8010197a:	5e                   	pop    %esi
+8010197b:	5f                   	pop    %edi
+8010197c:	5d                   	pop    %ebp
+8010197d:	c3                   	ret
+8010197e:	66 90                	xchg   %ax,%ax
+    bsum.nfree[bb] = bcount((uint*)bp->data, n);
+80101980:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  free = 0;
+80101983:	31 d2                	xor    %edx,%edx
+    bsum.nfree[bb] = bcount((uint*)bp->data, n);
+80101985:	8b 70 60             	mov    0x60(%eax),%esi
+  for(i = 0; i < n; i += 32){
+80101988:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010198b:	39 c3                	cmp    %eax,%ebx
+8010198d:	74 48                	je     801019d7 <ballocin+0x207>
+      x &= (1U << (n - i)) - 1;
+8010198f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i += 32){
+80101992:	31 db                	xor    %ebx,%ebx
+80101994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    x = ~w[i/32];
+80101998:	89 d8                	mov    %ebx,%eax
+    if(n - i < 32)
+8010199a:	89 f9                	mov    %edi,%ecx
+    x = ~w[i/32];
+8010199c:	c1 e8 05             	shr    $0x5,%eax
+    if(n - i < 32)
+8010199f:	29 d9                	sub    %ebx,%ecx
+    x = ~w[i/32];
+801019a1:	8b 04 86             	mov    (%esi,%eax,4),%eax
+    if(n - i < 32)
+801019a4:	83 f9 1f             	cmp    $0x1f,%ecx
+801019a7:	77 09                	ja     801019b2 <ballocin+0x1e2>
+      x &= (1U << (n - i)) - 1;
+801019a9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+801019ae:	d3 e2                	shl    %cl,%edx
+801019b0:	09 d0                	or     %edx,%eax
+801019b2:	f7 d0                	not    %eax
+    for(; x; x &= x - 1)
+801019b4:	85 c0                	test   %eax,%eax
+801019b6:	74 15                	je     801019cd <ballocin+0x1fd>
+801019b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801019bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801019bf:	90                   	nop
+801019c0:	8d 48 ff             	lea    -0x1(%eax),%ecx
+      free++;
+801019c3:	83 c2 01             	add    $0x1,%edx
+    for(; x; x &= x - 1)
+801019c6:	21 c8                	and    %ecx,%eax
+801019c8:	75 f6                	jne    801019c0 <ballocin+0x1f0>
+801019ca:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i += 32){
+801019cd:	83 c3 20             	add    $0x20,%ebx
+801019d0:	39 fb                	cmp    %edi,%ebx
+801019d2:	72 c4                	jb     80101998 <ballocin+0x1c8>
+801019d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    bsum.nfree[bb] = bcount((uint*)bp->data, n);
+801019d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801019da:	89 14 85 e4 13 11 80 	mov    %edx,-0x7feeec1c(,%eax,4)
+801019e1:	e9 53 fe ff ff       	jmp    80101839 <ballocin+0x69>
+801019e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801019ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801019f0 <balloc>:
+{
+801019f0:	55                   	push   %ebp
+801019f1:	89 e5                	mov    %esp,%ebp
+801019f3:	57                   	push   %edi
+801019f4:	56                   	push   %esi
+801019f5:	53                   	push   %ebx
+801019f6:	83 ec 1c             	sub    $0x1c,%esp
+801019f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  nbmap = (sb.size + BPB - 1) / BPB;
+801019fc:	a1 a0 1f 11 80       	mov    0x80111fa0,%eax
+80101a01:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+80101a07:	c1 ee 0c             	shr    $0xc,%esi
+  if(near != 0 && near + 1 < sb.size){
+80101a0a:	85 d2                	test   %edx,%edx
+80101a0c:	74 07                	je     80101a15 <balloc+0x25>
+80101a0e:	8d 4a 01             	lea    0x1(%edx),%ecx
+80101a11:	39 c1                	cmp    %eax,%ecx
+80101a13:	72 41                	jb     80101a56 <balloc+0x66>
+  start = bsum.cursor;
+80101a15:	8b 1d 88 1f 11 80    	mov    0x80111f88,%ebx
+  for(bb = 0; bb < nbmap; bb++){
+80101a1b:	85 f6                	test   %esi,%esi
+80101a1d:	74 4b                	je     80101a6a <balloc+0x7a>
+80101a1f:	8d 3c 1e             	lea    (%esi,%ebx,1),%edi
+80101a22:	eb 0b                	jmp    80101a2f <balloc+0x3f>
+80101a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101a28:	83 c3 01             	add    $0x1,%ebx
+80101a2b:	39 df                	cmp    %ebx,%edi
+80101a2d:	74 3b                	je     80101a6a <balloc+0x7a>
+    if(bsum.nfree[(start + bb) % nbmap] == 0)
+80101a2f:	89 d8                	mov    %ebx,%eax
+80101a31:	31 d2                	xor    %edx,%edx
+80101a33:	f7 f6                	div    %esi
+80101a35:	8b 04 95 14 14 11 80 	mov    -0x7feeebec(,%edx,4),%eax
+80101a3c:	85 c0                	test   %eax,%eax
+80101a3e:	74 e8                	je     80101a28 <balloc+0x38>
+    if((b = ballocin(dev, (start + bb) % nbmap, 0)) != 0)
+80101a40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101a43:	31 c9                	xor    %ecx,%ecx
+80101a45:	e8 86 fd ff ff       	call   801017d0 <ballocin>
+80101a4a:	85 c0                	test   %eax,%eax
+80101a4c:	74 da                	je     80101a28 <balloc+0x38>
+}
+80101a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a51:	5b                   	pop    %ebx
+80101a52:	5e                   	pop    %esi
+80101a53:	5f                   	pop    %edi
+80101a54:	5d                   	pop    %ebp
+80101a55:	c3                   	ret
+    if((b = ballocin(dev, BBLOCK(near + 1, sb) - sb.bmapstart,
+80101a56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101a59:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+80101a5f:	e8 6c fd ff ff       	call   801017d0 <ballocin>
+80101a64:	85 c0                	test   %eax,%eax
+80101a66:	74 ad                	je     80101a15 <balloc+0x25>
+80101a68:	eb e4                	jmp    80101a4e <balloc+0x5e>
+  panic("balloc: out of blocks");
+80101a6a:	83 ec 0c             	sub    $0xc,%esp
+80101a6d:	68 4f ae 10 80       	push   $0x8010ae4f
+80101a72:	e8 b9 ec ff ff       	call   80100730 <panic>
+80101a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a7e:	66 90                	xchg   %ax,%ax
+
+80101a80 <iget>:
+{
+80101a80:	55                   	push   %ebp
+80101a81:	89 e5                	mov    %esp,%ebp
+80101a83:	57                   	push   %edi
+80101a84:	56                   	push   %esi
+80101a85:	89 c6                	mov    %eax,%esi
+80101a87:	53                   	push   %ebx
+  bk = &icache.bucket[IHASH(dev, inum)];
+80101a88:	89 c3                	mov    %eax,%ebx
+80101a8a:	b8 11 08 04 02       	mov    $0x2040811,%eax
+80101a8f:	c1 e3 1b             	shl    $0x1b,%ebx
+80101a92:	09 d3                	or     %edx,%ebx
+{
+80101a94:	83 ec 28             	sub    $0x28,%esp
+  bk = &icache.bucket[IHASH(dev, inum)];
+80101a97:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101a9a:	f7 e3                	mul    %ebx
+80101a9c:	89 d8                	mov    %ebx,%eax
+80101a9e:	29 d0                	sub    %edx,%eax
+80101aa0:	d1 e8                	shr    %eax
+80101aa2:	01 c2                	add    %eax,%edx
+80101aa4:	89 d7                	mov    %edx,%edi
+80101aa6:	c1 ef 06             	shr    $0x6,%edi
+80101aa9:	89 f8                	mov    %edi,%eax
+80101aab:	c1 e0 07             	shl    $0x7,%eax
+80101aae:	29 f8                	sub    %edi,%eax
+80101ab0:	89 df                	mov    %ebx,%edi
+80101ab2:	29 c7                	sub    %eax,%edi
+  acquire(&bk->lock);
+80101ab4:	6b df 3c             	imul   $0x3c,%edi,%ebx
+80101ab7:	8d 83 10 f6 10 80    	lea    -0x7fef09f0(%ebx),%eax
+80101abd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101ac0:	50                   	push   %eax
+80101ac1:	e8 aa 60 00 00       	call   80107b70 <acquire>
+  for(ip = bk->inode; ip; ip = ip->next){
+80101ac6:	8b 9b 44 f6 10 80    	mov    -0x7fef09bc(%ebx),%ebx
+80101acc:	83 c4 10             	add    $0x10,%esp
+80101acf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101ad2:	85 db                	test   %ebx,%ebx
+80101ad4:	75 14                	jne    80101aea <iget+0x6a>
+80101ad6:	eb 68                	jmp    80101b40 <iget+0xc0>
+80101ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101adf:	90                   	nop
+80101ae0:	8b 9b a0 00 00 00    	mov    0xa0(%ebx),%ebx
+80101ae6:	85 db                	test   %ebx,%ebx
+80101ae8:	74 56                	je     80101b40 <iget+0xc0>
+    if(ip->dev == dev && ip->inum == inum){
+80101aea:	39 33                	cmp    %esi,(%ebx)
+80101aec:	75 f2                	jne    80101ae0 <iget+0x60>
+80101aee:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+80101af1:	75 ed                	jne    80101ae0 <iget+0x60>
+      if(ip->ref++ == 0)
+80101af3:	8b 43 08             	mov    0x8(%ebx),%eax
+80101af6:	8d 48 01             	lea    0x1(%eax),%ecx
+80101af9:	89 4b 08             	mov    %ecx,0x8(%ebx)
+80101afc:	85 c0                	test   %eax,%eax
+80101afe:	75 0a                	jne    80101b0a <iget+0x8a>
+        bk->nidle--;
+80101b00:	6b c7 3c             	imul   $0x3c,%edi,%eax
+80101b03:	83 a8 48 f6 10 80 01 	subl   $0x1,-0x7fef09b8(%eax)
+  if(ip->prev)
+80101b0a:	8b 83 a4 00 00 00    	mov    0xa4(%ebx),%eax
+    ip->prev->next = ip->next;
+80101b10:	8b 8b a0 00 00 00    	mov    0xa0(%ebx),%ecx
+  if(ip->prev)
+80101b16:	85 c0                	test   %eax,%eax
+80101b18:	0f 84 95 00 00 00    	je     80101bb3 <iget+0x133>
+    ip->prev->next = ip->next;
+80101b1e:	89 88 a0 00 00 00    	mov    %ecx,0xa0(%eax)
+  if(ip->next)
+80101b24:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80101b2a:	85 c0                	test   %eax,%eax
+80101b2c:	74 41                	je     80101b6f <iget+0xef>
+    ip->next->prev = ip->prev;
+80101b2e:	8b 8b a4 00 00 00    	mov    0xa4(%ebx),%ecx
+80101b34:	89 88 a4 00 00 00    	mov    %ecx,0xa4(%eax)
+  ip->prev = 0;
+80101b3a:	eb 33                	jmp    80101b6f <iget+0xef>
+80101b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if((ip = slaballoc(&icache.cache)) == 0)
+80101b40:	83 ec 0c             	sub    $0xc,%esp
+80101b43:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80101b46:	68 a0 f3 10 80       	push   $0x8010f3a0
+80101b4b:	e8 b0 59 00 00       	call   80107500 <slaballoc>
+80101b50:	83 c4 10             	add    $0x10,%esp
+80101b53:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101b56:	85 c0                	test   %eax,%eax
+80101b58:	89 c3                	mov    %eax,%ebx
+80101b5a:	74 65                	je     80101bc1 <iget+0x141>
+  ip->dev = dev;
+80101b5c:	89 30                	mov    %esi,(%eax)
+  ip->inum = inum;
+80101b5e:	89 48 04             	mov    %ecx,0x4(%eax)
+  ip->ref = 1;
+80101b61:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  ip->valid = 0;
+80101b68:	c7 40 4c 00 00 00 00 	movl   $0x0,0x4c(%eax)
+  ip->prev = 0;
+80101b6f:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+80101b76:	00 00 00 
+  ip->next = bk->inode;
+80101b79:	6b c7 3c             	imul   $0x3c,%edi,%eax
+80101b7c:	8b 80 44 f6 10 80    	mov    -0x7fef09bc(%eax),%eax
+80101b82:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+  if(bk->inode)
+80101b88:	85 c0                	test   %eax,%eax
+80101b8a:	74 06                	je     80101b92 <iget+0x112>
+    bk->inode->prev = ip;
+80101b8c:	89 98 a4 00 00 00    	mov    %ebx,0xa4(%eax)
+  bk->inode = ip;
+80101b92:	6b d7 3c             	imul   $0x3c,%edi,%edx
+  release(&bk->lock);
+80101b95:	83 ec 0c             	sub    $0xc,%esp
+  bk->inode = ip;
+80101b98:	89 9a 44 f6 10 80    	mov    %ebx,-0x7fef09bc(%edx)
+  release(&bk->lock);
+80101b9e:	ff 75 e4             	push   -0x1c(%ebp)
+80101ba1:	e8 6a 5f 00 00       	call   80107b10 <release>
+  return ip;
+80101ba6:	83 c4 10             	add    $0x10,%esp
+}
+80101ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101bac:	89 d8                	mov    %ebx,%eax
+80101bae:	5b                   	pop    %ebx
+80101baf:	5e                   	pop    %esi
+80101bb0:	5f                   	pop    %edi
+80101bb1:	5d                   	pop    %ebp
+80101bb2:	c3                   	ret
+    bk->inode = ip->next;
+80101bb3:	6b c7 3c             	imul   $0x3c,%edi,%eax
+80101bb6:	89 88 44 f6 10 80    	mov    %ecx,-0x7fef09bc(%eax)
+80101bbc:	e9 63 ff ff ff       	jmp    80101b24 <iget+0xa4>
+    panic("iget: no inodes");
+80101bc1:	83 ec 0c             	sub    $0xc,%esp
+80101bc4:	68 65 ae 10 80       	push   $0x8010ae65
+80101bc9:	e8 62 eb ff ff       	call   80100730 <panic>
+80101bce:	66 90                	xchg   %ax,%ax
+
+80101bd0 <emap>:
+{
+80101bd0:	55                   	push   %ebp
+80101bd1:	89 e5                	mov    %esp,%ebp
+80101bd3:	57                   	push   %edi
+  e = (struct extent*)ip->addrs;
+80101bd4:	8d 78 6c             	lea    0x6c(%eax),%edi
+{
+80101bd7:	56                   	push   %esi
+80101bd8:	89 d6                	mov    %edx,%esi
+80101bda:	53                   	push   %ebx
+  lo = 0;
+80101bdb:	31 db                	xor    %ebx,%ebx
+{
+80101bdd:	83 ec 2c             	sub    $0x2c,%esp
+80101be0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101be3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  hi = n;
+80101be6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  while(lo < hi){
+80101beb:	39 d9                	cmp    %ebx,%ecx
+80101bed:	7e 19                	jle    80101c08 <emap+0x38>
+    mid = (lo + hi) / 2;
+80101bef:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+80101bf2:	d1 f8                	sar    %eax
+    if(e[mid].end == 0 || e[mid].end > bn)
+80101bf4:	8b 14 c7             	mov    (%edi,%eax,8),%edx
+80101bf7:	83 ea 01             	sub    $0x1,%edx
+80101bfa:	39 f2                	cmp    %esi,%edx
+80101bfc:	0f 82 be 00 00 00    	jb     80101cc0 <emap+0xf0>
+    mid = (lo + hi) / 2;
+80101c02:	89 c1                	mov    %eax,%ecx
+  while(lo < hi){
+80101c04:	39 d9                	cmp    %ebx,%ecx
+80101c06:	7f e7                	jg     80101bef <emap+0x1f>
+  if(i == n){
+80101c08:	83 fb 06             	cmp    $0x6,%ebx
+80101c0b:	0f 84 7f 01 00 00    	je     80101d90 <emap+0x1c0>
+  n = NIEXTENT;
+80101c11:	c7 45 d0 06 00 00 00 	movl   $0x6,-0x30(%ebp)
+  prev = 0;
+80101c18:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  bp = 0;
+80101c1f:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  last = 0;
+80101c26:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  if(i > 0 && e[i-1].end != 0){
+80101c2d:	89 f8                	mov    %edi,%eax
+80101c2f:	85 db                	test   %ebx,%ebx
+80101c31:	0f 85 99 00 00 00    	jne    80101cd0 <emap+0x100>
+  if(i < n && e[i].end != 0){
+80101c37:	8b 08                	mov    (%eax),%ecx
+80101c39:	85 c9                	test   %ecx,%ecx
+80101c3b:	0f 85 df 01 00 00    	jne    80101e20 <emap+0x250>
+  if(!alloc){
+80101c41:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80101c44:	85 c9                	test   %ecx,%ecx
+80101c46:	0f 84 c4 00 00 00    	je     80101d10 <emap+0x140>
+  if(bn != prev)
+80101c4c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101c4f:	39 c6                	cmp    %eax,%esi
+80101c51:	0f 85 a4 02 00 00    	jne    80101efb <emap+0x32b>
+  addr = balloc(ip->dev, last ? last->pend - 1 : ip->lastblock);
+80101c57:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101c5a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101c5d:	8b 00                	mov    (%eax),%eax
+80101c5f:	85 d2                	test   %edx,%edx
+80101c61:	0f 84 f9 01 00 00    	je     80101e60 <emap+0x290>
+80101c67:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80101c6a:	8b 51 04             	mov    0x4(%ecx),%edx
+80101c6d:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80101c70:	83 ea 01             	sub    $0x1,%edx
+80101c73:	e8 78 fd ff ff       	call   801019f0 <balloc>
+  if(last && last->pend == addr){
+80101c78:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  addr = balloc(ip->dev, last ? last->pend - 1 : ip->lastblock);
+80101c7b:	89 c2                	mov    %eax,%edx
+  ip->lastblock = addr;
+80101c7d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101c80:	89 50 50             	mov    %edx,0x50(%eax)
+  if(last && last->pend == addr){
+80101c83:	39 51 04             	cmp    %edx,0x4(%ecx)
+80101c86:	0f 84 f4 01 00 00    	je     80101e80 <emap+0x2b0>
+    if(i == n && bp == 0){
+80101c8c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101c8f:	39 c3                	cmp    %eax,%ebx
+80101c91:	0f 85 49 01 00 00    	jne    80101de0 <emap+0x210>
+80101c97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101c9a:	85 c0                	test   %eax,%eax
+80101c9c:	0f 84 86 00 00 00    	je     80101d28 <emap+0x158>
+    if(i == n){
+80101ca2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101ca5:	39 c3                	cmp    %eax,%ebx
+80101ca7:	0f 85 33 01 00 00    	jne    80101de0 <emap+0x210>
+      bfree(ip->dev, addr);
+80101cad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101cb0:	8b 00                	mov    (%eax),%eax
+80101cb2:	e8 69 fa ff ff       	call   80101720 <bfree>
+      addr = 0;
+80101cb7:	31 d2                	xor    %edx,%edx
+      goto out;
+80101cb9:	eb 57                	jmp    80101d12 <emap+0x142>
+80101cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101cbf:	90                   	nop
+      lo = mid + 1;
+80101cc0:	8d 58 01             	lea    0x1(%eax),%ebx
+80101cc3:	e9 23 ff ff ff       	jmp    80101beb <emap+0x1b>
+80101cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101ccf:	90                   	nop
+  if(i > 0 && e[i-1].end != 0){
+80101cd0:	8d 04 dd f8 ff ff ff 	lea    -0x8(,%ebx,8),%eax
+80101cd7:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+80101cda:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if(i < n && e[i].end != 0){
+80101cdd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  if(i > 0 && e[i-1].end != 0){
+80101ce0:	8b 11                	mov    (%ecx),%edx
+80101ce2:	85 d2                	test   %edx,%edx
+80101ce4:	0f 84 1e 01 00 00    	je     80101e08 <emap+0x238>
+  if(i < n && e[i].end != 0){
+80101cea:	39 c3                	cmp    %eax,%ebx
+80101cec:	0f 8d f3 01 00 00    	jge    80101ee5 <emap+0x315>
+80101cf2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  if(i > 0 && e[i-1].end != 0){
+80101cf5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80101cf8:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  if(i < n && e[i].end != 0){
+80101cfb:	8d 44 07 08          	lea    0x8(%edi,%eax,1),%eax
+80101cff:	8b 08                	mov    (%eax),%ecx
+80101d01:	85 c9                	test   %ecx,%ecx
+80101d03:	0f 84 38 ff ff ff    	je     80101c41 <emap+0x71>
+80101d09:	e9 12 01 00 00       	jmp    80101e20 <emap+0x250>
+80101d0e:	66 90                	xchg   %ax,%ax
+    addr = 0;
+80101d10:	31 d2                	xor    %edx,%edx
+  if(bp)
+80101d12:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101d15:	85 db                	test   %ebx,%ebx
+80101d17:	75 58                	jne    80101d71 <emap+0x1a1>
+}
+80101d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d1c:	89 d0                	mov    %edx,%eax
+80101d1e:	5b                   	pop    %ebx
+80101d1f:	5e                   	pop    %esi
+80101d20:	5f                   	pop    %edi
+80101d21:	5d                   	pop    %ebp
+80101d22:	c3                   	ret
+80101d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101d27:	90                   	nop
+      ip->addrs[EXTBLOCK] = balloc(ip->dev, addr);
+80101d28:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101d2b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    e[i].end = bn + 1;
+80101d2e:	83 c6 01             	add    $0x1,%esi
+      ip->addrs[EXTBLOCK] = balloc(ip->dev, addr);
+80101d31:	8b 07                	mov    (%edi),%eax
+80101d33:	e8 b8 fc ff ff       	call   801019f0 <balloc>
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101d38:	83 ec 08             	sub    $0x8,%esp
+      ip->addrs[EXTBLOCK] = balloc(ip->dev, addr);
+80101d3b:	89 87 9c 00 00 00    	mov    %eax,0x9c(%edi)
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101d41:	50                   	push   %eax
+80101d42:	ff 37                	push   (%edi)
+80101d44:	e8 27 e7 ff ff       	call   80100470 <bread>
+    e[i].pend = addr + 1;
+80101d49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101d4c:	83 c4 10             	add    $0x10,%esp
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101d4f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      e = (struct extent*)bp->data;
+80101d52:	8b 40 60             	mov    0x60(%eax),%eax
+    e[i].pend = addr + 1;
+80101d55:	8d 4a 01             	lea    0x1(%edx),%ecx
+    e[i].end = bn + 1;
+80101d58:	89 30                	mov    %esi,(%eax)
+    e[i].pend = addr + 1;
+80101d5a:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(bp)
+80101d5d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    log_write(bp);
+80101d60:	83 ec 0c             	sub    $0xc,%esp
+80101d63:	ff 75 e0             	push   -0x20(%ebp)
+80101d66:	e8 c5 3b 00 00       	call   80105930 <log_write>
+  if(bp)
+80101d6b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    log_write(bp);
+80101d6e:	83 c4 10             	add    $0x10,%esp
+80101d71:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    brelse(bp);
+80101d74:	83 ec 0c             	sub    $0xc,%esp
+80101d77:	ff 75 e0             	push   -0x20(%ebp)
+80101d7a:	e8 e1 e7 ff ff       	call   80100560 <brelse>
+80101d7f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101d82:	83 c4 10             	add    $0x10,%esp
+}
+80101d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d88:	5b                   	pop    %ebx
+80101d89:	5e                   	pop    %esi
+80101d8a:	89 d0                	mov    %edx,%eax
+80101d8c:	5f                   	pop    %edi
+80101d8d:	5d                   	pop    %ebp
+80101d8e:	c3                   	ret
+80101d8f:	90                   	nop
+    last = &e[n-1];
+80101d90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101d93:	8d 88 94 00 00 00    	lea    0x94(%eax),%ecx
+    if(ip->addrs[EXTBLOCK] != 0){
+80101d99:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+    last = &e[n-1];
+80101d9f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+    prev = last->end;
+80101da2:	8b 88 94 00 00 00    	mov    0x94(%eax),%ecx
+80101da8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    if(ip->addrs[EXTBLOCK] != 0){
+80101dab:	85 d2                	test   %edx,%edx
+80101dad:	0f 85 e5 00 00 00    	jne    80101e98 <emap+0x2c8>
+  if(i > 0 && e[i-1].end != 0){
+80101db3:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80101db6:	85 c9                	test   %ecx,%ecx
+80101db8:	75 76                	jne    80101e30 <emap+0x260>
+  if(!alloc){
+80101dba:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101dbd:	85 c0                	test   %eax,%eax
+80101dbf:	0f 84 54 ff ff ff    	je     80101d19 <emap+0x149>
+  n = NIEXTENT;
+80101dc5:	c7 45 d0 06 00 00 00 	movl   $0x6,-0x30(%ebp)
+  bp = 0;
+80101dcc:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+80101dd3:	e9 74 fe ff ff       	jmp    80101c4c <emap+0x7c>
+80101dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101ddf:	90                   	nop
+    e[i].end = bn + 1;
+80101de0:	8d 04 df             	lea    (%edi,%ebx,8),%eax
+80101de3:	83 c6 01             	add    $0x1,%esi
+    e[i].pend = addr + 1;
+80101de6:	8d 4a 01             	lea    0x1(%edx),%ecx
+    e[i].end = bn + 1;
+80101de9:	89 30                	mov    %esi,(%eax)
+    e[i].pend = addr + 1;
+80101deb:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(bp)
+80101dee:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101df1:	85 f6                	test   %esi,%esi
+80101df3:	0f 85 64 ff ff ff    	jne    80101d5d <emap+0x18d>
+}
+80101df9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101dfc:	89 d0                	mov    %edx,%eax
+80101dfe:	5b                   	pop    %ebx
+80101dff:	5e                   	pop    %esi
+80101e00:	5f                   	pop    %edi
+80101e01:	5d                   	pop    %ebp
+80101e02:	c3                   	ret
+80101e03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101e07:	90                   	nop
+  if(i < n && e[i].end != 0){
+80101e08:	39 c3                	cmp    %eax,%ebx
+80101e0a:	0f 8d 31 fe ff ff    	jge    80101c41 <emap+0x71>
+80101e10:	8d 04 df             	lea    (%edi,%ebx,8),%eax
+80101e13:	e9 1f fe ff ff       	jmp    80101c37 <emap+0x67>
+80101e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101e1f:	90                   	nop
+    addr = e[i].pend - (e[i].end - bn);
+80101e20:	03 70 04             	add    0x4(%eax),%esi
+80101e23:	89 f2                	mov    %esi,%edx
+80101e25:	29 ca                	sub    %ecx,%edx
+    goto out;
+80101e27:	e9 e6 fe ff ff       	jmp    80101d12 <emap+0x142>
+80101e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(!alloc){
+80101e30:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101e33:	85 c0                	test   %eax,%eax
+80101e35:	0f 84 de fe ff ff    	je     80101d19 <emap+0x149>
+  n = NIEXTENT;
+80101e3b:	c7 45 d0 06 00 00 00 	movl   $0x6,-0x30(%ebp)
+  bp = 0;
+80101e42:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  if(bn != prev)
+80101e49:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101e4c:	39 c6                	cmp    %eax,%esi
+80101e4e:	0f 85 a7 00 00 00    	jne    80101efb <emap+0x32b>
+80101e54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101e57:	8b 00                	mov    (%eax),%eax
+80101e59:	e9 09 fe ff ff       	jmp    80101c67 <emap+0x97>
+80101e5e:	66 90                	xchg   %ax,%ax
+  addr = balloc(ip->dev, last ? last->pend - 1 : ip->lastblock);
+80101e60:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101e63:	8b 51 50             	mov    0x50(%ecx),%edx
+80101e66:	e8 85 fb ff ff       	call   801019f0 <balloc>
+  ip->lastblock = addr;
+80101e6b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  addr = balloc(ip->dev, last ? last->pend - 1 : ip->lastblock);
+80101e6e:	89 c2                	mov    %eax,%edx
+  ip->lastblock = addr;
+80101e70:	89 41 50             	mov    %eax,0x50(%ecx)
+  if(last && last->pend == addr){
+80101e73:	e9 14 fe ff ff       	jmp    80101c8c <emap+0xbc>
+80101e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101e7f:	90                   	nop
+    last->end++;
+80101e80:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    last->pend++;
+80101e83:	8d 42 01             	lea    0x1(%edx),%eax
+    last->end++;
+80101e86:	83 06 01             	addl   $0x1,(%esi)
+    last->pend++;
+80101e89:	89 46 04             	mov    %eax,0x4(%esi)
+80101e8c:	e9 5d ff ff ff       	jmp    80101dee <emap+0x21e>
+80101e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101e98:	83 ec 08             	sub    $0x8,%esp
+  lo = 0;
+80101e9b:	31 db                	xor    %ebx,%ebx
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101e9d:	52                   	push   %edx
+80101e9e:	ff 30                	push   (%eax)
+80101ea0:	e8 cb e5 ff ff       	call   80100470 <bread>
+  while(lo < hi){
+80101ea5:	83 c4 10             	add    $0x10,%esp
+  hi = n;
+80101ea8:	b9 40 00 00 00       	mov    $0x40,%ecx
+      bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80101ead:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      e = (struct extent*)bp->data;
+80101eb0:	8b 78 60             	mov    0x60(%eax),%edi
+  while(lo < hi){
+80101eb3:	39 d9                	cmp    %ebx,%ecx
+80101eb5:	7e 15                	jle    80101ecc <emap+0x2fc>
+    mid = (lo + hi) / 2;
+80101eb7:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+80101eba:	d1 f8                	sar    %eax
+    if(e[mid].end == 0 || e[mid].end > bn)
+80101ebc:	8b 14 c7             	mov    (%edi,%eax,8),%edx
+80101ebf:	83 ea 01             	sub    $0x1,%edx
+80101ec2:	39 f2                	cmp    %esi,%edx
+80101ec4:	72 1a                	jb     80101ee0 <emap+0x310>
+    mid = (lo + hi) / 2;
+80101ec6:	89 c1                	mov    %eax,%ecx
+  while(lo < hi){
+80101ec8:	39 d9                	cmp    %ebx,%ecx
+80101eca:	7f eb                	jg     80101eb7 <emap+0x2e7>
+      n = NBEXTENT;
+80101ecc:	c7 45 d0 40 00 00 00 	movl   $0x40,-0x30(%ebp)
+80101ed3:	e9 55 fd ff ff       	jmp    80101c2d <emap+0x5d>
+80101ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101edf:	90                   	nop
+      lo = mid + 1;
+80101ee0:	8d 58 01             	lea    0x1(%eax),%ebx
+80101ee3:	eb ce                	jmp    80101eb3 <emap+0x2e3>
+  if(!alloc){
+80101ee5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101ee8:	85 c0                	test   %eax,%eax
+80101eea:	0f 84 20 fe ff ff    	je     80101d10 <emap+0x140>
+  if(i > 0 && e[i-1].end != 0){
+80101ef0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80101ef3:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80101ef6:	e9 4e ff ff ff       	jmp    80101e49 <emap+0x279>
+    panic("emap: hole");
+80101efb:	83 ec 0c             	sub    $0xc,%esp
+80101efe:	68 75 ae 10 80       	push   $0x8010ae75
+80101f03:	e8 28 e8 ff ff       	call   80100730 <panic>
+80101f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101f0f:	90                   	nop
+
+80101f10 <bmap>:
+{
+80101f10:	55                   	push   %ebp
+80101f11:	89 e5                	mov    %esp,%ebp
+80101f13:	57                   	push   %edi
+80101f14:	56                   	push   %esi
+80101f15:	89 ce                	mov    %ecx,%esi
+80101f17:	53                   	push   %ebx
+80101f18:	89 c3                	mov    %eax,%ebx
+80101f1a:	83 ec 1c             	sub    $0x1c,%esp
+  if(ip->flags & I_EXTENT)
+80101f1d:	f6 40 5e 01          	testb  $0x1,0x5e(%eax)
+80101f21:	0f 85 f9 00 00 00    	jne    80102020 <bmap+0x110>
+  if(bn < NDIRECT){
+80101f27:	83 fa 09             	cmp    $0x9,%edx
+80101f2a:	0f 86 c0 00 00 00    	jbe    80101ff0 <bmap+0xe0>
+  bn -= NDIRECT;
+80101f30:	8d 7a f6             	lea    -0xa(%edx),%edi
+  if(bn < NINDIRECT){
+80101f33:	83 ff 7f             	cmp    $0x7f,%edi
+80101f36:	77 28                	ja     80101f60 <bmap+0x50>
+    if((addr = ip->addrs[NDIRECT]) == 0 && alloc)
+80101f38:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+80101f3e:	85 c0                	test   %eax,%eax
+80101f40:	0f 85 b2 01 00 00    	jne    801020f8 <bmap+0x1e8>
+80101f46:	85 c9                	test   %ecx,%ecx
+80101f48:	0f 85 52 01 00 00    	jne    801020a0 <bmap+0x190>
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+80101f4e:	31 c0                	xor    %eax,%eax
+}
+80101f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101f53:	5b                   	pop    %ebx
+80101f54:	5e                   	pop    %esi
+80101f55:	5f                   	pop    %edi
+80101f56:	5d                   	pop    %ebp
+80101f57:	c3                   	ret
+80101f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101f5f:	90                   	nop
+  bn -= NINDIRECT;
+80101f60:	8d ba 76 ff ff ff    	lea    -0x8a(%edx),%edi
+  if(bn < DINDIRECT){
+80101f66:	81 ff ff 3f 00 00    	cmp    $0x3fff,%edi
+80101f6c:	0f 86 be 00 00 00    	jbe    80102030 <bmap+0x120>
+  bn -= DINDIRECT;
+80101f72:	8d ba 76 bf ff ff    	lea    -0x408a(%edx),%edi
+  if(bn < TINDIRECT){
+80101f78:	81 ff ff ff 1f 00    	cmp    $0x1fffff,%edi
+80101f7e:	0f 87 c6 03 00 00    	ja     8010234a <bmap+0x43a>
+    if((addr = ip->addrs[NDIRECT+2]) == 0 && alloc)
+80101f84:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+80101f8a:	85 c0                	test   %eax,%eax
+80101f8c:	0f 85 be 01 00 00    	jne    80102150 <bmap+0x240>
+80101f92:	85 c9                	test   %ecx,%ecx
+80101f94:	74 b8                	je     80101f4e <bmap+0x3e>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80101f96:	8b 53 50             	mov    0x50(%ebx),%edx
+80101f99:	8b 03                	mov    (%ebx),%eax
+80101f9b:	e8 50 fa ff ff       	call   801019f0 <balloc>
+80101fa0:	89 43 50             	mov    %eax,0x50(%ebx)
+      ip->addrs[NDIRECT+2] = addr = bnext(ip);
+80101fa3:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+    if(addr == 0)
+80101fa9:	85 c0                	test   %eax,%eax
+80101fab:	74 a1                	je     80101f4e <bmap+0x3e>
+    bp = bread(ip->dev, addr);
+80101fad:	83 ec 08             	sub    $0x8,%esp
+80101fb0:	50                   	push   %eax
+80101fb1:	ff 33                	push   (%ebx)
+80101fb3:	e8 b8 e4 ff ff       	call   80100470 <bread>
+    uint outer_index = bn / DINDIRECT;
+80101fb8:	89 fa                	mov    %edi,%edx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+80101fba:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80101fbd:	89 c1                	mov    %eax,%ecx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+80101fbf:	8b 40 60             	mov    0x60(%eax),%eax
+    uint outer_index = bn / DINDIRECT;
+80101fc2:	c1 ea 0e             	shr    $0xe,%edx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+80101fc5:	8d 04 90             	lea    (%eax,%edx,4),%eax
+80101fc8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101fcb:	8b 00                	mov    (%eax),%eax
+80101fcd:	85 c0                	test   %eax,%eax
+80101fcf:	0f 84 ae 01 00 00    	je     80102183 <bmap+0x273>
+    brelse(bp);
+80101fd5:	83 ec 0c             	sub    $0xc,%esp
+80101fd8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101fdb:	51                   	push   %ecx
+80101fdc:	e8 7f e5 ff ff       	call   80100560 <brelse>
+    bp = bread(ip->dev, addr);
+80101fe1:	58                   	pop    %eax
+80101fe2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101fe5:	5a                   	pop    %edx
+80101fe6:	e9 db 01 00 00       	jmp    801021c6 <bmap+0x2b6>
+80101feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101fef:	90                   	nop
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+80101ff0:	8d 7a 18             	lea    0x18(%edx),%edi
+80101ff3:	8b 44 b8 0c          	mov    0xc(%eax,%edi,4),%eax
+80101ff7:	85 c0                	test   %eax,%eax
+80101ff9:	0f 85 51 ff ff ff    	jne    80101f50 <bmap+0x40>
+80101fff:	85 c9                	test   %ecx,%ecx
+80102001:	0f 84 47 ff ff ff    	je     80101f4e <bmap+0x3e>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102007:	8b 53 50             	mov    0x50(%ebx),%edx
+8010200a:	8b 03                	mov    (%ebx),%eax
+8010200c:	e8 df f9 ff ff       	call   801019f0 <balloc>
+80102011:	89 43 50             	mov    %eax,0x50(%ebx)
+      ip->addrs[bn] = addr = bnext(ip);
+80102014:	89 44 bb 0c          	mov    %eax,0xc(%ebx,%edi,4)
+80102018:	e9 33 ff ff ff       	jmp    80101f50 <bmap+0x40>
+8010201d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80102020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102023:	5b                   	pop    %ebx
+80102024:	5e                   	pop    %esi
+80102025:	5f                   	pop    %edi
+80102026:	5d                   	pop    %ebp
+    return emap(ip, bn, alloc);
+80102027:	e9 a4 fb ff ff       	jmp    80101bd0 <emap>
+8010202c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[NDIRECT+1]) == 0 && alloc)
+80102030:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+80102036:	85 c0                	test   %eax,%eax
+80102038:	0f 85 2a 02 00 00    	jne    80102268 <bmap+0x358>
+8010203e:	85 c9                	test   %ecx,%ecx
+80102040:	0f 84 08 ff ff ff    	je     80101f4e <bmap+0x3e>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102046:	8b 53 50             	mov    0x50(%ebx),%edx
+80102049:	8b 03                	mov    (%ebx),%eax
+8010204b:	e8 a0 f9 ff ff       	call   801019f0 <balloc>
+80102050:	89 43 50             	mov    %eax,0x50(%ebx)
+      ip->addrs[NDIRECT+1] = addr = bnext(ip);
+80102053:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    if(addr == 0)
+80102059:	85 c0                	test   %eax,%eax
+8010205b:	0f 84 ed fe ff ff    	je     80101f4e <bmap+0x3e>
+    uint inside_blockidx = bn % NINDIRECT;
+80102061:	89 fe                	mov    %edi,%esi
+    bp = bread(ip->dev, addr);
+80102063:	83 ec 08             	sub    $0x8,%esp
+    uint indirect_blockidx = bn / NINDIRECT;
+80102066:	c1 ef 07             	shr    $0x7,%edi
+    uint inside_blockidx = bn % NINDIRECT;
+80102069:	83 e6 7f             	and    $0x7f,%esi
+8010206c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    bp = bread(ip->dev, addr);
+8010206f:	50                   	push   %eax
+80102070:	ff 33                	push   (%ebx)
+80102072:	e8 f9 e3 ff ff       	call   80100470 <bread>
+    if ((addr = a[indirect_blockidx]) == 0 && alloc) {
+80102077:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+8010207a:	89 c1                	mov    %eax,%ecx
+    if ((addr = a[indirect_blockidx]) == 0 && alloc) {
+8010207c:	8b 40 60             	mov    0x60(%eax),%eax
+8010207f:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+80102082:	8b 37                	mov    (%edi),%esi
+80102084:	85 f6                	test   %esi,%esi
+80102086:	0f 84 65 01 00 00    	je     801021f1 <bmap+0x2e1>
+    brelse(bp);
+8010208c:	83 ec 0c             	sub    $0xc,%esp
+8010208f:	51                   	push   %ecx
+80102090:	e8 cb e4 ff ff       	call   80100560 <brelse>
+    bp = bread(ip->dev, addr);
+80102095:	59                   	pop    %ecx
+80102096:	5f                   	pop    %edi
+80102097:	e9 8e 01 00 00       	jmp    8010222a <bmap+0x31a>
+8010209c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+801020a0:	8b 53 50             	mov    0x50(%ebx),%edx
+801020a3:	8b 03                	mov    (%ebx),%eax
+801020a5:	e8 46 f9 ff ff       	call   801019f0 <balloc>
+801020aa:	89 43 50             	mov    %eax,0x50(%ebx)
+      ip->addrs[NDIRECT] = addr = bnext(ip);
+801020ad:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+    if(addr == 0)
+801020b3:	85 c0                	test   %eax,%eax
+801020b5:	0f 84 93 fe ff ff    	je     80101f4e <bmap+0x3e>
+    bp = bread(ip->dev, addr);
+801020bb:	83 ec 08             	sub    $0x8,%esp
+801020be:	50                   	push   %eax
+801020bf:	ff 33                	push   (%ebx)
+801020c1:	e8 aa e3 ff ff       	call   80100470 <bread>
+    if((addr = a[bn]) == 0 && alloc){
+801020c6:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+801020c9:	89 c1                	mov    %eax,%ecx
+    if((addr = a[bn]) == 0 && alloc){
+801020cb:	8b 40 60             	mov    0x60(%eax),%eax
+801020ce:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+801020d1:	8b 07                	mov    (%edi),%eax
+801020d3:	85 c0                	test   %eax,%eax
+801020d5:	74 49                	je     80102120 <bmap+0x210>
+    brelse(bp);
+801020d7:	83 ec 0c             	sub    $0xc,%esp
+801020da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801020dd:	51                   	push   %ecx
+801020de:	e8 7d e4 ff ff       	call   80100560 <brelse>
+    return addr;
+801020e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801020e6:	83 c4 10             	add    $0x10,%esp
+}
+801020e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801020ec:	5b                   	pop    %ebx
+801020ed:	5e                   	pop    %esi
+801020ee:	5f                   	pop    %edi
+801020ef:	5d                   	pop    %ebp
+801020f0:	c3                   	ret
+801020f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, addr);
+801020f8:	83 ec 08             	sub    $0x8,%esp
+801020fb:	50                   	push   %eax
+801020fc:	ff 33                	push   (%ebx)
+801020fe:	e8 6d e3 ff ff       	call   80100470 <bread>
+    if((addr = a[bn]) == 0 && alloc){
+80102103:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80102106:	89 c1                	mov    %eax,%ecx
+    if((addr = a[bn]) == 0 && alloc){
+80102108:	8b 40 60             	mov    0x60(%eax),%eax
+8010210b:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+8010210e:	8b 07                	mov    (%edi),%eax
+80102110:	85 c0                	test   %eax,%eax
+80102112:	75 c3                	jne    801020d7 <bmap+0x1c7>
+80102114:	85 f6                	test   %esi,%esi
+80102116:	74 bf                	je     801020d7 <bmap+0x1c7>
+80102118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010211f:	90                   	nop
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102120:	8b 53 50             	mov    0x50(%ebx),%edx
+80102123:	8b 03                	mov    (%ebx),%eax
+80102125:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102128:	e8 c3 f8 ff ff       	call   801019f0 <balloc>
+      log_write(bp);
+8010212d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102130:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102133:	89 43 50             	mov    %eax,0x50(%ebx)
+      a[bn] = addr = bnext(ip);
+80102136:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102139:	89 07                	mov    %eax,(%edi)
+      log_write(bp);
+8010213b:	51                   	push   %ecx
+8010213c:	e8 ef 37 00 00       	call   80105930 <log_write>
+80102141:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102144:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102147:	83 c4 10             	add    $0x10,%esp
+8010214a:	eb 8b                	jmp    801020d7 <bmap+0x1c7>
+8010214c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, addr);
+80102150:	83 ec 08             	sub    $0x8,%esp
+80102153:	50                   	push   %eax
+80102154:	ff 33                	push   (%ebx)
+80102156:	e8 15 e3 ff ff       	call   80100470 <bread>
+    uint outer_index = bn / DINDIRECT;
+8010215b:	89 fa                	mov    %edi,%edx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+8010215d:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80102160:	89 c1                	mov    %eax,%ecx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+80102162:	8b 40 60             	mov    0x60(%eax),%eax
+    uint outer_index = bn / DINDIRECT;
+80102165:	c1 ea 0e             	shr    $0xe,%edx
+    if ((addr = a[outer_index]) == 0 && alloc) {
+80102168:	8d 04 90             	lea    (%eax,%edx,4),%eax
+8010216b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010216e:	8b 00                	mov    (%eax),%eax
+80102170:	85 c0                	test   %eax,%eax
+80102172:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102175:	0f 85 35 01 00 00    	jne    801022b0 <bmap+0x3a0>
+8010217b:	85 f6                	test   %esi,%esi
+8010217d:	0f 84 17 01 00 00    	je     8010229a <bmap+0x38a>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102183:	8b 53 50             	mov    0x50(%ebx),%edx
+80102186:	8b 03                	mov    (%ebx),%eax
+80102188:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+8010218b:	e8 60 f8 ff ff       	call   801019f0 <balloc>
+      a[outer_index] = addr = bnext(ip);
+80102190:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      log_write(bp);
+80102193:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102196:	89 43 50             	mov    %eax,0x50(%ebx)
+      a[outer_index] = addr = bnext(ip);
+80102199:	89 01                	mov    %eax,(%ecx)
+      log_write(bp);
+8010219b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      a[outer_index] = addr = bnext(ip);
+8010219e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      log_write(bp);
+801021a1:	51                   	push   %ecx
+801021a2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801021a5:	e8 86 37 00 00       	call   80105930 <log_write>
+    brelse(bp);
+801021aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801021ad:	89 0c 24             	mov    %ecx,(%esp)
+801021b0:	e8 ab e3 ff ff       	call   80100560 <brelse>
+    if(addr == 0)
+801021b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801021b8:	83 c4 10             	add    $0x10,%esp
+801021bb:	85 c0                	test   %eax,%eax
+801021bd:	0f 84 8b fd ff ff    	je     80101f4e <bmap+0x3e>
+    bp = bread(ip->dev, addr);
+801021c3:	83 ec 08             	sub    $0x8,%esp
+801021c6:	50                   	push   %eax
+801021c7:	ff 33                	push   (%ebx)
+801021c9:	e8 a2 e2 ff ff       	call   80100470 <bread>
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801021ce:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+801021d1:	89 c1                	mov    %eax,%ecx
+    uint inner_offset = outer_offset % NINDIRECT;
+801021d3:	89 f8                	mov    %edi,%eax
+    uint inner_index = outer_offset / NINDIRECT;
+801021d5:	c1 ef 05             	shr    $0x5,%edi
+    uint inner_offset = outer_offset % NINDIRECT;
+801021d8:	83 e0 7f             	and    $0x7f,%eax
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801021db:	81 e7 fc 01 00 00    	and    $0x1fc,%edi
+    uint inner_offset = outer_offset % NINDIRECT;
+801021e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801021e4:	03 79 60             	add    0x60(%ecx),%edi
+801021e7:	8b 07                	mov    (%edi),%eax
+801021e9:	85 c0                	test   %eax,%eax
+801021eb:	0f 85 f4 00 00 00    	jne    801022e5 <bmap+0x3d5>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+801021f1:	8b 53 50             	mov    0x50(%ebx),%edx
+801021f4:	8b 03                	mov    (%ebx),%eax
+801021f6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801021f9:	e8 f2 f7 ff ff       	call   801019f0 <balloc>
+      log_write(bp);
+801021fe:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102201:	89 43 50             	mov    %eax,0x50(%ebx)
+80102204:	89 c6                	mov    %eax,%esi
+      a[inner_index] = addr = bnext(ip);
+80102206:	89 07                	mov    %eax,(%edi)
+      log_write(bp);
+80102208:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010220b:	51                   	push   %ecx
+8010220c:	e8 1f 37 00 00       	call   80105930 <log_write>
+    brelse(bp);
+80102211:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102214:	89 0c 24             	mov    %ecx,(%esp)
+80102217:	e8 44 e3 ff ff       	call   80100560 <brelse>
+    if(addr == 0)
+8010221c:	83 c4 10             	add    $0x10,%esp
+8010221f:	85 f6                	test   %esi,%esi
+80102221:	0f 84 27 fd ff ff    	je     80101f4e <bmap+0x3e>
+    bp = bread(ip->dev, addr);
+80102227:	83 ec 08             	sub    $0x8,%esp
+    bp = bread(ip->dev, addr);
+8010222a:	56                   	push   %esi
+8010222b:	ff 33                	push   (%ebx)
+8010222d:	e8 3e e2 ff ff       	call   80100470 <bread>
+    if ((addr = a[inside_blockidx]) == 0 && alloc) {
+80102232:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80102235:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80102238:	89 c7                	mov    %eax,%edi
+    if ((addr = a[inside_blockidx]) == 0 && alloc) {
+8010223a:	8b 40 60             	mov    0x60(%eax),%eax
+8010223d:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+80102240:	8b 01                	mov    (%ecx),%eax
+80102242:	85 c0                	test   %eax,%eax
+80102244:	0f 84 d4 00 00 00    	je     8010231e <bmap+0x40e>
+    brelse(bp);
+8010224a:	83 ec 0c             	sub    $0xc,%esp
+8010224d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102250:	57                   	push   %edi
+80102251:	e8 0a e3 ff ff       	call   80100560 <brelse>
+    return addr;
+80102256:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102259:	83 c4 10             	add    $0x10,%esp
+8010225c:	e9 ef fc ff ff       	jmp    80101f50 <bmap+0x40>
+80102261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    uint inside_blockidx = bn % NINDIRECT;
+80102268:	89 f9                	mov    %edi,%ecx
+    bp = bread(ip->dev, addr);
+8010226a:	83 ec 08             	sub    $0x8,%esp
+    uint indirect_blockidx = bn / NINDIRECT;
+8010226d:	c1 ef 07             	shr    $0x7,%edi
+    uint inside_blockidx = bn % NINDIRECT;
+80102270:	83 e1 7f             	and    $0x7f,%ecx
+80102273:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    bp = bread(ip->dev, addr);
+80102276:	50                   	push   %eax
+80102277:	ff 33                	push   (%ebx)
+80102279:	e8 f2 e1 ff ff       	call   80100470 <bread>
+    if ((addr = a[indirect_blockidx]) == 0 && alloc) {
+8010227e:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80102281:	89 c1                	mov    %eax,%ecx
+    if ((addr = a[indirect_blockidx]) == 0 && alloc) {
+80102283:	8b 40 60             	mov    0x60(%eax),%eax
+80102286:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+80102289:	8b 07                	mov    (%edi),%eax
+8010228b:	85 c0                	test   %eax,%eax
+8010228d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102290:	75 56                	jne    801022e8 <bmap+0x3d8>
+    if ((addr = a[inner_index]) == 0 && alloc) {
+80102292:	85 f6                	test   %esi,%esi
+80102294:	0f 85 57 ff ff ff    	jne    801021f1 <bmap+0x2e1>
+    brelse(bp);
+8010229a:	83 ec 0c             	sub    $0xc,%esp
+8010229d:	51                   	push   %ecx
+8010229e:	e8 bd e2 ff ff       	call   80100560 <brelse>
+801022a3:	83 c4 10             	add    $0x10,%esp
+801022a6:	e9 a3 fc ff ff       	jmp    80101f4e <bmap+0x3e>
+801022ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801022af:	90                   	nop
+    brelse(bp);
+801022b0:	83 ec 0c             	sub    $0xc,%esp
+801022b3:	51                   	push   %ecx
+801022b4:	e8 a7 e2 ff ff       	call   80100560 <brelse>
+    bp = bread(ip->dev, addr);
+801022b9:	59                   	pop    %ecx
+801022ba:	58                   	pop    %eax
+801022bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801022be:	50                   	push   %eax
+801022bf:	ff 33                	push   (%ebx)
+801022c1:	e8 aa e1 ff ff       	call   80100470 <bread>
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801022c6:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+801022c9:	89 c1                	mov    %eax,%ecx
+    uint inner_offset = outer_offset % NINDIRECT;
+801022cb:	89 f8                	mov    %edi,%eax
+    uint inner_index = outer_offset / NINDIRECT;
+801022cd:	c1 ef 05             	shr    $0x5,%edi
+    uint inner_offset = outer_offset % NINDIRECT;
+801022d0:	83 e0 7f             	and    $0x7f,%eax
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801022d3:	81 e7 fc 01 00 00    	and    $0x1fc,%edi
+801022d9:	03 79 60             	add    0x60(%ecx),%edi
+    uint inner_offset = outer_offset % NINDIRECT;
+801022dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if ((addr = a[inner_index]) == 0 && alloc) {
+801022df:	8b 07                	mov    (%edi),%eax
+801022e1:	85 c0                	test   %eax,%eax
+801022e3:	74 ad                	je     80102292 <bmap+0x382>
+801022e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    brelse(bp);
+801022e8:	83 ec 0c             	sub    $0xc,%esp
+801022eb:	51                   	push   %ecx
+801022ec:	e8 6f e2 ff ff       	call   80100560 <brelse>
+    bp = bread(ip->dev, addr);
+801022f1:	58                   	pop    %eax
+801022f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801022f5:	5a                   	pop    %edx
+801022f6:	50                   	push   %eax
+801022f7:	ff 33                	push   (%ebx)
+801022f9:	e8 72 e1 ff ff       	call   80100470 <bread>
+    if ((addr = a[inner_offset]) == 0 && alloc) {
+801022fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102301:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80102304:	89 c7                	mov    %eax,%edi
+    if ((addr = a[inner_offset]) == 0 && alloc) {
+80102306:	8b 40 60             	mov    0x60(%eax),%eax
+80102309:	8d 0c 88             	lea    (%eax,%ecx,4),%ecx
+8010230c:	8b 01                	mov    (%ecx),%eax
+8010230e:	85 c0                	test   %eax,%eax
+80102310:	0f 85 34 ff ff ff    	jne    8010224a <bmap+0x33a>
+80102316:	85 f6                	test   %esi,%esi
+80102318:	0f 84 2c ff ff ff    	je     8010224a <bmap+0x33a>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+8010231e:	8b 53 50             	mov    0x50(%ebx),%edx
+80102321:	8b 03                	mov    (%ebx),%eax
+80102323:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102326:	e8 c5 f6 ff ff       	call   801019f0 <balloc>
+      a[inner_offset] = addr = bnext(ip);
+8010232b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      log_write(bp);
+8010232e:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+80102331:	89 43 50             	mov    %eax,0x50(%ebx)
+      a[inner_offset] = addr = bnext(ip);
+80102334:	89 01                	mov    %eax,(%ecx)
+80102336:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      log_write(bp);
+80102339:	57                   	push   %edi
+8010233a:	e8 f1 35 00 00       	call   80105930 <log_write>
+8010233f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102342:	83 c4 10             	add    $0x10,%esp
+80102345:	e9 00 ff ff ff       	jmp    8010224a <bmap+0x33a>
+  panic("bmap: out of range");
+8010234a:	83 ec 0c             	sub    $0xc,%esp
+8010234d:	68 80 ae 10 80       	push   $0x8010ae80
+80102352:	e8 d9 e3 ff ff       	call   80100730 <panic>
+80102357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010235e:	66 90                	xchg   %ax,%ax
+
+80102360 <readi.part.0>:
+
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+80102360:	55                   	push   %ebp
+80102361:	89 e5                	mov    %esp,%ebp
+80102363:	57                   	push   %edi
+80102364:	56                   	push   %esi
+80102365:	53                   	push   %ebx
+80102366:	83 ec 1c             	sub    $0x1c,%esp
+80102369:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+8010236c:	8b 50 68             	mov    0x68(%eax),%edx
+8010236f:	39 ca                	cmp    %ecx,%edx
+80102371:	0f 82 a2 01 00 00    	jb     80102519 <readi.part.0+0x1b9>
+80102377:	31 db                	xor    %ebx,%ebx
+80102379:	89 ce                	mov    %ecx,%esi
+8010237b:	03 4d 08             	add    0x8(%ebp),%ecx
+8010237e:	0f 92 c3             	setb   %bl
+80102381:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80102384:	0f 82 8f 01 00 00    	jb     80102519 <readi.part.0+0x1b9>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+8010238a:	89 d3                	mov    %edx,%ebx
+8010238c:	29 f3                	sub    %esi,%ebx
+8010238e:	39 ca                	cmp    %ecx,%edx
+80102390:	0f 43 5d 08          	cmovae 0x8(%ebp),%ebx
+80102394:	89 5d 08             	mov    %ebx,0x8(%ebp)
+
+  if(ip->flags & I_INLINE){
+80102397:	f6 40 5e 04          	testb  $0x4,0x5e(%eax)
+8010239b:	0f 85 5f 01 00 00    	jne    80102500 <readi.part.0+0x1a0>
+
+  // A read that starts where the last one ended is sequential.
+  // Queue its blocks and the next readahead ones without waiting,
+  // so that the disk merges them and the blocks are cached by
+  // the time they are asked for.
+  if(off != ip->ranext)
+801023a1:	3b 70 54             	cmp    0x54(%eax),%esi
+801023a4:	0f 84 c6 00 00 00    	je     80102470 <readi.part.0+0x110>
+    ip->rahead = 0;
+801023aa:	c7 40 58 00 00 00 00 	movl   $0x0,0x58(%eax)
+    for(bn = max(off/BSIZE, ip->rahead); bn < end; bn++)
+      if((addr = bmap(ip, bn, 0)) != 0)
+        breadahead(ip->dev, addr);
+    ip->rahead = max(end, ip->rahead);
+  }
+  ip->ranext = off + n;
+801023b1:	8b 55 08             	mov    0x8(%ebp),%edx
+801023b4:	01 f2                	add    %esi,%edx
+801023b6:	89 50 54             	mov    %edx,0x54(%eax)
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801023b9:	8b 55 08             	mov    0x8(%ebp),%edx
+801023bc:	85 d2                	test   %edx,%edx
+801023be:	0f 84 9b 00 00 00    	je     8010245f <readi.part.0+0xff>
+801023c4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801023c7:	eb 46                	jmp    8010240f <readi.part.0+0xaf>
+801023c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+      // A hole, e.g. in a hashed directory's table.
+      memset(dst, 0, m);
+      continue;
+    }
+    bp = bread(ip->dev, addr);
+801023d0:	83 ec 08             	sub    $0x8,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801023d3:	01 de                	add    %ebx,%esi
+    bp = bread(ip->dev, addr);
+801023d5:	50                   	push   %eax
+801023d6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801023d9:	ff 30                	push   (%eax)
+801023db:	e8 90 e0 ff ff       	call   80100470 <bread>
+    memmove(dst, bp->data + off%BSIZE, m);
+801023e0:	83 c4 0c             	add    $0xc,%esp
+801023e3:	53                   	push   %ebx
+801023e4:	03 78 60             	add    0x60(%eax),%edi
+801023e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801023ea:	57                   	push   %edi
+801023eb:	ff 75 e0             	push   -0x20(%ebp)
+801023ee:	e8 ed 58 00 00       	call   80107ce0 <memmove>
+    brelse(bp);
+801023f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+801023f6:	89 14 24             	mov    %edx,(%esp)
+801023f9:	e8 62 e1 ff ff       	call   80100560 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801023fe:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+    brelse(bp);
+80102401:	83 c4 10             	add    $0x10,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102404:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102407:	01 5d e0             	add    %ebx,-0x20(%ebp)
+8010240a:	3b 45 08             	cmp    0x8(%ebp),%eax
+8010240d:	73 50                	jae    8010245f <readi.part.0+0xff>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010240f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102412:	8b 45 08             	mov    0x8(%ebp),%eax
+80102415:	89 f7                	mov    %esi,%edi
+80102417:	bb 00 02 00 00       	mov    $0x200,%ebx
+8010241c:	81 e7 ff 01 00 00    	and    $0x1ff,%edi
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+80102422:	89 f2                	mov    %esi,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102424:	29 c8                	sub    %ecx,%eax
+80102426:	29 fb                	sub    %edi,%ebx
+80102428:	39 c3                	cmp    %eax,%ebx
+8010242a:	0f 47 d8             	cmova  %eax,%ebx
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+8010242d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102430:	c1 ea 09             	shr    $0x9,%edx
+80102433:	31 c9                	xor    %ecx,%ecx
+80102435:	e8 d6 fa ff ff       	call   80101f10 <bmap>
+8010243a:	85 c0                	test   %eax,%eax
+8010243c:	75 92                	jne    801023d0 <readi.part.0+0x70>
+      memset(dst, 0, m);
+8010243e:	83 ec 04             	sub    $0x4,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102441:	01 de                	add    %ebx,%esi
+      memset(dst, 0, m);
+80102443:	53                   	push   %ebx
+80102444:	6a 00                	push   $0x0
+80102446:	ff 75 e0             	push   -0x20(%ebp)
+80102449:	e8 02 58 00 00       	call   80107c50 <memset>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010244e:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+      continue;
+80102451:	83 c4 10             	add    $0x10,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102454:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102457:	01 5d e0             	add    %ebx,-0x20(%ebp)
+8010245a:	3b 45 08             	cmp    0x8(%ebp),%eax
+8010245d:	72 b0                	jb     8010240f <readi.part.0+0xaf>
+    return n;
+8010245f:	8b 45 08             	mov    0x8(%ebp),%eax
+  }
+  return n;
+}
+80102462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102465:	5b                   	pop    %ebx
+80102466:	5e                   	pop    %esi
+80102467:	5f                   	pop    %edi
+80102468:	5d                   	pop    %ebp
+80102469:	c3                   	ret
+8010246a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  else if(readahead > 0){
+80102470:	8b 1d 00 c0 10 80    	mov    0x8010c000,%ebx
+80102476:	85 db                	test   %ebx,%ebx
+80102478:	0f 8e 33 ff ff ff    	jle    801023b1 <readi.part.0+0x51>
+    end = (off + n + BSIZE - 1)/BSIZE + readahead;
+8010247e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    if(end > (ip->size + BSIZE - 1)/BSIZE)
+80102481:	81 c2 ff 01 00 00    	add    $0x1ff,%edx
+80102487:	c1 ea 09             	shr    $0x9,%edx
+    end = (off + n + BSIZE - 1)/BSIZE + readahead;
+8010248a:	8d 8c 3e ff 01 00 00 	lea    0x1ff(%esi,%edi,1),%ecx
+80102491:	89 d7                	mov    %edx,%edi
+80102493:	c1 e9 09             	shr    $0x9,%ecx
+80102496:	01 d9                	add    %ebx,%ecx
+    for(bn = max(off/BSIZE, ip->rahead); bn < end; bn++)
+80102498:	89 f3                	mov    %esi,%ebx
+8010249a:	39 d1                	cmp    %edx,%ecx
+8010249c:	8b 50 58             	mov    0x58(%eax),%edx
+8010249f:	0f 46 f9             	cmovbe %ecx,%edi
+801024a2:	c1 eb 09             	shr    $0x9,%ebx
+801024a5:	39 d3                	cmp    %edx,%ebx
+801024a7:	0f 42 da             	cmovb  %edx,%ebx
+801024aa:	39 fb                	cmp    %edi,%ebx
+801024ac:	73 45                	jae    801024f3 <readi.part.0+0x193>
+801024ae:	89 75 dc             	mov    %esi,-0x24(%ebp)
+801024b1:	89 de                	mov    %ebx,%esi
+801024b3:	89 c3                	mov    %eax,%ebx
+801024b5:	eb 10                	jmp    801024c7 <readi.part.0+0x167>
+801024b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801024be:	66 90                	xchg   %ax,%ax
+801024c0:	83 c6 01             	add    $0x1,%esi
+801024c3:	39 f7                	cmp    %esi,%edi
+801024c5:	74 24                	je     801024eb <readi.part.0+0x18b>
+      if((addr = bmap(ip, bn, 0)) != 0)
+801024c7:	31 c9                	xor    %ecx,%ecx
+801024c9:	89 f2                	mov    %esi,%edx
+801024cb:	89 d8                	mov    %ebx,%eax
+801024cd:	e8 3e fa ff ff       	call   80101f10 <bmap>
+801024d2:	85 c0                	test   %eax,%eax
+801024d4:	74 ea                	je     801024c0 <readi.part.0+0x160>
+        breadahead(ip->dev, addr);
+801024d6:	83 ec 08             	sub    $0x8,%esp
+    for(bn = max(off/BSIZE, ip->rahead); bn < end; bn++)
+801024d9:	83 c6 01             	add    $0x1,%esi
+        breadahead(ip->dev, addr);
+801024dc:	50                   	push   %eax
+801024dd:	ff 33                	push   (%ebx)
+801024df:	e8 0c e1 ff ff       	call   801005f0 <breadahead>
+801024e4:	83 c4 10             	add    $0x10,%esp
+    for(bn = max(off/BSIZE, ip->rahead); bn < end; bn++)
+801024e7:	39 f7                	cmp    %esi,%edi
+801024e9:	75 dc                	jne    801024c7 <readi.part.0+0x167>
+    ip->rahead = max(end, ip->rahead);
+801024eb:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801024ee:	8b 53 58             	mov    0x58(%ebx),%edx
+801024f1:	89 d8                	mov    %ebx,%eax
+801024f3:	39 d7                	cmp    %edx,%edi
+801024f5:	0f 42 fa             	cmovb  %edx,%edi
+801024f8:	89 78 58             	mov    %edi,0x58(%eax)
+801024fb:	e9 b1 fe ff ff       	jmp    801023b1 <readi.part.0+0x51>
+    memmove(dst, (char*)ip->addrs + off, n);
+80102500:	83 ec 04             	sub    $0x4,%esp
+80102503:	8d 44 30 6c          	lea    0x6c(%eax,%esi,1),%eax
+80102507:	53                   	push   %ebx
+80102508:	50                   	push   %eax
+80102509:	ff 75 e0             	push   -0x20(%ebp)
+8010250c:	e8 cf 57 00 00       	call   80107ce0 <memmove>
+    return n;
+80102511:	83 c4 10             	add    $0x10,%esp
+80102514:	e9 46 ff ff ff       	jmp    8010245f <readi.part.0+0xff>
+      return -1;
+80102519:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010251e:	e9 3f ff ff ff       	jmp    80102462 <readi.part.0+0x102>
+80102523:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010252a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102530 <readsb>:
+{
+80102530:	55                   	push   %ebp
+80102531:	89 e5                	mov    %esp,%ebp
+80102533:	56                   	push   %esi
+80102534:	53                   	push   %ebx
+80102535:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80102538:	83 ec 08             	sub    $0x8,%esp
+8010253b:	6a 01                	push   $0x1
+8010253d:	ff 75 08             	push   0x8(%ebp)
+80102540:	e8 2b df ff ff       	call   80100470 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102545:	83 c4 0c             	add    $0xc,%esp
+80102548:	6a 20                	push   $0x20
+  bp = bread(dev, 1);
+8010254a:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010254c:	ff 70 60             	push   0x60(%eax)
+8010254f:	56                   	push   %esi
+80102550:	e8 8b 57 00 00       	call   80107ce0 <memmove>
+  brelse(bp);
+80102555:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102558:	83 c4 10             	add    $0x10,%esp
+}
+8010255b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010255e:	5b                   	pop    %ebx
+8010255f:	5e                   	pop    %esi
+80102560:	5d                   	pop    %ebp
+  brelse(bp);
+80102561:	e9 fa df ff ff       	jmp    80100560 <brelse>
+80102566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010256d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102570 <icacheinit>:
+{
+80102570:	55                   	push   %ebp
+80102571:	89 e5                	mov    %esp,%ebp
+80102573:	53                   	push   %ebx
+80102574:	bb 10 f6 10 80       	mov    $0x8010f610,%ebx
+80102579:	83 ec 04             	sub    $0x4,%esp
+8010257c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+80102580:	83 ec 08             	sub    $0x8,%esp
+80102583:	68 93 ae 10 80       	push   $0x8010ae93
+80102588:	53                   	push   %ebx
+  for(i = 0; i < NIBUCKET; i++)
+80102589:	83 c3 3c             	add    $0x3c,%ebx
+    initlock(&icache.bucket[i].lock, "icache.bucket");
+8010258c:	e8 ff 53 00 00       	call   80107990 <initlock>
+  for(i = 0; i < NIBUCKET; i++)
+80102591:	83 c4 10             	add    $0x10,%esp
+80102594:	81 fb d4 13 11 80    	cmp    $0x801113d4,%ebx
+8010259a:	75 e4                	jne    80102580 <icacheinit+0x10>
+8010259c:	bb c0 1f 11 80       	mov    $0x80111fc0,%ebx
+801025a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+dcacheinit(void)
+{
+  int i;
+
+  for(i = 0; i < NDCSET; i++)
+    initlock(&dcache[i].lock, "dcache");
+801025a8:	83 ec 08             	sub    $0x8,%esp
+801025ab:	68 a1 ae 10 80       	push   $0x8010aea1
+801025b0:	53                   	push   %ebx
+  for(i = 0; i < NDCSET; i++)
+801025b1:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+    initlock(&dcache[i].lock, "dcache");
+801025b7:	e8 d4 53 00 00       	call   80107990 <initlock>
+  for(i = 0; i < NDCSET; i++)
+801025bc:	83 c4 10             	add    $0x10,%esp
+801025bf:	81 fb c0 79 11 80    	cmp    $0x801179c0,%ebx
+801025c5:	75 e1                	jne    801025a8 <icacheinit+0x38>
+  slabinit(&icache.cache, "inode", sizeof(struct inode), inodector);
+801025c7:	68 70 15 10 80       	push   $0x80101570
+801025cc:	68 a8 00 00 00       	push   $0xa8
+801025d1:	68 36 ae 10 80       	push   $0x8010ae36
+801025d6:	68 a0 f3 10 80       	push   $0x8010f3a0
+801025db:	e8 b0 4e 00 00       	call   80107490 <slabinit>
+}
+801025e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801025e3:	83 c4 10             	add    $0x10,%esp
+801025e6:	c9                   	leave
+801025e7:	c3                   	ret
+801025e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025ef:	90                   	nop
+
+801025f0 <iinit>:
+{
+801025f0:	55                   	push   %ebp
+801025f1:	89 e5                	mov    %esp,%ebp
+801025f3:	53                   	push   %ebx
+801025f4:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+801025f7:	6a 01                	push   $0x1
+801025f9:	ff 75 08             	push   0x8(%ebp)
+801025fc:	e8 6f de ff ff       	call   80100470 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102601:	83 c4 0c             	add    $0xc,%esp
+80102604:	6a 20                	push   $0x20
+  bp = bread(dev, 1);
+80102606:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80102608:	ff 70 60             	push   0x60(%eax)
+8010260b:	68 a0 1f 11 80       	push   $0x80111fa0
+80102610:	e8 cb 56 00 00       	call   80107ce0 <memmove>
+  brelse(bp);
+80102615:	89 1c 24             	mov    %ebx,(%esp)
+80102618:	e8 43 df ff ff       	call   80100560 <brelse>
+  if(sb.bsize != BSIZE)
+8010261d:	83 c4 10             	add    $0x10,%esp
+80102620:	81 3d bc 1f 11 80 00 	cmpl   $0x200,0x80111fbc
+80102627:	02 00 00 
+8010262a:	75 75                	jne    801026a1 <iinit+0xb1>
+  if(sb.size > FSSIZE)
+8010262c:	81 3d a0 1f 11 80 c0 	cmpl   $0x2dc6c0,0x80111fa0
+80102633:	c6 2d 00 
+80102636:	77 76                	ja     801026ae <iinit+0xbe>
+  initlock(&bsum.lock, "bsum");
+80102638:	83 ec 08             	sub    $0x8,%esp
+8010263b:	68 db ae 10 80       	push   $0x8010aedb
+80102640:	68 e0 13 11 80       	push   $0x801113e0
+80102645:	e8 46 53 00 00       	call   80107990 <initlock>
+8010264a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NBMAP; i++)
+8010264d:	31 c0                	xor    %eax,%eax
+8010264f:	90                   	nop
+    bsum.nfree[i] = -1;
+80102650:	c7 04 85 14 14 11 80 	movl   $0xffffffff,-0x7feeebec(,%eax,4)
+80102657:	ff ff ff ff 
+  for(i = 0; i < NBMAP; i++)
+8010265b:	83 c0 01             	add    $0x1,%eax
+8010265e:	3d dd 02 00 00       	cmp    $0x2dd,%eax
+80102663:	75 eb                	jne    80102650 <iinit+0x60>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102665:	ff 35 b8 1f 11 80    	push   0x80111fb8
+8010266b:	ff 35 b4 1f 11 80    	push   0x80111fb4
+80102671:	ff 35 b0 1f 11 80    	push   0x80111fb0
+80102677:	ff 35 ac 1f 11 80    	push   0x80111fac
+8010267d:	ff 35 a8 1f 11 80    	push   0x80111fa8
+80102683:	ff 35 a4 1f 11 80    	push   0x80111fa4
+80102689:	ff 35 a0 1f 11 80    	push   0x80111fa0
+8010268f:	68 58 af 10 80       	push   $0x8010af58
+80102694:	e8 c7 e3 ff ff       	call   80100a60 <cprintf>
+}
+80102699:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010269c:	83 c4 20             	add    $0x20,%esp
+8010269f:	c9                   	leave
+801026a0:	c3                   	ret
+    panic("iinit: wrong block size");
+801026a1:	83 ec 0c             	sub    $0xc,%esp
+801026a4:	68 a8 ae 10 80       	push   $0x8010aea8
+801026a9:	e8 82 e0 ff ff       	call   80100730 <panic>
+    panic("iinit: file system too big");
+801026ae:	83 ec 0c             	sub    $0xc,%esp
+801026b1:	68 c0 ae 10 80       	push   $0x8010aec0
+801026b6:	e8 75 e0 ff ff       	call   80100730 <panic>
+801026bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801026bf:	90                   	nop
+
+801026c0 <ialloc>:
+{
+801026c0:	55                   	push   %ebp
+801026c1:	89 e5                	mov    %esp,%ebp
+801026c3:	57                   	push   %edi
+801026c4:	56                   	push   %esi
+801026c5:	53                   	push   %ebx
+801026c6:	83 ec 1c             	sub    $0x1c,%esp
+801026c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+801026cc:	83 3d a8 1f 11 80 01 	cmpl   $0x1,0x80111fa8
+{
+801026d3:	8b 75 08             	mov    0x8(%ebp),%esi
+801026d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+801026d9:	0f 86 92 00 00 00    	jbe    80102771 <ialloc+0xb1>
+801026df:	bf 01 00 00 00       	mov    $0x1,%edi
+801026e4:	eb 21                	jmp    80102707 <ialloc+0x47>
+801026e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026ed:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+801026f0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+801026f3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+801026f6:	50                   	push   %eax
+801026f7:	e8 64 de ff ff       	call   80100560 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+801026fc:	83 c4 10             	add    $0x10,%esp
+801026ff:	3b 3d a8 1f 11 80    	cmp    0x80111fa8,%edi
+80102705:	73 6a                	jae    80102771 <ialloc+0xb1>
+    bp = bread(dev, IBLOCK(inum, sb));
+80102707:	89 f8                	mov    %edi,%eax
+80102709:	83 ec 08             	sub    $0x8,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+8010270c:	89 fb                	mov    %edi,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010270e:	c1 e8 03             	shr    $0x3,%eax
+80102711:	03 05 b4 1f 11 80    	add    0x80111fb4,%eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102717:	83 e3 07             	and    $0x7,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010271a:	50                   	push   %eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+8010271b:	c1 e3 06             	shl    $0x6,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010271e:	56                   	push   %esi
+8010271f:	e8 4c dd ff ff       	call   80100470 <bread>
+    if(dip->type == 0){  // a free inode
+80102724:	83 c4 10             	add    $0x10,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102727:	03 58 60             	add    0x60(%eax),%ebx
+    if(dip->type == 0){  // a free inode
+8010272a:	80 3b 00             	cmpb   $0x0,(%ebx)
+8010272d:	75 c1                	jne    801026f0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+8010272f:	83 ec 04             	sub    $0x4,%esp
+80102732:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102735:	6a 40                	push   $0x40
+80102737:	6a 00                	push   $0x0
+80102739:	53                   	push   %ebx
+8010273a:	e8 11 55 00 00       	call   80107c50 <memset>
+      dip->type = type;
+8010273f:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+      log_write(bp);   // mark it allocated on the disk
+80102743:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      dip->type = type;
+80102746:	88 03                	mov    %al,(%ebx)
+      log_write(bp);   // mark it allocated on the disk
+80102748:	89 14 24             	mov    %edx,(%esp)
+8010274b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010274e:	e8 dd 31 00 00       	call   80105930 <log_write>
+      brelse(bp);
+80102753:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102756:	89 14 24             	mov    %edx,(%esp)
+80102759:	e8 02 de ff ff       	call   80100560 <brelse>
+      return iget(dev, inum);
+8010275e:	83 c4 10             	add    $0x10,%esp
+}
+80102761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102764:	89 fa                	mov    %edi,%edx
+}
+80102766:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102767:	89 f0                	mov    %esi,%eax
+}
+80102769:	5e                   	pop    %esi
+8010276a:	5f                   	pop    %edi
+8010276b:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010276c:	e9 0f f3 ff ff       	jmp    80101a80 <iget>
+  panic("ialloc: no inodes");
+80102771:	83 ec 0c             	sub    $0xc,%esp
+80102774:	68 e0 ae 10 80       	push   $0x8010aee0
+80102779:	e8 b2 df ff ff       	call   80100730 <panic>
+8010277e:	66 90                	xchg   %ax,%ax
+
+80102780 <iupdate>:
+{
+80102780:	55                   	push   %ebp
+80102781:	89 e5                	mov    %esp,%ebp
+80102783:	56                   	push   %esi
+80102784:	53                   	push   %ebx
+80102785:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102788:	8b 46 04             	mov    0x4(%esi),%eax
+8010278b:	83 ec 08             	sub    $0x8,%esp
+8010278e:	c1 e8 03             	shr    $0x3,%eax
+80102791:	03 05 b4 1f 11 80    	add    0x80111fb4,%eax
+80102797:	50                   	push   %eax
+80102798:	ff 36                	push   (%esi)
+8010279a:	e8 d1 dc ff ff       	call   80100470 <bread>
+  dip->type = ip->type;
+8010279f:	0f b7 56 5c          	movzwl 0x5c(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801027a3:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801027a6:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+801027a8:	8b 46 04             	mov    0x4(%esi),%eax
+801027ab:	83 e0 07             	and    $0x7,%eax
+801027ae:	c1 e0 06             	shl    $0x6,%eax
+801027b1:	03 43 60             	add    0x60(%ebx),%eax
+  dip->type = ip->type;
+801027b4:	88 10                	mov    %dl,(%eax)
+  dip->flags = ip->flags;
+801027b6:	0f b7 56 5e          	movzwl 0x5e(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801027ba:	83 c0 0c             	add    $0xc,%eax
+  dip->flags = ip->flags;
+801027bd:	88 50 f5             	mov    %dl,-0xb(%eax)
+  dip->major = ip->major;
+801027c0:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+801027c4:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+801027c8:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+801027cc:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+801027d0:	0f b7 56 64          	movzwl 0x64(%esi),%edx
+801027d4:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+801027d8:	8b 56 68             	mov    0x68(%esi),%edx
+801027db:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801027de:	8d 56 6c             	lea    0x6c(%esi),%edx
+801027e1:	6a 34                	push   $0x34
+801027e3:	52                   	push   %edx
+801027e4:	50                   	push   %eax
+801027e5:	e8 f6 54 00 00       	call   80107ce0 <memmove>
+  log_write(bp);
+801027ea:	89 1c 24             	mov    %ebx,(%esp)
+801027ed:	e8 3e 31 00 00       	call   80105930 <log_write>
+  brelse(bp);
+801027f2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801027f5:	83 c4 10             	add    $0x10,%esp
+}
+801027f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801027fb:	5b                   	pop    %ebx
+801027fc:	5e                   	pop    %esi
+801027fd:	5d                   	pop    %ebp
+  brelse(bp);
+801027fe:	e9 5d dd ff ff       	jmp    80100560 <brelse>
+80102803:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010280a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102810 <idup>:
+{
+80102810:	55                   	push   %ebp
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+80102811:	b8 11 08 04 02       	mov    $0x2040811,%eax
+{
+80102816:	89 e5                	mov    %esp,%ebp
+80102818:	56                   	push   %esi
+80102819:	53                   	push   %ebx
+8010281a:	8b 75 08             	mov    0x8(%ebp),%esi
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+8010281d:	8b 0e                	mov    (%esi),%ecx
+  acquire(&bk->lock);
+8010281f:	83 ec 0c             	sub    $0xc,%esp
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+80102822:	c1 e1 1b             	shl    $0x1b,%ecx
+80102825:	0b 4e 04             	or     0x4(%esi),%ecx
+80102828:	f7 e1                	mul    %ecx
+8010282a:	89 c8                	mov    %ecx,%eax
+8010282c:	29 d0                	sub    %edx,%eax
+8010282e:	d1 e8                	shr    %eax
+80102830:	01 c2                	add    %eax,%edx
+80102832:	c1 ea 06             	shr    $0x6,%edx
+80102835:	89 d0                	mov    %edx,%eax
+80102837:	c1 e0 07             	shl    $0x7,%eax
+8010283a:	29 d0                	sub    %edx,%eax
+8010283c:	29 c1                	sub    %eax,%ecx
+  acquire(&bk->lock);
+8010283e:	6b d9 3c             	imul   $0x3c,%ecx,%ebx
+80102841:	81 c3 10 f6 10 80    	add    $0x8010f610,%ebx
+80102847:	53                   	push   %ebx
+80102848:	e8 23 53 00 00       	call   80107b70 <acquire>
+  ip->ref++;
+8010284d:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&bk->lock);
+80102851:	89 1c 24             	mov    %ebx,(%esp)
+80102854:	e8 b7 52 00 00       	call   80107b10 <release>
+}
+80102859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010285c:	89 f0                	mov    %esi,%eax
+8010285e:	5b                   	pop    %ebx
+8010285f:	5e                   	pop    %esi
+80102860:	5d                   	pop    %ebp
+80102861:	c3                   	ret
+80102862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102870 <ilock>:
+{
+80102870:	55                   	push   %ebp
+80102871:	89 e5                	mov    %esp,%ebp
+80102873:	56                   	push   %esi
+80102874:	53                   	push   %ebx
+80102875:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102878:	85 db                	test   %ebx,%ebx
+8010287a:	0f 84 d3 00 00 00    	je     80102953 <ilock+0xe3>
+80102880:	8b 53 08             	mov    0x8(%ebx),%edx
+80102883:	85 d2                	test   %edx,%edx
+80102885:	0f 8e c8 00 00 00    	jle    80102953 <ilock+0xe3>
+  acquiresleep(&ip->lock);
+8010288b:	83 ec 0c             	sub    $0xc,%esp
+8010288e:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102891:	50                   	push   %eax
+80102892:	e8 09 50 00 00       	call   801078a0 <acquiresleep>
+  if(ip->valid == 0){
+80102897:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010289a:	83 c4 10             	add    $0x10,%esp
+8010289d:	85 c0                	test   %eax,%eax
+8010289f:	74 0f                	je     801028b0 <ilock+0x40>
+}
+801028a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801028a4:	5b                   	pop    %ebx
+801028a5:	5e                   	pop    %esi
+801028a6:	5d                   	pop    %ebp
+801028a7:	c3                   	ret
+801028a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801028af:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028b0:	8b 43 04             	mov    0x4(%ebx),%eax
+801028b3:	83 ec 08             	sub    $0x8,%esp
+801028b6:	c1 e8 03             	shr    $0x3,%eax
+801028b9:	03 05 b4 1f 11 80    	add    0x80111fb4,%eax
+801028bf:	50                   	push   %eax
+801028c0:	ff 33                	push   (%ebx)
+801028c2:	e8 a9 db ff ff       	call   80100470 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028c7:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028ca:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801028cc:	8b 43 04             	mov    0x4(%ebx),%eax
+801028cf:	83 e0 07             	and    $0x7,%eax
+801028d2:	c1 e0 06             	shl    $0x6,%eax
+801028d5:	03 46 60             	add    0x60(%esi),%eax
+    ip->type = dip->type;
+801028d8:	0f b6 10             	movzbl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028db:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+801028de:	66 89 53 5c          	mov    %dx,0x5c(%ebx)
+    ip->flags = dip->flags;
+801028e2:	0f b6 50 f5          	movzbl -0xb(%eax),%edx
+801028e6:	66 89 53 5e          	mov    %dx,0x5e(%ebx)
+    ip->major = dip->major;
+801028ea:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+801028ee:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->minor = dip->minor;
+801028f2:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+801028f6:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->nlink = dip->nlink;
+801028fa:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+801028fe:	66 89 53 64          	mov    %dx,0x64(%ebx)
+    ip->size = dip->size;
+80102902:	8b 50 fc             	mov    -0x4(%eax),%edx
+80102905:	89 53 68             	mov    %edx,0x68(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102908:	6a 34                	push   $0x34
+8010290a:	50                   	push   %eax
+8010290b:	8d 43 6c             	lea    0x6c(%ebx),%eax
+8010290e:	50                   	push   %eax
+8010290f:	e8 cc 53 00 00       	call   80107ce0 <memmove>
+    brelse(bp);
+80102914:	89 34 24             	mov    %esi,(%esp)
+80102917:	e8 44 dc ff ff       	call   80100560 <brelse>
+    if(ip->type == 0)
+8010291c:	83 c4 10             	add    $0x10,%esp
+8010291f:	66 83 7b 5c 00       	cmpw   $0x0,0x5c(%ebx)
+    ip->lastblock = 0;
+80102924:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+    ip->ranext = 0;
+8010292b:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+    ip->rahead = 0;
+80102932:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+    ip->valid = 1;
+80102939:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+80102940:	0f 85 5b ff ff ff    	jne    801028a1 <ilock+0x31>
+      panic("ilock: no type");
+80102946:	83 ec 0c             	sub    $0xc,%esp
+80102949:	68 f8 ae 10 80       	push   $0x8010aef8
+8010294e:	e8 dd dd ff ff       	call   80100730 <panic>
+    panic("ilock");
+80102953:	83 ec 0c             	sub    $0xc,%esp
+80102956:	68 f2 ae 10 80       	push   $0x8010aef2
+8010295b:	e8 d0 dd ff ff       	call   80100730 <panic>
+
+80102960 <iunlock>:
+{
+80102960:	55                   	push   %ebp
+80102961:	89 e5                	mov    %esp,%ebp
+80102963:	56                   	push   %esi
+80102964:	53                   	push   %ebx
+80102965:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102968:	85 db                	test   %ebx,%ebx
+8010296a:	74 28                	je     80102994 <iunlock+0x34>
+8010296c:	83 ec 0c             	sub    $0xc,%esp
+8010296f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102972:	56                   	push   %esi
+80102973:	e8 c8 4f 00 00       	call   80107940 <holdingsleep>
+80102978:	83 c4 10             	add    $0x10,%esp
+8010297b:	85 c0                	test   %eax,%eax
+8010297d:	74 15                	je     80102994 <iunlock+0x34>
+8010297f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102982:	85 c0                	test   %eax,%eax
+80102984:	7e 0e                	jle    80102994 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102986:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102989:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010298c:	5b                   	pop    %ebx
+8010298d:	5e                   	pop    %esi
+8010298e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+8010298f:	e9 6c 4f 00 00       	jmp    80107900 <releasesleep>
+    panic("iunlock");
+80102994:	83 ec 0c             	sub    $0xc,%esp
+80102997:	68 07 af 10 80       	push   $0x8010af07
+8010299c:	e8 8f dd ff ff       	call   80100730 <panic>
+801029a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029af:	90                   	nop
+
+801029b0 <iput>:
+{
+801029b0:	55                   	push   %ebp
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+801029b1:	b8 11 08 04 02       	mov    $0x2040811,%eax
+{
+801029b6:	89 e5                	mov    %esp,%ebp
+801029b8:	57                   	push   %edi
+801029b9:	56                   	push   %esi
+801029ba:	53                   	push   %ebx
+801029bb:	83 ec 48             	sub    $0x48,%esp
+801029be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+801029c1:	8b 0f                	mov    (%edi),%ecx
+801029c3:	c1 e1 1b             	shl    $0x1b,%ecx
+801029c6:	0b 4f 04             	or     0x4(%edi),%ecx
+801029c9:	f7 e1                	mul    %ecx
+801029cb:	89 c8                	mov    %ecx,%eax
+801029cd:	29 d0                	sub    %edx,%eax
+801029cf:	d1 e8                	shr    %eax
+801029d1:	01 c2                	add    %eax,%edx
+801029d3:	c1 ea 06             	shr    $0x6,%edx
+801029d6:	89 d0                	mov    %edx,%eax
+801029d8:	c1 e0 07             	shl    $0x7,%eax
+801029db:	29 d0                	sub    %edx,%eax
+801029dd:	29 c1                	sub    %eax,%ecx
+  acquiresleep(&ip->lock);
+801029df:	8d 47 0c             	lea    0xc(%edi),%eax
+801029e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+801029e5:	89 cb                	mov    %ecx,%ebx
+  acquiresleep(&ip->lock);
+801029e7:	50                   	push   %eax
+801029e8:	e8 b3 4e 00 00       	call   801078a0 <acquiresleep>
+    acquire(&bk->lock);
+801029ed:	6b c3 3c             	imul   $0x3c,%ebx,%eax
+  if(ip->valid && ip->nlink == 0){
+801029f0:	8b 57 4c             	mov    0x4c(%edi),%edx
+801029f3:	83 c4 10             	add    $0x10,%esp
+    acquire(&bk->lock);
+801029f6:	05 10 f6 10 80       	add    $0x8010f610,%eax
+801029fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if(ip->valid && ip->nlink == 0){
+801029fe:	85 d2                	test   %edx,%edx
+80102a00:	74 0b                	je     80102a0d <iput+0x5d>
+80102a02:	66 83 7f 64 00       	cmpw   $0x0,0x64(%edi)
+80102a07:	0f 84 e9 00 00 00    	je     80102af6 <iput+0x146>
+  releasesleep(&ip->lock);
+80102a0d:	83 ec 0c             	sub    $0xc,%esp
+80102a10:	ff 75 d4             	push   -0x2c(%ebp)
+80102a13:	e8 e8 4e 00 00       	call   80107900 <releasesleep>
+  acquire(&bk->lock);
+80102a18:	58                   	pop    %eax
+80102a19:	ff 75 d8             	push   -0x28(%ebp)
+80102a1c:	e8 4f 51 00 00       	call   80107b70 <acquire>
+  if(--ip->ref == 0){
+80102a21:	8b 47 08             	mov    0x8(%edi),%eax
+80102a24:	83 c4 10             	add    $0x10,%esp
+80102a27:	83 e8 01             	sub    $0x1,%eax
+80102a2a:	89 47 08             	mov    %eax,0x8(%edi)
+80102a2d:	85 c0                	test   %eax,%eax
+80102a2f:	75 48                	jne    80102a79 <iput+0xc9>
+    if(ip->valid){
+80102a31:	8b 77 4c             	mov    0x4c(%edi),%esi
+80102a34:	85 f6                	test   %esi,%esi
+80102a36:	75 53                	jne    80102a8b <iput+0xdb>
+  if(ip->prev)
+80102a38:	8b 97 a4 00 00 00    	mov    0xa4(%edi),%edx
+    ip->prev->next = ip->next;
+80102a3e:	8b 87 a0 00 00 00    	mov    0xa0(%edi),%eax
+  if(ip->prev)
+80102a44:	85 d2                	test   %edx,%edx
+80102a46:	0f 84 9c 00 00 00    	je     80102ae8 <iput+0x138>
+    ip->prev->next = ip->next;
+80102a4c:	89 82 a0 00 00 00    	mov    %eax,0xa0(%edx)
+  if(ip->next)
+80102a52:	8b 87 a0 00 00 00    	mov    0xa0(%edi),%eax
+80102a58:	85 c0                	test   %eax,%eax
+80102a5a:	74 0c                	je     80102a68 <iput+0xb8>
+    ip->next->prev = ip->prev;
+80102a5c:	8b 97 a4 00 00 00    	mov    0xa4(%edi),%edx
+80102a62:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+      slabfree(&icache.cache, victim);
+80102a68:	83 ec 08             	sub    $0x8,%esp
+80102a6b:	57                   	push   %edi
+80102a6c:	68 a0 f3 10 80       	push   $0x8010f3a0
+80102a71:	e8 8a 4c 00 00       	call   80107700 <slabfree>
+80102a76:	83 c4 10             	add    $0x10,%esp
+  release(&bk->lock);
+80102a79:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102a7c:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80102a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102a82:	5b                   	pop    %ebx
+80102a83:	5e                   	pop    %esi
+80102a84:	5f                   	pop    %edi
+80102a85:	5d                   	pop    %ebp
+  release(&bk->lock);
+80102a86:	e9 85 50 00 00       	jmp    80107b10 <release>
+      if(++bk->nidle > IBUCKETIDLE){
+80102a8b:	6b c3 3c             	imul   $0x3c,%ebx,%eax
+80102a8e:	8b 90 48 f6 10 80    	mov    -0x7fef09b8(%eax),%edx
+80102a94:	8d 4a 01             	lea    0x1(%edx),%ecx
+80102a97:	89 88 48 f6 10 80    	mov    %ecx,-0x7fef09b8(%eax)
+80102a9d:	83 f9 08             	cmp    $0x8,%ecx
+80102aa0:	7e d7                	jle    80102a79 <iput+0xc9>
+        for(victim = ip; victim->next; victim = victim->next)
+80102aa2:	89 f8                	mov    %edi,%eax
+80102aa4:	8b bf a0 00 00 00    	mov    0xa0(%edi),%edi
+80102aaa:	85 ff                	test   %edi,%edi
+80102aac:	74 14                	je     80102ac2 <iput+0x112>
+80102aae:	89 f8                	mov    %edi,%eax
+80102ab0:	8b bf a0 00 00 00    	mov    0xa0(%edi),%edi
+80102ab6:	85 ff                	test   %edi,%edi
+80102ab8:	75 e8                	jne    80102aa2 <iput+0xf2>
+80102aba:	eb 06                	jmp    80102ac2 <iput+0x112>
+          victim = victim->prev;
+80102abc:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+        while(victim->ref > 0)
+80102ac2:	8b 48 08             	mov    0x8(%eax),%ecx
+80102ac5:	85 c9                	test   %ecx,%ecx
+80102ac7:	7f f3                	jg     80102abc <iput+0x10c>
+        bk->nidle--;
+80102ac9:	6b cb 3c             	imul   $0x3c,%ebx,%ecx
+80102acc:	89 c7                	mov    %eax,%edi
+80102ace:	89 91 48 f6 10 80    	mov    %edx,-0x7fef09b8(%ecx)
+  if(ip->prev)
+80102ad4:	8b 97 a4 00 00 00    	mov    0xa4(%edi),%edx
+    ip->prev->next = ip->next;
+80102ada:	8b 87 a0 00 00 00    	mov    0xa0(%edi),%eax
+  if(ip->prev)
+80102ae0:	85 d2                	test   %edx,%edx
+80102ae2:	0f 85 64 ff ff ff    	jne    80102a4c <iput+0x9c>
+    bk->inode = ip->next;
+80102ae8:	6b db 3c             	imul   $0x3c,%ebx,%ebx
+80102aeb:	89 83 44 f6 10 80    	mov    %eax,-0x7fef09bc(%ebx)
+80102af1:	e9 5c ff ff ff       	jmp    80102a52 <iput+0xa2>
+    acquire(&bk->lock);
+80102af6:	83 ec 0c             	sub    $0xc,%esp
+80102af9:	50                   	push   %eax
+80102afa:	e8 71 50 00 00       	call   80107b70 <acquire>
+    release(&bk->lock);
+80102aff:	58                   	pop    %eax
+    int r = ip->ref;
+80102b00:	8b 77 08             	mov    0x8(%edi),%esi
+    release(&bk->lock);
+80102b03:	ff 75 d8             	push   -0x28(%ebp)
+80102b06:	e8 05 50 00 00       	call   80107b10 <release>
+    if(r == 1){
+80102b0b:	83 c4 10             	add    $0x10,%esp
+80102b0e:	83 fe 01             	cmp    $0x1,%esi
+80102b11:	0f 85 f6 fe ff ff    	jne    80102a0d <iput+0x5d>
+      if(ip->type == T_DIR)
+80102b17:	66 83 7f 5c 01       	cmpw   $0x1,0x5c(%edi)
+80102b1c:	0f 84 43 03 00 00    	je     80102e65 <iput+0x4b5>
+  if(ip->flags & I_INLINE){
+80102b22:	0f b7 47 5e          	movzwl 0x5e(%edi),%eax
+80102b26:	a8 04                	test   $0x4,%al
+80102b28:	0f 85 0b 03 00 00    	jne    80102e39 <iput+0x489>
+  if(ip->flags & I_EXTENT){
+80102b2e:	8d 77 6c             	lea    0x6c(%edi),%esi
+80102b31:	8d 8f 94 00 00 00    	lea    0x94(%edi),%ecx
+80102b37:	a8 01                	test   $0x1,%al
+80102b39:	0f 85 87 00 00 00    	jne    80102bc6 <iput+0x216>
+80102b3f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80102b42:	89 cb                	mov    %ecx,%ebx
+80102b44:	eb 11                	jmp    80102b57 <iput+0x1a7>
+80102b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  for (i = 0; i < NDIRECT; i++) {
+80102b50:	83 c6 04             	add    $0x4,%esi
+80102b53:	39 de                	cmp    %ebx,%esi
+80102b55:	74 15                	je     80102b6c <iput+0x1bc>
+    if (ip->addrs[i]) {
+80102b57:	8b 16                	mov    (%esi),%edx
+80102b59:	85 d2                	test   %edx,%edx
+80102b5b:	74 f3                	je     80102b50 <iput+0x1a0>
+      bfree(ip->dev, ip->addrs[i]);
+80102b5d:	8b 07                	mov    (%edi),%eax
+80102b5f:	e8 bc eb ff ff       	call   80101720 <bfree>
+      ip->addrs[i] = 0;
+80102b64:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102b6a:	eb e4                	jmp    80102b50 <iput+0x1a0>
+  if (ip->addrs[NDIRECT]) {
+80102b6c:	8b 87 94 00 00 00    	mov    0x94(%edi),%eax
+80102b72:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102b75:	85 c0                	test   %eax,%eax
+80102b77:	0f 85 60 03 00 00    	jne    80102edd <iput+0x52d>
+  if (ip->addrs[NDIRECT + 1]) {
+80102b7d:	8b 87 98 00 00 00    	mov    0x98(%edi),%eax
+80102b83:	85 c0                	test   %eax,%eax
+80102b85:	0f 85 f9 01 00 00    	jne    80102d84 <iput+0x3d4>
+  if (ip->addrs[NDIRECT + 2]) {
+80102b8b:	8b 87 9c 00 00 00    	mov    0x9c(%edi),%eax
+80102b91:	85 c0                	test   %eax,%eax
+80102b93:	75 7d                	jne    80102c12 <iput+0x262>
+  iupdate(ip);
+80102b95:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80102b98:	c7 47 68 00 00 00 00 	movl   $0x0,0x68(%edi)
+  iupdate(ip);
+80102b9f:	57                   	push   %edi
+80102ba0:	e8 db fb ff ff       	call   80102780 <iupdate>
+80102ba5:	83 c4 10             	add    $0x10,%esp
+      iupdate(ip);
+80102ba8:	83 ec 0c             	sub    $0xc,%esp
+      ip->type = 0;
+80102bab:	31 c0                	xor    %eax,%eax
+80102bad:	66 89 47 5c          	mov    %ax,0x5c(%edi)
+      iupdate(ip);
+80102bb1:	57                   	push   %edi
+80102bb2:	e8 c9 fb ff ff       	call   80102780 <iupdate>
+      ip->valid = 0;
+80102bb7:	c7 47 4c 00 00 00 00 	movl   $0x0,0x4c(%edi)
+80102bbe:	83 c4 10             	add    $0x10,%esp
+80102bc1:	e9 47 fe ff ff       	jmp    80102a0d <iput+0x5d>
+  prev = efree(ip->dev, (struct extent*)ip->addrs, NIEXTENT, 0);
+80102bc6:	83 ec 0c             	sub    $0xc,%esp
+80102bc9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80102bcc:	8b 07                	mov    (%edi),%eax
+80102bce:	b9 06 00 00 00       	mov    $0x6,%ecx
+80102bd3:	6a 00                	push   $0x0
+80102bd5:	89 f2                	mov    %esi,%edx
+80102bd7:	e8 b4 e9 ff ff       	call   80101590 <efree>
+  if(ip->addrs[EXTBLOCK]){
+80102bdc:	83 c4 10             	add    $0x10,%esp
+  prev = efree(ip->dev, (struct extent*)ip->addrs, NIEXTENT, 0);
+80102bdf:	89 c1                	mov    %eax,%ecx
+  if(ip->addrs[EXTBLOCK]){
+80102be1:	8b 87 9c 00 00 00    	mov    0x9c(%edi),%eax
+80102be7:	85 c0                	test   %eax,%eax
+80102be9:	0f 85 25 01 00 00    	jne    80102d14 <iput+0x364>
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+80102bef:	83 ec 04             	sub    $0x4,%esp
+80102bf2:	6a 34                	push   $0x34
+80102bf4:	6a 00                	push   $0x0
+80102bf6:	ff 75 e4             	push   -0x1c(%ebp)
+80102bf9:	e8 52 50 00 00       	call   80107c50 <memset>
+    ip->size = 0;
+80102bfe:	c7 47 68 00 00 00 00 	movl   $0x0,0x68(%edi)
+    iupdate(ip);
+80102c05:	89 3c 24             	mov    %edi,(%esp)
+80102c08:	e8 73 fb ff ff       	call   80102780 <iupdate>
+    return;
+80102c0d:	83 c4 10             	add    $0x10,%esp
+80102c10:	eb 96                	jmp    80102ba8 <iput+0x1f8>
+    bp = bread(ip->dev, ip->addrs[NDIRECT + 2]);
+80102c12:	83 ec 08             	sub    $0x8,%esp
+80102c15:	50                   	push   %eax
+80102c16:	ff 37                	push   (%edi)
+80102c18:	e8 53 d8 ff ff       	call   80100470 <bread>
+    for (i = 0; i < NINDIRECT; i++) {
+80102c1d:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80102c20:	83 c4 10             	add    $0x10,%esp
+80102c23:	8b 70 60             	mov    0x60(%eax),%esi
+80102c26:	89 45 c8             	mov    %eax,-0x38(%ebp)
+80102c29:	8d 8e 00 02 00 00    	lea    0x200(%esi),%ecx
+80102c2f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80102c32:	eb 10                	jmp    80102c44 <iput+0x294>
+80102c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102c38:	83 c6 04             	add    $0x4,%esi
+80102c3b:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+80102c3e:	0f 84 12 01 00 00    	je     80102d56 <iput+0x3a6>
+      if (a[i]) {
+80102c44:	8b 06                	mov    (%esi),%eax
+80102c46:	85 c0                	test   %eax,%eax
+80102c48:	74 ee                	je     80102c38 <iput+0x288>
+        bp2 = bread(ip->dev, a[i]);
+80102c4a:	83 ec 08             	sub    $0x8,%esp
+80102c4d:	50                   	push   %eax
+80102c4e:	ff 37                	push   (%edi)
+80102c50:	e8 1b d8 ff ff       	call   80100470 <bread>
+80102c55:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+80102c58:	83 c4 10             	add    $0x10,%esp
+80102c5b:	8b 48 60             	mov    0x60(%eax),%ecx
+80102c5e:	89 c2                	mov    %eax,%edx
+        for (j = 0; j < NINDIRECT; j++) {
+80102c60:	89 55 c0             	mov    %edx,-0x40(%ebp)
+80102c63:	8d 81 00 02 00 00    	lea    0x200(%ecx),%eax
+80102c69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102c6c:	eb 0a                	jmp    80102c78 <iput+0x2c8>
+80102c6e:	66 90                	xchg   %ax,%ax
+80102c70:	83 c1 04             	add    $0x4,%ecx
+80102c73:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+80102c76:	74 76                	je     80102cee <iput+0x33e>
+          if (b[j]) {
+80102c78:	8b 01                	mov    (%ecx),%eax
+80102c7a:	85 c0                	test   %eax,%eax
+80102c7c:	74 f2                	je     80102c70 <iput+0x2c0>
+            bp3 = bread(ip->dev, b[j]);
+80102c7e:	83 ec 08             	sub    $0x8,%esp
+80102c81:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80102c84:	50                   	push   %eax
+80102c85:	ff 37                	push   (%edi)
+80102c87:	e8 e4 d7 ff ff       	call   80100470 <bread>
+            for (k = 0; k < NINDIRECT; k++) {
+80102c8c:	83 c4 10             	add    $0x10,%esp
+80102c8f:	8b 58 60             	mov    0x60(%eax),%ebx
+80102c92:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102c95:	8d b3 00 02 00 00    	lea    0x200(%ebx),%esi
+80102c9b:	eb 0a                	jmp    80102ca7 <iput+0x2f7>
+80102c9d:	8d 76 00             	lea    0x0(%esi),%esi
+80102ca0:	83 c3 04             	add    $0x4,%ebx
+80102ca3:	39 f3                	cmp    %esi,%ebx
+80102ca5:	74 1b                	je     80102cc2 <iput+0x312>
+              if (c[k]) {
+80102ca7:	8b 13                	mov    (%ebx),%edx
+80102ca9:	85 d2                	test   %edx,%edx
+80102cab:	74 f3                	je     80102ca0 <iput+0x2f0>
+                bfree(ip->dev, c[k]);
+80102cad:	8b 07                	mov    (%edi),%eax
+            for (k = 0; k < NINDIRECT; k++) {
+80102caf:	83 c3 04             	add    $0x4,%ebx
+                bfree(ip->dev, c[k]);
+80102cb2:	e8 69 ea ff ff       	call   80101720 <bfree>
+                c[k] = 0;
+80102cb7:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+            for (k = 0; k < NINDIRECT; k++) {
+80102cbe:	39 f3                	cmp    %esi,%ebx
+80102cc0:	75 e5                	jne    80102ca7 <iput+0x2f7>
+            brelse(bp3);
+80102cc2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102cc5:	83 ec 0c             	sub    $0xc,%esp
+80102cc8:	50                   	push   %eax
+80102cc9:	e8 92 d8 ff ff       	call   80100560 <brelse>
+            bfree(ip->dev, b[j]);
+80102cce:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102cd1:	8b 07                	mov    (%edi),%eax
+80102cd3:	8b 11                	mov    (%ecx),%edx
+80102cd5:	e8 46 ea ff ff       	call   80101720 <bfree>
+            b[j] = 0;
+80102cda:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102cdd:	83 c4 10             	add    $0x10,%esp
+80102ce0:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+        for (j = 0; j < NINDIRECT; j++) {
+80102ce6:	83 c1 04             	add    $0x4,%ecx
+80102ce9:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+80102cec:	75 8a                	jne    80102c78 <iput+0x2c8>
+        brelse(bp2);
+80102cee:	8b 55 c0             	mov    -0x40(%ebp),%edx
+80102cf1:	83 ec 0c             	sub    $0xc,%esp
+80102cf4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+80102cf7:	52                   	push   %edx
+80102cf8:	e8 63 d8 ff ff       	call   80100560 <brelse>
+        bfree(ip->dev, a[i]);
+80102cfd:	8b 16                	mov    (%esi),%edx
+80102cff:	8b 07                	mov    (%edi),%eax
+80102d01:	e8 1a ea ff ff       	call   80101720 <bfree>
+        a[i] = 0;
+80102d06:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102d0c:	83 c4 10             	add    $0x10,%esp
+80102d0f:	e9 24 ff ff ff       	jmp    80102c38 <iput+0x288>
+    bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80102d14:	83 ec 08             	sub    $0x8,%esp
+80102d17:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80102d1a:	50                   	push   %eax
+80102d1b:	ff 37                	push   (%edi)
+80102d1d:	e8 4e d7 ff ff       	call   80100470 <bread>
+    efree(ip->dev, (struct extent*)bp->data, NBEXTENT, prev);
+80102d22:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102d25:	8b 50 60             	mov    0x60(%eax),%edx
+    bp = bread(ip->dev, ip->addrs[EXTBLOCK]);
+80102d28:	89 c6                	mov    %eax,%esi
+    efree(ip->dev, (struct extent*)bp->data, NBEXTENT, prev);
+80102d2a:	8b 07                	mov    (%edi),%eax
+80102d2c:	89 0c 24             	mov    %ecx,(%esp)
+80102d2f:	b9 40 00 00 00       	mov    $0x40,%ecx
+80102d34:	e8 57 e8 ff ff       	call   80101590 <efree>
+    brelse(bp);
+80102d39:	89 34 24             	mov    %esi,(%esp)
+80102d3c:	e8 1f d8 ff ff       	call   80100560 <brelse>
+    bfree(ip->dev, ip->addrs[EXTBLOCK]);
+80102d41:	8b 97 9c 00 00 00    	mov    0x9c(%edi),%edx
+80102d47:	8b 07                	mov    (%edi),%eax
+80102d49:	e8 d2 e9 ff ff       	call   80101720 <bfree>
+80102d4e:	83 c4 10             	add    $0x10,%esp
+80102d51:	e9 99 fe ff ff       	jmp    80102bef <iput+0x23f>
+    brelse(bp);
+80102d56:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80102d59:	83 ec 0c             	sub    $0xc,%esp
+80102d5c:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80102d5f:	50                   	push   %eax
+80102d60:	e8 fb d7 ff ff       	call   80100560 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT + 2]);
+80102d65:	8b 97 9c 00 00 00    	mov    0x9c(%edi),%edx
+80102d6b:	8b 07                	mov    (%edi),%eax
+80102d6d:	e8 ae e9 ff ff       	call   80101720 <bfree>
+    ip->addrs[NDIRECT + 2] = 0;
+80102d72:	83 c4 10             	add    $0x10,%esp
+80102d75:	c7 87 9c 00 00 00 00 	movl   $0x0,0x9c(%edi)
+80102d7c:	00 00 00 
+80102d7f:	e9 11 fe ff ff       	jmp    80102b95 <iput+0x1e5>
+    bp = bread(ip->dev, ip->addrs[NDIRECT + 1]);
+80102d84:	83 ec 08             	sub    $0x8,%esp
+80102d87:	50                   	push   %eax
+80102d88:	ff 37                	push   (%edi)
+80102d8a:	e8 e1 d6 ff ff       	call   80100470 <bread>
+80102d8f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80102d92:	83 c4 10             	add    $0x10,%esp
+80102d95:	8b 48 60             	mov    0x60(%eax),%ecx
+80102d98:	89 c6                	mov    %eax,%esi
+    for (i = 0; i < NINDIRECT; i++) {
+80102d9a:	89 75 dc             	mov    %esi,-0x24(%ebp)
+80102d9d:	8d 81 00 02 00 00    	lea    0x200(%ecx),%eax
+80102da3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102da6:	eb 16                	jmp    80102dbe <iput+0x40e>
+80102da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102daf:	90                   	nop
+80102db0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102db3:	83 c1 04             	add    $0x4,%ecx
+80102db6:	39 c1                	cmp    %eax,%ecx
+80102db8:	0f 84 5e 01 00 00    	je     80102f1c <iput+0x56c>
+      if (a[i]) {
+80102dbe:	8b 01                	mov    (%ecx),%eax
+80102dc0:	85 c0                	test   %eax,%eax
+80102dc2:	74 ec                	je     80102db0 <iput+0x400>
+        bp2 = bread(ip->dev, a[i]);
+80102dc4:	83 ec 08             	sub    $0x8,%esp
+80102dc7:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+80102dca:	50                   	push   %eax
+80102dcb:	ff 37                	push   (%edi)
+80102dcd:	e8 9e d6 ff ff       	call   80100470 <bread>
+        for (j = 0; j < NINDIRECT; j++) {
+80102dd2:	83 c4 10             	add    $0x10,%esp
+80102dd5:	8b 58 60             	mov    0x60(%eax),%ebx
+80102dd8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80102ddb:	8d b3 00 02 00 00    	lea    0x200(%ebx),%esi
+80102de1:	eb 0c                	jmp    80102def <iput+0x43f>
+80102de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102de7:	90                   	nop
+80102de8:	83 c3 04             	add    $0x4,%ebx
+80102deb:	39 f3                	cmp    %esi,%ebx
+80102ded:	74 1b                	je     80102e0a <iput+0x45a>
+          if (b[j]) {
+80102def:	8b 13                	mov    (%ebx),%edx
+80102df1:	85 d2                	test   %edx,%edx
+80102df3:	74 f3                	je     80102de8 <iput+0x438>
+            bfree(ip->dev, b[j]);
+80102df5:	8b 07                	mov    (%edi),%eax
+        for (j = 0; j < NINDIRECT; j++) {
+80102df7:	83 c3 04             	add    $0x4,%ebx
+            bfree(ip->dev, b[j]);
+80102dfa:	e8 21 e9 ff ff       	call   80101720 <bfree>
+            b[j] = 0;
+80102dff:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+        for (j = 0; j < NINDIRECT; j++) {
+80102e06:	39 f3                	cmp    %esi,%ebx
+80102e08:	75 e5                	jne    80102def <iput+0x43f>
+        brelse(bp2);
+80102e0a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102e0d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80102e10:	83 ec 0c             	sub    $0xc,%esp
+80102e13:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80102e16:	50                   	push   %eax
+80102e17:	e8 44 d7 ff ff       	call   80100560 <brelse>
+        bfree(ip->dev, a[i]);
+80102e1c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80102e1f:	8b 07                	mov    (%edi),%eax
+80102e21:	8b 11                	mov    (%ecx),%edx
+80102e23:	e8 f8 e8 ff ff       	call   80101720 <bfree>
+        a[i] = 0;
+80102e28:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80102e2b:	83 c4 10             	add    $0x10,%esp
+80102e2e:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+80102e34:	e9 77 ff ff ff       	jmp    80102db0 <iput+0x400>
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+80102e39:	83 ec 04             	sub    $0x4,%esp
+80102e3c:	8d 47 6c             	lea    0x6c(%edi),%eax
+80102e3f:	6a 34                	push   $0x34
+80102e41:	6a 00                	push   $0x0
+80102e43:	50                   	push   %eax
+80102e44:	e8 07 4e 00 00       	call   80107c50 <memset>
+    ip->flags &= ~I_INLINE;
+80102e49:	66 83 67 5e fb       	andw   $0xfffb,0x5e(%edi)
+    ip->size = 0;
+80102e4e:	c7 47 68 00 00 00 00 	movl   $0x0,0x68(%edi)
+    iupdate(ip);
+80102e55:	89 3c 24             	mov    %edi,(%esp)
+80102e58:	e8 23 f9 ff ff       	call   80102780 <iupdate>
+    return;
+80102e5d:	83 c4 10             	add    $0x10,%esp
+80102e60:	e9 43 fd ff ff       	jmp    80102ba8 <iput+0x1f8>
+        dcachepurge(ip->dev, ip->inum);
+80102e65:	8b 0f                	mov    (%edi),%ecx
+80102e67:	8b 47 04             	mov    0x4(%edi),%eax
+80102e6a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+80102e6d:	be 64 20 11 80       	mov    $0x80112064,%esi
+80102e72:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80102e75:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+dcachepurge(uint dev, uint inum)
+{
+  struct dcset *s;
+  struct dentry *e;
+
+  for(s = dcache; s < dcache+NDCSET; s++){
+80102e78:	89 c3                	mov    %eax,%ebx
+    acquire(&s->lock);
+80102e7a:	83 ec 0c             	sub    $0xc,%esp
+80102e7d:	8d be 5c ff ff ff    	lea    -0xa4(%esi),%edi
+80102e83:	57                   	push   %edi
+80102e84:	e8 e7 4c 00 00       	call   80107b70 <acquire>
+    for(e = s->e; e < s->e+NDCWAY; e++)
+80102e89:	8d 46 90             	lea    -0x70(%esi),%eax
+80102e8c:	83 c4 10             	add    $0x10,%esp
+80102e8f:	83 fe 6f             	cmp    $0x6f,%esi
+80102e92:	76 12                	jbe    80102ea6 <iput+0x4f6>
+      if(e->used && e->dinum == inum && e->dev == dev)
+80102e94:	80 78 1a 00          	cmpb   $0x0,0x1a(%eax)
+80102e98:	74 05                	je     80102e9f <iput+0x4ef>
+80102e9a:	3b 58 04             	cmp    0x4(%eax),%ebx
+80102e9d:	74 31                	je     80102ed0 <iput+0x520>
+    for(e = s->e; e < s->e+NDCWAY; e++)
+80102e9f:	83 c0 1c             	add    $0x1c,%eax
+80102ea2:	39 f0                	cmp    %esi,%eax
+80102ea4:	75 ee                	jne    80102e94 <iput+0x4e4>
+        e->used = 0;
+    release(&s->lock);
+80102ea6:	83 ec 0c             	sub    $0xc,%esp
+  for(s = dcache; s < dcache+NDCSET; s++){
+80102ea9:	81 c6 b4 00 00 00    	add    $0xb4,%esi
+    release(&s->lock);
+80102eaf:	57                   	push   %edi
+80102eb0:	e8 5b 4c 00 00       	call   80107b10 <release>
+  for(s = dcache; s < dcache+NDCSET; s++){
+80102eb5:	83 c4 10             	add    $0x10,%esp
+80102eb8:	81 fe 64 7a 11 80    	cmp    $0x80117a64,%esi
+80102ebe:	75 ba                	jne    80102e7a <iput+0x4ca>
+80102ec0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102ec3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+80102ec6:	e9 57 fc ff ff       	jmp    80102b22 <iput+0x172>
+80102ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102ecf:	90                   	nop
+      if(e->used && e->dinum == inum && e->dev == dev)
+80102ed0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102ed3:	3b 08                	cmp    (%eax),%ecx
+80102ed5:	75 c8                	jne    80102e9f <iput+0x4ef>
+        e->used = 0;
+80102ed7:	c6 40 1a 00          	movb   $0x0,0x1a(%eax)
+80102edb:	eb c2                	jmp    80102e9f <iput+0x4ef>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80102edd:	83 ec 08             	sub    $0x8,%esp
+80102ee0:	50                   	push   %eax
+80102ee1:	ff 37                	push   (%edi)
+80102ee3:	e8 88 d5 ff ff       	call   80100470 <bread>
+    for (i = 0; i < NINDIRECT; i++) {
+80102ee8:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80102eeb:	83 c4 10             	add    $0x10,%esp
+80102eee:	8b 70 60             	mov    0x60(%eax),%esi
+80102ef1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102ef4:	8d 8e 00 02 00 00    	lea    0x200(%esi),%ecx
+80102efa:	89 cb                	mov    %ecx,%ebx
+80102efc:	eb 09                	jmp    80102f07 <iput+0x557>
+80102efe:	66 90                	xchg   %ax,%ax
+80102f00:	83 c6 04             	add    $0x4,%esi
+80102f03:	39 de                	cmp    %ebx,%esi
+80102f05:	74 43                	je     80102f4a <iput+0x59a>
+      if (a[i]) {
+80102f07:	8b 16                	mov    (%esi),%edx
+80102f09:	85 d2                	test   %edx,%edx
+80102f0b:	74 f3                	je     80102f00 <iput+0x550>
+        bfree(ip->dev, a[i]);
+80102f0d:	8b 07                	mov    (%edi),%eax
+80102f0f:	e8 0c e8 ff ff       	call   80101720 <bfree>
+        a[i] = 0;
+80102f14:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102f1a:	eb e4                	jmp    80102f00 <iput+0x550>
+    brelse(bp);
+80102f1c:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80102f1f:	83 ec 0c             	sub    $0xc,%esp
+80102f22:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102f25:	56                   	push   %esi
+80102f26:	e8 35 d6 ff ff       	call   80100560 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT + 1]);
+80102f2b:	8b 97 98 00 00 00    	mov    0x98(%edi),%edx
+80102f31:	8b 07                	mov    (%edi),%eax
+80102f33:	e8 e8 e7 ff ff       	call   80101720 <bfree>
+    ip->addrs[NDIRECT + 1] = 0;
+80102f38:	83 c4 10             	add    $0x10,%esp
+80102f3b:	c7 87 98 00 00 00 00 	movl   $0x0,0x98(%edi)
+80102f42:	00 00 00 
+80102f45:	e9 41 fc ff ff       	jmp    80102b8b <iput+0x1db>
+    brelse(bp);
+80102f4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102f4d:	83 ec 0c             	sub    $0xc,%esp
+80102f50:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102f53:	50                   	push   %eax
+80102f54:	e8 07 d6 ff ff       	call   80100560 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80102f59:	8b 97 94 00 00 00    	mov    0x94(%edi),%edx
+80102f5f:	8b 07                	mov    (%edi),%eax
+80102f61:	e8 ba e7 ff ff       	call   80101720 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80102f66:	83 c4 10             	add    $0x10,%esp
+80102f69:	c7 87 94 00 00 00 00 	movl   $0x0,0x94(%edi)
+80102f70:	00 00 00 
+80102f73:	e9 05 fc ff ff       	jmp    80102b7d <iput+0x1cd>
+80102f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f7f:	90                   	nop
+
+80102f80 <iunlockput>:
+{
+80102f80:	55                   	push   %ebp
+80102f81:	89 e5                	mov    %esp,%ebp
+80102f83:	56                   	push   %esi
+80102f84:	53                   	push   %ebx
+80102f85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102f88:	85 db                	test   %ebx,%ebx
+80102f8a:	74 34                	je     80102fc0 <iunlockput+0x40>
+80102f8c:	83 ec 0c             	sub    $0xc,%esp
+80102f8f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102f92:	56                   	push   %esi
+80102f93:	e8 a8 49 00 00       	call   80107940 <holdingsleep>
+80102f98:	83 c4 10             	add    $0x10,%esp
+80102f9b:	85 c0                	test   %eax,%eax
+80102f9d:	74 21                	je     80102fc0 <iunlockput+0x40>
+80102f9f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102fa2:	85 c0                	test   %eax,%eax
+80102fa4:	7e 1a                	jle    80102fc0 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102fa6:	83 ec 0c             	sub    $0xc,%esp
+80102fa9:	56                   	push   %esi
+80102faa:	e8 51 49 00 00       	call   80107900 <releasesleep>
+  iput(ip);
+80102faf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102fb2:	83 c4 10             	add    $0x10,%esp
+}
+80102fb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102fb8:	5b                   	pop    %ebx
+80102fb9:	5e                   	pop    %esi
+80102fba:	5d                   	pop    %ebp
+  iput(ip);
+80102fbb:	e9 f0 f9 ff ff       	jmp    801029b0 <iput>
+    panic("iunlock");
+80102fc0:	83 ec 0c             	sub    $0xc,%esp
+80102fc3:	68 07 af 10 80       	push   $0x8010af07
+80102fc8:	e8 63 d7 ff ff       	call   80100730 <panic>
+80102fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102fd0 <stati>:
+{
+80102fd0:	55                   	push   %ebp
+80102fd1:	89 e5                	mov    %esp,%ebp
+80102fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+80102fd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102fd9:	8b 0a                	mov    (%edx),%ecx
+80102fdb:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102fde:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102fe1:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102fe4:	0f b7 4a 5c          	movzwl 0x5c(%edx),%ecx
+80102fe8:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102feb:	0f b7 4a 64          	movzwl 0x64(%edx),%ecx
+80102fef:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102ff3:	8b 52 68             	mov    0x68(%edx),%edx
+80102ff6:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102ff9:	5d                   	pop    %ebp
+80102ffa:	c3                   	ret
+80102ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102fff:	90                   	nop
+
+80103000 <setreadahead>:
+{
+80103000:	55                   	push   %ebp
+80103001:	89 e5                	mov    %esp,%ebp
+80103003:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(n > MAXREADAHEAD)
+80103006:	83 f8 40             	cmp    $0x40,%eax
+80103009:	7f 15                	jg     80103020 <setreadahead+0x20>
+  old = readahead;
+8010300b:	8b 15 00 c0 10 80    	mov    0x8010c000,%edx
+  if(n >= 0)
+80103011:	85 c0                	test   %eax,%eax
+80103013:	78 05                	js     8010301a <setreadahead+0x1a>
+    readahead = n;
+80103015:	a3 00 c0 10 80       	mov    %eax,0x8010c000
+}
+8010301a:	89 d0                	mov    %edx,%eax
+8010301c:	5d                   	pop    %ebp
+8010301d:	c3                   	ret
+8010301e:	66 90                	xchg   %ax,%ax
+    return -1;
+80103020:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80103025:	eb f3                	jmp    8010301a <setreadahead+0x1a>
+80103027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010302e:	66 90                	xchg   %ax,%ax
+
+80103030 <readi>:
+{
+80103030:	55                   	push   %ebp
+80103031:	89 e5                	mov    %esp,%ebp
+80103033:	53                   	push   %ebx
+80103034:	8b 45 08             	mov    0x8(%ebp),%eax
+80103037:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010303a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010303d:	8b 55 14             	mov    0x14(%ebp),%edx
+  if(ip->type == T_DEV){
+80103040:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+80103045:	74 11                	je     80103058 <readi+0x28>
+80103047:	89 55 08             	mov    %edx,0x8(%ebp)
+8010304a:	89 da                	mov    %ebx,%edx
+}
+8010304c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010304f:	c9                   	leave
+80103050:	e9 0b f3 ff ff       	jmp    80102360 <readi.part.0>
+80103055:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80103058:	0f bf 40 60          	movswl 0x60(%eax),%eax
+8010305c:	66 83 f8 09          	cmp    $0x9,%ax
+80103060:	77 14                	ja     80103076 <readi+0x46>
+80103062:	8b 04 c5 40 f3 10 80 	mov    -0x7fef0cc0(,%eax,8),%eax
+80103069:	85 c0                	test   %eax,%eax
+8010306b:	74 09                	je     80103076 <readi+0x46>
+    return devsw[ip->major].read(ip, dst, n);
+8010306d:	89 55 10             	mov    %edx,0x10(%ebp)
+}
+80103070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103073:	c9                   	leave
+    return devsw[ip->major].read(ip, dst, n);
+80103074:	ff e0                	jmp    *%eax
+}
+80103076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103079:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010307e:	c9                   	leave
+8010307f:	c3                   	ret
+
+80103080 <dirprobe>:
+// *pfree to the first free slot in the probe window (0 if none)
+// and returns 0 if the search reached a never-used slot, so the
+// name cannot have overflowed past the table, or -1 if not.
+static int
+dirprobe(struct inode *dp, char *name, uint *poff, uint *pfree)
+{
+80103080:	55                   	push   %ebp
+80103081:	89 e5                	mov    %esp,%ebp
+80103083:	57                   	push   %edi
+80103084:	89 d7                	mov    %edx,%edi
+80103086:	56                   	push   %esi
+80103087:	53                   	push   %ebx
+  h = 2166136261U;
+80103088:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+{
+8010308d:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+80103093:	89 85 dc fd ff ff    	mov    %eax,-0x224(%ebp)
+80103099:	89 c8                	mov    %ecx,%eax
+  struct dirent de[DPB];
+  uint s, off, bn;
+  int i;
+
+  *pfree = 0;
+8010309b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+{
+8010309e:	89 95 d8 fd ff ff    	mov    %edx,-0x228(%ebp)
+  *pfree = 0;
+801030a4:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801030aa:	89 d1                	mov    %edx,%ecx
+801030ac:	83 c1 0e             	add    $0xe,%ecx
+801030af:	90                   	nop
+801030b0:	0f b6 17             	movzbl (%edi),%edx
+801030b3:	84 d2                	test   %dl,%dl
+801030b5:	74 12                	je     801030c9 <dirprobe+0x49>
+    h = (h ^ (uchar)name[i]) * 16777619U;
+801030b7:	0f b6 f2             	movzbl %dl,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801030ba:	83 c7 01             	add    $0x1,%edi
+    h = (h ^ (uchar)name[i]) * 16777619U;
+801030bd:	31 f3                	xor    %esi,%ebx
+801030bf:	69 db 93 01 00 01    	imul   $0x1000193,%ebx,%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801030c5:	39 f9                	cmp    %edi,%ecx
+801030c7:	75 e7                	jne    801030b0 <dirprobe+0x30>
+  s = dirhash(name) % DIRHASH_NSLOT;
+  for(i = 0; i < DPB; i++, s = (s + 1) % DIRHASH_NSLOT){
+    off = DIRHASH_START*BSIZE + s*sizeof(de[0]);
+    if(i == 0 || off/BSIZE != bn){
+      bn = off/BSIZE;
+      if(readi(dp, (char*)de, bn*BSIZE, BSIZE) != BSIZE)
+801030c9:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  s = dirhash(name) % DIRHASH_NSLOT;
+801030cf:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  for(i = 0; i < DPB; i++, s = (s + 1) % DIRHASH_NSLOT){
+801030d5:	31 ff                	xor    %edi,%edi
+  bn = 0;
+801030d7:	31 d2                	xor    %edx,%edx
+    off = DIRHASH_START*BSIZE + s*sizeof(de[0]);
+801030d9:	8d 83 80 00 00 00    	lea    0x80(%ebx),%eax
+801030df:	89 d6                	mov    %edx,%esi
+801030e1:	89 c1                	mov    %eax,%ecx
+    if(i == 0 || off/BSIZE != bn){
+801030e3:	c1 e8 05             	shr    $0x5,%eax
+    off = DIRHASH_START*BSIZE + s*sizeof(de[0]);
+801030e6:	c1 e1 04             	shl    $0x4,%ecx
+    if(i == 0 || off/BSIZE != bn){
+801030e9:	89 c2                	mov    %eax,%edx
+    off = DIRHASH_START*BSIZE + s*sizeof(de[0]);
+801030eb:	89 8d e4 fd ff ff    	mov    %ecx,-0x21c(%ebp)
+    if(i == 0 || off/BSIZE != bn){
+801030f1:	85 ff                	test   %edi,%edi
+801030f3:	74 04                	je     801030f9 <dirprobe+0x79>
+801030f5:	39 c6                	cmp    %eax,%esi
+801030f7:	74 3d                	je     80103136 <dirprobe+0xb6>
+801030f9:	89 95 e0 fd ff ff    	mov    %edx,-0x220(%ebp)
+      if(readi(dp, (char*)de, bn*BSIZE, BSIZE) != BSIZE)
+801030ff:	68 00 02 00 00       	push   $0x200
+80103104:	8b 85 e4 fd ff ff    	mov    -0x21c(%ebp),%eax
+8010310a:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+8010310f:	50                   	push   %eax
+80103110:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+80103116:	50                   	push   %eax
+80103117:	ff b5 dc fd ff ff    	push   -0x224(%ebp)
+8010311d:	e8 0e ff ff ff       	call   80103030 <readi>
+80103122:	83 c4 10             	add    $0x10,%esp
+80103125:	8b 95 e0 fd ff ff    	mov    -0x220(%ebp),%edx
+8010312b:	3d 00 02 00 00       	cmp    $0x200,%eax
+80103130:	0f 85 a8 00 00 00    	jne    801031de <dirprobe+0x15e>
+        panic("dirprobe read");
+    }
+    if(de[s%DPB].inum == 0){
+80103136:	89 de                	mov    %ebx,%esi
+80103138:	83 e6 1f             	and    $0x1f,%esi
+8010313b:	89 f0                	mov    %esi,%eax
+8010313d:	c1 e0 04             	shl    $0x4,%eax
+80103140:	66 83 bc 05 e8 fd ff 	cmpw   $0x0,-0x218(%ebp,%eax,1)
+80103147:	ff 00 
+80103149:	75 2d                	jne    80103178 <dirprobe+0xf8>
+      if(*pfree == 0)
+8010314b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010314e:	8b 08                	mov    (%eax),%ecx
+80103150:	85 c9                	test   %ecx,%ecx
+80103152:	75 08                	jne    8010315c <dirprobe+0xdc>
+        *pfree = off;
+80103154:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+8010315a:	89 08                	mov    %ecx,(%eax)
+      if(de[s%DPB].name[0] == 0)
+8010315c:	c1 e6 04             	shl    $0x4,%esi
+8010315f:	80 bc 35 ea fd ff ff 	cmpb   $0x0,-0x216(%ebp,%esi,1)
+80103166:	00 
+80103167:	75 3a                	jne    801031a3 <dirprobe+0x123>
+        return 0;
+80103169:	31 c0                	xor    %eax,%eax
+        *poff = off;
+      return de[s%DPB].inum;
+    }
+  }
+  return -1;
+}
+8010316b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010316e:	5b                   	pop    %ebx
+8010316f:	5e                   	pop    %esi
+80103170:	5f                   	pop    %edi
+80103171:	5d                   	pop    %ebp
+80103172:	c3                   	ret
+80103173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103177:	90                   	nop
+  return strncmp(s, t, DIRSIZ);
+80103178:	83 ec 04             	sub    $0x4,%esp
+    if(namecmp(name, de[s%DPB].name) == 0){
+8010317b:	8d 84 05 ea fd ff ff 	lea    -0x216(%ebp,%eax,1),%eax
+80103182:	89 95 e0 fd ff ff    	mov    %edx,-0x220(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80103188:	6a 0e                	push   $0xe
+8010318a:	50                   	push   %eax
+8010318b:	ff b5 d8 fd ff ff    	push   -0x228(%ebp)
+80103191:	e8 ba 4b 00 00       	call   80107d50 <strncmp>
+    if(namecmp(name, de[s%DPB].name) == 0){
+80103196:	83 c4 10             	add    $0x10,%esp
+80103199:	8b 95 e0 fd ff ff    	mov    -0x220(%ebp),%edx
+8010319f:	85 c0                	test   %eax,%eax
+801031a1:	74 1c                	je     801031bf <dirprobe+0x13f>
+  for(i = 0; i < DPB; i++, s = (s + 1) % DIRHASH_NSLOT){
+801031a3:	83 c3 01             	add    $0x1,%ebx
+801031a6:	83 c7 01             	add    $0x1,%edi
+801031a9:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+801031af:	83 ff 20             	cmp    $0x20,%edi
+801031b2:	0f 85 21 ff ff ff    	jne    801030d9 <dirprobe+0x59>
+  return -1;
+801031b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801031bd:	eb ac                	jmp    8010316b <dirprobe+0xeb>
+      if(poff)
+801031bf:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+801031c5:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+801031cb:	85 c0                	test   %eax,%eax
+801031cd:	74 02                	je     801031d1 <dirprobe+0x151>
+        *poff = off;
+801031cf:	89 08                	mov    %ecx,(%eax)
+      return de[s%DPB].inum;
+801031d1:	c1 e6 04             	shl    $0x4,%esi
+801031d4:	0f b7 84 35 e8 fd ff 	movzwl -0x218(%ebp,%esi,1),%eax
+801031db:	ff 
+801031dc:	eb 8d                	jmp    8010316b <dirprobe+0xeb>
+        panic("dirprobe read");
+801031de:	83 ec 0c             	sub    $0xc,%esp
+801031e1:	68 0f af 10 80       	push   $0x8010af0f
+801031e6:	e8 45 d5 ff ff       	call   80100730 <panic>
+801031eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801031ef:	90                   	nop
+
+801031f0 <dirscan>:
+{
+801031f0:	55                   	push   %ebp
+801031f1:	89 e5                	mov    %esp,%ebp
+801031f3:	57                   	push   %edi
+801031f4:	56                   	push   %esi
+801031f5:	53                   	push   %ebx
+801031f6:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+801031fc:	89 95 e4 fd ff ff    	mov    %edx,-0x21c(%ebp)
+80103202:	89 ca                	mov    %ecx,%edx
+  if(pfree)
+80103204:	8b 4d 10             	mov    0x10(%ebp),%ecx
+{
+80103207:	89 85 d8 fd ff ff    	mov    %eax,-0x228(%ebp)
+8010320d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(pfree)
+80103210:	85 c9                	test   %ecx,%ecx
+80103212:	74 08                	je     8010321c <dirscan+0x2c>
+    *pfree = end;
+80103214:	8b 45 10             	mov    0x10(%ebp),%eax
+80103217:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010321a:	89 38                	mov    %edi,(%eax)
+  for(; off < end; off += n){
+8010321c:	3b 55 08             	cmp    0x8(%ebp),%edx
+8010321f:	0f 83 12 01 00 00    	jae    80103337 <dirscan+0x147>
+80103225:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+    n = min(end - off, BSIZE - off%BSIZE);
+80103228:	89 d0                	mov    %edx,%eax
+8010322a:	b9 00 02 00 00       	mov    $0x200,%ecx
+8010322f:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103234:	29 c1                	sub    %eax,%ecx
+80103236:	8b 45 08             	mov    0x8(%ebp),%eax
+80103239:	29 d0                	sub    %edx,%eax
+8010323b:	39 c1                	cmp    %eax,%ecx
+8010323d:	0f 47 c8             	cmova  %eax,%ecx
+    if(readi(dp, (char*)de, off, n) != n)
+80103240:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+80103246:	51                   	push   %ecx
+80103247:	89 8d dc fd ff ff    	mov    %ecx,-0x224(%ebp)
+8010324d:	52                   	push   %edx
+8010324e:	89 95 e0 fd ff ff    	mov    %edx,-0x220(%ebp)
+80103254:	50                   	push   %eax
+80103255:	ff b5 d8 fd ff ff    	push   -0x228(%ebp)
+8010325b:	e8 d0 fd ff ff       	call   80103030 <readi>
+80103260:	8b 8d dc fd ff ff    	mov    -0x224(%ebp),%ecx
+80103266:	83 c4 10             	add    $0x10,%esp
+80103269:	39 c8                	cmp    %ecx,%eax
+8010326b:	0f 85 d0 00 00 00    	jne    80103341 <dirscan+0x151>
+    for(i = 0; i < n/sizeof(de[0]); i++){
+80103271:	89 cf                	mov    %ecx,%edi
+80103273:	31 f6                	xor    %esi,%esi
+80103275:	8b 95 e0 fd ff ff    	mov    -0x220(%ebp),%edx
+8010327b:	8d 9d ea fd ff ff    	lea    -0x216(%ebp),%ebx
+80103281:	c1 ef 04             	shr    $0x4,%edi
+80103284:	0f 84 a2 00 00 00    	je     8010332c <dirscan+0x13c>
+8010328a:	89 8d dc fd ff ff    	mov    %ecx,-0x224(%ebp)
+80103290:	89 95 e0 fd ff ff    	mov    %edx,-0x220(%ebp)
+80103296:	eb 3a                	jmp    801032d2 <dirscan+0xe2>
+80103298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010329f:	90                   	nop
+        if(pfree && *pfree == end)
+801032a0:	8b 45 10             	mov    0x10(%ebp),%eax
+801032a3:	85 c0                	test   %eax,%eax
+801032a5:	74 21                	je     801032c8 <dirscan+0xd8>
+801032a7:	8b 45 10             	mov    0x10(%ebp),%eax
+801032aa:	8b 55 08             	mov    0x8(%ebp),%edx
+801032ad:	39 10                	cmp    %edx,(%eax)
+801032af:	75 17                	jne    801032c8 <dirscan+0xd8>
+          *pfree = off + i*sizeof(de[0]);
+801032b1:	8b 8d e0 fd ff ff    	mov    -0x220(%ebp),%ecx
+801032b7:	89 f0                	mov    %esi,%eax
+801032b9:	c1 e0 04             	shl    $0x4,%eax
+801032bc:	01 c8                	add    %ecx,%eax
+801032be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801032c1:	89 01                	mov    %eax,(%ecx)
+801032c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801032c7:	90                   	nop
+    for(i = 0; i < n/sizeof(de[0]); i++){
+801032c8:	83 c6 01             	add    $0x1,%esi
+801032cb:	83 c3 10             	add    $0x10,%ebx
+801032ce:	39 fe                	cmp    %edi,%esi
+801032d0:	74 4e                	je     80103320 <dirscan+0x130>
+      if(de[i].inum == 0){
+801032d2:	66 83 7b fe 00       	cmpw   $0x0,-0x2(%ebx)
+801032d7:	74 c7                	je     801032a0 <dirscan+0xb0>
+  return strncmp(s, t, DIRSIZ);
+801032d9:	83 ec 04             	sub    $0x4,%esp
+801032dc:	6a 0e                	push   $0xe
+801032de:	53                   	push   %ebx
+801032df:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+801032e5:	e8 66 4a 00 00       	call   80107d50 <strncmp>
+      if(namecmp(name, de[i].name) == 0){
+801032ea:	83 c4 10             	add    $0x10,%esp
+801032ed:	85 c0                	test   %eax,%eax
+801032ef:	75 d7                	jne    801032c8 <dirscan+0xd8>
+        if(poff)
+801032f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801032f4:	8b 95 e0 fd ff ff    	mov    -0x220(%ebp),%edx
+801032fa:	85 db                	test   %ebx,%ebx
+801032fc:	74 09                	je     80103307 <dirscan+0x117>
+          *poff = off + i*sizeof(de[0]);
+801032fe:	89 f0                	mov    %esi,%eax
+80103300:	c1 e0 04             	shl    $0x4,%eax
+80103303:	01 d0                	add    %edx,%eax
+80103305:	89 03                	mov    %eax,(%ebx)
+        return de[i].inum;
+80103307:	c1 e6 04             	shl    $0x4,%esi
+8010330a:	0f b7 84 35 e8 fd ff 	movzwl -0x218(%ebp,%esi,1),%eax
+80103311:	ff 
+}
+80103312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103315:	5b                   	pop    %ebx
+80103316:	5e                   	pop    %esi
+80103317:	5f                   	pop    %edi
+80103318:	5d                   	pop    %ebp
+80103319:	c3                   	ret
+8010331a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103320:	8b 8d dc fd ff ff    	mov    -0x224(%ebp),%ecx
+80103326:	8b 95 e0 fd ff ff    	mov    -0x220(%ebp),%edx
+  for(; off < end; off += n){
+8010332c:	01 ca                	add    %ecx,%edx
+8010332e:	3b 55 08             	cmp    0x8(%ebp),%edx
+80103331:	0f 82 f1 fe ff ff    	jb     80103228 <dirscan+0x38>
+}
+80103337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010333a:	31 c0                	xor    %eax,%eax
+}
+8010333c:	5b                   	pop    %ebx
+8010333d:	5e                   	pop    %esi
+8010333e:	5f                   	pop    %edi
+8010333f:	5d                   	pop    %ebp
+80103340:	c3                   	ret
+      panic("dirscan read");
+80103341:	83 ec 0c             	sub    $0xc,%esp
+80103344:	68 1d af 10 80       	push   $0x8010af1d
+80103349:	e8 e2 d3 ff ff       	call   80100730 <panic>
+8010334e:	66 90                	xchg   %ax,%ax
+
+80103350 <writei>:
+{
+80103350:	55                   	push   %ebp
+80103351:	89 e5                	mov    %esp,%ebp
+80103353:	57                   	push   %edi
+80103354:	56                   	push   %esi
+80103355:	53                   	push   %ebx
+80103356:	83 ec 5c             	sub    $0x5c,%esp
+80103359:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010335c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010335f:	89 7d 9c             	mov    %edi,-0x64(%ebp)
+80103362:	8b 7d 10             	mov    0x10(%ebp),%edi
+80103365:	89 45 98             	mov    %eax,-0x68(%ebp)
+  if(ip->type == T_DEV){
+80103368:	0f b7 40 5c          	movzwl 0x5c(%eax),%eax
+{
+8010336c:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+8010336f:	8b 7d 14             	mov    0x14(%ebp),%edi
+80103372:	89 7d a0             	mov    %edi,-0x60(%ebp)
+  if(ip->type == T_DEV){
+80103375:	66 83 f8 03          	cmp    $0x3,%ax
+80103379:	0f 84 59 01 00 00    	je     801034d8 <writei+0x188>
+  if(off > ip->size || off + n < off)
+8010337f:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+80103382:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+80103385:	8b 51 68             	mov    0x68(%ecx),%edx
+80103388:	39 fa                	cmp    %edi,%edx
+8010338a:	0f 82 63 02 00 00    	jb     801035f3 <writei+0x2a3>
+  if(off + n > MAXFILE*BSIZE)
+80103390:	8b 75 a0             	mov    -0x60(%ebp),%esi
+80103393:	01 f7                	add    %esi,%edi
+80103395:	0f 82 58 02 00 00    	jb     801035f3 <writei+0x2a3>
+8010339b:	81 ff 00 14 81 40    	cmp    $0x40811400,%edi
+801033a1:	0f 87 4c 02 00 00    	ja     801035f3 <writei+0x2a3>
+  if(ip->type == T_FILE && ip->size == 0 && n > 0 && off + n <= NINLINE &&
+801033a7:	85 d2                	test   %edx,%edx
+  if(ip->flags & I_INLINE){
+801033a9:	0f b7 59 5e          	movzwl 0x5e(%ecx),%ebx
+  if(ip->type == T_FILE && ip->size == 0 && n > 0 && off + n <= NINLINE &&
+801033ad:	0f 94 c1             	sete   %cl
+801033b0:	66 83 f8 02          	cmp    $0x2,%ax
+801033b4:	0f 94 c0             	sete   %al
+801033b7:	84 c1                	test   %al,%cl
+801033b9:	74 08                	je     801033c3 <writei+0x73>
+801033bb:	85 f6                	test   %esi,%esi
+801033bd:	0f 85 45 01 00 00    	jne    80103508 <writei+0x1b8>
+  if(ip->flags & I_INLINE){
+801033c3:	83 e3 04             	and    $0x4,%ebx
+801033c6:	74 53                	je     8010341b <writei+0xcb>
+    if(off + n <= NINLINE){
+801033c8:	83 ff 34             	cmp    $0x34,%edi
+801033cb:	0f 86 5f 01 00 00    	jbe    80103530 <writei+0x1e0>
+  memmove(data, ip->addrs, ip->size);
+801033d1:	8b 75 98             	mov    -0x68(%ebp),%esi
+801033d4:	83 ec 04             	sub    $0x4,%esp
+801033d7:	8d 5d b4             	lea    -0x4c(%ebp),%ebx
+801033da:	52                   	push   %edx
+801033db:	8d 7e 6c             	lea    0x6c(%esi),%edi
+801033de:	57                   	push   %edi
+801033df:	53                   	push   %ebx
+801033e0:	e8 fb 48 00 00       	call   80107ce0 <memmove>
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+801033e5:	83 c4 0c             	add    $0xc,%esp
+801033e8:	6a 34                	push   $0x34
+801033ea:	6a 00                	push   $0x0
+801033ec:	57                   	push   %edi
+801033ed:	e8 5e 48 00 00       	call   80107c50 <memset>
+  ip->flags &= ~I_INLINE;
+801033f2:	0f b7 46 5e          	movzwl 0x5e(%esi),%eax
+  if(ip->size > 0){
+801033f6:	83 c4 10             	add    $0x10,%esp
+  ip->flags &= ~I_INLINE;
+801033f9:	89 c2                	mov    %eax,%edx
+801033fb:	83 e2 fb             	and    $0xfffffffb,%edx
+801033fe:	66 89 56 5e          	mov    %dx,0x5e(%esi)
+  if(ip->size > 0){
+80103402:	8b 56 68             	mov    0x68(%esi),%edx
+80103405:	85 d2                	test   %edx,%edx
+80103407:	0f 85 83 01 00 00    	jne    80103590 <writei+0x240>
+  iupdate(ip);
+8010340d:	83 ec 0c             	sub    $0xc,%esp
+80103410:	ff 75 98             	push   -0x68(%ebp)
+80103413:	e8 68 f3 ff ff       	call   80102780 <iupdate>
+}
+80103418:	83 c4 10             	add    $0x10,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010341b:	8b 45 a0             	mov    -0x60(%ebp),%eax
+8010341e:	85 c0                	test   %eax,%eax
+80103420:	0f 84 a2 00 00 00    	je     801034c8 <writei+0x178>
+{
+80103426:	31 ff                	xor    %edi,%edi
+80103428:	eb 62                	jmp    8010348c <writei+0x13c>
+8010342a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    bp = bread(ip->dev, addr);
+80103430:	83 ec 08             	sub    $0x8,%esp
+80103433:	50                   	push   %eax
+80103434:	ff 36                	push   (%esi)
+80103436:	e8 35 d0 ff ff       	call   80100470 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010343b:	8b 55 a0             	mov    -0x60(%ebp),%edx
+8010343e:	b9 00 02 00 00       	mov    $0x200,%ecx
+80103443:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+    bp = bread(ip->dev, addr);
+80103446:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103448:	89 d8                	mov    %ebx,%eax
+8010344a:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010344f:	29 fa                	sub    %edi,%edx
+80103451:	29 c1                	sub    %eax,%ecx
+80103453:	89 d3                	mov    %edx,%ebx
+80103455:	39 d1                	cmp    %edx,%ecx
+80103457:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+8010345a:	83 c4 0c             	add    $0xc,%esp
+8010345d:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010345e:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+80103460:	ff 75 9c             	push   -0x64(%ebp)
+80103463:	03 46 60             	add    0x60(%esi),%eax
+80103466:	50                   	push   %eax
+80103467:	e8 74 48 00 00       	call   80107ce0 <memmove>
+    log_write(bp);
+8010346c:	89 34 24             	mov    %esi,(%esp)
+8010346f:	e8 bc 24 00 00       	call   80105930 <log_write>
+    brelse(bp);
+80103474:	89 34 24             	mov    %esi,(%esp)
+80103477:	e8 e4 d0 ff ff       	call   80100560 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010347c:	8b 55 a0             	mov    -0x60(%ebp),%edx
+8010347f:	01 5d a4             	add    %ebx,-0x5c(%ebp)
+80103482:	83 c4 10             	add    $0x10,%esp
+80103485:	01 5d 9c             	add    %ebx,-0x64(%ebp)
+80103488:	39 d7                	cmp    %edx,%edi
+8010348a:	73 1b                	jae    801034a7 <writei+0x157>
+    if((addr = bmap(ip, off/BSIZE, 1)) == 0)
+8010348c:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+8010348f:	8b 75 98             	mov    -0x68(%ebp),%esi
+80103492:	b9 01 00 00 00       	mov    $0x1,%ecx
+80103497:	89 da                	mov    %ebx,%edx
+80103499:	89 f0                	mov    %esi,%eax
+8010349b:	c1 ea 09             	shr    $0x9,%edx
+8010349e:	e8 6d ea ff ff       	call   80101f10 <bmap>
+801034a3:	85 c0                	test   %eax,%eax
+801034a5:	75 89                	jne    80103430 <writei+0xe0>
+  if(n > 0 && off > ip->size){
+801034a7:	85 ff                	test   %edi,%edi
+801034a9:	74 1d                	je     801034c8 <writei+0x178>
+801034ab:	8b 45 98             	mov    -0x68(%ebp),%eax
+801034ae:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+801034b1:	39 48 68             	cmp    %ecx,0x68(%eax)
+801034b4:	0f 82 b6 00 00 00    	jb     80103570 <writei+0x220>
+  return n;
+801034ba:	89 f8                	mov    %edi,%eax
+}
+801034bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801034bf:	5b                   	pop    %ebx
+801034c0:	5e                   	pop    %esi
+801034c1:	5f                   	pop    %edi
+801034c2:	5d                   	pop    %ebp
+801034c3:	c3                   	ret
+801034c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+{
+801034c8:	31 c0                	xor    %eax,%eax
+}
+801034ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801034cd:	5b                   	pop    %ebx
+801034ce:	5e                   	pop    %esi
+801034cf:	5f                   	pop    %edi
+801034d0:	5d                   	pop    %ebp
+801034d1:	c3                   	ret
+801034d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801034d8:	8b 45 98             	mov    -0x68(%ebp),%eax
+801034db:	0f bf 40 60          	movswl 0x60(%eax),%eax
+801034df:	66 83 f8 09          	cmp    $0x9,%ax
+801034e3:	0f 87 0a 01 00 00    	ja     801035f3 <writei+0x2a3>
+801034e9:	8b 04 c5 44 f3 10 80 	mov    -0x7fef0cbc(,%eax,8),%eax
+801034f0:	85 c0                	test   %eax,%eax
+801034f2:	0f 84 fb 00 00 00    	je     801035f3 <writei+0x2a3>
+    return devsw[ip->major].write(ip, src, n);
+801034f8:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+801034fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801034fe:	5b                   	pop    %ebx
+801034ff:	5e                   	pop    %esi
+80103500:	5f                   	pop    %edi
+80103501:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80103502:	ff e0                	jmp    *%eax
+80103504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(ip->type == T_FILE && ip->size == 0 && n > 0 && off + n <= NINLINE &&
+80103508:	83 ff 34             	cmp    $0x34,%edi
+8010350b:	0f 87 d4 00 00 00    	ja     801035e5 <writei+0x295>
+80103511:	f6 c3 05             	test   $0x5,%bl
+80103514:	0f 85 f4 00 00 00    	jne    8010360e <writei+0x2be>
+    ip->flags |= I_INLINE;
+8010351a:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+8010351d:	89 d8                	mov    %ebx,%eax
+8010351f:	83 c8 04             	or     $0x4,%eax
+80103522:	66 89 41 5e          	mov    %ax,0x5e(%ecx)
+  if(ip->flags & I_INLINE){
+80103526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010352d:	8d 76 00             	lea    0x0(%esi),%esi
+      memmove((char*)ip->addrs + off, src, n);
+80103530:	83 ec 04             	sub    $0x4,%esp
+80103533:	ff 75 a0             	push   -0x60(%ebp)
+80103536:	ff 75 9c             	push   -0x64(%ebp)
+80103539:	8b 75 98             	mov    -0x68(%ebp),%esi
+8010353c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+8010353f:	8d 44 06 6c          	lea    0x6c(%esi,%eax,1),%eax
+80103543:	50                   	push   %eax
+80103544:	e8 97 47 00 00       	call   80107ce0 <memmove>
+      if(off + n > ip->size)
+80103549:	83 c4 10             	add    $0x10,%esp
+8010354c:	39 7e 68             	cmp    %edi,0x68(%esi)
+8010354f:	73 03                	jae    80103554 <writei+0x204>
+        ip->size = off + n;
+80103551:	89 7e 68             	mov    %edi,0x68(%esi)
+      iupdate(ip);
+80103554:	83 ec 0c             	sub    $0xc,%esp
+80103557:	ff 75 98             	push   -0x68(%ebp)
+8010355a:	e8 21 f2 ff ff       	call   80102780 <iupdate>
+      return n;
+8010355f:	8b 45 a0             	mov    -0x60(%ebp),%eax
+80103562:	83 c4 10             	add    $0x10,%esp
+}
+80103565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103568:	5b                   	pop    %ebx
+80103569:	5e                   	pop    %esi
+8010356a:	5f                   	pop    %edi
+8010356b:	5d                   	pop    %ebp
+8010356c:	c3                   	ret
+8010356d:	8d 76 00             	lea    0x0(%esi),%esi
+    ip->size = off;
+80103570:	8b 45 98             	mov    -0x68(%ebp),%eax
+80103573:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    iupdate(ip);
+80103576:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+80103579:	89 48 68             	mov    %ecx,0x68(%eax)
+    iupdate(ip);
+8010357c:	50                   	push   %eax
+8010357d:	e8 fe f1 ff ff       	call   80102780 <iupdate>
+80103582:	83 c4 10             	add    $0x10,%esp
+  return n;
+80103585:	89 f8                	mov    %edi,%eax
+80103587:	e9 30 ff ff ff       	jmp    801034bc <writei+0x16c>
+8010358c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(ip->flags & I_EXTENT)
+80103590:	a8 01                	test   $0x1,%al
+80103592:	75 69                	jne    801035fd <writei+0x2ad>
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+80103594:	8b 7d 98             	mov    -0x68(%ebp),%edi
+80103597:	8b 47 6c             	mov    0x6c(%edi),%eax
+8010359a:	85 c0                	test   %eax,%eax
+8010359c:	75 10                	jne    801035ae <writei+0x25e>
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+8010359e:	8b 57 50             	mov    0x50(%edi),%edx
+801035a1:	8b 07                	mov    (%edi),%eax
+801035a3:	e8 48 e4 ff ff       	call   801019f0 <balloc>
+801035a8:	89 47 50             	mov    %eax,0x50(%edi)
+      ip->addrs[bn] = addr = bnext(ip);
+801035ab:	89 47 6c             	mov    %eax,0x6c(%edi)
+    bp = bread(ip->dev, bmap(ip, 0, 1));
+801035ae:	83 ec 08             	sub    $0x8,%esp
+801035b1:	50                   	push   %eax
+801035b2:	8b 75 98             	mov    -0x68(%ebp),%esi
+801035b5:	ff 36                	push   (%esi)
+801035b7:	e8 b4 ce ff ff       	call   80100470 <bread>
+    memmove(bp->data, data, ip->size);
+801035bc:	83 c4 0c             	add    $0xc,%esp
+801035bf:	ff 76 68             	push   0x68(%esi)
+801035c2:	53                   	push   %ebx
+    bp = bread(ip->dev, bmap(ip, 0, 1));
+801035c3:	89 c7                	mov    %eax,%edi
+    memmove(bp->data, data, ip->size);
+801035c5:	ff 70 60             	push   0x60(%eax)
+801035c8:	e8 13 47 00 00       	call   80107ce0 <memmove>
+    log_write(bp);
+801035cd:	89 3c 24             	mov    %edi,(%esp)
+801035d0:	e8 5b 23 00 00       	call   80105930 <log_write>
+    brelse(bp);
+801035d5:	89 3c 24             	mov    %edi,(%esp)
+801035d8:	e8 83 cf ff ff       	call   80100560 <brelse>
+801035dd:	83 c4 10             	add    $0x10,%esp
+801035e0:	e9 28 fe ff ff       	jmp    8010340d <writei+0xbd>
+  if(ip->flags & I_INLINE){
+801035e5:	83 e3 04             	and    $0x4,%ebx
+801035e8:	0f 85 e3 fd ff ff    	jne    801033d1 <writei+0x81>
+801035ee:	e9 33 fe ff ff       	jmp    80103426 <writei+0xd6>
+      return -1;
+801035f3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801035f8:	e9 cd fe ff ff       	jmp    801034ca <writei+0x17a>
+    return emap(ip, bn, alloc);
+801035fd:	8b 45 98             	mov    -0x68(%ebp),%eax
+80103600:	b9 01 00 00 00       	mov    $0x1,%ecx
+80103605:	31 d2                	xor    %edx,%edx
+80103607:	e8 c4 e5 ff ff       	call   80101bd0 <emap>
+8010360c:	eb a0                	jmp    801035ae <writei+0x25e>
+  if(ip->flags & I_INLINE){
+8010360e:	83 e3 04             	and    $0x4,%ebx
+80103611:	0f 85 19 ff ff ff    	jne    80103530 <writei+0x1e0>
+80103617:	e9 0a fe ff ff       	jmp    80103426 <writei+0xd6>
+8010361c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103620 <writelink>:
+{
+80103620:	55                   	push   %ebp
+80103621:	89 e5                	mov    %esp,%ebp
+80103623:	56                   	push   %esi
+80103624:	53                   	push   %ebx
+80103625:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103628:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010362b:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(ip->type != T_SYMLINK || ip->size != 0)
+8010362e:	66 83 7b 5c 04       	cmpw   $0x4,0x5c(%ebx)
+80103633:	75 52                	jne    80103687 <writelink+0x67>
+80103635:	8b 53 68             	mov    0x68(%ebx),%edx
+80103638:	85 d2                	test   %edx,%edx
+8010363a:	75 4b                	jne    80103687 <writelink+0x67>
+  if(n <= NINLINE){
+8010363c:	83 fe 34             	cmp    $0x34,%esi
+8010363f:	76 1f                	jbe    80103660 <writelink+0x40>
+  if(writei(ip, target, 0, n) != n)
+80103641:	56                   	push   %esi
+80103642:	6a 00                	push   $0x0
+80103644:	50                   	push   %eax
+80103645:	53                   	push   %ebx
+80103646:	e8 05 fd ff ff       	call   80103350 <writei>
+8010364b:	83 c4 10             	add    $0x10,%esp
+8010364e:	39 f0                	cmp    %esi,%eax
+80103650:	75 42                	jne    80103694 <writelink+0x74>
+}
+80103652:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103655:	5b                   	pop    %ebx
+80103656:	5e                   	pop    %esi
+80103657:	5d                   	pop    %ebp
+80103658:	c3                   	ret
+80103659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memmove(ip->addrs, target, n);
+80103660:	83 ec 04             	sub    $0x4,%esp
+80103663:	56                   	push   %esi
+80103664:	50                   	push   %eax
+80103665:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80103668:	50                   	push   %eax
+80103669:	e8 72 46 00 00       	call   80107ce0 <memmove>
+    ip->flags |= I_INLINE;
+8010366e:	66 83 4b 5e 04       	orw    $0x4,0x5e(%ebx)
+    iupdate(ip);
+80103673:	83 c4 10             	add    $0x10,%esp
+    ip->size = n;
+80103676:	89 73 68             	mov    %esi,0x68(%ebx)
+    iupdate(ip);
+80103679:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010367c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010367f:	5b                   	pop    %ebx
+80103680:	5e                   	pop    %esi
+80103681:	5d                   	pop    %ebp
+    iupdate(ip);
+80103682:	e9 f9 f0 ff ff       	jmp    80102780 <iupdate>
+    panic("writelink");
+80103687:	83 ec 0c             	sub    $0xc,%esp
+8010368a:	68 2a af 10 80       	push   $0x8010af2a
+8010368f:	e8 9c d0 ff ff       	call   80100730 <panic>
+    panic("writelink: writei");
+80103694:	83 ec 0c             	sub    $0xc,%esp
+80103697:	68 34 af 10 80       	push   $0x8010af34
+8010369c:	e8 8f d0 ff ff       	call   80100730 <panic>
+801036a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036af:	90                   	nop
+
+801036b0 <readlink>:
+{
+801036b0:	55                   	push   %ebp
+801036b1:	89 e5                	mov    %esp,%ebp
+801036b3:	56                   	push   %esi
+801036b4:	53                   	push   %ebx
+801036b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801036b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ip->type != T_SYMLINK || ip->size >= n)
+801036bb:	66 83 7b 5c 04       	cmpw   $0x4,0x5c(%ebx)
+801036c0:	75 2e                	jne    801036f0 <readlink+0x40>
+801036c2:	8b 43 68             	mov    0x68(%ebx),%eax
+801036c5:	3b 45 10             	cmp    0x10(%ebp),%eax
+801036c8:	73 26                	jae    801036f0 <readlink+0x40>
+  if(ip->type == T_DEV){
+801036ca:	83 ec 0c             	sub    $0xc,%esp
+801036cd:	31 c9                	xor    %ecx,%ecx
+801036cf:	89 f2                	mov    %esi,%edx
+801036d1:	50                   	push   %eax
+801036d2:	89 d8                	mov    %ebx,%eax
+801036d4:	e8 87 ec ff ff       	call   80102360 <readi.part.0>
+  if(readi(ip, buf, 0, ip->size) != ip->size)
+801036d9:	83 c4 10             	add    $0x10,%esp
+801036dc:	3b 43 68             	cmp    0x68(%ebx),%eax
+801036df:	75 0f                	jne    801036f0 <readlink+0x40>
+  buf[ip->size] = 0;
+801036e1:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return ip->size;
+801036e5:	8b 43 68             	mov    0x68(%ebx),%eax
+}
+801036e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801036eb:	5b                   	pop    %ebx
+801036ec:	5e                   	pop    %esi
+801036ed:	5d                   	pop    %ebp
+801036ee:	c3                   	ret
+801036ef:	90                   	nop
+    return -1;
+801036f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801036f5:	eb f1                	jmp    801036e8 <readlink+0x38>
+801036f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036fe:	66 90                	xchg   %ax,%ax
+
+80103700 <namecmp>:
+{
+80103700:	55                   	push   %ebp
+80103701:	89 e5                	mov    %esp,%ebp
+80103703:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80103706:	6a 0e                	push   $0xe
+80103708:	ff 75 0c             	push   0xc(%ebp)
+8010370b:	ff 75 08             	push   0x8(%ebp)
+8010370e:	e8 3d 46 00 00       	call   80107d50 <strncmp>
+}
+80103713:	c9                   	leave
+80103714:	c3                   	ret
+80103715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010371c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103720 <dcacheput>:
+{
+80103720:	55                   	push   %ebp
+  h = 2166136261U;
+80103721:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+{
+80103726:	89 e5                	mov    %esp,%ebp
+80103728:	57                   	push   %edi
+80103729:	56                   	push   %esi
+8010372a:	53                   	push   %ebx
+8010372b:	83 ec 2c             	sub    $0x2c,%esp
+8010372e:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103731:	8b 7d 10             	mov    0x10(%ebp),%edi
+80103734:	8b 75 08             	mov    0x8(%ebp),%esi
+80103737:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010373a:	89 c1                	mov    %eax,%ecx
+8010373c:	8d 58 0e             	lea    0xe(%eax),%ebx
+8010373f:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80103742:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103748:	0f b6 01             	movzbl (%ecx),%eax
+8010374b:	84 c0                	test   %al,%al
+8010374d:	74 0f                	je     8010375e <dcacheput+0x3e>
+    h = (h ^ (uchar)name[i]) * 16777619U;
+8010374f:	31 c2                	xor    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103751:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619U;
+80103754:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010375a:	39 cb                	cmp    %ecx,%ebx
+8010375c:	75 ea                	jne    80103748 <dcacheput+0x28>
+  return &dcache[(dirhash(name) ^ dp->inum*2654435761U ^ dp->dev) % NDCSET];
+8010375e:	69 46 04 b1 79 37 9e 	imul   $0x9e3779b1,0x4(%esi),%eax
+80103765:	33 06                	xor    (%esi),%eax
+  acquire(&s->lock);
+80103767:	83 ec 0c             	sub    $0xc,%esp
+  return &dcache[(dirhash(name) ^ dp->inum*2654435761U ^ dp->dev) % NDCSET];
+8010376a:	31 d0                	xor    %edx,%eax
+8010376c:	83 e0 7f             	and    $0x7f,%eax
+8010376f:	69 d8 b4 00 00 00    	imul   $0xb4,%eax,%ebx
+80103775:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80103778:	8d bb c0 1f 11 80    	lea    -0x7feee040(%ebx),%edi
+  acquire(&s->lock);
+8010377e:	57                   	push   %edi
+8010377f:	e8 ec 43 00 00       	call   80107b70 <acquire>
+  for(e = s->e; e < s->e+NDCWAY; e++)
+80103784:	8d 4b 34             	lea    0x34(%ebx),%ecx
+80103787:	8d 97 a4 00 00 00    	lea    0xa4(%edi),%edx
+8010378d:	83 c4 10             	add    $0x10,%esp
+80103790:	81 c3 f4 1f 11 80    	add    $0x80111ff4,%ebx
+80103796:	39 d3                	cmp    %edx,%ebx
+80103798:	73 15                	jae    801037af <dcacheput+0x8f>
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+8010379a:	80 7b 1a 00          	cmpb   $0x0,0x1a(%ebx)
+8010379e:	74 08                	je     801037a8 <dcacheput+0x88>
+801037a0:	8b 46 04             	mov    0x4(%esi),%eax
+801037a3:	39 43 04             	cmp    %eax,0x4(%ebx)
+801037a6:	74 48                	je     801037f0 <dcacheput+0xd0>
+  for(e = s->e; e < s->e+NDCWAY; e++)
+801037a8:	83 c3 1c             	add    $0x1c,%ebx
+801037ab:	39 d3                	cmp    %edx,%ebx
+801037ad:	72 eb                	jb     8010379a <dcacheput+0x7a>
+  if(e == s->e+NDCWAY){
+801037af:	39 da                	cmp    %ebx,%edx
+801037b1:	74 6d                	je     80103820 <dcacheput+0x100>
+  e->dev = dp->dev;
+801037b3:	8b 06                	mov    (%esi),%eax
+  strncpy(e->name, name, DIRSIZ);
+801037b5:	83 ec 04             	sub    $0x4,%esp
+  e->dev = dp->dev;
+801037b8:	89 03                	mov    %eax,(%ebx)
+  e->dinum = dp->inum;
+801037ba:	8b 46 04             	mov    0x4(%esi),%eax
+801037bd:	89 43 04             	mov    %eax,0x4(%ebx)
+  e->inum = inum;
+801037c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801037c3:	89 43 08             	mov    %eax,0x8(%ebx)
+  strncpy(e->name, name, DIRSIZ);
+801037c6:	8d 43 0c             	lea    0xc(%ebx),%eax
+801037c9:	6a 0e                	push   $0xe
+801037cb:	ff 75 e4             	push   -0x1c(%ebp)
+801037ce:	50                   	push   %eax
+801037cf:	e8 cc 45 00 00       	call   80107da0 <strncpy>
+  e->used = 1;
+801037d4:	c6 43 1a 01          	movb   $0x1,0x1a(%ebx)
+  release(&s->lock);
+801037d8:	83 c4 10             	add    $0x10,%esp
+801037db:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+801037de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801037e1:	5b                   	pop    %ebx
+801037e2:	5e                   	pop    %esi
+801037e3:	5f                   	pop    %edi
+801037e4:	5d                   	pop    %ebp
+  release(&s->lock);
+801037e5:	e9 26 43 00 00       	jmp    80107b10 <release>
+801037ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+801037f0:	8b 06                	mov    (%esi),%eax
+801037f2:	39 03                	cmp    %eax,(%ebx)
+801037f4:	75 b2                	jne    801037a8 <dcacheput+0x88>
+  return strncmp(s, t, DIRSIZ);
+801037f6:	83 ec 04             	sub    $0x4,%esp
+       namecmp(e->name, name) == 0)
+801037f9:	8d 43 0c             	lea    0xc(%ebx),%eax
+801037fc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+801037ff:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80103802:	6a 0e                	push   $0xe
+80103804:	ff 75 e4             	push   -0x1c(%ebp)
+80103807:	50                   	push   %eax
+80103808:	e8 43 45 00 00       	call   80107d50 <strncmp>
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+8010380d:	83 c4 10             	add    $0x10,%esp
+80103810:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80103813:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80103816:	85 c0                	test   %eax,%eax
+80103818:	75 8e                	jne    801037a8 <dcacheput+0x88>
+8010381a:	eb 93                	jmp    801037af <dcacheput+0x8f>
+8010381c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    e = &s->e[s->next];
+80103820:	69 45 dc b4 00 00 00 	imul   $0xb4,-0x24(%ebp),%eax
+80103827:	8b 90 64 20 11 80    	mov    -0x7feedf9c(%eax),%edx
+8010382d:	6b da 1c             	imul   $0x1c,%edx,%ebx
+    s->next = (s->next + 1) % NDCWAY;
+80103830:	83 c2 01             	add    $0x1,%edx
+    e = &s->e[s->next];
+80103833:	8d 9c 19 c0 1f 11 80 	lea    -0x7feee040(%ecx,%ebx,1),%ebx
+    s->next = (s->next + 1) % NDCWAY;
+8010383a:	89 d1                	mov    %edx,%ecx
+8010383c:	c1 f9 1f             	sar    $0x1f,%ecx
+8010383f:	c1 e9 1e             	shr    $0x1e,%ecx
+80103842:	01 ca                	add    %ecx,%edx
+80103844:	83 e2 03             	and    $0x3,%edx
+80103847:	29 ca                	sub    %ecx,%edx
+80103849:	89 90 64 20 11 80    	mov    %edx,-0x7feedf9c(%eax)
+8010384f:	e9 5f ff ff ff       	jmp    801037b3 <dcacheput+0x93>
+80103854:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010385b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010385f:	90                   	nop
+
+80103860 <dcachestat>:
+{
+80103860:	55                   	push   %ebp
+80103861:	89 e5                	mov    %esp,%ebp
+80103863:	56                   	push   %esi
+80103864:	53                   	push   %ebx
+80103865:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(s = dcache; s < dcache+NDCSET; s++){
+80103868:	bb c0 1f 11 80       	mov    $0x80111fc0,%ebx
+  memset(st, 0, sizeof(*st));
+8010386d:	83 ec 04             	sub    $0x4,%esp
+80103870:	6a 0c                	push   $0xc
+80103872:	6a 00                	push   $0x0
+80103874:	56                   	push   %esi
+80103875:	e8 d6 43 00 00       	call   80107c50 <memset>
+8010387a:	83 c4 10             	add    $0x10,%esp
+8010387d:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&s->lock);
+80103880:	83 ec 0c             	sub    $0xc,%esp
+80103883:	53                   	push   %ebx
+80103884:	e8 e7 42 00 00       	call   80107b70 <acquire>
+    st->nhit += s->st.nhit;
+80103889:	8b 83 a8 00 00 00    	mov    0xa8(%ebx),%eax
+8010388f:	01 06                	add    %eax,(%esi)
+    st->nneg += s->st.nneg;
+80103891:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+80103897:	01 46 04             	add    %eax,0x4(%esi)
+    st->nmiss += s->st.nmiss;
+8010389a:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+801038a0:	01 46 08             	add    %eax,0x8(%esi)
+    release(&s->lock);
+801038a3:	89 1c 24             	mov    %ebx,(%esp)
+  for(s = dcache; s < dcache+NDCSET; s++){
+801038a6:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+    release(&s->lock);
+801038ac:	e8 5f 42 00 00       	call   80107b10 <release>
+  for(s = dcache; s < dcache+NDCSET; s++){
+801038b1:	83 c4 10             	add    $0x10,%esp
+801038b4:	81 fb c0 79 11 80    	cmp    $0x801179c0,%ebx
+801038ba:	75 c4                	jne    80103880 <dcachestat+0x20>
+}
+801038bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801038bf:	5b                   	pop    %ebx
+801038c0:	5e                   	pop    %esi
+801038c1:	5d                   	pop    %ebp
+801038c2:	c3                   	ret
+801038c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801038ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801038d0 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+801038d0:	55                   	push   %ebp
+801038d1:	89 e5                	mov    %esp,%ebp
+801038d3:	57                   	push   %edi
+801038d4:	56                   	push   %esi
+801038d5:	53                   	push   %ebx
+801038d6:	83 ec 2c             	sub    $0x2c,%esp
+801038d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801038dc:	8b 45 10             	mov    0x10(%ebp),%eax
+801038df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint free, inum;
+  int r;
+
+  if(dp->type != T_DIR)
+801038e2:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+{
+801038e7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(dp->type != T_DIR)
+801038ea:	0f 85 f9 01 00 00    	jne    80103ae9 <dirlookup+0x219>
+    panic("dirlookup not DIR");
+
+  // The name cache does not know offsets.
+  if(poff == 0 && dcacheget(dp, name, &inum))
+801038f0:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801038f3:	85 d2                	test   %edx,%edx
+801038f5:	0f 84 85 00 00 00    	je     80103980 <dirlookup+0xb0>
+    return inum ? iget(dp->dev, inum) : 0;
+
+  if((dp->flags & I_DIRHASH) == 0)
+801038fb:	f6 43 5e 02          	testb  $0x2,0x5e(%ebx)
+801038ff:	74 47                	je     80103948 <dirlookup+0x78>
+    inum = dirscan(dp, name, 0, dp->size, poff, 0);
+  else if((r = dirprobe(dp, name, poff, &free)) > 0)
+80103901:	83 ec 0c             	sub    $0xc,%esp
+80103904:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80103907:	89 f2                	mov    %esi,%edx
+80103909:	50                   	push   %eax
+8010390a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+8010390d:	89 d8                	mov    %ebx,%eax
+8010390f:	e8 6c f7 ff ff       	call   80103080 <dirprobe>
+80103914:	83 c4 10             	add    $0x10,%esp
+80103917:	89 45 d0             	mov    %eax,-0x30(%ebp)
+8010391a:	89 c7                	mov    %eax,%edi
+8010391c:	85 c0                	test   %eax,%eax
+8010391e:	0f 8e fc 00 00 00    	jle    80103a20 <dirlookup+0x150>
+    inum = r;
+  else if((inum = dirscan(dp, name, 0, DIRHASH_START*BSIZE, poff, 0)) == 0 &&
+          r < 0)
+    inum = dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, poff, 0);
+  dcacheput(dp, name, inum);
+80103924:	83 ec 04             	sub    $0x4,%esp
+80103927:	57                   	push   %edi
+80103928:	56                   	push   %esi
+80103929:	53                   	push   %ebx
+8010392a:	e8 f1 fd ff ff       	call   80103720 <dcacheput>
+8010392f:	83 c4 10             	add    $0x10,%esp
+  if(inum)
+    return iget(dp->dev, inum);
+80103932:	8b 03                	mov    (%ebx),%eax
+80103934:	89 fa                	mov    %edi,%edx
+  return 0;
+}
+80103936:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103939:	5b                   	pop    %ebx
+8010393a:	5e                   	pop    %esi
+8010393b:	5f                   	pop    %edi
+8010393c:	5d                   	pop    %ebp
+    return iget(dp->dev, inum);
+8010393d:	e9 3e e1 ff ff       	jmp    80101a80 <iget>
+80103942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    inum = dirscan(dp, name, 0, dp->size, poff, 0);
+80103948:	83 ec 04             	sub    $0x4,%esp
+8010394b:	31 c9                	xor    %ecx,%ecx
+8010394d:	6a 00                	push   $0x0
+8010394f:	ff 75 d4             	push   -0x2c(%ebp)
+80103952:	ff 73 68             	push   0x68(%ebx)
+    inum = dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, poff, 0);
+80103955:	89 f2                	mov    %esi,%edx
+80103957:	89 d8                	mov    %ebx,%eax
+80103959:	e8 92 f8 ff ff       	call   801031f0 <dirscan>
+8010395e:	83 c4 10             	add    $0x10,%esp
+  dcacheput(dp, name, inum);
+80103961:	83 ec 04             	sub    $0x4,%esp
+    inum = dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, poff, 0);
+80103964:	89 c7                	mov    %eax,%edi
+  dcacheput(dp, name, inum);
+80103966:	50                   	push   %eax
+80103967:	56                   	push   %esi
+80103968:	53                   	push   %ebx
+80103969:	e8 b2 fd ff ff       	call   80103720 <dcacheput>
+  if(inum)
+8010396e:	83 c4 10             	add    $0x10,%esp
+80103971:	85 ff                	test   %edi,%edi
+80103973:	75 bd                	jne    80103932 <dirlookup+0x62>
+}
+80103975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103978:	31 c0                	xor    %eax,%eax
+8010397a:	5b                   	pop    %ebx
+8010397b:	5e                   	pop    %esi
+8010397c:	5f                   	pop    %edi
+8010397d:	5d                   	pop    %ebp
+8010397e:	c3                   	ret
+8010397f:	90                   	nop
+80103980:	89 f1                	mov    %esi,%ecx
+80103982:	8d 7e 0e             	lea    0xe(%esi),%edi
+  h = 2166136261U;
+80103985:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+8010398a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103990:	0f b6 01             	movzbl (%ecx),%eax
+80103993:	84 c0                	test   %al,%al
+80103995:	74 0f                	je     801039a6 <dirlookup+0xd6>
+    h = (h ^ (uchar)name[i]) * 16777619U;
+80103997:	31 d0                	xor    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103999:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619U;
+8010399c:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801039a2:	39 cf                	cmp    %ecx,%edi
+801039a4:	75 ea                	jne    80103990 <dirlookup+0xc0>
+  return &dcache[(dirhash(name) ^ dp->inum*2654435761U ^ dp->dev) % NDCSET];
+801039a6:	69 43 04 b1 79 37 9e 	imul   $0x9e3779b1,0x4(%ebx),%eax
+801039ad:	33 03                	xor    (%ebx),%eax
+  acquire(&s->lock);
+801039af:	83 ec 0c             	sub    $0xc,%esp
+  return &dcache[(dirhash(name) ^ dp->inum*2654435761U ^ dp->dev) % NDCSET];
+801039b2:	31 d0                	xor    %edx,%eax
+801039b4:	83 e0 7f             	and    $0x7f,%eax
+801039b7:	69 f8 b4 00 00 00    	imul   $0xb4,%eax,%edi
+801039bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801039c0:	8d 8f c0 1f 11 80    	lea    -0x7feee040(%edi),%ecx
+  for(e = s->e; e < s->e+NDCWAY; e++){
+801039c6:	81 c7 f4 1f 11 80    	add    $0x80111ff4,%edi
+  acquire(&s->lock);
+801039cc:	51                   	push   %ecx
+801039cd:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+801039d0:	e8 9b 41 00 00       	call   80107b70 <acquire>
+  for(e = s->e; e < s->e+NDCWAY; e++){
+801039d5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+801039d8:	83 c4 10             	add    $0x10,%esp
+801039db:	8d 91 a4 00 00 00    	lea    0xa4(%ecx),%edx
+801039e1:	39 d7                	cmp    %edx,%edi
+801039e3:	73 15                	jae    801039fa <dirlookup+0x12a>
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+801039e5:	80 7f 1a 00          	cmpb   $0x0,0x1a(%edi)
+801039e9:	74 08                	je     801039f3 <dirlookup+0x123>
+801039eb:	8b 43 04             	mov    0x4(%ebx),%eax
+801039ee:	39 47 04             	cmp    %eax,0x4(%edi)
+801039f1:	74 6d                	je     80103a60 <dirlookup+0x190>
+  for(e = s->e; e < s->e+NDCWAY; e++){
+801039f3:	83 c7 1c             	add    $0x1c,%edi
+801039f6:	39 d7                	cmp    %edx,%edi
+801039f8:	72 eb                	jb     801039e5 <dirlookup+0x115>
+  s->st.nmiss++;
+801039fa:	69 45 d0 b4 00 00 00 	imul   $0xb4,-0x30(%ebp),%eax
+  release(&s->lock);
+80103a01:	83 ec 0c             	sub    $0xc,%esp
+  s->st.nmiss++;
+80103a04:	83 80 70 20 11 80 01 	addl   $0x1,-0x7feedf90(%eax)
+  release(&s->lock);
+80103a0b:	51                   	push   %ecx
+80103a0c:	e8 ff 40 00 00       	call   80107b10 <release>
+80103a11:	83 c4 10             	add    $0x10,%esp
+80103a14:	e9 e2 fe ff ff       	jmp    801038fb <dirlookup+0x2b>
+80103a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  else if((inum = dirscan(dp, name, 0, DIRHASH_START*BSIZE, poff, 0)) == 0 &&
+80103a20:	83 ec 04             	sub    $0x4,%esp
+80103a23:	31 c9                	xor    %ecx,%ecx
+80103a25:	89 f2                	mov    %esi,%edx
+80103a27:	89 d8                	mov    %ebx,%eax
+80103a29:	6a 00                	push   $0x0
+80103a2b:	ff 75 d4             	push   -0x2c(%ebp)
+80103a2e:	68 00 08 00 00       	push   $0x800
+80103a33:	e8 b8 f7 ff ff       	call   801031f0 <dirscan>
+80103a38:	83 c4 10             	add    $0x10,%esp
+80103a3b:	89 c7                	mov    %eax,%edi
+80103a3d:	85 c0                	test   %eax,%eax
+80103a3f:	0f 85 df fe ff ff    	jne    80103924 <dirlookup+0x54>
+80103a45:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80103a48:	85 c0                	test   %eax,%eax
+80103a4a:	75 6c                	jne    80103ab8 <dirlookup+0x1e8>
+  dcacheput(dp, name, inum);
+80103a4c:	83 ec 04             	sub    $0x4,%esp
+80103a4f:	6a 00                	push   $0x0
+80103a51:	56                   	push   %esi
+80103a52:	53                   	push   %ebx
+80103a53:	e8 c8 fc ff ff       	call   80103720 <dcacheput>
+80103a58:	83 c4 10             	add    $0x10,%esp
+80103a5b:	e9 15 ff ff ff       	jmp    80103975 <dirlookup+0xa5>
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+80103a60:	8b 03                	mov    (%ebx),%eax
+80103a62:	39 07                	cmp    %eax,(%edi)
+80103a64:	75 8d                	jne    801039f3 <dirlookup+0x123>
+  return strncmp(s, t, DIRSIZ);
+80103a66:	83 ec 04             	sub    $0x4,%esp
+       namecmp(e->name, name) == 0){
+80103a69:	8d 47 0c             	lea    0xc(%edi),%eax
+80103a6c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+80103a6f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80103a72:	6a 0e                	push   $0xe
+80103a74:	56                   	push   %esi
+80103a75:	50                   	push   %eax
+80103a76:	e8 d5 42 00 00       	call   80107d50 <strncmp>
+    if(e->used && e->dinum == dp->inum && e->dev == dp->dev &&
+80103a7b:	83 c4 10             	add    $0x10,%esp
+80103a7e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103a81:	8b 55 c8             	mov    -0x38(%ebp),%edx
+80103a84:	85 c0                	test   %eax,%eax
+80103a86:	0f 85 67 ff ff ff    	jne    801039f3 <dirlookup+0x123>
+      *pinum = e->inum;
+80103a8c:	8b 77 08             	mov    0x8(%edi),%esi
+        s->st.nhit++;
+80103a8f:	69 45 d0 b4 00 00 00 	imul   $0xb4,-0x30(%ebp),%eax
+      if(e->inum)
+80103a96:	85 f6                	test   %esi,%esi
+80103a98:	75 33                	jne    80103acd <dirlookup+0x1fd>
+      release(&s->lock);
+80103a9a:	83 ec 0c             	sub    $0xc,%esp
+        s->st.nneg++;
+80103a9d:	83 80 6c 20 11 80 01 	addl   $0x1,-0x7feedf94(%eax)
+      release(&s->lock);
+80103aa4:	51                   	push   %ecx
+80103aa5:	e8 66 40 00 00       	call   80107b10 <release>
+80103aaa:	83 c4 10             	add    $0x10,%esp
+80103aad:	e9 c3 fe ff ff       	jmp    80103975 <dirlookup+0xa5>
+80103ab2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    inum = dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, poff, 0);
+80103ab8:	83 ec 04             	sub    $0x4,%esp
+80103abb:	b9 00 08 01 00       	mov    $0x10800,%ecx
+80103ac0:	6a 00                	push   $0x0
+80103ac2:	ff 75 d4             	push   -0x2c(%ebp)
+80103ac5:	ff 73 68             	push   0x68(%ebx)
+80103ac8:	e9 88 fe ff ff       	jmp    80103955 <dirlookup+0x85>
+      release(&s->lock);
+80103acd:	83 ec 0c             	sub    $0xc,%esp
+        s->st.nhit++;
+80103ad0:	83 80 68 20 11 80 01 	addl   $0x1,-0x7feedf98(%eax)
+      release(&s->lock);
+80103ad7:	51                   	push   %ecx
+80103ad8:	e8 33 40 00 00       	call   80107b10 <release>
+    return inum ? iget(dp->dev, inum) : 0;
+80103add:	8b 03                	mov    (%ebx),%eax
+80103adf:	83 c4 10             	add    $0x10,%esp
+80103ae2:	89 f2                	mov    %esi,%edx
+80103ae4:	e9 4d fe ff ff       	jmp    80103936 <dirlookup+0x66>
+    panic("dirlookup not DIR");
+80103ae9:	83 ec 0c             	sub    $0xc,%esp
+80103aec:	68 46 af 10 80       	push   $0x8010af46
+80103af1:	e8 3a cc ff ff       	call   80100730 <panic>
+80103af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103b00 <namex>:
+// and reads an inline target from the cached inode, so going through
+// the same link again reads no blocks.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, int follow, char *name)
+{
+80103b00:	55                   	push   %ebp
+80103b01:	89 e5                	mov    %esp,%ebp
+80103b03:	57                   	push   %edi
+80103b04:	56                   	push   %esi
+80103b05:	53                   	push   %ebx
+80103b06:	89 c3                	mov    %eax,%ebx
+80103b08:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+  struct inode *ip, *next;
+  char buf[MAXPATH];
+  int hops;
+
+  if(*path == '/')
+80103b0e:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+80103b11:	89 95 e0 fe ff ff    	mov    %edx,-0x120(%ebp)
+80103b17:	89 8d d8 fe ff ff    	mov    %ecx,-0x128(%ebp)
+  if(*path == '/')
+80103b1d:	0f 84 73 03 00 00    	je     80103e96 <namex+0x396>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80103b23:	e8 f8 2d 00 00       	call   80106920 <myproc>
+  acquire(&bk->lock);
+80103b28:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80103b2b:	8b 78 6c             	mov    0x6c(%eax),%edi
+  return &icache.bucket[IHASH(ip->dev, ip->inum)];
+80103b2e:	b8 11 08 04 02       	mov    $0x2040811,%eax
+80103b33:	8b 0f                	mov    (%edi),%ecx
+80103b35:	c1 e1 1b             	shl    $0x1b,%ecx
+80103b38:	0b 4f 04             	or     0x4(%edi),%ecx
+80103b3b:	f7 e1                	mul    %ecx
+80103b3d:	89 c8                	mov    %ecx,%eax
+80103b3f:	29 d0                	sub    %edx,%eax
+80103b41:	d1 e8                	shr    %eax
+80103b43:	01 c2                	add    %eax,%edx
+80103b45:	c1 ea 06             	shr    $0x6,%edx
+80103b48:	89 d0                	mov    %edx,%eax
+80103b4a:	c1 e0 07             	shl    $0x7,%eax
+80103b4d:	29 d0                	sub    %edx,%eax
+80103b4f:	29 c1                	sub    %eax,%ecx
+  acquire(&bk->lock);
+80103b51:	6b f1 3c             	imul   $0x3c,%ecx,%esi
+80103b54:	81 c6 10 f6 10 80    	add    $0x8010f610,%esi
+80103b5a:	56                   	push   %esi
+80103b5b:	e8 10 40 00 00       	call   80107b70 <acquire>
+  ip->ref++;
+80103b60:	83 47 08 01          	addl   $0x1,0x8(%edi)
+  release(&bk->lock);
+80103b64:	89 34 24             	mov    %esi,(%esp)
+80103b67:	e8 a4 3f 00 00       	call   80107b10 <release>
+80103b6c:	83 c4 10             	add    $0x10,%esp
+    if(nameiparent && *path == '\0'){
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103b6f:	c7 85 dc fe ff ff 00 	movl   $0x0,-0x124(%ebp)
+80103b76:	00 00 00 
+80103b79:	eb 08                	jmp    80103b83 <namex+0x83>
+80103b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103b7f:	90                   	nop
+    path++;
+80103b80:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103b83:	0f b6 03             	movzbl (%ebx),%eax
+80103b86:	3c 2f                	cmp    $0x2f,%al
+80103b88:	74 f6                	je     80103b80 <namex+0x80>
+  if(*path == 0)
+80103b8a:	84 c0                	test   %al,%al
+80103b8c:	0f 84 8e 02 00 00    	je     80103e20 <namex+0x320>
+  while(*path != '/' && *path != 0)
+80103b92:	0f b6 03             	movzbl (%ebx),%eax
+80103b95:	84 c0                	test   %al,%al
+80103b97:	0f 84 ed 02 00 00    	je     80103e8a <namex+0x38a>
+80103b9d:	89 de                	mov    %ebx,%esi
+80103b9f:	3c 2f                	cmp    $0x2f,%al
+80103ba1:	0f 84 e3 02 00 00    	je     80103e8a <namex+0x38a>
+80103ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103bae:	66 90                	xchg   %ax,%ax
+80103bb0:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+    path++;
+80103bb4:	83 c6 01             	add    $0x1,%esi
+  while(*path != '/' && *path != 0)
+80103bb7:	3c 2f                	cmp    $0x2f,%al
+80103bb9:	74 04                	je     80103bbf <namex+0xbf>
+80103bbb:	84 c0                	test   %al,%al
+80103bbd:	75 f1                	jne    80103bb0 <namex+0xb0>
+  len = path - s;
+80103bbf:	89 f0                	mov    %esi,%eax
+80103bc1:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80103bc3:	83 f8 0d             	cmp    $0xd,%eax
+80103bc6:	0f 8e 24 02 00 00    	jle    80103df0 <namex+0x2f0>
+    memmove(name, s, DIRSIZ);
+80103bcc:	83 ec 04             	sub    $0x4,%esp
+80103bcf:	6a 0e                	push   $0xe
+80103bd1:	53                   	push   %ebx
+    path++;
+80103bd2:	89 f3                	mov    %esi,%ebx
+    memmove(name, s, DIRSIZ);
+80103bd4:	ff 75 08             	push   0x8(%ebp)
+80103bd7:	e8 04 41 00 00       	call   80107ce0 <memmove>
+80103bdc:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80103bdf:	80 3e 2f             	cmpb   $0x2f,(%esi)
+80103be2:	75 0c                	jne    80103bf0 <namex+0xf0>
+80103be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80103be8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103beb:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80103bee:	74 f8                	je     80103be8 <namex+0xe8>
+    ilock(ip);
+80103bf0:	83 ec 0c             	sub    $0xc,%esp
+80103bf3:	57                   	push   %edi
+80103bf4:	e8 77 ec ff ff       	call   80102870 <ilock>
+    if(ip->type != T_DIR){
+80103bf9:	83 c4 10             	add    $0x10,%esp
+80103bfc:	66 83 7f 5c 01       	cmpw   $0x1,0x5c(%edi)
+80103c01:	0f 85 c7 02 00 00    	jne    80103ece <namex+0x3ce>
+    if(nameiparent && *path == '\0'){
+80103c07:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+80103c0d:	85 c0                	test   %eax,%eax
+80103c0f:	74 09                	je     80103c1a <namex+0x11a>
+80103c11:	80 3b 00             	cmpb   $0x0,(%ebx)
+80103c14:	0f 84 2f 03 00 00    	je     80103f49 <namex+0x449>
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103c1a:	83 ec 04             	sub    $0x4,%esp
+80103c1d:	6a 00                	push   $0x0
+80103c1f:	ff 75 08             	push   0x8(%ebp)
+80103c22:	57                   	push   %edi
+80103c23:	e8 a8 fc ff ff       	call   801038d0 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103c28:	8d 57 0c             	lea    0xc(%edi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103c2b:	83 c4 10             	add    $0x10,%esp
+80103c2e:	89 c6                	mov    %eax,%esi
+80103c30:	85 c0                	test   %eax,%eax
+80103c32:	0f 84 d3 02 00 00    	je     80103f0b <namex+0x40b>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103c38:	83 ec 0c             	sub    $0xc,%esp
+80103c3b:	52                   	push   %edx
+80103c3c:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+80103c42:	e8 f9 3c 00 00       	call   80107940 <holdingsleep>
+80103c47:	83 c4 10             	add    $0x10,%esp
+80103c4a:	85 c0                	test   %eax,%eax
+80103c4c:	0f 84 22 03 00 00    	je     80103f74 <namex+0x474>
+80103c52:	8b 47 08             	mov    0x8(%edi),%eax
+80103c55:	85 c0                	test   %eax,%eax
+80103c57:	0f 8e 17 03 00 00    	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103c5d:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+80103c63:	83 ec 0c             	sub    $0xc,%esp
+80103c66:	52                   	push   %edx
+80103c67:	e8 94 3c 00 00       	call   80107900 <releasesleep>
+      iunlockput(ip);
+      return 0;
+    }
+    iunlock(ip);
+    ilock(next);
+80103c6c:	89 34 24             	mov    %esi,(%esp)
+80103c6f:	e8 fc eb ff ff       	call   80102870 <ilock>
+    if(next->type == T_SYMLINK && (*path != '\0' || follow)){
+80103c74:	83 c4 10             	add    $0x10,%esp
+80103c77:	66 83 7e 5c 04       	cmpw   $0x4,0x5c(%esi)
+80103c7c:	0f 85 1e 01 00 00    	jne    80103da0 <namex+0x2a0>
+80103c82:	80 3b 00             	cmpb   $0x0,(%ebx)
+80103c85:	75 0d                	jne    80103c94 <namex+0x194>
+80103c87:	f6 85 d8 fe ff ff 01 	testb  $0x1,-0x128(%ebp)
+80103c8e:	0f 84 0c 01 00 00    	je     80103da0 <namex+0x2a0>
+      if(++hops > MAXSYMLINKS ||
+80103c94:	83 85 dc fe ff ff 01 	addl   $0x1,-0x124(%ebp)
+80103c9b:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+80103ca1:	83 f8 08             	cmp    $0x8,%eax
+80103ca4:	0f 8f 96 01 00 00    	jg     80103e40 <namex+0x340>
+  if(ip->type != T_SYMLINK || ip->size >= n)
+80103caa:	8b 46 68             	mov    0x68(%esi),%eax
+80103cad:	83 f8 7f             	cmp    $0x7f,%eax
+80103cb0:	0f 87 8a 01 00 00    	ja     80103e40 <namex+0x340>
+  if(readi(ip, buf, 0, ip->size) != ip->size)
+80103cb6:	50                   	push   %eax
+80103cb7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+80103cbd:	6a 00                	push   $0x0
+80103cbf:	50                   	push   %eax
+80103cc0:	56                   	push   %esi
+80103cc1:	e8 6a f3 ff ff       	call   80103030 <readi>
+80103cc6:	83 c4 10             	add    $0x10,%esp
+80103cc9:	3b 46 68             	cmp    0x68(%esi),%eax
+80103ccc:	0f 85 6e 01 00 00    	jne    80103e40 <namex+0x340>
+  buf[ip->size] = 0;
+80103cd2:	c6 84 05 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%eax,1)
+80103cd9:	00 
+  return ip->size;
+80103cda:	8b 46 68             	mov    0x68(%esi),%eax
+  if((n = readlink(lp, target, sizeof(target))) < 0)
+80103cdd:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+80103ce3:	85 c0                	test   %eax,%eax
+80103ce5:	0f 88 55 01 00 00    	js     80103e40 <namex+0x340>
+  r = strlen(path);
+80103ceb:	83 ec 0c             	sub    $0xc,%esp
+80103cee:	53                   	push   %ebx
+80103cef:	e8 4c 41 00 00       	call   80107e40 <strlen>
+  if(n + 1 + r >= MAXPATH)
+80103cf4:	8b 8d e4 fe ff ff    	mov    -0x11c(%ebp),%ecx
+80103cfa:	83 c4 10             	add    $0x10,%esp
+80103cfd:	8d 51 01             	lea    0x1(%ecx),%edx
+80103d00:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+80103d03:	83 f9 7f             	cmp    $0x7f,%ecx
+80103d06:	0f 8f 34 01 00 00    	jg     80103e40 <namex+0x340>
+  memmove(buf + n + 1, path, r + 1);
+80103d0c:	83 ec 04             	sub    $0x4,%esp
+80103d0f:	83 c0 01             	add    $0x1,%eax
+80103d12:	50                   	push   %eax
+80103d13:	53                   	push   %ebx
+80103d14:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+80103d1a:	01 da                	add    %ebx,%edx
+80103d1c:	52                   	push   %edx
+80103d1d:	e8 be 3f 00 00       	call   80107ce0 <memmove>
+  memmove(buf, target, n);
+80103d22:	8b 9d e4 fe ff ff    	mov    -0x11c(%ebp),%ebx
+80103d28:	83 c4 0c             	add    $0xc,%esp
+80103d2b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+80103d31:	53                   	push   %ebx
+80103d32:	50                   	push   %eax
+80103d33:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+80103d39:	50                   	push   %eax
+80103d3a:	e8 a1 3f 00 00       	call   80107ce0 <memmove>
+  if(target[0] == '/'){
+80103d3f:	83 c4 10             	add    $0x10,%esp
+80103d42:	80 bd 68 ff ff ff 2f 	cmpb   $0x2f,-0x98(%ebp)
+  buf[n] = '/';
+80103d49:	c6 84 1d e8 fe ff ff 	movb   $0x2f,-0x118(%ebp,%ebx,1)
+80103d50:	2f 
+  if(target[0] == '/'){
+80103d51:	0f 84 55 01 00 00    	je     80103eac <namex+0x3ac>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103d57:	83 ec 0c             	sub    $0xc,%esp
+80103d5a:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80103d5d:	53                   	push   %ebx
+80103d5e:	e8 dd 3b 00 00       	call   80107940 <holdingsleep>
+80103d63:	83 c4 10             	add    $0x10,%esp
+80103d66:	85 c0                	test   %eax,%eax
+80103d68:	0f 84 06 02 00 00    	je     80103f74 <namex+0x474>
+80103d6e:	8b 4e 08             	mov    0x8(%esi),%ecx
+80103d71:	85 c9                	test   %ecx,%ecx
+80103d73:	0f 8e fb 01 00 00    	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103d79:	83 ec 0c             	sub    $0xc,%esp
+80103d7c:	53                   	push   %ebx
+        iunlockput(next);
+        iput(ip);
+        return 0;
+      }
+      iunlockput(next);
+      continue;
+80103d7d:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+  releasesleep(&ip->lock);
+80103d83:	e8 78 3b 00 00       	call   80107900 <releasesleep>
+  iput(ip);
+80103d88:	89 34 24             	mov    %esi,(%esp)
+80103d8b:	e8 20 ec ff ff       	call   801029b0 <iput>
+      continue;
+80103d90:	83 c4 10             	add    $0x10,%esp
+80103d93:	e9 eb fd ff ff       	jmp    80103b83 <namex+0x83>
+80103d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d9f:	90                   	nop
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103da0:	8d 56 0c             	lea    0xc(%esi),%edx
+80103da3:	83 ec 0c             	sub    $0xc,%esp
+80103da6:	52                   	push   %edx
+80103da7:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+80103dad:	e8 8e 3b 00 00       	call   80107940 <holdingsleep>
+80103db2:	83 c4 10             	add    $0x10,%esp
+80103db5:	85 c0                	test   %eax,%eax
+80103db7:	0f 84 b7 01 00 00    	je     80103f74 <namex+0x474>
+80103dbd:	8b 56 08             	mov    0x8(%esi),%edx
+80103dc0:	85 d2                	test   %edx,%edx
+80103dc2:	0f 8e ac 01 00 00    	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103dc8:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+80103dce:	83 ec 0c             	sub    $0xc,%esp
+80103dd1:	52                   	push   %edx
+80103dd2:	e8 29 3b 00 00       	call   80107900 <releasesleep>
+    }
+    iunlock(next);
+    iput(ip);
+80103dd7:	89 3c 24             	mov    %edi,(%esp)
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103dda:	89 f7                	mov    %esi,%edi
+    iput(ip);
+80103ddc:	e8 cf eb ff ff       	call   801029b0 <iput>
+80103de1:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80103de4:	e9 9a fd ff ff       	jmp    80103b83 <namex+0x83>
+80103de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[len] = 0;
+80103df0:	8b 55 08             	mov    0x8(%ebp),%edx
+80103df3:	01 c2                	add    %eax,%edx
+    memmove(name, s, len);
+80103df5:	83 ec 04             	sub    $0x4,%esp
+80103df8:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+80103dfe:	50                   	push   %eax
+80103dff:	53                   	push   %ebx
+    name[len] = 0;
+80103e00:	89 f3                	mov    %esi,%ebx
+    memmove(name, s, len);
+80103e02:	ff 75 08             	push   0x8(%ebp)
+80103e05:	e8 d6 3e 00 00       	call   80107ce0 <memmove>
+    name[len] = 0;
+80103e0a:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+80103e10:	83 c4 10             	add    $0x10,%esp
+80103e13:	c6 02 00             	movb   $0x0,(%edx)
+80103e16:	e9 c4 fd ff ff       	jmp    80103bdf <namex+0xdf>
+80103e1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e1f:	90                   	nop
+    ip = next;
+  }
+  if(nameiparent){
+80103e20:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+80103e26:	85 c0                	test   %eax,%eax
+80103e28:	0f 85 53 01 00 00    	jne    80103f81 <namex+0x481>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80103e2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e31:	89 f8                	mov    %edi,%eax
+80103e33:	5b                   	pop    %ebx
+80103e34:	5e                   	pop    %esi
+80103e35:	5f                   	pop    %edi
+80103e36:	5d                   	pop    %ebp
+80103e37:	c3                   	ret
+80103e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e3f:	90                   	nop
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103e40:	83 ec 0c             	sub    $0xc,%esp
+80103e43:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80103e46:	53                   	push   %ebx
+80103e47:	e8 f4 3a 00 00       	call   80107940 <holdingsleep>
+80103e4c:	83 c4 10             	add    $0x10,%esp
+80103e4f:	85 c0                	test   %eax,%eax
+80103e51:	0f 84 1d 01 00 00    	je     80103f74 <namex+0x474>
+80103e57:	8b 46 08             	mov    0x8(%esi),%eax
+80103e5a:	85 c0                	test   %eax,%eax
+80103e5c:	0f 8e 12 01 00 00    	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103e62:	83 ec 0c             	sub    $0xc,%esp
+80103e65:	53                   	push   %ebx
+80103e66:	e8 95 3a 00 00       	call   80107900 <releasesleep>
+  iput(ip);
+80103e6b:	89 34 24             	mov    %esi,(%esp)
+80103e6e:	e8 3d eb ff ff       	call   801029b0 <iput>
+        iput(ip);
+80103e73:	89 3c 24             	mov    %edi,(%esp)
+      return 0;
+80103e76:	31 ff                	xor    %edi,%edi
+        iput(ip);
+80103e78:	e8 33 eb ff ff       	call   801029b0 <iput>
+        return 0;
+80103e7d:	83 c4 10             	add    $0x10,%esp
+}
+80103e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e83:	89 f8                	mov    %edi,%eax
+80103e85:	5b                   	pop    %ebx
+80103e86:	5e                   	pop    %esi
+80103e87:	5f                   	pop    %edi
+80103e88:	5d                   	pop    %ebp
+80103e89:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80103e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+80103e8d:	89 de                	mov    %ebx,%esi
+80103e8f:	31 c0                	xor    %eax,%eax
+80103e91:	e9 5f ff ff ff       	jmp    80103df5 <namex+0x2f5>
+    ip = iget(ROOTDEV, ROOTINO);
+80103e96:	ba 01 00 00 00       	mov    $0x1,%edx
+80103e9b:	b8 01 00 00 00       	mov    $0x1,%eax
+80103ea0:	e8 db db ff ff       	call   80101a80 <iget>
+80103ea5:	89 c7                	mov    %eax,%edi
+80103ea7:	e9 c3 fc ff ff       	jmp    80103b6f <namex+0x6f>
+    iput(*ipp);
+80103eac:	83 ec 0c             	sub    $0xc,%esp
+80103eaf:	57                   	push   %edi
+80103eb0:	e8 fb ea ff ff       	call   801029b0 <iput>
+    *ipp = iget(ROOTDEV, ROOTINO);
+80103eb5:	ba 01 00 00 00       	mov    $0x1,%edx
+80103eba:	b8 01 00 00 00       	mov    $0x1,%eax
+80103ebf:	e8 bc db ff ff       	call   80101a80 <iget>
+80103ec4:	83 c4 10             	add    $0x10,%esp
+80103ec7:	89 c7                	mov    %eax,%edi
+80103ec9:	e9 89 fe ff ff       	jmp    80103d57 <namex+0x257>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103ece:	83 ec 0c             	sub    $0xc,%esp
+80103ed1:	8d 5f 0c             	lea    0xc(%edi),%ebx
+80103ed4:	53                   	push   %ebx
+80103ed5:	e8 66 3a 00 00       	call   80107940 <holdingsleep>
+80103eda:	83 c4 10             	add    $0x10,%esp
+80103edd:	85 c0                	test   %eax,%eax
+80103edf:	0f 84 8f 00 00 00    	je     80103f74 <namex+0x474>
+80103ee5:	8b 57 08             	mov    0x8(%edi),%edx
+80103ee8:	85 d2                	test   %edx,%edx
+80103eea:	0f 8e 84 00 00 00    	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103ef0:	83 ec 0c             	sub    $0xc,%esp
+80103ef3:	53                   	push   %ebx
+80103ef4:	e8 07 3a 00 00       	call   80107900 <releasesleep>
+  iput(ip);
+80103ef9:	89 3c 24             	mov    %edi,(%esp)
+      return 0;
+80103efc:	31 ff                	xor    %edi,%edi
+  iput(ip);
+80103efe:	e8 ad ea ff ff       	call   801029b0 <iput>
+      return 0;
+80103f03:	83 c4 10             	add    $0x10,%esp
+80103f06:	e9 75 ff ff ff       	jmp    80103e80 <namex+0x380>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103f0b:	83 ec 0c             	sub    $0xc,%esp
+80103f0e:	52                   	push   %edx
+80103f0f:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+80103f15:	e8 26 3a 00 00       	call   80107940 <holdingsleep>
+80103f1a:	83 c4 10             	add    $0x10,%esp
+80103f1d:	85 c0                	test   %eax,%eax
+80103f1f:	74 53                	je     80103f74 <namex+0x474>
+80103f21:	8b 47 08             	mov    0x8(%edi),%eax
+80103f24:	85 c0                	test   %eax,%eax
+80103f26:	7e 4c                	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103f28:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+80103f2e:	83 ec 0c             	sub    $0xc,%esp
+80103f31:	52                   	push   %edx
+80103f32:	e8 c9 39 00 00       	call   80107900 <releasesleep>
+  iput(ip);
+80103f37:	89 3c 24             	mov    %edi,(%esp)
+      return 0;
+80103f3a:	31 ff                	xor    %edi,%edi
+  iput(ip);
+80103f3c:	e8 6f ea ff ff       	call   801029b0 <iput>
+      return 0;
+80103f41:	83 c4 10             	add    $0x10,%esp
+80103f44:	e9 37 ff ff ff       	jmp    80103e80 <namex+0x380>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103f49:	83 ec 0c             	sub    $0xc,%esp
+80103f4c:	8d 5f 0c             	lea    0xc(%edi),%ebx
+80103f4f:	53                   	push   %ebx
+80103f50:	e8 eb 39 00 00       	call   80107940 <holdingsleep>
+80103f55:	83 c4 10             	add    $0x10,%esp
+80103f58:	85 c0                	test   %eax,%eax
+80103f5a:	74 18                	je     80103f74 <namex+0x474>
+80103f5c:	8b 47 08             	mov    0x8(%edi),%eax
+80103f5f:	85 c0                	test   %eax,%eax
+80103f61:	7e 11                	jle    80103f74 <namex+0x474>
+  releasesleep(&ip->lock);
+80103f63:	83 ec 0c             	sub    $0xc,%esp
+80103f66:	53                   	push   %ebx
+80103f67:	e8 94 39 00 00       	call   80107900 <releasesleep>
+}
+80103f6c:	83 c4 10             	add    $0x10,%esp
+80103f6f:	e9 ba fe ff ff       	jmp    80103e2e <namex+0x32e>
+    panic("iunlock");
+80103f74:	83 ec 0c             	sub    $0xc,%esp
+80103f77:	68 07 af 10 80       	push   $0x8010af07
+80103f7c:	e8 af c7 ff ff       	call   80100730 <panic>
+    iput(ip);
+80103f81:	83 ec 0c             	sub    $0xc,%esp
+80103f84:	57                   	push   %edi
+      return 0;
+80103f85:	31 ff                	xor    %edi,%edi
+    iput(ip);
+80103f87:	e8 24 ea ff ff       	call   801029b0 <iput>
+    return 0;
+80103f8c:	83 c4 10             	add    $0x10,%esp
+80103f8f:	e9 ec fe ff ff       	jmp    80103e80 <namex+0x380>
+80103f94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103f9f:	90                   	nop
+
+80103fa0 <dirlink>:
+{
+80103fa0:	55                   	push   %ebp
+80103fa1:	89 e5                	mov    %esp,%ebp
+80103fa3:	57                   	push   %edi
+80103fa4:	56                   	push   %esi
+80103fa5:	53                   	push   %ebx
+80103fa6:	83 ec 40             	sub    $0x40,%esp
+80103fa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103fac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103faf:	6a 00                	push   $0x0
+80103fb1:	56                   	push   %esi
+80103fb2:	53                   	push   %ebx
+80103fb3:	e8 18 f9 ff ff       	call   801038d0 <dirlookup>
+80103fb8:	83 c4 10             	add    $0x10,%esp
+80103fbb:	85 c0                	test   %eax,%eax
+80103fbd:	0f 85 0d 01 00 00    	jne    801040d0 <dirlink+0x130>
+  if((dp->flags & I_DIRHASH) == 0){
+80103fc3:	f6 43 5e 02          	testb  $0x2,0x5e(%ebx)
+80103fc7:	74 77                	je     80104040 <dirlink+0xa0>
+80103fc9:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+    dirprobe(dp, name, 0, &off);
+80103fcc:	83 ec 0c             	sub    $0xc,%esp
+80103fcf:	89 f2                	mov    %esi,%edx
+80103fd1:	31 c9                	xor    %ecx,%ecx
+80103fd3:	89 d8                	mov    %ebx,%eax
+80103fd5:	57                   	push   %edi
+80103fd6:	e8 a5 f0 ff ff       	call   80103080 <dirprobe>
+    if(off == 0)
+80103fdb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80103fde:	83 c4 10             	add    $0x10,%esp
+80103fe1:	85 d2                	test   %edx,%edx
+80103fe3:	0f 84 8f 00 00 00    	je     80104078 <dirlink+0xd8>
+  strncpy(de.name, name, DIRSIZ);
+80103fe9:	83 ec 04             	sub    $0x4,%esp
+80103fec:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103fef:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80103ff2:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80103ff5:	6a 0e                	push   $0xe
+80103ff7:	56                   	push   %esi
+80103ff8:	50                   	push   %eax
+80103ff9:	e8 a2 3d 00 00       	call   80107da0 <strncpy>
+  de.inum = inum;
+80103ffe:	0f b7 45 10          	movzwl 0x10(%ebp),%eax
+80104002:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80104006:	6a 10                	push   $0x10
+80104008:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+8010400b:	52                   	push   %edx
+8010400c:	57                   	push   %edi
+8010400d:	53                   	push   %ebx
+8010400e:	e8 3d f3 ff ff       	call   80103350 <writei>
+80104013:	83 c4 20             	add    $0x20,%esp
+80104016:	83 f8 10             	cmp    $0x10,%eax
+80104019:	0f 85 c7 00 00 00    	jne    801040e6 <dirlink+0x146>
+  dcacheput(dp, name, inum);
+8010401f:	83 ec 04             	sub    $0x4,%esp
+80104022:	ff 75 10             	push   0x10(%ebp)
+80104025:	56                   	push   %esi
+80104026:	53                   	push   %ebx
+80104027:	e8 f4 f6 ff ff       	call   80103720 <dcacheput>
+  return 0;
+8010402c:	83 c4 10             	add    $0x10,%esp
+8010402f:	31 c0                	xor    %eax,%eax
+}
+80104031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104034:	5b                   	pop    %ebx
+80104035:	5e                   	pop    %esi
+80104036:	5f                   	pop    %edi
+80104037:	5d                   	pop    %ebp
+80104038:	c3                   	ret
+80104039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    dirscan(dp, name, 0, dp->size, 0, &off);
+80104040:	83 ec 04             	sub    $0x4,%esp
+80104043:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+80104046:	89 f2                	mov    %esi,%edx
+80104048:	31 c9                	xor    %ecx,%ecx
+8010404a:	57                   	push   %edi
+8010404b:	89 d8                	mov    %ebx,%eax
+8010404d:	6a 00                	push   $0x0
+8010404f:	ff 73 68             	push   0x68(%ebx)
+80104052:	e8 99 f1 ff ff       	call   801031f0 <dirscan>
+    if(off == DIRHASH_START*BSIZE && dp->size == off){
+80104057:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010405a:	83 c4 10             	add    $0x10,%esp
+8010405d:	81 fa 00 08 00 00    	cmp    $0x800,%edx
+80104063:	74 3b                	je     801040a0 <dirlink+0x100>
+  if(dp->flags & I_DIRHASH){
+80104065:	f6 43 5e 02          	testb  $0x2,0x5e(%ebx)
+80104069:	0f 84 7a ff ff ff    	je     80103fe9 <dirlink+0x49>
+8010406f:	e9 58 ff ff ff       	jmp    80103fcc <dirlink+0x2c>
+80104074:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      dirscan(dp, name, DIRHASH_END*BSIZE, dp->size, 0, &off);
+80104078:	83 ec 04             	sub    $0x4,%esp
+8010407b:	89 f2                	mov    %esi,%edx
+8010407d:	b9 00 08 01 00       	mov    $0x10800,%ecx
+80104082:	89 d8                	mov    %ebx,%eax
+80104084:	57                   	push   %edi
+80104085:	6a 00                	push   $0x0
+80104087:	ff 73 68             	push   0x68(%ebx)
+8010408a:	e8 61 f1 ff ff       	call   801031f0 <dirscan>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010408f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80104092:	83 c4 10             	add    $0x10,%esp
+80104095:	e9 4f ff ff ff       	jmp    80103fe9 <dirlink+0x49>
+8010409a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(off == DIRHASH_START*BSIZE && dp->size == off){
+801040a0:	81 7b 68 00 08 00 00 	cmpl   $0x800,0x68(%ebx)
+801040a7:	75 bc                	jne    80104065 <dirlink+0xc5>
+      iupdate(dp);
+801040a9:	83 ec 0c             	sub    $0xc,%esp
+      dp->flags |= I_DIRHASH;
+801040ac:	66 83 4b 5e 02       	orw    $0x2,0x5e(%ebx)
+801040b1:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      dp->size = DIRHASH_END*BSIZE;
+801040b4:	c7 43 68 00 08 01 00 	movl   $0x10800,0x68(%ebx)
+      iupdate(dp);
+801040bb:	53                   	push   %ebx
+801040bc:	e8 bf e6 ff ff       	call   80102780 <iupdate>
+801040c1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+801040c4:	83 c4 10             	add    $0x10,%esp
+801040c7:	eb 9c                	jmp    80104065 <dirlink+0xc5>
+801040c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iput(ip);
+801040d0:	83 ec 0c             	sub    $0xc,%esp
+801040d3:	50                   	push   %eax
+801040d4:	e8 d7 e8 ff ff       	call   801029b0 <iput>
+    return -1;
+801040d9:	83 c4 10             	add    $0x10,%esp
+801040dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801040e1:	e9 4b ff ff ff       	jmp    80104031 <dirlink+0x91>
+    panic("dirlink");
+801040e6:	83 ec 0c             	sub    $0xc,%esp
+801040e9:	68 f6 b5 10 80       	push   $0x8010b5f6
+801040ee:	e8 3d c6 ff ff       	call   80100730 <panic>
+801040f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801040fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104100 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80104100:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, 1, name);
+80104101:	b9 01 00 00 00       	mov    $0x1,%ecx
+80104106:	31 d2                	xor    %edx,%edx
+{
+80104108:	89 e5                	mov    %esp,%ebp
+8010410a:	83 ec 24             	sub    $0x24,%esp
+  return namex(path, 0, 1, name);
+8010410d:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80104110:	50                   	push   %eax
+80104111:	8b 45 08             	mov    0x8(%ebp),%eax
+80104114:	e8 e7 f9 ff ff       	call   80103b00 <namex>
+}
+80104119:	c9                   	leave
+8010411a:	c3                   	ret
+8010411b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010411f:	90                   	nop
+
+80104120 <nameilink>:
+
+// Like namei, but return a final symlink itself.
+struct inode*
+nameilink(char *path)
+{
+80104120:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, 0, name);
+80104121:	31 c9                	xor    %ecx,%ecx
+80104123:	31 d2                	xor    %edx,%edx
+{
+80104125:	89 e5                	mov    %esp,%ebp
+80104127:	83 ec 24             	sub    $0x24,%esp
+  return namex(path, 0, 0, name);
+8010412a:	8d 45 ea             	lea    -0x16(%ebp),%eax
+8010412d:	50                   	push   %eax
+8010412e:	8b 45 08             	mov    0x8(%ebp),%eax
+80104131:	e8 ca f9 ff ff       	call   80103b00 <namex>
+}
+80104136:	c9                   	leave
+80104137:	c3                   	ret
+80104138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010413f:	90                   	nop
+
+80104140 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80104140:	55                   	push   %ebp
+  return namex(path, 1, 0, name);
+80104141:	31 c9                	xor    %ecx,%ecx
+{
+80104143:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, 0, name);
+80104145:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+80104148:	8b 45 08             	mov    0x8(%ebp),%eax
+  return namex(path, 1, 0, name);
+8010414b:	89 55 08             	mov    %edx,0x8(%ebp)
+8010414e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+80104153:	5d                   	pop    %ebp
+  return namex(path, 1, 0, name);
+80104154:	e9 a7 f9 ff ff       	jmp    80103b00 <namex>
+80104159:	66 90                	xchg   %ax,%ax
+8010415b:	66 90                	xchg   %ax,%ax
+8010415d:	66 90                	xchg   %ax,%ax
+8010415f:	90                   	nop
+
+80104160 <idestart>:
+// Start the request for b, merging the queued requests after it
+// that continue it on disk into the same command.
+// Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80104160:	55                   	push   %ebp
+80104161:	89 e5                	mov    %esp,%ebp
+80104163:	57                   	push   %edi
+80104164:	56                   	push   %esi
+80104165:	53                   	push   %ebx
+80104166:	83 ec 2c             	sub    $0x2c,%esp
+  struct buf *n;
+  int i;
+
+  if(b == 0)
+80104169:	85 c0                	test   %eax,%eax
+8010416b:	0f 84 0d 02 00 00    	je     8010437e <idestart+0x21e>
+80104171:	89 c6                	mov    %eax,%esi
+    panic("idestart");
+  if(b->blockno >= FSSIZE) {
+80104173:	8b 40 08             	mov    0x8(%eax),%eax
+80104176:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104179:	3d bf c6 2d 00       	cmp    $0x2dc6bf,%eax
+8010417e:	0f 87 07 02 00 00    	ja     8010438b <idestart+0x22b>
+  }
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector = b->blockno * sector_per_block;
+
+  idebusy = 1;
+  for(n = b; n->qnext != 0; n = n->qnext){
+80104184:	8b 46 5c             	mov    0x5c(%esi),%eax
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nsector);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80104187:	8b 7e 04             	mov    0x4(%esi),%edi
+  idebusy = 1;
+8010418a:	c7 05 d0 79 11 80 01 	movl   $0x1,0x801179d0
+80104191:	00 00 00 
+  if(b->flags & B_DIRTY){
+80104194:	8b 1e                	mov    (%esi),%ebx
+  for(n = b; n->qnext != 0; n = n->qnext){
+80104196:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80104199:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  if(b->flags & B_DIRTY){
+8010419c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  for(n = b; n->qnext != 0; n = n->qnext){
+8010419f:	85 c0                	test   %eax,%eax
+801041a1:	0f 84 89 01 00 00    	je     80104330 <idestart+0x1d0>
+801041a7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+801041aa:	89 f2                	mov    %esi,%edx
+801041ac:	31 db                	xor    %ebx,%ebx
+801041ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+801041b3:	89 fe                	mov    %edi,%esi
+801041b5:	eb 37                	jmp    801041ee <idestart+0x8e>
+801041b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041be:	66 90                	xchg   %ax,%ax
+    if((idebusy+1) * sector_per_block > IDE_MAXSECT ||
+801041c0:	39 70 04             	cmp    %esi,0x4(%eax)
+801041c3:	75 73                	jne    80104238 <idestart+0xd8>
+       n->qnext->blockno != n->blockno + 1 ||
+801041c5:	8b 52 08             	mov    0x8(%edx),%edx
+801041c8:	83 c2 01             	add    $0x1,%edx
+       n->qnext->dev != b->dev ||
+801041cb:	39 50 08             	cmp    %edx,0x8(%eax)
+801041ce:	75 68                	jne    80104238 <idestart+0xd8>
+       (n->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+801041d0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801041d3:	33 10                	xor    (%eax),%edx
+       n->qnext->blockno != n->blockno + 1 ||
+801041d5:	83 e2 04             	and    $0x4,%edx
+801041d8:	75 5e                	jne    80104238 <idestart+0xd8>
+  for(n = b; n->qnext != 0; n = n->qnext){
+801041da:	8b 78 5c             	mov    0x5c(%eax),%edi
+801041dd:	89 c2                	mov    %eax,%edx
+801041df:	bb 01 00 00 00       	mov    $0x1,%ebx
+801041e4:	85 ff                	test   %edi,%edi
+801041e6:	0f 84 84 01 00 00    	je     80104370 <idestart+0x210>
+801041ec:	89 f8                	mov    %edi,%eax
+    if((idebusy+1) * sector_per_block > IDE_MAXSECT ||
+801041ee:	89 cf                	mov    %ecx,%edi
+801041f0:	8d 49 01             	lea    0x1(%ecx),%ecx
+801041f3:	83 ff 10             	cmp    $0x10,%edi
+801041f6:	75 c8                	jne    801041c0 <idestart+0x60>
+801041f8:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801041fb:	84 db                	test   %bl,%bl
+801041fd:	0f 84 2d 01 00 00    	je     80104330 <idestart+0x1d0>
+  idestat.nmerged += idebusy - 1;
+80104203:	a1 cc 79 11 80       	mov    0x801179cc,%eax
+  idestat.ncmd++;
+80104208:	83 05 c8 79 11 80 01 	addl   $0x1,0x801179c8
+  idestat.nmerged += idebusy - 1;
+8010420f:	bb 10 00 00 00       	mov    $0x10,%ebx
+80104214:	c7 05 d0 79 11 80 10 	movl   $0x10,0x801179d0
+8010421b:	00 00 00 
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+8010421e:	c7 45 d8 c4 00 00 00 	movl   $0xc4,-0x28(%ebp)
+  idestat.nmerged += idebusy - 1;
+80104225:	8d 48 0f             	lea    0xf(%eax),%ecx
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+80104228:	c7 45 d4 c5 00 00 00 	movl   $0xc5,-0x2c(%ebp)
+8010422f:	eb 52                	jmp    80104283 <idestart+0x123>
+80104231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104238:	8b 75 d8             	mov    -0x28(%ebp),%esi
+8010423b:	84 db                	test   %bl,%bl
+8010423d:	0f 84 ed 00 00 00    	je     80104330 <idestart+0x1d0>
+  idestat.nmerged += idebusy - 1;
+80104243:	89 f8                	mov    %edi,%eax
+  outb(0x1f2, nsector);  // number of sectors
+80104245:	89 fb                	mov    %edi,%ebx
+80104247:	89 f9                	mov    %edi,%ecx
+  idestat.nmerged += idebusy - 1;
+80104249:	8b 15 cc 79 11 80    	mov    0x801179cc,%edx
+  idestat.ncmd++;
+8010424f:	83 05 c8 79 11 80 01 	addl   $0x1,0x801179c8
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+80104256:	83 ff 01             	cmp    $0x1,%edi
+80104259:	89 0d d0 79 11 80    	mov    %ecx,0x801179d0
+  idestat.nmerged += idebusy - 1;
+8010425f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+80104263:	ba 20 00 00 00       	mov    $0x20,%edx
+80104268:	b8 c4 00 00 00       	mov    $0xc4,%eax
+8010426d:	0f 44 c2             	cmove  %edx,%eax
+80104270:	ba 30 00 00 00       	mov    $0x30,%edx
+80104275:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80104278:	b8 c5 00 00 00       	mov    $0xc5,%eax
+8010427d:	0f 44 c2             	cmove  %edx,%eax
+80104280:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  idestat.nmerged += idebusy - 1;
+80104283:	89 0d cc 79 11 80    	mov    %ecx,0x801179cc
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104289:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+8010428e:	66 90                	xchg   %ax,%ax
+80104290:	89 ca                	mov    %ecx,%edx
+80104292:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80104293:	83 e0 c0             	and    $0xffffffc0,%eax
+80104296:	3c 40                	cmp    $0x40,%al
+80104298:	75 f6                	jne    80104290 <idestart+0x130>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010429a:	31 c0                	xor    %eax,%eax
+8010429c:	ba f6 03 00 00       	mov    $0x3f6,%edx
+801042a1:	ee                   	out    %al,(%dx)
+801042a2:	ba f2 01 00 00       	mov    $0x1f2,%edx
+801042a7:	89 d8                	mov    %ebx,%eax
+801042a9:	ee                   	out    %al,(%dx)
+801042aa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801042ad:	ba f3 01 00 00       	mov    $0x1f3,%edx
+801042b2:	89 d8                	mov    %ebx,%eax
+801042b4:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+801042b5:	89 d8                	mov    %ebx,%eax
+801042b7:	ba f4 01 00 00       	mov    $0x1f4,%edx
+801042bc:	c1 f8 08             	sar    $0x8,%eax
+801042bf:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+801042c0:	89 d8                	mov    %ebx,%eax
+801042c2:	ba f5 01 00 00       	mov    $0x1f5,%edx
+801042c7:	c1 f8 10             	sar    $0x10,%eax
+801042ca:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+801042cb:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+801042cf:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801042d4:	c1 e0 04             	shl    $0x4,%eax
+801042d7:	83 e0 10             	and    $0x10,%eax
+801042da:	83 c8 e0             	or     $0xffffffe0,%eax
+801042dd:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+801042de:	f6 45 e4 04          	testb  $0x4,-0x1c(%ebp)
+801042e2:	74 7c                	je     80104360 <idestart+0x200>
+801042e4:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+801042e8:	89 ca                	mov    %ecx,%edx
+801042ea:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+801042eb:	b9 80 00 00 00       	mov    $0x80,%ecx
+801042f0:	8b 76 60             	mov    0x60(%esi),%esi
+801042f3:	ba f0 01 00 00       	mov    $0x1f0,%edx
+801042f8:	fc                   	cld
+801042f9:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+    outb(0x1f7, write_cmd);
+    for(i = 0, n = b; i < idebusy; i++, n = n->qnext)
+801042fb:	83 ff 01             	cmp    $0x1,%edi
+801042fe:	74 27                	je     80104327 <idestart+0x1c7>
+80104300:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80104303:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80104306:	b8 01 00 00 00       	mov    $0x1,%eax
+8010430b:	bb 80 00 00 00       	mov    $0x80,%ebx
+80104310:	89 f9                	mov    %edi,%ecx
+80104312:	8b 7f 5c             	mov    0x5c(%edi),%edi
+80104315:	8b 71 60             	mov    0x60(%ecx),%esi
+80104318:	89 d9                	mov    %ebx,%ecx
+8010431a:	fc                   	cld
+8010431b:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+8010431d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80104320:	83 c0 01             	add    $0x1,%eax
+80104323:	39 f0                	cmp    %esi,%eax
+80104325:	75 e9                	jne    80104310 <idestart+0x1b0>
+      outsl(0x1f0, n->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+80104327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010432a:	5b                   	pop    %ebx
+8010432b:	5e                   	pop    %esi
+8010432c:	5f                   	pop    %edi
+8010432d:	5d                   	pop    %ebp
+8010432e:	c3                   	ret
+8010432f:	90                   	nop
+  idestat.ncmd++;
+80104330:	83 05 c8 79 11 80 01 	addl   $0x1,0x801179c8
+  idestat.nmerged += idebusy - 1;
+80104337:	8b 0d cc 79 11 80    	mov    0x801179cc,%ecx
+8010433d:	bb 01 00 00 00       	mov    $0x1,%ebx
+80104342:	bf 01 00 00 00       	mov    $0x1,%edi
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+80104347:	c7 45 d8 20 00 00 00 	movl   $0x20,-0x28(%ebp)
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+8010434e:	c7 45 d4 30 00 00 00 	movl   $0x30,-0x2c(%ebp)
+80104355:	e9 29 ff ff ff       	jmp    80104283 <idestart+0x123>
+8010435a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104360:	0f b6 45 d8          	movzbl -0x28(%ebp),%eax
+80104364:	89 ca                	mov    %ecx,%edx
+80104366:	ee                   	out    %al,(%dx)
+}
+80104367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010436a:	5b                   	pop    %ebx
+8010436b:	5e                   	pop    %esi
+8010436c:	5f                   	pop    %edi
+8010436d:	5d                   	pop    %ebp
+8010436e:	c3                   	ret
+8010436f:	90                   	nop
+  idestat.nmerged += idebusy - 1;
+80104370:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80104373:	89 c8                	mov    %ecx,%eax
+  outb(0x1f2, nsector);  // number of sectors
+80104375:	89 cb                	mov    %ecx,%ebx
+    if((idebusy+1) * sector_per_block > IDE_MAXSECT ||
+80104377:	89 cf                	mov    %ecx,%edi
+80104379:	e9 cb fe ff ff       	jmp    80104249 <idestart+0xe9>
+    panic("idestart");
+8010437e:	83 ec 0c             	sub    $0xc,%esp
+80104381:	68 ab af 10 80       	push   $0x8010afab
+80104386:	e8 a5 c3 ff ff       	call   80100730 <panic>
+    cprintf("blockno: %d\n", b->blockno);
+8010438b:	52                   	push   %edx
+8010438c:	52                   	push   %edx
+8010438d:	50                   	push   %eax
+8010438e:	68 b4 af 10 80       	push   $0x8010afb4
+80104393:	e8 c8 c6 ff ff       	call   80100a60 <cprintf>
+    panic("incorrect blockno");
+80104398:	c7 04 24 c1 af 10 80 	movl   $0x8010afc1,(%esp)
+8010439f:	e8 8c c3 ff ff       	call   80100730 <panic>
+801043a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801043ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801043af:	90                   	nop
+
+801043b0 <ideinit>:
+{
+801043b0:	55                   	push   %ebp
+801043b1:	89 e5                	mov    %esp,%ebp
+801043b3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+801043b6:	68 d3 af 10 80       	push   $0x8010afd3
+801043bb:	68 e0 79 11 80       	push   $0x801179e0
+801043c0:	e8 cb 35 00 00       	call   80107990 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+801043c5:	58                   	pop    %eax
+801043c6:	a1 c4 78 15 80       	mov    0x801578c4,%eax
+801043cb:	5a                   	pop    %edx
+801043cc:	83 e8 01             	sub    $0x1,%eax
+801043cf:	50                   	push   %eax
+801043d0:	6a 0e                	push   $0xe
+801043d2:	e8 99 03 00 00       	call   80104770 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801043d7:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801043da:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801043df:	90                   	nop
+801043e0:	89 ca                	mov    %ecx,%edx
+801043e2:	ec                   	in     (%dx),%al
+801043e3:	83 e0 c0             	and    $0xffffffc0,%eax
+801043e6:	3c 40                	cmp    $0x40,%al
+801043e8:	75 f6                	jne    801043e0 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801043ea:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801043ef:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801043f4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801043f5:	89 ca                	mov    %ecx,%edx
+801043f7:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801043f8:	84 c0                	test   %al,%al
+801043fa:	75 1e                	jne    8010441a <ideinit+0x6a>
+801043fc:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80104401:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80104406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010440d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+80104410:	83 e9 01             	sub    $0x1,%ecx
+80104413:	74 0f                	je     80104424 <ideinit+0x74>
+80104415:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80104416:	84 c0                	test   %al,%al
+80104418:	74 f6                	je     80104410 <ideinit+0x60>
+      havedisk1 = 1;
+8010441a:	c7 05 c0 79 11 80 01 	movl   $0x1,0x801179c0
+80104421:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104424:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80104429:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010442e:	ee                   	out    %al,(%dx)
+}
+8010442f:	c9                   	leave
+80104430:	c3                   	ret
+80104431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010443f:	90                   	nop
+
+80104440 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80104440:	55                   	push   %ebp
+80104441:	89 e5                	mov    %esp,%ebp
+80104443:	57                   	push   %edi
+80104444:	56                   	push   %esi
+80104445:	53                   	push   %ebx
+80104446:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+  int ok;
+
+  // First idebusy queued buffers are the active request.
+  acquire(&idelock);
+80104449:	68 e0 79 11 80       	push   $0x801179e0
+8010444e:	e8 1d 37 00 00       	call   80107b70 <acquire>
+
+  if((b = idequeue) == 0){
+80104453:	8b 1d d4 79 11 80    	mov    0x801179d4,%ebx
+80104459:	83 c4 10             	add    $0x10,%esp
+8010445c:	85 db                	test   %ebx,%ebx
+8010445e:	0f 84 97 00 00 00    	je     801044fb <ideintr+0xbb>
+    release(&idelock);
+    return;
+  }
+
+  // Read data if needed; the sectors arrive in queue order.
+  ok = (b->flags & B_DIRTY) || idewait(1) >= 0;
+80104464:	be 01 00 00 00       	mov    $0x1,%esi
+80104469:	f6 03 04             	testb  $0x4,(%ebx)
+8010446c:	0f 84 9e 00 00 00    	je     80104510 <ideintr+0xd0>
+  for(; idebusy > 0; idebusy--){
+80104472:	a1 d0 79 11 80       	mov    0x801179d0,%eax
+80104477:	85 c0                	test   %eax,%eax
+80104479:	7e 79                	jle    801044f4 <ideintr+0xb4>
+    b = idequeue;
+    idequeue = b->qnext;
+    if(!(b->flags & B_DIRTY) && ok)
+8010447b:	83 e6 01             	and    $0x1,%esi
+8010447e:	eb 2b                	jmp    801044ab <ideintr+0x6b>
+    // Wake process waiting for this buf, or hand
+    // a read-ahead buffer back to the cache.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+80104480:	83 e0 f3             	and    $0xfffffff3,%eax
+      bdone(b);
+80104483:	83 ec 0c             	sub    $0xc,%esp
+      b->flags &= ~B_ASYNC;
+80104486:	83 c8 02             	or     $0x2,%eax
+80104489:	89 03                	mov    %eax,(%ebx)
+      bdone(b);
+8010448b:	53                   	push   %ebx
+8010448c:	e8 5f c0 ff ff       	call   801004f0 <bdone>
+80104491:	83 c4 10             	add    $0x10,%esp
+  for(; idebusy > 0; idebusy--){
+80104494:	a1 d0 79 11 80       	mov    0x801179d0,%eax
+    } else
+      wakeup(b);
+  }
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80104499:	8b 1d d4 79 11 80    	mov    0x801179d4,%ebx
+  for(; idebusy > 0; idebusy--){
+8010449f:	83 e8 01             	sub    $0x1,%eax
+801044a2:	a3 d0 79 11 80       	mov    %eax,0x801179d0
+801044a7:	85 c0                	test   %eax,%eax
+801044a9:	7e 45                	jle    801044f0 <ideintr+0xb0>
+    idequeue = b->qnext;
+801044ab:	8b 43 5c             	mov    0x5c(%ebx),%eax
+801044ae:	a3 d4 79 11 80       	mov    %eax,0x801179d4
+    if(!(b->flags & B_DIRTY) && ok)
+801044b3:	8b 03                	mov    (%ebx),%eax
+801044b5:	a8 04                	test   $0x4,%al
+801044b7:	75 18                	jne    801044d1 <ideintr+0x91>
+801044b9:	89 f1                	mov    %esi,%ecx
+801044bb:	84 c9                	test   %cl,%cl
+801044bd:	74 12                	je     801044d1 <ideintr+0x91>
+  asm volatile("cld; rep insl" :
+801044bf:	8b 7b 60             	mov    0x60(%ebx),%edi
+801044c2:	b9 80 00 00 00       	mov    $0x80,%ecx
+801044c7:	ba f0 01 00 00       	mov    $0x1f0,%edx
+801044cc:	fc                   	cld
+801044cd:	f3 6d                	rep insl (%dx),%es:(%edi)
+    b->flags |= B_VALID;
+801044cf:	8b 03                	mov    (%ebx),%eax
+    b->flags &= ~B_DIRTY;
+801044d1:	89 c2                	mov    %eax,%edx
+801044d3:	83 e2 fb             	and    $0xfffffffb,%edx
+801044d6:	83 ca 02             	or     $0x2,%edx
+801044d9:	89 13                	mov    %edx,(%ebx)
+    if(b->flags & B_ASYNC){
+801044db:	a8 08                	test   $0x8,%al
+801044dd:	75 a1                	jne    80104480 <ideintr+0x40>
+      wakeup(b);
+801044df:	83 ec 0c             	sub    $0xc,%esp
+801044e2:	53                   	push   %ebx
+801044e3:	e8 a8 2d 00 00       	call   80107290 <wakeup>
+801044e8:	83 c4 10             	add    $0x10,%esp
+801044eb:	eb a7                	jmp    80104494 <ideintr+0x54>
+801044ed:	8d 76 00             	lea    0x0(%esi),%esi
+  if(idequeue != 0)
+801044f0:	85 db                	test   %ebx,%ebx
+801044f2:	74 07                	je     801044fb <ideintr+0xbb>
+    idestart(idequeue);
+801044f4:	89 d8                	mov    %ebx,%eax
+801044f6:	e8 65 fc ff ff       	call   80104160 <idestart>
+    release(&idelock);
+801044fb:	83 ec 0c             	sub    $0xc,%esp
+801044fe:	68 e0 79 11 80       	push   $0x801179e0
+80104503:	e8 08 36 00 00       	call   80107b10 <release>
+
+  release(&idelock);
+}
+80104508:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010450b:	5b                   	pop    %ebx
+8010450c:	5e                   	pop    %esi
+8010450d:	5f                   	pop    %edi
+8010450e:	5d                   	pop    %ebp
+8010450f:	c3                   	ret
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104510:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80104515:	8d 76 00             	lea    0x0(%esi),%esi
+80104518:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80104519:	89 c1                	mov    %eax,%ecx
+8010451b:	83 e1 c0             	and    $0xffffffc0,%ecx
+8010451e:	80 f9 40             	cmp    $0x40,%cl
+80104521:	75 f5                	jne    80104518 <ideintr+0xd8>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80104523:	a8 21                	test   $0x21,%al
+80104525:	0f 94 c0             	sete   %al
+80104528:	0f b6 c0             	movzbl %al,%eax
+8010452b:	89 c6                	mov    %eax,%esi
+8010452d:	e9 40 ff ff ff       	jmp    80104472 <ideintr+0x32>
+80104532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104540 <iderw>:
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr() releases b.
+void
+iderw(struct buf *b)
+{
+80104540:	55                   	push   %ebp
+80104541:	89 e5                	mov    %esp,%ebp
+80104543:	57                   	push   %edi
+80104544:	56                   	push   %esi
+80104545:	53                   	push   %ebx
+80104546:	83 ec 18             	sub    $0x18,%esp
+80104549:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp, *last;
+  int i;
+
+  if(!holdingsleep(&b->lock))
+8010454c:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010454f:	50                   	push   %eax
+80104550:	e8 eb 33 00 00       	call   80107940 <holdingsleep>
+80104555:	83 c4 10             	add    $0x10,%esp
+80104558:	85 c0                	test   %eax,%eax
+8010455a:	0f 84 14 01 00 00    	je     80104674 <iderw+0x134>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80104560:	8b 03                	mov    (%ebx),%eax
+80104562:	83 e0 06             	and    $0x6,%eax
+80104565:	83 f8 02             	cmp    $0x2,%eax
+80104568:	0f 84 f9 00 00 00    	je     80104667 <iderw+0x127>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+8010456e:	8b 53 04             	mov    0x4(%ebx),%edx
+80104571:	85 d2                	test   %edx,%edx
+80104573:	74 0d                	je     80104582 <iderw+0x42>
+80104575:	a1 c0 79 11 80       	mov    0x801179c0,%eax
+8010457a:	85 c0                	test   %eax,%eax
+8010457c:	0f 84 ff 00 00 00    	je     80104681 <iderw+0x141>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80104582:	83 ec 0c             	sub    $0xc,%esp
+80104585:	68 e0 79 11 80       	push   $0x801179e0
+8010458a:	e8 e1 35 00 00       	call   80107b70 <acquire>
+  // Insert b in C-SCAN order after the active request:
+  // block numbers are compared by their distance past the
+  // last active block, wrapping around.
+  b->qnext = 0;
+  pp = &idequeue;
+  if(idequeue != 0){
+8010458f:	a1 d4 79 11 80       	mov    0x801179d4,%eax
+80104594:	83 c4 10             	add    $0x10,%esp
+  b->qnext = 0;
+80104597:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+  pp = &idequeue;
+8010459e:	b9 d4 79 11 80       	mov    $0x801179d4,%ecx
+  if(idequeue != 0){
+801045a3:	85 c0                	test   %eax,%eax
+801045a5:	74 4f                	je     801045f6 <iderw+0xb6>
+    last = idequeue;
+    for(i = 0; i < idebusy; i++){
+801045a7:	8b 35 d0 79 11 80    	mov    0x801179d0,%esi
+801045ad:	85 f6                	test   %esi,%esi
+801045af:	0f 8e ab 00 00 00    	jle    80104660 <iderw+0x120>
+801045b5:	31 d2                	xor    %edx,%edx
+801045b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801045be:	66 90                	xchg   %ax,%ax
+801045c0:	83 c2 01             	add    $0x1,%edx
+801045c3:	89 c7                	mov    %eax,%edi
+      last = *pp;
+      pp = &(*pp)->qnext;
+    }
+    for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801045c5:	8b 40 5c             	mov    0x5c(%eax),%eax
+    for(i = 0; i < idebusy; i++){
+801045c8:	39 d6                	cmp    %edx,%esi
+801045ca:	75 f4                	jne    801045c0 <iderw+0x80>
+      pp = &(*pp)->qnext;
+801045cc:	8d 4f 5c             	lea    0x5c(%edi),%ecx
+    for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801045cf:	85 c0                	test   %eax,%eax
+801045d1:	74 20                	je     801045f3 <iderw+0xb3>
+      if(b->blockno - last->blockno < (*pp)->blockno - last->blockno)
+801045d3:	8b 7f 08             	mov    0x8(%edi),%edi
+801045d6:	8b 73 08             	mov    0x8(%ebx),%esi
+801045d9:	29 fe                	sub    %edi,%esi
+801045db:	eb 0d                	jmp    801045ea <iderw+0xaa>
+801045dd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+801045e0:	8d 48 5c             	lea    0x5c(%eax),%ecx
+801045e3:	8b 40 5c             	mov    0x5c(%eax),%eax
+801045e6:	85 c0                	test   %eax,%eax
+801045e8:	74 09                	je     801045f3 <iderw+0xb3>
+      if(b->blockno - last->blockno < (*pp)->blockno - last->blockno)
+801045ea:	8b 50 08             	mov    0x8(%eax),%edx
+801045ed:	29 fa                	sub    %edi,%edx
+801045ef:	39 d6                	cmp    %edx,%esi
+801045f1:	73 ed                	jae    801045e0 <iderw+0xa0>
+        break;
+    b->qnext = *pp;
+801045f3:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  }
+  *pp = b;
+  idestat.nreq++;
+801045f6:	83 05 c4 79 11 80 01 	addl   $0x1,0x801179c4
+  *pp = b;
+801045fd:	89 19                	mov    %ebx,(%ecx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+801045ff:	39 1d d4 79 11 80    	cmp    %ebx,0x801179d4
+80104605:	74 49                	je     80104650 <iderw+0x110>
+    idestart(b);
+
+  if(b->flags & B_ASYNC){
+80104607:	8b 03                	mov    (%ebx),%eax
+80104609:	a8 08                	test   $0x8,%al
+8010460b:	75 26                	jne    80104633 <iderw+0xf3>
+    release(&idelock);
+    return;
+  }
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+8010460d:	83 e0 06             	and    $0x6,%eax
+80104610:	83 f8 02             	cmp    $0x2,%eax
+80104613:	74 1e                	je     80104633 <iderw+0xf3>
+80104615:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(b, &idelock);
+80104618:	83 ec 08             	sub    $0x8,%esp
+8010461b:	68 e0 79 11 80       	push   $0x801179e0
+80104620:	53                   	push   %ebx
+80104621:	e8 5a 2b 00 00       	call   80107180 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80104626:	8b 03                	mov    (%ebx),%eax
+80104628:	83 c4 10             	add    $0x10,%esp
+8010462b:	83 e0 06             	and    $0x6,%eax
+8010462e:	83 f8 02             	cmp    $0x2,%eax
+80104631:	75 e5                	jne    80104618 <iderw+0xd8>
+    release(&idelock);
+80104633:	c7 45 08 e0 79 11 80 	movl   $0x801179e0,0x8(%ebp)
+  }
+
+
+  release(&idelock);
+}
+8010463a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010463d:	5b                   	pop    %ebx
+8010463e:	5e                   	pop    %esi
+8010463f:	5f                   	pop    %edi
+80104640:	5d                   	pop    %ebp
+    release(&idelock);
+80104641:	e9 ca 34 00 00       	jmp    80107b10 <release>
+80104646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010464d:	8d 76 00             	lea    0x0(%esi),%esi
+    idestart(b);
+80104650:	89 d8                	mov    %ebx,%eax
+80104652:	e8 09 fb ff ff       	call   80104160 <idestart>
+80104657:	eb ae                	jmp    80104607 <iderw+0xc7>
+80104659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < idebusy; i++){
+80104660:	89 c7                	mov    %eax,%edi
+80104662:	e9 6c ff ff ff       	jmp    801045d3 <iderw+0x93>
+    panic("iderw: nothing to do");
+80104667:	83 ec 0c             	sub    $0xc,%esp
+8010466a:	68 ed af 10 80       	push   $0x8010afed
+8010466f:	e8 bc c0 ff ff       	call   80100730 <panic>
+    panic("iderw: buf not locked");
+80104674:	83 ec 0c             	sub    $0xc,%esp
+80104677:	68 d7 af 10 80       	push   $0x8010afd7
+8010467c:	e8 af c0 ff ff       	call   80100730 <panic>
+    panic("iderw: ide disk 1 not present");
+80104681:	83 ec 0c             	sub    $0xc,%esp
+80104684:	68 02 b0 10 80       	push   $0x8010b002
+80104689:	e8 a2 c0 ff ff       	call   80100730 <panic>
+8010468e:	66 90                	xchg   %ax,%ax
+
+80104690 <ideiostat>:
+
+// Copy the disk request counters into st.
+void
+ideiostat(struct iostat *st)
+{
+80104690:	55                   	push   %ebp
+80104691:	89 e5                	mov    %esp,%ebp
+80104693:	53                   	push   %ebx
+80104694:	83 ec 10             	sub    $0x10,%esp
+80104697:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);
+8010469a:	68 e0 79 11 80       	push   $0x801179e0
+8010469f:	e8 cc 34 00 00       	call   80107b70 <acquire>
+  *st = idestat;
+801046a4:	a1 c4 79 11 80       	mov    0x801179c4,%eax
+  release(&idelock);
+801046a9:	83 c4 10             	add    $0x10,%esp
+  *st = idestat;
+801046ac:	89 03                	mov    %eax,(%ebx)
+801046ae:	a1 c8 79 11 80       	mov    0x801179c8,%eax
+801046b3:	89 43 04             	mov    %eax,0x4(%ebx)
+801046b6:	a1 cc 79 11 80       	mov    0x801179cc,%eax
+801046bb:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+801046be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&idelock);
+801046c1:	c7 45 08 e0 79 11 80 	movl   $0x801179e0,0x8(%ebp)
+}
+801046c8:	c9                   	leave
+  release(&idelock);
+801046c9:	e9 42 34 00 00       	jmp    80107b10 <release>
+801046ce:	66 90                	xchg   %ax,%ax
+
+801046d0 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+801046d0:	55                   	push   %ebp
+801046d1:	89 e5                	mov    %esp,%ebp
+801046d3:	56                   	push   %esi
+801046d4:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801046d5:	c7 05 14 7a 11 80 00 	movl   $0xfec00000,0x80117a14
+801046dc:	00 c0 fe 
+  ioapic->reg = reg;
+801046df:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+801046e6:	00 00 00 
+  return ioapic->data;
+801046e9:	8b 15 14 7a 11 80    	mov    0x80117a14,%edx
+801046ef:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+801046f2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+801046f8:	8b 1d 14 7a 11 80    	mov    0x80117a14,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+801046fe:	0f b6 15 c0 78 15 80 	movzbl 0x801578c0,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80104705:	c1 ee 10             	shr    $0x10,%esi
+80104708:	89 f0                	mov    %esi,%eax
+8010470a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010470d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80104710:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80104713:	39 c2                	cmp    %eax,%edx
+80104715:	74 16                	je     8010472d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80104717:	83 ec 0c             	sub    $0xc,%esp
+8010471a:	68 20 b0 10 80       	push   $0x8010b020
+8010471f:	e8 3c c3 ff ff       	call   80100a60 <cprintf>
+  ioapic->reg = reg;
+80104724:	8b 1d 14 7a 11 80    	mov    0x80117a14,%ebx
+8010472a:	83 c4 10             	add    $0x10,%esp
+{
+8010472d:	ba 10 00 00 00       	mov    $0x10,%edx
+80104732:	31 c0                	xor    %eax,%eax
+80104734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+80104738:	89 13                	mov    %edx,(%ebx)
+8010473a:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+8010473d:	8b 1d 14 7a 11 80    	mov    0x80117a14,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+80104743:	83 c0 01             	add    $0x1,%eax
+80104746:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+8010474c:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+8010474f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80104752:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80104755:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80104757:	8b 1d 14 7a 11 80    	mov    0x80117a14,%ebx
+8010475d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+80104764:	39 c6                	cmp    %eax,%esi
+80104766:	7d d0                	jge    80104738 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80104768:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010476b:	5b                   	pop    %ebx
+8010476c:	5e                   	pop    %esi
+8010476d:	5d                   	pop    %ebp
+8010476e:	c3                   	ret
+8010476f:	90                   	nop
+
+80104770 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80104770:	55                   	push   %ebp
+  ioapic->reg = reg;
+80104771:	8b 0d 14 7a 11 80    	mov    0x80117a14,%ecx
+{
+80104777:	89 e5                	mov    %esp,%ebp
+80104779:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010477c:	8d 50 20             	lea    0x20(%eax),%edx
+8010477f:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80104783:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80104785:	8b 0d 14 7a 11 80    	mov    0x80117a14,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010478b:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+8010478e:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80104791:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80104794:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80104796:	a1 14 7a 11 80       	mov    0x80117a14,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010479b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010479e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801047a1:	5d                   	pop    %ebp
+801047a2:	c3                   	ret
+801047a3:	66 90                	xchg   %ax,%ax
+801047a5:	66 90                	xchg   %ax,%ax
+801047a7:	66 90                	xchg   %ax,%ax
+801047a9:	66 90                	xchg   %ax,%ax
+801047ab:	66 90                	xchg   %ax,%ax
+801047ad:	66 90                	xchg   %ax,%ax
+801047af:	90                   	nop
+
+801047b0 <kfree>:
+// and free it if that was the last one.  v normally should have
+// been returned by a call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+801047b0:	55                   	push   %ebp
+801047b1:	89 e5                	mov    %esp,%ebp
+801047b3:	57                   	push   %edi
+801047b4:	56                   	push   %esi
+801047b5:	53                   	push   %ebx
+801047b6:	83 ec 1c             	sub    $0x1c,%esp
+801047b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r, *chain;
+  struct kcache *c;
+  int got;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801047bc:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801047c2:	0f 85 56 01 00 00    	jne    8010491e <kfree+0x16e>
+801047c8:	81 fb 10 9d 15 80    	cmp    $0x80159d10,%ebx
+801047ce:	0f 82 4a 01 00 00    	jb     8010491e <kfree+0x16e>
+801047d4:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801047da:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801047df:	0f 87 39 01 00 00    	ja     8010491e <kfree+0x16e>
+    panic("kfree");
+
+  if(xadd(&kref[V2P(v)/PGSIZE], -1) != 1){
+801047e5:	c1 e8 0c             	shr    $0xc,%eax
+
+// Atomically add v to *addr and return the old value.
+static inline int
+xadd(volatile int *addr, int v)
+{
+  asm volatile("lock; xaddl %0, %1" :
+801047e8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+801047ed:	f0 0f c1 14 85 60 7a 	lock xadd %edx,-0x7fee85a0(,%eax,4)
+801047f4:	11 80 
+801047f6:	83 fa 01             	cmp    $0x1,%edx
+801047f9:	74 1d                	je     80104818 <kfree+0x68>
+    if(kref[V2P(v)/PGSIZE] < 0)
+801047fb:	8b 14 85 60 7a 11 80 	mov    -0x7fee85a0(,%eax,4),%edx
+80104802:	85 d2                	test   %edx,%edx
+80104804:	0f 88 21 01 00 00    	js     8010492b <kfree+0x17b>
+    r->next = kmem.freelist;
+    kmem.freelist = chain;
+    release(&kmem.lock);
+  }
+  popcli();
+}
+8010480a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010480d:	5b                   	pop    %ebx
+8010480e:	5e                   	pop    %esi
+8010480f:	5f                   	pop    %edi
+80104810:	5d                   	pop    %ebp
+80104811:	c3                   	ret
+80104812:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(!kmem.use_lock){
+80104818:	a1 54 7a 11 80       	mov    0x80117a54,%eax
+8010481d:	85 c0                	test   %eax,%eax
+8010481f:	75 1f                	jne    80104840 <kfree+0x90>
+    r->next = kmem.freelist;
+80104821:	a1 58 7a 11 80       	mov    0x80117a58,%eax
+80104826:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = r;
+80104828:	89 1d 58 7a 11 80    	mov    %ebx,0x80117a58
+}
+8010482e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104831:	5b                   	pop    %ebx
+80104832:	5e                   	pop    %esi
+80104833:	5f                   	pop    %edi
+80104834:	5d                   	pop    %ebp
+80104835:	c3                   	ret
+80104836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010483d:	8d 76 00             	lea    0x0(%esi),%esi
+80104840:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  pushcli();
+80104843:	e8 d8 31 00 00       	call   80107a20 <pushcli>
+  c = &kcache[cpuid()];
+80104848:	e8 b3 20 00 00       	call   80106900 <cpuid>
+  acquire(&c->lock);
+8010484d:	83 ec 0c             	sub    $0xc,%esp
+80104850:	6b f0 3c             	imul   $0x3c,%eax,%esi
+  c = &kcache[cpuid()];
+80104853:	89 c7                	mov    %eax,%edi
+  acquire(&c->lock);
+80104855:	81 c6 60 fa 14 80    	add    $0x8014fa60,%esi
+8010485b:	56                   	push   %esi
+8010485c:	e8 0f 33 00 00       	call   80107b70 <acquire>
+  r->next = c->freelist;
+80104861:	8b 46 34             	mov    0x34(%esi),%eax
+  if(++c->nfree > KHIGH){
+80104864:	83 c4 10             	add    $0x10,%esp
+80104867:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  r->next = c->freelist;
+8010486a:	89 03                	mov    %eax,(%ebx)
+  if(++c->nfree > KHIGH){
+8010486c:	8b 46 38             	mov    0x38(%esi),%eax
+  c->freelist = r;
+8010486f:	89 5e 34             	mov    %ebx,0x34(%esi)
+  if(++c->nfree > KHIGH){
+80104872:	83 c0 01             	add    $0x1,%eax
+80104875:	83 f8 40             	cmp    $0x40,%eax
+80104878:	89 46 38             	mov    %eax,0x38(%esi)
+8010487b:	7f 1b                	jg     80104898 <kfree+0xe8>
+  release(&c->lock);
+8010487d:	83 ec 0c             	sub    $0xc,%esp
+80104880:	56                   	push   %esi
+80104881:	e8 8a 32 00 00       	call   80107b10 <release>
+80104886:	83 c4 10             	add    $0x10,%esp
+}
+80104889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010488c:	5b                   	pop    %ebx
+8010488d:	5e                   	pop    %esi
+8010488e:	5f                   	pop    %edi
+8010488f:	5d                   	pop    %ebp
+  popcli();
+80104890:	e9 db 31 00 00       	jmp    80107a70 <popcli>
+80104895:	8d 76 00             	lea    0x0(%esi),%esi
+80104898:	89 d8                	mov    %ebx,%eax
+8010489a:	eb 0c                	jmp    801048a8 <kfree+0xf8>
+8010489c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 1, r = head; i < n && r->next; i++)
+801048a0:	83 c2 01             	add    $0x1,%edx
+801048a3:	83 fa 20             	cmp    $0x20,%edx
+801048a6:	74 70                	je     80104918 <kfree+0x168>
+801048a8:	89 c1                	mov    %eax,%ecx
+801048aa:	8b 00                	mov    (%eax),%eax
+801048ac:	85 c0                	test   %eax,%eax
+801048ae:	75 f0                	jne    801048a0 <kfree+0xf0>
+  *list = r->next;
+801048b0:	6b ff 3c             	imul   $0x3c,%edi,%edi
+  release(&c->lock);
+801048b3:	83 ec 0c             	sub    $0xc,%esp
+  *list = r->next;
+801048b6:	81 c7 60 fa 14 80    	add    $0x8014fa60,%edi
+801048bc:	89 47 34             	mov    %eax,0x34(%edi)
+  r->next = 0;
+801048bf:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    c->nfree -= got;
+801048c5:	29 57 38             	sub    %edx,0x38(%edi)
+  release(&c->lock);
+801048c8:	56                   	push   %esi
+801048c9:	e8 42 32 00 00       	call   80107b10 <release>
+801048ce:	83 c4 10             	add    $0x10,%esp
+801048d1:	89 d8                	mov    %ebx,%eax
+801048d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801048d7:	90                   	nop
+    for(r = chain; r->next; r = r->next)
+801048d8:	89 c6                	mov    %eax,%esi
+801048da:	8b 00                	mov    (%eax),%eax
+801048dc:	85 c0                	test   %eax,%eax
+801048de:	75 f8                	jne    801048d8 <kfree+0x128>
+    acquire(&kmem.lock);
+801048e0:	83 ec 0c             	sub    $0xc,%esp
+801048e3:	68 20 7a 11 80       	push   $0x80117a20
+801048e8:	e8 83 32 00 00       	call   80107b70 <acquire>
+    r->next = kmem.freelist;
+801048ed:	a1 58 7a 11 80       	mov    0x80117a58,%eax
+801048f2:	89 06                	mov    %eax,(%esi)
+    kmem.freelist = chain;
+801048f4:	89 1d 58 7a 11 80    	mov    %ebx,0x80117a58
+    release(&kmem.lock);
+801048fa:	c7 04 24 20 7a 11 80 	movl   $0x80117a20,(%esp)
+80104901:	e8 0a 32 00 00       	call   80107b10 <release>
+80104906:	83 c4 10             	add    $0x10,%esp
+}
+80104909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010490c:	5b                   	pop    %ebx
+8010490d:	5e                   	pop    %esi
+8010490e:	5f                   	pop    %edi
+8010490f:	5d                   	pop    %ebp
+  popcli();
+80104910:	e9 5b 31 00 00       	jmp    80107a70 <popcli>
+80104915:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 1, r = head; i < n && r->next; i++)
+80104918:	89 c1                	mov    %eax,%ecx
+  *list = r->next;
+8010491a:	8b 00                	mov    (%eax),%eax
+8010491c:	eb 92                	jmp    801048b0 <kfree+0x100>
+    panic("kfree");
+8010491e:	83 ec 0c             	sub    $0xc,%esp
+80104921:	68 52 b0 10 80       	push   $0x8010b052
+80104926:	e8 05 be ff ff       	call   80100730 <panic>
+      panic("kfree: ref");
+8010492b:	83 ec 0c             	sub    $0xc,%esp
+8010492e:	68 58 b0 10 80       	push   $0x8010b058
+80104933:	e8 f8 bd ff ff       	call   80100730 <panic>
+80104938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010493f:	90                   	nop
+
+80104940 <freerange>:
+{
+80104940:	55                   	push   %ebp
+80104941:	89 e5                	mov    %esp,%ebp
+80104943:	56                   	push   %esi
+80104944:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80104945:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80104948:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010494b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104951:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104957:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010495d:	39 de                	cmp    %ebx,%esi
+8010495f:	72 37                	jb     80104998 <freerange+0x58>
+80104961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kref[V2P(p)/PGSIZE] = 1;
+80104968:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+    kfree(p);
+8010496e:	83 ec 0c             	sub    $0xc,%esp
+    kref[V2P(p)/PGSIZE] = 1;
+80104971:	c1 e8 0c             	shr    $0xc,%eax
+80104974:	c7 04 85 60 7a 11 80 	movl   $0x1,-0x7fee85a0(,%eax,4)
+8010497b:	01 00 00 00 
+    kfree(p);
+8010497f:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104985:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+8010498b:	50                   	push   %eax
+8010498c:	e8 1f fe ff ff       	call   801047b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104991:	83 c4 10             	add    $0x10,%esp
+80104994:	39 de                	cmp    %ebx,%esi
+80104996:	73 d0                	jae    80104968 <freerange+0x28>
+}
+80104998:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010499b:	5b                   	pop    %ebx
+8010499c:	5e                   	pop    %esi
+8010499d:	5d                   	pop    %ebp
+8010499e:	c3                   	ret
+8010499f:	90                   	nop
+
+801049a0 <kinit2>:
+{
+801049a0:	55                   	push   %ebp
+801049a1:	89 e5                	mov    %esp,%ebp
+801049a3:	56                   	push   %esi
+801049a4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801049a5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801049a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801049ab:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801049b1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801049b7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801049bd:	39 de                	cmp    %ebx,%esi
+801049bf:	72 37                	jb     801049f8 <kinit2+0x58>
+801049c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kref[V2P(p)/PGSIZE] = 1;
+801049c8:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+    kfree(p);
+801049ce:	83 ec 0c             	sub    $0xc,%esp
+    kref[V2P(p)/PGSIZE] = 1;
+801049d1:	c1 e8 0c             	shr    $0xc,%eax
+801049d4:	c7 04 85 60 7a 11 80 	movl   $0x1,-0x7fee85a0(,%eax,4)
+801049db:	01 00 00 00 
+    kfree(p);
+801049df:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801049e5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801049eb:	50                   	push   %eax
+801049ec:	e8 bf fd ff ff       	call   801047b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801049f1:	83 c4 10             	add    $0x10,%esp
+801049f4:	39 de                	cmp    %ebx,%esi
+801049f6:	73 d0                	jae    801049c8 <kinit2+0x28>
+  kmem.use_lock = 1;
+801049f8:	c7 05 54 7a 11 80 01 	movl   $0x1,0x80117a54
+801049ff:	00 00 00 
+}
+80104a02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104a05:	5b                   	pop    %ebx
+80104a06:	5e                   	pop    %esi
+80104a07:	5d                   	pop    %ebp
+80104a08:	c3                   	ret
+80104a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104a10 <kinit1>:
+{
+80104a10:	55                   	push   %ebp
+80104a11:	89 e5                	mov    %esp,%ebp
+80104a13:	56                   	push   %esi
+80104a14:	53                   	push   %ebx
+80104a15:	8b 75 0c             	mov    0xc(%ebp),%esi
+80104a18:	bb 60 fa 14 80       	mov    $0x8014fa60,%ebx
+  initlock(&kmem.lock, "kmem");
+80104a1d:	83 ec 08             	sub    $0x8,%esp
+80104a20:	68 63 b0 10 80       	push   $0x8010b063
+80104a25:	68 20 7a 11 80       	push   $0x80117a20
+80104a2a:	e8 61 2f 00 00       	call   80107990 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104a2f:	83 c4 10             	add    $0x10,%esp
+80104a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    initlock(&kcache[i].lock, "kcache");
+80104a38:	83 ec 08             	sub    $0x8,%esp
+80104a3b:	68 68 b0 10 80       	push   $0x8010b068
+80104a40:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80104a41:	83 c3 3c             	add    $0x3c,%ebx
+    initlock(&kcache[i].lock, "kcache");
+80104a44:	e8 47 2f 00 00       	call   80107990 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104a49:	83 c4 10             	add    $0x10,%esp
+80104a4c:	81 fb 40 fc 14 80    	cmp    $0x8014fc40,%ebx
+80104a52:	75 e4                	jne    80104a38 <kinit1+0x28>
+  kmem.use_lock = 0;
+80104a54:	c7 05 54 7a 11 80 00 	movl   $0x0,0x80117a54
+80104a5b:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+80104a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+80104a61:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104a67:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a6d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80104a73:	39 de                	cmp    %ebx,%esi
+80104a75:	72 39                	jb     80104ab0 <kinit1+0xa0>
+80104a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a7e:	66 90                	xchg   %ax,%ax
+    kref[V2P(p)/PGSIZE] = 1;
+80104a80:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+    kfree(p);
+80104a86:	83 ec 0c             	sub    $0xc,%esp
+    kref[V2P(p)/PGSIZE] = 1;
+80104a89:	c1 e8 0c             	shr    $0xc,%eax
+80104a8c:	c7 04 85 60 7a 11 80 	movl   $0x1,-0x7fee85a0(,%eax,4)
+80104a93:	01 00 00 00 
+    kfree(p);
+80104a97:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a9d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80104aa3:	50                   	push   %eax
+80104aa4:	e8 07 fd ff ff       	call   801047b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104aa9:	83 c4 10             	add    $0x10,%esp
+80104aac:	39 de                	cmp    %ebx,%esi
+80104aae:	73 d0                	jae    80104a80 <kinit1+0x70>
+}
+80104ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104ab3:	5b                   	pop    %ebx
+80104ab4:	5e                   	pop    %esi
+80104ab5:	5d                   	pop    %ebp
+80104ab6:	c3                   	ret
+80104ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104abe:	66 90                	xchg   %ax,%ax
+
+80104ac0 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80104ac0:	55                   	push   %ebp
+80104ac1:	89 e5                	mov    %esp,%ebp
+80104ac3:	57                   	push   %edi
+80104ac4:	56                   	push   %esi
+80104ac5:	53                   	push   %ebx
+80104ac6:	83 ec 1c             	sub    $0x1c,%esp
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock){
+80104ac9:	8b 15 54 7a 11 80    	mov    0x80117a54,%edx
+80104acf:	85 d2                	test   %edx,%edx
+80104ad1:	75 35                	jne    80104b08 <kalloc+0x48>
+    r = kmem.freelist;
+80104ad3:	a1 58 7a 11 80       	mov    0x80117a58,%eax
+    if(r)
+80104ad8:	85 c0                	test   %eax,%eax
+80104ada:	0f 84 a1 00 00 00    	je     80104b81 <kalloc+0xc1>
+      kmem.freelist = r->next;
+80104ae0:	8b 10                	mov    (%eax),%edx
+80104ae2:	89 15 58 7a 11 80    	mov    %edx,0x80117a58
+    }
+    release(&c->lock);
+    popcli();
+  }
+  if(r)
+    kref[V2P(r)/PGSIZE] = 1;
+80104ae8:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+80104aee:	c1 ea 0c             	shr    $0xc,%edx
+80104af1:	c7 04 95 60 7a 11 80 	movl   $0x1,-0x7fee85a0(,%edx,4)
+80104af8:	01 00 00 00 
+  return (char*)r;
+}
+80104afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104aff:	5b                   	pop    %ebx
+80104b00:	5e                   	pop    %esi
+80104b01:	5f                   	pop    %edi
+80104b02:	5d                   	pop    %ebp
+80104b03:	c3                   	ret
+80104b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pushcli();
+80104b08:	e8 13 2f 00 00       	call   80107a20 <pushcli>
+    c = &kcache[cpuid()];
+80104b0d:	e8 ee 1d 00 00       	call   80106900 <cpuid>
+80104b12:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104b15:	6b c0 3c             	imul   $0x3c,%eax,%eax
+80104b18:	8d b0 60 fa 14 80    	lea    -0x7feb05a0(%eax),%esi
+    if(c->freelist == 0)
+80104b1e:	8b 80 94 fa 14 80    	mov    -0x7feb056c(%eax),%eax
+80104b24:	85 c0                	test   %eax,%eax
+80104b26:	74 68                	je     80104b90 <kalloc+0xd0>
+    acquire(&c->lock);
+80104b28:	83 ec 0c             	sub    $0xc,%esp
+80104b2b:	56                   	push   %esi
+80104b2c:	e8 3f 30 00 00       	call   80107b70 <acquire>
+    r = c->freelist;
+80104b31:	6b 55 e0 3c          	imul   $0x3c,-0x20(%ebp),%edx
+    if(r){
+80104b35:	83 c4 10             	add    $0x10,%esp
+    r = c->freelist;
+80104b38:	81 c2 60 fa 14 80    	add    $0x8014fa60,%edx
+80104b3e:	8b 42 34             	mov    0x34(%edx),%eax
+    if(r){
+80104b41:	85 c0                	test   %eax,%eax
+80104b43:	74 2b                	je     80104b70 <kalloc+0xb0>
+      c->freelist = r->next;
+80104b45:	8b 08                	mov    (%eax),%ecx
+    release(&c->lock);
+80104b47:	83 ec 0c             	sub    $0xc,%esp
+      c->freelist = r->next;
+80104b4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      c->nfree--;
+80104b4d:	83 6a 38 01          	subl   $0x1,0x38(%edx)
+      c->freelist = r->next;
+80104b51:	89 4a 34             	mov    %ecx,0x34(%edx)
+    release(&c->lock);
+80104b54:	56                   	push   %esi
+80104b55:	e8 b6 2f 00 00       	call   80107b10 <release>
+    popcli();
+80104b5a:	e8 11 2f 00 00       	call   80107a70 <popcli>
+80104b5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104b62:	83 c4 10             	add    $0x10,%esp
+80104b65:	eb 81                	jmp    80104ae8 <kalloc+0x28>
+80104b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b6e:	66 90                	xchg   %ax,%ax
+    release(&c->lock);
+80104b70:	83 ec 0c             	sub    $0xc,%esp
+80104b73:	56                   	push   %esi
+80104b74:	e8 97 2f 00 00       	call   80107b10 <release>
+    popcli();
+80104b79:	e8 f2 2e 00 00       	call   80107a70 <popcli>
+80104b7e:	83 c4 10             	add    $0x10,%esp
+    r = c->freelist;
+80104b81:	31 c0                	xor    %eax,%eax
+80104b83:	e9 74 ff ff ff       	jmp    80104afc <kalloc+0x3c>
+80104b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b8f:	90                   	nop
+  acquire(&kmem.lock);
+80104b90:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1, r = head; i < n && r->next; i++)
+80104b93:	bb 01 00 00 00       	mov    $0x1,%ebx
+  acquire(&kmem.lock);
+80104b98:	68 20 7a 11 80       	push   $0x80117a20
+80104b9d:	e8 ce 2f 00 00       	call   80107b70 <acquire>
+  head = *list;
+80104ba2:	a1 58 7a 11 80       	mov    0x80117a58,%eax
+  if(head == 0){
+80104ba7:	83 c4 10             	add    $0x10,%esp
+  head = *list;
+80104baa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(head == 0){
+80104bad:	85 c0                	test   %eax,%eax
+80104baf:	75 1b                	jne    80104bcc <kalloc+0x10c>
+80104bb1:	e9 80 00 00 00       	jmp    80104c36 <kalloc+0x176>
+80104bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bbd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 1, r = head; i < n && r->next; i++)
+80104bc0:	83 c3 01             	add    $0x1,%ebx
+80104bc3:	83 fb 20             	cmp    $0x20,%ebx
+80104bc6:	0f 84 34 01 00 00    	je     80104d00 <kalloc+0x240>
+80104bcc:	89 c2                	mov    %eax,%edx
+80104bce:	8b 00                	mov    (%eax),%eax
+80104bd0:	85 c0                	test   %eax,%eax
+80104bd2:	75 ec                	jne    80104bc0 <kalloc+0x100>
+  release(&kmem.lock);
+80104bd4:	83 ec 0c             	sub    $0xc,%esp
+  *list = r->next;
+80104bd7:	a3 58 7a 11 80       	mov    %eax,0x80117a58
+  r->next = 0;
+80104bdc:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  release(&kmem.lock);
+80104be2:	68 20 7a 11 80       	push   $0x80117a20
+80104be7:	e8 24 2f 00 00       	call   80107b10 <release>
+80104bec:	83 c4 10             	add    $0x10,%esp
+80104bef:	90                   	nop
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104bf0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104bf7:	90                   	nop
+  for(r = chain; r->next; r = r->next)
+80104bf8:	89 c7                	mov    %eax,%edi
+80104bfa:	8b 00                	mov    (%eax),%eax
+80104bfc:	85 c0                	test   %eax,%eax
+80104bfe:	75 f8                	jne    80104bf8 <kalloc+0x138>
+  acquire(&c->lock);
+80104c00:	83 ec 0c             	sub    $0xc,%esp
+80104c03:	56                   	push   %esi
+80104c04:	e8 67 2f 00 00       	call   80107b70 <acquire>
+  r->next = c->freelist;
+80104c09:	6b 45 e0 3c          	imul   $0x3c,-0x20(%ebp),%eax
+  c->freelist = chain;
+80104c0d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  r->next = c->freelist;
+80104c10:	8b 90 94 fa 14 80    	mov    -0x7feb056c(%eax),%edx
+80104c16:	89 17                	mov    %edx,(%edi)
+  c->freelist = chain;
+80104c18:	89 88 94 fa 14 80    	mov    %ecx,-0x7feb056c(%eax)
+  r->next = c->freelist;
+80104c1e:	05 60 fa 14 80       	add    $0x8014fa60,%eax
+  c->nfree += got;
+80104c23:	01 58 38             	add    %ebx,0x38(%eax)
+  release(&c->lock);
+80104c26:	89 34 24             	mov    %esi,(%esp)
+80104c29:	e8 e2 2e 00 00       	call   80107b10 <release>
+80104c2e:	83 c4 10             	add    $0x10,%esp
+80104c31:	e9 f2 fe ff ff       	jmp    80104b28 <kalloc+0x68>
+  release(&kmem.lock);
+80104c36:	83 ec 0c             	sub    $0xc,%esp
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104c39:	bf 60 fa 14 80       	mov    $0x8014fa60,%edi
+  release(&kmem.lock);
+80104c3e:	68 20 7a 11 80       	push   $0x80117a20
+80104c43:	e8 c8 2e 00 00       	call   80107b10 <release>
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104c48:	8b 15 c4 78 15 80    	mov    0x801578c4,%edx
+  release(&kmem.lock);
+80104c4e:	83 c4 10             	add    $0x10,%esp
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104c51:	6b c2 3c             	imul   $0x3c,%edx,%eax
+80104c54:	05 60 fa 14 80       	add    $0x8014fa60,%eax
+80104c59:	39 c7                	cmp    %eax,%edi
+80104c5b:	0f 83 c7 fe ff ff    	jae    80104b28 <kalloc+0x68>
+    if(o == c)
+80104c61:	39 fe                	cmp    %edi,%esi
+80104c63:	74 6b                	je     80104cd0 <kalloc+0x210>
+    acquire(&o->lock);
+80104c65:	83 ec 0c             	sub    $0xc,%esp
+80104c68:	57                   	push   %edi
+80104c69:	e8 02 2f 00 00       	call   80107b70 <acquire>
+  head = *list;
+80104c6e:	8b 47 34             	mov    0x34(%edi),%eax
+    chain = takepages(&o->freelist, (o->nfree+1)/2, &got);
+80104c71:	8b 57 38             	mov    0x38(%edi),%edx
+  if(head == 0){
+80104c74:	83 c4 10             	add    $0x10,%esp
+80104c77:	85 c0                	test   %eax,%eax
+80104c79:	74 6b                	je     80104ce6 <kalloc+0x226>
+  *list = r->next;
+80104c7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104c7e:	8b 00                	mov    (%eax),%eax
+  for(i = 1, r = head; i < n && r->next; i++)
+80104c80:	83 fa 02             	cmp    $0x2,%edx
+80104c83:	0f 8e 80 00 00 00    	jle    80104d09 <kalloc+0x249>
+    chain = takepages(&o->freelist, (o->nfree+1)/2, &got);
+80104c89:	83 c2 01             	add    $0x1,%edx
+  for(i = 1, r = head; i < n && r->next; i++)
+80104c8c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    chain = takepages(&o->freelist, (o->nfree+1)/2, &got);
+80104c91:	89 d0                	mov    %edx,%eax
+80104c93:	c1 e8 1f             	shr    $0x1f,%eax
+80104c96:	01 c2                	add    %eax,%edx
+  head = *list;
+80104c98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    chain = takepages(&o->freelist, (o->nfree+1)/2, &got);
+80104c9b:	d1 fa                	sar    %edx
+80104c9d:	eb 08                	jmp    80104ca7 <kalloc+0x1e7>
+80104c9f:	90                   	nop
+  for(i = 1, r = head; i < n && r->next; i++)
+80104ca0:	83 c3 01             	add    $0x1,%ebx
+80104ca3:	39 da                	cmp    %ebx,%edx
+80104ca5:	7e 39                	jle    80104ce0 <kalloc+0x220>
+80104ca7:	89 c1                	mov    %eax,%ecx
+80104ca9:	8b 00                	mov    (%eax),%eax
+80104cab:	85 c0                	test   %eax,%eax
+80104cad:	75 f1                	jne    80104ca0 <kalloc+0x1e0>
+  *list = r->next;
+80104caf:	89 47 34             	mov    %eax,0x34(%edi)
+    release(&o->lock);
+80104cb2:	83 ec 0c             	sub    $0xc,%esp
+  r->next = 0;
+80104cb5:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    o->nfree -= got;
+80104cbb:	29 5f 38             	sub    %ebx,0x38(%edi)
+    release(&o->lock);
+80104cbe:	57                   	push   %edi
+80104cbf:	e8 4c 2e 00 00       	call   80107b10 <release>
+  if(chain == 0)
+80104cc4:	83 c4 10             	add    $0x10,%esp
+80104cc7:	e9 24 ff ff ff       	jmp    80104bf0 <kalloc+0x130>
+80104ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104cd0:	8d 7e 3c             	lea    0x3c(%esi),%edi
+80104cd3:	e9 79 ff ff ff       	jmp    80104c51 <kalloc+0x191>
+80104cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104cdf:	90                   	nop
+  for(i = 1, r = head; i < n && r->next; i++)
+80104ce0:	89 c1                	mov    %eax,%ecx
+  *list = r->next;
+80104ce2:	8b 00                	mov    (%eax),%eax
+80104ce4:	eb c9                	jmp    80104caf <kalloc+0x1ef>
+    release(&o->lock);
+80104ce6:	83 ec 0c             	sub    $0xc,%esp
+80104ce9:	57                   	push   %edi
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104cea:	83 c7 3c             	add    $0x3c,%edi
+    release(&o->lock);
+80104ced:	e8 1e 2e 00 00       	call   80107b10 <release>
+  for(o = kcache; chain == 0 && o < kcache+ncpu; o++){
+80104cf2:	8b 15 c4 78 15 80    	mov    0x801578c4,%edx
+80104cf8:	83 c4 10             	add    $0x10,%esp
+80104cfb:	e9 51 ff ff ff       	jmp    80104c51 <kalloc+0x191>
+  for(i = 1, r = head; i < n && r->next; i++)
+80104d00:	89 c2                	mov    %eax,%edx
+  *list = r->next;
+80104d02:	8b 00                	mov    (%eax),%eax
+80104d04:	e9 cb fe ff ff       	jmp    80104bd4 <kalloc+0x114>
+  head = *list;
+80104d09:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(i = 1, r = head; i < n && r->next; i++)
+80104d0c:	bb 01 00 00 00       	mov    $0x1,%ebx
+80104d11:	eb 9c                	jmp    80104caf <kalloc+0x1ef>
+80104d13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104d20 <kincref>:
+
+// Add a reference to the page pointed at by v,
+// which another page table is about to share.
+void
+kincref(char *v)
+{
+80104d20:	55                   	push   %ebp
+80104d21:	89 e5                	mov    %esp,%ebp
+80104d23:	83 ec 08             	sub    $0x8,%esp
+80104d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80104d29:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80104d2e:	75 26                	jne    80104d56 <kincref+0x36>
+80104d30:	3d 10 9d 15 80       	cmp    $0x80159d10,%eax
+80104d35:	72 1f                	jb     80104d56 <kincref+0x36>
+80104d37:	05 00 00 00 80       	add    $0x80000000,%eax
+80104d3c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80104d41:	77 13                	ja     80104d56 <kincref+0x36>
+    panic("kincref");
+  xadd(&kref[V2P(v)/PGSIZE], 1);
+80104d43:	c1 e8 0c             	shr    $0xc,%eax
+80104d46:	ba 01 00 00 00       	mov    $0x1,%edx
+80104d4b:	f0 0f c1 14 85 60 7a 	lock xadd %edx,-0x7fee85a0(,%eax,4)
+80104d52:	11 80 
+}
+80104d54:	c9                   	leave
+80104d55:	c3                   	ret
+    panic("kincref");
+80104d56:	83 ec 0c             	sub    $0xc,%esp
+80104d59:	68 6f b0 10 80       	push   $0x8010b06f
+80104d5e:	e8 cd b9 ff ff       	call   80100730 <panic>
+80104d63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104d70 <krefcnt>:
+
+// Return the number of references to the page pointed at by v.
+int
+krefcnt(char *v)
+{
+80104d70:	55                   	push   %ebp
+80104d71:	89 e5                	mov    %esp,%ebp
+  return kref[V2P(v)/PGSIZE];
+80104d73:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80104d76:	5d                   	pop    %ebp
+  return kref[V2P(v)/PGSIZE];
+80104d77:	05 00 00 00 80       	add    $0x80000000,%eax
+80104d7c:	c1 e8 0c             	shr    $0xc,%eax
+80104d7f:	8b 04 85 60 7a 11 80 	mov    -0x7fee85a0(,%eax,4),%eax
+}
+80104d86:	c3                   	ret
+80104d87:	66 90                	xchg   %ax,%ax
+80104d89:	66 90                	xchg   %ax,%ax
+80104d8b:	66 90                	xchg   %ax,%ax
+80104d8d:	66 90                	xchg   %ax,%ax
+80104d8f:	90                   	nop
+
+80104d90 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104d90:	ba 64 00 00 00       	mov    $0x64,%edx
+80104d95:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80104d96:	a8 01                	test   $0x1,%al
+80104d98:	0f 84 c2 00 00 00    	je     80104e60 <kbdgetc+0xd0>
+{
+80104d9e:	55                   	push   %ebp
+80104d9f:	ba 60 00 00 00       	mov    $0x60,%edx
+80104da4:	89 e5                	mov    %esp,%ebp
+80104da6:	53                   	push   %ebx
+80104da7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80104da8:	8b 1d 40 fc 14 80    	mov    0x8014fc40,%ebx
+  data = inb(KBDATAP);
+80104dae:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80104db1:	3c e0                	cmp    $0xe0,%al
+80104db3:	74 5b                	je     80104e10 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104db5:	89 da                	mov    %ebx,%edx
+80104db7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80104dba:	84 c0                	test   %al,%al
+80104dbc:	78 6a                	js     80104e28 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80104dbe:	85 d2                	test   %edx,%edx
+80104dc0:	74 09                	je     80104dcb <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80104dc2:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80104dc5:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80104dc8:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80104dcb:	0f b6 91 a0 b1 10 80 	movzbl -0x7fef4e60(%ecx),%edx
+  shift ^= togglecode[data];
+80104dd2:	0f b6 81 a0 b0 10 80 	movzbl -0x7fef4f60(%ecx),%eax
+  shift |= shiftcode[data];
+80104dd9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80104ddb:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104ddd:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80104ddf:	89 15 40 fc 14 80    	mov    %edx,0x8014fc40
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104de5:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80104de8:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104deb:	8b 04 85 80 b0 10 80 	mov    -0x7fef4f80(,%eax,4),%eax
+80104df2:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80104df6:	74 0b                	je     80104e03 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80104df8:	8d 50 9f             	lea    -0x61(%eax),%edx
+80104dfb:	83 fa 19             	cmp    $0x19,%edx
+80104dfe:	77 48                	ja     80104e48 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80104e00:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80104e03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104e06:	c9                   	leave
+80104e07:	c3                   	ret
+80104e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e0f:	90                   	nop
+    shift |= E0ESC;
+80104e10:	89 d8                	mov    %ebx,%eax
+80104e12:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80104e15:	a3 40 fc 14 80       	mov    %eax,0x8014fc40
+    return 0;
+80104e1a:	31 c0                	xor    %eax,%eax
+}
+80104e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104e1f:	c9                   	leave
+80104e20:	c3                   	ret
+80104e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104e28:	83 e0 7f             	and    $0x7f,%eax
+80104e2b:	85 d2                	test   %edx,%edx
+80104e2d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80104e30:	0f b6 81 a0 b1 10 80 	movzbl -0x7fef4e60(%ecx),%eax
+80104e37:	83 c8 40             	or     $0x40,%eax
+80104e3a:	0f b6 c0             	movzbl %al,%eax
+80104e3d:	f7 d0                	not    %eax
+80104e3f:	21 d8                	and    %ebx,%eax
+    return 0;
+80104e41:	eb d2                	jmp    80104e15 <kbdgetc+0x85>
+80104e43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104e47:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80104e48:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80104e4b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80104e4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104e51:	c9                   	leave
+      c += 'a' - 'A';
+80104e52:	83 f9 1a             	cmp    $0x1a,%ecx
+80104e55:	0f 42 c2             	cmovb  %edx,%eax
+}
+80104e58:	c3                   	ret
+80104e59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80104e60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104e65:	c3                   	ret
+80104e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104e70 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80104e70:	55                   	push   %ebp
+80104e71:	89 e5                	mov    %esp,%ebp
+80104e73:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80104e76:	68 90 4d 10 80       	push   $0x80104d90
+80104e7b:	e8 f0 bd ff ff       	call   80100c70 <consoleintr>
+}
+80104e80:	83 c4 10             	add    $0x10,%esp
+80104e83:	c9                   	leave
+80104e84:	c3                   	ret
+80104e85:	66 90                	xchg   %ax,%ax
+80104e87:	66 90                	xchg   %ax,%ax
+80104e89:	66 90                	xchg   %ax,%ax
+80104e8b:	66 90                	xchg   %ax,%ax
+80104e8d:	66 90                	xchg   %ax,%ax
+80104e8f:	90                   	nop
+
+80104e90 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80104e90:	a1 44 fc 14 80       	mov    0x8014fc44,%eax
+80104e95:	85 c0                	test   %eax,%eax
+80104e97:	0f 84 cb 00 00 00    	je     80104f68 <lapicinit+0xd8>
+  lapic[index] = value;
+80104e9d:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80104ea4:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104ea7:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104eaa:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80104eb1:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104eb4:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104eb7:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+80104ebe:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104ec1:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104ec4:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+80104ecb:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104ece:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104ed1:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80104ed8:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104edb:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104ede:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80104ee5:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104ee8:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80104eeb:	8b 50 30             	mov    0x30(%eax),%edx
+80104eee:	c1 ea 10             	shr    $0x10,%edx
+80104ef1:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104ef7:	75 77                	jne    80104f70 <lapicinit+0xe0>
+  lapic[index] = value;
+80104ef9:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80104f00:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f03:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f06:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80104f0d:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f10:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f13:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80104f1a:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f1d:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f20:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80104f27:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f2a:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f2d:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80104f34:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f37:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f3a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80104f41:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f44:	8b 50 20             	mov    0x20(%eax),%edx
+80104f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f4e:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80104f50:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80104f56:	80 e6 10             	and    $0x10,%dh
+80104f59:	75 f5                	jne    80104f50 <lapicinit+0xc0>
+  lapic[index] = value;
+80104f5b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80104f62:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f65:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80104f68:	c3                   	ret
+80104f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80104f70:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+80104f77:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f7a:	8b 50 20             	mov    0x20(%eax),%edx
+}
+80104f7d:	e9 77 ff ff ff       	jmp    80104ef9 <lapicinit+0x69>
+80104f82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104f90 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80104f90:	a1 44 fc 14 80       	mov    0x8014fc44,%eax
+80104f95:	85 c0                	test   %eax,%eax
+80104f97:	74 07                	je     80104fa0 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80104f99:	8b 40 20             	mov    0x20(%eax),%eax
+80104f9c:	c1 e8 18             	shr    $0x18,%eax
+80104f9f:	c3                   	ret
+    return 0;
+80104fa0:	31 c0                	xor    %eax,%eax
+}
+80104fa2:	c3                   	ret
+80104fa3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104fb0 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80104fb0:	a1 44 fc 14 80       	mov    0x8014fc44,%eax
+80104fb5:	85 c0                	test   %eax,%eax
+80104fb7:	74 0d                	je     80104fc6 <lapiceoi+0x16>
+  lapic[index] = value;
+80104fb9:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80104fc0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fc3:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80104fc6:	c3                   	ret
+80104fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fce:	66 90                	xchg   %ax,%ax
+
+80104fd0 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80104fd0:	c3                   	ret
+80104fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fdf:	90                   	nop
+
+80104fe0 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80104fe0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104fe1:	b8 0f 00 00 00       	mov    $0xf,%eax
+80104fe6:	ba 70 00 00 00       	mov    $0x70,%edx
+80104feb:	89 e5                	mov    %esp,%ebp
+80104fed:	53                   	push   %ebx
+80104fee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104ff1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104ff4:	ee                   	out    %al,(%dx)
+80104ff5:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104ffa:	ba 71 00 00 00       	mov    $0x71,%edx
+80104fff:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80105000:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80105002:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80105005:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+8010500b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+8010500d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80105010:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80105012:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80105015:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80105018:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+8010501e:	a1 44 fc 14 80       	mov    0x8014fc44,%eax
+80105023:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105029:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010502c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80105033:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105036:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105039:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80105040:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105043:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105046:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010504c:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010504f:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105055:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105058:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010505e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80105061:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105067:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+8010506a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010506d:	c9                   	leave
+8010506e:	c3                   	ret
+8010506f:	90                   	nop
+
+80105070 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80105070:	55                   	push   %ebp
+80105071:	b8 0b 00 00 00       	mov    $0xb,%eax
+80105076:	ba 70 00 00 00       	mov    $0x70,%edx
+8010507b:	89 e5                	mov    %esp,%ebp
+8010507d:	57                   	push   %edi
+8010507e:	56                   	push   %esi
+8010507f:	53                   	push   %ebx
+80105080:	83 ec 4c             	sub    $0x4c,%esp
+80105083:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105084:	ba 71 00 00 00       	mov    $0x71,%edx
+80105089:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+8010508a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010508d:	bf 70 00 00 00       	mov    $0x70,%edi
+80105092:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80105095:	8d 76 00             	lea    0x0(%esi),%esi
+80105098:	31 c0                	xor    %eax,%eax
+8010509a:	89 fa                	mov    %edi,%edx
+8010509c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010509d:	b9 71 00 00 00       	mov    $0x71,%ecx
+801050a2:	89 ca                	mov    %ecx,%edx
+801050a4:	ec                   	in     (%dx),%al
+801050a5:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050a8:	89 fa                	mov    %edi,%edx
+801050aa:	b8 02 00 00 00       	mov    $0x2,%eax
+801050af:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050b0:	89 ca                	mov    %ecx,%edx
+801050b2:	ec                   	in     (%dx),%al
+801050b3:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050b6:	89 fa                	mov    %edi,%edx
+801050b8:	b8 04 00 00 00       	mov    $0x4,%eax
+801050bd:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050be:	89 ca                	mov    %ecx,%edx
+801050c0:	ec                   	in     (%dx),%al
+801050c1:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050c4:	89 fa                	mov    %edi,%edx
+801050c6:	b8 07 00 00 00       	mov    $0x7,%eax
+801050cb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050cc:	89 ca                	mov    %ecx,%edx
+801050ce:	ec                   	in     (%dx),%al
+801050cf:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050d2:	89 fa                	mov    %edi,%edx
+801050d4:	b8 08 00 00 00       	mov    $0x8,%eax
+801050d9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050da:	89 ca                	mov    %ecx,%edx
+801050dc:	ec                   	in     (%dx),%al
+801050dd:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050df:	89 fa                	mov    %edi,%edx
+801050e1:	b8 09 00 00 00       	mov    $0x9,%eax
+801050e6:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050e7:	89 ca                	mov    %ecx,%edx
+801050e9:	ec                   	in     (%dx),%al
+801050ea:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050ed:	89 fa                	mov    %edi,%edx
+801050ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+801050f4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801050f5:	89 ca                	mov    %ecx,%edx
+801050f7:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+801050f8:	84 c0                	test   %al,%al
+801050fa:	78 9c                	js     80105098 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+801050fc:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80105100:	89 f2                	mov    %esi,%edx
+80105102:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80105105:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105108:	89 fa                	mov    %edi,%edx
+8010510a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010510d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80105111:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80105114:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80105117:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+8010511b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+8010511e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80105122:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80105125:	31 c0                	xor    %eax,%eax
+80105127:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105128:	89 ca                	mov    %ecx,%edx
+8010512a:	ec                   	in     (%dx),%al
+8010512b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010512e:	89 fa                	mov    %edi,%edx
+80105130:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80105133:	b8 02 00 00 00       	mov    $0x2,%eax
+80105138:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105139:	89 ca                	mov    %ecx,%edx
+8010513b:	ec                   	in     (%dx),%al
+8010513c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010513f:	89 fa                	mov    %edi,%edx
+80105141:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80105144:	b8 04 00 00 00       	mov    $0x4,%eax
+80105149:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010514a:	89 ca                	mov    %ecx,%edx
+8010514c:	ec                   	in     (%dx),%al
+8010514d:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105150:	89 fa                	mov    %edi,%edx
+80105152:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80105155:	b8 07 00 00 00       	mov    $0x7,%eax
+8010515a:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010515b:	89 ca                	mov    %ecx,%edx
+8010515d:	ec                   	in     (%dx),%al
+8010515e:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105161:	89 fa                	mov    %edi,%edx
+80105163:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80105166:	b8 08 00 00 00       	mov    $0x8,%eax
+8010516b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010516c:	89 ca                	mov    %ecx,%edx
+8010516e:	ec                   	in     (%dx),%al
+8010516f:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105172:	89 fa                	mov    %edi,%edx
+80105174:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105177:	b8 09 00 00 00       	mov    $0x9,%eax
+8010517c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010517d:	89 ca                	mov    %ecx,%edx
+8010517f:	ec                   	in     (%dx),%al
+80105180:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80105183:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80105186:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80105189:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010518c:	6a 18                	push   $0x18
+8010518e:	50                   	push   %eax
+8010518f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80105192:	50                   	push   %eax
+80105193:	e8 f8 2a 00 00       	call   80107c90 <memcmp>
+80105198:	83 c4 10             	add    $0x10,%esp
+8010519b:	85 c0                	test   %eax,%eax
+8010519d:	0f 85 f5 fe ff ff    	jne    80105098 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+801051a3:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+801051a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801051aa:	89 f0                	mov    %esi,%eax
+801051ac:	84 c0                	test   %al,%al
+801051ae:	75 78                	jne    80105228 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+801051b0:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801051b3:	89 c2                	mov    %eax,%edx
+801051b5:	83 e0 0f             	and    $0xf,%eax
+801051b8:	c1 ea 04             	shr    $0x4,%edx
+801051bb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801051be:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801051c1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+801051c4:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801051c7:	89 c2                	mov    %eax,%edx
+801051c9:	83 e0 0f             	and    $0xf,%eax
+801051cc:	c1 ea 04             	shr    $0x4,%edx
+801051cf:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801051d2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801051d5:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+801051d8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+801051db:	89 c2                	mov    %eax,%edx
+801051dd:	83 e0 0f             	and    $0xf,%eax
+801051e0:	c1 ea 04             	shr    $0x4,%edx
+801051e3:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801051e6:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801051e9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+801051ec:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801051ef:	89 c2                	mov    %eax,%edx
+801051f1:	83 e0 0f             	and    $0xf,%eax
+801051f4:	c1 ea 04             	shr    $0x4,%edx
+801051f7:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801051fa:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801051fd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80105200:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80105203:	89 c2                	mov    %eax,%edx
+80105205:	83 e0 0f             	and    $0xf,%eax
+80105208:	c1 ea 04             	shr    $0x4,%edx
+8010520b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010520e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80105211:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80105214:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80105217:	89 c2                	mov    %eax,%edx
+80105219:	83 e0 0f             	and    $0xf,%eax
+8010521c:	c1 ea 04             	shr    $0x4,%edx
+8010521f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80105222:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80105225:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80105228:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010522b:	89 03                	mov    %eax,(%ebx)
+8010522d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80105230:	89 43 04             	mov    %eax,0x4(%ebx)
+80105233:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80105236:	89 43 08             	mov    %eax,0x8(%ebx)
+80105239:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010523c:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010523f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80105242:	89 43 10             	mov    %eax,0x10(%ebx)
+80105245:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80105248:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+8010524b:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80105252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105255:	5b                   	pop    %ebx
+80105256:	5e                   	pop    %esi
+80105257:	5f                   	pop    %edi
+80105258:	5d                   	pop    %ebp
+80105259:	c3                   	ret
+8010525a:	66 90                	xchg   %ax,%ax
+8010525c:	66 90                	xchg   %ax,%ax
+8010525e:	66 90                	xchg   %ax,%ax
+
+80105260 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80105260:	55                   	push   %ebp
+80105261:	89 e5                	mov    %esp,%ebp
+80105263:	56                   	push   %esi
+80105264:	53                   	push   %ebx
+  struct buf *buf = bread(log.dev, log.start);
+80105265:	83 ec 08             	sub    $0x8,%esp
+80105268:	ff 35 94 fc 14 80    	push   0x8014fc94
+8010526e:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+80105274:	e8 f7 b1 ff ff       	call   80100470 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.clh.n;
+  for (i = 0; i < log.clh.n; i++) {
+80105279:	83 c4 10             	add    $0x10,%esp
+8010527c:	31 d2                	xor    %edx,%edx
+  struct logheader *hb = (struct logheader *) (buf->data);
+8010527e:	8b 58 60             	mov    0x60(%eax),%ebx
+  struct buf *buf = bread(log.dev, log.start);
+80105281:	89 c6                	mov    %eax,%esi
+  hb->n = log.clh.n;
+80105283:	a1 b0 fd 14 80       	mov    0x8014fdb0,%eax
+80105288:	89 03                	mov    %eax,(%ebx)
+  for (i = 0; i < log.clh.n; i++) {
+8010528a:	85 c0                	test   %eax,%eax
+8010528c:	7e 18                	jle    801052a6 <write_head+0x46>
+8010528e:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.clh.block[i];
+80105290:	8b 0c 95 b4 fd 14 80 	mov    -0x7feb024c(,%edx,4),%ecx
+80105297:	89 4c 93 04          	mov    %ecx,0x4(%ebx,%edx,4)
+  for (i = 0; i < log.clh.n; i++) {
+8010529b:	83 c2 01             	add    $0x1,%edx
+8010529e:	39 15 b0 fd 14 80    	cmp    %edx,0x8014fdb0
+801052a4:	7f ea                	jg     80105290 <write_head+0x30>
+  }
+  bwrite(buf);
+801052a6:	83 ec 0c             	sub    $0xc,%esp
+801052a9:	56                   	push   %esi
+801052aa:	e8 01 b2 ff ff       	call   801004b0 <bwrite>
+  brelse(buf);
+801052af:	89 34 24             	mov    %esi,(%esp)
+801052b2:	e8 a9 b2 ff ff       	call   80100560 <brelse>
+}
+801052b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801052ba:	5b                   	pop    %ebx
+801052bb:	5e                   	pop    %esi
+801052bc:	5d                   	pop    %ebp
+801052bd:	c3                   	ret
+801052be:	66 90                	xchg   %ax,%ax
+
+801052c0 <logflusher>:
+}
+
+// Kernel thread that commits the log; see the comment at the top.
+static void
+logflusher(void)
+{
+801052c0:	55                   	push   %ebp
+801052c1:	89 e5                	mov    %esp,%ebp
+801052c3:	57                   	push   %edi
+801052c4:	56                   	push   %esi
+801052c5:	53                   	push   %ebx
+801052c6:	bb b0 fd 14 80       	mov    $0x8014fdb0,%ebx
+801052cb:	83 ec 18             	sub    $0x18,%esp
+  acquire(&log.lock);
+801052ce:	68 60 fc 14 80       	push   $0x8014fc60
+801052d3:	e8 98 28 00 00       	call   80107b70 <acquire>
+801052d8:	83 c4 10             	add    $0x10,%esp
+801052db:	eb 18                	jmp    801052f5 <logflusher+0x35>
+801052dd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(;;){
+    if(log.lh.n == 0 || log.outstanding > 0 ||
+       (!logfull() && !log.syncwait && ticks - log.since < LOGFLUSHTICKS)){
+      sleep(&log.flusher, &log.lock);
+801052e0:	83 ec 08             	sub    $0x8,%esp
+801052e3:	68 60 fc 14 80       	push   $0x8014fc60
+801052e8:	68 b4 fc 14 80       	push   $0x8014fcb4
+801052ed:	e8 8e 1e 00 00       	call   80107180 <sleep>
+      continue;
+801052f2:	83 c4 10             	add    $0x10,%esp
+    if(log.lh.n == 0 || log.outstanding > 0 ||
+801052f5:	a1 bc fc 14 80       	mov    0x8014fcbc,%eax
+801052fa:	85 c0                	test   %eax,%eax
+801052fc:	74 e2                	je     801052e0 <logflusher+0x20>
+801052fe:	8b 15 9c fc 14 80    	mov    0x8014fc9c,%edx
+80105304:	85 d2                	test   %edx,%edx
+80105306:	7f d8                	jg     801052e0 <logflusher+0x20>
+  return log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE;
+80105308:	8d 54 92 05          	lea    0x5(%edx,%edx,4),%edx
+8010530c:	8d 04 50             	lea    (%eax,%edx,2),%eax
+    if(log.lh.n == 0 || log.outstanding > 0 ||
+8010530f:	83 f8 3c             	cmp    $0x3c,%eax
+80105312:	7f 1a                	jg     8010532e <logflusher+0x6e>
+       (!logfull() && !log.syncwait && ticks - log.since < LOGFLUSHTICKS)){
+80105314:	8b 35 a8 fc 14 80    	mov    0x8014fca8,%esi
+8010531a:	85 f6                	test   %esi,%esi
+8010531c:	75 10                	jne    8010532e <logflusher+0x6e>
+8010531e:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+80105323:	2b 05 b0 fc 14 80    	sub    0x8014fcb0,%eax
+80105329:	83 f8 09             	cmp    $0x9,%eax
+8010532c:	76 b2                	jbe    801052e0 <logflusher+0x20>
+    }
+    // Close the transaction.  No FS system call is active,
+    // so the cached blocks hold exactly its updates.
+    log.closing = 1;
+8010532e:	c7 05 a0 fc 14 80 01 	movl   $0x1,0x8014fca0
+80105335:	00 00 00 
+    release(&log.lock);
+80105338:	83 ec 0c             	sub    $0xc,%esp
+8010533b:	68 60 fc 14 80       	push   $0x8014fc60
+80105340:	e8 cb 27 00 00       	call   80107b10 <release>
+static void
+snapshot(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80105345:	8b 0d bc fc 14 80    	mov    0x8014fcbc,%ecx
+8010534b:	83 c4 10             	add    $0x10,%esp
+8010534e:	85 c9                	test   %ecx,%ecx
+80105350:	7e 4e                	jle    801053a0 <logflusher+0xe0>
+80105352:	31 f6                	xor    %esi,%esi
+80105354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80105358:	83 ec 08             	sub    $0x8,%esp
+8010535b:	ff 34 b5 c0 fc 14 80 	push   -0x7feb0340(,%esi,4)
+80105362:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+80105368:	e8 03 b1 ff ff       	call   80100470 <bread>
+    memmove(snap[tail], from->data, BSIZE);
+8010536d:	83 c4 0c             	add    $0xc,%esp
+80105370:	68 00 02 00 00       	push   $0x200
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80105375:	89 c7                	mov    %eax,%edi
+    memmove(snap[tail], from->data, BSIZE);
+80105377:	ff 70 60             	push   0x60(%eax)
+8010537a:	89 f0                	mov    %esi,%eax
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010537c:	83 c6 01             	add    $0x1,%esi
+    memmove(snap[tail], from->data, BSIZE);
+8010537f:	c1 e0 09             	shl    $0x9,%eax
+80105382:	05 c0 00 15 80       	add    $0x801500c0,%eax
+80105387:	50                   	push   %eax
+80105388:	e8 53 29 00 00       	call   80107ce0 <memmove>
+    brelse(from);
+8010538d:	89 3c 24             	mov    %edi,(%esp)
+80105390:	e8 cb b1 ff ff       	call   80100560 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80105395:	83 c4 10             	add    $0x10,%esp
+80105398:	3b 35 bc fc 14 80    	cmp    0x8014fcbc,%esi
+8010539e:	7c b8                	jl     80105358 <logflusher+0x98>
+    acquire(&log.lock);
+801053a0:	83 ec 0c             	sub    $0xc,%esp
+    log.clh = log.lh;
+801053a3:	89 df                	mov    %ebx,%edi
+801053a5:	be bc fc 14 80       	mov    $0x8014fcbc,%esi
+    acquire(&log.lock);
+801053aa:	68 60 fc 14 80       	push   $0x8014fc60
+801053af:	e8 bc 27 00 00       	call   80107b70 <acquire>
+    log.clh = log.lh;
+801053b4:	b9 3d 00 00 00       	mov    $0x3d,%ecx
+    log.closing = 0;
+801053b9:	c7 05 a0 fc 14 80 00 	movl   $0x0,0x8014fca0
+801053c0:	00 00 00 
+    log.clh = log.lh;
+801053c3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    log.committing = 1;
+801053c5:	c7 05 a4 fc 14 80 01 	movl   $0x1,0x8014fca4
+801053cc:	00 00 00 
+    wakeup(&log);
+801053cf:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+    log.lh.n = 0;
+801053d6:	c7 05 bc fc 14 80 00 	movl   $0x0,0x8014fcbc
+801053dd:	00 00 00 
+    wakeup(&log);
+801053e0:	e8 ab 1e 00 00       	call   80107290 <wakeup>
+    release(&log.lock);
+801053e5:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+801053ec:	e8 1f 27 00 00       	call   80107b10 <release>
+}
+
+static void
+commit()
+{
+  if (log.clh.n > 0) {
+801053f1:	8b 15 b0 fd 14 80    	mov    0x8014fdb0,%edx
+801053f7:	83 c4 10             	add    $0x10,%esp
+801053fa:	85 d2                	test   %edx,%edx
+801053fc:	7f 42                	jg     80105440 <logflusher+0x180>
+    acquire(&log.lock);
+801053fe:	83 ec 0c             	sub    $0xc,%esp
+80105401:	68 60 fc 14 80       	push   $0x8014fc60
+80105406:	e8 65 27 00 00       	call   80107b70 <acquire>
+    wakeup(&log.ncommit);
+8010540b:	c7 04 24 ac fc 14 80 	movl   $0x8014fcac,(%esp)
+    log.ncommit++;
+80105412:	83 05 ac fc 14 80 01 	addl   $0x1,0x8014fcac
+    log.committing = 0;
+80105419:	c7 05 a4 fc 14 80 00 	movl   $0x0,0x8014fca4
+80105420:	00 00 00 
+    wakeup(&log.ncommit);
+80105423:	e8 68 1e 00 00       	call   80107290 <wakeup>
+    wakeup(&log);
+80105428:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+8010542f:	e8 5c 1e 00 00       	call   80107290 <wakeup>
+80105434:	83 c4 10             	add    $0x10,%esp
+80105437:	e9 b9 fe ff ff       	jmp    801052f5 <logflusher+0x35>
+8010543c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for (tail = 0; tail < log.clh.n; tail++) {
+80105440:	31 ff                	xor    %edi,%edi
+80105442:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80105448:	a1 94 fc 14 80       	mov    0x8014fc94,%eax
+8010544d:	83 ec 08             	sub    $0x8,%esp
+80105450:	01 f8                	add    %edi,%eax
+80105452:	83 c0 01             	add    $0x1,%eax
+80105455:	50                   	push   %eax
+80105456:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+8010545c:	e8 0f b0 ff ff       	call   80100470 <bread>
+    memmove(to->data, snap[tail], BSIZE);
+80105461:	83 c4 0c             	add    $0xc,%esp
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80105464:	89 c6                	mov    %eax,%esi
+    memmove(to->data, snap[tail], BSIZE);
+80105466:	89 f8                	mov    %edi,%eax
+80105468:	68 00 02 00 00       	push   $0x200
+  for (tail = 0; tail < log.clh.n; tail++) {
+8010546d:	83 c7 01             	add    $0x1,%edi
+    memmove(to->data, snap[tail], BSIZE);
+80105470:	c1 e0 09             	shl    $0x9,%eax
+80105473:	05 c0 00 15 80       	add    $0x801500c0,%eax
+80105478:	50                   	push   %eax
+80105479:	ff 76 60             	push   0x60(%esi)
+8010547c:	e8 5f 28 00 00       	call   80107ce0 <memmove>
+    bwrite(to);  // write the log
+80105481:	89 34 24             	mov    %esi,(%esp)
+80105484:	e8 27 b0 ff ff       	call   801004b0 <bwrite>
+    brelse(to);
+80105489:	89 34 24             	mov    %esi,(%esp)
+8010548c:	e8 cf b0 ff ff       	call   80100560 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+80105491:	83 c4 10             	add    $0x10,%esp
+80105494:	3b 3d b0 fd 14 80    	cmp    0x8014fdb0,%edi
+8010549a:	7c ac                	jl     80105448 <logflusher+0x188>
+    write_log();     // Write snapshot to log
+    write_head();    // Write header to disk -- the real commit
+8010549c:	e8 bf fd ff ff       	call   80105260 <write_head>
+  for (tail = 0; tail < log.clh.n; tail++) {
+801054a1:	a1 b0 fd 14 80       	mov    0x8014fdb0,%eax
+801054a6:	85 c0                	test   %eax,%eax
+801054a8:	0f 8e d1 00 00 00    	jle    8010557f <logflusher+0x2bf>
+801054ae:	31 ff                	xor    %edi,%edi
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // cache block
+801054b0:	83 ec 08             	sub    $0x8,%esp
+801054b3:	ff 34 bd b4 fd 14 80 	push   -0x7feb024c(,%edi,4)
+801054ba:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+801054c0:	e8 ab af ff ff       	call   80100470 <bread>
+    acquire(&log.lock);
+801054c5:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // cache block
+801054cc:	89 c6                	mov    %eax,%esi
+    acquire(&log.lock);
+801054ce:	e8 9d 26 00 00       	call   80107b70 <acquire>
+  for (i = 0; i < log.lh.n; i++)
+801054d3:	8b 15 bc fc 14 80    	mov    0x8014fcbc,%edx
+    open = inopen(dbuf->blockno);
+801054d9:	8b 4e 08             	mov    0x8(%esi),%ecx
+  for (i = 0; i < log.lh.n; i++)
+801054dc:	83 c4 10             	add    $0x10,%esp
+801054df:	85 d2                	test   %edx,%edx
+801054e1:	0f 8e b1 00 00 00    	jle    80105598 <logflusher+0x2d8>
+801054e7:	31 c0                	xor    %eax,%eax
+801054e9:	eb 10                	jmp    801054fb <logflusher+0x23b>
+801054eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801054ef:	90                   	nop
+801054f0:	83 c0 01             	add    $0x1,%eax
+801054f3:	39 d0                	cmp    %edx,%eax
+801054f5:	0f 84 9d 00 00 00    	je     80105598 <logflusher+0x2d8>
+    if (log.lh.block[i] == b)
+801054fb:	3b 0c 85 c0 fc 14 80 	cmp    -0x7feb0340(,%eax,4),%ecx
+80105502:	75 ec                	jne    801054f0 <logflusher+0x230>
+    release(&log.lock);
+80105504:	83 ec 0c             	sub    $0xc,%esp
+80105507:	68 60 fc 14 80       	push   $0x8014fc60
+8010550c:	e8 ff 25 00 00       	call   80107b10 <release>
+      memmove(newer, dbuf->data, BSIZE);
+80105511:	83 c4 0c             	add    $0xc,%esp
+80105514:	68 00 02 00 00       	push   $0x200
+80105519:	ff 76 60             	push   0x60(%esi)
+8010551c:	68 c0 fe 14 80       	push   $0x8014fec0
+80105521:	e8 ba 27 00 00       	call   80107ce0 <memmove>
+      memmove(dbuf->data, snap[tail], BSIZE);
+80105526:	89 f8                	mov    %edi,%eax
+80105528:	83 c4 0c             	add    $0xc,%esp
+8010552b:	c1 e0 09             	shl    $0x9,%eax
+8010552e:	68 00 02 00 00       	push   $0x200
+80105533:	05 c0 00 15 80       	add    $0x801500c0,%eax
+80105538:	50                   	push   %eax
+80105539:	ff 76 60             	push   0x60(%esi)
+8010553c:	e8 9f 27 00 00       	call   80107ce0 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80105541:	89 34 24             	mov    %esi,(%esp)
+80105544:	e8 67 af ff ff       	call   801004b0 <bwrite>
+      memmove(dbuf->data, newer, BSIZE);
+80105549:	83 c4 0c             	add    $0xc,%esp
+8010554c:	68 00 02 00 00       	push   $0x200
+80105551:	68 c0 fe 14 80       	push   $0x8014fec0
+80105556:	ff 76 60             	push   0x60(%esi)
+80105559:	e8 82 27 00 00       	call   80107ce0 <memmove>
+      dbuf->flags |= B_DIRTY;
+8010555e:	83 0e 04             	orl    $0x4,(%esi)
+80105561:	83 c4 10             	add    $0x10,%esp
+    brelse(dbuf);
+80105564:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < log.clh.n; tail++) {
+80105567:	83 c7 01             	add    $0x1,%edi
+    brelse(dbuf);
+8010556a:	56                   	push   %esi
+8010556b:	e8 f0 af ff ff       	call   80100560 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+80105570:	83 c4 10             	add    $0x10,%esp
+80105573:	3b 3d b0 fd 14 80    	cmp    0x8014fdb0,%edi
+80105579:	0f 8c 31 ff ff ff    	jl     801054b0 <logflusher+0x1f0>
+    install_snap();  // Now install writes to home locations
+    log.clh.n = 0;
+8010557f:	c7 05 b0 fd 14 80 00 	movl   $0x0,0x8014fdb0
+80105586:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80105589:	e8 d2 fc ff ff       	call   80105260 <write_head>
+8010558e:	e9 6b fe ff ff       	jmp    801053fe <logflusher+0x13e>
+80105593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105597:	90                   	nop
+    release(&log.lock);
+80105598:	83 ec 0c             	sub    $0xc,%esp
+8010559b:	68 60 fc 14 80       	push   $0x8014fc60
+801055a0:	e8 6b 25 00 00       	call   80107b10 <release>
+801055a5:	83 c4 10             	add    $0x10,%esp
+    bwrite(dbuf);  // write dst to disk
+801055a8:	83 ec 0c             	sub    $0xc,%esp
+801055ab:	56                   	push   %esi
+801055ac:	e8 ff ae ff ff       	call   801004b0 <bwrite>
+801055b1:	83 c4 10             	add    $0x10,%esp
+801055b4:	eb ae                	jmp    80105564 <logflusher+0x2a4>
+801055b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801055c0 <initlog>:
+{
+801055c0:	55                   	push   %ebp
+801055c1:	89 e5                	mov    %esp,%ebp
+801055c3:	57                   	push   %edi
+801055c4:	56                   	push   %esi
+801055c5:	53                   	push   %ebx
+801055c6:	83 ec 34             	sub    $0x34,%esp
+801055c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801055cc:	68 a0 b2 10 80       	push   $0x8010b2a0
+801055d1:	68 60 fc 14 80       	push   $0x8014fc60
+801055d6:	e8 b5 23 00 00       	call   80107990 <initlock>
+  readsb(dev, &sb);
+801055db:	8d 45 c8             	lea    -0x38(%ebp),%eax
+801055de:	5e                   	pop    %esi
+801055df:	5f                   	pop    %edi
+801055e0:	50                   	push   %eax
+801055e1:	53                   	push   %ebx
+801055e2:	e8 49 cf ff ff       	call   80102530 <readsb>
+  log.size = sb.nlog;
+801055e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  log.start = sb.logstart;
+801055ea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  log.dev = dev;
+801055ed:	89 1d b8 fc 14 80    	mov    %ebx,0x8014fcb8
+  log.start = sb.logstart;
+801055f3:	a3 94 fc 14 80       	mov    %eax,0x8014fc94
+  log.size = sb.nlog;
+801055f8:	89 15 98 fc 14 80    	mov    %edx,0x8014fc98
+  struct buf *buf = bread(log.dev, log.start);
+801055fe:	5a                   	pop    %edx
+801055ff:	59                   	pop    %ecx
+80105600:	50                   	push   %eax
+80105601:	53                   	push   %ebx
+80105602:	e8 69 ae ff ff       	call   80100470 <bread>
+  for (i = 0; i < log.clh.n; i++) {
+80105607:	83 c4 10             	add    $0x10,%esp
+  struct logheader *lh = (struct logheader *) (buf->data);
+8010560a:	8b 70 60             	mov    0x60(%eax),%esi
+  log.clh.n = lh->n;
+8010560d:	8b 1e                	mov    (%esi),%ebx
+8010560f:	89 1d b0 fd 14 80    	mov    %ebx,0x8014fdb0
+  for (i = 0; i < log.clh.n; i++) {
+80105615:	85 db                	test   %ebx,%ebx
+80105617:	7e 19                	jle    80105632 <initlog+0x72>
+80105619:	31 d2                	xor    %edx,%edx
+8010561b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010561f:	90                   	nop
+    log.clh.block[i] = lh->block[i];
+80105620:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80105624:	89 0c 95 b4 fd 14 80 	mov    %ecx,-0x7feb024c(,%edx,4)
+  for (i = 0; i < log.clh.n; i++) {
+8010562b:	83 c2 01             	add    $0x1,%edx
+8010562e:	39 d3                	cmp    %edx,%ebx
+80105630:	75 ee                	jne    80105620 <initlog+0x60>
+  brelse(buf);
+80105632:	83 ec 0c             	sub    $0xc,%esp
+80105635:	50                   	push   %eax
+80105636:	e8 25 af ff ff       	call   80100560 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+8010563b:	8b 0d b0 fd 14 80    	mov    0x8014fdb0,%ecx
+80105641:	83 c4 10             	add    $0x10,%esp
+80105644:	85 c9                	test   %ecx,%ecx
+80105646:	7e 72                	jle    801056ba <initlog+0xfa>
+80105648:	31 ff                	xor    %edi,%edi
+8010564a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80105650:	a1 94 fc 14 80       	mov    0x8014fc94,%eax
+80105655:	83 ec 08             	sub    $0x8,%esp
+80105658:	01 f8                	add    %edi,%eax
+8010565a:	83 c0 01             	add    $0x1,%eax
+8010565d:	50                   	push   %eax
+8010565e:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+80105664:	e8 07 ae ff ff       	call   80100470 <bread>
+80105669:	89 c6                	mov    %eax,%esi
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // read dst
+8010566b:	58                   	pop    %eax
+8010566c:	5a                   	pop    %edx
+8010566d:	ff 34 bd b4 fd 14 80 	push   -0x7feb024c(,%edi,4)
+80105674:	ff 35 b8 fc 14 80    	push   0x8014fcb8
+  for (tail = 0; tail < log.clh.n; tail++) {
+8010567a:	83 c7 01             	add    $0x1,%edi
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // read dst
+8010567d:	e8 ee ad ff ff       	call   80100470 <bread>
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80105682:	83 c4 0c             	add    $0xc,%esp
+80105685:	68 00 02 00 00       	push   $0x200
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // read dst
+8010568a:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+8010568c:	ff 76 60             	push   0x60(%esi)
+8010568f:	ff 70 60             	push   0x60(%eax)
+80105692:	e8 49 26 00 00       	call   80107ce0 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80105697:	89 1c 24             	mov    %ebx,(%esp)
+8010569a:	e8 11 ae ff ff       	call   801004b0 <bwrite>
+    brelse(lbuf);
+8010569f:	89 34 24             	mov    %esi,(%esp)
+801056a2:	e8 b9 ae ff ff       	call   80100560 <brelse>
+    brelse(dbuf);
+801056a7:	89 1c 24             	mov    %ebx,(%esp)
+801056aa:	e8 b1 ae ff ff       	call   80100560 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+801056af:	83 c4 10             	add    $0x10,%esp
+801056b2:	3b 3d b0 fd 14 80    	cmp    0x8014fdb0,%edi
+801056b8:	7c 96                	jl     80105650 <initlog+0x90>
+  log.clh.n = 0;
+801056ba:	c7 05 b0 fd 14 80 00 	movl   $0x0,0x8014fdb0
+801056c1:	00 00 00 
+  write_head(); // clear the log
+801056c4:	e8 97 fb ff ff       	call   80105260 <write_head>
+  if(kthread("logflush", logflusher) < 0)
+801056c9:	83 ec 08             	sub    $0x8,%esp
+801056cc:	68 c0 52 10 80       	push   $0x801052c0
+801056d1:	68 a4 b2 10 80       	push   $0x8010b2a4
+801056d6:	e8 75 12 00 00       	call   80106950 <kthread>
+801056db:	83 c4 10             	add    $0x10,%esp
+801056de:	85 c0                	test   %eax,%eax
+801056e0:	78 08                	js     801056ea <initlog+0x12a>
+}
+801056e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801056e5:	5b                   	pop    %ebx
+801056e6:	5e                   	pop    %esi
+801056e7:	5f                   	pop    %edi
+801056e8:	5d                   	pop    %ebp
+801056e9:	c3                   	ret
+    panic("initlog: no log flusher");
+801056ea:	83 ec 0c             	sub    $0xc,%esp
+801056ed:	68 ad b2 10 80       	push   $0x8010b2ad
+801056f2:	e8 39 b0 ff ff       	call   80100730 <panic>
+801056f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056fe:	66 90                	xchg   %ax,%ax
+
+80105700 <begin_op>:
+{
+80105700:	55                   	push   %ebp
+80105701:	89 e5                	mov    %esp,%ebp
+80105703:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80105706:	68 60 fc 14 80       	push   $0x8014fc60
+8010570b:	e8 60 24 00 00       	call   80107b70 <acquire>
+80105710:	83 c4 10             	add    $0x10,%esp
+80105713:	eb 1c                	jmp    80105731 <begin_op+0x31>
+80105715:	8d 76 00             	lea    0x0(%esi),%esi
+    } else if(log.syncwait && log.lh.n > 0){
+80105718:	85 d2                	test   %edx,%edx
+8010571a:	7e 41                	jle    8010575d <begin_op+0x5d>
+      sleep(&log, &log.lock);
+8010571c:	83 ec 08             	sub    $0x8,%esp
+8010571f:	68 60 fc 14 80       	push   $0x8014fc60
+80105724:	68 60 fc 14 80       	push   $0x8014fc60
+80105729:	e8 52 1a 00 00       	call   80107180 <sleep>
+8010572e:	83 c4 10             	add    $0x10,%esp
+    if(log.closing){
+80105731:	a1 a0 fc 14 80       	mov    0x8014fca0,%eax
+80105736:	85 c0                	test   %eax,%eax
+80105738:	75 e2                	jne    8010571c <begin_op+0x1c>
+  return log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE;
+8010573a:	a1 9c fc 14 80       	mov    0x8014fc9c,%eax
+8010573f:	8b 15 bc fc 14 80    	mov    0x8014fcbc,%edx
+80105745:	83 c0 01             	add    $0x1,%eax
+80105748:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+8010574b:	8d 0c 4a             	lea    (%edx,%ecx,2),%ecx
+    } else if(logfull()){
+8010574e:	83 f9 3c             	cmp    $0x3c,%ecx
+80105751:	7f c9                	jg     8010571c <begin_op+0x1c>
+    } else if(log.syncwait && log.lh.n > 0){
+80105753:	8b 0d a8 fc 14 80    	mov    0x8014fca8,%ecx
+80105759:	85 c9                	test   %ecx,%ecx
+8010575b:	75 bb                	jne    80105718 <begin_op+0x18>
+      release(&log.lock);
+8010575d:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80105760:	a3 9c fc 14 80       	mov    %eax,0x8014fc9c
+      release(&log.lock);
+80105765:	68 60 fc 14 80       	push   $0x8014fc60
+8010576a:	e8 a1 23 00 00       	call   80107b10 <release>
+}
+8010576f:	83 c4 10             	add    $0x10,%esp
+80105772:	c9                   	leave
+80105773:	c3                   	ret
+80105774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010577b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010577f:	90                   	nop
+
+80105780 <end_op>:
+{
+80105780:	55                   	push   %ebp
+80105781:	89 e5                	mov    %esp,%ebp
+80105783:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80105786:	68 60 fc 14 80       	push   $0x8014fc60
+8010578b:	e8 e0 23 00 00       	call   80107b70 <acquire>
+  log.outstanding -= 1;
+80105790:	a1 9c fc 14 80       	mov    0x8014fc9c,%eax
+  if(log.closing)
+80105795:	8b 15 a0 fc 14 80    	mov    0x8014fca0,%edx
+8010579b:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+8010579e:	83 e8 01             	sub    $0x1,%eax
+801057a1:	a3 9c fc 14 80       	mov    %eax,0x8014fc9c
+  if(log.closing)
+801057a6:	85 d2                	test   %edx,%edx
+801057a8:	75 49                	jne    801057f3 <end_op+0x73>
+  if(log.outstanding == 0 && log.lh.n > 0 && (logfull() || log.syncwait))
+801057aa:	85 c0                	test   %eax,%eax
+801057ac:	75 27                	jne    801057d5 <end_op+0x55>
+801057ae:	a1 bc fc 14 80       	mov    0x8014fcbc,%eax
+801057b3:	85 c0                	test   %eax,%eax
+801057b5:	7e 1e                	jle    801057d5 <end_op+0x55>
+801057b7:	83 f8 32             	cmp    $0x32,%eax
+801057ba:	7f 09                	jg     801057c5 <end_op+0x45>
+801057bc:	a1 a8 fc 14 80       	mov    0x8014fca8,%eax
+801057c1:	85 c0                	test   %eax,%eax
+801057c3:	74 10                	je     801057d5 <end_op+0x55>
+    wakeup(&log.flusher);
+801057c5:	83 ec 0c             	sub    $0xc,%esp
+801057c8:	68 b4 fc 14 80       	push   $0x8014fcb4
+801057cd:	e8 be 1a 00 00       	call   80107290 <wakeup>
+801057d2:	83 c4 10             	add    $0x10,%esp
+  wakeup(&log);
+801057d5:	83 ec 0c             	sub    $0xc,%esp
+801057d8:	68 60 fc 14 80       	push   $0x8014fc60
+801057dd:	e8 ae 1a 00 00       	call   80107290 <wakeup>
+  release(&log.lock);
+801057e2:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+801057e9:	e8 22 23 00 00       	call   80107b10 <release>
+}
+801057ee:	83 c4 10             	add    $0x10,%esp
+801057f1:	c9                   	leave
+801057f2:	c3                   	ret
+    panic("log.closing");
+801057f3:	83 ec 0c             	sub    $0xc,%esp
+801057f6:	68 c5 b2 10 80       	push   $0x8010b2c5
+801057fb:	e8 30 af ff ff       	call   80100730 <panic>
+
+80105800 <logtick>:
+  if(log.lh.n > 0 && log.outstanding == 0 && !log.committing &&
+80105800:	a1 bc fc 14 80       	mov    0x8014fcbc,%eax
+80105805:	85 c0                	test   %eax,%eax
+80105807:	7e 1d                	jle    80105826 <logtick+0x26>
+80105809:	a1 9c fc 14 80       	mov    0x8014fc9c,%eax
+8010580e:	0b 05 a4 fc 14 80    	or     0x8014fca4,%eax
+80105814:	75 10                	jne    80105826 <logtick+0x26>
+     ticks - log.since >= LOGFLUSHTICKS)
+80105816:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+8010581b:	2b 05 b0 fc 14 80    	sub    0x8014fcb0,%eax
+  if(log.lh.n > 0 && log.outstanding == 0 && !log.committing &&
+80105821:	83 f8 09             	cmp    $0x9,%eax
+80105824:	77 0a                	ja     80105830 <logtick+0x30>
+80105826:	c3                   	ret
+80105827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010582e:	66 90                	xchg   %ax,%ax
+{
+80105830:	55                   	push   %ebp
+80105831:	89 e5                	mov    %esp,%ebp
+80105833:	83 ec 14             	sub    $0x14,%esp
+    wakeup(&log.flusher);
+80105836:	68 b4 fc 14 80       	push   $0x8014fcb4
+8010583b:	e8 50 1a 00 00       	call   80107290 <wakeup>
+80105840:	83 c4 10             	add    $0x10,%esp
+}
+80105843:	c9                   	leave
+80105844:	c3                   	ret
+80105845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010584c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105850 <sync>:
+{
+80105850:	55                   	push   %ebp
+80105851:	89 e5                	mov    %esp,%ebp
+80105853:	56                   	push   %esi
+80105854:	53                   	push   %ebx
+  acquire(&log.lock);
+80105855:	83 ec 0c             	sub    $0xc,%esp
+80105858:	68 60 fc 14 80       	push   $0x8014fc60
+8010585d:	e8 0e 23 00 00       	call   80107b70 <acquire>
+  blocksz = log.lh.n;
+80105862:	8b 35 bc fc 14 80    	mov    0x8014fcbc,%esi
+  if(blocksz == 0 && !log.committing){
+80105868:	83 c4 10             	add    $0x10,%esp
+8010586b:	85 f6                	test   %esi,%esi
+8010586d:	75 21                	jne    80105890 <sync+0x40>
+8010586f:	8b 15 a4 fc 14 80    	mov    0x8014fca4,%edx
+80105875:	85 d2                	test   %edx,%edx
+80105877:	0f 84 98 00 00 00    	je     80105915 <sync+0xc5>
+  target = log.ncommit + (log.committing ? 1 : 0) + (blocksz > 0 ? 1 : 0);
+8010587d:	a1 ac fc 14 80       	mov    0x8014fcac,%eax
+80105882:	8d 58 01             	lea    0x1(%eax),%ebx
+80105885:	eb 24                	jmp    801058ab <sync+0x5b>
+80105887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010588e:	66 90                	xchg   %ax,%ax
+80105890:	a1 a4 fc 14 80       	mov    0x8014fca4,%eax
+80105895:	31 db                	xor    %ebx,%ebx
+80105897:	85 c0                	test   %eax,%eax
+80105899:	0f 95 c3             	setne  %bl
+8010589c:	31 c0                	xor    %eax,%eax
+8010589e:	85 f6                	test   %esi,%esi
+801058a0:	0f 9f c0             	setg   %al
+801058a3:	01 c3                	add    %eax,%ebx
+801058a5:	03 1d ac fc 14 80    	add    0x8014fcac,%ebx
+  wakeup(&log.flusher);
+801058ab:	83 ec 0c             	sub    $0xc,%esp
+  log.syncwait++;
+801058ae:	83 05 a8 fc 14 80 01 	addl   $0x1,0x8014fca8
+  wakeup(&log.flusher);
+801058b5:	68 b4 fc 14 80       	push   $0x8014fcb4
+801058ba:	e8 d1 19 00 00       	call   80107290 <wakeup>
+801058bf:	eb 19                	jmp    801058da <sync+0x8a>
+801058c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(&log.ncommit, &log.lock);
+801058c8:	83 ec 08             	sub    $0x8,%esp
+801058cb:	68 60 fc 14 80       	push   $0x8014fc60
+801058d0:	68 ac fc 14 80       	push   $0x8014fcac
+801058d5:	e8 a6 18 00 00       	call   80107180 <sleep>
+  while((int)(target - log.ncommit) > 0)
+801058da:	89 d8                	mov    %ebx,%eax
+801058dc:	2b 05 ac fc 14 80    	sub    0x8014fcac,%eax
+801058e2:	83 c4 10             	add    $0x10,%esp
+801058e5:	85 c0                	test   %eax,%eax
+801058e7:	7f df                	jg     801058c8 <sync+0x78>
+  wakeup(&log);
+801058e9:	83 ec 0c             	sub    $0xc,%esp
+  log.syncwait--;
+801058ec:	83 2d a8 fc 14 80 01 	subl   $0x1,0x8014fca8
+  wakeup(&log);
+801058f3:	68 60 fc 14 80       	push   $0x8014fc60
+801058f8:	e8 93 19 00 00       	call   80107290 <wakeup>
+  release(&log.lock);
+801058fd:	c7 04 24 60 fc 14 80 	movl   $0x8014fc60,(%esp)
+80105904:	e8 07 22 00 00       	call   80107b10 <release>
+  return blocksz;
+80105909:	83 c4 10             	add    $0x10,%esp
+}
+8010590c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010590f:	89 f0                	mov    %esi,%eax
+80105911:	5b                   	pop    %ebx
+80105912:	5e                   	pop    %esi
+80105913:	5d                   	pop    %ebp
+80105914:	c3                   	ret
+    release(&log.lock);
+80105915:	83 ec 0c             	sub    $0xc,%esp
+    return -1;
+80105918:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    release(&log.lock);
+8010591d:	68 60 fc 14 80       	push   $0x8014fc60
+80105922:	e8 e9 21 00 00       	call   80107b10 <release>
+    return -1;
+80105927:	83 c4 10             	add    $0x10,%esp
+8010592a:	eb e0                	jmp    8010590c <sync+0xbc>
+8010592c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105930 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80105930:	55                   	push   %ebp
+80105931:	89 e5                	mov    %esp,%ebp
+80105933:	53                   	push   %ebx
+80105934:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80105937:	8b 15 bc fc 14 80    	mov    0x8014fcbc,%edx
+{
+8010593d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80105940:	83 fa 3b             	cmp    $0x3b,%edx
+80105943:	0f 8f 9f 00 00 00    	jg     801059e8 <log_write+0xb8>
+80105949:	a1 98 fc 14 80       	mov    0x8014fc98,%eax
+8010594e:	83 e8 01             	sub    $0x1,%eax
+80105951:	39 c2                	cmp    %eax,%edx
+80105953:	0f 8d 8f 00 00 00    	jge    801059e8 <log_write+0xb8>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80105959:	a1 9c fc 14 80       	mov    0x8014fc9c,%eax
+8010595e:	85 c0                	test   %eax,%eax
+80105960:	0f 8e 8f 00 00 00    	jle    801059f5 <log_write+0xc5>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80105966:	83 ec 0c             	sub    $0xc,%esp
+80105969:	68 60 fc 14 80       	push   $0x8014fc60
+8010596e:	e8 fd 21 00 00       	call   80107b70 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80105973:	8b 15 bc fc 14 80    	mov    0x8014fcbc,%edx
+80105979:	83 c4 10             	add    $0x10,%esp
+8010597c:	85 d2                	test   %edx,%edx
+8010597e:	7e 52                	jle    801059d2 <log_write+0xa2>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80105980:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+80105983:	31 c0                	xor    %eax,%eax
+80105985:	eb 10                	jmp    80105997 <log_write+0x67>
+80105987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010598e:	66 90                	xchg   %ax,%ax
+80105990:	83 c0 01             	add    $0x1,%eax
+80105993:	39 c2                	cmp    %eax,%edx
+80105995:	74 29                	je     801059c0 <log_write+0x90>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80105997:	39 0c 85 c0 fc 14 80 	cmp    %ecx,-0x7feb0340(,%eax,4)
+8010599e:	75 f0                	jne    80105990 <log_write+0x60>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+801059a0:	89 0c 85 c0 fc 14 80 	mov    %ecx,-0x7feb0340(,%eax,4)
+  if (log.lh.n == 0)
+    log.since = ticks;
+  if (i == log.lh.n)
+801059a7:	39 c2                	cmp    %eax,%edx
+801059a9:	74 1c                	je     801059c7 <log_write+0x97>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+801059ab:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+801059ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+801059b1:	c7 45 08 60 fc 14 80 	movl   $0x8014fc60,0x8(%ebp)
+}
+801059b8:	c9                   	leave
+  release(&log.lock);
+801059b9:	e9 52 21 00 00       	jmp    80107b10 <release>
+801059be:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+801059c0:	89 0c 95 c0 fc 14 80 	mov    %ecx,-0x7feb0340(,%edx,4)
+    log.lh.n++;
+801059c7:	83 c2 01             	add    $0x1,%edx
+801059ca:	89 15 bc fc 14 80    	mov    %edx,0x8014fcbc
+801059d0:	eb d9                	jmp    801059ab <log_write+0x7b>
+  log.lh.block[i] = b->blockno;
+801059d2:	8b 43 08             	mov    0x8(%ebx),%eax
+801059d5:	a3 c0 fc 14 80       	mov    %eax,0x8014fcc0
+  if (log.lh.n == 0)
+801059da:	75 cf                	jne    801059ab <log_write+0x7b>
+    log.since = ticks;
+801059dc:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+801059e1:	a3 b0 fc 14 80       	mov    %eax,0x8014fcb0
+  if (i == log.lh.n)
+801059e6:	eb df                	jmp    801059c7 <log_write+0x97>
+    panic("too big a transaction");
+801059e8:	83 ec 0c             	sub    $0xc,%esp
+801059eb:	68 d1 b2 10 80       	push   $0x8010b2d1
+801059f0:	e8 3b ad ff ff       	call   80100730 <panic>
+    panic("log_write outside of trans");
+801059f5:	83 ec 0c             	sub    $0xc,%esp
+801059f8:	68 e7 b2 10 80       	push   $0x8010b2e7
+801059fd:	e8 2e ad ff ff       	call   80100730 <panic>
+80105a02:	66 90                	xchg   %ax,%ax
+80105a04:	66 90                	xchg   %ax,%ax
+80105a06:	66 90                	xchg   %ax,%ax
+80105a08:	66 90                	xchg   %ax,%ax
+80105a0a:	66 90                	xchg   %ax,%ax
+80105a0c:	66 90                	xchg   %ax,%ax
+80105a0e:	66 90                	xchg   %ax,%ax
+
+80105a10 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+80105a10:	55                   	push   %ebp
+80105a11:	89 e5                	mov    %esp,%ebp
+80105a13:	53                   	push   %ebx
+80105a14:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80105a17:	e8 e4 0e 00 00       	call   80106900 <cpuid>
+80105a1c:	89 c3                	mov    %eax,%ebx
+80105a1e:	e8 dd 0e 00 00       	call   80106900 <cpuid>
+80105a23:	83 ec 04             	sub    $0x4,%esp
+80105a26:	53                   	push   %ebx
+80105a27:	50                   	push   %eax
+80105a28:	68 02 b3 10 80       	push   $0x8010b302
+80105a2d:	e8 2e b0 ff ff       	call   80100a60 <cprintf>
+  idtinit();       // load idt register
+80105a32:	e8 d9 36 00 00       	call   80109110 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80105a37:	e8 64 0e 00 00       	call   801068a0 <mycpu>
+80105a3c:	89 c2                	mov    %eax,%edx
+  asm volatile("lock; xchgl %0, %1" :
+80105a3e:	b8 01 00 00 00       	mov    $0x1,%eax
+80105a43:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80105a4a:	e8 01 13 00 00       	call   80106d50 <scheduler>
+80105a4f:	90                   	nop
+
+80105a50 <mpenter>:
+{
+80105a50:	55                   	push   %ebp
+80105a51:	89 e5                	mov    %esp,%ebp
+80105a53:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80105a56:	e8 35 48 00 00       	call   8010a290 <switchkvm>
+  seginit();
+80105a5b:	e8 a0 47 00 00       	call   8010a200 <seginit>
+  lapicinit();
+80105a60:	e8 2b f4 ff ff       	call   80104e90 <lapicinit>
+  mpmain();
+80105a65:	e8 a6 ff ff ff       	call   80105a10 <mpmain>
+80105a6a:	66 90                	xchg   %ax,%ax
+80105a6c:	66 90                	xchg   %ax,%ax
+80105a6e:	66 90                	xchg   %ax,%ax
+
+80105a70 <main>:
+{
+80105a70:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80105a74:	83 e4 f0             	and    $0xfffffff0,%esp
+80105a77:	ff 71 fc             	push   -0x4(%ecx)
+80105a7a:	55                   	push   %ebp
+80105a7b:	89 e5                	mov    %esp,%ebp
+80105a7d:	53                   	push   %ebx
+80105a7e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80105a7f:	83 ec 08             	sub    $0x8,%esp
+80105a82:	68 00 00 40 80       	push   $0x80400000
+80105a87:	68 10 9d 15 80       	push   $0x80159d10
+80105a8c:	e8 7f ef ff ff       	call   80104a10 <kinit1>
+  kvmalloc();      // kernel page table
+80105a91:	e8 ba 4c 00 00       	call   8010a750 <kvmalloc>
+  mpinit();        // detect other processors
+80105a96:	e8 95 01 00 00       	call   80105c30 <mpinit>
+  lapicinit();     // interrupt controller
+80105a9b:	e8 f0 f3 ff ff       	call   80104e90 <lapicinit>
+  seginit();       // segment descriptors
+80105aa0:	e8 5b 47 00 00       	call   8010a200 <seginit>
+  picinit();       // disable pic
+80105aa5:	e8 96 03 00 00       	call   80105e40 <picinit>
+  ioapicinit();    // another interrupt controller
+80105aaa:	e8 21 ec ff ff       	call   801046d0 <ioapicinit>
+  consoleinit();   // console hardware
+80105aaf:	e8 8c b3 ff ff       	call   80100e40 <consoleinit>
+  uartinit();      // serial port
+80105ab4:	e8 b7 39 00 00       	call   80109470 <uartinit>
+  pinit();         // process table
+80105ab9:	e8 b2 0d 00 00       	call   80106870 <pinit>
+  tvinit();        // trap vectors
+80105abe:	e8 cd 35 00 00       	call   80109090 <tvinit>
+  binit();         // buffer cache
+80105ac3:	e8 c8 a8 ff ff       	call   80100390 <binit>
+  fileinit();      // file table
+80105ac8:	e8 43 b7 ff ff       	call   80101210 <fileinit>
+  pipeinit();      // pipe cache
+80105acd:	e8 ae 03 00 00       	call   80105e80 <pipeinit>
+  icacheinit();    // inode cache
+80105ad2:	e8 99 ca ff ff       	call   80102570 <icacheinit>
+  ideinit();       // disk 
+80105ad7:	e8 d4 e8 ff ff       	call   801043b0 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80105adc:	83 c4 0c             	add    $0xc,%esp
+80105adf:	68 8a 00 00 00       	push   $0x8a
+80105ae4:	68 8c e4 10 80       	push   $0x8010e48c
+80105ae9:	68 00 70 00 80       	push   $0x80007000
+80105aee:	e8 ed 21 00 00       	call   80107ce0 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80105af3:	83 c4 10             	add    $0x10,%esp
+80105af6:	69 05 c4 78 15 80 b0 	imul   $0xb0,0x801578c4,%eax
+80105afd:	00 00 00 
+80105b00:	05 e0 78 15 80       	add    $0x801578e0,%eax
+80105b05:	3d e0 78 15 80       	cmp    $0x801578e0,%eax
+80105b0a:	76 7c                	jbe    80105b88 <main+0x118>
+80105b0c:	bb e0 78 15 80       	mov    $0x801578e0,%ebx
+80105b11:	eb 1e                	jmp    80105b31 <main+0xc1>
+80105b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105b17:	90                   	nop
+80105b18:	69 05 c4 78 15 80 b0 	imul   $0xb0,0x801578c4,%eax
+80105b1f:	00 00 00 
+80105b22:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+80105b28:	05 e0 78 15 80       	add    $0x801578e0,%eax
+80105b2d:	39 c3                	cmp    %eax,%ebx
+80105b2f:	73 57                	jae    80105b88 <main+0x118>
+    if(c == mycpu())  // We've started already.
+80105b31:	e8 6a 0d 00 00       	call   801068a0 <mycpu>
+80105b36:	39 c3                	cmp    %eax,%ebx
+80105b38:	74 de                	je     80105b18 <main+0xa8>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80105b3a:	e8 81 ef ff ff       	call   80104ac0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80105b3f:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+80105b42:	c7 05 f8 6f 00 80 50 	movl   $0x80105a50,0x80006ff8
+80105b49:	5a 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80105b4c:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+80105b53:	d0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80105b56:	05 00 10 00 00       	add    $0x1000,%eax
+80105b5b:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80105b60:	0f b6 03             	movzbl (%ebx),%eax
+80105b63:	68 00 70 00 00       	push   $0x7000
+80105b68:	50                   	push   %eax
+80105b69:	e8 72 f4 ff ff       	call   80104fe0 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80105b6e:	83 c4 10             	add    $0x10,%esp
+80105b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b78:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80105b7e:	85 c0                	test   %eax,%eax
+80105b80:	74 f6                	je     80105b78 <main+0x108>
+80105b82:	eb 94                	jmp    80105b18 <main+0xa8>
+80105b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80105b88:	83 ec 08             	sub    $0x8,%esp
+80105b8b:	68 00 00 00 8e       	push   $0x8e000000
+80105b90:	68 00 00 40 80       	push   $0x80400000
+80105b95:	e8 06 ee ff ff       	call   801049a0 <kinit2>
+  userinit();      // first user process
+80105b9a:	e8 d1 0e 00 00       	call   80106a70 <userinit>
+  mpmain();        // finish this processor's setup
+80105b9f:	e8 6c fe ff ff       	call   80105a10 <mpmain>
+80105ba4:	66 90                	xchg   %ax,%ax
+80105ba6:	66 90                	xchg   %ax,%ax
+80105ba8:	66 90                	xchg   %ax,%ax
+80105baa:	66 90                	xchg   %ax,%ax
+80105bac:	66 90                	xchg   %ax,%ax
+80105bae:	66 90                	xchg   %ax,%ax
+
+80105bb0 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80105bb0:	55                   	push   %ebp
+80105bb1:	89 e5                	mov    %esp,%ebp
+80105bb3:	57                   	push   %edi
+80105bb4:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80105bb5:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80105bbb:	53                   	push   %ebx
+  e = addr+len;
+80105bbc:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80105bbf:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80105bc2:	39 de                	cmp    %ebx,%esi
+80105bc4:	72 10                	jb     80105bd6 <mpsearch1+0x26>
+80105bc6:	eb 50                	jmp    80105c18 <mpsearch1+0x68>
+80105bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105bcf:	90                   	nop
+80105bd0:	89 fe                	mov    %edi,%esi
+80105bd2:	39 df                	cmp    %ebx,%edi
+80105bd4:	73 42                	jae    80105c18 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105bd6:	83 ec 04             	sub    $0x4,%esp
+80105bd9:	8d 7e 10             	lea    0x10(%esi),%edi
+80105bdc:	6a 04                	push   $0x4
+80105bde:	68 16 b3 10 80       	push   $0x8010b316
+80105be3:	56                   	push   %esi
+80105be4:	e8 a7 20 00 00       	call   80107c90 <memcmp>
+80105be9:	83 c4 10             	add    $0x10,%esp
+80105bec:	85 c0                	test   %eax,%eax
+80105bee:	75 e0                	jne    80105bd0 <mpsearch1+0x20>
+80105bf0:	89 f2                	mov    %esi,%edx
+80105bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80105bf8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80105bfb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80105bfe:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80105c00:	39 fa                	cmp    %edi,%edx
+80105c02:	75 f4                	jne    80105bf8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105c04:	84 c0                	test   %al,%al
+80105c06:	75 c8                	jne    80105bd0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80105c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c0b:	89 f0                	mov    %esi,%eax
+80105c0d:	5b                   	pop    %ebx
+80105c0e:	5e                   	pop    %esi
+80105c0f:	5f                   	pop    %edi
+80105c10:	5d                   	pop    %ebp
+80105c11:	c3                   	ret
+80105c12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80105c1b:	31 f6                	xor    %esi,%esi
+}
+80105c1d:	5b                   	pop    %ebx
+80105c1e:	89 f0                	mov    %esi,%eax
+80105c20:	5e                   	pop    %esi
+80105c21:	5f                   	pop    %edi
+80105c22:	5d                   	pop    %ebp
+80105c23:	c3                   	ret
+80105c24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105c2f:	90                   	nop
+
+80105c30 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80105c30:	55                   	push   %ebp
+80105c31:	89 e5                	mov    %esp,%ebp
+80105c33:	57                   	push   %edi
+80105c34:	56                   	push   %esi
+80105c35:	53                   	push   %ebx
+80105c36:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80105c39:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80105c40:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80105c47:	c1 e0 08             	shl    $0x8,%eax
+80105c4a:	09 d0                	or     %edx,%eax
+80105c4c:	c1 e0 04             	shl    $0x4,%eax
+80105c4f:	75 1b                	jne    80105c6c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80105c51:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80105c58:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80105c5f:	c1 e0 08             	shl    $0x8,%eax
+80105c62:	09 d0                	or     %edx,%eax
+80105c64:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80105c67:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+80105c6c:	ba 00 04 00 00       	mov    $0x400,%edx
+80105c71:	e8 3a ff ff ff       	call   80105bb0 <mpsearch1>
+80105c76:	89 c3                	mov    %eax,%ebx
+80105c78:	85 c0                	test   %eax,%eax
+80105c7a:	0f 84 50 01 00 00    	je     80105dd0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80105c80:	8b 73 04             	mov    0x4(%ebx),%esi
+80105c83:	85 f6                	test   %esi,%esi
+80105c85:	0f 84 35 01 00 00    	je     80105dc0 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+80105c8b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+80105c8e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80105c94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80105c97:	6a 04                	push   $0x4
+80105c99:	68 1b b3 10 80       	push   $0x8010b31b
+80105c9e:	50                   	push   %eax
+80105c9f:	e8 ec 1f 00 00       	call   80107c90 <memcmp>
+80105ca4:	83 c4 10             	add    $0x10,%esp
+80105ca7:	85 c0                	test   %eax,%eax
+80105ca9:	0f 85 11 01 00 00    	jne    80105dc0 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+80105caf:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80105cb6:	3c 01                	cmp    $0x1,%al
+80105cb8:	74 08                	je     80105cc2 <mpinit+0x92>
+80105cba:	3c 04                	cmp    $0x4,%al
+80105cbc:	0f 85 fe 00 00 00    	jne    80105dc0 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80105cc2:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80105cc9:	66 85 d2             	test   %dx,%dx
+80105ccc:	74 22                	je     80105cf0 <mpinit+0xc0>
+80105cce:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+80105cd1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+80105cd3:	31 d2                	xor    %edx,%edx
+80105cd5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80105cd8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+80105cdf:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+80105ce2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80105ce4:	39 c7                	cmp    %eax,%edi
+80105ce6:	75 f0                	jne    80105cd8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+80105ce8:	84 d2                	test   %dl,%dl
+80105cea:	0f 85 d0 00 00 00    	jne    80105dc0 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80105cf0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105cf6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80105cf9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+80105cfc:	a3 44 fc 14 80       	mov    %eax,0x8014fc44
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105d01:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80105d08:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+80105d0e:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105d13:	01 d7                	add    %edx,%edi
+80105d15:	89 fa                	mov    %edi,%edx
+80105d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d1e:	66 90                	xchg   %ax,%ax
+80105d20:	39 d0                	cmp    %edx,%eax
+80105d22:	73 15                	jae    80105d39 <mpinit+0x109>
+    switch(*p){
+80105d24:	0f b6 08             	movzbl (%eax),%ecx
+80105d27:	80 f9 02             	cmp    $0x2,%cl
+80105d2a:	74 54                	je     80105d80 <mpinit+0x150>
+80105d2c:	77 42                	ja     80105d70 <mpinit+0x140>
+80105d2e:	84 c9                	test   %cl,%cl
+80105d30:	74 5e                	je     80105d90 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80105d32:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105d35:	39 d0                	cmp    %edx,%eax
+80105d37:	72 eb                	jb     80105d24 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80105d39:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80105d3c:	85 f6                	test   %esi,%esi
+80105d3e:	0f 84 e1 00 00 00    	je     80105e25 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80105d44:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80105d48:	74 15                	je     80105d5f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105d4a:	b8 70 00 00 00       	mov    $0x70,%eax
+80105d4f:	ba 22 00 00 00       	mov    $0x22,%edx
+80105d54:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105d55:	ba 23 00 00 00       	mov    $0x23,%edx
+80105d5a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80105d5b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105d5e:	ee                   	out    %al,(%dx)
+  }
+}
+80105d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105d62:	5b                   	pop    %ebx
+80105d63:	5e                   	pop    %esi
+80105d64:	5f                   	pop    %edi
+80105d65:	5d                   	pop    %ebp
+80105d66:	c3                   	ret
+80105d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d6e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80105d70:	83 e9 03             	sub    $0x3,%ecx
+80105d73:	80 f9 01             	cmp    $0x1,%cl
+80105d76:	76 ba                	jbe    80105d32 <mpinit+0x102>
+80105d78:	31 f6                	xor    %esi,%esi
+80105d7a:	eb a4                	jmp    80105d20 <mpinit+0xf0>
+80105d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80105d80:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80105d84:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80105d87:	88 0d c0 78 15 80    	mov    %cl,0x801578c0
+      continue;
+80105d8d:	eb 91                	jmp    80105d20 <mpinit+0xf0>
+80105d8f:	90                   	nop
+      if(ncpu < NCPU) {
+80105d90:	8b 0d c4 78 15 80    	mov    0x801578c4,%ecx
+80105d96:	83 f9 07             	cmp    $0x7,%ecx
+80105d99:	7f 19                	jg     80105db4 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80105d9b:	69 f9 b0 00 00 00    	imul   $0xb0,%ecx,%edi
+80105da1:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80105da5:	83 c1 01             	add    $0x1,%ecx
+80105da8:	89 0d c4 78 15 80    	mov    %ecx,0x801578c4
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80105dae:	88 9f e0 78 15 80    	mov    %bl,-0x7fea8720(%edi)
+      p += sizeof(struct mpproc);
+80105db4:	83 c0 14             	add    $0x14,%eax
+      continue;
+80105db7:	e9 64 ff ff ff       	jmp    80105d20 <mpinit+0xf0>
+80105dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80105dc0:	83 ec 0c             	sub    $0xc,%esp
+80105dc3:	68 20 b3 10 80       	push   $0x8010b320
+80105dc8:	e8 63 a9 ff ff       	call   80100730 <panic>
+80105dcd:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80105dd0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+80105dd5:	eb 13                	jmp    80105dea <mpinit+0x1ba>
+80105dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dde:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+80105de0:	89 f3                	mov    %esi,%ebx
+80105de2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80105de8:	74 d6                	je     80105dc0 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105dea:	83 ec 04             	sub    $0x4,%esp
+80105ded:	8d 73 10             	lea    0x10(%ebx),%esi
+80105df0:	6a 04                	push   $0x4
+80105df2:	68 16 b3 10 80       	push   $0x8010b316
+80105df7:	53                   	push   %ebx
+80105df8:	e8 93 1e 00 00       	call   80107c90 <memcmp>
+80105dfd:	83 c4 10             	add    $0x10,%esp
+80105e00:	85 c0                	test   %eax,%eax
+80105e02:	75 dc                	jne    80105de0 <mpinit+0x1b0>
+80105e04:	89 da                	mov    %ebx,%edx
+80105e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e0d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80105e10:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80105e13:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80105e16:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80105e18:	39 f2                	cmp    %esi,%edx
+80105e1a:	75 f4                	jne    80105e10 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105e1c:	84 c0                	test   %al,%al
+80105e1e:	75 c0                	jne    80105de0 <mpinit+0x1b0>
+80105e20:	e9 5b fe ff ff       	jmp    80105c80 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80105e25:	83 ec 0c             	sub    $0xc,%esp
+80105e28:	68 38 b3 10 80       	push   $0x8010b338
+80105e2d:	e8 fe a8 ff ff       	call   80100730 <panic>
+80105e32:	66 90                	xchg   %ax,%ax
+80105e34:	66 90                	xchg   %ax,%ax
+80105e36:	66 90                	xchg   %ax,%ax
+80105e38:	66 90                	xchg   %ax,%ax
+80105e3a:	66 90                	xchg   %ax,%ax
+80105e3c:	66 90                	xchg   %ax,%ax
+80105e3e:	66 90                	xchg   %ax,%ax
+
+80105e40 <picinit>:
+80105e40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105e45:	ba 21 00 00 00       	mov    $0x21,%edx
+80105e4a:	ee                   	out    %al,(%dx)
+80105e4b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80105e50:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80105e51:	c3                   	ret
+80105e52:	66 90                	xchg   %ax,%ax
+80105e54:	66 90                	xchg   %ax,%ax
+80105e56:	66 90                	xchg   %ax,%ax
+80105e58:	66 90                	xchg   %ax,%ax
+80105e5a:	66 90                	xchg   %ax,%ax
+80105e5c:	66 90                	xchg   %ax,%ax
+80105e5e:	66 90                	xchg   %ax,%ax
+
+80105e60 <pipector>:
+
+static struct slabcache pipecache;
+
+static void
+pipector(void *v)
+{
+80105e60:	55                   	push   %ebp
+80105e61:	89 e5                	mov    %esp,%ebp
+80105e63:	83 ec 10             	sub    $0x10,%esp
+  initlock(&((struct pipe*)v)->lock, "pipe");
+80105e66:	68 57 b3 10 80       	push   $0x8010b357
+80105e6b:	ff 75 08             	push   0x8(%ebp)
+80105e6e:	e8 1d 1b 00 00       	call   80107990 <initlock>
+}
+80105e73:	83 c4 10             	add    $0x10,%esp
+80105e76:	c9                   	leave
+80105e77:	c3                   	ret
+80105e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e7f:	90                   	nop
+
+80105e80 <pipeinit>:
+
+void
+pipeinit(void)
+{
+80105e80:	55                   	push   %ebp
+80105e81:	89 e5                	mov    %esp,%ebp
+80105e83:	83 ec 08             	sub    $0x8,%esp
+  slabinit(&pipecache, "pipe", sizeof(struct pipe), pipector);
+80105e86:	68 60 5e 10 80       	push   $0x80105e60
+80105e8b:	68 88 02 00 00       	push   $0x288
+80105e90:	68 57 b3 10 80       	push   $0x8010b357
+80105e95:	68 60 7e 15 80       	push   $0x80157e60
+80105e9a:	e8 f1 15 00 00       	call   80107490 <slabinit>
+}
+80105e9f:	83 c4 10             	add    $0x10,%esp
+80105ea2:	c9                   	leave
+80105ea3:	c3                   	ret
+80105ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105eaf:	90                   	nop
+
+80105eb0 <pipealloc>:
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80105eb0:	55                   	push   %ebp
+80105eb1:	89 e5                	mov    %esp,%ebp
+80105eb3:	56                   	push   %esi
+80105eb4:	53                   	push   %ebx
+80105eb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105eb8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+80105ebb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80105ec1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80105ec7:	e8 74 b3 ff ff       	call   80101240 <filealloc>
+80105ecc:	89 03                	mov    %eax,(%ebx)
+80105ece:	85 c0                	test   %eax,%eax
+80105ed0:	0f 84 a6 00 00 00    	je     80105f7c <pipealloc+0xcc>
+80105ed6:	e8 65 b3 ff ff       	call   80101240 <filealloc>
+80105edb:	89 06                	mov    %eax,(%esi)
+80105edd:	85 c0                	test   %eax,%eax
+80105edf:	0f 84 85 00 00 00    	je     80105f6a <pipealloc+0xba>
+    goto bad;
+  if((p = slaballoc(&pipecache)) == 0)
+80105ee5:	83 ec 0c             	sub    $0xc,%esp
+80105ee8:	68 60 7e 15 80       	push   $0x80157e60
+80105eed:	e8 0e 16 00 00       	call   80107500 <slaballoc>
+80105ef2:	83 c4 10             	add    $0x10,%esp
+80105ef5:	85 c0                	test   %eax,%eax
+80105ef7:	0f 84 98 00 00 00    	je     80105f95 <pipealloc+0xe5>
+    goto bad;
+  p->readopen = 1;
+80105efd:	c7 80 80 02 00 00 01 	movl   $0x1,0x280(%eax)
+80105f04:	00 00 00 
+  p->writeopen = 1;
+80105f07:	c7 80 84 02 00 00 01 	movl   $0x1,0x284(%eax)
+80105f0e:	00 00 00 
+  p->cap = PIPESIZE;
+80105f11:	c7 80 74 02 00 00 00 	movl   $0x200,0x274(%eax)
+80105f18:	02 00 00 
+  p->nwrite = 0;
+80105f1b:	c7 80 7c 02 00 00 00 	movl   $0x0,0x27c(%eax)
+80105f22:	00 00 00 
+  p->nread = 0;
+80105f25:	c7 80 78 02 00 00 00 	movl   $0x0,0x278(%eax)
+80105f2c:	00 00 00 
+  (*f0)->type = FD_PIPE;
+80105f2f:	8b 13                	mov    (%ebx),%edx
+80105f31:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+  (*f0)->readable = 1;
+80105f37:	8b 13                	mov    (%ebx),%edx
+80105f39:	c6 42 08 01          	movb   $0x1,0x8(%edx)
+  (*f0)->writable = 0;
+80105f3d:	8b 13                	mov    (%ebx),%edx
+80105f3f:	c6 42 09 00          	movb   $0x0,0x9(%edx)
+  (*f0)->pipe = p;
+80105f43:	8b 13                	mov    (%ebx),%edx
+80105f45:	89 42 0c             	mov    %eax,0xc(%edx)
+  (*f1)->type = FD_PIPE;
+80105f48:	8b 16                	mov    (%esi),%edx
+80105f4a:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+  (*f1)->readable = 0;
+80105f50:	8b 16                	mov    (%esi),%edx
+80105f52:	c6 42 08 00          	movb   $0x0,0x8(%edx)
+  (*f1)->writable = 1;
+80105f56:	8b 16                	mov    (%esi),%edx
+80105f58:	c6 42 09 01          	movb   $0x1,0x9(%edx)
+  (*f1)->pipe = p;
+80105f5c:	8b 16                	mov    (%esi),%edx
+80105f5e:	89 42 0c             	mov    %eax,0xc(%edx)
+  return 0;
+80105f61:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+80105f63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105f66:	5b                   	pop    %ebx
+80105f67:	5e                   	pop    %esi
+80105f68:	5d                   	pop    %ebp
+80105f69:	c3                   	ret
+  if(*f0)
+80105f6a:	8b 03                	mov    (%ebx),%eax
+80105f6c:	85 c0                	test   %eax,%eax
+80105f6e:	74 1e                	je     80105f8e <pipealloc+0xde>
+    fileclose(*f0);
+80105f70:	83 ec 0c             	sub    $0xc,%esp
+80105f73:	50                   	push   %eax
+80105f74:	e8 37 b3 ff ff       	call   801012b0 <fileclose>
+80105f79:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80105f7c:	8b 06                	mov    (%esi),%eax
+80105f7e:	85 c0                	test   %eax,%eax
+80105f80:	74 0c                	je     80105f8e <pipealloc+0xde>
+    fileclose(*f1);
+80105f82:	83 ec 0c             	sub    $0xc,%esp
+80105f85:	50                   	push   %eax
+80105f86:	e8 25 b3 ff ff       	call   801012b0 <fileclose>
+80105f8b:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105f8e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105f93:	eb ce                	jmp    80105f63 <pipealloc+0xb3>
+  if(*f0)
+80105f95:	8b 03                	mov    (%ebx),%eax
+80105f97:	85 c0                	test   %eax,%eax
+80105f99:	75 d5                	jne    80105f70 <pipealloc+0xc0>
+80105f9b:	eb df                	jmp    80105f7c <pipealloc+0xcc>
+80105f9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105fa0 <pipesize>:
+// between PIPESIZE and PIPEPAGES pages, and at least a page if
+// more than PIPESIZE.  Only an empty pipe can
+// be resized.  Returns the new capacity, or -1.
+int
+pipesize(struct pipe *p, int n)
+{
+80105fa0:	55                   	push   %ebp
+80105fa1:	89 e5                	mov    %esp,%ebp
+80105fa3:	57                   	push   %edi
+80105fa4:	56                   	push   %esi
+80105fa5:	53                   	push   %ebx
+80105fa6:	83 ec 0c             	sub    $0xc,%esp
+80105fa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint cap;
+
+  if(n < 0 || n > PIPEPAGES*PGSIZE)
+80105fac:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80105fb1:	0f 87 d0 00 00 00    	ja     80106087 <pipesize+0xe7>
+    return -1;
+  cap = PIPESIZE;
+80105fb7:	bb 00 02 00 00       	mov    $0x200,%ebx
+  if(n > PIPESIZE)
+80105fbc:	3d 00 02 00 00       	cmp    $0x200,%eax
+80105fc1:	0f 8f 91 00 00 00    	jg     80106058 <pipesize+0xb8>
+    for(cap = PGSIZE; cap < n; cap *= 2)
+      ;
+  acquire(&p->lock);
+80105fc7:	83 ec 0c             	sub    $0xc,%esp
+80105fca:	ff 75 08             	push   0x8(%ebp)
+80105fcd:	e8 9e 1b 00 00       	call   80107b70 <acquire>
+  if(p->nread != p->nwrite){
+80105fd2:	8b 45 08             	mov    0x8(%ebp),%eax
+80105fd5:	83 c4 10             	add    $0x10,%esp
+80105fd8:	8b 88 7c 02 00 00    	mov    0x27c(%eax),%ecx
+80105fde:	39 88 78 02 00 00    	cmp    %ecx,0x278(%eax)
+80105fe4:	0f 85 91 00 00 00    	jne    8010607b <pipesize+0xdb>
+80105fea:	8b 45 08             	mov    0x8(%ebp),%eax
+80105fed:	8d b8 34 02 00 00    	lea    0x234(%eax),%edi
+80105ff3:	8d b0 74 02 00 00    	lea    0x274(%eax),%esi
+80105ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(p->page[i]){
+80106000:	8b 17                	mov    (%edi),%edx
+80106002:	85 d2                	test   %edx,%edx
+80106004:	74 12                	je     80106018 <pipesize+0x78>
+      kfree(p->page[i]);
+80106006:	83 ec 0c             	sub    $0xc,%esp
+80106009:	52                   	push   %edx
+8010600a:	e8 a1 e7 ff ff       	call   801047b0 <kfree>
+      p->page[i] = 0;
+8010600f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80106015:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < PIPEPAGES; i++){
+80106018:	83 c7 04             	add    $0x4,%edi
+8010601b:	39 f7                	cmp    %esi,%edi
+8010601d:	75 e1                	jne    80106000 <pipesize+0x60>
+    release(&p->lock);
+    return -1;
+  }
+  pipefree(p);
+  p->cap = cap;
+8010601f:	8b 45 08             	mov    0x8(%ebp),%eax
+  p->nread = p->nwrite = 0;
+  release(&p->lock);
+80106022:	83 ec 0c             	sub    $0xc,%esp
+  p->cap = cap;
+80106025:	89 98 74 02 00 00    	mov    %ebx,0x274(%eax)
+  p->nread = p->nwrite = 0;
+8010602b:	c7 80 7c 02 00 00 00 	movl   $0x0,0x27c(%eax)
+80106032:	00 00 00 
+80106035:	c7 80 78 02 00 00 00 	movl   $0x0,0x278(%eax)
+8010603c:	00 00 00 
+  release(&p->lock);
+8010603f:	50                   	push   %eax
+80106040:	e8 cb 1a 00 00       	call   80107b10 <release>
+  return cap;
+80106045:	89 d8                	mov    %ebx,%eax
+80106047:	83 c4 10             	add    $0x10,%esp
+}
+8010604a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010604d:	5b                   	pop    %ebx
+8010604e:	5e                   	pop    %esi
+8010604f:	5f                   	pop    %edi
+80106050:	5d                   	pop    %ebp
+80106051:	c3                   	ret
+80106052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    for(cap = PGSIZE; cap < n; cap *= 2)
+80106058:	bb 00 10 00 00       	mov    $0x1000,%ebx
+8010605d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80106062:	0f 86 5f ff ff ff    	jbe    80105fc7 <pipesize+0x27>
+80106068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010606f:	90                   	nop
+80106070:	01 db                	add    %ebx,%ebx
+80106072:	39 c3                	cmp    %eax,%ebx
+80106074:	72 fa                	jb     80106070 <pipesize+0xd0>
+80106076:	e9 4c ff ff ff       	jmp    80105fc7 <pipesize+0x27>
+    release(&p->lock);
+8010607b:	83 ec 0c             	sub    $0xc,%esp
+8010607e:	50                   	push   %eax
+8010607f:	e8 8c 1a 00 00       	call   80107b10 <release>
+    return -1;
+80106084:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106087:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010608c:	eb bc                	jmp    8010604a <pipesize+0xaa>
+8010608e:	66 90                	xchg   %ax,%ax
+
+80106090 <pipeclose>:
+  return pg + off%PGSIZE;
+}
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80106090:	55                   	push   %ebp
+80106091:	89 e5                	mov    %esp,%ebp
+80106093:	57                   	push   %edi
+80106094:	56                   	push   %esi
+80106095:	53                   	push   %ebx
+80106096:	83 ec 18             	sub    $0x18,%esp
+80106099:	8b 75 08             	mov    0x8(%ebp),%esi
+8010609c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  acquire(&p->lock);
+8010609f:	56                   	push   %esi
+801060a0:	e8 cb 1a 00 00       	call   80107b70 <acquire>
+  if(writable){
+801060a5:	83 c4 10             	add    $0x10,%esp
+801060a8:	85 db                	test   %ebx,%ebx
+801060aa:	74 44                	je     801060f0 <pipeclose+0x60>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+801060ac:	83 ec 0c             	sub    $0xc,%esp
+801060af:	8d 86 78 02 00 00    	lea    0x278(%esi),%eax
+    p->writeopen = 0;
+801060b5:	c7 86 84 02 00 00 00 	movl   $0x0,0x284(%esi)
+801060bc:	00 00 00 
+    wakeup(&p->nread);
+801060bf:	50                   	push   %eax
+801060c0:	e8 cb 11 00 00       	call   80107290 <wakeup>
+801060c5:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+801060c8:	8b 96 80 02 00 00    	mov    0x280(%esi),%edx
+801060ce:	85 d2                	test   %edx,%edx
+801060d0:	75 0a                	jne    801060dc <pipeclose+0x4c>
+801060d2:	8b 86 84 02 00 00    	mov    0x284(%esi),%eax
+801060d8:	85 c0                	test   %eax,%eax
+801060da:	74 34                	je     80106110 <pipeclose+0x80>
+    pipefree(p);
+    release(&p->lock);
+    slabfree(&pipecache, p);
+  } else
+    release(&p->lock);
+801060dc:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+801060df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801060e2:	5b                   	pop    %ebx
+801060e3:	5e                   	pop    %esi
+801060e4:	5f                   	pop    %edi
+801060e5:	5d                   	pop    %ebp
+    release(&p->lock);
+801060e6:	e9 25 1a 00 00       	jmp    80107b10 <release>
+801060eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801060ef:	90                   	nop
+    wakeup(&p->nwrite);
+801060f0:	83 ec 0c             	sub    $0xc,%esp
+801060f3:	8d 86 7c 02 00 00    	lea    0x27c(%esi),%eax
+    p->readopen = 0;
+801060f9:	c7 86 80 02 00 00 00 	movl   $0x0,0x280(%esi)
+80106100:	00 00 00 
+    wakeup(&p->nwrite);
+80106103:	50                   	push   %eax
+80106104:	e8 87 11 00 00       	call   80107290 <wakeup>
+80106109:	83 c4 10             	add    $0x10,%esp
+8010610c:	eb ba                	jmp    801060c8 <pipeclose+0x38>
+8010610e:	66 90                	xchg   %ax,%ax
+80106110:	8d 9e 34 02 00 00    	lea    0x234(%esi),%ebx
+80106116:	8d be 74 02 00 00    	lea    0x274(%esi),%edi
+8010611c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p->page[i]){
+80106120:	8b 03                	mov    (%ebx),%eax
+80106122:	85 c0                	test   %eax,%eax
+80106124:	74 12                	je     80106138 <pipeclose+0xa8>
+      kfree(p->page[i]);
+80106126:	83 ec 0c             	sub    $0xc,%esp
+80106129:	50                   	push   %eax
+8010612a:	e8 81 e6 ff ff       	call   801047b0 <kfree>
+      p->page[i] = 0;
+8010612f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80106135:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < PIPEPAGES; i++){
+80106138:	83 c3 04             	add    $0x4,%ebx
+8010613b:	39 fb                	cmp    %edi,%ebx
+8010613d:	75 e1                	jne    80106120 <pipeclose+0x90>
+    release(&p->lock);
+8010613f:	83 ec 0c             	sub    $0xc,%esp
+80106142:	56                   	push   %esi
+80106143:	e8 c8 19 00 00       	call   80107b10 <release>
+    slabfree(&pipecache, p);
+80106148:	89 75 0c             	mov    %esi,0xc(%ebp)
+8010614b:	83 c4 10             	add    $0x10,%esp
+8010614e:	c7 45 08 60 7e 15 80 	movl   $0x80157e60,0x8(%ebp)
+}
+80106155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106158:	5b                   	pop    %ebx
+80106159:	5e                   	pop    %esi
+8010615a:	5f                   	pop    %edi
+8010615b:	5d                   	pop    %ebp
+    slabfree(&pipecache, p);
+8010615c:	e9 9f 15 00 00       	jmp    80107700 <slabfree>
+80106161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010616f:	90                   	nop
+
+80106170 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80106170:	55                   	push   %ebp
+80106171:	89 e5                	mov    %esp,%ebp
+80106173:	57                   	push   %edi
+80106174:	56                   	push   %esi
+80106175:	53                   	push   %ebx
+80106176:	83 ec 28             	sub    $0x28,%esp
+80106179:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+  uint m, room, off;
+  char *buf;
+
+  acquire(&p->lock);
+8010617c:	53                   	push   %ebx
+8010617d:	e8 ee 19 00 00       	call   80107b70 <acquire>
+    while(p->nwrite == p->nread + p->cap){  //DOC: pipewrite-full
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+80106182:	8d 83 78 02 00 00    	lea    0x278(%ebx),%eax
+  for(i = 0; i < n; ){
+80106188:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+8010618f:	83 c4 10             	add    $0x10,%esp
+      wakeup(&p->nread);
+80106192:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < n; ){
+80106195:	8b 45 10             	mov    0x10(%ebp),%eax
+80106198:	85 c0                	test   %eax,%eax
+8010619a:	0f 8e 3e 01 00 00    	jle    801062de <pipewrite+0x16e>
+    while(p->nwrite == p->nread + p->cap){  //DOC: pipewrite-full
+801061a0:	8b 8b 74 02 00 00    	mov    0x274(%ebx),%ecx
+801061a6:	8b 83 78 02 00 00    	mov    0x278(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+801061ac:	8d b3 7c 02 00 00    	lea    0x27c(%ebx),%esi
+    while(p->nwrite == p->nread + p->cap){  //DOC: pipewrite-full
+801061b2:	8b bb 7c 02 00 00    	mov    0x27c(%ebx),%edi
+801061b8:	01 c8                	add    %ecx,%eax
+801061ba:	39 c7                	cmp    %eax,%edi
+801061bc:	75 74                	jne    80106232 <pipewrite+0xc2>
+801061be:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801061c1:	eb 3e                	jmp    80106201 <pipewrite+0x91>
+801061c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801061c7:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+801061c8:	e8 53 07 00 00       	call   80106920 <myproc>
+801061cd:	8b 40 28             	mov    0x28(%eax),%eax
+801061d0:	85 c0                	test   %eax,%eax
+801061d2:	75 37                	jne    8010620b <pipewrite+0x9b>
+      wakeup(&p->nread);
+801061d4:	83 ec 0c             	sub    $0xc,%esp
+801061d7:	57                   	push   %edi
+801061d8:	e8 b3 10 00 00       	call   80107290 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+801061dd:	59                   	pop    %ecx
+801061de:	58                   	pop    %eax
+801061df:	53                   	push   %ebx
+801061e0:	56                   	push   %esi
+801061e1:	e8 9a 0f 00 00       	call   80107180 <sleep>
+    while(p->nwrite == p->nread + p->cap){  //DOC: pipewrite-full
+801061e6:	8b 8b 74 02 00 00    	mov    0x274(%ebx),%ecx
+801061ec:	8b 83 78 02 00 00    	mov    0x278(%ebx),%eax
+801061f2:	83 c4 10             	add    $0x10,%esp
+801061f5:	8b 93 7c 02 00 00    	mov    0x27c(%ebx),%edx
+801061fb:	01 c8                	add    %ecx,%eax
+801061fd:	39 c2                	cmp    %eax,%edx
+801061ff:	75 2f                	jne    80106230 <pipewrite+0xc0>
+      if(p->readopen == 0 || myproc()->killed){
+80106201:	8b 83 80 02 00 00    	mov    0x280(%ebx),%eax
+80106207:	85 c0                	test   %eax,%eax
+80106209:	75 bd                	jne    801061c8 <pipewrite+0x58>
+        release(&p->lock);
+8010620b:	83 ec 0c             	sub    $0xc,%esp
+8010620e:	53                   	push   %ebx
+8010620f:	e8 fc 18 00 00       	call   80107b10 <release>
+        return -1;
+80106214:	83 c4 10             	add    $0x10,%esp
+80106217:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    i += m;
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+8010621e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106224:	5b                   	pop    %ebx
+80106225:	5e                   	pop    %esi
+80106226:	5f                   	pop    %edi
+80106227:	5d                   	pop    %ebp
+80106228:	c3                   	ret
+80106229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106230:	89 d7                	mov    %edx,%edi
+    room = p->cap - (p->nwrite - p->nread);
+80106232:	29 f8                	sub    %edi,%eax
+80106234:	89 c6                	mov    %eax,%esi
+    if(p->cap > PIPESIZE && p->page[off/PGSIZE] == 0){
+80106236:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+8010623c:	76 26                	jbe    80106264 <pipewrite+0xf4>
+    off = p->nwrite % p->cap;
+8010623e:	89 f8                	mov    %edi,%eax
+80106240:	31 d2                	xor    %edx,%edx
+80106242:	f7 f1                	div    %ecx
+    if(p->cap > PIPESIZE && p->page[off/PGSIZE] == 0){
+80106244:	89 d0                	mov    %edx,%eax
+    off = p->nwrite % p->cap;
+80106246:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    if(p->cap > PIPESIZE && p->page[off/PGSIZE] == 0){
+80106249:	c1 e8 0c             	shr    $0xc,%eax
+8010624c:	8d 90 8c 00 00 00    	lea    0x8c(%eax),%edx
+80106252:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80106255:	8b 94 83 34 02 00 00 	mov    0x234(%ebx,%eax,4),%edx
+8010625c:	85 d2                	test   %edx,%edx
+8010625e:	0f 84 a7 00 00 00    	je     8010630b <pipewrite+0x19b>
+  off %= p->cap;
+80106264:	89 f8                	mov    %edi,%eax
+80106266:	31 d2                	xor    %edx,%edx
+80106268:	f7 f1                	div    %ecx
+  if(p->cap == PIPESIZE){
+8010626a:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+80106270:	0f 84 8d 00 00 00    	je     80106303 <pipewrite+0x193>
+  *n = PGSIZE - off%PGSIZE;
+80106276:	89 d0                	mov    %edx,%eax
+  if((pg = p->page[off/PGSIZE]) == 0)
+80106278:	c1 ea 0c             	shr    $0xc,%edx
+  *n = PGSIZE - off%PGSIZE;
+8010627b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  if((pg = p->page[off/PGSIZE]) == 0)
+80106280:	8b 94 93 34 02 00 00 	mov    0x234(%ebx,%edx,4),%edx
+  *n = PGSIZE - off%PGSIZE;
+80106287:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010628c:	29 c1                	sub    %eax,%ecx
+  return pg + off%PGSIZE;
+8010628e:	01 d0                	add    %edx,%eax
+80106290:	85 d2                	test   %edx,%edx
+80106292:	0f 45 d0             	cmovne %eax,%edx
+    if(m > n - i)
+80106295:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106298:	8b 45 10             	mov    0x10(%ebp),%eax
+8010629b:	29 f8                	sub    %edi,%eax
+8010629d:	39 f0                	cmp    %esi,%eax
+8010629f:	0f 47 c6             	cmova  %esi,%eax
+801062a2:	39 c8                	cmp    %ecx,%eax
+801062a4:	0f 46 c8             	cmovbe %eax,%ecx
+    memmove(buf, addr + i, m);
+801062a7:	83 ec 04             	sub    $0x4,%esp
+801062aa:	51                   	push   %ecx
+801062ab:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801062ae:	89 cf                	mov    %ecx,%edi
+801062b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801062b3:	01 f0                	add    %esi,%eax
+    i += m;
+801062b5:	01 fe                	add    %edi,%esi
+    memmove(buf, addr + i, m);
+801062b7:	50                   	push   %eax
+801062b8:	52                   	push   %edx
+801062b9:	e8 22 1a 00 00       	call   80107ce0 <memmove>
+    p->nwrite += m;
+801062be:	8b 83 7c 02 00 00    	mov    0x27c(%ebx),%eax
+    i += m;
+801062c4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801062c7:	83 c4 10             	add    $0x10,%esp
+    p->nwrite += m;
+801062ca:	01 f8                	add    %edi,%eax
+        p->nwrite += PGSIZE;
+801062cc:	89 83 7c 02 00 00    	mov    %eax,0x27c(%ebx)
+  for(i = 0; i < n; ){
+801062d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801062d5:	39 45 10             	cmp    %eax,0x10(%ebp)
+801062d8:	0f 8f c2 fe ff ff    	jg     801061a0 <pipewrite+0x30>
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801062de:	83 ec 0c             	sub    $0xc,%esp
+801062e1:	8d 83 78 02 00 00    	lea    0x278(%ebx),%eax
+801062e7:	50                   	push   %eax
+801062e8:	e8 a3 0f 00 00       	call   80107290 <wakeup>
+  release(&p->lock);
+801062ed:	89 1c 24             	mov    %ebx,(%esp)
+801062f0:	e8 1b 18 00 00       	call   80107b10 <release>
+  return n;
+801062f5:	8b 45 10             	mov    0x10(%ebp),%eax
+801062f8:	83 c4 10             	add    $0x10,%esp
+801062fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801062fe:	e9 1b ff ff ff       	jmp    8010621e <pipewrite+0xae>
+    *n = PIPESIZE - off;
+80106303:	29 d1                	sub    %edx,%ecx
+    return p->data + off;
+80106305:	8d 54 13 34          	lea    0x34(%ebx,%edx,1),%edx
+80106309:	eb 8a                	jmp    80106295 <pipewrite+0x125>
+      if(off%PGSIZE == 0 && room >= PGSIZE && n - i >= PGSIZE &&
+8010630b:	f7 45 dc ff 0f 00 00 	testl  $0xfff,-0x24(%ebp)
+80106312:	75 5c                	jne    80106370 <pipewrite+0x200>
+80106314:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010631a:	76 54                	jbe    80106370 <pipewrite+0x200>
+8010631c:	8b 45 10             	mov    0x10(%ebp),%eax
+8010631f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106322:	29 f8                	sub    %edi,%eax
+80106324:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80106329:	7e 45                	jle    80106370 <pipewrite+0x200>
+         (p->page[off/PGSIZE] = lenduvm(myproc()->pgdir, (uint)(addr+i))) != 0){
+8010632b:	e8 f0 05 00 00       	call   80106920 <myproc>
+80106330:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106333:	8b 55 0c             	mov    0xc(%ebp),%edx
+80106336:	83 ec 08             	sub    $0x8,%esp
+80106339:	01 fa                	add    %edi,%edx
+8010633b:	52                   	push   %edx
+8010633c:	ff 70 04             	push   0x4(%eax)
+8010633f:	e8 2c 47 00 00       	call   8010aa70 <lenduvm>
+80106344:	8b 55 d8             	mov    -0x28(%ebp),%edx
+      if(off%PGSIZE == 0 && room >= PGSIZE && n - i >= PGSIZE &&
+80106347:	83 c4 10             	add    $0x10,%esp
+         (p->page[off/PGSIZE] = lenduvm(myproc()->pgdir, (uint)(addr+i))) != 0){
+8010634a:	89 44 93 04          	mov    %eax,0x4(%ebx,%edx,4)
+      if(off%PGSIZE == 0 && room >= PGSIZE && n - i >= PGSIZE &&
+8010634e:	85 c0                	test   %eax,%eax
+80106350:	74 1e                	je     80106370 <pipewrite+0x200>
+        p->nwrite += PGSIZE;
+80106352:	8b 83 7c 02 00 00    	mov    0x27c(%ebx),%eax
+        i += PGSIZE;
+80106358:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010635e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+        p->nwrite += PGSIZE;
+80106361:	05 00 10 00 00       	add    $0x1000,%eax
+        continue;
+80106366:	e9 61 ff ff ff       	jmp    801062cc <pipewrite+0x15c>
+8010636b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010636f:	90                   	nop
+      if((p->page[off/PGSIZE] = kalloc()) == 0){
+80106370:	e8 4b e7 ff ff       	call   80104ac0 <kalloc>
+80106375:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80106378:	89 44 bb 04          	mov    %eax,0x4(%ebx,%edi,4)
+8010637c:	85 c0                	test   %eax,%eax
+8010637e:	74 11                	je     80106391 <pipewrite+0x221>
+80106380:	8b bb 7c 02 00 00    	mov    0x27c(%ebx),%edi
+80106386:	8b 8b 74 02 00 00    	mov    0x274(%ebx),%ecx
+8010638c:	e9 d3 fe ff ff       	jmp    80106264 <pipewrite+0xf4>
+        release(&p->lock);
+80106391:	83 ec 0c             	sub    $0xc,%esp
+80106394:	53                   	push   %ebx
+80106395:	e8 76 17 00 00       	call   80107b10 <release>
+        return i > 0 ? i : -1;
+8010639a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010639d:	83 c4 10             	add    $0x10,%esp
+801063a0:	85 c0                	test   %eax,%eax
+801063a2:	0f 8f 76 fe ff ff    	jg     8010621e <pipewrite+0xae>
+801063a8:	e9 6a fe ff ff       	jmp    80106217 <pipewrite+0xa7>
+801063ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801063b0 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+801063b0:	55                   	push   %ebp
+801063b1:	89 e5                	mov    %esp,%ebp
+801063b3:	57                   	push   %edi
+801063b4:	56                   	push   %esi
+801063b5:	53                   	push   %ebx
+801063b6:	83 ec 38             	sub    $0x38,%esp
+801063b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+  uint m, off;
+  char *buf;
+
+  acquire(&p->lock);
+801063bc:	57                   	push   %edi
+801063bd:	8d b7 78 02 00 00    	lea    0x278(%edi),%esi
+801063c3:	e8 a8 17 00 00       	call   80107b70 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801063c8:	8b 9f 78 02 00 00    	mov    0x278(%edi),%ebx
+801063ce:	83 c4 10             	add    $0x10,%esp
+801063d1:	3b 9f 7c 02 00 00    	cmp    0x27c(%edi),%ebx
+801063d7:	74 32                	je     8010640b <piperead+0x5b>
+801063d9:	eb 3a                	jmp    80106415 <piperead+0x65>
+801063db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801063df:	90                   	nop
+    if(myproc()->killed){
+801063e0:	e8 3b 05 00 00       	call   80106920 <myproc>
+801063e5:	8b 48 28             	mov    0x28(%eax),%ecx
+801063e8:	85 c9                	test   %ecx,%ecx
+801063ea:	0f 85 b8 01 00 00    	jne    801065a8 <piperead+0x1f8>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+801063f0:	83 ec 08             	sub    $0x8,%esp
+801063f3:	57                   	push   %edi
+801063f4:	56                   	push   %esi
+801063f5:	e8 86 0d 00 00       	call   80107180 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801063fa:	8b 9f 78 02 00 00    	mov    0x278(%edi),%ebx
+80106400:	83 c4 10             	add    $0x10,%esp
+80106403:	3b 9f 7c 02 00 00    	cmp    0x27c(%edi),%ebx
+80106409:	75 0a                	jne    80106415 <piperead+0x65>
+8010640b:	8b 97 84 02 00 00    	mov    0x284(%edi),%edx
+80106411:	85 d2                	test   %edx,%edx
+80106413:	75 cb                	jne    801063e0 <piperead+0x30>
+    return p->data + off;
+80106415:	8d 47 34             	lea    0x34(%edi),%eax
+  }
+  for(i = 0; i < n && p->nread != p->nwrite; ){  //DOC: piperead-copy
+80106418:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    return p->data + off;
+8010641f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < n && p->nread != p->nwrite; ){  //DOC: piperead-copy
+80106422:	8b 45 10             	mov    0x10(%ebp),%eax
+80106425:	85 c0                	test   %eax,%eax
+80106427:	0f 8f 9c 00 00 00    	jg     801064c9 <piperead+0x119>
+8010642d:	e9 4e 01 00 00       	jmp    80106580 <piperead+0x1d0>
+80106432:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    off = p->nread % p->cap;
+    if(p->cap > PIPESIZE && off%PGSIZE == 0 &&
+80106438:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010643e:	0f 86 cd 00 00 00    	jbe    80106511 <piperead+0x161>
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+80106444:	81 7d dc ff 0f 00 00 	cmpl   $0xfff,-0x24(%ebp)
+  off %= p->cap;
+8010644b:	89 da                	mov    %ebx,%edx
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+8010644d:	0f 8f 7d 01 00 00    	jg     801065d0 <piperead+0x220>
+80106453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106457:	90                   	nop
+  if((pg = p->page[off/PGSIZE]) == 0)
+80106458:	c1 ea 0c             	shr    $0xc,%edx
+  *n = PGSIZE - off%PGSIZE;
+8010645b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  if((pg = p->page[off/PGSIZE]) == 0)
+80106460:	8b 94 97 34 02 00 00 	mov    0x234(%edi,%edx,4),%edx
+  *n = PGSIZE - off%PGSIZE;
+80106467:	29 c1                	sub    %eax,%ecx
+  return pg + off%PGSIZE;
+80106469:	01 d0                	add    %edx,%eax
+8010646b:	85 d2                	test   %edx,%edx
+8010646d:	0f 45 d0             	cmovne %eax,%edx
+      continue;
+    }
+    buf = pipebuf(p, p->nread, &m);
+    if(m > p->nwrite - p->nread)
+      m = p->nwrite - p->nread;
+    if(m > n - i)
+80106470:	39 f1                	cmp    %esi,%ecx
+80106472:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80106475:	0f 47 ce             	cmova  %esi,%ecx
+80106478:	89 c3                	mov    %eax,%ebx
+8010647a:	39 c1                	cmp    %eax,%ecx
+8010647c:	0f 46 d9             	cmovbe %ecx,%ebx
+      m = n - i;
+    memmove(addr + i, buf, m);
+8010647f:	83 ec 04             	sub    $0x4,%esp
+80106482:	53                   	push   %ebx
+80106483:	52                   	push   %edx
+80106484:	ff 75 d8             	push   -0x28(%ebp)
+80106487:	e8 54 18 00 00       	call   80107ce0 <memmove>
+    p->nread += m;
+8010648c:	8b 87 78 02 00 00    	mov    0x278(%edi),%eax
+    i += m;
+    // Done with this ring page.
+    if(p->cap > PIPESIZE && p->nread % PGSIZE == 0){
+80106492:	83 c4 10             	add    $0x10,%esp
+    p->nread += m;
+80106495:	01 d8                	add    %ebx,%eax
+    if(p->cap > PIPESIZE && p->nread % PGSIZE == 0){
+80106497:	81 bf 74 02 00 00 00 	cmpl   $0x200,0x274(%edi)
+8010649e:	02 00 00 
+    p->nread += m;
+801064a1:	89 87 78 02 00 00    	mov    %eax,0x278(%edi)
+    if(p->cap > PIPESIZE && p->nread % PGSIZE == 0){
+801064a7:	76 0b                	jbe    801064b4 <piperead+0x104>
+801064a9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+801064ae:	0f 84 8c 00 00 00    	je     80106540 <piperead+0x190>
+    i += m;
+801064b4:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  for(i = 0; i < n && p->nread != p->nwrite; ){  //DOC: piperead-copy
+801064b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801064ba:	39 45 10             	cmp    %eax,0x10(%ebp)
+801064bd:	0f 8e bd 00 00 00    	jle    80106580 <piperead+0x1d0>
+801064c3:	8b 9f 78 02 00 00    	mov    0x278(%edi),%ebx
+801064c9:	8b b7 7c 02 00 00    	mov    0x27c(%edi),%esi
+801064cf:	39 f3                	cmp    %esi,%ebx
+801064d1:	0f 84 a9 00 00 00    	je     80106580 <piperead+0x1d0>
+    off = p->nread % p->cap;
+801064d7:	8b 8f 74 02 00 00    	mov    0x274(%edi),%ecx
+801064dd:	89 d8                	mov    %ebx,%eax
+801064df:	31 d2                	xor    %edx,%edx
+801064e1:	f7 f1                	div    %ecx
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+801064e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    off = p->nread % p->cap;
+801064e6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+801064e9:	8b 55 10             	mov    0x10(%ebp),%edx
+801064ec:	29 c2                	sub    %eax,%edx
+       mapuvm(myproc()->pgdir, (uint)(addr+i), p->page[off/PGSIZE],
+801064ee:	03 45 0c             	add    0xc(%ebp),%eax
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+801064f1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+       mapuvm(myproc()->pgdir, (uint)(addr+i), p->page[off/PGSIZE],
+801064f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(p->cap > PIPESIZE && off%PGSIZE == 0 &&
+801064f7:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+801064fd:	76 21                	jbe    80106520 <piperead+0x170>
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+801064ff:	29 de                	sub    %ebx,%esi
+    if(p->cap > PIPESIZE && off%PGSIZE == 0 &&
+80106501:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80106504:	89 d8                	mov    %ebx,%eax
+80106506:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010650b:	0f 84 27 ff ff ff    	je     80106438 <piperead+0x88>
+  off %= p->cap;
+80106511:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80106514:	e9 3f ff ff ff       	jmp    80106458 <piperead+0xa8>
+80106519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106520:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    if(m > p->nwrite - p->nread)
+80106523:	29 de                	sub    %ebx,%esi
+  if(p->cap == PIPESIZE){
+80106525:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+8010652b:	75 43                	jne    80106570 <piperead+0x1c0>
+    return p->data + off;
+8010652d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    *n = PIPESIZE - off;
+80106530:	29 d1                	sub    %edx,%ecx
+    return p->data + off;
+80106532:	01 c2                	add    %eax,%edx
+80106534:	e9 37 ff ff ff       	jmp    80106470 <piperead+0xc0>
+80106539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      kfree(p->page[off/PGSIZE]);
+80106540:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80106543:	83 ec 0c             	sub    $0xc,%esp
+80106546:	c1 ee 0c             	shr    $0xc,%esi
+80106549:	81 c6 8c 00 00 00    	add    $0x8c,%esi
+8010654f:	ff 74 b7 04          	push   0x4(%edi,%esi,4)
+80106553:	e8 58 e2 ff ff       	call   801047b0 <kfree>
+      p->page[off/PGSIZE] = 0;
+80106558:	c7 44 b7 04 00 00 00 	movl   $0x0,0x4(%edi,%esi,4)
+8010655f:	00 
+80106560:	83 c4 10             	add    $0x10,%esp
+80106563:	e9 4c ff ff ff       	jmp    801064b4 <piperead+0x104>
+80106568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010656f:	90                   	nop
+  *n = PGSIZE - off%PGSIZE;
+80106570:	89 d0                	mov    %edx,%eax
+80106572:	25 ff 0f 00 00       	and    $0xfff,%eax
+80106577:	e9 dc fe ff ff       	jmp    80106458 <piperead+0xa8>
+8010657c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80106580:	83 ec 0c             	sub    $0xc,%esp
+80106583:	8d 87 7c 02 00 00    	lea    0x27c(%edi),%eax
+80106589:	50                   	push   %eax
+8010658a:	e8 01 0d 00 00       	call   80107290 <wakeup>
+  release(&p->lock);
+8010658f:	89 3c 24             	mov    %edi,(%esp)
+80106592:	e8 79 15 00 00       	call   80107b10 <release>
+  return i;
+}
+80106597:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  return i;
+8010659a:	83 c4 10             	add    $0x10,%esp
+}
+8010659d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801065a0:	5b                   	pop    %ebx
+801065a1:	5e                   	pop    %esi
+801065a2:	5f                   	pop    %edi
+801065a3:	5d                   	pop    %ebp
+801065a4:	c3                   	ret
+801065a5:	8d 76 00             	lea    0x0(%esi),%esi
+      release(&p->lock);
+801065a8:	83 ec 0c             	sub    $0xc,%esp
+801065ab:	57                   	push   %edi
+801065ac:	e8 5f 15 00 00       	call   80107b10 <release>
+      return -1;
+801065b1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+801065b8:	83 c4 10             	add    $0x10,%esp
+}
+801065bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801065be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801065c1:	5b                   	pop    %ebx
+801065c2:	5e                   	pop    %esi
+801065c3:	5f                   	pop    %edi
+801065c4:	5d                   	pop    %ebp
+801065c5:	c3                   	ret
+801065c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065cd:	8d 76 00             	lea    0x0(%esi),%esi
+              myproc()->sz) == 0){
+801065d0:	e8 4b 03 00 00       	call   80106920 <myproc>
+       mapuvm(myproc()->pgdir, (uint)(addr+i), p->page[off/PGSIZE],
+801065d5:	c1 eb 0c             	shr    $0xc,%ebx
+801065d8:	81 c3 8c 00 00 00    	add    $0x8c,%ebx
+801065de:	8b 30                	mov    (%eax),%esi
+801065e0:	8b 54 9f 04          	mov    0x4(%edi,%ebx,4),%edx
+801065e4:	89 55 d0             	mov    %edx,-0x30(%ebp)
+801065e7:	e8 34 03 00 00       	call   80106920 <myproc>
+801065ec:	56                   	push   %esi
+801065ed:	8b 55 d0             	mov    -0x30(%ebp),%edx
+801065f0:	52                   	push   %edx
+801065f1:	ff 75 d8             	push   -0x28(%ebp)
+801065f4:	ff 70 04             	push   0x4(%eax)
+801065f7:	e8 04 45 00 00       	call   8010ab00 <mapuvm>
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+801065fc:	83 c4 10             	add    $0x10,%esp
+801065ff:	85 c0                	test   %eax,%eax
+80106601:	74 1d                	je     80106620 <piperead+0x270>
+    buf = pipebuf(p, p->nread, &m);
+80106603:	8b 9f 78 02 00 00    	mov    0x278(%edi),%ebx
+  off %= p->cap;
+80106609:	8b 8f 74 02 00 00    	mov    0x274(%edi),%ecx
+8010660f:	31 d2                	xor    %edx,%edx
+    if(m > p->nwrite - p->nread)
+80106611:	8b b7 7c 02 00 00    	mov    0x27c(%edi),%esi
+  off %= p->cap;
+80106617:	89 d8                	mov    %ebx,%eax
+80106619:	f7 f1                	div    %ecx
+8010661b:	e9 03 ff ff ff       	jmp    80106523 <piperead+0x173>
+      p->page[off/PGSIZE] = 0;
+80106620:	c7 44 9f 04 00 00 00 	movl   $0x0,0x4(%edi,%ebx,4)
+80106627:	00 
+      i += PGSIZE;
+80106628:	81 45 e4 00 10 00 00 	addl   $0x1000,-0x1c(%ebp)
+      p->nread += PGSIZE;
+8010662f:	81 87 78 02 00 00 00 	addl   $0x1000,0x278(%edi)
+80106636:	10 00 00 
+      continue;
+80106639:	e9 79 fe ff ff       	jmp    801064b7 <piperead+0x107>
+8010663e:	66 90                	xchg   %ax,%ax
+
+80106640 <wakeup1>:
+// Wake up all processes sleeping on chan.
+// Only looks at the sleepers that hash with chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+80106640:	55                   	push   %ebp
+  struct proc **pp, *p;
+
+  ptable.nwakeup++;
+  pp = &ptable.sleepq[SLEEPQ(chan)];
+80106641:	89 c1                	mov    %eax,%ecx
+80106643:	c1 e9 02             	shr    $0x2,%ecx
+{
+80106646:	89 e5                	mov    %esp,%ebp
+80106648:	53                   	push   %ebx
+80106649:	89 c3                	mov    %eax,%ebx
+  pp = &ptable.sleepq[SLEEPQ(chan)];
+8010664b:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80106650:	f7 e1                	mul    %ecx
+  ptable.nwakeup++;
+80106652:	83 05 7c 84 15 80 01 	addl   $0x1,0x8015847c
+  pp = &ptable.sleepq[SLEEPQ(chan)];
+80106659:	c1 ea 04             	shr    $0x4,%edx
+8010665c:	6b c2 3d             	imul   $0x3d,%edx,%eax
+8010665f:	89 ca                	mov    %ecx,%edx
+80106661:	29 c2                	sub    %eax,%edx
+  while((p = *pp) != 0){
+80106663:	8b 04 95 88 83 15 80 	mov    -0x7fea7c78(,%edx,4),%eax
+8010666a:	85 c0                	test   %eax,%eax
+8010666c:	74 39                	je     801066a7 <wakeup1+0x67>
+8010666e:	8d 0c 95 88 83 15 80 	lea    -0x7fea7c78(,%edx,4),%ecx
+80106675:	eb 12                	jmp    80106689 <wakeup1+0x49>
+80106677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010667e:	66 90                	xchg   %ax,%ax
+    ptable.nscan++;
+    if(p->chan == chan){
+      *pp = p->snext;
+      p->state = RUNNABLE;
+    } else
+      pp = &p->snext;
+80106680:	8d 48 24             	lea    0x24(%eax),%ecx
+  while((p = *pp) != 0){
+80106683:	8b 01                	mov    (%ecx),%eax
+80106685:	85 c0                	test   %eax,%eax
+80106687:	74 1e                	je     801066a7 <wakeup1+0x67>
+    ptable.nscan++;
+80106689:	83 05 80 84 15 80 01 	addl   $0x1,0x80158480
+    if(p->chan == chan){
+80106690:	39 58 20             	cmp    %ebx,0x20(%eax)
+80106693:	75 eb                	jne    80106680 <wakeup1+0x40>
+      *pp = p->snext;
+80106695:	8b 50 24             	mov    0x24(%eax),%edx
+80106698:	89 11                	mov    %edx,(%ecx)
+      p->state = RUNNABLE;
+8010669a:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  while((p = *pp) != 0){
+801066a1:	8b 01                	mov    (%ecx),%eax
+801066a3:	85 c0                	test   %eax,%eax
+801066a5:	75 e2                	jne    80106689 <wakeup1+0x49>
+  }
+}
+801066a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801066aa:	c9                   	leave
+801066ab:	c3                   	ret
+801066ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801066b0 <kthreadstart>:
+{
+801066b0:	55                   	push   %ebp
+801066b1:	89 e5                	mov    %esp,%ebp
+801066b3:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+801066b6:	68 e0 80 15 80       	push   $0x801580e0
+801066bb:	e8 50 14 00 00       	call   80107b10 <release>
+  fn();
+801066c0:	ff 55 08             	call   *0x8(%ebp)
+  panic("kthread returned");
+801066c3:	c7 04 24 5c b3 10 80 	movl   $0x8010b35c,(%esp)
+801066ca:	e8 61 a0 ff ff       	call   80100730 <panic>
+801066cf:	90                   	nop
+
+801066d0 <forkret>:
+{
+801066d0:	55                   	push   %ebp
+801066d1:	89 e5                	mov    %esp,%ebp
+801066d3:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+801066d6:	68 e0 80 15 80       	push   $0x801580e0
+801066db:	e8 30 14 00 00       	call   80107b10 <release>
+  if (first) {
+801066e0:	a1 00 e0 10 80       	mov    0x8010e000,%eax
+801066e5:	83 c4 10             	add    $0x10,%esp
+801066e8:	85 c0                	test   %eax,%eax
+801066ea:	75 04                	jne    801066f0 <forkret+0x20>
+}
+801066ec:	c9                   	leave
+801066ed:	c3                   	ret
+801066ee:	66 90                	xchg   %ax,%ax
+    first = 0;
+801066f0:	c7 05 00 e0 10 80 00 	movl   $0x0,0x8010e000
+801066f7:	00 00 00 
+    iinit(ROOTDEV);
+801066fa:	83 ec 0c             	sub    $0xc,%esp
+801066fd:	6a 01                	push   $0x1
+801066ff:	e8 ec be ff ff       	call   801025f0 <iinit>
+    initlog(ROOTDEV);
+80106704:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+8010670b:	e8 b0 ee ff ff       	call   801055c0 <initlog>
+}
+80106710:	83 c4 10             	add    $0x10,%esp
+80106713:	c9                   	leave
+80106714:	c3                   	ret
+80106715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010671c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106720 <allocproc>:
+{
+80106720:	55                   	push   %ebp
+80106721:	89 e5                	mov    %esp,%ebp
+80106723:	53                   	push   %ebx
+80106724:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80106727:	68 e0 80 15 80       	push   $0x801580e0
+8010672c:	e8 3f 14 00 00       	call   80107b70 <acquire>
+  if((p = slaballoc(&ptable.cache)) == 0){
+80106731:	c7 04 24 14 81 15 80 	movl   $0x80158114,(%esp)
+80106738:	e8 c3 0d 00 00       	call   80107500 <slaballoc>
+8010673d:	83 c4 10             	add    $0x10,%esp
+80106740:	85 c0                	test   %eax,%eax
+80106742:	0f 84 f8 00 00 00    	je     80106840 <allocproc+0x120>
+80106748:	89 c3                	mov    %eax,%ebx
+  p->next = ptable.proc;
+8010674a:	a1 84 83 15 80       	mov    0x80158384,%eax
+8010674f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  if(ptable.proc)
+80106755:	85 c0                	test   %eax,%eax
+80106757:	74 06                	je     8010675f <allocproc+0x3f>
+    ptable.proc->prev = p;
+80106759:	89 98 84 00 00 00    	mov    %ebx,0x84(%eax)
+  p->pid = nextpid++;
+8010675f:	a1 04 e0 10 80       	mov    0x8010e004,%eax
+  release(&ptable.lock);
+80106764:	83 ec 0c             	sub    $0xc,%esp
+  ptable.proc = p;
+80106767:	89 1d 84 83 15 80    	mov    %ebx,0x80158384
+  p->state = EMBRYO;
+8010676d:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->pid = nextpid++;
+80106774:	8d 50 01             	lea    0x1(%eax),%edx
+80106777:	89 43 10             	mov    %eax,0x10(%ebx)
+8010677a:	89 15 04 e0 10 80    	mov    %edx,0x8010e004
+  release(&ptable.lock);
+80106780:	68 e0 80 15 80       	push   $0x801580e0
+80106785:	e8 86 13 00 00       	call   80107b10 <release>
+  if((p->kstack = kalloc()) == 0){
+8010678a:	e8 31 e3 ff ff       	call   80104ac0 <kalloc>
+8010678f:	83 c4 10             	add    $0x10,%esp
+80106792:	89 43 08             	mov    %eax,0x8(%ebx)
+80106795:	85 c0                	test   %eax,%eax
+80106797:	74 3f                	je     801067d8 <allocproc+0xb8>
+  sp -= sizeof *p->tf;
+80106799:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  memset(p->context, 0, sizeof *p->context);
+8010679f:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+801067a2:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+801067a7:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+801067aa:	c7 40 14 82 90 10 80 	movl   $0x80109082,0x14(%eax)
+  p->context = (struct context*)sp;
+801067b1:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801067b4:	6a 14                	push   $0x14
+801067b6:	6a 00                	push   $0x0
+801067b8:	50                   	push   %eax
+801067b9:	e8 92 14 00 00       	call   80107c50 <memset>
+  p->context->eip = (uint)forkret;
+801067be:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  return p;
+801067c1:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+801067c4:	c7 40 10 d0 66 10 80 	movl   $0x801066d0,0x10(%eax)
+}
+801067cb:	89 d8                	mov    %ebx,%eax
+801067cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801067d0:	c9                   	leave
+801067d1:	c3                   	ret
+801067d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquire(&ptable.lock);
+801067d8:	83 ec 0c             	sub    $0xc,%esp
+801067db:	68 e0 80 15 80       	push   $0x801580e0
+801067e0:	e8 8b 13 00 00       	call   80107b70 <acquire>
+  if(p->prev)
+801067e5:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+801067eb:	83 c4 10             	add    $0x10,%esp
+801067ee:	85 c0                	test   %eax,%eax
+801067f0:	74 6e                	je     80106860 <allocproc+0x140>
+    p->prev->next = p->next;
+801067f2:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+801067f8:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+  if(p->next)
+801067fe:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106804:	85 c0                	test   %eax,%eax
+80106806:	74 0c                	je     80106814 <allocproc+0xf4>
+    p->next->prev = p->prev;
+80106808:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+8010680e:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+  slabfree(&ptable.cache, p);
+80106814:	83 ec 08             	sub    $0x8,%esp
+  p->state = UNUSED;
+80106817:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  slabfree(&ptable.cache, p);
+8010681e:	53                   	push   %ebx
+    return 0;
+8010681f:	31 db                	xor    %ebx,%ebx
+  slabfree(&ptable.cache, p);
+80106821:	68 14 81 15 80       	push   $0x80158114
+80106826:	e8 d5 0e 00 00       	call   80107700 <slabfree>
+    release(&ptable.lock);
+8010682b:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106832:	e8 d9 12 00 00       	call   80107b10 <release>
+    return 0;
+80106837:	83 c4 10             	add    $0x10,%esp
+8010683a:	eb 8f                	jmp    801067cb <allocproc+0xab>
+8010683c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    release(&ptable.lock);
+80106840:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+80106843:	31 db                	xor    %ebx,%ebx
+    release(&ptable.lock);
+80106845:	68 e0 80 15 80       	push   $0x801580e0
+8010684a:	e8 c1 12 00 00       	call   80107b10 <release>
+    return 0;
+8010684f:	83 c4 10             	add    $0x10,%esp
+80106852:	e9 74 ff ff ff       	jmp    801067cb <allocproc+0xab>
+80106857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010685e:	66 90                	xchg   %ax,%ax
+    ptable.proc = p->next;
+80106860:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106866:	a3 84 83 15 80       	mov    %eax,0x80158384
+8010686b:	eb 91                	jmp    801067fe <allocproc+0xde>
+8010686d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106870 <pinit>:
+{
+80106870:	55                   	push   %ebp
+80106871:	89 e5                	mov    %esp,%ebp
+80106873:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+80106876:	68 6d b3 10 80       	push   $0x8010b36d
+8010687b:	68 e0 80 15 80       	push   $0x801580e0
+80106880:	e8 0b 11 00 00       	call   80107990 <initlock>
+  slabinit(&ptable.cache, "proc", sizeof(struct proc), 0);
+80106885:	6a 00                	push   $0x0
+80106887:	68 88 00 00 00       	push   $0x88
+8010688c:	68 74 b3 10 80       	push   $0x8010b374
+80106891:	68 14 81 15 80       	push   $0x80158114
+80106896:	e8 f5 0b 00 00       	call   80107490 <slabinit>
+}
+8010689b:	83 c4 20             	add    $0x20,%esp
+8010689e:	c9                   	leave
+8010689f:	c3                   	ret
+
+801068a0 <mycpu>:
+{
+801068a0:	55                   	push   %ebp
+801068a1:	89 e5                	mov    %esp,%ebp
+801068a3:	56                   	push   %esi
+801068a4:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801068a5:	9c                   	pushf
+801068a6:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801068a7:	f6 c4 02             	test   $0x2,%ah
+801068aa:	75 46                	jne    801068f2 <mycpu+0x52>
+  apicid = lapicid();
+801068ac:	e8 df e6 ff ff       	call   80104f90 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+801068b1:	8b 35 c4 78 15 80    	mov    0x801578c4,%esi
+801068b7:	85 f6                	test   %esi,%esi
+801068b9:	7e 2a                	jle    801068e5 <mycpu+0x45>
+801068bb:	31 d2                	xor    %edx,%edx
+801068bd:	eb 08                	jmp    801068c7 <mycpu+0x27>
+801068bf:	90                   	nop
+801068c0:	83 c2 01             	add    $0x1,%edx
+801068c3:	39 f2                	cmp    %esi,%edx
+801068c5:	74 1e                	je     801068e5 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+801068c7:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+801068cd:	0f b6 99 e0 78 15 80 	movzbl -0x7fea8720(%ecx),%ebx
+801068d4:	39 c3                	cmp    %eax,%ebx
+801068d6:	75 e8                	jne    801068c0 <mycpu+0x20>
+}
+801068d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+801068db:	8d 81 e0 78 15 80    	lea    -0x7fea8720(%ecx),%eax
+}
+801068e1:	5b                   	pop    %ebx
+801068e2:	5e                   	pop    %esi
+801068e3:	5d                   	pop    %ebp
+801068e4:	c3                   	ret
+  panic("unknown apicid\n");
+801068e5:	83 ec 0c             	sub    $0xc,%esp
+801068e8:	68 79 b3 10 80       	push   $0x8010b379
+801068ed:	e8 3e 9e ff ff       	call   80100730 <panic>
+    panic("mycpu called with interrupts enabled\n");
+801068f2:	83 ec 0c             	sub    $0xc,%esp
+801068f5:	68 58 b4 10 80       	push   $0x8010b458
+801068fa:	e8 31 9e ff ff       	call   80100730 <panic>
+801068ff:	90                   	nop
+
+80106900 <cpuid>:
+cpuid() {
+80106900:	55                   	push   %ebp
+80106901:	89 e5                	mov    %esp,%ebp
+80106903:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80106906:	e8 95 ff ff ff       	call   801068a0 <mycpu>
+}
+8010690b:	c9                   	leave
+  return mycpu()-cpus;
+8010690c:	2d e0 78 15 80       	sub    $0x801578e0,%eax
+80106911:	c1 f8 04             	sar    $0x4,%eax
+80106914:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+8010691a:	c3                   	ret
+8010691b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010691f:	90                   	nop
+
+80106920 <myproc>:
+myproc(void) {
+80106920:	55                   	push   %ebp
+80106921:	89 e5                	mov    %esp,%ebp
+80106923:	53                   	push   %ebx
+80106924:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80106927:	e8 f4 10 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+8010692c:	e8 6f ff ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80106931:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106937:	e8 34 11 00 00       	call   80107a70 <popcli>
+}
+8010693c:	89 d8                	mov    %ebx,%eax
+8010693e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106941:	c9                   	leave
+80106942:	c3                   	ret
+80106943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010694a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106950 <kthread>:
+{
+80106950:	55                   	push   %ebp
+80106951:	89 e5                	mov    %esp,%ebp
+80106953:	53                   	push   %ebx
+80106954:	83 ec 04             	sub    $0x4,%esp
+  if((p = allocproc()) == 0)
+80106957:	e8 c4 fd ff ff       	call   80106720 <allocproc>
+8010695c:	85 c0                	test   %eax,%eax
+8010695e:	0f 84 f6 00 00 00    	je     80106a5a <kthread+0x10a>
+80106964:	89 c3                	mov    %eax,%ebx
+  if((p->pgdir = setupkvm()) == 0){
+80106966:	e8 65 3d 00 00       	call   8010a6d0 <setupkvm>
+8010696b:	89 43 04             	mov    %eax,0x4(%ebx)
+8010696e:	85 c0                	test   %eax,%eax
+80106970:	74 7e                	je     801069f0 <kthread+0xa0>
+  *(uint*)sp = (uint)fn;
+80106972:	8b 55 0c             	mov    0xc(%ebp),%edx
+  sp = p->kstack + KSTACKSIZE;
+80106975:	8b 43 08             	mov    0x8(%ebx),%eax
+  memset(p->context, 0, sizeof *p->context);
+80106978:	83 ec 04             	sub    $0x4,%esp
+  p->sz = 0;
+8010697b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  p->parent = 0;
+80106981:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  p->tf = 0;
+80106988:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  sp -= sizeof *p->context;
+8010698f:	05 e4 0f 00 00       	add    $0xfe4,%eax
+  *(uint*)sp = (uint)fn;
+80106994:	89 50 18             	mov    %edx,0x18(%eax)
+  *(uint*)sp = 0;
+80106997:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  p->context = (struct context*)sp;
+8010699e:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801069a1:	6a 14                	push   $0x14
+801069a3:	6a 00                	push   $0x0
+801069a5:	50                   	push   %eax
+801069a6:	e8 a5 12 00 00       	call   80107c50 <memset>
+  p->context->eip = (uint)kthreadstart;
+801069ab:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  safestrcpy(p->name, name, sizeof(p->name));
+801069ae:	83 c4 0c             	add    $0xc,%esp
+  p->context->eip = (uint)kthreadstart;
+801069b1:	c7 40 10 b0 66 10 80 	movl   $0x801066b0,0x10(%eax)
+  safestrcpy(p->name, name, sizeof(p->name));
+801069b8:	8d 43 70             	lea    0x70(%ebx),%eax
+801069bb:	6a 10                	push   $0x10
+801069bd:	ff 75 08             	push   0x8(%ebp)
+801069c0:	50                   	push   %eax
+801069c1:	e8 3a 14 00 00       	call   80107e00 <safestrcpy>
+  acquire(&ptable.lock);
+801069c6:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+801069cd:	e8 9e 11 00 00       	call   80107b70 <acquire>
+  p->state = RUNNABLE;
+801069d2:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  release(&ptable.lock);
+801069d9:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+801069e0:	e8 2b 11 00 00       	call   80107b10 <release>
+  return p->pid;
+801069e5:	8b 43 10             	mov    0x10(%ebx),%eax
+801069e8:	83 c4 10             	add    $0x10,%esp
+}
+801069eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801069ee:	c9                   	leave
+801069ef:	c3                   	ret
+    kfree(p->kstack);
+801069f0:	83 ec 0c             	sub    $0xc,%esp
+801069f3:	ff 73 08             	push   0x8(%ebx)
+801069f6:	e8 b5 dd ff ff       	call   801047b0 <kfree>
+    acquire(&ptable.lock);
+801069fb:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106a02:	e8 69 11 00 00       	call   80107b70 <acquire>
+  if(p->prev)
+80106a07:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+80106a0d:	83 c4 10             	add    $0x10,%esp
+80106a10:	85 c0                	test   %eax,%eax
+80106a12:	74 4d                	je     80106a61 <kthread+0x111>
+    p->prev->next = p->next;
+80106a14:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80106a1a:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+  if(p->next)
+80106a20:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106a26:	85 c0                	test   %eax,%eax
+80106a28:	74 0c                	je     80106a36 <kthread+0xe6>
+    p->next->prev = p->prev;
+80106a2a:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+80106a30:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+  slabfree(&ptable.cache, p);
+80106a36:	83 ec 08             	sub    $0x8,%esp
+  p->state = UNUSED;
+80106a39:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  slabfree(&ptable.cache, p);
+80106a40:	53                   	push   %ebx
+80106a41:	68 14 81 15 80       	push   $0x80158114
+80106a46:	e8 b5 0c 00 00       	call   80107700 <slabfree>
+    release(&ptable.lock);
+80106a4b:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106a52:	e8 b9 10 00 00       	call   80107b10 <release>
+    return -1;
+80106a57:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106a5a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106a5f:	eb 8a                	jmp    801069eb <kthread+0x9b>
+    ptable.proc = p->next;
+80106a61:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106a67:	a3 84 83 15 80       	mov    %eax,0x80158384
+80106a6c:	eb b2                	jmp    80106a20 <kthread+0xd0>
+80106a6e:	66 90                	xchg   %ax,%ax
+
+80106a70 <userinit>:
+{
+80106a70:	55                   	push   %ebp
+80106a71:	89 e5                	mov    %esp,%ebp
+80106a73:	53                   	push   %ebx
+80106a74:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80106a77:	e8 a4 fc ff ff       	call   80106720 <allocproc>
+80106a7c:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80106a7e:	a3 84 84 15 80       	mov    %eax,0x80158484
+  if((p->pgdir = setupkvm()) == 0)
+80106a83:	e8 48 3c 00 00       	call   8010a6d0 <setupkvm>
+80106a88:	89 43 04             	mov    %eax,0x4(%ebx)
+80106a8b:	85 c0                	test   %eax,%eax
+80106a8d:	0f 84 bd 00 00 00    	je     80106b50 <userinit+0xe0>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80106a93:	83 ec 04             	sub    $0x4,%esp
+80106a96:	68 2c 00 00 00       	push   $0x2c
+80106a9b:	68 60 e4 10 80       	push   $0x8010e460
+80106aa0:	50                   	push   %eax
+80106aa1:	e8 0a 39 00 00       	call   8010a3b0 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80106aa6:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80106aa9:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80106aaf:	6a 4c                	push   $0x4c
+80106ab1:	6a 00                	push   $0x0
+80106ab3:	ff 73 18             	push   0x18(%ebx)
+80106ab6:	e8 95 11 00 00       	call   80107c50 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106abb:	8b 43 18             	mov    0x18(%ebx),%eax
+80106abe:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80106ac3:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106ac6:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106acb:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106acf:	8b 43 18             	mov    0x18(%ebx),%eax
+80106ad2:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80106ad6:	8b 43 18             	mov    0x18(%ebx),%eax
+80106ad9:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106add:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80106ae1:	8b 43 18             	mov    0x18(%ebx),%eax
+80106ae4:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106ae8:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80106aec:	8b 43 18             	mov    0x18(%ebx),%eax
+80106aef:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80106af6:	8b 43 18             	mov    0x18(%ebx),%eax
+80106af9:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80106b00:	8b 43 18             	mov    0x18(%ebx),%eax
+80106b03:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80106b0a:	8d 43 70             	lea    0x70(%ebx),%eax
+80106b0d:	6a 10                	push   $0x10
+80106b0f:	68 a2 b3 10 80       	push   $0x8010b3a2
+80106b14:	50                   	push   %eax
+80106b15:	e8 e6 12 00 00       	call   80107e00 <safestrcpy>
+  p->cwd = namei("/");
+80106b1a:	c7 04 24 ab b3 10 80 	movl   $0x8010b3ab,(%esp)
+80106b21:	e8 da d5 ff ff       	call   80104100 <namei>
+80106b26:	89 43 6c             	mov    %eax,0x6c(%ebx)
+  acquire(&ptable.lock);
+80106b29:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106b30:	e8 3b 10 00 00       	call   80107b70 <acquire>
+  p->state = RUNNABLE;
+80106b35:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  release(&ptable.lock);
+80106b3c:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106b43:	e8 c8 0f 00 00       	call   80107b10 <release>
+}
+80106b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106b4b:	83 c4 10             	add    $0x10,%esp
+80106b4e:	c9                   	leave
+80106b4f:	c3                   	ret
+    panic("userinit: out of memory?");
+80106b50:	83 ec 0c             	sub    $0xc,%esp
+80106b53:	68 89 b3 10 80       	push   $0x8010b389
+80106b58:	e8 d3 9b ff ff       	call   80100730 <panic>
+80106b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106b60 <growproc>:
+{
+80106b60:	55                   	push   %ebp
+80106b61:	89 e5                	mov    %esp,%ebp
+80106b63:	56                   	push   %esi
+80106b64:	53                   	push   %ebx
+80106b65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80106b68:	e8 b3 0e 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80106b6d:	e8 2e fd ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80106b72:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106b78:	e8 f3 0e 00 00       	call   80107a70 <popcli>
+  sz = curproc->sz;
+80106b7d:	8b 06                	mov    (%esi),%eax
+  if(n > 0){
+80106b7f:	85 db                	test   %ebx,%ebx
+80106b81:	7e 25                	jle    80106ba8 <growproc+0x48>
+    if(sz + n < sz || sz + n >= KERNBASE)
+80106b83:	01 d8                	add    %ebx,%eax
+80106b85:	72 39                	jb     80106bc0 <growproc+0x60>
+80106b87:	85 c0                	test   %eax,%eax
+80106b89:	78 35                	js     80106bc0 <growproc+0x60>
+  switchuvm(curproc);
+80106b8b:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+80106b8e:	89 06                	mov    %eax,(%esi)
+  switchuvm(curproc);
+80106b90:	56                   	push   %esi
+80106b91:	e8 0a 37 00 00       	call   8010a2a0 <switchuvm>
+  return 0;
+80106b96:	83 c4 10             	add    $0x10,%esp
+80106b99:	31 c0                	xor    %eax,%eax
+}
+80106b9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106b9e:	5b                   	pop    %ebx
+80106b9f:	5e                   	pop    %esi
+80106ba0:	5d                   	pop    %ebp
+80106ba1:	c3                   	ret
+80106ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  } else if(n < 0){
+80106ba8:	74 e1                	je     80106b8b <growproc+0x2b>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106baa:	83 ec 04             	sub    $0x4,%esp
+80106bad:	01 c3                	add    %eax,%ebx
+80106baf:	53                   	push   %ebx
+80106bb0:	50                   	push   %eax
+80106bb1:	ff 76 04             	push   0x4(%esi)
+80106bb4:	e8 67 3a 00 00       	call   8010a620 <deallocuvm>
+80106bb9:	83 c4 10             	add    $0x10,%esp
+80106bbc:	85 c0                	test   %eax,%eax
+80106bbe:	75 cb                	jne    80106b8b <growproc+0x2b>
+      return -1;
+80106bc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106bc5:	eb d4                	jmp    80106b9b <growproc+0x3b>
+80106bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106bce:	66 90                	xchg   %ax,%ax
+
+80106bd0 <fork>:
+{
+80106bd0:	55                   	push   %ebp
+80106bd1:	89 e5                	mov    %esp,%ebp
+80106bd3:	57                   	push   %edi
+80106bd4:	56                   	push   %esi
+80106bd5:	53                   	push   %ebx
+80106bd6:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80106bd9:	e8 42 0e 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80106bde:	e8 bd fc ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80106be3:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106be9:	e8 82 0e 00 00       	call   80107a70 <popcli>
+  if((np = allocproc()) == 0){
+80106bee:	e8 2d fb ff ff       	call   80106720 <allocproc>
+80106bf3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106bf6:	85 c0                	test   %eax,%eax
+80106bf8:	0f 84 2a 01 00 00    	je     80106d28 <fork+0x158>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106bfe:	83 ec 08             	sub    $0x8,%esp
+80106c01:	ff 33                	push   (%ebx)
+80106c03:	89 c7                	mov    %eax,%edi
+80106c05:	ff 73 04             	push   0x4(%ebx)
+80106c08:	e8 b3 3b 00 00       	call   8010a7c0 <copyuvm>
+80106c0d:	83 c4 10             	add    $0x10,%esp
+80106c10:	89 47 04             	mov    %eax,0x4(%edi)
+80106c13:	85 c0                	test   %eax,%eax
+80106c15:	0f 84 9a 00 00 00    	je     80106cb5 <fork+0xe5>
+  np->sz = curproc->sz;
+80106c1b:	8b 03                	mov    (%ebx),%eax
+80106c1d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106c20:	89 01                	mov    %eax,(%ecx)
+  *np->tf = *curproc->tf;
+80106c22:	8b 79 18             	mov    0x18(%ecx),%edi
+  np->parent = curproc;
+80106c25:	89 c8                	mov    %ecx,%eax
+80106c27:	89 59 14             	mov    %ebx,0x14(%ecx)
+  *np->tf = *curproc->tf;
+80106c2a:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106c2f:	8b 73 18             	mov    0x18(%ebx),%esi
+80106c32:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+80106c34:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80106c36:	8b 40 18             	mov    0x18(%eax),%eax
+80106c39:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    if(curproc->ofile[i])
+80106c40:	8b 44 b3 2c          	mov    0x2c(%ebx,%esi,4),%eax
+80106c44:	85 c0                	test   %eax,%eax
+80106c46:	74 13                	je     80106c5b <fork+0x8b>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106c48:	83 ec 0c             	sub    $0xc,%esp
+80106c4b:	50                   	push   %eax
+80106c4c:	e8 0f a6 ff ff       	call   80101260 <filedup>
+80106c51:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106c54:	83 c4 10             	add    $0x10,%esp
+80106c57:	89 44 b2 2c          	mov    %eax,0x2c(%edx,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+80106c5b:	83 c6 01             	add    $0x1,%esi
+80106c5e:	83 fe 10             	cmp    $0x10,%esi
+80106c61:	75 dd                	jne    80106c40 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+80106c63:	83 ec 0c             	sub    $0xc,%esp
+80106c66:	ff 73 6c             	push   0x6c(%ebx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106c69:	83 c3 70             	add    $0x70,%ebx
+  np->cwd = idup(curproc->cwd);
+80106c6c:	e8 9f bb ff ff       	call   80102810 <idup>
+80106c71:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106c74:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+80106c77:	89 47 6c             	mov    %eax,0x6c(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106c7a:	8d 47 70             	lea    0x70(%edi),%eax
+80106c7d:	6a 10                	push   $0x10
+80106c7f:	53                   	push   %ebx
+80106c80:	50                   	push   %eax
+80106c81:	e8 7a 11 00 00       	call   80107e00 <safestrcpy>
+  pid = np->pid;
+80106c86:	8b 5f 10             	mov    0x10(%edi),%ebx
+  acquire(&ptable.lock);
+80106c89:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106c90:	e8 db 0e 00 00       	call   80107b70 <acquire>
+  np->state = RUNNABLE;
+80106c95:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+  release(&ptable.lock);
+80106c9c:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106ca3:	e8 68 0e 00 00       	call   80107b10 <release>
+  return pid;
+80106ca8:	83 c4 10             	add    $0x10,%esp
+}
+80106cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106cae:	89 d8                	mov    %ebx,%eax
+80106cb0:	5b                   	pop    %ebx
+80106cb1:	5e                   	pop    %esi
+80106cb2:	5f                   	pop    %edi
+80106cb3:	5d                   	pop    %ebp
+80106cb4:	c3                   	ret
+    kfree(np->kstack);
+80106cb5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80106cb8:	83 ec 0c             	sub    $0xc,%esp
+80106cbb:	ff 73 08             	push   0x8(%ebx)
+80106cbe:	e8 ed da ff ff       	call   801047b0 <kfree>
+    acquire(&ptable.lock);
+80106cc3:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106cca:	e8 a1 0e 00 00       	call   80107b70 <acquire>
+  if(p->prev)
+80106ccf:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+80106cd5:	83 c4 10             	add    $0x10,%esp
+80106cd8:	85 c0                	test   %eax,%eax
+80106cda:	74 56                	je     80106d32 <fork+0x162>
+    p->prev->next = p->next;
+80106cdc:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+80106ce2:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+  if(p->next)
+80106ce8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80106ceb:	8b 81 80 00 00 00    	mov    0x80(%ecx),%eax
+80106cf1:	85 c0                	test   %eax,%eax
+80106cf3:	74 0c                	je     80106d01 <fork+0x131>
+    p->next->prev = p->prev;
+80106cf5:	8b 91 84 00 00 00    	mov    0x84(%ecx),%edx
+80106cfb:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+  p->state = UNUSED;
+80106d01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  slabfree(&ptable.cache, p);
+80106d04:	83 ec 08             	sub    $0x8,%esp
+  p->state = UNUSED;
+80106d07:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  slabfree(&ptable.cache, p);
+80106d0e:	50                   	push   %eax
+80106d0f:	68 14 81 15 80       	push   $0x80158114
+80106d14:	e8 e7 09 00 00       	call   80107700 <slabfree>
+    release(&ptable.lock);
+80106d19:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106d20:	e8 eb 0d 00 00       	call   80107b10 <release>
+    return -1;
+80106d25:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106d28:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106d2d:	e9 79 ff ff ff       	jmp    80106cab <fork+0xdb>
+    ptable.proc = p->next;
+80106d32:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106d35:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80106d3b:	a3 84 83 15 80       	mov    %eax,0x80158384
+80106d40:	eb a6                	jmp    80106ce8 <fork+0x118>
+80106d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106d50 <scheduler>:
+{
+80106d50:	55                   	push   %ebp
+80106d51:	89 e5                	mov    %esp,%ebp
+80106d53:	57                   	push   %edi
+80106d54:	56                   	push   %esi
+80106d55:	53                   	push   %ebx
+80106d56:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c = mycpu();
+80106d59:	e8 42 fb ff ff       	call   801068a0 <mycpu>
+  c->proc = 0;
+80106d5e:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+80106d65:	00 00 00 
+  struct cpu *c = mycpu();
+80106d68:	89 c6                	mov    %eax,%esi
+  c->proc = 0;
+80106d6a:	8d 78 04             	lea    0x4(%eax),%edi
+80106d6d:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("sti");
+80106d70:	fb                   	sti
+    acquire(&ptable.lock);
+80106d71:	83 ec 0c             	sub    $0xc,%esp
+80106d74:	68 e0 80 15 80       	push   $0x801580e0
+80106d79:	e8 f2 0d 00 00       	call   80107b70 <acquire>
+    for(p = ptable.proc; p; p = p->next){
+80106d7e:	8b 1d 84 83 15 80    	mov    0x80158384,%ebx
+80106d84:	83 c4 10             	add    $0x10,%esp
+80106d87:	85 db                	test   %ebx,%ebx
+80106d89:	74 48                	je     80106dd3 <scheduler+0x83>
+80106d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106d8f:	90                   	nop
+      if(p->state != RUNNABLE)
+80106d90:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+80106d94:	75 33                	jne    80106dc9 <scheduler+0x79>
+      switchuvm(p);
+80106d96:	83 ec 0c             	sub    $0xc,%esp
+      c->proc = p;
+80106d99:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+      switchuvm(p);
+80106d9f:	53                   	push   %ebx
+80106da0:	e8 fb 34 00 00       	call   8010a2a0 <switchuvm>
+      p->state = RUNNING;
+80106da5:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+      swtch(&(c->scheduler), p->context);
+80106dac:	58                   	pop    %eax
+80106dad:	5a                   	pop    %edx
+80106dae:	ff 73 1c             	push   0x1c(%ebx)
+80106db1:	57                   	push   %edi
+80106db2:	e8 a4 10 00 00       	call   80107e5b <swtch>
+      switchkvm();
+80106db7:	e8 d4 34 00 00       	call   8010a290 <switchkvm>
+      c->proc = 0;
+80106dbc:	83 c4 10             	add    $0x10,%esp
+80106dbf:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+80106dc6:	00 00 00 
+    for(p = ptable.proc; p; p = p->next){
+80106dc9:	8b 9b 80 00 00 00    	mov    0x80(%ebx),%ebx
+80106dcf:	85 db                	test   %ebx,%ebx
+80106dd1:	75 bd                	jne    80106d90 <scheduler+0x40>
+    release(&ptable.lock);
+80106dd3:	83 ec 0c             	sub    $0xc,%esp
+80106dd6:	68 e0 80 15 80       	push   $0x801580e0
+80106ddb:	e8 30 0d 00 00       	call   80107b10 <release>
+    sti();
+80106de0:	83 c4 10             	add    $0x10,%esp
+80106de3:	eb 8b                	jmp    80106d70 <scheduler+0x20>
+80106de5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106df0 <sched>:
+{
+80106df0:	55                   	push   %ebp
+80106df1:	89 e5                	mov    %esp,%ebp
+80106df3:	56                   	push   %esi
+80106df4:	53                   	push   %ebx
+  pushcli();
+80106df5:	e8 26 0c 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80106dfa:	e8 a1 fa ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80106dff:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106e05:	e8 66 0c 00 00       	call   80107a70 <popcli>
+  if(!holding(&ptable.lock))
+80106e0a:	83 ec 0c             	sub    $0xc,%esp
+80106e0d:	68 e0 80 15 80       	push   $0x801580e0
+80106e12:	e8 b9 0c 00 00       	call   80107ad0 <holding>
+80106e17:	83 c4 10             	add    $0x10,%esp
+80106e1a:	85 c0                	test   %eax,%eax
+80106e1c:	74 4f                	je     80106e6d <sched+0x7d>
+  if(mycpu()->ncli != 1)
+80106e1e:	e8 7d fa ff ff       	call   801068a0 <mycpu>
+80106e23:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+80106e2a:	75 68                	jne    80106e94 <sched+0xa4>
+  if(p->state == RUNNING)
+80106e2c:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80106e30:	74 55                	je     80106e87 <sched+0x97>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106e32:	9c                   	pushf
+80106e33:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106e34:	f6 c4 02             	test   $0x2,%ah
+80106e37:	75 41                	jne    80106e7a <sched+0x8a>
+  intena = mycpu()->intena;
+80106e39:	e8 62 fa ff ff       	call   801068a0 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+80106e3e:	83 c3 1c             	add    $0x1c,%ebx
+  intena = mycpu()->intena;
+80106e41:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80106e47:	e8 54 fa ff ff       	call   801068a0 <mycpu>
+80106e4c:	83 ec 08             	sub    $0x8,%esp
+80106e4f:	ff 70 04             	push   0x4(%eax)
+80106e52:	53                   	push   %ebx
+80106e53:	e8 03 10 00 00       	call   80107e5b <swtch>
+  mycpu()->intena = intena;
+80106e58:	e8 43 fa ff ff       	call   801068a0 <mycpu>
+}
+80106e5d:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80106e60:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80106e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106e69:	5b                   	pop    %ebx
+80106e6a:	5e                   	pop    %esi
+80106e6b:	5d                   	pop    %ebp
+80106e6c:	c3                   	ret
+    panic("sched ptable.lock");
+80106e6d:	83 ec 0c             	sub    $0xc,%esp
+80106e70:	68 ad b3 10 80       	push   $0x8010b3ad
+80106e75:	e8 b6 98 ff ff       	call   80100730 <panic>
+    panic("sched interruptible");
+80106e7a:	83 ec 0c             	sub    $0xc,%esp
+80106e7d:	68 d9 b3 10 80       	push   $0x8010b3d9
+80106e82:	e8 a9 98 ff ff       	call   80100730 <panic>
+    panic("sched running");
+80106e87:	83 ec 0c             	sub    $0xc,%esp
+80106e8a:	68 cb b3 10 80       	push   $0x8010b3cb
+80106e8f:	e8 9c 98 ff ff       	call   80100730 <panic>
+    panic("sched locks");
+80106e94:	83 ec 0c             	sub    $0xc,%esp
+80106e97:	68 bf b3 10 80       	push   $0x8010b3bf
+80106e9c:	e8 8f 98 ff ff       	call   80100730 <panic>
+80106ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106eaf:	90                   	nop
+
+80106eb0 <exit>:
+{
+80106eb0:	55                   	push   %ebp
+80106eb1:	89 e5                	mov    %esp,%ebp
+80106eb3:	57                   	push   %edi
+80106eb4:	56                   	push   %esi
+80106eb5:	53                   	push   %ebx
+80106eb6:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80106eb9:	e8 62 fa ff ff       	call   80106920 <myproc>
+  if(curproc == initproc)
+80106ebe:	39 05 84 84 15 80    	cmp    %eax,0x80158484
+80106ec4:	0f 84 b7 00 00 00    	je     80106f81 <exit+0xd1>
+80106eca:	89 c6                	mov    %eax,%esi
+80106ecc:	8d 58 2c             	lea    0x2c(%eax),%ebx
+80106ecf:	8d 78 6c             	lea    0x6c(%eax),%edi
+80106ed2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+80106ed8:	8b 03                	mov    (%ebx),%eax
+80106eda:	85 c0                	test   %eax,%eax
+80106edc:	74 12                	je     80106ef0 <exit+0x40>
+      fileclose(curproc->ofile[fd]);
+80106ede:	83 ec 0c             	sub    $0xc,%esp
+80106ee1:	50                   	push   %eax
+80106ee2:	e8 c9 a3 ff ff       	call   801012b0 <fileclose>
+      curproc->ofile[fd] = 0;
+80106ee7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80106eed:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80106ef0:	83 c3 04             	add    $0x4,%ebx
+80106ef3:	39 fb                	cmp    %edi,%ebx
+80106ef5:	75 e1                	jne    80106ed8 <exit+0x28>
+  begin_op();
+80106ef7:	e8 04 e8 ff ff       	call   80105700 <begin_op>
+  iput(curproc->cwd);
+80106efc:	83 ec 0c             	sub    $0xc,%esp
+80106eff:	ff 76 6c             	push   0x6c(%esi)
+80106f02:	e8 a9 ba ff ff       	call   801029b0 <iput>
+  end_op();
+80106f07:	e8 74 e8 ff ff       	call   80105780 <end_op>
+  curproc->cwd = 0;
+80106f0c:	c7 46 6c 00 00 00 00 	movl   $0x0,0x6c(%esi)
+  acquire(&ptable.lock);
+80106f13:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80106f1a:	e8 51 0c 00 00       	call   80107b70 <acquire>
+  wakeup1(curproc->parent);
+80106f1f:	8b 46 14             	mov    0x14(%esi),%eax
+80106f22:	e8 19 f7 ff ff       	call   80106640 <wakeup1>
+  for(p = ptable.proc; p; p = p->next){
+80106f27:	8b 1d 84 83 15 80    	mov    0x80158384,%ebx
+80106f2d:	83 c4 10             	add    $0x10,%esp
+80106f30:	85 db                	test   %ebx,%ebx
+80106f32:	75 16                	jne    80106f4a <exit+0x9a>
+80106f34:	eb 32                	jmp    80106f68 <exit+0xb8>
+80106f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106f3d:	8d 76 00             	lea    0x0(%esi),%esi
+80106f40:	8b 9b 80 00 00 00    	mov    0x80(%ebx),%ebx
+80106f46:	85 db                	test   %ebx,%ebx
+80106f48:	74 1e                	je     80106f68 <exit+0xb8>
+    if(p->parent == curproc){
+80106f4a:	39 73 14             	cmp    %esi,0x14(%ebx)
+80106f4d:	75 f1                	jne    80106f40 <exit+0x90>
+      p->parent = initproc;
+80106f4f:	a1 84 84 15 80       	mov    0x80158484,%eax
+      if(p->state == ZOMBIE)
+80106f54:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+      p->parent = initproc;
+80106f58:	89 43 14             	mov    %eax,0x14(%ebx)
+      if(p->state == ZOMBIE)
+80106f5b:	75 e3                	jne    80106f40 <exit+0x90>
+        wakeup1(initproc);
+80106f5d:	e8 de f6 ff ff       	call   80106640 <wakeup1>
+80106f62:	eb dc                	jmp    80106f40 <exit+0x90>
+80106f64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  curproc->state = ZOMBIE;
+80106f68:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  sched();
+80106f6f:	e8 7c fe ff ff       	call   80106df0 <sched>
+  panic("zombie exit");
+80106f74:	83 ec 0c             	sub    $0xc,%esp
+80106f77:	68 fa b3 10 80       	push   $0x8010b3fa
+80106f7c:	e8 af 97 ff ff       	call   80100730 <panic>
+    panic("init exiting");
+80106f81:	83 ec 0c             	sub    $0xc,%esp
+80106f84:	68 ed b3 10 80       	push   $0x8010b3ed
+80106f89:	e8 a2 97 ff ff       	call   80100730 <panic>
+80106f8e:	66 90                	xchg   %ax,%ax
+
+80106f90 <wait>:
+{
+80106f90:	55                   	push   %ebp
+80106f91:	89 e5                	mov    %esp,%ebp
+80106f93:	57                   	push   %edi
+80106f94:	56                   	push   %esi
+80106f95:	53                   	push   %ebx
+80106f96:	83 ec 0c             	sub    $0xc,%esp
+  pushcli();
+80106f99:	e8 82 0a 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80106f9e:	e8 fd f8 ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80106fa3:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80106fa9:	e8 c2 0a 00 00       	call   80107a70 <popcli>
+  acquire(&ptable.lock);
+80106fae:	83 ec 0c             	sub    $0xc,%esp
+80106fb1:	68 e0 80 15 80       	push   $0x801580e0
+80106fb6:	e8 b5 0b 00 00       	call   80107b70 <acquire>
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80106fbb:	89 f1                	mov    %esi,%ecx
+80106fbd:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80106fc2:	83 c4 10             	add    $0x10,%esp
+80106fc5:	c1 e9 02             	shr    $0x2,%ecx
+    for(p = ptable.proc; p; p = p->next){
+80106fc8:	8b 1d 84 83 15 80    	mov    0x80158384,%ebx
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80106fce:	f7 e1                	mul    %ecx
+80106fd0:	89 d7                	mov    %edx,%edi
+80106fd2:	c1 ef 04             	shr    $0x4,%edi
+80106fd5:	6b c7 3d             	imul   $0x3d,%edi,%eax
+80106fd8:	29 c1                	sub    %eax,%ecx
+80106fda:	89 cf                	mov    %ecx,%edi
+    for(p = ptable.proc; p; p = p->next){
+80106fdc:	85 db                	test   %ebx,%ebx
+80106fde:	0f 84 97 00 00 00    	je     8010707b <wait+0xeb>
+    havekids = 0;
+80106fe4:	31 c0                	xor    %eax,%eax
+80106fe6:	eb 12                	jmp    80106ffa <wait+0x6a>
+80106fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106fef:	90                   	nop
+    for(p = ptable.proc; p; p = p->next){
+80106ff0:	8b 9b 80 00 00 00    	mov    0x80(%ebx),%ebx
+80106ff6:	85 db                	test   %ebx,%ebx
+80106ff8:	74 1e                	je     80107018 <wait+0x88>
+      if(p->parent != curproc)
+80106ffa:	39 73 14             	cmp    %esi,0x14(%ebx)
+80106ffd:	75 f1                	jne    80106ff0 <wait+0x60>
+      if(p->state == ZOMBIE){
+80106fff:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+80107003:	0f 84 97 00 00 00    	je     801070a0 <wait+0x110>
+    for(p = ptable.proc; p; p = p->next){
+80107009:	8b 9b 80 00 00 00    	mov    0x80(%ebx),%ebx
+      havekids = 1;
+8010700f:	b8 01 00 00 00       	mov    $0x1,%eax
+    for(p = ptable.proc; p; p = p->next){
+80107014:	85 db                	test   %ebx,%ebx
+80107016:	75 e2                	jne    80106ffa <wait+0x6a>
+    if(!havekids || curproc->killed){
+80107018:	85 c0                	test   %eax,%eax
+8010701a:	74 5f                	je     8010707b <wait+0xeb>
+8010701c:	8b 46 28             	mov    0x28(%esi),%eax
+8010701f:	85 c0                	test   %eax,%eax
+80107021:	75 58                	jne    8010707b <wait+0xeb>
+  pushcli();
+80107023:	e8 f8 09 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80107028:	e8 73 f8 ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+8010702d:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107033:	e8 38 0a 00 00       	call   80107a70 <popcli>
+  if(p == 0)
+80107038:	85 db                	test   %ebx,%ebx
+8010703a:	0f 84 e1 00 00 00    	je     80107121 <wait+0x191>
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80107040:	8d 87 a8 00 00 00    	lea    0xa8(%edi),%eax
+  p->chan = chan;
+80107046:	89 73 20             	mov    %esi,0x20(%ebx)
+  p->state = SLEEPING;
+80107049:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80107050:	8b 14 85 e8 80 15 80 	mov    -0x7fea7f18(,%eax,4),%edx
+80107057:	89 53 24             	mov    %edx,0x24(%ebx)
+  ptable.sleepq[SLEEPQ(chan)] = p;
+8010705a:	89 1c 85 e8 80 15 80 	mov    %ebx,-0x7fea7f18(,%eax,4)
+  sched();
+80107061:	e8 8a fd ff ff       	call   80106df0 <sched>
+  p->chan = 0;
+80107066:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    for(p = ptable.proc; p; p = p->next){
+8010706d:	8b 1d 84 83 15 80    	mov    0x80158384,%ebx
+80107073:	85 db                	test   %ebx,%ebx
+80107075:	0f 85 69 ff ff ff    	jne    80106fe4 <wait+0x54>
+      release(&ptable.lock);
+8010707b:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+8010707e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+80107083:	68 e0 80 15 80       	push   $0x801580e0
+80107088:	e8 83 0a 00 00       	call   80107b10 <release>
+      return -1;
+8010708d:	83 c4 10             	add    $0x10,%esp
+}
+80107090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107093:	89 f0                	mov    %esi,%eax
+80107095:	5b                   	pop    %ebx
+80107096:	5e                   	pop    %esi
+80107097:	5f                   	pop    %edi
+80107098:	5d                   	pop    %ebp
+80107099:	c3                   	ret
+8010709a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        kfree(p->kstack);
+801070a0:	83 ec 0c             	sub    $0xc,%esp
+        pid = p->pid;
+801070a3:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+801070a6:	ff 73 08             	push   0x8(%ebx)
+801070a9:	e8 02 d7 ff ff       	call   801047b0 <kfree>
+        freevm(p->pgdir);
+801070ae:	5a                   	pop    %edx
+801070af:	ff 73 04             	push   0x4(%ebx)
+801070b2:	e8 99 35 00 00       	call   8010a650 <freevm>
+  if(p->prev)
+801070b7:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+801070bd:	83 c4 10             	add    $0x10,%esp
+801070c0:	85 c0                	test   %eax,%eax
+801070c2:	74 50                	je     80107114 <wait+0x184>
+    p->prev->next = p->next;
+801070c4:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+801070ca:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+  if(p->next)
+801070d0:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801070d6:	85 c0                	test   %eax,%eax
+801070d8:	74 0c                	je     801070e6 <wait+0x156>
+    p->next->prev = p->prev;
+801070da:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+801070e0:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+  slabfree(&ptable.cache, p);
+801070e6:	83 ec 08             	sub    $0x8,%esp
+  p->state = UNUSED;
+801070e9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  slabfree(&ptable.cache, p);
+801070f0:	53                   	push   %ebx
+801070f1:	68 14 81 15 80       	push   $0x80158114
+801070f6:	e8 05 06 00 00       	call   80107700 <slabfree>
+        release(&ptable.lock);
+801070fb:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80107102:	e8 09 0a 00 00       	call   80107b10 <release>
+        return pid;
+80107107:	83 c4 10             	add    $0x10,%esp
+}
+8010710a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010710d:	89 f0                	mov    %esi,%eax
+8010710f:	5b                   	pop    %ebx
+80107110:	5e                   	pop    %esi
+80107111:	5f                   	pop    %edi
+80107112:	5d                   	pop    %ebp
+80107113:	c3                   	ret
+    ptable.proc = p->next;
+80107114:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+8010711a:	a3 84 83 15 80       	mov    %eax,0x80158384
+8010711f:	eb af                	jmp    801070d0 <wait+0x140>
+    panic("sleep");
+80107121:	83 ec 0c             	sub    $0xc,%esp
+80107124:	68 19 b4 10 80       	push   $0x8010b419
+80107129:	e8 02 96 ff ff       	call   80100730 <panic>
+8010712e:	66 90                	xchg   %ax,%ax
+
+80107130 <yield>:
+{
+80107130:	55                   	push   %ebp
+80107131:	89 e5                	mov    %esp,%ebp
+80107133:	53                   	push   %ebx
+80107134:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+80107137:	68 e0 80 15 80       	push   $0x801580e0
+8010713c:	e8 2f 0a 00 00       	call   80107b70 <acquire>
+  pushcli();
+80107141:	e8 da 08 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80107146:	e8 55 f7 ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+8010714b:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107151:	e8 1a 09 00 00       	call   80107a70 <popcli>
+  myproc()->state = RUNNABLE;
+80107156:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  sched();
+8010715d:	e8 8e fc ff ff       	call   80106df0 <sched>
+  release(&ptable.lock);
+80107162:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80107169:	e8 a2 09 00 00       	call   80107b10 <release>
+}
+8010716e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107171:	83 c4 10             	add    $0x10,%esp
+80107174:	c9                   	leave
+80107175:	c3                   	ret
+80107176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010717d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107180 <sleep>:
+{
+80107180:	55                   	push   %ebp
+80107181:	89 e5                	mov    %esp,%ebp
+80107183:	57                   	push   %edi
+80107184:	56                   	push   %esi
+80107185:	53                   	push   %ebx
+80107186:	83 ec 1c             	sub    $0x1c,%esp
+80107189:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010718c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pushcli();
+8010718f:	e8 8c 08 00 00       	call   80107a20 <pushcli>
+  c = mycpu();
+80107194:	e8 07 f7 ff ff       	call   801068a0 <mycpu>
+  p = c->proc;
+80107199:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010719f:	e8 cc 08 00 00       	call   80107a70 <popcli>
+  if(p == 0)
+801071a4:	85 db                	test   %ebx,%ebx
+801071a6:	0f 84 d6 00 00 00    	je     80107282 <sleep+0x102>
+  if(lk == 0)
+801071ac:	85 f6                	test   %esi,%esi
+801071ae:	0f 84 c1 00 00 00    	je     80107275 <sleep+0xf5>
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+801071b4:	89 f9                	mov    %edi,%ecx
+801071b6:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+801071bb:	c1 e9 02             	shr    $0x2,%ecx
+801071be:	f7 e1                	mul    %ecx
+801071c0:	c1 ea 04             	shr    $0x4,%edx
+801071c3:	6b c2 3d             	imul   $0x3d,%edx,%eax
+801071c6:	29 c1                	sub    %eax,%ecx
+801071c8:	89 ca                	mov    %ecx,%edx
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+801071ca:	81 fe e0 80 15 80    	cmp    $0x801580e0,%esi
+801071d0:	74 6e                	je     80107240 <sleep+0xc0>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+801071d2:	83 ec 0c             	sub    $0xc,%esp
+801071d5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801071d8:	68 e0 80 15 80       	push   $0x801580e0
+801071dd:	e8 8e 09 00 00       	call   80107b70 <acquire>
+    release(lk);
+801071e2:	89 34 24             	mov    %esi,(%esp)
+801071e5:	e8 26 09 00 00       	call   80107b10 <release>
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+801071ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  p->chan = chan;
+801071ed:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+801071f0:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+801071f7:	81 c2 a8 00 00 00    	add    $0xa8,%edx
+801071fd:	8b 04 95 e8 80 15 80 	mov    -0x7fea7f18(,%edx,4),%eax
+80107204:	89 43 24             	mov    %eax,0x24(%ebx)
+  ptable.sleepq[SLEEPQ(chan)] = p;
+80107207:	89 1c 95 e8 80 15 80 	mov    %ebx,-0x7fea7f18(,%edx,4)
+  sched();
+8010720e:	e8 dd fb ff ff       	call   80106df0 <sched>
+  p->chan = 0;
+80107213:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    release(&ptable.lock);
+8010721a:	c7 04 24 e0 80 15 80 	movl   $0x801580e0,(%esp)
+80107221:	e8 ea 08 00 00       	call   80107b10 <release>
+    acquire(lk);
+80107226:	89 75 08             	mov    %esi,0x8(%ebp)
+80107229:	83 c4 10             	add    $0x10,%esp
+}
+8010722c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010722f:	5b                   	pop    %ebx
+80107230:	5e                   	pop    %esi
+80107231:	5f                   	pop    %edi
+80107232:	5d                   	pop    %ebp
+    acquire(lk);
+80107233:	e9 38 09 00 00       	jmp    80107b70 <acquire>
+80107238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010723f:	90                   	nop
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80107240:	81 c2 a8 00 00 00    	add    $0xa8,%edx
+  p->chan = chan;
+80107246:	89 7b 20             	mov    %edi,0x20(%ebx)
+  p->state = SLEEPING;
+80107249:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+80107250:	8b 04 95 e8 80 15 80 	mov    -0x7fea7f18(,%edx,4),%eax
+80107257:	89 43 24             	mov    %eax,0x24(%ebx)
+  ptable.sleepq[SLEEPQ(chan)] = p;
+8010725a:	89 1c 95 e8 80 15 80 	mov    %ebx,-0x7fea7f18(,%edx,4)
+  sched();
+80107261:	e8 8a fb ff ff       	call   80106df0 <sched>
+  p->chan = 0;
+80107266:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+}
+8010726d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107270:	5b                   	pop    %ebx
+80107271:	5e                   	pop    %esi
+80107272:	5f                   	pop    %edi
+80107273:	5d                   	pop    %ebp
+80107274:	c3                   	ret
+    panic("sleep without lk");
+80107275:	83 ec 0c             	sub    $0xc,%esp
+80107278:	68 06 b4 10 80       	push   $0x8010b406
+8010727d:	e8 ae 94 ff ff       	call   80100730 <panic>
+    panic("sleep");
+80107282:	83 ec 0c             	sub    $0xc,%esp
+80107285:	68 19 b4 10 80       	push   $0x8010b419
+8010728a:	e8 a1 94 ff ff       	call   80100730 <panic>
+8010728f:	90                   	nop
+
+80107290 <wakeup>:
+}
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+80107290:	55                   	push   %ebp
+80107291:	89 e5                	mov    %esp,%ebp
+80107293:	53                   	push   %ebx
+80107294:	83 ec 10             	sub    $0x10,%esp
+80107297:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+8010729a:	68 e0 80 15 80       	push   $0x801580e0
+8010729f:	e8 cc 08 00 00       	call   80107b70 <acquire>
+  wakeup1(chan);
+801072a4:	89 d8                	mov    %ebx,%eax
+801072a6:	e8 95 f3 ff ff       	call   80106640 <wakeup1>
+  release(&ptable.lock);
+801072ab:	c7 45 08 e0 80 15 80 	movl   $0x801580e0,0x8(%ebp)
+}
+801072b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&ptable.lock);
+801072b5:	83 c4 10             	add    $0x10,%esp
+}
+801072b8:	c9                   	leave
+  release(&ptable.lock);
+801072b9:	e9 52 08 00 00       	jmp    80107b10 <release>
+801072be:	66 90                	xchg   %ax,%ax
+
+801072c0 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+801072c0:	55                   	push   %ebp
+801072c1:	89 e5                	mov    %esp,%ebp
+801072c3:	53                   	push   %ebx
+801072c4:	83 ec 10             	sub    $0x10,%esp
+801072c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+801072ca:	68 e0 80 15 80       	push   $0x801580e0
+801072cf:	e8 9c 08 00 00       	call   80107b70 <acquire>
+  for(p = ptable.proc; p; p = p->next){
+801072d4:	8b 0d 84 83 15 80    	mov    0x80158384,%ecx
+801072da:	83 c4 10             	add    $0x10,%esp
+801072dd:	85 c9                	test   %ecx,%ecx
+801072df:	75 11                	jne    801072f2 <kill+0x32>
+801072e1:	eb 3d                	jmp    80107320 <kill+0x60>
+801072e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801072e7:	90                   	nop
+801072e8:	8b 89 80 00 00 00    	mov    0x80(%ecx),%ecx
+801072ee:	85 c9                	test   %ecx,%ecx
+801072f0:	74 2e                	je     80107320 <kill+0x60>
+    if(p->pid == pid){
+801072f2:	39 59 10             	cmp    %ebx,0x10(%ecx)
+801072f5:	75 f1                	jne    801072e8 <kill+0x28>
+      p->killed = 1;
+      // Wake process from sleep if necessary.
+      if(p->state == SLEEPING){
+801072f7:	83 79 0c 02          	cmpl   $0x2,0xc(%ecx)
+      p->killed = 1;
+801072fb:	c7 41 28 01 00 00 00 	movl   $0x1,0x28(%ecx)
+      if(p->state == SLEEPING){
+80107302:	74 3c                	je     80107340 <kill+0x80>
+        unsleep(p);
+        p->state = RUNNABLE;
+      }
+      release(&ptable.lock);
+80107304:	83 ec 0c             	sub    $0xc,%esp
+80107307:	68 e0 80 15 80       	push   $0x801580e0
+8010730c:	e8 ff 07 00 00       	call   80107b10 <release>
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80107311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+80107314:	83 c4 10             	add    $0x10,%esp
+80107317:	31 c0                	xor    %eax,%eax
+}
+80107319:	c9                   	leave
+8010731a:	c3                   	ret
+8010731b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010731f:	90                   	nop
+  release(&ptable.lock);
+80107320:	83 ec 0c             	sub    $0xc,%esp
+80107323:	68 e0 80 15 80       	push   $0x801580e0
+80107328:	e8 e3 07 00 00       	call   80107b10 <release>
+}
+8010732d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80107330:	83 c4 10             	add    $0x10,%esp
+80107333:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107338:	c9                   	leave
+80107339:	c3                   	ret
+8010733a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(pp = &ptable.sleepq[SLEEPQ(p->chan)]; *pp; pp = &(*pp)->snext){
+80107340:	8b 59 20             	mov    0x20(%ecx),%ebx
+80107343:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80107348:	c1 eb 02             	shr    $0x2,%ebx
+8010734b:	f7 e3                	mul    %ebx
+8010734d:	c1 ea 04             	shr    $0x4,%edx
+80107350:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80107353:	89 da                	mov    %ebx,%edx
+80107355:	29 c2                	sub    %eax,%edx
+80107357:	8b 04 95 88 83 15 80 	mov    -0x7fea7c78(,%edx,4),%eax
+8010735e:	85 c0                	test   %eax,%eax
+80107360:	74 38                	je     8010739a <kill+0xda>
+    if(*pp == p){
+80107362:	39 c8                	cmp    %ecx,%eax
+80107364:	74 2b                	je     80107391 <kill+0xd1>
+80107366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010736d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(pp = &ptable.sleepq[SLEEPQ(p->chan)]; *pp; pp = &(*pp)->snext){
+80107370:	89 c2                	mov    %eax,%edx
+80107372:	8b 40 24             	mov    0x24(%eax),%eax
+80107375:	85 c0                	test   %eax,%eax
+80107377:	74 21                	je     8010739a <kill+0xda>
+    if(*pp == p){
+80107379:	39 c8                	cmp    %ecx,%eax
+8010737b:	75 f3                	jne    80107370 <kill+0xb0>
+  for(pp = &ptable.sleepq[SLEEPQ(p->chan)]; *pp; pp = &(*pp)->snext){
+8010737d:	83 c2 24             	add    $0x24,%edx
+      *pp = p->snext;
+80107380:	8b 41 24             	mov    0x24(%ecx),%eax
+80107383:	89 02                	mov    %eax,(%edx)
+        p->state = RUNNABLE;
+80107385:	c7 41 0c 03 00 00 00 	movl   $0x3,0xc(%ecx)
+8010738c:	e9 73 ff ff ff       	jmp    80107304 <kill+0x44>
+  for(pp = &ptable.sleepq[SLEEPQ(p->chan)]; *pp; pp = &(*pp)->snext){
+80107391:	8d 14 95 88 83 15 80 	lea    -0x7fea7c78(,%edx,4),%edx
+80107398:	eb e6                	jmp    80107380 <kill+0xc0>
+  panic("unsleep");
+8010739a:	83 ec 0c             	sub    $0xc,%esp
+8010739d:	68 17 b4 10 80       	push   $0x8010b417
+801073a2:	e8 89 93 ff ff       	call   80100730 <panic>
+801073a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073ae:	66 90                	xchg   %ax,%ax
+
+801073b0 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+801073b0:	55                   	push   %ebp
+801073b1:	89 e5                	mov    %esp,%ebp
+801073b3:	57                   	push   %edi
+801073b4:	56                   	push   %esi
+801073b5:	53                   	push   %ebx
+  int i, n;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  n = 0;
+801073b6:	31 db                	xor    %ebx,%ebx
+{
+801073b8:	83 ec 3c             	sub    $0x3c,%esp
+  for(p = ptable.proc; p; p = p->next){
+801073bb:	8b 35 84 83 15 80    	mov    0x80158384,%esi
+801073c1:	85 f6                	test   %esi,%esi
+801073c3:	74 59                	je     8010741e <procdump+0x6e>
+801073c5:	8d 76 00             	lea    0x0(%esi),%esi
+    n++;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801073c8:	8b 4e 0c             	mov    0xc(%esi),%ecx
+    n++;
+801073cb:	83 c3 01             	add    $0x1,%ebx
+      state = states[p->state];
+    else
+      state = "???";
+801073ce:	ba 1f b4 10 80       	mov    $0x8010b41f,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801073d3:	83 f9 05             	cmp    $0x5,%ecx
+801073d6:	77 11                	ja     801073e9 <procdump+0x39>
+801073d8:	8b 14 8d bc b4 10 80 	mov    -0x7fef4b44(,%ecx,4),%edx
+      state = "???";
+801073df:	b8 1f b4 10 80       	mov    $0x8010b41f,%eax
+801073e4:	85 d2                	test   %edx,%edx
+801073e6:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+801073e9:	8d 4e 70             	lea    0x70(%esi),%ecx
+801073ec:	51                   	push   %ecx
+801073ed:	52                   	push   %edx
+801073ee:	ff 76 10             	push   0x10(%esi)
+801073f1:	68 23 b4 10 80       	push   $0x8010b423
+801073f6:	e8 65 96 ff ff       	call   80100a60 <cprintf>
+    if(p->state == SLEEPING){
+801073fb:	83 c4 10             	add    $0x10,%esp
+801073fe:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+80107402:	74 44                	je     80107448 <procdump+0x98>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80107404:	83 ec 0c             	sub    $0xc,%esp
+80107407:	68 57 b8 10 80       	push   $0x8010b857
+8010740c:	e8 4f 96 ff ff       	call   80100a60 <cprintf>
+  for(p = ptable.proc; p; p = p->next){
+80107411:	8b b6 80 00 00 00    	mov    0x80(%esi),%esi
+80107417:	83 c4 10             	add    $0x10,%esp
+8010741a:	85 f6                	test   %esi,%esi
+8010741c:	75 aa                	jne    801073c8 <procdump+0x18>
+  }
+  cprintf("wakeup: %d calls, %d sleepers scanned (%d by ptable scan)\n",
+          ptable.nwakeup, ptable.nscan, ptable.nwakeup * n);
+8010741e:	a1 7c 84 15 80       	mov    0x8015847c,%eax
+  cprintf("wakeup: %d calls, %d sleepers scanned (%d by ptable scan)\n",
+80107423:	0f af d8             	imul   %eax,%ebx
+80107426:	53                   	push   %ebx
+80107427:	ff 35 80 84 15 80    	push   0x80158480
+8010742d:	50                   	push   %eax
+8010742e:	68 80 b4 10 80       	push   $0x8010b480
+80107433:	e8 28 96 ff ff       	call   80100a60 <cprintf>
+}
+80107438:	83 c4 10             	add    $0x10,%esp
+8010743b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010743e:	5b                   	pop    %ebx
+8010743f:	5e                   	pop    %esi
+80107440:	5f                   	pop    %edi
+80107441:	5d                   	pop    %ebp
+80107442:	c3                   	ret
+80107443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107447:	90                   	nop
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80107448:	83 ec 08             	sub    $0x8,%esp
+8010744b:	8d 7d c0             	lea    -0x40(%ebp),%edi
+8010744e:	57                   	push   %edi
+8010744f:	8b 56 1c             	mov    0x1c(%esi),%edx
+80107452:	8b 52 0c             	mov    0xc(%edx),%edx
+80107455:	83 c2 08             	add    $0x8,%edx
+80107458:	52                   	push   %edx
+80107459:	e8 52 05 00 00       	call   801079b0 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010745e:	83 c4 10             	add    $0x10,%esp
+80107461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107468:	8b 0f                	mov    (%edi),%ecx
+8010746a:	85 c9                	test   %ecx,%ecx
+8010746c:	74 96                	je     80107404 <procdump+0x54>
+        cprintf(" %p", pc[i]);
+8010746e:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107471:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+80107474:	51                   	push   %ecx
+80107475:	68 b9 ad 10 80       	push   $0x8010adb9
+8010747a:	e8 e1 95 ff ff       	call   80100a60 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010747f:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80107482:	83 c4 10             	add    $0x10,%esp
+80107485:	39 c7                	cmp    %eax,%edi
+80107487:	75 df                	jne    80107468 <procdump+0xb8>
+80107489:	e9 76 ff ff ff       	jmp    80107404 <procdump+0x54>
+8010748e:	66 90                	xchg   %ax,%ax
+
+80107490 <slabinit>:
+  uint nfree;
+};
+
+void
+slabinit(struct slabcache *c, char *name, uint size, void (*ctor)(void*))
+{
+80107490:	55                   	push   %ebp
+80107491:	89 e5                	mov    %esp,%ebp
+80107493:	56                   	push   %esi
+80107494:	53                   	push   %ebx
+80107495:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107498:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&c->lock, name);
+8010749b:	83 ec 08             	sub    $0x8,%esp
+8010749e:	56                   	push   %esi
+8010749f:	53                   	push   %ebx
+801074a0:	e8 eb 04 00 00       	call   80107990 <initlock>
+  c->name = name;
+  c->size = (size + 3) & ~3;
+801074a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  c->perslab = (PGSIZE - sizeof(struct slab)) /
+801074a8:	31 d2                	xor    %edx,%edx
+  c->name = name;
+801074aa:	89 73 34             	mov    %esi,0x34(%ebx)
+               (c->size + sizeof(struct object));
+  if(c->perslab == 0)
+801074ad:	83 c4 10             	add    $0x10,%esp
+  c->size = (size + 3) & ~3;
+801074b0:	8d 48 03             	lea    0x3(%eax),%ecx
+  c->perslab = (PGSIZE - sizeof(struct slab)) /
+801074b3:	b8 ec 0f 00 00       	mov    $0xfec,%eax
+  c->size = (size + 3) & ~3;
+801074b8:	83 e1 fc             	and    $0xfffffffc,%ecx
+801074bb:	89 4b 38             	mov    %ecx,0x38(%ebx)
+               (c->size + sizeof(struct object));
+801074be:	83 c1 04             	add    $0x4,%ecx
+  c->perslab = (PGSIZE - sizeof(struct slab)) /
+801074c1:	f7 f1                	div    %ecx
+801074c3:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  if(c->perslab == 0)
+801074c6:	81 f9 ec 0f 00 00    	cmp    $0xfec,%ecx
+801074cc:	77 22                	ja     801074f0 <slabinit+0x60>
+    panic("slabinit: object too big");
+  c->ctor = ctor;
+801074ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  c->partial = 0;
+801074d1:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+  c->nslab = 0;
+801074d8:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+  c->ctor = ctor;
+801074df:	89 43 40             	mov    %eax,0x40(%ebx)
+  c->nempty = 0;
+801074e2:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+}
+801074e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801074ec:	5b                   	pop    %ebx
+801074ed:	5e                   	pop    %esi
+801074ee:	5d                   	pop    %ebp
+801074ef:	c3                   	ret
+    panic("slabinit: object too big");
+801074f0:	83 ec 0c             	sub    $0xc,%esp
+801074f3:	68 d4 b4 10 80       	push   $0x8010b4d4
+801074f8:	e8 33 92 ff ff       	call   80100730 <panic>
+801074fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107500 <slaballoc>:
+
+// Allocate an object from c.
+// Returns 0 if there is no memory left.
+void*
+slaballoc(struct slabcache *c)
+{
+80107500:	55                   	push   %ebp
+80107501:	89 e5                	mov    %esp,%ebp
+80107503:	57                   	push   %edi
+80107504:	56                   	push   %esi
+80107505:	53                   	push   %ebx
+80107506:	83 ec 1c             	sub    $0x1c,%esp
+80107509:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct magazine *m;
+  void *v;
+
+  pushcli();
+8010750c:	e8 0f 05 00 00       	call   80107a20 <pushcli>
+  m = &c->mag[cpuid()];
+80107511:	e8 ea f3 ff ff       	call   80106900 <cpuid>
+80107516:	89 c2                	mov    %eax,%edx
+  if(m->n == 0){
+80107518:	6b c0 44             	imul   $0x44,%eax,%eax
+8010751b:	01 d8                	add    %ebx,%eax
+8010751d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107520:	8b 40 50             	mov    0x50(%eax),%eax
+80107523:	85 c0                	test   %eax,%eax
+80107525:	74 49                	je     80107570 <slaballoc+0x70>
+    while(m->n < NMAG/2 && (v = slabget(c)) != 0)
+      m->obj[m->n++] = v;
+    release(&c->lock);
+  }
+  v = 0;
+  if(m->n > 0)
+80107527:	85 c0                	test   %eax,%eax
+80107529:	0f 8e 92 01 00 00    	jle    801076c1 <slaballoc+0x1c1>
+    v = m->obj[--m->n];
+8010752f:	6b ca 44             	imul   $0x44,%edx,%ecx
+80107532:	83 e8 01             	sub    $0x1,%eax
+80107535:	89 44 0b 50          	mov    %eax,0x50(%ebx,%ecx,1)
+80107539:	89 d1                	mov    %edx,%ecx
+8010753b:	c1 e1 04             	shl    $0x4,%ecx
+8010753e:	01 ca                	add    %ecx,%edx
+80107540:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+80107544:	8b 74 83 04          	mov    0x4(%ebx,%eax,4),%esi
+  popcli();
+80107548:	e8 23 05 00 00       	call   80107a70 <popcli>
+
+  if(v && c->ctor == 0)
+8010754d:	85 f6                	test   %esi,%esi
+8010754f:	0f 84 71 01 00 00    	je     801076c6 <slaballoc+0x1c6>
+80107555:	8b 43 40             	mov    0x40(%ebx),%eax
+80107558:	85 c0                	test   %eax,%eax
+8010755a:	0f 84 78 01 00 00    	je     801076d8 <slaballoc+0x1d8>
+    memset(v, 0, c->size);
+  return v;
+}
+80107560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107563:	89 f0                	mov    %esi,%eax
+80107565:	5b                   	pop    %ebx
+80107566:	5e                   	pop    %esi
+80107567:	5f                   	pop    %edi
+80107568:	5d                   	pop    %ebp
+80107569:	c3                   	ret
+8010756a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquire(&c->lock);
+80107570:	83 ec 0c             	sub    $0xc,%esp
+80107573:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107576:	53                   	push   %ebx
+80107577:	e8 f4 05 00 00       	call   80107b70 <acquire>
+    while(m->n < NMAG/2 && (v = slabget(c)) != 0)
+8010757c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010757f:	83 c4 10             	add    $0x10,%esp
+80107582:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107585:	83 78 50 07          	cmpl   $0x7,0x50(%eax)
+80107589:	7e 69                	jle    801075f4 <slaballoc+0xf4>
+8010758b:	e9 10 01 00 00       	jmp    801076a0 <slaballoc+0x1a0>
+  if(s->nfree == c->perslab)
+80107590:	8b 4e 10             	mov    0x10(%esi),%ecx
+80107593:	3b 4b 3c             	cmp    0x3c(%ebx),%ecx
+80107596:	75 07                	jne    8010759f <slaballoc+0x9f>
+    c->nempty--;
+80107598:	83 6b 4c 01          	subl   $0x1,0x4c(%ebx)
+  if(--s->nfree == 0)
+8010759c:	8b 4e 10             	mov    0x10(%esi),%ecx
+  o = s->free;
+8010759f:	8b 46 0c             	mov    0xc(%esi),%eax
+  if(--s->nfree == 0)
+801075a2:	83 e9 01             	sub    $0x1,%ecx
+  s->free = o->next;
+801075a5:	8b 38                	mov    (%eax),%edi
+  if(--s->nfree == 0)
+801075a7:	89 4e 10             	mov    %ecx,0x10(%esi)
+  s->free = o->next;
+801075aa:	89 7e 0c             	mov    %edi,0xc(%esi)
+  if(--s->nfree == 0)
+801075ad:	75 1e                	jne    801075cd <slaballoc+0xcd>
+  if(s->prev)
+801075af:	8b 4e 08             	mov    0x8(%esi),%ecx
+    s->prev->next = s->next;
+801075b2:	8b 7e 04             	mov    0x4(%esi),%edi
+  if(s->prev)
+801075b5:	85 c9                	test   %ecx,%ecx
+801075b7:	0f 84 d3 00 00 00    	je     80107690 <slaballoc+0x190>
+    s->prev->next = s->next;
+801075bd:	89 79 04             	mov    %edi,0x4(%ecx)
+  if(s->next)
+801075c0:	8b 4e 04             	mov    0x4(%esi),%ecx
+801075c3:	85 c9                	test   %ecx,%ecx
+801075c5:	74 06                	je     801075cd <slaballoc+0xcd>
+    s->next->prev = s->prev;
+801075c7:	8b 76 08             	mov    0x8(%esi),%esi
+801075ca:	89 71 08             	mov    %esi,0x8(%ecx)
+      m->obj[m->n++] = v;
+801075cd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  return OBJ(c, o);
+801075d0:	2b 43 38             	sub    0x38(%ebx),%eax
+      m->obj[m->n++] = v;
+801075d3:	8b 79 50             	mov    0x50(%ecx),%edi
+801075d6:	8d 77 01             	lea    0x1(%edi),%esi
+801075d9:	89 71 50             	mov    %esi,0x50(%ecx)
+801075dc:	89 d1                	mov    %edx,%ecx
+801075de:	c1 e1 04             	shl    $0x4,%ecx
+801075e1:	01 d1                	add    %edx,%ecx
+801075e3:	8d 4c 0f 14          	lea    0x14(%edi,%ecx,1),%ecx
+801075e7:	89 44 8b 04          	mov    %eax,0x4(%ebx,%ecx,4)
+    while(m->n < NMAG/2 && (v = slabget(c)) != 0)
+801075eb:	83 fe 07             	cmp    $0x7,%esi
+801075ee:	0f 8f ac 00 00 00    	jg     801076a0 <slaballoc+0x1a0>
+  if((s = c->partial) == 0 && (s = slabgrow(c)) == 0)
+801075f4:	8b 73 44             	mov    0x44(%ebx),%esi
+801075f7:	85 f6                	test   %esi,%esi
+801075f9:	75 95                	jne    80107590 <slaballoc+0x90>
+801075fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if((s = (struct slab*)kalloc()) == 0)
+801075fe:	e8 bd d4 ff ff       	call   80104ac0 <kalloc>
+80107603:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107606:	85 c0                	test   %eax,%eax
+80107608:	89 c6                	mov    %eax,%esi
+8010760a:	0f 84 90 00 00 00    	je     801076a0 <slaballoc+0x1a0>
+  s->cache = c;
+80107610:	89 18                	mov    %ebx,(%eax)
+  p = (char*)(s + 1);
+80107612:	8d 78 14             	lea    0x14(%eax),%edi
+  s->free = 0;
+80107615:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  for(i = 0; i < c->perslab; i++, p += c->size + sizeof(struct object)){
+8010761c:	8b 4b 3c             	mov    0x3c(%ebx),%ecx
+8010761f:	85 c9                	test   %ecx,%ecx
+80107621:	74 46                	je     80107669 <slaballoc+0x169>
+80107623:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80107626:	31 c0                	xor    %eax,%eax
+80107628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010762f:	90                   	nop
+    if(c->ctor)
+80107630:	8b 53 40             	mov    0x40(%ebx),%edx
+80107633:	85 d2                	test   %edx,%edx
+80107635:	74 0f                	je     80107646 <slaballoc+0x146>
+      c->ctor(p);
+80107637:	83 ec 0c             	sub    $0xc,%esp
+8010763a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010763d:	57                   	push   %edi
+8010763e:	ff d2                	call   *%edx
+80107640:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107643:	83 c4 10             	add    $0x10,%esp
+    o = LINK(c, p);
+80107646:	8b 53 38             	mov    0x38(%ebx),%edx
+    o->next = s->free;
+80107649:	8b 4e 0c             	mov    0xc(%esi),%ecx
+  for(i = 0; i < c->perslab; i++, p += c->size + sizeof(struct object)){
+8010764c:	83 c0 01             	add    $0x1,%eax
+    o = LINK(c, p);
+8010764f:	01 fa                	add    %edi,%edx
+    o->next = s->free;
+80107651:	89 0a                	mov    %ecx,(%edx)
+    s->free = o;
+80107653:	89 56 0c             	mov    %edx,0xc(%esi)
+  for(i = 0; i < c->perslab; i++, p += c->size + sizeof(struct object)){
+80107656:	8b 53 38             	mov    0x38(%ebx),%edx
+80107659:	8d 7c 17 04          	lea    0x4(%edi,%edx,1),%edi
+8010765d:	8b 53 3c             	mov    0x3c(%ebx),%edx
+80107660:	39 d0                	cmp    %edx,%eax
+80107662:	72 cc                	jb     80107630 <slaballoc+0x130>
+80107664:	89 d1                	mov    %edx,%ecx
+80107666:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  s->nfree = c->perslab;
+80107669:	89 4e 10             	mov    %ecx,0x10(%esi)
+  s->prev = 0;
+8010766c:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  s->next = c->partial;
+80107673:	8b 43 44             	mov    0x44(%ebx),%eax
+80107676:	89 46 04             	mov    %eax,0x4(%esi)
+  if(c->partial)
+80107679:	85 c0                	test   %eax,%eax
+8010767b:	74 03                	je     80107680 <slaballoc+0x180>
+    c->partial->prev = s;
+8010767d:	89 70 08             	mov    %esi,0x8(%eax)
+  c->nslab++;
+80107680:	83 43 48 01          	addl   $0x1,0x48(%ebx)
+  c->nempty++;
+80107684:	83 43 4c 01          	addl   $0x1,0x4c(%ebx)
+  c->partial = s;
+80107688:	89 73 44             	mov    %esi,0x44(%ebx)
+  return s;
+8010768b:	e9 00 ff ff ff       	jmp    80107590 <slaballoc+0x90>
+    c->partial = s->next;
+80107690:	89 7b 44             	mov    %edi,0x44(%ebx)
+80107693:	e9 28 ff ff ff       	jmp    801075c0 <slaballoc+0xc0>
+80107698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010769f:	90                   	nop
+    release(&c->lock);
+801076a0:	83 ec 0c             	sub    $0xc,%esp
+801076a3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801076a6:	53                   	push   %ebx
+801076a7:	e8 64 04 00 00       	call   80107b10 <release>
+  if(m->n > 0)
+801076ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801076af:	83 c4 10             	add    $0x10,%esp
+801076b2:	6b c2 44             	imul   $0x44,%edx,%eax
+801076b5:	8b 44 03 50          	mov    0x50(%ebx,%eax,1),%eax
+801076b9:	85 c0                	test   %eax,%eax
+801076bb:	0f 8f 6e fe ff ff    	jg     8010752f <slaballoc+0x2f>
+  popcli();
+801076c1:	e8 aa 03 00 00       	call   80107a70 <popcli>
+}
+801076c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    v = m->obj[--m->n];
+801076c9:	31 f6                	xor    %esi,%esi
+}
+801076cb:	5b                   	pop    %ebx
+801076cc:	89 f0                	mov    %esi,%eax
+801076ce:	5e                   	pop    %esi
+801076cf:	5f                   	pop    %edi
+801076d0:	5d                   	pop    %ebp
+801076d1:	c3                   	ret
+801076d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memset(v, 0, c->size);
+801076d8:	83 ec 04             	sub    $0x4,%esp
+801076db:	ff 73 38             	push   0x38(%ebx)
+801076de:	6a 00                	push   $0x0
+801076e0:	56                   	push   %esi
+801076e1:	e8 6a 05 00 00       	call   80107c50 <memset>
+801076e6:	83 c4 10             	add    $0x10,%esp
+}
+801076e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801076ec:	89 f0                	mov    %esi,%eax
+801076ee:	5b                   	pop    %ebx
+801076ef:	5e                   	pop    %esi
+801076f0:	5f                   	pop    %edi
+801076f1:	5d                   	pop    %ebp
+801076f2:	c3                   	ret
+801076f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801076fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107700 <slabfree>:
+
+// Return object v to c.
+void
+slabfree(struct slabcache *c, void *v)
+{
+80107700:	55                   	push   %ebp
+80107701:	89 e5                	mov    %esp,%ebp
+80107703:	57                   	push   %edi
+80107704:	56                   	push   %esi
+80107705:	53                   	push   %ebx
+80107706:	83 ec 1c             	sub    $0x1c,%esp
+80107709:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010770c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010770f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct magazine *m;
+
+  if(((struct slab*)PGROUNDDOWN((uint)v))->cache != c)
+80107712:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80107717:	39 18                	cmp    %ebx,(%eax)
+80107719:	0f 85 26 01 00 00    	jne    80107845 <slabfree+0x145>
+    panic("slabfree");
+
+  pushcli();
+8010771f:	e8 fc 02 00 00       	call   80107a20 <pushcli>
+  m = &c->mag[cpuid()];
+80107724:	e8 d7 f1 ff ff       	call   80106900 <cpuid>
+  if(m->n == NMAG){
+80107729:	6b f8 44             	imul   $0x44,%eax,%edi
+  m = &c->mag[cpuid()];
+8010772c:	89 c6                	mov    %eax,%esi
+  if(m->n == NMAG){
+8010772e:	01 df                	add    %ebx,%edi
+80107730:	8b 47 50             	mov    0x50(%edi),%eax
+80107733:	83 f8 10             	cmp    $0x10,%eax
+80107736:	74 28                	je     80107760 <slabfree+0x60>
+    acquire(&c->lock);
+    while(m->n > NMAG/2)
+      slabput(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = v;
+80107738:	6b d6 44             	imul   $0x44,%esi,%edx
+8010773b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010773e:	89 4c 13 50          	mov    %ecx,0x50(%ebx,%edx,1)
+80107742:	89 f2                	mov    %esi,%edx
+80107744:	c1 e2 04             	shl    $0x4,%edx
+80107747:	01 f2                	add    %esi,%edx
+80107749:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010774c:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+80107750:	89 74 83 04          	mov    %esi,0x4(%ebx,%eax,4)
+  popcli();
+}
+80107754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107757:	5b                   	pop    %ebx
+80107758:	5e                   	pop    %esi
+80107759:	5f                   	pop    %edi
+8010775a:	5d                   	pop    %ebp
+  popcli();
+8010775b:	e9 10 03 00 00       	jmp    80107a70 <popcli>
+    acquire(&c->lock);
+80107760:	83 ec 0c             	sub    $0xc,%esp
+80107763:	53                   	push   %ebx
+80107764:	e8 07 04 00 00       	call   80107b70 <acquire>
+      slabput(c, m->obj[--m->n]);
+80107769:	89 f0                	mov    %esi,%eax
+    while(m->n > NMAG/2)
+8010776b:	83 c4 10             	add    $0x10,%esp
+      slabput(c, m->obj[--m->n]);
+8010776e:	c1 e0 04             	shl    $0x4,%eax
+80107771:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    while(m->n > NMAG/2)
+80107778:	8b 47 50             	mov    0x50(%edi),%eax
+8010777b:	83 f8 08             	cmp    $0x8,%eax
+8010777e:	0f 8e 94 00 00 00    	jle    80107818 <slabfree+0x118>
+      slabput(c, m->obj[--m->n]);
+80107784:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80107787:	83 e8 01             	sub    $0x1,%eax
+8010778a:	89 47 50             	mov    %eax,0x50(%edi)
+8010778d:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+80107790:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+80107794:	8b 54 83 04          	mov    0x4(%ebx,%eax,4),%edx
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+80107798:	89 d0                	mov    %edx,%eax
+  o = LINK(c, v);
+8010779a:	03 53 38             	add    0x38(%ebx),%edx
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+8010779d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  o->next = s->free;
+801077a2:	8b 48 0c             	mov    0xc(%eax),%ecx
+801077a5:	89 0a                	mov    %ecx,(%edx)
+  if(s->nfree++ == 0)
+801077a7:	8b 48 10             	mov    0x10(%eax),%ecx
+  s->free = o;
+801077aa:	89 50 0c             	mov    %edx,0xc(%eax)
+  if(s->nfree++ == 0)
+801077ad:	8d 51 01             	lea    0x1(%ecx),%edx
+801077b0:	89 50 10             	mov    %edx,0x10(%eax)
+801077b3:	85 c9                	test   %ecx,%ecx
+801077b5:	75 1a                	jne    801077d1 <slabfree+0xd1>
+  s->prev = 0;
+801077b7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  s->next = c->partial;
+801077be:	8b 53 44             	mov    0x44(%ebx),%edx
+801077c1:	89 50 04             	mov    %edx,0x4(%eax)
+  if(c->partial)
+801077c4:	85 d2                	test   %edx,%edx
+801077c6:	74 03                	je     801077cb <slabfree+0xcb>
+    c->partial->prev = s;
+801077c8:	89 42 08             	mov    %eax,0x8(%edx)
+  c->partial = s;
+801077cb:	89 43 44             	mov    %eax,0x44(%ebx)
+  if(s->nfree == c->perslab){
+801077ce:	8b 50 10             	mov    0x10(%eax),%edx
+801077d1:	39 53 3c             	cmp    %edx,0x3c(%ebx)
+801077d4:	75 a2                	jne    80107778 <slabfree+0x78>
+    if(c->nempty > 0){
+801077d6:	8b 53 4c             	mov    0x4c(%ebx),%edx
+801077d9:	85 d2                	test   %edx,%edx
+801077db:	74 53                	je     80107830 <slabfree+0x130>
+  if(s->prev)
+801077dd:	8b 50 08             	mov    0x8(%eax),%edx
+    s->prev->next = s->next;
+801077e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  if(s->prev)
+801077e3:	85 d2                	test   %edx,%edx
+801077e5:	74 59                	je     80107840 <slabfree+0x140>
+    s->prev->next = s->next;
+801077e7:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(s->next)
+801077ea:	8b 50 04             	mov    0x4(%eax),%edx
+801077ed:	85 d2                	test   %edx,%edx
+801077ef:	74 06                	je     801077f7 <slabfree+0xf7>
+    s->next->prev = s->prev;
+801077f1:	8b 48 08             	mov    0x8(%eax),%ecx
+801077f4:	89 4a 08             	mov    %ecx,0x8(%edx)
+      kfree((char*)s);
+801077f7:	83 ec 0c             	sub    $0xc,%esp
+      c->nslab--;
+801077fa:	83 6b 48 01          	subl   $0x1,0x48(%ebx)
+      kfree((char*)s);
+801077fe:	50                   	push   %eax
+801077ff:	e8 ac cf ff ff       	call   801047b0 <kfree>
+    while(m->n > NMAG/2)
+80107804:	8b 47 50             	mov    0x50(%edi),%eax
+80107807:	83 c4 10             	add    $0x10,%esp
+8010780a:	83 f8 08             	cmp    $0x8,%eax
+8010780d:	0f 8f 71 ff ff ff    	jg     80107784 <slabfree+0x84>
+80107813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107817:	90                   	nop
+    release(&c->lock);
+80107818:	83 ec 0c             	sub    $0xc,%esp
+8010781b:	53                   	push   %ebx
+8010781c:	e8 ef 02 00 00       	call   80107b10 <release>
+  m->obj[m->n++] = v;
+80107821:	8b 47 50             	mov    0x50(%edi),%eax
+80107824:	83 c4 10             	add    $0x10,%esp
+80107827:	e9 0c ff ff ff       	jmp    80107738 <slabfree+0x38>
+8010782c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c->nempty++;
+80107830:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+80107837:	e9 3c ff ff ff       	jmp    80107778 <slabfree+0x78>
+8010783c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c->partial = s->next;
+80107840:	89 4b 44             	mov    %ecx,0x44(%ebx)
+80107843:	eb a5                	jmp    801077ea <slabfree+0xea>
+    panic("slabfree");
+80107845:	83 ec 0c             	sub    $0xc,%esp
+80107848:	68 ed b4 10 80       	push   $0x8010b4ed
+8010784d:	e8 de 8e ff ff       	call   80100730 <panic>
+80107852:	66 90                	xchg   %ax,%ax
+80107854:	66 90                	xchg   %ax,%ax
+80107856:	66 90                	xchg   %ax,%ax
+80107858:	66 90                	xchg   %ax,%ax
+8010785a:	66 90                	xchg   %ax,%ax
+8010785c:	66 90                	xchg   %ax,%ax
+8010785e:	66 90                	xchg   %ax,%ax
+
+80107860 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80107860:	55                   	push   %ebp
+80107861:	89 e5                	mov    %esp,%ebp
+80107863:	53                   	push   %ebx
+80107864:	83 ec 0c             	sub    $0xc,%esp
+80107867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+8010786a:	68 f6 b4 10 80       	push   $0x8010b4f6
+8010786f:	8d 43 04             	lea    0x4(%ebx),%eax
+80107872:	50                   	push   %eax
+80107873:	e8 18 01 00 00       	call   80107990 <initlock>
+  lk->name = name;
+80107878:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+8010787b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+80107881:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+80107884:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+8010788b:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+8010788e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107891:	c9                   	leave
+80107892:	c3                   	ret
+80107893:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010789a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801078a0 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801078a0:	55                   	push   %ebp
+801078a1:	89 e5                	mov    %esp,%ebp
+801078a3:	56                   	push   %esi
+801078a4:	53                   	push   %ebx
+801078a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801078a8:	8d 73 04             	lea    0x4(%ebx),%esi
+801078ab:	83 ec 0c             	sub    $0xc,%esp
+801078ae:	56                   	push   %esi
+801078af:	e8 bc 02 00 00       	call   80107b70 <acquire>
+  while (lk->locked) {
+801078b4:	8b 13                	mov    (%ebx),%edx
+801078b6:	83 c4 10             	add    $0x10,%esp
+801078b9:	85 d2                	test   %edx,%edx
+801078bb:	74 16                	je     801078d3 <acquiresleep+0x33>
+801078bd:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+801078c0:	83 ec 08             	sub    $0x8,%esp
+801078c3:	56                   	push   %esi
+801078c4:	53                   	push   %ebx
+801078c5:	e8 b6 f8 ff ff       	call   80107180 <sleep>
+  while (lk->locked) {
+801078ca:	8b 03                	mov    (%ebx),%eax
+801078cc:	83 c4 10             	add    $0x10,%esp
+801078cf:	85 c0                	test   %eax,%eax
+801078d1:	75 ed                	jne    801078c0 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+801078d3:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+801078d9:	e8 42 f0 ff ff       	call   80106920 <myproc>
+801078de:	8b 40 10             	mov    0x10(%eax),%eax
+801078e1:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+801078e4:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+801078e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801078ea:	5b                   	pop    %ebx
+801078eb:	5e                   	pop    %esi
+801078ec:	5d                   	pop    %ebp
+  release(&lk->lk);
+801078ed:	e9 1e 02 00 00       	jmp    80107b10 <release>
+801078f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801078f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107900 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107900:	55                   	push   %ebp
+80107901:	89 e5                	mov    %esp,%ebp
+80107903:	56                   	push   %esi
+80107904:	53                   	push   %ebx
+80107905:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107908:	8d 73 04             	lea    0x4(%ebx),%esi
+8010790b:	83 ec 0c             	sub    $0xc,%esp
+8010790e:	56                   	push   %esi
+8010790f:	e8 5c 02 00 00       	call   80107b70 <acquire>
+  lk->locked = 0;
+80107914:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+8010791a:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80107921:	89 1c 24             	mov    %ebx,(%esp)
+80107924:	e8 67 f9 ff ff       	call   80107290 <wakeup>
+  release(&lk->lk);
+80107929:	89 75 08             	mov    %esi,0x8(%ebp)
+8010792c:	83 c4 10             	add    $0x10,%esp
+}
+8010792f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107932:	5b                   	pop    %ebx
+80107933:	5e                   	pop    %esi
+80107934:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107935:	e9 d6 01 00 00       	jmp    80107b10 <release>
+8010793a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107940 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107940:	55                   	push   %ebp
+80107941:	89 e5                	mov    %esp,%ebp
+80107943:	57                   	push   %edi
+80107944:	31 ff                	xor    %edi,%edi
+80107946:	56                   	push   %esi
+80107947:	53                   	push   %ebx
+80107948:	83 ec 18             	sub    $0x18,%esp
+8010794b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+8010794e:	8d 73 04             	lea    0x4(%ebx),%esi
+80107951:	56                   	push   %esi
+80107952:	e8 19 02 00 00       	call   80107b70 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107957:	8b 03                	mov    (%ebx),%eax
+80107959:	83 c4 10             	add    $0x10,%esp
+8010795c:	85 c0                	test   %eax,%eax
+8010795e:	75 18                	jne    80107978 <holdingsleep+0x38>
+  release(&lk->lk);
+80107960:	83 ec 0c             	sub    $0xc,%esp
+80107963:	56                   	push   %esi
+80107964:	e8 a7 01 00 00       	call   80107b10 <release>
+  return r;
+}
+80107969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010796c:	89 f8                	mov    %edi,%eax
+8010796e:	5b                   	pop    %ebx
+8010796f:	5e                   	pop    %esi
+80107970:	5f                   	pop    %edi
+80107971:	5d                   	pop    %ebp
+80107972:	c3                   	ret
+80107973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107977:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107978:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+8010797b:	e8 a0 ef ff ff       	call   80106920 <myproc>
+80107980:	39 58 10             	cmp    %ebx,0x10(%eax)
+80107983:	0f 94 c0             	sete   %al
+80107986:	0f b6 c0             	movzbl %al,%eax
+80107989:	89 c7                	mov    %eax,%edi
+8010798b:	eb d3                	jmp    80107960 <holdingsleep+0x20>
+8010798d:	66 90                	xchg   %ax,%ax
+8010798f:	90                   	nop
+
+80107990 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107990:	55                   	push   %ebp
+80107991:	89 e5                	mov    %esp,%ebp
+80107993:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107996:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80107999:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+8010799f:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+801079a2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+801079a9:	5d                   	pop    %ebp
+801079aa:	c3                   	ret
+801079ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801079af:	90                   	nop
+
+801079b0 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+801079b0:	55                   	push   %ebp
+801079b1:	89 e5                	mov    %esp,%ebp
+801079b3:	53                   	push   %ebx
+801079b4:	8b 45 08             	mov    0x8(%ebp),%eax
+801079b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+801079ba:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801079bd:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+801079c2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+801079c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801079cc:	76 10                	jbe    801079de <getcallerpcs+0x2e>
+801079ce:	eb 28                	jmp    801079f8 <getcallerpcs+0x48>
+801079d0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801079d6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801079dc:	77 1a                	ja     801079f8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+801079de:	8b 5a 04             	mov    0x4(%edx),%ebx
+801079e1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+801079e4:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+801079e7:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801079e9:	83 f8 0a             	cmp    $0xa,%eax
+801079ec:	75 e2                	jne    801079d0 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+801079ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079f1:	c9                   	leave
+801079f2:	c3                   	ret
+801079f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801079f7:	90                   	nop
+801079f8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801079fb:	8d 51 28             	lea    0x28(%ecx),%edx
+801079fe:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107a00:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107a06:	83 c0 04             	add    $0x4,%eax
+80107a09:	39 d0                	cmp    %edx,%eax
+80107a0b:	75 f3                	jne    80107a00 <getcallerpcs+0x50>
+}
+80107a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a10:	c9                   	leave
+80107a11:	c3                   	ret
+80107a12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107a20 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80107a20:	55                   	push   %ebp
+80107a21:	89 e5                	mov    %esp,%ebp
+80107a23:	53                   	push   %ebx
+80107a24:	83 ec 04             	sub    $0x4,%esp
+80107a27:	9c                   	pushf
+80107a28:	5b                   	pop    %ebx
+  asm volatile("cli");
+80107a29:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80107a2a:	e8 71 ee ff ff       	call   801068a0 <mycpu>
+80107a2f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80107a35:	85 c0                	test   %eax,%eax
+80107a37:	74 17                	je     80107a50 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107a39:	e8 62 ee ff ff       	call   801068a0 <mycpu>
+80107a3e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80107a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a48:	c9                   	leave
+80107a49:	c3                   	ret
+80107a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80107a50:	e8 4b ee ff ff       	call   801068a0 <mycpu>
+80107a55:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107a5b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107a61:	eb d6                	jmp    80107a39 <pushcli+0x19>
+80107a63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107a70 <popcli>:
+
+void
+popcli(void)
+{
+80107a70:	55                   	push   %ebp
+80107a71:	89 e5                	mov    %esp,%ebp
+80107a73:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107a76:	9c                   	pushf
+80107a77:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107a78:	f6 c4 02             	test   $0x2,%ah
+80107a7b:	75 35                	jne    80107ab2 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107a7d:	e8 1e ee ff ff       	call   801068a0 <mycpu>
+80107a82:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80107a89:	78 34                	js     80107abf <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107a8b:	e8 10 ee ff ff       	call   801068a0 <mycpu>
+80107a90:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80107a96:	85 d2                	test   %edx,%edx
+80107a98:	74 06                	je     80107aa0 <popcli+0x30>
+    sti();
+}
+80107a9a:	c9                   	leave
+80107a9b:	c3                   	ret
+80107a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107aa0:	e8 fb ed ff ff       	call   801068a0 <mycpu>
+80107aa5:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+80107aab:	85 c0                	test   %eax,%eax
+80107aad:	74 eb                	je     80107a9a <popcli+0x2a>
+  asm volatile("sti");
+80107aaf:	fb                   	sti
+}
+80107ab0:	c9                   	leave
+80107ab1:	c3                   	ret
+    panic("popcli - interruptible");
+80107ab2:	83 ec 0c             	sub    $0xc,%esp
+80107ab5:	68 01 b5 10 80       	push   $0x8010b501
+80107aba:	e8 71 8c ff ff       	call   80100730 <panic>
+    panic("popcli");
+80107abf:	83 ec 0c             	sub    $0xc,%esp
+80107ac2:	68 18 b5 10 80       	push   $0x8010b518
+80107ac7:	e8 64 8c ff ff       	call   80100730 <panic>
+80107acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107ad0 <holding>:
+{
+80107ad0:	55                   	push   %ebp
+80107ad1:	89 e5                	mov    %esp,%ebp
+80107ad3:	56                   	push   %esi
+80107ad4:	53                   	push   %ebx
+80107ad5:	8b 75 08             	mov    0x8(%ebp),%esi
+80107ad8:	31 db                	xor    %ebx,%ebx
+  pushcli();
+80107ada:	e8 41 ff ff ff       	call   80107a20 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107adf:	8b 06                	mov    (%esi),%eax
+80107ae1:	85 c0                	test   %eax,%eax
+80107ae3:	75 0b                	jne    80107af0 <holding+0x20>
+  popcli();
+80107ae5:	e8 86 ff ff ff       	call   80107a70 <popcli>
+}
+80107aea:	89 d8                	mov    %ebx,%eax
+80107aec:	5b                   	pop    %ebx
+80107aed:	5e                   	pop    %esi
+80107aee:	5d                   	pop    %ebp
+80107aef:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80107af0:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107af3:	e8 a8 ed ff ff       	call   801068a0 <mycpu>
+80107af8:	39 c3                	cmp    %eax,%ebx
+80107afa:	0f 94 c3             	sete   %bl
+  popcli();
+80107afd:	e8 6e ff ff ff       	call   80107a70 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107b02:	0f b6 db             	movzbl %bl,%ebx
+}
+80107b05:	89 d8                	mov    %ebx,%eax
+80107b07:	5b                   	pop    %ebx
+80107b08:	5e                   	pop    %esi
+80107b09:	5d                   	pop    %ebp
+80107b0a:	c3                   	ret
+80107b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b0f:	90                   	nop
+
+80107b10 <release>:
+{
+80107b10:	55                   	push   %ebp
+80107b11:	89 e5                	mov    %esp,%ebp
+80107b13:	56                   	push   %esi
+80107b14:	53                   	push   %ebx
+80107b15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107b18:	e8 03 ff ff ff       	call   80107a20 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107b1d:	8b 03                	mov    (%ebx),%eax
+80107b1f:	85 c0                	test   %eax,%eax
+80107b21:	75 15                	jne    80107b38 <release+0x28>
+  popcli();
+80107b23:	e8 48 ff ff ff       	call   80107a70 <popcli>
+    panic("release");
+80107b28:	83 ec 0c             	sub    $0xc,%esp
+80107b2b:	68 1f b5 10 80       	push   $0x8010b51f
+80107b30:	e8 fb 8b ff ff       	call   80100730 <panic>
+80107b35:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107b38:	8b 73 08             	mov    0x8(%ebx),%esi
+80107b3b:	e8 60 ed ff ff       	call   801068a0 <mycpu>
+80107b40:	39 c6                	cmp    %eax,%esi
+80107b42:	75 df                	jne    80107b23 <release+0x13>
+  popcli();
+80107b44:	e8 27 ff ff ff       	call   80107a70 <popcli>
+  lk->pcs[0] = 0;
+80107b49:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107b50:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107b57:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107b5c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80107b62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107b65:	5b                   	pop    %ebx
+80107b66:	5e                   	pop    %esi
+80107b67:	5d                   	pop    %ebp
+  popcli();
+80107b68:	e9 03 ff ff ff       	jmp    80107a70 <popcli>
+80107b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107b70 <acquire>:
+{
+80107b70:	55                   	push   %ebp
+80107b71:	89 e5                	mov    %esp,%ebp
+80107b73:	53                   	push   %ebx
+80107b74:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107b77:	e8 a4 fe ff ff       	call   80107a20 <pushcli>
+  if(holding(lk))
+80107b7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107b7f:	e8 9c fe ff ff       	call   80107a20 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107b84:	8b 03                	mov    (%ebx),%eax
+80107b86:	85 c0                	test   %eax,%eax
+80107b88:	0f 85 9a 00 00 00    	jne    80107c28 <acquire+0xb8>
+  popcli();
+80107b8e:	e8 dd fe ff ff       	call   80107a70 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+80107b93:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b9f:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80107ba0:	8b 55 08             	mov    0x8(%ebp),%edx
+80107ba3:	89 c8                	mov    %ecx,%eax
+80107ba5:	f0 87 02             	lock xchg %eax,(%edx)
+80107ba8:	85 c0                	test   %eax,%eax
+80107baa:	75 f4                	jne    80107ba0 <acquire+0x30>
+  __sync_synchronize();
+80107bac:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107bb1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107bb4:	e8 e7 ec ff ff       	call   801068a0 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80107bb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+80107bbc:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+80107bbe:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107bc1:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80107bc7:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80107bcc:	77 32                	ja     80107c00 <acquire+0x90>
+  ebp = (uint*)v - 2;
+80107bce:	89 e8                	mov    %ebp,%eax
+80107bd0:	eb 14                	jmp    80107be6 <acquire+0x76>
+80107bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107bd8:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+80107bde:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107be4:	77 1a                	ja     80107c00 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+80107be6:	8b 58 04             	mov    0x4(%eax),%ebx
+80107be9:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80107bed:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107bf0:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80107bf2:	83 fa 0a             	cmp    $0xa,%edx
+80107bf5:	75 e1                	jne    80107bd8 <acquire+0x68>
+}
+80107bf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107bfa:	c9                   	leave
+80107bfb:	c3                   	ret
+80107bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c00:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80107c04:	8d 51 34             	lea    0x34(%ecx),%edx
+80107c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c0e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107c10:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107c16:	83 c0 04             	add    $0x4,%eax
+80107c19:	39 c2                	cmp    %eax,%edx
+80107c1b:	75 f3                	jne    80107c10 <acquire+0xa0>
+}
+80107c1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c20:	c9                   	leave
+80107c21:	c3                   	ret
+80107c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107c28:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80107c2b:	e8 70 ec ff ff       	call   801068a0 <mycpu>
+80107c30:	39 c3                	cmp    %eax,%ebx
+80107c32:	0f 85 56 ff ff ff    	jne    80107b8e <acquire+0x1e>
+  popcli();
+80107c38:	e8 33 fe ff ff       	call   80107a70 <popcli>
+    panic("acquire");
+80107c3d:	83 ec 0c             	sub    $0xc,%esp
+80107c40:	68 27 b5 10 80       	push   $0x8010b527
+80107c45:	e8 e6 8a ff ff       	call   80100730 <panic>
+80107c4a:	66 90                	xchg   %ax,%ax
+80107c4c:	66 90                	xchg   %ax,%ax
+80107c4e:	66 90                	xchg   %ax,%ax
+
+80107c50 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107c50:	55                   	push   %ebp
+80107c51:	89 e5                	mov    %esp,%ebp
+80107c53:	57                   	push   %edi
+80107c54:	8b 55 08             	mov    0x8(%ebp),%edx
+80107c57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107c5a:	89 d0                	mov    %edx,%eax
+80107c5c:	09 c8                	or     %ecx,%eax
+80107c5e:	a8 03                	test   $0x3,%al
+80107c60:	75 1e                	jne    80107c80 <memset+0x30>
+    c &= 0xFF;
+80107c62:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107c66:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80107c69:	89 d7                	mov    %edx,%edi
+80107c6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80107c71:	fc                   	cld
+80107c72:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107c74:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107c77:	89 d0                	mov    %edx,%eax
+80107c79:	c9                   	leave
+80107c7a:	c3                   	ret
+80107c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c7f:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80107c80:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107c83:	89 d7                	mov    %edx,%edi
+80107c85:	fc                   	cld
+80107c86:	f3 aa                	rep stos %al,%es:(%edi)
+80107c88:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107c8b:	89 d0                	mov    %edx,%eax
+80107c8d:	c9                   	leave
+80107c8e:	c3                   	ret
+80107c8f:	90                   	nop
+
+80107c90 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107c90:	55                   	push   %ebp
+80107c91:	89 e5                	mov    %esp,%ebp
+80107c93:	56                   	push   %esi
+80107c94:	53                   	push   %ebx
+80107c95:	8b 75 10             	mov    0x10(%ebp),%esi
+80107c98:	8b 55 08             	mov    0x8(%ebp),%edx
+80107c9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107c9e:	85 f6                	test   %esi,%esi
+80107ca0:	74 2e                	je     80107cd0 <memcmp+0x40>
+80107ca2:	01 c6                	add    %eax,%esi
+80107ca4:	eb 14                	jmp    80107cba <memcmp+0x2a>
+80107ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107cb0:	83 c0 01             	add    $0x1,%eax
+80107cb3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107cb6:	39 f0                	cmp    %esi,%eax
+80107cb8:	74 16                	je     80107cd0 <memcmp+0x40>
+    if(*s1 != *s2)
+80107cba:	0f b6 0a             	movzbl (%edx),%ecx
+80107cbd:	0f b6 18             	movzbl (%eax),%ebx
+80107cc0:	38 d9                	cmp    %bl,%cl
+80107cc2:	74 ec                	je     80107cb0 <memcmp+0x20>
+      return *s1 - *s2;
+80107cc4:	0f b6 c1             	movzbl %cl,%eax
+80107cc7:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107cc9:	5b                   	pop    %ebx
+80107cca:	5e                   	pop    %esi
+80107ccb:	5d                   	pop    %ebp
+80107ccc:	c3                   	ret
+80107ccd:	8d 76 00             	lea    0x0(%esi),%esi
+80107cd0:	5b                   	pop    %ebx
+  return 0;
+80107cd1:	31 c0                	xor    %eax,%eax
+}
+80107cd3:	5e                   	pop    %esi
+80107cd4:	5d                   	pop    %ebp
+80107cd5:	c3                   	ret
+80107cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107ce0 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107ce0:	55                   	push   %ebp
+80107ce1:	89 e5                	mov    %esp,%ebp
+80107ce3:	57                   	push   %edi
+80107ce4:	56                   	push   %esi
+80107ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+80107ce8:	8b 75 0c             	mov    0xc(%ebp),%esi
+80107ceb:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80107cee:	39 d6                	cmp    %edx,%esi
+80107cf0:	73 26                	jae    80107d18 <memmove+0x38>
+80107cf2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107cf5:	39 ca                	cmp    %ecx,%edx
+80107cf7:	73 1f                	jae    80107d18 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80107cf9:	85 c0                	test   %eax,%eax
+80107cfb:	74 0f                	je     80107d0c <memmove+0x2c>
+80107cfd:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80107d00:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80107d04:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80107d07:	83 e8 01             	sub    $0x1,%eax
+80107d0a:	73 f4                	jae    80107d00 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+80107d0c:	5e                   	pop    %esi
+80107d0d:	89 d0                	mov    %edx,%eax
+80107d0f:	5f                   	pop    %edi
+80107d10:	5d                   	pop    %ebp
+80107d11:	c3                   	ret
+80107d12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80107d18:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107d1b:	89 d7                	mov    %edx,%edi
+80107d1d:	85 c0                	test   %eax,%eax
+80107d1f:	74 eb                	je     80107d0c <memmove+0x2c>
+80107d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107d28:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107d29:	39 ce                	cmp    %ecx,%esi
+80107d2b:	75 fb                	jne    80107d28 <memmove+0x48>
+}
+80107d2d:	5e                   	pop    %esi
+80107d2e:	89 d0                	mov    %edx,%eax
+80107d30:	5f                   	pop    %edi
+80107d31:	5d                   	pop    %ebp
+80107d32:	c3                   	ret
+80107d33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107d40 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80107d40:	eb 9e                	jmp    80107ce0 <memmove>
+80107d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107d50 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107d50:	55                   	push   %ebp
+80107d51:	89 e5                	mov    %esp,%ebp
+80107d53:	53                   	push   %ebx
+80107d54:	8b 55 10             	mov    0x10(%ebp),%edx
+80107d57:	8b 45 08             	mov    0x8(%ebp),%eax
+80107d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+80107d5d:	85 d2                	test   %edx,%edx
+80107d5f:	75 16                	jne    80107d77 <strncmp+0x27>
+80107d61:	eb 2d                	jmp    80107d90 <strncmp+0x40>
+80107d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d67:	90                   	nop
+80107d68:	3a 19                	cmp    (%ecx),%bl
+80107d6a:	75 12                	jne    80107d7e <strncmp+0x2e>
+    n--, p++, q++;
+80107d6c:	83 c0 01             	add    $0x1,%eax
+80107d6f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107d72:	83 ea 01             	sub    $0x1,%edx
+80107d75:	74 19                	je     80107d90 <strncmp+0x40>
+80107d77:	0f b6 18             	movzbl (%eax),%ebx
+80107d7a:	84 db                	test   %bl,%bl
+80107d7c:	75 ea                	jne    80107d68 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80107d7e:	0f b6 00             	movzbl (%eax),%eax
+80107d81:	0f b6 11             	movzbl (%ecx),%edx
+}
+80107d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107d87:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+80107d88:	29 d0                	sub    %edx,%eax
+}
+80107d8a:	c3                   	ret
+80107d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d8f:	90                   	nop
+80107d90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80107d93:	31 c0                	xor    %eax,%eax
+}
+80107d95:	c9                   	leave
+80107d96:	c3                   	ret
+80107d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d9e:	66 90                	xchg   %ax,%ax
+
+80107da0 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107da0:	55                   	push   %ebp
+80107da1:	89 e5                	mov    %esp,%ebp
+80107da3:	57                   	push   %edi
+80107da4:	56                   	push   %esi
+80107da5:	53                   	push   %ebx
+80107da6:	8b 75 08             	mov    0x8(%ebp),%esi
+80107da9:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80107dac:	89 f0                	mov    %esi,%eax
+80107dae:	eb 15                	jmp    80107dc5 <strncpy+0x25>
+80107db0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80107db4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107db7:	83 c0 01             	add    $0x1,%eax
+80107dba:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+80107dbe:	88 48 ff             	mov    %cl,-0x1(%eax)
+80107dc1:	84 c9                	test   %cl,%cl
+80107dc3:	74 13                	je     80107dd8 <strncpy+0x38>
+80107dc5:	89 d3                	mov    %edx,%ebx
+80107dc7:	83 ea 01             	sub    $0x1,%edx
+80107dca:	85 db                	test   %ebx,%ebx
+80107dcc:	7f e2                	jg     80107db0 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+80107dce:	5b                   	pop    %ebx
+80107dcf:	89 f0                	mov    %esi,%eax
+80107dd1:	5e                   	pop    %esi
+80107dd2:	5f                   	pop    %edi
+80107dd3:	5d                   	pop    %ebp
+80107dd4:	c3                   	ret
+80107dd5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80107dd8:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80107ddb:	83 e9 01             	sub    $0x1,%ecx
+80107dde:	85 d2                	test   %edx,%edx
+80107de0:	74 ec                	je     80107dce <strncpy+0x2e>
+80107de2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80107de8:	83 c0 01             	add    $0x1,%eax
+80107deb:	89 ca                	mov    %ecx,%edx
+80107ded:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80107df1:	29 c2                	sub    %eax,%edx
+80107df3:	85 d2                	test   %edx,%edx
+80107df5:	7f f1                	jg     80107de8 <strncpy+0x48>
+}
+80107df7:	5b                   	pop    %ebx
+80107df8:	89 f0                	mov    %esi,%eax
+80107dfa:	5e                   	pop    %esi
+80107dfb:	5f                   	pop    %edi
+80107dfc:	5d                   	pop    %ebp
+80107dfd:	c3                   	ret
+80107dfe:	66 90                	xchg   %ax,%ax
+
+80107e00 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107e00:	55                   	push   %ebp
+80107e01:	89 e5                	mov    %esp,%ebp
+80107e03:	56                   	push   %esi
+80107e04:	53                   	push   %ebx
+80107e05:	8b 55 10             	mov    0x10(%ebp),%edx
+80107e08:	8b 75 08             	mov    0x8(%ebp),%esi
+80107e0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80107e0e:	85 d2                	test   %edx,%edx
+80107e10:	7e 25                	jle    80107e37 <safestrcpy+0x37>
+80107e12:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80107e16:	89 f2                	mov    %esi,%edx
+80107e18:	eb 16                	jmp    80107e30 <safestrcpy+0x30>
+80107e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107e20:	0f b6 08             	movzbl (%eax),%ecx
+80107e23:	83 c0 01             	add    $0x1,%eax
+80107e26:	83 c2 01             	add    $0x1,%edx
+80107e29:	88 4a ff             	mov    %cl,-0x1(%edx)
+80107e2c:	84 c9                	test   %cl,%cl
+80107e2e:	74 04                	je     80107e34 <safestrcpy+0x34>
+80107e30:	39 d8                	cmp    %ebx,%eax
+80107e32:	75 ec                	jne    80107e20 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80107e34:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107e37:	89 f0                	mov    %esi,%eax
+80107e39:	5b                   	pop    %ebx
+80107e3a:	5e                   	pop    %esi
+80107e3b:	5d                   	pop    %ebp
+80107e3c:	c3                   	ret
+80107e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107e40 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107e40:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107e41:	31 c0                	xor    %eax,%eax
+{
+80107e43:	89 e5                	mov    %esp,%ebp
+80107e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80107e48:	80 3a 00             	cmpb   $0x0,(%edx)
+80107e4b:	74 0c                	je     80107e59 <strlen+0x19>
+80107e4d:	8d 76 00             	lea    0x0(%esi),%esi
+80107e50:	83 c0 01             	add    $0x1,%eax
+80107e53:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107e57:	75 f7                	jne    80107e50 <strlen+0x10>
+    ;
+  return n;
+}
+80107e59:	5d                   	pop    %ebp
+80107e5a:	c3                   	ret
+
+80107e5b <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107e5b:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80107e5f:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80107e63:	55                   	push   %ebp
+  pushl %ebx
+80107e64:	53                   	push   %ebx
+  pushl %esi
+80107e65:	56                   	push   %esi
+  pushl %edi
+80107e66:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107e67:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107e69:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80107e6b:	5f                   	pop    %edi
+  popl %esi
+80107e6c:	5e                   	pop    %esi
+  popl %ebx
+80107e6d:	5b                   	pop    %ebx
+  popl %ebp
+80107e6e:	5d                   	pop    %ebp
+  ret
+80107e6f:	c3                   	ret
+
+80107e70 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80107e70:	55                   	push   %ebp
+80107e71:	89 e5                	mov    %esp,%ebp
+80107e73:	53                   	push   %ebx
+80107e74:	83 ec 04             	sub    $0x4,%esp
+80107e77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80107e7a:	e8 a1 ea ff ff       	call   80106920 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107e7f:	8b 00                	mov    (%eax),%eax
+80107e81:	39 c3                	cmp    %eax,%ebx
+80107e83:	73 1b                	jae    80107ea0 <fetchint+0x30>
+80107e85:	8d 53 04             	lea    0x4(%ebx),%edx
+80107e88:	39 d0                	cmp    %edx,%eax
+80107e8a:	72 14                	jb     80107ea0 <fetchint+0x30>
+    return -1;
+  *ip = *(int*)(addr);
+80107e8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107e8f:	8b 13                	mov    (%ebx),%edx
+80107e91:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107e93:	31 c0                	xor    %eax,%eax
+}
+80107e95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107e98:	c9                   	leave
+80107e99:	c3                   	ret
+80107e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80107ea0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ea5:	eb ee                	jmp    80107e95 <fetchint+0x25>
+80107ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eae:	66 90                	xchg   %ax,%ax
+
+80107eb0 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107eb0:	55                   	push   %ebp
+80107eb1:	89 e5                	mov    %esp,%ebp
+80107eb3:	53                   	push   %ebx
+80107eb4:	83 ec 04             	sub    $0x4,%esp
+80107eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+80107eba:	e8 61 ea ff ff       	call   80106920 <myproc>
+
+  if(addr >= curproc->sz)
+80107ebf:	3b 18                	cmp    (%eax),%ebx
+80107ec1:	73 2d                	jae    80107ef0 <fetchstr+0x40>
+    return -1;
+  *pp = (char*)addr;
+80107ec3:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107ec6:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+80107ec8:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+80107eca:	39 d3                	cmp    %edx,%ebx
+80107ecc:	73 22                	jae    80107ef0 <fetchstr+0x40>
+80107ece:	89 d8                	mov    %ebx,%eax
+80107ed0:	eb 0d                	jmp    80107edf <fetchstr+0x2f>
+80107ed2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107ed8:	83 c0 01             	add    $0x1,%eax
+80107edb:	39 d0                	cmp    %edx,%eax
+80107edd:	73 11                	jae    80107ef0 <fetchstr+0x40>
+    if(*s == 0)
+80107edf:	80 38 00             	cmpb   $0x0,(%eax)
+80107ee2:	75 f4                	jne    80107ed8 <fetchstr+0x28>
+      return s - *pp;
+80107ee4:	29 d8                	sub    %ebx,%eax
+  }
+  return -1;
+}
+80107ee6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ee9:	c9                   	leave
+80107eea:	c3                   	ret
+80107eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107eef:	90                   	nop
+80107ef0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80107ef3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107ef8:	c9                   	leave
+80107ef9:	c3                   	ret
+80107efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107f00 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80107f00:	55                   	push   %ebp
+80107f01:	89 e5                	mov    %esp,%ebp
+80107f03:	56                   	push   %esi
+80107f04:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f05:	e8 16 ea ff ff       	call   80106920 <myproc>
+80107f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+80107f0d:	8b 40 18             	mov    0x18(%eax),%eax
+80107f10:	8b 40 44             	mov    0x44(%eax),%eax
+80107f13:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107f16:	e8 05 ea ff ff       	call   80106920 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f1b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107f1e:	8b 00                	mov    (%eax),%eax
+80107f20:	39 c6                	cmp    %eax,%esi
+80107f22:	73 1c                	jae    80107f40 <argint+0x40>
+80107f24:	8d 53 08             	lea    0x8(%ebx),%edx
+80107f27:	39 d0                	cmp    %edx,%eax
+80107f29:	72 15                	jb     80107f40 <argint+0x40>
+  *ip = *(int*)(addr);
+80107f2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107f2e:	8b 53 04             	mov    0x4(%ebx),%edx
+80107f31:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107f33:	31 c0                	xor    %eax,%eax
+}
+80107f35:	5b                   	pop    %ebx
+80107f36:	5e                   	pop    %esi
+80107f37:	5d                   	pop    %ebp
+80107f38:	c3                   	ret
+80107f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80107f40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f45:	eb ee                	jmp    80107f35 <argint+0x35>
+80107f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f4e:	66 90                	xchg   %ax,%ax
+
+80107f50 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80107f50:	55                   	push   %ebp
+80107f51:	89 e5                	mov    %esp,%ebp
+80107f53:	57                   	push   %edi
+80107f54:	56                   	push   %esi
+80107f55:	53                   	push   %ebx
+80107f56:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  struct proc *curproc = myproc();
+80107f59:	e8 c2 e9 ff ff       	call   80106920 <myproc>
+80107f5e:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f60:	e8 bb e9 ff ff       	call   80106920 <myproc>
+80107f65:	8b 55 08             	mov    0x8(%ebp),%edx
+80107f68:	8b 40 18             	mov    0x18(%eax),%eax
+80107f6b:	8b 40 44             	mov    0x44(%eax),%eax
+80107f6e:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107f71:	e8 aa e9 ff ff       	call   80106920 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107f76:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107f79:	8b 00                	mov    (%eax),%eax
+80107f7b:	39 c7                	cmp    %eax,%edi
+80107f7d:	73 31                	jae    80107fb0 <argptr+0x60>
+80107f7f:	8d 4b 08             	lea    0x8(%ebx),%ecx
+80107f82:	39 c8                	cmp    %ecx,%eax
+80107f84:	72 2a                	jb     80107fb0 <argptr+0x60>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107f86:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int*)(addr);
+80107f89:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107f8c:	85 d2                	test   %edx,%edx
+80107f8e:	78 20                	js     80107fb0 <argptr+0x60>
+80107f90:	8b 16                	mov    (%esi),%edx
+80107f92:	39 d0                	cmp    %edx,%eax
+80107f94:	73 1a                	jae    80107fb0 <argptr+0x60>
+80107f96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80107f99:	01 c3                	add    %eax,%ebx
+80107f9b:	39 da                	cmp    %ebx,%edx
+80107f9d:	72 11                	jb     80107fb0 <argptr+0x60>
+    return -1;
+  *pp = (char*)i;
+80107f9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107fa2:	89 02                	mov    %eax,(%edx)
+  return 0;
+80107fa4:	31 c0                	xor    %eax,%eax
+}
+80107fa6:	83 c4 0c             	add    $0xc,%esp
+80107fa9:	5b                   	pop    %ebx
+80107faa:	5e                   	pop    %esi
+80107fab:	5f                   	pop    %edi
+80107fac:	5d                   	pop    %ebp
+80107fad:	c3                   	ret
+80107fae:	66 90                	xchg   %ax,%ax
+    return -1;
+80107fb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fb5:	eb ef                	jmp    80107fa6 <argptr+0x56>
+80107fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107fbe:	66 90                	xchg   %ax,%ax
+
+80107fc0 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80107fc0:	55                   	push   %ebp
+80107fc1:	89 e5                	mov    %esp,%ebp
+80107fc3:	56                   	push   %esi
+80107fc4:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107fc5:	e8 56 e9 ff ff       	call   80106920 <myproc>
+80107fca:	8b 55 08             	mov    0x8(%ebp),%edx
+80107fcd:	8b 40 18             	mov    0x18(%eax),%eax
+80107fd0:	8b 40 44             	mov    0x44(%eax),%eax
+80107fd3:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107fd6:	e8 45 e9 ff ff       	call   80106920 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107fdb:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107fde:	8b 00                	mov    (%eax),%eax
+80107fe0:	39 c6                	cmp    %eax,%esi
+80107fe2:	73 44                	jae    80108028 <argstr+0x68>
+80107fe4:	8d 53 08             	lea    0x8(%ebx),%edx
+80107fe7:	39 d0                	cmp    %edx,%eax
+80107fe9:	72 3d                	jb     80108028 <argstr+0x68>
+  *ip = *(int*)(addr);
+80107feb:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+80107fee:	e8 2d e9 ff ff       	call   80106920 <myproc>
+  if(addr >= curproc->sz)
+80107ff3:	3b 18                	cmp    (%eax),%ebx
+80107ff5:	73 31                	jae    80108028 <argstr+0x68>
+  *pp = (char*)addr;
+80107ff7:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107ffa:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+80107ffc:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+80107ffe:	39 d3                	cmp    %edx,%ebx
+80108000:	73 26                	jae    80108028 <argstr+0x68>
+80108002:	89 d8                	mov    %ebx,%eax
+80108004:	eb 11                	jmp    80108017 <argstr+0x57>
+80108006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010800d:	8d 76 00             	lea    0x0(%esi),%esi
+80108010:	83 c0 01             	add    $0x1,%eax
+80108013:	39 d0                	cmp    %edx,%eax
+80108015:	73 11                	jae    80108028 <argstr+0x68>
+    if(*s == 0)
+80108017:	80 38 00             	cmpb   $0x0,(%eax)
+8010801a:	75 f4                	jne    80108010 <argstr+0x50>
+      return s - *pp;
+8010801c:	29 d8                	sub    %ebx,%eax
+  int addr;
+  if(argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+}
+8010801e:	5b                   	pop    %ebx
+8010801f:	5e                   	pop    %esi
+80108020:	5d                   	pop    %ebp
+80108021:	c3                   	ret
+80108022:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108028:	5b                   	pop    %ebx
+    return -1;
+80108029:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010802e:	5e                   	pop    %esi
+8010802f:	5d                   	pop    %ebp
+80108030:	c3                   	ret
+80108031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010803f:	90                   	nop
+
+80108040 <syscall>:
+[SYS_dcstat]  sys_dcstat,
+};
+
+void
+syscall(void)
+{
+80108040:	55                   	push   %ebp
+80108041:	89 e5                	mov    %esp,%ebp
+80108043:	53                   	push   %ebx
+80108044:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80108047:	e8 d4 e8 ff ff       	call   80106920 <myproc>
+8010804c:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+8010804e:	8b 40 18             	mov    0x18(%eax),%eax
+80108051:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80108054:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108057:	83 fa 1a             	cmp    $0x1a,%edx
+8010805a:	77 24                	ja     80108080 <syscall+0x40>
+8010805c:	8b 14 85 60 b5 10 80 	mov    -0x7fef4aa0(,%eax,4),%edx
+80108063:	85 d2                	test   %edx,%edx
+80108065:	74 19                	je     80108080 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+80108067:	ff d2                	call   *%edx
+80108069:	89 c2                	mov    %eax,%edx
+8010806b:	8b 43 18             	mov    0x18(%ebx),%eax
+8010806e:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+80108071:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108074:	c9                   	leave
+80108075:	c3                   	ret
+80108076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010807d:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+80108080:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+80108081:	8d 43 70             	lea    0x70(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80108084:	50                   	push   %eax
+80108085:	ff 73 10             	push   0x10(%ebx)
+80108088:	68 2f b5 10 80       	push   $0x8010b52f
+8010808d:	e8 ce 89 ff ff       	call   80100a60 <cprintf>
+    curproc->tf->eax = -1;
+80108092:	8b 43 18             	mov    0x18(%ebx),%eax
+80108095:	83 c4 10             	add    $0x10,%esp
+80108098:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+8010809f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801080a2:	c9                   	leave
+801080a3:	c3                   	ret
+801080a4:	66 90                	xchg   %ax,%ax
+801080a6:	66 90                	xchg   %ax,%ax
+801080a8:	66 90                	xchg   %ax,%ax
+801080aa:	66 90                	xchg   %ax,%ax
+801080ac:	66 90                	xchg   %ax,%ax
+801080ae:	66 90                	xchg   %ax,%ax
+
+801080b0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801080b0:	55                   	push   %ebp
+801080b1:	89 e5                	mov    %esp,%ebp
+801080b3:	57                   	push   %edi
+801080b4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801080b5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+801080b8:	53                   	push   %ebx
+801080b9:	83 ec 34             	sub    $0x34,%esp
+801080bc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801080bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801080c2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801080c5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+801080c8:	57                   	push   %edi
+801080c9:	50                   	push   %eax
+801080ca:	e8 71 c0 ff ff       	call   80104140 <nameiparent>
+801080cf:	83 c4 10             	add    $0x10,%esp
+801080d2:	85 c0                	test   %eax,%eax
+801080d4:	74 5e                	je     80108134 <create+0x84>
+    return 0;
+  ilock(dp);
+801080d6:	83 ec 0c             	sub    $0xc,%esp
+801080d9:	89 c3                	mov    %eax,%ebx
+801080db:	50                   	push   %eax
+801080dc:	e8 8f a7 ff ff       	call   80102870 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801080e1:	83 c4 0c             	add    $0xc,%esp
+801080e4:	6a 00                	push   $0x0
+801080e6:	57                   	push   %edi
+801080e7:	53                   	push   %ebx
+801080e8:	e8 e3 b7 ff ff       	call   801038d0 <dirlookup>
+801080ed:	83 c4 10             	add    $0x10,%esp
+801080f0:	89 c6                	mov    %eax,%esi
+801080f2:	85 c0                	test   %eax,%eax
+801080f4:	74 4a                	je     80108140 <create+0x90>
+    iunlockput(dp);
+801080f6:	83 ec 0c             	sub    $0xc,%esp
+801080f9:	53                   	push   %ebx
+801080fa:	e8 81 ae ff ff       	call   80102f80 <iunlockput>
+    ilock(ip);
+801080ff:	89 34 24             	mov    %esi,(%esp)
+80108102:	e8 69 a7 ff ff       	call   80102870 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80108107:	83 c4 10             	add    $0x10,%esp
+8010810a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+8010810f:	75 17                	jne    80108128 <create+0x78>
+80108111:	66 83 7e 5c 02       	cmpw   $0x2,0x5c(%esi)
+80108116:	75 10                	jne    80108128 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80108118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010811b:	89 f0                	mov    %esi,%eax
+8010811d:	5b                   	pop    %ebx
+8010811e:	5e                   	pop    %esi
+8010811f:	5f                   	pop    %edi
+80108120:	5d                   	pop    %ebp
+80108121:	c3                   	ret
+80108122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80108128:	83 ec 0c             	sub    $0xc,%esp
+8010812b:	56                   	push   %esi
+8010812c:	e8 4f ae ff ff       	call   80102f80 <iunlockput>
+    return 0;
+80108131:	83 c4 10             	add    $0x10,%esp
+}
+80108134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80108137:	31 f6                	xor    %esi,%esi
+}
+80108139:	5b                   	pop    %ebx
+8010813a:	89 f0                	mov    %esi,%eax
+8010813c:	5e                   	pop    %esi
+8010813d:	5f                   	pop    %edi
+8010813e:	5d                   	pop    %ebp
+8010813f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108140:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80108144:	83 ec 08             	sub    $0x8,%esp
+80108147:	50                   	push   %eax
+80108148:	ff 33                	push   (%ebx)
+8010814a:	e8 71 a5 ff ff       	call   801026c0 <ialloc>
+8010814f:	83 c4 10             	add    $0x10,%esp
+80108152:	89 c6                	mov    %eax,%esi
+80108154:	85 c0                	test   %eax,%eax
+80108156:	0f 84 bc 00 00 00    	je     80108218 <create+0x168>
+  ilock(ip);
+8010815c:	83 ec 0c             	sub    $0xc,%esp
+8010815f:	50                   	push   %eax
+80108160:	e8 0b a7 ff ff       	call   80102870 <ilock>
+  ip->major = major;
+80108165:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80108169:	66 89 46 60          	mov    %ax,0x60(%esi)
+  ip->minor = minor;
+8010816d:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80108171:	66 89 46 62          	mov    %ax,0x62(%esi)
+  ip->nlink = 1;
+80108175:	b8 01 00 00 00       	mov    $0x1,%eax
+8010817a:	66 89 46 64          	mov    %ax,0x64(%esi)
+  iupdate(ip);
+8010817e:	89 34 24             	mov    %esi,(%esp)
+80108181:	e8 fa a5 ff ff       	call   80102780 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108186:	83 c4 10             	add    $0x10,%esp
+80108189:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+8010818e:	74 30                	je     801081c0 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+80108190:	83 ec 04             	sub    $0x4,%esp
+80108193:	ff 76 04             	push   0x4(%esi)
+80108196:	57                   	push   %edi
+80108197:	53                   	push   %ebx
+80108198:	e8 03 be ff ff       	call   80103fa0 <dirlink>
+8010819d:	83 c4 10             	add    $0x10,%esp
+801081a0:	85 c0                	test   %eax,%eax
+801081a2:	78 67                	js     8010820b <create+0x15b>
+  iunlockput(dp);
+801081a4:	83 ec 0c             	sub    $0xc,%esp
+801081a7:	53                   	push   %ebx
+801081a8:	e8 d3 ad ff ff       	call   80102f80 <iunlockput>
+  return ip;
+801081ad:	83 c4 10             	add    $0x10,%esp
+}
+801081b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801081b3:	89 f0                	mov    %esi,%eax
+801081b5:	5b                   	pop    %ebx
+801081b6:	5e                   	pop    %esi
+801081b7:	5f                   	pop    %edi
+801081b8:	5d                   	pop    %ebp
+801081b9:	c3                   	ret
+801081ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+801081c0:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+801081c3:	66 83 43 64 01       	addw   $0x1,0x64(%ebx)
+    iupdate(dp);
+801081c8:	53                   	push   %ebx
+801081c9:	e8 b2 a5 ff ff       	call   80102780 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+801081ce:	83 c4 0c             	add    $0xc,%esp
+801081d1:	ff 76 04             	push   0x4(%esi)
+801081d4:	68 ec b5 10 80       	push   $0x8010b5ec
+801081d9:	56                   	push   %esi
+801081da:	e8 c1 bd ff ff       	call   80103fa0 <dirlink>
+801081df:	83 c4 10             	add    $0x10,%esp
+801081e2:	85 c0                	test   %eax,%eax
+801081e4:	78 18                	js     801081fe <create+0x14e>
+801081e6:	83 ec 04             	sub    $0x4,%esp
+801081e9:	ff 73 04             	push   0x4(%ebx)
+801081ec:	68 eb b5 10 80       	push   $0x8010b5eb
+801081f1:	56                   	push   %esi
+801081f2:	e8 a9 bd ff ff       	call   80103fa0 <dirlink>
+801081f7:	83 c4 10             	add    $0x10,%esp
+801081fa:	85 c0                	test   %eax,%eax
+801081fc:	79 92                	jns    80108190 <create+0xe0>
+      panic("create dots");
+801081fe:	83 ec 0c             	sub    $0xc,%esp
+80108201:	68 df b5 10 80       	push   $0x8010b5df
+80108206:	e8 25 85 ff ff       	call   80100730 <panic>
+    panic("create: dirlink");
+8010820b:	83 ec 0c             	sub    $0xc,%esp
+8010820e:	68 ee b5 10 80       	push   $0x8010b5ee
+80108213:	e8 18 85 ff ff       	call   80100730 <panic>
+    panic("create: ialloc");
+80108218:	83 ec 0c             	sub    $0xc,%esp
+8010821b:	68 d0 b5 10 80       	push   $0x8010b5d0
+80108220:	e8 0b 85 ff ff       	call   80100730 <panic>
+80108225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010822c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108230 <sys_dup>:
+{
+80108230:	55                   	push   %ebp
+80108231:	89 e5                	mov    %esp,%ebp
+80108233:	56                   	push   %esi
+80108234:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108235:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108238:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010823b:	50                   	push   %eax
+8010823c:	6a 00                	push   $0x0
+8010823e:	e8 bd fc ff ff       	call   80107f00 <argint>
+80108243:	83 c4 10             	add    $0x10,%esp
+80108246:	85 c0                	test   %eax,%eax
+80108248:	78 36                	js     80108280 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010824a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010824e:	77 30                	ja     80108280 <sys_dup+0x50>
+80108250:	e8 cb e6 ff ff       	call   80106920 <myproc>
+80108255:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108258:	8b 74 90 2c          	mov    0x2c(%eax,%edx,4),%esi
+8010825c:	85 f6                	test   %esi,%esi
+8010825e:	74 20                	je     80108280 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+80108260:	e8 bb e6 ff ff       	call   80106920 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108265:	31 db                	xor    %ebx,%ebx
+80108267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010826e:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+80108270:	8b 54 98 2c          	mov    0x2c(%eax,%ebx,4),%edx
+80108274:	85 d2                	test   %edx,%edx
+80108276:	74 18                	je     80108290 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+80108278:	83 c3 01             	add    $0x1,%ebx
+8010827b:	83 fb 10             	cmp    $0x10,%ebx
+8010827e:	75 f0                	jne    80108270 <sys_dup+0x40>
+}
+80108280:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80108283:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80108288:	89 d8                	mov    %ebx,%eax
+8010828a:	5b                   	pop    %ebx
+8010828b:	5e                   	pop    %esi
+8010828c:	5d                   	pop    %ebp
+8010828d:	c3                   	ret
+8010828e:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80108290:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80108293:	89 74 98 2c          	mov    %esi,0x2c(%eax,%ebx,4)
+  filedup(f);
+80108297:	56                   	push   %esi
+80108298:	e8 c3 8f ff ff       	call   80101260 <filedup>
+  return fd;
+8010829d:	83 c4 10             	add    $0x10,%esp
+}
+801082a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801082a3:	89 d8                	mov    %ebx,%eax
+801082a5:	5b                   	pop    %ebx
+801082a6:	5e                   	pop    %esi
+801082a7:	5d                   	pop    %ebp
+801082a8:	c3                   	ret
+801082a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801082b0 <sys_read>:
+{
+801082b0:	55                   	push   %ebp
+801082b1:	89 e5                	mov    %esp,%ebp
+801082b3:	56                   	push   %esi
+801082b4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801082b5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+801082b8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801082bb:	53                   	push   %ebx
+801082bc:	6a 00                	push   $0x0
+801082be:	e8 3d fc ff ff       	call   80107f00 <argint>
+801082c3:	83 c4 10             	add    $0x10,%esp
+801082c6:	85 c0                	test   %eax,%eax
+801082c8:	78 5e                	js     80108328 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801082ca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801082ce:	77 58                	ja     80108328 <sys_read+0x78>
+801082d0:	e8 4b e6 ff ff       	call   80106920 <myproc>
+801082d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801082d8:	8b 74 90 2c          	mov    0x2c(%eax,%edx,4),%esi
+801082dc:	85 f6                	test   %esi,%esi
+801082de:	74 48                	je     80108328 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+801082e0:	83 ec 08             	sub    $0x8,%esp
+801082e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801082e6:	50                   	push   %eax
+801082e7:	6a 02                	push   $0x2
+801082e9:	e8 12 fc ff ff       	call   80107f00 <argint>
+801082ee:	83 c4 10             	add    $0x10,%esp
+801082f1:	85 c0                	test   %eax,%eax
+801082f3:	78 33                	js     80108328 <sys_read+0x78>
+801082f5:	83 ec 04             	sub    $0x4,%esp
+801082f8:	ff 75 f0             	push   -0x10(%ebp)
+801082fb:	53                   	push   %ebx
+801082fc:	6a 01                	push   $0x1
+801082fe:	e8 4d fc ff ff       	call   80107f50 <argptr>
+80108303:	83 c4 10             	add    $0x10,%esp
+80108306:	85 c0                	test   %eax,%eax
+80108308:	78 1e                	js     80108328 <sys_read+0x78>
+  return fileread(f, p, n);
+8010830a:	83 ec 04             	sub    $0x4,%esp
+8010830d:	ff 75 f0             	push   -0x10(%ebp)
+80108310:	ff 75 f4             	push   -0xc(%ebp)
+80108313:	56                   	push   %esi
+80108314:	e8 c7 90 ff ff       	call   801013e0 <fileread>
+80108319:	83 c4 10             	add    $0x10,%esp
+}
+8010831c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010831f:	5b                   	pop    %ebx
+80108320:	5e                   	pop    %esi
+80108321:	5d                   	pop    %ebp
+80108322:	c3                   	ret
+80108323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108327:	90                   	nop
+    return -1;
+80108328:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010832d:	eb ed                	jmp    8010831c <sys_read+0x6c>
+8010832f:	90                   	nop
+
+80108330 <sys_write>:
+{
+80108330:	55                   	push   %ebp
+80108331:	89 e5                	mov    %esp,%ebp
+80108333:	56                   	push   %esi
+80108334:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108335:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108338:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010833b:	53                   	push   %ebx
+8010833c:	6a 00                	push   $0x0
+8010833e:	e8 bd fb ff ff       	call   80107f00 <argint>
+80108343:	83 c4 10             	add    $0x10,%esp
+80108346:	85 c0                	test   %eax,%eax
+80108348:	78 5e                	js     801083a8 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010834a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010834e:	77 58                	ja     801083a8 <sys_write+0x78>
+80108350:	e8 cb e5 ff ff       	call   80106920 <myproc>
+80108355:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108358:	8b 74 90 2c          	mov    0x2c(%eax,%edx,4),%esi
+8010835c:	85 f6                	test   %esi,%esi
+8010835e:	74 48                	je     801083a8 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80108360:	83 ec 08             	sub    $0x8,%esp
+80108363:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108366:	50                   	push   %eax
+80108367:	6a 02                	push   $0x2
+80108369:	e8 92 fb ff ff       	call   80107f00 <argint>
+8010836e:	83 c4 10             	add    $0x10,%esp
+80108371:	85 c0                	test   %eax,%eax
+80108373:	78 33                	js     801083a8 <sys_write+0x78>
+80108375:	83 ec 04             	sub    $0x4,%esp
+80108378:	ff 75 f0             	push   -0x10(%ebp)
+8010837b:	53                   	push   %ebx
+8010837c:	6a 01                	push   $0x1
+8010837e:	e8 cd fb ff ff       	call   80107f50 <argptr>
+80108383:	83 c4 10             	add    $0x10,%esp
+80108386:	85 c0                	test   %eax,%eax
+80108388:	78 1e                	js     801083a8 <sys_write+0x78>
+  return filewrite(f, p, n);
+8010838a:	83 ec 04             	sub    $0x4,%esp
+8010838d:	ff 75 f0             	push   -0x10(%ebp)
+80108390:	ff 75 f4             	push   -0xc(%ebp)
+80108393:	56                   	push   %esi
+80108394:	e8 d7 90 ff ff       	call   80101470 <filewrite>
+80108399:	83 c4 10             	add    $0x10,%esp
+}
+8010839c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010839f:	5b                   	pop    %ebx
+801083a0:	5e                   	pop    %esi
+801083a1:	5d                   	pop    %ebp
+801083a2:	c3                   	ret
+801083a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801083a7:	90                   	nop
+    return -1;
+801083a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083ad:	eb ed                	jmp    8010839c <sys_write+0x6c>
+801083af:	90                   	nop
+
+801083b0 <sys_close>:
+{
+801083b0:	55                   	push   %ebp
+801083b1:	89 e5                	mov    %esp,%ebp
+801083b3:	56                   	push   %esi
+801083b4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801083b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801083b8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801083bb:	50                   	push   %eax
+801083bc:	6a 00                	push   $0x0
+801083be:	e8 3d fb ff ff       	call   80107f00 <argint>
+801083c3:	83 c4 10             	add    $0x10,%esp
+801083c6:	85 c0                	test   %eax,%eax
+801083c8:	78 3e                	js     80108408 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801083ca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801083ce:	77 38                	ja     80108408 <sys_close+0x58>
+801083d0:	e8 4b e5 ff ff       	call   80106920 <myproc>
+801083d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801083d8:	8d 5a 08             	lea    0x8(%edx),%ebx
+801083db:	8b 74 98 0c          	mov    0xc(%eax,%ebx,4),%esi
+801083df:	85 f6                	test   %esi,%esi
+801083e1:	74 25                	je     80108408 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+801083e3:	e8 38 e5 ff ff       	call   80106920 <myproc>
+  fileclose(f);
+801083e8:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+801083eb:	c7 44 98 0c 00 00 00 	movl   $0x0,0xc(%eax,%ebx,4)
+801083f2:	00 
+  fileclose(f);
+801083f3:	56                   	push   %esi
+801083f4:	e8 b7 8e ff ff       	call   801012b0 <fileclose>
+  return 0;
+801083f9:	83 c4 10             	add    $0x10,%esp
+801083fc:	31 c0                	xor    %eax,%eax
+}
+801083fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108401:	5b                   	pop    %ebx
+80108402:	5e                   	pop    %esi
+80108403:	5d                   	pop    %ebp
+80108404:	c3                   	ret
+80108405:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108408:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010840d:	eb ef                	jmp    801083fe <sys_close+0x4e>
+8010840f:	90                   	nop
+
+80108410 <sys_fstat>:
+{
+80108410:	55                   	push   %ebp
+80108411:	89 e5                	mov    %esp,%ebp
+80108413:	56                   	push   %esi
+80108414:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108415:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108418:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010841b:	53                   	push   %ebx
+8010841c:	6a 00                	push   $0x0
+8010841e:	e8 dd fa ff ff       	call   80107f00 <argint>
+80108423:	83 c4 10             	add    $0x10,%esp
+80108426:	85 c0                	test   %eax,%eax
+80108428:	78 46                	js     80108470 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010842a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010842e:	77 40                	ja     80108470 <sys_fstat+0x60>
+80108430:	e8 eb e4 ff ff       	call   80106920 <myproc>
+80108435:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108438:	8b 74 90 2c          	mov    0x2c(%eax,%edx,4),%esi
+8010843c:	85 f6                	test   %esi,%esi
+8010843e:	74 30                	je     80108470 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80108440:	83 ec 04             	sub    $0x4,%esp
+80108443:	6a 14                	push   $0x14
+80108445:	53                   	push   %ebx
+80108446:	6a 01                	push   $0x1
+80108448:	e8 03 fb ff ff       	call   80107f50 <argptr>
+8010844d:	83 c4 10             	add    $0x10,%esp
+80108450:	85 c0                	test   %eax,%eax
+80108452:	78 1c                	js     80108470 <sys_fstat+0x60>
+  return filestat(f, st);
+80108454:	83 ec 08             	sub    $0x8,%esp
+80108457:	ff 75 f4             	push   -0xc(%ebp)
+8010845a:	56                   	push   %esi
+8010845b:	e8 30 8f ff ff       	call   80101390 <filestat>
+80108460:	83 c4 10             	add    $0x10,%esp
+}
+80108463:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108466:	5b                   	pop    %ebx
+80108467:	5e                   	pop    %esi
+80108468:	5d                   	pop    %ebp
+80108469:	c3                   	ret
+8010846a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80108470:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108475:	eb ec                	jmp    80108463 <sys_fstat+0x53>
+80108477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010847e:	66 90                	xchg   %ax,%ax
+
+80108480 <sys_link>:
+{
+80108480:	55                   	push   %ebp
+80108481:	89 e5                	mov    %esp,%ebp
+80108483:	57                   	push   %edi
+80108484:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108485:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80108488:	53                   	push   %ebx
+80108489:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+8010848c:	50                   	push   %eax
+8010848d:	6a 00                	push   $0x0
+8010848f:	e8 2c fb ff ff       	call   80107fc0 <argstr>
+80108494:	83 c4 10             	add    $0x10,%esp
+80108497:	85 c0                	test   %eax,%eax
+80108499:	0f 88 fb 00 00 00    	js     8010859a <sys_link+0x11a>
+8010849f:	83 ec 08             	sub    $0x8,%esp
+801084a2:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801084a5:	50                   	push   %eax
+801084a6:	6a 01                	push   $0x1
+801084a8:	e8 13 fb ff ff       	call   80107fc0 <argstr>
+801084ad:	83 c4 10             	add    $0x10,%esp
+801084b0:	85 c0                	test   %eax,%eax
+801084b2:	0f 88 e2 00 00 00    	js     8010859a <sys_link+0x11a>
+  begin_op();
+801084b8:	e8 43 d2 ff ff       	call   80105700 <begin_op>
+  if((ip = namei(old)) == 0){
+801084bd:	83 ec 0c             	sub    $0xc,%esp
+801084c0:	ff 75 d4             	push   -0x2c(%ebp)
+801084c3:	e8 38 bc ff ff       	call   80104100 <namei>
+801084c8:	83 c4 10             	add    $0x10,%esp
+801084cb:	89 c3                	mov    %eax,%ebx
+801084cd:	85 c0                	test   %eax,%eax
+801084cf:	0f 84 df 00 00 00    	je     801085b4 <sys_link+0x134>
+  ilock(ip);
+801084d5:	83 ec 0c             	sub    $0xc,%esp
+801084d8:	50                   	push   %eax
+801084d9:	e8 92 a3 ff ff       	call   80102870 <ilock>
+  if(ip->type == T_DIR){
+801084de:	83 c4 10             	add    $0x10,%esp
+801084e1:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801084e6:	0f 84 b5 00 00 00    	je     801085a1 <sys_link+0x121>
+  iupdate(ip);
+801084ec:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+801084ef:	66 83 43 64 01       	addw   $0x1,0x64(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+801084f4:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+801084f7:	53                   	push   %ebx
+801084f8:	e8 83 a2 ff ff       	call   80102780 <iupdate>
+  iunlock(ip);
+801084fd:	89 1c 24             	mov    %ebx,(%esp)
+80108500:	e8 5b a4 ff ff       	call   80102960 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108505:	58                   	pop    %eax
+80108506:	5a                   	pop    %edx
+80108507:	57                   	push   %edi
+80108508:	ff 75 d0             	push   -0x30(%ebp)
+8010850b:	e8 30 bc ff ff       	call   80104140 <nameiparent>
+80108510:	83 c4 10             	add    $0x10,%esp
+80108513:	89 c6                	mov    %eax,%esi
+80108515:	85 c0                	test   %eax,%eax
+80108517:	74 5b                	je     80108574 <sys_link+0xf4>
+  ilock(dp);
+80108519:	83 ec 0c             	sub    $0xc,%esp
+8010851c:	50                   	push   %eax
+8010851d:	e8 4e a3 ff ff       	call   80102870 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108522:	8b 03                	mov    (%ebx),%eax
+80108524:	83 c4 10             	add    $0x10,%esp
+80108527:	39 06                	cmp    %eax,(%esi)
+80108529:	75 3d                	jne    80108568 <sys_link+0xe8>
+8010852b:	83 ec 04             	sub    $0x4,%esp
+8010852e:	ff 73 04             	push   0x4(%ebx)
+80108531:	57                   	push   %edi
+80108532:	56                   	push   %esi
+80108533:	e8 68 ba ff ff       	call   80103fa0 <dirlink>
+80108538:	83 c4 10             	add    $0x10,%esp
+8010853b:	85 c0                	test   %eax,%eax
+8010853d:	78 29                	js     80108568 <sys_link+0xe8>
+  iunlockput(dp);
+8010853f:	83 ec 0c             	sub    $0xc,%esp
+80108542:	56                   	push   %esi
+80108543:	e8 38 aa ff ff       	call   80102f80 <iunlockput>
+  iput(ip);
+80108548:	89 1c 24             	mov    %ebx,(%esp)
+8010854b:	e8 60 a4 ff ff       	call   801029b0 <iput>
+  end_op();
+80108550:	e8 2b d2 ff ff       	call   80105780 <end_op>
+  return 0;
+80108555:	83 c4 10             	add    $0x10,%esp
+80108558:	31 c0                	xor    %eax,%eax
+}
+8010855a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010855d:	5b                   	pop    %ebx
+8010855e:	5e                   	pop    %esi
+8010855f:	5f                   	pop    %edi
+80108560:	5d                   	pop    %ebp
+80108561:	c3                   	ret
+80108562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80108568:	83 ec 0c             	sub    $0xc,%esp
+8010856b:	56                   	push   %esi
+8010856c:	e8 0f aa ff ff       	call   80102f80 <iunlockput>
+    goto bad;
+80108571:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108574:	83 ec 0c             	sub    $0xc,%esp
+80108577:	53                   	push   %ebx
+80108578:	e8 f3 a2 ff ff       	call   80102870 <ilock>
+  ip->nlink--;
+8010857d:	66 83 6b 64 01       	subw   $0x1,0x64(%ebx)
+  iupdate(ip);
+80108582:	89 1c 24             	mov    %ebx,(%esp)
+80108585:	e8 f6 a1 ff ff       	call   80102780 <iupdate>
+  iunlockput(ip);
+8010858a:	89 1c 24             	mov    %ebx,(%esp)
+8010858d:	e8 ee a9 ff ff       	call   80102f80 <iunlockput>
+  end_op();
+80108592:	e8 e9 d1 ff ff       	call   80105780 <end_op>
+  return -1;
+80108597:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010859a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010859f:	eb b9                	jmp    8010855a <sys_link+0xda>
+    iunlockput(ip);
+801085a1:	83 ec 0c             	sub    $0xc,%esp
+801085a4:	53                   	push   %ebx
+801085a5:	e8 d6 a9 ff ff       	call   80102f80 <iunlockput>
+    end_op();
+801085aa:	e8 d1 d1 ff ff       	call   80105780 <end_op>
+    return -1;
+801085af:	83 c4 10             	add    $0x10,%esp
+801085b2:	eb e6                	jmp    8010859a <sys_link+0x11a>
+    end_op();
+801085b4:	e8 c7 d1 ff ff       	call   80105780 <end_op>
+    return -1;
+801085b9:	eb df                	jmp    8010859a <sys_link+0x11a>
+801085bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801085bf:	90                   	nop
+
+801085c0 <sys_unlink>:
+{
+801085c0:	55                   	push   %ebp
+801085c1:	89 e5                	mov    %esp,%ebp
+801085c3:	57                   	push   %edi
+801085c4:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+801085c5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+801085c8:	53                   	push   %ebx
+801085c9:	83 ec 44             	sub    $0x44,%esp
+  if(argstr(0, &path) < 0)
+801085cc:	50                   	push   %eax
+801085cd:	6a 00                	push   $0x0
+801085cf:	e8 ec f9 ff ff       	call   80107fc0 <argstr>
+801085d4:	83 c4 10             	add    $0x10,%esp
+801085d7:	85 c0                	test   %eax,%eax
+801085d9:	0f 88 82 01 00 00    	js     80108761 <sys_unlink+0x1a1>
+  begin_op();
+801085df:	e8 1c d1 ff ff       	call   80105700 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+801085e4:	83 ec 08             	sub    $0x8,%esp
+801085e7:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801085ea:	50                   	push   %eax
+801085eb:	ff 75 c0             	push   -0x40(%ebp)
+801085ee:	e8 4d bb ff ff       	call   80104140 <nameiparent>
+801085f3:	83 c4 10             	add    $0x10,%esp
+801085f6:	89 c6                	mov    %eax,%esi
+801085f8:	85 c0                	test   %eax,%eax
+801085fa:	0f 84 86 01 00 00    	je     80108786 <sys_unlink+0x1c6>
+  ilock(dp);
+80108600:	83 ec 0c             	sub    $0xc,%esp
+80108603:	50                   	push   %eax
+80108604:	e8 67 a2 ff ff       	call   80102870 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80108609:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010860c:	5a                   	pop    %edx
+8010860d:	59                   	pop    %ecx
+8010860e:	68 ec b5 10 80       	push   $0x8010b5ec
+80108613:	50                   	push   %eax
+80108614:	e8 e7 b0 ff ff       	call   80103700 <namecmp>
+80108619:	83 c4 10             	add    $0x10,%esp
+8010861c:	85 c0                	test   %eax,%eax
+8010861e:	0f 84 2c 01 00 00    	je     80108750 <sys_unlink+0x190>
+80108624:	83 ec 08             	sub    $0x8,%esp
+80108627:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010862a:	68 eb b5 10 80       	push   $0x8010b5eb
+8010862f:	50                   	push   %eax
+80108630:	e8 cb b0 ff ff       	call   80103700 <namecmp>
+80108635:	83 c4 10             	add    $0x10,%esp
+80108638:	85 c0                	test   %eax,%eax
+8010863a:	0f 84 10 01 00 00    	je     80108750 <sys_unlink+0x190>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80108640:	83 ec 04             	sub    $0x4,%esp
+80108643:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108646:	50                   	push   %eax
+80108647:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010864a:	50                   	push   %eax
+8010864b:	56                   	push   %esi
+8010864c:	e8 7f b2 ff ff       	call   801038d0 <dirlookup>
+80108651:	83 c4 10             	add    $0x10,%esp
+80108654:	89 c3                	mov    %eax,%ebx
+80108656:	85 c0                	test   %eax,%eax
+80108658:	0f 84 f2 00 00 00    	je     80108750 <sys_unlink+0x190>
+  ilock(ip);
+8010865e:	83 ec 0c             	sub    $0xc,%esp
+80108661:	50                   	push   %eax
+80108662:	e8 09 a2 ff ff       	call   80102870 <ilock>
+  if(ip->nlink < 1)
+80108667:	83 c4 10             	add    $0x10,%esp
+8010866a:	66 83 7b 64 00       	cmpw   $0x0,0x64(%ebx)
+8010866f:	0f 8e 32 01 00 00    	jle    801087a7 <sys_unlink+0x1e7>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108675:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+8010867a:	0f 84 80 00 00 00    	je     80108700 <sys_unlink+0x140>
+  de.inum = 0;
+80108680:	31 c0                	xor    %eax,%eax
+  strncpy(de.name, name, DIRSIZ);
+80108682:	83 ec 04             	sub    $0x4,%esp
+  de.inum = 0;
+80108685:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  strncpy(de.name, name, DIRSIZ);
+80108689:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010868c:	6a 0e                	push   $0xe
+8010868e:	50                   	push   %eax
+8010868f:	8d 45 da             	lea    -0x26(%ebp),%eax
+80108692:	50                   	push   %eax
+80108693:	e8 08 f7 ff ff       	call   80107da0 <strncpy>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108698:	8d 45 d8             	lea    -0x28(%ebp),%eax
+8010869b:	6a 10                	push   $0x10
+8010869d:	ff 75 c4             	push   -0x3c(%ebp)
+801086a0:	50                   	push   %eax
+801086a1:	56                   	push   %esi
+801086a2:	e8 a9 ac ff ff       	call   80103350 <writei>
+801086a7:	83 c4 20             	add    $0x20,%esp
+801086aa:	83 f8 10             	cmp    $0x10,%eax
+801086ad:	0f 85 e7 00 00 00    	jne    8010879a <sys_unlink+0x1da>
+  dcacheput(dp, name, 0);
+801086b3:	83 ec 04             	sub    $0x4,%esp
+801086b6:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801086b9:	6a 00                	push   $0x0
+801086bb:	50                   	push   %eax
+801086bc:	56                   	push   %esi
+801086bd:	e8 5e b0 ff ff       	call   80103720 <dcacheput>
+  if(ip->type == T_DIR){
+801086c2:	83 c4 10             	add    $0x10,%esp
+801086c5:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801086ca:	0f 84 a0 00 00 00    	je     80108770 <sys_unlink+0x1b0>
+  iunlockput(dp);
+801086d0:	83 ec 0c             	sub    $0xc,%esp
+801086d3:	56                   	push   %esi
+801086d4:	e8 a7 a8 ff ff       	call   80102f80 <iunlockput>
+  ip->nlink--;
+801086d9:	66 83 6b 64 01       	subw   $0x1,0x64(%ebx)
+  iupdate(ip);
+801086de:	89 1c 24             	mov    %ebx,(%esp)
+801086e1:	e8 9a a0 ff ff       	call   80102780 <iupdate>
+  iunlockput(ip);
+801086e6:	89 1c 24             	mov    %ebx,(%esp)
+801086e9:	e8 92 a8 ff ff       	call   80102f80 <iunlockput>
+  end_op();
+801086ee:	e8 8d d0 ff ff       	call   80105780 <end_op>
+  return 0;
+801086f3:	83 c4 10             	add    $0x10,%esp
+801086f6:	31 c0                	xor    %eax,%eax
+}
+801086f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801086fb:	5b                   	pop    %ebx
+801086fc:	5e                   	pop    %esi
+801086fd:	5f                   	pop    %edi
+801086fe:	5d                   	pop    %ebp
+801086ff:	c3                   	ret
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108700:	83 7b 68 20          	cmpl   $0x20,0x68(%ebx)
+80108704:	0f 86 76 ff ff ff    	jbe    80108680 <sys_unlink+0xc0>
+8010870a:	bf 20 00 00 00       	mov    $0x20,%edi
+8010870f:	eb 13                	jmp    80108724 <sys_unlink+0x164>
+80108711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108718:	83 c7 10             	add    $0x10,%edi
+8010871b:	3b 7b 68             	cmp    0x68(%ebx),%edi
+8010871e:	0f 83 5c ff ff ff    	jae    80108680 <sys_unlink+0xc0>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108724:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80108727:	6a 10                	push   $0x10
+80108729:	57                   	push   %edi
+8010872a:	50                   	push   %eax
+8010872b:	53                   	push   %ebx
+8010872c:	e8 ff a8 ff ff       	call   80103030 <readi>
+80108731:	83 c4 10             	add    $0x10,%esp
+80108734:	83 f8 10             	cmp    $0x10,%eax
+80108737:	75 54                	jne    8010878d <sys_unlink+0x1cd>
+    if(de.inum != 0)
+80108739:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010873e:	74 d8                	je     80108718 <sys_unlink+0x158>
+    iunlockput(ip);
+80108740:	83 ec 0c             	sub    $0xc,%esp
+80108743:	53                   	push   %ebx
+80108744:	e8 37 a8 ff ff       	call   80102f80 <iunlockput>
+    goto bad;
+80108749:	83 c4 10             	add    $0x10,%esp
+8010874c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  iunlockput(dp);
+80108750:	83 ec 0c             	sub    $0xc,%esp
+80108753:	56                   	push   %esi
+80108754:	e8 27 a8 ff ff       	call   80102f80 <iunlockput>
+  end_op();
+80108759:	e8 22 d0 ff ff       	call   80105780 <end_op>
+  return -1;
+8010875e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108761:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108766:	eb 90                	jmp    801086f8 <sys_unlink+0x138>
+80108768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010876f:	90                   	nop
+    iupdate(dp);
+80108770:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+80108773:	66 83 6e 64 01       	subw   $0x1,0x64(%esi)
+    iupdate(dp);
+80108778:	56                   	push   %esi
+80108779:	e8 02 a0 ff ff       	call   80102780 <iupdate>
+8010877e:	83 c4 10             	add    $0x10,%esp
+80108781:	e9 4a ff ff ff       	jmp    801086d0 <sys_unlink+0x110>
+    end_op();
+80108786:	e8 f5 cf ff ff       	call   80105780 <end_op>
+    return -1;
+8010878b:	eb d4                	jmp    80108761 <sys_unlink+0x1a1>
+      panic("isdirempty: readi");
+8010878d:	83 ec 0c             	sub    $0xc,%esp
+80108790:	68 10 b6 10 80       	push   $0x8010b610
+80108795:	e8 96 7f ff ff       	call   80100730 <panic>
+    panic("unlink: writei");
+8010879a:	83 ec 0c             	sub    $0xc,%esp
+8010879d:	68 22 b6 10 80       	push   $0x8010b622
+801087a2:	e8 89 7f ff ff       	call   80100730 <panic>
+    panic("unlink: nlink < 1");
+801087a7:	83 ec 0c             	sub    $0xc,%esp
+801087aa:	68 fe b5 10 80       	push   $0x8010b5fe
+801087af:	e8 7c 7f ff ff       	call   80100730 <panic>
+801087b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801087bf:	90                   	nop
+
+801087c0 <sys_open>:
+
+int
+sys_open(void)
+{
+801087c0:	55                   	push   %ebp
+801087c1:	89 e5                	mov    %esp,%ebp
+801087c3:	57                   	push   %edi
+801087c4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801087c5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+801087c8:	53                   	push   %ebx
+801087c9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801087cc:	50                   	push   %eax
+801087cd:	6a 00                	push   $0x0
+801087cf:	e8 ec f7 ff ff       	call   80107fc0 <argstr>
+801087d4:	83 c4 10             	add    $0x10,%esp
+801087d7:	85 c0                	test   %eax,%eax
+801087d9:	0f 88 9e 00 00 00    	js     8010887d <sys_open+0xbd>
+801087df:	83 ec 08             	sub    $0x8,%esp
+801087e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801087e5:	50                   	push   %eax
+801087e6:	6a 01                	push   $0x1
+801087e8:	e8 13 f7 ff ff       	call   80107f00 <argint>
+801087ed:	83 c4 10             	add    $0x10,%esp
+801087f0:	85 c0                	test   %eax,%eax
+801087f2:	0f 88 85 00 00 00    	js     8010887d <sys_open+0xbd>
+    return -1;
+
+  begin_op();
+801087f8:	e8 03 cf ff ff       	call   80105700 <begin_op>
+
+// openstart: 
+  if(omode & O_CREATE){
+801087fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80108800:	f6 c4 02             	test   $0x2,%ah
+80108803:	0f 85 df 00 00 00    	jne    801088e8 <sys_open+0x128>
+    ip = create(path, T_FILE, 0, 0);
+80108809:	8b 55 e0             	mov    -0x20(%ebp),%edx
+       !(ip->flags & I_EXTENT)){
+      ip->flags |= I_EXTENT;
+      iupdate(ip);
+    }
+  } else {
+    if(omode & O_LOOKUP)
+8010880c:	a8 04                	test   $0x4,%al
+8010880e:	75 78                	jne    80108888 <sys_open+0xc8>
+      ip = nameilink(path);
+    else
+      ip = namei(path);
+80108810:	83 ec 0c             	sub    $0xc,%esp
+80108813:	52                   	push   %edx
+80108814:	e8 e7 b8 ff ff       	call   80104100 <namei>
+80108819:	83 c4 10             	add    $0x10,%esp
+8010881c:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+8010881e:	85 f6                	test   %esi,%esi
+80108820:	0f 84 3c 01 00 00    	je     80108962 <sys_open+0x1a2>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80108826:	83 ec 0c             	sub    $0xc,%esp
+80108829:	56                   	push   %esi
+8010882a:	e8 41 a0 ff ff       	call   80102870 <ilock>
+    if(ip->type == T_DIR && !(omode == O_RDONLY || omode == O_LOOKUP)){
+8010882f:	83 c4 10             	add    $0x10,%esp
+80108832:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+80108837:	0f 84 13 01 00 00    	je     80108950 <sys_open+0x190>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+8010883d:	e8 fe 89 ff ff       	call   80101240 <filealloc>
+80108842:	89 c7                	mov    %eax,%edi
+80108844:	85 c0                	test   %eax,%eax
+80108846:	74 24                	je     8010886c <sys_open+0xac>
+  struct proc *curproc = myproc();
+80108848:	e8 d3 e0 ff ff       	call   80106920 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010884d:	31 db                	xor    %ebx,%ebx
+8010884f:	90                   	nop
+    if(curproc->ofile[fd] == 0){
+80108850:	8b 54 98 2c          	mov    0x2c(%eax,%ebx,4),%edx
+80108854:	85 d2                	test   %edx,%edx
+80108856:	74 48                	je     801088a0 <sys_open+0xe0>
+  for(fd = 0; fd < NOFILE; fd++){
+80108858:	83 c3 01             	add    $0x1,%ebx
+8010885b:	83 fb 10             	cmp    $0x10,%ebx
+8010885e:	75 f0                	jne    80108850 <sys_open+0x90>
+    if(f)
+      fileclose(f);
+80108860:	83 ec 0c             	sub    $0xc,%esp
+80108863:	57                   	push   %edi
+80108864:	e8 47 8a ff ff       	call   801012b0 <fileclose>
+80108869:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010886c:	83 ec 0c             	sub    $0xc,%esp
+8010886f:	56                   	push   %esi
+80108870:	e8 0b a7 ff ff       	call   80102f80 <iunlockput>
+    end_op();
+80108875:	e8 06 cf ff ff       	call   80105780 <end_op>
+    return -1;
+8010887a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010887d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108882:	eb 55                	jmp    801088d9 <sys_open+0x119>
+80108884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ip = nameilink(path);
+80108888:	83 ec 0c             	sub    $0xc,%esp
+8010888b:	52                   	push   %edx
+8010888c:	e8 8f b8 ff ff       	call   80104120 <nameilink>
+80108891:	83 c4 10             	add    $0x10,%esp
+80108894:	89 c6                	mov    %eax,%esi
+80108896:	e9 83 ff ff ff       	jmp    8010881e <sys_open+0x5e>
+8010889b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010889f:	90                   	nop
+  }
+  iunlock(ip);
+801088a0:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801088a3:	89 7c 98 2c          	mov    %edi,0x2c(%eax,%ebx,4)
+  iunlock(ip);
+801088a7:	56                   	push   %esi
+801088a8:	e8 b3 a0 ff ff       	call   80102960 <iunlock>
+  end_op();
+801088ad:	e8 ce ce ff ff       	call   80105780 <end_op>
+
+  f->type = FD_INODE;
+801088b2:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+801088b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801088bb:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+801088be:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+801088c1:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+801088c3:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+801088ca:	f7 d0                	not    %eax
+801088cc:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801088cf:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+801088d2:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801088d5:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+801088d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801088dc:	89 d8                	mov    %ebx,%eax
+801088de:	5b                   	pop    %ebx
+801088df:	5e                   	pop    %esi
+801088e0:	5f                   	pop    %edi
+801088e1:	5d                   	pop    %ebp
+801088e2:	c3                   	ret
+801088e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801088e7:	90                   	nop
+    ip = create(path, T_FILE, 0, 0);
+801088e8:	83 ec 0c             	sub    $0xc,%esp
+801088eb:	31 c9                	xor    %ecx,%ecx
+801088ed:	ba 02 00 00 00       	mov    $0x2,%edx
+801088f2:	6a 00                	push   $0x0
+801088f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801088f7:	e8 b4 f7 ff ff       	call   801080b0 <create>
+    if(ip == 0){
+801088fc:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801088ff:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108901:	85 c0                	test   %eax,%eax
+80108903:	74 5d                	je     80108962 <sys_open+0x1a2>
+    if((omode & O_EXTENT) && ip->type == T_FILE && ip->size == 0 &&
+80108905:	f6 45 e5 04          	testb  $0x4,-0x1b(%ebp)
+80108909:	0f 84 2e ff ff ff    	je     8010883d <sys_open+0x7d>
+8010890f:	66 83 78 5c 02       	cmpw   $0x2,0x5c(%eax)
+80108914:	0f 85 23 ff ff ff    	jne    8010883d <sys_open+0x7d>
+8010891a:	8b 48 68             	mov    0x68(%eax),%ecx
+8010891d:	85 c9                	test   %ecx,%ecx
+8010891f:	0f 85 18 ff ff ff    	jne    8010883d <sys_open+0x7d>
+       !(ip->flags & I_EXTENT)){
+80108925:	0f b7 40 5e          	movzwl 0x5e(%eax),%eax
+    if((omode & O_EXTENT) && ip->type == T_FILE && ip->size == 0 &&
+80108929:	a8 01                	test   $0x1,%al
+8010892b:	0f 85 0c ff ff ff    	jne    8010883d <sys_open+0x7d>
+      iupdate(ip);
+80108931:	83 ec 0c             	sub    $0xc,%esp
+      ip->flags |= I_EXTENT;
+80108934:	83 c8 01             	or     $0x1,%eax
+80108937:	66 89 46 5e          	mov    %ax,0x5e(%esi)
+      iupdate(ip);
+8010893b:	56                   	push   %esi
+8010893c:	e8 3f 9e ff ff       	call   80102780 <iupdate>
+80108941:	83 c4 10             	add    $0x10,%esp
+80108944:	e9 f4 fe ff ff       	jmp    8010883d <sys_open+0x7d>
+80108949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->type == T_DIR && !(omode == O_RDONLY || omode == O_LOOKUP)){
+80108950:	f7 45 e4 fb ff ff ff 	testl  $0xfffffffb,-0x1c(%ebp)
+80108957:	0f 84 e0 fe ff ff    	je     8010883d <sys_open+0x7d>
+8010895d:	e9 0a ff ff ff       	jmp    8010886c <sys_open+0xac>
+      end_op();
+80108962:	e8 19 ce ff ff       	call   80105780 <end_op>
+      return -1;
+80108967:	e9 11 ff ff ff       	jmp    8010887d <sys_open+0xbd>
+8010896c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108970 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80108970:	55                   	push   %ebp
+80108971:	89 e5                	mov    %esp,%ebp
+80108973:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108976:	e8 85 cd ff ff       	call   80105700 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010897b:	83 ec 08             	sub    $0x8,%esp
+8010897e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108981:	50                   	push   %eax
+80108982:	6a 00                	push   $0x0
+80108984:	e8 37 f6 ff ff       	call   80107fc0 <argstr>
+80108989:	83 c4 10             	add    $0x10,%esp
+8010898c:	85 c0                	test   %eax,%eax
+8010898e:	78 30                	js     801089c0 <sys_mkdir+0x50>
+80108990:	83 ec 0c             	sub    $0xc,%esp
+80108993:	31 c9                	xor    %ecx,%ecx
+80108995:	ba 01 00 00 00       	mov    $0x1,%edx
+8010899a:	6a 00                	push   $0x0
+8010899c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010899f:	e8 0c f7 ff ff       	call   801080b0 <create>
+801089a4:	83 c4 10             	add    $0x10,%esp
+801089a7:	85 c0                	test   %eax,%eax
+801089a9:	74 15                	je     801089c0 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801089ab:	83 ec 0c             	sub    $0xc,%esp
+801089ae:	50                   	push   %eax
+801089af:	e8 cc a5 ff ff       	call   80102f80 <iunlockput>
+  end_op();
+801089b4:	e8 c7 cd ff ff       	call   80105780 <end_op>
+  return 0;
+801089b9:	83 c4 10             	add    $0x10,%esp
+801089bc:	31 c0                	xor    %eax,%eax
+}
+801089be:	c9                   	leave
+801089bf:	c3                   	ret
+    end_op();
+801089c0:	e8 bb cd ff ff       	call   80105780 <end_op>
+    return -1;
+801089c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801089ca:	c9                   	leave
+801089cb:	c3                   	ret
+801089cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801089d0 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+801089d0:	55                   	push   %ebp
+801089d1:	89 e5                	mov    %esp,%ebp
+801089d3:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+801089d6:	e8 25 cd ff ff       	call   80105700 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801089db:	83 ec 08             	sub    $0x8,%esp
+801089de:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801089e1:	50                   	push   %eax
+801089e2:	6a 00                	push   $0x0
+801089e4:	e8 d7 f5 ff ff       	call   80107fc0 <argstr>
+801089e9:	83 c4 10             	add    $0x10,%esp
+801089ec:	85 c0                	test   %eax,%eax
+801089ee:	78 60                	js     80108a50 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+801089f0:	83 ec 08             	sub    $0x8,%esp
+801089f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801089f6:	50                   	push   %eax
+801089f7:	6a 01                	push   $0x1
+801089f9:	e8 02 f5 ff ff       	call   80107f00 <argint>
+  if((argstr(0, &path)) < 0 ||
+801089fe:	83 c4 10             	add    $0x10,%esp
+80108a01:	85 c0                	test   %eax,%eax
+80108a03:	78 4b                	js     80108a50 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+80108a05:	83 ec 08             	sub    $0x8,%esp
+80108a08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a0b:	50                   	push   %eax
+80108a0c:	6a 02                	push   $0x2
+80108a0e:	e8 ed f4 ff ff       	call   80107f00 <argint>
+     argint(1, &major) < 0 ||
+80108a13:	83 c4 10             	add    $0x10,%esp
+80108a16:	85 c0                	test   %eax,%eax
+80108a18:	78 36                	js     80108a50 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108a1a:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+80108a1e:	83 ec 0c             	sub    $0xc,%esp
+80108a21:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108a25:	ba 03 00 00 00       	mov    $0x3,%edx
+80108a2a:	50                   	push   %eax
+80108a2b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108a2e:	e8 7d f6 ff ff       	call   801080b0 <create>
+     argint(2, &minor) < 0 ||
+80108a33:	83 c4 10             	add    $0x10,%esp
+80108a36:	85 c0                	test   %eax,%eax
+80108a38:	74 16                	je     80108a50 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108a3a:	83 ec 0c             	sub    $0xc,%esp
+80108a3d:	50                   	push   %eax
+80108a3e:	e8 3d a5 ff ff       	call   80102f80 <iunlockput>
+  end_op();
+80108a43:	e8 38 cd ff ff       	call   80105780 <end_op>
+  return 0;
+80108a48:	83 c4 10             	add    $0x10,%esp
+80108a4b:	31 c0                	xor    %eax,%eax
+}
+80108a4d:	c9                   	leave
+80108a4e:	c3                   	ret
+80108a4f:	90                   	nop
+    end_op();
+80108a50:	e8 2b cd ff ff       	call   80105780 <end_op>
+    return -1;
+80108a55:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108a5a:	c9                   	leave
+80108a5b:	c3                   	ret
+80108a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108a60 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80108a60:	55                   	push   %ebp
+80108a61:	89 e5                	mov    %esp,%ebp
+80108a63:	56                   	push   %esi
+80108a64:	53                   	push   %ebx
+80108a65:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80108a68:	e8 b3 de ff ff       	call   80106920 <myproc>
+80108a6d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+80108a6f:	e8 8c cc ff ff       	call   80105700 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108a74:	83 ec 08             	sub    $0x8,%esp
+80108a77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a7a:	50                   	push   %eax
+80108a7b:	6a 00                	push   $0x0
+80108a7d:	e8 3e f5 ff ff       	call   80107fc0 <argstr>
+80108a82:	83 c4 10             	add    $0x10,%esp
+80108a85:	85 c0                	test   %eax,%eax
+80108a87:	78 77                	js     80108b00 <sys_chdir+0xa0>
+80108a89:	83 ec 0c             	sub    $0xc,%esp
+80108a8c:	ff 75 f4             	push   -0xc(%ebp)
+80108a8f:	e8 6c b6 ff ff       	call   80104100 <namei>
+80108a94:	83 c4 10             	add    $0x10,%esp
+80108a97:	89 c3                	mov    %eax,%ebx
+80108a99:	85 c0                	test   %eax,%eax
+80108a9b:	74 63                	je     80108b00 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80108a9d:	83 ec 0c             	sub    $0xc,%esp
+80108aa0:	50                   	push   %eax
+80108aa1:	e8 ca 9d ff ff       	call   80102870 <ilock>
+  if(ip->type != T_DIR){
+80108aa6:	83 c4 10             	add    $0x10,%esp
+80108aa9:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80108aae:	75 30                	jne    80108ae0 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108ab0:	83 ec 0c             	sub    $0xc,%esp
+80108ab3:	53                   	push   %ebx
+80108ab4:	e8 a7 9e ff ff       	call   80102960 <iunlock>
+  iput(curproc->cwd);
+80108ab9:	58                   	pop    %eax
+80108aba:	ff 76 6c             	push   0x6c(%esi)
+80108abd:	e8 ee 9e ff ff       	call   801029b0 <iput>
+  end_op();
+80108ac2:	e8 b9 cc ff ff       	call   80105780 <end_op>
+  curproc->cwd = ip;
+80108ac7:	89 5e 6c             	mov    %ebx,0x6c(%esi)
+  return 0;
+80108aca:	83 c4 10             	add    $0x10,%esp
+80108acd:	31 c0                	xor    %eax,%eax
+}
+80108acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108ad2:	5b                   	pop    %ebx
+80108ad3:	5e                   	pop    %esi
+80108ad4:	5d                   	pop    %ebp
+80108ad5:	c3                   	ret
+80108ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108add:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80108ae0:	83 ec 0c             	sub    $0xc,%esp
+80108ae3:	53                   	push   %ebx
+80108ae4:	e8 97 a4 ff ff       	call   80102f80 <iunlockput>
+    end_op();
+80108ae9:	e8 92 cc ff ff       	call   80105780 <end_op>
+    return -1;
+80108aee:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108af1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108af6:	eb d7                	jmp    80108acf <sys_chdir+0x6f>
+80108af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aff:	90                   	nop
+    end_op();
+80108b00:	e8 7b cc ff ff       	call   80105780 <end_op>
+    return -1;
+80108b05:	eb ea                	jmp    80108af1 <sys_chdir+0x91>
+80108b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b0e:	66 90                	xchg   %ax,%ax
+
+80108b10 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108b10:	55                   	push   %ebp
+80108b11:	89 e5                	mov    %esp,%ebp
+80108b13:	57                   	push   %edi
+80108b14:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108b15:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+80108b1b:	53                   	push   %ebx
+80108b1c:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108b22:	50                   	push   %eax
+80108b23:	6a 00                	push   $0x0
+80108b25:	e8 96 f4 ff ff       	call   80107fc0 <argstr>
+80108b2a:	83 c4 10             	add    $0x10,%esp
+80108b2d:	85 c0                	test   %eax,%eax
+80108b2f:	0f 88 87 00 00 00    	js     80108bbc <sys_exec+0xac>
+80108b35:	83 ec 08             	sub    $0x8,%esp
+80108b38:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+80108b3e:	50                   	push   %eax
+80108b3f:	6a 01                	push   $0x1
+80108b41:	e8 ba f3 ff ff       	call   80107f00 <argint>
+80108b46:	83 c4 10             	add    $0x10,%esp
+80108b49:	85 c0                	test   %eax,%eax
+80108b4b:	78 6f                	js     80108bbc <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80108b4d:	83 ec 04             	sub    $0x4,%esp
+80108b50:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80108b56:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80108b58:	68 80 00 00 00       	push   $0x80
+80108b5d:	6a 00                	push   $0x0
+80108b5f:	56                   	push   %esi
+80108b60:	e8 eb f0 ff ff       	call   80107c50 <memset>
+80108b65:	83 c4 10             	add    $0x10,%esp
+80108b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b6f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80108b70:	83 ec 08             	sub    $0x8,%esp
+80108b73:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80108b79:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108b80:	50                   	push   %eax
+80108b81:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108b87:	01 f8                	add    %edi,%eax
+80108b89:	50                   	push   %eax
+80108b8a:	e8 e1 f2 ff ff       	call   80107e70 <fetchint>
+80108b8f:	83 c4 10             	add    $0x10,%esp
+80108b92:	85 c0                	test   %eax,%eax
+80108b94:	78 26                	js     80108bbc <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108b96:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+80108b9c:	85 c0                	test   %eax,%eax
+80108b9e:	74 30                	je     80108bd0 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108ba0:	83 ec 08             	sub    $0x8,%esp
+80108ba3:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108ba6:	52                   	push   %edx
+80108ba7:	50                   	push   %eax
+80108ba8:	e8 03 f3 ff ff       	call   80107eb0 <fetchstr>
+80108bad:	83 c4 10             	add    $0x10,%esp
+80108bb0:	85 c0                	test   %eax,%eax
+80108bb2:	78 08                	js     80108bbc <sys_exec+0xac>
+  for(i=0;; i++){
+80108bb4:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108bb7:	83 fb 20             	cmp    $0x20,%ebx
+80108bba:	75 b4                	jne    80108b70 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+80108bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80108bbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108bc4:	5b                   	pop    %ebx
+80108bc5:	5e                   	pop    %esi
+80108bc6:	5f                   	pop    %edi
+80108bc7:	5d                   	pop    %ebp
+80108bc8:	c3                   	ret
+80108bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80108bd0:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80108bd7:	00 00 00 00 
+  return exec(path, argv);
+80108bdb:	83 ec 08             	sub    $0x8,%esp
+80108bde:	56                   	push   %esi
+80108bdf:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80108be5:	e8 a6 82 ff ff       	call   80100e90 <exec>
+80108bea:	83 c4 10             	add    $0x10,%esp
+}
+80108bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108bf0:	5b                   	pop    %ebx
+80108bf1:	5e                   	pop    %esi
+80108bf2:	5f                   	pop    %edi
+80108bf3:	5d                   	pop    %ebp
+80108bf4:	c3                   	ret
+80108bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108c00 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80108c00:	55                   	push   %ebp
+80108c01:	89 e5                	mov    %esp,%ebp
+80108c03:	57                   	push   %edi
+80108c04:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108c05:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+80108c08:	53                   	push   %ebx
+80108c09:	83 ec 20             	sub    $0x20,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108c0c:	6a 08                	push   $0x8
+80108c0e:	50                   	push   %eax
+80108c0f:	6a 00                	push   $0x0
+80108c11:	e8 3a f3 ff ff       	call   80107f50 <argptr>
+80108c16:	83 c4 10             	add    $0x10,%esp
+80108c19:	85 c0                	test   %eax,%eax
+80108c1b:	0f 88 8b 00 00 00    	js     80108cac <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108c21:	83 ec 08             	sub    $0x8,%esp
+80108c24:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108c27:	50                   	push   %eax
+80108c28:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108c2b:	50                   	push   %eax
+80108c2c:	e8 7f d2 ff ff       	call   80105eb0 <pipealloc>
+80108c31:	83 c4 10             	add    $0x10,%esp
+80108c34:	85 c0                	test   %eax,%eax
+80108c36:	78 74                	js     80108cac <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108c38:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+80108c3b:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+80108c3d:	e8 de dc ff ff       	call   80106920 <myproc>
+    if(curproc->ofile[fd] == 0){
+80108c42:	8b 74 98 2c          	mov    0x2c(%eax,%ebx,4),%esi
+80108c46:	85 f6                	test   %esi,%esi
+80108c48:	74 16                	je     80108c60 <sys_pipe+0x60>
+80108c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80108c50:	83 c3 01             	add    $0x1,%ebx
+80108c53:	83 fb 10             	cmp    $0x10,%ebx
+80108c56:	74 3d                	je     80108c95 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80108c58:	8b 74 98 2c          	mov    0x2c(%eax,%ebx,4),%esi
+80108c5c:	85 f6                	test   %esi,%esi
+80108c5e:	75 f0                	jne    80108c50 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80108c60:	8d 73 08             	lea    0x8(%ebx),%esi
+80108c63:	89 7c b0 0c          	mov    %edi,0xc(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108c67:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+80108c6a:	e8 b1 dc ff ff       	call   80106920 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108c6f:	31 d2                	xor    %edx,%edx
+80108c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80108c78:	8b 4c 90 2c          	mov    0x2c(%eax,%edx,4),%ecx
+80108c7c:	85 c9                	test   %ecx,%ecx
+80108c7e:	74 38                	je     80108cb8 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80108c80:	83 c2 01             	add    $0x1,%edx
+80108c83:	83 fa 10             	cmp    $0x10,%edx
+80108c86:	75 f0                	jne    80108c78 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80108c88:	e8 93 dc ff ff       	call   80106920 <myproc>
+80108c8d:	c7 44 b0 0c 00 00 00 	movl   $0x0,0xc(%eax,%esi,4)
+80108c94:	00 
+    fileclose(rf);
+80108c95:	83 ec 0c             	sub    $0xc,%esp
+80108c98:	ff 75 e0             	push   -0x20(%ebp)
+80108c9b:	e8 10 86 ff ff       	call   801012b0 <fileclose>
+    fileclose(wf);
+80108ca0:	58                   	pop    %eax
+80108ca1:	ff 75 e4             	push   -0x1c(%ebp)
+80108ca4:	e8 07 86 ff ff       	call   801012b0 <fileclose>
+    return -1;
+80108ca9:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108cac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108cb1:	eb 16                	jmp    80108cc9 <sys_pipe+0xc9>
+80108cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108cb7:	90                   	nop
+      curproc->ofile[fd] = f;
+80108cb8:	89 7c 90 2c          	mov    %edi,0x2c(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+80108cbc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108cbf:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+80108cc1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108cc4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+80108cc7:	31 c0                	xor    %eax,%eax
+}
+80108cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108ccc:	5b                   	pop    %ebx
+80108ccd:	5e                   	pop    %esi
+80108cce:	5f                   	pop    %edi
+80108ccf:	5d                   	pop    %ebp
+80108cd0:	c3                   	ret
+80108cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108cdf:	90                   	nop
+
+80108ce0 <sys_pipesize>:
+
+// Set the capacity of a pipe; see pipesize() in pipe.c.
+int
+sys_pipesize(void)
+{
+80108ce0:	55                   	push   %ebp
+80108ce1:	89 e5                	mov    %esp,%ebp
+80108ce3:	56                   	push   %esi
+80108ce4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108ce5:	8d 75 f4             	lea    -0xc(%ebp),%esi
+{
+80108ce8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108ceb:	56                   	push   %esi
+80108cec:	6a 00                	push   $0x0
+80108cee:	e8 0d f2 ff ff       	call   80107f00 <argint>
+80108cf3:	83 c4 10             	add    $0x10,%esp
+80108cf6:	85 c0                	test   %eax,%eax
+80108cf8:	78 46                	js     80108d40 <sys_pipesize+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108cfa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108cfe:	77 40                	ja     80108d40 <sys_pipesize+0x60>
+80108d00:	e8 1b dc ff ff       	call   80106920 <myproc>
+80108d05:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108d08:	8b 5c 90 2c          	mov    0x2c(%eax,%edx,4),%ebx
+80108d0c:	85 db                	test   %ebx,%ebx
+80108d0e:	74 30                	je     80108d40 <sys_pipesize+0x60>
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0)
+80108d10:	83 ec 08             	sub    $0x8,%esp
+80108d13:	56                   	push   %esi
+80108d14:	6a 01                	push   $0x1
+80108d16:	e8 e5 f1 ff ff       	call   80107f00 <argint>
+80108d1b:	83 c4 10             	add    $0x10,%esp
+80108d1e:	85 c0                	test   %eax,%eax
+80108d20:	78 1e                	js     80108d40 <sys_pipesize+0x60>
+    return -1;
+  if(f->type != FD_PIPE)
+80108d22:	83 3b 01             	cmpl   $0x1,(%ebx)
+80108d25:	75 19                	jne    80108d40 <sys_pipesize+0x60>
+    return -1;
+  return pipesize(f->pipe, n);
+80108d27:	83 ec 08             	sub    $0x8,%esp
+80108d2a:	ff 75 f4             	push   -0xc(%ebp)
+80108d2d:	ff 73 0c             	push   0xc(%ebx)
+80108d30:	e8 6b d2 ff ff       	call   80105fa0 <pipesize>
+80108d35:	83 c4 10             	add    $0x10,%esp
+}
+80108d38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108d3b:	5b                   	pop    %ebx
+80108d3c:	5e                   	pop    %esi
+80108d3d:	5d                   	pop    %ebp
+80108d3e:	c3                   	ret
+80108d3f:	90                   	nop
+    return -1;
+80108d40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d45:	eb f1                	jmp    80108d38 <sys_pipesize+0x58>
+80108d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d4e:	66 90                	xchg   %ax,%ax
+
+80108d50 <sys_readahead>:
+
+// Set the file read-ahead window; see setreadahead() in fs.c.
+int
+sys_readahead(void)
+{
+80108d50:	55                   	push   %ebp
+80108d51:	89 e5                	mov    %esp,%ebp
+80108d53:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108d56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d59:	50                   	push   %eax
+80108d5a:	6a 00                	push   $0x0
+80108d5c:	e8 9f f1 ff ff       	call   80107f00 <argint>
+80108d61:	83 c4 10             	add    $0x10,%esp
+80108d64:	85 c0                	test   %eax,%eax
+80108d66:	78 18                	js     80108d80 <sys_readahead+0x30>
+    return -1;
+  return setreadahead(n);
+80108d68:	83 ec 0c             	sub    $0xc,%esp
+80108d6b:	ff 75 f4             	push   -0xc(%ebp)
+80108d6e:	e8 8d a2 ff ff       	call   80103000 <setreadahead>
+80108d73:	83 c4 10             	add    $0x10,%esp
+}
+80108d76:	c9                   	leave
+80108d77:	c3                   	ret
+80108d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d7f:	90                   	nop
+80108d80:	c9                   	leave
+    return -1;
+80108d81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108d86:	c3                   	ret
+80108d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d8e:	66 90                	xchg   %ax,%ax
+
+80108d90 <sys_symlink>:
+
+// Make symbolic linked file.
+int
+sys_symlink(void)
+{
+80108d90:	55                   	push   %ebp
+80108d91:	89 e5                	mov    %esp,%ebp
+80108d93:	56                   	push   %esi
+80108d94:	53                   	push   %ebx
+  char *oldpath, *newpath;
+  struct inode *ip;
+  int n;
+
+  if ((n = argstr(0, &oldpath)) < 0 || argstr(1, &newpath) < 0) {
+80108d95:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+80108d98:	83 ec 18             	sub    $0x18,%esp
+  if ((n = argstr(0, &oldpath)) < 0 || argstr(1, &newpath) < 0) {
+80108d9b:	50                   	push   %eax
+80108d9c:	6a 00                	push   $0x0
+80108d9e:	e8 1d f2 ff ff       	call   80107fc0 <argstr>
+80108da3:	83 c4 10             	add    $0x10,%esp
+80108da6:	85 c0                	test   %eax,%eax
+80108da8:	78 76                	js     80108e20 <sys_symlink+0x90>
+80108daa:	83 ec 08             	sub    $0x8,%esp
+80108dad:	89 c3                	mov    %eax,%ebx
+80108daf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108db2:	50                   	push   %eax
+80108db3:	6a 01                	push   $0x1
+80108db5:	e8 06 f2 ff ff       	call   80107fc0 <argstr>
+80108dba:	83 c4 10             	add    $0x10,%esp
+80108dbd:	85 c0                	test   %eax,%eax
+80108dbf:	78 5f                	js     80108e20 <sys_symlink+0x90>
+    return -1;
+  }
+  if (n == 0 || n >= MAXPATH) {
+80108dc1:	85 db                	test   %ebx,%ebx
+80108dc3:	74 5b                	je     80108e20 <sys_symlink+0x90>
+80108dc5:	83 fb 7f             	cmp    $0x7f,%ebx
+80108dc8:	7f 56                	jg     80108e20 <sys_symlink+0x90>
+    return -1;
+  }
+
+  begin_op();
+80108dca:	e8 31 c9 ff ff       	call   80105700 <begin_op>
+
+  ip = create(newpath, T_SYMLINK, 0, 0);
+80108dcf:	83 ec 0c             	sub    $0xc,%esp
+80108dd2:	31 c9                	xor    %ecx,%ecx
+80108dd4:	ba 04 00 00 00       	mov    $0x4,%edx
+80108dd9:	6a 00                	push   $0x0
+80108ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108dde:	e8 cd f2 ff ff       	call   801080b0 <create>
+  if (ip == 0) {
+80108de3:	83 c4 10             	add    $0x10,%esp
+  ip = create(newpath, T_SYMLINK, 0, 0);
+80108de6:	89 c6                	mov    %eax,%esi
+  if (ip == 0) {
+80108de8:	85 c0                	test   %eax,%eax
+80108dea:	74 26                	je     80108e12 <sys_symlink+0x82>
+    end_op();
+    return -1;
+  }
+
+  writelink(ip, oldpath, n);
+80108dec:	83 ec 04             	sub    $0x4,%esp
+80108def:	53                   	push   %ebx
+80108df0:	ff 75 f0             	push   -0x10(%ebp)
+80108df3:	50                   	push   %eax
+80108df4:	e8 27 a8 ff ff       	call   80103620 <writelink>
+  iunlockput(ip);
+80108df9:	89 34 24             	mov    %esi,(%esp)
+80108dfc:	e8 7f a1 ff ff       	call   80102f80 <iunlockput>
+
+  end_op();
+80108e01:	e8 7a c9 ff ff       	call   80105780 <end_op>
+  return 0;
+80108e06:	83 c4 10             	add    $0x10,%esp
+80108e09:	31 c0                	xor    %eax,%eax
+}
+80108e0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108e0e:	5b                   	pop    %ebx
+80108e0f:	5e                   	pop    %esi
+80108e10:	5d                   	pop    %ebp
+80108e11:	c3                   	ret
+    end_op();
+80108e12:	e8 69 c9 ff ff       	call   80105780 <end_op>
+    return -1;
+80108e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e1e:	66 90                	xchg   %ax,%ax
+    return -1;
+80108e20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e25:	eb e4                	jmp    80108e0b <sys_symlink+0x7b>
+80108e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e2e:	66 90                	xchg   %ax,%ax
+
+80108e30 <sys_sync>:
+
+int
+sys_sync(void)
+{
+  return sync(); 
+80108e30:	e9 1b ca ff ff       	jmp    80105850 <sync>
+80108e35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108e40 <sys_iostat>:
+}
+
+// Copy the disk request counters to user space.
+int
+sys_iostat(void)
+{
+80108e40:	55                   	push   %ebp
+80108e41:	89 e5                	mov    %esp,%ebp
+80108e43:	83 ec 1c             	sub    $0x1c,%esp
+  struct iostat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+80108e46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e49:	6a 0c                	push   $0xc
+80108e4b:	50                   	push   %eax
+80108e4c:	6a 00                	push   $0x0
+80108e4e:	e8 fd f0 ff ff       	call   80107f50 <argptr>
+80108e53:	83 c4 10             	add    $0x10,%esp
+80108e56:	85 c0                	test   %eax,%eax
+80108e58:	78 16                	js     80108e70 <sys_iostat+0x30>
+    return -1;
+  ideiostat(st);
+80108e5a:	83 ec 0c             	sub    $0xc,%esp
+80108e5d:	ff 75 f4             	push   -0xc(%ebp)
+80108e60:	e8 2b b8 ff ff       	call   80104690 <ideiostat>
+  return 0;
+80108e65:	83 c4 10             	add    $0x10,%esp
+80108e68:	31 c0                	xor    %eax,%eax
+}
+80108e6a:	c9                   	leave
+80108e6b:	c3                   	ret
+80108e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108e70:	c9                   	leave
+    return -1;
+80108e71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108e76:	c3                   	ret
+80108e77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e7e:	66 90                	xchg   %ax,%ax
+
+80108e80 <sys_dcstat>:
+
+// Copy the name cache counters to user space.
+int
+sys_dcstat(void)
+{
+80108e80:	55                   	push   %ebp
+80108e81:	89 e5                	mov    %esp,%ebp
+80108e83:	83 ec 1c             	sub    $0x1c,%esp
+  struct dcstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+80108e86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e89:	6a 0c                	push   $0xc
+80108e8b:	50                   	push   %eax
+80108e8c:	6a 00                	push   $0x0
+80108e8e:	e8 bd f0 ff ff       	call   80107f50 <argptr>
+80108e93:	83 c4 10             	add    $0x10,%esp
+80108e96:	85 c0                	test   %eax,%eax
+80108e98:	78 16                	js     80108eb0 <sys_dcstat+0x30>
+    return -1;
+  dcachestat(st);
+80108e9a:	83 ec 0c             	sub    $0xc,%esp
+80108e9d:	ff 75 f4             	push   -0xc(%ebp)
+80108ea0:	e8 bb a9 ff ff       	call   80103860 <dcachestat>
+  return 0;
+80108ea5:	83 c4 10             	add    $0x10,%esp
+80108ea8:	31 c0                	xor    %eax,%eax
+}
+80108eaa:	c9                   	leave
+80108eab:	c3                   	ret
+80108eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108eb0:	c9                   	leave
+    return -1;
+80108eb1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108eb6:	c3                   	ret
+80108eb7:	66 90                	xchg   %ax,%ax
+80108eb9:	66 90                	xchg   %ax,%ax
+80108ebb:	66 90                	xchg   %ax,%ax
+80108ebd:	66 90                	xchg   %ax,%ax
+80108ebf:	90                   	nop
+
+80108ec0 <sys_fork>:
+#include "proc.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+80108ec0:	e9 0b dd ff ff       	jmp    80106bd0 <fork>
+80108ec5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108ed0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80108ed0:	55                   	push   %ebp
+80108ed1:	89 e5                	mov    %esp,%ebp
+80108ed3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108ed6:	e8 d5 df ff ff       	call   80106eb0 <exit>
+  return 0;  // not reached
+}
+80108edb:	31 c0                	xor    %eax,%eax
+80108edd:	c9                   	leave
+80108ede:	c3                   	ret
+80108edf:	90                   	nop
+
+80108ee0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80108ee0:	e9 ab e0 ff ff       	jmp    80106f90 <wait>
+80108ee5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108ef0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80108ef0:	55                   	push   %ebp
+80108ef1:	89 e5                	mov    %esp,%ebp
+80108ef3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108ef6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ef9:	50                   	push   %eax
+80108efa:	6a 00                	push   $0x0
+80108efc:	e8 ff ef ff ff       	call   80107f00 <argint>
+80108f01:	83 c4 10             	add    $0x10,%esp
+80108f04:	85 c0                	test   %eax,%eax
+80108f06:	78 18                	js     80108f20 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80108f08:	83 ec 0c             	sub    $0xc,%esp
+80108f0b:	ff 75 f4             	push   -0xc(%ebp)
+80108f0e:	e8 ad e3 ff ff       	call   801072c0 <kill>
+80108f13:	83 c4 10             	add    $0x10,%esp
+}
+80108f16:	c9                   	leave
+80108f17:	c3                   	ret
+80108f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f1f:	90                   	nop
+80108f20:	c9                   	leave
+    return -1;
+80108f21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108f26:	c3                   	ret
+80108f27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f2e:	66 90                	xchg   %ax,%ax
+
+80108f30 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108f30:	55                   	push   %ebp
+80108f31:	89 e5                	mov    %esp,%ebp
+80108f33:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108f36:	e8 e5 d9 ff ff       	call   80106920 <myproc>
+80108f3b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80108f3e:	c9                   	leave
+80108f3f:	c3                   	ret
+
+80108f40 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108f40:	55                   	push   %ebp
+80108f41:	89 e5                	mov    %esp,%ebp
+80108f43:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108f44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108f47:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80108f4a:	50                   	push   %eax
+80108f4b:	6a 00                	push   $0x0
+80108f4d:	e8 ae ef ff ff       	call   80107f00 <argint>
+80108f52:	83 c4 10             	add    $0x10,%esp
+80108f55:	85 c0                	test   %eax,%eax
+80108f57:	78 27                	js     80108f80 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80108f59:	e8 c2 d9 ff ff       	call   80106920 <myproc>
+  if(growproc(n) < 0)
+80108f5e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80108f61:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108f63:	ff 75 f4             	push   -0xc(%ebp)
+80108f66:	e8 f5 db ff ff       	call   80106b60 <growproc>
+80108f6b:	83 c4 10             	add    $0x10,%esp
+80108f6e:	85 c0                	test   %eax,%eax
+80108f70:	78 0e                	js     80108f80 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108f72:	89 d8                	mov    %ebx,%eax
+80108f74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108f77:	c9                   	leave
+80108f78:	c3                   	ret
+80108f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108f80:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108f85:	eb eb                	jmp    80108f72 <sys_sbrk+0x32>
+80108f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f8e:	66 90                	xchg   %ax,%ax
+
+80108f90 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108f90:	55                   	push   %ebp
+80108f91:	89 e5                	mov    %esp,%ebp
+80108f93:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80108f94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108f97:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80108f9a:	50                   	push   %eax
+80108f9b:	6a 00                	push   $0x0
+80108f9d:	e8 5e ef ff ff       	call   80107f00 <argint>
+80108fa2:	83 c4 10             	add    $0x10,%esp
+80108fa5:	85 c0                	test   %eax,%eax
+80108fa7:	78 64                	js     8010900d <sys_sleep+0x7d>
+    return -1;
+  acquire(&tickslock);
+80108fa9:	83 ec 0c             	sub    $0xc,%esp
+80108fac:	68 c0 84 15 80       	push   $0x801584c0
+80108fb1:	e8 ba eb ff ff       	call   80107b70 <acquire>
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+80108fb6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  ticks0 = ticks;
+80108fb9:	8b 1d a0 84 15 80    	mov    0x801584a0,%ebx
+  while(ticks - ticks0 < n){
+80108fbf:	83 c4 10             	add    $0x10,%esp
+80108fc2:	85 d2                	test   %edx,%edx
+80108fc4:	75 2b                	jne    80108ff1 <sys_sleep+0x61>
+80108fc6:	eb 58                	jmp    80109020 <sys_sleep+0x90>
+80108fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108fcf:	90                   	nop
+    if(myproc()->killed){
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80108fd0:	83 ec 08             	sub    $0x8,%esp
+80108fd3:	68 c0 84 15 80       	push   $0x801584c0
+80108fd8:	68 a0 84 15 80       	push   $0x801584a0
+80108fdd:	e8 9e e1 ff ff       	call   80107180 <sleep>
+  while(ticks - ticks0 < n){
+80108fe2:	a1 a0 84 15 80       	mov    0x801584a0,%eax
+80108fe7:	83 c4 10             	add    $0x10,%esp
+80108fea:	29 d8                	sub    %ebx,%eax
+80108fec:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80108fef:	73 2f                	jae    80109020 <sys_sleep+0x90>
+    if(myproc()->killed){
+80108ff1:	e8 2a d9 ff ff       	call   80106920 <myproc>
+80108ff6:	8b 40 28             	mov    0x28(%eax),%eax
+80108ff9:	85 c0                	test   %eax,%eax
+80108ffb:	74 d3                	je     80108fd0 <sys_sleep+0x40>
+      release(&tickslock);
+80108ffd:	83 ec 0c             	sub    $0xc,%esp
+80109000:	68 c0 84 15 80       	push   $0x801584c0
+80109005:	e8 06 eb ff ff       	call   80107b10 <release>
+      return -1;
+8010900a:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&tickslock);
+  return 0;
+}
+8010900d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80109010:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109015:	c9                   	leave
+80109016:	c3                   	ret
+80109017:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010901e:	66 90                	xchg   %ax,%ax
+  release(&tickslock);
+80109020:	83 ec 0c             	sub    $0xc,%esp
+80109023:	68 c0 84 15 80       	push   $0x801584c0
+80109028:	e8 e3 ea ff ff       	call   80107b10 <release>
+}
+8010902d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80109030:	83 c4 10             	add    $0x10,%esp
+80109033:	31 c0                	xor    %eax,%eax
+}
+80109035:	c9                   	leave
+80109036:	c3                   	ret
+80109037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010903e:	66 90                	xchg   %ax,%ax
+
+80109040 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80109040:	55                   	push   %ebp
+80109041:	89 e5                	mov    %esp,%ebp
+80109043:	53                   	push   %ebx
+80109044:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80109047:	68 c0 84 15 80       	push   $0x801584c0
+8010904c:	e8 1f eb ff ff       	call   80107b70 <acquire>
+  xticks = ticks;
+80109051:	8b 1d a0 84 15 80    	mov    0x801584a0,%ebx
+  release(&tickslock);
+80109057:	c7 04 24 c0 84 15 80 	movl   $0x801584c0,(%esp)
+8010905e:	e8 ad ea ff ff       	call   80107b10 <release>
+  return xticks;
+}
+80109063:	89 d8                	mov    %ebx,%eax
+80109065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109068:	c9                   	leave
+80109069:	c3                   	ret
+
+8010906a <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+8010906a:	1e                   	push   %ds
+  pushl %es
+8010906b:	06                   	push   %es
+  pushl %fs
+8010906c:	0f a0                	push   %fs
+  pushl %gs
+8010906e:	0f a8                	push   %gs
+  pushal
+80109070:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80109071:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80109075:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109077:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80109079:	54                   	push   %esp
+  call trap
+8010907a:	e8 c1 00 00 00       	call   80109140 <trap>
+  addl $4, %esp
+8010907f:	83 c4 04             	add    $0x4,%esp
+
+80109082 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80109082:	61                   	popa
+  popl %gs
+80109083:	0f a9                	pop    %gs
+  popl %fs
+80109085:	0f a1                	pop    %fs
+  popl %es
+80109087:	07                   	pop    %es
+  popl %ds
+80109088:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109089:	83 c4 08             	add    $0x8,%esp
+  iret
+8010908c:	cf                   	iret
+8010908d:	66 90                	xchg   %ax,%ax
+8010908f:	90                   	nop
+
+80109090 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+80109090:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109091:	31 c0                	xor    %eax,%eax
+{
+80109093:	89 e5                	mov    %esp,%ebp
+80109095:	83 ec 08             	sub    $0x8,%esp
+80109098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010909f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+801090a0:	8b 14 85 08 e0 10 80 	mov    -0x7fef1ff8(,%eax,4),%edx
+801090a7:	c7 04 c5 02 85 15 80 	movl   $0x8e000008,-0x7fea7afe(,%eax,8)
+801090ae:	08 00 00 8e 
+801090b2:	66 89 14 c5 00 85 15 	mov    %dx,-0x7fea7b00(,%eax,8)
+801090b9:	80 
+801090ba:	c1 ea 10             	shr    $0x10,%edx
+801090bd:	66 89 14 c5 06 85 15 	mov    %dx,-0x7fea7afa(,%eax,8)
+801090c4:	80 
+  for(i = 0; i < 256; i++)
+801090c5:	83 c0 01             	add    $0x1,%eax
+801090c8:	3d 00 01 00 00       	cmp    $0x100,%eax
+801090cd:	75 d1                	jne    801090a0 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801090cf:	a1 08 e1 10 80       	mov    0x8010e108,%eax
+
+  initlock(&tickslock, "time");
+801090d4:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801090d7:	c7 05 02 87 15 80 08 	movl   $0xef000008,0x80158702
+801090de:	00 00 ef 
+801090e1:	66 a3 00 87 15 80    	mov    %ax,0x80158700
+801090e7:	c1 e8 10             	shr    $0x10,%eax
+801090ea:	66 a3 06 87 15 80    	mov    %ax,0x80158706
+  initlock(&tickslock, "time");
+801090f0:	68 31 b6 10 80       	push   $0x8010b631
+801090f5:	68 c0 84 15 80       	push   $0x801584c0
+801090fa:	e8 91 e8 ff ff       	call   80107990 <initlock>
+}
+801090ff:	83 c4 10             	add    $0x10,%esp
+80109102:	c9                   	leave
+80109103:	c3                   	ret
+80109104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010910b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010910f:	90                   	nop
+
+80109110 <idtinit>:
+
+void
+idtinit(void)
+{
+80109110:	55                   	push   %ebp
+  pd[0] = size-1;
+80109111:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80109116:	89 e5                	mov    %esp,%ebp
+80109118:	83 ec 10             	sub    $0x10,%esp
+8010911b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010911f:	b8 00 85 15 80       	mov    $0x80158500,%eax
+80109124:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109128:	c1 e8 10             	shr    $0x10,%eax
+8010912b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010912f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109132:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109135:	c9                   	leave
+80109136:	c3                   	ret
+80109137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010913e:	66 90                	xchg   %ax,%ax
+
+80109140 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109140:	55                   	push   %ebp
+80109141:	89 e5                	mov    %esp,%ebp
+80109143:	57                   	push   %edi
+80109144:	56                   	push   %esi
+80109145:	53                   	push   %ebx
+80109146:	83 ec 1c             	sub    $0x1c,%esp
+80109149:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+8010914c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010914f:	83 f8 40             	cmp    $0x40,%eax
+80109152:	0f 84 80 01 00 00    	je     801092d8 <trap+0x198>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80109158:	83 e8 0e             	sub    $0xe,%eax
+8010915b:	83 f8 31             	cmp    $0x31,%eax
+8010915e:	0f 87 dc 00 00 00    	ja     80109240 <trap+0x100>
+80109164:	ff 24 85 d8 b6 10 80 	jmp    *-0x7fef4928(,%eax,4)
+8010916b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010916f:	90                   	nop
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+80109170:	e8 8b d7 ff ff       	call   80106900 <cpuid>
+80109175:	85 c0                	test   %eax,%eax
+80109177:	0f 84 5b 02 00 00    	je     801093d8 <trap+0x298>
+    }
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+    lapiceoi();
+8010917d:	e8 2e be ff ff       	call   80104fb0 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109182:	e8 99 d7 ff ff       	call   80106920 <myproc>
+80109187:	85 c0                	test   %eax,%eax
+80109189:	74 1d                	je     801091a8 <trap+0x68>
+8010918b:	e8 90 d7 ff ff       	call   80106920 <myproc>
+80109190:	8b 50 28             	mov    0x28(%eax),%edx
+80109193:	85 d2                	test   %edx,%edx
+80109195:	74 11                	je     801091a8 <trap+0x68>
+80109197:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+8010919b:	83 e0 03             	and    $0x3,%eax
+8010919e:	66 83 f8 03          	cmp    $0x3,%ax
+801091a2:	0f 84 f8 01 00 00    	je     801093a0 <trap+0x260>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+801091a8:	e8 73 d7 ff ff       	call   80106920 <myproc>
+801091ad:	85 c0                	test   %eax,%eax
+801091af:	74 0f                	je     801091c0 <trap+0x80>
+801091b1:	e8 6a d7 ff ff       	call   80106920 <myproc>
+801091b6:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+801091ba:	0f 84 00 01 00 00    	je     801092c0 <trap+0x180>
+     tf->trapno == T_IRQ0+IRQ_TIMER)
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801091c0:	e8 5b d7 ff ff       	call   80106920 <myproc>
+801091c5:	85 c0                	test   %eax,%eax
+801091c7:	74 1d                	je     801091e6 <trap+0xa6>
+801091c9:	e8 52 d7 ff ff       	call   80106920 <myproc>
+801091ce:	8b 40 28             	mov    0x28(%eax),%eax
+801091d1:	85 c0                	test   %eax,%eax
+801091d3:	74 11                	je     801091e6 <trap+0xa6>
+801091d5:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801091d9:	83 e0 03             	and    $0x3,%eax
+801091dc:	66 83 f8 03          	cmp    $0x3,%ax
+801091e0:	0f 84 1f 01 00 00    	je     80109305 <trap+0x1c5>
+    exit();
+}
+801091e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801091e9:	5b                   	pop    %ebx
+801091ea:	5e                   	pop    %esi
+801091eb:	5f                   	pop    %edi
+801091ec:	5d                   	pop    %ebp
+801091ed:	c3                   	ret
+801091ee:	66 90                	xchg   %ax,%ax
+    if(myproc() && (cowuvm(myproc()->pgdir, rcr2()) == 0 ||
+801091f0:	e8 2b d7 ff ff       	call   80106920 <myproc>
+801091f5:	85 c0                	test   %eax,%eax
+801091f7:	74 47                	je     80109240 <trap+0x100>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+801091f9:	0f 20 d6             	mov    %cr2,%esi
+801091fc:	e8 1f d7 ff ff       	call   80106920 <myproc>
+80109201:	83 ec 08             	sub    $0x8,%esp
+80109204:	56                   	push   %esi
+80109205:	ff 70 04             	push   0x4(%eax)
+80109208:	e8 d3 16 00 00       	call   8010a8e0 <cowuvm>
+8010920d:	83 c4 10             	add    $0x10,%esp
+80109210:	85 c0                	test   %eax,%eax
+80109212:	0f 84 98 01 00 00    	je     801093b0 <trap+0x270>
+       lazyuvm(myproc()->pgdir, rcr2(), myproc()->sz) == 0)){
+80109218:	e8 03 d7 ff ff       	call   80106920 <myproc>
+8010921d:	8b 38                	mov    (%eax),%edi
+8010921f:	0f 20 d6             	mov    %cr2,%esi
+80109222:	e8 f9 d6 ff ff       	call   80106920 <myproc>
+80109227:	83 ec 04             	sub    $0x4,%esp
+8010922a:	57                   	push   %edi
+8010922b:	56                   	push   %esi
+8010922c:	ff 70 04             	push   0x4(%eax)
+8010922f:	e8 8c 17 00 00       	call   8010a9c0 <lazyuvm>
+    if(myproc() && (cowuvm(myproc()->pgdir, rcr2()) == 0 ||
+80109234:	83 c4 10             	add    $0x10,%esp
+80109237:	85 c0                	test   %eax,%eax
+80109239:	0f 84 71 01 00 00    	je     801093b0 <trap+0x270>
+8010923f:	90                   	nop
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109240:	e8 db d6 ff ff       	call   80106920 <myproc>
+80109245:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109248:	85 c0                	test   %eax,%eax
+8010924a:	0f 84 c1 01 00 00    	je     80109411 <trap+0x2d1>
+80109250:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109254:	0f 84 b7 01 00 00    	je     80109411 <trap+0x2d1>
+8010925a:	0f 20 d1             	mov    %cr2,%ecx
+8010925d:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109260:	e8 9b d6 ff ff       	call   80106900 <cpuid>
+80109265:	8b 73 30             	mov    0x30(%ebx),%esi
+80109268:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010926b:	8b 43 34             	mov    0x34(%ebx),%eax
+8010926e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80109271:	e8 aa d6 ff ff       	call   80106920 <myproc>
+80109276:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109279:	e8 a2 d6 ff ff       	call   80106920 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010927e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109281:	51                   	push   %ecx
+80109282:	57                   	push   %edi
+80109283:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80109286:	52                   	push   %edx
+80109287:	ff 75 e4             	push   -0x1c(%ebp)
+8010928a:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+8010928b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010928e:	83 c6 70             	add    $0x70,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109291:	56                   	push   %esi
+80109292:	ff 70 10             	push   0x10(%eax)
+80109295:	68 94 b6 10 80       	push   $0x8010b694
+8010929a:	e8 c1 77 ff ff       	call   80100a60 <cprintf>
+    myproc()->killed = 1;
+8010929f:	83 c4 20             	add    $0x20,%esp
+801092a2:	e8 79 d6 ff ff       	call   80106920 <myproc>
+801092a7:	c7 40 28 01 00 00 00 	movl   $0x1,0x28(%eax)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801092ae:	e8 6d d6 ff ff       	call   80106920 <myproc>
+801092b3:	85 c0                	test   %eax,%eax
+801092b5:	0f 85 d0 fe ff ff    	jne    8010918b <trap+0x4b>
+801092bb:	e9 e8 fe ff ff       	jmp    801091a8 <trap+0x68>
+  if(myproc() && myproc()->state == RUNNING &&
+801092c0:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+801092c4:	0f 85 f6 fe ff ff    	jne    801091c0 <trap+0x80>
+    yield();
+801092ca:	e8 61 de ff ff       	call   80107130 <yield>
+801092cf:	e9 ec fe ff ff       	jmp    801091c0 <trap+0x80>
+801092d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(myproc()->killed)
+801092d8:	e8 43 d6 ff ff       	call   80106920 <myproc>
+801092dd:	8b 70 28             	mov    0x28(%eax),%esi
+801092e0:	85 f6                	test   %esi,%esi
+801092e2:	0f 85 e0 00 00 00    	jne    801093c8 <trap+0x288>
+    myproc()->tf = tf;
+801092e8:	e8 33 d6 ff ff       	call   80106920 <myproc>
+801092ed:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+801092f0:	e8 4b ed ff ff       	call   80108040 <syscall>
+    if(myproc()->killed)
+801092f5:	e8 26 d6 ff ff       	call   80106920 <myproc>
+801092fa:	8b 48 28             	mov    0x28(%eax),%ecx
+801092fd:	85 c9                	test   %ecx,%ecx
+801092ff:	0f 84 e1 fe ff ff    	je     801091e6 <trap+0xa6>
+}
+80109305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109308:	5b                   	pop    %ebx
+80109309:	5e                   	pop    %esi
+8010930a:	5f                   	pop    %edi
+8010930b:	5d                   	pop    %ebp
+      exit();
+8010930c:	e9 9f db ff ff       	jmp    80106eb0 <exit>
+80109311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109318:	8b 7b 38             	mov    0x38(%ebx),%edi
+8010931b:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+8010931f:	e8 dc d5 ff ff       	call   80106900 <cpuid>
+80109324:	57                   	push   %edi
+80109325:	56                   	push   %esi
+80109326:	50                   	push   %eax
+80109327:	68 3c b6 10 80       	push   $0x8010b63c
+8010932c:	e8 2f 77 ff ff       	call   80100a60 <cprintf>
+    lapiceoi();
+80109331:	e8 7a bc ff ff       	call   80104fb0 <lapiceoi>
+    break;
+80109336:	83 c4 10             	add    $0x10,%esp
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109339:	e8 e2 d5 ff ff       	call   80106920 <myproc>
+8010933e:	85 c0                	test   %eax,%eax
+80109340:	0f 85 45 fe ff ff    	jne    8010918b <trap+0x4b>
+80109346:	e9 5d fe ff ff       	jmp    801091a8 <trap+0x68>
+8010934b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010934f:	90                   	nop
+    kbdintr();
+80109350:	e8 1b bb ff ff       	call   80104e70 <kbdintr>
+    lapiceoi();
+80109355:	e8 56 bc ff ff       	call   80104fb0 <lapiceoi>
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010935a:	e8 c1 d5 ff ff       	call   80106920 <myproc>
+8010935f:	85 c0                	test   %eax,%eax
+80109361:	0f 85 24 fe ff ff    	jne    8010918b <trap+0x4b>
+80109367:	e9 3c fe ff ff       	jmp    801091a8 <trap+0x68>
+8010936c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    uartintr();
+80109370:	e8 4b 02 00 00       	call   801095c0 <uartintr>
+    lapiceoi();
+80109375:	e8 36 bc ff ff       	call   80104fb0 <lapiceoi>
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010937a:	e8 a1 d5 ff ff       	call   80106920 <myproc>
+8010937f:	85 c0                	test   %eax,%eax
+80109381:	0f 85 04 fe ff ff    	jne    8010918b <trap+0x4b>
+80109387:	e9 1c fe ff ff       	jmp    801091a8 <trap+0x68>
+8010938c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ideintr();
+80109390:	e8 ab b0 ff ff       	call   80104440 <ideintr>
+80109395:	e9 e3 fd ff ff       	jmp    8010917d <trap+0x3d>
+8010939a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+801093a0:	e8 0b db ff ff       	call   80106eb0 <exit>
+801093a5:	e9 fe fd ff ff       	jmp    801091a8 <trap+0x68>
+801093aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      lcr3(V2P(myproc()->pgdir));
+801093b0:	e8 6b d5 ff ff       	call   80106920 <myproc>
+801093b5:	8b 40 04             	mov    0x4(%eax),%eax
+801093b8:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+801093bd:	0f 22 d8             	mov    %eax,%cr3
+}
+801093c0:	e9 bd fd ff ff       	jmp    80109182 <trap+0x42>
+801093c5:	8d 76 00             	lea    0x0(%esi),%esi
+      exit();
+801093c8:	e8 e3 da ff ff       	call   80106eb0 <exit>
+801093cd:	e9 16 ff ff ff       	jmp    801092e8 <trap+0x1a8>
+801093d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      acquire(&tickslock);
+801093d8:	83 ec 0c             	sub    $0xc,%esp
+801093db:	68 c0 84 15 80       	push   $0x801584c0
+801093e0:	e8 8b e7 ff ff       	call   80107b70 <acquire>
+      ticks++;
+801093e5:	83 05 a0 84 15 80 01 	addl   $0x1,0x801584a0
+      wakeup(&ticks);
+801093ec:	c7 04 24 a0 84 15 80 	movl   $0x801584a0,(%esp)
+801093f3:	e8 98 de ff ff       	call   80107290 <wakeup>
+      release(&tickslock);
+801093f8:	c7 04 24 c0 84 15 80 	movl   $0x801584c0,(%esp)
+801093ff:	e8 0c e7 ff ff       	call   80107b10 <release>
+      logtick();
+80109404:	e8 f7 c3 ff ff       	call   80105800 <logtick>
+80109409:	83 c4 10             	add    $0x10,%esp
+    lapiceoi();
+8010940c:	e9 6c fd ff ff       	jmp    8010917d <trap+0x3d>
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109411:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109414:	e8 e7 d4 ff ff       	call   80106900 <cpuid>
+80109419:	83 ec 0c             	sub    $0xc,%esp
+8010941c:	56                   	push   %esi
+8010941d:	57                   	push   %edi
+8010941e:	50                   	push   %eax
+8010941f:	ff 73 30             	push   0x30(%ebx)
+80109422:	68 60 b6 10 80       	push   $0x8010b660
+80109427:	e8 34 76 ff ff       	call   80100a60 <cprintf>
+      panic("trap");
+8010942c:	83 c4 14             	add    $0x14,%esp
+8010942f:	68 36 b6 10 80       	push   $0x8010b636
+80109434:	e8 f7 72 ff ff       	call   80100730 <panic>
+80109439:	66 90                	xchg   %ax,%ax
+8010943b:	66 90                	xchg   %ax,%ax
+8010943d:	66 90                	xchg   %ax,%ax
+8010943f:	90                   	nop
+
+80109440 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109440:	a1 00 8d 15 80       	mov    0x80158d00,%eax
+80109445:	85 c0                	test   %eax,%eax
+80109447:	74 17                	je     80109460 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109449:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010944e:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+8010944f:	a8 01                	test   $0x1,%al
+80109451:	74 0d                	je     80109460 <uartgetc+0x20>
+80109453:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109458:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109459:	0f b6 c0             	movzbl %al,%eax
+8010945c:	c3                   	ret
+8010945d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109460:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109465:	c3                   	ret
+80109466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010946d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109470 <uartinit>:
+{
+80109470:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109471:	31 c9                	xor    %ecx,%ecx
+80109473:	89 c8                	mov    %ecx,%eax
+80109475:	89 e5                	mov    %esp,%ebp
+80109477:	57                   	push   %edi
+80109478:	bf fa 03 00 00       	mov    $0x3fa,%edi
+8010947d:	56                   	push   %esi
+8010947e:	89 fa                	mov    %edi,%edx
+80109480:	53                   	push   %ebx
+80109481:	83 ec 1c             	sub    $0x1c,%esp
+80109484:	ee                   	out    %al,(%dx)
+80109485:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010948a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010948f:	89 f2                	mov    %esi,%edx
+80109491:	ee                   	out    %al,(%dx)
+80109492:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109497:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010949c:	ee                   	out    %al,(%dx)
+8010949d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+801094a2:	89 c8                	mov    %ecx,%eax
+801094a4:	89 da                	mov    %ebx,%edx
+801094a6:	ee                   	out    %al,(%dx)
+801094a7:	b8 03 00 00 00       	mov    $0x3,%eax
+801094ac:	89 f2                	mov    %esi,%edx
+801094ae:	ee                   	out    %al,(%dx)
+801094af:	ba fc 03 00 00       	mov    $0x3fc,%edx
+801094b4:	89 c8                	mov    %ecx,%eax
+801094b6:	ee                   	out    %al,(%dx)
+801094b7:	b8 01 00 00 00       	mov    $0x1,%eax
+801094bc:	89 da                	mov    %ebx,%edx
+801094be:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801094bf:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801094c4:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+801094c5:	3c ff                	cmp    $0xff,%al
+801094c7:	0f 84 7c 00 00 00    	je     80109549 <uartinit+0xd9>
+  uart = 1;
+801094cd:	c7 05 00 8d 15 80 01 	movl   $0x1,0x80158d00
+801094d4:	00 00 00 
+801094d7:	89 fa                	mov    %edi,%edx
+801094d9:	ec                   	in     (%dx),%al
+801094da:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801094df:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+801094e0:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+801094e3:	bf a0 b7 10 80       	mov    $0x8010b7a0,%edi
+801094e8:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+801094ed:	6a 00                	push   $0x0
+801094ef:	6a 04                	push   $0x4
+801094f1:	e8 7a b2 ff ff       	call   80104770 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+801094f6:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+801094fa:	83 c4 10             	add    $0x10,%esp
+801094fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109500:	a1 00 8d 15 80       	mov    0x80158d00,%eax
+80109505:	85 c0                	test   %eax,%eax
+80109507:	74 32                	je     8010953b <uartinit+0xcb>
+80109509:	89 f2                	mov    %esi,%edx
+8010950b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+8010950c:	a8 20                	test   $0x20,%al
+8010950e:	75 21                	jne    80109531 <uartinit+0xc1>
+80109510:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109515:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80109518:	83 ec 0c             	sub    $0xc,%esp
+8010951b:	6a 0a                	push   $0xa
+8010951d:	e8 ae ba ff ff       	call   80104fd0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109522:	83 c4 10             	add    $0x10,%esp
+80109525:	83 eb 01             	sub    $0x1,%ebx
+80109528:	74 07                	je     80109531 <uartinit+0xc1>
+8010952a:	89 f2                	mov    %esi,%edx
+8010952c:	ec                   	in     (%dx),%al
+8010952d:	a8 20                	test   $0x20,%al
+8010952f:	74 e7                	je     80109518 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109531:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109536:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+8010953a:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+8010953b:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+8010953f:	83 c7 01             	add    $0x1,%edi
+80109542:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109545:	84 c0                	test   %al,%al
+80109547:	75 b7                	jne    80109500 <uartinit+0x90>
+}
+80109549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010954c:	5b                   	pop    %ebx
+8010954d:	5e                   	pop    %esi
+8010954e:	5f                   	pop    %edi
+8010954f:	5d                   	pop    %ebp
+80109550:	c3                   	ret
+80109551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010955f:	90                   	nop
+
+80109560 <uartputc>:
+  if(!uart)
+80109560:	a1 00 8d 15 80       	mov    0x80158d00,%eax
+80109565:	85 c0                	test   %eax,%eax
+80109567:	74 4f                	je     801095b8 <uartputc+0x58>
+{
+80109569:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010956a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010956f:	89 e5                	mov    %esp,%ebp
+80109571:	56                   	push   %esi
+80109572:	53                   	push   %ebx
+80109573:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109574:	a8 20                	test   $0x20,%al
+80109576:	75 29                	jne    801095a1 <uartputc+0x41>
+80109578:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010957d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109582:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109588:	83 ec 0c             	sub    $0xc,%esp
+8010958b:	6a 0a                	push   $0xa
+8010958d:	e8 3e ba ff ff       	call   80104fd0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109592:	83 c4 10             	add    $0x10,%esp
+80109595:	83 eb 01             	sub    $0x1,%ebx
+80109598:	74 07                	je     801095a1 <uartputc+0x41>
+8010959a:	89 f2                	mov    %esi,%edx
+8010959c:	ec                   	in     (%dx),%al
+8010959d:	a8 20                	test   $0x20,%al
+8010959f:	74 e7                	je     80109588 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801095a1:	8b 45 08             	mov    0x8(%ebp),%eax
+801095a4:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801095a9:	ee                   	out    %al,(%dx)
+}
+801095aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801095ad:	5b                   	pop    %ebx
+801095ae:	5e                   	pop    %esi
+801095af:	5d                   	pop    %ebp
+801095b0:	c3                   	ret
+801095b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095b8:	c3                   	ret
+801095b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801095c0 <uartintr>:
+
+void
+uartintr(void)
+{
+801095c0:	55                   	push   %ebp
+801095c1:	89 e5                	mov    %esp,%ebp
+801095c3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+801095c6:	68 40 94 10 80       	push   $0x80109440
+801095cb:	e8 a0 76 ff ff       	call   80100c70 <consoleintr>
+}
+801095d0:	83 c4 10             	add    $0x10,%esp
+801095d3:	c9                   	leave
+801095d4:	c3                   	ret
+
+801095d5 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+801095d5:	6a 00                	push   $0x0
+  pushl $0
+801095d7:	6a 00                	push   $0x0
+  jmp alltraps
+801095d9:	e9 8c fa ff ff       	jmp    8010906a <alltraps>
+
+801095de <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+801095de:	6a 00                	push   $0x0
+  pushl $1
+801095e0:	6a 01                	push   $0x1
+  jmp alltraps
+801095e2:	e9 83 fa ff ff       	jmp    8010906a <alltraps>
+
+801095e7 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+801095e7:	6a 00                	push   $0x0
+  pushl $2
+801095e9:	6a 02                	push   $0x2
+  jmp alltraps
+801095eb:	e9 7a fa ff ff       	jmp    8010906a <alltraps>
+
+801095f0 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+801095f0:	6a 00                	push   $0x0
+  pushl $3
+801095f2:	6a 03                	push   $0x3
+  jmp alltraps
+801095f4:	e9 71 fa ff ff       	jmp    8010906a <alltraps>
+
+801095f9 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+801095f9:	6a 00                	push   $0x0
+  pushl $4
+801095fb:	6a 04                	push   $0x4
+  jmp alltraps
+801095fd:	e9 68 fa ff ff       	jmp    8010906a <alltraps>
+
+80109602 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109602:	6a 00                	push   $0x0
+  pushl $5
+80109604:	6a 05                	push   $0x5
+  jmp alltraps
+80109606:	e9 5f fa ff ff       	jmp    8010906a <alltraps>
+
+8010960b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010960b:	6a 00                	push   $0x0
+  pushl $6
+8010960d:	6a 06                	push   $0x6
+  jmp alltraps
+8010960f:	e9 56 fa ff ff       	jmp    8010906a <alltraps>
+
+80109614 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109614:	6a 00                	push   $0x0
+  pushl $7
+80109616:	6a 07                	push   $0x7
+  jmp alltraps
+80109618:	e9 4d fa ff ff       	jmp    8010906a <alltraps>
+
+8010961d <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010961d:	6a 08                	push   $0x8
+  jmp alltraps
+8010961f:	e9 46 fa ff ff       	jmp    8010906a <alltraps>
+
+80109624 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109624:	6a 00                	push   $0x0
+  pushl $9
+80109626:	6a 09                	push   $0x9
+  jmp alltraps
+80109628:	e9 3d fa ff ff       	jmp    8010906a <alltraps>
+
+8010962d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010962d:	6a 0a                	push   $0xa
+  jmp alltraps
+8010962f:	e9 36 fa ff ff       	jmp    8010906a <alltraps>
+
+80109634 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109634:	6a 0b                	push   $0xb
+  jmp alltraps
+80109636:	e9 2f fa ff ff       	jmp    8010906a <alltraps>
+
+8010963b <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010963b:	6a 0c                	push   $0xc
+  jmp alltraps
+8010963d:	e9 28 fa ff ff       	jmp    8010906a <alltraps>
+
+80109642 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109642:	6a 0d                	push   $0xd
+  jmp alltraps
+80109644:	e9 21 fa ff ff       	jmp    8010906a <alltraps>
+
+80109649 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109649:	6a 0e                	push   $0xe
+  jmp alltraps
+8010964b:	e9 1a fa ff ff       	jmp    8010906a <alltraps>
+
+80109650 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109650:	6a 00                	push   $0x0
+  pushl $15
+80109652:	6a 0f                	push   $0xf
+  jmp alltraps
+80109654:	e9 11 fa ff ff       	jmp    8010906a <alltraps>
+
+80109659 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109659:	6a 00                	push   $0x0
+  pushl $16
+8010965b:	6a 10                	push   $0x10
+  jmp alltraps
+8010965d:	e9 08 fa ff ff       	jmp    8010906a <alltraps>
+
+80109662 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109662:	6a 11                	push   $0x11
+  jmp alltraps
+80109664:	e9 01 fa ff ff       	jmp    8010906a <alltraps>
+
+80109669 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109669:	6a 00                	push   $0x0
+  pushl $18
+8010966b:	6a 12                	push   $0x12
+  jmp alltraps
+8010966d:	e9 f8 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109672 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109672:	6a 00                	push   $0x0
+  pushl $19
+80109674:	6a 13                	push   $0x13
+  jmp alltraps
+80109676:	e9 ef f9 ff ff       	jmp    8010906a <alltraps>
+
+8010967b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010967b:	6a 00                	push   $0x0
+  pushl $20
+8010967d:	6a 14                	push   $0x14
+  jmp alltraps
+8010967f:	e9 e6 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109684 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109684:	6a 00                	push   $0x0
+  pushl $21
+80109686:	6a 15                	push   $0x15
+  jmp alltraps
+80109688:	e9 dd f9 ff ff       	jmp    8010906a <alltraps>
+
+8010968d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010968d:	6a 00                	push   $0x0
+  pushl $22
+8010968f:	6a 16                	push   $0x16
+  jmp alltraps
+80109691:	e9 d4 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109696 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109696:	6a 00                	push   $0x0
+  pushl $23
+80109698:	6a 17                	push   $0x17
+  jmp alltraps
+8010969a:	e9 cb f9 ff ff       	jmp    8010906a <alltraps>
+
+8010969f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+8010969f:	6a 00                	push   $0x0
+  pushl $24
+801096a1:	6a 18                	push   $0x18
+  jmp alltraps
+801096a3:	e9 c2 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096a8 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+801096a8:	6a 00                	push   $0x0
+  pushl $25
+801096aa:	6a 19                	push   $0x19
+  jmp alltraps
+801096ac:	e9 b9 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096b1 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+801096b1:	6a 00                	push   $0x0
+  pushl $26
+801096b3:	6a 1a                	push   $0x1a
+  jmp alltraps
+801096b5:	e9 b0 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096ba <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+801096ba:	6a 00                	push   $0x0
+  pushl $27
+801096bc:	6a 1b                	push   $0x1b
+  jmp alltraps
+801096be:	e9 a7 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096c3 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+801096c3:	6a 00                	push   $0x0
+  pushl $28
+801096c5:	6a 1c                	push   $0x1c
+  jmp alltraps
+801096c7:	e9 9e f9 ff ff       	jmp    8010906a <alltraps>
+
+801096cc <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+801096cc:	6a 00                	push   $0x0
+  pushl $29
+801096ce:	6a 1d                	push   $0x1d
+  jmp alltraps
+801096d0:	e9 95 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096d5 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+801096d5:	6a 00                	push   $0x0
+  pushl $30
+801096d7:	6a 1e                	push   $0x1e
+  jmp alltraps
+801096d9:	e9 8c f9 ff ff       	jmp    8010906a <alltraps>
+
+801096de <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+801096de:	6a 00                	push   $0x0
+  pushl $31
+801096e0:	6a 1f                	push   $0x1f
+  jmp alltraps
+801096e2:	e9 83 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096e7 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+801096e7:	6a 00                	push   $0x0
+  pushl $32
+801096e9:	6a 20                	push   $0x20
+  jmp alltraps
+801096eb:	e9 7a f9 ff ff       	jmp    8010906a <alltraps>
+
+801096f0 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+801096f0:	6a 00                	push   $0x0
+  pushl $33
+801096f2:	6a 21                	push   $0x21
+  jmp alltraps
+801096f4:	e9 71 f9 ff ff       	jmp    8010906a <alltraps>
+
+801096f9 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+801096f9:	6a 00                	push   $0x0
+  pushl $34
+801096fb:	6a 22                	push   $0x22
+  jmp alltraps
+801096fd:	e9 68 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109702 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109702:	6a 00                	push   $0x0
+  pushl $35
+80109704:	6a 23                	push   $0x23
+  jmp alltraps
+80109706:	e9 5f f9 ff ff       	jmp    8010906a <alltraps>
+
+8010970b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010970b:	6a 00                	push   $0x0
+  pushl $36
+8010970d:	6a 24                	push   $0x24
+  jmp alltraps
+8010970f:	e9 56 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109714 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109714:	6a 00                	push   $0x0
+  pushl $37
+80109716:	6a 25                	push   $0x25
+  jmp alltraps
+80109718:	e9 4d f9 ff ff       	jmp    8010906a <alltraps>
+
+8010971d <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010971d:	6a 00                	push   $0x0
+  pushl $38
+8010971f:	6a 26                	push   $0x26
+  jmp alltraps
+80109721:	e9 44 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109726 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109726:	6a 00                	push   $0x0
+  pushl $39
+80109728:	6a 27                	push   $0x27
+  jmp alltraps
+8010972a:	e9 3b f9 ff ff       	jmp    8010906a <alltraps>
+
+8010972f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010972f:	6a 00                	push   $0x0
+  pushl $40
+80109731:	6a 28                	push   $0x28
+  jmp alltraps
+80109733:	e9 32 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109738 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109738:	6a 00                	push   $0x0
+  pushl $41
+8010973a:	6a 29                	push   $0x29
+  jmp alltraps
+8010973c:	e9 29 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109741 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109741:	6a 00                	push   $0x0
+  pushl $42
+80109743:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109745:	e9 20 f9 ff ff       	jmp    8010906a <alltraps>
+
+8010974a <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010974a:	6a 00                	push   $0x0
+  pushl $43
+8010974c:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010974e:	e9 17 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109753 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109753:	6a 00                	push   $0x0
+  pushl $44
+80109755:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109757:	e9 0e f9 ff ff       	jmp    8010906a <alltraps>
+
+8010975c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010975c:	6a 00                	push   $0x0
+  pushl $45
+8010975e:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109760:	e9 05 f9 ff ff       	jmp    8010906a <alltraps>
+
+80109765 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109765:	6a 00                	push   $0x0
+  pushl $46
+80109767:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109769:	e9 fc f8 ff ff       	jmp    8010906a <alltraps>
+
+8010976e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010976e:	6a 00                	push   $0x0
+  pushl $47
+80109770:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109772:	e9 f3 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109777 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109777:	6a 00                	push   $0x0
+  pushl $48
+80109779:	6a 30                	push   $0x30
+  jmp alltraps
+8010977b:	e9 ea f8 ff ff       	jmp    8010906a <alltraps>
+
+80109780 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109780:	6a 00                	push   $0x0
+  pushl $49
+80109782:	6a 31                	push   $0x31
+  jmp alltraps
+80109784:	e9 e1 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109789 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109789:	6a 00                	push   $0x0
+  pushl $50
+8010978b:	6a 32                	push   $0x32
+  jmp alltraps
+8010978d:	e9 d8 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109792 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109792:	6a 00                	push   $0x0
+  pushl $51
+80109794:	6a 33                	push   $0x33
+  jmp alltraps
+80109796:	e9 cf f8 ff ff       	jmp    8010906a <alltraps>
+
+8010979b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010979b:	6a 00                	push   $0x0
+  pushl $52
+8010979d:	6a 34                	push   $0x34
+  jmp alltraps
+8010979f:	e9 c6 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097a4 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+801097a4:	6a 00                	push   $0x0
+  pushl $53
+801097a6:	6a 35                	push   $0x35
+  jmp alltraps
+801097a8:	e9 bd f8 ff ff       	jmp    8010906a <alltraps>
+
+801097ad <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+801097ad:	6a 00                	push   $0x0
+  pushl $54
+801097af:	6a 36                	push   $0x36
+  jmp alltraps
+801097b1:	e9 b4 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097b6 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+801097b6:	6a 00                	push   $0x0
+  pushl $55
+801097b8:	6a 37                	push   $0x37
+  jmp alltraps
+801097ba:	e9 ab f8 ff ff       	jmp    8010906a <alltraps>
+
+801097bf <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+801097bf:	6a 00                	push   $0x0
+  pushl $56
+801097c1:	6a 38                	push   $0x38
+  jmp alltraps
+801097c3:	e9 a2 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097c8 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+801097c8:	6a 00                	push   $0x0
+  pushl $57
+801097ca:	6a 39                	push   $0x39
+  jmp alltraps
+801097cc:	e9 99 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097d1 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+801097d1:	6a 00                	push   $0x0
+  pushl $58
+801097d3:	6a 3a                	push   $0x3a
+  jmp alltraps
+801097d5:	e9 90 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097da <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+801097da:	6a 00                	push   $0x0
+  pushl $59
+801097dc:	6a 3b                	push   $0x3b
+  jmp alltraps
+801097de:	e9 87 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097e3 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+801097e3:	6a 00                	push   $0x0
+  pushl $60
+801097e5:	6a 3c                	push   $0x3c
+  jmp alltraps
+801097e7:	e9 7e f8 ff ff       	jmp    8010906a <alltraps>
+
+801097ec <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+801097ec:	6a 00                	push   $0x0
+  pushl $61
+801097ee:	6a 3d                	push   $0x3d
+  jmp alltraps
+801097f0:	e9 75 f8 ff ff       	jmp    8010906a <alltraps>
+
+801097f5 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+801097f5:	6a 00                	push   $0x0
+  pushl $62
+801097f7:	6a 3e                	push   $0x3e
+  jmp alltraps
+801097f9:	e9 6c f8 ff ff       	jmp    8010906a <alltraps>
+
+801097fe <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+801097fe:	6a 00                	push   $0x0
+  pushl $63
+80109800:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109802:	e9 63 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109807 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109807:	6a 00                	push   $0x0
+  pushl $64
+80109809:	6a 40                	push   $0x40
+  jmp alltraps
+8010980b:	e9 5a f8 ff ff       	jmp    8010906a <alltraps>
+
+80109810 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109810:	6a 00                	push   $0x0
+  pushl $65
+80109812:	6a 41                	push   $0x41
+  jmp alltraps
+80109814:	e9 51 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109819 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109819:	6a 00                	push   $0x0
+  pushl $66
+8010981b:	6a 42                	push   $0x42
+  jmp alltraps
+8010981d:	e9 48 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109822 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109822:	6a 00                	push   $0x0
+  pushl $67
+80109824:	6a 43                	push   $0x43
+  jmp alltraps
+80109826:	e9 3f f8 ff ff       	jmp    8010906a <alltraps>
+
+8010982b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010982b:	6a 00                	push   $0x0
+  pushl $68
+8010982d:	6a 44                	push   $0x44
+  jmp alltraps
+8010982f:	e9 36 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109834 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109834:	6a 00                	push   $0x0
+  pushl $69
+80109836:	6a 45                	push   $0x45
+  jmp alltraps
+80109838:	e9 2d f8 ff ff       	jmp    8010906a <alltraps>
+
+8010983d <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010983d:	6a 00                	push   $0x0
+  pushl $70
+8010983f:	6a 46                	push   $0x46
+  jmp alltraps
+80109841:	e9 24 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109846 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109846:	6a 00                	push   $0x0
+  pushl $71
+80109848:	6a 47                	push   $0x47
+  jmp alltraps
+8010984a:	e9 1b f8 ff ff       	jmp    8010906a <alltraps>
+
+8010984f <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010984f:	6a 00                	push   $0x0
+  pushl $72
+80109851:	6a 48                	push   $0x48
+  jmp alltraps
+80109853:	e9 12 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109858 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109858:	6a 00                	push   $0x0
+  pushl $73
+8010985a:	6a 49                	push   $0x49
+  jmp alltraps
+8010985c:	e9 09 f8 ff ff       	jmp    8010906a <alltraps>
+
+80109861 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109861:	6a 00                	push   $0x0
+  pushl $74
+80109863:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109865:	e9 00 f8 ff ff       	jmp    8010906a <alltraps>
+
+8010986a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010986a:	6a 00                	push   $0x0
+  pushl $75
+8010986c:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010986e:	e9 f7 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109873 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109873:	6a 00                	push   $0x0
+  pushl $76
+80109875:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109877:	e9 ee f7 ff ff       	jmp    8010906a <alltraps>
+
+8010987c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010987c:	6a 00                	push   $0x0
+  pushl $77
+8010987e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109880:	e9 e5 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109885 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109885:	6a 00                	push   $0x0
+  pushl $78
+80109887:	6a 4e                	push   $0x4e
+  jmp alltraps
+80109889:	e9 dc f7 ff ff       	jmp    8010906a <alltraps>
+
+8010988e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010988e:	6a 00                	push   $0x0
+  pushl $79
+80109890:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109892:	e9 d3 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109897 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109897:	6a 00                	push   $0x0
+  pushl $80
+80109899:	6a 50                	push   $0x50
+  jmp alltraps
+8010989b:	e9 ca f7 ff ff       	jmp    8010906a <alltraps>
+
+801098a0 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+801098a0:	6a 00                	push   $0x0
+  pushl $81
+801098a2:	6a 51                	push   $0x51
+  jmp alltraps
+801098a4:	e9 c1 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098a9 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+801098a9:	6a 00                	push   $0x0
+  pushl $82
+801098ab:	6a 52                	push   $0x52
+  jmp alltraps
+801098ad:	e9 b8 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098b2 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+801098b2:	6a 00                	push   $0x0
+  pushl $83
+801098b4:	6a 53                	push   $0x53
+  jmp alltraps
+801098b6:	e9 af f7 ff ff       	jmp    8010906a <alltraps>
+
+801098bb <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+801098bb:	6a 00                	push   $0x0
+  pushl $84
+801098bd:	6a 54                	push   $0x54
+  jmp alltraps
+801098bf:	e9 a6 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098c4 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+801098c4:	6a 00                	push   $0x0
+  pushl $85
+801098c6:	6a 55                	push   $0x55
+  jmp alltraps
+801098c8:	e9 9d f7 ff ff       	jmp    8010906a <alltraps>
+
+801098cd <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+801098cd:	6a 00                	push   $0x0
+  pushl $86
+801098cf:	6a 56                	push   $0x56
+  jmp alltraps
+801098d1:	e9 94 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098d6 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+801098d6:	6a 00                	push   $0x0
+  pushl $87
+801098d8:	6a 57                	push   $0x57
+  jmp alltraps
+801098da:	e9 8b f7 ff ff       	jmp    8010906a <alltraps>
+
+801098df <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+801098df:	6a 00                	push   $0x0
+  pushl $88
+801098e1:	6a 58                	push   $0x58
+  jmp alltraps
+801098e3:	e9 82 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098e8 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+801098e8:	6a 00                	push   $0x0
+  pushl $89
+801098ea:	6a 59                	push   $0x59
+  jmp alltraps
+801098ec:	e9 79 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098f1 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+801098f1:	6a 00                	push   $0x0
+  pushl $90
+801098f3:	6a 5a                	push   $0x5a
+  jmp alltraps
+801098f5:	e9 70 f7 ff ff       	jmp    8010906a <alltraps>
+
+801098fa <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+801098fa:	6a 00                	push   $0x0
+  pushl $91
+801098fc:	6a 5b                	push   $0x5b
+  jmp alltraps
+801098fe:	e9 67 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109903 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109903:	6a 00                	push   $0x0
+  pushl $92
+80109905:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109907:	e9 5e f7 ff ff       	jmp    8010906a <alltraps>
+
+8010990c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010990c:	6a 00                	push   $0x0
+  pushl $93
+8010990e:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109910:	e9 55 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109915 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109915:	6a 00                	push   $0x0
+  pushl $94
+80109917:	6a 5e                	push   $0x5e
+  jmp alltraps
+80109919:	e9 4c f7 ff ff       	jmp    8010906a <alltraps>
+
+8010991e <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010991e:	6a 00                	push   $0x0
+  pushl $95
+80109920:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109922:	e9 43 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109927 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109927:	6a 00                	push   $0x0
+  pushl $96
+80109929:	6a 60                	push   $0x60
+  jmp alltraps
+8010992b:	e9 3a f7 ff ff       	jmp    8010906a <alltraps>
+
+80109930 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109930:	6a 00                	push   $0x0
+  pushl $97
+80109932:	6a 61                	push   $0x61
+  jmp alltraps
+80109934:	e9 31 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109939 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109939:	6a 00                	push   $0x0
+  pushl $98
+8010993b:	6a 62                	push   $0x62
+  jmp alltraps
+8010993d:	e9 28 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109942 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109942:	6a 00                	push   $0x0
+  pushl $99
+80109944:	6a 63                	push   $0x63
+  jmp alltraps
+80109946:	e9 1f f7 ff ff       	jmp    8010906a <alltraps>
+
+8010994b <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010994b:	6a 00                	push   $0x0
+  pushl $100
+8010994d:	6a 64                	push   $0x64
+  jmp alltraps
+8010994f:	e9 16 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109954 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109954:	6a 00                	push   $0x0
+  pushl $101
+80109956:	6a 65                	push   $0x65
+  jmp alltraps
+80109958:	e9 0d f7 ff ff       	jmp    8010906a <alltraps>
+
+8010995d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010995d:	6a 00                	push   $0x0
+  pushl $102
+8010995f:	6a 66                	push   $0x66
+  jmp alltraps
+80109961:	e9 04 f7 ff ff       	jmp    8010906a <alltraps>
+
+80109966 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109966:	6a 00                	push   $0x0
+  pushl $103
+80109968:	6a 67                	push   $0x67
+  jmp alltraps
+8010996a:	e9 fb f6 ff ff       	jmp    8010906a <alltraps>
+
+8010996f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010996f:	6a 00                	push   $0x0
+  pushl $104
+80109971:	6a 68                	push   $0x68
+  jmp alltraps
+80109973:	e9 f2 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109978 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80109978:	6a 00                	push   $0x0
+  pushl $105
+8010997a:	6a 69                	push   $0x69
+  jmp alltraps
+8010997c:	e9 e9 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109981 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109981:	6a 00                	push   $0x0
+  pushl $106
+80109983:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109985:	e9 e0 f6 ff ff       	jmp    8010906a <alltraps>
+
+8010998a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010998a:	6a 00                	push   $0x0
+  pushl $107
+8010998c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010998e:	e9 d7 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109993 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109993:	6a 00                	push   $0x0
+  pushl $108
+80109995:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109997:	e9 ce f6 ff ff       	jmp    8010906a <alltraps>
+
+8010999c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010999c:	6a 00                	push   $0x0
+  pushl $109
+8010999e:	6a 6d                	push   $0x6d
+  jmp alltraps
+801099a0:	e9 c5 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099a5 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+801099a5:	6a 00                	push   $0x0
+  pushl $110
+801099a7:	6a 6e                	push   $0x6e
+  jmp alltraps
+801099a9:	e9 bc f6 ff ff       	jmp    8010906a <alltraps>
+
+801099ae <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+801099ae:	6a 00                	push   $0x0
+  pushl $111
+801099b0:	6a 6f                	push   $0x6f
+  jmp alltraps
+801099b2:	e9 b3 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099b7 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+801099b7:	6a 00                	push   $0x0
+  pushl $112
+801099b9:	6a 70                	push   $0x70
+  jmp alltraps
+801099bb:	e9 aa f6 ff ff       	jmp    8010906a <alltraps>
+
+801099c0 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801099c0:	6a 00                	push   $0x0
+  pushl $113
+801099c2:	6a 71                	push   $0x71
+  jmp alltraps
+801099c4:	e9 a1 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099c9 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+801099c9:	6a 00                	push   $0x0
+  pushl $114
+801099cb:	6a 72                	push   $0x72
+  jmp alltraps
+801099cd:	e9 98 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099d2 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+801099d2:	6a 00                	push   $0x0
+  pushl $115
+801099d4:	6a 73                	push   $0x73
+  jmp alltraps
+801099d6:	e9 8f f6 ff ff       	jmp    8010906a <alltraps>
+
+801099db <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+801099db:	6a 00                	push   $0x0
+  pushl $116
+801099dd:	6a 74                	push   $0x74
+  jmp alltraps
+801099df:	e9 86 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099e4 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+801099e4:	6a 00                	push   $0x0
+  pushl $117
+801099e6:	6a 75                	push   $0x75
+  jmp alltraps
+801099e8:	e9 7d f6 ff ff       	jmp    8010906a <alltraps>
+
+801099ed <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+801099ed:	6a 00                	push   $0x0
+  pushl $118
+801099ef:	6a 76                	push   $0x76
+  jmp alltraps
+801099f1:	e9 74 f6 ff ff       	jmp    8010906a <alltraps>
+
+801099f6 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+801099f6:	6a 00                	push   $0x0
+  pushl $119
+801099f8:	6a 77                	push   $0x77
+  jmp alltraps
+801099fa:	e9 6b f6 ff ff       	jmp    8010906a <alltraps>
+
+801099ff <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+801099ff:	6a 00                	push   $0x0
+  pushl $120
+80109a01:	6a 78                	push   $0x78
+  jmp alltraps
+80109a03:	e9 62 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a08 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80109a08:	6a 00                	push   $0x0
+  pushl $121
+80109a0a:	6a 79                	push   $0x79
+  jmp alltraps
+80109a0c:	e9 59 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a11 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109a11:	6a 00                	push   $0x0
+  pushl $122
+80109a13:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109a15:	e9 50 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a1a <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80109a1a:	6a 00                	push   $0x0
+  pushl $123
+80109a1c:	6a 7b                	push   $0x7b
+  jmp alltraps
+80109a1e:	e9 47 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a23 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109a23:	6a 00                	push   $0x0
+  pushl $124
+80109a25:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109a27:	e9 3e f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a2c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80109a2c:	6a 00                	push   $0x0
+  pushl $125
+80109a2e:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109a30:	e9 35 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a35 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109a35:	6a 00                	push   $0x0
+  pushl $126
+80109a37:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109a39:	e9 2c f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a3e <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80109a3e:	6a 00                	push   $0x0
+  pushl $127
+80109a40:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109a42:	e9 23 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a47 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109a47:	6a 00                	push   $0x0
+  pushl $128
+80109a49:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80109a4e:	e9 17 f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a53 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109a53:	6a 00                	push   $0x0
+  pushl $129
+80109a55:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80109a5a:	e9 0b f6 ff ff       	jmp    8010906a <alltraps>
+
+80109a5f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80109a5f:	6a 00                	push   $0x0
+  pushl $130
+80109a61:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109a66:	e9 ff f5 ff ff       	jmp    8010906a <alltraps>
+
+80109a6b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80109a6b:	6a 00                	push   $0x0
+  pushl $131
+80109a6d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109a72:	e9 f3 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109a77 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109a77:	6a 00                	push   $0x0
+  pushl $132
+80109a79:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80109a7e:	e9 e7 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109a83 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109a83:	6a 00                	push   $0x0
+  pushl $133
+80109a85:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+80109a8a:	e9 db f5 ff ff       	jmp    8010906a <alltraps>
+
+80109a8f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109a8f:	6a 00                	push   $0x0
+  pushl $134
+80109a91:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109a96:	e9 cf f5 ff ff       	jmp    8010906a <alltraps>
+
+80109a9b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+80109a9b:	6a 00                	push   $0x0
+  pushl $135
+80109a9d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109aa2:	e9 c3 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109aa7 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109aa7:	6a 00                	push   $0x0
+  pushl $136
+80109aa9:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+80109aae:	e9 b7 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109ab3 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109ab3:	6a 00                	push   $0x0
+  pushl $137
+80109ab5:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+80109aba:	e9 ab f5 ff ff       	jmp    8010906a <alltraps>
+
+80109abf <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80109abf:	6a 00                	push   $0x0
+  pushl $138
+80109ac1:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80109ac6:	e9 9f f5 ff ff       	jmp    8010906a <alltraps>
+
+80109acb <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80109acb:	6a 00                	push   $0x0
+  pushl $139
+80109acd:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80109ad2:	e9 93 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109ad7 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80109ad7:	6a 00                	push   $0x0
+  pushl $140
+80109ad9:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+80109ade:	e9 87 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109ae3 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80109ae3:	6a 00                	push   $0x0
+  pushl $141
+80109ae5:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80109aea:	e9 7b f5 ff ff       	jmp    8010906a <alltraps>
+
+80109aef <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80109aef:	6a 00                	push   $0x0
+  pushl $142
+80109af1:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109af6:	e9 6f f5 ff ff       	jmp    8010906a <alltraps>
+
+80109afb <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80109afb:	6a 00                	push   $0x0
+  pushl $143
+80109afd:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109b02:	e9 63 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b07 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109b07:	6a 00                	push   $0x0
+  pushl $144
+80109b09:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80109b0e:	e9 57 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b13 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109b13:	6a 00                	push   $0x0
+  pushl $145
+80109b15:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80109b1a:	e9 4b f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b1f <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+80109b1f:	6a 00                	push   $0x0
+  pushl $146
+80109b21:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109b26:	e9 3f f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b2b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109b2b:	6a 00                	push   $0x0
+  pushl $147
+80109b2d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109b32:	e9 33 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b37 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109b37:	6a 00                	push   $0x0
+  pushl $148
+80109b39:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109b3e:	e9 27 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b43 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109b43:	6a 00                	push   $0x0
+  pushl $149
+80109b45:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109b4a:	e9 1b f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b4f <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109b4f:	6a 00                	push   $0x0
+  pushl $150
+80109b51:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109b56:	e9 0f f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b5b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109b5b:	6a 00                	push   $0x0
+  pushl $151
+80109b5d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109b62:	e9 03 f5 ff ff       	jmp    8010906a <alltraps>
+
+80109b67 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109b67:	6a 00                	push   $0x0
+  pushl $152
+80109b69:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109b6e:	e9 f7 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109b73 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109b73:	6a 00                	push   $0x0
+  pushl $153
+80109b75:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109b7a:	e9 eb f4 ff ff       	jmp    8010906a <alltraps>
+
+80109b7f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109b7f:	6a 00                	push   $0x0
+  pushl $154
+80109b81:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109b86:	e9 df f4 ff ff       	jmp    8010906a <alltraps>
+
+80109b8b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+80109b8b:	6a 00                	push   $0x0
+  pushl $155
+80109b8d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109b92:	e9 d3 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109b97 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109b97:	6a 00                	push   $0x0
+  pushl $156
+80109b99:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+80109b9e:	e9 c7 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109ba3 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109ba3:	6a 00                	push   $0x0
+  pushl $157
+80109ba5:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+80109baa:	e9 bb f4 ff ff       	jmp    8010906a <alltraps>
+
+80109baf <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109baf:	6a 00                	push   $0x0
+  pushl $158
+80109bb1:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109bb6:	e9 af f4 ff ff       	jmp    8010906a <alltraps>
+
+80109bbb <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+80109bbb:	6a 00                	push   $0x0
+  pushl $159
+80109bbd:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109bc2:	e9 a3 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109bc7 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109bc7:	6a 00                	push   $0x0
+  pushl $160
+80109bc9:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+80109bce:	e9 97 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109bd3 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109bd3:	6a 00                	push   $0x0
+  pushl $161
+80109bd5:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80109bda:	e9 8b f4 ff ff       	jmp    8010906a <alltraps>
+
+80109bdf <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109bdf:	6a 00                	push   $0x0
+  pushl $162
+80109be1:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109be6:	e9 7f f4 ff ff       	jmp    8010906a <alltraps>
+
+80109beb <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109beb:	6a 00                	push   $0x0
+  pushl $163
+80109bed:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109bf2:	e9 73 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109bf7 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109bf7:	6a 00                	push   $0x0
+  pushl $164
+80109bf9:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109bfe:	e9 67 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c03 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109c03:	6a 00                	push   $0x0
+  pushl $165
+80109c05:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109c0a:	e9 5b f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c0f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109c0f:	6a 00                	push   $0x0
+  pushl $166
+80109c11:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109c16:	e9 4f f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c1b <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109c1b:	6a 00                	push   $0x0
+  pushl $167
+80109c1d:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109c22:	e9 43 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c27 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109c27:	6a 00                	push   $0x0
+  pushl $168
+80109c29:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109c2e:	e9 37 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c33 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109c33:	6a 00                	push   $0x0
+  pushl $169
+80109c35:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109c3a:	e9 2b f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c3f <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109c3f:	6a 00                	push   $0x0
+  pushl $170
+80109c41:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109c46:	e9 1f f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c4b <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109c4b:	6a 00                	push   $0x0
+  pushl $171
+80109c4d:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109c52:	e9 13 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c57 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109c57:	6a 00                	push   $0x0
+  pushl $172
+80109c59:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109c5e:	e9 07 f4 ff ff       	jmp    8010906a <alltraps>
+
+80109c63 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109c63:	6a 00                	push   $0x0
+  pushl $173
+80109c65:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109c6a:	e9 fb f3 ff ff       	jmp    8010906a <alltraps>
+
+80109c6f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109c6f:	6a 00                	push   $0x0
+  pushl $174
+80109c71:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109c76:	e9 ef f3 ff ff       	jmp    8010906a <alltraps>
+
+80109c7b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109c7b:	6a 00                	push   $0x0
+  pushl $175
+80109c7d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109c82:	e9 e3 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109c87 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109c87:	6a 00                	push   $0x0
+  pushl $176
+80109c89:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+80109c8e:	e9 d7 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109c93 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109c93:	6a 00                	push   $0x0
+  pushl $177
+80109c95:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+80109c9a:	e9 cb f3 ff ff       	jmp    8010906a <alltraps>
+
+80109c9f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109c9f:	6a 00                	push   $0x0
+  pushl $178
+80109ca1:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109ca6:	e9 bf f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cab <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+80109cab:	6a 00                	push   $0x0
+  pushl $179
+80109cad:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109cb2:	e9 b3 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cb7 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109cb7:	6a 00                	push   $0x0
+  pushl $180
+80109cb9:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+80109cbe:	e9 a7 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cc3 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109cc3:	6a 00                	push   $0x0
+  pushl $181
+80109cc5:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80109cca:	e9 9b f3 ff ff       	jmp    8010906a <alltraps>
+
+80109ccf <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109ccf:	6a 00                	push   $0x0
+  pushl $182
+80109cd1:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109cd6:	e9 8f f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cdb <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80109cdb:	6a 00                	push   $0x0
+  pushl $183
+80109cdd:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109ce2:	e9 83 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109ce7 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109ce7:	6a 00                	push   $0x0
+  pushl $184
+80109ce9:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+80109cee:	e9 77 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cf3 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109cf3:	6a 00                	push   $0x0
+  pushl $185
+80109cf5:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109cfa:	e9 6b f3 ff ff       	jmp    8010906a <alltraps>
+
+80109cff <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109cff:	6a 00                	push   $0x0
+  pushl $186
+80109d01:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109d06:	e9 5f f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d0b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109d0b:	6a 00                	push   $0x0
+  pushl $187
+80109d0d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109d12:	e9 53 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d17 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109d17:	6a 00                	push   $0x0
+  pushl $188
+80109d19:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+80109d1e:	e9 47 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d23 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80109d23:	6a 00                	push   $0x0
+  pushl $189
+80109d25:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109d2a:	e9 3b f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d2f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+80109d2f:	6a 00                	push   $0x0
+  pushl $190
+80109d31:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109d36:	e9 2f f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d3b <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109d3b:	6a 00                	push   $0x0
+  pushl $191
+80109d3d:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80109d42:	e9 23 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d47 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109d47:	6a 00                	push   $0x0
+  pushl $192
+80109d49:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+80109d4e:	e9 17 f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d53 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80109d53:	6a 00                	push   $0x0
+  pushl $193
+80109d55:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109d5a:	e9 0b f3 ff ff       	jmp    8010906a <alltraps>
+
+80109d5f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+80109d5f:	6a 00                	push   $0x0
+  pushl $194
+80109d61:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109d66:	e9 ff f2 ff ff       	jmp    8010906a <alltraps>
+
+80109d6b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109d6b:	6a 00                	push   $0x0
+  pushl $195
+80109d6d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+80109d72:	e9 f3 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109d77 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80109d77:	6a 00                	push   $0x0
+  pushl $196
+80109d79:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+80109d7e:	e9 e7 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109d83 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80109d83:	6a 00                	push   $0x0
+  pushl $197
+80109d85:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+80109d8a:	e9 db f2 ff ff       	jmp    8010906a <alltraps>
+
+80109d8f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+80109d8f:	6a 00                	push   $0x0
+  pushl $198
+80109d91:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80109d96:	e9 cf f2 ff ff       	jmp    8010906a <alltraps>
+
+80109d9b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+80109d9b:	6a 00                	push   $0x0
+  pushl $199
+80109d9d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80109da2:	e9 c3 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109da7 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80109da7:	6a 00                	push   $0x0
+  pushl $200
+80109da9:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+80109dae:	e9 b7 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109db3 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80109db3:	6a 00                	push   $0x0
+  pushl $201
+80109db5:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+80109dba:	e9 ab f2 ff ff       	jmp    8010906a <alltraps>
+
+80109dbf <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+80109dbf:	6a 00                	push   $0x0
+  pushl $202
+80109dc1:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80109dc6:	e9 9f f2 ff ff       	jmp    8010906a <alltraps>
+
+80109dcb <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80109dcb:	6a 00                	push   $0x0
+  pushl $203
+80109dcd:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80109dd2:	e9 93 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109dd7 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80109dd7:	6a 00                	push   $0x0
+  pushl $204
+80109dd9:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+80109dde:	e9 87 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109de3 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80109de3:	6a 00                	push   $0x0
+  pushl $205
+80109de5:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109dea:	e9 7b f2 ff ff       	jmp    8010906a <alltraps>
+
+80109def <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109def:	6a 00                	push   $0x0
+  pushl $206
+80109df1:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109df6:	e9 6f f2 ff ff       	jmp    8010906a <alltraps>
+
+80109dfb <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109dfb:	6a 00                	push   $0x0
+  pushl $207
+80109dfd:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109e02:	e9 63 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e07 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109e07:	6a 00                	push   $0x0
+  pushl $208
+80109e09:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109e0e:	e9 57 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e13 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109e13:	6a 00                	push   $0x0
+  pushl $209
+80109e15:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109e1a:	e9 4b f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e1f <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109e1f:	6a 00                	push   $0x0
+  pushl $210
+80109e21:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109e26:	e9 3f f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e2b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109e2b:	6a 00                	push   $0x0
+  pushl $211
+80109e2d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109e32:	e9 33 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e37 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109e37:	6a 00                	push   $0x0
+  pushl $212
+80109e39:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109e3e:	e9 27 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e43 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109e43:	6a 00                	push   $0x0
+  pushl $213
+80109e45:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109e4a:	e9 1b f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e4f <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109e4f:	6a 00                	push   $0x0
+  pushl $214
+80109e51:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109e56:	e9 0f f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e5b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109e5b:	6a 00                	push   $0x0
+  pushl $215
+80109e5d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109e62:	e9 03 f2 ff ff       	jmp    8010906a <alltraps>
+
+80109e67 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109e67:	6a 00                	push   $0x0
+  pushl $216
+80109e69:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109e6e:	e9 f7 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109e73 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109e73:	6a 00                	push   $0x0
+  pushl $217
+80109e75:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109e7a:	e9 eb f1 ff ff       	jmp    8010906a <alltraps>
+
+80109e7f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109e7f:	6a 00                	push   $0x0
+  pushl $218
+80109e81:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109e86:	e9 df f1 ff ff       	jmp    8010906a <alltraps>
+
+80109e8b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109e8b:	6a 00                	push   $0x0
+  pushl $219
+80109e8d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109e92:	e9 d3 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109e97 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109e97:	6a 00                	push   $0x0
+  pushl $220
+80109e99:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109e9e:	e9 c7 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109ea3 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109ea3:	6a 00                	push   $0x0
+  pushl $221
+80109ea5:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109eaa:	e9 bb f1 ff ff       	jmp    8010906a <alltraps>
+
+80109eaf <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109eaf:	6a 00                	push   $0x0
+  pushl $222
+80109eb1:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109eb6:	e9 af f1 ff ff       	jmp    8010906a <alltraps>
+
+80109ebb <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109ebb:	6a 00                	push   $0x0
+  pushl $223
+80109ebd:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109ec2:	e9 a3 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109ec7 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109ec7:	6a 00                	push   $0x0
+  pushl $224
+80109ec9:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109ece:	e9 97 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109ed3 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109ed3:	6a 00                	push   $0x0
+  pushl $225
+80109ed5:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109eda:	e9 8b f1 ff ff       	jmp    8010906a <alltraps>
+
+80109edf <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109edf:	6a 00                	push   $0x0
+  pushl $226
+80109ee1:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109ee6:	e9 7f f1 ff ff       	jmp    8010906a <alltraps>
+
+80109eeb <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109eeb:	6a 00                	push   $0x0
+  pushl $227
+80109eed:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109ef2:	e9 73 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109ef7 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109ef7:	6a 00                	push   $0x0
+  pushl $228
+80109ef9:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109efe:	e9 67 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f03 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109f03:	6a 00                	push   $0x0
+  pushl $229
+80109f05:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109f0a:	e9 5b f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f0f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109f0f:	6a 00                	push   $0x0
+  pushl $230
+80109f11:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109f16:	e9 4f f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f1b <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109f1b:	6a 00                	push   $0x0
+  pushl $231
+80109f1d:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109f22:	e9 43 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f27 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109f27:	6a 00                	push   $0x0
+  pushl $232
+80109f29:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109f2e:	e9 37 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f33 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109f33:	6a 00                	push   $0x0
+  pushl $233
+80109f35:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109f3a:	e9 2b f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f3f <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109f3f:	6a 00                	push   $0x0
+  pushl $234
+80109f41:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109f46:	e9 1f f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f4b <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109f4b:	6a 00                	push   $0x0
+  pushl $235
+80109f4d:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109f52:	e9 13 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f57 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109f57:	6a 00                	push   $0x0
+  pushl $236
+80109f59:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109f5e:	e9 07 f1 ff ff       	jmp    8010906a <alltraps>
+
+80109f63 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109f63:	6a 00                	push   $0x0
+  pushl $237
+80109f65:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109f6a:	e9 fb f0 ff ff       	jmp    8010906a <alltraps>
+
+80109f6f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109f6f:	6a 00                	push   $0x0
+  pushl $238
+80109f71:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109f76:	e9 ef f0 ff ff       	jmp    8010906a <alltraps>
+
+80109f7b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109f7b:	6a 00                	push   $0x0
+  pushl $239
+80109f7d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109f82:	e9 e3 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109f87 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109f87:	6a 00                	push   $0x0
+  pushl $240
+80109f89:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109f8e:	e9 d7 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109f93 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109f93:	6a 00                	push   $0x0
+  pushl $241
+80109f95:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109f9a:	e9 cb f0 ff ff       	jmp    8010906a <alltraps>
+
+80109f9f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109f9f:	6a 00                	push   $0x0
+  pushl $242
+80109fa1:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109fa6:	e9 bf f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fab <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109fab:	6a 00                	push   $0x0
+  pushl $243
+80109fad:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109fb2:	e9 b3 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fb7 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109fb7:	6a 00                	push   $0x0
+  pushl $244
+80109fb9:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109fbe:	e9 a7 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fc3 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109fc3:	6a 00                	push   $0x0
+  pushl $245
+80109fc5:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109fca:	e9 9b f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fcf <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109fcf:	6a 00                	push   $0x0
+  pushl $246
+80109fd1:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109fd6:	e9 8f f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fdb <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109fdb:	6a 00                	push   $0x0
+  pushl $247
+80109fdd:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109fe2:	e9 83 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fe7 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109fe7:	6a 00                	push   $0x0
+  pushl $248
+80109fe9:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109fee:	e9 77 f0 ff ff       	jmp    8010906a <alltraps>
+
+80109ff3 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109ff3:	6a 00                	push   $0x0
+  pushl $249
+80109ff5:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109ffa:	e9 6b f0 ff ff       	jmp    8010906a <alltraps>
+
+80109fff <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109fff:	6a 00                	push   $0x0
+  pushl $250
+8010a001:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a006:	e9 5f f0 ff ff       	jmp    8010906a <alltraps>
+
+8010a00b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a00b:	6a 00                	push   $0x0
+  pushl $251
+8010a00d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a012:	e9 53 f0 ff ff       	jmp    8010906a <alltraps>
+
+8010a017 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a017:	6a 00                	push   $0x0
+  pushl $252
+8010a019:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a01e:	e9 47 f0 ff ff       	jmp    8010906a <alltraps>
+
+8010a023 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a023:	6a 00                	push   $0x0
+  pushl $253
+8010a025:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a02a:	e9 3b f0 ff ff       	jmp    8010906a <alltraps>
+
+8010a02f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a02f:	6a 00                	push   $0x0
+  pushl $254
+8010a031:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a036:	e9 2f f0 ff ff       	jmp    8010906a <alltraps>
+
+8010a03b <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a03b:	6a 00                	push   $0x0
+  pushl $255
+8010a03d:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a042:	e9 23 f0 ff ff       	jmp    8010906a <alltraps>
+8010a047:	66 90                	xchg   %ax,%ax
+8010a049:	66 90                	xchg   %ax,%ax
+8010a04b:	66 90                	xchg   %ax,%ax
+8010a04d:	66 90                	xchg   %ax,%ax
+8010a04f:	90                   	nop
+
+8010a050 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a050:	55                   	push   %ebp
+8010a051:	89 e5                	mov    %esp,%ebp
+8010a053:	57                   	push   %edi
+8010a054:	56                   	push   %esi
+8010a055:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a056:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a05c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a062:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010a065:	39 d3                	cmp    %edx,%ebx
+8010a067:	73 56                	jae    8010a0bf <deallocuvm.part.0+0x6f>
+8010a069:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a06c:	89 c6                	mov    %eax,%esi
+8010a06e:	89 d7                	mov    %edx,%edi
+8010a070:	eb 12                	jmp    8010a084 <deallocuvm.part.0+0x34>
+8010a072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a078:	83 c2 01             	add    $0x1,%edx
+8010a07b:	89 d3                	mov    %edx,%ebx
+8010a07d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a080:	39 fb                	cmp    %edi,%ebx
+8010a082:	73 38                	jae    8010a0bc <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+8010a084:	89 da                	mov    %ebx,%edx
+8010a086:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a089:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a08c:	a8 01                	test   $0x1,%al
+8010a08e:	74 e8                	je     8010a078 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a090:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a092:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a097:	c1 e9 0a             	shr    $0xa,%ecx
+8010a09a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a0a0:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+8010a0a7:	85 c0                	test   %eax,%eax
+8010a0a9:	74 cd                	je     8010a078 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010a0ab:	8b 10                	mov    (%eax),%edx
+8010a0ad:	f6 c2 01             	test   $0x1,%dl
+8010a0b0:	75 1e                	jne    8010a0d0 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+8010a0b2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a0b8:	39 fb                	cmp    %edi,%ebx
+8010a0ba:	72 c8                	jb     8010a084 <deallocuvm.part.0+0x34>
+8010a0bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010a0bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a0c2:	89 c8                	mov    %ecx,%eax
+8010a0c4:	5b                   	pop    %ebx
+8010a0c5:	5e                   	pop    %esi
+8010a0c6:	5f                   	pop    %edi
+8010a0c7:	5d                   	pop    %ebp
+8010a0c8:	c3                   	ret
+8010a0c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+8010a0d0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a0d6:	74 26                	je     8010a0fe <deallocuvm.part.0+0xae>
+      kfree(v);
+8010a0d8:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a0db:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a0e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010a0e4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010a0ea:	52                   	push   %edx
+8010a0eb:	e8 c0 a6 ff ff       	call   801047b0 <kfree>
+      *pte = 0;
+8010a0f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+8010a0f3:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+8010a0f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010a0fc:	eb 82                	jmp    8010a080 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010a0fe:	83 ec 0c             	sub    $0xc,%esp
+8010a101:	68 52 b0 10 80       	push   $0x8010b052
+8010a106:	e8 25 66 ff ff       	call   80100730 <panic>
+8010a10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a10f:	90                   	nop
+
+8010a110 <mappages>:
+{
+8010a110:	55                   	push   %ebp
+8010a111:	89 e5                	mov    %esp,%ebp
+8010a113:	57                   	push   %edi
+8010a114:	56                   	push   %esi
+8010a115:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a116:	89 d3                	mov    %edx,%ebx
+8010a118:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010a11e:	83 ec 1c             	sub    $0x1c,%esp
+8010a121:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a124:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a128:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a12d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010a130:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a133:	29 d8                	sub    %ebx,%eax
+8010a135:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a138:	eb 3f                	jmp    8010a179 <mappages+0x69>
+8010a13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a140:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a142:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a147:	c1 ea 0a             	shr    $0xa,%edx
+8010a14a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a150:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a157:	85 c0                	test   %eax,%eax
+8010a159:	74 75                	je     8010a1d0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010a15b:	f6 00 01             	testb  $0x1,(%eax)
+8010a15e:	0f 85 86 00 00 00    	jne    8010a1ea <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010a164:	0b 75 0c             	or     0xc(%ebp),%esi
+8010a167:	83 ce 01             	or     $0x1,%esi
+8010a16a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010a16c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010a16f:	39 c3                	cmp    %eax,%ebx
+8010a171:	74 6d                	je     8010a1e0 <mappages+0xd0>
+    a += PGSIZE;
+8010a173:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010a179:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010a17c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a17f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010a182:	89 d8                	mov    %ebx,%eax
+8010a184:	c1 e8 16             	shr    $0x16,%eax
+8010a187:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010a18a:	8b 07                	mov    (%edi),%eax
+8010a18c:	a8 01                	test   $0x1,%al
+8010a18e:	75 b0                	jne    8010a140 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010a190:	e8 2b a9 ff ff       	call   80104ac0 <kalloc>
+8010a195:	85 c0                	test   %eax,%eax
+8010a197:	74 37                	je     8010a1d0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010a199:	83 ec 04             	sub    $0x4,%esp
+8010a19c:	68 00 10 00 00       	push   $0x1000
+8010a1a1:	6a 00                	push   $0x0
+8010a1a3:	50                   	push   %eax
+8010a1a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010a1a7:	e8 a4 da ff ff       	call   80107c50 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a1ac:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010a1af:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a1b2:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010a1b8:	83 c8 07             	or     $0x7,%eax
+8010a1bb:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010a1bd:	89 d8                	mov    %ebx,%eax
+8010a1bf:	c1 e8 0a             	shr    $0xa,%eax
+8010a1c2:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a1c7:	01 d0                	add    %edx,%eax
+8010a1c9:	eb 90                	jmp    8010a15b <mappages+0x4b>
+8010a1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a1cf:	90                   	nop
+}
+8010a1d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a1d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a1d8:	5b                   	pop    %ebx
+8010a1d9:	5e                   	pop    %esi
+8010a1da:	5f                   	pop    %edi
+8010a1db:	5d                   	pop    %ebp
+8010a1dc:	c3                   	ret
+8010a1dd:	8d 76 00             	lea    0x0(%esi),%esi
+8010a1e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a1e3:	31 c0                	xor    %eax,%eax
+}
+8010a1e5:	5b                   	pop    %ebx
+8010a1e6:	5e                   	pop    %esi
+8010a1e7:	5f                   	pop    %edi
+8010a1e8:	5d                   	pop    %ebp
+8010a1e9:	c3                   	ret
+      panic("remap");
+8010a1ea:	83 ec 0c             	sub    $0xc,%esp
+8010a1ed:	68 a8 b7 10 80       	push   $0x8010b7a8
+8010a1f2:	e8 39 65 ff ff       	call   80100730 <panic>
+8010a1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a1fe:	66 90                	xchg   %ax,%ax
+
+8010a200 <seginit>:
+{
+8010a200:	55                   	push   %ebp
+8010a201:	89 e5                	mov    %esp,%ebp
+8010a203:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+8010a206:	e8 f5 c6 ff ff       	call   80106900 <cpuid>
+  pd[0] = size-1;
+8010a20b:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a210:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+8010a216:	c7 80 58 79 15 80 ff 	movl   $0xffff,-0x7fea86a8(%eax)
+8010a21d:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a220:	c7 80 60 79 15 80 ff 	movl   $0xffff,-0x7fea86a0(%eax)
+8010a227:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a22a:	c7 80 68 79 15 80 ff 	movl   $0xffff,-0x7fea8698(%eax)
+8010a231:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a234:	c7 80 70 79 15 80 ff 	movl   $0xffff,-0x7fea8690(%eax)
+8010a23b:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a23e:	c7 80 5c 79 15 80 00 	movl   $0xcf9a00,-0x7fea86a4(%eax)
+8010a245:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a248:	c7 80 64 79 15 80 00 	movl   $0xcf9200,-0x7fea869c(%eax)
+8010a24f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a252:	c7 80 6c 79 15 80 00 	movl   $0xcffa00,-0x7fea8694(%eax)
+8010a259:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a25c:	c7 80 74 79 15 80 00 	movl   $0xcff200,-0x7fea868c(%eax)
+8010a263:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a266:	05 50 79 15 80       	add    $0x80157950,%eax
+8010a26b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010a26f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a273:	c1 e8 10             	shr    $0x10,%eax
+8010a276:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a27a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010a27d:	0f 01 10             	lgdtl  (%eax)
+}
+8010a280:	c9                   	leave
+8010a281:	c3                   	ret
+8010a282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010a290 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a290:	a1 04 8d 15 80       	mov    0x80158d04,%eax
+8010a295:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a29a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a29d:	c3                   	ret
+8010a29e:	66 90                	xchg   %ax,%ax
+
+8010a2a0 <switchuvm>:
+{
+8010a2a0:	55                   	push   %ebp
+8010a2a1:	89 e5                	mov    %esp,%ebp
+8010a2a3:	57                   	push   %edi
+8010a2a4:	56                   	push   %esi
+8010a2a5:	53                   	push   %ebx
+8010a2a6:	83 ec 1c             	sub    $0x1c,%esp
+8010a2a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a2ac:	85 f6                	test   %esi,%esi
+8010a2ae:	0f 84 cb 00 00 00    	je     8010a37f <switchuvm+0xdf>
+  if(p->kstack == 0)
+8010a2b4:	8b 46 08             	mov    0x8(%esi),%eax
+8010a2b7:	85 c0                	test   %eax,%eax
+8010a2b9:	0f 84 da 00 00 00    	je     8010a399 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+8010a2bf:	8b 46 04             	mov    0x4(%esi),%eax
+8010a2c2:	85 c0                	test   %eax,%eax
+8010a2c4:	0f 84 c2 00 00 00    	je     8010a38c <switchuvm+0xec>
+  pushcli();
+8010a2ca:	e8 51 d7 ff ff       	call   80107a20 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a2cf:	e8 cc c5 ff ff       	call   801068a0 <mycpu>
+8010a2d4:	89 c3                	mov    %eax,%ebx
+8010a2d6:	e8 c5 c5 ff ff       	call   801068a0 <mycpu>
+8010a2db:	89 c7                	mov    %eax,%edi
+8010a2dd:	e8 be c5 ff ff       	call   801068a0 <mycpu>
+8010a2e2:	83 c7 08             	add    $0x8,%edi
+8010a2e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a2e8:	e8 b3 c5 ff ff       	call   801068a0 <mycpu>
+8010a2ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a2f0:	ba 67 00 00 00       	mov    $0x67,%edx
+8010a2f5:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a2fc:	83 c0 08             	add    $0x8,%eax
+8010a2ff:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a306:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a30b:	83 c1 08             	add    $0x8,%ecx
+8010a30e:	c1 e8 18             	shr    $0x18,%eax
+8010a311:	c1 e9 10             	shr    $0x10,%ecx
+8010a314:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010a31a:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010a320:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010a325:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a32c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a331:	e8 6a c5 ff ff       	call   801068a0 <mycpu>
+8010a336:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a33d:	e8 5e c5 ff ff       	call   801068a0 <mycpu>
+8010a342:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a346:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a349:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a34f:	e8 4c c5 ff ff       	call   801068a0 <mycpu>
+8010a354:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a357:	e8 44 c5 ff ff       	call   801068a0 <mycpu>
+8010a35c:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010a360:	b8 28 00 00 00       	mov    $0x28,%eax
+8010a365:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010a368:	8b 46 04             	mov    0x4(%esi),%eax
+8010a36b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a370:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a373:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a376:	5b                   	pop    %ebx
+8010a377:	5e                   	pop    %esi
+8010a378:	5f                   	pop    %edi
+8010a379:	5d                   	pop    %ebp
+  popcli();
+8010a37a:	e9 f1 d6 ff ff       	jmp    80107a70 <popcli>
+    panic("switchuvm: no process");
+8010a37f:	83 ec 0c             	sub    $0xc,%esp
+8010a382:	68 ae b7 10 80       	push   $0x8010b7ae
+8010a387:	e8 a4 63 ff ff       	call   80100730 <panic>
+    panic("switchuvm: no pgdir");
+8010a38c:	83 ec 0c             	sub    $0xc,%esp
+8010a38f:	68 d9 b7 10 80       	push   $0x8010b7d9
+8010a394:	e8 97 63 ff ff       	call   80100730 <panic>
+    panic("switchuvm: no kstack");
+8010a399:	83 ec 0c             	sub    $0xc,%esp
+8010a39c:	68 c4 b7 10 80       	push   $0x8010b7c4
+8010a3a1:	e8 8a 63 ff ff       	call   80100730 <panic>
+8010a3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010a3b0 <inituvm>:
+{
+8010a3b0:	55                   	push   %ebp
+8010a3b1:	89 e5                	mov    %esp,%ebp
+8010a3b3:	57                   	push   %edi
+8010a3b4:	56                   	push   %esi
+8010a3b5:	53                   	push   %ebx
+8010a3b6:	83 ec 1c             	sub    $0x1c,%esp
+8010a3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a3bc:	8b 75 10             	mov    0x10(%ebp),%esi
+8010a3bf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010a3c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010a3c5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a3cb:	77 49                	ja     8010a416 <inituvm+0x66>
+  mem = kalloc();
+8010a3cd:	e8 ee a6 ff ff       	call   80104ac0 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010a3d2:	83 ec 04             	sub    $0x4,%esp
+8010a3d5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010a3da:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010a3dc:	6a 00                	push   $0x0
+8010a3de:	50                   	push   %eax
+8010a3df:	e8 6c d8 ff ff       	call   80107c50 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010a3e4:	58                   	pop    %eax
+8010a3e5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a3eb:	5a                   	pop    %edx
+8010a3ec:	6a 06                	push   $0x6
+8010a3ee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a3f3:	31 d2                	xor    %edx,%edx
+8010a3f5:	50                   	push   %eax
+8010a3f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a3f9:	e8 12 fd ff ff       	call   8010a110 <mappages>
+  memmove(mem, init, sz);
+8010a3fe:	89 75 10             	mov    %esi,0x10(%ebp)
+8010a401:	83 c4 10             	add    $0x10,%esp
+8010a404:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010a407:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010a40a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a40d:	5b                   	pop    %ebx
+8010a40e:	5e                   	pop    %esi
+8010a40f:	5f                   	pop    %edi
+8010a410:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010a411:	e9 ca d8 ff ff       	jmp    80107ce0 <memmove>
+    panic("inituvm: more than a page");
+8010a416:	83 ec 0c             	sub    $0xc,%esp
+8010a419:	68 ed b7 10 80       	push   $0x8010b7ed
+8010a41e:	e8 0d 63 ff ff       	call   80100730 <panic>
+8010a423:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a430 <loaduvm>:
+{
+8010a430:	55                   	push   %ebp
+8010a431:	89 e5                	mov    %esp,%ebp
+8010a433:	57                   	push   %edi
+8010a434:	56                   	push   %esi
+8010a435:	53                   	push   %ebx
+8010a436:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010a439:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010a43c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010a43f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010a445:	0f 85 a2 00 00 00    	jne    8010a4ed <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a44b:	85 ff                	test   %edi,%edi
+8010a44d:	74 7d                	je     8010a4cc <loaduvm+0x9c>
+8010a44f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010a450:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010a453:	8b 55 08             	mov    0x8(%ebp),%edx
+8010a456:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010a458:	89 c1                	mov    %eax,%ecx
+8010a45a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a45d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010a460:	f6 c1 01             	test   $0x1,%cl
+8010a463:	75 13                	jne    8010a478 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010a465:	83 ec 0c             	sub    $0xc,%esp
+8010a468:	68 07 b8 10 80       	push   $0x8010b807
+8010a46d:	e8 be 62 ff ff       	call   80100730 <panic>
+8010a472:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a478:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a47b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010a481:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a486:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010a48d:	85 c9                	test   %ecx,%ecx
+8010a48f:	74 d4                	je     8010a465 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010a491:	89 fb                	mov    %edi,%ebx
+8010a493:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010a498:	29 f3                	sub    %esi,%ebx
+8010a49a:	39 c3                	cmp    %eax,%ebx
+8010a49c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a49f:	53                   	push   %ebx
+8010a4a0:	8b 45 14             	mov    0x14(%ebp),%eax
+8010a4a3:	01 f0                	add    %esi,%eax
+8010a4a5:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010a4a6:	8b 01                	mov    (%ecx),%eax
+8010a4a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a4ad:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a4b2:	50                   	push   %eax
+8010a4b3:	ff 75 10             	push   0x10(%ebp)
+8010a4b6:	e8 75 8b ff ff       	call   80103030 <readi>
+8010a4bb:	83 c4 10             	add    $0x10,%esp
+8010a4be:	39 d8                	cmp    %ebx,%eax
+8010a4c0:	75 1e                	jne    8010a4e0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a4c2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010a4c8:	39 fe                	cmp    %edi,%esi
+8010a4ca:	72 84                	jb     8010a450 <loaduvm+0x20>
+}
+8010a4cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a4cf:	31 c0                	xor    %eax,%eax
+}
+8010a4d1:	5b                   	pop    %ebx
+8010a4d2:	5e                   	pop    %esi
+8010a4d3:	5f                   	pop    %edi
+8010a4d4:	5d                   	pop    %ebp
+8010a4d5:	c3                   	ret
+8010a4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a4dd:	8d 76 00             	lea    0x0(%esi),%esi
+8010a4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a4e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a4e8:	5b                   	pop    %ebx
+8010a4e9:	5e                   	pop    %esi
+8010a4ea:	5f                   	pop    %edi
+8010a4eb:	5d                   	pop    %ebp
+8010a4ec:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010a4ed:	83 ec 0c             	sub    $0xc,%esp
+8010a4f0:	68 74 b8 10 80       	push   $0x8010b874
+8010a4f5:	e8 36 62 ff ff       	call   80100730 <panic>
+8010a4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a500 <allocuvm>:
+{
+8010a500:	55                   	push   %ebp
+8010a501:	89 e5                	mov    %esp,%ebp
+8010a503:	57                   	push   %edi
+8010a504:	56                   	push   %esi
+8010a505:	53                   	push   %ebx
+8010a506:	83 ec 1c             	sub    $0x1c,%esp
+8010a509:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010a50c:	85 f6                	test   %esi,%esi
+8010a50e:	0f 88 98 00 00 00    	js     8010a5ac <allocuvm+0xac>
+8010a514:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010a516:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a519:	0f 82 a1 00 00 00    	jb     8010a5c0 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+8010a51f:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a522:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010a527:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a52c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010a52e:	39 f0                	cmp    %esi,%eax
+8010a530:	0f 83 8d 00 00 00    	jae    8010a5c3 <allocuvm+0xc3>
+8010a536:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010a539:	eb 44                	jmp    8010a57f <allocuvm+0x7f>
+8010a53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a53f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010a540:	83 ec 04             	sub    $0x4,%esp
+8010a543:	68 00 10 00 00       	push   $0x1000
+8010a548:	6a 00                	push   $0x0
+8010a54a:	50                   	push   %eax
+8010a54b:	e8 00 d7 ff ff       	call   80107c50 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010a550:	58                   	pop    %eax
+8010a551:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a557:	5a                   	pop    %edx
+8010a558:	6a 06                	push   $0x6
+8010a55a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a55f:	89 fa                	mov    %edi,%edx
+8010a561:	50                   	push   %eax
+8010a562:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a565:	e8 a6 fb ff ff       	call   8010a110 <mappages>
+8010a56a:	83 c4 10             	add    $0x10,%esp
+8010a56d:	85 c0                	test   %eax,%eax
+8010a56f:	78 5f                	js     8010a5d0 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+8010a571:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010a577:	39 f7                	cmp    %esi,%edi
+8010a579:	0f 83 89 00 00 00    	jae    8010a608 <allocuvm+0x108>
+    mem = kalloc();
+8010a57f:	e8 3c a5 ff ff       	call   80104ac0 <kalloc>
+8010a584:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010a586:	85 c0                	test   %eax,%eax
+8010a588:	75 b6                	jne    8010a540 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010a58a:	83 ec 0c             	sub    $0xc,%esp
+8010a58d:	68 25 b8 10 80       	push   $0x8010b825
+8010a592:	e8 c9 64 ff ff       	call   80100a60 <cprintf>
+  if(newsz >= oldsz)
+8010a597:	83 c4 10             	add    $0x10,%esp
+8010a59a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a59d:	74 0d                	je     8010a5ac <allocuvm+0xac>
+8010a59f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010a5a2:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a5a5:	89 f2                	mov    %esi,%edx
+8010a5a7:	e8 a4 fa ff ff       	call   8010a050 <deallocuvm.part.0>
+    return 0;
+8010a5ac:	31 d2                	xor    %edx,%edx
+}
+8010a5ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a5b1:	89 d0                	mov    %edx,%eax
+8010a5b3:	5b                   	pop    %ebx
+8010a5b4:	5e                   	pop    %esi
+8010a5b5:	5f                   	pop    %edi
+8010a5b6:	5d                   	pop    %ebp
+8010a5b7:	c3                   	ret
+8010a5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a5bf:	90                   	nop
+    return oldsz;
+8010a5c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010a5c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a5c6:	89 d0                	mov    %edx,%eax
+8010a5c8:	5b                   	pop    %ebx
+8010a5c9:	5e                   	pop    %esi
+8010a5ca:	5f                   	pop    %edi
+8010a5cb:	5d                   	pop    %ebp
+8010a5cc:	c3                   	ret
+8010a5cd:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010a5d0:	83 ec 0c             	sub    $0xc,%esp
+8010a5d3:	68 3d b8 10 80       	push   $0x8010b83d
+8010a5d8:	e8 83 64 ff ff       	call   80100a60 <cprintf>
+  if(newsz >= oldsz)
+8010a5dd:	83 c4 10             	add    $0x10,%esp
+8010a5e0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a5e3:	74 0d                	je     8010a5f2 <allocuvm+0xf2>
+8010a5e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010a5e8:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a5eb:	89 f2                	mov    %esi,%edx
+8010a5ed:	e8 5e fa ff ff       	call   8010a050 <deallocuvm.part.0>
+      kfree(mem);
+8010a5f2:	83 ec 0c             	sub    $0xc,%esp
+8010a5f5:	53                   	push   %ebx
+8010a5f6:	e8 b5 a1 ff ff       	call   801047b0 <kfree>
+      return 0;
+8010a5fb:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010a5fe:	31 d2                	xor    %edx,%edx
+8010a600:	eb ac                	jmp    8010a5ae <allocuvm+0xae>
+8010a602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010a608:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010a60b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a60e:	5b                   	pop    %ebx
+8010a60f:	5e                   	pop    %esi
+8010a610:	89 d0                	mov    %edx,%eax
+8010a612:	5f                   	pop    %edi
+8010a613:	5d                   	pop    %ebp
+8010a614:	c3                   	ret
+8010a615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010a620 <deallocuvm>:
+{
+8010a620:	55                   	push   %ebp
+8010a621:	89 e5                	mov    %esp,%ebp
+8010a623:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a626:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010a629:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010a62c:	39 d1                	cmp    %edx,%ecx
+8010a62e:	73 10                	jae    8010a640 <deallocuvm+0x20>
+}
+8010a630:	5d                   	pop    %ebp
+8010a631:	e9 1a fa ff ff       	jmp    8010a050 <deallocuvm.part.0>
+8010a636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a63d:	8d 76 00             	lea    0x0(%esi),%esi
+8010a640:	89 d0                	mov    %edx,%eax
+8010a642:	5d                   	pop    %ebp
+8010a643:	c3                   	ret
+8010a644:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a64f:	90                   	nop
+
+8010a650 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010a650:	55                   	push   %ebp
+8010a651:	89 e5                	mov    %esp,%ebp
+8010a653:	57                   	push   %edi
+8010a654:	56                   	push   %esi
+8010a655:	53                   	push   %ebx
+8010a656:	83 ec 0c             	sub    $0xc,%esp
+8010a659:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010a65c:	85 f6                	test   %esi,%esi
+8010a65e:	74 59                	je     8010a6b9 <freevm+0x69>
+  if(newsz >= oldsz)
+8010a660:	31 c9                	xor    %ecx,%ecx
+8010a662:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010a667:	89 f0                	mov    %esi,%eax
+8010a669:	89 f3                	mov    %esi,%ebx
+8010a66b:	e8 e0 f9 ff ff       	call   8010a050 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+8010a670:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010a676:	eb 0f                	jmp    8010a687 <freevm+0x37>
+8010a678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a67f:	90                   	nop
+8010a680:	83 c3 04             	add    $0x4,%ebx
+8010a683:	39 fb                	cmp    %edi,%ebx
+8010a685:	74 23                	je     8010a6aa <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010a687:	8b 03                	mov    (%ebx),%eax
+8010a689:	a8 01                	test   $0x1,%al
+8010a68b:	74 f3                	je     8010a680 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010a68d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010a692:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010a695:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010a698:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010a69d:	50                   	push   %eax
+8010a69e:	e8 0d a1 ff ff       	call   801047b0 <kfree>
+8010a6a3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010a6a6:	39 fb                	cmp    %edi,%ebx
+8010a6a8:	75 dd                	jne    8010a687 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010a6aa:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010a6ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a6b0:	5b                   	pop    %ebx
+8010a6b1:	5e                   	pop    %esi
+8010a6b2:	5f                   	pop    %edi
+8010a6b3:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010a6b4:	e9 f7 a0 ff ff       	jmp    801047b0 <kfree>
+    panic("freevm: no pgdir");
+8010a6b9:	83 ec 0c             	sub    $0xc,%esp
+8010a6bc:	68 59 b8 10 80       	push   $0x8010b859
+8010a6c1:	e8 6a 60 ff ff       	call   80100730 <panic>
+8010a6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010a6d0 <setupkvm>:
+{
+8010a6d0:	55                   	push   %ebp
+8010a6d1:	89 e5                	mov    %esp,%ebp
+8010a6d3:	56                   	push   %esi
+8010a6d4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010a6d5:	e8 e6 a3 ff ff       	call   80104ac0 <kalloc>
+8010a6da:	85 c0                	test   %eax,%eax
+8010a6dc:	74 5e                	je     8010a73c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010a6de:	83 ec 04             	sub    $0x4,%esp
+8010a6e1:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a6e3:	bb 20 e4 10 80       	mov    $0x8010e420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010a6e8:	68 00 10 00 00       	push   $0x1000
+8010a6ed:	6a 00                	push   $0x0
+8010a6ef:	50                   	push   %eax
+8010a6f0:	e8 5b d5 ff ff       	call   80107c50 <memset>
+8010a6f5:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+8010a6f8:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010a6fb:	83 ec 08             	sub    $0x8,%esp
+8010a6fe:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010a701:	8b 13                	mov    (%ebx),%edx
+8010a703:	ff 73 0c             	push   0xc(%ebx)
+8010a706:	50                   	push   %eax
+8010a707:	29 c1                	sub    %eax,%ecx
+8010a709:	89 f0                	mov    %esi,%eax
+8010a70b:	e8 00 fa ff ff       	call   8010a110 <mappages>
+8010a710:	83 c4 10             	add    $0x10,%esp
+8010a713:	85 c0                	test   %eax,%eax
+8010a715:	78 19                	js     8010a730 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a717:	83 c3 10             	add    $0x10,%ebx
+8010a71a:	81 fb 60 e4 10 80    	cmp    $0x8010e460,%ebx
+8010a720:	75 d6                	jne    8010a6f8 <setupkvm+0x28>
+}
+8010a722:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a725:	89 f0                	mov    %esi,%eax
+8010a727:	5b                   	pop    %ebx
+8010a728:	5e                   	pop    %esi
+8010a729:	5d                   	pop    %ebp
+8010a72a:	c3                   	ret
+8010a72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a72f:	90                   	nop
+      freevm(pgdir);
+8010a730:	83 ec 0c             	sub    $0xc,%esp
+8010a733:	56                   	push   %esi
+8010a734:	e8 17 ff ff ff       	call   8010a650 <freevm>
+      return 0;
+8010a739:	83 c4 10             	add    $0x10,%esp
+}
+8010a73c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010a73f:	31 f6                	xor    %esi,%esi
+}
+8010a741:	89 f0                	mov    %esi,%eax
+8010a743:	5b                   	pop    %ebx
+8010a744:	5e                   	pop    %esi
+8010a745:	5d                   	pop    %ebp
+8010a746:	c3                   	ret
+8010a747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a74e:	66 90                	xchg   %ax,%ax
+
+8010a750 <kvmalloc>:
+{
+8010a750:	55                   	push   %ebp
+8010a751:	89 e5                	mov    %esp,%ebp
+8010a753:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010a756:	e8 75 ff ff ff       	call   8010a6d0 <setupkvm>
+8010a75b:	a3 04 8d 15 80       	mov    %eax,0x80158d04
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a760:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a765:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a768:	c9                   	leave
+8010a769:	c3                   	ret
+8010a76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a770 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010a770:	55                   	push   %ebp
+8010a771:	89 e5                	mov    %esp,%ebp
+8010a773:	83 ec 08             	sub    $0x8,%esp
+8010a776:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010a779:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010a77c:	89 c1                	mov    %eax,%ecx
+8010a77e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a781:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010a784:	f6 c2 01             	test   $0x1,%dl
+8010a787:	75 17                	jne    8010a7a0 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010a789:	83 ec 0c             	sub    $0xc,%esp
+8010a78c:	68 6a b8 10 80       	push   $0x8010b86a
+8010a791:	e8 9a 5f ff ff       	call   80100730 <panic>
+8010a796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a79d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a7a0:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a7a3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010a7a9:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a7ae:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010a7b5:	85 c0                	test   %eax,%eax
+8010a7b7:	74 d0                	je     8010a789 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010a7b9:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010a7bc:	c9                   	leave
+8010a7bd:	c3                   	ret
+8010a7be:	66 90                	xchg   %ax,%ax
+
+8010a7c0 <copyuvm>:
+// and cowuvm() copies them on the first write.  Heap pages
+// that lazyuvm() has not allocated yet stay unmapped.
+// pgdir must be the current page table.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010a7c0:	55                   	push   %ebp
+8010a7c1:	89 e5                	mov    %esp,%ebp
+8010a7c3:	57                   	push   %edi
+8010a7c4:	56                   	push   %esi
+8010a7c5:	53                   	push   %ebx
+8010a7c6:	83 ec 1c             	sub    $0x1c,%esp
+8010a7c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+
+  if((d = setupkvm()) == 0)
+8010a7cc:	e8 ff fe ff ff       	call   8010a6d0 <setupkvm>
+8010a7d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a7d4:	85 c0                	test   %eax,%eax
+8010a7d6:	0f 84 eb 00 00 00    	je     8010a8c7 <copyuvm+0x107>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010a7dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a7df:	31 ff                	xor    %edi,%edi
+8010a7e1:	85 c0                	test   %eax,%eax
+8010a7e3:	75 1c                	jne    8010a801 <copyuvm+0x41>
+8010a7e5:	e9 9f 00 00 00       	jmp    8010a889 <copyuvm+0xc9>
+8010a7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010a7f0:	83 c1 01             	add    $0x1,%ecx
+8010a7f3:	89 cf                	mov    %ecx,%edi
+8010a7f5:	c1 e7 16             	shl    $0x16,%edi
+  for(i = 0; i < sz; i += PGSIZE){
+8010a7f8:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010a7fb:	0f 83 88 00 00 00    	jae    8010a889 <copyuvm+0xc9>
+  pde = &pgdir[PDX(va)];
+8010a801:	89 f9                	mov    %edi,%ecx
+8010a803:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a806:	8b 04 8e             	mov    (%esi,%ecx,4),%eax
+8010a809:	a8 01                	test   $0x1,%al
+8010a80b:	74 e3                	je     8010a7f0 <copyuvm+0x30>
+  return &pgtab[PTX(va)];
+8010a80d:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a80f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a814:	c1 eb 0a             	shr    $0xa,%ebx
+8010a817:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010a81d:	8d 84 18 00 00 00 80 	lea    -0x80000000(%eax,%ebx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010a824:	85 c0                	test   %eax,%eax
+8010a826:	74 c8                	je     8010a7f0 <copyuvm+0x30>
+      continue;
+    }
+    if(!(*pte & PTE_P))
+8010a828:	8b 08                	mov    (%eax),%ecx
+8010a82a:	f6 c1 01             	test   $0x1,%cl
+8010a82d:	74 71                	je     8010a8a0 <copyuvm+0xe0>
+      continue;
+    if(*pte & PTE_W)
+8010a82f:	f6 c1 02             	test   $0x2,%cl
+8010a832:	74 0b                	je     8010a83f <copyuvm+0x7f>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010a834:	81 e1 fd fd ff ff    	and    $0xfffffdfd,%ecx
+8010a83a:	80 cd 02             	or     $0x2,%ch
+8010a83d:	89 08                	mov    %ecx,(%eax)
+    pa = PTE_ADDR(*pte);
+8010a83f:	89 cb                	mov    %ecx,%ebx
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a841:	83 ec 08             	sub    $0x8,%esp
+    flags = PTE_FLAGS(*pte);
+8010a844:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a84a:	89 fa                	mov    %edi,%edx
+    pa = PTE_ADDR(*pte);
+8010a84c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a852:	51                   	push   %ecx
+8010a853:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a858:	53                   	push   %ebx
+8010a859:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a85c:	e8 af f8 ff ff       	call   8010a110 <mappages>
+8010a861:	83 c4 10             	add    $0x10,%esp
+8010a864:	85 c0                	test   %eax,%eax
+8010a866:	78 48                	js     8010a8b0 <copyuvm+0xf0>
+      goto bad;
+    kincref(P2V(pa));
+8010a868:	83 ec 0c             	sub    $0xc,%esp
+8010a86b:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+  for(i = 0; i < sz; i += PGSIZE){
+8010a871:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    kincref(P2V(pa));
+8010a877:	53                   	push   %ebx
+8010a878:	e8 a3 a4 ff ff       	call   80104d20 <kincref>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a87d:	83 c4 10             	add    $0x10,%esp
+8010a880:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010a883:	0f 82 78 ff ff ff    	jb     8010a801 <copyuvm+0x41>
+  }
+  lcr3(V2P(pgdir));  // parent's writable pages are now read-only
+8010a889:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010a88f:	0f 22 de             	mov    %esi,%cr3
+
+bad:
+  lcr3(V2P(pgdir));
+  freevm(d);
+  return 0;
+}
+8010a892:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a898:	5b                   	pop    %ebx
+8010a899:	5e                   	pop    %esi
+8010a89a:	5f                   	pop    %edi
+8010a89b:	5d                   	pop    %ebp
+8010a89c:	c3                   	ret
+8010a89d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010a8a0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010a8a6:	e9 4d ff ff ff       	jmp    8010a7f8 <copyuvm+0x38>
+8010a8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a8af:	90                   	nop
+  lcr3(V2P(pgdir));
+8010a8b0:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010a8b6:	0f 22 de             	mov    %esi,%cr3
+  freevm(d);
+8010a8b9:	83 ec 0c             	sub    $0xc,%esp
+8010a8bc:	ff 75 e4             	push   -0x1c(%ebp)
+8010a8bf:	e8 8c fd ff ff       	call   8010a650 <freevm>
+  return 0;
+8010a8c4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010a8c7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+}
+8010a8ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a8d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a8d4:	5b                   	pop    %ebx
+8010a8d5:	5e                   	pop    %esi
+8010a8d6:	5f                   	pop    %edi
+8010a8d7:	5d                   	pop    %ebp
+8010a8d8:	c3                   	ret
+8010a8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010a8e0 <cowuvm>:
+// page just takes it over.  Returns 0 on success, -1 if va is
+// not a copy-on-write page or memory ran out.  The caller must
+// flush the TLB if pgdir is the current page table.
+int
+cowuvm(pde_t *pgdir, uint va)
+{
+8010a8e0:	55                   	push   %ebp
+8010a8e1:	89 e5                	mov    %esp,%ebp
+8010a8e3:	57                   	push   %edi
+8010a8e4:	56                   	push   %esi
+8010a8e5:	53                   	push   %ebx
+8010a8e6:	83 ec 1c             	sub    $0x1c,%esp
+8010a8e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+8010a8ec:	85 c0                	test   %eax,%eax
+8010a8ee:	0f 88 b4 00 00 00    	js     8010a9a8 <cowuvm+0xc8>
+  if(*pde & PTE_P){
+8010a8f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    return -1;
+  pte = walkpgdir(pgdir, (char*)PGROUNDDOWN(va), 0);
+8010a8f7:	89 c2                	mov    %eax,%edx
+  pde = &pgdir[PDX(va)];
+8010a8f9:	c1 e8 16             	shr    $0x16,%eax
+  pte = walkpgdir(pgdir, (char*)PGROUNDDOWN(va), 0);
+8010a8fc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(*pde & PTE_P){
+8010a902:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010a905:	a8 01                	test   $0x1,%al
+8010a907:	0f 84 9b 00 00 00    	je     8010a9a8 <cowuvm+0xc8>
+  return &pgtab[PTX(va)];
+8010a90d:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a910:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a915:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a91b:	8d bc 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%edi
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010a922:	85 ff                	test   %edi,%edi
+8010a924:	0f 84 7e 00 00 00    	je     8010a9a8 <cowuvm+0xc8>
+8010a92a:	8b 1f                	mov    (%edi),%ebx
+8010a92c:	89 d8                	mov    %ebx,%eax
+8010a92e:	25 05 02 00 00       	and    $0x205,%eax
+8010a933:	3d 05 02 00 00       	cmp    $0x205,%eax
+8010a938:	75 6e                	jne    8010a9a8 <cowuvm+0xc8>
+    return -1;
+  pa = PTE_ADDR(*pte);
+8010a93a:	89 da                	mov    %ebx,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcnt(P2V(pa)) == 1){
+8010a93c:	83 ec 0c             	sub    $0xc,%esp
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a93f:	81 e3 fd 0d 00 00    	and    $0xdfd,%ebx
+  pa = PTE_ADDR(*pte);
+8010a945:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a94b:	83 cb 02             	or     $0x2,%ebx
+  if(krefcnt(P2V(pa)) == 1){
+8010a94e:	8d b2 00 00 00 80    	lea    -0x80000000(%edx),%esi
+8010a954:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010a957:	56                   	push   %esi
+8010a958:	e8 13 a4 ff ff       	call   80104d70 <krefcnt>
+8010a95d:	83 c4 10             	add    $0x10,%esp
+8010a960:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a963:	83 f8 01             	cmp    $0x1,%eax
+8010a966:	74 50                	je     8010a9b8 <cowuvm+0xd8>
+    *pte = pa | flags;
+    return 0;
+  }
+  if((mem = kalloc()) == 0)
+8010a968:	e8 53 a1 ff ff       	call   80104ac0 <kalloc>
+8010a96d:	85 c0                	test   %eax,%eax
+8010a96f:	74 37                	je     8010a9a8 <cowuvm+0xc8>
+    return -1;
+  memmove(mem, (char*)P2V(pa), PGSIZE);
+8010a971:	83 ec 04             	sub    $0x4,%esp
+8010a974:	68 00 10 00 00       	push   $0x1000
+8010a979:	56                   	push   %esi
+8010a97a:	50                   	push   %eax
+8010a97b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a97e:	e8 5d d3 ff ff       	call   80107ce0 <memmove>
+  *pte = V2P(mem) | flags;
+8010a983:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a986:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a98c:	09 da                	or     %ebx,%edx
+8010a98e:	89 17                	mov    %edx,(%edi)
+  kfree(P2V(pa));
+8010a990:	89 34 24             	mov    %esi,(%esp)
+8010a993:	e8 18 9e ff ff       	call   801047b0 <kfree>
+  return 0;
+8010a998:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010a99b:	31 c0                	xor    %eax,%eax
+}
+8010a99d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9a0:	5b                   	pop    %ebx
+8010a9a1:	5e                   	pop    %esi
+8010a9a2:	5f                   	pop    %edi
+8010a9a3:	5d                   	pop    %ebp
+8010a9a4:	c3                   	ret
+8010a9a5:	8d 76 00             	lea    0x0(%esi),%esi
+8010a9a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010a9ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a9b0:	5b                   	pop    %ebx
+8010a9b1:	5e                   	pop    %esi
+8010a9b2:	5f                   	pop    %edi
+8010a9b3:	5d                   	pop    %ebp
+8010a9b4:	c3                   	ret
+8010a9b5:	8d 76 00             	lea    0x0(%esi),%esi
+    *pte = pa | flags;
+8010a9b8:	09 da                	or     %ebx,%edx
+    return 0;
+8010a9ba:	31 c0                	xor    %eax,%eax
+    *pte = pa | flags;
+8010a9bc:	89 17                	mov    %edx,(%edi)
+    return 0;
+8010a9be:	eb dd                	jmp    8010a99d <cowuvm+0xbd>
+
+8010a9c0 <lazyuvm>:
+// the heap that growproc() reserved but did not allocate.
+// Returns 0 on success, -1 if va is outside the first sz bytes,
+// is already mapped, or memory ran out.
+int
+lazyuvm(pde_t *pgdir, uint va, uint sz)
+{
+8010a9c0:	55                   	push   %ebp
+8010a9c1:	89 e5                	mov    %esp,%ebp
+8010a9c3:	57                   	push   %edi
+8010a9c4:	56                   	push   %esi
+8010a9c5:	53                   	push   %ebx
+8010a9c6:	83 ec 0c             	sub    $0xc,%esp
+8010a9c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010a9cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+8010a9cf:	3b 45 10             	cmp    0x10(%ebp),%eax
+8010a9d2:	73 7c                	jae    8010aa50 <lazyuvm+0x90>
+8010a9d4:	85 c0                	test   %eax,%eax
+8010a9d6:	78 78                	js     8010aa50 <lazyuvm+0x90>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010a9d8:	89 c6                	mov    %eax,%esi
+  pde = &pgdir[PDX(va)];
+8010a9da:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010a9dd:	8b 04 83             	mov    (%ebx,%eax,4),%eax
+  va = PGROUNDDOWN(va);
+8010a9e0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if(*pde & PTE_P){
+8010a9e6:	a8 01                	test   $0x1,%al
+8010a9e8:	75 46                	jne    8010aa30 <lazyuvm+0x70>
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc()) == 0)
+8010a9ea:	e8 d1 a0 ff ff       	call   80104ac0 <kalloc>
+8010a9ef:	89 c7                	mov    %eax,%edi
+8010a9f1:	85 c0                	test   %eax,%eax
+8010a9f3:	74 5b                	je     8010aa50 <lazyuvm+0x90>
+    return -1;
+  memset(mem, 0, PGSIZE);
+8010a9f5:	83 ec 04             	sub    $0x4,%esp
+8010a9f8:	68 00 10 00 00       	push   $0x1000
+8010a9fd:	6a 00                	push   $0x0
+8010a9ff:	50                   	push   %eax
+8010aa00:	e8 4b d2 ff ff       	call   80107c50 <memset>
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010aa05:	58                   	pop    %eax
+8010aa06:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010aa0c:	5a                   	pop    %edx
+8010aa0d:	6a 06                	push   $0x6
+8010aa0f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010aa14:	89 f2                	mov    %esi,%edx
+8010aa16:	50                   	push   %eax
+8010aa17:	89 d8                	mov    %ebx,%eax
+8010aa19:	e8 f2 f6 ff ff       	call   8010a110 <mappages>
+8010aa1e:	83 c4 10             	add    $0x10,%esp
+8010aa21:	85 c0                	test   %eax,%eax
+8010aa23:	78 32                	js     8010aa57 <lazyuvm+0x97>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010aa25:	31 c0                	xor    %eax,%eax
+}
+8010aa27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aa2a:	5b                   	pop    %ebx
+8010aa2b:	5e                   	pop    %esi
+8010aa2c:	5f                   	pop    %edi
+8010aa2d:	5d                   	pop    %ebp
+8010aa2e:	c3                   	ret
+8010aa2f:	90                   	nop
+  return &pgtab[PTX(va)];
+8010aa30:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa32:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa37:	c1 ea 0a             	shr    $0xa,%edx
+8010aa3a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010aa40:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+8010aa47:	85 c0                	test   %eax,%eax
+8010aa49:	74 9f                	je     8010a9ea <lazyuvm+0x2a>
+8010aa4b:	f6 00 01             	testb  $0x1,(%eax)
+8010aa4e:	74 9a                	je     8010a9ea <lazyuvm+0x2a>
+    return -1;
+8010aa50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa55:	eb d0                	jmp    8010aa27 <lazyuvm+0x67>
+    kfree(mem);
+8010aa57:	83 ec 0c             	sub    $0xc,%esp
+8010aa5a:	57                   	push   %edi
+8010aa5b:	e8 50 9d ff ff       	call   801047b0 <kfree>
+    return -1;
+8010aa60:	83 c4 10             	add    $0x10,%esp
+8010aa63:	eb eb                	jmp    8010aa50 <lazyuvm+0x90>
+8010aa65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aa6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010aa70 <lenduvm>:
+// copy-on-write in pgdir and return its kernel address with an
+// extra reference for the borrower.  Returns 0 if va is not a
+// present user page.  pgdir must be the current page table.
+char*
+lenduvm(pde_t *pgdir, uint va)
+{
+8010aa70:	55                   	push   %ebp
+8010aa71:	89 e5                	mov    %esp,%ebp
+8010aa73:	53                   	push   %ebx
+  pte_t *pte;
+  char *mem;
+
+  if(va % PGSIZE || va >= KERNBASE)
+    return 0;
+8010aa74:	31 db                	xor    %ebx,%ebx
+{
+8010aa76:	83 ec 04             	sub    $0x4,%esp
+8010aa79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(va % PGSIZE || va >= KERNBASE)
+8010aa7c:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+8010aa82:	75 64                	jne    8010aae8 <lenduvm+0x78>
+8010aa84:	85 d2                	test   %edx,%edx
+8010aa86:	78 60                	js     8010aae8 <lenduvm+0x78>
+  if(*pde & PTE_P){
+8010aa88:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010aa8b:	89 d1                	mov    %edx,%ecx
+8010aa8d:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010aa90:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010aa93:	a8 01                	test   $0x1,%al
+8010aa95:	74 51                	je     8010aae8 <lenduvm+0x78>
+  return &pgtab[PTX(va)];
+8010aa97:	89 d1                	mov    %edx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa99:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa9e:	c1 e9 0a             	shr    $0xa,%ecx
+8010aaa1:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010aaa7:	8d 9c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ebx
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010aaae:	85 db                	test   %ebx,%ebx
+8010aab0:	74 36                	je     8010aae8 <lenduvm+0x78>
+8010aab2:	8b 03                	mov    (%ebx),%eax
+8010aab4:	89 c1                	mov    %eax,%ecx
+8010aab6:	83 e1 05             	and    $0x5,%ecx
+8010aab9:	83 f9 05             	cmp    $0x5,%ecx
+8010aabc:	75 32                	jne    8010aaf0 <lenduvm+0x80>
+    return 0;
+  if(*pte & PTE_W){
+8010aabe:	a8 02                	test   $0x2,%al
+8010aac0:	74 0f                	je     8010aad1 <lenduvm+0x61>
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+8010aac2:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010aac7:	80 cc 02             	or     $0x2,%ah
+8010aaca:	89 03                	mov    %eax,(%ebx)
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010aacc:	0f 01 3a             	invlpg (%edx)
+    invlpg((void*)va);
+  }
+  mem = P2V(PTE_ADDR(*pte));
+8010aacf:	8b 03                	mov    (%ebx),%eax
+8010aad1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  kincref(mem);
+8010aad6:	83 ec 0c             	sub    $0xc,%esp
+  mem = P2V(PTE_ADDR(*pte));
+8010aad9:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+  kincref(mem);
+8010aadf:	53                   	push   %ebx
+8010aae0:	e8 3b a2 ff ff       	call   80104d20 <kincref>
+  return mem;
+8010aae5:	83 c4 10             	add    $0x10,%esp
+}
+8010aae8:	89 d8                	mov    %ebx,%eax
+8010aaea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010aaed:	c9                   	leave
+8010aaee:	c3                   	ret
+8010aaef:	90                   	nop
+    return 0;
+8010aaf0:	31 db                	xor    %ebx,%ebx
+}
+8010aaf2:	89 d8                	mov    %ebx,%eax
+8010aaf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010aaf7:	c9                   	leave
+8010aaf8:	c3                   	ret
+8010aaf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010ab00 <mapuvm>:
+// handing the caller's reference to pgdir.  va must lie in the first
+// sz bytes, in a page the user may write.  Returns 0 on success, -1
+// otherwise.  pgdir must be the current page table.
+int
+mapuvm(pde_t *pgdir, uint va, char *mem, uint sz)
+{
+8010ab00:	55                   	push   %ebp
+8010ab01:	89 e5                	mov    %esp,%ebp
+8010ab03:	57                   	push   %edi
+8010ab04:	56                   	push   %esi
+8010ab05:	53                   	push   %ebx
+8010ab06:	83 ec 0c             	sub    $0xc,%esp
+8010ab09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  pte_t *pte;
+
+  if(va % PGSIZE || va >= sz || va >= KERNBASE)
+8010ab0c:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+8010ab12:	0f 85 c3 00 00 00    	jne    8010abdb <mapuvm+0xdb>
+8010ab18:	3b 5d 14             	cmp    0x14(%ebp),%ebx
+8010ab1b:	0f 83 ba 00 00 00    	jae    8010abdb <mapuvm+0xdb>
+8010ab21:	85 db                	test   %ebx,%ebx
+8010ab23:	0f 88 b2 00 00 00    	js     8010abdb <mapuvm+0xdb>
+  pde = &pgdir[PDX(va)];
+8010ab29:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ab2c:	89 da                	mov    %ebx,%edx
+8010ab2e:	c1 ea 16             	shr    $0x16,%edx
+8010ab31:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+  if(*pde & PTE_P){
+8010ab34:	8b 07                	mov    (%edi),%eax
+8010ab36:	a8 01                	test   $0x1,%al
+8010ab38:	0f 85 82 00 00 00    	jne    8010abc0 <mapuvm+0xc0>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010ab3e:	e8 7d 9f ff ff       	call   80104ac0 <kalloc>
+8010ab43:	89 c6                	mov    %eax,%esi
+8010ab45:	85 c0                	test   %eax,%eax
+8010ab47:	0f 84 8e 00 00 00    	je     8010abdb <mapuvm+0xdb>
+    memset(pgtab, 0, PGSIZE);
+8010ab4d:	83 ec 04             	sub    $0x4,%esp
+8010ab50:	68 00 10 00 00       	push   $0x1000
+8010ab55:	6a 00                	push   $0x0
+8010ab57:	50                   	push   %eax
+8010ab58:	e8 f3 d0 ff ff       	call   80107c50 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010ab5d:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+  return &pgtab[PTX(va)];
+8010ab63:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010ab66:	83 c8 07             	or     $0x7,%eax
+8010ab69:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010ab6b:	89 d8                	mov    %ebx,%eax
+8010ab6d:	c1 e8 0a             	shr    $0xa,%eax
+8010ab70:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ab75:	01 c6                	add    %eax,%esi
+    return -1;
+  if((pte = walkpgdir(pgdir, (char*)va, 1)) == 0)
+    return -1;
+  if(*pte & PTE_P){
+8010ab77:	8b 06                	mov    (%esi),%eax
+8010ab79:	a8 01                	test   $0x1,%al
+8010ab7b:	74 21                	je     8010ab9e <mapuvm+0x9e>
+    if((*pte & PTE_U) == 0 || (*pte & (PTE_W|PTE_COW)) == 0)
+8010ab7d:	a8 04                	test   $0x4,%al
+8010ab7f:	74 5a                	je     8010abdb <mapuvm+0xdb>
+8010ab81:	a9 02 02 00 00       	test   $0x202,%eax
+8010ab86:	74 53                	je     8010abdb <mapuvm+0xdb>
+      return -1;
+    kfree(P2V(PTE_ADDR(*pte)));
+8010ab88:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ab8d:	83 ec 0c             	sub    $0xc,%esp
+8010ab90:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ab95:	50                   	push   %eax
+8010ab96:	e8 15 9c ff ff       	call   801047b0 <kfree>
+8010ab9b:	83 c4 10             	add    $0x10,%esp
+  }
+  *pte = V2P(mem) | PTE_P | PTE_U | PTE_COW;
+8010ab9e:	8b 45 10             	mov    0x10(%ebp),%eax
+8010aba1:	05 00 00 00 80       	add    $0x80000000,%eax
+8010aba6:	0d 05 02 00 00       	or     $0x205,%eax
+8010abab:	89 06                	mov    %eax,(%esi)
+8010abad:	0f 01 3b             	invlpg (%ebx)
+  invlpg((void*)va);
+  return 0;
+}
+8010abb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010abb3:	31 c0                	xor    %eax,%eax
+}
+8010abb5:	5b                   	pop    %ebx
+8010abb6:	5e                   	pop    %esi
+8010abb7:	5f                   	pop    %edi
+8010abb8:	5d                   	pop    %ebp
+8010abb9:	c3                   	ret
+8010abba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010abc0:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010abc2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010abc7:	c1 ea 0a             	shr    $0xa,%edx
+8010abca:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010abd0:	8d b4 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%esi
+  if((pte = walkpgdir(pgdir, (char*)va, 1)) == 0)
+8010abd7:	85 f6                	test   %esi,%esi
+8010abd9:	75 9c                	jne    8010ab77 <mapuvm+0x77>
+}
+8010abdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010abde:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010abe3:	5b                   	pop    %ebx
+8010abe4:	5e                   	pop    %esi
+8010abe5:	5f                   	pop    %edi
+8010abe6:	5d                   	pop    %ebp
+8010abe7:	c3                   	ret
+8010abe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010abef:	90                   	nop
+
+8010abf0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010abf0:	55                   	push   %ebp
+8010abf1:	89 e5                	mov    %esp,%ebp
+8010abf3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010abf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010abf9:	89 d1                	mov    %edx,%ecx
+8010abfb:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010abfe:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0)
+    return 0;
+8010ac01:	31 c0                	xor    %eax,%eax
+  if(*pde & PTE_P){
+8010ac03:	f6 c1 01             	test   $0x1,%cl
+8010ac06:	74 36                	je     8010ac3e <uva2ka+0x4e>
+  return &pgtab[PTX(va)];
+8010ac08:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ac0b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ac11:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010ac17:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010ac1e:	85 c0                	test   %eax,%eax
+8010ac20:	74 1c                	je     8010ac3e <uva2ka+0x4e>
+8010ac22:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010ac24:	89 c2                	mov    %eax,%edx
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010ac26:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010ac2b:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010ac2e:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ac33:	83 fa 05             	cmp    $0x5,%edx
+8010ac36:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ac3b:	0f 45 c2             	cmovne %edx,%eax
+}
+8010ac3e:	5d                   	pop    %ebp
+8010ac3f:	c3                   	ret
+
+8010ac40 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010ac40:	55                   	push   %ebp
+8010ac41:	89 e5                	mov    %esp,%ebp
+8010ac43:	57                   	push   %edi
+8010ac44:	56                   	push   %esi
+8010ac45:	53                   	push   %ebx
+8010ac46:	83 ec 1c             	sub    $0x1c,%esp
+8010ac49:	8b 75 14             	mov    0x14(%ebp),%esi
+8010ac4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010ac4f:	85 f6                	test   %esi,%esi
+8010ac51:	0f 85 8b 00 00 00    	jne    8010ace2 <copyout+0xa2>
+8010ac57:	e9 f4 00 00 00       	jmp    8010ad50 <copyout+0x110>
+8010ac5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010ac60:	89 f9                	mov    %edi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ac62:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ac67:	c1 e9 0a             	shr    $0xa,%ecx
+8010ac6a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010ac70:	8d 84 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%eax
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowuvm(pgdir, va0) < 0)
+8010ac77:	85 c0                	test   %eax,%eax
+8010ac79:	0f 84 80 00 00 00    	je     8010acff <copyout+0xbf>
+8010ac7f:	f7 00 00 02 00 00    	testl  $0x200,(%eax)
+8010ac85:	0f 85 85 00 00 00    	jne    8010ad10 <copyout+0xd0>
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010ac8b:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010ac8d:	89 c2                	mov    %eax,%edx
+8010ac8f:	83 e2 05             	and    $0x5,%edx
+8010ac92:	83 fa 05             	cmp    $0x5,%edx
+8010ac95:	75 68                	jne    8010acff <copyout+0xbf>
+  return (char*)P2V(PTE_ADDR(*pte));
+8010ac97:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ac9c:	89 c2                	mov    %eax,%edx
+8010ac9e:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+      return -1;
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+8010aca4:	81 fa 00 00 00 80    	cmp    $0x80000000,%edx
+8010acaa:	74 53                	je     8010acff <copyout+0xbf>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010acac:	89 fa                	mov    %edi,%edx
+8010acae:	29 da                	sub    %ebx,%edx
+8010acb0:	81 c2 00 10 00 00    	add    $0x1000,%edx
+8010acb6:	39 f2                	cmp    %esi,%edx
+8010acb8:	0f 47 d6             	cmova  %esi,%edx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010acbb:	29 fb                	sub    %edi,%ebx
+8010acbd:	83 ec 04             	sub    $0x4,%esp
+8010acc0:	01 d8                	add    %ebx,%eax
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+8010acc2:	8d 9f 00 10 00 00    	lea    0x1000(%edi),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010acc8:	52                   	push   %edx
+8010acc9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010accc:	ff 75 10             	push   0x10(%ebp)
+8010accf:	50                   	push   %eax
+8010acd0:	e8 0b d0 ff ff       	call   80107ce0 <memmove>
+    buf += n;
+8010acd5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  while(len > 0){
+8010acd8:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010acdb:	01 55 10             	add    %edx,0x10(%ebp)
+  while(len > 0){
+8010acde:	29 d6                	sub    %edx,%esi
+8010ace0:	74 6e                	je     8010ad50 <copyout+0x110>
+  pde = &pgdir[PDX(va)];
+8010ace2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010ace5:	89 d8                	mov    %ebx,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010ace7:	89 df                	mov    %ebx,%edi
+  pde = &pgdir[PDX(va)];
+8010ace9:	c1 e8 16             	shr    $0x16,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010acec:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  pde = &pgdir[PDX(va)];
+8010acf2:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+  if(*pde & PTE_P){
+8010acf5:	8b 02                	mov    (%edx),%eax
+8010acf7:	a8 01                	test   $0x1,%al
+8010acf9:	0f 85 61 ff ff ff    	jne    8010ac60 <copyout+0x20>
+  }
+  return 0;
+}
+8010acff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010ad02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ad07:	5b                   	pop    %ebx
+8010ad08:	5e                   	pop    %esi
+8010ad09:	5f                   	pop    %edi
+8010ad0a:	5d                   	pop    %ebp
+8010ad0b:	c3                   	ret
+8010ad0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pte && (*pte & PTE_COW) && cowuvm(pgdir, va0) < 0)
+8010ad10:	83 ec 08             	sub    $0x8,%esp
+8010ad13:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010ad16:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010ad19:	57                   	push   %edi
+8010ad1a:	ff 75 08             	push   0x8(%ebp)
+8010ad1d:	e8 be fb ff ff       	call   8010a8e0 <cowuvm>
+8010ad22:	83 c4 10             	add    $0x10,%esp
+8010ad25:	85 c0                	test   %eax,%eax
+8010ad27:	78 d6                	js     8010acff <copyout+0xbf>
+  if(*pde & PTE_P){
+8010ad29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ad2c:	8b 02                	mov    (%edx),%eax
+8010ad2e:	a8 01                	test   $0x1,%al
+8010ad30:	74 cd                	je     8010acff <copyout+0xbf>
+  return &pgtab[PTX(va)];
+8010ad32:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ad35:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ad3a:	8d 84 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010ad41:	85 c0                	test   %eax,%eax
+8010ad43:	0f 85 42 ff ff ff    	jne    8010ac8b <copyout+0x4b>
+8010ad49:	eb b4                	jmp    8010acff <copyout+0xbf>
+8010ad4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010ad4f:	90                   	nop
+}
+8010ad50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010ad53:	31 c0                	xor    %eax,%eax
+}
+8010ad55:	5b                   	pop    %ebx
+8010ad56:	5e                   	pop    %esi
+8010ad57:	5f                   	pop    %edi
+8010ad58:	5d                   	pop    %ebp
+8010ad59:	c3                   	ret
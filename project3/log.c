@@ -18,7 +18,24 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the log flusher has committed.
+//
+// Commits are done by the log flusher kernel thread, not by
+// end_op(), so many system calls are grouped into one commit.
+// The flusher commits once no FS system call is active and
+// either the log is full, sync() is waiting, or the oldest
+// update has waited LOGFLUSHTICKS ticks.  An FS system call
+// is therefore only durable after the next commit; callers
+// that need durability call sync().
+//
+// There are two in-memory transactions.  When the flusher
+// commits, it copies the open transaction's blocks into a
+// private snapshot and moves its header to log.clh; from then
+// on new FS system calls fill the next transaction in log.lh
+// while the snapshot is written to the log and installed.
+// A block can be in both transactions; install_snap() then
+// writes the snapshot to disk underneath the newer cached
+// copy, which stays pinned for the next commit.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -36,19 +53,35 @@ struct logheader {
   int block[LOGSIZE];
 };
 
+#define LOGFLUSHTICKS 10  // most ticks an update waits for commit
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int closing;     // copying log.lh to the snapshot, please wait.
+  int committing;  // in commit() of log.clh.
+  int syncwait;    // how many sync() calls are waiting.
+  uint nclose;     // number of transactions closed so far.
+  uint ncommit;    // number of commits done so far.
+  uint since;      // ticks when the transaction got its first block.
+  int flusher;     // sleep channel of the log flusher.
   int dev;
-  struct logheader lh;
+  struct logheader lh;   // open transaction
+  struct logheader clh;  // transaction being committed
 };
 struct log log;
 
+// Contents of log.clh's blocks when it was closed.
+static uchar snap[LOGSIZE][BSIZE];
+// Newer cached contents of the block install_snap() is writing.
+static uchar newer[BSIZE];
+
 static void recover_from_log(void);
+static void snapshot(void);
 static void commit();
+static void logflusher(void);
 
 void
 initlog(int dev)
@@ -63,6 +96,8 @@ initlog(int dev)
   log.size = sb.nlog;
   log.dev = dev;
   recover_from_log();
+  if(kthread("logflush", logflusher) < 0)
+    panic("initlog: no log flusher");
 }
 
 // Copy committed blocks from log to their home location
@@ -71,9 +106,9 @@ install_trans(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
+  for (tail = 0; tail < log.clh.n; tail++) {
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
     bwrite(dbuf);  // write dst to disk
     brelse(lbuf);
@@ -88,9 +123,9 @@ read_head(void)
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  log.clh.n = lh->n;
+  for (i = 0; i < log.clh.n; i++) {
+    log.clh.block[i] = lh->block[i];
   }
   brelse(buf);
 }
@@ -104,9 +139,9 @@ write_head(void)
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = log.clh.n;
+  for (i = 0; i < log.clh.n; i++) {
+    hb->block[i] = log.clh.block[i];
   }
   bwrite(buf);
   brelse(buf);
@@ -117,21 +152,31 @@ recover_from_log(void)
 {
   read_head();
   install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
+  log.clh.n = 0;
   write_head(); // clear the log
 }
 
+// Is the log too full for one more FS system call?
+// Caller must hold log.lock.
+static int
+logfull(void)
+{
+  return log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE;
+}
+
 // called at the start of each FS system call.
 void
 begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(logfull()){
       // this op might exhaust log space; wait for commit.
-      // sync();
+      sleep(&log, &log.lock);
+    } else if(log.syncwait && log.lh.n > 0){
+      // let sync() commit before the transaction grows.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
@@ -142,87 +187,182 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// wakes the log flusher if this was the last outstanding
+// operation and the transaction should commit now.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
-  }
+  if(log.closing)
+    panic("log.closing");
+  if(log.outstanding == 0 && log.lh.n > 0 && (logfull() || log.syncwait))
+    wakeup(&log.flusher);
 
+  // begin_op() may be waiting for log space,
+  // and decrementing log.outstanding has decreased
+  // the amount of reserved space.
+  wakeup(&log);
   release(&log.lock);
+}
+
+// Called by the timer interrupt on every tick.
+// Wakes the log flusher once the transaction is old enough.
+// Reads the log without log.lock; a missed wakeup only
+// delays the commit until the next tick.
+void
+logtick(void)
+{
+  if(log.lh.n > 0 && log.outstanding == 0 && !log.committing &&
+     ticks - log.since >= LOGFLUSHTICKS)
+    wakeup(&log.flusher);
+}
+
+// Kernel thread that commits the log; see the comment at the top.
+static void
+logflusher(void)
+{
+  acquire(&log.lock);
+  for(;;){
+    if(log.lh.n == 0 || log.outstanding > 0 ||
+       (!logfull() && !log.syncwait && ticks - log.since < LOGFLUSHTICKS)){
+      sleep(&log.flusher, &log.lock);
+      continue;
+    }
+    // Close the transaction.  No FS system call is active,
+    // so the cached blocks hold exactly its updates.
+    log.closing = 1;
+    release(&log.lock);
+    snapshot();
+    acquire(&log.lock);
+    log.clh = log.lh;
+    log.lh.n = 0;
+    log.nclose++;
+    log.closing = 0;
+    log.committing = 1;
+    wakeup(&log);
+    release(&log.lock);
 
-  if(do_commit){
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
+
     acquire(&log.lock);
     log.committing = 0;
+    log.ncommit++;
+    wakeup(&log.ncommit);
     wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Commits all dirty bits in buffer
+// Wait until every FS system call that has already finished
+// is on disk.  Returns the number of blocks that were waiting
+// to be committed, or -1 if there was nothing to commit.
 int
 sync(void)
 {
-  int blocksz = log.lh.n;
+  int blocksz;
+  uint target;
 
-  if (blocksz == 0) {
+  acquire(&log.lock);
+  blocksz = log.lh.n;
+  if(blocksz == 0 && !log.committing){
+    release(&log.lock);
     return -1;
   }
 
-  log.committing = 1;
-
-  // call commit w/o holding locks, since not allowed
-  // to sleep with locks.
-  commit();
-  acquire(&log.lock);
-  log.committing = 0;
-  log.outstanding = 0;
-  // wakeup(&log);
+  // Wait for every closed transaction to commit, and for
+  // the open one if it holds blocks.  A closing transaction
+  // is still in log.lh and not counted in log.nclose yet.
+  target = log.nclose + (blocksz > 0 ? 1 : 0);
+  log.syncwait++;
+  wakeup(&log.flusher);
+  while((int)(target - log.ncommit) > 0)
+    sleep(&log.ncommit, &log.lock);
+  log.syncwait--;
+  wakeup(&log);
   release(&log.lock);
 
   return blocksz;
 }
 
-// Copy modified blocks from cache to log.
+// Copy the open transaction's blocks from cache to the snapshot.
+// Called with log.closing set, so no FS system call is active.
 static void
-write_log(void)
+snapshot(void)
 {
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    memmove(snap[tail], from->data, BSIZE);
     brelse(from);
+  }
+}
+
+// Copy the snapshot to the log.
+static void
+write_log(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+    memmove(to->data, snap[tail], BSIZE);
+    bwrite(to);  // write the log
     brelse(to);
   }
 }
 
+// Is block b part of the open transaction?
+// Caller must hold log.lock.
+static int
+inopen(uint b)
+{
+  int i;
+
+  for (i = 0; i < log.lh.n; i++)
+    if (log.lh.block[i] == b)
+      return 1;
+  return 0;
+}
+
+// Write the snapshot to the committed blocks' home locations.
+// A block that the open transaction has changed since is
+// written from the snapshot and then gets its newer contents
+// back, pinned again with B_DIRTY.  Holding the buffer lock
+// keeps FS system calls from changing it in between.
+static void
+install_snap(void)
+{
+  int tail, open;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+    struct buf *dbuf = bread(log.dev, log.clh.block[tail]); // cache block
+    acquire(&log.lock);
+    open = inopen(dbuf->blockno);
+    release(&log.lock);
+    if (open) {
+      memmove(newer, dbuf->data, BSIZE);
+      memmove(dbuf->data, snap[tail], BSIZE);
+    }
+    bwrite(dbuf);  // write dst to disk
+    if (open) {
+      memmove(dbuf->data, newer, BSIZE);
+      dbuf->flags |= B_DIRTY;
+    }
+    brelse(dbuf);
+  }
+}
+
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
+  if (log.clh.n > 0) {
+    write_log();     // Write snapshot to log
     write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
+    install_snap();  // Now install writes to home locations
+    log.clh.n = 0;
     write_head();    // Erase the transaction from the log
   }
 }
@@ -252,6 +392,8 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
+  if (log.lh.n == 0)
+    log.since = ticks;
   if (i == log.lh.n)
     log.lh.n++;
   b->flags |= B_DIRTY; // prevent eviction
@@ -38,8 +38,9 @@ void wsect(uint, void*);
 void winode(uint, struct dinode*);
 void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
-uint ialloc(ushort type);
+uint ialloc(ushort type, uchar flags);
 void iappend(uint inum, void *p, int n);
+void dirlink(uint dir, char *name, uint inum);
 
 // convert to intel byte order
 ushort
@@ -67,9 +68,8 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
+  int i, cc, fd, extent;
   uint rootino, inum, off;
-  struct dirent de;
   char buf[BSIZE];
   struct dinode din;
 
@@ -77,7 +77,8 @@ main(int argc, char *argv[])
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs fs.img [-e] files...\n");
+    fprintf(stderr, "  -e: map the files after it by extents\n");
     exit(1);
   }
 
@@ -101,6 +102,7 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.bsize = xint(BSIZE);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
@@ -114,20 +116,18 @@ main(int argc, char *argv[])
   memmove(buf, &sb, sizeof(sb));
   wsect(1, buf);
 
-  rootino = ialloc(T_DIR);
+  rootino = ialloc(T_DIR, 0);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  dirlink(rootino, ".", rootino);
+  dirlink(rootino, "..", rootino);
 
+  extent = 0;
   for(i = 2; i < argc; i++){
+    if(strcmp(argv[i], "-e") == 0){
+      extent = 1;
+      continue;
+    }
     assert(index(argv[i], '/') == 0);
 
     if((fd = open(argv[i], 0)) < 0){
@@ -142,12 +142,9 @@ main(int argc, char *argv[])
     if(argv[i][0] == '_')
       ++argv[i];
 
-    inum = ialloc(T_FILE);
+    inum = ialloc(T_FILE, extent ? I_EXTENT : 0);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    dirlink(rootino, argv[i], inum);
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -157,10 +154,12 @@ main(int argc, char *argv[])
 
   // fix size of root inode dir
   rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  if((din.flags & I_DIRHASH) == 0){
+    off = xint(din.size);
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(rootino, &din);
+  }
 
   balloc(freeblock);
 
@@ -221,13 +220,14 @@ rsect(uint sec, void *buf)
 }
 
 uint
-ialloc(ushort type)
+ialloc(ushort type, uchar flags)
 {
   uint inum = freeinode++;
   struct dinode din;
 
   bzero(&din, sizeof(din));
-  din.type = xshort(type);
+  din.type = type;
+  din.flags = flags;
   din.nlink = xshort(1);
   din.size = xint(0);
   winode(inum, &din);
@@ -252,38 +252,126 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Map block fbn of an extent-mapped inode, allocating it if it
+// is the block after the end of the file.  mkfs allocates blocks
+// in order, so a file only gets a new extent when another file's
+// blocks were allocated in between.
+uint
+emap(struct dinode *din, uint fbn)
+{
+  struct extent *e = (struct extent*)din->addrs;
+  uint prev;
+  int i;
+
+  prev = 0;
+  for(i = 0; i < NIEXTENT && xint(e[i].end) != 0; i++){
+    if(fbn < xint(e[i].end))
+      return xint(e[i].pend) - (xint(e[i].end) - fbn);
+    prev = xint(e[i].end);
+  }
+  assert(fbn == prev);
+  if(i > 0 && xint(e[i-1].pend) == freeblock){
+    e[i-1].end = xint(fbn + 1);
+    e[i-1].pend = xint(++freeblock);
+    return freeblock - 1;
+  }
+  assert(i < NIEXTENT);
+  e[i].end = xint(fbn + 1);
+  e[i].pend = xint(++freeblock);
+  return freeblock - 1;
+}
+
+// Return entry i of indirect block ib, allocating a block for
+// it if alloc is set; 0 if it is not allocated.
+uint
+ientry(uint ib, uint i, int alloc)
+{
+  uint indirect[NINDIRECT];
+
+  rsect(ib, (char*)indirect);
+  if(indirect[i] == 0 && alloc){
+    indirect[i] = xint(freeblock++);
+    wsect(ib, (char*)indirect);
+  }
+  return xint(indirect[i]);
+}
+
+// Return the disk block of block fbn of the inode, allocating
+// it if alloc is set; 0 if it is not allocated.
+uint
+bmap(struct dinode *din, uint fbn, int alloc)
+{
+  uint x;
+
+  assert(fbn < MAXFILE);
+  if(din->flags & I_EXTENT)
+    return emap(din, fbn);
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0 && alloc){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  if(fbn < NINDIRECT){
+    if(xint(din->addrs[NDIRECT]) == 0){
+      if(!alloc)
+        return 0;
+      din->addrs[NDIRECT] = xint(freeblock++);
+    }
+    return ientry(xint(din->addrs[NDIRECT]), fbn, alloc);
+  }
+  fbn -= NINDIRECT;
+
+  // Double indirect blocks
+  assert(fbn < DINDIRECT);
+  if(xint(din->addrs[NDIRECT+1]) == 0){
+    if(!alloc)
+      return 0;
+    din->addrs[NDIRECT+1] = xint(freeblock++);
+  }
+  if((x = ientry(xint(din->addrs[NDIRECT+1]), fbn / NINDIRECT, alloc)) == 0)
+    return 0;
+  return ientry(x, fbn % NINDIRECT, alloc);
+}
+
 void
-iappend(uint inum, void *xp, int n)
+iread(uint inum, uint off, void *xp, int n)
 {
   char *p = (char*)xp;
-  uint fbn, off, n1;
+  uint fbn, n1, x;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
-  uint x;
 
   rinode(inum, &din);
-  off = xint(din.size);
-  // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
     fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    n1 = min(n, (fbn + 1) * BSIZE - off);
+    if((x = bmap(&din, fbn, 0)) == 0)
+      bzero(buf, BSIZE);
+    else
+      rsect(x, buf);
+    bcopy(buf + off - (fbn * BSIZE), p, n1);
+    n -= n1;
+    off += n1;
+    p += n1;
+  }
+}
+
+void
+iwrite(uint inum, uint off, void *xp, int n)
+{
+  char *p = (char*)xp;
+  uint fbn, n1, x;
+  struct dinode din;
+  char buf[BSIZE];
+
+  rinode(inum, &din);
+  // printf("write inum %d at off %d sz %d\n", inum, off, n);
+  while(n > 0){
+    fbn = off / BSIZE;
+    x = bmap(&din, fbn, 1);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -292,6 +380,65 @@ iappend(uint inum, void *xp, int n)
     off += n1;
     p += n1;
   }
-  din.size = xint(off);
+  if(off > xint(din.size))
+    din.size = xint(off);
   winode(inum, &din);
 }
+
+void
+iappend(uint inum, void *xp, int n)
+{
+  struct dinode din;
+
+  rinode(inum, &din);
+  iwrite(inum, xint(din.size), xp, n);
+}
+
+// Same hash as the kernel's dirhash().
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+// Add (name, inum) to directory dir, hashing it the way the
+// kernel's dirlink() does once dir fills DIRHASH_START blocks.
+void
+dirlink(uint dir, char *name, uint inum)
+{
+  struct dinode din;
+  struct dirent de, old;
+  uint s, off;
+  int i;
+
+  bzero(&de, sizeof(de));
+  de.inum = xshort(inum);
+  strncpy(de.name, name, DIRSIZ);
+
+  rinode(dir, &din);
+  if((din.flags & I_DIRHASH) == 0){
+    if(xint(din.size) < DIRHASH_START*BSIZE){
+      iappend(dir, &de, sizeof(de));
+      return;
+    }
+    din.flags |= I_DIRHASH;
+    din.size = xint(DIRHASH_END*BSIZE);
+    winode(dir, &din);
+  }
+  s = dirhash(name) % DIRHASH_NSLOT;
+  for(i = 0; i < DPB; i++, s = (s + 1) % DIRHASH_NSLOT){
+    off = DIRHASH_START*BSIZE + s*sizeof(de);
+    iread(dir, off, &old, sizeof(old));
+    if(old.inum == 0){
+      iwrite(dir, off, &de, sizeof(de));
+      return;
+    }
+  }
+  iappend(dir, &de, sizeof(de));
+}
@@ -7,18 +7,51 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "slab.h"
 
+// A pipe starts out with a PIPESIZE-byte ring inside struct pipe.
+// pipesize() can switch it to a ring of up to PIPEPAGES pages,
+// which are allocated as the writer reaches them and freed as the
+// reader leaves them.  The writer stops short of the page the
+// reader is in, so that a ring page never holds bytes of two laps
+// and the reader can free it once past its end.  Both capacities
+// are powers of two so that the nread and nwrite counters can wrap.
+//
+// In page mode a write of a whole page-aligned user page to a
+// page boundary of the ring lends the writer's page to the pipe
+// copy-on-write instead of copying it, and a read of a whole ring
+// page into a page-aligned user page maps it there the same way.
 #define PIPESIZE 512
+#define PIPEPAGES 16
 
 struct pipe {
   struct spinlock lock;
   char data[PIPESIZE];
+  char *page[PIPEPAGES];  // ring pages, when cap > PIPESIZE
+  uint cap;       // capacity in bytes
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
 };
 
+static struct slabcache pipecache;
+
+static void
+pipector(void *v)
+{
+  struct pipe *p = v;
+
+  initlock(&p->lock, "pipe");
+  memset(p->page, 0, sizeof(p->page));  // pipefree() keeps it so
+}
+
+void
+pipeinit(void)
+{
+  slabinit(&pipecache, "pipe", sizeof(struct pipe), pipector);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -28,13 +61,13 @@ pipealloc(struct file **f0, struct file **f1)
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = slaballoc(&pipecache)) == 0)
     goto bad;
   p->readopen = 1;
   p->writeopen = 1;
+  p->cap = PIPESIZE;
   p->nwrite = 0;
   p->nread = 0;
-  initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
@@ -48,7 +81,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    slabfree(&pipecache, p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -56,6 +89,76 @@ pipealloc(struct file **f0, struct file **f1)
   return -1;
 }
 
+// Free the ring pages of p.  Caller must hold p->lock.
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++){
+    if(p->page[i]){
+      kfree(p->page[i]);
+      p->page[i] = 0;
+    }
+  }
+}
+
+// Set the capacity of p to n bytes, rounded up to a power of two
+// between PIPESIZE and PIPEPAGES pages, and at least a page if
+// more than PIPESIZE.  Only an empty pipe can
+// be resized.  Returns the new capacity, or -1.
+int
+pipesize(struct pipe *p, int n)
+{
+  uint cap;
+
+  if(n < 0 || n > PIPEPAGES*PGSIZE)
+    return -1;
+  cap = PIPESIZE;
+  if(n > PIPESIZE)
+    for(cap = PGSIZE; cap < n; cap *= 2)
+      ;
+  acquire(&p->lock);
+  if(p->nread != p->nwrite){
+    release(&p->lock);
+    return -1;
+  }
+  pipefree(p);
+  p->cap = cap;
+  p->nread = p->nwrite = 0;
+  release(&p->lock);
+  return cap;
+}
+
+// Return where byte off of p's ring lives, or 0 if its page has not
+// been allocated, and set *n to the number of bytes from there to the
+// end of the page or ring.  Caller must hold p->lock.
+static char*
+pipebuf(struct pipe *p, uint off, uint *n)
+{
+  char *pg;
+
+  off %= p->cap;
+  if(p->cap == PIPESIZE){
+    *n = PIPESIZE - off;
+    return p->data + off;
+  }
+  *n = PGSIZE - off%PGSIZE;
+  if((pg = p->page[off/PGSIZE]) == 0)
+    return 0;
+  return pg + off%PGSIZE;
+}
+
+// Return how many bytes the writer may add to p.
+// Caller must hold p->lock.
+static uint
+piperoom(struct pipe *p)
+{
+  if(p->cap == PIPESIZE)
+    return p->cap - (p->nwrite - p->nread);
+  return p->nread - p->nread%PGSIZE + p->cap - p->nwrite;
+}
+
 void
 pipeclose(struct pipe *p, int writable)
 {
@@ -68,8 +171,9 @@ pipeclose(struct pipe *p, int writable)
     wakeup(&p->nwrite);
   }
   if(p->readopen == 0 && p->writeopen == 0){
+    pipefree(p);
     release(&p->lock);
-    kfree((char*)p);
+    slabfree(&pipecache, p);
   } else
     release(&p->lock);
 }
@@ -79,10 +183,12 @@ int
 pipewrite(struct pipe *p, char *addr, int n)
 {
   int i;
+  uint m, room, off;
+  char *buf;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; ){
+    while(piperoom(p) == 0){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -90,7 +196,30 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    room = piperoom(p);
+    off = p->nwrite % p->cap;
+    if(p->cap > PIPESIZE && p->page[off/PGSIZE] == 0){
+      // Lend a whole user page if possible, else get a fresh one.
+      if(off%PGSIZE == 0 && room >= PGSIZE && n - i >= PGSIZE &&
+         (p->page[off/PGSIZE] = lenduvm(myproc()->pgdir, (uint)(addr+i))) != 0){
+        p->nwrite += PGSIZE;
+        i += PGSIZE;
+        continue;
+      }
+      if((p->page[off/PGSIZE] = kalloc()) == 0){
+        release(&p->lock);
+        return i > 0 ? i : -1;
+      }
+    }
+    if((buf = pipebuf(p, p->nwrite, &m)) == 0)
+      panic("pipewrite");
+    if(m > room)
+      m = room;
+    if(m > n - i)
+      m = n - i;
+    memmove(buf, addr + i, m);
+    p->nwrite += m;
+    i += m;
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
@@ -101,6 +230,8 @@ int
 piperead(struct pipe *p, char *addr, int n)
 {
   int i;
+  uint m, off;
+  char *buf;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -110,10 +241,32 @@ piperead(struct pipe *p, char *addr, int n)
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  for(i = 0; i < n && p->nread != p->nwrite; ){  //DOC: piperead-copy
+    off = p->nread % p->cap;
+    if(p->cap > PIPESIZE && off%PGSIZE == 0 &&
+       p->nwrite - p->nread >= PGSIZE && n - i >= PGSIZE &&
+       mapuvm(myproc()->pgdir, (uint)(addr+i), p->page[off/PGSIZE],
+              myproc()->sz) == 0){
+      // The reader's page table took over the ring page.
+      p->page[off/PGSIZE] = 0;
+      p->nread += PGSIZE;
+      i += PGSIZE;
+      continue;
+    }
+    if((buf = pipebuf(p, p->nread, &m)) == 0)
+      panic("piperead");
+    if(m > p->nwrite - p->nread)
+      m = p->nwrite - p->nread;
+    if(m > n - i)
+      m = n - i;
+    memmove(addr + i, buf, m);
+    p->nread += m;
+    i += m;
+    // Done with this ring page.
+    if(p->cap > PIPESIZE && p->nread % PGSIZE == 0){
+      kfree(p->page[off/PGSIZE]);
+      p->page[off/PGSIZE] = 0;
+    }
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
@@ -6,10 +6,18 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "slab.h"
+
+#define NSLEEPQ 61
+#define SLEEPQ(chan) (((uint)(chan) >> 2) % NSLEEPQ)
 
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct slabcache cache;        // Where procs come from
+  struct proc *proc;             // Allocated procs, through next/prev
+  struct proc *sleepq[NSLEEPQ];  // SLEEPING procs hashed by chan
+  uint nwakeup;                  // Calls to wakeup1()
+  uint nscan;                    // Sleepers they looked at
 } ptable;
 
 static struct proc *initproc;
@@ -24,6 +32,7 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  slabinit(&ptable.cache, "proc", sizeof(struct proc), 0);
 }
 
 // Must be called with interrupts disabled
@@ -65,9 +74,24 @@ myproc(void) {
   return p;
 }
 
+// Take p off the process list and give it back to the
+// proc cache.  Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    ptable.proc = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  p->state = UNUSED;
+  slabfree(&ptable.cache, p);
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Allocate a proc and put it on the process list.
+// If that works, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -78,14 +102,15 @@ allocproc(void)
 
   acquire(&ptable.lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if((p = slaballoc(&ptable.cache)) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
+  p->next = ptable.proc;
+  if(ptable.proc)
+    ptable.proc->prev = p;
+  ptable.proc = p;
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
 
@@ -93,7 +118,9 @@ found:
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -115,6 +142,60 @@ found:
   return p;
 }
 
+// A kernel thread's first scheduling by scheduler()
+// will swtch here, with fn left on the stack as the argument.
+static void
+kthreadstart(void (*fn)(void))
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  fn();
+  panic("kthread returned");
+}
+
+// Start a process that runs fn in the kernel and never
+// enters user space.  fn must not return.
+// Returns the new pid, or -1 on failure.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+  char *sp;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
+    return -1;
+  }
+  p->sz = 0;
+  p->parent = 0;
+  p->tf = 0;
+
+  // Replace allocproc's forkret/trapret frame with a
+  // call of kthreadstart(fn) that has no return address.
+  sp = p->kstack + KSTACKSIZE;
+  sp -= 4;
+  *(uint*)sp = (uint)fn;
+  sp -= 4;
+  *(uint*)sp = 0;
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+  p->context->eip = (uint)kthreadstart;
+
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return p->pid;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -154,6 +235,8 @@ userinit(void)
 }
 
 // Grow current process's memory by n bytes.
+// Growing only reserves the address range; lazyuvm()
+// allocates each page on its first touch.
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
@@ -163,8 +246,9 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n < sz || sz + n >= KERNBASE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -192,8 +276,9 @@ fork(void)
   // Copy process state from proc.
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
     kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz;
@@ -253,7 +338,7 @@ exit(void)
   wakeup1(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p; p = p->next){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
@@ -280,7 +365,7 @@ wait(void)
   for(;;){
     // Scan through table looking for exited children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.proc; p; p = p->next){
       if(p->parent != curproc)
         continue;
       havekids = 1;
@@ -288,13 +373,8 @@ wait(void)
         // Found one.
         pid = p->pid;
         kfree(p->kstack);
-        p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -332,7 +412,7 @@ scheduler(void)
 
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.proc; p; p = p->next){
       if(p->state != RUNNABLE)
         continue;
 
@@ -438,6 +518,8 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  p->snext = ptable.sleepq[SLEEPQ(chan)];
+  ptable.sleepq[SLEEPQ(chan)] = p;
 
   sched();
 
@@ -453,15 +535,39 @@ sleep(void *chan, struct spinlock *lk)
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
+// Only looks at the sleepers that hash with chan.
 // The ptable lock must be held.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
+  struct proc **pp, *p;
+
+  ptable.nwakeup++;
+  pp = &ptable.sleepq[SLEEPQ(chan)];
+  while((p = *pp) != 0){
+    ptable.nscan++;
+    if(p->chan == chan){
+      *pp = p->snext;
       p->state = RUNNABLE;
+    } else
+      pp = &p->snext;
+  }
+}
+
+// Take sleeping p off its sleep queue.
+// The ptable lock must be held.
+static void
+unsleep(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.sleepq[SLEEPQ(p->chan)]; *pp; pp = &(*pp)->snext){
+    if(*pp == p){
+      *pp = p->snext;
+      return;
+    }
+  }
+  panic("unsleep");
 }
 
 // Wake up all processes sleeping on chan.
@@ -482,12 +588,14 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.proc; p; p = p->next){
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
+      if(p->state == SLEEPING){
+        unsleep(p);
         p->state = RUNNABLE;
+      }
       release(&ptable.lock);
       return 0;
     }
@@ -511,14 +619,14 @@ procdump(void)
   [RUNNING]   "run   ",
   [ZOMBIE]    "zombie"
   };
-  int i;
+  int i, n;
   struct proc *p;
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED)
-      continue;
+  n = 0;
+  for(p = ptable.proc; p; p = p->next){
+    n++;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
@@ -531,4 +639,6 @@ procdump(void)
     }
     cprintf("\n");
   }
+  cprintf("wakeup: %d calls, %d sleepers scanned (%d by ptable scan)\n",
+          ptable.nwakeup, ptable.nscan, ptable.nwakeup * n);
 }
@@ -0,0 +1,58 @@
+// Sequential read throughput at several read-ahead windows.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define FILESIZE (2*1024*1024)
+
+char buf[8192];
+int windows[] = { 0, 8, 32 };
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, n, w, old, t0;
+  struct iostat st0, st1;
+
+  fd = open("readbench.tmp", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(2, "readbench: cannot create file\n");
+    exit();
+  }
+  memset(buf, 'r', sizeof(buf));
+  for(i = 0; i < FILESIZE; i += sizeof(buf)){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "readbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  old = readahead(-1);
+  for(w = 0; w < sizeof(windows)/sizeof(windows[0]); w++){
+    if(readahead(windows[w]) < 0){
+      printf(2, "readbench: readahead failed\n");
+      exit();
+    }
+    fd = open("readbench.tmp", O_RDONLY);
+    iostat(&st0);
+    t0 = uptime();
+    for(i = 0; (n = read(fd, buf, sizeof(buf))) > 0; i += n)
+      ;
+    iostat(&st1);
+    close(fd);
+    if(i != FILESIZE){
+      printf(2, "readbench: short read %d\n", i);
+      exit();
+    }
+    printf(1, "readahead %d: %d ticks, %d commands, %d merged\n",
+           windows[w], uptime() - t0, st1.ncmd - st0.ncmd,
+           st1.nmerged - st0.nmerged);
+  }
+  readahead(old);
+  unlink("readbench.tmp");
+  exit();
+}
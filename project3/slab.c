@@ -0,0 +1,203 @@
+// Slab allocator for kernel objects.
+//
+// A slab cache hands out objects of one size, carved out of
+// pages from kalloc().  Each page starts with a struct slab
+// followed by as many objects as fit, and an object finds its
+// slab by rounding its address down to the page.  Slabs with a
+// free object sit on the cache's partial list, so allocation
+// never searches.  When the last object of a slab is freed its
+// page goes back to kalloc(), except for one spare per cache so
+// that a table hovering around a page boundary does not thrash.
+//
+// Each CPU keeps a magazine of free objects per cache and only
+// takes c->lock to move NMAG/2 of them to or from the slabs,
+// the way kalloc.c batches pages.
+//
+// A cache with a constructor runs it once per object, when the
+// object's page is carved, and hands objects out in whatever
+// state they were freed in; callers must free them in their
+// constructed state (locks initialized and not held).  Objects
+// from a cache without one come back zeroed.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+// Free objects are chained through a word just past their end,
+// so that sitting on a free list does not disturb the state the
+// constructor left behind.
+struct object {
+  struct object *next;
+};
+
+#define LINK(c, v)  ((struct object*)((char*)(v) + (c)->size))
+#define OBJ(c, o)   ((void*)((char*)(o) - (c)->size))
+
+struct slab {
+  struct slabcache *cache; // Cache this page belongs to
+  struct slab *next;       // Partial list
+  struct slab *prev;
+  struct object *free;     // Free objects in this page
+  uint nfree;
+};
+
+void
+slabinit(struct slabcache *c, char *name, uint size, void (*ctor)(void*))
+{
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = (size + 3) & ~3;
+  c->perslab = (PGSIZE - sizeof(struct slab)) /
+               (c->size + sizeof(struct object));
+  if(c->perslab == 0)
+    panic("slabinit: object too big");
+  c->ctor = ctor;
+  c->partial = 0;
+  c->nslab = 0;
+  c->nempty = 0;
+}
+
+// Put s at the front of c's partial list.
+static void
+slablink(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Take s off c's partial list.
+static void
+slabunlink(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+// Carve a fresh page into objects for c.
+// Caller must hold c->lock.
+static struct slab*
+slabgrow(struct slabcache *c)
+{
+  struct slab *s;
+  struct object *o;
+  char *p;
+  uint i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->free = 0;
+  p = (char*)(s + 1);
+  for(i = 0; i < c->perslab; i++, p += c->size + sizeof(struct object)){
+    if(c->ctor)
+      c->ctor(p);
+    o = LINK(c, p);
+    o->next = s->free;
+    s->free = o;
+  }
+  s->nfree = c->perslab;
+  slablink(c, s);
+  c->nslab++;
+  c->nempty++;
+  return s;
+}
+
+// Take one free object out of c's slabs.
+// Caller must hold c->lock.
+static void*
+slabget(struct slabcache *c)
+{
+  struct slab *s;
+  struct object *o;
+
+  if((s = c->partial) == 0 && (s = slabgrow(c)) == 0)
+    return 0;
+  if(s->nfree == c->perslab)
+    c->nempty--;
+  o = s->free;
+  s->free = o->next;
+  if(--s->nfree == 0)
+    slabunlink(c, s);
+  return OBJ(c, o);
+}
+
+// Give object v back to its slab.
+// Caller must hold c->lock.
+static void
+slabput(struct slabcache *c, void *v)
+{
+  struct slab *s;
+  struct object *o;
+
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  o = LINK(c, v);
+  o->next = s->free;
+  s->free = o;
+  if(s->nfree++ == 0)
+    slablink(c, s);
+  if(s->nfree == c->perslab){
+    if(c->nempty > 0){
+      slabunlink(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    } else
+      c->nempty++;
+  }
+}
+
+// Allocate an object from c.
+// Returns 0 if there is no memory left.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct magazine *m;
+  void *v;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == 0){
+    acquire(&c->lock);
+    while(m->n < NMAG/2 && (v = slabget(c)) != 0)
+      m->obj[m->n++] = v;
+    release(&c->lock);
+  }
+  v = 0;
+  if(m->n > 0)
+    v = m->obj[--m->n];
+  popcli();
+
+  if(v && c->ctor == 0)
+    memset(v, 0, c->size);
+  return v;
+}
+
+// Return object v to c.
+void
+slabfree(struct slabcache *c, void *v)
+{
+  struct magazine *m;
+
+  if(((struct slab*)PGROUNDDOWN((uint)v))->cache != c)
+    panic("slabfree");
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == NMAG){
+    acquire(&c->lock);
+    while(m->n > NMAG/2)
+      slabput(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = v;
+  popcli();
+}
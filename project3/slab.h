@@ -0,0 +1,22 @@
+// A cache of fixed-size kernel objects, carved out of
+// whole pages from kalloc().  See slab.c.
+
+#define NMAG 16  // objects a CPU keeps on hand per cache
+
+// Free objects held by one CPU, used without c->lock.
+struct magazine {
+  int n;
+  void *obj[NMAG];
+};
+
+struct slabcache {
+  struct spinlock lock;
+  char *name;          // Name of cache, for debugging
+  uint size;           // Size of each object
+  uint perslab;        // Objects that fit in one page
+  void (*ctor)(void*); // Sets up each object when its page is carved
+  struct slab *partial; // Slabs with at least one free object
+  uint nslab;          // Pages held by the cache
+  uint nempty;         // Of which have no object in use
+  struct magazine mag[NCPU];
+};
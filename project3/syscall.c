@@ -21,6 +21,9 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(touchuvm(curproc->pgdir, addr, curproc->sz, 0) < 0 ||
+     touchuvm(curproc->pgdir, addr+3, curproc->sz, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -39,6 +42,9 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       touchuvm(curproc->pgdir, (uint)s, curproc->sz, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -59,12 +65,18 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
+  uint a;
   struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  // Fault the buffer in now, where running out of memory
+  // can fail the call; the kernel may write to it.
+  for(a = PGROUNDDOWN(i); a < (uint)i+size; a += PGSIZE)
+    if(touchuvm(curproc->pgdir, a, curproc->sz, 1) < 0)
+      return -1;
   *pp = (char*)i;
   return 0;
 }
@@ -105,6 +117,10 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_symlink(void);
 extern int sys_sync(void);
+extern int sys_iostat(void);
+extern int sys_pipesize(void);
+extern int sys_readahead(void);
+extern int sys_dcstat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +146,10 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_symlink] sys_symlink,
 [SYS_sync]    sys_sync,
+[SYS_iostat]  sys_iostat,
+[SYS_pipesize] sys_pipesize,
+[SYS_readahead] sys_readahead,
+[SYS_dcstat]  sys_dcstat,
 };
 
 void
@@ -22,3 +22,7 @@
 #define SYS_close  21
 #define SYS_symlink 22
 #define SYS_sync   23
+#define SYS_iostat 24
+#define SYS_pipesize 25
+#define SYS_readahead 26
+#define SYS_dcstat 27
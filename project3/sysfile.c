@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "iostat.h"
+#include "dcstat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -215,9 +217,13 @@ sys_unlink(void)
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
+  // Keep the name: hashed directories tell deleted
+  // dirents from never-used ones by it.
+  de.inum = 0;
+  strncpy(de.name, name, DIRSIZ);
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcacheput(dp, name, 0);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -253,8 +259,6 @@ create(char *path, short type, short major, short minor)
     ilock(ip);
     if(type == T_FILE && ip->type == T_FILE)
       return ip;
-    if (type == T_SYMLINK)
-      return ip;
     iunlockput(ip);
     return 0;
   }
@@ -304,8 +308,17 @@ sys_open(void)
       end_op();
       return -1;
     }
+    if((omode & O_EXTENT) && ip->type == T_FILE && ip->size == 0 &&
+       !(ip->flags & I_EXTENT)){
+      ip->flags |= I_EXTENT;
+      iupdate(ip);
+    }
   } else {
-    if((ip = namei(path)) == 0){
+    if(omode & O_LOOKUP)
+      ip = nameilink(path);
+    else
+      ip = namei(path);
+    if(ip == 0){
       end_op();
       return -1;
     }
@@ -315,18 +328,12 @@ sys_open(void)
       end_op();
       return -1;
     }
-  }
-
-  // for symbolic link file
-  if (ip->type == T_SYMLINK && !(omode & O_LOOKUP)) {
-    path = ip->repath;
-
-    iunlockput(ip);
-    if ((ip = namei(path)) == 0) {
+    // A symlink's contents are its target; only writelink() sets them.
+    if(ip->type == T_SYMLINK && (omode & (O_WRONLY|O_RDWR))){
+      iunlockput(ip);
       end_op();
       return -1;
     }
-    ilock(ip);
   }
 
   if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
@@ -458,14 +465,43 @@ sys_pipe(void)
   return 0;
 }
 
+// Set the capacity of a pipe; see pipesize() in pipe.c.
+int
+sys_pipesize(void)
+{
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0)
+    return -1;
+  if(f->type != FD_PIPE)
+    return -1;
+  return pipesize(f->pipe, n);
+}
+
+// Set the file read-ahead window; see setreadahead() in fs.c.
+int
+sys_readahead(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return setreadahead(n);
+}
+
 // Make symbolic linked file.
 int
 sys_symlink(void)
 {
   char *oldpath, *newpath;
   struct inode *ip;
+  int n;
 
-  if (argstr(0, &oldpath) < 0 || argstr(1, &newpath) < 0) {
+  if ((n = argstr(0, &oldpath)) < 0 || argstr(1, &newpath) < 0) {
+    return -1;
+  }
+  if (n == 0 || n >= MAXPATH) {
     return -1;
   }
 
@@ -477,8 +513,7 @@ sys_symlink(void)
     return -1;
   }
 
-  safestrcpy(ip->repath, oldpath, MAXPATH);
-  iupdate(ip);
+  writelink(ip, oldpath, n);
   iunlockput(ip);
 
   end_op();
@@ -489,4 +524,28 @@ int
 sys_sync(void)
 {
   return sync(); 
-}
\ No newline at end of file
+}
+
+// Copy the disk request counters to user space.
+int
+sys_iostat(void)
+{
+  struct iostat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  ideiostat(st);
+  return 0;
+}
+
+// Copy the name cache counters to user space.
+int
+sys_dcstat(void)
+{
+  struct dcstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  dcachestat(st);
+  return 0;
+}
@@ -53,6 +53,7 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      logtick();
     }
     lapiceoi();
     break;
@@ -78,6 +79,20 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // Write to a page shared copy-on-write since fork(),
+    // or first touch of a heap page reserved by sbrk().
+    // This also catches the kernel touching user memory
+    // on behalf of a system call, since CR0_WP is set;
+    // argptr() and fetchstr() fault such pages in first
+    // (touchuvm), so running out of memory fails the call.
+    if(myproc() && (cowuvm(myproc()->pgdir, rcr2()) == 0 ||
+       lazyuvm(myproc()->pgdir, rcr2(), myproc()->sz) == 0)){
+      lcr3(V2P(myproc()->pgdir));
+      break;
+    }
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
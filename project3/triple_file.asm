@@ -0,0 +1,1425 @@
+
+_triple_file:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  if (first)
+    printf(1, "Test 2 passed\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+  int i;
+  for (i = 0; i < NUM_BYTES; i++)
+    buf[i] = (i % 26) + 'a';
+   e:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+{
+  13:	51                   	push   %ecx
+  for (i = 0; i < NUM_BYTES; i++)
+  14:	31 c9                	xor    %ecx,%ecx
+  16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  1d:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[i] = (i % 26) + 'a';
+  20:	89 c8                	mov    %ecx,%eax
+  22:	f7 e3                	mul    %ebx
+  24:	89 c8                	mov    %ecx,%eax
+  for (i = 0; i < NUM_BYTES; i++)
+  26:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = (i % 26) + 'a';
+  29:	c1 ea 03             	shr    $0x3,%edx
+  2c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  2f:	29 d0                	sub    %edx,%eax
+  31:	83 c0 61             	add    $0x61,%eax
+  34:	88 81 9f 0e 00 01    	mov    %al,0x1000e9f(%ecx)
+  for (i = 0; i < NUM_BYTES; i++)
+  3a:	81 f9 00 00 00 01    	cmp    $0x1000000,%ecx
+  40:	75 de                	jne    20 <main+0x20>
+
+  test1(1);
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	6a 01                	push   $0x1
+  47:	e8 54 00 00 00       	call   a0 <test1>
+  test2(1);
+  4c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  53:	e8 08 01 00 00       	call   160 <test2>
+  
+  printf(1, "All tests passed!!\n");
+  58:	58                   	pop    %eax
+  59:	5a                   	pop    %edx
+  5a:	68 a0 0a 00 00       	push   $0xaa0
+  5f:	6a 01                	push   $0x1
+  61:	e8 4a 06 00 00       	call   6b0 <printf>
+  exit();
+  66:	e8 c8 04 00 00       	call   533 <exit>
+  6b:	66 90                	xchg   %ax,%ax
+  6d:	66 90                	xchg   %ax,%ax
+  6f:	90                   	nop
+
+00000070 <failed>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	83 ec 10             	sub    $0x10,%esp
+  printf(1, msg);
+  76:	ff 75 08             	push   0x8(%ebp)
+  79:	6a 01                	push   $0x1
+  7b:	e8 30 06 00 00       	call   6b0 <printf>
+  printf(1, "Test failed!!\n");
+  80:	58                   	pop    %eax
+  81:	5a                   	pop    %edx
+  82:	68 d8 09 00 00       	push   $0x9d8
+  87:	6a 01                	push   $0x1
+  89:	e8 22 06 00 00       	call   6b0 <printf>
+  exit();
+  8e:	e8 a0 04 00 00       	call   533 <exit>
+  93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000a0 <test1>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	56                   	push   %esi
+  a4:	53                   	push   %ebx
+  a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (first)
+  a8:	85 f6                	test   %esi,%esi
+  aa:	75 54                	jne    100 <test1+0x60>
+  fd = open(filename, O_CREATE | O_WRONLY);
+  ac:	83 ec 08             	sub    $0x8,%esp
+  af:	68 01 02 00 00       	push   $0x201
+  b4:	68 74 0e 00 00       	push   $0xe74
+  b9:	e8 b5 04 00 00       	call   573 <open>
+  if (fd < 0)
+  be:	83 c4 10             	add    $0x10,%esp
+  fd = open(filename, O_CREATE | O_WRONLY);
+  c1:	89 c3                	mov    %eax,%ebx
+  if (fd < 0)
+  c3:	85 c0                	test   %eax,%eax
+  c5:	0f 88 88 00 00 00    	js     153 <test1+0xb3>
+  if (write(fd, buf, NUM_BYTES) < 0)
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	68 00 00 00 01       	push   $0x1000000
+  d3:	68 a0 0e 00 01       	push   $0x1000ea0
+  d8:	50                   	push   %eax
+  d9:	e8 75 04 00 00       	call   553 <write>
+  de:	83 c4 10             	add    $0x10,%esp
+  e1:	85 c0                	test   %eax,%eax
+  e3:	78 61                	js     146 <test1+0xa6>
+  if (close(fd) < 0)
+  e5:	83 ec 0c             	sub    $0xc,%esp
+  e8:	53                   	push   %ebx
+  e9:	e8 6d 04 00 00       	call   55b <close>
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	85 c0                	test   %eax,%eax
+  f3:	78 44                	js     139 <test1+0x99>
+  if (first)
+  f5:	85 f6                	test   %esi,%esi
+  f7:	75 27                	jne    120 <test1+0x80>
+}
+  f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  fc:	5b                   	pop    %ebx
+  fd:	5e                   	pop    %esi
+  fe:	5d                   	pop    %ebp
+  ff:	c3                   	ret
+    printf(1, "Test 1: Write %d bytes\n", NUM_BYTES);
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	68 00 00 00 01       	push   $0x1000000
+ 108:	68 e7 09 00 00       	push   $0x9e7
+ 10d:	6a 01                	push   $0x1
+ 10f:	e8 9c 05 00 00       	call   6b0 <printf>
+ 114:	83 c4 10             	add    $0x10,%esp
+ 117:	eb 93                	jmp    ac <test1+0xc>
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "Test 1 passed\n\n");
+ 120:	83 ec 08             	sub    $0x8,%esp
+ 123:	68 34 0a 00 00       	push   $0xa34
+ 128:	6a 01                	push   $0x1
+ 12a:	e8 81 05 00 00       	call   6b0 <printf>
+ 12f:	83 c4 10             	add    $0x10,%esp
+}
+ 132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 135:	5b                   	pop    %ebx
+ 136:	5e                   	pop    %esi
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+    failed("File close error\n");
+ 139:	83 ec 0c             	sub    $0xc,%esp
+ 13c:	68 22 0a 00 00       	push   $0xa22
+ 141:	e8 2a ff ff ff       	call   70 <failed>
+    failed("File write error\n");
+ 146:	83 ec 0c             	sub    $0xc,%esp
+ 149:	68 10 0a 00 00       	push   $0xa10
+ 14e:	e8 1d ff ff ff       	call   70 <failed>
+    failed("File open error\n");
+ 153:	83 ec 0c             	sub    $0xc,%esp
+ 156:	68 ff 09 00 00       	push   $0x9ff
+ 15b:	e8 10 ff ff ff       	call   70 <failed>
+
+00000160 <test2>:
+{
+ 160:	55                   	push   %ebp
+ 161:	b8 a0 0e 00 00       	mov    $0xea0,%eax
+ 166:	89 e5                	mov    %esp,%ebp
+ 168:	57                   	push   %edi
+ 169:	56                   	push   %esi
+ 16a:	53                   	push   %ebx
+ 16b:	83 ec 0c             	sub    $0xc,%esp
+ 16e:	66 90                	xchg   %ax,%ax
+    buf2[i] = 0;
+ 170:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for (i = 0; i < NUM_BYTES; i++)
+ 176:	83 c0 04             	add    $0x4,%eax
+ 179:	3d a0 0e 00 01       	cmp    $0x1000ea0,%eax
+ 17e:	75 f0                	jne    170 <test2+0x10>
+  if (first)
+ 180:	8b 55 08             	mov    0x8(%ebp),%edx
+ 183:	85 d2                	test   %edx,%edx
+ 185:	0f 85 c1 00 00 00    	jne    24c <test2+0xec>
+  fd = open(filename, O_RDONLY);
+ 18b:	83 ec 08             	sub    $0x8,%esp
+ 18e:	6a 00                	push   $0x0
+ 190:	68 74 0e 00 00       	push   $0xe74
+ 195:	e8 d9 03 00 00       	call   573 <open>
+  if (fd < 0)
+ 19a:	83 c4 10             	add    $0x10,%esp
+  fd = open(filename, O_RDONLY);
+ 19d:	89 c6                	mov    %eax,%esi
+  if (fd < 0)
+ 19f:	85 c0                	test   %eax,%eax
+ 1a1:	0f 88 2e 01 00 00    	js     2d5 <test2+0x175>
+  if (read(fd, buf2, NUM_BYTES) < 0)
+ 1a7:	83 ec 04             	sub    $0x4,%esp
+ 1aa:	68 00 00 00 01       	push   $0x1000000
+ 1af:	68 a0 0e 00 00       	push   $0xea0
+ 1b4:	50                   	push   %eax
+ 1b5:	e8 91 03 00 00       	call   54b <read>
+ 1ba:	83 c4 10             	add    $0x10,%esp
+ 1bd:	85 c0                	test   %eax,%eax
+ 1bf:	0f 88 03 01 00 00    	js     2c8 <test2+0x168>
+  for (i = 0; i < NUM_BYTES; i++) {
+ 1c5:	31 ff                	xor    %edi,%edi
+    if (buf2[i] != (i % 26) + 'a') {
+ 1c7:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d0:	89 f8                	mov    %edi,%eax
+ 1d2:	0f be 8f a0 0e 00 00 	movsbl 0xea0(%edi),%ecx
+ 1d9:	f7 e3                	mul    %ebx
+ 1db:	89 f8                	mov    %edi,%eax
+ 1dd:	c1 ea 03             	shr    $0x3,%edx
+ 1e0:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 1e3:	29 d0                	sub    %edx,%eax
+ 1e5:	83 c0 61             	add    $0x61,%eax
+ 1e8:	39 c1                	cmp    %eax,%ecx
+ 1ea:	0f 85 92 00 00 00    	jne    282 <test2+0x122>
+  for (i = 0; i < NUM_BYTES; i++) {
+ 1f0:	83 c7 01             	add    $0x1,%edi
+ 1f3:	81 ff 00 00 00 01    	cmp    $0x1000000,%edi
+ 1f9:	75 d5                	jne    1d0 <test2+0x70>
+  if (close(fd) < 0)
+ 1fb:	83 ec 0c             	sub    $0xc,%esp
+ 1fe:	56                   	push   %esi
+ 1ff:	e8 57 03 00 00       	call   55b <close>
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	85 c0                	test   %eax,%eax
+ 209:	0f 88 92 00 00 00    	js     2a1 <test2+0x141>
+  if (unlink(filename) < 0)
+ 20f:	83 ec 0c             	sub    $0xc,%esp
+ 212:	68 74 0e 00 00       	push   $0xe74
+ 217:	e8 67 03 00 00       	call   583 <unlink>
+ 21c:	83 c4 10             	add    $0x10,%esp
+ 21f:	85 c0                	test   %eax,%eax
+ 221:	0f 88 94 00 00 00    	js     2bb <test2+0x15b>
+  if ((fd = open(filename, O_RDONLY)) >= 0)
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	6a 00                	push   $0x0
+ 22c:	68 74 0e 00 00       	push   $0xe74
+ 231:	e8 3d 03 00 00       	call   573 <open>
+ 236:	83 c4 10             	add    $0x10,%esp
+ 239:	85 c0                	test   %eax,%eax
+ 23b:	79 71                	jns    2ae <test2+0x14e>
+  if (first)
+ 23d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 240:	85 c0                	test   %eax,%eax
+ 242:	75 24                	jne    268 <test2+0x108>
+}
+ 244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 247:	5b                   	pop    %ebx
+ 248:	5e                   	pop    %esi
+ 249:	5f                   	pop    %edi
+ 24a:	5d                   	pop    %ebp
+ 24b:	c3                   	ret
+    printf(1, "Test 2: Read %d bytes\n", NUM_BYTES);
+ 24c:	83 ec 04             	sub    $0x4,%esp
+ 24f:	68 00 00 00 01       	push   $0x1000000
+ 254:	68 44 0a 00 00       	push   $0xa44
+ 259:	6a 01                	push   $0x1
+ 25b:	e8 50 04 00 00       	call   6b0 <printf>
+ 260:	83 c4 10             	add    $0x10,%esp
+ 263:	e9 23 ff ff ff       	jmp    18b <test2+0x2b>
+    printf(1, "Test 2 passed\n\n");
+ 268:	83 ec 08             	sub    $0x8,%esp
+ 26b:	68 90 0a 00 00       	push   $0xa90
+ 270:	6a 01                	push   $0x1
+ 272:	e8 39 04 00 00       	call   6b0 <printf>
+ 277:	83 c4 10             	add    $0x10,%esp
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+      printf(1, "%dth character, expected %c, found %c\n", i, (i % 26) + 'a', buf2[i]);
+ 282:	83 ec 0c             	sub    $0xc,%esp
+ 285:	51                   	push   %ecx
+ 286:	50                   	push   %eax
+ 287:	57                   	push   %edi
+ 288:	68 b4 0a 00 00       	push   $0xab4
+ 28d:	6a 01                	push   $0x1
+ 28f:	e8 1c 04 00 00       	call   6b0 <printf>
+      failed("");
+ 294:	83 c4 14             	add    $0x14,%esp
+ 297:	68 43 0a 00 00       	push   $0xa43
+ 29c:	e8 cf fd ff ff       	call   70 <failed>
+    failed("File close error\n");
+ 2a1:	83 ec 0c             	sub    $0xc,%esp
+ 2a4:	68 22 0a 00 00       	push   $0xa22
+ 2a9:	e8 c2 fd ff ff       	call   70 <failed>
+      failed("File not erased\n");
+ 2ae:	83 ec 0c             	sub    $0xc,%esp
+ 2b1:	68 7f 0a 00 00       	push   $0xa7f
+ 2b6:	e8 b5 fd ff ff       	call   70 <failed>
+    failed("File unlink error\n");
+ 2bb:	83 ec 0c             	sub    $0xc,%esp
+ 2be:	68 6c 0a 00 00       	push   $0xa6c
+ 2c3:	e8 a8 fd ff ff       	call   70 <failed>
+    failed("File read error\n");
+ 2c8:	83 ec 0c             	sub    $0xc,%esp
+ 2cb:	68 5b 0a 00 00       	push   $0xa5b
+ 2d0:	e8 9b fd ff ff       	call   70 <failed>
+    failed("File open error\n");
+ 2d5:	83 ec 0c             	sub    $0xc,%esp
+ 2d8:	68 ff 09 00 00       	push   $0x9ff
+ 2dd:	e8 8e fd ff ff       	call   70 <failed>
+ 2e2:	66 90                	xchg   %ax,%ax
+ 2e4:	66 90                	xchg   %ax,%ax
+ 2e6:	66 90                	xchg   %ax,%ax
+ 2e8:	66 90                	xchg   %ax,%ax
+ 2ea:	66 90                	xchg   %ax,%ax
+ 2ec:	66 90                	xchg   %ax,%ax
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2f1:	31 c0                	xor    %eax,%eax
+{
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	53                   	push   %ebx
+ 2f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 300:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 304:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 307:	83 c0 01             	add    $0x1,%eax
+ 30a:	84 d2                	test   %dl,%dl
+ 30c:	75 f2                	jne    300 <strcpy+0x10>
+    ;
+  return os;
+}
+ 30e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 311:	89 c8                	mov    %ecx,%eax
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+ 315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+ 327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 32a:	0f b6 02             	movzbl (%edx),%eax
+ 32d:	84 c0                	test   %al,%al
+ 32f:	75 17                	jne    348 <strcmp+0x28>
+ 331:	eb 3a                	jmp    36d <strcmp+0x4d>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+ 338:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 33c:	83 c2 01             	add    $0x1,%edx
+ 33f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 342:	84 c0                	test   %al,%al
+ 344:	74 1a                	je     360 <strcmp+0x40>
+    p++, q++;
+ 346:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 348:	0f b6 19             	movzbl (%ecx),%ebx
+ 34b:	38 c3                	cmp    %al,%bl
+ 34d:	74 e9                	je     338 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 34f:	29 d8                	sub    %ebx,%eax
+}
+ 351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 360:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 364:	31 c0                	xor    %eax,%eax
+ 366:	29 d8                	sub    %ebx,%eax
+}
+ 368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36b:	c9                   	leave
+ 36c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 36d:	0f b6 19             	movzbl (%ecx),%ebx
+ 370:	31 c0                	xor    %eax,%eax
+ 372:	eb db                	jmp    34f <strcmp+0x2f>
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 386:	80 3a 00             	cmpb   $0x0,(%edx)
+ 389:	74 15                	je     3a0 <strlen+0x20>
+ 38b:	31 c0                	xor    %eax,%eax
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+ 390:	83 c0 01             	add    $0x1,%eax
+ 393:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 397:	89 c1                	mov    %eax,%ecx
+ 399:	75 f5                	jne    390 <strlen+0x10>
+    ;
+  return n;
+}
+ 39b:	89 c8                	mov    %ecx,%eax
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+ 39f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3a0:	31 c9                	xor    %ecx,%ecx
+}
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	89 c8                	mov    %ecx,%eax
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bd:	89 d7                	mov    %edx,%edi
+ 3bf:	fc                   	cld
+ 3c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3c5:	89 d0                	mov    %edx,%eax
+ 3c7:	c9                   	leave
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3da:	0f b6 10             	movzbl (%eax),%edx
+ 3dd:	84 d2                	test   %dl,%dl
+ 3df:	75 12                	jne    3f3 <strchr+0x23>
+ 3e1:	eb 1d                	jmp    400 <strchr+0x30>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ec:	83 c0 01             	add    $0x1,%eax
+ 3ef:	84 d2                	test   %dl,%dl
+ 3f1:	74 0d                	je     400 <strchr+0x30>
+    if(*s == c)
+ 3f3:	38 d1                	cmp    %dl,%cl
+ 3f5:	75 f1                	jne    3e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3f7:	5d                   	pop    %ebp
+ 3f8:	c3                   	ret
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 400:	31 c0                	xor    %eax,%eax
+}
+ 402:	5d                   	pop    %ebp
+ 403:	c3                   	ret
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 415:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 418:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 419:	31 db                	xor    %ebx,%ebx
+{
+ 41b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 41e:	eb 27                	jmp    447 <gets+0x37>
+    cc = read(0, &c, 1);
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	6a 01                	push   $0x1
+ 425:	56                   	push   %esi
+ 426:	6a 00                	push   $0x0
+ 428:	e8 1e 01 00 00       	call   54b <read>
+    if(cc < 1)
+ 42d:	83 c4 10             	add    $0x10,%esp
+ 430:	85 c0                	test   %eax,%eax
+ 432:	7e 1d                	jle    451 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 434:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 43f:	3c 0a                	cmp    $0xa,%al
+ 441:	74 10                	je     453 <gets+0x43>
+ 443:	3c 0d                	cmp    $0xd,%al
+ 445:	74 0c                	je     453 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 447:	89 df                	mov    %ebx,%edi
+ 449:	83 c3 01             	add    $0x1,%ebx
+ 44c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 44f:	7c cf                	jl     420 <gets+0x10>
+ 451:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 45a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45d:	5b                   	pop    %ebx
+ 45e:	5e                   	pop    %esi
+ 45f:	5f                   	pop    %edi
+ 460:	5d                   	pop    %ebp
+ 461:	c3                   	ret
+ 462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_LOOKUP);
+ 475:	83 ec 08             	sub    $0x8,%esp
+ 478:	6a 04                	push   $0x4
+ 47a:	ff 75 08             	push   0x8(%ebp)
+ 47d:	e8 f1 00 00 00       	call   573 <open>
+  if(fd < 0)
+ 482:	83 c4 10             	add    $0x10,%esp
+ 485:	85 c0                	test   %eax,%eax
+ 487:	78 27                	js     4b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 489:	83 ec 08             	sub    $0x8,%esp
+ 48c:	ff 75 0c             	push   0xc(%ebp)
+ 48f:	89 c3                	mov    %eax,%ebx
+ 491:	50                   	push   %eax
+ 492:	e8 f4 00 00 00       	call   58b <fstat>
+  close(fd);
+ 497:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 49a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 49c:	e8 ba 00 00 00       	call   55b <close>
+  return r;
+ 4a1:	83 c4 10             	add    $0x10,%esp
+}
+ 4a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4a7:	89 f0                	mov    %esi,%eax
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5d                   	pop    %ebp
+ 4ac:	c3                   	ret
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4b5:	eb ed                	jmp    4a4 <stat+0x34>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4c7:	0f be 02             	movsbl (%edx),%eax
+ 4ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4d5:	77 1e                	ja     4f5 <atoi+0x35>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4e0:	83 c2 01             	add    $0x1,%edx
+ 4e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ea:	0f be 02             	movsbl (%edx),%eax
+ 4ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4f0:	80 fb 09             	cmp    $0x9,%bl
+ 4f3:	76 eb                	jbe    4e0 <atoi+0x20>
+  return n;
+}
+ 4f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f8:	89 c8                	mov    %ecx,%eax
+ 4fa:	c9                   	leave
+ 4fb:	c3                   	ret
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	8b 45 10             	mov    0x10(%ebp),%eax
+ 508:	8b 55 08             	mov    0x8(%ebp),%edx
+ 50b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 50e:	85 c0                	test   %eax,%eax
+ 510:	7e 13                	jle    525 <memmove+0x25>
+ 512:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 514:	89 d7                	mov    %edx,%edi
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 520:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 521:	39 f8                	cmp    %edi,%eax
+ 523:	75 fb                	jne    520 <memmove+0x20>
+  return vdst;
+}
+ 525:	5e                   	pop    %esi
+ 526:	89 d0                	mov    %edx,%eax
+ 528:	5f                   	pop    %edi
+ 529:	5d                   	pop    %ebp
+ 52a:	c3                   	ret
+
+0000052b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 52b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <exit>:
+SYSCALL(exit)
+ 533:	b8 02 00 00 00       	mov    $0x2,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <wait>:
+SYSCALL(wait)
+ 53b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <pipe>:
+SYSCALL(pipe)
+ 543:	b8 04 00 00 00       	mov    $0x4,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <read>:
+SYSCALL(read)
+ 54b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <write>:
+SYSCALL(write)
+ 553:	b8 10 00 00 00       	mov    $0x10,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <close>:
+SYSCALL(close)
+ 55b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <kill>:
+SYSCALL(kill)
+ 563:	b8 06 00 00 00       	mov    $0x6,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <exec>:
+SYSCALL(exec)
+ 56b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <open>:
+SYSCALL(open)
+ 573:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mknod>:
+SYSCALL(mknod)
+ 57b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <unlink>:
+SYSCALL(unlink)
+ 583:	b8 12 00 00 00       	mov    $0x12,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <fstat>:
+SYSCALL(fstat)
+ 58b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <link>:
+SYSCALL(link)
+ 593:	b8 13 00 00 00       	mov    $0x13,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mkdir>:
+SYSCALL(mkdir)
+ 59b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <chdir>:
+SYSCALL(chdir)
+ 5a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <dup>:
+SYSCALL(dup)
+ 5ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getpid>:
+SYSCALL(getpid)
+ 5b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sbrk>:
+SYSCALL(sbrk)
+ 5bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sleep>:
+SYSCALL(sleep)
+ 5c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <uptime>:
+SYSCALL(uptime)
+ 5cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <symlink>:
+SYSCALL(symlink)
+ 5d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sync>:
+SYSCALL(sync)
+ 5db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <iostat>:
+SYSCALL(iostat)
+ 5e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <pipesize>:
+SYSCALL(pipesize)
+ 5eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <readahead>:
+SYSCALL(readahead)
+ 5f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <dcstat>:
+SYSCALL(dcstat)
+ 5fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+ 603:	66 90                	xchg   %ax,%ax
+ 605:	66 90                	xchg   %ax,%ax
+ 607:	66 90                	xchg   %ax,%ax
+ 609:	66 90                	xchg   %ax,%ax
+ 60b:	66 90                	xchg   %ax,%ax
+ 60d:	66 90                	xchg   %ax,%ax
+ 60f:	90                   	nop
+
+00000610 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 618:	89 d1                	mov    %edx,%ecx
+{
+ 61a:	83 ec 3c             	sub    $0x3c,%esp
+ 61d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 620:	85 d2                	test   %edx,%edx
+ 622:	0f 89 80 00 00 00    	jns    6a8 <printint+0x98>
+ 628:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 62c:	74 7a                	je     6a8 <printint+0x98>
+    x = -xx;
+ 62e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 630:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 635:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 638:	31 f6                	xor    %esi,%esi
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 640:	89 c8                	mov    %ecx,%eax
+ 642:	31 d2                	xor    %edx,%edx
+ 644:	89 f7                	mov    %esi,%edi
+ 646:	f7 f3                	div    %ebx
+ 648:	8d 76 01             	lea    0x1(%esi),%esi
+ 64b:	0f b6 92 40 0b 00 00 	movzbl 0xb40(%edx),%edx
+ 652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 656:	89 ca                	mov    %ecx,%edx
+ 658:	89 c1                	mov    %eax,%ecx
+ 65a:	39 da                	cmp    %ebx,%edx
+ 65c:	73 e2                	jae    640 <printint+0x30>
+  if(neg)
+ 65e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 661:	85 c0                	test   %eax,%eax
+ 663:	74 07                	je     66c <printint+0x5c>
+    buf[i++] = '-';
+ 665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 66a:	89 f7                	mov    %esi,%edi
+ 66c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 66f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 672:	01 df                	add    %ebx,%edi
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 678:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 681:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 684:	6a 01                	push   $0x1
+ 686:	50                   	push   %eax
+ 687:	56                   	push   %esi
+ 688:	e8 c6 fe ff ff       	call   553 <write>
+  while(--i >= 0)
+ 68d:	89 f8                	mov    %edi,%eax
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	83 ef 01             	sub    $0x1,%edi
+ 695:	39 d8                	cmp    %ebx,%eax
+ 697:	75 df                	jne    678 <printint+0x68>
+}
+ 699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69c:	5b                   	pop    %ebx
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+ 6aa:	eb 89                	jmp    635 <printint+0x25>
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c2:	83 c6 01             	add    $0x1,%esi
+ 6c5:	84 db                	test   %bl,%bl
+ 6c7:	74 67                	je     730 <printf+0x80>
+ 6c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6cc:	31 d2                	xor    %edx,%edx
+ 6ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6d1:	eb 34                	jmp    707 <printf+0x57>
+ 6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d7:	90                   	nop
+ 6d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6e0:	83 f8 25             	cmp    $0x25,%eax
+ 6e3:	74 18                	je     6fd <printf+0x4d>
+  write(fd, &c, 1);
+ 6e5:	83 ec 04             	sub    $0x4,%esp
+ 6e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	50                   	push   %eax
+ 6f1:	57                   	push   %edi
+ 6f2:	e8 5c fe ff ff       	call   553 <write>
+ 6f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 700:	83 c6 01             	add    $0x1,%esi
+ 703:	84 db                	test   %bl,%bl
+ 705:	74 29                	je     730 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 707:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 ca                	je     6d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 70e:	83 fa 25             	cmp    $0x25,%edx
+ 711:	75 ea                	jne    6fd <printf+0x4d>
+      if(c == 'd'){
+ 713:	83 f8 25             	cmp    $0x25,%eax
+ 716:	0f 84 24 01 00 00    	je     840 <printf+0x190>
+ 71c:	83 e8 63             	sub    $0x63,%eax
+ 71f:	83 f8 15             	cmp    $0x15,%eax
+ 722:	77 1c                	ja     740 <printf+0x90>
+ 724:	ff 24 85 e8 0a 00 00 	jmp    *0xae8(,%eax,4)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 746:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 74a:	6a 01                	push   $0x1
+ 74c:	52                   	push   %edx
+ 74d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 750:	57                   	push   %edi
+ 751:	e8 fd fd ff ff       	call   553 <write>
+ 756:	83 c4 0c             	add    $0xc,%esp
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75c:	6a 01                	push   $0x1
+ 75e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 761:	52                   	push   %edx
+ 762:	57                   	push   %edi
+ 763:	e8 eb fd ff ff       	call   553 <write>
+        putc(fd, c);
+ 768:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76b:	31 d2                	xor    %edx,%edx
+ 76d:	eb 8e                	jmp    6fd <printf+0x4d>
+ 76f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 00                	push   $0x0
+ 77f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 781:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 784:	e8 87 fe ff ff       	call   610 <printint>
+        ap++;
+ 789:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 78c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 67 ff ff ff       	jmp    6fd <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7ab:	85 db                	test   %ebx,%ebx
+ 7ad:	0f 84 9d 00 00 00    	je     850 <printf+0x1a0>
+        while(*s != 0){
+ 7b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	0f 84 3d ff ff ff    	je     6fd <printf+0x4d>
+ 7c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7c6:	89 de                	mov    %ebx,%esi
+ 7c8:	89 d3                	mov    %edx,%ebx
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	53                   	push   %ebx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 71 fd ff ff       	call   553 <write>
+        while(*s != 0){
+ 7e2:	0f b6 06             	movzbl (%esi),%eax
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	75 e4                	jne    7d0 <printf+0x120>
+      state = 0;
+ 7ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 07 ff ff ff       	jmp    6fd <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 01                	push   $0x1
+ 80f:	e9 6b ff ff ff       	jmp    77f <printf+0xcf>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 818:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 821:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 823:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 826:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	52                   	push   %edx
+ 82c:	57                   	push   %edi
+ 82d:	e8 21 fd ff ff       	call   553 <write>
+        ap++;
+ 832:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 835:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 838:	31 d2                	xor    %edx,%edx
+ 83a:	e9 be fe ff ff       	jmp    6fd <printf+0x4d>
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 846:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 849:	6a 01                	push   $0x1
+ 84b:	e9 11 ff ff ff       	jmp    761 <printf+0xb1>
+ 850:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 855:	bb e0 0a 00 00       	mov    $0xae0,%ebx
+ 85a:	e9 61 ff ff ff       	jmp    7c0 <printf+0x110>
+ 85f:	90                   	nop
+
+00000860 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 860:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	a1 a0 0e 00 02       	mov    0x2000ea0,%eax
+{
+ 866:	89 e5                	mov    %esp,%ebp
+ 868:	57                   	push   %edi
+ 869:	56                   	push   %esi
+ 86a:	53                   	push   %ebx
+ 86b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 86e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 878:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 87c:	39 ca                	cmp    %ecx,%edx
+ 87e:	73 30                	jae    8b0 <free+0x50>
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 04                	jb     888 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 884:	39 c2                	cmp    %eax,%edx
+ 886:	72 f0                	jb     878 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 888:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 88b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 88e:	39 f8                	cmp    %edi,%eax
+ 890:	74 2e                	je     8c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 892:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 895:	8b 42 04             	mov    0x4(%edx),%eax
+ 898:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 89b:	39 f1                	cmp    %esi,%ecx
+ 89d:	74 38                	je     8d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 89f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8a1:	5b                   	pop    %ebx
+  freep = p;
+ 8a2:	89 15 a0 0e 00 02    	mov    %edx,0x2000ea0
+}
+ 8a8:	5e                   	pop    %esi
+ 8a9:	5f                   	pop    %edi
+ 8aa:	5d                   	pop    %ebp
+ 8ab:	c3                   	ret
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 d0                	jb     884 <free+0x24>
+ 8b4:	eb c2                	jmp    878 <free+0x18>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	03 70 04             	add    0x4(%eax),%esi
+ 8c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c6:	8b 02                	mov    (%edx),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8d3:	39 f1                	cmp    %esi,%ecx
+ 8d5:	75 c8                	jne    89f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8da:	89 15 a0 0e 00 02    	mov    %edx,0x2000ea0
+    p->s.size += bp->s.size;
+ 8e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8e8:	5b                   	pop    %ebx
+ 8e9:	5e                   	pop    %esi
+ 8ea:	5f                   	pop    %edi
+ 8eb:	5d                   	pop    %ebp
+ 8ec:	c3                   	ret
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8fc:	8b 15 a0 0e 00 02    	mov    0x2000ea0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 902:	8d 78 07             	lea    0x7(%eax),%edi
+ 905:	c1 ef 03             	shr    $0x3,%edi
+ 908:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 90b:	85 d2                	test   %edx,%edx
+ 90d:	0f 84 8d 00 00 00    	je     9a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 913:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 915:	8b 48 04             	mov    0x4(%eax),%ecx
+ 918:	39 f9                	cmp    %edi,%ecx
+ 91a:	73 64                	jae    980 <malloc+0x90>
+  if(nu < 4096)
+ 91c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 921:	39 df                	cmp    %ebx,%edi
+ 923:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 926:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 92d:	eb 0a                	jmp    939 <malloc+0x49>
+ 92f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 930:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 932:	8b 48 04             	mov    0x4(%eax),%ecx
+ 935:	39 f9                	cmp    %edi,%ecx
+ 937:	73 47                	jae    980 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 939:	89 c2                	mov    %eax,%edx
+ 93b:	39 05 a0 0e 00 02    	cmp    %eax,0x2000ea0
+ 941:	75 ed                	jne    930 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	56                   	push   %esi
+ 947:	e8 6f fc ff ff       	call   5bb <sbrk>
+  if(p == (char*)-1)
+ 94c:	83 c4 10             	add    $0x10,%esp
+ 94f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 952:	74 1c                	je     970 <malloc+0x80>
+  hp->s.size = nu;
+ 954:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 957:	83 ec 0c             	sub    $0xc,%esp
+ 95a:	83 c0 08             	add    $0x8,%eax
+ 95d:	50                   	push   %eax
+ 95e:	e8 fd fe ff ff       	call   860 <free>
+  return freep;
+ 963:	8b 15 a0 0e 00 02    	mov    0x2000ea0,%edx
+      if((p = morecore(nunits)) == 0)
+ 969:	83 c4 10             	add    $0x10,%esp
+ 96c:	85 d2                	test   %edx,%edx
+ 96e:	75 c0                	jne    930 <malloc+0x40>
+        return 0;
+  }
+}
+ 970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 973:	31 c0                	xor    %eax,%eax
+}
+ 975:	5b                   	pop    %ebx
+ 976:	5e                   	pop    %esi
+ 977:	5f                   	pop    %edi
+ 978:	5d                   	pop    %ebp
+ 979:	c3                   	ret
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 980:	39 cf                	cmp    %ecx,%edi
+ 982:	74 4c                	je     9d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 984:	29 f9                	sub    %edi,%ecx
+ 986:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 989:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 98c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 98f:	89 15 a0 0e 00 02    	mov    %edx,0x2000ea0
+}
+ 995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 998:	83 c0 08             	add    $0x8,%eax
+}
+ 99b:	5b                   	pop    %ebx
+ 99c:	5e                   	pop    %esi
+ 99d:	5f                   	pop    %edi
+ 99e:	5d                   	pop    %ebp
+ 99f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9a0:	c7 05 a0 0e 00 02 a4 	movl   $0x2000ea4,0x2000ea0
+ 9a7:	0e 00 02 
+    base.s.size = 0;
+ 9aa:	b8 a4 0e 00 02       	mov    $0x2000ea4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9af:	c7 05 a4 0e 00 02 a4 	movl   $0x2000ea4,0x2000ea4
+ 9b6:	0e 00 02 
+    base.s.size = 0;
+ 9b9:	c7 05 a8 0e 00 02 00 	movl   $0x0,0x2000ea8
+ 9c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9c3:	e9 54 ff ff ff       	jmp    91c <malloc+0x2c>
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 08                	mov    (%eax),%ecx
+ 9d2:	89 0a                	mov    %ecx,(%edx)
+ 9d4:	eb b9                	jmp    98f <malloc+0x9f>
@@ -3,9 +3,8 @@
 #include "stat.h"
 #include "user.h"
 #include "fcntl.h"
+#include "fs.h"
 
-#define BSIZE 512
-#define NINDIRECT (BSIZE / sizeof(uint))
 #define NDBLINDIRECT ((NINDIRECT) * (NINDIRECT))
 #define NUM_BYTES (16 * 1024 * 1024)
 
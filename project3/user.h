@@ -1,4 +1,6 @@
 struct stat;
+struct iostat;
+struct dcstat;
 struct rtcdate;
 
 // system calls
@@ -25,6 +27,10 @@ int sleep(int);
 int uptime(void);
 int symlink(const char* oldpath, const char* newpath);
 int sync(void);
+int iostat(struct iostat*);
+int pipesize(int, int);
+int readahead(int);
+int dcstat(struct dcstat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,7817 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 20 5c 00 00       	push   $0x5c20
+      16:	6a 01                	push   $0x1
+      18:	e8 b3 46 00 00       	call   46d0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 34 5c 00 00       	push   $0x5c34
+      26:	e8 68 45 00 00       	call   4593 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 74 64 00 00       	push   $0x6474
+      39:	6a 01                	push   $0x1
+      3b:	e8 90 46 00 00       	call   46d0 <printf>
+    exit();
+      40:	e8 0e 45 00 00       	call   4553 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 34 5c 00 00       	push   $0x5c34
+      51:	e8 3d 45 00 00       	call   4593 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 1d 45 00 00       	call   457b <close>
+
+  argptest();
+      5e:	e8 1d 42 00 00       	call   4280 <argptest>
+  createdelete();
+      63:	e8 58 14 00 00       	call   14c0 <createdelete>
+  linkunlink();
+      68:	e8 63 24 00 00       	call   24d0 <linkunlink>
+  concreate();
+      6d:	e8 5e 21 00 00       	call   21d0 <concreate>
+  fourfiles();
+      72:	e8 49 12 00 00       	call   12c0 <fourfiles>
+  sharedfd();
+      77:	e8 84 10 00 00       	call   1100 <sharedfd>
+
+  bigargtest();
+      7c:	e8 bf 3e 00 00       	call   3f40 <bigargtest>
+  bigwrite();
+      81:	e8 0a 30 00 00       	call   3090 <bigwrite>
+  bigargtest();
+      86:	e8 b5 3e 00 00       	call   3f40 <bigargtest>
+  bsstest();
+      8b:	e8 40 3e 00 00       	call   3ed0 <bsstest>
+  sbrktest();
+      90:	e8 3b 39 00 00       	call   39d0 <sbrktest>
+  validatetest();
+      95:	e8 86 3d 00 00       	call   3e20 <validatetest>
+
+  opentest();
+      9a:	e8 71 03 00 00       	call   410 <opentest>
+  writetest();
+      9f:	e8 fc 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      a4:	e8 d7 05 00 00       	call   680 <writetest1>
+  createtest();
+      a9:	e8 a2 07 00 00       	call   850 <createtest>
+
+  openiputtest();
+      ae:	e8 5d 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      b3:	e8 58 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      b8:	e8 73 00 00 00       	call   130 <iputtest>
+
+  mem();
+      bd:	e8 6e 0f 00 00       	call   1030 <mem>
+  pipe1();
+      c2:	e8 69 09 00 00       	call   a30 <pipe1>
+  pipebig();
+      c7:	e8 04 0b 00 00       	call   bd0 <pipebig>
+  preempt();
+      cc:	e8 7f 0d 00 00       	call   e50 <preempt>
+  exitwait();
+      d1:	e8 da 0e 00 00       	call   fb0 <exitwait>
+
+  rmdot();
+      d6:	e8 a5 33 00 00       	call   3480 <rmdot>
+  fourteen();
+      db:	e8 60 32 00 00       	call   3340 <fourteen>
+  bigfile();
+      e0:	e8 8b 30 00 00       	call   3170 <bigfile>
+  subdir();
+      e5:	e8 c6 28 00 00       	call   29b0 <subdir>
+  linktest();
+      ea:	e8 61 17 00 00       	call   1850 <linktest>
+  symlinktest();
+      ef:	e8 6c 19 00 00       	call   1a60 <symlinktest>
+  inlinetest();
+      f4:	e8 57 1e 00 00       	call   1f50 <inlinetest>
+  unlinkread();
+      f9:	e8 c2 15 00 00       	call   16c0 <unlinkread>
+  dirfile();
+      fe:	e8 fd 34 00 00       	call   3600 <dirfile>
+  iref();
+     103:	e8 f8 36 00 00       	call   3800 <iref>
+  forktest();
+     108:	e8 13 38 00 00       	call   3920 <forktest>
+  bigdir(); // slow
+     10d:	e8 ce 24 00 00       	call   25e0 <bigdir>
+  dirbench(); // slow
+     112:	e8 f9 25 00 00       	call   2710 <dirbench>
+
+  uio();
+     117:	e8 f4 40 00 00       	call   4210 <uio>
+
+  exectest();
+     11c:	e8 bf 08 00 00       	call   9e0 <exectest>
+
+  exit();
+     121:	e8 2d 44 00 00       	call   4553 <exit>
+     126:	66 90                	xchg   %ax,%ax
+     128:	66 90                	xchg   %ax,%ax
+     12a:	66 90                	xchg   %ax,%ax
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 8c 4a 00 00       	push   $0x4a8c
+     13b:	ff 35 a8 6e 00 00    	push   0x6ea8
+     141:	e8 8a 45 00 00       	call   46d0 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 1f 4a 00 00 	movl   $0x4a1f,(%esp)
+     14d:	e8 69 44 00 00       	call   45bb <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 1f 4a 00 00       	push   $0x4a1f
+     161:	e8 5d 44 00 00       	call   45c3 <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 1c 4a 00 00       	push   $0x4a1c
+     179:	e8 25 44 00 00       	call   45a3 <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 41 4a 00 00       	push   $0x4a41
+     18d:	e8 31 44 00 00       	call   45c3 <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 b5 4a 00 00       	push   $0x4ab5
+     1a1:	ff 35 a8 6e 00 00    	push   0x6ea8
+     1a7:	e8 24 45 00 00       	call   46d0 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 f8 49 00 00       	push   $0x49f8
+     1b8:	ff 35 a8 6e 00 00    	push   0x6ea8
+     1be:	e8 0d 45 00 00       	call   46d0 <printf>
+    exit();
+     1c3:	e8 8b 43 00 00       	call   4553 <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 43 4a 00 00       	push   $0x4a43
+     1cf:	ff 35 a8 6e 00 00    	push   0x6ea8
+     1d5:	e8 f6 44 00 00       	call   46d0 <printf>
+    exit();
+     1da:	e8 74 43 00 00       	call   4553 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 27 4a 00 00       	push   $0x4a27
+     1e6:	ff 35 a8 6e 00 00    	push   0x6ea8
+     1ec:	e8 df 44 00 00       	call   46d0 <printf>
+    exit();
+     1f1:	e8 5d 43 00 00       	call   4553 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 06 4a 00 00       	push   $0x4a06
+     1fd:	ff 35 a8 6e 00 00    	push   0x6ea8
+     203:	e8 c8 44 00 00       	call   46d0 <printf>
+    exit();
+     208:	e8 46 43 00 00       	call   4553 <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 53 4a 00 00       	push   $0x4a53
+     21b:	ff 35 a8 6e 00 00    	push   0x6ea8
+     221:	e8 aa 44 00 00       	call   46d0 <printf>
+  pid = fork();
+     226:	e8 20 43 00 00       	call   454b <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 1f 4a 00 00       	push   $0x4a1f
+     240:	e8 76 43 00 00       	call   45bb <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 1f 4a 00 00       	push   $0x4a1f
+     258:	e8 66 43 00 00       	call   45c3 <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 1c 4a 00 00       	push   $0x4a1c
+     270:	e8 2e 43 00 00       	call   45a3 <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 d2 42 00 00       	call   4553 <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 ce 42 00 00       	call   455b <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 76 4a 00 00       	push   $0x4a76
+     295:	ff 35 a8 6e 00 00    	push   0x6ea8
+     29b:	e8 30 44 00 00       	call   46d0 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 27 4a 00 00       	push   $0x4a27
+     2b0:	ff 35 a8 6e 00 00    	push   0x6ea8
+     2b6:	e8 15 44 00 00       	call   46d0 <printf>
+      exit();
+     2bb:	e8 93 42 00 00       	call   4553 <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 80 5b 00 00       	push   $0x5b80
+     2c7:	ff 35 a8 6e 00 00    	push   0x6ea8
+     2cd:	e8 fe 43 00 00       	call   46d0 <printf>
+    exit();
+     2d2:	e8 7c 42 00 00       	call   4553 <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 f8 49 00 00       	push   $0x49f8
+     2de:	ff 35 a8 6e 00 00    	push   0x6ea8
+     2e4:	e8 e7 43 00 00       	call   46d0 <printf>
+      exit();
+     2e9:	e8 65 42 00 00       	call   4553 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 62 4a 00 00       	push   $0x4a62
+     2f5:	ff 35 a8 6e 00 00    	push   0x6ea8
+     2fb:	e8 d0 43 00 00       	call   46d0 <printf>
+      exit();
+     300:	e8 4e 42 00 00       	call   4553 <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 88 4a 00 00       	push   $0x4a88
+     31b:	ff 35 a8 6e 00 00    	push   0x6ea8
+     321:	e8 aa 43 00 00       	call   46d0 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 97 4a 00 00 	movl   $0x4a97,(%esp)
+     32d:	e8 89 42 00 00       	call   45bb <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 09 42 00 00       	call   454b <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 97 4a 00 00       	push   $0x4a97
+     352:	e8 3c 42 00 00       	call   4593 <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 54 5c 00 00       	push   $0x5c54
+     366:	ff 35 a8 6e 00 00    	push   0x6ea8
+     36c:	e8 5f 43 00 00       	call   46d0 <printf>
+      exit();
+     371:	e8 dd 41 00 00       	call   4553 <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 59 42 00 00       	call   45e3 <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 97 4a 00 00 	movl   $0x4a97,(%esp)
+     391:	e8 0d 42 00 00       	call   45a3 <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 b9 41 00 00       	call   455b <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 b1 4a 00 00       	push   $0x4ab1
+     3aa:	ff 35 a8 6e 00 00    	push   0x6ea8
+     3b0:	e8 1b 43 00 00       	call   46d0 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 8e 41 00 00       	call   4553 <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 80 5b 00 00       	push   $0x5b80
+     3cc:	ff 35 a8 6e 00 00    	push   0x6ea8
+     3d2:	e8 f9 42 00 00       	call   46d0 <printf>
+    exit();
+     3d7:	e8 77 41 00 00       	call   4553 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 9d 4a 00 00       	push   $0x4a9d
+     3e3:	ff 35 a8 6e 00 00    	push   0x6ea8
+     3e9:	e8 e2 42 00 00       	call   46d0 <printf>
+    exit();
+     3ee:	e8 60 41 00 00       	call   4553 <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 6d 53 00 00       	push   $0x536d
+     3fa:	ff 35 a8 6e 00 00    	push   0x6ea8
+     400:	e8 cb 42 00 00       	call   46d0 <printf>
+    exit();
+     405:	e8 49 41 00 00       	call   4553 <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 c3 4a 00 00       	push   $0x4ac3
+     41b:	ff 35 a8 6e 00 00    	push   0x6ea8
+     421:	e8 aa 42 00 00       	call   46d0 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 ce 4a 00 00       	push   $0x4ace
+     42f:	e8 5f 41 00 00       	call   4593 <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 37 41 00 00       	call   457b <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 e6 4a 00 00       	push   $0x4ae6
+     44d:	e8 41 41 00 00       	call   4593 <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 11 4b 00 00       	push   $0x4b11
+     461:	ff 35 a8 6e 00 00    	push   0x6ea8
+     467:	e8 64 42 00 00       	call   46d0 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 d3 4a 00 00       	push   $0x4ad3
+     478:	ff 35 a8 6e 00 00    	push   0x6ea8
+     47e:	e8 4d 42 00 00       	call   46d0 <printf>
+    exit();
+     483:	e8 cb 40 00 00       	call   4553 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 f3 4a 00 00       	push   $0x4af3
+     48f:	ff 35 a8 6e 00 00    	push   0x6ea8
+     495:	e8 36 42 00 00       	call   46d0 <printf>
+    exit();
+     49a:	e8 b4 40 00 00       	call   4553 <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 1f 4b 00 00       	push   $0x4b1f
+     4ad:	ff 35 a8 6e 00 00    	push   0x6ea8
+     4b3:	e8 18 42 00 00       	call   46d0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 30 4b 00 00       	push   $0x4b30
+     4c4:	e8 ca 40 00 00       	call   4593 <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 36 4b 00 00       	push   $0x4b36
+     4e0:	ff 35 a8 6e 00 00    	push   0x6ea8
+     4e6:	e8 e5 41 00 00       	call   46d0 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 6d 4b 00 00       	push   $0x4b6d
+     4fa:	56                   	push   %esi
+     4fb:	e8 73 40 00 00       	call   4573 <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 78 4b 00 00       	push   $0x4b78
+     516:	56                   	push   %esi
+     517:	e8 57 40 00 00       	call   4573 <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 83 4b 00 00       	push   $0x4b83
+     538:	ff 35 a8 6e 00 00    	push   0x6ea8
+     53e:	e8 8d 41 00 00       	call   46d0 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 30 40 00 00       	call   457b <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 30 4b 00 00       	push   $0x4b30
+     554:	e8 3a 40 00 00       	call   4593 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 8e 4b 00 00       	push   $0x4b8e
+     56e:	ff 35 a8 6e 00 00    	push   0x6ea8
+     574:	e8 57 41 00 00       	call   46d0 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 e0 95 00 00       	push   $0x95e0
+     586:	53                   	push   %ebx
+     587:	e8 df 3f 00 00       	call   456b <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 c2 4b 00 00       	push   $0x4bc2
+     5a2:	ff 35 a8 6e 00 00    	push   0x6ea8
+     5a8:	e8 23 41 00 00       	call   46d0 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 c6 3f 00 00       	call   457b <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 30 4b 00 00 	movl   $0x4b30,(%esp)
+     5bc:	e8 e2 3f 00 00       	call   45a3 <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 ea 4b 00 00       	push   $0x4bea
+     5d0:	ff 35 a8 6e 00 00    	push   0x6ea8
+     5d6:	e8 f5 40 00 00       	call   46d0 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 78 5c 00 00       	push   $0x5c78
+     5ee:	ff 35 a8 6e 00 00    	push   0x6ea8
+     5f4:	e8 d7 40 00 00       	call   46d0 <printf>
+      exit();
+     5f9:	e8 55 3f 00 00       	call   4553 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 9c 5c 00 00       	push   $0x5c9c
+     607:	ff 35 a8 6e 00 00    	push   0x6ea8
+     60d:	e8 be 40 00 00       	call   46d0 <printf>
+      exit();
+     612:	e8 3c 3f 00 00       	call   4553 <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 a7 4b 00 00       	push   $0x4ba7
+     61e:	ff 35 a8 6e 00 00    	push   0x6ea8
+     624:	e8 a7 40 00 00       	call   46d0 <printf>
+    exit();
+     629:	e8 25 3f 00 00       	call   4553 <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 66 4f 00 00       	push   $0x4f66
+     635:	ff 35 a8 6e 00 00    	push   0x6ea8
+     63b:	e8 90 40 00 00       	call   46d0 <printf>
+    exit();
+     640:	e8 0e 3f 00 00       	call   4553 <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 d5 4b 00 00       	push   $0x4bd5
+     64c:	ff 35 a8 6e 00 00    	push   0x6ea8
+     652:	e8 79 40 00 00       	call   46d0 <printf>
+    exit();
+     657:	e8 f7 3e 00 00       	call   4553 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 51 4b 00 00       	push   $0x4b51
+     663:	ff 35 a8 6e 00 00    	push   0x6ea8
+     669:	e8 62 40 00 00       	call   46d0 <printf>
+    exit();
+     66e:	e8 e0 3e 00 00       	call   4553 <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	68 fe 4b 00 00       	push   $0x4bfe
+     68d:	ff 35 a8 6e 00 00    	push   0x6ea8
+     693:	e8 38 40 00 00       	call   46d0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     698:	58                   	pop    %eax
+     699:	5a                   	pop    %edx
+     69a:	68 02 02 00 00       	push   $0x202
+     69f:	68 78 4c 00 00       	push   $0x4c78
+     6a4:	e8 ea 3e 00 00       	call   4593 <open>
+  if(fd < 0){
+     6a9:	83 c4 10             	add    $0x10,%esp
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	0f 88 61 01 00 00    	js     815 <writetest1+0x195>
+     6b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6b6:	31 db                	xor    %ebx,%ebx
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d e0 95 00 00    	mov    %ebx,0x95e0
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 e0 95 00 00       	push   $0x95e0
+     6d3:	56                   	push   %esi
+     6d4:	e8 9a 3e 00 00       	call   4573 <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 b3 00 00 00    	jne    79a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 8a 40 20 00    	cmp    $0x20408a,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 80 3e 00 00       	call   457b <close>
+  fd = open("big", O_RDONLY);
+     6fb:	5b                   	pop    %ebx
+     6fc:	5e                   	pop    %esi
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 78 4c 00 00       	push   $0x4c78
+     704:	e8 8a 3e 00 00       	call   4593 <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 e8 00 00 00    	js     7fe <writetest1+0x17e>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 1d                	jmp    737 <writetest1+0xb7>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 9f 00 00 00    	jne    7ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     72b:	a1 e0 95 00 00       	mov    0x95e0,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	75 7f                	jne    7b3 <writetest1+0x133>
+    n++;
+     734:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	68 00 02 00 00       	push   $0x200
+     73f:	68 e0 95 00 00       	push   $0x95e0
+     744:	53                   	push   %ebx
+     745:	e8 21 3e 00 00       	call   456b <read>
+    if(i == 0){
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	85 c0                	test   %eax,%eax
+     74f:	75 cf                	jne    720 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     751:	81 fe 89 40 20 00    	cmp    $0x204089,%esi
+     757:	0f 84 86 00 00 00    	je     7e3 <writetest1+0x163>
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	53                   	push   %ebx
+     761:	e8 15 3e 00 00       	call   457b <close>
+  if(unlink("big") < 0){
+     766:	c7 04 24 78 4c 00 00 	movl   $0x4c78,(%esp)
+     76d:	e8 31 3e 00 00       	call   45a3 <unlink>
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	0f 88 af 00 00 00    	js     82c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     77d:	83 ec 08             	sub    $0x8,%esp
+     780:	68 9f 4c 00 00       	push   $0x4c9f
+     785:	ff 35 a8 6e 00 00    	push   0x6ea8
+     78b:	e8 40 3f 00 00       	call   46d0 <printf>
+}
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5d                   	pop    %ebp
+     799:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	53                   	push   %ebx
+     79e:	68 28 4c 00 00       	push   $0x4c28
+     7a3:	ff 35 a8 6e 00 00    	push   0x6ea8
+     7a9:	e8 22 3f 00 00       	call   46d0 <printf>
+      exit();
+     7ae:	e8 a0 3d 00 00       	call   4553 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7b3:	50                   	push   %eax
+     7b4:	56                   	push   %esi
+     7b5:	68 c0 5c 00 00       	push   $0x5cc0
+     7ba:	ff 35 a8 6e 00 00    	push   0x6ea8
+     7c0:	e8 0b 3f 00 00       	call   46d0 <printf>
+      exit();
+     7c5:	e8 89 3d 00 00       	call   4553 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 7c 4c 00 00       	push   $0x4c7c
+     7d3:	ff 35 a8 6e 00 00    	push   0x6ea8
+     7d9:	e8 f2 3e 00 00       	call   46d0 <printf>
+      exit();
+     7de:	e8 70 3d 00 00       	call   4553 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7e3:	52                   	push   %edx
+     7e4:	68 89 40 20 00       	push   $0x204089
+     7e9:	68 5f 4c 00 00       	push   $0x4c5f
+     7ee:	ff 35 a8 6e 00 00    	push   0x6ea8
+     7f4:	e8 d7 3e 00 00       	call   46d0 <printf>
+        exit();
+     7f9:	e8 55 3d 00 00       	call   4553 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7fe:	51                   	push   %ecx
+     7ff:	51                   	push   %ecx
+     800:	68 46 4c 00 00       	push   $0x4c46
+     805:	ff 35 a8 6e 00 00    	push   0x6ea8
+     80b:	e8 c0 3e 00 00       	call   46d0 <printf>
+    exit();
+     810:	e8 3e 3d 00 00       	call   4553 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     815:	50                   	push   %eax
+     816:	50                   	push   %eax
+     817:	68 0e 4c 00 00       	push   $0x4c0e
+     81c:	ff 35 a8 6e 00 00    	push   0x6ea8
+     822:	e8 a9 3e 00 00       	call   46d0 <printf>
+    exit();
+     827:	e8 27 3d 00 00       	call   4553 <exit>
+    printf(stdout, "unlink big failed\n");
+     82c:	50                   	push   %eax
+     82d:	50                   	push   %eax
+     82e:	68 8c 4c 00 00       	push   $0x4c8c
+     833:	ff 35 a8 6e 00 00    	push   0x6ea8
+     839:	e8 92 3e 00 00       	call   46d0 <printf>
+    exit();
+     83e:	e8 10 3d 00 00       	call   4553 <exit>
+     843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000850 <createtest>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+  name[2] = '\0';
+     854:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     859:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     85c:	68 e0 5c 00 00       	push   $0x5ce0
+     861:	ff 35 a8 6e 00 00    	push   0x6ea8
+     867:	e8 64 3e 00 00       	call   46d0 <printf>
+  name[0] = 'a';
+     86c:	c6 05 d0 95 00 00 61 	movb   $0x61,0x95d0
+  name[2] = '\0';
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	c6 05 d2 95 00 00 00 	movb   $0x0,0x95d2
+  for(i = 0; i < 52; i++){
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     880:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     883:	88 1d d1 95 00 00    	mov    %bl,0x95d1
+  for(i = 0; i < 52; i++){
+     889:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     88c:	68 02 02 00 00       	push   $0x202
+     891:	68 d0 95 00 00       	push   $0x95d0
+     896:	e8 f8 3c 00 00       	call   4593 <open>
+    close(fd);
+     89b:	89 04 24             	mov    %eax,(%esp)
+     89e:	e8 d8 3c 00 00       	call   457b <close>
+  for(i = 0; i < 52; i++){
+     8a3:	83 c4 10             	add    $0x10,%esp
+     8a6:	80 fb 64             	cmp    $0x64,%bl
+     8a9:	75 d5                	jne    880 <createtest+0x30>
+  name[0] = 'a';
+     8ab:	c6 05 d0 95 00 00 61 	movb   $0x61,0x95d0
+  name[2] = '\0';
+     8b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8b7:	c6 05 d2 95 00 00 00 	movb   $0x0,0x95d2
+  for(i = 0; i < 52; i++){
+     8be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8c3:	88 1d d1 95 00 00    	mov    %bl,0x95d1
+  for(i = 0; i < 52; i++){
+     8c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8cc:	68 d0 95 00 00       	push   $0x95d0
+     8d1:	e8 cd 3c 00 00       	call   45a3 <unlink>
+  for(i = 0; i < 52; i++){
+     8d6:	83 c4 10             	add    $0x10,%esp
+     8d9:	80 fb 64             	cmp    $0x64,%bl
+     8dc:	75 e2                	jne    8c0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8de:	83 ec 08             	sub    $0x8,%esp
+     8e1:	68 08 5d 00 00       	push   $0x5d08
+     8e6:	ff 35 a8 6e 00 00    	push   0x6ea8
+     8ec:	e8 df 3d 00 00       	call   46d0 <printf>
+}
+     8f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f4:	83 c4 10             	add    $0x10,%esp
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <dirtest>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     906:	68 ad 4c 00 00       	push   $0x4cad
+     90b:	ff 35 a8 6e 00 00    	push   0x6ea8
+     911:	e8 ba 3d 00 00       	call   46d0 <printf>
+  if(mkdir("dir0") < 0){
+     916:	c7 04 24 b9 4c 00 00 	movl   $0x4cb9,(%esp)
+     91d:	e8 99 3c 00 00       	call   45bb <mkdir>
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 58                	js     981 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     929:	83 ec 0c             	sub    $0xc,%esp
+     92c:	68 b9 4c 00 00       	push   $0x4cb9
+     931:	e8 8d 3c 00 00       	call   45c3 <chdir>
+     936:	83 c4 10             	add    $0x10,%esp
+     939:	85 c0                	test   %eax,%eax
+     93b:	0f 88 85 00 00 00    	js     9c6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     941:	83 ec 0c             	sub    $0xc,%esp
+     944:	68 b4 54 00 00       	push   $0x54b4
+     949:	e8 75 3c 00 00       	call   45c3 <chdir>
+     94e:	83 c4 10             	add    $0x10,%esp
+     951:	85 c0                	test   %eax,%eax
+     953:	78 5a                	js     9af <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	68 b9 4c 00 00       	push   $0x4cb9
+     95d:	e8 41 3c 00 00       	call   45a3 <unlink>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	78 2f                	js     998 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	68 f6 4c 00 00       	push   $0x4cf6
+     971:	ff 35 a8 6e 00 00    	push   0x6ea8
+     977:	e8 54 3d 00 00       	call   46d0 <printf>
+}
+     97c:	83 c4 10             	add    $0x10,%esp
+     97f:	c9                   	leave
+     980:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     981:	50                   	push   %eax
+     982:	50                   	push   %eax
+     983:	68 f8 49 00 00       	push   $0x49f8
+     988:	ff 35 a8 6e 00 00    	push   0x6ea8
+     98e:	e8 3d 3d 00 00       	call   46d0 <printf>
+    exit();
+     993:	e8 bb 3b 00 00       	call   4553 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     998:	50                   	push   %eax
+     999:	50                   	push   %eax
+     99a:	68 e2 4c 00 00       	push   $0x4ce2
+     99f:	ff 35 a8 6e 00 00    	push   0x6ea8
+     9a5:	e8 26 3d 00 00       	call   46d0 <printf>
+    exit();
+     9aa:	e8 a4 3b 00 00       	call   4553 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9af:	52                   	push   %edx
+     9b0:	52                   	push   %edx
+     9b1:	68 d1 4c 00 00       	push   $0x4cd1
+     9b6:	ff 35 a8 6e 00 00    	push   0x6ea8
+     9bc:	e8 0f 3d 00 00       	call   46d0 <printf>
+    exit();
+     9c1:	e8 8d 3b 00 00       	call   4553 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9c6:	51                   	push   %ecx
+     9c7:	51                   	push   %ecx
+     9c8:	68 be 4c 00 00       	push   $0x4cbe
+     9cd:	ff 35 a8 6e 00 00    	push   0x6ea8
+     9d3:	e8 f8 3c 00 00       	call   46d0 <printf>
+    exit();
+     9d8:	e8 76 3b 00 00       	call   4553 <exit>
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <exectest>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9e6:	68 05 4d 00 00       	push   $0x4d05
+     9eb:	ff 35 a8 6e 00 00    	push   0x6ea8
+     9f1:	e8 da 3c 00 00       	call   46d0 <printf>
+  if(exec("echo", echoargv) < 0){
+     9f6:	5a                   	pop    %edx
+     9f7:	59                   	pop    %ecx
+     9f8:	68 ac 6e 00 00       	push   $0x6eac
+     9fd:	68 ce 4a 00 00       	push   $0x4ace
+     a02:	e8 84 3b 00 00       	call   458b <exec>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	78 02                	js     a10 <exectest+0x30>
+}
+     a0e:	c9                   	leave
+     a0f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a10:	50                   	push   %eax
+     a11:	50                   	push   %eax
+     a12:	68 10 4d 00 00       	push   $0x4d10
+     a17:	ff 35 a8 6e 00 00    	push   0x6ea8
+     a1d:	e8 ae 3c 00 00       	call   46d0 <printf>
+    exit();
+     a22:	e8 2c 3b 00 00       	call   4553 <exit>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <pipe1>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a38:	53                   	push   %ebx
+     a39:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a3c:	50                   	push   %eax
+     a3d:	e8 21 3b 00 00       	call   4563 <pipe>
+     a42:	83 c4 10             	add    $0x10,%esp
+     a45:	85 c0                	test   %eax,%eax
+     a47:	0f 85 41 01 00 00    	jne    b8e <pipe1+0x15e>
+     a4d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a4f:	e8 f7 3a 00 00       	call   454b <fork>
+  if(pid == 0){
+     a54:	85 c0                	test   %eax,%eax
+     a56:	0f 84 92 00 00 00    	je     aee <pipe1+0xbe>
+  } else if(pid > 0){
+     a5c:	0f 8e 3f 01 00 00    	jle    ba1 <pipe1+0x171>
+    close(fds[1]);
+     a62:	83 ec 0c             	sub    $0xc,%esp
+     a65:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a68:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a6a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a6f:	e8 07 3b 00 00       	call   457b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a74:	83 c4 10             	add    $0x10,%esp
+     a77:	83 ec 04             	sub    $0x4,%esp
+     a7a:	57                   	push   %edi
+     a7b:	68 e0 95 00 00       	push   $0x95e0
+     a80:	ff 75 e0             	push   -0x20(%ebp)
+     a83:	e8 e3 3a 00 00       	call   456b <read>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	89 c1                	mov    %eax,%ecx
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	0f 8e b8 00 00 00    	jle    b4d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a95:	89 f0                	mov    %esi,%eax
+     a97:	32 05 e0 95 00 00    	xor    0x95e0,%al
+     a9d:	0f b6 c0             	movzbl %al,%eax
+     aa0:	85 c0                	test   %eax,%eax
+     aa2:	75 30                	jne    ad4 <pipe1+0xa4>
+     aa4:	83 c6 01             	add    $0x1,%esi
+     aa7:	eb 0f                	jmp    ab8 <pipe1+0x88>
+     aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ab0:	38 90 e0 95 00 00    	cmp    %dl,0x95e0(%eax)
+     ab6:	75 1c                	jne    ad4 <pipe1+0xa4>
+     ab8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     abb:	83 c0 01             	add    $0x1,%eax
+     abe:	39 c1                	cmp    %eax,%ecx
+     ac0:	75 ee                	jne    ab0 <pipe1+0x80>
+      cc = cc * 2;
+     ac2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ac4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ac9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     acb:	89 d6                	mov    %edx,%esi
+     acd:	39 c7                	cmp    %eax,%edi
+     acf:	0f 4f f8             	cmovg  %eax,%edi
+     ad2:	eb a3                	jmp    a77 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ad4:	83 ec 08             	sub    $0x8,%esp
+     ad7:	68 3f 4d 00 00       	push   $0x4d3f
+     adc:	6a 01                	push   $0x1
+     ade:	e8 ed 3b 00 00       	call   46d0 <printf>
+     ae3:	83 c4 10             	add    $0x10,%esp
+}
+     ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5f                   	pop    %edi
+     aec:	5d                   	pop    %ebp
+     aed:	c3                   	ret
+    close(fds[0]);
+     aee:	83 ec 0c             	sub    $0xc,%esp
+     af1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     af4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     af6:	e8 80 3a 00 00       	call   457b <close>
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b00:	31 c0                	xor    %eax,%eax
+     b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b08:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b0b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b0e:	88 90 df 95 00 00    	mov    %dl,0x95df(%eax)
+      for(i = 0; i < 1033; i++)
+     b14:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b19:	75 ed                	jne    b08 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b1b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b1e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b24:	68 09 04 00 00       	push   $0x409
+     b29:	68 e0 95 00 00       	push   $0x95e0
+     b2e:	ff 75 e4             	push   -0x1c(%ebp)
+     b31:	e8 3d 3a 00 00       	call   4573 <write>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b3e:	75 74                	jne    bb4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b40:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b46:	75 b8                	jne    b00 <pipe1+0xd0>
+    exit();
+     b48:	e8 06 3a 00 00       	call   4553 <exit>
+    if(total != 5 * 1033){
+     b4d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b53:	75 26                	jne    b7b <pipe1+0x14b>
+    close(fds[0]);
+     b55:	83 ec 0c             	sub    $0xc,%esp
+     b58:	ff 75 e0             	push   -0x20(%ebp)
+     b5b:	e8 1b 3a 00 00       	call   457b <close>
+    wait();
+     b60:	e8 f6 39 00 00       	call   455b <wait>
+  printf(1, "pipe1 ok\n");
+     b65:	5a                   	pop    %edx
+     b66:	59                   	pop    %ecx
+     b67:	68 64 4d 00 00       	push   $0x4d64
+     b6c:	6a 01                	push   $0x1
+     b6e:	e8 5d 3b 00 00       	call   46d0 <printf>
+     b73:	83 c4 10             	add    $0x10,%esp
+     b76:	e9 6b ff ff ff       	jmp    ae6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b7b:	56                   	push   %esi
+     b7c:	53                   	push   %ebx
+     b7d:	68 4d 4d 00 00       	push   $0x4d4d
+     b82:	6a 01                	push   $0x1
+     b84:	e8 47 3b 00 00       	call   46d0 <printf>
+      exit();
+     b89:	e8 c5 39 00 00       	call   4553 <exit>
+    printf(1, "pipe() failed\n");
+     b8e:	50                   	push   %eax
+     b8f:	50                   	push   %eax
+     b90:	68 22 4d 00 00       	push   $0x4d22
+     b95:	6a 01                	push   $0x1
+     b97:	e8 34 3b 00 00       	call   46d0 <printf>
+    exit();
+     b9c:	e8 b2 39 00 00       	call   4553 <exit>
+    printf(1, "fork() failed\n");
+     ba1:	50                   	push   %eax
+     ba2:	50                   	push   %eax
+     ba3:	68 6e 4d 00 00       	push   $0x4d6e
+     ba8:	6a 01                	push   $0x1
+     baa:	e8 21 3b 00 00       	call   46d0 <printf>
+    exit();
+     baf:	e8 9f 39 00 00       	call   4553 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bb4:	57                   	push   %edi
+     bb5:	57                   	push   %edi
+     bb6:	68 31 4d 00 00       	push   $0x4d31
+     bbb:	6a 01                	push   $0x1
+     bbd:	e8 0e 3b 00 00       	call   46d0 <printf>
+        exit();
+     bc2:	e8 8c 39 00 00       	call   4553 <exit>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <pipebig>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "pipebig test\n");
+     bd9:	68 7d 4d 00 00       	push   $0x4d7d
+     bde:	6a 01                	push   $0x1
+     be0:	e8 eb 3a 00 00       	call   46d0 <printf>
+  if(pipe(fds) != 0){
+     be5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     be8:	89 04 24             	mov    %eax,(%esp)
+     beb:	e8 73 39 00 00       	call   4563 <pipe>
+     bf0:	83 c4 10             	add    $0x10,%esp
+     bf3:	85 c0                	test   %eax,%eax
+     bf5:	0f 85 12 02 00 00    	jne    e0d <pipebig+0x23d>
+  if(pipesize(fds[1], 65536) != 65536 || pipesize(fds[0], 1) != 512 ||
+     bfb:	83 ec 08             	sub    $0x8,%esp
+     bfe:	89 c3                	mov    %eax,%ebx
+     c00:	68 00 00 01 00       	push   $0x10000
+     c05:	ff 75 e4             	push   -0x1c(%ebp)
+     c08:	e8 fe 39 00 00       	call   460b <pipesize>
+     c0d:	83 c4 10             	add    $0x10,%esp
+     c10:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     c15:	0f 85 de 01 00 00    	jne    df9 <pipebig+0x229>
+     c1b:	83 ec 08             	sub    $0x8,%esp
+     c1e:	6a 01                	push   $0x1
+     c20:	ff 75 e0             	push   -0x20(%ebp)
+     c23:	e8 e3 39 00 00       	call   460b <pipesize>
+     c28:	83 c4 10             	add    $0x10,%esp
+     c2b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c30:	0f 85 c3 01 00 00    	jne    df9 <pipebig+0x229>
+     pipesize(fds[0], 60000) != 65536){
+     c36:	83 ec 08             	sub    $0x8,%esp
+     c39:	68 60 ea 00 00       	push   $0xea60
+     c3e:	ff 75 e0             	push   -0x20(%ebp)
+     c41:	e8 c5 39 00 00       	call   460b <pipesize>
+  if(pipesize(fds[1], 65536) != 65536 || pipesize(fds[0], 1) != 512 ||
+     c46:	83 c4 10             	add    $0x10,%esp
+     c49:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     c4e:	0f 85 a5 01 00 00    	jne    df9 <pipebig+0x229>
+  p = sbrk(17*4096);
+     c54:	83 ec 0c             	sub    $0xc,%esp
+     c57:	68 00 10 01 00       	push   $0x11000
+     c5c:	e8 7a 39 00 00       	call   45db <sbrk>
+  p = (char*)(((uint)p + 4095) & ~4095);
+     c61:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+     c67:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+     c6d:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  t0 = uptime();
+     c70:	e8 76 39 00 00       	call   45eb <uptime>
+     c75:	89 c7                	mov    %eax,%edi
+  pid = fork();
+     c77:	e8 cf 38 00 00       	call   454b <fork>
+  if(pid == 0){
+     c7c:	83 c4 10             	add    $0x10,%esp
+     c7f:	85 c0                	test   %eax,%eax
+     c81:	0f 84 cc 00 00 00    	je     d53 <pipebig+0x183>
+  } else if(pid < 0){
+     c87:	0f 88 93 01 00 00    	js     e20 <pipebig+0x250>
+  close(fds[1]);
+     c8d:	83 ec 0c             	sub    $0xc,%esp
+     c90:	ff 75 e4             	push   -0x1c(%ebp)
+     c93:	e8 e3 38 00 00       	call   457b <close>
+  while((n = read(fds[0], rbuf, 16*4096)) > 0){
+     c98:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     c9b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+     c9e:	83 c4 10             	add    $0x10,%esp
+     ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ca8:	83 ec 04             	sub    $0x4,%esp
+     cab:	68 00 00 01 00       	push   $0x10000
+     cb0:	57                   	push   %edi
+     cb1:	ff 75 e0             	push   -0x20(%ebp)
+     cb4:	e8 b2 38 00 00       	call   456b <read>
+     cb9:	83 c4 10             	add    $0x10,%esp
+     cbc:	85 c0                	test   %eax,%eax
+     cbe:	7e 42                	jle    d02 <pipebig+0x132>
+      if((rbuf[j] & 0xff) != ((i + j) / 4096 & 0xff)){
+     cc0:	89 da                	mov    %ebx,%edx
+     cc2:	c1 fa 0c             	sar    $0xc,%edx
+     cc5:	38 17                	cmp    %dl,(%edi)
+     cc7:	75 24                	jne    ced <pipebig+0x11d>
+     cc9:	89 fe                	mov    %edi,%esi
+     ccb:	8d 53 01             	lea    0x1(%ebx),%edx
+     cce:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+     cd1:	29 de                	sub    %ebx,%esi
+     cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cd7:	90                   	nop
+     cd8:	89 d3                	mov    %edx,%ebx
+    for(j = 0; j < n; j++){
+     cda:	39 ca                	cmp    %ecx,%edx
+     cdc:	74 ca                	je     ca8 <pipebig+0xd8>
+      if((rbuf[j] & 0xff) != ((i + j) / 4096 & 0xff)){
+     cde:	89 d0                	mov    %edx,%eax
+     ce0:	c1 f8 0c             	sar    $0xc,%eax
+     ce3:	32 04 16             	xor    (%esi,%edx,1),%al
+     ce6:	83 c2 01             	add    $0x1,%edx
+     ce9:	84 c0                	test   %al,%al
+     ceb:	74 eb                	je     cd8 <pipebig+0x108>
+        printf(1, "pipebig oops at %d\n", i + j);
+     ced:	83 ec 04             	sub    $0x4,%esp
+     cf0:	53                   	push   %ebx
+     cf1:	68 b2 4d 00 00       	push   $0x4db2
+     cf6:	6a 01                	push   $0x1
+     cf8:	e8 d3 39 00 00       	call   46d0 <printf>
+        exit();
+     cfd:	e8 51 38 00 00       	call   4553 <exit>
+  close(fds[0]);
+     d02:	83 ec 0c             	sub    $0xc,%esp
+     d05:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     d08:	ff 75 e0             	push   -0x20(%ebp)
+     d0b:	e8 6b 38 00 00       	call   457b <close>
+  wait();
+     d10:	e8 46 38 00 00       	call   455b <wait>
+  if(i != 1024*4096){
+     d15:	83 c4 10             	add    $0x10,%esp
+     d18:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+     d1e:	0f 85 0f 01 00 00    	jne    e33 <pipebig+0x263>
+  sbrk(-17*4096);
+     d24:	83 ec 0c             	sub    $0xc,%esp
+     d27:	68 00 f0 fe ff       	push   $0xfffef000
+     d2c:	e8 aa 38 00 00       	call   45db <sbrk>
+  printf(1, "pipebig ok, 4MB in %d ticks\n", uptime() - t0);
+     d31:	e8 b5 38 00 00       	call   45eb <uptime>
+     d36:	83 c4 0c             	add    $0xc,%esp
+     d39:	29 f8                	sub    %edi,%eax
+     d3b:	50                   	push   %eax
+     d3c:	68 d8 4d 00 00       	push   $0x4dd8
+     d41:	6a 01                	push   $0x1
+     d43:	e8 88 39 00 00       	call   46d0 <printf>
+}
+     d48:	83 c4 10             	add    $0x10,%esp
+     d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d4e:	5b                   	pop    %ebx
+     d4f:	5e                   	pop    %esi
+     d50:	5f                   	pop    %edi
+     d51:	5d                   	pop    %ebp
+     d52:	c3                   	ret
+    close(fds[0]);
+     d53:	83 ec 0c             	sub    $0xc,%esp
+     d56:	ff 75 e0             	push   -0x20(%ebp)
+     d59:	e8 1d 38 00 00       	call   457b <close>
+    for(i = 0; i < 256; i++){
+     d5e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    close(fds[0]);
+     d61:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     d68:	83 c4 10             	add    $0x10,%esp
+     d6b:	8d 98 00 40 00 00    	lea    0x4000(%eax),%ebx
+     d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+{
+     d78:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     d7b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+        memset(wbuf + j*4096, i*4 + j, 4096);
+     d7e:	83 ec 04             	sub    $0x4,%esp
+     d81:	68 00 10 00 00       	push   $0x1000
+     d86:	56                   	push   %esi
+      for(j = 0; j < 4; j++)
+     d87:	83 c6 01             	add    $0x1,%esi
+        memset(wbuf + j*4096, i*4 + j, 4096);
+     d8a:	57                   	push   %edi
+      for(j = 0; j < 4; j++)
+     d8b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+        memset(wbuf + j*4096, i*4 + j, 4096);
+     d91:	e8 3a 36 00 00       	call   43d0 <memset>
+      for(j = 0; j < 4; j++)
+     d96:	83 c4 10             	add    $0x10,%esp
+     d99:	39 df                	cmp    %ebx,%edi
+     d9b:	75 e1                	jne    d7e <pipebig+0x1ae>
+      if(write(fds[1], wbuf, 4*4096) != 4*4096){
+     d9d:	83 ec 04             	sub    $0x4,%esp
+     da0:	68 00 40 00 00       	push   $0x4000
+     da5:	ff 75 d0             	push   -0x30(%ebp)
+     da8:	ff 75 e4             	push   -0x1c(%ebp)
+     dab:	e8 c3 37 00 00       	call   4573 <write>
+     db0:	83 c4 10             	add    $0x10,%esp
+     db3:	3d 00 40 00 00       	cmp    $0x4000,%eax
+     db8:	75 2b                	jne    de5 <pipebig+0x215>
+      memset(wbuf, 0xff, 4*4096);
+     dba:	83 ec 04             	sub    $0x4,%esp
+     dbd:	68 00 40 00 00       	push   $0x4000
+     dc2:	68 ff 00 00 00       	push   $0xff
+     dc7:	ff 75 d0             	push   -0x30(%ebp)
+     dca:	e8 01 36 00 00       	call   43d0 <memset>
+    for(i = 0; i < 256; i++){
+     dcf:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+     dd3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     dd6:	83 c4 10             	add    $0x10,%esp
+     dd9:	3d 00 04 00 00       	cmp    $0x400,%eax
+     dde:	75 98                	jne    d78 <pipebig+0x1a8>
+    exit();
+     de0:	e8 6e 37 00 00       	call   4553 <exit>
+        printf(1, "pipebig write failed\n");
+     de5:	83 ec 08             	sub    $0x8,%esp
+     de8:	68 9c 4d 00 00       	push   $0x4d9c
+     ded:	6a 01                	push   $0x1
+     def:	e8 dc 38 00 00       	call   46d0 <printf>
+        exit();
+     df4:	e8 5a 37 00 00       	call   4553 <exit>
+    printf(1, "pipesize failed\n");
+     df9:	83 ec 08             	sub    $0x8,%esp
+     dfc:	68 8b 4d 00 00       	push   $0x4d8b
+     e01:	6a 01                	push   $0x1
+     e03:	e8 c8 38 00 00       	call   46d0 <printf>
+    exit();
+     e08:	e8 46 37 00 00       	call   4553 <exit>
+    printf(1, "pipe() failed\n");
+     e0d:	51                   	push   %ecx
+     e0e:	51                   	push   %ecx
+     e0f:	68 22 4d 00 00       	push   $0x4d22
+     e14:	6a 01                	push   $0x1
+     e16:	e8 b5 38 00 00       	call   46d0 <printf>
+    exit();
+     e1b:	e8 33 37 00 00       	call   4553 <exit>
+    printf(1, "fork() failed\n");
+     e20:	52                   	push   %edx
+     e21:	52                   	push   %edx
+     e22:	68 6e 4d 00 00       	push   $0x4d6e
+     e27:	6a 01                	push   $0x1
+     e29:	e8 a2 38 00 00       	call   46d0 <printf>
+    exit();
+     e2e:	e8 20 37 00 00       	call   4553 <exit>
+    printf(1, "pipebig total %d\n", i);
+     e33:	50                   	push   %eax
+     e34:	53                   	push   %ebx
+     e35:	68 c6 4d 00 00       	push   $0x4dc6
+     e3a:	6a 01                	push   $0x1
+     e3c:	e8 8f 38 00 00       	call   46d0 <printf>
+    exit();
+     e41:	e8 0d 37 00 00       	call   4553 <exit>
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e50 <preempt>:
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	57                   	push   %edi
+     e54:	56                   	push   %esi
+     e55:	53                   	push   %ebx
+     e56:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     e59:	68 f5 4d 00 00       	push   $0x4df5
+     e5e:	6a 01                	push   $0x1
+     e60:	e8 6b 38 00 00       	call   46d0 <printf>
+  pid1 = fork();
+     e65:	e8 e1 36 00 00       	call   454b <fork>
+  if(pid1 == 0)
+     e6a:	83 c4 10             	add    $0x10,%esp
+     e6d:	85 c0                	test   %eax,%eax
+     e6f:	75 07                	jne    e78 <preempt+0x28>
+    for(;;)
+     e71:	eb fe                	jmp    e71 <preempt+0x21>
+     e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e77:	90                   	nop
+     e78:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     e7a:	e8 cc 36 00 00       	call   454b <fork>
+     e7f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     e81:	85 c0                	test   %eax,%eax
+     e83:	75 0b                	jne    e90 <preempt+0x40>
+    for(;;)
+     e85:	eb fe                	jmp    e85 <preempt+0x35>
+     e87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e96:	50                   	push   %eax
+     e97:	e8 c7 36 00 00       	call   4563 <pipe>
+  pid3 = fork();
+     e9c:	e8 aa 36 00 00       	call   454b <fork>
+  if(pid3 == 0){
+     ea1:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     ea4:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     ea6:	85 c0                	test   %eax,%eax
+     ea8:	75 3e                	jne    ee8 <preempt+0x98>
+    close(pfds[0]);
+     eaa:	83 ec 0c             	sub    $0xc,%esp
+     ead:	ff 75 e0             	push   -0x20(%ebp)
+     eb0:	e8 c6 36 00 00       	call   457b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     eb5:	83 c4 0c             	add    $0xc,%esp
+     eb8:	6a 01                	push   $0x1
+     eba:	68 98 55 00 00       	push   $0x5598
+     ebf:	ff 75 e4             	push   -0x1c(%ebp)
+     ec2:	e8 ac 36 00 00       	call   4573 <write>
+     ec7:	83 c4 10             	add    $0x10,%esp
+     eca:	83 f8 01             	cmp    $0x1,%eax
+     ecd:	0f 85 b8 00 00 00    	jne    f8b <preempt+0x13b>
+    close(pfds[1]);
+     ed3:	83 ec 0c             	sub    $0xc,%esp
+     ed6:	ff 75 e4             	push   -0x1c(%ebp)
+     ed9:	e8 9d 36 00 00       	call   457b <close>
+     ede:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ee1:	eb fe                	jmp    ee1 <preempt+0x91>
+     ee3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ee7:	90                   	nop
+  close(pfds[1]);
+     ee8:	83 ec 0c             	sub    $0xc,%esp
+     eeb:	ff 75 e4             	push   -0x1c(%ebp)
+     eee:	e8 88 36 00 00       	call   457b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ef3:	83 c4 0c             	add    $0xc,%esp
+     ef6:	68 00 20 00 00       	push   $0x2000
+     efb:	68 e0 95 00 00       	push   $0x95e0
+     f00:	ff 75 e0             	push   -0x20(%ebp)
+     f03:	e8 63 36 00 00       	call   456b <read>
+     f08:	83 c4 10             	add    $0x10,%esp
+     f0b:	83 f8 01             	cmp    $0x1,%eax
+     f0e:	75 67                	jne    f77 <preempt+0x127>
+  close(pfds[0]);
+     f10:	83 ec 0c             	sub    $0xc,%esp
+     f13:	ff 75 e0             	push   -0x20(%ebp)
+     f16:	e8 60 36 00 00       	call   457b <close>
+  printf(1, "kill... ");
+     f1b:	58                   	pop    %eax
+     f1c:	5a                   	pop    %edx
+     f1d:	68 26 4e 00 00       	push   $0x4e26
+     f22:	6a 01                	push   $0x1
+     f24:	e8 a7 37 00 00       	call   46d0 <printf>
+  kill(pid1);
+     f29:	89 1c 24             	mov    %ebx,(%esp)
+     f2c:	e8 52 36 00 00       	call   4583 <kill>
+  kill(pid2);
+     f31:	89 34 24             	mov    %esi,(%esp)
+     f34:	e8 4a 36 00 00       	call   4583 <kill>
+  kill(pid3);
+     f39:	89 3c 24             	mov    %edi,(%esp)
+     f3c:	e8 42 36 00 00       	call   4583 <kill>
+  printf(1, "wait... ");
+     f41:	59                   	pop    %ecx
+     f42:	5b                   	pop    %ebx
+     f43:	68 2f 4e 00 00       	push   $0x4e2f
+     f48:	6a 01                	push   $0x1
+     f4a:	e8 81 37 00 00       	call   46d0 <printf>
+  wait();
+     f4f:	e8 07 36 00 00       	call   455b <wait>
+  wait();
+     f54:	e8 02 36 00 00       	call   455b <wait>
+  wait();
+     f59:	e8 fd 35 00 00       	call   455b <wait>
+  printf(1, "preempt ok\n");
+     f5e:	5e                   	pop    %esi
+     f5f:	5f                   	pop    %edi
+     f60:	68 38 4e 00 00       	push   $0x4e38
+     f65:	6a 01                	push   $0x1
+     f67:	e8 64 37 00 00       	call   46d0 <printf>
+     f6c:	83 c4 10             	add    $0x10,%esp
+}
+     f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f72:	5b                   	pop    %ebx
+     f73:	5e                   	pop    %esi
+     f74:	5f                   	pop    %edi
+     f75:	5d                   	pop    %ebp
+     f76:	c3                   	ret
+    printf(1, "preempt read error");
+     f77:	83 ec 08             	sub    $0x8,%esp
+     f7a:	68 13 4e 00 00       	push   $0x4e13
+     f7f:	6a 01                	push   $0x1
+     f81:	e8 4a 37 00 00       	call   46d0 <printf>
+     f86:	83 c4 10             	add    $0x10,%esp
+     f89:	eb e4                	jmp    f6f <preempt+0x11f>
+      printf(1, "preempt write error");
+     f8b:	83 ec 08             	sub    $0x8,%esp
+     f8e:	68 ff 4d 00 00       	push   $0x4dff
+     f93:	6a 01                	push   $0x1
+     f95:	e8 36 37 00 00       	call   46d0 <printf>
+     f9a:	83 c4 10             	add    $0x10,%esp
+     f9d:	e9 31 ff ff ff       	jmp    ed3 <preempt+0x83>
+     fa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fb0 <exitwait>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	56                   	push   %esi
+     fb4:	be 64 00 00 00       	mov    $0x64,%esi
+     fb9:	53                   	push   %ebx
+     fba:	eb 14                	jmp    fd0 <exitwait+0x20>
+     fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     fc0:	74 68                	je     102a <exitwait+0x7a>
+      if(wait() != pid){
+     fc2:	e8 94 35 00 00       	call   455b <wait>
+     fc7:	39 d8                	cmp    %ebx,%eax
+     fc9:	75 2d                	jne    ff8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     fcb:	83 ee 01             	sub    $0x1,%esi
+     fce:	74 41                	je     1011 <exitwait+0x61>
+    pid = fork();
+     fd0:	e8 76 35 00 00       	call   454b <fork>
+     fd5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     fd7:	85 c0                	test   %eax,%eax
+     fd9:	79 e5                	jns    fc0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     fdb:	83 ec 08             	sub    $0x8,%esp
+     fde:	68 80 5b 00 00       	push   $0x5b80
+     fe3:	6a 01                	push   $0x1
+     fe5:	e8 e6 36 00 00       	call   46d0 <printf>
+      return;
+     fea:	83 c4 10             	add    $0x10,%esp
+}
+     fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ff0:	5b                   	pop    %ebx
+     ff1:	5e                   	pop    %esi
+     ff2:	5d                   	pop    %ebp
+     ff3:	c3                   	ret
+     ff4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     ff8:	83 ec 08             	sub    $0x8,%esp
+     ffb:	68 44 4e 00 00       	push   $0x4e44
+    1000:	6a 01                	push   $0x1
+    1002:	e8 c9 36 00 00       	call   46d0 <printf>
+        return;
+    1007:	83 c4 10             	add    $0x10,%esp
+}
+    100a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    100d:	5b                   	pop    %ebx
+    100e:	5e                   	pop    %esi
+    100f:	5d                   	pop    %ebp
+    1010:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1011:	83 ec 08             	sub    $0x8,%esp
+    1014:	68 54 4e 00 00       	push   $0x4e54
+    1019:	6a 01                	push   $0x1
+    101b:	e8 b0 36 00 00       	call   46d0 <printf>
+    1020:	83 c4 10             	add    $0x10,%esp
+}
+    1023:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1026:	5b                   	pop    %ebx
+    1027:	5e                   	pop    %esi
+    1028:	5d                   	pop    %ebp
+    1029:	c3                   	ret
+      exit();
+    102a:	e8 24 35 00 00       	call   4553 <exit>
+    102f:	90                   	nop
+
+00001030 <mem>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	56                   	push   %esi
+    1034:	31 f6                	xor    %esi,%esi
+    1036:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1037:	83 ec 08             	sub    $0x8,%esp
+    103a:	68 61 4e 00 00       	push   $0x4e61
+    103f:	6a 01                	push   $0x1
+    1041:	e8 8a 36 00 00       	call   46d0 <printf>
+  ppid = getpid();
+    1046:	e8 88 35 00 00       	call   45d3 <getpid>
+    104b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    104d:	e8 f9 34 00 00       	call   454b <fork>
+    1052:	83 c4 10             	add    $0x10,%esp
+    1055:	85 c0                	test   %eax,%eax
+    1057:	74 0b                	je     1064 <mem+0x34>
+    1059:	e9 8a 00 00 00       	jmp    10e8 <mem+0xb8>
+    105e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1060:	89 30                	mov    %esi,(%eax)
+    1062:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1064:	83 ec 0c             	sub    $0xc,%esp
+    1067:	68 11 27 00 00       	push   $0x2711
+    106c:	e8 9f 38 00 00       	call   4910 <malloc>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	85 c0                	test   %eax,%eax
+    1076:	75 e8                	jne    1060 <mem+0x30>
+    while(m1){
+    1078:	85 f6                	test   %esi,%esi
+    107a:	74 18                	je     1094 <mem+0x64>
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1080:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1082:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1085:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1087:	50                   	push   %eax
+    1088:	e8 f3 37 00 00       	call   4880 <free>
+    while(m1){
+    108d:	83 c4 10             	add    $0x10,%esp
+    1090:	85 f6                	test   %esi,%esi
+    1092:	75 ec                	jne    1080 <mem+0x50>
+    m1 = malloc(1024*20);
+    1094:	83 ec 0c             	sub    $0xc,%esp
+    1097:	68 00 50 00 00       	push   $0x5000
+    109c:	e8 6f 38 00 00       	call   4910 <malloc>
+    if(m1 == 0){
+    10a1:	83 c4 10             	add    $0x10,%esp
+    10a4:	85 c0                	test   %eax,%eax
+    10a6:	74 20                	je     10c8 <mem+0x98>
+    free(m1);
+    10a8:	83 ec 0c             	sub    $0xc,%esp
+    10ab:	50                   	push   %eax
+    10ac:	e8 cf 37 00 00       	call   4880 <free>
+    printf(1, "mem ok\n");
+    10b1:	58                   	pop    %eax
+    10b2:	5a                   	pop    %edx
+    10b3:	68 85 4e 00 00       	push   $0x4e85
+    10b8:	6a 01                	push   $0x1
+    10ba:	e8 11 36 00 00       	call   46d0 <printf>
+    exit();
+    10bf:	e8 8f 34 00 00       	call   4553 <exit>
+    10c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    10c8:	83 ec 08             	sub    $0x8,%esp
+    10cb:	68 6b 4e 00 00       	push   $0x4e6b
+    10d0:	6a 01                	push   $0x1
+    10d2:	e8 f9 35 00 00       	call   46d0 <printf>
+      kill(ppid);
+    10d7:	89 1c 24             	mov    %ebx,(%esp)
+    10da:	e8 a4 34 00 00       	call   4583 <kill>
+      exit();
+    10df:	e8 6f 34 00 00       	call   4553 <exit>
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    10e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10eb:	5b                   	pop    %ebx
+    10ec:	5e                   	pop    %esi
+    10ed:	5d                   	pop    %ebp
+    wait();
+    10ee:	e9 68 34 00 00       	jmp    455b <wait>
+    10f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001100 <sharedfd>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1109:	68 8d 4e 00 00       	push   $0x4e8d
+    110e:	6a 01                	push   $0x1
+    1110:	e8 bb 35 00 00       	call   46d0 <printf>
+  unlink("sharedfd");
+    1115:	c7 04 24 9c 4e 00 00 	movl   $0x4e9c,(%esp)
+    111c:	e8 82 34 00 00       	call   45a3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1121:	5b                   	pop    %ebx
+    1122:	5e                   	pop    %esi
+    1123:	68 02 02 00 00       	push   $0x202
+    1128:	68 9c 4e 00 00       	push   $0x4e9c
+    112d:	e8 61 34 00 00       	call   4593 <open>
+  if(fd < 0){
+    1132:	83 c4 10             	add    $0x10,%esp
+    1135:	85 c0                	test   %eax,%eax
+    1137:	0f 88 2a 01 00 00    	js     1267 <sharedfd+0x167>
+    113d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    113f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1142:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1147:	e8 ff 33 00 00       	call   454b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    114c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    114f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1152:	19 c0                	sbb    %eax,%eax
+    1154:	83 ec 04             	sub    $0x4,%esp
+    1157:	83 e0 f3             	and    $0xfffffff3,%eax
+    115a:	6a 0a                	push   $0xa
+    115c:	83 c0 70             	add    $0x70,%eax
+    115f:	50                   	push   %eax
+    1160:	56                   	push   %esi
+    1161:	e8 6a 32 00 00       	call   43d0 <memset>
+    1166:	83 c4 10             	add    $0x10,%esp
+    1169:	eb 0a                	jmp    1175 <sharedfd+0x75>
+    116b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1170:	83 eb 01             	sub    $0x1,%ebx
+    1173:	74 26                	je     119b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1175:	83 ec 04             	sub    $0x4,%esp
+    1178:	6a 0a                	push   $0xa
+    117a:	56                   	push   %esi
+    117b:	57                   	push   %edi
+    117c:	e8 f2 33 00 00       	call   4573 <write>
+    1181:	83 c4 10             	add    $0x10,%esp
+    1184:	83 f8 0a             	cmp    $0xa,%eax
+    1187:	74 e7                	je     1170 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1189:	83 ec 08             	sub    $0x8,%esp
+    118c:	68 5c 5d 00 00       	push   $0x5d5c
+    1191:	6a 01                	push   $0x1
+    1193:	e8 38 35 00 00       	call   46d0 <printf>
+      break;
+    1198:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    119b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    119e:	85 c9                	test   %ecx,%ecx
+    11a0:	0f 84 f5 00 00 00    	je     129b <sharedfd+0x19b>
+    wait();
+    11a6:	e8 b0 33 00 00       	call   455b <wait>
+  close(fd);
+    11ab:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    11ae:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    11b0:	57                   	push   %edi
+    11b1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    11b4:	e8 c2 33 00 00       	call   457b <close>
+  fd = open("sharedfd", 0);
+    11b9:	58                   	pop    %eax
+    11ba:	5a                   	pop    %edx
+    11bb:	6a 00                	push   $0x0
+    11bd:	68 9c 4e 00 00       	push   $0x4e9c
+    11c2:	e8 cc 33 00 00       	call   4593 <open>
+  if(fd < 0){
+    11c7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    11ca:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    11cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    11cf:	85 c0                	test   %eax,%eax
+    11d1:	0f 88 aa 00 00 00    	js     1281 <sharedfd+0x181>
+    11d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11de:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    11e0:	83 ec 04             	sub    $0x4,%esp
+    11e3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    11e6:	6a 0a                	push   $0xa
+    11e8:	56                   	push   %esi
+    11e9:	ff 75 d0             	push   -0x30(%ebp)
+    11ec:	e8 7a 33 00 00       	call   456b <read>
+    11f1:	83 c4 10             	add    $0x10,%esp
+    11f4:	85 c0                	test   %eax,%eax
+    11f6:	7e 28                	jle    1220 <sharedfd+0x120>
+    11f8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    11fb:	89 f0                	mov    %esi,%eax
+    11fd:	eb 13                	jmp    1212 <sharedfd+0x112>
+    11ff:	90                   	nop
+        np++;
+    1200:	80 f9 70             	cmp    $0x70,%cl
+    1203:	0f 94 c1             	sete   %cl
+    1206:	0f b6 c9             	movzbl %cl,%ecx
+    1209:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    120b:	83 c0 01             	add    $0x1,%eax
+    120e:	39 f8                	cmp    %edi,%eax
+    1210:	74 ce                	je     11e0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1212:	0f b6 08             	movzbl (%eax),%ecx
+    1215:	80 f9 63             	cmp    $0x63,%cl
+    1218:	75 e6                	jne    1200 <sharedfd+0x100>
+        nc++;
+    121a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    121d:	eb ec                	jmp    120b <sharedfd+0x10b>
+    121f:	90                   	nop
+  close(fd);
+    1220:	83 ec 0c             	sub    $0xc,%esp
+    1223:	ff 75 d0             	push   -0x30(%ebp)
+    1226:	e8 50 33 00 00       	call   457b <close>
+  unlink("sharedfd");
+    122b:	c7 04 24 9c 4e 00 00 	movl   $0x4e9c,(%esp)
+    1232:	e8 6c 33 00 00       	call   45a3 <unlink>
+  if(nc == 10000 && np == 10000){
+    1237:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    123a:	83 c4 10             	add    $0x10,%esp
+    123d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1243:	75 5b                	jne    12a0 <sharedfd+0x1a0>
+    1245:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    124b:	75 53                	jne    12a0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    124d:	83 ec 08             	sub    $0x8,%esp
+    1250:	68 a5 4e 00 00       	push   $0x4ea5
+    1255:	6a 01                	push   $0x1
+    1257:	e8 74 34 00 00       	call   46d0 <printf>
+    125c:	83 c4 10             	add    $0x10,%esp
+}
+    125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1262:	5b                   	pop    %ebx
+    1263:	5e                   	pop    %esi
+    1264:	5f                   	pop    %edi
+    1265:	5d                   	pop    %ebp
+    1266:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1267:	83 ec 08             	sub    $0x8,%esp
+    126a:	68 30 5d 00 00       	push   $0x5d30
+    126f:	6a 01                	push   $0x1
+    1271:	e8 5a 34 00 00       	call   46d0 <printf>
+    return;
+    1276:	83 c4 10             	add    $0x10,%esp
+}
+    1279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    127c:	5b                   	pop    %ebx
+    127d:	5e                   	pop    %esi
+    127e:	5f                   	pop    %edi
+    127f:	5d                   	pop    %ebp
+    1280:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1281:	83 ec 08             	sub    $0x8,%esp
+    1284:	68 7c 5d 00 00       	push   $0x5d7c
+    1289:	6a 01                	push   $0x1
+    128b:	e8 40 34 00 00       	call   46d0 <printf>
+    return;
+    1290:	83 c4 10             	add    $0x10,%esp
+}
+    1293:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1296:	5b                   	pop    %ebx
+    1297:	5e                   	pop    %esi
+    1298:	5f                   	pop    %edi
+    1299:	5d                   	pop    %ebp
+    129a:	c3                   	ret
+    exit();
+    129b:	e8 b3 32 00 00       	call   4553 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    12a0:	53                   	push   %ebx
+    12a1:	52                   	push   %edx
+    12a2:	68 b2 4e 00 00       	push   $0x4eb2
+    12a7:	6a 01                	push   $0x1
+    12a9:	e8 22 34 00 00       	call   46d0 <printf>
+    exit();
+    12ae:	e8 a0 32 00 00       	call   4553 <exit>
+    12b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000012c0 <fourfiles>:
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+    12c5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    12c6:	31 db                	xor    %ebx,%ebx
+{
+    12c8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    12cb:	c7 45 d8 c7 4e 00 00 	movl   $0x4ec7,-0x28(%ebp)
+    12d2:	c7 45 dc 06 50 00 00 	movl   $0x5006,-0x24(%ebp)
+    12d9:	c7 45 e0 0a 50 00 00 	movl   $0x500a,-0x20(%ebp)
+    12e0:	c7 45 e4 ca 4e 00 00 	movl   $0x4eca,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    12e7:	68 cd 4e 00 00       	push   $0x4ecd
+    12ec:	6a 01                	push   $0x1
+    12ee:	e8 dd 33 00 00       	call   46d0 <printf>
+    12f3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    12f6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    12fa:	83 ec 0c             	sub    $0xc,%esp
+    12fd:	56                   	push   %esi
+    12fe:	e8 a0 32 00 00       	call   45a3 <unlink>
+    pid = fork();
+    1303:	e8 43 32 00 00       	call   454b <fork>
+    if(pid < 0){
+    1308:	83 c4 10             	add    $0x10,%esp
+    130b:	85 c0                	test   %eax,%eax
+    130d:	0f 88 65 01 00 00    	js     1478 <fourfiles+0x1b8>
+    if(pid == 0){
+    1313:	0f 84 eb 00 00 00    	je     1404 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1319:	83 c3 01             	add    $0x1,%ebx
+    131c:	83 fb 04             	cmp    $0x4,%ebx
+    131f:	75 d5                	jne    12f6 <fourfiles+0x36>
+    wait();
+    1321:	e8 35 32 00 00       	call   455b <wait>
+  for(i = 0; i < 2; i++){
+    1326:	31 f6                	xor    %esi,%esi
+    wait();
+    1328:	e8 2e 32 00 00       	call   455b <wait>
+    132d:	e8 29 32 00 00       	call   455b <wait>
+    1332:	e8 24 32 00 00       	call   455b <wait>
+    fname = names[i];
+    1337:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    133b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    133e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1340:	6a 00                	push   $0x0
+    1342:	53                   	push   %ebx
+    1343:	e8 4b 32 00 00       	call   4593 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1348:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    134b:	83 c4 10             	add    $0x10,%esp
+    134e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1358:	83 ec 04             	sub    $0x4,%esp
+    135b:	68 00 20 00 00       	push   $0x2000
+    1360:	68 e0 95 00 00       	push   $0x95e0
+    1365:	ff 75 d4             	push   -0x2c(%ebp)
+    1368:	e8 fe 31 00 00       	call   456b <read>
+    136d:	83 c4 10             	add    $0x10,%esp
+    1370:	89 c3                	mov    %eax,%ebx
+    1372:	85 c0                	test   %eax,%eax
+    1374:	7e 28                	jle    139e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1376:	31 c0                	xor    %eax,%eax
+    1378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1380:	83 fe 01             	cmp    $0x1,%esi
+    1383:	0f be 88 e0 95 00 00 	movsbl 0x95e0(%eax),%ecx
+    138a:	19 d2                	sbb    %edx,%edx
+    138c:	83 c2 31             	add    $0x31,%edx
+    138f:	39 d1                	cmp    %edx,%ecx
+    1391:	75 5d                	jne    13f0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1393:	83 c0 01             	add    $0x1,%eax
+    1396:	39 c3                	cmp    %eax,%ebx
+    1398:	75 e6                	jne    1380 <fourfiles+0xc0>
+      total += n;
+    139a:	01 df                	add    %ebx,%edi
+    139c:	eb ba                	jmp    1358 <fourfiles+0x98>
+    close(fd);
+    139e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    13a1:	83 ec 0c             	sub    $0xc,%esp
+    13a4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13a7:	51                   	push   %ecx
+    13a8:	e8 ce 31 00 00       	call   457b <close>
+    if(total != 12*500){
+    13ad:	83 c4 10             	add    $0x10,%esp
+    13b0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    13b6:	0f 85 d0 00 00 00    	jne    148c <fourfiles+0x1cc>
+    unlink(fname);
+    13bc:	83 ec 0c             	sub    $0xc,%esp
+    13bf:	53                   	push   %ebx
+    13c0:	e8 de 31 00 00       	call   45a3 <unlink>
+  for(i = 0; i < 2; i++){
+    13c5:	83 c4 10             	add    $0x10,%esp
+    13c8:	85 f6                	test   %esi,%esi
+    13ca:	75 0a                	jne    13d6 <fourfiles+0x116>
+    13cc:	be 01 00 00 00       	mov    $0x1,%esi
+    13d1:	e9 61 ff ff ff       	jmp    1337 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    13d6:	83 ec 08             	sub    $0x8,%esp
+    13d9:	68 0b 4f 00 00       	push   $0x4f0b
+    13de:	6a 01                	push   $0x1
+    13e0:	e8 eb 32 00 00       	call   46d0 <printf>
+}
+    13e5:	83 c4 10             	add    $0x10,%esp
+    13e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13eb:	5b                   	pop    %ebx
+    13ec:	5e                   	pop    %esi
+    13ed:	5f                   	pop    %edi
+    13ee:	5d                   	pop    %ebp
+    13ef:	c3                   	ret
+          printf(1, "wrong char\n");
+    13f0:	83 ec 08             	sub    $0x8,%esp
+    13f3:	68 ee 4e 00 00       	push   $0x4eee
+    13f8:	6a 01                	push   $0x1
+    13fa:	e8 d1 32 00 00       	call   46d0 <printf>
+          exit();
+    13ff:	e8 4f 31 00 00       	call   4553 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1404:	83 ec 08             	sub    $0x8,%esp
+    1407:	68 02 02 00 00       	push   $0x202
+    140c:	56                   	push   %esi
+    140d:	e8 81 31 00 00       	call   4593 <open>
+      if(fd < 0){
+    1412:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1415:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1417:	85 c0                	test   %eax,%eax
+    1419:	78 45                	js     1460 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    141b:	83 ec 04             	sub    $0x4,%esp
+    141e:	83 c3 30             	add    $0x30,%ebx
+    1421:	68 00 02 00 00       	push   $0x200
+    1426:	53                   	push   %ebx
+    1427:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    142c:	68 e0 95 00 00       	push   $0x95e0
+    1431:	e8 9a 2f 00 00       	call   43d0 <memset>
+    1436:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1439:	83 ec 04             	sub    $0x4,%esp
+    143c:	68 f4 01 00 00       	push   $0x1f4
+    1441:	68 e0 95 00 00       	push   $0x95e0
+    1446:	56                   	push   %esi
+    1447:	e8 27 31 00 00       	call   4573 <write>
+    144c:	83 c4 10             	add    $0x10,%esp
+    144f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1454:	75 49                	jne    149f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1456:	83 eb 01             	sub    $0x1,%ebx
+    1459:	75 de                	jne    1439 <fourfiles+0x179>
+      exit();
+    145b:	e8 f3 30 00 00       	call   4553 <exit>
+        printf(1, "create failed\n");
+    1460:	51                   	push   %ecx
+    1461:	51                   	push   %ecx
+    1462:	68 29 53 00 00       	push   $0x5329
+    1467:	6a 01                	push   $0x1
+    1469:	e8 62 32 00 00       	call   46d0 <printf>
+        exit();
+    146e:	e8 e0 30 00 00       	call   4553 <exit>
+    1473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1477:	90                   	nop
+      printf(1, "fork failed\n");
+    1478:	83 ec 08             	sub    $0x8,%esp
+    147b:	68 80 5b 00 00       	push   $0x5b80
+    1480:	6a 01                	push   $0x1
+    1482:	e8 49 32 00 00       	call   46d0 <printf>
+      exit();
+    1487:	e8 c7 30 00 00       	call   4553 <exit>
+      printf(1, "wrong length %d\n", total);
+    148c:	50                   	push   %eax
+    148d:	57                   	push   %edi
+    148e:	68 fa 4e 00 00       	push   $0x4efa
+    1493:	6a 01                	push   $0x1
+    1495:	e8 36 32 00 00       	call   46d0 <printf>
+      exit();
+    149a:	e8 b4 30 00 00       	call   4553 <exit>
+          printf(1, "write failed %d\n", n);
+    149f:	52                   	push   %edx
+    14a0:	50                   	push   %eax
+    14a1:	68 dd 4e 00 00       	push   $0x4edd
+    14a6:	6a 01                	push   $0x1
+    14a8:	e8 23 32 00 00       	call   46d0 <printf>
+          exit();
+    14ad:	e8 a1 30 00 00       	call   4553 <exit>
+    14b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014c0 <createdelete>:
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    14c5:	31 f6                	xor    %esi,%esi
+{
+    14c7:	53                   	push   %ebx
+    14c8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    14cb:	68 19 4f 00 00       	push   $0x4f19
+    14d0:	6a 01                	push   $0x1
+    14d2:	e8 f9 31 00 00       	call   46d0 <printf>
+    14d7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    14da:	e8 6c 30 00 00       	call   454b <fork>
+    14df:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    14e1:	85 c0                	test   %eax,%eax
+    14e3:	0f 88 ac 01 00 00    	js     1695 <createdelete+0x1d5>
+    if(pid == 0){
+    14e9:	0f 84 01 01 00 00    	je     15f0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    14ef:	83 c6 01             	add    $0x1,%esi
+    14f2:	83 fe 04             	cmp    $0x4,%esi
+    14f5:	75 e3                	jne    14da <createdelete+0x1a>
+    wait();
+    14f7:	e8 5f 30 00 00       	call   455b <wait>
+  for(i = 0; i < N; i++){
+    14fc:	31 ff                	xor    %edi,%edi
+    14fe:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1501:	e8 55 30 00 00       	call   455b <wait>
+    1506:	e8 50 30 00 00       	call   455b <wait>
+    150b:	e8 4b 30 00 00       	call   455b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1510:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1518:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    151a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    151d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1522:	0f 94 c2             	sete   %dl
+    1525:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1528:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    152b:	0f 9f c0             	setg   %al
+    152e:	09 c2                	or     %eax,%edx
+    1530:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1533:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1537:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    153a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    153d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1540:	6a 00                	push   $0x0
+    1542:	56                   	push   %esi
+    1543:	e8 4b 30 00 00       	call   4593 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1548:	83 c4 10             	add    $0x10,%esp
+    154b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    154f:	74 7f                	je     15d0 <createdelete+0x110>
+    1551:	85 c0                	test   %eax,%eax
+    1553:	0f 88 27 01 00 00    	js     1680 <createdelete+0x1c0>
+        close(fd);
+    1559:	83 ec 0c             	sub    $0xc,%esp
+    155c:	50                   	push   %eax
+    155d:	e8 19 30 00 00       	call   457b <close>
+    1562:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1565:	83 c3 01             	add    $0x1,%ebx
+    1568:	80 fb 74             	cmp    $0x74,%bl
+    156b:	75 c6                	jne    1533 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    156d:	83 c7 01             	add    $0x1,%edi
+    1570:	83 ff 14             	cmp    $0x14,%edi
+    1573:	75 a3                	jne    1518 <createdelete+0x58>
+    1575:	bf 70 00 00 00       	mov    $0x70,%edi
+    157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1580:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1583:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1588:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    158b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    158d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1590:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1593:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1597:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    159a:	56                   	push   %esi
+    159b:	e8 03 30 00 00       	call   45a3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    15a0:	83 c4 10             	add    $0x10,%esp
+    15a3:	83 eb 01             	sub    $0x1,%ebx
+    15a6:	75 e3                	jne    158b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    15a8:	83 c7 01             	add    $0x1,%edi
+    15ab:	89 f8                	mov    %edi,%eax
+    15ad:	3c 84                	cmp    $0x84,%al
+    15af:	75 cf                	jne    1580 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    15b1:	83 ec 08             	sub    $0x8,%esp
+    15b4:	68 2c 4f 00 00       	push   $0x4f2c
+    15b9:	6a 01                	push   $0x1
+    15bb:	e8 10 31 00 00       	call   46d0 <printf>
+}
+    15c0:	83 c4 10             	add    $0x10,%esp
+    15c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15c6:	5b                   	pop    %ebx
+    15c7:	5e                   	pop    %esi
+    15c8:	5f                   	pop    %edi
+    15c9:	5d                   	pop    %ebp
+    15ca:	c3                   	ret
+    15cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    15d0:	85 c0                	test   %eax,%eax
+    15d2:	78 91                	js     1565 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    15d4:	50                   	push   %eax
+    15d5:	56                   	push   %esi
+    15d6:	68 cc 5d 00 00       	push   $0x5dcc
+    15db:	6a 01                	push   $0x1
+    15dd:	e8 ee 30 00 00       	call   46d0 <printf>
+        exit();
+    15e2:	e8 6c 2f 00 00       	call   4553 <exit>
+    15e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ee:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    15f0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    15f3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    15f7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    15fa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    15fd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1600:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1603:	8d 43 30             	lea    0x30(%ebx),%eax
+    1606:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1609:	68 02 02 00 00       	push   $0x202
+    160e:	56                   	push   %esi
+    160f:	e8 7f 2f 00 00       	call   4593 <open>
+        if(fd < 0){
+    1614:	83 c4 10             	add    $0x10,%esp
+    1617:	85 c0                	test   %eax,%eax
+    1619:	0f 88 8a 00 00 00    	js     16a9 <createdelete+0x1e9>
+        close(fd);
+    161f:	83 ec 0c             	sub    $0xc,%esp
+    1622:	50                   	push   %eax
+    1623:	e8 53 2f 00 00       	call   457b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1628:	83 c4 10             	add    $0x10,%esp
+    162b:	85 db                	test   %ebx,%ebx
+    162d:	74 19                	je     1648 <createdelete+0x188>
+    162f:	f6 c3 01             	test   $0x1,%bl
+    1632:	74 1b                	je     164f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1634:	83 c3 01             	add    $0x1,%ebx
+    1637:	83 fb 14             	cmp    $0x14,%ebx
+    163a:	75 c4                	jne    1600 <createdelete+0x140>
+      exit();
+    163c:	e8 12 2f 00 00       	call   4553 <exit>
+    1641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1648:	bb 01 00 00 00       	mov    $0x1,%ebx
+    164d:	eb b1                	jmp    1600 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    164f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1651:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1654:	d1 f8                	sar    %eax
+    1656:	83 c0 30             	add    $0x30,%eax
+    1659:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    165c:	56                   	push   %esi
+    165d:	e8 41 2f 00 00       	call   45a3 <unlink>
+    1662:	83 c4 10             	add    $0x10,%esp
+    1665:	85 c0                	test   %eax,%eax
+    1667:	79 cb                	jns    1634 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1669:	52                   	push   %edx
+    166a:	52                   	push   %edx
+    166b:	68 6d 53 00 00       	push   $0x536d
+    1670:	6a 01                	push   $0x1
+    1672:	e8 59 30 00 00       	call   46d0 <printf>
+            exit();
+    1677:	e8 d7 2e 00 00       	call   4553 <exit>
+    167c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1680:	83 ec 04             	sub    $0x4,%esp
+    1683:	56                   	push   %esi
+    1684:	68 a8 5d 00 00       	push   $0x5da8
+    1689:	6a 01                	push   $0x1
+    168b:	e8 40 30 00 00       	call   46d0 <printf>
+        exit();
+    1690:	e8 be 2e 00 00       	call   4553 <exit>
+      printf(1, "fork failed\n");
+    1695:	83 ec 08             	sub    $0x8,%esp
+    1698:	68 80 5b 00 00       	push   $0x5b80
+    169d:	6a 01                	push   $0x1
+    169f:	e8 2c 30 00 00       	call   46d0 <printf>
+      exit();
+    16a4:	e8 aa 2e 00 00       	call   4553 <exit>
+          printf(1, "create failed\n");
+    16a9:	83 ec 08             	sub    $0x8,%esp
+    16ac:	68 29 53 00 00       	push   $0x5329
+    16b1:	6a 01                	push   $0x1
+    16b3:	e8 18 30 00 00       	call   46d0 <printf>
+          exit();
+    16b8:	e8 96 2e 00 00       	call   4553 <exit>
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016c0 <unlinkread>:
+{
+    16c0:	55                   	push   %ebp
+    16c1:	89 e5                	mov    %esp,%ebp
+    16c3:	56                   	push   %esi
+    16c4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    16c5:	83 ec 08             	sub    $0x8,%esp
+    16c8:	68 3d 4f 00 00       	push   $0x4f3d
+    16cd:	6a 01                	push   $0x1
+    16cf:	e8 fc 2f 00 00       	call   46d0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    16d4:	5b                   	pop    %ebx
+    16d5:	5e                   	pop    %esi
+    16d6:	68 02 02 00 00       	push   $0x202
+    16db:	68 4e 4f 00 00       	push   $0x4f4e
+    16e0:	e8 ae 2e 00 00       	call   4593 <open>
+  if(fd < 0){
+    16e5:	83 c4 10             	add    $0x10,%esp
+    16e8:	85 c0                	test   %eax,%eax
+    16ea:	0f 88 e6 00 00 00    	js     17d6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    16f0:	83 ec 04             	sub    $0x4,%esp
+    16f3:	89 c3                	mov    %eax,%ebx
+    16f5:	6a 05                	push   $0x5
+    16f7:	68 73 4f 00 00       	push   $0x4f73
+    16fc:	50                   	push   %eax
+    16fd:	e8 71 2e 00 00       	call   4573 <write>
+  close(fd);
+    1702:	89 1c 24             	mov    %ebx,(%esp)
+    1705:	e8 71 2e 00 00       	call   457b <close>
+  fd = open("unlinkread", O_RDWR);
+    170a:	58                   	pop    %eax
+    170b:	5a                   	pop    %edx
+    170c:	6a 02                	push   $0x2
+    170e:	68 4e 4f 00 00       	push   $0x4f4e
+    1713:	e8 7b 2e 00 00       	call   4593 <open>
+  if(fd < 0){
+    1718:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    171b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    171d:	85 c0                	test   %eax,%eax
+    171f:	0f 88 10 01 00 00    	js     1835 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1725:	83 ec 0c             	sub    $0xc,%esp
+    1728:	68 4e 4f 00 00       	push   $0x4f4e
+    172d:	e8 71 2e 00 00       	call   45a3 <unlink>
+    1732:	83 c4 10             	add    $0x10,%esp
+    1735:	85 c0                	test   %eax,%eax
+    1737:	0f 85 e5 00 00 00    	jne    1822 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    173d:	83 ec 08             	sub    $0x8,%esp
+    1740:	68 02 02 00 00       	push   $0x202
+    1745:	68 4e 4f 00 00       	push   $0x4f4e
+    174a:	e8 44 2e 00 00       	call   4593 <open>
+  write(fd1, "yyy", 3);
+    174f:	83 c4 0c             	add    $0xc,%esp
+    1752:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1754:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1756:	68 ab 4f 00 00       	push   $0x4fab
+    175b:	50                   	push   %eax
+    175c:	e8 12 2e 00 00       	call   4573 <write>
+  close(fd1);
+    1761:	89 34 24             	mov    %esi,(%esp)
+    1764:	e8 12 2e 00 00       	call   457b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1769:	83 c4 0c             	add    $0xc,%esp
+    176c:	68 00 20 00 00       	push   $0x2000
+    1771:	68 e0 95 00 00       	push   $0x95e0
+    1776:	53                   	push   %ebx
+    1777:	e8 ef 2d 00 00       	call   456b <read>
+    177c:	83 c4 10             	add    $0x10,%esp
+    177f:	83 f8 05             	cmp    $0x5,%eax
+    1782:	0f 85 87 00 00 00    	jne    180f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1788:	80 3d e0 95 00 00 68 	cmpb   $0x68,0x95e0
+    178f:	75 6b                	jne    17fc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1791:	83 ec 04             	sub    $0x4,%esp
+    1794:	6a 0a                	push   $0xa
+    1796:	68 e0 95 00 00       	push   $0x95e0
+    179b:	53                   	push   %ebx
+    179c:	e8 d2 2d 00 00       	call   4573 <write>
+    17a1:	83 c4 10             	add    $0x10,%esp
+    17a4:	83 f8 0a             	cmp    $0xa,%eax
+    17a7:	75 40                	jne    17e9 <unlinkread+0x129>
+  close(fd);
+    17a9:	83 ec 0c             	sub    $0xc,%esp
+    17ac:	53                   	push   %ebx
+    17ad:	e8 c9 2d 00 00       	call   457b <close>
+  unlink("unlinkread");
+    17b2:	c7 04 24 4e 4f 00 00 	movl   $0x4f4e,(%esp)
+    17b9:	e8 e5 2d 00 00       	call   45a3 <unlink>
+  printf(1, "unlinkread ok\n");
+    17be:	58                   	pop    %eax
+    17bf:	5a                   	pop    %edx
+    17c0:	68 f6 4f 00 00       	push   $0x4ff6
+    17c5:	6a 01                	push   $0x1
+    17c7:	e8 04 2f 00 00       	call   46d0 <printf>
+}
+    17cc:	83 c4 10             	add    $0x10,%esp
+    17cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    17d2:	5b                   	pop    %ebx
+    17d3:	5e                   	pop    %esi
+    17d4:	5d                   	pop    %ebp
+    17d5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    17d6:	51                   	push   %ecx
+    17d7:	51                   	push   %ecx
+    17d8:	68 59 4f 00 00       	push   $0x4f59
+    17dd:	6a 01                	push   $0x1
+    17df:	e8 ec 2e 00 00       	call   46d0 <printf>
+    exit();
+    17e4:	e8 6a 2d 00 00       	call   4553 <exit>
+    printf(1, "unlinkread write failed\n");
+    17e9:	51                   	push   %ecx
+    17ea:	51                   	push   %ecx
+    17eb:	68 dd 4f 00 00       	push   $0x4fdd
+    17f0:	6a 01                	push   $0x1
+    17f2:	e8 d9 2e 00 00       	call   46d0 <printf>
+    exit();
+    17f7:	e8 57 2d 00 00       	call   4553 <exit>
+    printf(1, "unlinkread wrong data\n");
+    17fc:	53                   	push   %ebx
+    17fd:	53                   	push   %ebx
+    17fe:	68 c6 4f 00 00       	push   $0x4fc6
+    1803:	6a 01                	push   $0x1
+    1805:	e8 c6 2e 00 00       	call   46d0 <printf>
+    exit();
+    180a:	e8 44 2d 00 00       	call   4553 <exit>
+    printf(1, "unlinkread read failed");
+    180f:	56                   	push   %esi
+    1810:	56                   	push   %esi
+    1811:	68 af 4f 00 00       	push   $0x4faf
+    1816:	6a 01                	push   $0x1
+    1818:	e8 b3 2e 00 00       	call   46d0 <printf>
+    exit();
+    181d:	e8 31 2d 00 00       	call   4553 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1822:	50                   	push   %eax
+    1823:	50                   	push   %eax
+    1824:	68 91 4f 00 00       	push   $0x4f91
+    1829:	6a 01                	push   $0x1
+    182b:	e8 a0 2e 00 00       	call   46d0 <printf>
+    exit();
+    1830:	e8 1e 2d 00 00       	call   4553 <exit>
+    printf(1, "open unlinkread failed\n");
+    1835:	50                   	push   %eax
+    1836:	50                   	push   %eax
+    1837:	68 79 4f 00 00       	push   $0x4f79
+    183c:	6a 01                	push   $0x1
+    183e:	e8 8d 2e 00 00       	call   46d0 <printf>
+    exit();
+    1843:	e8 0b 2d 00 00       	call   4553 <exit>
+    1848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+
+00001850 <linktest>:
+{
+    1850:	55                   	push   %ebp
+    1851:	89 e5                	mov    %esp,%ebp
+    1853:	53                   	push   %ebx
+    1854:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1857:	68 a6 50 00 00       	push   $0x50a6
+    185c:	6a 01                	push   $0x1
+    185e:	e8 6d 2e 00 00       	call   46d0 <printf>
+  unlink("lf1");
+    1863:	c7 04 24 05 50 00 00 	movl   $0x5005,(%esp)
+    186a:	e8 34 2d 00 00       	call   45a3 <unlink>
+  unlink("lf2");
+    186f:	c7 04 24 09 50 00 00 	movl   $0x5009,(%esp)
+    1876:	e8 28 2d 00 00       	call   45a3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    187b:	58                   	pop    %eax
+    187c:	5a                   	pop    %edx
+    187d:	68 02 02 00 00       	push   $0x202
+    1882:	68 05 50 00 00       	push   $0x5005
+    1887:	e8 07 2d 00 00       	call   4593 <open>
+  if(fd < 0){
+    188c:	83 c4 10             	add    $0x10,%esp
+    188f:	85 c0                	test   %eax,%eax
+    1891:	0f 88 1e 01 00 00    	js     19b5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1897:	83 ec 04             	sub    $0x4,%esp
+    189a:	89 c3                	mov    %eax,%ebx
+    189c:	6a 05                	push   $0x5
+    189e:	68 73 4f 00 00       	push   $0x4f73
+    18a3:	50                   	push   %eax
+    18a4:	e8 ca 2c 00 00       	call   4573 <write>
+    18a9:	83 c4 10             	add    $0x10,%esp
+    18ac:	83 f8 05             	cmp    $0x5,%eax
+    18af:	0f 85 98 01 00 00    	jne    1a4d <linktest+0x1fd>
+  close(fd);
+    18b5:	83 ec 0c             	sub    $0xc,%esp
+    18b8:	53                   	push   %ebx
+    18b9:	e8 bd 2c 00 00       	call   457b <close>
+  if(link("lf1", "lf2") < 0){
+    18be:	5b                   	pop    %ebx
+    18bf:	58                   	pop    %eax
+    18c0:	68 09 50 00 00       	push   $0x5009
+    18c5:	68 05 50 00 00       	push   $0x5005
+    18ca:	e8 e4 2c 00 00       	call   45b3 <link>
+    18cf:	83 c4 10             	add    $0x10,%esp
+    18d2:	85 c0                	test   %eax,%eax
+    18d4:	0f 88 60 01 00 00    	js     1a3a <linktest+0x1ea>
+  unlink("lf1");
+    18da:	83 ec 0c             	sub    $0xc,%esp
+    18dd:	68 05 50 00 00       	push   $0x5005
+    18e2:	e8 bc 2c 00 00       	call   45a3 <unlink>
+  if(open("lf1", 0) >= 0){
+    18e7:	58                   	pop    %eax
+    18e8:	5a                   	pop    %edx
+    18e9:	6a 00                	push   $0x0
+    18eb:	68 05 50 00 00       	push   $0x5005
+    18f0:	e8 9e 2c 00 00       	call   4593 <open>
+    18f5:	83 c4 10             	add    $0x10,%esp
+    18f8:	85 c0                	test   %eax,%eax
+    18fa:	0f 89 27 01 00 00    	jns    1a27 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1900:	83 ec 08             	sub    $0x8,%esp
+    1903:	6a 00                	push   $0x0
+    1905:	68 09 50 00 00       	push   $0x5009
+    190a:	e8 84 2c 00 00       	call   4593 <open>
+  if(fd < 0){
+    190f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1912:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1914:	85 c0                	test   %eax,%eax
+    1916:	0f 88 f8 00 00 00    	js     1a14 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    191c:	83 ec 04             	sub    $0x4,%esp
+    191f:	68 00 20 00 00       	push   $0x2000
+    1924:	68 e0 95 00 00       	push   $0x95e0
+    1929:	50                   	push   %eax
+    192a:	e8 3c 2c 00 00       	call   456b <read>
+    192f:	83 c4 10             	add    $0x10,%esp
+    1932:	83 f8 05             	cmp    $0x5,%eax
+    1935:	0f 85 c6 00 00 00    	jne    1a01 <linktest+0x1b1>
+  close(fd);
+    193b:	83 ec 0c             	sub    $0xc,%esp
+    193e:	53                   	push   %ebx
+    193f:	e8 37 2c 00 00       	call   457b <close>
+  if(link("lf2", "lf2") >= 0){
+    1944:	58                   	pop    %eax
+    1945:	5a                   	pop    %edx
+    1946:	68 09 50 00 00       	push   $0x5009
+    194b:	68 09 50 00 00       	push   $0x5009
+    1950:	e8 5e 2c 00 00       	call   45b3 <link>
+    1955:	83 c4 10             	add    $0x10,%esp
+    1958:	85 c0                	test   %eax,%eax
+    195a:	0f 89 8e 00 00 00    	jns    19ee <linktest+0x19e>
+  unlink("lf2");
+    1960:	83 ec 0c             	sub    $0xc,%esp
+    1963:	68 09 50 00 00       	push   $0x5009
+    1968:	e8 36 2c 00 00       	call   45a3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    196d:	59                   	pop    %ecx
+    196e:	5b                   	pop    %ebx
+    196f:	68 05 50 00 00       	push   $0x5005
+    1974:	68 09 50 00 00       	push   $0x5009
+    1979:	e8 35 2c 00 00       	call   45b3 <link>
+    197e:	83 c4 10             	add    $0x10,%esp
+    1981:	85 c0                	test   %eax,%eax
+    1983:	79 56                	jns    19db <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1985:	83 ec 08             	sub    $0x8,%esp
+    1988:	68 05 50 00 00       	push   $0x5005
+    198d:	68 b5 54 00 00       	push   $0x54b5
+    1992:	e8 1c 2c 00 00       	call   45b3 <link>
+    1997:	83 c4 10             	add    $0x10,%esp
+    199a:	85 c0                	test   %eax,%eax
+    199c:	79 2a                	jns    19c8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    199e:	83 ec 08             	sub    $0x8,%esp
+    19a1:	68 6c 51 00 00       	push   $0x516c
+    19a6:	6a 01                	push   $0x1
+    19a8:	e8 23 2d 00 00       	call   46d0 <printf>
+}
+    19ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19b0:	83 c4 10             	add    $0x10,%esp
+    19b3:	c9                   	leave
+    19b4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    19b5:	50                   	push   %eax
+    19b6:	50                   	push   %eax
+    19b7:	68 0d 50 00 00       	push   $0x500d
+    19bc:	6a 01                	push   $0x1
+    19be:	e8 0d 2d 00 00       	call   46d0 <printf>
+    exit();
+    19c3:	e8 8b 2b 00 00       	call   4553 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    19c8:	50                   	push   %eax
+    19c9:	50                   	push   %eax
+    19ca:	68 87 50 00 00       	push   $0x5087
+    19cf:	6a 01                	push   $0x1
+    19d1:	e8 fa 2c 00 00       	call   46d0 <printf>
+    exit();
+    19d6:	e8 78 2b 00 00       	call   4553 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    19db:	52                   	push   %edx
+    19dc:	52                   	push   %edx
+    19dd:	68 14 5e 00 00       	push   $0x5e14
+    19e2:	6a 01                	push   $0x1
+    19e4:	e8 e7 2c 00 00       	call   46d0 <printf>
+    exit();
+    19e9:	e8 65 2b 00 00       	call   4553 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    19ee:	50                   	push   %eax
+    19ef:	50                   	push   %eax
+    19f0:	68 69 50 00 00       	push   $0x5069
+    19f5:	6a 01                	push   $0x1
+    19f7:	e8 d4 2c 00 00       	call   46d0 <printf>
+    exit();
+    19fc:	e8 52 2b 00 00       	call   4553 <exit>
+    printf(1, "read lf2 failed\n");
+    1a01:	51                   	push   %ecx
+    1a02:	51                   	push   %ecx
+    1a03:	68 58 50 00 00       	push   $0x5058
+    1a08:	6a 01                	push   $0x1
+    1a0a:	e8 c1 2c 00 00       	call   46d0 <printf>
+    exit();
+    1a0f:	e8 3f 2b 00 00       	call   4553 <exit>
+    printf(1, "open lf2 failed\n");
+    1a14:	53                   	push   %ebx
+    1a15:	53                   	push   %ebx
+    1a16:	68 47 50 00 00       	push   $0x5047
+    1a1b:	6a 01                	push   $0x1
+    1a1d:	e8 ae 2c 00 00       	call   46d0 <printf>
+    exit();
+    1a22:	e8 2c 2b 00 00       	call   4553 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1a27:	50                   	push   %eax
+    1a28:	50                   	push   %eax
+    1a29:	68 ec 5d 00 00       	push   $0x5dec
+    1a2e:	6a 01                	push   $0x1
+    1a30:	e8 9b 2c 00 00       	call   46d0 <printf>
+    exit();
+    1a35:	e8 19 2b 00 00       	call   4553 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1a3a:	51                   	push   %ecx
+    1a3b:	51                   	push   %ecx
+    1a3c:	68 32 50 00 00       	push   $0x5032
+    1a41:	6a 01                	push   $0x1
+    1a43:	e8 88 2c 00 00       	call   46d0 <printf>
+    exit();
+    1a48:	e8 06 2b 00 00       	call   4553 <exit>
+    printf(1, "write lf1 failed\n");
+    1a4d:	50                   	push   %eax
+    1a4e:	50                   	push   %eax
+    1a4f:	68 20 50 00 00       	push   $0x5020
+    1a54:	6a 01                	push   $0x1
+    1a56:	e8 75 2c 00 00       	call   46d0 <printf>
+    exit();
+    1a5b:	e8 f3 2a 00 00       	call   4553 <exit>
+
+00001a60 <symlinktest>:
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	57                   	push   %edi
+    1a64:	56                   	push   %esi
+    1a65:	53                   	push   %ebx
+    1a66:	81 ec 94 00 00 00    	sub    $0x94,%esp
+  printf(1, "symlinktest\n");
+    1a6c:	68 a3 50 00 00       	push   $0x50a3
+    1a71:	6a 01                	push   $0x1
+    1a73:	e8 58 2c 00 00       	call   46d0 <printf>
+  unlink("sl0");
+    1a78:	c7 04 24 b0 50 00 00 	movl   $0x50b0,(%esp)
+    1a7f:	e8 1f 2b 00 00       	call   45a3 <unlink>
+  unlink("sl1");
+    1a84:	c7 04 24 b4 50 00 00 	movl   $0x50b4,(%esp)
+    1a8b:	e8 13 2b 00 00       	call   45a3 <unlink>
+  unlink("sl2");
+    1a90:	c7 04 24 b8 50 00 00 	movl   $0x50b8,(%esp)
+    1a97:	e8 07 2b 00 00       	call   45a3 <unlink>
+  fd = open("sl0", O_CREATE|O_RDWR);
+    1a9c:	58                   	pop    %eax
+    1a9d:	5a                   	pop    %edx
+    1a9e:	68 02 02 00 00       	push   $0x202
+    1aa3:	68 b0 50 00 00       	push   $0x50b0
+    1aa8:	e8 e6 2a 00 00       	call   4593 <open>
+  if(fd < 0 || write(fd, "hello", 5) != 5){
+    1aad:	83 c4 10             	add    $0x10,%esp
+    1ab0:	85 c0                	test   %eax,%eax
+    1ab2:	0f 88 e7 03 00 00    	js     1e9f <symlinktest+0x43f>
+    1ab8:	83 ec 04             	sub    $0x4,%esp
+    1abb:	89 c3                	mov    %eax,%ebx
+    1abd:	6a 05                	push   $0x5
+    1abf:	68 73 4f 00 00       	push   $0x4f73
+    1ac4:	50                   	push   %eax
+    1ac5:	e8 a9 2a 00 00       	call   4573 <write>
+    1aca:	83 c4 10             	add    $0x10,%esp
+    1acd:	83 f8 05             	cmp    $0x5,%eax
+    1ad0:	0f 85 c9 03 00 00    	jne    1e9f <symlinktest+0x43f>
+  close(fd);
+    1ad6:	83 ec 0c             	sub    $0xc,%esp
+    1ad9:	53                   	push   %ebx
+    1ada:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+    1add:	e8 99 2a 00 00       	call   457b <close>
+  for(i = 0; i < 40; i++){
+    1ae2:	89 d8                	mov    %ebx,%eax
+    1ae4:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+    1ae7:	83 c4 10             	add    $0x10,%esp
+    1aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    target[n++] = '.';
+    1af0:	c7 00 2e 2f 2e 2f    	movl   $0x2f2e2f2e,(%eax)
+  for(i = 0; i < 40; i++){
+    1af6:	83 c0 04             	add    $0x4,%eax
+    1af9:	39 d0                	cmp    %edx,%eax
+    1afb:	75 f3                	jne    1af0 <symlinktest+0x90>
+  strcpy(target + n, "sl0");
+    1afd:	83 ec 08             	sub    $0x8,%esp
+    1b00:	68 b0 50 00 00       	push   $0x50b0
+    1b05:	50                   	push   %eax
+    1b06:	e8 05 28 00 00       	call   4310 <strcpy>
+  if(symlink("sl0", "sl1") < 0 || symlink(target, "sl2") < 0){
+    1b0b:	5f                   	pop    %edi
+    1b0c:	58                   	pop    %eax
+    1b0d:	68 b4 50 00 00       	push   $0x50b4
+    1b12:	68 b0 50 00 00       	push   $0x50b0
+    1b17:	e8 d7 2a 00 00       	call   45f3 <symlink>
+    1b1c:	83 c4 10             	add    $0x10,%esp
+    1b1f:	85 c0                	test   %eax,%eax
+    1b21:	0f 88 64 03 00 00    	js     1e8b <symlinktest+0x42b>
+    1b27:	83 ec 08             	sub    $0x8,%esp
+    1b2a:	68 b8 50 00 00       	push   $0x50b8
+    1b2f:	53                   	push   %ebx
+    1b30:	e8 be 2a 00 00       	call   45f3 <symlink>
+    1b35:	83 c4 10             	add    $0x10,%esp
+    1b38:	85 c0                	test   %eax,%eax
+    1b3a:	0f 88 4b 03 00 00    	js     1e8b <symlinktest+0x42b>
+  if(symlink("sl0", "sl1") >= 0){
+    1b40:	83 ec 08             	sub    $0x8,%esp
+    1b43:	68 b4 50 00 00       	push   $0x50b4
+    1b48:	68 b0 50 00 00       	push   $0x50b0
+    1b4d:	e8 a1 2a 00 00       	call   45f3 <symlink>
+    1b52:	83 c4 10             	add    $0x10,%esp
+    1b55:	85 c0                	test   %eax,%eax
+    1b57:	0f 89 de 03 00 00    	jns    1f3b <symlinktest+0x4db>
+  fd = open("sl2", O_LOOKUP);
+    1b5d:	83 ec 08             	sub    $0x8,%esp
+    1b60:	6a 04                	push   $0x4
+    1b62:	68 b8 50 00 00       	push   $0x50b8
+    1b67:	e8 27 2a 00 00       	call   4593 <open>
+  if(fd < 0 || fstat(fd, &st) < 0 || st.size != strlen(target)){
+    1b6c:	83 c4 10             	add    $0x10,%esp
+  fd = open("sl2", O_LOOKUP);
+    1b6f:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || fstat(fd, &st) < 0 || st.size != strlen(target)){
+    1b71:	85 c0                	test   %eax,%eax
+    1b73:	0f 88 ae 03 00 00    	js     1f27 <symlinktest+0x4c7>
+    1b79:	83 ec 08             	sub    $0x8,%esp
+    1b7c:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+    1b82:	50                   	push   %eax
+    1b83:	56                   	push   %esi
+    1b84:	e8 22 2a 00 00       	call   45ab <fstat>
+    1b89:	83 c4 10             	add    $0x10,%esp
+    1b8c:	85 c0                	test   %eax,%eax
+    1b8e:	0f 88 93 03 00 00    	js     1f27 <symlinktest+0x4c7>
+    1b94:	83 ec 0c             	sub    $0xc,%esp
+    1b97:	8b 7d 80             	mov    -0x80(%ebp),%edi
+    1b9a:	53                   	push   %ebx
+    1b9b:	e8 00 28 00 00       	call   43a0 <strlen>
+    1ba0:	83 c4 10             	add    $0x10,%esp
+    1ba3:	39 c7                	cmp    %eax,%edi
+    1ba5:	0f 85 7c 03 00 00    	jne    1f27 <symlinktest+0x4c7>
+  close(fd);
+    1bab:	83 ec 0c             	sub    $0xc,%esp
+    1bae:	56                   	push   %esi
+    1baf:	e8 c7 29 00 00       	call   457b <close>
+    fd = open(i ? "sl2" : "sl1", O_RDONLY);
+    1bb4:	59                   	pop    %ecx
+    1bb5:	5b                   	pop    %ebx
+    1bb6:	6a 00                	push   $0x0
+    1bb8:	68 b4 50 00 00       	push   $0x50b4
+    1bbd:	e8 d1 29 00 00       	call   4593 <open>
+    if(fd < 0){
+    1bc2:	83 c4 10             	add    $0x10,%esp
+    fd = open(i ? "sl2" : "sl1", O_RDONLY);
+    1bc5:	89 c3                	mov    %eax,%ebx
+    if(fd < 0){
+    1bc7:	85 c0                	test   %eax,%eax
+    1bc9:	0f 88 45 03 00 00    	js     1f14 <symlinktest+0x4b4>
+    if(read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+    1bcf:	83 ec 04             	sub    $0x4,%esp
+    1bd2:	68 00 20 00 00       	push   $0x2000
+    1bd7:	68 e0 95 00 00       	push   $0x95e0
+    1bdc:	50                   	push   %eax
+    1bdd:	e8 89 29 00 00       	call   456b <read>
+    1be2:	83 c4 10             	add    $0x10,%esp
+    1be5:	83 f8 05             	cmp    $0x5,%eax
+    1be8:	0f 85 12 03 00 00    	jne    1f00 <symlinktest+0x4a0>
+    1bee:	80 3d e0 95 00 00 68 	cmpb   $0x68,0x95e0
+    1bf5:	0f 85 05 03 00 00    	jne    1f00 <symlinktest+0x4a0>
+    close(fd);
+    1bfb:	83 ec 0c             	sub    $0xc,%esp
+    1bfe:	53                   	push   %ebx
+    1bff:	e8 77 29 00 00       	call   457b <close>
+    fd = open(i ? "sl2" : "sl1", O_RDONLY);
+    1c04:	58                   	pop    %eax
+    1c05:	5a                   	pop    %edx
+    1c06:	6a 00                	push   $0x0
+    1c08:	68 b8 50 00 00       	push   $0x50b8
+    1c0d:	e8 81 29 00 00       	call   4593 <open>
+    if(fd < 0){
+    1c12:	83 c4 10             	add    $0x10,%esp
+    fd = open(i ? "sl2" : "sl1", O_RDONLY);
+    1c15:	89 c3                	mov    %eax,%ebx
+    if(fd < 0){
+    1c17:	85 c0                	test   %eax,%eax
+    1c19:	0f 88 f5 02 00 00    	js     1f14 <symlinktest+0x4b4>
+    if(read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+    1c1f:	83 ec 04             	sub    $0x4,%esp
+    1c22:	68 00 20 00 00       	push   $0x2000
+    1c27:	68 e0 95 00 00       	push   $0x95e0
+    1c2c:	50                   	push   %eax
+    1c2d:	e8 39 29 00 00       	call   456b <read>
+    1c32:	83 c4 10             	add    $0x10,%esp
+    1c35:	83 f8 05             	cmp    $0x5,%eax
+    1c38:	0f 85 c2 02 00 00    	jne    1f00 <symlinktest+0x4a0>
+    1c3e:	80 3d e0 95 00 00 68 	cmpb   $0x68,0x95e0
+    1c45:	0f 85 b5 02 00 00    	jne    1f00 <symlinktest+0x4a0>
+    close(fd);
+    1c4b:	83 ec 0c             	sub    $0xc,%esp
+    1c4e:	53                   	push   %ebx
+    1c4f:	e8 27 29 00 00       	call   457b <close>
+  if(symlink("sl1", "sl3") < 0 || mkdir("sld") < 0 ||
+    1c54:	5b                   	pop    %ebx
+    1c55:	5e                   	pop    %esi
+    1c56:	68 1a 51 00 00       	push   $0x511a
+    1c5b:	68 b4 50 00 00       	push   $0x50b4
+    1c60:	e8 8e 29 00 00       	call   45f3 <symlink>
+    1c65:	83 c4 10             	add    $0x10,%esp
+    1c68:	85 c0                	test   %eax,%eax
+    1c6a:	0f 88 1b 02 00 00    	js     1e8b <symlinktest+0x42b>
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	68 28 51 00 00       	push   $0x5128
+    1c78:	e8 3e 29 00 00       	call   45bb <mkdir>
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    1c80:	85 c0                	test   %eax,%eax
+    1c82:	0f 88 03 02 00 00    	js     1e8b <symlinktest+0x42b>
+     symlink("../sld", "sld/up") < 0 || symlink("sld/up/up", "sl4") < 0){
+    1c88:	83 ec 08             	sub    $0x8,%esp
+    1c8b:	68 1e 51 00 00       	push   $0x511e
+    1c90:	68 25 51 00 00       	push   $0x5125
+    1c95:	e8 59 29 00 00       	call   45f3 <symlink>
+  if(symlink("sl1", "sl3") < 0 || mkdir("sld") < 0 ||
+    1c9a:	83 c4 10             	add    $0x10,%esp
+    1c9d:	85 c0                	test   %eax,%eax
+    1c9f:	0f 88 e6 01 00 00    	js     1e8b <symlinktest+0x42b>
+     symlink("../sld", "sld/up") < 0 || symlink("sld/up/up", "sl4") < 0){
+    1ca5:	83 ec 08             	sub    $0x8,%esp
+    1ca8:	68 2c 51 00 00       	push   $0x512c
+    1cad:	68 30 51 00 00       	push   $0x5130
+    1cb2:	e8 3c 29 00 00       	call   45f3 <symlink>
+    1cb7:	83 c4 10             	add    $0x10,%esp
+    1cba:	85 c0                	test   %eax,%eax
+    1cbc:	0f 88 c9 01 00 00    	js     1e8b <symlinktest+0x42b>
+  fd = open("sld/f", O_CREATE|O_RDWR);
+    1cc2:	83 ec 08             	sub    $0x8,%esp
+    1cc5:	68 02 02 00 00       	push   $0x202
+    1cca:	68 3a 51 00 00       	push   $0x513a
+    1ccf:	e8 bf 28 00 00       	call   4593 <open>
+  if(fd < 0 || write(fd, "world", 5) != 5){
+    1cd4:	83 c4 10             	add    $0x10,%esp
+  fd = open("sld/f", O_CREATE|O_RDWR);
+    1cd7:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || write(fd, "world", 5) != 5){
+    1cd9:	85 c0                	test   %eax,%eax
+    1cdb:	0f 88 0c 02 00 00    	js     1eed <symlinktest+0x48d>
+    1ce1:	83 ec 04             	sub    $0x4,%esp
+    1ce4:	6a 05                	push   $0x5
+    1ce6:	68 55 51 00 00       	push   $0x5155
+    1ceb:	50                   	push   %eax
+    1cec:	e8 82 28 00 00       	call   4573 <write>
+    1cf1:	83 c4 10             	add    $0x10,%esp
+    1cf4:	83 f8 05             	cmp    $0x5,%eax
+    1cf7:	0f 85 f0 01 00 00    	jne    1eed <symlinktest+0x48d>
+  close(fd);
+    1cfd:	83 ec 0c             	sub    $0xc,%esp
+    1d00:	53                   	push   %ebx
+    1d01:	e8 75 28 00 00       	call   457b <close>
+  fd = open("sl3", O_RDONLY);
+    1d06:	58                   	pop    %eax
+    1d07:	5a                   	pop    %edx
+    1d08:	6a 00                	push   $0x0
+    1d0a:	68 1a 51 00 00       	push   $0x511a
+    1d0f:	e8 7f 28 00 00       	call   4593 <open>
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+    1d14:	83 c4 10             	add    $0x10,%esp
+  fd = open("sl3", O_RDONLY);
+    1d17:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+    1d19:	85 c0                	test   %eax,%eax
+    1d1b:	0f 88 b8 01 00 00    	js     1ed9 <symlinktest+0x479>
+    1d21:	83 ec 04             	sub    $0x4,%esp
+    1d24:	68 00 20 00 00       	push   $0x2000
+    1d29:	68 e0 95 00 00       	push   $0x95e0
+    1d2e:	50                   	push   %eax
+    1d2f:	e8 37 28 00 00       	call   456b <read>
+    1d34:	83 c4 10             	add    $0x10,%esp
+    1d37:	83 f8 05             	cmp    $0x5,%eax
+    1d3a:	0f 85 99 01 00 00    	jne    1ed9 <symlinktest+0x479>
+    1d40:	80 3d e0 95 00 00 68 	cmpb   $0x68,0x95e0
+    1d47:	0f 85 8c 01 00 00    	jne    1ed9 <symlinktest+0x479>
+  close(fd);
+    1d4d:	83 ec 0c             	sub    $0xc,%esp
+    1d50:	53                   	push   %ebx
+    1d51:	e8 25 28 00 00       	call   457b <close>
+  fd = open("sl4/f", O_RDONLY);
+    1d56:	5f                   	pop    %edi
+    1d57:	58                   	pop    %eax
+    1d58:	6a 00                	push   $0x0
+    1d5a:	68 5b 51 00 00       	push   $0x515b
+    1d5f:	e8 2f 28 00 00       	call   4593 <open>
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'w'){
+    1d64:	83 c4 10             	add    $0x10,%esp
+  fd = open("sl4/f", O_RDONLY);
+    1d67:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'w'){
+    1d69:	85 c0                	test   %eax,%eax
+    1d6b:	0f 88 54 01 00 00    	js     1ec5 <symlinktest+0x465>
+    1d71:	83 ec 04             	sub    $0x4,%esp
+    1d74:	68 00 20 00 00       	push   $0x2000
+    1d79:	68 e0 95 00 00       	push   $0x95e0
+    1d7e:	50                   	push   %eax
+    1d7f:	e8 e7 27 00 00       	call   456b <read>
+    1d84:	83 c4 10             	add    $0x10,%esp
+    1d87:	83 f8 05             	cmp    $0x5,%eax
+    1d8a:	0f 85 35 01 00 00    	jne    1ec5 <symlinktest+0x465>
+    1d90:	80 3d e0 95 00 00 77 	cmpb   $0x77,0x95e0
+    1d97:	0f 85 28 01 00 00    	jne    1ec5 <symlinktest+0x465>
+  close(fd);
+    1d9d:	83 ec 0c             	sub    $0xc,%esp
+    1da0:	53                   	push   %ebx
+    1da1:	e8 d5 27 00 00       	call   457b <close>
+  if(symlink("sl6", "sl5") < 0 || symlink("sl5", "sl6") < 0){
+    1da6:	5b                   	pop    %ebx
+    1da7:	5e                   	pop    %esi
+    1da8:	68 61 51 00 00       	push   $0x5161
+    1dad:	68 65 51 00 00       	push   $0x5165
+    1db2:	e8 3c 28 00 00       	call   45f3 <symlink>
+    1db7:	83 c4 10             	add    $0x10,%esp
+    1dba:	85 c0                	test   %eax,%eax
+    1dbc:	0f 88 c9 00 00 00    	js     1e8b <symlinktest+0x42b>
+    1dc2:	83 ec 08             	sub    $0x8,%esp
+    1dc5:	68 65 51 00 00       	push   $0x5165
+    1dca:	68 61 51 00 00       	push   $0x5161
+    1dcf:	e8 1f 28 00 00       	call   45f3 <symlink>
+    1dd4:	83 c4 10             	add    $0x10,%esp
+    1dd7:	85 c0                	test   %eax,%eax
+    1dd9:	0f 88 ac 00 00 00    	js     1e8b <symlinktest+0x42b>
+  if(open("sl5", O_RDONLY) >= 0){
+    1ddf:	83 ec 08             	sub    $0x8,%esp
+    1de2:	6a 00                	push   $0x0
+    1de4:	68 61 51 00 00       	push   $0x5161
+    1de9:	e8 a5 27 00 00       	call   4593 <open>
+    1dee:	83 c4 10             	add    $0x10,%esp
+    1df1:	85 c0                	test   %eax,%eax
+    1df3:	0f 89 b9 00 00 00    	jns    1eb2 <symlinktest+0x452>
+  unlink("sl6");
+    1df9:	83 ec 0c             	sub    $0xc,%esp
+    1dfc:	68 65 51 00 00       	push   $0x5165
+    1e01:	e8 9d 27 00 00       	call   45a3 <unlink>
+  unlink("sl5");
+    1e06:	c7 04 24 61 51 00 00 	movl   $0x5161,(%esp)
+    1e0d:	e8 91 27 00 00       	call   45a3 <unlink>
+  unlink("sl4");
+    1e12:	c7 04 24 2c 51 00 00 	movl   $0x512c,(%esp)
+    1e19:	e8 85 27 00 00       	call   45a3 <unlink>
+  unlink("sld/up");
+    1e1e:	c7 04 24 1e 51 00 00 	movl   $0x511e,(%esp)
+    1e25:	e8 79 27 00 00       	call   45a3 <unlink>
+  unlink("sld/f");
+    1e2a:	c7 04 24 3a 51 00 00 	movl   $0x513a,(%esp)
+    1e31:	e8 6d 27 00 00       	call   45a3 <unlink>
+  unlink("sld");
+    1e36:	c7 04 24 28 51 00 00 	movl   $0x5128,(%esp)
+    1e3d:	e8 61 27 00 00       	call   45a3 <unlink>
+  unlink("sl3");
+    1e42:	c7 04 24 1a 51 00 00 	movl   $0x511a,(%esp)
+    1e49:	e8 55 27 00 00       	call   45a3 <unlink>
+  unlink("sl2");
+    1e4e:	c7 04 24 b8 50 00 00 	movl   $0x50b8,(%esp)
+    1e55:	e8 49 27 00 00       	call   45a3 <unlink>
+  unlink("sl1");
+    1e5a:	c7 04 24 b4 50 00 00 	movl   $0x50b4,(%esp)
+    1e61:	e8 3d 27 00 00       	call   45a3 <unlink>
+  unlink("sl0");
+    1e66:	c7 04 24 b0 50 00 00 	movl   $0x50b0,(%esp)
+    1e6d:	e8 31 27 00 00       	call   45a3 <unlink>
+  printf(1, "symlinktest ok\n");
+    1e72:	58                   	pop    %eax
+    1e73:	5a                   	pop    %edx
+    1e74:	68 69 51 00 00       	push   $0x5169
+    1e79:	6a 01                	push   $0x1
+    1e7b:	e8 50 28 00 00       	call   46d0 <printf>
+}
+    1e80:	83 c4 10             	add    $0x10,%esp
+    1e83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e86:	5b                   	pop    %ebx
+    1e87:	5e                   	pop    %esi
+    1e88:	5f                   	pop    %edi
+    1e89:	5d                   	pop    %ebp
+    1e8a:	c3                   	ret
+    printf(1, "symlink failed\n");
+    1e8b:	83 ec 08             	sub    $0x8,%esp
+    1e8e:	68 0a 51 00 00       	push   $0x510a
+    1e93:	6a 01                	push   $0x1
+    1e95:	e8 36 28 00 00       	call   46d0 <printf>
+    exit();
+    1e9a:	e8 b4 26 00 00       	call   4553 <exit>
+    printf(1, "create sl0 failed\n");
+    1e9f:	50                   	push   %eax
+    1ea0:	50                   	push   %eax
+    1ea1:	68 bc 50 00 00       	push   $0x50bc
+    1ea6:	6a 01                	push   $0x1
+    1ea8:	e8 23 28 00 00       	call   46d0 <printf>
+    exit();
+    1ead:	e8 a1 26 00 00       	call   4553 <exit>
+    printf(1, "open through symlink loop succeeded! oops\n");
+    1eb2:	51                   	push   %ecx
+    1eb3:	51                   	push   %ecx
+    1eb4:	68 ac 5e 00 00       	push   $0x5eac
+    1eb9:	6a 01                	push   $0x1
+    1ebb:	e8 10 28 00 00       	call   46d0 <printf>
+    exit();
+    1ec0:	e8 8e 26 00 00       	call   4553 <exit>
+    printf(1, "read through symlinked directory failed\n");
+    1ec5:	83 ec 08             	sub    $0x8,%esp
+    1ec8:	68 80 5e 00 00       	push   $0x5e80
+    1ecd:	6a 01                	push   $0x1
+    1ecf:	e8 fc 27 00 00       	call   46d0 <printf>
+    exit();
+    1ed4:	e8 7a 26 00 00       	call   4553 <exit>
+    printf(1, "read through symlink chain failed\n");
+    1ed9:	83 ec 08             	sub    $0x8,%esp
+    1edc:	68 5c 5e 00 00       	push   $0x5e5c
+    1ee1:	6a 01                	push   $0x1
+    1ee3:	e8 e8 27 00 00       	call   46d0 <printf>
+    exit();
+    1ee8:	e8 66 26 00 00       	call   4553 <exit>
+    printf(1, "create sld/f failed\n");
+    1eed:	51                   	push   %ecx
+    1eee:	51                   	push   %ecx
+    1eef:	68 40 51 00 00       	push   $0x5140
+    1ef4:	6a 01                	push   $0x1
+    1ef6:	e8 d5 27 00 00       	call   46d0 <printf>
+    exit();
+    1efb:	e8 53 26 00 00       	call   4553 <exit>
+      printf(1, "read through symlink failed\n");
+    1f00:	83 ec 08             	sub    $0x8,%esp
+    1f03:	68 fd 50 00 00       	push   $0x50fd
+    1f08:	6a 01                	push   $0x1
+    1f0a:	e8 c1 27 00 00       	call   46d0 <printf>
+      exit();
+    1f0f:	e8 3f 26 00 00       	call   4553 <exit>
+      printf(1, "open through symlink failed\n");
+    1f14:	57                   	push   %edi
+    1f15:	57                   	push   %edi
+    1f16:	68 e0 50 00 00       	push   $0x50e0
+    1f1b:	6a 01                	push   $0x1
+    1f1d:	e8 ae 27 00 00       	call   46d0 <printf>
+      exit();
+    1f22:	e8 2c 26 00 00       	call   4553 <exit>
+    printf(1, "stat sl2 failed\n");
+    1f27:	83 ec 08             	sub    $0x8,%esp
+    1f2a:	68 cf 50 00 00       	push   $0x50cf
+    1f2f:	6a 01                	push   $0x1
+    1f31:	e8 9a 27 00 00       	call   46d0 <printf>
+    exit();
+    1f36:	e8 18 26 00 00       	call   4553 <exit>
+    printf(1, "symlink over sl1 succeeded! oops\n");
+    1f3b:	56                   	push   %esi
+    1f3c:	56                   	push   %esi
+    1f3d:	68 38 5e 00 00       	push   $0x5e38
+    1f42:	6a 01                	push   $0x1
+    1f44:	e8 87 27 00 00       	call   46d0 <printf>
+    exit();
+    1f49:	e8 05 26 00 00       	call   4553 <exit>
+    1f4e:	66 90                	xchg   %ax,%ax
+
+00001f50 <inlinetest>:
+{
+    1f50:	55                   	push   %ebp
+    1f51:	89 e5                	mov    %esp,%ebp
+    1f53:	57                   	push   %edi
+    1f54:	56                   	push   %esi
+    1f55:	53                   	push   %ebx
+    1f56:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "inlinetest\n");
+    1f59:	68 79 51 00 00       	push   $0x5179
+    1f5e:	6a 01                	push   $0x1
+    1f60:	e8 6b 27 00 00       	call   46d0 <printf>
+  unlink("inl");
+    1f65:	c7 04 24 85 51 00 00 	movl   $0x5185,(%esp)
+    1f6c:	e8 32 26 00 00       	call   45a3 <unlink>
+  fd = open("inl", O_CREATE|O_RDWR);
+    1f71:	5e                   	pop    %esi
+    1f72:	5f                   	pop    %edi
+    1f73:	68 02 02 00 00       	push   $0x202
+    1f78:	68 85 51 00 00       	push   $0x5185
+    1f7d:	e8 11 26 00 00       	call   4593 <open>
+  if(fd < 0){
+    1f82:	83 c4 10             	add    $0x10,%esp
+    1f85:	85 c0                	test   %eax,%eax
+    1f87:	0f 88 2e 02 00 00    	js     21bb <inlinetest+0x26b>
+    1f8d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 40; i++)
+    1f8f:	31 c9                	xor    %ecx,%ecx
+    buf[i] = 'a' + i % 26;
+    1f91:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+    1f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    1fa0:	89 c8                	mov    %ecx,%eax
+    1fa2:	f7 e3                	mul    %ebx
+    1fa4:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 40; i++)
+    1fa6:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    1fa9:	c1 ea 03             	shr    $0x3,%edx
+    1fac:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    1faf:	29 d0                	sub    %edx,%eax
+    1fb1:	83 c0 61             	add    $0x61,%eax
+    1fb4:	88 81 df 95 00 00    	mov    %al,0x95df(%ecx)
+  for(i = 0; i < 40; i++)
+    1fba:	83 f9 28             	cmp    $0x28,%ecx
+    1fbd:	75 e1                	jne    1fa0 <inlinetest+0x50>
+  if(write(fd, buf, 20) != 20 || write(fd, buf + 20, 20) != 20){
+    1fbf:	83 ec 04             	sub    $0x4,%esp
+    1fc2:	6a 14                	push   $0x14
+    1fc4:	68 e0 95 00 00       	push   $0x95e0
+    1fc9:	56                   	push   %esi
+    1fca:	e8 a4 25 00 00       	call   4573 <write>
+    1fcf:	83 c4 10             	add    $0x10,%esp
+    1fd2:	83 f8 14             	cmp    $0x14,%eax
+    1fd5:	0f 85 cd 01 00 00    	jne    21a8 <inlinetest+0x258>
+    1fdb:	83 ec 04             	sub    $0x4,%esp
+    1fde:	6a 14                	push   $0x14
+    1fe0:	68 f4 95 00 00       	push   $0x95f4
+    1fe5:	56                   	push   %esi
+    1fe6:	e8 88 25 00 00       	call   4573 <write>
+    1feb:	83 c4 10             	add    $0x10,%esp
+    1fee:	83 f8 14             	cmp    $0x14,%eax
+    1ff1:	0f 85 b1 01 00 00    	jne    21a8 <inlinetest+0x258>
+  close(fd);
+    1ff7:	83 ec 0c             	sub    $0xc,%esp
+    1ffa:	56                   	push   %esi
+    1ffb:	e8 7b 25 00 00       	call   457b <close>
+  fd = open("inl", O_RDWR);
+    2000:	58                   	pop    %eax
+    2001:	5a                   	pop    %edx
+    2002:	6a 02                	push   $0x2
+    2004:	68 85 51 00 00       	push   $0x5185
+    2009:	e8 85 25 00 00       	call   4593 <open>
+  if(fd < 0 || read(fd, buf + 100, 100) != 40){
+    200e:	83 c4 10             	add    $0x10,%esp
+  fd = open("inl", O_RDWR);
+    2011:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || read(fd, buf + 100, 100) != 40){
+    2013:	85 c0                	test   %eax,%eax
+    2015:	0f 88 54 01 00 00    	js     216f <inlinetest+0x21f>
+    201b:	83 ec 04             	sub    $0x4,%esp
+    201e:	6a 64                	push   $0x64
+    2020:	68 44 96 00 00       	push   $0x9644
+    2025:	50                   	push   %eax
+    2026:	e8 40 25 00 00       	call   456b <read>
+    202b:	83 c4 10             	add    $0x10,%esp
+    202e:	83 f8 28             	cmp    $0x28,%eax
+    2031:	0f 85 38 01 00 00    	jne    216f <inlinetest+0x21f>
+  for(i = 0; i < 40; i++){
+    2037:	31 c9                	xor    %ecx,%ecx
+    2039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(buf[100 + i] != buf[i]){
+    2040:	0f b6 81 e0 95 00 00 	movzbl 0x95e0(%ecx),%eax
+    2047:	38 81 44 96 00 00    	cmp    %al,0x9644(%ecx)
+    204d:	0f 85 07 01 00 00    	jne    215a <inlinetest+0x20a>
+  for(i = 0; i < 40; i++){
+    2053:	83 c1 01             	add    $0x1,%ecx
+    2056:	83 f9 28             	cmp    $0x28,%ecx
+    2059:	75 e5                	jne    2040 <inlinetest+0xf0>
+    buf[i] = 'a' + i % 26;
+    205b:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+    2060:	89 c8                	mov    %ecx,%eax
+    2062:	f7 e3                	mul    %ebx
+    2064:	89 c8                	mov    %ecx,%eax
+  for(i = 40; i < 600; i++)
+    2066:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    2069:	c1 ea 03             	shr    $0x3,%edx
+    206c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    206f:	29 d0                	sub    %edx,%eax
+    2071:	83 c0 61             	add    $0x61,%eax
+    2074:	88 81 df 95 00 00    	mov    %al,0x95df(%ecx)
+  for(i = 40; i < 600; i++)
+    207a:	81 f9 58 02 00 00    	cmp    $0x258,%ecx
+    2080:	75 de                	jne    2060 <inlinetest+0x110>
+  if(write(fd, buf + 40, 560) != 560){
+    2082:	83 ec 04             	sub    $0x4,%esp
+    2085:	68 30 02 00 00       	push   $0x230
+    208a:	68 08 96 00 00       	push   $0x9608
+    208f:	56                   	push   %esi
+    2090:	e8 de 24 00 00       	call   4573 <write>
+    2095:	83 c4 10             	add    $0x10,%esp
+    2098:	3d 30 02 00 00       	cmp    $0x230,%eax
+    209d:	0f 85 f2 00 00 00    	jne    2195 <inlinetest+0x245>
+  close(fd);
+    20a3:	83 ec 0c             	sub    $0xc,%esp
+    20a6:	56                   	push   %esi
+    20a7:	e8 cf 24 00 00       	call   457b <close>
+  fd = open("inl", O_RDONLY);
+    20ac:	5b                   	pop    %ebx
+    20ad:	5e                   	pop    %esi
+    20ae:	6a 00                	push   $0x0
+    20b0:	68 85 51 00 00       	push   $0x5185
+    20b5:	e8 d9 24 00 00       	call   4593 <open>
+  if(fd < 0 || (n = read(fd, buf + 1000, 1000)) != 600){
+    20ba:	83 c4 10             	add    $0x10,%esp
+  fd = open("inl", O_RDONLY);
+    20bd:	89 c7                	mov    %eax,%edi
+  if(fd < 0 || (n = read(fd, buf + 1000, 1000)) != 600){
+    20bf:	85 c0                	test   %eax,%eax
+    20c1:	0f 88 bb 00 00 00    	js     2182 <inlinetest+0x232>
+    20c7:	83 ec 04             	sub    $0x4,%esp
+    20ca:	68 e8 03 00 00       	push   $0x3e8
+    20cf:	68 c8 99 00 00       	push   $0x99c8
+    20d4:	50                   	push   %eax
+    20d5:	e8 91 24 00 00       	call   456b <read>
+    20da:	83 c4 10             	add    $0x10,%esp
+    20dd:	3d 58 02 00 00       	cmp    $0x258,%eax
+    20e2:	0f 85 9a 00 00 00    	jne    2182 <inlinetest+0x232>
+  for(i = 0; i < n; i++){
+    20e8:	31 c9                	xor    %ecx,%ecx
+    if(buf[1000 + i] != 'a' + i % 26){
+    20ea:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    20ef:	90                   	nop
+    20f0:	89 c8                	mov    %ecx,%eax
+    20f2:	0f be 99 c8 99 00 00 	movsbl 0x99c8(%ecx),%ebx
+    20f9:	f7 e6                	mul    %esi
+    20fb:	89 c8                	mov    %ecx,%eax
+    20fd:	c1 ea 03             	shr    $0x3,%edx
+    2100:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2103:	29 d0                	sub    %edx,%eax
+    2105:	83 c0 61             	add    $0x61,%eax
+    2108:	39 c3                	cmp    %eax,%ebx
+    210a:	75 39                	jne    2145 <inlinetest+0x1f5>
+  for(i = 0; i < n; i++){
+    210c:	83 c1 01             	add    $0x1,%ecx
+    210f:	81 f9 58 02 00 00    	cmp    $0x258,%ecx
+    2115:	75 d9                	jne    20f0 <inlinetest+0x1a0>
+  close(fd);
+    2117:	83 ec 0c             	sub    $0xc,%esp
+    211a:	57                   	push   %edi
+    211b:	e8 5b 24 00 00       	call   457b <close>
+  unlink("inl");
+    2120:	c7 04 24 85 51 00 00 	movl   $0x5185,(%esp)
+    2127:	e8 77 24 00 00       	call   45a3 <unlink>
+  printf(1, "inlinetest ok\n");
+    212c:	58                   	pop    %eax
+    212d:	5a                   	pop    %edx
+    212e:	68 0e 52 00 00       	push   $0x520e
+    2133:	6a 01                	push   $0x1
+    2135:	e8 96 25 00 00       	call   46d0 <printf>
+}
+    213a:	83 c4 10             	add    $0x10,%esp
+    213d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2140:	5b                   	pop    %ebx
+    2141:	5e                   	pop    %esi
+    2142:	5f                   	pop    %edi
+    2143:	5d                   	pop    %ebp
+    2144:	c3                   	ret
+      printf(1, "inl oops at %d\n", i);
+    2145:	83 ec 04             	sub    $0x4,%esp
+    2148:	51                   	push   %ecx
+    2149:	68 cd 51 00 00       	push   $0x51cd
+    214e:	6a 01                	push   $0x1
+    2150:	e8 7b 25 00 00       	call   46d0 <printf>
+      exit();
+    2155:	e8 f9 23 00 00       	call   4553 <exit>
+      printf(1, "inline inl oops at %d\n", i);
+    215a:	83 ec 04             	sub    $0x4,%esp
+    215d:	51                   	push   %ecx
+    215e:	68 c6 51 00 00       	push   $0x51c6
+    2163:	6a 01                	push   $0x1
+    2165:	e8 66 25 00 00       	call   46d0 <printf>
+      exit();
+    216a:	e8 e4 23 00 00       	call   4553 <exit>
+    printf(1, "read inline inl failed\n");
+    216f:	50                   	push   %eax
+    2170:	50                   	push   %eax
+    2171:	68 ae 51 00 00       	push   $0x51ae
+    2176:	6a 01                	push   $0x1
+    2178:	e8 53 25 00 00       	call   46d0 <printf>
+    exit();
+    217d:	e8 d1 23 00 00       	call   4553 <exit>
+    printf(1, "read grown inl failed\n");
+    2182:	51                   	push   %ecx
+    2183:	51                   	push   %ecx
+    2184:	68 f7 51 00 00       	push   $0x51f7
+    2189:	6a 01                	push   $0x1
+    218b:	e8 40 25 00 00       	call   46d0 <printf>
+    exit();
+    2190:	e8 be 23 00 00       	call   4553 <exit>
+    printf(1, "write to grow inl failed\n");
+    2195:	57                   	push   %edi
+    2196:	57                   	push   %edi
+    2197:	68 dd 51 00 00       	push   $0x51dd
+    219c:	6a 01                	push   $0x1
+    219e:	e8 2d 25 00 00       	call   46d0 <printf>
+    exit();
+    21a3:	e8 ab 23 00 00       	call   4553 <exit>
+    printf(1, "write inl failed\n");
+    21a8:	51                   	push   %ecx
+    21a9:	51                   	push   %ecx
+    21aa:	68 9c 51 00 00       	push   $0x519c
+    21af:	6a 01                	push   $0x1
+    21b1:	e8 1a 25 00 00       	call   46d0 <printf>
+    exit();
+    21b6:	e8 98 23 00 00       	call   4553 <exit>
+    printf(1, "create inl failed\n");
+    21bb:	53                   	push   %ebx
+    21bc:	53                   	push   %ebx
+    21bd:	68 89 51 00 00       	push   $0x5189
+    21c2:	6a 01                	push   $0x1
+    21c4:	e8 07 25 00 00       	call   46d0 <printf>
+    exit();
+    21c9:	e8 85 23 00 00       	call   4553 <exit>
+    21ce:	66 90                	xchg   %ax,%ax
+
+000021d0 <concreate>:
+{
+    21d0:	55                   	push   %ebp
+    21d1:	89 e5                	mov    %esp,%ebp
+    21d3:	57                   	push   %edi
+    21d4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    21d5:	31 f6                	xor    %esi,%esi
+{
+    21d7:	53                   	push   %ebx
+    21d8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    21db:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    21de:	68 1d 52 00 00       	push   $0x521d
+    21e3:	6a 01                	push   $0x1
+    21e5:	e8 e6 24 00 00       	call   46d0 <printf>
+  file[0] = 'C';
+    21ea:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    21ee:	83 c4 10             	add    $0x10,%esp
+    21f1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    21f5:	eb 48                	jmp    223f <concreate+0x6f>
+    21f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21fe:	66 90                	xchg   %ax,%ax
+    2200:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2206:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    220b:	0f 83 8f 00 00 00    	jae    22a0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2211:	83 ec 08             	sub    $0x8,%esp
+    2214:	68 02 02 00 00       	push   $0x202
+    2219:	53                   	push   %ebx
+    221a:	e8 74 23 00 00       	call   4593 <open>
+      if(fd < 0){
+    221f:	83 c4 10             	add    $0x10,%esp
+    2222:	85 c0                	test   %eax,%eax
+    2224:	78 5f                	js     2285 <concreate+0xb5>
+      close(fd);
+    2226:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2229:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    222c:	50                   	push   %eax
+    222d:	e8 49 23 00 00       	call   457b <close>
+    2232:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2235:	e8 21 23 00 00       	call   455b <wait>
+  for(i = 0; i < 40; i++){
+    223a:	83 fe 28             	cmp    $0x28,%esi
+    223d:	74 7f                	je     22be <concreate+0xee>
+    unlink(file);
+    223f:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2242:	8d 46 30             	lea    0x30(%esi),%eax
+    2245:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    2248:	53                   	push   %ebx
+    2249:	e8 55 23 00 00       	call   45a3 <unlink>
+    pid = fork();
+    224e:	e8 f8 22 00 00       	call   454b <fork>
+    if(pid && (i % 3) == 1){
+    2253:	83 c4 10             	add    $0x10,%esp
+    2256:	85 c0                	test   %eax,%eax
+    2258:	75 a6                	jne    2200 <concreate+0x30>
+      link("C0", file);
+    225a:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2260:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    2266:	0f 83 d4 00 00 00    	jae    2340 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    226c:	83 ec 08             	sub    $0x8,%esp
+    226f:	68 02 02 00 00       	push   $0x202
+    2274:	53                   	push   %ebx
+    2275:	e8 19 23 00 00       	call   4593 <open>
+      if(fd < 0){
+    227a:	83 c4 10             	add    $0x10,%esp
+    227d:	85 c0                	test   %eax,%eax
+    227f:	0f 89 ee 01 00 00    	jns    2473 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    2285:	83 ec 04             	sub    $0x4,%esp
+    2288:	53                   	push   %ebx
+    2289:	68 30 52 00 00       	push   $0x5230
+    228e:	6a 01                	push   $0x1
+    2290:	e8 3b 24 00 00       	call   46d0 <printf>
+        exit();
+    2295:	e8 b9 22 00 00       	call   4553 <exit>
+    229a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      link("C0", file);
+    22a0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    22a3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    22a6:	53                   	push   %ebx
+    22a7:	68 2d 52 00 00       	push   $0x522d
+    22ac:	e8 02 23 00 00       	call   45b3 <link>
+    22b1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    22b4:	e8 a2 22 00 00       	call   455b <wait>
+  for(i = 0; i < 40; i++){
+    22b9:	83 fe 28             	cmp    $0x28,%esi
+    22bc:	75 81                	jne    223f <concreate+0x6f>
+  memset(fa, 0, sizeof(fa));
+    22be:	83 ec 04             	sub    $0x4,%esp
+    22c1:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    22c4:	6a 28                	push   $0x28
+    22c6:	6a 00                	push   $0x0
+    22c8:	50                   	push   %eax
+    22c9:	e8 02 21 00 00       	call   43d0 <memset>
+  fd = open(".", 0);
+    22ce:	5e                   	pop    %esi
+    22cf:	5f                   	pop    %edi
+    22d0:	6a 00                	push   $0x0
+    22d2:	68 b5 54 00 00       	push   $0x54b5
+    22d7:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    22da:	e8 b4 22 00 00       	call   4593 <open>
+  n = 0;
+    22df:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    22e6:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    22e9:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    22eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22ef:	90                   	nop
+    22f0:	83 ec 04             	sub    $0x4,%esp
+    22f3:	6a 10                	push   $0x10
+    22f5:	57                   	push   %edi
+    22f6:	56                   	push   %esi
+    22f7:	e8 6f 22 00 00       	call   456b <read>
+    22fc:	83 c4 10             	add    $0x10,%esp
+    22ff:	85 c0                	test   %eax,%eax
+    2301:	7e 5d                	jle    2360 <concreate+0x190>
+    if(de.inum == 0)
+    2303:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2308:	74 e6                	je     22f0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    230a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    230e:	75 e0                	jne    22f0 <concreate+0x120>
+    2310:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2314:	75 da                	jne    22f0 <concreate+0x120>
+      i = de.name[1] - '0';
+    2316:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    231a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    231d:	83 f8 27             	cmp    $0x27,%eax
+    2320:	0f 87 5e 01 00 00    	ja     2484 <concreate+0x2b4>
+      if(fa[i]){
+    2326:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    232b:	0f 85 7e 01 00 00    	jne    24af <concreate+0x2df>
+      n++;
+    2331:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2335:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    233a:	eb b4                	jmp    22f0 <concreate+0x120>
+    233c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2340:	83 ec 08             	sub    $0x8,%esp
+    2343:	53                   	push   %ebx
+    2344:	68 2d 52 00 00       	push   $0x522d
+    2349:	e8 65 22 00 00       	call   45b3 <link>
+    234e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2351:	e8 fd 21 00 00       	call   4553 <exit>
+    2356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2360:	83 ec 0c             	sub    $0xc,%esp
+    2363:	56                   	push   %esi
+    2364:	e8 12 22 00 00       	call   457b <close>
+  if(n != 40){
+    2369:	83 c4 10             	add    $0x10,%esp
+    236c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    2370:	0f 85 26 01 00 00    	jne    249c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    2376:	31 f6                	xor    %esi,%esi
+    2378:	eb 48                	jmp    23c2 <concreate+0x1f2>
+    237a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    2380:	85 ff                	test   %edi,%edi
+    2382:	74 05                	je     2389 <concreate+0x1b9>
+    2384:	83 f8 01             	cmp    $0x1,%eax
+    2387:	74 68                	je     23f1 <concreate+0x221>
+      unlink(file);
+    2389:	83 ec 0c             	sub    $0xc,%esp
+    238c:	53                   	push   %ebx
+    238d:	e8 11 22 00 00       	call   45a3 <unlink>
+      unlink(file);
+    2392:	89 1c 24             	mov    %ebx,(%esp)
+    2395:	e8 09 22 00 00       	call   45a3 <unlink>
+      unlink(file);
+    239a:	89 1c 24             	mov    %ebx,(%esp)
+    239d:	e8 01 22 00 00       	call   45a3 <unlink>
+      unlink(file);
+    23a2:	89 1c 24             	mov    %ebx,(%esp)
+    23a5:	e8 f9 21 00 00       	call   45a3 <unlink>
+    23aa:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    23ad:	85 ff                	test   %edi,%edi
+    23af:	74 a0                	je     2351 <concreate+0x181>
+      wait();
+    23b1:	e8 a5 21 00 00       	call   455b <wait>
+  for(i = 0; i < 40; i++){
+    23b6:	83 c6 01             	add    $0x1,%esi
+    23b9:	83 fe 28             	cmp    $0x28,%esi
+    23bc:	0f 84 86 00 00 00    	je     2448 <concreate+0x278>
+    file[1] = '0' + i;
+    23c2:	8d 46 30             	lea    0x30(%esi),%eax
+    23c5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    23c8:	e8 7e 21 00 00       	call   454b <fork>
+    23cd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    23cf:	85 c0                	test   %eax,%eax
+    23d1:	0f 88 88 00 00 00    	js     245f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    23d7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    23dc:	f7 e6                	mul    %esi
+    23de:	89 d0                	mov    %edx,%eax
+    23e0:	83 e2 fe             	and    $0xfffffffe,%edx
+    23e3:	d1 e8                	shr    %eax
+    23e5:	01 c2                	add    %eax,%edx
+    23e7:	89 f0                	mov    %esi,%eax
+    23e9:	29 d0                	sub    %edx,%eax
+    23eb:	89 c1                	mov    %eax,%ecx
+    23ed:	09 f9                	or     %edi,%ecx
+    23ef:	75 8f                	jne    2380 <concreate+0x1b0>
+      close(open(file, 0));
+    23f1:	83 ec 08             	sub    $0x8,%esp
+    23f4:	6a 00                	push   $0x0
+    23f6:	53                   	push   %ebx
+    23f7:	e8 97 21 00 00       	call   4593 <open>
+    23fc:	89 04 24             	mov    %eax,(%esp)
+    23ff:	e8 77 21 00 00       	call   457b <close>
+      close(open(file, 0));
+    2404:	58                   	pop    %eax
+    2405:	5a                   	pop    %edx
+    2406:	6a 00                	push   $0x0
+    2408:	53                   	push   %ebx
+    2409:	e8 85 21 00 00       	call   4593 <open>
+    240e:	89 04 24             	mov    %eax,(%esp)
+    2411:	e8 65 21 00 00       	call   457b <close>
+      close(open(file, 0));
+    2416:	59                   	pop    %ecx
+    2417:	58                   	pop    %eax
+    2418:	6a 00                	push   $0x0
+    241a:	53                   	push   %ebx
+    241b:	e8 73 21 00 00       	call   4593 <open>
+    2420:	89 04 24             	mov    %eax,(%esp)
+    2423:	e8 53 21 00 00       	call   457b <close>
+      close(open(file, 0));
+    2428:	58                   	pop    %eax
+    2429:	5a                   	pop    %edx
+    242a:	6a 00                	push   $0x0
+    242c:	53                   	push   %ebx
+    242d:	e8 61 21 00 00       	call   4593 <open>
+    2432:	89 04 24             	mov    %eax,(%esp)
+    2435:	e8 41 21 00 00       	call   457b <close>
+    243a:	83 c4 10             	add    $0x10,%esp
+    243d:	e9 6b ff ff ff       	jmp    23ad <concreate+0x1dd>
+    2442:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    2448:	83 ec 08             	sub    $0x8,%esp
+    244b:	68 82 52 00 00       	push   $0x5282
+    2450:	6a 01                	push   $0x1
+    2452:	e8 79 22 00 00       	call   46d0 <printf>
+}
+    2457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    245a:	5b                   	pop    %ebx
+    245b:	5e                   	pop    %esi
+    245c:	5f                   	pop    %edi
+    245d:	5d                   	pop    %ebp
+    245e:	c3                   	ret
+      printf(1, "fork failed\n");
+    245f:	83 ec 08             	sub    $0x8,%esp
+    2462:	68 80 5b 00 00       	push   $0x5b80
+    2467:	6a 01                	push   $0x1
+    2469:	e8 62 22 00 00       	call   46d0 <printf>
+      exit();
+    246e:	e8 e0 20 00 00       	call   4553 <exit>
+      close(fd);
+    2473:	83 ec 0c             	sub    $0xc,%esp
+    2476:	50                   	push   %eax
+    2477:	e8 ff 20 00 00       	call   457b <close>
+    247c:	83 c4 10             	add    $0x10,%esp
+    247f:	e9 cd fe ff ff       	jmp    2351 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    2484:	83 ec 04             	sub    $0x4,%esp
+    2487:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    248a:	50                   	push   %eax
+    248b:	68 4c 52 00 00       	push   $0x524c
+    2490:	6a 01                	push   $0x1
+    2492:	e8 39 22 00 00       	call   46d0 <printf>
+        exit();
+    2497:	e8 b7 20 00 00       	call   4553 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    249c:	51                   	push   %ecx
+    249d:	51                   	push   %ecx
+    249e:	68 d8 5e 00 00       	push   $0x5ed8
+    24a3:	6a 01                	push   $0x1
+    24a5:	e8 26 22 00 00       	call   46d0 <printf>
+    exit();
+    24aa:	e8 a4 20 00 00       	call   4553 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    24af:	83 ec 04             	sub    $0x4,%esp
+    24b2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    24b5:	50                   	push   %eax
+    24b6:	68 65 52 00 00       	push   $0x5265
+    24bb:	6a 01                	push   $0x1
+    24bd:	e8 0e 22 00 00       	call   46d0 <printf>
+        exit();
+    24c2:	e8 8c 20 00 00       	call   4553 <exit>
+    24c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24ce:	66 90                	xchg   %ax,%ax
+
+000024d0 <linkunlink>:
+{
+    24d0:	55                   	push   %ebp
+    24d1:	89 e5                	mov    %esp,%ebp
+    24d3:	57                   	push   %edi
+    24d4:	56                   	push   %esi
+    24d5:	53                   	push   %ebx
+    24d6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    24d9:	68 90 52 00 00       	push   $0x5290
+    24de:	6a 01                	push   $0x1
+    24e0:	e8 eb 21 00 00       	call   46d0 <printf>
+  unlink("x");
+    24e5:	c7 04 24 98 55 00 00 	movl   $0x5598,(%esp)
+    24ec:	e8 b2 20 00 00       	call   45a3 <unlink>
+  pid = fork();
+    24f1:	e8 55 20 00 00       	call   454b <fork>
+  if(pid < 0){
+    24f6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    24f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    24fc:	85 c0                	test   %eax,%eax
+    24fe:	0f 88 b6 00 00 00    	js     25ba <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2504:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2508:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    250d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2512:	19 ff                	sbb    %edi,%edi
+    2514:	83 e7 60             	and    $0x60,%edi
+    2517:	83 c7 01             	add    $0x1,%edi
+    251a:	eb 1e                	jmp    253a <linkunlink+0x6a>
+    251c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2520:	83 f8 01             	cmp    $0x1,%eax
+    2523:	74 7b                	je     25a0 <linkunlink+0xd0>
+      unlink("x");
+    2525:	83 ec 0c             	sub    $0xc,%esp
+    2528:	68 98 55 00 00       	push   $0x5598
+    252d:	e8 71 20 00 00       	call   45a3 <unlink>
+    2532:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2535:	83 eb 01             	sub    $0x1,%ebx
+    2538:	74 41                	je     257b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    253a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2540:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2546:	89 f8                	mov    %edi,%eax
+    2548:	f7 e6                	mul    %esi
+    254a:	89 d0                	mov    %edx,%eax
+    254c:	83 e2 fe             	and    $0xfffffffe,%edx
+    254f:	d1 e8                	shr    %eax
+    2551:	01 c2                	add    %eax,%edx
+    2553:	89 f8                	mov    %edi,%eax
+    2555:	29 d0                	sub    %edx,%eax
+    2557:	75 c7                	jne    2520 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2559:	83 ec 08             	sub    $0x8,%esp
+    255c:	68 02 02 00 00       	push   $0x202
+    2561:	68 98 55 00 00       	push   $0x5598
+    2566:	e8 28 20 00 00       	call   4593 <open>
+    256b:	89 04 24             	mov    %eax,(%esp)
+    256e:	e8 08 20 00 00       	call   457b <close>
+    2573:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2576:	83 eb 01             	sub    $0x1,%ebx
+    2579:	75 bf                	jne    253a <linkunlink+0x6a>
+  if(pid)
+    257b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    257e:	85 c0                	test   %eax,%eax
+    2580:	74 4b                	je     25cd <linkunlink+0xfd>
+    wait();
+    2582:	e8 d4 1f 00 00       	call   455b <wait>
+  printf(1, "linkunlink ok\n");
+    2587:	83 ec 08             	sub    $0x8,%esp
+    258a:	68 a5 52 00 00       	push   $0x52a5
+    258f:	6a 01                	push   $0x1
+    2591:	e8 3a 21 00 00       	call   46d0 <printf>
+}
+    2596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2599:	5b                   	pop    %ebx
+    259a:	5e                   	pop    %esi
+    259b:	5f                   	pop    %edi
+    259c:	5d                   	pop    %ebp
+    259d:	c3                   	ret
+    259e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    25a0:	83 ec 08             	sub    $0x8,%esp
+    25a3:	68 98 55 00 00       	push   $0x5598
+    25a8:	68 a1 52 00 00       	push   $0x52a1
+    25ad:	e8 01 20 00 00       	call   45b3 <link>
+    25b2:	83 c4 10             	add    $0x10,%esp
+    25b5:	e9 7b ff ff ff       	jmp    2535 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    25ba:	52                   	push   %edx
+    25bb:	52                   	push   %edx
+    25bc:	68 80 5b 00 00       	push   $0x5b80
+    25c1:	6a 01                	push   $0x1
+    25c3:	e8 08 21 00 00       	call   46d0 <printf>
+    exit();
+    25c8:	e8 86 1f 00 00       	call   4553 <exit>
+    exit();
+    25cd:	e8 81 1f 00 00       	call   4553 <exit>
+    25d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000025e0 <bigdir>:
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	57                   	push   %edi
+    25e4:	56                   	push   %esi
+    25e5:	53                   	push   %ebx
+    25e6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    25e9:	68 b4 52 00 00       	push   $0x52b4
+    25ee:	6a 01                	push   $0x1
+    25f0:	e8 db 20 00 00       	call   46d0 <printf>
+  unlink("bd");
+    25f5:	c7 04 24 c1 52 00 00 	movl   $0x52c1,(%esp)
+    25fc:	e8 a2 1f 00 00       	call   45a3 <unlink>
+  fd = open("bd", O_CREATE);
+    2601:	5a                   	pop    %edx
+    2602:	59                   	pop    %ecx
+    2603:	68 00 02 00 00       	push   $0x200
+    2608:	68 c1 52 00 00       	push   $0x52c1
+    260d:	e8 81 1f 00 00       	call   4593 <open>
+  if(fd < 0){
+    2612:	83 c4 10             	add    $0x10,%esp
+    2615:	85 c0                	test   %eax,%eax
+    2617:	0f 88 de 00 00 00    	js     26fb <bigdir+0x11b>
+  close(fd);
+    261d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2620:	31 f6                	xor    %esi,%esi
+    2622:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2625:	50                   	push   %eax
+    2626:	e8 50 1f 00 00       	call   457b <close>
+    262b:	83 c4 10             	add    $0x10,%esp
+    262e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2630:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2632:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2635:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2639:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    263c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2640:	83 c0 30             	add    $0x30,%eax
+    2643:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2646:	89 f0                	mov    %esi,%eax
+    2648:	83 e0 3f             	and    $0x3f,%eax
+    264b:	83 c0 30             	add    $0x30,%eax
+    264e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2651:	57                   	push   %edi
+    2652:	68 c1 52 00 00       	push   $0x52c1
+    2657:	e8 57 1f 00 00       	call   45b3 <link>
+    265c:	83 c4 10             	add    $0x10,%esp
+    265f:	89 c3                	mov    %eax,%ebx
+    2661:	85 c0                	test   %eax,%eax
+    2663:	75 6e                	jne    26d3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2665:	83 c6 01             	add    $0x1,%esi
+    2668:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    266e:	75 c0                	jne    2630 <bigdir+0x50>
+  unlink("bd");
+    2670:	83 ec 0c             	sub    $0xc,%esp
+    2673:	68 c1 52 00 00       	push   $0x52c1
+    2678:	e8 26 1f 00 00       	call   45a3 <unlink>
+    267d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2680:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2682:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2685:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2689:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    268c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2690:	83 c0 30             	add    $0x30,%eax
+    2693:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2696:	89 d8                	mov    %ebx,%eax
+    2698:	83 e0 3f             	and    $0x3f,%eax
+    269b:	83 c0 30             	add    $0x30,%eax
+    269e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    26a1:	57                   	push   %edi
+    26a2:	e8 fc 1e 00 00       	call   45a3 <unlink>
+    26a7:	83 c4 10             	add    $0x10,%esp
+    26aa:	85 c0                	test   %eax,%eax
+    26ac:	75 39                	jne    26e7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    26ae:	83 c3 01             	add    $0x1,%ebx
+    26b1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    26b7:	75 c7                	jne    2680 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    26b9:	83 ec 08             	sub    $0x8,%esp
+    26bc:	68 03 53 00 00       	push   $0x5303
+    26c1:	6a 01                	push   $0x1
+    26c3:	e8 08 20 00 00       	call   46d0 <printf>
+    26c8:	83 c4 10             	add    $0x10,%esp
+}
+    26cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26ce:	5b                   	pop    %ebx
+    26cf:	5e                   	pop    %esi
+    26d0:	5f                   	pop    %edi
+    26d1:	5d                   	pop    %ebp
+    26d2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    26d3:	83 ec 08             	sub    $0x8,%esp
+    26d6:	68 da 52 00 00       	push   $0x52da
+    26db:	6a 01                	push   $0x1
+    26dd:	e8 ee 1f 00 00       	call   46d0 <printf>
+      exit();
+    26e2:	e8 6c 1e 00 00       	call   4553 <exit>
+      printf(1, "bigdir unlink failed");
+    26e7:	83 ec 08             	sub    $0x8,%esp
+    26ea:	68 ee 52 00 00       	push   $0x52ee
+    26ef:	6a 01                	push   $0x1
+    26f1:	e8 da 1f 00 00       	call   46d0 <printf>
+      exit();
+    26f6:	e8 58 1e 00 00       	call   4553 <exit>
+    printf(1, "bigdir create failed\n");
+    26fb:	50                   	push   %eax
+    26fc:	50                   	push   %eax
+    26fd:	68 c4 52 00 00       	push   $0x52c4
+    2702:	6a 01                	push   $0x1
+    2704:	e8 c7 1f 00 00       	call   46d0 <printf>
+    exit();
+    2709:	e8 45 1e 00 00       	call   4553 <exit>
+    270e:	66 90                	xchg   %ax,%ax
+
+00002710 <dirbench>:
+{
+    2710:	55                   	push   %ebp
+    2711:	89 e5                	mov    %esp,%ebp
+    2713:	57                   	push   %edi
+    2714:	56                   	push   %esi
+    2715:	53                   	push   %ebx
+    2716:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "dirbench test\n");
+    2719:	68 0e 53 00 00       	push   $0x530e
+    271e:	6a 01                	push   $0x1
+    2720:	e8 ab 1f 00 00       	call   46d0 <printf>
+  unlink("db");
+    2725:	c7 04 24 1d 53 00 00 	movl   $0x531d,(%esp)
+    272c:	e8 72 1e 00 00       	call   45a3 <unlink>
+  fd = open("db", O_CREATE);
+    2731:	5b                   	pop    %ebx
+    2732:	5e                   	pop    %esi
+    2733:	68 00 02 00 00       	push   $0x200
+    2738:	68 1d 53 00 00       	push   $0x531d
+    273d:	e8 51 1e 00 00       	call   4593 <open>
+  if(fd < 0){
+    2742:	83 c4 10             	add    $0x10,%esp
+    2745:	85 c0                	test   %eax,%eax
+    2747:	0f 88 30 02 00 00    	js     297d <dirbench+0x26d>
+  close(fd);
+    274d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 1000; i++){
+    2750:	31 f6                	xor    %esi,%esi
+    name[1] = '0' + (i / 100);
+    2752:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    name[2] = '0' + (i / 10) % 10;
+    2757:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  close(fd);
+    275c:	50                   	push   %eax
+    275d:	e8 19 1e 00 00       	call   457b <close>
+  t0 = uptime();
+    2762:	e8 84 1e 00 00       	call   45eb <uptime>
+    2767:	83 c4 10             	add    $0x10,%esp
+    276a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < 1000; i++){
+    276d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + (i / 100);
+    2770:	89 f0                	mov    %esi,%eax
+    if(link("db", name) != 0){
+    2772:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'y';
+    2775:	c6 45 de 79          	movb   $0x79,-0x22(%ebp)
+    name[1] = '0' + (i / 100);
+    2779:	f7 e7                	mul    %edi
+    name[2] = '0' + (i / 10) % 10;
+    277b:	89 f0                	mov    %esi,%eax
+    name[4] = '\0';
+    277d:	c6 45 e2 00          	movb   $0x0,-0x1e(%ebp)
+    name[1] = '0' + (i / 100);
+    2781:	c1 ea 05             	shr    $0x5,%edx
+    2784:	83 c2 30             	add    $0x30,%edx
+    2787:	88 55 df             	mov    %dl,-0x21(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+    278a:	f7 e3                	mul    %ebx
+    278c:	89 d1                	mov    %edx,%ecx
+    278e:	c1 e9 03             	shr    $0x3,%ecx
+    2791:	89 c8                	mov    %ecx,%eax
+    2793:	f7 e3                	mul    %ebx
+    2795:	89 c8                	mov    %ecx,%eax
+    2797:	c1 ea 03             	shr    $0x3,%edx
+    279a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    279d:	01 d2                	add    %edx,%edx
+    279f:	29 d0                	sub    %edx,%eax
+    name[3] = '0' + (i % 10);
+    27a1:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    name[2] = '0' + (i / 10) % 10;
+    27a4:	83 c0 30             	add    $0x30,%eax
+    name[3] = '0' + (i % 10);
+    27a7:	01 d2                	add    %edx,%edx
+    name[2] = '0' + (i / 10) % 10;
+    27a9:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '0' + (i % 10);
+    27ac:	89 f0                	mov    %esi,%eax
+    27ae:	29 d0                	sub    %edx,%eax
+    27b0:	83 c0 30             	add    $0x30,%eax
+    27b3:	88 45 e1             	mov    %al,-0x1f(%ebp)
+    if(link("db", name) != 0){
+    27b6:	8d 45 de             	lea    -0x22(%ebp),%eax
+    27b9:	50                   	push   %eax
+    27ba:	68 1d 53 00 00       	push   $0x531d
+    27bf:	e8 ef 1d 00 00       	call   45b3 <link>
+    27c4:	83 c4 10             	add    $0x10,%esp
+    27c7:	85 c0                	test   %eax,%eax
+    27c9:	0f 85 9a 01 00 00    	jne    2969 <dirbench+0x259>
+  for(i = 0; i < 1000; i++){
+    27cf:	83 c6 01             	add    $0x1,%esi
+    27d2:	81 fe e8 03 00 00    	cmp    $0x3e8,%esi
+    27d8:	75 96                	jne    2770 <dirbench+0x60>
+  t1 = uptime();
+    27da:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      name[1] = '0' + (i / 100);
+    27dd:	be 1f 85 eb 51       	mov    $0x51eb851f,%esi
+      name[2] = '0' + (i / 10) % 10;
+    27e2:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  t1 = uptime();
+    27e7:	e8 ff 1d 00 00       	call   45eb <uptime>
+    27ec:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+    27f3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  for(j = 0; j < 10; j++){
+    27f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27fd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i = 0; i < 1000; i++){
+    2800:	31 ff                	xor    %edi,%edi
+    2802:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + (i / 100);
+    2808:	89 f8                	mov    %edi,%eax
+      if((fd = open(name, O_RDONLY)) < 0){
+    280a:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'y';
+    280d:	c6 45 de 79          	movb   $0x79,-0x22(%ebp)
+      name[1] = '0' + (i / 100);
+    2811:	f7 e6                	mul    %esi
+      name[2] = '0' + (i / 10) % 10;
+    2813:	89 f8                	mov    %edi,%eax
+      name[4] = '\0';
+    2815:	c6 45 e2 00          	movb   $0x0,-0x1e(%ebp)
+      name[1] = '0' + (i / 100);
+    2819:	c1 ea 05             	shr    $0x5,%edx
+    281c:	83 c2 30             	add    $0x30,%edx
+    281f:	88 55 df             	mov    %dl,-0x21(%ebp)
+      name[2] = '0' + (i / 10) % 10;
+    2822:	f7 e3                	mul    %ebx
+    2824:	89 d1                	mov    %edx,%ecx
+    2826:	c1 e9 03             	shr    $0x3,%ecx
+    2829:	89 c8                	mov    %ecx,%eax
+    282b:	f7 e3                	mul    %ebx
+    282d:	89 c8                	mov    %ecx,%eax
+    282f:	c1 ea 03             	shr    $0x3,%edx
+    2832:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    2835:	01 d2                	add    %edx,%edx
+    2837:	29 d0                	sub    %edx,%eax
+      name[3] = '0' + (i % 10);
+    2839:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+      name[2] = '0' + (i / 10) % 10;
+    283c:	83 c0 30             	add    $0x30,%eax
+      name[3] = '0' + (i % 10);
+    283f:	01 d2                	add    %edx,%edx
+      name[2] = '0' + (i / 10) % 10;
+    2841:	88 45 e0             	mov    %al,-0x20(%ebp)
+      name[3] = '0' + (i % 10);
+    2844:	89 f8                	mov    %edi,%eax
+    2846:	29 d0                	sub    %edx,%eax
+    2848:	83 c0 30             	add    $0x30,%eax
+    284b:	88 45 e1             	mov    %al,-0x1f(%ebp)
+      if((fd = open(name, O_RDONLY)) < 0){
+    284e:	8d 45 de             	lea    -0x22(%ebp),%eax
+    2851:	6a 00                	push   $0x0
+    2853:	50                   	push   %eax
+    2854:	e8 3a 1d 00 00       	call   4593 <open>
+    2859:	83 c4 10             	add    $0x10,%esp
+    285c:	85 c0                	test   %eax,%eax
+    285e:	0f 88 f1 00 00 00    	js     2955 <dirbench+0x245>
+      close(fd);
+    2864:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; i < 1000; i++){
+    2867:	83 c7 01             	add    $0x1,%edi
+      close(fd);
+    286a:	50                   	push   %eax
+    286b:	e8 0b 1d 00 00       	call   457b <close>
+    for(i = 0; i < 1000; i++){
+    2870:	83 c4 10             	add    $0x10,%esp
+    2873:	81 ff e8 03 00 00    	cmp    $0x3e8,%edi
+    2879:	75 8d                	jne    2808 <dirbench+0xf8>
+  for(j = 0; j < 10; j++){
+    287b:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+    287f:	0f 85 7b ff ff ff    	jne    2800 <dirbench+0xf0>
+  t2 = uptime();
+    2885:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+    name[1] = '0' + (i / 100);
+    2888:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    name[2] = '0' + (i / 10) % 10;
+    288d:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  t2 = uptime();
+    2892:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+    2895:	e8 51 1d 00 00       	call   45eb <uptime>
+  unlink("db");
+    289a:	83 ec 0c             	sub    $0xc,%esp
+    289d:	68 1d 53 00 00       	push   $0x531d
+  t2 = uptime();
+    28a2:	89 c6                	mov    %eax,%esi
+  unlink("db");
+    28a4:	e8 fa 1c 00 00       	call   45a3 <unlink>
+    name[2] = '0' + (i / 10) % 10;
+    28a9:	89 75 c8             	mov    %esi,-0x38(%ebp)
+    28ac:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  unlink("db");
+    28af:	83 c4 10             	add    $0x10,%esp
+    28b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + (i / 100);
+    28b8:	89 c8                	mov    %ecx,%eax
+    if(unlink(name) != 0){
+    28ba:	83 ec 0c             	sub    $0xc,%esp
+    name[3] = '0' + (i % 10);
+    28bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+    name[1] = '0' + (i / 100);
+    28c0:	f7 e7                	mul    %edi
+    name[2] = '0' + (i / 10) % 10;
+    28c2:	89 c8                	mov    %ecx,%eax
+    name[0] = 'y';
+    28c4:	c6 45 de 79          	movb   $0x79,-0x22(%ebp)
+    name[4] = '\0';
+    28c8:	c6 45 e2 00          	movb   $0x0,-0x1e(%ebp)
+    name[1] = '0' + (i / 100);
+    28cc:	c1 ea 05             	shr    $0x5,%edx
+    28cf:	83 c2 30             	add    $0x30,%edx
+    28d2:	88 55 df             	mov    %dl,-0x21(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+    28d5:	f7 e3                	mul    %ebx
+    28d7:	89 d6                	mov    %edx,%esi
+    28d9:	c1 ee 03             	shr    $0x3,%esi
+    28dc:	89 f0                	mov    %esi,%eax
+    28de:	f7 e3                	mul    %ebx
+    28e0:	89 f0                	mov    %esi,%eax
+    28e2:	c1 ea 03             	shr    $0x3,%edx
+    28e5:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    28e8:	01 d2                	add    %edx,%edx
+    28ea:	29 d0                	sub    %edx,%eax
+    name[3] = '0' + (i % 10);
+    28ec:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+    name[2] = '0' + (i / 10) % 10;
+    28ef:	83 c0 30             	add    $0x30,%eax
+    name[3] = '0' + (i % 10);
+    28f2:	01 d2                	add    %edx,%edx
+    name[2] = '0' + (i / 10) % 10;
+    28f4:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '0' + (i % 10);
+    28f7:	89 c8                	mov    %ecx,%eax
+    28f9:	29 d0                	sub    %edx,%eax
+    28fb:	83 c0 30             	add    $0x30,%eax
+    28fe:	88 45 e1             	mov    %al,-0x1f(%ebp)
+    if(unlink(name) != 0){
+    2901:	8d 45 de             	lea    -0x22(%ebp),%eax
+    2904:	50                   	push   %eax
+    2905:	e8 99 1c 00 00       	call   45a3 <unlink>
+    290a:	83 c4 10             	add    $0x10,%esp
+    290d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    2910:	85 c0                	test   %eax,%eax
+    2912:	75 7c                	jne    2990 <dirbench+0x280>
+  for(i = 0; i < 1000; i++){
+    2914:	83 c1 01             	add    $0x1,%ecx
+    2917:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+    291d:	75 99                	jne    28b8 <dirbench+0x1a8>
+  printf(1, "dirbench: 1000 links %d ticks, 10000 opens %d ticks\n",
+    291f:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+    2922:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    2925:	29 d8                	sub    %ebx,%eax
+    2927:	50                   	push   %eax
+    2928:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    292b:	89 d8                	mov    %ebx,%eax
+    292d:	29 f0                	sub    %esi,%eax
+    292f:	50                   	push   %eax
+    2930:	68 0c 5f 00 00       	push   $0x5f0c
+    2935:	6a 01                	push   $0x1
+    2937:	e8 94 1d 00 00       	call   46d0 <printf>
+  printf(1, "dirbench ok\n");
+    293c:	58                   	pop    %eax
+    293d:	5a                   	pop    %edx
+    293e:	68 7c 53 00 00       	push   $0x537c
+    2943:	6a 01                	push   $0x1
+    2945:	e8 86 1d 00 00       	call   46d0 <printf>
+}
+    294a:	83 c4 10             	add    $0x10,%esp
+    294d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2950:	5b                   	pop    %ebx
+    2951:	5e                   	pop    %esi
+    2952:	5f                   	pop    %edi
+    2953:	5d                   	pop    %ebp
+    2954:	c3                   	ret
+        printf(1, "dirbench open failed\n");
+    2955:	83 ec 08             	sub    $0x8,%esp
+    2958:	68 4e 53 00 00       	push   $0x534e
+    295d:	6a 01                	push   $0x1
+    295f:	e8 6c 1d 00 00       	call   46d0 <printf>
+        exit();
+    2964:	e8 ea 1b 00 00       	call   4553 <exit>
+      printf(1, "dirbench link failed\n");
+    2969:	83 ec 08             	sub    $0x8,%esp
+    296c:	68 38 53 00 00       	push   $0x5338
+    2971:	6a 01                	push   $0x1
+    2973:	e8 58 1d 00 00       	call   46d0 <printf>
+      exit();
+    2978:	e8 d6 1b 00 00       	call   4553 <exit>
+    printf(1, "dirbench create failed\n");
+    297d:	51                   	push   %ecx
+    297e:	51                   	push   %ecx
+    297f:	68 20 53 00 00       	push   $0x5320
+    2984:	6a 01                	push   $0x1
+    2986:	e8 45 1d 00 00       	call   46d0 <printf>
+    exit();
+    298b:	e8 c3 1b 00 00       	call   4553 <exit>
+      printf(1, "dirbench unlink failed\n");
+    2990:	83 ec 08             	sub    $0x8,%esp
+    2993:	68 64 53 00 00       	push   $0x5364
+    2998:	6a 01                	push   $0x1
+    299a:	e8 31 1d 00 00       	call   46d0 <printf>
+      exit();
+    299f:	e8 af 1b 00 00       	call   4553 <exit>
+    29a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    29af:	90                   	nop
+
+000029b0 <subdir>:
+{
+    29b0:	55                   	push   %ebp
+    29b1:	89 e5                	mov    %esp,%ebp
+    29b3:	53                   	push   %ebx
+    29b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    29b7:	68 89 53 00 00       	push   $0x5389
+    29bc:	6a 01                	push   $0x1
+    29be:	e8 0d 1d 00 00       	call   46d0 <printf>
+  unlink("ff");
+    29c3:	c7 04 24 12 54 00 00 	movl   $0x5412,(%esp)
+    29ca:	e8 d4 1b 00 00       	call   45a3 <unlink>
+  if(mkdir("dd") != 0){
+    29cf:	c7 04 24 af 54 00 00 	movl   $0x54af,(%esp)
+    29d6:	e8 e0 1b 00 00       	call   45bb <mkdir>
+    29db:	83 c4 10             	add    $0x10,%esp
+    29de:	85 c0                	test   %eax,%eax
+    29e0:	0f 85 b3 05 00 00    	jne    2f99 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    29e6:	83 ec 08             	sub    $0x8,%esp
+    29e9:	68 02 02 00 00       	push   $0x202
+    29ee:	68 e8 53 00 00       	push   $0x53e8
+    29f3:	e8 9b 1b 00 00       	call   4593 <open>
+  if(fd < 0){
+    29f8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    29fb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    29fd:	85 c0                	test   %eax,%eax
+    29ff:	0f 88 81 05 00 00    	js     2f86 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2a05:	83 ec 04             	sub    $0x4,%esp
+    2a08:	6a 02                	push   $0x2
+    2a0a:	68 12 54 00 00       	push   $0x5412
+    2a0f:	50                   	push   %eax
+    2a10:	e8 5e 1b 00 00       	call   4573 <write>
+  close(fd);
+    2a15:	89 1c 24             	mov    %ebx,(%esp)
+    2a18:	e8 5e 1b 00 00       	call   457b <close>
+  if(unlink("dd") >= 0){
+    2a1d:	c7 04 24 af 54 00 00 	movl   $0x54af,(%esp)
+    2a24:	e8 7a 1b 00 00       	call   45a3 <unlink>
+    2a29:	83 c4 10             	add    $0x10,%esp
+    2a2c:	85 c0                	test   %eax,%eax
+    2a2e:	0f 89 3f 05 00 00    	jns    2f73 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2a34:	83 ec 0c             	sub    $0xc,%esp
+    2a37:	68 c3 53 00 00       	push   $0x53c3
+    2a3c:	e8 7a 1b 00 00       	call   45bb <mkdir>
+    2a41:	83 c4 10             	add    $0x10,%esp
+    2a44:	85 c0                	test   %eax,%eax
+    2a46:	0f 85 14 05 00 00    	jne    2f60 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2a4c:	83 ec 08             	sub    $0x8,%esp
+    2a4f:	68 02 02 00 00       	push   $0x202
+    2a54:	68 e5 53 00 00       	push   $0x53e5
+    2a59:	e8 35 1b 00 00       	call   4593 <open>
+  if(fd < 0){
+    2a5e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2a61:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2a63:	85 c0                	test   %eax,%eax
+    2a65:	0f 88 24 04 00 00    	js     2e8f <subdir+0x4df>
+  write(fd, "FF", 2);
+    2a6b:	83 ec 04             	sub    $0x4,%esp
+    2a6e:	6a 02                	push   $0x2
+    2a70:	68 06 54 00 00       	push   $0x5406
+    2a75:	50                   	push   %eax
+    2a76:	e8 f8 1a 00 00       	call   4573 <write>
+  close(fd);
+    2a7b:	89 1c 24             	mov    %ebx,(%esp)
+    2a7e:	e8 f8 1a 00 00       	call   457b <close>
+  fd = open("dd/dd/../ff", 0);
+    2a83:	58                   	pop    %eax
+    2a84:	5a                   	pop    %edx
+    2a85:	6a 00                	push   $0x0
+    2a87:	68 09 54 00 00       	push   $0x5409
+    2a8c:	e8 02 1b 00 00       	call   4593 <open>
+  if(fd < 0){
+    2a91:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2a94:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2a96:	85 c0                	test   %eax,%eax
+    2a98:	0f 88 de 03 00 00    	js     2e7c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    2a9e:	83 ec 04             	sub    $0x4,%esp
+    2aa1:	68 00 20 00 00       	push   $0x2000
+    2aa6:	68 e0 95 00 00       	push   $0x95e0
+    2aab:	50                   	push   %eax
+    2aac:	e8 ba 1a 00 00       	call   456b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2ab1:	83 c4 10             	add    $0x10,%esp
+    2ab4:	83 f8 02             	cmp    $0x2,%eax
+    2ab7:	0f 85 3a 03 00 00    	jne    2df7 <subdir+0x447>
+    2abd:	80 3d e0 95 00 00 66 	cmpb   $0x66,0x95e0
+    2ac4:	0f 85 2d 03 00 00    	jne    2df7 <subdir+0x447>
+  close(fd);
+    2aca:	83 ec 0c             	sub    $0xc,%esp
+    2acd:	53                   	push   %ebx
+    2ace:	e8 a8 1a 00 00       	call   457b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2ad3:	59                   	pop    %ecx
+    2ad4:	5b                   	pop    %ebx
+    2ad5:	68 49 54 00 00       	push   $0x5449
+    2ada:	68 e5 53 00 00       	push   $0x53e5
+    2adf:	e8 cf 1a 00 00       	call   45b3 <link>
+    2ae4:	83 c4 10             	add    $0x10,%esp
+    2ae7:	85 c0                	test   %eax,%eax
+    2ae9:	0f 85 c6 03 00 00    	jne    2eb5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    2aef:	83 ec 0c             	sub    $0xc,%esp
+    2af2:	68 e5 53 00 00       	push   $0x53e5
+    2af7:	e8 a7 1a 00 00       	call   45a3 <unlink>
+    2afc:	83 c4 10             	add    $0x10,%esp
+    2aff:	85 c0                	test   %eax,%eax
+    2b01:	0f 85 16 03 00 00    	jne    2e1d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2b07:	83 ec 08             	sub    $0x8,%esp
+    2b0a:	6a 00                	push   $0x0
+    2b0c:	68 e5 53 00 00       	push   $0x53e5
+    2b11:	e8 7d 1a 00 00       	call   4593 <open>
+    2b16:	83 c4 10             	add    $0x10,%esp
+    2b19:	85 c0                	test   %eax,%eax
+    2b1b:	0f 89 2c 04 00 00    	jns    2f4d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2b21:	83 ec 0c             	sub    $0xc,%esp
+    2b24:	68 af 54 00 00       	push   $0x54af
+    2b29:	e8 95 1a 00 00       	call   45c3 <chdir>
+    2b2e:	83 c4 10             	add    $0x10,%esp
+    2b31:	85 c0                	test   %eax,%eax
+    2b33:	0f 85 01 04 00 00    	jne    2f3a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2b39:	83 ec 0c             	sub    $0xc,%esp
+    2b3c:	68 7d 54 00 00       	push   $0x547d
+    2b41:	e8 7d 1a 00 00       	call   45c3 <chdir>
+    2b46:	83 c4 10             	add    $0x10,%esp
+    2b49:	85 c0                	test   %eax,%eax
+    2b4b:	0f 85 b9 02 00 00    	jne    2e0a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2b51:	83 ec 0c             	sub    $0xc,%esp
+    2b54:	68 a3 54 00 00       	push   $0x54a3
+    2b59:	e8 65 1a 00 00       	call   45c3 <chdir>
+    2b5e:	83 c4 10             	add    $0x10,%esp
+    2b61:	85 c0                	test   %eax,%eax
+    2b63:	0f 85 a1 02 00 00    	jne    2e0a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2b69:	83 ec 0c             	sub    $0xc,%esp
+    2b6c:	68 b2 54 00 00       	push   $0x54b2
+    2b71:	e8 4d 1a 00 00       	call   45c3 <chdir>
+    2b76:	83 c4 10             	add    $0x10,%esp
+    2b79:	85 c0                	test   %eax,%eax
+    2b7b:	0f 85 21 03 00 00    	jne    2ea2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2b81:	83 ec 08             	sub    $0x8,%esp
+    2b84:	6a 00                	push   $0x0
+    2b86:	68 49 54 00 00       	push   $0x5449
+    2b8b:	e8 03 1a 00 00       	call   4593 <open>
+  if(fd < 0){
+    2b90:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2b93:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2b95:	85 c0                	test   %eax,%eax
+    2b97:	0f 88 e0 04 00 00    	js     307d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2b9d:	83 ec 04             	sub    $0x4,%esp
+    2ba0:	68 00 20 00 00       	push   $0x2000
+    2ba5:	68 e0 95 00 00       	push   $0x95e0
+    2baa:	50                   	push   %eax
+    2bab:	e8 bb 19 00 00       	call   456b <read>
+    2bb0:	83 c4 10             	add    $0x10,%esp
+    2bb3:	83 f8 02             	cmp    $0x2,%eax
+    2bb6:	0f 85 ae 04 00 00    	jne    306a <subdir+0x6ba>
+  close(fd);
+    2bbc:	83 ec 0c             	sub    $0xc,%esp
+    2bbf:	53                   	push   %ebx
+    2bc0:	e8 b6 19 00 00       	call   457b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2bc5:	58                   	pop    %eax
+    2bc6:	5a                   	pop    %edx
+    2bc7:	6a 00                	push   $0x0
+    2bc9:	68 e5 53 00 00       	push   $0x53e5
+    2bce:	e8 c0 19 00 00       	call   4593 <open>
+    2bd3:	83 c4 10             	add    $0x10,%esp
+    2bd6:	85 c0                	test   %eax,%eax
+    2bd8:	0f 89 65 02 00 00    	jns    2e43 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2bde:	83 ec 08             	sub    $0x8,%esp
+    2be1:	68 02 02 00 00       	push   $0x202
+    2be6:	68 fd 54 00 00       	push   $0x54fd
+    2beb:	e8 a3 19 00 00       	call   4593 <open>
+    2bf0:	83 c4 10             	add    $0x10,%esp
+    2bf3:	85 c0                	test   %eax,%eax
+    2bf5:	0f 89 35 02 00 00    	jns    2e30 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2bfb:	83 ec 08             	sub    $0x8,%esp
+    2bfe:	68 02 02 00 00       	push   $0x202
+    2c03:	68 22 55 00 00       	push   $0x5522
+    2c08:	e8 86 19 00 00       	call   4593 <open>
+    2c0d:	83 c4 10             	add    $0x10,%esp
+    2c10:	85 c0                	test   %eax,%eax
+    2c12:	0f 89 0f 03 00 00    	jns    2f27 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2c18:	83 ec 08             	sub    $0x8,%esp
+    2c1b:	68 00 02 00 00       	push   $0x200
+    2c20:	68 af 54 00 00       	push   $0x54af
+    2c25:	e8 69 19 00 00       	call   4593 <open>
+    2c2a:	83 c4 10             	add    $0x10,%esp
+    2c2d:	85 c0                	test   %eax,%eax
+    2c2f:	0f 89 df 02 00 00    	jns    2f14 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2c35:	83 ec 08             	sub    $0x8,%esp
+    2c38:	6a 02                	push   $0x2
+    2c3a:	68 af 54 00 00       	push   $0x54af
+    2c3f:	e8 4f 19 00 00       	call   4593 <open>
+    2c44:	83 c4 10             	add    $0x10,%esp
+    2c47:	85 c0                	test   %eax,%eax
+    2c49:	0f 89 b2 02 00 00    	jns    2f01 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    2c4f:	83 ec 08             	sub    $0x8,%esp
+    2c52:	6a 01                	push   $0x1
+    2c54:	68 af 54 00 00       	push   $0x54af
+    2c59:	e8 35 19 00 00       	call   4593 <open>
+    2c5e:	83 c4 10             	add    $0x10,%esp
+    2c61:	85 c0                	test   %eax,%eax
+    2c63:	0f 89 85 02 00 00    	jns    2eee <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2c69:	83 ec 08             	sub    $0x8,%esp
+    2c6c:	68 91 55 00 00       	push   $0x5591
+    2c71:	68 fd 54 00 00       	push   $0x54fd
+    2c76:	e8 38 19 00 00       	call   45b3 <link>
+    2c7b:	83 c4 10             	add    $0x10,%esp
+    2c7e:	85 c0                	test   %eax,%eax
+    2c80:	0f 84 55 02 00 00    	je     2edb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2c86:	83 ec 08             	sub    $0x8,%esp
+    2c89:	68 91 55 00 00       	push   $0x5591
+    2c8e:	68 22 55 00 00       	push   $0x5522
+    2c93:	e8 1b 19 00 00       	call   45b3 <link>
+    2c98:	83 c4 10             	add    $0x10,%esp
+    2c9b:	85 c0                	test   %eax,%eax
+    2c9d:	0f 84 25 02 00 00    	je     2ec8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2ca3:	83 ec 08             	sub    $0x8,%esp
+    2ca6:	68 49 54 00 00       	push   $0x5449
+    2cab:	68 e8 53 00 00       	push   $0x53e8
+    2cb0:	e8 fe 18 00 00       	call   45b3 <link>
+    2cb5:	83 c4 10             	add    $0x10,%esp
+    2cb8:	85 c0                	test   %eax,%eax
+    2cba:	0f 84 a9 01 00 00    	je     2e69 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2cc0:	83 ec 0c             	sub    $0xc,%esp
+    2cc3:	68 fd 54 00 00       	push   $0x54fd
+    2cc8:	e8 ee 18 00 00       	call   45bb <mkdir>
+    2ccd:	83 c4 10             	add    $0x10,%esp
+    2cd0:	85 c0                	test   %eax,%eax
+    2cd2:	0f 84 7e 01 00 00    	je     2e56 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2cd8:	83 ec 0c             	sub    $0xc,%esp
+    2cdb:	68 22 55 00 00       	push   $0x5522
+    2ce0:	e8 d6 18 00 00       	call   45bb <mkdir>
+    2ce5:	83 c4 10             	add    $0x10,%esp
+    2ce8:	85 c0                	test   %eax,%eax
+    2cea:	0f 84 67 03 00 00    	je     3057 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2cf0:	83 ec 0c             	sub    $0xc,%esp
+    2cf3:	68 49 54 00 00       	push   $0x5449
+    2cf8:	e8 be 18 00 00       	call   45bb <mkdir>
+    2cfd:	83 c4 10             	add    $0x10,%esp
+    2d00:	85 c0                	test   %eax,%eax
+    2d02:	0f 84 3c 03 00 00    	je     3044 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2d08:	83 ec 0c             	sub    $0xc,%esp
+    2d0b:	68 22 55 00 00       	push   $0x5522
+    2d10:	e8 8e 18 00 00       	call   45a3 <unlink>
+    2d15:	83 c4 10             	add    $0x10,%esp
+    2d18:	85 c0                	test   %eax,%eax
+    2d1a:	0f 84 11 03 00 00    	je     3031 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2d20:	83 ec 0c             	sub    $0xc,%esp
+    2d23:	68 fd 54 00 00       	push   $0x54fd
+    2d28:	e8 76 18 00 00       	call   45a3 <unlink>
+    2d2d:	83 c4 10             	add    $0x10,%esp
+    2d30:	85 c0                	test   %eax,%eax
+    2d32:	0f 84 e6 02 00 00    	je     301e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2d38:	83 ec 0c             	sub    $0xc,%esp
+    2d3b:	68 e8 53 00 00       	push   $0x53e8
+    2d40:	e8 7e 18 00 00       	call   45c3 <chdir>
+    2d45:	83 c4 10             	add    $0x10,%esp
+    2d48:	85 c0                	test   %eax,%eax
+    2d4a:	0f 84 bb 02 00 00    	je     300b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2d50:	83 ec 0c             	sub    $0xc,%esp
+    2d53:	68 94 55 00 00       	push   $0x5594
+    2d58:	e8 66 18 00 00       	call   45c3 <chdir>
+    2d5d:	83 c4 10             	add    $0x10,%esp
+    2d60:	85 c0                	test   %eax,%eax
+    2d62:	0f 84 90 02 00 00    	je     2ff8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2d68:	83 ec 0c             	sub    $0xc,%esp
+    2d6b:	68 49 54 00 00       	push   $0x5449
+    2d70:	e8 2e 18 00 00       	call   45a3 <unlink>
+    2d75:	83 c4 10             	add    $0x10,%esp
+    2d78:	85 c0                	test   %eax,%eax
+    2d7a:	0f 85 9d 00 00 00    	jne    2e1d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2d80:	83 ec 0c             	sub    $0xc,%esp
+    2d83:	68 e8 53 00 00       	push   $0x53e8
+    2d88:	e8 16 18 00 00       	call   45a3 <unlink>
+    2d8d:	83 c4 10             	add    $0x10,%esp
+    2d90:	85 c0                	test   %eax,%eax
+    2d92:	0f 85 4d 02 00 00    	jne    2fe5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2d98:	83 ec 0c             	sub    $0xc,%esp
+    2d9b:	68 af 54 00 00       	push   $0x54af
+    2da0:	e8 fe 17 00 00       	call   45a3 <unlink>
+    2da5:	83 c4 10             	add    $0x10,%esp
+    2da8:	85 c0                	test   %eax,%eax
+    2daa:	0f 84 22 02 00 00    	je     2fd2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2db0:	83 ec 0c             	sub    $0xc,%esp
+    2db3:	68 c4 53 00 00       	push   $0x53c4
+    2db8:	e8 e6 17 00 00       	call   45a3 <unlink>
+    2dbd:	83 c4 10             	add    $0x10,%esp
+    2dc0:	85 c0                	test   %eax,%eax
+    2dc2:	0f 88 f7 01 00 00    	js     2fbf <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2dc8:	83 ec 0c             	sub    $0xc,%esp
+    2dcb:	68 af 54 00 00       	push   $0x54af
+    2dd0:	e8 ce 17 00 00       	call   45a3 <unlink>
+    2dd5:	83 c4 10             	add    $0x10,%esp
+    2dd8:	85 c0                	test   %eax,%eax
+    2dda:	0f 88 cc 01 00 00    	js     2fac <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2de0:	83 ec 08             	sub    $0x8,%esp
+    2de3:	68 91 56 00 00       	push   $0x5691
+    2de8:	6a 01                	push   $0x1
+    2dea:	e8 e1 18 00 00       	call   46d0 <printf>
+}
+    2def:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2df2:	83 c4 10             	add    $0x10,%esp
+    2df5:	c9                   	leave
+    2df6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2df7:	50                   	push   %eax
+    2df8:	50                   	push   %eax
+    2df9:	68 2e 54 00 00       	push   $0x542e
+    2dfe:	6a 01                	push   $0x1
+    2e00:	e8 cb 18 00 00       	call   46d0 <printf>
+    exit();
+    2e05:	e8 49 17 00 00       	call   4553 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2e0a:	50                   	push   %eax
+    2e0b:	50                   	push   %eax
+    2e0c:	68 89 54 00 00       	push   $0x5489
+    2e11:	6a 01                	push   $0x1
+    2e13:	e8 b8 18 00 00       	call   46d0 <printf>
+    exit();
+    2e18:	e8 36 17 00 00       	call   4553 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2e1d:	50                   	push   %eax
+    2e1e:	50                   	push   %eax
+    2e1f:	68 54 54 00 00       	push   $0x5454
+    2e24:	6a 01                	push   $0x1
+    2e26:	e8 a5 18 00 00       	call   46d0 <printf>
+    exit();
+    2e2b:	e8 23 17 00 00       	call   4553 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2e30:	51                   	push   %ecx
+    2e31:	51                   	push   %ecx
+    2e32:	68 06 55 00 00       	push   $0x5506
+    2e37:	6a 01                	push   $0x1
+    2e39:	e8 92 18 00 00       	call   46d0 <printf>
+    exit();
+    2e3e:	e8 10 17 00 00       	call   4553 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2e43:	53                   	push   %ebx
+    2e44:	53                   	push   %ebx
+    2e45:	68 b4 5f 00 00       	push   $0x5fb4
+    2e4a:	6a 01                	push   $0x1
+    2e4c:	e8 7f 18 00 00       	call   46d0 <printf>
+    exit();
+    2e51:	e8 fd 16 00 00       	call   4553 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2e56:	51                   	push   %ecx
+    2e57:	51                   	push   %ecx
+    2e58:	68 9a 55 00 00       	push   $0x559a
+    2e5d:	6a 01                	push   $0x1
+    2e5f:	e8 6c 18 00 00       	call   46d0 <printf>
+    exit();
+    2e64:	e8 ea 16 00 00       	call   4553 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2e69:	53                   	push   %ebx
+    2e6a:	53                   	push   %ebx
+    2e6b:	68 24 60 00 00       	push   $0x6024
+    2e70:	6a 01                	push   $0x1
+    2e72:	e8 59 18 00 00       	call   46d0 <printf>
+    exit();
+    2e77:	e8 d7 16 00 00       	call   4553 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    2e7c:	50                   	push   %eax
+    2e7d:	50                   	push   %eax
+    2e7e:	68 15 54 00 00       	push   $0x5415
+    2e83:	6a 01                	push   $0x1
+    2e85:	e8 46 18 00 00       	call   46d0 <printf>
+    exit();
+    2e8a:	e8 c4 16 00 00       	call   4553 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    2e8f:	51                   	push   %ecx
+    2e90:	51                   	push   %ecx
+    2e91:	68 ee 53 00 00       	push   $0x53ee
+    2e96:	6a 01                	push   $0x1
+    2e98:	e8 33 18 00 00       	call   46d0 <printf>
+    exit();
+    2e9d:	e8 b1 16 00 00       	call   4553 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2ea2:	50                   	push   %eax
+    2ea3:	50                   	push   %eax
+    2ea4:	68 b7 54 00 00       	push   $0x54b7
+    2ea9:	6a 01                	push   $0x1
+    2eab:	e8 20 18 00 00       	call   46d0 <printf>
+    exit();
+    2eb0:	e8 9e 16 00 00       	call   4553 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2eb5:	52                   	push   %edx
+    2eb6:	52                   	push   %edx
+    2eb7:	68 6c 5f 00 00       	push   $0x5f6c
+    2ebc:	6a 01                	push   $0x1
+    2ebe:	e8 0d 18 00 00       	call   46d0 <printf>
+    exit();
+    2ec3:	e8 8b 16 00 00       	call   4553 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2ec8:	50                   	push   %eax
+    2ec9:	50                   	push   %eax
+    2eca:	68 00 60 00 00       	push   $0x6000
+    2ecf:	6a 01                	push   $0x1
+    2ed1:	e8 fa 17 00 00       	call   46d0 <printf>
+    exit();
+    2ed6:	e8 78 16 00 00       	call   4553 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    2edb:	50                   	push   %eax
+    2edc:	50                   	push   %eax
+    2edd:	68 dc 5f 00 00       	push   $0x5fdc
+    2ee2:	6a 01                	push   $0x1
+    2ee4:	e8 e7 17 00 00       	call   46d0 <printf>
+    exit();
+    2ee9:	e8 65 16 00 00       	call   4553 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    2eee:	50                   	push   %eax
+    2eef:	50                   	push   %eax
+    2ef0:	68 76 55 00 00       	push   $0x5576
+    2ef5:	6a 01                	push   $0x1
+    2ef7:	e8 d4 17 00 00       	call   46d0 <printf>
+    exit();
+    2efc:	e8 52 16 00 00       	call   4553 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2f01:	50                   	push   %eax
+    2f02:	50                   	push   %eax
+    2f03:	68 5d 55 00 00       	push   $0x555d
+    2f08:	6a 01                	push   $0x1
+    2f0a:	e8 c1 17 00 00       	call   46d0 <printf>
+    exit();
+    2f0f:	e8 3f 16 00 00       	call   4553 <exit>
+    printf(1, "create dd succeeded!\n");
+    2f14:	50                   	push   %eax
+    2f15:	50                   	push   %eax
+    2f16:	68 47 55 00 00       	push   $0x5547
+    2f1b:	6a 01                	push   $0x1
+    2f1d:	e8 ae 17 00 00       	call   46d0 <printf>
+    exit();
+    2f22:	e8 2c 16 00 00       	call   4553 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2f27:	52                   	push   %edx
+    2f28:	52                   	push   %edx
+    2f29:	68 2b 55 00 00       	push   $0x552b
+    2f2e:	6a 01                	push   $0x1
+    2f30:	e8 9b 17 00 00       	call   46d0 <printf>
+    exit();
+    2f35:	e8 19 16 00 00       	call   4553 <exit>
+    printf(1, "chdir dd failed\n");
+    2f3a:	50                   	push   %eax
+    2f3b:	50                   	push   %eax
+    2f3c:	68 6c 54 00 00       	push   $0x546c
+    2f41:	6a 01                	push   $0x1
+    2f43:	e8 88 17 00 00       	call   46d0 <printf>
+    exit();
+    2f48:	e8 06 16 00 00       	call   4553 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2f4d:	50                   	push   %eax
+    2f4e:	50                   	push   %eax
+    2f4f:	68 90 5f 00 00       	push   $0x5f90
+    2f54:	6a 01                	push   $0x1
+    2f56:	e8 75 17 00 00       	call   46d0 <printf>
+    exit();
+    2f5b:	e8 f3 15 00 00       	call   4553 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2f60:	53                   	push   %ebx
+    2f61:	53                   	push   %ebx
+    2f62:	68 ca 53 00 00       	push   $0x53ca
+    2f67:	6a 01                	push   $0x1
+    2f69:	e8 62 17 00 00       	call   46d0 <printf>
+    exit();
+    2f6e:	e8 e0 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2f73:	50                   	push   %eax
+    2f74:	50                   	push   %eax
+    2f75:	68 44 5f 00 00       	push   $0x5f44
+    2f7a:	6a 01                	push   $0x1
+    2f7c:	e8 4f 17 00 00       	call   46d0 <printf>
+    exit();
+    2f81:	e8 cd 15 00 00       	call   4553 <exit>
+    printf(1, "create dd/ff failed\n");
+    2f86:	50                   	push   %eax
+    2f87:	50                   	push   %eax
+    2f88:	68 ae 53 00 00       	push   $0x53ae
+    2f8d:	6a 01                	push   $0x1
+    2f8f:	e8 3c 17 00 00       	call   46d0 <printf>
+    exit();
+    2f94:	e8 ba 15 00 00       	call   4553 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2f99:	50                   	push   %eax
+    2f9a:	50                   	push   %eax
+    2f9b:	68 96 53 00 00       	push   $0x5396
+    2fa0:	6a 01                	push   $0x1
+    2fa2:	e8 29 17 00 00       	call   46d0 <printf>
+    exit();
+    2fa7:	e8 a7 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd failed\n");
+    2fac:	50                   	push   %eax
+    2fad:	50                   	push   %eax
+    2fae:	68 7f 56 00 00       	push   $0x567f
+    2fb3:	6a 01                	push   $0x1
+    2fb5:	e8 16 17 00 00       	call   46d0 <printf>
+    exit();
+    2fba:	e8 94 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2fbf:	52                   	push   %edx
+    2fc0:	52                   	push   %edx
+    2fc1:	68 6a 56 00 00       	push   $0x566a
+    2fc6:	6a 01                	push   $0x1
+    2fc8:	e8 03 17 00 00       	call   46d0 <printf>
+    exit();
+    2fcd:	e8 81 15 00 00       	call   4553 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2fd2:	51                   	push   %ecx
+    2fd3:	51                   	push   %ecx
+    2fd4:	68 48 60 00 00       	push   $0x6048
+    2fd9:	6a 01                	push   $0x1
+    2fdb:	e8 f0 16 00 00       	call   46d0 <printf>
+    exit();
+    2fe0:	e8 6e 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2fe5:	53                   	push   %ebx
+    2fe6:	53                   	push   %ebx
+    2fe7:	68 55 56 00 00       	push   $0x5655
+    2fec:	6a 01                	push   $0x1
+    2fee:	e8 dd 16 00 00       	call   46d0 <printf>
+    exit();
+    2ff3:	e8 5b 15 00 00       	call   4553 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2ff8:	50                   	push   %eax
+    2ff9:	50                   	push   %eax
+    2ffa:	68 3d 56 00 00       	push   $0x563d
+    2fff:	6a 01                	push   $0x1
+    3001:	e8 ca 16 00 00       	call   46d0 <printf>
+    exit();
+    3006:	e8 48 15 00 00       	call   4553 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    300b:	50                   	push   %eax
+    300c:	50                   	push   %eax
+    300d:	68 25 56 00 00       	push   $0x5625
+    3012:	6a 01                	push   $0x1
+    3014:	e8 b7 16 00 00       	call   46d0 <printf>
+    exit();
+    3019:	e8 35 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    301e:	50                   	push   %eax
+    301f:	50                   	push   %eax
+    3020:	68 09 56 00 00       	push   $0x5609
+    3025:	6a 01                	push   $0x1
+    3027:	e8 a4 16 00 00       	call   46d0 <printf>
+    exit();
+    302c:	e8 22 15 00 00       	call   4553 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3031:	50                   	push   %eax
+    3032:	50                   	push   %eax
+    3033:	68 ed 55 00 00       	push   $0x55ed
+    3038:	6a 01                	push   $0x1
+    303a:	e8 91 16 00 00       	call   46d0 <printf>
+    exit();
+    303f:	e8 0f 15 00 00       	call   4553 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3044:	50                   	push   %eax
+    3045:	50                   	push   %eax
+    3046:	68 d0 55 00 00       	push   $0x55d0
+    304b:	6a 01                	push   $0x1
+    304d:	e8 7e 16 00 00       	call   46d0 <printf>
+    exit();
+    3052:	e8 fc 14 00 00       	call   4553 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3057:	52                   	push   %edx
+    3058:	52                   	push   %edx
+    3059:	68 b5 55 00 00       	push   $0x55b5
+    305e:	6a 01                	push   $0x1
+    3060:	e8 6b 16 00 00       	call   46d0 <printf>
+    exit();
+    3065:	e8 e9 14 00 00       	call   4553 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    306a:	51                   	push   %ecx
+    306b:	51                   	push   %ecx
+    306c:	68 e2 54 00 00       	push   $0x54e2
+    3071:	6a 01                	push   $0x1
+    3073:	e8 58 16 00 00       	call   46d0 <printf>
+    exit();
+    3078:	e8 d6 14 00 00       	call   4553 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    307d:	53                   	push   %ebx
+    307e:	53                   	push   %ebx
+    307f:	68 ca 54 00 00       	push   $0x54ca
+    3084:	6a 01                	push   $0x1
+    3086:	e8 45 16 00 00       	call   46d0 <printf>
+    exit();
+    308b:	e8 c3 14 00 00       	call   4553 <exit>
+
+00003090 <bigwrite>:
+{
+    3090:	55                   	push   %ebp
+    3091:	89 e5                	mov    %esp,%ebp
+    3093:	56                   	push   %esi
+    3094:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    3095:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    309a:	83 ec 08             	sub    $0x8,%esp
+    309d:	68 9c 56 00 00       	push   $0x569c
+    30a2:	6a 01                	push   $0x1
+    30a4:	e8 27 16 00 00       	call   46d0 <printf>
+  unlink("bigwrite");
+    30a9:	c7 04 24 ab 56 00 00 	movl   $0x56ab,(%esp)
+    30b0:	e8 ee 14 00 00       	call   45a3 <unlink>
+    30b5:	83 c4 10             	add    $0x10,%esp
+    30b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    30bf:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    30c0:	83 ec 08             	sub    $0x8,%esp
+    30c3:	68 02 02 00 00       	push   $0x202
+    30c8:	68 ab 56 00 00       	push   $0x56ab
+    30cd:	e8 c1 14 00 00       	call   4593 <open>
+    if(fd < 0){
+    30d2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    30d5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    30d7:	85 c0                	test   %eax,%eax
+    30d9:	78 7e                	js     3159 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    30db:	83 ec 04             	sub    $0x4,%esp
+    30de:	53                   	push   %ebx
+    30df:	68 e0 95 00 00       	push   $0x95e0
+    30e4:	50                   	push   %eax
+    30e5:	e8 89 14 00 00       	call   4573 <write>
+      if(cc != sz){
+    30ea:	83 c4 10             	add    $0x10,%esp
+    30ed:	39 d8                	cmp    %ebx,%eax
+    30ef:	75 55                	jne    3146 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    30f1:	83 ec 04             	sub    $0x4,%esp
+    30f4:	53                   	push   %ebx
+    30f5:	68 e0 95 00 00       	push   $0x95e0
+    30fa:	56                   	push   %esi
+    30fb:	e8 73 14 00 00       	call   4573 <write>
+      if(cc != sz){
+    3100:	83 c4 10             	add    $0x10,%esp
+    3103:	39 c3                	cmp    %eax,%ebx
+    3105:	75 3f                	jne    3146 <bigwrite+0xb6>
+    close(fd);
+    3107:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    310a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    3110:	56                   	push   %esi
+    3111:	e8 65 14 00 00       	call   457b <close>
+    unlink("bigwrite");
+    3116:	c7 04 24 ab 56 00 00 	movl   $0x56ab,(%esp)
+    311d:	e8 81 14 00 00       	call   45a3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3122:	83 c4 10             	add    $0x10,%esp
+    3125:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    312b:	75 93                	jne    30c0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    312d:	83 ec 08             	sub    $0x8,%esp
+    3130:	68 de 56 00 00       	push   $0x56de
+    3135:	6a 01                	push   $0x1
+    3137:	e8 94 15 00 00       	call   46d0 <printf>
+}
+    313c:	83 c4 10             	add    $0x10,%esp
+    313f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3142:	5b                   	pop    %ebx
+    3143:	5e                   	pop    %esi
+    3144:	5d                   	pop    %ebp
+    3145:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    3146:	50                   	push   %eax
+    3147:	53                   	push   %ebx
+    3148:	68 cc 56 00 00       	push   $0x56cc
+    314d:	6a 01                	push   $0x1
+    314f:	e8 7c 15 00 00       	call   46d0 <printf>
+        exit();
+    3154:	e8 fa 13 00 00       	call   4553 <exit>
+      printf(1, "cannot create bigwrite\n");
+    3159:	83 ec 08             	sub    $0x8,%esp
+    315c:	68 b4 56 00 00       	push   $0x56b4
+    3161:	6a 01                	push   $0x1
+    3163:	e8 68 15 00 00       	call   46d0 <printf>
+      exit();
+    3168:	e8 e6 13 00 00       	call   4553 <exit>
+    316d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003170 <bigfile>:
+{
+    3170:	55                   	push   %ebp
+    3171:	89 e5                	mov    %esp,%ebp
+    3173:	57                   	push   %edi
+    3174:	56                   	push   %esi
+    3175:	53                   	push   %ebx
+    3176:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    3179:	68 eb 56 00 00       	push   $0x56eb
+    317e:	6a 01                	push   $0x1
+    3180:	e8 4b 15 00 00       	call   46d0 <printf>
+  unlink("bigfile");
+    3185:	c7 04 24 07 57 00 00 	movl   $0x5707,(%esp)
+    318c:	e8 12 14 00 00       	call   45a3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3191:	58                   	pop    %eax
+    3192:	5a                   	pop    %edx
+    3193:	68 02 02 00 00       	push   $0x202
+    3198:	68 07 57 00 00       	push   $0x5707
+    319d:	e8 f1 13 00 00       	call   4593 <open>
+  if(fd < 0){
+    31a2:	83 c4 10             	add    $0x10,%esp
+    31a5:	85 c0                	test   %eax,%eax
+    31a7:	0f 88 5e 01 00 00    	js     330b <bigfile+0x19b>
+    31ad:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    31af:	31 db                	xor    %ebx,%ebx
+    31b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    31b8:	83 ec 04             	sub    $0x4,%esp
+    31bb:	68 58 02 00 00       	push   $0x258
+    31c0:	53                   	push   %ebx
+    31c1:	68 e0 95 00 00       	push   $0x95e0
+    31c6:	e8 05 12 00 00       	call   43d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    31cb:	83 c4 0c             	add    $0xc,%esp
+    31ce:	68 58 02 00 00       	push   $0x258
+    31d3:	68 e0 95 00 00       	push   $0x95e0
+    31d8:	56                   	push   %esi
+    31d9:	e8 95 13 00 00       	call   4573 <write>
+    31de:	83 c4 10             	add    $0x10,%esp
+    31e1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    31e6:	0f 85 f8 00 00 00    	jne    32e4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    31ec:	83 c3 01             	add    $0x1,%ebx
+    31ef:	83 fb 14             	cmp    $0x14,%ebx
+    31f2:	75 c4                	jne    31b8 <bigfile+0x48>
+  close(fd);
+    31f4:	83 ec 0c             	sub    $0xc,%esp
+    31f7:	56                   	push   %esi
+    31f8:	e8 7e 13 00 00       	call   457b <close>
+  fd = open("bigfile", 0);
+    31fd:	5e                   	pop    %esi
+    31fe:	5f                   	pop    %edi
+    31ff:	6a 00                	push   $0x0
+    3201:	68 07 57 00 00       	push   $0x5707
+    3206:	e8 88 13 00 00       	call   4593 <open>
+  if(fd < 0){
+    320b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    320e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    3210:	85 c0                	test   %eax,%eax
+    3212:	0f 88 e0 00 00 00    	js     32f8 <bigfile+0x188>
+  total = 0;
+    3218:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    321a:	31 ff                	xor    %edi,%edi
+    321c:	eb 30                	jmp    324e <bigfile+0xde>
+    321e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    3220:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    3225:	0f 85 91 00 00 00    	jne    32bc <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    322b:	89 fa                	mov    %edi,%edx
+    322d:	0f be 05 e0 95 00 00 	movsbl 0x95e0,%eax
+    3234:	d1 fa                	sar    %edx
+    3236:	39 d0                	cmp    %edx,%eax
+    3238:	75 6e                	jne    32a8 <bigfile+0x138>
+    323a:	0f be 15 0b 97 00 00 	movsbl 0x970b,%edx
+    3241:	39 d0                	cmp    %edx,%eax
+    3243:	75 63                	jne    32a8 <bigfile+0x138>
+    total += cc;
+    3245:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    324b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    324e:	83 ec 04             	sub    $0x4,%esp
+    3251:	68 2c 01 00 00       	push   $0x12c
+    3256:	68 e0 95 00 00       	push   $0x95e0
+    325b:	56                   	push   %esi
+    325c:	e8 0a 13 00 00       	call   456b <read>
+    if(cc < 0){
+    3261:	83 c4 10             	add    $0x10,%esp
+    3264:	85 c0                	test   %eax,%eax
+    3266:	78 68                	js     32d0 <bigfile+0x160>
+    if(cc == 0)
+    3268:	75 b6                	jne    3220 <bigfile+0xb0>
+  close(fd);
+    326a:	83 ec 0c             	sub    $0xc,%esp
+    326d:	56                   	push   %esi
+    326e:	e8 08 13 00 00       	call   457b <close>
+  if(total != 20*600){
+    3273:	83 c4 10             	add    $0x10,%esp
+    3276:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    327c:	0f 85 9c 00 00 00    	jne    331e <bigfile+0x1ae>
+  unlink("bigfile");
+    3282:	83 ec 0c             	sub    $0xc,%esp
+    3285:	68 07 57 00 00       	push   $0x5707
+    328a:	e8 14 13 00 00       	call   45a3 <unlink>
+  printf(1, "bigfile test ok\n");
+    328f:	58                   	pop    %eax
+    3290:	5a                   	pop    %edx
+    3291:	68 96 57 00 00       	push   $0x5796
+    3296:	6a 01                	push   $0x1
+    3298:	e8 33 14 00 00       	call   46d0 <printf>
+}
+    329d:	83 c4 10             	add    $0x10,%esp
+    32a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    32a3:	5b                   	pop    %ebx
+    32a4:	5e                   	pop    %esi
+    32a5:	5f                   	pop    %edi
+    32a6:	5d                   	pop    %ebp
+    32a7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    32a8:	83 ec 08             	sub    $0x8,%esp
+    32ab:	68 63 57 00 00       	push   $0x5763
+    32b0:	6a 01                	push   $0x1
+    32b2:	e8 19 14 00 00       	call   46d0 <printf>
+      exit();
+    32b7:	e8 97 12 00 00       	call   4553 <exit>
+      printf(1, "short read bigfile\n");
+    32bc:	83 ec 08             	sub    $0x8,%esp
+    32bf:	68 4f 57 00 00       	push   $0x574f
+    32c4:	6a 01                	push   $0x1
+    32c6:	e8 05 14 00 00       	call   46d0 <printf>
+      exit();
+    32cb:	e8 83 12 00 00       	call   4553 <exit>
+      printf(1, "read bigfile failed\n");
+    32d0:	83 ec 08             	sub    $0x8,%esp
+    32d3:	68 3a 57 00 00       	push   $0x573a
+    32d8:	6a 01                	push   $0x1
+    32da:	e8 f1 13 00 00       	call   46d0 <printf>
+      exit();
+    32df:	e8 6f 12 00 00       	call   4553 <exit>
+      printf(1, "write bigfile failed\n");
+    32e4:	83 ec 08             	sub    $0x8,%esp
+    32e7:	68 0f 57 00 00       	push   $0x570f
+    32ec:	6a 01                	push   $0x1
+    32ee:	e8 dd 13 00 00       	call   46d0 <printf>
+      exit();
+    32f3:	e8 5b 12 00 00       	call   4553 <exit>
+    printf(1, "cannot open bigfile\n");
+    32f8:	53                   	push   %ebx
+    32f9:	53                   	push   %ebx
+    32fa:	68 25 57 00 00       	push   $0x5725
+    32ff:	6a 01                	push   $0x1
+    3301:	e8 ca 13 00 00       	call   46d0 <printf>
+    exit();
+    3306:	e8 48 12 00 00       	call   4553 <exit>
+    printf(1, "cannot create bigfile");
+    330b:	50                   	push   %eax
+    330c:	50                   	push   %eax
+    330d:	68 f9 56 00 00       	push   $0x56f9
+    3312:	6a 01                	push   $0x1
+    3314:	e8 b7 13 00 00       	call   46d0 <printf>
+    exit();
+    3319:	e8 35 12 00 00       	call   4553 <exit>
+    printf(1, "read bigfile wrong total\n");
+    331e:	51                   	push   %ecx
+    331f:	51                   	push   %ecx
+    3320:	68 7c 57 00 00       	push   $0x577c
+    3325:	6a 01                	push   $0x1
+    3327:	e8 a4 13 00 00       	call   46d0 <printf>
+    exit();
+    332c:	e8 22 12 00 00       	call   4553 <exit>
+    3331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    333f:	90                   	nop
+
+00003340 <fourteen>:
+{
+    3340:	55                   	push   %ebp
+    3341:	89 e5                	mov    %esp,%ebp
+    3343:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3346:	68 a7 57 00 00       	push   $0x57a7
+    334b:	6a 01                	push   $0x1
+    334d:	e8 7e 13 00 00       	call   46d0 <printf>
+  if(mkdir("12345678901234") != 0){
+    3352:	c7 04 24 e2 57 00 00 	movl   $0x57e2,(%esp)
+    3359:	e8 5d 12 00 00       	call   45bb <mkdir>
+    335e:	83 c4 10             	add    $0x10,%esp
+    3361:	85 c0                	test   %eax,%eax
+    3363:	0f 85 97 00 00 00    	jne    3400 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3369:	83 ec 0c             	sub    $0xc,%esp
+    336c:	68 68 60 00 00       	push   $0x6068
+    3371:	e8 45 12 00 00       	call   45bb <mkdir>
+    3376:	83 c4 10             	add    $0x10,%esp
+    3379:	85 c0                	test   %eax,%eax
+    337b:	0f 85 de 00 00 00    	jne    345f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3381:	83 ec 08             	sub    $0x8,%esp
+    3384:	68 00 02 00 00       	push   $0x200
+    3389:	68 b8 60 00 00       	push   $0x60b8
+    338e:	e8 00 12 00 00       	call   4593 <open>
+  if(fd < 0){
+    3393:	83 c4 10             	add    $0x10,%esp
+    3396:	85 c0                	test   %eax,%eax
+    3398:	0f 88 ae 00 00 00    	js     344c <fourteen+0x10c>
+  close(fd);
+    339e:	83 ec 0c             	sub    $0xc,%esp
+    33a1:	50                   	push   %eax
+    33a2:	e8 d4 11 00 00       	call   457b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    33a7:	58                   	pop    %eax
+    33a8:	5a                   	pop    %edx
+    33a9:	6a 00                	push   $0x0
+    33ab:	68 28 61 00 00       	push   $0x6128
+    33b0:	e8 de 11 00 00       	call   4593 <open>
+  if(fd < 0){
+    33b5:	83 c4 10             	add    $0x10,%esp
+    33b8:	85 c0                	test   %eax,%eax
+    33ba:	78 7d                	js     3439 <fourteen+0xf9>
+  close(fd);
+    33bc:	83 ec 0c             	sub    $0xc,%esp
+    33bf:	50                   	push   %eax
+    33c0:	e8 b6 11 00 00       	call   457b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    33c5:	c7 04 24 d3 57 00 00 	movl   $0x57d3,(%esp)
+    33cc:	e8 ea 11 00 00       	call   45bb <mkdir>
+    33d1:	83 c4 10             	add    $0x10,%esp
+    33d4:	85 c0                	test   %eax,%eax
+    33d6:	74 4e                	je     3426 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    33d8:	83 ec 0c             	sub    $0xc,%esp
+    33db:	68 c4 61 00 00       	push   $0x61c4
+    33e0:	e8 d6 11 00 00       	call   45bb <mkdir>
+    33e5:	83 c4 10             	add    $0x10,%esp
+    33e8:	85 c0                	test   %eax,%eax
+    33ea:	74 27                	je     3413 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    33ec:	83 ec 08             	sub    $0x8,%esp
+    33ef:	68 f1 57 00 00       	push   $0x57f1
+    33f4:	6a 01                	push   $0x1
+    33f6:	e8 d5 12 00 00       	call   46d0 <printf>
+}
+    33fb:	83 c4 10             	add    $0x10,%esp
+    33fe:	c9                   	leave
+    33ff:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3400:	50                   	push   %eax
+    3401:	50                   	push   %eax
+    3402:	68 b6 57 00 00       	push   $0x57b6
+    3407:	6a 01                	push   $0x1
+    3409:	e8 c2 12 00 00       	call   46d0 <printf>
+    exit();
+    340e:	e8 40 11 00 00       	call   4553 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3413:	50                   	push   %eax
+    3414:	50                   	push   %eax
+    3415:	68 e4 61 00 00       	push   $0x61e4
+    341a:	6a 01                	push   $0x1
+    341c:	e8 af 12 00 00       	call   46d0 <printf>
+    exit();
+    3421:	e8 2d 11 00 00       	call   4553 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3426:	52                   	push   %edx
+    3427:	52                   	push   %edx
+    3428:	68 94 61 00 00       	push   $0x6194
+    342d:	6a 01                	push   $0x1
+    342f:	e8 9c 12 00 00       	call   46d0 <printf>
+    exit();
+    3434:	e8 1a 11 00 00       	call   4553 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3439:	51                   	push   %ecx
+    343a:	51                   	push   %ecx
+    343b:	68 58 61 00 00       	push   $0x6158
+    3440:	6a 01                	push   $0x1
+    3442:	e8 89 12 00 00       	call   46d0 <printf>
+    exit();
+    3447:	e8 07 11 00 00       	call   4553 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    344c:	51                   	push   %ecx
+    344d:	51                   	push   %ecx
+    344e:	68 e8 60 00 00       	push   $0x60e8
+    3453:	6a 01                	push   $0x1
+    3455:	e8 76 12 00 00       	call   46d0 <printf>
+    exit();
+    345a:	e8 f4 10 00 00       	call   4553 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    345f:	50                   	push   %eax
+    3460:	50                   	push   %eax
+    3461:	68 88 60 00 00       	push   $0x6088
+    3466:	6a 01                	push   $0x1
+    3468:	e8 63 12 00 00       	call   46d0 <printf>
+    exit();
+    346d:	e8 e1 10 00 00       	call   4553 <exit>
+    3472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003480 <rmdot>:
+{
+    3480:	55                   	push   %ebp
+    3481:	89 e5                	mov    %esp,%ebp
+    3483:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3486:	68 fe 57 00 00       	push   $0x57fe
+    348b:	6a 01                	push   $0x1
+    348d:	e8 3e 12 00 00       	call   46d0 <printf>
+  if(mkdir("dots") != 0){
+    3492:	c7 04 24 0a 58 00 00 	movl   $0x580a,(%esp)
+    3499:	e8 1d 11 00 00       	call   45bb <mkdir>
+    349e:	83 c4 10             	add    $0x10,%esp
+    34a1:	85 c0                	test   %eax,%eax
+    34a3:	0f 85 b0 00 00 00    	jne    3559 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    34a9:	83 ec 0c             	sub    $0xc,%esp
+    34ac:	68 0a 58 00 00       	push   $0x580a
+    34b1:	e8 0d 11 00 00       	call   45c3 <chdir>
+    34b6:	83 c4 10             	add    $0x10,%esp
+    34b9:	85 c0                	test   %eax,%eax
+    34bb:	0f 85 1d 01 00 00    	jne    35de <rmdot+0x15e>
+  if(unlink(".") == 0){
+    34c1:	83 ec 0c             	sub    $0xc,%esp
+    34c4:	68 b5 54 00 00       	push   $0x54b5
+    34c9:	e8 d5 10 00 00       	call   45a3 <unlink>
+    34ce:	83 c4 10             	add    $0x10,%esp
+    34d1:	85 c0                	test   %eax,%eax
+    34d3:	0f 84 f2 00 00 00    	je     35cb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    34d9:	83 ec 0c             	sub    $0xc,%esp
+    34dc:	68 b4 54 00 00       	push   $0x54b4
+    34e1:	e8 bd 10 00 00       	call   45a3 <unlink>
+    34e6:	83 c4 10             	add    $0x10,%esp
+    34e9:	85 c0                	test   %eax,%eax
+    34eb:	0f 84 c7 00 00 00    	je     35b8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    34f1:	83 ec 0c             	sub    $0xc,%esp
+    34f4:	68 41 4a 00 00       	push   $0x4a41
+    34f9:	e8 c5 10 00 00       	call   45c3 <chdir>
+    34fe:	83 c4 10             	add    $0x10,%esp
+    3501:	85 c0                	test   %eax,%eax
+    3503:	0f 85 9c 00 00 00    	jne    35a5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3509:	83 ec 0c             	sub    $0xc,%esp
+    350c:	68 52 58 00 00       	push   $0x5852
+    3511:	e8 8d 10 00 00       	call   45a3 <unlink>
+    3516:	83 c4 10             	add    $0x10,%esp
+    3519:	85 c0                	test   %eax,%eax
+    351b:	74 75                	je     3592 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    351d:	83 ec 0c             	sub    $0xc,%esp
+    3520:	68 70 58 00 00       	push   $0x5870
+    3525:	e8 79 10 00 00       	call   45a3 <unlink>
+    352a:	83 c4 10             	add    $0x10,%esp
+    352d:	85 c0                	test   %eax,%eax
+    352f:	74 4e                	je     357f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3531:	83 ec 0c             	sub    $0xc,%esp
+    3534:	68 0a 58 00 00       	push   $0x580a
+    3539:	e8 65 10 00 00       	call   45a3 <unlink>
+    353e:	83 c4 10             	add    $0x10,%esp
+    3541:	85 c0                	test   %eax,%eax
+    3543:	75 27                	jne    356c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    3545:	83 ec 08             	sub    $0x8,%esp
+    3548:	68 a5 58 00 00       	push   $0x58a5
+    354d:	6a 01                	push   $0x1
+    354f:	e8 7c 11 00 00       	call   46d0 <printf>
+}
+    3554:	83 c4 10             	add    $0x10,%esp
+    3557:	c9                   	leave
+    3558:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    3559:	50                   	push   %eax
+    355a:	50                   	push   %eax
+    355b:	68 0f 58 00 00       	push   $0x580f
+    3560:	6a 01                	push   $0x1
+    3562:	e8 69 11 00 00       	call   46d0 <printf>
+    exit();
+    3567:	e8 e7 0f 00 00       	call   4553 <exit>
+    printf(1, "unlink dots failed!\n");
+    356c:	50                   	push   %eax
+    356d:	50                   	push   %eax
+    356e:	68 90 58 00 00       	push   $0x5890
+    3573:	6a 01                	push   $0x1
+    3575:	e8 56 11 00 00       	call   46d0 <printf>
+    exit();
+    357a:	e8 d4 0f 00 00       	call   4553 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    357f:	52                   	push   %edx
+    3580:	52                   	push   %edx
+    3581:	68 78 58 00 00       	push   $0x5878
+    3586:	6a 01                	push   $0x1
+    3588:	e8 43 11 00 00       	call   46d0 <printf>
+    exit();
+    358d:	e8 c1 0f 00 00       	call   4553 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3592:	51                   	push   %ecx
+    3593:	51                   	push   %ecx
+    3594:	68 59 58 00 00       	push   $0x5859
+    3599:	6a 01                	push   $0x1
+    359b:	e8 30 11 00 00       	call   46d0 <printf>
+    exit();
+    35a0:	e8 ae 0f 00 00       	call   4553 <exit>
+    printf(1, "chdir / failed\n");
+    35a5:	50                   	push   %eax
+    35a6:	50                   	push   %eax
+    35a7:	68 43 4a 00 00       	push   $0x4a43
+    35ac:	6a 01                	push   $0x1
+    35ae:	e8 1d 11 00 00       	call   46d0 <printf>
+    exit();
+    35b3:	e8 9b 0f 00 00       	call   4553 <exit>
+    printf(1, "rm .. worked!\n");
+    35b8:	50                   	push   %eax
+    35b9:	50                   	push   %eax
+    35ba:	68 43 58 00 00       	push   $0x5843
+    35bf:	6a 01                	push   $0x1
+    35c1:	e8 0a 11 00 00       	call   46d0 <printf>
+    exit();
+    35c6:	e8 88 0f 00 00       	call   4553 <exit>
+    printf(1, "rm . worked!\n");
+    35cb:	50                   	push   %eax
+    35cc:	50                   	push   %eax
+    35cd:	68 35 58 00 00       	push   $0x5835
+    35d2:	6a 01                	push   $0x1
+    35d4:	e8 f7 10 00 00       	call   46d0 <printf>
+    exit();
+    35d9:	e8 75 0f 00 00       	call   4553 <exit>
+    printf(1, "chdir dots failed\n");
+    35de:	50                   	push   %eax
+    35df:	50                   	push   %eax
+    35e0:	68 22 58 00 00       	push   $0x5822
+    35e5:	6a 01                	push   $0x1
+    35e7:	e8 e4 10 00 00       	call   46d0 <printf>
+    exit();
+    35ec:	e8 62 0f 00 00       	call   4553 <exit>
+    35f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35ff:	90                   	nop
+
+00003600 <dirfile>:
+{
+    3600:	55                   	push   %ebp
+    3601:	89 e5                	mov    %esp,%ebp
+    3603:	53                   	push   %ebx
+    3604:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3607:	68 af 58 00 00       	push   $0x58af
+    360c:	6a 01                	push   $0x1
+    360e:	e8 bd 10 00 00       	call   46d0 <printf>
+  fd = open("dirfile", O_CREATE);
+    3613:	5b                   	pop    %ebx
+    3614:	58                   	pop    %eax
+    3615:	68 00 02 00 00       	push   $0x200
+    361a:	68 bc 58 00 00       	push   $0x58bc
+    361f:	e8 6f 0f 00 00       	call   4593 <open>
+  if(fd < 0){
+    3624:	83 c4 10             	add    $0x10,%esp
+    3627:	85 c0                	test   %eax,%eax
+    3629:	0f 88 43 01 00 00    	js     3772 <dirfile+0x172>
+  close(fd);
+    362f:	83 ec 0c             	sub    $0xc,%esp
+    3632:	50                   	push   %eax
+    3633:	e8 43 0f 00 00       	call   457b <close>
+  if(chdir("dirfile") == 0){
+    3638:	c7 04 24 bc 58 00 00 	movl   $0x58bc,(%esp)
+    363f:	e8 7f 0f 00 00       	call   45c3 <chdir>
+    3644:	83 c4 10             	add    $0x10,%esp
+    3647:	85 c0                	test   %eax,%eax
+    3649:	0f 84 10 01 00 00    	je     375f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    364f:	83 ec 08             	sub    $0x8,%esp
+    3652:	6a 00                	push   $0x0
+    3654:	68 f5 58 00 00       	push   $0x58f5
+    3659:	e8 35 0f 00 00       	call   4593 <open>
+  if(fd >= 0){
+    365e:	83 c4 10             	add    $0x10,%esp
+    3661:	85 c0                	test   %eax,%eax
+    3663:	0f 89 e3 00 00 00    	jns    374c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    3669:	83 ec 08             	sub    $0x8,%esp
+    366c:	68 00 02 00 00       	push   $0x200
+    3671:	68 f5 58 00 00       	push   $0x58f5
+    3676:	e8 18 0f 00 00       	call   4593 <open>
+  if(fd >= 0){
+    367b:	83 c4 10             	add    $0x10,%esp
+    367e:	85 c0                	test   %eax,%eax
+    3680:	0f 89 c6 00 00 00    	jns    374c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3686:	83 ec 0c             	sub    $0xc,%esp
+    3689:	68 f5 58 00 00       	push   $0x58f5
+    368e:	e8 28 0f 00 00       	call   45bb <mkdir>
+    3693:	83 c4 10             	add    $0x10,%esp
+    3696:	85 c0                	test   %eax,%eax
+    3698:	0f 84 46 01 00 00    	je     37e4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    369e:	83 ec 0c             	sub    $0xc,%esp
+    36a1:	68 f5 58 00 00       	push   $0x58f5
+    36a6:	e8 f8 0e 00 00       	call   45a3 <unlink>
+    36ab:	83 c4 10             	add    $0x10,%esp
+    36ae:	85 c0                	test   %eax,%eax
+    36b0:	0f 84 1b 01 00 00    	je     37d1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    36b6:	83 ec 08             	sub    $0x8,%esp
+    36b9:	68 f5 58 00 00       	push   $0x58f5
+    36be:	68 59 59 00 00       	push   $0x5959
+    36c3:	e8 eb 0e 00 00       	call   45b3 <link>
+    36c8:	83 c4 10             	add    $0x10,%esp
+    36cb:	85 c0                	test   %eax,%eax
+    36cd:	0f 84 eb 00 00 00    	je     37be <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    36d3:	83 ec 0c             	sub    $0xc,%esp
+    36d6:	68 bc 58 00 00       	push   $0x58bc
+    36db:	e8 c3 0e 00 00       	call   45a3 <unlink>
+    36e0:	83 c4 10             	add    $0x10,%esp
+    36e3:	85 c0                	test   %eax,%eax
+    36e5:	0f 85 c0 00 00 00    	jne    37ab <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    36eb:	83 ec 08             	sub    $0x8,%esp
+    36ee:	6a 02                	push   $0x2
+    36f0:	68 b5 54 00 00       	push   $0x54b5
+    36f5:	e8 99 0e 00 00       	call   4593 <open>
+  if(fd >= 0){
+    36fa:	83 c4 10             	add    $0x10,%esp
+    36fd:	85 c0                	test   %eax,%eax
+    36ff:	0f 89 93 00 00 00    	jns    3798 <dirfile+0x198>
+  fd = open(".", 0);
+    3705:	83 ec 08             	sub    $0x8,%esp
+    3708:	6a 00                	push   $0x0
+    370a:	68 b5 54 00 00       	push   $0x54b5
+    370f:	e8 7f 0e 00 00       	call   4593 <open>
+  if(write(fd, "x", 1) > 0){
+    3714:	83 c4 0c             	add    $0xc,%esp
+    3717:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3719:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    371b:	68 98 55 00 00       	push   $0x5598
+    3720:	50                   	push   %eax
+    3721:	e8 4d 0e 00 00       	call   4573 <write>
+    3726:	83 c4 10             	add    $0x10,%esp
+    3729:	85 c0                	test   %eax,%eax
+    372b:	7f 58                	jg     3785 <dirfile+0x185>
+  close(fd);
+    372d:	83 ec 0c             	sub    $0xc,%esp
+    3730:	53                   	push   %ebx
+    3731:	e8 45 0e 00 00       	call   457b <close>
+  printf(1, "dir vs file OK\n");
+    3736:	58                   	pop    %eax
+    3737:	5a                   	pop    %edx
+    3738:	68 8c 59 00 00       	push   $0x598c
+    373d:	6a 01                	push   $0x1
+    373f:	e8 8c 0f 00 00       	call   46d0 <printf>
+}
+    3744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3747:	83 c4 10             	add    $0x10,%esp
+    374a:	c9                   	leave
+    374b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    374c:	50                   	push   %eax
+    374d:	50                   	push   %eax
+    374e:	68 00 59 00 00       	push   $0x5900
+    3753:	6a 01                	push   $0x1
+    3755:	e8 76 0f 00 00       	call   46d0 <printf>
+    exit();
+    375a:	e8 f4 0d 00 00       	call   4553 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    375f:	52                   	push   %edx
+    3760:	52                   	push   %edx
+    3761:	68 db 58 00 00       	push   $0x58db
+    3766:	6a 01                	push   $0x1
+    3768:	e8 63 0f 00 00       	call   46d0 <printf>
+    exit();
+    376d:	e8 e1 0d 00 00       	call   4553 <exit>
+    printf(1, "create dirfile failed\n");
+    3772:	51                   	push   %ecx
+    3773:	51                   	push   %ecx
+    3774:	68 c4 58 00 00       	push   $0x58c4
+    3779:	6a 01                	push   $0x1
+    377b:	e8 50 0f 00 00       	call   46d0 <printf>
+    exit();
+    3780:	e8 ce 0d 00 00       	call   4553 <exit>
+    printf(1, "write . succeeded!\n");
+    3785:	51                   	push   %ecx
+    3786:	51                   	push   %ecx
+    3787:	68 78 59 00 00       	push   $0x5978
+    378c:	6a 01                	push   $0x1
+    378e:	e8 3d 0f 00 00       	call   46d0 <printf>
+    exit();
+    3793:	e8 bb 0d 00 00       	call   4553 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3798:	53                   	push   %ebx
+    3799:	53                   	push   %ebx
+    379a:	68 38 62 00 00       	push   $0x6238
+    379f:	6a 01                	push   $0x1
+    37a1:	e8 2a 0f 00 00       	call   46d0 <printf>
+    exit();
+    37a6:	e8 a8 0d 00 00       	call   4553 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    37ab:	50                   	push   %eax
+    37ac:	50                   	push   %eax
+    37ad:	68 60 59 00 00       	push   $0x5960
+    37b2:	6a 01                	push   $0x1
+    37b4:	e8 17 0f 00 00       	call   46d0 <printf>
+    exit();
+    37b9:	e8 95 0d 00 00       	call   4553 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    37be:	50                   	push   %eax
+    37bf:	50                   	push   %eax
+    37c0:	68 18 62 00 00       	push   $0x6218
+    37c5:	6a 01                	push   $0x1
+    37c7:	e8 04 0f 00 00       	call   46d0 <printf>
+    exit();
+    37cc:	e8 82 0d 00 00       	call   4553 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    37d1:	50                   	push   %eax
+    37d2:	50                   	push   %eax
+    37d3:	68 3b 59 00 00       	push   $0x593b
+    37d8:	6a 01                	push   $0x1
+    37da:	e8 f1 0e 00 00       	call   46d0 <printf>
+    exit();
+    37df:	e8 6f 0d 00 00       	call   4553 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    37e4:	50                   	push   %eax
+    37e5:	50                   	push   %eax
+    37e6:	68 1e 59 00 00       	push   $0x591e
+    37eb:	6a 01                	push   $0x1
+    37ed:	e8 de 0e 00 00       	call   46d0 <printf>
+    exit();
+    37f2:	e8 5c 0d 00 00       	call   4553 <exit>
+    37f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37fe:	66 90                	xchg   %ax,%ax
+
+00003800 <iref>:
+{
+    3800:	55                   	push   %ebp
+    3801:	89 e5                	mov    %esp,%ebp
+    3803:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3804:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3809:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    380c:	68 9c 59 00 00       	push   $0x599c
+    3811:	6a 01                	push   $0x1
+    3813:	e8 b8 0e 00 00       	call   46d0 <printf>
+    3818:	83 c4 10             	add    $0x10,%esp
+    381b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    381f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3820:	83 ec 0c             	sub    $0xc,%esp
+    3823:	68 ad 59 00 00       	push   $0x59ad
+    3828:	e8 8e 0d 00 00       	call   45bb <mkdir>
+    382d:	83 c4 10             	add    $0x10,%esp
+    3830:	85 c0                	test   %eax,%eax
+    3832:	0f 85 bb 00 00 00    	jne    38f3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3838:	83 ec 0c             	sub    $0xc,%esp
+    383b:	68 ad 59 00 00       	push   $0x59ad
+    3840:	e8 7e 0d 00 00       	call   45c3 <chdir>
+    3845:	83 c4 10             	add    $0x10,%esp
+    3848:	85 c0                	test   %eax,%eax
+    384a:	0f 85 b7 00 00 00    	jne    3907 <iref+0x107>
+    mkdir("");
+    3850:	83 ec 0c             	sub    $0xc,%esp
+    3853:	68 84 4e 00 00       	push   $0x4e84
+    3858:	e8 5e 0d 00 00       	call   45bb <mkdir>
+    link("README", "");
+    385d:	59                   	pop    %ecx
+    385e:	58                   	pop    %eax
+    385f:	68 84 4e 00 00       	push   $0x4e84
+    3864:	68 59 59 00 00       	push   $0x5959
+    3869:	e8 45 0d 00 00       	call   45b3 <link>
+    fd = open("", O_CREATE);
+    386e:	58                   	pop    %eax
+    386f:	5a                   	pop    %edx
+    3870:	68 00 02 00 00       	push   $0x200
+    3875:	68 84 4e 00 00       	push   $0x4e84
+    387a:	e8 14 0d 00 00       	call   4593 <open>
+    if(fd >= 0)
+    387f:	83 c4 10             	add    $0x10,%esp
+    3882:	85 c0                	test   %eax,%eax
+    3884:	78 0c                	js     3892 <iref+0x92>
+      close(fd);
+    3886:	83 ec 0c             	sub    $0xc,%esp
+    3889:	50                   	push   %eax
+    388a:	e8 ec 0c 00 00       	call   457b <close>
+    388f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3892:	83 ec 08             	sub    $0x8,%esp
+    3895:	68 00 02 00 00       	push   $0x200
+    389a:	68 97 55 00 00       	push   $0x5597
+    389f:	e8 ef 0c 00 00       	call   4593 <open>
+    if(fd >= 0)
+    38a4:	83 c4 10             	add    $0x10,%esp
+    38a7:	85 c0                	test   %eax,%eax
+    38a9:	78 0c                	js     38b7 <iref+0xb7>
+      close(fd);
+    38ab:	83 ec 0c             	sub    $0xc,%esp
+    38ae:	50                   	push   %eax
+    38af:	e8 c7 0c 00 00       	call   457b <close>
+    38b4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    38b7:	83 ec 0c             	sub    $0xc,%esp
+    38ba:	68 97 55 00 00       	push   $0x5597
+    38bf:	e8 df 0c 00 00       	call   45a3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    38c4:	83 c4 10             	add    $0x10,%esp
+    38c7:	83 eb 01             	sub    $0x1,%ebx
+    38ca:	0f 85 50 ff ff ff    	jne    3820 <iref+0x20>
+  chdir("/");
+    38d0:	83 ec 0c             	sub    $0xc,%esp
+    38d3:	68 41 4a 00 00       	push   $0x4a41
+    38d8:	e8 e6 0c 00 00       	call   45c3 <chdir>
+  printf(1, "empty file name OK\n");
+    38dd:	58                   	pop    %eax
+    38de:	5a                   	pop    %edx
+    38df:	68 db 59 00 00       	push   $0x59db
+    38e4:	6a 01                	push   $0x1
+    38e6:	e8 e5 0d 00 00       	call   46d0 <printf>
+}
+    38eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38ee:	83 c4 10             	add    $0x10,%esp
+    38f1:	c9                   	leave
+    38f2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    38f3:	83 ec 08             	sub    $0x8,%esp
+    38f6:	68 b3 59 00 00       	push   $0x59b3
+    38fb:	6a 01                	push   $0x1
+    38fd:	e8 ce 0d 00 00       	call   46d0 <printf>
+      exit();
+    3902:	e8 4c 0c 00 00       	call   4553 <exit>
+      printf(1, "chdir irefd failed\n");
+    3907:	83 ec 08             	sub    $0x8,%esp
+    390a:	68 c7 59 00 00       	push   $0x59c7
+    390f:	6a 01                	push   $0x1
+    3911:	e8 ba 0d 00 00       	call   46d0 <printf>
+      exit();
+    3916:	e8 38 0c 00 00       	call   4553 <exit>
+    391b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    391f:	90                   	nop
+
+00003920 <forktest>:
+{
+    3920:	55                   	push   %ebp
+    3921:	89 e5                	mov    %esp,%ebp
+    3923:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3924:	31 db                	xor    %ebx,%ebx
+{
+    3926:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3929:	68 ef 59 00 00       	push   $0x59ef
+    392e:	6a 01                	push   $0x1
+    3930:	e8 9b 0d 00 00       	call   46d0 <printf>
+    3935:	83 c4 10             	add    $0x10,%esp
+    3938:	eb 13                	jmp    394d <forktest+0x2d>
+    393a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3940:	74 4d                	je     398f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3942:	83 c3 01             	add    $0x1,%ebx
+    3945:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    394b:	74 6e                	je     39bb <forktest+0x9b>
+    pid = fork();
+    394d:	e8 f9 0b 00 00       	call   454b <fork>
+    if(pid < 0)
+    3952:	85 c0                	test   %eax,%eax
+    3954:	79 ea                	jns    3940 <forktest+0x20>
+  for(; n > 0; n--){
+    3956:	85 db                	test   %ebx,%ebx
+    3958:	74 14                	je     396e <forktest+0x4e>
+    395a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3960:	e8 f6 0b 00 00       	call   455b <wait>
+    3965:	85 c0                	test   %eax,%eax
+    3967:	78 2b                	js     3994 <forktest+0x74>
+  for(; n > 0; n--){
+    3969:	83 eb 01             	sub    $0x1,%ebx
+    396c:	75 f2                	jne    3960 <forktest+0x40>
+  if(wait() != -1){
+    396e:	e8 e8 0b 00 00       	call   455b <wait>
+    3973:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3976:	75 30                	jne    39a8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3978:	83 ec 08             	sub    $0x8,%esp
+    397b:	68 21 5a 00 00       	push   $0x5a21
+    3980:	6a 01                	push   $0x1
+    3982:	e8 49 0d 00 00       	call   46d0 <printf>
+}
+    3987:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    398a:	83 c4 10             	add    $0x10,%esp
+    398d:	c9                   	leave
+    398e:	c3                   	ret
+      exit();
+    398f:	e8 bf 0b 00 00       	call   4553 <exit>
+      printf(1, "wait stopped early\n");
+    3994:	83 ec 08             	sub    $0x8,%esp
+    3997:	68 fa 59 00 00       	push   $0x59fa
+    399c:	6a 01                	push   $0x1
+    399e:	e8 2d 0d 00 00       	call   46d0 <printf>
+      exit();
+    39a3:	e8 ab 0b 00 00       	call   4553 <exit>
+    printf(1, "wait got too many\n");
+    39a8:	50                   	push   %eax
+    39a9:	50                   	push   %eax
+    39aa:	68 0e 5a 00 00       	push   $0x5a0e
+    39af:	6a 01                	push   $0x1
+    39b1:	e8 1a 0d 00 00       	call   46d0 <printf>
+    exit();
+    39b6:	e8 98 0b 00 00       	call   4553 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    39bb:	52                   	push   %edx
+    39bc:	52                   	push   %edx
+    39bd:	68 58 62 00 00       	push   $0x6258
+    39c2:	6a 01                	push   $0x1
+    39c4:	e8 07 0d 00 00       	call   46d0 <printf>
+    exit();
+    39c9:	e8 85 0b 00 00       	call   4553 <exit>
+    39ce:	66 90                	xchg   %ax,%ax
+
+000039d0 <sbrktest>:
+{
+    39d0:	55                   	push   %ebp
+    39d1:	89 e5                	mov    %esp,%ebp
+    39d3:	57                   	push   %edi
+    39d4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    39d5:	31 f6                	xor    %esi,%esi
+{
+    39d7:	53                   	push   %ebx
+    39d8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    39db:	68 2f 5a 00 00       	push   $0x5a2f
+    39e0:	ff 35 a8 6e 00 00    	push   0x6ea8
+    39e6:	e8 e5 0c 00 00       	call   46d0 <printf>
+  oldbrk = sbrk(0);
+    39eb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    39f2:	e8 e4 0b 00 00       	call   45db <sbrk>
+    39f7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    39fa:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3a01:	e8 d5 0b 00 00       	call   45db <sbrk>
+    3a06:	83 c4 10             	add    $0x10,%esp
+    3a09:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3a0b:	eb 05                	jmp    3a12 <sbrktest+0x42>
+    3a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3a10:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3a12:	83 ec 0c             	sub    $0xc,%esp
+    3a15:	6a 01                	push   $0x1
+    3a17:	e8 bf 0b 00 00       	call   45db <sbrk>
+    if(b != a){
+    3a1c:	83 c4 10             	add    $0x10,%esp
+    3a1f:	39 d8                	cmp    %ebx,%eax
+    3a21:	0f 85 9c 02 00 00    	jne    3cc3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3a27:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3a2a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3a2d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3a30:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3a36:	75 d8                	jne    3a10 <sbrktest+0x40>
+  pid = fork();
+    3a38:	e8 0e 0b 00 00       	call   454b <fork>
+    3a3d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3a3f:	85 c0                	test   %eax,%eax
+    3a41:	0f 88 02 03 00 00    	js     3d49 <sbrktest+0x379>
+  c = sbrk(1);
+    3a47:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3a4a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3a4d:	6a 01                	push   $0x1
+    3a4f:	e8 87 0b 00 00       	call   45db <sbrk>
+  c = sbrk(1);
+    3a54:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3a5b:	e8 7b 0b 00 00       	call   45db <sbrk>
+  if(c != a + 1){
+    3a60:	83 c4 10             	add    $0x10,%esp
+    3a63:	39 c3                	cmp    %eax,%ebx
+    3a65:	0f 85 3b 03 00 00    	jne    3da6 <sbrktest+0x3d6>
+  if(pid == 0)
+    3a6b:	85 f6                	test   %esi,%esi
+    3a6d:	0f 84 2e 03 00 00    	je     3da1 <sbrktest+0x3d1>
+  wait();
+    3a73:	e8 e3 0a 00 00       	call   455b <wait>
+  a = sbrk(0);
+    3a78:	83 ec 0c             	sub    $0xc,%esp
+    3a7b:	6a 00                	push   $0x0
+    3a7d:	e8 59 0b 00 00       	call   45db <sbrk>
+    3a82:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3a84:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3a89:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3a8b:	89 04 24             	mov    %eax,(%esp)
+    3a8e:	e8 48 0b 00 00       	call   45db <sbrk>
+  if (p != a) {
+    3a93:	83 c4 10             	add    $0x10,%esp
+    3a96:	39 c3                	cmp    %eax,%ebx
+    3a98:	0f 85 94 02 00 00    	jne    3d32 <sbrktest+0x362>
+  a = sbrk(0);
+    3a9e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3aa1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3aa8:	6a 00                	push   $0x0
+    3aaa:	e8 2c 0b 00 00       	call   45db <sbrk>
+  c = sbrk(-4096);
+    3aaf:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3ab6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3ab8:	e8 1e 0b 00 00       	call   45db <sbrk>
+  if(c == (char*)0xffffffff){
+    3abd:	83 c4 10             	add    $0x10,%esp
+    3ac0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ac3:	0f 84 22 03 00 00    	je     3deb <sbrktest+0x41b>
+  c = sbrk(0);
+    3ac9:	83 ec 0c             	sub    $0xc,%esp
+    3acc:	6a 00                	push   $0x0
+    3ace:	e8 08 0b 00 00       	call   45db <sbrk>
+  if(c != a - 4096){
+    3ad3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3ad9:	83 c4 10             	add    $0x10,%esp
+    3adc:	39 d0                	cmp    %edx,%eax
+    3ade:	0f 85 f0 02 00 00    	jne    3dd4 <sbrktest+0x404>
+  a = sbrk(0);
+    3ae4:	83 ec 0c             	sub    $0xc,%esp
+    3ae7:	6a 00                	push   $0x0
+    3ae9:	e8 ed 0a 00 00       	call   45db <sbrk>
+  c = sbrk(4096);
+    3aee:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3af5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3af7:	e8 df 0a 00 00       	call   45db <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3afc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3aff:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3b01:	39 c3                	cmp    %eax,%ebx
+    3b03:	0f 85 b4 02 00 00    	jne    3dbd <sbrktest+0x3ed>
+    3b09:	83 ec 0c             	sub    $0xc,%esp
+    3b0c:	6a 00                	push   $0x0
+    3b0e:	e8 c8 0a 00 00       	call   45db <sbrk>
+    3b13:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3b19:	83 c4 10             	add    $0x10,%esp
+    3b1c:	39 c2                	cmp    %eax,%edx
+    3b1e:	0f 85 99 02 00 00    	jne    3dbd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3b24:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3b2b:	0f 84 2f 02 00 00    	je     3d60 <sbrktest+0x390>
+  a = sbrk(0);
+    3b31:	83 ec 0c             	sub    $0xc,%esp
+    3b34:	6a 00                	push   $0x0
+    3b36:	e8 a0 0a 00 00       	call   45db <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b3b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3b42:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b44:	e8 92 0a 00 00       	call   45db <sbrk>
+    3b49:	89 c2                	mov    %eax,%edx
+    3b4b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3b4e:	29 d0                	sub    %edx,%eax
+    3b50:	89 04 24             	mov    %eax,(%esp)
+    3b53:	e8 83 0a 00 00       	call   45db <sbrk>
+  if(c != a){
+    3b58:	83 c4 10             	add    $0x10,%esp
+    3b5b:	39 c3                	cmp    %eax,%ebx
+    3b5d:	0f 85 b8 01 00 00    	jne    3d1b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b63:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b6f:	90                   	nop
+    ppid = getpid();
+    3b70:	e8 5e 0a 00 00       	call   45d3 <getpid>
+    3b75:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3b77:	e8 cf 09 00 00       	call   454b <fork>
+    if(pid < 0){
+    3b7c:	85 c0                	test   %eax,%eax
+    3b7e:	0f 88 5d 01 00 00    	js     3ce1 <sbrktest+0x311>
+    if(pid == 0){
+    3b84:	0f 84 6f 01 00 00    	je     3cf9 <sbrktest+0x329>
+    wait();
+    3b8a:	e8 cc 09 00 00       	call   455b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b8f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3b95:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3b9b:	75 d3                	jne    3b70 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3b9d:	83 ec 0c             	sub    $0xc,%esp
+    3ba0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3ba3:	50                   	push   %eax
+    3ba4:	e8 ba 09 00 00       	call   4563 <pipe>
+    3ba9:	83 c4 10             	add    $0x10,%esp
+    3bac:	85 c0                	test   %eax,%eax
+    3bae:	0f 85 da 01 00 00    	jne    3d8e <sbrktest+0x3be>
+    3bb4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3bb7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3bba:	89 df                	mov    %ebx,%edi
+    3bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3bc0:	e8 86 09 00 00       	call   454b <fork>
+    3bc5:	89 07                	mov    %eax,(%edi)
+    3bc7:	85 c0                	test   %eax,%eax
+    3bc9:	0f 84 91 00 00 00    	je     3c60 <sbrktest+0x290>
+    if(pids[i] != -1)
+    3bcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bd2:	74 14                	je     3be8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3bd4:	83 ec 04             	sub    $0x4,%esp
+    3bd7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3bda:	6a 01                	push   $0x1
+    3bdc:	50                   	push   %eax
+    3bdd:	ff 75 b8             	push   -0x48(%ebp)
+    3be0:	e8 86 09 00 00       	call   456b <read>
+    3be5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3be8:	83 c7 04             	add    $0x4,%edi
+    3beb:	39 f7                	cmp    %esi,%edi
+    3bed:	75 d1                	jne    3bc0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3bef:	83 ec 0c             	sub    $0xc,%esp
+    3bf2:	68 00 10 00 00       	push   $0x1000
+    3bf7:	e8 df 09 00 00       	call   45db <sbrk>
+    3bfc:	83 c4 10             	add    $0x10,%esp
+    3bff:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3c08:	8b 03                	mov    (%ebx),%eax
+    3c0a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c0d:	74 11                	je     3c20 <sbrktest+0x250>
+    kill(pids[i]);
+    3c0f:	83 ec 0c             	sub    $0xc,%esp
+    3c12:	50                   	push   %eax
+    3c13:	e8 6b 09 00 00       	call   4583 <kill>
+    wait();
+    3c18:	e8 3e 09 00 00       	call   455b <wait>
+    3c1d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c20:	83 c3 04             	add    $0x4,%ebx
+    3c23:	39 f3                	cmp    %esi,%ebx
+    3c25:	75 e1                	jne    3c08 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3c27:	83 ff ff             	cmp    $0xffffffff,%edi
+    3c2a:	0f 84 47 01 00 00    	je     3d77 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3c30:	83 ec 0c             	sub    $0xc,%esp
+    3c33:	6a 00                	push   $0x0
+    3c35:	e8 a1 09 00 00       	call   45db <sbrk>
+    3c3a:	83 c4 10             	add    $0x10,%esp
+    3c3d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3c40:	72 60                	jb     3ca2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3c42:	83 ec 08             	sub    $0x8,%esp
+    3c45:	68 d7 5a 00 00       	push   $0x5ad7
+    3c4a:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3c50:	e8 7b 0a 00 00       	call   46d0 <printf>
+}
+    3c55:	83 c4 10             	add    $0x10,%esp
+    3c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c5b:	5b                   	pop    %ebx
+    3c5c:	5e                   	pop    %esi
+    3c5d:	5f                   	pop    %edi
+    3c5e:	5d                   	pop    %ebp
+    3c5f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3c60:	83 ec 0c             	sub    $0xc,%esp
+    3c63:	6a 00                	push   $0x0
+    3c65:	e8 71 09 00 00       	call   45db <sbrk>
+    3c6a:	89 c2                	mov    %eax,%edx
+    3c6c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c71:	29 d0                	sub    %edx,%eax
+    3c73:	89 04 24             	mov    %eax,(%esp)
+    3c76:	e8 60 09 00 00       	call   45db <sbrk>
+      write(fds[1], "x", 1);
+    3c7b:	83 c4 0c             	add    $0xc,%esp
+    3c7e:	6a 01                	push   $0x1
+    3c80:	68 98 55 00 00       	push   $0x5598
+    3c85:	ff 75 bc             	push   -0x44(%ebp)
+    3c88:	e8 e6 08 00 00       	call   4573 <write>
+    3c8d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3c90:	83 ec 0c             	sub    $0xc,%esp
+    3c93:	68 e8 03 00 00       	push   $0x3e8
+    3c98:	e8 46 09 00 00       	call   45e3 <sleep>
+    3c9d:	83 c4 10             	add    $0x10,%esp
+    3ca0:	eb ee                	jmp    3c90 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3ca2:	83 ec 0c             	sub    $0xc,%esp
+    3ca5:	6a 00                	push   $0x0
+    3ca7:	e8 2f 09 00 00       	call   45db <sbrk>
+    3cac:	89 c2                	mov    %eax,%edx
+    3cae:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3cb1:	29 d0                	sub    %edx,%eax
+    3cb3:	89 04 24             	mov    %eax,(%esp)
+    3cb6:	e8 20 09 00 00       	call   45db <sbrk>
+    3cbb:	83 c4 10             	add    $0x10,%esp
+    3cbe:	e9 7f ff ff ff       	jmp    3c42 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3cc3:	83 ec 0c             	sub    $0xc,%esp
+    3cc6:	50                   	push   %eax
+    3cc7:	53                   	push   %ebx
+    3cc8:	56                   	push   %esi
+    3cc9:	68 3a 5a 00 00       	push   $0x5a3a
+    3cce:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3cd4:	e8 f7 09 00 00       	call   46d0 <printf>
+      exit();
+    3cd9:	83 c4 20             	add    $0x20,%esp
+    3cdc:	e8 72 08 00 00       	call   4553 <exit>
+      printf(stdout, "fork failed\n");
+    3ce1:	83 ec 08             	sub    $0x8,%esp
+    3ce4:	68 80 5b 00 00       	push   $0x5b80
+    3ce9:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3cef:	e8 dc 09 00 00       	call   46d0 <printf>
+      exit();
+    3cf4:	e8 5a 08 00 00       	call   4553 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3cf9:	0f be 03             	movsbl (%ebx),%eax
+    3cfc:	50                   	push   %eax
+    3cfd:	53                   	push   %ebx
+    3cfe:	68 a3 5a 00 00       	push   $0x5aa3
+    3d03:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d09:	e8 c2 09 00 00       	call   46d0 <printf>
+      kill(ppid);
+    3d0e:	89 34 24             	mov    %esi,(%esp)
+    3d11:	e8 6d 08 00 00       	call   4583 <kill>
+      exit();
+    3d16:	e8 38 08 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3d1b:	50                   	push   %eax
+    3d1c:	53                   	push   %ebx
+    3d1d:	68 4c 63 00 00       	push   $0x634c
+    3d22:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d28:	e8 a3 09 00 00       	call   46d0 <printf>
+    exit();
+    3d2d:	e8 21 08 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3d32:	56                   	push   %esi
+    3d33:	56                   	push   %esi
+    3d34:	68 7c 62 00 00       	push   $0x627c
+    3d39:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d3f:	e8 8c 09 00 00       	call   46d0 <printf>
+    exit();
+    3d44:	e8 0a 08 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3d49:	50                   	push   %eax
+    3d4a:	50                   	push   %eax
+    3d4b:	68 55 5a 00 00       	push   $0x5a55
+    3d50:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d56:	e8 75 09 00 00       	call   46d0 <printf>
+    exit();
+    3d5b:	e8 f3 07 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3d60:	51                   	push   %ecx
+    3d61:	51                   	push   %ecx
+    3d62:	68 1c 63 00 00       	push   $0x631c
+    3d67:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d6d:	e8 5e 09 00 00       	call   46d0 <printf>
+    exit();
+    3d72:	e8 dc 07 00 00       	call   4553 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3d77:	50                   	push   %eax
+    3d78:	50                   	push   %eax
+    3d79:	68 bc 5a 00 00       	push   $0x5abc
+    3d7e:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3d84:	e8 47 09 00 00       	call   46d0 <printf>
+    exit();
+    3d89:	e8 c5 07 00 00       	call   4553 <exit>
+    printf(1, "pipe() failed\n");
+    3d8e:	52                   	push   %edx
+    3d8f:	52                   	push   %edx
+    3d90:	68 22 4d 00 00       	push   $0x4d22
+    3d95:	6a 01                	push   $0x1
+    3d97:	e8 34 09 00 00       	call   46d0 <printf>
+    exit();
+    3d9c:	e8 b2 07 00 00       	call   4553 <exit>
+    exit();
+    3da1:	e8 ad 07 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3da6:	57                   	push   %edi
+    3da7:	57                   	push   %edi
+    3da8:	68 6c 5a 00 00       	push   $0x5a6c
+    3dad:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3db3:	e8 18 09 00 00       	call   46d0 <printf>
+    exit();
+    3db8:	e8 96 07 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3dbd:	56                   	push   %esi
+    3dbe:	53                   	push   %ebx
+    3dbf:	68 f4 62 00 00       	push   $0x62f4
+    3dc4:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3dca:	e8 01 09 00 00       	call   46d0 <printf>
+    exit();
+    3dcf:	e8 7f 07 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3dd4:	50                   	push   %eax
+    3dd5:	53                   	push   %ebx
+    3dd6:	68 bc 62 00 00       	push   $0x62bc
+    3ddb:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3de1:	e8 ea 08 00 00       	call   46d0 <printf>
+    exit();
+    3de6:	e8 68 07 00 00       	call   4553 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3deb:	53                   	push   %ebx
+    3dec:	53                   	push   %ebx
+    3ded:	68 88 5a 00 00       	push   $0x5a88
+    3df2:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3df8:	e8 d3 08 00 00       	call   46d0 <printf>
+    exit();
+    3dfd:	e8 51 07 00 00       	call   4553 <exit>
+    3e02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003e10 <validateint>:
+}
+    3e10:	c3                   	ret
+    3e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e1f:	90                   	nop
+
+00003e20 <validatetest>:
+{
+    3e20:	55                   	push   %ebp
+    3e21:	89 e5                	mov    %esp,%ebp
+    3e23:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e24:	31 f6                	xor    %esi,%esi
+{
+    3e26:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3e27:	83 ec 08             	sub    $0x8,%esp
+    3e2a:	68 e5 5a 00 00       	push   $0x5ae5
+    3e2f:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3e35:	e8 96 08 00 00       	call   46d0 <printf>
+    3e3a:	83 c4 10             	add    $0x10,%esp
+    3e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3e40:	e8 06 07 00 00       	call   454b <fork>
+    3e45:	89 c3                	mov    %eax,%ebx
+    3e47:	85 c0                	test   %eax,%eax
+    3e49:	74 63                	je     3eae <validatetest+0x8e>
+    sleep(0);
+    3e4b:	83 ec 0c             	sub    $0xc,%esp
+    3e4e:	6a 00                	push   $0x0
+    3e50:	e8 8e 07 00 00       	call   45e3 <sleep>
+    sleep(0);
+    3e55:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3e5c:	e8 82 07 00 00       	call   45e3 <sleep>
+    kill(pid);
+    3e61:	89 1c 24             	mov    %ebx,(%esp)
+    3e64:	e8 1a 07 00 00       	call   4583 <kill>
+    wait();
+    3e69:	e8 ed 06 00 00       	call   455b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3e6e:	58                   	pop    %eax
+    3e6f:	5a                   	pop    %edx
+    3e70:	56                   	push   %esi
+    3e71:	68 f4 5a 00 00       	push   $0x5af4
+    3e76:	e8 38 07 00 00       	call   45b3 <link>
+    3e7b:	83 c4 10             	add    $0x10,%esp
+    3e7e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e81:	75 30                	jne    3eb3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e83:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3e89:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3e8f:	75 af                	jne    3e40 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3e91:	83 ec 08             	sub    $0x8,%esp
+    3e94:	68 18 5b 00 00       	push   $0x5b18
+    3e99:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3e9f:	e8 2c 08 00 00       	call   46d0 <printf>
+}
+    3ea4:	83 c4 10             	add    $0x10,%esp
+    3ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3eaa:	5b                   	pop    %ebx
+    3eab:	5e                   	pop    %esi
+    3eac:	5d                   	pop    %ebp
+    3ead:	c3                   	ret
+      exit();
+    3eae:	e8 a0 06 00 00       	call   4553 <exit>
+      printf(stdout, "link should not succeed\n");
+    3eb3:	83 ec 08             	sub    $0x8,%esp
+    3eb6:	68 ff 5a 00 00       	push   $0x5aff
+    3ebb:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3ec1:	e8 0a 08 00 00       	call   46d0 <printf>
+      exit();
+    3ec6:	e8 88 06 00 00       	call   4553 <exit>
+    3ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ecf:	90                   	nop
+
+00003ed0 <bsstest>:
+{
+    3ed0:	55                   	push   %ebp
+    3ed1:	89 e5                	mov    %esp,%ebp
+    3ed3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3ed6:	68 25 5b 00 00       	push   $0x5b25
+    3edb:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3ee1:	e8 ea 07 00 00       	call   46d0 <printf>
+    3ee6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3ee9:	31 c0                	xor    %eax,%eax
+    3eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3eef:	90                   	nop
+    if(uninit[i] != '\0'){
+    3ef0:	80 b8 c0 6e 00 00 00 	cmpb   $0x0,0x6ec0(%eax)
+    3ef7:	75 22                	jne    3f1b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3ef9:	83 c0 01             	add    $0x1,%eax
+    3efc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3f01:	75 ed                	jne    3ef0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3f03:	83 ec 08             	sub    $0x8,%esp
+    3f06:	68 40 5b 00 00       	push   $0x5b40
+    3f0b:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3f11:	e8 ba 07 00 00       	call   46d0 <printf>
+}
+    3f16:	83 c4 10             	add    $0x10,%esp
+    3f19:	c9                   	leave
+    3f1a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3f1b:	83 ec 08             	sub    $0x8,%esp
+    3f1e:	68 2f 5b 00 00       	push   $0x5b2f
+    3f23:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3f29:	e8 a2 07 00 00       	call   46d0 <printf>
+      exit();
+    3f2e:	e8 20 06 00 00       	call   4553 <exit>
+    3f33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003f40 <bigargtest>:
+{
+    3f40:	55                   	push   %ebp
+    3f41:	89 e5                	mov    %esp,%ebp
+    3f43:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3f46:	68 4d 5b 00 00       	push   $0x5b4d
+    3f4b:	e8 53 06 00 00       	call   45a3 <unlink>
+  pid = fork();
+    3f50:	e8 f6 05 00 00       	call   454b <fork>
+  if(pid == 0){
+    3f55:	83 c4 10             	add    $0x10,%esp
+    3f58:	85 c0                	test   %eax,%eax
+    3f5a:	74 44                	je     3fa0 <bigargtest+0x60>
+  } else if(pid < 0){
+    3f5c:	0f 88 c3 00 00 00    	js     4025 <bigargtest+0xe5>
+  wait();
+    3f62:	e8 f4 05 00 00       	call   455b <wait>
+  fd = open("bigarg-ok", 0);
+    3f67:	83 ec 08             	sub    $0x8,%esp
+    3f6a:	6a 00                	push   $0x0
+    3f6c:	68 4d 5b 00 00       	push   $0x5b4d
+    3f71:	e8 1d 06 00 00       	call   4593 <open>
+  if(fd < 0){
+    3f76:	83 c4 10             	add    $0x10,%esp
+    3f79:	85 c0                	test   %eax,%eax
+    3f7b:	0f 88 8d 00 00 00    	js     400e <bigargtest+0xce>
+  close(fd);
+    3f81:	83 ec 0c             	sub    $0xc,%esp
+    3f84:	50                   	push   %eax
+    3f85:	e8 f1 05 00 00       	call   457b <close>
+  unlink("bigarg-ok");
+    3f8a:	c7 04 24 4d 5b 00 00 	movl   $0x5b4d,(%esp)
+    3f91:	e8 0d 06 00 00       	call   45a3 <unlink>
+}
+    3f96:	83 c4 10             	add    $0x10,%esp
+    3f99:	c9                   	leave
+    3f9a:	c3                   	ret
+    3f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f9f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3fa0:	c7 04 85 e0 b5 00 00 	movl   $0x6370,0xb5e0(,%eax,4)
+    3fa7:	70 63 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3fab:	83 c0 01             	add    $0x1,%eax
+    3fae:	83 f8 1f             	cmp    $0x1f,%eax
+    3fb1:	75 ed                	jne    3fa0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3fb3:	31 c9                	xor    %ecx,%ecx
+    3fb5:	89 0d 5c b6 00 00    	mov    %ecx,0xb65c
+    printf(stdout, "bigarg test\n");
+    3fbb:	50                   	push   %eax
+    3fbc:	50                   	push   %eax
+    3fbd:	68 57 5b 00 00       	push   $0x5b57
+    3fc2:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3fc8:	e8 03 07 00 00       	call   46d0 <printf>
+    exec("echo", args);
+    3fcd:	58                   	pop    %eax
+    3fce:	5a                   	pop    %edx
+    3fcf:	68 e0 b5 00 00       	push   $0xb5e0
+    3fd4:	68 ce 4a 00 00       	push   $0x4ace
+    3fd9:	e8 ad 05 00 00       	call   458b <exec>
+    printf(stdout, "bigarg test ok\n");
+    3fde:	59                   	pop    %ecx
+    3fdf:	58                   	pop    %eax
+    3fe0:	68 64 5b 00 00       	push   $0x5b64
+    3fe5:	ff 35 a8 6e 00 00    	push   0x6ea8
+    3feb:	e8 e0 06 00 00       	call   46d0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3ff0:	58                   	pop    %eax
+    3ff1:	5a                   	pop    %edx
+    3ff2:	68 00 02 00 00       	push   $0x200
+    3ff7:	68 4d 5b 00 00       	push   $0x5b4d
+    3ffc:	e8 92 05 00 00       	call   4593 <open>
+    close(fd);
+    4001:	89 04 24             	mov    %eax,(%esp)
+    4004:	e8 72 05 00 00       	call   457b <close>
+    exit();
+    4009:	e8 45 05 00 00       	call   4553 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    400e:	50                   	push   %eax
+    400f:	50                   	push   %eax
+    4010:	68 8d 5b 00 00       	push   $0x5b8d
+    4015:	ff 35 a8 6e 00 00    	push   0x6ea8
+    401b:	e8 b0 06 00 00       	call   46d0 <printf>
+    exit();
+    4020:	e8 2e 05 00 00       	call   4553 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4025:	52                   	push   %edx
+    4026:	52                   	push   %edx
+    4027:	68 74 5b 00 00       	push   $0x5b74
+    402c:	ff 35 a8 6e 00 00    	push   0x6ea8
+    4032:	e8 99 06 00 00       	call   46d0 <printf>
+    exit();
+    4037:	e8 17 05 00 00       	call   4553 <exit>
+    403c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004040 <fsfull>:
+{
+    4040:	55                   	push   %ebp
+    4041:	89 e5                	mov    %esp,%ebp
+    4043:	57                   	push   %edi
+    4044:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4045:	31 f6                	xor    %esi,%esi
+{
+    4047:	53                   	push   %ebx
+    4048:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    404b:	68 a2 5b 00 00       	push   $0x5ba2
+    4050:	6a 01                	push   $0x1
+    4052:	e8 79 06 00 00       	call   46d0 <printf>
+    4057:	83 c4 10             	add    $0x10,%esp
+    405a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4060:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4065:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    406a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    406d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4071:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4073:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4077:	c1 ea 06             	shr    $0x6,%edx
+    407a:	8d 42 30             	lea    0x30(%edx),%eax
+    407d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4080:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4086:	89 f2                	mov    %esi,%edx
+    4088:	29 c2                	sub    %eax,%edx
+    408a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    408f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4091:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4096:	c1 ea 05             	shr    $0x5,%edx
+    4099:	83 c2 30             	add    $0x30,%edx
+    409c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    409f:	f7 e6                	mul    %esi
+    40a1:	c1 ea 05             	shr    $0x5,%edx
+    40a4:	6b c2 64             	imul   $0x64,%edx,%eax
+    40a7:	89 f2                	mov    %esi,%edx
+    40a9:	29 c2                	sub    %eax,%edx
+    40ab:	89 d0                	mov    %edx,%eax
+    40ad:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    40af:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    40b1:	c1 ea 03             	shr    $0x3,%edx
+    40b4:	83 c2 30             	add    $0x30,%edx
+    40b7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    40ba:	f7 e1                	mul    %ecx
+    40bc:	89 f0                	mov    %esi,%eax
+    40be:	c1 ea 03             	shr    $0x3,%edx
+    40c1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    40c4:	01 d2                	add    %edx,%edx
+    40c6:	29 d0                	sub    %edx,%eax
+    40c8:	83 c0 30             	add    $0x30,%eax
+    40cb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    40ce:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40d1:	50                   	push   %eax
+    40d2:	68 af 5b 00 00       	push   $0x5baf
+    40d7:	6a 01                	push   $0x1
+    40d9:	e8 f2 05 00 00       	call   46d0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    40de:	58                   	pop    %eax
+    40df:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40e2:	5a                   	pop    %edx
+    40e3:	68 02 02 00 00       	push   $0x202
+    40e8:	50                   	push   %eax
+    40e9:	e8 a5 04 00 00       	call   4593 <open>
+    if(fd < 0){
+    40ee:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    40f1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    40f3:	85 c0                	test   %eax,%eax
+    40f5:	78 4f                	js     4146 <fsfull+0x106>
+    int total = 0;
+    40f7:	31 db                	xor    %ebx,%ebx
+    40f9:	eb 07                	jmp    4102 <fsfull+0xc2>
+    40fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    40ff:	90                   	nop
+      total += cc;
+    4100:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4102:	83 ec 04             	sub    $0x4,%esp
+    4105:	68 00 02 00 00       	push   $0x200
+    410a:	68 e0 95 00 00       	push   $0x95e0
+    410f:	57                   	push   %edi
+    4110:	e8 5e 04 00 00       	call   4573 <write>
+      if(cc < 512)
+    4115:	83 c4 10             	add    $0x10,%esp
+    4118:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    411d:	7f e1                	jg     4100 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    411f:	83 ec 04             	sub    $0x4,%esp
+    4122:	53                   	push   %ebx
+    4123:	68 cb 5b 00 00       	push   $0x5bcb
+    4128:	6a 01                	push   $0x1
+    412a:	e8 a1 05 00 00       	call   46d0 <printf>
+    close(fd);
+    412f:	89 3c 24             	mov    %edi,(%esp)
+    4132:	e8 44 04 00 00       	call   457b <close>
+    if(total == 0)
+    4137:	83 c4 10             	add    $0x10,%esp
+    413a:	85 db                	test   %ebx,%ebx
+    413c:	74 1e                	je     415c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    413e:	83 c6 01             	add    $0x1,%esi
+    4141:	e9 1a ff ff ff       	jmp    4060 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4146:	83 ec 04             	sub    $0x4,%esp
+    4149:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    414c:	50                   	push   %eax
+    414d:	68 bb 5b 00 00       	push   $0x5bbb
+    4152:	6a 01                	push   $0x1
+    4154:	e8 77 05 00 00       	call   46d0 <printf>
+      break;
+    4159:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    415c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4161:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    416d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4170:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4172:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4175:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4179:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    417b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    417f:	c1 ea 06             	shr    $0x6,%edx
+    4182:	8d 42 30             	lea    0x30(%edx),%eax
+    4185:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4188:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    418e:	89 f2                	mov    %esi,%edx
+    4190:	29 c2                	sub    %eax,%edx
+    4192:	89 d0                	mov    %edx,%eax
+    4194:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4196:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4198:	c1 ea 05             	shr    $0x5,%edx
+    419b:	83 c2 30             	add    $0x30,%edx
+    419e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    41a1:	f7 e3                	mul    %ebx
+    41a3:	c1 ea 05             	shr    $0x5,%edx
+    41a6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    41a9:	89 f2                	mov    %esi,%edx
+    41ab:	29 ca                	sub    %ecx,%edx
+    41ad:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    41b2:	89 d0                	mov    %edx,%eax
+    41b4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    41b6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41b8:	c1 ea 03             	shr    $0x3,%edx
+    41bb:	83 c2 30             	add    $0x30,%edx
+    41be:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    41c1:	f7 e1                	mul    %ecx
+    41c3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    41c5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    41c8:	c1 ea 03             	shr    $0x3,%edx
+    41cb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    41ce:	01 d2                	add    %edx,%edx
+    41d0:	29 d0                	sub    %edx,%eax
+    41d2:	83 c0 30             	add    $0x30,%eax
+    41d5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    41d8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    41db:	50                   	push   %eax
+    41dc:	e8 c2 03 00 00       	call   45a3 <unlink>
+  while(nfiles >= 0){
+    41e1:	83 c4 10             	add    $0x10,%esp
+    41e4:	83 fe ff             	cmp    $0xffffffff,%esi
+    41e7:	75 87                	jne    4170 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    41e9:	83 ec 08             	sub    $0x8,%esp
+    41ec:	68 db 5b 00 00       	push   $0x5bdb
+    41f1:	6a 01                	push   $0x1
+    41f3:	e8 d8 04 00 00       	call   46d0 <printf>
+}
+    41f8:	83 c4 10             	add    $0x10,%esp
+    41fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    41fe:	5b                   	pop    %ebx
+    41ff:	5e                   	pop    %esi
+    4200:	5f                   	pop    %edi
+    4201:	5d                   	pop    %ebp
+    4202:	c3                   	ret
+    4203:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    420a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004210 <uio>:
+{
+    4210:	55                   	push   %ebp
+    4211:	89 e5                	mov    %esp,%ebp
+    4213:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4216:	68 f1 5b 00 00       	push   $0x5bf1
+    421b:	6a 01                	push   $0x1
+    421d:	e8 ae 04 00 00       	call   46d0 <printf>
+  pid = fork();
+    4222:	e8 24 03 00 00       	call   454b <fork>
+  if(pid == 0){
+    4227:	83 c4 10             	add    $0x10,%esp
+    422a:	85 c0                	test   %eax,%eax
+    422c:	74 1b                	je     4249 <uio+0x39>
+  } else if(pid < 0){
+    422e:	78 3d                	js     426d <uio+0x5d>
+  wait();
+    4230:	e8 26 03 00 00       	call   455b <wait>
+  printf(1, "uio test done\n");
+    4235:	83 ec 08             	sub    $0x8,%esp
+    4238:	68 fb 5b 00 00       	push   $0x5bfb
+    423d:	6a 01                	push   $0x1
+    423f:	e8 8c 04 00 00       	call   46d0 <printf>
+}
+    4244:	83 c4 10             	add    $0x10,%esp
+    4247:	c9                   	leave
+    4248:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4249:	b8 09 00 00 00       	mov    $0x9,%eax
+    424e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4253:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4254:	ba 71 00 00 00       	mov    $0x71,%edx
+    4259:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    425a:	52                   	push   %edx
+    425b:	52                   	push   %edx
+    425c:	68 50 64 00 00       	push   $0x6450
+    4261:	6a 01                	push   $0x1
+    4263:	e8 68 04 00 00       	call   46d0 <printf>
+    exit();
+    4268:	e8 e6 02 00 00       	call   4553 <exit>
+    printf (1, "fork failed\n");
+    426d:	50                   	push   %eax
+    426e:	50                   	push   %eax
+    426f:	68 80 5b 00 00       	push   $0x5b80
+    4274:	6a 01                	push   $0x1
+    4276:	e8 55 04 00 00       	call   46d0 <printf>
+    exit();
+    427b:	e8 d3 02 00 00       	call   4553 <exit>
+
+00004280 <argptest>:
+{
+    4280:	55                   	push   %ebp
+    4281:	89 e5                	mov    %esp,%ebp
+    4283:	53                   	push   %ebx
+    4284:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4287:	6a 00                	push   $0x0
+    4289:	68 0a 5c 00 00       	push   $0x5c0a
+    428e:	e8 00 03 00 00       	call   4593 <open>
+  if (fd < 0) {
+    4293:	83 c4 10             	add    $0x10,%esp
+    4296:	85 c0                	test   %eax,%eax
+    4298:	78 39                	js     42d3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    429a:	83 ec 0c             	sub    $0xc,%esp
+    429d:	89 c3                	mov    %eax,%ebx
+    429f:	6a 00                	push   $0x0
+    42a1:	e8 35 03 00 00       	call   45db <sbrk>
+    42a6:	83 c4 0c             	add    $0xc,%esp
+    42a9:	83 e8 01             	sub    $0x1,%eax
+    42ac:	6a ff                	push   $0xffffffff
+    42ae:	50                   	push   %eax
+    42af:	53                   	push   %ebx
+    42b0:	e8 b6 02 00 00       	call   456b <read>
+  close(fd);
+    42b5:	89 1c 24             	mov    %ebx,(%esp)
+    42b8:	e8 be 02 00 00       	call   457b <close>
+  printf(1, "arg test passed\n");
+    42bd:	58                   	pop    %eax
+    42be:	5a                   	pop    %edx
+    42bf:	68 0f 5c 00 00       	push   $0x5c0f
+    42c4:	6a 01                	push   $0x1
+    42c6:	e8 05 04 00 00       	call   46d0 <printf>
+}
+    42cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42ce:	83 c4 10             	add    $0x10,%esp
+    42d1:	c9                   	leave
+    42d2:	c3                   	ret
+    printf(2, "open failed\n");
+    42d3:	51                   	push   %ecx
+    42d4:	51                   	push   %ecx
+    42d5:	68 57 53 00 00       	push   $0x5357
+    42da:	6a 02                	push   $0x2
+    42dc:	e8 ef 03 00 00       	call   46d0 <printf>
+    exit();
+    42e1:	e8 6d 02 00 00       	call   4553 <exit>
+    42e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000042f0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    42f0:	69 05 a4 6e 00 00 0d 	imul   $0x19660d,0x6ea4,%eax
+    42f7:	66 19 00 
+    42fa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    42ff:	a3 a4 6e 00 00       	mov    %eax,0x6ea4
+}
+    4304:	c3                   	ret
+    4305:	66 90                	xchg   %ax,%ax
+    4307:	66 90                	xchg   %ax,%ax
+    4309:	66 90                	xchg   %ax,%ax
+    430b:	66 90                	xchg   %ax,%ax
+    430d:	66 90                	xchg   %ax,%ax
+    430f:	90                   	nop
+
+00004310 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4310:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4311:	31 c0                	xor    %eax,%eax
+{
+    4313:	89 e5                	mov    %esp,%ebp
+    4315:	53                   	push   %ebx
+    4316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    431c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4320:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4324:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4327:	83 c0 01             	add    $0x1,%eax
+    432a:	84 d2                	test   %dl,%dl
+    432c:	75 f2                	jne    4320 <strcpy+0x10>
+    ;
+  return os;
+}
+    432e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4331:	89 c8                	mov    %ecx,%eax
+    4333:	c9                   	leave
+    4334:	c3                   	ret
+    4335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    433c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4340:	55                   	push   %ebp
+    4341:	89 e5                	mov    %esp,%ebp
+    4343:	53                   	push   %ebx
+    4344:	8b 55 08             	mov    0x8(%ebp),%edx
+    4347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    434a:	0f b6 02             	movzbl (%edx),%eax
+    434d:	84 c0                	test   %al,%al
+    434f:	75 17                	jne    4368 <strcmp+0x28>
+    4351:	eb 3a                	jmp    438d <strcmp+0x4d>
+    4353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4357:	90                   	nop
+    4358:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    435c:	83 c2 01             	add    $0x1,%edx
+    435f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4362:	84 c0                	test   %al,%al
+    4364:	74 1a                	je     4380 <strcmp+0x40>
+    p++, q++;
+    4366:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4368:	0f b6 19             	movzbl (%ecx),%ebx
+    436b:	38 c3                	cmp    %al,%bl
+    436d:	74 e9                	je     4358 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    436f:	29 d8                	sub    %ebx,%eax
+}
+    4371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4374:	c9                   	leave
+    4375:	c3                   	ret
+    4376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    437d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4380:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4384:	31 c0                	xor    %eax,%eax
+    4386:	29 d8                	sub    %ebx,%eax
+}
+    4388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    438b:	c9                   	leave
+    438c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    438d:	0f b6 19             	movzbl (%ecx),%ebx
+    4390:	31 c0                	xor    %eax,%eax
+    4392:	eb db                	jmp    436f <strcmp+0x2f>
+    4394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    439b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    439f:	90                   	nop
+
+000043a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    43a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    43a9:	74 15                	je     43c0 <strlen+0x20>
+    43ab:	31 c0                	xor    %eax,%eax
+    43ad:	8d 76 00             	lea    0x0(%esi),%esi
+    43b0:	83 c0 01             	add    $0x1,%eax
+    43b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    43b7:	89 c1                	mov    %eax,%ecx
+    43b9:	75 f5                	jne    43b0 <strlen+0x10>
+    ;
+  return n;
+}
+    43bb:	89 c8                	mov    %ecx,%eax
+    43bd:	5d                   	pop    %ebp
+    43be:	c3                   	ret
+    43bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    43c0:	31 c9                	xor    %ecx,%ecx
+}
+    43c2:	5d                   	pop    %ebp
+    43c3:	89 c8                	mov    %ecx,%eax
+    43c5:	c3                   	ret
+    43c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000043d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    43d0:	55                   	push   %ebp
+    43d1:	89 e5                	mov    %esp,%ebp
+    43d3:	57                   	push   %edi
+    43d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    43d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    43da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43dd:	89 d7                	mov    %edx,%edi
+    43df:	fc                   	cld
+    43e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    43e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    43e5:	89 d0                	mov    %edx,%eax
+    43e7:	c9                   	leave
+    43e8:	c3                   	ret
+    43e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000043f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    43f0:	55                   	push   %ebp
+    43f1:	89 e5                	mov    %esp,%ebp
+    43f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    43f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    43fa:	0f b6 10             	movzbl (%eax),%edx
+    43fd:	84 d2                	test   %dl,%dl
+    43ff:	75 12                	jne    4413 <strchr+0x23>
+    4401:	eb 1d                	jmp    4420 <strchr+0x30>
+    4403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4407:	90                   	nop
+    4408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    440c:	83 c0 01             	add    $0x1,%eax
+    440f:	84 d2                	test   %dl,%dl
+    4411:	74 0d                	je     4420 <strchr+0x30>
+    if(*s == c)
+    4413:	38 d1                	cmp    %dl,%cl
+    4415:	75 f1                	jne    4408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4417:	5d                   	pop    %ebp
+    4418:	c3                   	ret
+    4419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4420:	31 c0                	xor    %eax,%eax
+}
+    4422:	5d                   	pop    %ebp
+    4423:	c3                   	ret
+    4424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    442b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    442f:	90                   	nop
+
+00004430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4430:	55                   	push   %ebp
+    4431:	89 e5                	mov    %esp,%ebp
+    4433:	57                   	push   %edi
+    4434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4439:	31 db                	xor    %ebx,%ebx
+{
+    443b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    443e:	eb 27                	jmp    4467 <gets+0x37>
+    cc = read(0, &c, 1);
+    4440:	83 ec 04             	sub    $0x4,%esp
+    4443:	6a 01                	push   $0x1
+    4445:	56                   	push   %esi
+    4446:	6a 00                	push   $0x0
+    4448:	e8 1e 01 00 00       	call   456b <read>
+    if(cc < 1)
+    444d:	83 c4 10             	add    $0x10,%esp
+    4450:	85 c0                	test   %eax,%eax
+    4452:	7e 1d                	jle    4471 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4458:	8b 55 08             	mov    0x8(%ebp),%edx
+    445b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    445f:	3c 0a                	cmp    $0xa,%al
+    4461:	74 10                	je     4473 <gets+0x43>
+    4463:	3c 0d                	cmp    $0xd,%al
+    4465:	74 0c                	je     4473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4467:	89 df                	mov    %ebx,%edi
+    4469:	83 c3 01             	add    $0x1,%ebx
+    446c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    446f:	7c cf                	jl     4440 <gets+0x10>
+    4471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4473:	8b 45 08             	mov    0x8(%ebp),%eax
+    4476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    447a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    447d:	5b                   	pop    %ebx
+    447e:	5e                   	pop    %esi
+    447f:	5f                   	pop    %edi
+    4480:	5d                   	pop    %ebp
+    4481:	c3                   	ret
+    4482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4490:	55                   	push   %ebp
+    4491:	89 e5                	mov    %esp,%ebp
+    4493:	56                   	push   %esi
+    4494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_LOOKUP);
+    4495:	83 ec 08             	sub    $0x8,%esp
+    4498:	6a 04                	push   $0x4
+    449a:	ff 75 08             	push   0x8(%ebp)
+    449d:	e8 f1 00 00 00       	call   4593 <open>
+  if(fd < 0)
+    44a2:	83 c4 10             	add    $0x10,%esp
+    44a5:	85 c0                	test   %eax,%eax
+    44a7:	78 27                	js     44d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    44a9:	83 ec 08             	sub    $0x8,%esp
+    44ac:	ff 75 0c             	push   0xc(%ebp)
+    44af:	89 c3                	mov    %eax,%ebx
+    44b1:	50                   	push   %eax
+    44b2:	e8 f4 00 00 00       	call   45ab <fstat>
+  close(fd);
+    44b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    44ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    44bc:	e8 ba 00 00 00       	call   457b <close>
+  return r;
+    44c1:	83 c4 10             	add    $0x10,%esp
+}
+    44c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    44c7:	89 f0                	mov    %esi,%eax
+    44c9:	5b                   	pop    %ebx
+    44ca:	5e                   	pop    %esi
+    44cb:	5d                   	pop    %ebp
+    44cc:	c3                   	ret
+    44cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    44d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    44d5:	eb ed                	jmp    44c4 <stat+0x34>
+    44d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44de:	66 90                	xchg   %ax,%ax
+
+000044e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    44e0:	55                   	push   %ebp
+    44e1:	89 e5                	mov    %esp,%ebp
+    44e3:	53                   	push   %ebx
+    44e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    44e7:	0f be 02             	movsbl (%edx),%eax
+    44ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    44ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    44f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    44f5:	77 1e                	ja     4515 <atoi+0x35>
+    44f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4500:	83 c2 01             	add    $0x1,%edx
+    4503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    450a:	0f be 02             	movsbl (%edx),%eax
+    450d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4510:	80 fb 09             	cmp    $0x9,%bl
+    4513:	76 eb                	jbe    4500 <atoi+0x20>
+  return n;
+}
+    4515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4518:	89 c8                	mov    %ecx,%eax
+    451a:	c9                   	leave
+    451b:	c3                   	ret
+    451c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4520:	55                   	push   %ebp
+    4521:	89 e5                	mov    %esp,%ebp
+    4523:	57                   	push   %edi
+    4524:	56                   	push   %esi
+    4525:	8b 45 10             	mov    0x10(%ebp),%eax
+    4528:	8b 55 08             	mov    0x8(%ebp),%edx
+    452b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    452e:	85 c0                	test   %eax,%eax
+    4530:	7e 13                	jle    4545 <memmove+0x25>
+    4532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4534:	89 d7                	mov    %edx,%edi
+    4536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    453d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4541:	39 f8                	cmp    %edi,%eax
+    4543:	75 fb                	jne    4540 <memmove+0x20>
+  return vdst;
+}
+    4545:	5e                   	pop    %esi
+    4546:	89 d0                	mov    %edx,%eax
+    4548:	5f                   	pop    %edi
+    4549:	5d                   	pop    %ebp
+    454a:	c3                   	ret
+
+0000454b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    454b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4550:	cd 40                	int    $0x40
+    4552:	c3                   	ret
+
+00004553 <exit>:
+SYSCALL(exit)
+    4553:	b8 02 00 00 00       	mov    $0x2,%eax
+    4558:	cd 40                	int    $0x40
+    455a:	c3                   	ret
+
+0000455b <wait>:
+SYSCALL(wait)
+    455b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4560:	cd 40                	int    $0x40
+    4562:	c3                   	ret
+
+00004563 <pipe>:
+SYSCALL(pipe)
+    4563:	b8 04 00 00 00       	mov    $0x4,%eax
+    4568:	cd 40                	int    $0x40
+    456a:	c3                   	ret
+
+0000456b <read>:
+SYSCALL(read)
+    456b:	b8 05 00 00 00       	mov    $0x5,%eax
+    4570:	cd 40                	int    $0x40
+    4572:	c3                   	ret
+
+00004573 <write>:
+SYSCALL(write)
+    4573:	b8 10 00 00 00       	mov    $0x10,%eax
+    4578:	cd 40                	int    $0x40
+    457a:	c3                   	ret
+
+0000457b <close>:
+SYSCALL(close)
+    457b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4580:	cd 40                	int    $0x40
+    4582:	c3                   	ret
+
+00004583 <kill>:
+SYSCALL(kill)
+    4583:	b8 06 00 00 00       	mov    $0x6,%eax
+    4588:	cd 40                	int    $0x40
+    458a:	c3                   	ret
+
+0000458b <exec>:
+SYSCALL(exec)
+    458b:	b8 07 00 00 00       	mov    $0x7,%eax
+    4590:	cd 40                	int    $0x40
+    4592:	c3                   	ret
+
+00004593 <open>:
+SYSCALL(open)
+    4593:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4598:	cd 40                	int    $0x40
+    459a:	c3                   	ret
+
+0000459b <mknod>:
+SYSCALL(mknod)
+    459b:	b8 11 00 00 00       	mov    $0x11,%eax
+    45a0:	cd 40                	int    $0x40
+    45a2:	c3                   	ret
+
+000045a3 <unlink>:
+SYSCALL(unlink)
+    45a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    45a8:	cd 40                	int    $0x40
+    45aa:	c3                   	ret
+
+000045ab <fstat>:
+SYSCALL(fstat)
+    45ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    45b0:	cd 40                	int    $0x40
+    45b2:	c3                   	ret
+
+000045b3 <link>:
+SYSCALL(link)
+    45b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    45b8:	cd 40                	int    $0x40
+    45ba:	c3                   	ret
+
+000045bb <mkdir>:
+SYSCALL(mkdir)
+    45bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    45c0:	cd 40                	int    $0x40
+    45c2:	c3                   	ret
+
+000045c3 <chdir>:
+SYSCALL(chdir)
+    45c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    45c8:	cd 40                	int    $0x40
+    45ca:	c3                   	ret
+
+000045cb <dup>:
+SYSCALL(dup)
+    45cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    45d0:	cd 40                	int    $0x40
+    45d2:	c3                   	ret
+
+000045d3 <getpid>:
+SYSCALL(getpid)
+    45d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    45d8:	cd 40                	int    $0x40
+    45da:	c3                   	ret
+
+000045db <sbrk>:
+SYSCALL(sbrk)
+    45db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    45e0:	cd 40                	int    $0x40
+    45e2:	c3                   	ret
+
+000045e3 <sleep>:
+SYSCALL(sleep)
+    45e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    45e8:	cd 40                	int    $0x40
+    45ea:	c3                   	ret
+
+000045eb <uptime>:
+SYSCALL(uptime)
+    45eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    45f0:	cd 40                	int    $0x40
+    45f2:	c3                   	ret
+
+000045f3 <symlink>:
+SYSCALL(symlink)
+    45f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    45f8:	cd 40                	int    $0x40
+    45fa:	c3                   	ret
+
+000045fb <sync>:
+SYSCALL(sync)
+    45fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    4600:	cd 40                	int    $0x40
+    4602:	c3                   	ret
+
+00004603 <iostat>:
+SYSCALL(iostat)
+    4603:	b8 18 00 00 00       	mov    $0x18,%eax
+    4608:	cd 40                	int    $0x40
+    460a:	c3                   	ret
+
+0000460b <pipesize>:
+SYSCALL(pipesize)
+    460b:	b8 19 00 00 00       	mov    $0x19,%eax
+    4610:	cd 40                	int    $0x40
+    4612:	c3                   	ret
+
+00004613 <readahead>:
+SYSCALL(readahead)
+    4613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4618:	cd 40                	int    $0x40
+    461a:	c3                   	ret
+
+0000461b <dcstat>:
+SYSCALL(dcstat)
+    461b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4620:	cd 40                	int    $0x40
+    4622:	c3                   	ret
+    4623:	66 90                	xchg   %ax,%ax
+    4625:	66 90                	xchg   %ax,%ax
+    4627:	66 90                	xchg   %ax,%ax
+    4629:	66 90                	xchg   %ax,%ax
+    462b:	66 90                	xchg   %ax,%ax
+    462d:	66 90                	xchg   %ax,%ax
+    462f:	90                   	nop
+
+00004630 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4630:	55                   	push   %ebp
+    4631:	89 e5                	mov    %esp,%ebp
+    4633:	57                   	push   %edi
+    4634:	56                   	push   %esi
+    4635:	53                   	push   %ebx
+    4636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4638:	89 d1                	mov    %edx,%ecx
+{
+    463a:	83 ec 3c             	sub    $0x3c,%esp
+    463d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4640:	85 d2                	test   %edx,%edx
+    4642:	0f 89 80 00 00 00    	jns    46c8 <printint+0x98>
+    4648:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    464c:	74 7a                	je     46c8 <printint+0x98>
+    x = -xx;
+    464e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4650:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4655:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4658:	31 f6                	xor    %esi,%esi
+    465a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4660:	89 c8                	mov    %ecx,%eax
+    4662:	31 d2                	xor    %edx,%edx
+    4664:	89 f7                	mov    %esi,%edi
+    4666:	f7 f3                	div    %ebx
+    4668:	8d 76 01             	lea    0x1(%esi),%esi
+    466b:	0f b6 92 00 65 00 00 	movzbl 0x6500(%edx),%edx
+    4672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4676:	89 ca                	mov    %ecx,%edx
+    4678:	89 c1                	mov    %eax,%ecx
+    467a:	39 da                	cmp    %ebx,%edx
+    467c:	73 e2                	jae    4660 <printint+0x30>
+  if(neg)
+    467e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4681:	85 c0                	test   %eax,%eax
+    4683:	74 07                	je     468c <printint+0x5c>
+    buf[i++] = '-';
+    4685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    468a:	89 f7                	mov    %esi,%edi
+    468c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    468f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4692:	01 df                	add    %ebx,%edi
+    4694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4698:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    469b:	83 ec 04             	sub    $0x4,%esp
+    469e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    46a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    46a4:	6a 01                	push   $0x1
+    46a6:	50                   	push   %eax
+    46a7:	56                   	push   %esi
+    46a8:	e8 c6 fe ff ff       	call   4573 <write>
+  while(--i >= 0)
+    46ad:	89 f8                	mov    %edi,%eax
+    46af:	83 c4 10             	add    $0x10,%esp
+    46b2:	83 ef 01             	sub    $0x1,%edi
+    46b5:	39 d8                	cmp    %ebx,%eax
+    46b7:	75 df                	jne    4698 <printint+0x68>
+}
+    46b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    46bc:	5b                   	pop    %ebx
+    46bd:	5e                   	pop    %esi
+    46be:	5f                   	pop    %edi
+    46bf:	5d                   	pop    %ebp
+    46c0:	c3                   	ret
+    46c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    46c8:	31 c0                	xor    %eax,%eax
+    46ca:	eb 89                	jmp    4655 <printint+0x25>
+    46cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000046d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    46d0:	55                   	push   %ebp
+    46d1:	89 e5                	mov    %esp,%ebp
+    46d3:	57                   	push   %edi
+    46d4:	56                   	push   %esi
+    46d5:	53                   	push   %ebx
+    46d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    46d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    46dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    46df:	0f b6 1e             	movzbl (%esi),%ebx
+    46e2:	83 c6 01             	add    $0x1,%esi
+    46e5:	84 db                	test   %bl,%bl
+    46e7:	74 67                	je     4750 <printf+0x80>
+    46e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    46ec:	31 d2                	xor    %edx,%edx
+    46ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    46f1:	eb 34                	jmp    4727 <printf+0x57>
+    46f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    46f7:	90                   	nop
+    46f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    46fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4700:	83 f8 25             	cmp    $0x25,%eax
+    4703:	74 18                	je     471d <printf+0x4d>
+  write(fd, &c, 1);
+    4705:	83 ec 04             	sub    $0x4,%esp
+    4708:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    470b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    470e:	6a 01                	push   $0x1
+    4710:	50                   	push   %eax
+    4711:	57                   	push   %edi
+    4712:	e8 5c fe ff ff       	call   4573 <write>
+    4717:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    471a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    471d:	0f b6 1e             	movzbl (%esi),%ebx
+    4720:	83 c6 01             	add    $0x1,%esi
+    4723:	84 db                	test   %bl,%bl
+    4725:	74 29                	je     4750 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4727:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    472a:	85 d2                	test   %edx,%edx
+    472c:	74 ca                	je     46f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    472e:	83 fa 25             	cmp    $0x25,%edx
+    4731:	75 ea                	jne    471d <printf+0x4d>
+      if(c == 'd'){
+    4733:	83 f8 25             	cmp    $0x25,%eax
+    4736:	0f 84 24 01 00 00    	je     4860 <printf+0x190>
+    473c:	83 e8 63             	sub    $0x63,%eax
+    473f:	83 f8 15             	cmp    $0x15,%eax
+    4742:	77 1c                	ja     4760 <printf+0x90>
+    4744:	ff 24 85 a8 64 00 00 	jmp    *0x64a8(,%eax,4)
+    474b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    474f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4753:	5b                   	pop    %ebx
+    4754:	5e                   	pop    %esi
+    4755:	5f                   	pop    %edi
+    4756:	5d                   	pop    %ebp
+    4757:	c3                   	ret
+    4758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    475f:	90                   	nop
+  write(fd, &c, 1);
+    4760:	83 ec 04             	sub    $0x4,%esp
+    4763:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4766:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    476a:	6a 01                	push   $0x1
+    476c:	52                   	push   %edx
+    476d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4770:	57                   	push   %edi
+    4771:	e8 fd fd ff ff       	call   4573 <write>
+    4776:	83 c4 0c             	add    $0xc,%esp
+    4779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    477c:	6a 01                	push   $0x1
+    477e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4781:	52                   	push   %edx
+    4782:	57                   	push   %edi
+    4783:	e8 eb fd ff ff       	call   4573 <write>
+        putc(fd, c);
+    4788:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    478b:	31 d2                	xor    %edx,%edx
+    478d:	eb 8e                	jmp    471d <printf+0x4d>
+    478f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4793:	83 ec 0c             	sub    $0xc,%esp
+    4796:	b9 10 00 00 00       	mov    $0x10,%ecx
+    479b:	8b 13                	mov    (%ebx),%edx
+    479d:	6a 00                	push   $0x0
+    479f:	89 f8                	mov    %edi,%eax
+        ap++;
+    47a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    47a4:	e8 87 fe ff ff       	call   4630 <printint>
+        ap++;
+    47a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    47ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    47af:	31 d2                	xor    %edx,%edx
+    47b1:	e9 67 ff ff ff       	jmp    471d <printf+0x4d>
+    47b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    47c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    47c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    47c5:	83 c0 04             	add    $0x4,%eax
+    47c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    47cb:	85 db                	test   %ebx,%ebx
+    47cd:	0f 84 9d 00 00 00    	je     4870 <printf+0x1a0>
+        while(*s != 0){
+    47d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    47d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    47d8:	84 c0                	test   %al,%al
+    47da:	0f 84 3d ff ff ff    	je     471d <printf+0x4d>
+    47e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    47e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    47e6:	89 de                	mov    %ebx,%esi
+    47e8:	89 d3                	mov    %edx,%ebx
+    47ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    47f0:	83 ec 04             	sub    $0x4,%esp
+    47f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    47f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    47f9:	6a 01                	push   $0x1
+    47fb:	53                   	push   %ebx
+    47fc:	57                   	push   %edi
+    47fd:	e8 71 fd ff ff       	call   4573 <write>
+        while(*s != 0){
+    4802:	0f b6 06             	movzbl (%esi),%eax
+    4805:	83 c4 10             	add    $0x10,%esp
+    4808:	84 c0                	test   %al,%al
+    480a:	75 e4                	jne    47f0 <printf+0x120>
+      state = 0;
+    480c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    480f:	31 d2                	xor    %edx,%edx
+    4811:	e9 07 ff ff ff       	jmp    471d <printf+0x4d>
+    4816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    481d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4823:	83 ec 0c             	sub    $0xc,%esp
+    4826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    482b:	8b 13                	mov    (%ebx),%edx
+    482d:	6a 01                	push   $0x1
+    482f:	e9 6b ff ff ff       	jmp    479f <printf+0xcf>
+    4834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4838:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    483b:	83 ec 04             	sub    $0x4,%esp
+    483e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4841:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4843:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4846:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4849:	6a 01                	push   $0x1
+    484b:	52                   	push   %edx
+    484c:	57                   	push   %edi
+    484d:	e8 21 fd ff ff       	call   4573 <write>
+        ap++;
+    4852:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4855:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4858:	31 d2                	xor    %edx,%edx
+    485a:	e9 be fe ff ff       	jmp    471d <printf+0x4d>
+    485f:	90                   	nop
+  write(fd, &c, 1);
+    4860:	83 ec 04             	sub    $0x4,%esp
+    4863:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4866:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4869:	6a 01                	push   $0x1
+    486b:	e9 11 ff ff ff       	jmp    4781 <printf+0xb1>
+    4870:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4875:	bb 9e 64 00 00       	mov    $0x649e,%ebx
+    487a:	e9 61 ff ff ff       	jmp    47e0 <printf+0x110>
+    487f:	90                   	nop
+
+00004880 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4880:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4881:	a1 60 b6 00 00       	mov    0xb660,%eax
+{
+    4886:	89 e5                	mov    %esp,%ebp
+    4888:	57                   	push   %edi
+    4889:	56                   	push   %esi
+    488a:	53                   	push   %ebx
+    488b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    488e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4898:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    489a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    489c:	39 ca                	cmp    %ecx,%edx
+    489e:	73 30                	jae    48d0 <free+0x50>
+    48a0:	39 c1                	cmp    %eax,%ecx
+    48a2:	72 04                	jb     48a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    48a4:	39 c2                	cmp    %eax,%edx
+    48a6:	72 f0                	jb     4898 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    48a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    48ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    48ae:	39 f8                	cmp    %edi,%eax
+    48b0:	74 2e                	je     48e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    48b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    48b5:	8b 42 04             	mov    0x4(%edx),%eax
+    48b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    48bb:	39 f1                	cmp    %esi,%ecx
+    48bd:	74 38                	je     48f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    48bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    48c1:	5b                   	pop    %ebx
+  freep = p;
+    48c2:	89 15 60 b6 00 00    	mov    %edx,0xb660
+}
+    48c8:	5e                   	pop    %esi
+    48c9:	5f                   	pop    %edi
+    48ca:	5d                   	pop    %ebp
+    48cb:	c3                   	ret
+    48cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    48d0:	39 c1                	cmp    %eax,%ecx
+    48d2:	72 d0                	jb     48a4 <free+0x24>
+    48d4:	eb c2                	jmp    4898 <free+0x18>
+    48d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    48e0:	03 70 04             	add    0x4(%eax),%esi
+    48e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    48e6:	8b 02                	mov    (%edx),%eax
+    48e8:	8b 00                	mov    (%eax),%eax
+    48ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    48ed:	8b 42 04             	mov    0x4(%edx),%eax
+    48f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    48f3:	39 f1                	cmp    %esi,%ecx
+    48f5:	75 c8                	jne    48bf <free+0x3f>
+    p->s.size += bp->s.size;
+    48f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    48fa:	89 15 60 b6 00 00    	mov    %edx,0xb660
+    p->s.size += bp->s.size;
+    4900:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4903:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4906:	89 0a                	mov    %ecx,(%edx)
+}
+    4908:	5b                   	pop    %ebx
+    4909:	5e                   	pop    %esi
+    490a:	5f                   	pop    %edi
+    490b:	5d                   	pop    %ebp
+    490c:	c3                   	ret
+    490d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004910 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4910:	55                   	push   %ebp
+    4911:	89 e5                	mov    %esp,%ebp
+    4913:	57                   	push   %edi
+    4914:	56                   	push   %esi
+    4915:	53                   	push   %ebx
+    4916:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4919:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    491c:	8b 15 60 b6 00 00    	mov    0xb660,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4922:	8d 78 07             	lea    0x7(%eax),%edi
+    4925:	c1 ef 03             	shr    $0x3,%edi
+    4928:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    492b:	85 d2                	test   %edx,%edx
+    492d:	0f 84 8d 00 00 00    	je     49c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4933:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4935:	8b 48 04             	mov    0x4(%eax),%ecx
+    4938:	39 f9                	cmp    %edi,%ecx
+    493a:	73 64                	jae    49a0 <malloc+0x90>
+  if(nu < 4096)
+    493c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4941:	39 df                	cmp    %ebx,%edi
+    4943:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4946:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    494d:	eb 0a                	jmp    4959 <malloc+0x49>
+    494f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4950:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4952:	8b 48 04             	mov    0x4(%eax),%ecx
+    4955:	39 f9                	cmp    %edi,%ecx
+    4957:	73 47                	jae    49a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4959:	89 c2                	mov    %eax,%edx
+    495b:	39 05 60 b6 00 00    	cmp    %eax,0xb660
+    4961:	75 ed                	jne    4950 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4963:	83 ec 0c             	sub    $0xc,%esp
+    4966:	56                   	push   %esi
+    4967:	e8 6f fc ff ff       	call   45db <sbrk>
+  if(p == (char*)-1)
+    496c:	83 c4 10             	add    $0x10,%esp
+    496f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4972:	74 1c                	je     4990 <malloc+0x80>
+  hp->s.size = nu;
+    4974:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4977:	83 ec 0c             	sub    $0xc,%esp
+    497a:	83 c0 08             	add    $0x8,%eax
+    497d:	50                   	push   %eax
+    497e:	e8 fd fe ff ff       	call   4880 <free>
+  return freep;
+    4983:	8b 15 60 b6 00 00    	mov    0xb660,%edx
+      if((p = morecore(nunits)) == 0)
+    4989:	83 c4 10             	add    $0x10,%esp
+    498c:	85 d2                	test   %edx,%edx
+    498e:	75 c0                	jne    4950 <malloc+0x40>
+        return 0;
+  }
+}
+    4990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4993:	31 c0                	xor    %eax,%eax
+}
+    4995:	5b                   	pop    %ebx
+    4996:	5e                   	pop    %esi
+    4997:	5f                   	pop    %edi
+    4998:	5d                   	pop    %ebp
+    4999:	c3                   	ret
+    499a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    49a0:	39 cf                	cmp    %ecx,%edi
+    49a2:	74 4c                	je     49f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    49a4:	29 f9                	sub    %edi,%ecx
+    49a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    49a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    49ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    49af:	89 15 60 b6 00 00    	mov    %edx,0xb660
+}
+    49b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    49b8:	83 c0 08             	add    $0x8,%eax
+}
+    49bb:	5b                   	pop    %ebx
+    49bc:	5e                   	pop    %esi
+    49bd:	5f                   	pop    %edi
+    49be:	5d                   	pop    %ebp
+    49bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    49c0:	c7 05 60 b6 00 00 64 	movl   $0xb664,0xb660
+    49c7:	b6 00 00 
+    base.s.size = 0;
+    49ca:	b8 64 b6 00 00       	mov    $0xb664,%eax
+    base.s.ptr = freep = prevp = &base;
+    49cf:	c7 05 64 b6 00 00 64 	movl   $0xb664,0xb664
+    49d6:	b6 00 00 
+    base.s.size = 0;
+    49d9:	c7 05 68 b6 00 00 00 	movl   $0x0,0xb668
+    49e0:	00 00 00 
+    if(p->s.size >= nunits){
+    49e3:	e9 54 ff ff ff       	jmp    493c <malloc+0x2c>
+    49e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    49f0:	8b 08                	mov    (%eax),%ecx
+    49f2:	89 0a                	mov    %ecx,(%edx)
+    49f4:	eb b9                	jmp    49af <malloc+0x9f>
@@ -354,6 +354,112 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// big pipe: page-aligned writes and reads go through
+// the zero-copy path, and the writer scribbling on its
+// buffer afterwards must not change what the reader sees.
+void
+pipebig(void)
+{
+  int fds[2], pid, i, j, k, n, t0;
+  char *p, *wbuf, *rbuf;
+
+  printf(1, "pipebig test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(pipesize(fds[1], 65536) != 65536 || pipesize(fds[0], 1) != 512 ||
+     pipesize(fds[0], 60000) != 65536){
+    printf(1, "pipesize failed\n");
+    exit();
+  }
+  p = sbrk(17*4096);
+  p = (char*)(((uint)p + 4095) & ~4095);
+  wbuf = rbuf = p;
+
+  t0 = uptime();
+  pid = fork();
+  if(pid == 0){
+    close(fds[0]);
+    for(i = 0; i < 256; i++){
+      for(j = 0; j < 4; j++)
+        memset(wbuf + j*4096, i*4 + j, 4096);
+      if(write(fds[1], wbuf, 4*4096) != 4*4096){
+        printf(1, "pipebig write failed\n");
+        exit();
+      }
+      memset(wbuf, 0xff, 4*4096);
+    }
+    exit();
+  } else if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  close(fds[1]);
+  i = 0;
+  while((n = read(fds[0], rbuf, 16*4096)) > 0){
+    for(j = 0; j < n; j++){
+      if((rbuf[j] & 0xff) != ((i + j) / 4096 & 0xff)){
+        printf(1, "pipebig oops at %d\n", i + j);
+        exit();
+      }
+    }
+    i += n;
+  }
+  close(fds[0]);
+  wait();
+  if(i != 1024*4096){
+    printf(1, "pipebig total %d\n", i);
+    exit();
+  }
+  printf(1, "pipebig ok, 4MB in %d ticks\n", uptime() - t0);
+
+  // Odd-sized writes and reads, so that the writer catches up
+  // with the reader in the middle of a ring page.
+  for(k = 4096; k <= 65536; k *= 16){
+    if(pipe(fds) != 0 || pipesize(fds[1], k) != k){
+      printf(1, "pipe() failed\n");
+      exit();
+    }
+    pid = fork();
+    if(pid == 0){
+      close(fds[0]);
+      for(i = 0; i < 300000; i += n){
+        n = 300000 - i < 1000 ? 300000 - i : 1000;
+        for(j = 0; j < n; j++)
+          wbuf[j] = (i + j) % 251;
+        if(write(fds[1], wbuf, n) != n){
+          printf(1, "pipebig odd write failed\n");
+          exit();
+        }
+      }
+      exit();
+    } else if(pid < 0){
+      printf(1, "fork() failed\n");
+      exit();
+    }
+    close(fds[1]);
+    i = 0;
+    while((n = read(fds[0], rbuf, 777)) > 0){
+      for(j = 0; j < n; j++){
+        if((rbuf[j] & 0xff) != (i + j) % 251){
+          printf(1, "pipebig odd oops at %d\n", i + j);
+          exit();
+        }
+      }
+      i += n;
+    }
+    close(fds[0]);
+    wait();
+    if(i != 300000){
+      printf(1, "pipebig odd total %d\n", i);
+      exit();
+    }
+  }
+  sbrk(-17*4096);
+  printf(1, "pipebig odd sizes ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -760,6 +866,234 @@ linktest(void)
   printf(1, "linktest ok\n");
 }
 
+// symlink targets short enough to live in the inode and
+// ones long enough to spill to a data block.
+void
+symlinktest(void)
+{
+  char target[100];
+  struct stat st;
+  int fd, i, n;
+
+  printf(1, "symlinktest\n");
+
+  unlink("sl0");
+  unlink("sl1");
+  unlink("sl2");
+
+  fd = open("sl0", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "hello", 5) != 5){
+    printf(1, "create sl0 failed\n");
+    exit();
+  }
+  close(fd);
+
+  n = 0;
+  for(i = 0; i < 40; i++){
+    target[n++] = '.';
+    target[n++] = '/';
+  }
+  strcpy(target + n, "sl0");
+  if(symlink("sl0", "sl1") < 0 || symlink(target, "sl2") < 0){
+    printf(1, "symlink failed\n");
+    exit();
+  }
+  if(symlink("sl0", "sl1") >= 0){
+    printf(1, "symlink over sl1 succeeded! oops\n");
+    exit();
+  }
+
+  fd = open("sl2", O_LOOKUP);
+  if(fd < 0 || fstat(fd, &st) < 0 || st.size != strlen(target)){
+    printf(1, "stat sl2 failed\n");
+    exit();
+  }
+  close(fd);
+  if(open("sl1", O_LOOKUP|O_RDWR) >= 0 || open("sl1", O_LOOKUP|O_WRONLY) >= 0){
+    printf(1, "open symlink for writing succeeded! oops\n");
+    exit();
+  }
+
+  for(i = 0; i < 2; i++){
+    fd = open(i ? "sl2" : "sl1", O_RDONLY);
+    if(fd < 0){
+      printf(1, "open through symlink failed\n");
+      exit();
+    }
+    if(read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+      printf(1, "read through symlink failed\n");
+      exit();
+    }
+    close(fd);
+  }
+
+  // chains, links in the middle of a path, and loops.
+  if(symlink("sl1", "sl3") < 0 || mkdir("sld") < 0 ||
+     symlink("../sld", "sld/up") < 0 || symlink("sld/up/up", "sl4") < 0){
+    printf(1, "symlink failed\n");
+    exit();
+  }
+  fd = open("sld/f", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "world", 5) != 5){
+    printf(1, "create sld/f failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("sl3", O_RDONLY);
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'h'){
+    printf(1, "read through symlink chain failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("sl4/f", O_RDONLY);
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 5 || buf[0] != 'w'){
+    printf(1, "read through symlinked directory failed\n");
+    exit();
+  }
+  close(fd);
+  if(symlink("sl6", "sl5") < 0 || symlink("sl5", "sl6") < 0){
+    printf(1, "symlink failed\n");
+    exit();
+  }
+  if(open("sl5", O_RDONLY) >= 0){
+    printf(1, "open through symlink loop succeeded! oops\n");
+    exit();
+  }
+
+  unlink("sl6");
+  unlink("sl5");
+  unlink("sl4");
+  unlink("sld/up");
+  unlink("sld/f");
+  unlink("sld");
+  unlink("sl3");
+  unlink("sl2");
+  unlink("sl1");
+  unlink("sl0");
+  printf(1, "symlinktest ok\n");
+}
+
+// extent-mapped files: more extents than fit in the inode or
+// in one extent block, and freeing them all.
+void
+exttest(void)
+{
+  int fd, fd1, i, j, n, pass;
+
+  printf(1, "exttest\n");
+
+  for(pass = 0; pass < 2; pass++){
+    unlink("ext");
+    unlink("extfill");
+    fd = open("ext", O_CREATE|O_RDWR|O_EXTENT);
+    fd1 = open("extfill", O_CREATE|O_RDWR);
+    if(fd < 0 || fd1 < 0){
+      printf(1, "create ext failed\n");
+      exit();
+    }
+    // Interleave with another file, so that each block of ext
+    // starts a new extent.
+    for(n = 0; n < 200; n++){
+      memset(buf, n, BSIZE);
+      if(write(fd, buf, BSIZE) != BSIZE){
+        printf(1, "write ext failed at block %d\n", n);
+        exit();
+      }
+      if(write(fd1, buf, BSIZE) != BSIZE){
+        printf(1, "write extfill failed\n");
+        exit();
+      }
+    }
+    close(fd);
+    close(fd1);
+
+    fd = open("ext", O_RDONLY);
+    if(fd < 0){
+      printf(1, "open ext failed\n");
+      exit();
+    }
+    for(i = 0; i < n; i++){
+      if(read(fd, buf, BSIZE) != BSIZE){
+        printf(1, "read ext failed\n");
+        exit();
+      }
+      for(j = 0; j < BSIZE; j++){
+        if(buf[j] != (char)i){
+          printf(1, "ext oops at block %d\n", i);
+          exit();
+        }
+      }
+    }
+    if(read(fd, buf, BSIZE) != 0){
+      printf(1, "read past end of ext\n");
+      exit();
+    }
+    close(fd);
+    if(unlink("ext") < 0 || unlink("extfill") < 0){
+      printf(1, "unlink ext failed\n");
+      exit();
+    }
+  }
+  printf(1, "exttest ok\n");
+}
+
+// tiny files live in the inode until they grow out of it.
+void
+inlinetest(void)
+{
+  int fd, i, n;
+
+  printf(1, "inlinetest\n");
+
+  unlink("inl");
+  fd = open("inl", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create inl failed\n");
+    exit();
+  }
+  for(i = 0; i < 40; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, 20) != 20 || write(fd, buf + 20, 20) != 20){
+    printf(1, "write inl failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("inl", O_RDWR);
+  if(fd < 0 || read(fd, buf + 100, 100) != 40){
+    printf(1, "read inline inl failed\n");
+    exit();
+  }
+  for(i = 0; i < 40; i++){
+    if(buf[100 + i] != buf[i]){
+      printf(1, "inline inl oops at %d\n", i);
+      exit();
+    }
+  }
+  for(i = 40; i < 600; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf + 40, 560) != 560){
+    printf(1, "write to grow inl failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("inl", O_RDONLY);
+  if(fd < 0 || (n = read(fd, buf + 1000, 1000)) != 600){
+    printf(1, "read grown inl failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(buf[1000 + i] != 'a' + i % 26){
+      printf(1, "inl oops at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("inl");
+  printf(1, "inlinetest ok\n");
+}
+
 // test concurrent create/link/unlink of the same file
 void
 concreate(void)
@@ -931,6 +1265,70 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// Time lookups in a directory big enough to be hashed.
+void
+dirbench(void)
+{
+  int i, j, fd, t0, t1, t2;
+  char name[10];
+
+  printf(1, "dirbench test\n");
+  unlink("db");
+
+  fd = open("db", O_CREATE);
+  if(fd < 0){
+    printf(1, "dirbench create failed\n");
+    exit();
+  }
+  close(fd);
+
+  t0 = uptime();
+  for(i = 0; i < 1000; i++){
+    name[0] = 'y';
+    name[1] = '0' + (i / 100);
+    name[2] = '0' + (i / 10) % 10;
+    name[3] = '0' + (i % 10);
+    name[4] = '\0';
+    if(link("db", name) != 0){
+      printf(1, "dirbench link failed\n");
+      exit();
+    }
+  }
+  t1 = uptime();
+  for(j = 0; j < 10; j++){
+    for(i = 0; i < 1000; i++){
+      name[0] = 'y';
+      name[1] = '0' + (i / 100);
+      name[2] = '0' + (i / 10) % 10;
+      name[3] = '0' + (i % 10);
+      name[4] = '\0';
+      if((fd = open(name, O_RDONLY)) < 0){
+        printf(1, "dirbench open failed\n");
+        exit();
+      }
+      close(fd);
+    }
+  }
+  t2 = uptime();
+
+  unlink("db");
+  for(i = 0; i < 1000; i++){
+    name[0] = 'y';
+    name[1] = '0' + (i / 100);
+    name[2] = '0' + (i / 10) % 10;
+    name[3] = '0' + (i % 10);
+    name[4] = '\0';
+    if(unlink(name) != 0){
+      printf(1, "dirbench unlink failed\n");
+      exit();
+    }
+  }
+
+  printf(1, "dirbench: 1000 links %d ticks, 10000 opens %d ticks\n",
+         t1 - t0, t2 - t1);
+  printf(1, "dirbench ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1347,7 +1745,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 was NINODE, back when the inode cache was fixed
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1781,6 +2179,7 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipebig();
   preempt();
   exitwait();
 
@@ -1789,11 +2188,15 @@ main(int argc, char *argv[])
   bigfile();
   subdir();
   linktest();
+  symlinktest();
+  inlinetest();
+  exttest();
   unlinkread();
   dirfile();
   iref();
   forktest();
   bigdir(); // slow
+  dirbench(); // slow
 
   uio();
 
@@ -311,39 +311,171 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  Pages are not copied: writable pages
+// become read-only PTE_COW pages shared by parent and child,
+// and cowuvm() copies them on the first write.  Heap pages
+// that lazyuvm() has not allocated yet stay unmapped.
+// pgdir must be the current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    }
+    kincref(P2V(pa));
   }
+  lcr3(V2P(pgdir));  // parent's writable pages are now read-only
   return d;
 
 bad:
+  lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Give pgdir its own writable copy of the copy-on-write page
+// at user virtual address va.  The last page table sharing a
+// page just takes it over.  Returns 0 on success, -1 if va is
+// not a copy-on-write page or memory ran out.  The caller must
+// flush the TLB if pgdir is the current page table.
+int
+cowuvm(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)PGROUNDDOWN(va), 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcnt(P2V(pa)) == 1){
+    *pte = pa | flags;
+    return 0;
+  }
+  if((mem = kalloc()) == 0)
+    return -1;
+  memmove(mem, (char*)P2V(pa), PGSIZE);
+  *pte = V2P(mem) | flags;
+  kfree(P2V(pa));
+  return 0;
+}
+
+// Map a zeroed page at user virtual address va, which lies in
+// the heap that growproc() reserved but did not allocate.
+// Returns 0 on success, -1 if va is outside the first sz bytes,
+// is already mapped, or memory ran out.
+int
+lazyuvm(pde_t *pgdir, uint va, uint sz)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Make the page at user virtual address va present, and writable
+// if write is set, before a system call touches it: a page fault
+// in the kernel that runs out of memory could only panic.
+// Returns -1 if va is outside the first sz bytes or memory ran out.
+// pgdir must be the current page table.
+int
+touchuvm(pde_t *pgdir, uint va, uint sz, int write)
+{
+  pte_t *pte;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)PGROUNDDOWN(va), 0);
+  if(pte == 0 || !(*pte & PTE_P))
+    return lazyuvm(pgdir, va, sz);
+  if(write && (*pte & PTE_COW)){
+    if(cowuvm(pgdir, va) < 0)
+      return -1;
+    lcr3(V2P(pgdir));
+  }
+  return 0;
+}
+
+// Lend the user page at page-aligned va to the kernel: make it
+// copy-on-write in pgdir and return its kernel address with an
+// extra reference for the borrower.  Returns 0 if va is not a
+// present user page.  pgdir must be the current page table.
+char*
+lenduvm(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(va % PGSIZE || va >= KERNBASE)
+    return 0;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+    return 0;
+  if(*pte & PTE_W){
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+    invlpg((void*)va);
+  }
+  mem = P2V(PTE_ADDR(*pte));
+  kincref(mem);
+  return mem;
+}
+
+// Map the page at kernel address mem copy-on-write at page-aligned
+// user virtual address va, in place of whatever page was there,
+// handing the caller's reference to pgdir.  va must lie in the first
+// sz bytes, in a page the user may write.  Returns 0 on success, -1
+// otherwise.  pgdir must be the current page table.
+int
+mapuvm(pde_t *pgdir, uint va, char *mem, uint sz)
+{
+  pte_t *pte;
+
+  if(va % PGSIZE || va >= sz || va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (char*)va, 1)) == 0)
+    return -1;
+  if(*pte & PTE_P){
+    if((*pte & PTE_U) == 0 || (*pte & (PTE_W|PTE_COW)) == 0)
+      return -1;
+    kfree(P2V(PTE_ADDR(*pte)));
+  }
+  *pte = V2P(mem) | PTE_P | PTE_U | PTE_COW;
+  invlpg((void*)va);
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +484,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -367,10 +499,14 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowuvm(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;